@@ -78,3 +78,14 @@ class TestPyVeloxArrow(unittest.TestCase):
         # vector = to_velox(pyarrow.array([]))
         # self.assertEqual(vector.size(), 0)
         pass
+
+    def test_pycapsule_interface(self):
+        array = pyarrow.array([1, 2, None, 4])
+        vector = to_velox(array)
+
+        # pyarrow imports the vector through __arrow_c_array__.
+        self.assertEqual(pyarrow.array(vector), array)
+        schema_type = pyarrow.DataType._import_from_c_capsule(
+            vector.__arrow_c_schema__()
+        )
+        self.assertEqual(schema_type, pyarrow.int64())
@@ -79,6 +79,27 @@ class TestPyVeloxRunner(unittest.TestCase):
             total_size += vector.size()
         self.assertEqual(total_size, 100)
 
+    def test_runner_arrow_stream(self):
+        vectors = []
+        batch_size = 10
+        num_batches = 10
+
+        for i in range(num_batches):
+            array = pyarrow.array(list(range(i * batch_size, (i + 1) * batch_size)))
+            batch = pyarrow.record_batch([array], names=["c0"])
+            vectors.append(to_velox(batch))
+
+        plan_builder = PlanBuilder().values(vectors)
+        runner = LocalRunner(plan_builder.get_plan_node())
+
+        reader = pyarrow.RecordBatchReader.from_stream(runner)
+        table = reader.read_all()
+        self.assertEqual(table.num_rows, 100)
+        self.assertEqual(sorted(table.column("c0").to_pylist()), list(range(100)))
+
+        # The runner can only be executed once.
+        self.assertRaises(RuntimeError, runner.execute)
+
     def test_runner_with_values_order_limit(self):
         vectors = []
         batch_size = 10
@@ -38,6 +38,16 @@ int main(int argc, char** argv) {
       vectorSize, [](auto /*row*/) { return "$"; });
   auto validDoubleStringInput = vectorMaker.flatVector<std::string>(
       vectorSize, [](auto row) { return fmt::format("{}.12345678910", row); });
+  auto shortDoubleStringInput = vectorMaker.flatVector<std::string>(
+      vectorSize, [](auto row) { return fmt::format("-{}.25", row); });
+  auto validBigintStringInput = vectorMaker.flatVector<std::string>(
+      vectorSize, [](auto row) {
+        return std::to_string(1'234'567'890'123LL * (row + 1));
+      });
+  auto longBigintStringInput = vectorMaker.flatVector<std::string>(
+      vectorSize, [](auto row) {
+        return std::to_string(std::numeric_limits<int64_t>::max() - row);
+      });
   auto validNaNInput = vectorMaker.flatVector<std::string>(
       vectorSize, [](auto /*row*/) { return "NaN"; });
   auto validInfinityInput = vectorMaker.flatVector<std::string>(
@@ -130,18 +140,22 @@ int main(int argc, char** argv) {
           "cast_varchar_as_double",
           vectorMaker.rowVector(
               {"valid",
+               "short",
                "valid_nan",
                "valid_infinity",
                "invalid_nan",
                "invalid_infinity",
                "space"},
               {validDoubleStringInput,
+               shortDoubleStringInput,
                validNaNInput,
                validInfinityInput,
                invalidNaNInput,
                invalidInfinityInput,
                spaceInput}))
       .addExpression("cast_valid", "cast (valid as double)")
+      .addExpression("cast_short", "cast (short as double)")
+      .addExpression("cast_short_as_real", "cast (short as real)")
       .addExpression("cast_valid_nan", "cast (valid_nan as double)")
       .addExpression("cast_valid_infinity", "cast (valid_infinity as double)")
       .addExpression("try_cast_invalid_nan", "try_cast (invalid_nan as double)")
@@ -149,6 +163,16 @@ int main(int argc, char** argv) {
           "try_cast_invalid_infinity", "try_cast (invalid_infinity as double)")
       .addExpression("try_cast_space", "try_cast (space as double)");
 
+  benchmarkBuilder
+      .addBenchmarkSet(
+          "cast_varchar_as_bigint",
+          vectorMaker.rowVector(
+              {"valid", "long", "invalid"},
+              {validBigintStringInput, longBigintStringInput, invalidInput}))
+      .addExpression("cast_valid", "cast (valid as bigint)")
+      .addExpression("cast_long", "cast (long as bigint)")
+      .addExpression("try_cast_invalid", "try_cast (invalid as bigint)");
+
   benchmarkBuilder
       .addBenchmarkSet(
           "cast",
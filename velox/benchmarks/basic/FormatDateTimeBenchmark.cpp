@@ -42,6 +42,23 @@ int main(int argc, char** argv) {
       .addExpression("", "format_datetime(c0, 'yyyy-MM-dd HH:mm:ss.SSS')")
       .disableTesting();
 
+  // Seconds since epoch in recent years, formatted in time zones with and
+  // without daylight saving time.
+  auto seconds = vectorMaker.flatVector<double>(
+      options.vectorSize, [](auto row) { return 1'600'000'000 + row * 3'607; });
+  benchmarkBuilder
+      .addBenchmarkSet(
+          "Benchmark format_datetime with time zone",
+          vectorMaker.rowVector({seconds}))
+      .addExpression(
+          "utc",
+          "format_datetime(from_unixtime(c0, 'UTC'), 'yyyy-MM-dd HH:mm:ss')")
+      .addExpression(
+          "los_angeles",
+          "format_datetime(from_unixtime(c0, 'America/Los_Angeles'), "
+          "'yyyy-MM-dd HH:mm:ss')")
+      .disableTesting();
+
   benchmarkBuilder.registerBenchmarks();
   folly::runBenchmarks();
   return 0;
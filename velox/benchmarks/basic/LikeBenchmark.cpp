@@ -117,6 +117,21 @@ int main(int argc, char** argv) {
           "generic", vectorMaker.rowVector({"col0"}, {substringInput}))
       .addExpression("generic", R"(like(col0, '%a%b%c'))");
 
+  // An OR of LIKE patterns over the same column is evaluated as a single
+  // multi-pattern search.
+  benchmarkBuilder
+      .addBenchmarkSet(
+          "multi_pattern", vectorMaker.rowVector({"col0"}, {substringInput}))
+      .addExpression(
+          "like_any",
+          R"(like(col0, '%a\_b\_c%', '\') or like(col0, 'xxxa%') or )"
+          R"(like(col0, '%cxx') or like(col0, '%zzz%') or like(col0, 'yyy%'))")
+      .addExpression(
+          "strpos_any",
+          "strpos(col0, 'a_b_c') > 0 or starts_with(col0, 'xxxa') or "
+          "ends_with(col0, 'cxx') or strpos(col0, 'zzz') > 0 or "
+          "starts_with(col0, 'yyy')");
+
   benchmarkBuilder.registerBenchmarks();
   benchmarkBuilder.testBenchmarks();
   folly::runBenchmarks();
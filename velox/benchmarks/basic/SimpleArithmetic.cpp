@@ -62,6 +62,27 @@ struct MultiplyNullOutputFunction {
   }
 };
 
+// Provides callBatch() to evaluate flat inputs without nulls.
+template <typename T>
+struct MultiplyBatchFunction {
+  template <typename TInput>
+  FOLLY_ALWAYS_INLINE void
+  call(TInput& result, const TInput& a, const TInput& b) {
+    result = functions::multiply(a, b);
+  }
+
+  template <typename TInput>
+  void callBatch(
+      TInput* result,
+      int32_t numRows,
+      const TInput* a,
+      const TInput* b) {
+    for (auto i = 0; i < numRows; ++i) {
+      result[i] = functions::multiply(a[i], b[i]);
+    }
+  }
+};
+
 // Checked vs. Unchecked Arithmetic.
 template <typename T>
 struct PlusFunction {
@@ -91,6 +112,8 @@ class SimpleArithmeticBenchmark
         {"multiply_nullable_output"});
     registerFunction<MultiplyNullOutputFunction, double, double, double>(
         {"multiply_null_output"});
+    registerFunction<MultiplyBatchFunction, double, double, double>(
+        {"multiply_batch"});
 
     registerFunction<PlusFunction, int64_t, int64_t, int64_t>({"plus"});
     registerFunction<CheckedPlusFunction, int64_t, int64_t, int64_t>(
@@ -218,6 +241,25 @@ BENCHMARK(multiplyOutputAlwaysNullSmall) {
 
 BENCHMARK_DRAW_LINE();
 
+// Per row evaluation vs. dense loop over call() vs. callBatch().
+BENCHMARK(multiplyPerRowSmall) {
+  benchmark->runSmall("multiply_nullable_output(a, b)");
+}
+
+BENCHMARK(multiplyDenseSmall) {
+  benchmark->runSmall("multiply(a, b)");
+}
+
+BENCHMARK(multiplyBatchSmall) {
+  benchmark->runSmall("multiply_batch(a, b)");
+}
+
+BENCHMARK(multiplyBatchHalfNullSmall) {
+  benchmark->runSmall("multiply_batch(a, half_null)");
+}
+
+BENCHMARK_DRAW_LINE();
+
 BENCHMARK(plusUncheckedSmall) {
   benchmark->runSmall("plus(c, d)");
 }
@@ -275,6 +317,25 @@ BENCHMARK(multiplyOutputAlwaysNullMedium) {
 
 BENCHMARK_DRAW_LINE();
 
+// Per row evaluation vs. dense loop over call() vs. callBatch().
+BENCHMARK(multiplyPerRowMedium) {
+  benchmark->runMedium("multiply_nullable_output(a, b)");
+}
+
+BENCHMARK(multiplyDenseMedium) {
+  benchmark->runMedium("multiply(a, b)");
+}
+
+BENCHMARK(multiplyBatchMedium) {
+  benchmark->runMedium("multiply_batch(a, b)");
+}
+
+BENCHMARK(multiplyBatchHalfNullMedium) {
+  benchmark->runMedium("multiply_batch(a, half_null)");
+}
+
+BENCHMARK_DRAW_LINE();
+
 BENCHMARK(plusUncheckedMedium) {
   benchmark->runMedium("plus(c, d)");
 }
@@ -332,6 +393,25 @@ BENCHMARK(multiplyOutputAlwaysNullLarge) {
 
 BENCHMARK_DRAW_LINE();
 
+// Per row evaluation vs. dense loop over call() vs. callBatch().
+BENCHMARK(multiplyPerRowLarge) {
+  benchmark->runLarge("multiply_nullable_output(a, b)");
+}
+
+BENCHMARK(multiplyDenseLarge) {
+  benchmark->runLarge("multiply(a, b)");
+}
+
+BENCHMARK(multiplyBatchLarge) {
+  benchmark->runLarge("multiply_batch(a, b)");
+}
+
+BENCHMARK(multiplyBatchHalfNullLarge) {
+  benchmark->runLarge("multiply_batch(a, half_null)");
+}
+
+BENCHMARK_DRAW_LINE();
+
 BENCHMARK(plusUncheckedLarge) {
   benchmark->runLarge("plus(c, d)");
 }
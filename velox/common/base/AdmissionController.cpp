@@ -73,19 +73,43 @@ void AdmissionController::release(uint64_t resourceUnits) {
         unitsUsed_,
         "Cannot release more units than have been acquired");
     unitsUsed_ -= resourceUnits;
-    while (!queue_.empty()) {
-      auto& request = queue_.front();
-      if (unitsUsed_ + request.unitsRequested > config_.maxLimit) {
-        break;
-      }
-      unitsUsed_ += request.unitsRequested;
-      request.promise.setValue();
-      queue_.pop_front();
-    }
-    updatedValue = unitsUsed_;
+    updatedValue = admitQueuedLocked();
+  }
+  if (!config_.resourceUsageAvgMetric.empty()) {
+    RECORD_METRIC_VALUE(config_.resourceUsageAvgMetric, updatedValue);
+  }
+}
+
+uint64_t AdmissionController::update(
+    uint64_t acquiredUnits,
+    uint64_t projectedUnits) {
+  const auto heldUnits = std::min(projectedUnits, config_.maxLimit);
+  uint64_t updatedValue = 0;
+  {
+    std::lock_guard<std::mutex> l(mu_);
+    VELOX_CHECK_LE(
+        acquiredUnits,
+        unitsUsed_,
+        "Cannot update more units than have been acquired");
+    unitsUsed_ = unitsUsed_ - acquiredUnits + heldUnits;
+    updatedValue = admitQueuedLocked();
   }
   if (!config_.resourceUsageAvgMetric.empty()) {
     RECORD_METRIC_VALUE(config_.resourceUsageAvgMetric, updatedValue);
   }
+  return heldUnits;
+}
+
+uint64_t AdmissionController::admitQueuedLocked() {
+  while (!queue_.empty()) {
+    auto& request = queue_.front();
+    if (unitsUsed_ + request.unitsRequested > config_.maxLimit) {
+      break;
+    }
+    unitsUsed_ += request.unitsRequested;
+    request.promise.setValue();
+    queue_.pop_front();
+  }
+  return unitsUsed_;
 }
 } // namespace facebook::velox::common
@@ -49,6 +49,14 @@ class AdmissionController {
   void accept(uint64_t resourceUnits);
   void release(uint64_t resourceUnits);
 
+  /// Replaces 'acquiredUnits' held by an admitted caller with
+  /// 'projectedUnits', e.g. when a running query's forecast of its peak usage
+  /// changes. Does not block: an increase is granted even if it exceeds the
+  /// limit so that later requests queue until usage drops; a decrease admits
+  /// queued requests that now fit. Returns the units now held by the caller,
+  /// which is 'projectedUnits' capped at the max limit.
+  uint64_t update(uint64_t acquiredUnits, uint64_t projectedUnits);
+
   uint64_t currentResourceUsage() const {
     std::lock_guard<std::mutex> l(mu_);
     return unitsUsed_;
@@ -59,6 +67,9 @@ class AdmissionController {
     uint64_t unitsRequested;
     ContinuePromise promise;
   };
+  // Admits queued requests that fit in the limit. Returns the units in use.
+  uint64_t admitQueuedLocked();
+
   Config config_;
   mutable std::mutex mu_;
   uint64_t unitsUsed_{0};
@@ -95,6 +95,12 @@ class BloomFilter {
     bits::orBits(bits_.data(), bitsdata, 0, 64 * size);
   }
 
+  /// Adds the values of 'other', which must have the same size as 'this'.
+  void merge(const BloomFilter& other) {
+    VELOX_CHECK_EQ(bits_.size(), other.bits_.size());
+    bits::orBits(bits_.data(), other.bits_.data(), 0, 64 * bits_.size());
+  }
+
   uint32_t serializedSize() const {
     return 1 /* version */
         + 4 /* number of bits */
@@ -107,6 +107,12 @@ void registerVeloxMetrics() {
   // was opened to load the cache.
   DEFINE_METRIC(kMetricCacheMaxAgeSecs, facebook::velox::StatType::AVG);
 
+  // The time distribution of query threads waiting for cache loads done by
+  // other threads in range of [0, 10s] with 100 buckets. It is configured to
+  // report the latency at P50, P90, P99, and P100 percentiles.
+  DEFINE_HISTOGRAM_METRIC(
+      kMetricCacheLoadWaitTimeMs, 100, 0, 10'000, 50, 90, 99, 100);
+
   // Total number of cache entries.
   DEFINE_METRIC(kMetricMemoryCacheNumEntries, facebook::velox::StatType::AVG);
 
@@ -660,6 +666,12 @@ void registerVeloxMetrics() {
   DEFINE_HISTOGRAM_METRIC(
       kMetricStorageThrottledDurationMs, 1'000, 0, 30'000, 50, 90, 99, 100);
 
+  // The time distribution of synchronous storage reads done by query threads
+  // in range of [0, 10s] with 100 buckets. It is configured to report the
+  // latency at P50, P90, P99, and P100 percentiles.
+  DEFINE_HISTOGRAM_METRIC(
+      kMetricStorageReadLatencyMs, 100, 0, 10'000, 50, 90, 99, 100);
+
   // The number of times that storage IOs get throttled in a storage directory.
   DEFINE_METRIC(kMetricStorageLocalThrottled, facebook::velox::StatType::COUNT);
 
@@ -195,6 +195,9 @@ constexpr folly::StringPiece kMetricMmapAllocatorDelegatedAllocatedBytes{
 
 constexpr folly::StringPiece kMetricCacheMaxAgeSecs{"velox.cache_max_age_secs"};
 
+constexpr folly::StringPiece kMetricCacheLoadWaitTimeMs{
+    "velox.cache_load_wait_time_ms"};
+
 constexpr folly::StringPiece kMetricMemoryCacheNumEntries{
     "velox.memory_cache_num_entries"};
 
@@ -357,6 +360,9 @@ constexpr folly::StringPiece kMetricExchangeDataSizeCount{
 constexpr folly::StringPiece kMetricStorageThrottledDurationMs{
     "velox.storage_throttled_duration_ms"};
 
+constexpr folly::StringPiece kMetricStorageReadLatencyMs{
+    "velox.storage_read_latency_ms"};
+
 constexpr folly::StringPiece kMetricStorageLocalThrottled{
     "velox.storage_local_throttled_count"};
 
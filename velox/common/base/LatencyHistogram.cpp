@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/base/LatencyHistogram.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "velox/common/base/Exceptions.h"
+#include "velox/common/base/SuccinctPrinter.h"
+
+namespace facebook::velox {
+
+// static
+int32_t LatencyHistogram::bucketIndex(uint64_t value) {
+  if (value < kNumLinearBuckets) {
+    return value;
+  }
+  // The highest set bit selects the power of two and the next kSubBucketBits
+  // bits select the bucket within it.
+  const int32_t exponent = 63 - __builtin_clzll(value);
+  const int32_t subBucket =
+      (value >> (exponent - kSubBucketBits)) & ((1 << kSubBucketBits) - 1);
+  return kNumLinearBuckets +
+      ((exponent - kSubBucketBits - 1) << kSubBucketBits) + subBucket;
+}
+
+// static
+uint64_t LatencyHistogram::bucketUpperBound(int32_t index) {
+  if (index < kNumLinearBuckets) {
+    return index;
+  }
+  const int32_t exponent =
+      ((index - kNumLinearBuckets) >> kSubBucketBits) + kSubBucketBits + 1;
+  const uint64_t subBucket =
+      (index - kNumLinearBuckets) & ((1 << kSubBucketBits) - 1);
+  const auto shift = exponent - kSubBucketBits;
+  const uint64_t lowerBound = ((1ULL << kSubBucketBits) + subBucket) << shift;
+  return lowerBound + ((1ULL << shift) - 1);
+}
+
+void LatencyHistogram::record(uint64_t value) {
+  const auto index = bucketIndex(value);
+  if (index >= counts_.size()) {
+    counts_.resize(index + 1, 0);
+  }
+  ++counts_[index];
+  ++count_;
+  sum_ += value;
+  max_ = std::max(max_, value);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+  if (other.counts_.size() > counts_.size()) {
+    counts_.resize(other.counts_.size(), 0);
+  }
+  for (auto i = 0; i < other.counts_.size(); ++i) {
+    counts_[i] += other.counts_[i];
+  }
+  count_ += other.count_;
+  sum_ += other.sum_;
+  max_ = std::max(max_, other.max_);
+}
+
+void LatencyHistogram::clear() {
+  counts_.clear();
+  count_ = 0;
+  sum_ = 0;
+  max_ = 0;
+}
+
+uint64_t LatencyHistogram::percentile(double percentile) const {
+  VELOX_CHECK(
+      percentile > 0 && percentile <= 100,
+      "Percentile must be in (0, 100]: {}",
+      percentile);
+  if (count_ == 0) {
+    return 0;
+  }
+  const auto target = std::max<uint64_t>(
+      1, static_cast<uint64_t>(std::ceil(count_ * percentile / 100)));
+  uint64_t numSeen = 0;
+  for (auto i = 0; i < counts_.size(); ++i) {
+    numSeen += counts_[i];
+    if (numSeen >= target) {
+      return std::min(bucketUpperBound(i), max_);
+    }
+  }
+  return max_;
+}
+
+std::string LatencyHistogram::toString() const {
+  if (count_ == 0) {
+    return "count: 0";
+  }
+  return fmt::format(
+      "count: {}, avg: {}, p50: {}, p90: {}, p99: {}, max: {}",
+      count_,
+      succinctNanos(sum_ / count_),
+      succinctNanos(percentile(50)),
+      succinctNanos(percentile(90)),
+      succinctNanos(percentile(99)),
+      succinctNanos(max_));
+}
+
+} // namespace facebook::velox
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace facebook::velox {
+
+/// Log-linear histogram of latencies in the style of HdrHistogram. Values
+/// below 16 have a bucket each. Larger values are counted in 8 buckets per
+/// power of two, so a reported percentile is at most 1/8 above the actual
+/// value. The buckets are allocated up to the largest recorded value, so an
+/// empty histogram costs no memory and one of latencies up to seconds in
+/// nanoseconds has about 250 buckets. Not thread-safe.
+class LatencyHistogram {
+ public:
+  void record(uint64_t value);
+
+  void merge(const LatencyHistogram& other);
+
+  void clear();
+
+  bool empty() const {
+    return count_ == 0;
+  }
+
+  uint64_t count() const {
+    return count_;
+  }
+
+  uint64_t sum() const {
+    return sum_;
+  }
+
+  uint64_t max() const {
+    return max_;
+  }
+
+  /// Returns an upper bound for the value at 'percentile', (0, 100]. Returns
+  /// 0 if the histogram is empty.
+  uint64_t percentile(double percentile) const;
+
+  /// Returns count, average and the 50th, 90th, 99th and 100th percentiles
+  /// formatted as nanoseconds.
+  std::string toString() const;
+
+  bool operator==(const LatencyHistogram& other) const {
+    return count_ == other.count_ && sum_ == other.sum_ &&
+        max_ == other.max_ && counts_ == other.counts_;
+  }
+
+ private:
+  static constexpr int32_t kSubBucketBits = 3;
+  static constexpr int32_t kNumLinearBuckets = 2 << kSubBucketBits;
+
+  static int32_t bucketIndex(uint64_t value);
+
+  static uint64_t bucketUpperBound(int32_t index);
+
+  std::vector<uint64_t> counts_;
+  uint64_t count_{0};
+  uint64_t sum_{0};
+  uint64_t max_{0};
+};
+
+} // namespace facebook::velox
@@ -120,4 +120,10 @@ void addThreadLocalRuntimeStat(
   }
 }
 
+void addThreadLocalLatency(const std::string& name, uint64_t nanos) {
+  if (localRuntimeStatWriter) {
+    localRuntimeStatWriter->addLatency(name, nanos);
+  }
+}
+
 } // namespace facebook::velox
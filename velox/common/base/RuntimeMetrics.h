@@ -74,6 +74,12 @@ class BaseRuntimeStatWriter {
   virtual void addRuntimeStat(
       const std::string& /* name */,
       const RuntimeCounter& /* value */) {}
+
+  /// Records 'nanos' in the latency histogram 'name'. Used for waits whose
+  /// tail matters more than their sum, e.g. storage reads.
+  virtual void addLatency(
+      const std::string& /* name */,
+      uint64_t /* nanos */) {}
 };
 
 /// Setting a concrete runtime stats writer on the thread will ensure that any
@@ -91,6 +97,9 @@ void addThreadLocalRuntimeStat(
     const std::string& name,
     const RuntimeCounter& value);
 
+/// Records a latency to the current Operator running on that thread.
+void addThreadLocalLatency(const std::string& name, uint64_t nanos);
+
 /// Scope guard to conveniently set and revert back the current stat writer.
 class RuntimeStatWriterScopeGuard {
  public:
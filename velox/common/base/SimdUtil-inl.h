@@ -1530,9 +1530,11 @@ simdStrstr(const char* s, size_t n, const char* needle, size_t k) {
       return 0;
 
     case 1: {
-      const char* res = strchr(s, needle[0]);
+      // 's' is not null terminated.
+      const void* res = memchr(s, needle[0], n);
 
-      return (res != nullptr) ? res - s : std::string::npos;
+      return (res != nullptr) ? static_cast<const char*>(res) - s
+                              : std::string::npos;
     }
 #define VELOX_SIMD_STRSTR_CASE(size)                                   \
   case size:                                                           \
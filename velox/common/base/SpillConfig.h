@@ -110,8 +110,8 @@ struct SpillConfig {
   uint64_t writeBufferSize;
 
   /// Specifies the buffer size to read from one spilled file. If the underlying
-  /// filesystem supports async read, we do read-ahead with double buffering,
-  /// which doubles the buffer used to read from each spill file.
+  /// filesystem supports async read, we do read-ahead with
+  /// 'numReadAheadBuffers' more buffers per spill file.
   uint64_t readBufferSize;
 
   /// Executor for spilling. If nullptr spilling writes on the Driver's thread.
@@ -157,5 +157,10 @@ struct SpillConfig {
 
   /// Custom options passed to velox::FileSystem to create spill WriteFile.
   std::string fileCreateConfig;
+
+  /// The number of buffers read ahead of the one being consumed from each
+  /// spilled file. If the underlying filesystem does not support async read,
+  /// the read-ahead runs on 'executor' if set.
+  uint32_t numReadAheadBuffers{1};
 };
 } // namespace facebook::velox::common
@@ -83,6 +83,7 @@ SpillStats& SpillStats::operator+=(const SpillStats& other) {
   spillFillTimeNanos += other.spillFillTimeNanos;
   spillSortTimeNanos += other.spillSortTimeNanos;
   spillExtractVectorTimeNanos += other.spillExtractVectorTimeNanos;
+  spillExtractAccumulatorTimeNanos += other.spillExtractAccumulatorTimeNanos;
   spillSerializationTimeNanos += other.spillSerializationTimeNanos;
   spillWrites += other.spillWrites;
   spillFlushTimeNanos += other.spillFlushTimeNanos;
@@ -91,6 +92,7 @@ SpillStats& SpillStats::operator+=(const SpillStats& other) {
   spillReadBytes += other.spillReadBytes;
   spillReads += other.spillReads;
   spillReadTimeNanos += other.spillReadTimeNanos;
+  spillReadAheadWaitTimeNanos += other.spillReadAheadWaitTimeNanos;
   spillDeserializationTimeNanos += other.spillDeserializationTimeNanos;
   return *this;
 }
@@ -107,6 +109,8 @@ SpillStats SpillStats::operator-(const SpillStats& other) const {
   result.spillSortTimeNanos = spillSortTimeNanos - other.spillSortTimeNanos;
   result.spillExtractVectorTimeNanos =
       spillExtractVectorTimeNanos - other.spillExtractVectorTimeNanos;
+  result.spillExtractAccumulatorTimeNanos =
+      spillExtractAccumulatorTimeNanos - other.spillExtractAccumulatorTimeNanos;
   result.spillDeserializationTimeNanos =
       spillExtractVectorTimeNanos - other.spillExtractVectorTimeNanos;
   result.spillSerializationTimeNanos =
@@ -119,6 +123,8 @@ SpillStats SpillStats::operator-(const SpillStats& other) const {
   result.spillReadBytes = spillReadBytes - other.spillReadBytes;
   result.spillReads = spillReads - other.spillReads;
   result.spillReadTimeNanos = spillReadTimeNanos - other.spillReadTimeNanos;
+  result.spillReadAheadWaitTimeNanos =
+      spillReadAheadWaitTimeNanos - other.spillReadAheadWaitTimeNanos;
   result.spillDeserializationTimeNanos =
       spillDeserializationTimeNanos - other.spillDeserializationTimeNanos;
   return result;
@@ -145,6 +151,7 @@ bool SpillStats::operator<(const SpillStats& other) const {
   UPDATE_COUNTER(spillFillTimeNanos);
   UPDATE_COUNTER(spillSortTimeNanos);
   UPDATE_COUNTER(spillExtractVectorTimeNanos);
+  UPDATE_COUNTER(spillExtractAccumulatorTimeNanos);
   UPDATE_COUNTER(spillSerializationTimeNanos);
   UPDATE_COUNTER(spillWrites);
   UPDATE_COUNTER(spillFlushTimeNanos);
@@ -153,6 +160,7 @@ bool SpillStats::operator<(const SpillStats& other) const {
   UPDATE_COUNTER(spillReadBytes);
   UPDATE_COUNTER(spillReads);
   UPDATE_COUNTER(spillReadTimeNanos);
+  UPDATE_COUNTER(spillReadAheadWaitTimeNanos);
   UPDATE_COUNTER(spillDeserializationTimeNanos);
 #undef UPDATE_COUNTER
   VELOX_CHECK(
@@ -186,6 +194,7 @@ bool SpillStats::operator==(const SpillStats& other) const {
              spillFillTimeNanos,
              spillSortTimeNanos,
              spillExtractVectorTimeNanos,
+             spillExtractAccumulatorTimeNanos,
              spillSerializationTimeNanos,
              spillWrites,
              spillFlushTimeNanos,
@@ -194,6 +203,7 @@ bool SpillStats::operator==(const SpillStats& other) const {
              spillReadBytes,
              spillReads,
              spillReadTimeNanos,
+             spillReadAheadWaitTimeNanos,
              spillDeserializationTimeNanos) ==
       std::tie(
              other.spillRuns,
@@ -205,6 +215,7 @@ bool SpillStats::operator==(const SpillStats& other) const {
              other.spillFillTimeNanos,
              other.spillSortTimeNanos,
              other.spillExtractVectorTimeNanos,
+             other.spillExtractAccumulatorTimeNanos,
              other.spillSerializationTimeNanos,
              other.spillWrites,
              other.spillFlushTimeNanos,
@@ -213,6 +224,7 @@ bool SpillStats::operator==(const SpillStats& other) const {
              spillReadBytes,
              spillReads,
              spillReadTimeNanos,
+             other.spillReadAheadWaitTimeNanos,
              spillDeserializationTimeNanos);
 }
 
@@ -226,6 +238,7 @@ void SpillStats::reset() {
   spillFillTimeNanos = 0;
   spillSortTimeNanos = 0;
   spillExtractVectorTimeNanos = 0;
+  spillExtractAccumulatorTimeNanos = 0;
   spillSerializationTimeNanos = 0;
   spillWrites = 0;
   spillFlushTimeNanos = 0;
@@ -234,6 +247,7 @@ void SpillStats::reset() {
   spillReadBytes = 0;
   spillReads = 0;
   spillReadTimeNanos = 0;
+  spillReadAheadWaitTimeNanos = 0;
   spillDeserializationTimeNanos = 0;
 }
 
@@ -241,10 +255,12 @@ std::string SpillStats::toString() const {
   return fmt::format(
       "spillRuns[{}] spilledInputBytes[{}] spilledBytes[{}] spilledRows[{}] "
       "spilledPartitions[{}] spilledFiles[{}] spillFillTimeNanos[{}] "
-      "spillSortTimeNanos[{}] spillExtractVectorTime[{}] spillSerializationTimeNanos[{}] spillWrites[{}] "
+      "spillSortTimeNanos[{}] spillExtractVectorTime[{}] "
+      "spillExtractAccumulatorTime[{}] spillSerializationTimeNanos[{}] "
+      "spillWrites[{}] "
       "spillFlushTimeNanos[{}] spillWriteTimeNanos[{}] maxSpillExceededLimitCount[{}] "
       "spillReadBytes[{}] spillReads[{}] spillReadTimeNanos[{}] "
-      "spillReadDeserializationTimeNanos[{}]",
+      "spillReadAheadWaitTimeNanos[{}] spillReadDeserializationTimeNanos[{}]",
       spillRuns,
       succinctBytes(spilledInputBytes),
       succinctBytes(spilledBytes),
@@ -254,6 +270,7 @@ std::string SpillStats::toString() const {
       succinctNanos(spillFillTimeNanos),
       succinctNanos(spillSortTimeNanos),
       succinctNanos(spillExtractVectorTimeNanos),
+      succinctNanos(spillExtractAccumulatorTimeNanos),
       succinctNanos(spillSerializationTimeNanos),
       spillWrites,
       succinctNanos(spillFlushTimeNanos),
@@ -262,6 +279,7 @@ std::string SpillStats::toString() const {
       succinctBytes(spillReadBytes),
       spillReads,
       succinctNanos(spillReadTimeNanos),
+      succinctNanos(spillReadAheadWaitTimeNanos),
       succinctNanos(spillDeserializationTimeNanos));
 }
 
@@ -301,6 +319,10 @@ void updateGlobalSpillExtractVectorTime(uint64_t timeNs) {
   localSpillStats().wlock()->spillExtractVectorTimeNanos += timeNs;
 }
 
+void updateGlobalSpillExtractAccumulatorTime(uint64_t timeNs) {
+  localSpillStats().wlock()->spillExtractAccumulatorTimeNanos += timeNs;
+}
+
 void updateGlobalSpillWriteStats(
     uint64_t spilledBytes,
     uint64_t flushTimeNs,
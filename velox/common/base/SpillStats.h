@@ -46,6 +46,10 @@ struct SpillStats {
   uint64_t spillSortTimeNanos{0};
   /// The time spent on extracting vector from RowContainer for spilling.
   uint64_t spillExtractVectorTimeNanos{0};
+  /// The part of 'spillExtractVectorTimeNanos' spent on extracting aggregate
+  /// accumulators. This is dominated by the aggregates with variable width
+  /// accumulators such as array_agg and set_agg.
+  uint64_t spillExtractAccumulatorTimeNanos{0};
   /// The time spent on serializing rows for spilling.
   uint64_t spillSerializationTimeNanos{0};
   /// The number of spill writer flushes, equivalent to number of write calls to
@@ -66,6 +70,9 @@ struct SpillStats {
   uint64_t spillReads{0};
   /// The time spent on read data from spilled files.
   uint64_t spillReadTimeNanos{0};
+  /// The part of 'spillReadTimeNanos' spent waiting for read-ahead of
+  /// spilled files to complete.
+  uint64_t spillReadAheadWaitTimeNanos{0};
   /// The time spent on deserializing rows read from spilled files.
   uint64_t spillDeserializationTimeNanos{0};
 
@@ -139,6 +146,10 @@ void updateGlobalSpillSortTime(uint64_t timeNs);
 /// Updates the time spent on extracting vector from RowContainer to spill.
 void updateGlobalSpillExtractVectorTime(uint64_t timeNs);
 
+/// Updates the part of the extract vector time spent on extracting aggregate
+/// accumulators.
+void updateGlobalSpillExtractAccumulatorTime(uint64_t timeNs);
+
 /// Updates the stats for disk write including the number of disk writes,
 /// the written bytes, the time spent on copying out (compression) for disk
 /// writes, the time spent on disk writes.
@@ -17,6 +17,7 @@
 #include "velox/common/base/AdmissionController.h"
 #include <gtest/gtest.h>
 #include <atomic>
+#include <thread>
 #include "velox/common/base/VeloxException.h"
 #include "velox/common/base/tests/GTestUtils.h"
 
@@ -47,6 +48,35 @@ TEST(AdmissionController, basic) {
       "A single request cannot exceed the max limit");
 }
 
+TEST(AdmissionController, update) {
+  AdmissionController::Config config;
+  config.maxLimit = 100;
+  AdmissionController admissionController(config);
+  admissionController.accept(60);
+
+  std::atomic_bool admitted{false};
+  std::thread waiter([&]() {
+    admissionController.accept(50);
+    admitted = true;
+  });
+
+  // The forecast grows past the limit. The increase is granted up to the
+  // limit without blocking.
+  EXPECT_EQ(admissionController.update(60, 120), 100);
+  EXPECT_EQ(admissionController.currentResourceUsage(), 100);
+  EXPECT_FALSE(admitted);
+
+  // The forecast drops. The queued request now fits and is admitted.
+  EXPECT_EQ(admissionController.update(100, 30), 30);
+  waiter.join();
+  EXPECT_TRUE(admitted);
+  EXPECT_EQ(admissionController.currentResourceUsage(), 80);
+
+  VELOX_ASSERT_THROW(
+      admissionController.update(81, 10),
+      "Cannot update more units than have been acquired");
+}
+
 TEST(AdmissionController, multiThreaded) {
   // Ensure that resource usage never exceeds the limit set in the admission
   // controller.
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/base/LatencyHistogram.h"
+
+#include <gtest/gtest.h>
+
+namespace facebook::velox {
+namespace {
+
+TEST(LatencyHistogramTest, percentiles) {
+  LatencyHistogram histogram;
+  ASSERT_TRUE(histogram.empty());
+  ASSERT_EQ(histogram.percentile(99), 0);
+  ASSERT_EQ(histogram.toString(), "count: 0");
+
+  for (uint64_t i = 1; i <= 1'000; ++i) {
+    histogram.record(i * 1'000);
+  }
+  ASSERT_EQ(histogram.count(), 1'000);
+  ASSERT_EQ(histogram.sum(), 500'500'000);
+  ASSERT_EQ(histogram.max(), 1'000'000);
+  for (auto percentile : {1.0, 10.0, 50.0, 90.0, 99.0, 99.9}) {
+    const auto expected = static_cast<uint64_t>(percentile * 10'000);
+    const auto actual = histogram.percentile(percentile);
+    ASSERT_GE(actual, expected) << percentile;
+    ASSERT_LE(actual, expected + expected / 8) << percentile;
+  }
+  ASSERT_EQ(histogram.percentile(100), 1'000'000);
+}
+
+TEST(LatencyHistogramTest, smallValues) {
+  LatencyHistogram histogram;
+  for (uint64_t i = 0; i < 16; ++i) {
+    histogram.record(i);
+  }
+  // Values below 16 have a bucket each.
+  ASSERT_EQ(histogram.percentile(50), 7);
+  ASSERT_EQ(histogram.percentile(100), 15);
+}
+
+TEST(LatencyHistogramTest, largeValues) {
+  LatencyHistogram histogram;
+  histogram.record(std::numeric_limits<uint64_t>::max());
+  histogram.record(1ULL << 63);
+  ASSERT_EQ(histogram.percentile(50), (1ULL << 63) + (1ULL << 60) - 1);
+  ASSERT_EQ(histogram.percentile(100), std::numeric_limits<uint64_t>::max());
+}
+
+TEST(LatencyHistogramTest, merge) {
+  LatencyHistogram first;
+  LatencyHistogram second;
+  for (uint64_t i = 0; i < 100; ++i) {
+    first.record(i);
+    second.record(i + 1'000'000);
+  }
+  LatencyHistogram merged;
+  merged.merge(first);
+  merged.merge(second);
+  ASSERT_EQ(merged.count(), 200);
+  ASSERT_EQ(merged.max(), 1'000'099);
+  ASSERT_GE(merged.percentile(50), 99);
+  ASSERT_LE(merged.percentile(50), 99 + 99 / 8);
+  ASSERT_GE(merged.percentile(51), 1'000'000);
+
+  LatencyHistogram reversed;
+  reversed.merge(second);
+  reversed.merge(first);
+  ASSERT_EQ(merged, reversed);
+
+  merged.clear();
+  ASSERT_TRUE(merged.empty());
+  ASSERT_EQ(merged, LatencyHistogram());
+}
+
+} // namespace
+} // namespace facebook::velox
@@ -54,6 +54,7 @@ TEST(SpillStatsTest, spillStats) {
   stats2.spillWrites = 1028;
   stats2.spillSortTimeNanos = 1029;
   stats2.spillExtractVectorTimeNanos = 1033;
+  stats2.spillExtractAccumulatorTimeNanos = 11;
   stats2.spillFillTimeNanos = 1030;
   stats2.spilledRows = 1031;
   stats2.spillSerializationTimeNanos = 1032;
@@ -86,6 +87,7 @@ TEST(SpillStatsTest, spillStats) {
   ASSERT_EQ(delta.spillWrites, 5);
   ASSERT_EQ(delta.spillSortTimeNanos, 6);
   ASSERT_EQ(delta.spillExtractVectorTimeNanos, 10);
+  ASSERT_EQ(delta.spillExtractAccumulatorTimeNanos, 11);
   ASSERT_EQ(delta.spillFillTimeNanos, 7);
   ASSERT_EQ(delta.spilledRows, 8);
   ASSERT_EQ(delta.spillSerializationTimeNanos, 9);
@@ -103,6 +105,7 @@ TEST(SpillStatsTest, spillStats) {
   ASSERT_EQ(delta.spillWrites, -5);
   ASSERT_EQ(delta.spillSortTimeNanos, -6);
   ASSERT_EQ(delta.spillExtractVectorTimeNanos, -10);
+  ASSERT_EQ(delta.spillExtractAccumulatorTimeNanos, -11);
   ASSERT_EQ(delta.spillFillTimeNanos, -7);
   ASSERT_EQ(delta.spilledRows, -8);
   ASSERT_EQ(delta.spillSerializationTimeNanos, -9);
@@ -128,18 +131,22 @@ TEST(SpillStatsTest, spillStats) {
       "spillRuns[100] spilledInputBytes[2.00KB] spilledBytes[1.00KB] "
       "spilledRows[1031] spilledPartitions[1025] spilledFiles[1026] "
       "spillFillTimeNanos[1.03us] spillSortTimeNanos[1.03us] spillExtractVectorTime[1.03us] "
+      "spillExtractAccumulatorTime[11ns] "
       "spillSerializationTimeNanos[1.03us] spillWrites[1028] spillFlushTimeNanos[1.03us] "
       "spillWriteTimeNanos[1.03us] maxSpillExceededLimitCount[4] "
       "spillReadBytes[2.00KB] spillReads[10] spillReadTimeNanos[100ns] "
+      "spillReadAheadWaitTimeNanos[0ns] "
       "spillReadDeserializationTimeNanos[100ns]");
   ASSERT_EQ(
       fmt::format("{}", stats2),
       "spillRuns[100] spilledInputBytes[2.00KB] spilledBytes[1.00KB] "
       "spilledRows[1031] spilledPartitions[1025] spilledFiles[1026] "
       "spillFillTimeNanos[1.03us] spillSortTimeNanos[1.03us] spillExtractVectorTime[1.03us] "
+      "spillExtractAccumulatorTime[11ns] "
       "spillSerializationTimeNanos[1.03us] spillWrites[1028] "
       "spillFlushTimeNanos[1.03us] spillWriteTimeNanos[1.03us] "
       "maxSpillExceededLimitCount[4] "
       "spillReadBytes[2.00KB] spillReads[10] spillReadTimeNanos[100ns] "
+      "spillReadAheadWaitTimeNanos[0ns] "
       "spillReadDeserializationTimeNanos[100ns]");
 }
@@ -24,6 +24,10 @@
 #include "velox/common/base/StatsReporter.h"
 #include "velox/common/base/SuccinctPrinter.h"
 #include "velox/common/caching/FileIds.h"
+#include "velox/common/compression/Compression.h"
+#ifdef VELOX_ENABLE_COMPRESSION_LZ4
+#include "velox/common/compression/Lz4Compression.h"
+#endif
 
 #define VELOX_CACHE_ERROR(errorMessage)                             \
   _VELOX_THROW(                                                     \
@@ -56,6 +60,7 @@ void AsyncDataCacheEntry::setExclusiveToShared(bool ssdSavable) {
     // Enter the shard's mutex to make sure a promise is not being added during
     // the move.
     promise = std::move(promise_);
+    shard_->recordLoadLocked(groupId_, size_);
   }
   if (promise != nullptr) {
     promise->setValue(true);
@@ -115,6 +120,9 @@ void AsyncDataCacheEntry::initialize(FileCacheKey key) {
   VELOX_CHECK(isExclusive());
   setSsdFile(nullptr, 0);
   key_ = std::move(key);
+  // A reused entry must not inherit the history of its previous contents.
+  accessStats_.reset();
+  groupId_ = 0;
   auto* cache = shard_->cache();
   ClockTimer t(shard_->allocClocks());
   if (size_ < AsyncDataCacheEntry::kTinyDataSize) {
@@ -168,7 +176,7 @@ CachePin CacheShard::findOrCreate(
     folly::SemiFuture<bool>* wait) {
   AsyncDataCacheEntry* entryToInit = nullptr;
   {
-    std::lock_guard<std::mutex> l(mutex_);
+    std::unique_lock<std::mutex> l(mutex_);
     ++eventCounter_;
     auto it = entryMap_.find(key);
     if (it != entryMap_.end()) {
@@ -181,6 +189,20 @@ CachePin CacheShard::findOrCreate(
         return CachePin();
       }
 
+      if (foundEntry->size() >= size && foundEntry->isCompressed()) {
+        foundEntry->touch();
+        // Other readers wait for the decompression like for a load.
+        foundEntry->numPins_ = AsyncDataCacheEntry::kExclusive;
+        ++numHit_;
+        hitBytes_ += foundEntry->size();
+        ++numDecompress_;
+        auto& groupStats = groupStats_[foundEntry->groupId_];
+        ++groupStats.numHit;
+        groupStats.hitBytes += foundEntry->size();
+        l.unlock();
+        return decompressEntry(key, size, foundEntry, wait);
+      }
+
       if (foundEntry->size() >= size) {
         foundEntry->touch();
         // The entry is in a readable state. Add a pin.
@@ -190,6 +212,9 @@ CachePin CacheShard::findOrCreate(
         } else {
           ++numHit_;
           hitBytes_ += foundEntry->size();
+          auto& groupStats = groupStats_[foundEntry->groupId_];
+          ++groupStats.numHit;
+          groupStats.hitBytes += foundEntry->size();
         }
         ++foundEntry->numPins_;
         CachePin pin;
@@ -269,6 +294,96 @@ CachePin CacheShard::initEntry(
   return pin;
 }
 
+CachePin CacheShard::decompressEntry(
+    RawFileCacheKey key,
+    uint64_t size,
+    AsyncDataCacheEntry* entry,
+    folly::SemiFuture<bool>* wait) {
+  // The entry is exclusive and out of the compressed tier once its compressed
+  // data is moved out. Releasing the pin removes the entry on failure.
+  const auto compressed = std::move(entry->compressedData_);
+  entry->compressedData_.clear();
+  cache_->removeCompressedBytes(compressed.size());
+  CachePin pin;
+  pin.setEntry(entry);
+  if (!decompress(compressed, *entry)) {
+    pin.clear();
+    return findOrCreate(key, size, wait);
+  }
+  std::unique_ptr<folly::SharedPromise<bool>> promise;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    entry->numPins_ = 1;
+    promise = entry->movePromise();
+  }
+  if (promise != nullptr) {
+    promise->setValue(true);
+  }
+  return pin;
+}
+
+std::string CacheShard::compress(const AsyncDataCacheEntry& entry) {
+  // An entry is kept in the compressed tier only if this saves at least a
+  // fifth of its size.
+  constexpr double kMaxCompressedRatio = 0.8;
+  auto* codec = cache_->compressionCodec();
+  std::string input(entry.size_, '\0');
+  uint64_t offset = 0;
+  const auto& data = entry.data();
+  for (auto i = 0; i < data.numRuns() && offset < entry.size_; ++i) {
+    const auto run = data.runAt(i);
+    const auto bytes = std::min<uint64_t>(entry.size_ - offset, run.numBytes());
+    ::memcpy(input.data() + offset, run.data<char>(), bytes);
+    offset += bytes;
+  }
+  std::string output(codec->maxCompressedLength(input.size()), '\0');
+  const auto result = codec->compress(
+      reinterpret_cast<const uint8_t*>(input.data()),
+      input.size(),
+      reinterpret_cast<uint8_t*>(output.data()),
+      output.size());
+  if (result.hasError() ||
+      result.value() > input.size() * kMaxCompressedRatio) {
+    return "";
+  }
+  output.resize(result.value());
+  output.shrink_to_fit();
+  if (!cache_->tryAddCompressedBytes(output.size())) {
+    return "";
+  }
+  return output;
+}
+
+bool CacheShard::decompress(
+    const std::string& compressed,
+    AsyncDataCacheEntry& entry) {
+  const auto numPages = memory::AllocationTraits::numPages(entry.size_);
+  if (!cache_->allocator()->allocateNonContiguous(numPages, entry.data_)) {
+    return false;
+  }
+  cache_->incrementCachedPages(entry.data_.numPages());
+  ClockTimer t(decompressClocks_);
+  std::string output(entry.size_, '\0');
+  const auto result = cache_->compressionCodec()->decompress(
+      reinterpret_cast<const uint8_t*>(compressed.data()),
+      compressed.size(),
+      reinterpret_cast<uint8_t*>(output.data()),
+      output.size());
+  if (result.hasError() || result.value() != output.size()) {
+    VELOX_CACHE_LOG(WARNING) << "Failed to decompress " << entry.toString();
+    return false;
+  }
+  uint64_t offset = 0;
+  for (auto i = 0; i < entry.data_.numRuns() && offset < output.size(); ++i) {
+    const auto run = entry.data_.runAt(i);
+    const auto bytes =
+        std::min<uint64_t>(output.size() - offset, run.numBytes());
+    ::memcpy(run.data<char>(), output.data() + offset, bytes);
+    offset += bytes;
+  }
+  return true;
+}
+
 CoalescedLoad::~CoalescedLoad() {
   // Continue possibly waiting threads.
   setEndState(State::kCancelled);
@@ -363,6 +478,11 @@ void CacheShard::removeEntryLocked(AsyncDataCacheEntry* entry) {
   }
   entry->tinyData_.clear();
   entry->tinyData_.shrink_to_fit();
+  if (entry->isCompressed()) {
+    cache_->removeCompressedBytes(entry->compressedData_.size());
+    entry->compressedData_.clear();
+    entry->compressedData_.shrink_to_fit();
+  }
   entry->size_ = 0;
 }
 
@@ -379,6 +499,23 @@ uint64_t CacheShard::evict(
   int64_t tinyEvicted = 0;
   int64_t largeEvicted = 0;
   int32_t evictSaveableSkipped = 0;
+  const bool useCompressedTier =
+      cache_->compressionCodec() != nullptr && !evictAllUnpinned;
+  // Entries to move to the compressed tier and their indices in 'entries_'.
+  // These are held exclusively while compressed outside of 'mutex_'.
+  std::vector<std::pair<AsyncDataCacheEntry*, int32_t>> toCompress;
+  auto moveData = [&](AsyncDataCacheEntry* candidate) {
+    if (pagesToAcquire > 0) {
+      const auto candidatePages = candidate->data().numPages();
+      pagesToAcquire = candidatePages > pagesToAcquire
+          ? 0
+          : pagesToAcquire - candidatePages;
+      acquired.appendMove(candidate->data());
+      VELOX_CHECK(candidate->data().empty());
+    } else {
+      toFree.push_back(std::move(candidate->data()));
+    }
+  };
   {
     std::lock_guard<std::mutex> l(mutex_);
     const size_t size = entries_.size();
@@ -417,25 +554,37 @@ uint64_t CacheShard::evict(
       int32_t score = 0;
       if (candidate->numPins_ == 0 &&
           (!candidate->key_.fileNum.hasValue() || evictAllUnpinned ||
-           (score = candidate->score(now)) >= evictionThreshold_)) {
+           (score = candidate->score(now, evictionPolicy_)) >=
+               evictionThreshold_)) {
         if (skipSsdSaveable && candidate->ssdSaveable() && !evictAllUnpinned) {
           ++evictSaveableSkipped;
           continue;
         }
+        // Entries made evictable by makeEvictable() are not compressed.
+        if (useCompressedTier && candidate->key_.fileNum.hasValue() &&
+            score != std::numeric_limits<int32_t>::max()) {
+          if (candidate->isCompressed()) {
+            // Evicting a compressed entry frees no cache memory.
+            if (!cache_->compressedTierFull()) {
+              continue;
+            }
+          } else if (
+              !candidate->data_.empty() && !candidate->ssdSaveable() &&
+              !cache_->compressedTierFull()) {
+            candidate->numPins_ = AsyncDataCacheEntry::kExclusive;
+            toCompress.emplace_back(candidate, entryIndex);
+            largeEvicted += candidate->data_.byteSize();
+            if (largeEvicted + tinyEvicted > bytesToFree) {
+              break;
+            }
+            continue;
+          }
+        }
         if (candidate->ssdSaveable()) {
           ++numSavableEvict_;
         }
         largeEvicted += candidate->data_.byteSize();
-        if (pagesToAcquire > 0) {
-          const auto candidatePages = candidate->data().numPages();
-          pagesToAcquire = candidatePages > pagesToAcquire
-              ? 0
-              : pagesToAcquire - candidatePages;
-          acquired.appendMove(candidate->data());
-          VELOX_CHECK(candidate->data().empty());
-        } else {
-          toFree.push_back(std::move(candidate->data()));
-        }
+        moveData(candidate);
         tinyEvicted += candidate->tinyData_.size();
         candidate->tinyData_.clear();
         candidate->tinyData_.shrink_to_fit();
@@ -445,6 +594,11 @@ uint64_t CacheShard::evict(
         emptySlots_.push_back(entryIndex);
         tryAddFreeEntry(std::move(*iter));
         ++numEvict_;
+        if (score >= AccessStats::kProbationScore &&
+            score != std::numeric_limits<int32_t>::max()) {
+          // Count the age of probationary entries, not their segment offset.
+          score -= AccessStats::kProbationScore;
+        }
         if (score > 0) {
           sumEvictScore_ += score;
         }
@@ -455,6 +609,39 @@ uint64_t CacheShard::evict(
     }
   }
 
+  // The data of the entries to compress is freed whether they fit in the
+  // compressed tier or not. The ones that do not fit are evicted.
+  for (auto [candidate, index] : toCompress) {
+    auto compressed = compress(*candidate);
+    const auto compressInputBytes = candidate->size_;
+    moveData(candidate);
+    std::unique_ptr<folly::SharedPromise<bool>> promise;
+    {
+      std::lock_guard<std::mutex> l(mutex_);
+      if (candidate->isPrefetch()) {
+        candidate->setPrefetch(false);
+      }
+      candidate->numPins_ = 0;
+      if (compressed.empty()) {
+        candidate->size_ = 0;
+        removeEntryLocked(candidate);
+        promise = candidate->movePromise();
+        emptySlots_.push_back(index);
+        tryAddFreeEntry(std::move(entries_[index]));
+        ++numEvict_;
+      } else {
+        ++numCompress_;
+        compressInputBytes_ += compressInputBytes;
+        compressOutputBytes_ += compressed.size();
+        candidate->compressedData_ = std::move(compressed);
+        promise = candidate->movePromise();
+      }
+    }
+    if (promise != nullptr) {
+      promise->setValue(true);
+    }
+  }
+
   ClockTimer t(allocClocks_);
   freeAllocations(toFree);
   cache_->incrementCachedPages(
@@ -499,7 +686,8 @@ void CacheShard::calibrateThreshold() {
   evictionThreshold_ = percentile<int32_t>(
       [&]() -> int32_t {
         AsyncDataCacheEntry* element = iter->get();
-        int32_t score = element ? element->score(now) : 0;
+        int32_t score =
+            element ? element->score(now, evictionPolicy_) : 0;
         if (entryIndex + step >= entries_.size()) {
           entryIndex = (entryIndex + step) % entries_.size();
           iter = entries_.begin() + entryIndex;
@@ -537,6 +725,11 @@ void CacheShard::updateStats(CacheStats& stats) {
     }
 
     ++stats.numEntries;
+    if (entry->isCompressed()) {
+      ++stats.numCompressedEntries;
+      stats.compressedSize += entry->compressedData_.size();
+      continue;
+    }
     stats.tinySize += entry->tinyData_.size();
     stats.tinyPadding += entry->tinyData_.capacity() - entry->tinyData_.size();
     if (entry->tinyData_.empty()) {
@@ -555,6 +748,18 @@ void CacheShard::updateStats(CacheStats& stats) {
   stats.numStales += numStales_;
   stats.sumEvictScore += sumEvictScore_;
   stats.allocClocks += allocClocks_;
+  stats.numCompress += numCompress_;
+  stats.compressInputBytes += compressInputBytes_;
+  stats.compressOutputBytes += compressOutputBytes_;
+  stats.numDecompress += numDecompress_;
+  stats.decompressClocks += decompressClocks_;
+  for (const auto& [groupId, groupStats] : groupStats_) {
+    auto& total = stats.groupStats[groupId];
+    total.numHit += groupStats.numHit;
+    total.hitBytes += groupStats.hitBytes;
+    total.numLoad += groupStats.numLoad;
+    total.loadBytes += groupStats.loadBytes;
+  }
 }
 
 void CacheShard::appendSsdSaveable(bool saveAll, std::vector<CachePin>& pins) {
@@ -644,6 +849,16 @@ CacheStats CacheStats::operator-(const CacheStats& other) const {
   result.numStales = numStales - other.numStales;
   result.allocClocks = allocClocks - other.allocClocks;
   result.sumEvictScore = sumEvictScore - other.sumEvictScore;
+  result.numCompress = numCompress - other.numCompress;
+  result.compressInputBytes = compressInputBytes - other.compressInputBytes;
+  result.compressOutputBytes = compressOutputBytes - other.compressOutputBytes;
+  result.numDecompress = numDecompress - other.numDecompress;
+  result.decompressClocks = decompressClocks - other.decompressClocks;
+  for (const auto& [groupId, groupStats] : groupStats) {
+    auto it = other.groupStats.find(groupId);
+    result.groupStats[groupId] =
+        it == other.groupStats.end() ? groupStats : groupStats - it->second;
+  }
   if (ssdStats != nullptr) {
     if (other.ssdStats != nullptr) {
       result.ssdStats =
@@ -668,8 +883,16 @@ AsyncDataCache::AsyncDataCache(
       allocator_(allocator),
       ssdCache_(std::move(ssdCache)),
       cachedPages_(0) {
+  if (opts_.maxCompressedBytes > 0) {
+#ifdef VELOX_ENABLE_COMPRESSION_LZ4
+    compressionCodec_ = common::makeLz4RawCodec();
+#else
+    VELOX_USER_FAIL("The compressed cache tier requires LZ4 support");
+#endif
+  }
   for (auto i = 0; i < kNumShards; ++i) {
-    shards_.push_back(std::make_unique<CacheShard>(this, opts_.maxWriteRatio));
+    shards_.push_back(std::make_unique<CacheShard>(
+        this, opts_.maxWriteRatio, opts_.evictionPolicy));
   }
 }
 
@@ -953,6 +1176,16 @@ bool AsyncDataCache::removeFileEntries(
   return success;
 }
 
+bool AsyncDataCache::tryAddCompressedBytes(uint64_t bytes) {
+  auto current = compressedBytes_.load();
+  do {
+    if (current + bytes > opts_.maxCompressedBytes) {
+      return false;
+    }
+  } while (!compressedBytes_.compare_exchange_weak(current, current + bytes));
+  return true;
+}
+
 CacheStats AsyncDataCache::refreshStats() const {
   CacheStats stats;
   for (auto& shard : shards_) {
@@ -1017,6 +1250,14 @@ std::string CacheStats::toString() const {
       << "\n"
       // Cache timing stats.
       << "Alloc Megaclocks " << (allocClocks >> 20);
+  if (numCompress > 0 || numCompressedEntries > 0) {
+    out << "\nCompressed entries: " << numCompressedEntries
+        << " size: " << succinctBytes(compressedSize)
+        << " compressed: " << numCompress
+        << " ratio: " << compressionRatio()
+        << " decompressed: " << numDecompress
+        << " decompress Megaclocks " << (decompressClocks >> 20);
+  }
   return out.str();
 }
 
@@ -21,6 +21,7 @@
 #include <fmt/format.h>
 #include <folly/GLog.h>
 #include <folly/chrono/Hardware.h>
+#include <folly/container/F14Map.h>
 #include <folly/container/F14Set.h>
 #include <folly/futures/SharedPromise.h>
 
@@ -35,6 +36,10 @@
 #include "velox/common/memory/Memory.h"
 #include "velox/common/memory/MemoryAllocator.h"
 
+namespace facebook::velox::common {
+class Codec;
+} // namespace facebook::velox::common
+
 namespace facebook::velox::cache {
 
 #define VELOX_CACHE_LOG_PREFIX "[CACHE] "
@@ -68,7 +73,19 @@ inline AccessTime accessTime() {
   return folly::hardware_timestamp() >> 21;
 }
 
+/// Selects how a CacheShard picks entries to evict.
+enum class EvictionPolicy {
+  /// Evicts by time since last use divided by use count.
+  kClock,
+  /// Like kClock but evicts entries that have not been reused before any
+  /// reused entry. This keeps large scans from flushing the hot entries.
+  kSegmented,
+};
+
 struct AccessStats {
+  // Lowest score of a probationary entry with EvictionPolicy::kSegmented.
+  static constexpr int32_t kProbationScore = 1 << 30;
+
   tsan_atomic<AccessTime> lastUse{0};
   tsan_atomic<int32_t> numUses{0};
 
@@ -85,6 +102,23 @@ struct AccessStats {
     return (now - lastUse) / (1 + numUses);
   }
 
+  // Retention score for EvictionPolicy::kSegmented. Entries used fewer than
+  // two times are in the probationary segment and score above all reused
+  // entries, so that a scan touching each entry once evicts its own entries
+  // before the reused ones. Larger probationary entries score higher.
+  int32_t segmentedScore(AccessTime now, uint64_t size) const {
+    if (!lastUse) {
+      return std::numeric_limits<int32_t>::max();
+    }
+    if (numUses >= 2) {
+      return std::min<int32_t>(
+          kProbationScore - 1, (now - lastUse) / (1 + numUses));
+    }
+    return std::min<int64_t>(
+        std::numeric_limits<int32_t>::max() - 1,
+        kProbationScore + static_cast<int64_t>(now - lastUse) + (size >> 16));
+  }
+
   // Resets the access tracking to not accessed. This is used after evicting the
   // previous contents of the entry, so that the new data does not inherit the
   // history of the previous.
@@ -201,6 +235,12 @@ class AsyncDataCacheEntry {
     return accessStats_.score(now, size_);
   }
 
+  int32_t score(AccessTime now, EvictionPolicy policy) const {
+    return policy == EvictionPolicy::kSegmented
+        ? accessStats_.segmentedScore(now, size_)
+        : accessStats_.score(now, size_);
+  }
+
   bool isShared() const {
     return numPins_ > 0;
   }
@@ -252,6 +292,12 @@ class AsyncDataCacheEntry {
     return ssdSaveable_;
   }
 
+  /// True if 'this' is in the compressed tier. The data is then decompressed
+  /// by the next findOrCreate() of the key.
+  bool isCompressed() const {
+    return !compressedData_.empty();
+  }
+
   void setTrackingId(TrackingId id) {
     trackingId_ = id;
   }
@@ -297,6 +343,10 @@ class AsyncDataCacheEntry {
   // page (kTinyDataSize).
   std::string tinyData_;
 
+  // The LZ4 compressed data if 'this' is in the compressed tier. 'data_' and
+  // 'tinyData_' are then empty.
+  std::string compressedData_;
+
   std::unique_ptr<folly::SharedPromise<bool>> promise_;
   int32_t size_{0};
 
@@ -481,6 +531,31 @@ class CoalescedLoad {
   std::vector<int32_t> sizes_;
 };
 
+/// Memory cache hits and loads of the entries of one file group, as set by
+/// AsyncDataCacheEntry::setGroupId(). Entries without a group count in group
+/// 0.
+struct FileGroupCacheStats {
+  /// Number of hits, counted like CacheStats::numHit.
+  int64_t numHit{0};
+  int64_t hitBytes{0};
+  /// Number of entries loaded into the cache.
+  int64_t numLoad{0};
+  int64_t loadBytes{0};
+
+  double hitRate() const {
+    const auto numAccess = numHit + numLoad;
+    return numAccess == 0 ? 0 : static_cast<double>(numHit) / numAccess;
+  }
+
+  FileGroupCacheStats operator-(const FileGroupCacheStats& other) const {
+    return {
+        numHit - other.numHit,
+        hitBytes - other.hitBytes,
+        numLoad - other.numLoad,
+        loadBytes - other.loadBytes};
+  }
+};
+
 /// Struct for CacheShard stats. Stats from all shards are added into
 /// this struct to provide a snapshot of state.
 struct CacheStats {
@@ -510,6 +585,10 @@ struct CacheStats {
   /// Total size of shared/exclusive pinned entries.
   int64_t sharedPinnedBytes{0};
   int64_t exclusivePinnedBytes{0};
+  /// Number of entries in the compressed tier.
+  int32_t numCompressedEntries{0};
+  /// Total compressed size of the entries in the compressed tier.
+  int64_t compressedSize{0};
 
   /// ============= Cumulative stats =============
 
@@ -541,10 +620,31 @@ struct CacheStats {
   /// Sum of scores of evicted entries. This serves to infer an average
   /// lifetime for entries in cache.
   int64_t sumEvictScore{0};
+  /// Number of entries moved to the compressed tier.
+  int64_t numCompress{0};
+  /// Uncompressed and compressed sizes of the entries counted in
+  /// 'numCompress'.
+  int64_t compressInputBytes{0};
+  int64_t compressOutputBytes{0};
+  /// Number of hits on compressed entries. These are also counted in
+  /// 'numHit'.
+  int64_t numDecompress{0};
+  /// Cumulative clocks spent in decompressing compressed entries.
+  uint64_t decompressClocks{0};
+  /// Hits and loads by file group id.
+  folly::F14FastMap<uint64_t, FileGroupCacheStats> groupStats;
 
   /// Ssd cache stats that include both snapshot and cumulative stats.
   std::shared_ptr<SsdCacheStats> ssdStats = nullptr;
 
+  /// Returns the uncompressed over the compressed size of the entries moved
+  /// to the compressed tier.
+  double compressionRatio() const {
+    return compressOutputBytes == 0
+        ? 0
+        : static_cast<double>(compressInputBytes) / compressOutputBytes;
+  }
+
   CacheStats operator-(const CacheStats& other) const;
 
   std::string toString() const;
@@ -556,8 +656,13 @@ struct CacheStats {
 /// and other housekeeping.
 class CacheShard {
  public:
-  CacheShard(AsyncDataCache* cache, double maxWriteRatio)
-      : cache_(cache), maxWriteRatio_(maxWriteRatio) {}
+  CacheShard(
+      AsyncDataCache* cache,
+      double maxWriteRatio,
+      EvictionPolicy evictionPolicy = EvictionPolicy::kClock)
+      : cache_(cache),
+        maxWriteRatio_(maxWriteRatio),
+        evictionPolicy_(evictionPolicy) {}
 
   /// See AsyncDataCache::findOrCreate.
   CachePin findOrCreate(
@@ -585,6 +690,8 @@ class CacheShard {
 
   /// Removes 'bytesToFree' worth of entries or as many entries as are not
   /// pinned. This favors first removing older and less frequently used entries.
+  /// If the cache has a compressed tier, large entries that are selected for
+  /// eviction are compressed into the tier instead, unless the tier is full.
   /// If 'evictAllUnpinned' is true, anything that is not pinned is evicted at
   /// first sight. This is for out of memory emergencies. If 'pagesToAcquire' is
   /// set, up to this amount is added to 'allocation'. A smaller amount can be
@@ -626,6 +733,14 @@ class CacheShard {
     return allocClocks_;
   }
 
+  /// Counts the load of 'bytes' into an entry of 'groupId'. Called inside
+  /// mutex().
+  void recordLoadLocked(uint64_t groupId, uint64_t bytes) {
+    auto& stats = groupStats_[groupId];
+    ++stats.numLoad;
+    stats.loadBytes += bytes;
+  }
+
  private:
   static constexpr uint32_t kMaxFreeEntries = 1 << 10;
   static constexpr int32_t kNoThreshold = std::numeric_limits<int32_t>::max();
@@ -646,8 +761,28 @@ class CacheShard {
 
   void tryAddFreeEntry(std::unique_ptr<AsyncDataCacheEntry>&& entry);
 
+  // Returns the compressed data of 'entry' and adds its size to the compressed
+  // tier. Returns an empty string if the tier is full or 'entry' does not
+  // compress well.
+  std::string compress(const AsyncDataCacheEntry& entry);
+
+  // Decompresses 'compressed' into newly allocated data of 'entry', which is
+  // held exclusively. Returns false if the allocation or the decompression
+  // fails.
+  bool decompress(const std::string& compressed, AsyncDataCacheEntry& entry);
+
+  // Makes 'entry' found in the compressed tier by findOrCreate() readable and
+  // returns a pin on it. Retries findOrCreate() if 'entry' cannot be
+  // decompressed.
+  CachePin decompressEntry(
+      RawFileCacheKey key,
+      uint64_t size,
+      AsyncDataCacheEntry* entry,
+      folly::SemiFuture<bool>* readyFuture);
+
   AsyncDataCache* const cache_;
   const double maxWriteRatio_;
+  const EvictionPolicy evictionPolicy_;
 
   mutable std::mutex mutex_;
   folly::F14FastMap<RawFileCacheKey, AsyncDataCacheEntry*> entryMap_;
@@ -687,6 +822,18 @@ class CacheShard {
   // Cumulative sum of evict scores. This divided by 'numEvict_' correlates to
   // time data stays in cache.
   uint64_t sumEvictScore_{0};
+  // Cumulative count of entries moved to the compressed tier.
+  uint64_t numCompress_{0};
+  // Cumulative sizes of the entries moved to the compressed tier before and
+  // after compression.
+  uint64_t compressInputBytes_{0};
+  uint64_t compressOutputBytes_{0};
+  // Cumulative count of hits on compressed entries.
+  uint64_t numDecompress_{0};
+  // Cumulative time spent in decompressing compressed entries.
+  std::atomic<uint64_t> decompressClocks_{0};
+  // Cumulative hits and loads by file group id.
+  folly::F14FastMap<uint64_t, FileGroupCacheStats> groupStats_;
   // Tracker of cumulative time spent in allocating/freeing MemoryAllocator
   // space for backing cached data.
   std::atomic<uint64_t> allocClocks_{0};
@@ -722,6 +869,16 @@ class AsyncDataCache : public memory::Cache {
     /// NOTE: we only write to SSD cache when both above conditions satisfy. The
     /// default is 16MB.
     int32_t minSsdSavableBytes;
+
+    /// The policy for selecting the entries to evict.
+    EvictionPolicy evictionPolicy{EvictionPolicy::kClock};
+
+    /// Max total size of the compressed tier. If set, cold entries are
+    /// compressed with LZ4 instead of being evicted and are decompressed on
+    /// the next access. The compressed data is allocated outside of the
+    /// cache's memory allocator. 0 disables the compressed tier, which is
+    /// the default.
+    uint64_t maxCompressedBytes{0};
   };
 
   AsyncDataCache(
@@ -815,6 +972,26 @@ class AsyncDataCache : public memory::Cache {
     return ssdCache_.get();
   }
 
+  /// Returns the codec of the compressed tier or nullptr if the cache has no
+  /// compressed tier.
+  common::Codec* compressionCodec() const {
+    return compressionCodec_.get();
+  }
+
+  /// Adds 'bytes' to the size of the compressed tier. Returns false without
+  /// adding if this would exceed Options::maxCompressedBytes.
+  bool tryAddCompressedBytes(uint64_t bytes);
+
+  void removeCompressedBytes(uint64_t bytes) {
+    compressedBytes_ -= bytes;
+  }
+
+  /// True if the compressed tier is almost full. Compressed entries are then
+  /// evicted to make space for compressing more recently used entries.
+  bool compressedTierFull() const {
+    return compressedBytes_ >= opts_.maxCompressedBytes * 0.9;
+  }
+
   /// Updates stats for creation of a new cache entry of 'size' bytes,
   /// i.e. a cache miss. Periodically updates SSD admission criteria,
   /// i.e. reconsider criteria every half cache capacity worth of misses.
@@ -893,6 +1070,10 @@ class AsyncDataCache : public memory::Cache {
   const Options opts_;
   memory::MemoryAllocator* const allocator_;
   std::unique_ptr<SsdCache> ssdCache_;
+  // Codec of the compressed tier. nullptr if Options::maxCompressedBytes is 0.
+  std::unique_ptr<common::Codec> compressionCodec_;
+  // Total size of the compressed tier.
+  std::atomic<uint64_t> compressedBytes_{0};
   std::vector<std::unique_ptr<CacheShard>> shards_;
   std::atomic<int32_t> shardCounter_{0};
   std::atomic<memory::MachinePageCount> cachedPages_{0};
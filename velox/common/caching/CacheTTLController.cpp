@@ -17,6 +17,7 @@
 #include "velox/common/caching/CacheTTLController.h"
 
 #include "velox/common/caching/AsyncDataCache.h"
+#include "velox/common/file/CachingFileSystem.h"
 
 namespace facebook::velox::cache {
 
@@ -53,6 +54,10 @@ CacheAgeStats CacheTTLController::getCacheAgeStats() const {
 }
 
 void CacheTTLController::applyTTL(int64_t ttlSecs) {
+  if (auto* blockCache = filesystems::FileBlockCache::instance()) {
+    blockCache->applyTTL(ttlSecs);
+  }
+
   int64_t maxOpenTime = getCurrentTimeSec() - ttlSecs;
 
   folly::F14FastSet<uint64_t> filesToRemove =
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/caching/ScanHistory.h"
+
+#include <algorithm>
+
+namespace facebook::velox::cache {
+
+// static
+ScanHistory* ScanHistory::instance() {
+  static ScanHistory history;
+  return &history;
+}
+
+void ScanHistory::recordReference(
+    uint64_t groupId,
+    TrackingId id,
+    uint64_t bytes) {
+  const Key key{groupId, id.id()};
+  auto& shard = this->shard(key);
+  std::lock_guard<std::mutex> l(shard.mutex);
+  auto& data = shard.data[key];
+  data.referencedBytes += bytes;
+  data.lastReferencedBytes = bytes;
+  if (shard.data.size() > kMaxEntriesPerShard) {
+    decayLocked(shard);
+  }
+}
+
+void ScanHistory::recordRead(uint64_t groupId, TrackingId id, uint64_t bytes) {
+  const Key key{groupId, id.id()};
+  auto& shard = this->shard(key);
+  std::lock_guard<std::mutex> l(shard.mutex);
+  auto it = shard.data.find(key);
+  // A read without a reference, e.g. after the stream was dropped by decay,
+  // is not recorded so that the read density stays at most 100%.
+  if (it != shard.data.end()) {
+    it->second.readBytes += bytes;
+  }
+}
+
+TrackingData ScanHistory::trackingData(uint64_t groupId, TrackingId id) {
+  const Key key{groupId, id.id()};
+  auto& shard = this->shard(key);
+  std::lock_guard<std::mutex> l(shard.mutex);
+  auto it = shard.data.find(key);
+  if (it == shard.data.end()) {
+    return {};
+  }
+  return it->second;
+}
+
+size_t ScanHistory::size() {
+  size_t size{0};
+  for (auto& shard : shards_) {
+    std::lock_guard<std::mutex> l(shard.mutex);
+    size += shard.data.size();
+  }
+  return size;
+}
+
+void ScanHistory::clear() {
+  for (auto& shard : shards_) {
+    std::lock_guard<std::mutex> l(shard.mutex);
+    shard.data.clear();
+  }
+}
+
+// static
+void ScanHistory::decayLocked(Shard& shard) {
+  for (auto it = shard.data.begin(); it != shard.data.end();) {
+    auto& data = it->second;
+    data.referencedBytes /= 2;
+    data.readBytes /= 2;
+    data.lastReferencedBytes =
+        std::min(data.lastReferencedBytes, data.referencedBytes);
+    if (data.referencedBytes < kMinReferencedBytes) {
+      it = shard.data.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  // All streams are referenced a lot. Start over rather than grow.
+  if (shard.data.size() > kMaxEntriesPerShard) {
+    shard.data.clear();
+  }
+}
+
+} // namespace facebook::velox::cache
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <mutex>
+
+#include <folly/container/F14Map.h>
+
+#include "velox/common/caching/ScanTracker.h"
+
+namespace facebook::velox::cache {
+
+/// Process wide history of references and reads of streams by file group.
+/// ScanTrackers record into this in addition to their per-scan data, so that
+/// a scan that has not yet read a stream can decide on prefetching from what
+/// earlier scans of the same file group did with the stream. Thread safe.
+class ScanHistory {
+ public:
+  /// Maximum number of tracked streams per shard. A shard that goes over
+  /// this is decayed and its rarely referenced streams are dropped.
+  static constexpr int32_t kMaxEntriesPerShard = 4096;
+
+  static ScanHistory* instance();
+
+  void recordReference(uint64_t groupId, TrackingId id, uint64_t bytes);
+
+  void recordRead(uint64_t groupId, TrackingId id, uint64_t bytes);
+
+  /// Returns the references and reads of 'id' in 'groupId' so far. All zero
+  /// if the stream has not been seen.
+  TrackingData trackingData(uint64_t groupId, TrackingId id);
+
+  /// Returns the number of tracked streams.
+  size_t size();
+
+  void clear();
+
+ private:
+  static constexpr int32_t kNumShards = 16;
+  // Streams referenced less than this after decay are dropped.
+  static constexpr double kMinReferencedBytes = 64 << 10;
+
+  using Key = std::pair<uint64_t, int32_t>;
+
+  struct Shard {
+    std::mutex mutex;
+    folly::F14FastMap<Key, TrackingData> data;
+  };
+
+  Shard& shard(const Key& key) {
+    return shards_[folly::hasher<Key>()(key) % kNumShards];
+  }
+
+  // Halves the counts of 'shard' and drops the rarely referenced streams.
+  static void decayLocked(Shard& shard);
+
+  std::array<Shard, kNumShards> shards_;
+};
+
+} // namespace facebook::velox::cache
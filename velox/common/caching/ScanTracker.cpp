@@ -16,6 +16,7 @@
 
 #include "velox/common/caching/ScanTracker.h"
 #include "velox/common/caching/FileGroupStats.h"
+#include "velox/common/caching/ScanHistory.h"
 
 #include <sstream>
 
@@ -31,6 +32,9 @@ void ScanTracker::recordReference(
   if (fileGroupStats_) {
     fileGroupStats_->recordReference(fileId, groupId, id, bytes);
   }
+  if (scanHistory_) {
+    scanHistory_->recordReference(groupId, id, bytes);
+  }
   std::lock_guard<std::mutex> l(mutex_);
   auto& data = data_[id];
   data.referencedBytes += bytes;
@@ -46,12 +50,28 @@ void ScanTracker::recordRead(
   if (fileGroupStats_) {
     fileGroupStats_->recordRead(fileId, groupId, id, bytes);
   }
+  if (scanHistory_) {
+    scanHistory_->recordRead(groupId, id, bytes);
+  }
   std::lock_guard<std::mutex> l(mutex_);
   auto& data = data_[id];
   data.readBytes += bytes;
   sum_.readBytes += bytes;
 }
 
+TrackingData ScanTracker::trackingData(TrackingId id, uint64_t groupId) {
+  const auto data = trackingData(id);
+  if (scanHistory_ == nullptr ||
+      data.referencedBytes > data.lastReferencedBytes) {
+    return data;
+  }
+  // The history includes the latest reference of this scan.
+  auto history = scanHistory_->trackingData(groupId, id);
+  history.lastReferencedBytes =
+      std::min(history.referencedBytes, data.lastReferencedBytes);
+  return history;
+}
+
 std::string ScanTracker::toString() const {
   std::stringstream out;
   out << "ScanTracker for " << id_ << std::endl;
@@ -70,6 +70,7 @@ struct hash<::facebook::velox::cache::TrackingId> {
 namespace facebook::velox::cache {
 
 class FileGroupStats;
+class ScanHistory;
 
 /// Records references and actual uses of a stream.
 struct TrackingData {
@@ -92,15 +93,18 @@ class ScanTracker {
   /// and will be referenced from a map from id to weak_ptr to 'this'.
   /// 'unregisterer' is supplied so that the destructor can remove the weak_ptr
   /// from the map of pending trackers. 'loadQuantum' is the largest single IO
-  /// size for read.
+  /// size for read. If 'scanHistory' is set, the references and reads are
+  /// also recorded there by file group.
   ScanTracker(
       std::string_view id,
       std::function<void(ScanTracker*)> unregisterer,
       int32_t loadQuantum,
-      FileGroupStats* fileGroupStats = nullptr)
+      FileGroupStats* fileGroupStats = nullptr,
+      ScanHistory* scanHistory = nullptr)
       : id_(id),
         unregisterer_(std::move(unregisterer)),
-        fileGroupStats_(fileGroupStats) {}
+        fileGroupStats_(fileGroupStats),
+        scanHistory_(scanHistory) {}
 
   ~ScanTracker() {
     if (unregisterer_) {
@@ -145,6 +149,12 @@ class ScanTracker {
     return data_[id];
   }
 
+  /// Returns the tracking data of 'id' for a read from 'groupId'. If this scan
+  /// has no references to 'id' before the latest one, returns the history of
+  /// earlier scans of the group instead, so that a stream that those scans
+  /// read densely is prefetched on first use.
+  TrackingData trackingData(TrackingId id, uint64_t groupId);
+
   std::string_view id() const {
     return id_;
   }
@@ -160,6 +170,7 @@ class ScanTracker {
   const std::string id_;
   const std::function<void(ScanTracker*)> unregisterer_{nullptr};
   FileGroupStats* const fileGroupStats_;
+  ScanHistory* const scanHistory_;
 
   std::mutex mutex_;
   folly::F14FastMap<TrackingId, TrackingData> data_;
@@ -35,6 +35,8 @@
 #include <numeric>
 
 DECLARE_bool(velox_ssd_odirect);
+DECLARE_bool(velox_ssd_io_uring);
+DECLARE_bool(velox_ssd_async_recovery);
 DECLARE_bool(velox_ssd_verify_write);
 
 namespace facebook::velox::cache {
@@ -60,6 +62,23 @@ void addEntryToIovecs(AsyncDataCacheEntry& entry, std::vector<iovec>& iovecs) {
   }
 }
 
+// Appends the data of 'entry' to 'buffer'.
+void copyEntry(const AsyncDataCacheEntry& entry, char* buffer) {
+  if (entry.tinyData() != nullptr) {
+    ::memcpy(buffer, entry.tinyData(), entry.size());
+    return;
+  }
+  const auto& data = entry.data();
+  int64_t bytesLeft = entry.size();
+  for (auto i = 0; i < data.numRuns() && bytesLeft > 0; ++i) {
+    const auto run = data.runAt(i);
+    const auto bytes = std::min<int64_t>(bytesLeft, run.numBytes());
+    ::memcpy(buffer, run.data<char>(), bytes);
+    buffer += bytes;
+    bytesLeft -= bytes;
+  }
+}
+
 // Returns the number of entries in a cache 'entry'.
 uint32_t numIoVectorsFromEntry(AsyncDataCacheEntry& entry) {
   if (entry.tinyData() != nullptr) {
@@ -119,6 +138,7 @@ SsdFile::SsdFile(const Config& config)
   filesystems::FileOptions fileOptions;
   fileOptions.shouldThrowOnFileAlreadyExists = false;
   fileOptions.bufferIo = !FLAGS_velox_ssd_odirect;
+  fileOptions.useIoUring = FLAGS_velox_ssd_io_uring;
   writeFile_ = fs_->openFileForWrite(fileName_, fileOptions);
   readFile_ = fs_->openFileForRead(fileName_, fileOptions);
 
@@ -144,6 +164,10 @@ SsdFile::SsdFile(const Config& config)
   }
 }
 
+SsdFile::~SsdFile() {
+  waitForRecovery();
+}
+
 void SsdFile::pinRegion(uint64_t offset) {
   std::lock_guard<std::shared_mutex> l(mutex_);
   pinRegionLocked(offset);
@@ -345,6 +369,11 @@ void SsdFile::clearRegionEntriesLocked(const std::vector<int32_t>& regions) {
 
 void SsdFile::write(std::vector<CachePin>& pins) {
   process::TraceContext trace("SsdFile::write");
+  if (recovering_) {
+    // The writable space is known only after the checkpoint has been read.
+    ++stats_.writeSsdDropped;
+    return;
+  }
   // Sorts the pins by their file/offset. In this way what is adjacent in
   // storage is likely adjacent on SSD.
   std::sort(pins.begin(), pins.end());
@@ -353,6 +382,16 @@ void SsdFile::write(std::vector<CachePin>& pins) {
     VELOX_CHECK_NULL(entry->ssdFile());
   }
 
+  // Page aligned copies of runs of small entries. Allocated on first use.
+  memory::ContiguousAllocation coalesceBuffer;
+  auto* allocator = memory::memoryManager()->allocator();
+  SCOPE_EXIT {
+    if (!coalesceBuffer.empty()) {
+      allocator->freeContiguous(coalesceBuffer);
+    }
+  };
+  bool coalesceBufferFailed{false};
+
   int32_t writeIndex = 0;
   while (writeIndex < pins.size()) {
     auto space = getSpace(pins, writeIndex);
@@ -367,13 +406,34 @@ void SsdFile::write(std::vector<CachePin>& pins) {
     uint64_t writeOffset = offset;
     int32_t writeLength = 0;
     std::vector<iovec> writeIovecs;
+    // Bytes of 'coalesceBuffer' pending in 'writeIovecs'.
+    uint64_t coalescedBytes{0};
+    // True if the last of 'writeIovecs' is in 'coalesceBuffer' and the next
+    // small entry extends it.
+    bool coalescing{false};
     for (auto i = writeIndex; i < pins.size(); ++i) {
       auto* entry = pins[i].checkedEntry();
       const auto entrySize = entry->size();
-      const auto numIovecs = numIoVectorsFromEntry(*entry);
+      if (coalesceBuffer.empty() && !coalesceBufferFailed &&
+          entrySize <= kMaxCoalescedEntrySize) {
+        coalesceBufferFailed = !allocator->allocateContiguous(
+            memory::AllocationTraits::numPages(kCoalesceBufferSize),
+            nullptr,
+            coalesceBuffer);
+      }
+      const bool coalesce =
+          entrySize <= kMaxCoalescedEntrySize && !coalesceBuffer.empty();
+      const bool coalesceBufferFull =
+          coalesce && coalescedBytes + entrySize > kCoalesceBufferSize;
+      if (!coalesce || coalesceBufferFull) {
+        coalescing = false;
+      }
+      const auto numIovecs =
+          !coalesce ? numIoVectorsFromEntry(*entry) : (coalescing ? 0 : 1);
       VELOX_CHECK_LE(numIovecs, IOV_MAX);
-      if (writeIovecs.size() + numIovecs > IOV_MAX) {
-        // Writes out the accumulated iovecs if it exceeds IOV_MAX limit.
+      if (writeIovecs.size() + numIovecs > IOV_MAX || coalesceBufferFull) {
+        // Writes out the accumulated iovecs if it exceeds IOV_MAX limit or the
+        // coalesce buffer is full.
         if (!write(writeOffset, writeLength, writeIovecs)) {
           // If write fails, we return without adding the pins to the cache. The
           // entries are unchanged.
@@ -383,11 +443,23 @@ void SsdFile::write(std::vector<CachePin>& pins) {
         available -= writeLength;
         writeOffset += writeLength;
         writeLength = 0;
+        coalescedBytes = 0;
       }
       if (writeLength + entrySize > available) {
         break;
       }
-      addEntryToIovecs(*entry, writeIovecs);
+      if (coalesce) {
+        auto* target = coalesceBuffer.data<char>() + coalescedBytes;
+        if (!coalescing) {
+          writeIovecs.push_back({target, 0});
+          coalescing = true;
+        }
+        copyEntry(*entry, target);
+        writeIovecs.back().iov_len += entrySize;
+        coalescedBytes += entrySize;
+      } else {
+        addEntryToIovecs(*entry, writeIovecs);
+      }
       writeLength += entrySize;
       ++numWrittenEntries;
     }
@@ -403,24 +475,34 @@ void SsdFile::write(std::vector<CachePin>& pins) {
     }
     VELOX_CHECK_GE(fileSize_, writeOffset);
 
+    // The checksums and write verification read the entries and do not need
+    // the exclusive lock, which would block concurrent reads.
+    std::vector<SsdRun> runs;
+    runs.reserve(numWrittenEntries);
+    for (auto i = writeIndex; i < writeIndex + numWrittenEntries; ++i) {
+      auto* entry = pins[i].checkedEntry();
+      const auto size = entry->size();
+      uint32_t checksum = 0;
+      if (checksumEnabled_) {
+        checksum = checksumEntry(*entry);
+      }
+      runs.emplace_back(offset, size, checksum);
+      if (FLAGS_velox_ssd_verify_write) {
+        verifyWrite(*entry, runs.back());
+      }
+      offset += size;
+    }
+
     {
       std::lock_guard<std::shared_mutex> l(mutex_);
-      for (auto i = writeIndex; i < writeIndex + numWrittenEntries; ++i) {
-        auto* entry = pins[i].checkedEntry();
+      for (auto i = 0; i < numWrittenEntries; ++i) {
+        auto* entry = pins[writeIndex + i].checkedEntry();
         VELOX_CHECK_NULL(entry->ssdFile());
-        entry->setSsdFile(this, offset);
+        entry->setSsdFile(this, runs[i].offset());
         const auto size = entry->size();
         FileCacheKey key = {
             entry->key().fileNum, static_cast<uint64_t>(entry->offset())};
-        uint32_t checksum = 0;
-        if (checksumEnabled_) {
-          checksum = checksumEntry(*entry);
-        }
-        entries_[std::move(key)] = SsdRun(offset, size, checksum);
-        if (FLAGS_velox_ssd_verify_write) {
-          verifyWrite(*entry, SsdRun(offset, size, checksum));
-        }
-        offset += size;
+        entries_[std::move(key)] = runs[i];
         ++stats_.entriesWritten;
         stats_.bytesWritten += size;
         bytesAfterCheckpoint_ += size;
@@ -439,6 +521,7 @@ bool SsdFile::write(
     int64_t length,
     const std::vector<iovec>& iovecs) {
   try {
+    ++stats_.writeIos;
     writeFile_->write(iovecs, offset, length);
     return true;
   } catch (const std::exception&) {
@@ -498,10 +581,12 @@ void SsdFile::updateStats(SsdCacheStats& stats) const {
   std::shared_lock<std::shared_mutex> l(mutex_);
   stats.entriesWritten += stats_.entriesWritten;
   stats.bytesWritten += stats_.bytesWritten;
+  stats.writeIos += stats_.writeIos;
   stats.checkpointsWritten += stats_.checkpointsWritten;
   stats.entriesRead += stats_.entriesRead;
   stats.bytesRead += stats_.bytesRead;
   stats.checkpointsRead += stats_.checkpointsRead;
+  stats.entriesRecovered += stats_.entriesRecovered;
   stats.entriesCached += entries_.size();
   stats.regionsCached += numRegions_;
   for (auto i = 0; i < numRegions_; i++) {
@@ -513,6 +598,9 @@ void SsdFile::updateStats(SsdCacheStats& stats) const {
   for (auto pins : regionPins_) {
     stats.numPins += pins;
   }
+  if (recovering_) {
+    ++stats.shardsRecovering;
+  }
 
   stats.openFileErrors += stats_.openFileErrors;
   stats.openCheckpointErrors += stats_.openCheckpointErrors;
@@ -520,6 +608,7 @@ void SsdFile::updateStats(SsdCacheStats& stats) const {
   stats.deleteMetaFileErrors += stats_.deleteMetaFileErrors;
   stats.growFileErrors += stats_.growFileErrors;
   stats.writeSsdErrors += stats_.writeSsdErrors;
+  stats.writeSsdDropped += stats_.writeSsdDropped;
   stats.writeCheckpointErrors += stats_.writeCheckpointErrors;
   stats.readSsdErrors += stats_.readSsdErrors;
   stats.readCheckpointErrors += stats_.readCheckpointErrors;
@@ -528,6 +617,7 @@ void SsdFile::updateStats(SsdCacheStats& stats) const {
 }
 
 void SsdFile::clear() {
+  waitForRecovery();
   std::lock_guard<std::shared_mutex> l(mutex_);
   entries_.clear();
   std::fill(regionSizes_.begin(), regionSizes_.end(), 0);
@@ -548,6 +638,10 @@ bool SsdFile::removeFileEntries(
   }
 
   std::lock_guard<std::shared_mutex> l(mutex_);
+  if (recovering_) {
+    // The region sizes are set after the checkpoint has been read.
+    return false;
+  }
 
   int64_t entriesAgedOut = 0;
   auto it = entries_.begin();
@@ -727,7 +821,8 @@ void SsdFile::flushCheckpointFile() {
 void SsdFile::checkpoint(bool force) {
   process::TraceContext trace("SsdFile::checkpoint");
   std::lock_guard<std::shared_mutex> l(mutex_);
-  if (!needCheckpoint(force)) {
+  // The checkpoint being recovered stays valid since nothing is written.
+  if (recovering_ || !needCheckpoint(force)) {
     return;
   }
 
@@ -859,6 +954,15 @@ void SsdFile::initializeCheckpoint() {
     VELOX_FAIL("Could not open evict log {}: {}", logPath, e.what());
   }
 
+  if (FLAGS_velox_ssd_async_recovery && executor_ != nullptr) {
+    recovering_ = true;
+    executor_->add([this]() { recoverFromCheckpoint(); });
+    return;
+  }
+  recoverFromCheckpoint();
+}
+
+void SsdFile::recoverFromCheckpoint() {
   try {
     readCheckpoint();
   } catch (const std::exception& e) {
@@ -866,11 +970,24 @@ void SsdFile::initializeCheckpoint() {
     try {
       VELOX_SSD_CACHE_LOG(ERROR) << "Error recovering from checkpoint "
                                  << e.what() << ": Starting without checkpoint";
+      std::lock_guard<std::shared_mutex> l(mutex_);
       entries_.clear();
       deleteCheckpoint(true);
     } catch (const std::exception&) {
     }
   }
+  if (recovering_) {
+    {
+      std::lock_guard<std::shared_mutex> l(mutex_);
+      recovering_ = false;
+    }
+    recoveryCv_.notify_all();
+  }
+}
+
+void SsdFile::waitForRecovery() {
+  std::unique_lock<std::shared_mutex> l(mutex_);
+  recoveryCv_.wait(l, [&]() { return !recovering_; });
 }
 
 uint32_t SsdFile::checksumEntry(const AsyncDataCacheEntry& entry) const {
@@ -993,7 +1110,7 @@ void SsdFile::readCheckpoint() {
       maxRegions,
       maxRegions_,
       "Trying to start from checkpoint with a different capacity");
-  numRegions_ = readNumber<int32_t>(stream.get());
+  const auto numRegions = readNumber<int32_t>(stream.get());
 
   const auto scores = readVector<double>(stream.get(), maxRegions_);
   std::unordered_map<uint64_t, StringIdLease> idMap;
@@ -1022,7 +1139,21 @@ void SsdFile::readCheckpoint() {
     evictedMap.insert(region);
   }
 
-  std::vector<uint32_t> regionCacheSizes(numRegions_, 0);
+  // The entries are added to 'entries_' in batches, so that they can be found
+  // while the rest of the checkpoint is read. The region state is installed
+  // when the whole checkpoint has been read.
+  std::vector<std::pair<FileCacheKey, SsdRun>> batch;
+  batch.reserve(kRecoveryBatchSize);
+  const auto addBatch = [&]() {
+    std::lock_guard<std::shared_mutex> l(mutex_);
+    for (auto& [key, run] : batch) {
+      entries_[std::move(key)] = run;
+    }
+    stats_.entriesRecovered += batch.size();
+    batch.clear();
+  };
+  std::vector<uint32_t> regionSizes(maxRegions_, 0);
+  std::vector<uint32_t> regionCacheSizes(numRegions, 0);
   for (;;) {
     const auto fileNum = readNumber<uint64_t>(stream.get());
     if (fileNum == kCheckpointEndMarker) {
@@ -1043,36 +1174,41 @@ void SsdFile::readCheckpoint() {
     // The file may have a different id on restore.
     const auto it = idMap.find(fileNum);
     VELOX_CHECK(it != idMap.end());
-    FileCacheKey key{it->second, offset};
-    entries_[std::move(key)] = run;
+    batch.emplace_back(FileCacheKey{it->second, offset}, run);
+    if (batch.size() >= kRecoveryBatchSize) {
+      addBatch();
+    }
     regionCacheSizes[region] += run.size();
-    regionSizes_[region] = std::max<uint32_t>(
-        regionSizes_[region], regionOffset(run.offset()) + run.size());
+    regionSizes[region] = std::max<uint32_t>(
+        regionSizes[region], regionOffset(run.offset()) + run.size());
   }
+  addBatch();
 
   // NOTE: we might erase entries from a region for TTL eviction, so we need to
   // set the region size to the max offset of the recovered cache entry from the
   // region. Correspondingly, we substract the cached size from the region size
   // to get the erased size.
-  for (auto region = 0; region < numRegions_; ++region) {
-    VELOX_CHECK_LE(regionSizes_[region], kRegionSize);
-    VELOX_CHECK_LE(regionCacheSizes[region], regionSizes_[region]);
-    erasedRegionSizes_[region] =
-        regionSizes_[region] - regionCacheSizes[region];
+  std::vector<uint32_t> erasedRegionSizes(maxRegions_, 0);
+  for (auto region = 0; region < numRegions; ++region) {
+    VELOX_CHECK_LE(regionSizes[region], kRegionSize);
+    VELOX_CHECK_LE(regionCacheSizes[region], regionSizes[region]);
+    erasedRegionSizes[region] = regionSizes[region] - regionCacheSizes[region];
   }
 
-  ++stats_.checkpointsRead;
-  stats_.entriesRecovered += entries_.size();
-
-  // The state is successfully read. Install the access frequency scores and
-  // evicted regions.
+  // The state is successfully read. Install the region sizes, access frequency
+  // scores and evicted regions.
   VELOX_CHECK_EQ(scores.size(), tracker_.regionScores().size());
+  std::lock_guard<std::shared_mutex> l(mutex_);
+  numRegions_ = numRegions;
+  regionSizes_ = std::move(regionSizes);
+  erasedRegionSizes_ = std::move(erasedRegionSizes);
   // Set the writable regions by deduplicated evicted regions.
   writableRegions_.clear();
   for (auto region : evictedMap) {
     writableRegions_.push_back(region);
   }
   tracker_.setRegionScores(scores);
+  ++stats_.checkpointsRead;
 
   uint64_t cachedBytes{0};
   for (const auto regionSize : regionSizes_) {
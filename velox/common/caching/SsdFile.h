@@ -17,6 +17,7 @@
 #pragma once
 
 #include <gflags/gflags.h>
+#include <condition_variable>
 #include <shared_mutex>
 
 #include "velox/common/caching/AsyncDataCache.h"
@@ -145,6 +146,7 @@ struct SsdCacheStats {
   void operator=(const SsdCacheStats& other) {
     entriesWritten = tsanAtomicValue(other.entriesWritten);
     bytesWritten = tsanAtomicValue(other.bytesWritten);
+    writeIos = tsanAtomicValue(other.writeIos);
     checkpointsWritten = tsanAtomicValue(other.checkpointsWritten);
     entriesRead = tsanAtomicValue(other.entriesRead);
     entriesRecovered = tsanAtomicValue(other.entriesRecovered);
@@ -157,6 +159,7 @@ struct SsdCacheStats {
     regionsAgedOut = tsanAtomicValue(other.regionsAgedOut);
     regionsEvicted = tsanAtomicValue(other.regionsEvicted);
     numPins = tsanAtomicValue(other.numPins);
+    shardsRecovering = tsanAtomicValue(other.shardsRecovering);
 
     openFileErrors = tsanAtomicValue(other.openFileErrors);
     openCheckpointErrors = tsanAtomicValue(other.openCheckpointErrors);
@@ -177,6 +180,7 @@ struct SsdCacheStats {
     SsdCacheStats result;
     result.entriesWritten = entriesWritten - other.entriesWritten;
     result.bytesWritten = bytesWritten - other.bytesWritten;
+    result.writeIos = writeIos - other.writeIos;
     result.checkpointsWritten = checkpointsWritten - other.checkpointsWritten;
     result.entriesRead = entriesRead - other.entriesRead;
     result.entriesRecovered = entriesRecovered - other.entriesRecovered;
@@ -214,10 +218,14 @@ struct SsdCacheStats {
   tsan_atomic<uint64_t> regionsCached{0};
   tsan_atomic<uint64_t> bytesCached{0};
   tsan_atomic<int32_t> numPins{0};
+  /// Number of shards whose checkpoint is still being read in the background.
+  tsan_atomic<uint32_t> shardsRecovering{0};
 
   /// Cumulative stats
   tsan_atomic<uint64_t> entriesWritten{0};
   tsan_atomic<uint64_t> bytesWritten{0};
+  /// Number of write calls to the cache files.
+  tsan_atomic<uint64_t> writeIos{0};
   tsan_atomic<uint64_t> checkpointsWritten{0};
   tsan_atomic<uint64_t> entriesRead{0};
   tsan_atomic<uint64_t> entriesRecovered{0};
@@ -290,7 +298,7 @@ class SsdFile {
     /// If true, checksum read verification from SSD is enabled.
     bool checksumReadVerificationEnabled;
 
-    /// Executor for async fsync in checkpoint.
+    /// Executor for async fsync in checkpoint and checkpoint recovery.
     folly::Executor* executor;
   };
 
@@ -300,9 +308,15 @@ class SsdFile {
   /// filename.
   SsdFile(const Config& config);
 
+  /// Waits for a checkpoint recovery in progress.
+  ~SsdFile();
+
   /// Adds entries of 'pins' to this file. 'pins' must be in read mode and
   /// those pins that are successfully added to SSD are marked as being on SSD.
-  /// The file of the entries must be a file that is backed by 'this'.
+  /// The file of the entries must be a file that is backed by 'this'. Entries
+  /// that are adjacent on SSD are written with one call. Small entries are
+  /// copied to page aligned buffers, so that a run of them takes a single
+  /// iovec.
   void write(std::vector<CachePin>& pins);
 
   /// Finds an entry for 'key'. If no entry is found, the returned pin is empty.
@@ -359,6 +373,15 @@ class SsdFile {
   /// eviction log and leaves this open.
   void deleteCheckpoint(bool keepLog = false);
 
+  /// Returns true while the checkpoint is read in the background. The entries
+  /// read so far can be found and writes are dropped.
+  bool recovering() const {
+    return recovering_;
+  }
+
+  /// Waits until the checkpoint recovery started at construction is done.
+  void waitForRecovery();
+
   /// Returns the SSD file path.
   const std::string& fileName() const {
     return fileName_;
@@ -441,6 +464,10 @@ class SsdFile {
   // failed read deletes the checkpoint and leaves the truncated log open.
   void readCheckpoint();
 
+  // Reads the checkpoint and starts without one if the read fails. Clears
+  // 'recovering_' when done.
+  void recoverFromCheckpoint();
+
   // Logs an error message, deletes the checkpoint and stop making new
   // checkpoints.
   void checkpointError(int32_t rc, const std::string& error);
@@ -529,6 +556,11 @@ class SsdFile {
   static constexpr const char* kLogExtension = ".log";
   static constexpr const char* kCheckpointExtension = ".cpt";
   static constexpr uint32_t kCheckpointBufferSize = 1 << 20; // 1MB
+  // Entries up to this size are copied to coalesce buffers for writing.
+  static constexpr int32_t kMaxCoalescedEntrySize = 64 << 10;
+  static constexpr uint32_t kCoalesceBufferSize = 1 << 20; // 1MB
+  // Number of entries read from a checkpoint before they are made findable.
+  static constexpr int32_t kRecoveryBatchSize = 64 << 10;
 
   // Name of cache file, used as prefix for checkpoint files.
   const std::string fileName_;
@@ -559,6 +591,11 @@ class SsdFile {
   // cleared.
   bool suspended_{false};
 
+  // True while the checkpoint is read on 'executor_'. Cleared under 'mutex_'
+  // and signalled on 'recoveryCv_'.
+  std::atomic_bool recovering_{false};
+  std::condition_variable_any recoveryCv_;
+
   // Number of used bytes in each region. A new entry must fit between the
   // offset and the end of the region. This is sub-scripted with the region
   // index. The regionIndex times kRegionSize is an offset into the file.
@@ -603,7 +640,7 @@ class SsdFile {
   // means no checkpointing. This is set to 0 if checkpointing fails.
   int64_t checkpointIntervalBytes_{0};
 
-  // Executor for async fsync in checkpoint.
+  // Executor for async fsync in checkpoint and checkpoint recovery.
   folly::Executor* executor_;
 
   // Count of bytes written after last checkpoint.
@@ -21,6 +21,7 @@
 #include "velox/common/caching/FileIds.h"
 #include "velox/common/caching/SsdCache.h"
 #include "velox/common/caching/tests/CacheTestUtil.h"
+#include "velox/common/compression/Compression.h"
 #include "velox/common/file/FileSystems.h"
 #include "velox/common/memory/Memory.h"
 #include "velox/common/memory/MmapAllocator.h"
@@ -1076,6 +1077,123 @@ TEST_P(AsyncDataCacheTest, staleEntry) {
   ASSERT_EQ(stats.numHit, 1);
 }
 
+TEST_P(AsyncDataCacheTest, segmentedEviction) {
+  constexpr uint64_t kRamBytes = 64UL << 20;
+  constexpr uint64_t kEntryBytes = 64 << 10;
+  constexpr int32_t kNumHot = 64;
+  constexpr uint64_t kHotGroup = 1;
+  constexpr uint64_t kScanGroup = 2;
+  AsyncDataCache::Options options;
+  options.evictionPolicy = EvictionPolicy::kSegmented;
+  initializeCache(kRamBytes, 0, 0, false, options);
+  StringIdLease hotFile(fileIds(), std::string_view("segmentedEvictionHot"));
+  StringIdLease scanFile(fileIds(), std::string_view("segmentedEvictionScan"));
+
+  auto load = [&](const StringIdLease& file, uint64_t offset, uint64_t group) {
+    folly::SemiFuture<bool> wait(false);
+    auto pin = cache_->findOrCreate({file.id(), offset}, kEntryBytes, &wait);
+    ASSERT_FALSE(pin.empty());
+    if (pin.entry()->isExclusive()) {
+      pin.entry()->setGroupId(group);
+      pin.entry()->setExclusiveToShared();
+    }
+  };
+
+  // The hot entries are used three times each.
+  for (auto i = 0; i < 3; ++i) {
+    for (auto j = 0; j < kNumHot; ++j) {
+      load(hotFile, j * kEntryBytes, kHotGroup);
+    }
+  }
+  // A scan of 4x the cache capacity touches each of its entries once.
+  for (uint64_t offset = 0; offset < 4 * kRamBytes; offset += kEntryBytes) {
+    load(scanFile, offset, kScanGroup);
+  }
+  auto stats = cache_->refreshStats();
+  ASSERT_LT(0, stats.numEvict);
+  for (auto j = 0; j < kNumHot; ++j) {
+    EXPECT_TRUE(cache_->exists({hotFile.id(), j * kEntryBytes}));
+  }
+
+  const auto& hotStats = stats.groupStats[kHotGroup];
+  EXPECT_EQ(hotStats.numLoad, kNumHot);
+  EXPECT_EQ(hotStats.numHit, 2 * kNumHot);
+  EXPECT_EQ(hotStats.hitBytes, 2 * kNumHot * kEntryBytes);
+  EXPECT_DOUBLE_EQ(hotStats.hitRate(), 2.0 / 3);
+  const auto& scanStats = stats.groupStats[kScanGroup];
+  EXPECT_EQ(scanStats.numLoad, 4 * kRamBytes / kEntryBytes);
+  EXPECT_EQ(scanStats.loadBytes, 4 * kRamBytes);
+  EXPECT_EQ(scanStats.numHit, 0);
+  EXPECT_EQ(scanStats.hitRate(), 0);
+}
+
+TEST_P(AsyncDataCacheTest, compressedTier) {
+  if (!common::Codec::isAvailable(common::CompressionKind_LZ4)) {
+    GTEST_SKIP() << "Requires LZ4";
+  }
+  constexpr uint64_t kRamBytes = 64UL << 20;
+  constexpr uint64_t kEntryBytes = 64 << 10;
+  AsyncDataCache::Options options;
+  options.maxCompressedBytes = 16 << 20;
+  initializeCache(kRamBytes, 0, 0, false, options);
+  StringIdLease file(fileIds(), std::string_view("compressedTier"));
+
+  // Fills each entry with a byte derived from its offset.
+  auto fill = [](uint64_t offset) {
+    return static_cast<char>(offset / kEntryBytes);
+  };
+  auto checkData = [&](const AsyncDataCacheEntry& entry) {
+    const auto& data = entry.data();
+    for (auto i = 0; i < data.numRuns(); ++i) {
+      const auto run = data.runAt(i);
+      const std::string expected(run.numBytes(), fill(entry.offset()));
+      ASSERT_EQ(
+          ::memcmp(run.data<char>(), expected.data(), expected.size()), 0);
+    }
+  };
+  for (uint64_t offset = 0; offset < 2 * kRamBytes; offset += kEntryBytes) {
+    folly::SemiFuture<bool> wait(false);
+    auto pin = cache_->findOrCreate({file.id(), offset}, kEntryBytes, &wait);
+    ASSERT_TRUE(pin.entry()->isExclusive());
+    auto& data = pin.entry()->data();
+    for (auto i = 0; i < data.numRuns(); ++i) {
+      const auto run = data.runAt(i);
+      ::memset(run.data<char>(), fill(offset), run.numBytes());
+    }
+    pin.entry()->setExclusiveToShared(false);
+  }
+  auto stats = cache_->refreshStats();
+  ASSERT_LT(0, stats.numCompress);
+  ASSERT_EQ(stats.numCompressedEntries, stats.numCompress);
+  ASSERT_EQ(stats.compressedSize, stats.compressOutputBytes);
+  ASSERT_EQ(
+      stats.compressInputBytes,
+      stats.numCompress * static_cast<int64_t>(kEntryBytes));
+  ASSERT_LT(10, stats.compressionRatio());
+  ASSERT_EQ(stats.numDecompress, 0);
+  // The compressed entries are not evicted while the tier has space.
+  ASSERT_EQ(stats.numEvict, 0);
+
+  // The first entry is compressed and is decompressed by the next lookup.
+  folly::SemiFuture<bool> wait(false);
+  auto pin = cache_->findOrCreate({file.id(), 0}, kEntryBytes, &wait);
+  ASSERT_FALSE(pin.empty());
+  ASSERT_TRUE(pin.entry()->isShared());
+  ASSERT_FALSE(pin.entry()->isCompressed());
+  checkData(*pin.entry());
+  const auto newStats = cache_->refreshStats() - stats;
+  ASSERT_EQ(newStats.numDecompress, 1);
+  ASSERT_EQ(newStats.numHit, 1);
+  ASSERT_EQ(newStats.numNew, 0);
+  ASSERT_LT(0, newStats.decompressClocks);
+  pin.clear();
+
+  cache_->clear();
+  stats = cache_->refreshStats();
+  ASSERT_EQ(stats.numCompressedEntries, 0);
+  ASSERT_EQ(stats.compressedSize, 0);
+}
+
 TEST_P(AsyncDataCacheTest, shrinkCache) {
   constexpr uint64_t kRamBytes = 128UL << 20;
   constexpr uint64_t kSsdBytes = 512UL << 20;
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/caching/ScanHistory.h"
+
+#include <gtest/gtest.h>
+
+using namespace facebook::velox::cache;
+
+TEST(ScanHistoryTest, firstUseFromHistory) {
+  constexpr uint64_t kFileId = 1;
+  constexpr uint64_t kGroupId = 10;
+  constexpr uint64_t kOtherGroupId = 11;
+  const TrackingId dense(1);
+  const TrackingId sparse(2);
+  ScanHistory history;
+
+  {
+    ScanTracker tracker("scan1", nullptr, 1 << 20, nullptr, &history);
+    for (auto i = 0; i < 4; ++i) {
+      tracker.recordReference(dense, 1000, kFileId, kGroupId);
+      tracker.recordRead(dense, 1000, kFileId, kGroupId);
+      tracker.recordReference(sparse, 1000, kFileId, kGroupId);
+    }
+    tracker.recordRead(sparse, 1000, kFileId, kGroupId);
+  }
+  EXPECT_EQ(history.size(), 2);
+
+  // A new scan has only the reference being planned. The history gives the
+  // read density of the earlier scan.
+  ScanTracker tracker("scan2", nullptr, 1 << 20, nullptr, &history);
+  tracker.recordReference(dense, 1000, kFileId, kGroupId);
+  auto data = tracker.trackingData(dense, kGroupId);
+  EXPECT_EQ(data.referencedBytes, 5000);
+  EXPECT_EQ(data.lastReferencedBytes, 1000);
+  EXPECT_EQ(data.readBytes, 4000);
+
+  tracker.recordReference(sparse, 1000, kFileId, kGroupId);
+  data = tracker.trackingData(sparse, kGroupId);
+  EXPECT_EQ(data.referencedBytes, 5000);
+  EXPECT_EQ(data.readBytes, 1000);
+
+  // Nothing is known about the other group.
+  tracker.recordReference(dense, 1000, kFileId, kOtherGroupId);
+  data = tracker.trackingData(dense, kOtherGroupId);
+  EXPECT_EQ(data.referencedBytes, 1000);
+  EXPECT_EQ(data.lastReferencedBytes, 1000);
+  EXPECT_EQ(data.readBytes, 0);
+
+  // Once the scan has its own references, its own data is used.
+  tracker.recordRead(dense, 1000, kFileId, kGroupId);
+  tracker.recordReference(dense, 1000, kFileId, kGroupId);
+  data = tracker.trackingData(dense, kGroupId);
+  EXPECT_EQ(data.referencedBytes, 2000);
+  EXPECT_EQ(data.readBytes, 1000);
+
+  // Without a history only the scan's own data is used.
+  ScanTracker noHistory("scan3", nullptr, 1 << 20);
+  noHistory.recordReference(dense, 1000, kFileId, kGroupId);
+  data = noHistory.trackingData(dense, kGroupId);
+  EXPECT_EQ(data.referencedBytes, 1000);
+  EXPECT_EQ(data.readBytes, 0);
+}
+
+TEST(ScanHistoryTest, decay) {
+  constexpr int32_t kNumStreams = ScanHistory::kMaxEntriesPerShard * 64;
+  ScanHistory history;
+  for (auto i = 0; i < kNumStreams; ++i) {
+    history.recordReference(i, TrackingId(1), 1000);
+    history.recordRead(i, TrackingId(1), 1000);
+  }
+  // The rarely referenced streams are dropped when a shard fills up.
+  EXPECT_LE(history.size(), kNumStreams / 4);
+
+  // A stream referenced a lot is kept with halved counts.
+  history.clear();
+  history.recordReference(0, TrackingId(1), 100 << 20);
+  history.recordRead(0, TrackingId(1), 50 << 20);
+  for (auto i = 1; i < kNumStreams; ++i) {
+    history.recordReference(i, TrackingId(1), 1000);
+  }
+  const auto data = history.trackingData(0, TrackingId(1));
+  EXPECT_GT(data.referencedBytes, 0);
+  EXPECT_LT(data.referencedBytes, 100 << 20);
+  EXPECT_EQ(data.readBytes / data.referencedBytes, 0.5);
+  EXPECT_LE(data.lastReferencedBytes, data.referencedBytes);
+  history.clear();
+  EXPECT_EQ(history.size(), 0);
+}
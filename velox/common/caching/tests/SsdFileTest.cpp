@@ -23,7 +23,9 @@
 #include "velox/exec/tests/utils/TempDirectoryPath.h"
 
 #include <fcntl.h>
+#include <folly/ScopeGuard.h>
 #include <folly/executors/IOThreadPoolExecutor.h>
+#include <folly/executors/ManualExecutor.h>
 #include <folly/executors/QueuedImmediateExecutor.h>
 #include <glog/logging.h>
 #include <gtest/gtest.h>
@@ -35,6 +37,7 @@ using namespace facebook::velox::tests::utils;
 
 using facebook::velox::memory::MemoryAllocator;
 
+DECLARE_bool(velox_ssd_async_recovery);
 DECLARE_bool(velox_ssd_odirect);
 DECLARE_bool(velox_ssd_verify_write);
 
@@ -96,7 +99,8 @@ class SsdFileTest : public testing::Test {
       uint64_t checkpointIntervalBytes = 0,
       bool checksumEnabled = false,
       bool checksumReadVerificationEnabled = false,
-      bool disableFileCow = false) {
+      bool disableFileCow = false,
+      folly::Executor* executor = nullptr) {
     SsdFile::Config config(
         fmt::format("{}/ssdtest", tempDirectory_->getPath()),
         0, // shardId
@@ -105,7 +109,7 @@ class SsdFileTest : public testing::Test {
         disableFileCow,
         checksumEnabled,
         checksumReadVerificationEnabled,
-        ssdExecutor());
+        executor != nullptr ? executor : ssdExecutor());
     ssdFile_ = std::make_unique<SsdFile>(config);
     if (ssdFile_ != nullptr) {
       ssdFileHelper_ =
@@ -401,6 +405,33 @@ TEST_F(SsdFileTest, writeAndRead) {
   }
 }
 
+TEST_F(SsdFileTest, coalescedWrite) {
+  constexpr int64_t kSsdSize = 16 * SsdFile::kRegionSize;
+  initializeCache(kSsdSize);
+  FLAGS_velox_ssd_verify_write = true;
+
+  // 200 small entries fit in one coalesce buffer and are written with one
+  // call.
+  auto pins = makePins(fileName_.id(), 0, 4096, 8192, 200 * 4096);
+  SsdCacheStats stats;
+  ssdFile_->updateStats(stats);
+  ssdFile_->write(pins);
+  SsdCacheStats newStats;
+  ssdFile_->updateStats(newStats);
+  ASSERT_EQ(newStats.writeIos - stats.writeIos, 1);
+  ASSERT_EQ(newStats.entriesWritten - stats.entriesWritten, pins.size());
+  readAndCheckPins(pins);
+  pins.clear();
+
+  // Small entries between large ones are written with the large ones.
+  pins = makePins(fileName_.id(), 1 << 30, 4096, 1 << 20, 8 << 20);
+  ssdFile_->write(pins);
+  SsdCacheStats finalStats;
+  ssdFile_->updateStats(finalStats);
+  ASSERT_EQ(finalStats.writeIos - newStats.writeIos, 1);
+  readAndCheckPins(pins);
+}
+
 TEST_F(SsdFileTest, checkpoint) {
   constexpr int64_t kSsdSize = 16 * SsdFile::kRegionSize;
   const uint64_t checkpointIntervalBytes = 5 * SsdFile::kRegionSize;
@@ -498,6 +529,56 @@ TEST_F(SsdFileTest, checkpoint) {
   EXPECT_EQ(numEntriesFound, 0);
 }
 
+TEST_F(SsdFileTest, asyncRecovery) {
+  constexpr int64_t kSsdSize = 16 * SsdFile::kRegionSize;
+  const uint64_t checkpointIntervalBytes = 5 * SsdFile::kRegionSize;
+  initializeCache(kSsdSize, checkpointIntervalBytes);
+
+  std::vector<TestEntry> allEntries;
+  for (auto startOffset = 0; startOffset <= kSsdSize - SsdFile::kRegionSize;
+       startOffset += SsdFile::kRegionSize) {
+    auto pins =
+        makePins(fileName_.id(), startOffset, 4096, 2048 * 1025, 62 * kMB);
+    ssdFile_->write(pins);
+    for (auto& pin : pins) {
+      allEntries.emplace_back(
+          pin.entry()->key(), pin.entry()->ssdOffset(), pin.entry()->size());
+    }
+  }
+  ssdFile_->checkpoint(true);
+
+  FLAGS_velox_ssd_async_recovery = true;
+  SCOPE_EXIT {
+    FLAGS_velox_ssd_async_recovery = false;
+  };
+  folly::ManualExecutor executor;
+  initializeSsdFile(
+      kSsdSize, checkpointIntervalBytes, false, false, false, &executor);
+  // Drops the entries from memory so that they are looked up on SSD.
+  cache_->clear();
+  ASSERT_TRUE(ssdFile_->recovering());
+  SsdCacheStats stats;
+  ssdFile_->updateStats(stats);
+  ASSERT_EQ(stats.shardsRecovering, 1);
+  ASSERT_EQ(stats.entriesRecovered, 0);
+  ASSERT_EQ(checkEntries(allEntries), 0);
+
+  // Writes are dropped until the checkpoint has been read.
+  auto pins = makePins(fileName_.id(), kSsdSize, 4096, 4096, 4096);
+  ssdFile_->write(pins);
+  ASSERT_EQ(pins[0].entry()->ssdFile(), nullptr);
+  pins.clear();
+
+  executor.drain();
+  ASSERT_FALSE(ssdFile_->recovering());
+  stats.clear();
+  ssdFile_->updateStats(stats);
+  ASSERT_EQ(stats.shardsRecovering, 0);
+  ASSERT_EQ(stats.entriesRecovered, allEntries.size());
+  ASSERT_EQ(stats.writeSsdDropped, 1);
+  ASSERT_EQ(checkEntries(allEntries), allEntries.size());
+}
+
 TEST_F(SsdFileTest, fileCorruption) {
   constexpr int64_t kSsdSize = 16 * SsdFile::kRegionSize;
   const uint64_t checkpointIntervalBytes = 5 * SsdFile::kRegionSize;
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/compression/ZstdCompression.h"
+#include "velox/common/base/Exceptions.h"
+
+#include <zdict.h>
+#include <zstd.h>
+
+namespace facebook::velox::common {
+namespace {
+
+Status zstdError(const char* prefixMessage, size_t errorCode) {
+  return Status::IOError("{}{}", prefixMessage, ZSTD_getErrorName(errorCode));
+}
+} // namespace
+
+class ZstdCodec : public Codec {
+ public:
+  ZstdCodec(
+      int32_t compressionLevel,
+      std::shared_ptr<const std::string> dictionary,
+      int32_t numWorkers);
+
+  ~ZstdCodec() override;
+
+  uint64_t maxCompressedLength(uint64_t inputLength) override;
+
+  Expected<uint64_t> compress(
+      const uint8_t* input,
+      uint64_t inputLength,
+      uint8_t* output,
+      uint64_t outputLength) override;
+
+  Expected<uint64_t> decompress(
+      const uint8_t* input,
+      uint64_t inputLength,
+      uint8_t* output,
+      uint64_t outputLength) override;
+
+  Expected<uint64_t> getUncompressedLength(
+      const uint8_t* input,
+      uint64_t inputLength) const override;
+
+  int32_t minCompressionLevel() const override;
+
+  int32_t maxCompressionLevel() const override;
+
+  int32_t defaultCompressionLevel() const override;
+
+  int32_t compressionLevel() const override;
+
+  CompressionKind compressionKind() const override;
+
+  std::string_view name() const override {
+    return "zstd";
+  }
+
+ private:
+  Status init() override;
+
+  const int32_t compressionLevel_;
+  const std::shared_ptr<const std::string> dictionary_;
+  const int32_t numWorkers_;
+
+  ZSTD_CCtx* cctx_{nullptr};
+  ZSTD_DCtx* dctx_{nullptr};
+  // Digested forms of 'dictionary_', built once in init() so that each call
+  // does not pay for loading the dictionary.
+  ZSTD_CDict* cdict_{nullptr};
+  ZSTD_DDict* ddict_{nullptr};
+};
+
+ZstdCodec::ZstdCodec(
+    int32_t compressionLevel,
+    std::shared_ptr<const std::string> dictionary,
+    int32_t numWorkers)
+    : compressionLevel_(
+          compressionLevel == kDefaultCompressionLevel ? ZSTD_CLEVEL_DEFAULT
+                                                       : compressionLevel),
+      dictionary_(std::move(dictionary)),
+      numWorkers_(numWorkers) {}
+
+ZstdCodec::~ZstdCodec() {
+  ZSTD_freeCDict(cdict_);
+  ZSTD_freeDDict(ddict_);
+  ZSTD_freeCCtx(cctx_);
+  ZSTD_freeDCtx(dctx_);
+}
+
+Status ZstdCodec::init() {
+  VELOX_RETURN_IF(
+      numWorkers_ < 0,
+      Status::Invalid("Invalid number of zstd workers: {}", numWorkers_));
+  cctx_ = ZSTD_createCCtx();
+  dctx_ = ZSTD_createDCtx();
+  VELOX_RETURN_IF(
+      cctx_ == nullptr || dctx_ == nullptr,
+      Status::IOError("Failed to create zstd context."));
+
+  auto ret = ZSTD_CCtx_setParameter(
+      cctx_, ZSTD_c_compressionLevel, compressionLevel_);
+  VELOX_RETURN_IF(
+      ZSTD_isError(ret), zstdError("Zstd set compression level failed: ", ret));
+
+  if (numWorkers_ > 0) {
+    ret = ZSTD_CCtx_setParameter(cctx_, ZSTD_c_nbWorkers, numWorkers_);
+    VELOX_RETURN_IF(
+        ZSTD_isError(ret),
+        Status::Invalid(
+            "Zstd compression with {} workers is not supported: {}",
+            numWorkers_,
+            ZSTD_getErrorName(ret)));
+  }
+
+  if (dictionary_ != nullptr && !dictionary_->empty()) {
+    cdict_ = ZSTD_createCDict(
+        dictionary_->data(), dictionary_->size(), compressionLevel_);
+    ddict_ = ZSTD_createDDict(dictionary_->data(), dictionary_->size());
+    VELOX_RETURN_IF(
+        cdict_ == nullptr || ddict_ == nullptr,
+        Status::IOError("Failed to load zstd dictionary."));
+    ret = ZSTD_CCtx_refCDict(cctx_, cdict_);
+    VELOX_RETURN_IF(
+        ZSTD_isError(ret), zstdError("Zstd set dictionary failed: ", ret));
+  }
+  return Status::OK();
+}
+
+uint64_t ZstdCodec::maxCompressedLength(uint64_t inputLength) {
+  return ZSTD_compressBound(inputLength);
+}
+
+Expected<uint64_t> ZstdCodec::compress(
+    const uint8_t* input,
+    uint64_t inputLength,
+    uint8_t* output,
+    uint64_t outputLength) {
+  VELOX_CHECK_NOT_NULL(input);
+  VELOX_CHECK_NOT_NULL(output);
+  // Parameters and the dictionary set in init() are sticky. Each call
+  // produces one complete frame which records its decompressed size.
+  auto ret = ZSTD_compress2(cctx_, output, outputLength, input, inputLength);
+  VELOX_RETURN_UNEXPECTED_IF(
+      ZSTD_isError(ret), zstdError("Zstd compression failure: ", ret));
+  return static_cast<uint64_t>(ret);
+}
+
+Expected<uint64_t> ZstdCodec::decompress(
+    const uint8_t* input,
+    uint64_t inputLength,
+    uint8_t* output,
+    uint64_t outputLength) {
+  VELOX_CHECK_NOT_NULL(input);
+  VELOX_CHECK_NOT_NULL(output);
+  size_t ret;
+  if (ddict_ != nullptr) {
+    ret = ZSTD_decompress_usingDDict(
+        dctx_, output, outputLength, input, inputLength, ddict_);
+  } else {
+    ret = ZSTD_decompressDCtx(dctx_, output, outputLength, input, inputLength);
+  }
+  VELOX_RETURN_UNEXPECTED_IF(
+      ZSTD_isError(ret), zstdError("Zstd decompression failure: ", ret));
+  return static_cast<uint64_t>(ret);
+}
+
+Expected<uint64_t> ZstdCodec::getUncompressedLength(
+    const uint8_t* input,
+    uint64_t inputLength) const {
+  VELOX_CHECK_NOT_NULL(input);
+  auto size = ZSTD_getFrameContentSize(input, inputLength);
+  VELOX_RETURN_UNEXPECTED_IF(
+      size == ZSTD_CONTENTSIZE_ERROR,
+      Status::IOError("Corrupted zstd frame header."));
+  VELOX_RETURN_UNEXPECTED_IF(
+      size == ZSTD_CONTENTSIZE_UNKNOWN,
+      Status::IOError("Zstd frame does not record its decompressed size."));
+  return static_cast<uint64_t>(size);
+}
+
+int32_t ZstdCodec::minCompressionLevel() const {
+  return ZSTD_minCLevel();
+}
+
+int32_t ZstdCodec::maxCompressionLevel() const {
+  return ZSTD_maxCLevel();
+}
+
+int32_t ZstdCodec::defaultCompressionLevel() const {
+  return ZSTD_CLEVEL_DEFAULT;
+}
+
+int32_t ZstdCodec::compressionLevel() const {
+  return compressionLevel_;
+}
+
+CompressionKind ZstdCodec::compressionKind() const {
+  return CompressionKind_ZSTD;
+}
+
+std::unique_ptr<Codec> makeZstdCodec(
+    int32_t compressionLevel,
+    std::shared_ptr<const std::string> dictionary,
+    int32_t numWorkers) {
+  return std::make_unique<ZstdCodec>(
+      compressionLevel, std::move(dictionary), numWorkers);
+}
+
+Expected<std::string> trainZstdDictionary(
+    const std::vector<std::string_view>& samples,
+    size_t maxDictionarySize) {
+  // ZDICT takes the samples concatenated in one buffer plus their sizes.
+  std::string buffer;
+  std::vector<size_t> sizes;
+  sizes.reserve(samples.size());
+  for (const auto& sample : samples) {
+    buffer.append(sample.data(), sample.size());
+    sizes.push_back(sample.size());
+  }
+  std::string dictionary(maxDictionarySize, '\0');
+  auto ret = ZDICT_trainFromBuffer(
+      dictionary.data(),
+      dictionary.size(),
+      buffer.data(),
+      sizes.data(),
+      static_cast<unsigned>(sizes.size()));
+  VELOX_RETURN_UNEXPECTED_IF(
+      ZDICT_isError(ret),
+      Status::Invalid(
+          "Zstd dictionary training failed: {}", ZDICT_getErrorName(ret)));
+  dictionary.resize(ret);
+  return dictionary;
+}
+} // namespace facebook::velox::common
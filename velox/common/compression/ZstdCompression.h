@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "velox/common/compression/Compression.h"
+
+namespace facebook::velox::common {
+
+struct ZstdCodecOptions : CodecOptions {
+  ZstdCodecOptions(
+      int32_t compressionLevel = kDefaultCompressionLevel,
+      std::shared_ptr<const std::string> dictionary = nullptr,
+      int32_t numWorkers = 0)
+      : CodecOptions(compressionLevel),
+        dictionary(std::move(dictionary)),
+        numWorkers(numWorkers) {}
+
+  /// Dictionary used for both compression and decompression, typically
+  /// produced by trainZstdDictionary(). Data compressed with a dictionary can
+  /// only be decompressed by a codec created with the same dictionary. Null
+  /// means no dictionary.
+  std::shared_ptr<const std::string> dictionary;
+
+  /// Number of zstd worker threads used by compress(). With 0 the input is
+  /// compressed on the calling thread. Values above 0 need a libzstd built
+  /// with multi-threading support, otherwise codec creation fails.
+  int32_t numWorkers;
+};
+
+/// Zstd frame format codec. The codec keeps its compression and decompression
+/// contexts across calls so it must not be used from multiple threads
+/// concurrently.
+std::unique_ptr<Codec> makeZstdCodec(
+    int32_t compressionLevel = kDefaultCompressionLevel,
+    std::shared_ptr<const std::string> dictionary = nullptr,
+    int32_t numWorkers = 0);
+
+/// Trains a zstd dictionary of at most 'maxDictionarySize' bytes from
+/// 'samples'. The samples should be representative of the small buffers the
+/// dictionary is used for, e.g. pages of a single column type. Returns an
+/// error if zstd cannot train on the given samples, e.g. when there are too
+/// few of them.
+Expected<std::string> trainZstdDictionary(
+    const std::vector<std::string_view>& samples,
+    size_t maxDictionarySize);
+} // namespace facebook::velox::common
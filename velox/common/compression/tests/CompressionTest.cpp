@@ -27,6 +27,7 @@
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/common/compression/Compression.h"
 #include "velox/common/compression/Lz4Compression.h"
+#include "velox/common/compression/ZstdCompression.h"
 
 namespace facebook::velox::common {
 
@@ -64,6 +65,19 @@ std::vector<TestParams> generateLz4TestParams() {
   return params;
 }
 
+std::vector<TestParams> generateZstdTestParams() {
+  std::vector<TestParams> params;
+  params.emplace_back(CompressionKind_ZSTD);
+  // Raw content dictionary.
+  params.emplace_back(
+      CompressionKind_ZSTD,
+      std::make_shared<ZstdCodecOptions>(
+          kDefaultCompressionLevel,
+          std::make_shared<const std::string>(
+              "The quick brown fox jumps over the lazy dog")));
+  return params;
+}
+
 std::vector<uint8_t> makeRandomData(size_t n) {
   // Allocate at least 1 byte to ensure data.data() is not nullptr.
   size_t bytes = n == 0 ? 1 : n;
@@ -507,6 +521,11 @@ INSTANTIATE_TEST_SUITE_P(
     CodecTest,
     ::testing::ValuesIn(generateLz4TestParams()));
 
+INSTANTIATE_TEST_SUITE_P(
+    TestZstd,
+    CodecTest,
+    ::testing::ValuesIn(generateZstdTestParams()));
+
 TEST(CodecLZ4HadoopTest, compatibility) {
   // LZ4 Hadoop codec should be able to read back LZ4 raw blocks.
   auto c1 = Codec::create(
@@ -523,6 +542,99 @@ TEST(CodecLZ4HadoopTest, compatibility) {
   }
 }
 
+TEST(CodecZstdTest, trainedDictionary) {
+  std::default_random_engine engine(42);
+  std::uniform_int_distribution<int32_t> dist(0, 1'000'000);
+  std::vector<std::string> pages;
+  for (auto i = 0; i < 2'000; ++i) {
+    pages.push_back(fmt::format(
+        "{{\"id\": {}, \"name\": \"Customer#{}\", \"segment\": \"{}\", "
+        "\"balance\": {}}}",
+        i,
+        dist(engine),
+        i % 3 == 0 ? "AUTOMOBILE" : "MACHINERY",
+        dist(engine)));
+  }
+  const std::vector<std::string_view> samples(pages.begin(), pages.end());
+  constexpr size_t kMaxDictionarySize = 4 << 10;
+  auto dictionary = std::make_shared<const std::string>(
+      trainZstdDictionary(samples, kMaxDictionarySize)
+          .thenOrThrow(folly::identity, throwsNotOk));
+  ASSERT_FALSE(dictionary->empty());
+  ASSERT_LE(dictionary->size(), kMaxDictionarySize);
+
+  auto plainCodec = Codec::create(CompressionKind_ZSTD)
+                        .thenOrThrow(folly::identity, throwsNotOk);
+  auto dictionaryCodec =
+      Codec::create(
+          CompressionKind_ZSTD,
+          ZstdCodecOptions{kDefaultCompressionLevel, dictionary})
+          .thenOrThrow(folly::identity, throwsNotOk);
+
+  const auto compress = [](Codec* codec, const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> compressed(codec->maxCompressedLength(data.size()));
+    auto compressedLength =
+        codec
+            ->compress(
+                data.data(), data.size(), compressed.data(), compressed.size())
+            .thenOrThrow(folly::identity, throwsNotOk);
+    compressed.resize(compressedLength);
+    return compressed;
+  };
+
+  uint64_t plainBytes = 0;
+  uint64_t dictionaryBytes = 0;
+  for (const auto& page : pages) {
+    const std::vector<uint8_t> data(page.begin(), page.end());
+    checkCodecRoundtrip(dictionaryCodec, data);
+    plainBytes += compress(plainCodec.get(), data).size();
+    dictionaryBytes += compress(dictionaryCodec.get(), data).size();
+  }
+  // Small pages compress much better with a dictionary trained on them.
+  ASSERT_LT(dictionaryBytes, plainBytes);
+
+  // Frames written with a dictionary cannot be read without it.
+  const std::vector<uint8_t> data(pages[0].begin(), pages[0].end());
+  auto compressed = compress(dictionaryCodec.get(), data);
+  std::vector<uint8_t> decompressed(data.size());
+  auto result = plainCodec->decompress(
+      compressed.data(),
+      compressed.size(),
+      decompressed.data(),
+      decompressed.size());
+  ASSERT_TRUE(result.hasError());
+  ASSERT_EQ(result.error().code(), StatusCode::kIOError);
+
+  VELOX_ASSERT_ERROR_STATUS(
+      trainZstdDictionary({}, kMaxDictionarySize).error(),
+      StatusCode::kInvalid,
+      "Zstd dictionary training failed");
+}
+
+TEST(CodecZstdTest, workers) {
+  VELOX_ASSERT_ERROR_STATUS(
+      Codec::create(
+          CompressionKind_ZSTD,
+          ZstdCodecOptions{kDefaultCompressionLevel, nullptr, -1})
+          .error(),
+      StatusCode::kInvalid,
+      "Invalid number of zstd workers: -1");
+
+  auto codec = Codec::create(
+      CompressionKind_ZSTD,
+      ZstdCodecOptions{kDefaultCompressionLevel, nullptr, 4});
+  if (codec.hasError()) {
+    // libzstd is built without multi-threading support.
+    ASSERT_EQ(codec.error().code(), StatusCode::kInvalid);
+    return;
+  }
+  // The largest size spans several zstd jobs, one per worker.
+  for (auto dataSize : {0, 10'000, 16 << 20}) {
+    checkCodecRoundtrip(codec.value(), makeRandomData(dataSize));
+    checkCodecRoundtrip(codec.value(), makeCompressibleData(dataSize));
+  }
+}
+
 TEST(CodecTestInvalid, invalidKind) {
   CompressionKind kind = CompressionKind_NONE;
   ASSERT_FALSE(Codec::isAvailable(kind));
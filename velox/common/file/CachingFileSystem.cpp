@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/common/file/CachingFileSystem.h"
+
+#include <fmt/format.h>
+#include <folly/hash/Hash.h>
+
+#include <filesystem>
+
+#include "velox/common/base/Exceptions.h"
+#include "velox/common/file/File.h"
+#include "velox/common/time/Timer.h"
+
+namespace facebook::velox::filesystems {
+
+namespace {
+
+// Reads a file of a remote file system through FileBlockCache.
+class CachingReadFile : public ReadFile {
+ public:
+  CachingReadFile(
+      std::unique_ptr<ReadFile> file,
+      std::string path,
+      FileBlockCache* cache)
+      : file_(std::move(file)), path_(std::move(path)), cache_(cache) {}
+
+  std::string_view pread(
+      uint64_t offset,
+      uint64_t length,
+      void* buf,
+      File::IoStats* stats = nullptr) const override {
+    bytesRead_ += length;
+    const auto blockSize = cache_->blockSize();
+    const auto fileSize = file_->size();
+    VELOX_CHECK_LE(offset + length, fileSize, "Read past end of {}", path_);
+    auto* buffer = static_cast<char*>(buf);
+    uint64_t numCachedBytes{0};
+    uint64_t numMissedBlocks{0};
+    for (auto position = offset; position < offset + length;) {
+      const auto blockIndex = position / blockSize;
+      const auto blockStart = blockIndex * blockSize;
+      const auto offsetInBlock = position - blockStart;
+      const auto readSize =
+          std::min(offset + length, blockStart + blockSize) - position;
+      if (cache_->read(path_, blockIndex, offsetInBlock, readSize, buffer)) {
+        numCachedBytes += readSize;
+      } else {
+        // Reads the whole block so that the other ranges of the block are
+        // read from the local disk.
+        const auto blockBytes = std::min(blockSize, fileSize - blockStart);
+        std::string block(blockBytes, 0);
+        file_->pread(blockStart, blockBytes, block.data(), stats);
+        cache_->write(path_, blockIndex, block);
+        memcpy(buffer, block.data() + offsetInBlock, readSize);
+        ++numMissedBlocks;
+      }
+      buffer += readSize;
+      position += readSize;
+    }
+    if (stats != nullptr) {
+      if (numCachedBytes > 0) {
+        stats->addCounter(
+            std::string(CachingFileSystem::kCachedBytes),
+            RuntimeCounter(numCachedBytes, RuntimeCounter::Unit::kBytes));
+      }
+      if (numMissedBlocks > 0) {
+        stats->addCounter(
+            std::string(CachingFileSystem::kMissedBlocks),
+            RuntimeCounter(numMissedBlocks));
+      }
+    }
+    return {static_cast<char*>(buf), length};
+  }
+
+  bool shouldCoalesce() const override {
+    return file_->shouldCoalesce();
+  }
+
+  uint64_t size() const override {
+    return file_->size();
+  }
+
+  uint64_t memoryUsage() const override {
+    return file_->memoryUsage();
+  }
+
+  std::string getName() const override {
+    return file_->getName();
+  }
+
+  uint64_t getNaturalReadSize() const override {
+    return file_->getNaturalReadSize();
+  }
+
+ private:
+  const std::unique_ptr<ReadFile> file_;
+  const std::string path_;
+  FileBlockCache* const cache_;
+};
+
+// Drops the cached blocks of the file when the file is closed since the
+// file is rewritten.
+class CachingWriteFile : public WriteFile {
+ public:
+  CachingWriteFile(
+      std::unique_ptr<WriteFile> file,
+      std::string path,
+      FileBlockCache* cache)
+      : file_(std::move(file)), path_(std::move(path)), cache_(cache) {}
+
+  void append(std::string_view data) override {
+    file_->append(data);
+  }
+
+  void append(std::unique_ptr<folly::IOBuf> data) override {
+    file_->append(std::move(data));
+  }
+
+  void flush() override {
+    file_->flush();
+  }
+
+  void setAttributes(
+      const std::unordered_map<std::string, std::string>& attributes)
+      override {
+    file_->setAttributes(attributes);
+  }
+
+  std::unordered_map<std::string, std::string> getAttributes() const override {
+    return file_->getAttributes();
+  }
+
+  void close() override {
+    file_->close();
+    cache_->removeFile(path_);
+  }
+
+  uint64_t size() const override {
+    return file_->size();
+  }
+
+  const std::string getName() const override {
+    return file_->getName();
+  }
+
+ private:
+  const std::unique_ptr<WriteFile> file_;
+  const std::string path_;
+  FileBlockCache* const cache_;
+};
+
+} // namespace
+
+size_t FileBlockCache::KeyHasher::operator()(const Key& key) const {
+  return folly::hash::hash_combine(
+      folly::hasher<std::string>()(key.path), key.blockIndex);
+}
+
+// static
+void FileBlockCache::init(const Options& options) {
+  std::unique_lock<folly::SharedMutex> l(instanceLock());
+  instanceRef().reset(new FileBlockCache(options));
+}
+
+// static
+FileBlockCache* FileBlockCache::instance() {
+  std::shared_lock<folly::SharedMutex> l(instanceLock());
+  return instanceRef().get();
+}
+
+// static
+void FileBlockCache::testingReset() {
+  std::unique_lock<folly::SharedMutex> l(instanceLock());
+  instanceRef().reset();
+}
+
+FileBlockCache::FileBlockCache(const Options& options)
+    : directory_(options.directory),
+      blockSize_(options.blockSize),
+      maxBytes_(options.maxBytes) {
+  VELOX_CHECK(!directory_.empty());
+  VELOX_CHECK_GT(blockSize_, 0);
+  VELOX_CHECK_GE(maxBytes_, blockSize_);
+  // The blocks of a previous process are not in the index.
+  std::filesystem::remove_all(directory_);
+  std::filesystem::create_directories(directory_);
+}
+
+bool FileBlockCache::read(
+    const std::string& path,
+    uint64_t blockIndex,
+    uint64_t offset,
+    uint64_t length,
+    char* buffer) {
+  std::string fileName;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    auto it = entries_.find(Key{path, blockIndex});
+    if (it == entries_.end() || offset + length > it->second->bytes) {
+      ++numMisses_;
+      return false;
+    }
+    lru_.splice(lru_.end(), lru_, it->second);
+    fileName = it->second->fileName;
+    ++numHits_;
+  }
+  // The file of the block may be removed by an eviction after the lookup.
+  // The read then falls back to the remote file.
+  try {
+    LocalReadFile file(fileName);
+    file.pread(offset, length, buffer);
+  } catch (const std::exception& e) {
+    VLOG(1) << "Failed to read cached block " << fileName << ": " << e.what();
+    return false;
+  }
+  return true;
+}
+
+void FileBlockCache::write(
+    const std::string& path,
+    uint64_t blockIndex,
+    std::string_view data) {
+  if (data.size() > maxBytes_) {
+    return;
+  }
+  Key key{path, blockIndex};
+  std::string fileName;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    if (entries_.contains(key)) {
+      return;
+    }
+    fileName = fmt::format("{}/{}", directory_, nextFileId_++);
+  }
+  try {
+    LocalWriteFile file(fileName);
+    file.append(data);
+    file.close();
+  } catch (const std::exception& e) {
+    LOG(WARNING) << "Failed to write cached block " << fileName << ": "
+                 << e.what();
+    std::lock_guard<std::mutex> l(mutex_);
+    ++numWriteErrors_;
+    return;
+  }
+
+  std::vector<std::string> filesToRemove;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    if (entries_.contains(key)) {
+      // Another reader cached the block first.
+      filesToRemove.push_back(std::move(fileName));
+    } else {
+      while (bytes_ + data.size() > maxBytes_) {
+        removeLocked(lru_.begin(), filesToRemove);
+        ++numEvictions_;
+      }
+      lru_.push_back(Entry{
+          key,
+          std::move(fileName),
+          data.size(),
+          static_cast<int64_t>(getCurrentTimeSec())});
+      entries_.emplace(std::move(key), std::prev(lru_.end()));
+      bytes_ += data.size();
+    }
+  }
+  removeFiles(filesToRemove);
+}
+
+void FileBlockCache::removeFile(const std::string& path) {
+  std::vector<std::string> filesToRemove;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    for (auto it = lru_.begin(); it != lru_.end();) {
+      auto next = std::next(it);
+      if (it->key.path == path) {
+        removeLocked(it, filesToRemove);
+      }
+      it = next;
+    }
+  }
+  removeFiles(filesToRemove);
+}
+
+void FileBlockCache::applyTTL(int64_t ttlSecs) {
+  const int64_t minCacheTimeSec =
+      static_cast<int64_t>(getCurrentTimeSec()) - ttlSecs;
+  std::vector<std::string> filesToRemove;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    for (auto it = lru_.begin(); it != lru_.end();) {
+      auto next = std::next(it);
+      if (it->cacheTimeSec < minCacheTimeSec) {
+        removeLocked(it, filesToRemove);
+      }
+      it = next;
+    }
+  }
+  LOG(INFO) << "Removed " << filesToRemove.size()
+            << " blocks out of TTL " << ttlSecs << " from file block cache.";
+  removeFiles(filesToRemove);
+}
+
+FileBlockCache::Stats FileBlockCache::stats() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  return Stats{
+      entries_.size(),
+      bytes_,
+      numHits_,
+      numMisses_,
+      numEvictions_,
+      numWriteErrors_};
+}
+
+void FileBlockCache::removeLocked(
+    EntryList::iterator it,
+    std::vector<std::string>& filesToRemove) {
+  VELOX_CHECK(it != lru_.end());
+  bytes_ -= it->bytes;
+  entries_.erase(it->key);
+  filesToRemove.push_back(std::move(it->fileName));
+  lru_.erase(it);
+}
+
+void FileBlockCache::removeFiles(const std::vector<std::string>& fileNames) {
+  for (const auto& fileName : fileNames) {
+    std::error_code ec;
+    std::filesystem::remove(fileName, ec);
+  }
+}
+
+CachingFileSystem::CachingFileSystem(
+    std::shared_ptr<FileSystem> fileSystem,
+    FileBlockCache* cache)
+    : FileSystem(nullptr), fileSystem_(std::move(fileSystem)), cache_(cache) {
+  VELOX_CHECK_NOT_NULL(fileSystem_);
+  VELOX_CHECK_NOT_NULL(cache_);
+}
+
+std::unique_ptr<ReadFile> CachingFileSystem::openFileForRead(
+    std::string_view path,
+    const FileOptions& options) {
+  return std::make_unique<CachingReadFile>(
+      fileSystem_->openFileForRead(path, options), std::string(path), cache_);
+}
+
+std::unique_ptr<WriteFile> CachingFileSystem::openFileForWrite(
+    std::string_view path,
+    const FileOptions& options) {
+  return std::make_unique<CachingWriteFile>(
+      fileSystem_->openFileForWrite(path, options), std::string(path), cache_);
+}
+
+void CachingFileSystem::remove(std::string_view path) {
+  fileSystem_->remove(path);
+  cache_->removeFile(std::string(path));
+}
+
+void CachingFileSystem::rename(
+    std::string_view oldPath,
+    std::string_view newPath,
+    bool overwrite) {
+  fileSystem_->rename(oldPath, newPath, overwrite);
+  cache_->removeFile(std::string(oldPath));
+  cache_->removeFile(std::string(newPath));
+}
+
+void CachingFileSystem::rmdir(std::string_view path) {
+  fileSystem_->rmdir(path);
+  // The blocks of the files of the directory age out by LRU and TTL.
+}
+
+void registerCachingFileSystem(
+    std::function<bool(std::string_view)> schemeMatcher) {
+  registerFileSystemWrapper(
+      std::move(schemeMatcher), [](std::shared_ptr<FileSystem> fileSystem) {
+        auto* cache = FileBlockCache::instance();
+        VELOX_CHECK_NOT_NULL(cache, "FileBlockCache is not initialized");
+        return std::make_shared<CachingFileSystem>(
+            std::move(fileSystem), cache);
+      });
+}
+
+} // namespace facebook::velox::filesystems
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <folly/SharedMutex.h>
+#include <folly/container/F14Map.h>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "velox/common/file/FileSystems.h"
+
+namespace facebook::velox::filesystems {
+
+/// A process-wide cache of the blocks of remote files on a local disk, e.g.
+/// an SSD. Any ReadFile of a file system wrapped by CachingFileSystem reads
+/// through the cache, so spill restore, text files, Iceberg delete files and
+/// footers that do not go through AsyncDataCache are not read from the
+/// object store each time. The blocks are 'blockSize' aligned ranges of a
+/// file and are evicted in LRU order to stay within 'maxBytes'.
+///
+/// The files of the cache are created in 'directory', which is removed at
+/// start. The index of the cached blocks is in memory only. The remote files
+/// are expected not to change in place, as in object stores. The blocks of a
+/// file, which is rewritten by other processes, are dropped after the TTL of
+/// CacheTTLController.
+class FileBlockCache {
+ public:
+  struct Options {
+    std::string directory;
+    uint64_t blockSize{8 << 20};
+    uint64_t maxBytes{64UL << 30};
+  };
+
+  struct Stats {
+    uint64_t numBlocks{0};
+    uint64_t bytes{0};
+    uint64_t numHits{0};
+    uint64_t numMisses{0};
+    uint64_t numEvictions{0};
+    uint64_t numWriteErrors{0};
+  };
+
+  /// Creates the process-wide cache.
+  static void init(const Options& options);
+
+  /// Returns the process-wide cache or nullptr if it has not been created.
+  static FileBlockCache* instance();
+
+  static void testingReset();
+
+  /// Copies 'length' bytes at 'offset' of block 'blockIndex' of the file at
+  /// 'path' to 'buffer'. Returns false if the block is not cached.
+  bool read(
+      const std::string& path,
+      uint64_t blockIndex,
+      uint64_t offset,
+      uint64_t length,
+      char* buffer);
+
+  /// Adds the block 'blockIndex' of the file at 'path'. Evicts the least
+  /// recently used blocks to make space. A failure to write the block to the
+  /// local disk is counted and otherwise ignored.
+  void
+  write(const std::string& path, uint64_t blockIndex, std::string_view data);
+
+  /// Removes the blocks of the file at 'path', e.g. after the file is
+  /// removed or overwritten.
+  void removeFile(const std::string& path);
+
+  /// Removes the blocks that have been cached for more than 'ttlSecs'.
+  void applyTTL(int64_t ttlSecs);
+
+  Stats stats() const;
+
+  uint64_t blockSize() const {
+    return blockSize_;
+  }
+
+  uint64_t maxBytes() const {
+    return maxBytes_;
+  }
+
+ private:
+  struct Key {
+    std::string path;
+    uint64_t blockIndex;
+
+    bool operator==(const Key& other) const {
+      return blockIndex == other.blockIndex && path == other.path;
+    }
+  };
+
+  struct KeyHasher {
+    size_t operator()(const Key& key) const;
+  };
+
+  struct Entry {
+    Key key;
+    // Name of the file of the block in 'directory_'.
+    std::string fileName;
+    uint64_t bytes;
+    int64_t cacheTimeSec;
+  };
+
+  using EntryList = std::list<Entry>;
+
+  static folly::SharedMutex& instanceLock() {
+    static folly::SharedMutex mu;
+    return mu;
+  }
+
+  static std::unique_ptr<FileBlockCache>& instanceRef() {
+    static std::unique_ptr<FileBlockCache> instance;
+    return instance;
+  }
+
+  explicit FileBlockCache(const Options& options);
+
+  // Removes 'it' from the index. The file of the block is added to
+  // 'filesToRemove' to be removed outside of 'mutex_'.
+  void removeLocked(
+      EntryList::iterator it,
+      std::vector<std::string>& filesToRemove);
+
+  void removeFiles(const std::vector<std::string>& fileNames);
+
+  const std::string directory_;
+  const uint64_t blockSize_;
+  const uint64_t maxBytes_;
+
+  mutable std::mutex mutex_;
+  // The entries from the least to the most recently used.
+  EntryList lru_;
+  folly::F14FastMap<Key, EntryList::iterator, KeyHasher> entries_;
+  uint64_t nextFileId_{0};
+  uint64_t bytes_{0};
+  uint64_t numHits_{0};
+  uint64_t numMisses_{0};
+  uint64_t numEvictions_{0};
+  uint64_t numWriteErrors_{0};
+};
+
+/// A FileSystem that delegates to 'fileSystem' and reads the files through
+/// FileBlockCache. The read files read the whole block that contains a missed
+/// range from 'fileSystem' and serve the following reads of the block from
+/// the local disk. The writes, renames and removals go to 'fileSystem' and
+/// drop the cached blocks of the files they change.
+class CachingFileSystem : public FileSystem {
+ public:
+  /// Name of the IoStats counter of the bytes read from the local disk.
+  static constexpr std::string_view kCachedBytes{"fileBlockCacheBytes"};
+  /// Name of the IoStats counter of the blocks read from 'fileSystem'.
+  static constexpr std::string_view kMissedBlocks{"fileBlockCacheMisses"};
+
+  CachingFileSystem(
+      std::shared_ptr<FileSystem> fileSystem,
+      FileBlockCache* cache);
+
+  std::string name() const override {
+    return "Caching " + fileSystem_->name();
+  }
+
+  std::string_view extractPath(std::string_view path) const override {
+    return fileSystem_->extractPath(path);
+  }
+
+  std::unique_ptr<ReadFile> openFileForRead(
+      std::string_view path,
+      const FileOptions& options = {}) override;
+
+  std::unique_ptr<WriteFile> openFileForWrite(
+      std::string_view path,
+      const FileOptions& options = {}) override;
+
+  void remove(std::string_view path) override;
+
+  void rename(
+      std::string_view oldPath,
+      std::string_view newPath,
+      bool overwrite = false) override;
+
+  bool exists(std::string_view path) override {
+    return fileSystem_->exists(path);
+  }
+
+  bool isDirectory(std::string_view path) const override {
+    return fileSystem_->isDirectory(path);
+  }
+
+  std::vector<std::string> list(std::string_view path) override {
+    return fileSystem_->list(path);
+  }
+
+  void mkdir(std::string_view path, const DirectoryOptions& options = {})
+      override {
+    fileSystem_->mkdir(path, options);
+  }
+
+  void rmdir(std::string_view path) override;
+
+  void setDirectoryProperty(
+      std::string_view path,
+      const DirectoryOptions& options = {}) override {
+    fileSystem_->setDirectoryProperty(path, options);
+  }
+
+  std::optional<std::string> getDirectoryProperty(
+      std::string_view path,
+      std::string_view propertyKey) override {
+    return fileSystem_->getDirectoryProperty(path, propertyKey);
+  }
+
+ private:
+  const std::shared_ptr<FileSystem> fileSystem_;
+  FileBlockCache* const cache_;
+};
+
+/// Reads the files of the registered file systems that 'schemeMatcher'
+/// accepts through the process-wide FileBlockCache, e.g. the paths of an
+/// object store. FileBlockCache::init() must be called first.
+void registerCachingFileSystem(
+    std::function<bool(std::string_view)> schemeMatcher);
+
+} // namespace facebook::velox::filesystems
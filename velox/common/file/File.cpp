@@ -143,8 +143,9 @@ uint64_t InMemoryWriteFile::size() const {
 LocalReadFile::LocalReadFile(
     std::string_view path,
     folly::Executor* executor,
-    bool bufferIo)
-    : executor_(executor), path_(path) {
+    bool bufferIo,
+    IoUring* ioUring)
+    : executor_(executor), ioUring_(ioUring), path_(path) {
   int32_t flags = O_RDONLY;
 #ifdef linux
   if (!bufferIo) {
@@ -188,6 +189,10 @@ LocalReadFile::~LocalReadFile() {
 void LocalReadFile::preadInternal(uint64_t offset, uint64_t length, char* pos)
     const {
   bytesRead_ += length;
+  if (ioUring_ != nullptr) {
+    ioUring_->readv(fd_, offset, {folly::Range<char*>(pos, length)}).get();
+    return;
+  }
   auto bytesRead = ::pread(fd_, pos, length, offset);
   VELOX_CHECK_EQ(
       bytesRead,
@@ -211,6 +216,9 @@ uint64_t LocalReadFile::preadv(
     uint64_t offset,
     const std::vector<folly::Range<char*>>& buffers,
     filesystems::File::IoStats* stats) const {
+  if (ioUring_ != nullptr) {
+    return ioUring_->readv(fd_, offset, buffers).get();
+  }
   // Dropped bytes sized so that a typical dropped range of 50K is not
   // too many iovecs.
   static thread_local std::vector<char> droppedBytes(16 * 1024);
@@ -268,6 +276,9 @@ folly::SemiFuture<uint64_t> LocalReadFile::preadvAsync(
     uint64_t offset,
     const std::vector<folly::Range<char*>>& buffers,
     filesystems::File::IoStats* stats) const {
+  if (ioUring_ != nullptr) {
+    return ioUring_->readv(fd_, offset, buffers);
+  }
   if (!executor_) {
     return ReadFile::preadvAsync(offset, buffers, stats);
   }
@@ -304,8 +315,9 @@ LocalWriteFile::LocalWriteFile(
     std::string_view path,
     bool shouldCreateParentDirectories,
     bool shouldThrowOnFileAlreadyExists,
-    bool bufferIo)
-    : path_(path) {
+    bool bufferIo,
+    IoUring* ioUring)
+    : ioUring_(ioUring), path_(path) {
   const auto dir = fs::path(path_).parent_path();
   if (shouldCreateParentDirectories && !fs::exists(dir)) {
     VELOX_CHECK(
@@ -365,6 +377,11 @@ LocalWriteFile::~LocalWriteFile() {
 
 void LocalWriteFile::append(std::string_view data) {
   checkNotClosed(closed_);
+  if (ioUring_ != nullptr) {
+    writeIoUring(
+        {{const_cast<char*>(data.data()), data.size()}}, size_, data.size());
+    return;
+  }
   const uint64_t bytesWritten = ::write(fd_, data.data(), data.size());
   VELOX_CHECK_EQ(
       bytesWritten,
@@ -378,6 +395,14 @@ void LocalWriteFile::append(std::string_view data) {
 
 void LocalWriteFile::append(std::unique_ptr<folly::IOBuf> data) {
   checkNotClosed(closed_);
+  if (ioUring_ != nullptr) {
+    std::vector<iovec> iovecs;
+    for (auto range : *data) {
+      iovecs.push_back({const_cast<uint8_t*>(range.data()), range.size()});
+    }
+    writeIoUring(iovecs, size_, data->computeChainDataLength());
+    return;
+  }
   uint64_t totalBytesWritten{0};
   for (auto rangeIter = data->begin(); rangeIter != data->end(); ++rangeIter) {
     const auto bytesToWrite = rangeIter->size();
@@ -408,6 +433,10 @@ void LocalWriteFile::write(
     int64_t length) {
   checkNotClosed(closed_);
   VELOX_CHECK_GE(offset, 0, "Offset cannot be negative.");
+  if (ioUring_ != nullptr) {
+    writeIoUring(iovecs, offset, length);
+    return;
+  }
   const auto bytesWritten = ::pwritev(
       fd_, iovecs.data(), static_cast<ssize_t>(iovecs.size()), offset);
   VELOX_CHECK_EQ(
@@ -419,6 +448,21 @@ void LocalWriteFile::write(
   size_ = std::max<uint64_t>(size_, offset + bytesWritten);
 }
 
+void LocalWriteFile::writeIoUring(
+    const std::vector<iovec>& iovecs,
+    int64_t offset,
+    int64_t length) {
+  // The writes are positional so appends do not move the file offset.
+  const auto bytesWritten = ioUring_->writev(fd_, offset, iovecs).get();
+  VELOX_CHECK_EQ(
+      bytesWritten,
+      length,
+      "Failure in LocalWriteFile::writeIoUring, {} vs {}",
+      bytesWritten,
+      length);
+  size_ = std::max<uint64_t>(size_, offset + bytesWritten);
+}
+
 void LocalWriteFile::truncate(int64_t newSize) {
   checkNotClosed(closed_);
   VELOX_CHECK_GE(newSize, 0, "New size cannot be negative.");
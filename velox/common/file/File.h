@@ -40,6 +40,7 @@
 
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/file/FileSystems.h"
+#include "velox/common/file/IoUring.h"
 #include "velox/common/file/Region.h"
 #include "velox/common/io/IoStatistics.h"
 
@@ -296,10 +297,13 @@ class InMemoryWriteFile final : public WriteFile {
 /// files match against any filepath starting with '/'.
 class LocalReadFile final : public ReadFile {
  public:
+  /// If 'ioUring' is set, reads are submitted to it instead of being issued
+  /// by the calling thread or 'executor'.
   LocalReadFile(
       std::string_view path,
       folly::Executor* executor = nullptr,
-      bool bufferIo = true);
+      bool bufferIo = true,
+      IoUring* ioUring = nullptr);
 
   /// TODO: deprecate this after creating local file all through velox fs
   /// interface.
@@ -326,7 +330,7 @@ class LocalReadFile final : public ReadFile {
       filesystems::File::IoStats* stats = nullptr) const override;
 
   bool hasPreadvAsync() const override {
-    return executor_ != nullptr;
+    return executor_ != nullptr || ioUring_ != nullptr;
   }
 
   uint64_t memoryUsage() const final;
@@ -350,6 +354,7 @@ class LocalReadFile final : public ReadFile {
   void preadInternal(uint64_t offset, uint64_t length, char* pos) const;
 
   folly::Executor* const executor_;
+  IoUring* const ioUring_{nullptr};
   std::string path_;
   int32_t fd_;
   long size_;
@@ -369,12 +374,14 @@ class LocalWriteFile final : public WriteFile {
   };
 
   // An error is thrown is a file already exists at |path|,
-  // unless flag shouldThrowOnFileAlreadyExists is false
+  // unless flag shouldThrowOnFileAlreadyExists is false. If 'ioUring' is set,
+  // writes are submitted to it.
   explicit LocalWriteFile(
       std::string_view path,
       bool shouldCreateParentDirectories = false,
       bool shouldThrowOnFileAlreadyExists = true,
-      bool bufferIo = true);
+      bool bufferIo = true,
+      IoUring* ioUring = nullptr);
 
   ~LocalWriteFile();
 
@@ -405,6 +412,13 @@ class LocalWriteFile final : public WriteFile {
   }
 
  private:
+  // Writes 'iovecs' of 'length' bytes at 'offset' with 'ioUring_'.
+  void writeIoUring(
+      const std::vector<iovec>& iovecs,
+      int64_t offset,
+      int64_t length);
+
+  IoUring* const ioUring_{nullptr};
   // File descriptor.
   int32_t fd_{-1};
   std::string path_;
@@ -16,37 +16,48 @@
 
 #include "velox/common/file/FileInputStream.h"
 
+#include <folly/futures/Future.h>
+
 namespace facebook::velox::common {
 
 FileInputStream::FileInputStream(
     std::unique_ptr<ReadFile>&& file,
     uint64_t bufferSize,
-    memory::MemoryPool* pool)
+    memory::MemoryPool* pool,
+    uint32_t numReadAheadBuffers,
+    folly::Executor* executor)
     : file_(std::move(file)),
       fileSize_(file_->size()),
       bufferSize_(std::min(fileSize_, bufferSize)),
       pool_(pool),
-      readAheadEnabled_((bufferSize_ < fileSize_) && file_->hasPreadvAsync()) {
+      executor_(executor),
+      readAheadEnabled_(
+          (bufferSize_ < fileSize_) && (numReadAheadBuffers > 0) &&
+          (file_->hasPreadvAsync() || executor_ != nullptr)),
+      numReadAheadBuffers_(
+          readAheadEnabled_
+              ? std::min<uint64_t>(
+                    numReadAheadBuffers,
+                    bits::divRoundUp(fileSize_, bufferSize_) - 1)
+              : 0) {
   VELOX_CHECK_NOT_NULL(pool_);
   VELOX_CHECK_GT(fileSize_, 0, "Empty FileInputStream");
 
-  buffers_.push_back(AlignedBuffer::allocate<char>(bufferSize_, pool_));
-  if (readAheadEnabled_) {
+  for (auto i = 0; i <= numReadAheadBuffers_; ++i) {
     buffers_.push_back(AlignedBuffer::allocate<char>(bufferSize_, pool_));
   }
   readNextRange();
 }
 
 FileInputStream::~FileInputStream() {
-  if (!readAheadWait_.valid()) {
-    return;
-  }
-  try {
-    readAheadWait_.wait();
-  } catch (const std::exception& ex) {
-    // ignore any prefetch error when query has failed.
-    LOG(WARNING) << "FileInputStream read-ahead failed on destruction "
-                 << ex.what();
+  for (auto& readAheadWait : readAheadWaits_) {
+    try {
+      readAheadWait.wait();
+    } catch (const std::exception& ex) {
+      // ignore any prefetch error when query has failed.
+      LOG(WARNING) << "FileInputStream read-ahead failed on destruction "
+                   << ex.what();
+    }
   }
 }
 
@@ -56,23 +67,26 @@ void FileInputStream::readNextRange() {
 
   int32_t readBytes{0};
   uint64_t readTimeNs{0};
+  uint64_t readAheadWaitTimeNs{0};
   {
     NanosecondTimer timer{&readTimeNs};
-    if (readAheadWait_.valid()) {
-      readBytes = std::move(readAheadWait_)
+    if (!readAheadWaits_.empty()) {
+      NanosecondTimer waitTimer{&readAheadWaitTimeNs};
+      readBytes = std::move(readAheadWaits_.front())
                       .via(&folly::QueuedImmediateExecutor::instance())
                       .wait()
                       .value();
-      VELOX_CHECK(!readAheadWait_.valid());
+      readAheadWaits_.pop_front();
       VELOX_CHECK_LT(
           0, readBytes, "Read past end of FileInputStream {}", fileSize_);
       advanceBuffer();
     } else {
-      readBytes = readSize();
+      readBytes = readSize(fileOffset_);
       VELOX_CHECK_LT(
           0, readBytes, "Read past end of FileInputStream {}", fileSize_);
       NanosecondTimer timer_2{&readTimeNs};
       file_->pread(fileOffset_, readBytes, buffer()->asMutable<char>());
+      readAheadOffset_ += readBytes;
     }
   }
 
@@ -80,7 +94,7 @@ void FileInputStream::readNextRange() {
   current_ = &range_;
   fileOffset_ += readBytes;
 
-  updateStats(readBytes, readTimeNs);
+  updateStats(readBytes, readTimeNs, readAheadWaitTimeNs);
 
   maybeIssueReadahead();
 }
@@ -201,28 +215,48 @@ std::string_view FileInputStream::nextView(int64_t size) {
       reinterpret_cast<char*>(current_->buffer) + position, viewSize);
 }
 
-uint64_t FileInputStream::readSize() const {
-  return std::min(fileSize_ - fileOffset_, bufferSize_);
+uint64_t FileInputStream::readSize(uint64_t offset) const {
+  return std::min(fileSize_ - offset, bufferSize_);
 }
 
 void FileInputStream::maybeIssueReadahead() {
-  VELOX_CHECK(!readAheadWait_.valid());
   if (!readAheadEnabled_) {
     return;
   }
-  const auto size = readSize();
-  if (size == 0) {
-    return;
+  while (readAheadWaits_.size() < numReadAheadBuffers_) {
+    const auto size = readSize(readAheadOffset_);
+    if (size == 0) {
+      return;
+    }
+    char* data =
+        buffers_[(bufferIndex_ + readAheadWaits_.size() + 1) % buffers_.size()]
+            ->asMutable<char>();
+    if (file_->hasPreadvAsync()) {
+      std::vector<folly::Range<char*>> ranges;
+      ranges.emplace_back(data, size);
+      readAheadWaits_.push_back(file_->preadvAsync(readAheadOffset_, ranges));
+    } else {
+      readAheadWaits_.push_back(
+          folly::via(
+              executor_,
+              [file = file_.get(), offset = readAheadOffset_, size, data]() {
+                file->pread(offset, size, data);
+                return size;
+              })
+              .semi());
+    }
+    VELOX_CHECK(readAheadWaits_.back().valid());
+    readAheadOffset_ += size;
   }
-  std::vector<folly::Range<char*>> ranges;
-  ranges.emplace_back(nextBuffer()->asMutable<char>(), size);
-  readAheadWait_ = file_->preadvAsync(fileOffset_, ranges);
-  VELOX_CHECK(readAheadWait_.valid());
 }
 
-void FileInputStream::updateStats(uint64_t readBytes, uint64_t readTimeNs) {
+void FileInputStream::updateStats(
+    uint64_t readBytes,
+    uint64_t readTimeNs,
+    uint64_t readAheadWaitTimeNs) {
   stats_.readBytes += readBytes;
   stats_.readTimeNs += readTimeNs;
+  stats_.readAheadWaitTimeNs += readAheadWaitTimeNs;
   ++stats_.numReads;
 }
 
@@ -241,15 +275,20 @@ FileInputStream::Stats FileInputStream::stats() const {
 
 bool FileInputStream::Stats::operator==(
     const FileInputStream::Stats& other) const {
-  return std::tie(numReads, readBytes, readTimeNs) ==
-      std::tie(other.numReads, other.readBytes, other.readTimeNs);
+  return std::tie(numReads, readBytes, readTimeNs, readAheadWaitTimeNs) ==
+      std::tie(
+             other.numReads,
+             other.readBytes,
+             other.readTimeNs,
+             other.readAheadWaitTimeNs);
 }
 
 std::string FileInputStream::Stats::toString() const {
   return fmt::format(
-      "numReads: {}, readBytes: {}, readTimeNs: {}",
+      "numReads: {}, readBytes: {}, readTimeNs: {}, readAheadWaitTimeNs: {}",
       numReads,
       succinctBytes(readBytes),
-      succinctMicros(readTimeNs));
+      succinctMicros(readTimeNs),
+      succinctMicros(readAheadWaitTimeNs));
 }
 } // namespace facebook::velox::common
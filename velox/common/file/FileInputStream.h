@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstdint>
+#include <deque>
 
 #include "velox/buffer/Buffer.h"
 #include "velox/common/file/File.h"
@@ -27,10 +28,17 @@ namespace facebook::velox::common {
 /// Readonly byte input stream backed by file.
 class FileInputStream : public ByteInputStream {
  public:
+  /// Reads 'file' 'bufferSize' bytes at a time. Keeps up to
+  /// 'numReadAheadBuffers' buffers ahead of the current one in flight if
+  /// 'file' supports async read or 'executor' is set, in which case the
+  /// reads are done on 'executor'. Each read-ahead buffer takes another
+  /// 'bufferSize' bytes of memory.
   FileInputStream(
       std::unique_ptr<ReadFile>&& file,
       uint64_t bufferSize,
-      memory::MemoryPool* pool);
+      memory::MemoryPool* pool,
+      uint32_t numReadAheadBuffers = 1,
+      folly::Executor* executor = nullptr);
 
   ~FileInputStream() override;
 
@@ -64,6 +72,8 @@ class FileInputStream : public ByteInputStream {
     uint32_t numReads{0};
     uint64_t readBytes{0};
     uint64_t readTimeNs{0};
+    /// The part of 'readTimeNs' spent waiting for read-ahead to complete.
+    uint64_t readAheadWaitTimeNs{0};
 
     bool operator==(const Stats& other) const;
 
@@ -77,13 +87,13 @@ class FileInputStream : public ByteInputStream {
   // Invoked to read the next byte range from the file in a buffer.
   void readNextRange();
 
-  // Issues readahead if underlying file system supports async mode read.
-  //
-  // TODO: we might consider to use AsyncSource to support read-ahead on
-  // filesystem which doesn't support async mode read.
+  // Issues read-ahead of the following buffers until
+  // 'numReadAheadBuffers_' are in flight, either with async mode read if the
+  // underlying file system supports it or on 'executor_'.
   void maybeIssueReadahead();
 
-  inline uint64_t readSize() const;
+  // Returns the size of the read at 'offset'.
+  inline uint64_t readSize(uint64_t offset) const;
 
   inline uint32_t bufferIndex() const {
     return bufferIndex_;
@@ -102,26 +112,33 @@ class FileInputStream : public ByteInputStream {
     return buffers_[bufferIndex()].get();
   }
 
-  inline Buffer* nextBuffer() const {
-    return buffers_[nextBufferIndex()].get();
-  }
-
-  void updateStats(uint64_t readBytes, uint64_t readTimeNs);
+  void updateStats(
+      uint64_t readBytes,
+      uint64_t readTimeNs,
+      uint64_t readAheadWaitTimeNs);
 
   const std::unique_ptr<ReadFile> file_;
   const uint64_t fileSize_;
   const uint64_t bufferSize_;
   memory::MemoryPool* const pool_;
+  folly::Executor* const executor_;
   const bool readAheadEnabled_;
+  const uint32_t numReadAheadBuffers_;
 
   // Offset of the next byte to read from file.
   uint64_t fileOffset_ = 0;
 
+  // Offset of the next byte to read ahead from file. This is 'fileOffset_'
+  // plus the bytes of the reads in 'readAheadWaits_'.
+  uint64_t readAheadOffset_ = 0;
+
+  // The buffer at 'bufferIndex_' has the current range and the following
+  // buffers the reads in 'readAheadWaits_'.
   std::vector<BufferPtr> buffers_;
   uint32_t bufferIndex_{0};
-  // Sets to read-ahead future if valid.
-  folly::SemiFuture<uint64_t> readAheadWait_{
-      folly::SemiFuture<uint64_t>::makeEmpty()};
+  // The futures of the read-ahead reads in file order. Each returns the
+  // number of bytes read.
+  std::deque<folly::SemiFuture<uint64_t>> readAheadWaits_;
 
   ByteRange range_;
 
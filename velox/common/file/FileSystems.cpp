@@ -41,6 +41,15 @@ RegisteredFileSystems& registeredFileSystems() {
   return *fss;
 }
 
+using RegisteredWrappers = std::vector<std::pair<
+    std::function<bool(std::string_view)>,
+    std::function<std::shared_ptr<FileSystem>(std::shared_ptr<FileSystem>)>>>;
+
+RegisteredWrappers& registeredWrappers() {
+  static RegisteredWrappers* wrappers = new RegisteredWrappers();
+  return *wrappers;
+}
+
 } // namespace
 
 void registerFileSystem(
@@ -51,13 +60,27 @@ void registerFileSystem(
   registeredFileSystems().emplace_back(schemeMatcher, fileSystemGenerator);
 }
 
+void registerFileSystemWrapper(
+    std::function<bool(std::string_view)> schemeMatcher,
+    std::function<std::shared_ptr<FileSystem>(std::shared_ptr<FileSystem>)>
+        wrapper) {
+  registeredWrappers().emplace_back(
+      std::move(schemeMatcher), std::move(wrapper));
+}
+
 std::shared_ptr<FileSystem> getFileSystem(
     std::string_view filePath,
     std::shared_ptr<const config::ConfigBase> properties) {
   const auto& filesystems = registeredFileSystems();
   for (const auto& p : filesystems) {
     if (p.first(filePath)) {
-      return p.second(properties, filePath);
+      auto fileSystem = p.second(properties, filePath);
+      for (const auto& [matcher, wrapper] : registeredWrappers()) {
+        if (matcher(filePath)) {
+          fileSystem = wrapper(std::move(fileSystem));
+        }
+      }
+      return fileSystem;
     }
   }
   VELOX_FAIL("No registered file system matched with file path '{}'", filePath);
@@ -117,7 +140,10 @@ class LocalFileSystem : public FileSystem {
       std::string_view path,
       const FileOptions& options) override {
     return std::make_unique<LocalReadFile>(
-        extractPath(path), executor_.get(), options.bufferIo);
+        extractPath(path),
+        executor_.get(),
+        options.bufferIo,
+        options.useIoUring ? IoUring::instance() : nullptr);
   }
 
   std::unique_ptr<WriteFile> openFileForWrite(
@@ -127,7 +153,8 @@ class LocalFileSystem : public FileSystem {
         extractPath(path),
         options.shouldCreateParentDirectories,
         options.shouldThrowOnFileAlreadyExists,
-        options.bufferIo);
+        options.bufferIo,
+        options.useIoUring ? IoUring::instance() : nullptr);
   }
 
   void remove(std::string_view path) override {
@@ -68,6 +68,11 @@ struct FileOptions {
   /// IO mode if set.
   bool bufferIo{true};
 
+  /// Whether to submit the reads and writes of a local file to io_uring. Only
+  /// applies if Velox is built with VELOX_ENABLE_IO_URING and the kernel
+  /// supports io_uring. Ignored by other file systems.
+  bool useIoUring{false};
+
   /// Property bag to set onto files/directories. Think something similar to
   /// ioctl(2). For other remote filesystems, this can be PutObjectTagging in
   /// S3.
@@ -252,6 +257,15 @@ void registerFileSystem(
         std::shared_ptr<const config::ConfigBase>,
         std::string_view)> fileSystemGenerator);
 
+/// Wraps the file systems of the paths that 'schemeMatcher' accepts, e.g. to
+/// cache their reads. 'wrapper' is called with the file system that
+/// getFileSystem() would return otherwise and returns the file system to use
+/// instead. The wrappers apply in the order of registration.
+void registerFileSystemWrapper(
+    std::function<bool(std::string_view)> schemeMatcher,
+    std::function<std::shared_ptr<FileSystem>(std::shared_ptr<FileSystem>)>
+        wrapper);
+
 /// Register the local filesystem.
 void registerLocalFileSystem(
     const FileSystemOptions& options = FileSystemOptions());
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/file/HedgedReader.h"
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/futures/Future.h>
+
+#include "velox/common/base/BitUtil.h"
+#include "velox/common/time/Timer.h"
+
+namespace facebook::velox::filesystems {
+
+namespace {
+
+folly::Executor* defaultExecutor() {
+  // The reads block the threads for their latency, so there are more threads
+  // than cores.
+  static folly::CPUThreadPoolExecutor* executor =
+      new folly::CPUThreadPoolExecutor(
+          std::max<int32_t>(16, 2 * std::thread::hardware_concurrency()),
+          std::make_shared<folly::NamedThreadFactory>("HedgedRead"));
+  return executor;
+}
+
+} // namespace
+
+// static
+std::shared_ptr<HedgedReader> HedgedReader::create(
+    std::chrono::milliseconds minDelay,
+    folly::Executor* executor) {
+  return std::shared_ptr<HedgedReader>(new HedgedReader(
+      minDelay, executor == nullptr ? defaultExecutor() : executor));
+}
+
+HedgedReader::HedgedReader(
+    std::chrono::milliseconds minDelay,
+    folly::Executor* executor)
+    : minDelay_(minDelay), executor_(executor) {}
+
+void HedgedReader::read(
+    uint64_t length,
+    char* buffer,
+    std::function<void(char*)> read,
+    File::IoStats* stats) {
+  // Each attempt reads into its own buffer since the attempt that completes
+  // last may still write after this returns.
+  auto attempt = [self = shared_from_this(), length, read]() {
+    std::string data(length, 0);
+    uint64_t latencyUs{0};
+    {
+      MicrosecondTimer timer(&latencyUs);
+      read(data.data());
+    }
+    self->recordLatency(latencyUs);
+    return data;
+  };
+
+  std::vector<folly::Future<std::string>> attempts;
+  attempts.push_back(folly::via(executor_, attempt));
+  attempts.back().wait(delay());
+  if (!attempts.back().isReady()) {
+    ++numHedgedReads_;
+    if (stats != nullptr) {
+      stats->addCounter(std::string(kHedgedReads), RuntimeCounter(1));
+    }
+    attempts.push_back(folly::via(executor_, attempt));
+  }
+  auto [index, data] =
+      folly::collectAnyWithoutException(std::move(attempts)).get();
+  if (index > 0) {
+    ++numHedgedReadWins_;
+    if (stats != nullptr) {
+      stats->addCounter(std::string(kHedgedReadWins), RuntimeCounter(1));
+    }
+  }
+  memcpy(buffer, data.data(), length);
+}
+
+std::chrono::microseconds HedgedReader::delay() const {
+  const auto minDelay =
+      std::chrono::duration_cast<std::chrono::microseconds>(minDelay_);
+  const uint64_t numReads = numReads_;
+  if (numReads < kMinReadsForLatency) {
+    return minDelay;
+  }
+  // The upper bound of the bucket of the p99 latency.
+  const uint64_t p99Count = numReads - numReads / 100;
+  uint64_t count = 0;
+  for (auto i = 0; i < kNumLatencyBuckets; ++i) {
+    count += latencyCounts_[i];
+    if (count >= p99Count) {
+      return std::max(minDelay, std::chrono::microseconds(2ULL << i));
+    }
+  }
+  return minDelay;
+}
+
+void HedgedReader::recordLatency(uint64_t latencyUs) {
+  const auto bucket = std::min<int32_t>(
+      kNumLatencyBuckets - 1,
+      latencyUs == 0 ? 0 : 63 - bits::countLeadingZeros(latencyUs));
+  ++latencyCounts_[bucket];
+  ++numReads_;
+}
+
+} // namespace facebook::velox::filesystems
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <folly/Executor.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+
+#include "velox/common/file/FileSystems.h"
+
+namespace facebook::velox::filesystems {
+
+/// Sends a second read of a range if the first read has not completed after a
+/// delay and uses the result of the read that completes first. This cuts the
+/// tail latency of slow reads, e.g. from a slow datanode or an object store
+/// hiccup, at the cost of extra requests.
+///
+/// The delay is the p99 latency of the completed reads and at least
+/// 'minDelay'. The read files of a file system share one HedgedReader so that
+/// the delay follows the latency of the storage.
+///
+/// The reads of the storage clients are synchronous and cannot be cancelled.
+/// The result of the read that completes last is dropped.
+class HedgedReader : public std::enable_shared_from_this<HedgedReader> {
+ public:
+  /// Name of the IoStats counter of the reads that were sent a second time.
+  static constexpr std::string_view kHedgedReads{"hedgedReads"};
+  /// Name of the IoStats counter of the second reads that completed first.
+  static constexpr std::string_view kHedgedReadWins{"hedgedReadWins"};
+
+  /// Number of completed reads before the delay follows their p99 latency.
+  static constexpr uint64_t kMinReadsForLatency{100};
+
+  /// Runs the reads on 'executor' or on a process wide executor if
+  /// 'executor' is nullptr.
+  static std::shared_ptr<HedgedReader> create(
+      std::chrono::milliseconds minDelay,
+      folly::Executor* executor = nullptr);
+
+  /// Reads 'length' bytes into 'buffer'. 'read' reads the 'length' bytes into
+  /// the buffer it is called with. 'read' is called concurrently if the read is
+  /// hedged and may run after this returns, so it must hold shared ownership
+  /// of the state it reads with. 'stats' gets the hedge counters.
+  void read(
+      uint64_t length,
+      char* buffer,
+      std::function<void(char*)> read,
+      File::IoStats* stats = nullptr);
+
+  /// Returns the current delay after which a read is sent again.
+  std::chrono::microseconds delay() const;
+
+  uint64_t numHedgedReads() const {
+    return numHedgedReads_;
+  }
+
+  uint64_t numHedgedReadWins() const {
+    return numHedgedReadWins_;
+  }
+
+ private:
+  HedgedReader(std::chrono::milliseconds minDelay, folly::Executor* executor);
+
+  void recordLatency(uint64_t latencyUs);
+
+  // Number of buckets of the read latencies. Bucket i counts the latencies in
+  // [2^i, 2^(i + 1)) microseconds.
+  static constexpr int32_t kNumLatencyBuckets{32};
+
+  const std::chrono::milliseconds minDelay_;
+  folly::Executor* const executor_;
+
+  std::array<std::atomic<uint64_t>, kNumLatencyBuckets> latencyCounts_{};
+  std::atomic<uint64_t> numReads_{0};
+  std::atomic<uint64_t> numHedgedReads_{0};
+  std::atomic<uint64_t> numHedgedReadWins_{0};
+};
+
+} // namespace facebook::velox::filesystems
@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/file/IoUring.h"
+
+#include <fmt/format.h>
+#include <folly/String.h>
+#include <glog/logging.h>
+#include <climits>
+
+#ifdef VELOX_ENABLE_IO_URING
+#include <liburing.h>
+#endif
+
+#include "velox/common/base/Exceptions.h"
+
+namespace facebook::velox {
+
+#ifdef VELOX_ENABLE_IO_URING
+
+// static
+IoUring* IoUring::instance() {
+  // Leaked so that files closed during static destruction can still use it.
+  static IoUring* ring = []() -> IoUring* {
+    try {
+      return new IoUring();
+    } catch (const std::exception& ex) {
+      LOG(WARNING) << "io_uring is not available: " << ex.what();
+      return nullptr;
+    }
+  }();
+  return ring;
+}
+
+IoUring::IoUring(uint32_t queueDepth)
+    : queueDepth_(queueDepth), ring_(new io_uring()) {
+  const auto rc = io_uring_queue_init(queueDepth_, ring_, 0);
+  if (rc != 0) {
+    delete ring_;
+    VELOX_FAIL("io_uring_queue_init failed: {}", folly::errnoStr(-rc));
+  }
+  registeredBuffersSupported_ =
+      io_uring_register_buffers_sparse(ring_, kMaxRegisteredBuffers) == 0;
+  if (registeredBuffersSupported_) {
+    registeredBufferSlots_.resize(kMaxRegisteredBuffers, nullptr);
+  }
+  reaper_ = std::thread([this]() { reap(); });
+}
+
+IoUring::~IoUring() {
+  {
+    // A nop without a request stops the reaper.
+    std::lock_guard<std::mutex> l(mutex_);
+    auto* sqe = io_uring_get_sqe(ring_);
+    if (sqe == nullptr) {
+      io_uring_submit(ring_);
+      sqe = io_uring_get_sqe(ring_);
+    }
+    io_uring_prep_nop(sqe);
+    io_uring_sqe_set_data(sqe, nullptr);
+    io_uring_submit(ring_);
+  }
+  reaper_.join();
+  io_uring_queue_exit(ring_);
+  delete ring_;
+}
+
+folly::SemiFuture<uint64_t> IoUring::readv(
+    int32_t fd,
+    uint64_t offset,
+    const std::vector<folly::Range<char*>>& buffers) {
+  auto request = std::make_unique<Request>();
+  request->write = false;
+  request->iovecs.reserve(buffers.size());
+  uint64_t opOffset = offset;
+  uint32_t firstIovec = 0;
+  for (const auto& buffer : buffers) {
+    request->totalBytes += buffer.size();
+    if (buffer.data() != nullptr) {
+      if (request->iovecs.size() - firstIovec == IOV_MAX) {
+        addOp(*request, firstIovec, opOffset);
+        firstIovec = request->iovecs.size();
+        opOffset = offset;
+      }
+      request->iovecs.push_back({buffer.data(), buffer.size()});
+    } else {
+      // Skipped ranges end the current op.
+      addOp(*request, firstIovec, opOffset);
+      firstIovec = request->iovecs.size();
+      opOffset = offset + buffer.size();
+    }
+    offset += buffer.size();
+  }
+  addOp(*request, firstIovec, opOffset);
+  return submit(fd, std::move(request));
+}
+
+folly::SemiFuture<uint64_t>
+IoUring::writev(int32_t fd, uint64_t offset, const std::vector<iovec>& iovecs) {
+  auto request = std::make_unique<Request>();
+  request->write = true;
+  request->iovecs.reserve(iovecs.size());
+  uint64_t opOffset = offset;
+  uint32_t firstIovec = 0;
+  for (const auto& iov : iovecs) {
+    if (request->iovecs.size() - firstIovec == IOV_MAX) {
+      addOp(*request, firstIovec, opOffset);
+      firstIovec = request->iovecs.size();
+      opOffset = offset + request->totalBytes;
+    }
+    request->iovecs.push_back(iov);
+    request->totalBytes += iov.iov_len;
+  }
+  addOp(*request, firstIovec, opOffset);
+  return submit(fd, std::move(request));
+}
+
+// static
+void IoUring::addOp(Request& request, uint32_t firstIovec, uint64_t offset) {
+  const uint32_t numIovecs = request.iovecs.size() - firstIovec;
+  if (numIovecs == 0) {
+    return;
+  }
+  uint64_t size{0};
+  for (auto i = firstIovec; i < request.iovecs.size(); ++i) {
+    size += request.iovecs[i].iov_len;
+  }
+  request.ops.push_back({&request, offset, firstIovec, numIovecs, size});
+}
+
+folly::SemiFuture<uint64_t> IoUring::submit(
+    int32_t fd,
+    std::unique_ptr<Request> request) {
+  if (request->ops.empty()) {
+    return folly::makeSemiFuture<uint64_t>(request->totalBytes);
+  }
+  auto future = request->promise.getSemiFuture();
+  // Set before the first submit since the reaper may complete ops while the
+  // remaining ones are being added.
+  request->pending = request->ops.size();
+  auto* rawRequest = request.release();
+
+  std::unique_lock<std::mutex> l(mutex_);
+  uint32_t numToSubmit{0};
+  for (auto& op : rawRequest->ops) {
+    if (numInFlight_ >= queueDepth_) {
+      if (numToSubmit > 0) {
+        io_uring_submit(ring_);
+        numToSubmit = 0;
+      }
+      inFlightCv_.wait(l, [&]() { return numInFlight_ < queueDepth_; });
+    }
+    auto* sqe = io_uring_get_sqe(ring_);
+    if (sqe == nullptr) {
+      io_uring_submit(ring_);
+      numToSubmit = 0;
+      sqe = io_uring_get_sqe(ring_);
+      VELOX_CHECK_NOT_NULL(sqe);
+    }
+    const auto& firstIovec = rawRequest->iovecs[op.firstIovec];
+    const auto bufferIndex =
+        op.numIovecs == 1 ? registeredBufferIndexLocked(firstIovec) : -1;
+    if (bufferIndex >= 0) {
+      if (rawRequest->write) {
+        io_uring_prep_write_fixed(
+            sqe,
+            fd,
+            firstIovec.iov_base,
+            firstIovec.iov_len,
+            op.offset,
+            bufferIndex);
+      } else {
+        io_uring_prep_read_fixed(
+            sqe,
+            fd,
+            firstIovec.iov_base,
+            firstIovec.iov_len,
+            op.offset,
+            bufferIndex);
+      }
+      ++numFixedIos_;
+    } else if (rawRequest->write) {
+      io_uring_prep_writev(sqe, fd, &firstIovec, op.numIovecs, op.offset);
+    } else {
+      io_uring_prep_readv(sqe, fd, &firstIovec, op.numIovecs, op.offset);
+    }
+    io_uring_sqe_set_data(sqe, &op);
+    ++numInFlight_;
+    ++numToSubmit;
+  }
+  if (numToSubmit > 0) {
+    const auto rc = io_uring_submit(ring_);
+    VELOX_CHECK_GE(rc, 0, "io_uring_submit failed: {}", folly::errnoStr(-rc));
+  }
+  return future;
+}
+
+int32_t IoUring::registeredBufferIndexLocked(const iovec& iov) const {
+  if (registeredBuffers_.empty()) {
+    return -1;
+  }
+  auto* data = static_cast<char*>(iov.iov_base);
+  auto it = registeredBuffers_.upper_bound(data);
+  if (it == registeredBuffers_.begin()) {
+    return -1;
+  }
+  --it;
+  const auto [size, index] = it->second;
+  if (data + iov.iov_len > it->first + size) {
+    return -1;
+  }
+  return index;
+}
+
+int32_t IoUring::registerBuffer(char* data, uint64_t size) {
+  std::lock_guard<std::mutex> l(mutex_);
+  if (!registeredBuffersSupported_) {
+    return -1;
+  }
+  for (auto i = 0; i < registeredBufferSlots_.size(); ++i) {
+    if (registeredBufferSlots_[i] != nullptr) {
+      continue;
+    }
+    iovec iov{data, size};
+    const auto rc =
+        io_uring_register_buffers_update_tag(ring_, i, &iov, nullptr, 1);
+    if (rc < 0) {
+      LOG(WARNING) << "io_uring buffer registration failed: "
+                   << folly::errnoStr(-rc);
+      return -1;
+    }
+    registeredBufferSlots_[i] = data;
+    registeredBuffers_[data] = {size, i};
+    return i;
+  }
+  return -1;
+}
+
+void IoUring::unregisterBuffer(int32_t index) {
+  std::lock_guard<std::mutex> l(mutex_);
+  VELOX_CHECK_LT(index, registeredBufferSlots_.size());
+  VELOX_CHECK_NOT_NULL(registeredBufferSlots_[index]);
+  // An empty iovec clears the slot. Ops in flight keep their reference.
+  iovec iov{nullptr, 0};
+  io_uring_register_buffers_update_tag(ring_, index, &iov, nullptr, 1);
+  registeredBuffers_.erase(registeredBufferSlots_[index]);
+  registeredBufferSlots_[index] = nullptr;
+}
+
+void IoUring::reap() {
+  for (;;) {
+    io_uring_cqe* cqe;
+    const auto rc = io_uring_wait_cqe(ring_, &cqe);
+    if (rc == -EINTR) {
+      continue;
+    }
+    VELOX_CHECK_EQ(rc, 0, "io_uring_wait_cqe failed: {}", folly::errnoStr(-rc));
+    auto* op = static_cast<Op*>(io_uring_cqe_get_data(cqe));
+    const auto result = cqe->res;
+    io_uring_cqe_seen(ring_, cqe);
+    if (op == nullptr) {
+      return;
+    }
+    complete(op, result);
+  }
+}
+
+void IoUring::complete(Op* op, int32_t result) {
+  auto* request = op->request;
+  if (result < 0) {
+    request->error = fmt::format(
+        "io_uring {} failed at offset {}: {}",
+        request->write ? "write" : "read",
+        op->offset,
+        folly::errnoStr(-result));
+  } else if (
+      static_cast<uint64_t>(result) != op->size && request->error.empty()) {
+    request->error = fmt::format(
+        "Short io_uring {} at offset {}, {} vs {}",
+        request->write ? "write" : "read",
+        op->offset,
+        result,
+        op->size);
+  }
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    --numInFlight_;
+  }
+  inFlightCv_.notify_all();
+  if (--request->pending > 0) {
+    return;
+  }
+  std::unique_ptr<Request> finished(request);
+  if (finished->error.empty()) {
+    finished->promise.setValue(finished->totalBytes);
+    return;
+  }
+  try {
+    VELOX_FAIL(finished->error);
+  } catch (const std::exception&) {
+    finished->promise.setException(
+        folly::exception_wrapper(std::current_exception()));
+  }
+}
+
+#else
+
+// static
+IoUring* IoUring::instance() {
+  return nullptr;
+}
+
+IoUring::IoUring(uint32_t queueDepth) : queueDepth_(queueDepth) {
+  VELOX_UNSUPPORTED("Velox is built without io_uring support");
+}
+
+IoUring::~IoUring() = default;
+
+folly::SemiFuture<uint64_t> IoUring::readv(
+    int32_t /*fd*/,
+    uint64_t /*offset*/,
+    const std::vector<folly::Range<char*>>& /*buffers*/) {
+  VELOX_UNREACHABLE();
+}
+
+folly::SemiFuture<uint64_t> IoUring::writev(
+    int32_t /*fd*/,
+    uint64_t /*offset*/,
+    const std::vector<iovec>& /*iovecs*/) {
+  VELOX_UNREACHABLE();
+}
+
+int32_t IoUring::registerBuffer(char* /*data*/, uint64_t /*size*/) {
+  VELOX_UNREACHABLE();
+}
+
+void IoUring::unregisterBuffer(int32_t /*index*/) {
+  VELOX_UNREACHABLE();
+}
+
+#endif // VELOX_ENABLE_IO_URING
+
+} // namespace facebook::velox
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <sys/uio.h>
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include <folly/Range.h>
+#include <folly/futures/Future.h>
+
+struct io_uring;
+
+namespace facebook::velox {
+
+/// An io_uring submission and completion queue shared by local files. Reads
+/// and writes are submitted by the calling thread and completed by a single
+/// reaper thread, so that many IOs can be in flight without a thread blocked
+/// on each. The IOs of one readv() or writev() call are submitted as a batch
+/// with a single system call. Only available if Velox is built with
+/// VELOX_ENABLE_IO_URING and the kernel supports io_uring.
+class IoUring {
+ public:
+  static constexpr uint32_t kDefaultQueueDepth{256};
+  static constexpr uint32_t kMaxRegisteredBuffers{1024};
+
+  /// Returns the process wide ring or nullptr if io_uring is not available.
+  static IoUring* instance();
+
+  explicit IoUring(uint32_t queueDepth = kDefaultQueueDepth);
+
+  ~IoUring();
+
+  /// Reads from 'fd' at 'offset' into 'buffers'. A buffer with a null data
+  /// pointer skips its size in the file. Returns the number of bytes covered
+  /// by 'buffers', or an error if any read fails or is short. The buffers
+  /// must stay valid until the returned future completes.
+  folly::SemiFuture<uint64_t> readv(
+      int32_t fd,
+      uint64_t offset,
+      const std::vector<folly::Range<char*>>& buffers);
+
+  /// Writes 'iovecs' to 'fd' at 'offset'. Returns the number of bytes
+  /// written, or an error if any write fails or is short. The data must stay
+  /// valid until the returned future completes.
+  folly::SemiFuture<uint64_t>
+  writev(int32_t fd, uint64_t offset, const std::vector<iovec>& iovecs);
+
+  /// Registers 'size' bytes at 'data' with the kernel so that reads and
+  /// writes that fall entirely inside the buffer do not map its pages on
+  /// each IO. Returns the index for unregisterBuffer() or -1 if the kernel
+  /// does not support buffer registration or all slots are in use.
+  int32_t registerBuffer(char* data, uint64_t size);
+
+  void unregisterBuffer(int32_t index);
+
+  /// Returns the number of IOs that used a registered buffer.
+  uint64_t numFixedIos() const {
+    return numFixedIos_;
+  }
+
+ private:
+  struct Request;
+
+  struct Op {
+    Request* request;
+    uint64_t offset;
+    // Range of the op in Request::iovecs.
+    uint32_t firstIovec;
+    uint32_t numIovecs;
+    uint64_t size;
+  };
+
+  struct Request {
+    folly::Promise<uint64_t> promise;
+    bool write;
+    uint64_t totalBytes{0};
+    std::vector<iovec> iovecs;
+    std::vector<Op> ops;
+    // Number of ops not completed yet. Only accessed by the reaper thread
+    // after submission.
+    uint32_t pending{0};
+    std::string error;
+  };
+
+  folly::SemiFuture<uint64_t> submit(
+      int32_t fd,
+      std::unique_ptr<Request> request);
+
+  // Adds an op at 'offset' for the iovecs of 'request' from 'firstIovec' to
+  // the end.
+  static void addOp(Request& request, uint32_t firstIovec, uint64_t offset);
+
+  // Returns the index of the registered buffer containing 'iov' or -1.
+  int32_t registeredBufferIndexLocked(const iovec& iov) const;
+
+  void reap();
+
+  void complete(Op* op, int32_t result);
+
+  const uint32_t queueDepth_;
+  io_uring* ring_{nullptr};
+  bool registeredBuffersSupported_{false};
+
+  // Serializes submission.
+  std::mutex mutex_;
+  std::condition_variable inFlightCv_;
+  uint32_t numInFlight_{0};
+  // Start address to size and index of the registered buffers.
+  std::map<char*, std::pair<uint64_t, int32_t>> registeredBuffers_;
+  std::vector<char*> registeredBufferSlots_;
+
+  std::atomic_uint64_t numFixedIos_{0};
+  std::thread reaper_;
+};
+
+} // namespace facebook::velox
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/common/file/CachingFileSystem.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/common/file/File.h"
+#include "velox/exec/tests/utils/TempDirectoryPath.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::filesystems;
+
+namespace {
+
+class CachingFileSystemTest : public testing::Test {
+ protected:
+  static constexpr uint64_t kBlockSize{1'024};
+  static constexpr uint64_t kFileSize{10 * kBlockSize + 100};
+
+  void SetUp() override {
+    registerLocalFileSystem();
+    tempDirectory_ = exec::test::TempDirectoryPath::create();
+    FileBlockCache::init(
+        {.directory = tempDirectory_->getPath() + "/cache",
+         .blockSize = kBlockSize,
+         .maxBytes = 4 * kBlockSize});
+    cache_ = FileBlockCache::instance();
+    fileSystem_ = std::make_shared<CachingFileSystem>(
+        getFileSystem("/", nullptr), cache_);
+
+    path_ = tempDirectory_->getPath() + "/data";
+    content_.resize(kFileSize);
+    for (auto i = 0; i < kFileSize; ++i) {
+      content_[i] = 'a' + i % 26;
+    }
+    writeFile(path_, content_);
+  }
+
+  void TearDown() override {
+    FileBlockCache::testingReset();
+  }
+
+  void writeFile(const std::string& path, const std::string& content) {
+    auto file = fileSystem_->openFileForWrite(
+        path, {.shouldThrowOnFileAlreadyExists = false});
+    file->append(content);
+    file->close();
+  }
+
+  std::string read(const ReadFile& file, uint64_t offset, uint64_t length) {
+    std::string data(length, 0);
+    file.pread(offset, length, data.data());
+    return data;
+  }
+
+  std::shared_ptr<exec::test::TempDirectoryPath> tempDirectory_;
+  FileBlockCache* cache_;
+  std::shared_ptr<CachingFileSystem> fileSystem_;
+  std::string path_;
+  std::string content_;
+};
+
+TEST_F(CachingFileSystemTest, readThrough) {
+  auto file = fileSystem_->openFileForRead(path_);
+  ASSERT_EQ(file->size(), kFileSize);
+
+  // A read across two blocks reads both blocks from the file.
+  File::IoStats stats;
+  ASSERT_EQ(
+      file->pread(kBlockSize - 10, 20, &stats),
+      content_.substr(kBlockSize - 10, 20));
+  ASSERT_EQ(cache_->stats().numBlocks, 2);
+  ASSERT_EQ(cache_->stats().bytes, 2 * kBlockSize);
+  ASSERT_EQ(
+      stats.stats().at(std::string(CachingFileSystem::kMissedBlocks)).sum, 2);
+
+  // The reads within the cached blocks are from the local disk.
+  File::IoStats cachedStats;
+  ASSERT_EQ(
+      file->pread(100, 1'500, &cachedStats), content_.substr(100, 1'500));
+  ASSERT_EQ(
+      cachedStats.stats().at(std::string(CachingFileSystem::kCachedBytes)).sum,
+      1'500);
+  ASSERT_EQ(
+      cachedStats.stats().count(std::string(CachingFileSystem::kMissedBlocks)),
+      0);
+
+  // The last block is shorter than the block size.
+  ASSERT_EQ(read(*file, kFileSize - 50, 50), content_.substr(kFileSize - 50));
+  ASSERT_EQ(
+      read(*file, kFileSize - 100, 100), content_.substr(kFileSize - 100));
+  ASSERT_EQ(cache_->stats().numBlocks, 3);
+  ASSERT_EQ(cache_->stats().bytes, 2 * kBlockSize + 100);
+
+  // A second file of the same path shares the blocks.
+  const auto numHits = cache_->stats().numHits;
+  auto otherFile = fileSystem_->openFileForRead(path_);
+  ASSERT_EQ(read(*otherFile, 0, kBlockSize), content_.substr(0, kBlockSize));
+  ASSERT_EQ(cache_->stats().numBlocks, 3);
+  ASSERT_EQ(cache_->stats().numHits, numHits + 1);
+
+  VELOX_ASSERT_THROW(read(*file, kFileSize - 10, 20), "Read past end");
+}
+
+TEST_F(CachingFileSystemTest, evict) {
+  auto file = fileSystem_->openFileForRead(path_);
+  ASSERT_EQ(read(*file, 0, kFileSize), content_);
+  auto stats = cache_->stats();
+  ASSERT_EQ(stats.numBlocks, 4);
+  ASSERT_LE(stats.bytes, cache_->maxBytes());
+  ASSERT_EQ(stats.numEvictions, 7);
+
+  // The first blocks are evicted and read again.
+  ASSERT_EQ(read(*file, 0, 10), content_.substr(0, 10));
+  ASSERT_EQ(cache_->stats().numEvictions, 8);
+  // The last block is the most recently used one.
+  const auto numHits = cache_->stats().numHits;
+  ASSERT_EQ(read(*file, kFileSize - 10, 10), content_.substr(kFileSize - 10));
+  ASSERT_EQ(cache_->stats().numHits, numHits + 1);
+}
+
+TEST_F(CachingFileSystemTest, rewriteAndRemove) {
+  ASSERT_EQ(read(*fileSystem_->openFileForRead(path_), 0, 10), "abcdefghij");
+  ASSERT_EQ(cache_->stats().numBlocks, 1);
+
+  // A write through the file system drops the blocks of the file.
+  writeFile(path_, "xyz");
+  ASSERT_EQ(cache_->stats().numBlocks, 0);
+  ASSERT_EQ(read(*fileSystem_->openFileForRead(path_), kFileSize, 3), "xyz");
+  ASSERT_EQ(cache_->stats().numBlocks, 1);
+
+  // So does a rename over the file.
+  const auto otherPath = tempDirectory_->getPath() + "/other";
+  writeFile(otherPath, std::string(kBlockSize, 'x'));
+  fileSystem_->rename(otherPath, path_, true);
+  ASSERT_EQ(cache_->stats().numBlocks, 0);
+  ASSERT_EQ(read(*fileSystem_->openFileForRead(path_), 0, 3), "xxx");
+  ASSERT_EQ(cache_->stats().numBlocks, 1);
+
+  fileSystem_->remove(path_);
+  ASSERT_FALSE(fileSystem_->exists(path_));
+  ASSERT_EQ(cache_->stats().numBlocks, 0);
+  ASSERT_EQ(cache_->stats().bytes, 0);
+}
+
+TEST_F(CachingFileSystemTest, ttl) {
+  auto file = fileSystem_->openFileForRead(path_);
+  read(*file, 0, 2 * kBlockSize);
+  cache_->applyTTL(3'600);
+  ASSERT_EQ(cache_->stats().numBlocks, 2);
+
+  std::this_thread::sleep_for(std::chrono::seconds(2));
+  read(*file, 2 * kBlockSize, kBlockSize);
+  cache_->applyTTL(1);
+  ASSERT_EQ(cache_->stats().numBlocks, 1);
+  ASSERT_EQ(cache_->stats().bytes, kBlockSize);
+}
+
+} // namespace
@@ -21,6 +21,7 @@
 #include "velox/common/memory/MmapAllocator.h"
 #include "velox/exec/tests/utils/TempDirectoryPath.h"
 
+#include <folly/executors/CPUThreadPoolExecutor.h>
 #include <gtest/gtest.h>
 
 using namespace facebook::velox;
@@ -50,7 +51,9 @@ class FileInputStreamTest : public testing::Test {
 
   std::unique_ptr<common::FileInputStream> createStream(
       uint64_t streamSize,
-      uint32_t bufferSize = 1024) {
+      uint32_t bufferSize = 1024,
+      uint32_t numReadAheadBuffers = 1,
+      folly::Executor* executor = nullptr) {
     const auto filePath =
         fmt::format("{}/{}", tempDirPath_->getPath(), fileId_++);
     auto writeFile = fs_->openFileForWrite(filePath);
@@ -62,7 +65,11 @@ class FileInputStreamTest : public testing::Test {
         std::string_view(reinterpret_cast<char*>(buffer.data()), streamSize));
     writeFile->close();
     return std::make_unique<common::FileInputStream>(
-        fs_->openFileForRead(filePath), bufferSize, pool_.get());
+        fs_->openFileForRead(filePath),
+        bufferSize,
+        pool_.get(),
+        numReadAheadBuffers,
+        executor);
   }
 
   folly::Random::DefaultGenerator rng_;
@@ -111,3 +118,60 @@ TEST_F(FileInputStreamTest, stats) {
     ASSERT_GT(byteStream->stats().readTimeNs, 0);
   }
 }
+
+TEST_F(FileInputStreamTest, readAhead) {
+  // The local file system does not support async read so the read-ahead runs
+  // on the executor.
+  folly::CPUThreadPoolExecutor executor(4);
+  struct {
+    size_t streamSize;
+    size_t bufferSize;
+    uint32_t numReadAheadBuffers;
+
+    std::string debugString() const {
+      return fmt::format(
+          "streamSize {}, bufferSize {}, numReadAheadBuffers {}",
+          streamSize,
+          bufferSize,
+          numReadAheadBuffers);
+    }
+  } testSettings[] = {
+      {4096, 1024, 0},
+      {4096, 1024, 1},
+      {4096, 1024, 3},
+      {4096, 1024, 8},
+      {4096 + 100, 1024, 2},
+      {4096, 4096, 2}};
+
+  for (const auto& testData : testSettings) {
+    SCOPED_TRACE(testData.debugString());
+
+    auto byteStream = createStream(
+        testData.streamSize,
+        testData.bufferSize,
+        testData.numReadAheadBuffers,
+        &executor);
+    std::vector<uint8_t> buffer(testData.streamSize);
+    byteStream->readBytes(buffer.data(), testData.streamSize);
+    for (int i = 0; i < testData.streamSize; ++i) {
+      ASSERT_EQ(buffer[i], i % 256);
+    }
+    ASSERT_TRUE(byteStream->atEnd());
+    ASSERT_EQ(
+        byteStream->stats().numReads,
+        bits::roundUp(testData.streamSize, testData.bufferSize) /
+            testData.bufferSize);
+    ASSERT_EQ(byteStream->stats().readBytes, testData.streamSize);
+    if (testData.numReadAheadBuffers == 0 ||
+        testData.streamSize <= testData.bufferSize) {
+      ASSERT_EQ(byteStream->stats().readAheadWaitTimeNs, 0);
+    }
+  }
+
+  // Destroys a stream with read-ahead in flight.
+  auto byteStream = createStream(1 << 20, 1024, 4, &executor);
+  uint8_t byte;
+  byteStream->readBytes(&byte, 1);
+  ASSERT_EQ(byte, 0);
+  byteStream.reset();
+}
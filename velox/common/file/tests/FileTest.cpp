@@ -471,6 +471,46 @@ TEST_P(LocalFileTest, attributes) {
   writeFile->close();
 }
 
+TEST_P(LocalFileTest, ioUring) {
+  auto* ioUring = IoUring::instance();
+  if (ioUring == nullptr || useFaultyFs_) {
+    GTEST_SKIP() << "io_uring is not available";
+  }
+  auto tempFile = exec::test::TempFilePath::create();
+  const auto& filename = tempFile->getPath();
+  auto fs = filesystems::getFileSystem(filename, {});
+  for (bool withOffset : {false, true}) {
+    SCOPED_TRACE(fmt::format("withOffset {}", withOffset));
+    fs->remove(filename);
+    {
+      LocalWriteFile writeFile(filename, false, true, true, ioUring);
+      if (withOffset) {
+        writeDataWithOffset(&writeFile);
+      } else {
+        writeData(&writeFile, true);
+      }
+      writeFile.close();
+    }
+    LocalReadFile readFile(filename, nullptr, true, ioUring);
+    ASSERT_TRUE(readFile.hasPreadvAsync());
+    readData(&readFile, true, true);
+  }
+
+  // Reads into a registered buffer use the fixed buffer read.
+  std::string buffer(1 << 10, '\0');
+  const auto index = ioUring->registerBuffer(buffer.data(), buffer.size());
+  if (index < 0) {
+    return;
+  }
+  const auto numFixedIos = ioUring->numFixedIos();
+  LocalReadFile readFile(filename, nullptr, true, ioUring);
+  ASSERT_EQ(readFile.pread(5, 10, buffer.data() + 100), "bbbbbccccc");
+  ASSERT_EQ(ioUring->numFixedIos(), numFixedIos + 1);
+  ioUring->unregisterBuffer(index);
+  ASSERT_EQ(readFile.pread(5, 10, buffer.data() + 100), "bbbbbccccc");
+  ASSERT_EQ(ioUring->numFixedIos(), numFixedIos + 1);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     LocalFileTestSuite,
     LocalFileTest,
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/file/HedgedReader.h"
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <gtest/gtest.h>
+
+#include "velox/common/base/tests/GTestUtils.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::filesystems;
+
+namespace {
+
+class HedgedReaderTest : public testing::Test {
+ protected:
+  folly::CPUThreadPoolExecutor executor_{4};
+};
+
+TEST_F(HedgedReaderTest, fastRead) {
+  auto reader = HedgedReader::create(std::chrono::seconds(10), &executor_);
+  File::IoStats stats;
+  char buffer[4];
+  for (uint64_t i = 0; i < HedgedReader::kMinReadsForLatency; ++i) {
+    reader->read(
+        sizeof(buffer),
+        buffer,
+        [](char* data) { memcpy(data, "abcd", 4); },
+        &stats);
+    ASSERT_EQ(std::string_view(buffer, sizeof(buffer)), "abcd");
+  }
+  ASSERT_EQ(reader->numHedgedReads(), 0);
+  ASSERT_TRUE(stats.stats().empty());
+  // The p99 latency of the fast reads is below the minimum delay.
+  ASSERT_EQ(reader->delay(), std::chrono::seconds(10));
+}
+
+TEST_F(HedgedReaderTest, slowRead) {
+  auto reader = HedgedReader::create(std::chrono::milliseconds(10), &executor_);
+  File::IoStats stats;
+  auto numReads = std::make_shared<std::atomic<int32_t>>(0);
+  char buffer[4];
+  reader->read(
+      sizeof(buffer),
+      buffer,
+      [numReads](char* data) {
+        if (++*numReads == 1) {
+          std::this_thread::sleep_for(std::chrono::seconds(1));
+          memcpy(data, "slow", 4);
+        } else {
+          memcpy(data, "fast", 4);
+        }
+      },
+      &stats);
+  ASSERT_EQ(std::string_view(buffer, sizeof(buffer)), "fast");
+  ASSERT_EQ(*numReads, 2);
+  ASSERT_EQ(reader->numHedgedReads(), 1);
+  ASSERT_EQ(reader->numHedgedReadWins(), 1);
+  const auto counters = stats.stats();
+  ASSERT_EQ(counters.at(std::string(HedgedReader::kHedgedReads)).sum, 1);
+  ASSERT_EQ(counters.at(std::string(HedgedReader::kHedgedReadWins)).sum, 1);
+}
+
+TEST_F(HedgedReaderTest, error) {
+  auto reader = HedgedReader::create(std::chrono::milliseconds(10), &executor_);
+  char buffer[4];
+  VELOX_ASSERT_THROW(
+      reader->read(
+          sizeof(buffer),
+          buffer,
+          [](char* /*data*/) { VELOX_FAIL("Read failed"); }),
+      "Read failed");
+  ASSERT_EQ(reader->numHedgedReads(), 0);
+}
+
+} // namespace
@@ -143,6 +143,18 @@ void DenseHll::insertHash(uint64_t hash) {
   insert(index, value);
 }
 
+void DenseHll::insertHashes(const uint64_t* hashes, int32_t count) {
+  for (auto i = 0; i < count; ++i) {
+    const auto index = computeIndex(hashes[i], indexBitLength_);
+    const int8_t value = numberOfLeadingZeros(hashes[i], indexBitLength_) + 1;
+    // 'baseline_' changes only in insert().
+    if (value - baseline_ <= getDelta(index)) {
+      continue;
+    }
+    insert(index, value);
+  }
+}
+
 void DenseHll::insert(int32_t index, int8_t value) {
   auto delta = value - baseline_;
   auto oldDelta = getDelta(index);
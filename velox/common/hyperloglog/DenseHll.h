@@ -48,6 +48,11 @@ class DenseHll {
 
   void insertHash(uint64_t hash);
 
+  /// Same as calling insertHash() for each of 'hashes'. Hashes that do not
+  /// raise their bucket, which is most of them once the HLL has seen many
+  /// values, are skipped after one bucket lookup.
+  void insertHashes(const uint64_t* hashes, int32_t count);
+
   /// Inserts pre-computed {bucket, value} pair. These value must be compatible
   /// with computeIndex and computeValue methods called with the indexBitLength
   /// value of this HLL. Used by SparseHll.toDense().
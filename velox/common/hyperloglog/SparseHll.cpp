@@ -237,10 +237,28 @@ void SparseHll::verify() const {
 }
 
 void SparseHll::toDense(DenseHll& denseHll) const {
+  toDense(entries_.size(), entries_.data(), denseHll);
+}
+
+// static
+void SparseHll::mergeToDense(const char* serialized, DenseHll& denseHll) {
+  auto stream = initializeInputStream(serialized);
+  auto size = stream.read<int16_t>();
+  toDense(
+      size,
+      reinterpret_cast<const uint32_t*>(serialized + stream.offset()),
+      denseHll);
+}
+
+// static
+void SparseHll::toDense(
+    size_t size,
+    const uint32_t* entries,
+    DenseHll& denseHll) {
   auto indexBitLength = denseHll.indexBitLength();
 
-  for (auto i = 0; i < entries_.size(); i++) {
-    auto entry = entries_[i];
+  for (auto i = 0; i < size; i++) {
+    auto entry = entries[i];
     auto index = entry >> (32 - indexBitLength);
     auto shiftedValue = entry << indexBitLength;
     auto zeros = shiftedValue == 0 ? 32 : __builtin_clz(shiftedValue);
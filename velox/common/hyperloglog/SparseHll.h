@@ -65,6 +65,10 @@ class SparseHll {
   /// Merges state into provided instance of DenseHll.
   void toDense(DenseHll& denseHll) const;
 
+  /// Merges the state of a serialized instance into 'denseHll' without
+  /// materializing the SparseHll.
+  static void mergeToDense(const char* serialized, DenseHll& denseHll);
+
   /// Returns current memory usage.
   int32_t inMemorySize() const;
 
@@ -81,6 +85,9 @@ class SparseHll {
  private:
   void mergeWith(size_t otherSize, const uint32_t* otherEntries);
 
+  static void
+  toDense(size_t size, const uint32_t* entries, DenseHll& denseHll);
+
   /// A list of observed buckets. Each entry is a 32 bit integer encoding 26-bit
   /// bucket and 6-bit value (number of zeros in the input hash after the bucket
   /// + 1).
@@ -30,7 +30,7 @@ uint64_t hashOne(T value) {
   return XXH64(&value, sizeof(value), 0);
 }
 
-// A benchmark for DenseHll::mergeWith(serialized) API.
+// A benchmark for DenseHll::mergeWith(serialized) and insertion APIs.
 //
 // Measures the time it takes to merge 2 serialized digests using different
 // values for hash bits. Larger values of hash bits corresponds to larger
@@ -43,6 +43,31 @@ class DenseHllBenchmark {
       serializedHlls_[hashBits].push_back(makeSerializedHll(hashBits, 1));
       serializedHlls_[hashBits].push_back(makeSerializedHll(hashBits, 2));
     }
+    for (int32_t i = 0; i < 1'000'000; ++i) {
+      hashes_.push_back(hashOne(i));
+    }
+  }
+
+  // Inserts 1M hashes one at a time or in batches of 10K.
+  void insert(int hashBits, bool batched) {
+    folly::BenchmarkSuspender suspender;
+
+    HashStringAllocator allocator(pool_);
+    common::hll::DenseHll hll(hashBits, &allocator);
+
+    suspender.dismiss();
+
+    if (batched) {
+      constexpr int32_t kBatchSize = 10'000;
+      for (auto i = 0; i < hashes_.size(); i += kBatchSize) {
+        hll.insertHashes(hashes_.data() + i, kBatchSize);
+      }
+    } else {
+      for (auto hash : hashes_) {
+        hll.insertHash(hash);
+      }
+    }
+    folly::doNotOptimizeAway(hll.cardinality());
   }
 
   void run(int hashBits) {
@@ -82,6 +107,9 @@ class DenseHllBenchmark {
   // List of serialized HLLs to use for merging, keyed by the number of hash
   // bits.
   std::unordered_map<int, std::vector<std::string>> serializedHlls_;
+
+  // Hashes of 1M distinct values.
+  std::vector<uint64_t> hashes_;
 };
 
 } // namespace
@@ -100,6 +128,24 @@ BENCHMARK(mergeSerialized16) {
   benchmark->run(16);
 }
 
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK(insert11) {
+  benchmark->insert(11, false);
+}
+
+BENCHMARK_RELATIVE(insertBatch11) {
+  benchmark->insert(11, true);
+}
+
+BENCHMARK(insert16) {
+  benchmark->insert(16, false);
+}
+
+BENCHMARK_RELATIVE(insertBatch16) {
+  benchmark->insert(16, true);
+}
+
 int main(int argc, char** argv) {
   folly::Init init(&argc, &argv);
 
@@ -225,6 +225,26 @@ TEST_P(DenseHllTest, mergeWith) {
   testMergeWith(indexBitLength, sequence(0, 2'000'000), sequence(0, 2'000'000));
 }
 
+TEST_P(DenseHllTest, insertHashes) {
+  int8_t indexBitLength = GetParam();
+
+  DenseHll expected{indexBitLength, &allocator_};
+  DenseHll hll{indexBitLength, &allocator_};
+  std::vector<uint64_t> hashes;
+  for (auto i = 0; i < 100'000; ++i) {
+    hashes.push_back(hashOne(i));
+    expected.insertHash(hashes.back());
+    // Insert in batches of varying size.
+    if (hashes.size() == static_cast<size_t>(i % 1'000 + 1)) {
+      hll.insertHashes(hashes.data(), hashes.size());
+      hashes.clear();
+    }
+  }
+  hll.insertHashes(hashes.data(), hashes.size());
+
+  ASSERT_EQ(serialize(expected), serialize(hll));
+}
+
 INSTANTIATE_TEST_SUITE_P(
     DenseHllTest,
     DenseHllTest,
@@ -209,6 +209,28 @@ TEST_P(SparseHllToDenseTest, toDense) {
   ASSERT_EQ(serialize(denseHll), serialize(expectedHll));
 }
 
+TEST_P(SparseHllToDenseTest, mergeToDense) {
+  int8_t indexBitLength = GetParam();
+
+  SparseHll sparseHll{&allocator_};
+  DenseHll expectedHll{indexBitLength, &allocator_};
+  DenseHll denseHll{indexBitLength, &allocator_};
+  for (int i = 0; i < 1'000; i++) {
+    auto hash = hashOne(i);
+    sparseHll.insertHash(hash);
+    expectedHll.insertHash(hash);
+    if (i % 3 == 0) {
+      denseHll.insertHash(hash);
+    }
+  }
+
+  std::string serialized;
+  serialized.resize(sparseHll.serializedSize());
+  sparseHll.serialize(indexBitLength, serialized.data());
+  SparseHll::mergeToDense(serialized.data(), denseHll);
+  ASSERT_EQ(serialize(denseHll), serialize(expectedHll));
+}
+
 TEST_P(SparseHllToDenseTest, testNumberOfZeros) {
   auto indexBitLength = GetParam();
   for (int i = 0; i < 64 - indexBitLength; ++i) {
@@ -118,6 +118,9 @@ void IoStatistics::merge(const IoStatistics& other) {
   read_.merge(other.read_);
   ramHit_.merge(other.ramHit_);
   ssdRead_.merge(other.ssdRead_);
+  decompressedCacheHit_.merge(other.decompressedCacheHit_);
+  offloadedDecompress_.merge(other.offloadedDecompress_);
+  offloadFallbackDecompress_.merge(other.offloadFallbackDecompress_);
   queryThreadIoLatency_.merge(other.queryThreadIoLatency_);
   {
     const auto& otherOperationStats = other.operationStats();
@@ -91,6 +91,12 @@ class IoCounter {
 
 class IoStatistics {
  public:
+  /// Names of the latency histograms recorded for the operator whose thread
+  /// waits for storage reads and for loads into AsyncDataCache done by other
+  /// threads. See BaseRuntimeStatWriter::addLatency().
+  static inline const std::string kStorageReadLatency{"storageReadNanos"};
+  static inline const std::string kCacheLoadWaitLatency{"cacheLoadWaitNanos"};
+
   uint64_t rawBytesRead() const;
   uint64_t rawOverreadBytes() const;
   uint64_t rawBytesWritten() const;
@@ -127,6 +133,18 @@ class IoStatistics {
     return queryThreadIoLatency_;
   }
 
+  IoCounter& decompressedCacheHit() {
+    return decompressedCacheHit_;
+  }
+
+  IoCounter& offloadedDecompress() {
+    return offloadedDecompress_;
+  }
+
+  IoCounter& offloadFallbackDecompress() {
+    return offloadFallbackDecompress_;
+  }
+
   void incOperationCounters(
       const std::string& operation,
       const uint64_t resourceThrottleCount,
@@ -171,6 +189,18 @@ class IoStatistics {
   // or for an in-progress read-ahead to finish.
   IoCounter queryThreadIoLatency_;
 
+  // Compression chunks found decompressed in RAM cache. The sum is the
+  // decompressed size.
+  IoCounter decompressedCacheHit_;
+
+  // Compression chunks decompressed by a hardware accelerator. The sum is the
+  // decompressed size.
+  IoCounter offloadedDecompress_;
+
+  // Compression chunks offered to a hardware accelerator that were
+  // decompressed in software instead. The sum is the decompressed size.
+  IoCounter offloadFallbackDecompress_;
+
   std::unordered_map<std::string, OperationCounters> operationStats_;
   mutable std::mutex operationStatsMutex_;
 };
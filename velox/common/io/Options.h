@@ -147,6 +147,30 @@ class ReaderOptions {
     noCacheRetention_ = noCacheRetention;
   }
 
+  bool cacheDecompressedStreams() const {
+    return cacheDecompressedStreams_;
+  }
+
+  /// If true, the chunks of compressed streams are kept in the data cache
+  /// after decompression, so that later reads of the same stream do not
+  /// decompress them again. Only applies to readers with a data cache.
+  void setCacheDecompressedStreams(bool cacheDecompressedStreams) {
+    cacheDecompressedStreams_ = cacheDecompressedStreams;
+  }
+
+  bool cacheDecryptedStreams() const {
+    return cacheDecryptedStreams_;
+  }
+
+  /// If true, setCacheDecompressedStreams() also applies to encrypted streams.
+  /// Their decrypted and decompressed chunks are then kept in the data cache,
+  /// so that later reads skip both decryption and decompression. The data
+  /// cache is shared, so the plaintext is visible to every reader of the
+  /// cache.
+  void setCacheDecryptedStreams(bool cacheDecryptedStreams) {
+    cacheDecryptedStreams_ = cacheDecryptedStreams;
+  }
+
  protected:
   velox::memory::MemoryPool* memoryPool_;
   uint64_t autoPreloadLength_;
@@ -156,5 +180,7 @@ class ReaderOptions {
   int64_t maxCoalesceBytes_{kDefaultCoalesceBytes};
   int32_t prefetchRowGroups_{kDefaultPrefetchRowGroups};
   bool noCacheRetention_{false};
+  bool cacheDecompressedStreams_{false};
+  bool cacheDecryptedStreams_{false};
 };
 } // namespace facebook::velox::io
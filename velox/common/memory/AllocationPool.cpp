@@ -36,12 +36,38 @@ folly::Range<char*> AllocationPool::rangeAt(int32_t index) const {
     }
     return range;
   }
+  const auto fileIndex = largeIndex - largeAllocations_.size();
+  if (fileIndex < fileRegions_.size()) {
+    const auto& region = fileRegions_[fileIndex];
+    return folly::Range<char*>(
+        region->data(),
+        region->data() == startOfRun_ ? currentOffset_ : region->size());
+  }
   VELOX_FAIL("Out of range index for rangeAt(): {}", index);
 }
 
+int64_t AllocationPool::fileBackedBytes() const {
+  int64_t bytes{0};
+  for (const auto& region : fileRegions_) {
+    bytes += region->size();
+  }
+  return bytes;
+}
+
+int64_t AllocationPool::residentFileBackedBytes() const {
+  int64_t bytes{0};
+  for (const auto& region : fileRegions_) {
+    bytes += region->residentBytes();
+  }
+  return bytes;
+}
+
 void AllocationPool::clear() {
   allocations_.clear();
   largeAllocations_.clear();
+  fileRegions_.clear();
+  currentRunFileBacked_ = false;
+  fileReservedBytes_ = 0;
   startOfRun_ = nullptr;
   bytesInRun_ = 0;
   currentOffset_ = 0;
@@ -82,38 +108,63 @@ void AllocationPool::maybeGrowLastAllocation(uint64_t bytesRequested) {
     VELOX_CHECK_GT(bytesInRun_, AllocationTraits::kHugePageSize);
     const auto bytesToReserve = bits::roundUp(
         updateOffset - endOfReservedRun(), AllocationTraits::kHugePageSize);
-    largeAllocations_.back().grow(AllocationTraits::numPages(bytesToReserve));
+    if (currentRunFileBacked_) {
+      fileReservedBytes_ += bytesToReserve;
+    } else {
+      largeAllocations_.back().grow(
+          AllocationTraits::numPages(bytesToReserve));
+    }
     usedBytes_ += bytesToReserve;
   }
   // Only update currentOffset_ once it points to valid data.
   currentOffset_ = updateOffset;
 }
 
+int64_t AllocationPool::nextLargeRunSize(MachinePageCount numPages) const {
+  // At least 16 huge pages, no more than kMaxMmapBytes. The next is
+  // double the previous. Because the previous is a hair under the
+  // power of two because of fractional pages at ends of allocation,
+  // add an extra huge page size.
+  int64_t nextSize = std::min(
+      kMaxMmapBytes,
+      std::max<int64_t>(
+          16 * AllocationTraits::kHugePageSize,
+          bits::nextPowerOfTwo(usedBytes_ + AllocationTraits::kHugePageSize)));
+  // Round 'numPages' to no of pages in huge page. Allocating this plus an
+  // extra huge page guarantees that 'numPages' worth of contiguous aligned
+  // huge pages will be founfd in the allocation.
+  numPages = bits::roundUp(numPages, AllocationTraits::numPagesInHugePage());
+  if (AllocationTraits::pageBytes(numPages) + AllocationTraits::kHugePageSize >
+      nextSize) {
+    // Extra large single request.
+    nextSize =
+        AllocationTraits::pageBytes(numPages) + AllocationTraits::kHugePageSize;
+  }
+  return nextSize;
+}
+
+void AllocationPool::newFileBackedRun(MachinePageCount numPages) {
+  fileRegions_.push_back(std::make_unique<FileBackedRegion>(
+      fileBackedDirectory_, nextLargeRunSize(numPages)));
+  startOfRun_ = fileRegions_.back()->data();
+  bytesInRun_ = fileRegions_.back()->size();
+  currentOffset_ = 0;
+  currentRunFileBacked_ = true;
+  // Account the region like a large allocation: One huge page up front, the
+  // rest as it gets used. See maybeGrowLastAllocation().
+  fileReservedBytes_ = AllocationTraits::kHugePageSize;
+  usedBytes_ += fileReservedBytes_;
+}
+
 void AllocationPool::newRunImpl(MachinePageCount numPages) {
+  if (isFileBacked()) {
+    newFileBackedRun(numPages);
+    return;
+  }
+  currentRunFileBacked_ = false;
   if (usedBytes_ >= hugePageThreshold_ ||
       numPages > pool_->sizeClasses().back()) {
-    // At least 16 huge pages, no more than kMaxMmapBytes. The next is
-    // double the previous. Because the previous is a hair under the
-    // power of two because of fractional pages at ends of allocation,
-    // add an extra huge page size.
-    int64_t nextSize = std::min(
-        kMaxMmapBytes,
-        std::max<int64_t>(
-            16 * AllocationTraits::kHugePageSize,
-            bits::nextPowerOfTwo(
-                usedBytes_ + AllocationTraits::kHugePageSize)));
-    // Round 'numPages' to no of pages in huge page. Allocating this plus an
-    // extra huge page guarantees that 'numPages' worth of contiguous aligned
-    // huge pages will be founfd in the allocation.
-    numPages = bits::roundUp(numPages, AllocationTraits::numPagesInHugePage());
-    if (AllocationTraits::pageBytes(numPages) +
-            AllocationTraits::kHugePageSize >
-        nextSize) {
-      // Extra large single request.
-      nextSize = AllocationTraits::pageBytes(numPages) +
-          AllocationTraits::kHugePageSize;
-    }
-
+    const int64_t nextSize = nextLargeRunSize(numPages);
     ContiguousAllocation largeAlloc;
     const MachinePageCount pagesToAlloc =
         AllocationTraits::numPagesInHugePage();
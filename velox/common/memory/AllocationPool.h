@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "velox/common/memory/FileBackedRegion.h"
 #include "velox/common/memory/Memory.h"
 
 namespace facebook::velox::memory {
@@ -45,7 +46,8 @@ class AllocationPool {
   void newRun(int64_t preferredSize);
 
   int32_t numRanges() const {
-    return allocations_.size() + largeAllocations_.size();
+    return allocations_.size() + largeAllocations_.size() +
+        fileRegions_.size();
   }
 
   /// Returns the indexth contiguous range. If the range is a large allocation,
@@ -64,6 +66,9 @@ class AllocationPool {
 
   /// Returns the number of bytes allocatable without growing 'this'.
   int64_t freeBytes() const {
+    if (currentRunFileBacked_) {
+      return fileReservedBytes_ - currentOffset_;
+    }
     if (largeAllocations_.empty()) {
       return freeAddressableBytes();
     }
@@ -104,6 +109,28 @@ class AllocationPool {
     hugePageThreshold_ = size;
   }
 
+  /// Makes all runs started after this call come from FileBackedRegions
+  /// created under 'directory' instead of from 'pool_'. The run being
+  /// allocated from is used up first. The file backed memory is not counted
+  /// in 'pool_' and is paged by the OS. This is a best-effort fallback for
+  /// when 'pool_' cannot grow and spilling is not possible.
+  void setFileBackedDirectory(const std::string& directory) {
+    VELOX_CHECK(!directory.empty());
+    fileBackedDirectory_ = directory;
+  }
+
+  bool isFileBacked() const {
+    return !fileBackedDirectory_.empty();
+  }
+
+  /// Returns the total size of the FileBackedRegions of 'this'.
+  int64_t fileBackedBytes() const;
+
+  /// Returns the number of bytes of the FileBackedRegions of 'this' that are
+  /// resident in memory. This is the part of the file backed memory that
+  /// currently takes up physical memory.
+  int64_t residentFileBackedBytes() const;
+
   int64_t testingFreeAddressableBytes() const {
     return freeAddressableBytes();
   }
@@ -117,6 +144,9 @@ class AllocationPool {
   // to 'bytesInRun_' ut they are not marked used by the
   // pool/allocator. So use growContiguous() to update this.
   int64_t endOfReservedRun() {
+    if (currentRunFileBacked_) {
+      return fileReservedBytes_;
+    }
     if (largeAllocations_.empty()) {
       return bytesInRun_;
     }
@@ -137,9 +167,29 @@ class AllocationPool {
 
   void newRunImpl(memory::MachinePageCount numPages);
 
+  // Starts a new run from a FileBackedRegion of at least 'numPages'.
+  void newFileBackedRun(memory::MachinePageCount numPages);
+
+  // Returns the size of the next large run given that at least 'numPages'
+  // huge page aligned pages must fit in it.
+  int64_t nextLargeRunSize(memory::MachinePageCount numPages) const;
+
   memory::MemoryPool* pool_;
   std::vector<memory::Allocation> allocations_;
   std::vector<memory::ContiguousAllocation> largeAllocations_;
+  std::vector<std::unique_ptr<FileBackedRegion>> fileRegions_;
+
+  // Directory for FileBackedRegions. Empty unless setFileBackedDirectory()
+  // has been called.
+  std::string fileBackedDirectory_;
+
+  // True if the current run is the last of 'fileRegions_'.
+  bool currentRunFileBacked_{false};
+
+  // Offset from 'startOfRun_' up to which the current file backed run is
+  // counted in 'usedBytes_'. Grows in huge page increments like the
+  // reservation of a large allocation.
+  int64_t fileReservedBytes_{0};
 
   // Points to the start of the run from which allocations are being made.
   char* startOfRun_{nullptr};
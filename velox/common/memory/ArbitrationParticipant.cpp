@@ -414,7 +414,23 @@ ArbitrationCandidate::ArbitrationCandidate(
       currentCapacity(participant->capacity()),
       reclaimableUsedCapacity(
           freeCapacityOnly ? 0 : participant->reclaimableUsedCapacity()),
-      reclaimableFreeCapacity(participant->reclaimableFreeCapacity()) {}
+      reclaimableFreeCapacity(participant->reclaimableFreeCapacity()) {
+  if (freeCapacityOnly) {
+    return;
+  }
+  durationNs = participant->durationNs();
+  const auto* reclaimer = participant->pool()->reclaimer();
+  if (reclaimer == nullptr) {
+    return;
+  }
+  priority = reclaimer->priority();
+  uint64_t numCompleted{0};
+  uint64_t numTotal{0};
+  reclaimer->progress(*participant->pool(), numCompleted, numTotal);
+  if (numTotal > 0) {
+    progress = std::min(1.0, static_cast<double>(numCompleted) / numTotal);
+  }
+}
 
 std::string ArbitrationCandidate::toString() const {
   return fmt::format(
@@ -424,6 +440,122 @@ std::string ArbitrationCandidate::toString() const {
       succinctBytes(reclaimableFreeCapacity));
 }
 
+namespace {
+class CapacityVictimPolicy : public ArbitrationVictimPolicy {
+ public:
+  std::string name() const override {
+    return std::string(kCapacity);
+  }
+
+  bool spillBefore(
+      const ArbitrationCandidate& lhs,
+      const ArbitrationCandidate& rhs) const override {
+    if (lhs.priority == rhs.priority) {
+      return lhs.reclaimableUsedCapacity > rhs.reclaimableUsedCapacity;
+    }
+    return lhs.priority > rhs.priority;
+  }
+
+  bool abortBefore(
+      const ArbitrationCandidate& lhs,
+      const ArbitrationCandidate& rhs) const override {
+    return lhs.participant->id() > rhs.participant->id();
+  }
+};
+
+class CostVictimPolicy : public ArbitrationVictimPolicy {
+ public:
+  std::string name() const override {
+    return std::string(kCost);
+  }
+
+  bool spillBefore(
+      const ArbitrationCandidate& lhs,
+      const ArbitrationCandidate& rhs) const override {
+    if (lhs.priority != rhs.priority) {
+      return lhs.priority > rhs.priority;
+    }
+    // Spilling delays a query by the time to spill and restore its state,
+    // while a query close to finishing frees its memory soon on its own.
+    return lhs.reclaimableUsedCapacity * (1 - lhs.progress) >
+        rhs.reclaimableUsedCapacity * (1 - rhs.progress);
+  }
+
+  bool abortBefore(
+      const ArbitrationCandidate& lhs,
+      const ArbitrationCandidate& rhs) const override {
+    const auto lhsCost = abortCost(lhs);
+    const auto rhsCost = abortCost(rhs);
+    if (lhsCost == rhsCost) {
+      return lhs.participant->id() > rhs.participant->id();
+    }
+    return lhsCost < rhsCost;
+  }
+
+ private:
+  // The minimum fraction of remaining work assumed for a query.
+  static constexpr double kMinRemainingWork{0.05};
+
+  // Returns the cost of aborting 'candidate' as the work done so far, scaled
+  // up by how close the query is to finishing.
+  static double abortCost(const ArbitrationCandidate& candidate) {
+    return candidate.durationNs /
+        std::max(1 - candidate.progress, kMinRemainingWork);
+  }
+};
+
+class VictimPolicyRegistry {
+ public:
+  VictimPolicyRegistry() {
+    map_[std::string(ArbitrationVictimPolicy::kCapacity)] = []() {
+      return std::make_unique<CapacityVictimPolicy>();
+    };
+    map_[std::string(ArbitrationVictimPolicy::kCost)] = []() {
+      return std::make_unique<CostVictimPolicy>();
+    };
+  }
+
+  bool registerFactory(
+      const std::string& name,
+      ArbitrationVictimPolicy::Factory factory) {
+    std::lock_guard<std::mutex> l(mutex_);
+    return map_.emplace(name, std::move(factory)).second;
+  }
+
+  std::unique_ptr<ArbitrationVictimPolicy> create(const std::string& name) {
+    std::lock_guard<std::mutex> l(mutex_);
+    auto it = map_.find(name);
+    VELOX_USER_CHECK(
+        it != map_.end(),
+        "Arbitration victim policy {} is not registered",
+        name);
+    return it->second();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<std::string, ArbitrationVictimPolicy::Factory> map_;
+};
+
+VictimPolicyRegistry& victimPolicies() {
+  static VictimPolicyRegistry registry;
+  return registry;
+}
+} // namespace
+
+// static
+bool ArbitrationVictimPolicy::registerFactory(
+    const std::string& name,
+    Factory factory) {
+  return victimPolicies().registerFactory(name, std::move(factory));
+}
+
+// static
+std::unique_ptr<ArbitrationVictimPolicy> ArbitrationVictimPolicy::create(
+    const std::string& name) {
+  return victimPolicies().create(name);
+}
+
 #ifdef TSAN_BUILD
 ArbitrationTimedLock::ArbitrationTimedLock(
     std::timed_mutex& mutex,
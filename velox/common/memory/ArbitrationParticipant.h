@@ -403,6 +403,15 @@ struct ArbitrationCandidate {
   int64_t reclaimableUsedCapacity{0};
   int64_t reclaimableFreeCapacity{0};
 
+  /// The inputs of the victim selection cost model which are only collected if
+  /// not 'freeCapacityOnly'. 'priority' is the reclaimer priority of the query
+  /// memory pool, with larger values reclaimed first. 'progress' is the
+  /// fraction of the query's work that is done, between 0 and 1. 'durationNs'
+  /// is the time since the participant was created.
+  int32_t priority{0};
+  double progress{0};
+  uint64_t durationNs{0};
+
   /// If 'freeCapacityOnly' is true, the candidate is only used to reclaim free
   /// capacity so only collects the free capacity stats.
   ArbitrationCandidate(
@@ -411,4 +420,46 @@ struct ArbitrationCandidate {
 
   std::string toString() const;
 };
+
+/// Decides the order in which global arbitration reclaims used memory from
+/// the participants. The arbitrator first buckets the candidates by their
+/// reclaimable used capacity for spilling and by reclaimer priority and
+/// capacity for abort, and uses the policy to order the candidates within a
+/// bucket. New policies can be added with registerFactory() and are selected
+/// by name with the 'global-arbitration-victim-policy' arbitrator config.
+class ArbitrationVictimPolicy {
+ public:
+  /// Spills the lowest priority participant with the most reclaimable used
+  /// capacity first and aborts the youngest one first.
+  static constexpr std::string_view kCapacity{"capacity"};
+  /// Weighs the reclaimable used capacity and the age of a participant by the
+  /// progress of its query, so that a query close to finishing is spilled and
+  /// aborted after queries which would lose less work.
+  static constexpr std::string_view kCost{"cost"};
+
+  using Factory = std::function<std::unique_ptr<ArbitrationVictimPolicy>()>;
+
+  virtual ~ArbitrationVictimPolicy() = default;
+
+  /// Registers the factory of the policy 'name'. Returns false if a policy
+  /// with the same name is already registered.
+  static bool registerFactory(const std::string& name, Factory factory);
+
+  /// Creates the policy 'name'. Throws if it is not registered.
+  static std::unique_ptr<ArbitrationVictimPolicy> create(
+      const std::string& name);
+
+  virtual std::string name() const = 0;
+
+  /// Returns true if 'lhs' should be spilled before 'rhs'.
+  virtual bool spillBefore(
+      const ArbitrationCandidate& lhs,
+      const ArbitrationCandidate& rhs) const = 0;
+
+  /// Returns true if 'lhs' should be aborted before 'rhs'. Both have the same
+  /// reclaimer priority.
+  virtual bool abortBefore(
+      const ArbitrationCandidate& lhs,
+      const ArbitrationCandidate& rhs) const = 0;
+};
 } // namespace facebook::velox::memory
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "velox/common/memory/FileBackedRegion.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+
+#include <fmt/format.h>
+#include <folly/String.h>
+
+#include "velox/common/base/BitUtil.h"
+#include "velox/common/base/Exceptions.h"
+#include "velox/common/memory/Allocation.h"
+
+namespace facebook::velox::memory {
+
+FileBackedRegion::FileBackedRegion(const std::string& directory, uint64_t size)
+    : size_(size) {
+  VELOX_CHECK_GT(size_, 0);
+  VELOX_CHECK_EQ(size_ % AllocationTraits::kPageSize, 0);
+  auto path = fmt::format("{}/velox_file_backed_XXXXXX", directory);
+  fd_ = ::mkstemp(path.data());
+  VELOX_CHECK_GE(
+      fd_,
+      0,
+      "Cannot create file backed region in {}: {}",
+      directory,
+      folly::errnoStr(errno));
+  // The file is only reachable through 'fd_' and goes away when it is closed.
+  ::unlink(path.c_str());
+#ifdef __linux__
+  // Reserve the disk space up front. Writing to a page of a sparse file when
+  // the disk is full raises SIGBUS instead of an error.
+  const auto rc = ::posix_fallocate(fd_, 0, size_);
+#else
+  const auto rc = ::ftruncate(fd_, size_) == 0 ? 0 : errno;
+#endif
+  if (rc != 0) {
+    ::close(fd_);
+    VELOX_FAIL(
+        "Cannot size file backed region of {} bytes in {}: {}",
+        size_,
+        directory,
+        folly::errnoStr(rc));
+  }
+  void* data =
+      ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if (data == MAP_FAILED) {
+    const auto error = errno;
+    ::close(fd_);
+    VELOX_FAIL(
+        "Cannot map file backed region of {} bytes: {}",
+        size_,
+        folly::errnoStr(error));
+  }
+  data_ = reinterpret_cast<char*>(data);
+}
+
+FileBackedRegion::~FileBackedRegion() {
+  ::munmap(data_, size_);
+  ::close(fd_);
+}
+
+uint64_t FileBackedRegion::residentBytes() const {
+#ifdef __APPLE__
+  using ResidencyFlag = char;
+#else
+  using ResidencyFlag = unsigned char;
+#endif
+  static const uint64_t kOsPageSize = ::sysconf(_SC_PAGESIZE);
+  std::vector<ResidencyFlag> flags(bits::divRoundUp(size_, kOsPageSize));
+  if (::mincore(data_, size_, flags.data()) != 0) {
+    // Treat the region as resident if residency cannot be determined.
+    return size_;
+  }
+  uint64_t numResident{0};
+  for (const auto flag : flags) {
+    numResident += flag & 1;
+  }
+  return std::min(size_, numResident * kOsPageSize);
+}
+
+} // namespace facebook::velox::memory
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace facebook::velox::memory {
+
+/// A read-write shared mapping of an unlinked temporary file. The pages are
+/// backed by the file instead of swap, so the kernel can write them back and
+/// drop them from memory under pressure without the process having to spill.
+/// The memory is not counted in any MemoryPool. Used as a best-effort
+/// fallback for data structures that outgrow the memory that can be granted
+/// to them. See AllocationPool::setFileBackedDirectory().
+class FileBackedRegion {
+ public:
+  /// Creates a region of 'size' bytes in a new file under 'directory'.
+  /// Throws if the file cannot be created, sized or mapped.
+  FileBackedRegion(const std::string& directory, uint64_t size);
+
+  ~FileBackedRegion();
+
+  FileBackedRegion(const FileBackedRegion&) = delete;
+  FileBackedRegion& operator=(const FileBackedRegion&) = delete;
+
+  char* data() const {
+    return data_;
+  }
+
+  uint64_t size() const {
+    return size_;
+  }
+
+  /// Returns the number of bytes of 'this' currently resident in memory.
+  uint64_t residentBytes() const;
+
+ private:
+  const uint64_t size_;
+  int fd_{-1};
+  char* data_{nullptr};
+};
+
+} // namespace facebook::velox::memory
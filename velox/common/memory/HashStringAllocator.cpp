@@ -86,6 +86,7 @@ HashStringAllocator::~HashStringAllocator() {
 }
 
 void HashStringAllocator::clear() {
+  state_.appendTail() = nullptr;
   state_.numFree() = 0;
   state_.freeBytes() = 0;
   std::fill(
@@ -259,8 +260,10 @@ HashStringAllocator::finishWrite(
 
 void HashStringAllocator::newSlab() {
   constexpr int32_t kSimdPadding = simd::kPadding - kHeaderSize;
-  const int64_t needed =
-      state_.pool().allocatedBytes() >= state_.pool().hugePageThreshold()
+  // File backed runs are accounted in huge page increments like large
+  // allocations, so slabs must be huge pages for freeBytes() to be 0 below.
+  const int64_t needed = state_.pool().isFileBacked() ||
+          state_.pool().allocatedBytes() >= state_.pool().hugePageThreshold()
       ? memory::AllocationTraits::kHugePageSize
       : kUnitSize;
   auto* run = state_.pool().allocateFixed(needed);
@@ -380,6 +383,11 @@ HashStringAllocator::Header* HashStringAllocator::allocate(
     return header;
   }
 
+  if (state_.appendOnly()) {
+    if (auto* header = allocateFromTail(size, exactSize)) {
+      return header;
+    }
+  }
   auto* header = allocateFromFreeLists(size, exactSize, exactSize);
   if (header == nullptr) {
     newSlab();
@@ -425,18 +433,76 @@ HashStringAllocator::Header* HashStringAllocator::allocateFromFreeList(
   auto* found = headerOf(item);
   VELOX_CHECK(
       found->isFree() && (!mustHaveSize || found->size() >= preferredSize));
+  takeFree(found);
+  if (isFinalSize) {
+    freeRestOfBlock(found, preferredSize);
+  }
+  return found;
+}
+
+HashStringAllocator::Header* HashStringAllocator::allocateFromTail(
+    int64_t size,
+    bool exactSize) {
+  auto* tail = state_.appendTail();
+  if (tail == nullptr) {
+    return nullptr;
+  }
+  VELOX_DCHECK(tail->isFree());
+  const int32_t roundedBytes = std::max<int64_t>(size, kMinAlloc);
+  if (!exactSize) {
+    // A write takes the whole tail. finishWrite() frees the unused end, which
+    // then becomes the tail again.
+    if (tail->size() < roundedBytes) {
+      return nullptr;
+    }
+    takeFree(tail);
+    return tail;
+  }
+  const auto spaceTaken = roundedBytes + kHeaderSize;
+  if (spaceTaken > tail->size() || tail->size() - spaceTaken <= kMaxAlloc) {
+    return nullptr;
+  }
+  return splitFree(tail, roundedBytes);
+}
+
+void HashStringAllocator::takeFree(Header* header) {
   --state_.numFree();
-  state_.freeBytes() -= blockBytes(found);
-  removeFromFreeList(found);
-  auto* next = found->next();
+  state_.freeBytes() -= blockBytes(header);
+  removeFromFreeList(header);
+  auto* next = header->next();
   if (next != nullptr) {
     next->clearPreviousFree();
   }
-  state_.currentBytes() += blockBytes(found);
-  if (isFinalSize) {
-    freeRestOfBlock(found, preferredSize);
+  state_.currentBytes() += blockBytes(header);
+  if (state_.appendTail() == header) {
+    state_.appendTail() = nullptr;
   }
-  return found;
+}
+
+HashStringAllocator::Header* HashStringAllocator::splitFree(
+    Header* header,
+    int32_t roundedBytes) {
+  const auto spaceTaken = roundedBytes + kHeaderSize;
+  VELOX_DCHECK_GT(header->size() - spaceTaken, kMaxAlloc);
+  auto* previous =
+      reinterpret_cast<CompactDoubleList*>(header->begin())->previous();
+  // The entry after allocation stays in the largest free list.
+  // The size at the end of the block is changed in place.
+  reinterpret_cast<int32_t*>(header->end())[-1] -= spaceTaken;
+  auto* freeHeader = new (header->begin() + roundedBytes)
+      Header(header->size() - spaceTaken);
+  freeHeader->setFree();
+  header->clearFree();
+  ::memcpy(freeHeader->begin(), header->begin(), sizeof(CompactDoubleList));
+  previous->nextMoved(
+      reinterpret_cast<CompactDoubleList*>(freeHeader->begin()));
+  header->setSize(roundedBytes);
+  state_.freeBytes() -= spaceTaken;
+  state_.currentBytes() += spaceTaken;
+  if (state_.appendTail() == header) {
+    state_.appendTail() = freeHeader;
+  }
+  return header;
 }
 
 void HashStringAllocator::free(Header* header) {
@@ -484,6 +550,11 @@ void HashStringAllocator::free(Header* header) {
       state_.freeLists()[freeIndex].insert(
           reinterpret_cast<CompactDoubleList*>(headerToFree->begin()));
       markAsFree(headerToFree);
+      if (state_.appendOnly() && headerToFree->next() == nullptr) {
+        // Appends continue in the free block at the end of an arena. If this
+        // took over the previous tail, the tail is this block now.
+        state_.appendTail() = headerToFree;
+      }
     }
     headerToFree = continued;
   } while (headerToFree != nullptr);
@@ -590,19 +661,7 @@ inline bool HashStringAllocator::storeStringFast(
       return false;
     }
     if (header->size() - spaceTaken > kMaxAlloc) {
-      // The entry after allocation stays in the largest free list.
-      // The size at the end of the block is changed in place.
-      reinterpret_cast<int32_t*>(header->end())[-1] -= spaceTaken;
-      auto* freeHeader = new (header->begin() + roundedBytes)
-          Header(header->size() - spaceTaken);
-      freeHeader->setFree();
-      header->clearFree();
-      ::memcpy(freeHeader->begin(), header->begin(), sizeof(CompactDoubleList));
-      freeList.nextMoved(
-          reinterpret_cast<CompactDoubleList*>(freeHeader->begin()));
-      header->setSize(roundedBytes);
-      state_.freeBytes() -= spaceTaken;
-      state_.currentBytes() += spaceTaken;
+      splitFree(header, roundedBytes);
     } else {
       header =
           allocateFromFreeList(roundedBytes, true, true, kNumFreeLists - 1);
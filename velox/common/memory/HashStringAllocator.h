@@ -313,6 +313,36 @@ class HashStringAllocator : public StreamArena {
   /// Frees all memory associated with 'this' and leaves 'this' ready for reuse.
   void clear() override;
 
+  /// Sets whether allocations bump the free block at the end of the newest
+  /// arena instead of taking the best fitting free block. This suits users
+  /// that append until clear(), e.g. the accumulators of array_agg: their
+  /// allocations are adjacent and skip the free list search. Freed blocks are
+  /// still reused once the arena is full.
+  void setAppendOnly(bool appendOnly) {
+    state_.appendOnly() = appendOnly;
+    if (!appendOnly) {
+      state_.appendTail() = nullptr;
+    }
+  }
+
+  bool isAppendOnly() const {
+    return state_.appendOnly();
+  }
+
+  /// Makes new slabs come from file backed memory under 'directory'. See
+  /// AllocationPool::setFileBackedDirectory(). Blocks larger than a slab are
+  /// still allocated from pool().
+  void setFileBackedDirectory(const std::string& directory) {
+    state_.pool().setFileBackedDirectory(directory);
+  }
+
+  /// Returns the size and the resident size of the file backed slabs.
+  std::pair<int64_t, int64_t> fileBackedBytes() const {
+    return {
+        state_.pool().fileBackedBytes(),
+        state_.pool().residentFileBackedBytes()};
+  }
+
   memory::MemoryPool* pool() const {
     return state_.pool().pool();
   }
@@ -369,6 +399,10 @@ class HashStringAllocator : public StreamArena {
   // be smaller or larger. Checks free list before allocating new memory.
   Header* allocate(int64_t size, bool exactSize);
 
+  // Allocates from 'appendTail' in append-only mode. Returns nullptr if the
+  // tail is not large enough.
+  Header* allocateFromTail(int64_t size, bool exactSize);
+
   // Allocates memory from free list. Returns nullptr if no memory in free list,
   // otherwise returns a header of a free block of some size. if 'mustHaveSize'
   // is true, the block will not be smaller than 'preferredSize'. If
@@ -386,6 +420,15 @@ class HashStringAllocator : public StreamArena {
       bool isFinalSize,
       int32_t freeListIndex);
 
+  // Removes the free block 'header' from its free list and counts it as
+  // allocated.
+  void takeFree(Header* header);
+
+  // Allocates 'roundedBytes' from the start of the free block 'header'. The
+  // rest of 'header' must be larger than kMaxAlloc so that it stays in the
+  // same free list, which is updated in place.
+  Header* splitFree(Header* header, int32_t roundedBytes);
+
   // Sets 'header' to be 'keepBytes' long and adds the remainder of
   // 'header's memory to free list. Does nothing if the resulting
   // blocks would be below minimum size.
@@ -489,6 +532,14 @@ class HashStringAllocator : public StreamArena {
     // Sum of sizes in 'allocationsFromPool_'.
     DECLARE_FIELD_WITH_INIT_VALUE(int64_t, sizeFromPool, 0);
 
+    // True if allocations are bumped from 'appendTail'. See setAppendOnly().
+    DECLARE_FIELD_WITH_INIT_VALUE(bool, appendOnly, false);
+
+    // Free block at the end of an arena that append-only allocations are
+    // taken from. nullptr if not in append-only mode or if there is no such
+    // block.
+    DECLARE_FIELD_WITH_INIT_VALUE(Header*, appendTail, nullptr);
+
 #undef DECLARE_FIELD_WITH_INIT_VALUE
 #undef DECLARE_FIELD
 #undef DECLARE_GETTERS
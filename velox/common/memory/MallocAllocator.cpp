@@ -120,10 +120,12 @@ bool MallocAllocator::allocateContiguousWithoutRetry(
     MachinePageCount numPages,
     Allocation* collateral,
     ContiguousAllocation& allocation,
-    MachinePageCount maxPages) {
+    MachinePageCount maxPages,
+    bool hugePages) {
   bool result;
   stats_.recordAllocate(AllocationTraits::pageBytes(numPages), 1, [&]() {
-    result = allocateContiguousImpl(numPages, collateral, allocation, maxPages);
+    result = allocateContiguousImpl(
+        numPages, collateral, allocation, maxPages, hugePages);
   });
   return result;
 }
@@ -132,7 +134,8 @@ bool MallocAllocator::allocateContiguousImpl(
     MachinePageCount numPages,
     Allocation* collateral,
     ContiguousAllocation& allocation,
-    MachinePageCount maxPages) {
+    MachinePageCount maxPages,
+    bool hugePages) {
   if (maxPages == 0) {
     maxPages = numPages;
   } else {
@@ -173,18 +176,10 @@ bool MallocAllocator::allocateContiguousImpl(
   numAllocated_.fetch_add(numPages);
   numMapped_.fetch_add(numPages);
   numExternalMapped_.fetch_add(numPages);
-  void* data = ::mmap(
-      nullptr,
-      AllocationTraits::pageBytes(maxPages),
-      PROT_READ | PROT_WRITE,
-      MAP_PRIVATE | MAP_ANONYMOUS,
-      -1,
-      0);
-  // TODO: add handling of MAP_FAILED.
-  allocation.set(
-      data,
-      AllocationTraits::pageBytes(numPages),
-      AllocationTraits::pageBytes(maxPages));
+  const auto mapBytes = contiguousMapBytes(maxPages, hugePages);
+  void* data = mmapContiguous(mapBytes, hugePages);
+  // TODO: add handling of mmap failure.
+  allocation.set(data, AllocationTraits::pageBytes(numPages), mapBytes);
   useHugePages(allocation, true);
   return true;
 }
@@ -52,6 +52,7 @@ std::shared_ptr<MemoryAllocator> createAllocator(
     mmapOptions.largestSizeClass = options.largestSizeClassPages;
     mmapOptions.useMmapArena = options.useMmapArena;
     mmapOptions.mmapArenaCapacityRatio = options.mmapArenaCapacityRatio;
+    mmapOptions.numNumaNodes = options.numNumaNodes;
     return std::make_shared<MmapAllocator>(mmapOptions);
   } else {
     return std::make_shared<MallocAllocator>(
@@ -82,6 +83,7 @@ std::shared_ptr<MemoryAllocator> createAllocator(
     mmapOptions.largestSizeClass = options.largestSizeClassPages;
     mmapOptions.useMmapArena = options.useMmapArena;
     mmapOptions.mmapArenaCapacityRatio = options.mmapArenaCapacityRatio;
+    mmapOptions.numNumaNodes = options.numNumaNodes;
     return std::make_shared<MmapAllocator>(mmapOptions);
   } else {
     return std::make_shared<MallocAllocator>(
@@ -169,6 +171,8 @@ MemoryManager::MemoryManager(const MemoryManager::Options& options)
       alignment_(std::max(MemoryAllocator::kMinAlignment, options.alignment)),
       checkUsageLeak_(options.checkUsageLeak),
       coreOnAllocationFailureEnabled_(options.coreOnAllocationFailureEnabled),
+      hugePageThresholdBytes_(options.hugePageThresholdBytes),
+      threadCacheBytes_(options.threadCacheBytes),
       disableMemoryPoolTracking_(options.disableMemoryPoolTracking),
       getPreferredSize_(options.getPreferredSize),
       poolDestructionCb_([&](MemoryPool* pool) { dropPool(pool); }),
@@ -214,6 +218,8 @@ MemoryManager::MemoryManager(const MemoryManagerOptions& options)
       alignment_(std::max(MemoryAllocator::kMinAlignment, options.alignment)),
       checkUsageLeak_(options.checkUsageLeak),
       coreOnAllocationFailureEnabled_(options.coreOnAllocationFailureEnabled),
+      hugePageThresholdBytes_(options.hugePageThresholdBytes),
+      threadCacheBytes_(options.threadCacheBytes),
       disableMemoryPoolTracking_(options.disableMemoryPoolTracking),
       getPreferredSize_(options.getPreferredSize),
       poolDestructionCb_([&](MemoryPool* pool) { dropPool(pool); }),
@@ -388,6 +394,8 @@ std::shared_ptr<MemoryPool> MemoryManager::addRootPool(
   options.maxCapacity = maxCapacity;
   options.trackUsage = true;
   options.coreOnAllocationFailureEnabled = coreOnAllocationFailureEnabled_;
+  options.hugePageThresholdBytes = hugePageThresholdBytes_;
+  options.threadCacheBytes = threadCacheBytes_;
   options.getPreferredSize = getPreferredSize_;
   options.debugOptions = poolDebugOpts;
 
@@ -77,6 +77,16 @@ struct MemoryManagerOptions {
   /// Terminates the process and generates a core file on an allocation failure
   bool coreOnAllocationFailureEnabled{false};
 
+  /// If not zero, contiguous allocations of at least this many bytes from the
+  /// root memory pools and their children are mapped for huge pages, which
+  /// reduces TLB misses on large hash tables.
+  uint64_t hugePageThresholdBytes{0};
+
+  /// If not zero, small allocations from the leaf memory pools of the root
+  /// memory pools take their reservation from per-thread caches refilled in
+  /// chunks of this many bytes. See MemoryPool::Options::threadCacheBytes.
+  uint64_t threadCacheBytes{0};
+
   /// Disables the memory manager's tracking on memory pools.
   bool disableMemoryPoolTracking{false};
 
@@ -108,6 +118,13 @@ struct MemoryManagerOptions {
   /// NOTE: this only applies for MmapAllocator.
   int32_t mmapArenaCapacityRatio{10};
 
+  /// Number of NUMA nodes that get their own size classes. Memory is then
+  /// allocated on the node of the allocating thread. 0 means the number of
+  /// nodes of the machine.
+  ///
+  /// NOTE: this only applies for MmapAllocator.
+  int32_t numNumaNodes{1};
+
   /// If not zero, reserve 'smallAllocationReservePct'% of space from
   /// 'allocatorCapacity' for ad hoc small allocations. And those allocations
   /// are delegated to std::malloc. If 'maxMallocBytes' is 0, this value will be
@@ -194,6 +211,16 @@ class MemoryManager {
     /// failure
     bool coreOnAllocationFailureEnabled{false};
 
+    /// If not zero, contiguous allocations of at least this many bytes from
+    /// the root memory pools and their children are mapped for huge pages,
+    /// which reduces TLB misses on large hash tables.
+    uint64_t hugePageThresholdBytes{0};
+
+    /// If not zero, small allocations from the leaf memory pools of the root
+    /// memory pools take their reservation from per-thread caches refilled in
+    /// chunks of this many bytes. See MemoryPool::Options::threadCacheBytes.
+    uint64_t threadCacheBytes{0};
+
     /// Disables the memory manager's tracking on memory pools.
     bool disableMemoryPoolTracking{false};
 
@@ -225,6 +252,13 @@ class MemoryManager {
     /// NOTE: this only applies for MmapAllocator.
     int32_t mmapArenaCapacityRatio{10};
 
+    /// Number of NUMA nodes that get their own size classes. Memory is then
+    /// allocated on the node of the allocating thread. 0 means the number of
+    /// nodes of the machine.
+    ///
+    /// NOTE: this only applies for MmapAllocator.
+    int32_t numNumaNodes{1};
+
     /// If not zero, reserve 'smallAllocationReservePct'% of space from
     /// 'allocatorCapacity' for ad hoc small allocations. And those allocations
     /// are delegated to std::malloc. If 'maxMallocBytes' is 0, this value will
@@ -431,6 +465,8 @@ class MemoryManager {
   const uint16_t alignment_;
   const bool checkUsageLeak_;
   const bool coreOnAllocationFailureEnabled_;
+  const uint64_t hugePageThresholdBytes_;
+  const uint64_t threadCacheBytes_;
   const bool disableMemoryPoolTracking_;
   const std::function<size_t(size_t)> getPreferredSize_;
 
@@ -237,7 +237,8 @@ bool MemoryAllocator::allocateContiguous(
     Allocation* collateral,
     ContiguousAllocation& allocation,
     ReservationCallback reservationCB,
-    MachinePageCount maxPages) {
+    MachinePageCount maxPages,
+    bool hugePages) {
   const MachinePageCount numCollateralPages =
       allocation.numPages() + (collateral ? collateral->numPages() : 0);
   const uint64_t totalCollateralBytes =
@@ -282,14 +283,14 @@ bool MemoryAllocator::allocateContiguous(
   bool success = false;
   if (cache() == nullptr) {
     success = allocateContiguousWithoutRetry(
-        numPages, collateral, allocation, maxPages);
+        numPages, collateral, allocation, maxPages, hugePages);
   } else {
     success = cache()->makeSpace(
         pagesToAcquire(numPages, numCollateralPages),
         [&](Allocation& acquired) {
           freeNonContiguous(acquired);
           return allocateContiguousWithoutRetry(
-              numPages, collateral, allocation, maxPages);
+              numPages, collateral, allocation, maxPages, hugePages);
         });
   }
 
@@ -373,6 +374,13 @@ Stats Stats::operator-(const Stats& other) const {
     result.sizes[i] = sizes[i] - other.sizes[i];
   }
   result.numAdvise = numAdvise - other.numAdvise;
+  result.numaNodes = numaNodes;
+  if (other.numaNodes.size() == numaNodes.size()) {
+    for (auto i = 0; i < numaNodes.size(); ++i) {
+      result.numaNodes[i] = numaNodes[i] - other.numaNodes[i];
+    }
+  }
+  result.hugePages = hugePages - other.hugePages;
   return result;
 }
 
@@ -411,9 +419,72 @@ std::string Stats::toString() const {
         sizes[i].clocks() >> 20,
         sizes[i].numAllocations);
   }
+  for (auto i = 0; i < numaNodes.size(); ++i) {
+    out << fmt::format(
+        "Node {}: {}MB {} Allocations\n",
+        i,
+        numaNodes[i].totalBytes >> 20,
+        numaNodes[i].numAllocations);
+  }
+  if (hugePages.numAllocations > 0) {
+    out << fmt::format(
+        "Huge pages: {}MB {} Allocations\n",
+        hugePages.totalBytes >> 20,
+        hugePages.numAllocations);
+  }
   return out.str();
 }
 
+// static
+uint64_t MemoryAllocator::contiguousMapBytes(
+    MachinePageCount maxPages,
+    bool hugePages) {
+  const auto bytes = AllocationTraits::pageBytes(maxPages);
+  if (!hugePages || !FLAGS_velox_memory_use_hugepages) {
+    return bytes;
+  }
+  return bits::roundUp(bytes, AllocationTraits::kHugePageSize);
+}
+
+void* MemoryAllocator::mmapContiguous(uint64_t bytes, bool hugePages) {
+  if (!hugePages || !FLAGS_velox_memory_use_hugepages) {
+    void* data = ::mmap(
+        nullptr,
+        bytes,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0);
+    return data == MAP_FAILED ? nullptr : data;
+  }
+  VELOX_CHECK_EQ(bytes % AllocationTraits::kHugePageSize, 0);
+  // Maps an extra huge page and unmaps the unaligned head and tail.
+  const auto mapBytes = bytes + AllocationTraits::kHugePageSize;
+  void* mapped = ::mmap(
+      nullptr,
+      mapBytes,
+      PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS,
+      -1,
+      0);
+  if (mapped == MAP_FAILED) {
+    return nullptr;
+  }
+  auto* begin = static_cast<char*>(mapped);
+  auto* data = reinterpret_cast<char*>(bits::roundUp(
+      reinterpret_cast<uintptr_t>(begin), AllocationTraits::kHugePageSize));
+  if (data > begin) {
+    ::munmap(begin, data - begin);
+  }
+  const auto tailBytes = begin + mapBytes - (data + bytes);
+  if (tailBytes > 0) {
+    ::munmap(data + bytes, tailBytes);
+  }
+  ++stats_.hugePages.numAllocations;
+  stats_.hugePages.totalBytes += bytes;
+  return data;
+}
+
 void MemoryAllocator::useHugePages(
     const ContiguousAllocation& data,
     bool enable) {
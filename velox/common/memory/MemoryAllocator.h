@@ -81,6 +81,58 @@ struct SizeClassStats {
   }
 };
 
+/// Counters of the allocations served from the memory of one NUMA node.
+struct NumaNodeStats {
+  /// Cumulative count of distinct allocations.
+  std::atomic<int64_t> numAllocations{0};
+
+  /// Cumulative count of bytes allocated.
+  std::atomic<int64_t> totalBytes{0};
+
+  NumaNodeStats() = default;
+  NumaNodeStats(const NumaNodeStats& other) {
+    *this = other;
+  }
+
+  void operator=(const NumaNodeStats& other) {
+    numAllocations = static_cast<int64_t>(other.numAllocations);
+    totalBytes = static_cast<int64_t>(other.totalBytes);
+  }
+
+  NumaNodeStats operator-(const NumaNodeStats& other) const {
+    NumaNodeStats result;
+    result.numAllocations = numAllocations - other.numAllocations;
+    result.totalBytes = totalBytes - other.totalBytes;
+    return result;
+  }
+};
+
+/// Counters of the contiguous allocations mapped for huge pages.
+struct HugePageStats {
+  /// Cumulative count of allocations.
+  std::atomic<int64_t> numAllocations{0};
+
+  /// Cumulative count of bytes mapped.
+  std::atomic<int64_t> totalBytes{0};
+
+  HugePageStats() = default;
+  HugePageStats(const HugePageStats& other) {
+    *this = other;
+  }
+
+  void operator=(const HugePageStats& other) {
+    numAllocations = static_cast<int64_t>(other.numAllocations);
+    totalBytes = static_cast<int64_t>(other.totalBytes);
+  }
+
+  HugePageStats operator-(const HugePageStats& other) const {
+    HugePageStats result;
+    result.numAllocations = numAllocations - other.numAllocations;
+    result.totalBytes = totalBytes - other.totalBytes;
+    return result;
+  }
+};
+
 struct Stats {
   /// 20 size classes in powers of 2 are tracked, from 4K to 4G. The
   /// allocation is recorded to the class corresponding to the closest
@@ -136,6 +188,13 @@ struct Stats {
 
   /// Cumulative count of pages advised away, if the allocator exposes this.
   int64_t numAdvise{0};
+
+  /// Counters for each NUMA node if the allocator places memory on the node
+  /// of the allocating thread. Empty otherwise.
+  std::vector<NumaNodeStats> numaNodes;
+
+  /// Counters for the contiguous allocations that requested huge pages.
+  HugePageStats hugePages;
 };
 
 class MemoryAllocator;
@@ -276,12 +335,20 @@ class MemoryAllocator : public std::enable_shared_from_this<MemoryAllocator> {
   /// huge pages without declaring the whole range as held by the query. The
   /// reservation will be increased as and if addresses in the range are used.
   /// See growContiguous().
+  ///
+  /// If 'hugePages' is true, the address range is aligned to the huge page
+  /// size and rounded up to a multiple of it, so that all of it can be backed
+  /// by transparent huge pages instead of only the aligned part inside it.
+  /// This reduces TLB misses on random access to large hash tables. Has no
+  /// effect if FLAGS_velox_memory_use_hugepages is false or the allocation is
+  /// served by ManagedMmapArena.
   bool allocateContiguous(
       MachinePageCount numPages,
       Allocation* collateral,
       ContiguousAllocation& allocation,
       ReservationCallback reservationCB = nullptr,
-      MachinePageCount maxPages = 0);
+      MachinePageCount maxPages = 0,
+      bool hugePages = false);
 
   /// Frees contiguous 'allocation'. 'allocation' is empty on return.
   virtual void freeContiguous(ContiguousAllocation& allocation) = 0;
@@ -439,7 +506,8 @@ class MemoryAllocator : public std::enable_shared_from_this<MemoryAllocator> {
       MachinePageCount numPages,
       Allocation* collateral,
       ContiguousAllocation& allocation,
-      MachinePageCount maxPages = 0) = 0;
+      MachinePageCount maxPages = 0,
+      bool hugePages = false) = 0;
 
   virtual bool allocateNonContiguousWithoutRetry(
       const SizeMix& sizeMix,
@@ -486,6 +554,15 @@ class MemoryAllocator : public std::enable_shared_from_this<MemoryAllocator> {
   // for the address range.
   void useHugePages(const ContiguousAllocation& data, bool enable);
 
+  // Returns the bytes to map for a contiguous allocation of 'maxPages'. See
+  // mmapContiguous().
+  static uint64_t contiguousMapBytes(MachinePageCount maxPages, bool hugePages);
+
+  // Maps 'bytes' of anonymous memory and returns nullptr on failure. If
+  // 'hugePages' is true, the mapping is aligned to the huge page size and
+  // 'bytes' must come from contiguousMapBytes().
+  void* mmapContiguous(uint64_t bytes, bool hugePages);
+
   // The machine page counts corresponding to different sizes in order
   // of increasing size.
   const std::vector<MachinePageCount>
@@ -226,6 +226,19 @@ bool MemoryReclaimer::reclaimableBytes(
   return reclaimable;
 }
 
+void MemoryReclaimer::progress(
+    const MemoryPool& pool,
+    uint64_t& numCompleted,
+    uint64_t& numTotal) const {
+  pool.visitChildren([&](MemoryPool* child) {
+    const auto* reclaimer = child->reclaimer();
+    if (reclaimer != nullptr) {
+      reclaimer->progress(*child, numCompleted, numTotal);
+    }
+    return true;
+  });
+}
+
 uint64_t MemoryReclaimer::reclaim(
     MemoryPool* pool,
     uint64_t targetBytes,
@@ -369,13 +382,15 @@ MemoryArbitrator::Stats::Stats(
 
 std::string MemoryArbitrator::Stats::toString() const {
   return fmt::format(
-      "numRequests {} numRunning {} numSucceded {} numAborted {} numFailures {} numNonReclaimableAttempts {} reclaimedFreeCapacity {} reclaimedUsedCapacity {} maxCapacity {} freeCapacity {} freeReservedCapacity {}",
+      "numRequests {} numRunning {} numSucceded {} numAborted {} numFailures {} numNonReclaimableAttempts {} numSpillVictims {} numAbortVictims {} reclaimedFreeCapacity {} reclaimedUsedCapacity {} maxCapacity {} freeCapacity {} freeReservedCapacity {}",
       numRequests,
       numRunning,
       numSucceeded,
       numAborted,
       numFailures,
       numNonReclaimableAttempts,
+      numSpillVictims,
+      numAbortVictims,
       succinctBytes(reclaimedFreeBytes),
       succinctBytes(reclaimedUsedBytes),
       succinctBytes(maxCapacityBytes),
@@ -397,6 +412,8 @@ MemoryArbitrator::Stats MemoryArbitrator::Stats::operator-(
   result.freeReservedCapacityBytes = freeReservedCapacityBytes;
   result.numNonReclaimableAttempts =
       numNonReclaimableAttempts - other.numNonReclaimableAttempts;
+  result.numSpillVictims = numSpillVictims - other.numSpillVictims;
+  result.numAbortVictims = numAbortVictims - other.numAbortVictims;
   return result;
 }
 
@@ -411,7 +428,9 @@ bool MemoryArbitrator::Stats::operator==(const Stats& other) const {
              maxCapacityBytes,
              freeCapacityBytes,
              freeReservedCapacityBytes,
-             numNonReclaimableAttempts) ==
+             numNonReclaimableAttempts,
+             numSpillVictims,
+             numAbortVictims) ==
       std::tie(
              other.numRequests,
              other.numSucceeded,
@@ -422,7 +441,9 @@ bool MemoryArbitrator::Stats::operator==(const Stats& other) const {
              other.maxCapacityBytes,
              other.freeCapacityBytes,
              other.freeReservedCapacityBytes,
-             other.numNonReclaimableAttempts);
+             other.numNonReclaimableAttempts,
+             other.numSpillVictims,
+             other.numAbortVictims);
 }
 
 bool MemoryArbitrator::Stats::operator!=(const Stats& other) const {
@@ -448,6 +469,8 @@ bool MemoryArbitrator::Stats::operator<(const Stats& other) const {
   UPDATE_COUNTER(reclaimedFreeBytes);
   UPDATE_COUNTER(reclaimedUsedBytes);
   UPDATE_COUNTER(numNonReclaimableAttempts);
+  UPDATE_COUNTER(numSpillVictims);
+  UPDATE_COUNTER(numAbortVictims);
 #undef UPDATE_COUNTER
   VELOX_CHECK(
       !((gtCount > 0) && (ltCount > 0)),
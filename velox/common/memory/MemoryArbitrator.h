@@ -223,6 +223,12 @@ class MemoryArbitrator {
     /// The total number of times of the reclaim attempts that end up failing
     /// due to reclaiming at non-reclaimable stage.
     uint64_t numNonReclaimableAttempts{0};
+    /// The number of participants selected by the victim policy to reclaim
+    /// used memory from by spilling in global arbitration.
+    uint64_t numSpillVictims{0};
+    /// The number of participants selected by the victim policy to abort in
+    /// global arbitration.
+    uint64_t numAbortVictims{0};
 
     Stats(
         uint64_t _numRequests,
@@ -378,6 +384,16 @@ class MemoryReclaimer {
       const MemoryPool& pool,
       uint64_t& reclaimableBytes) const;
 
+  /// Invoked by the memory arbitrator to estimate how far the work using
+  /// 'pool' has progressed, which is used to weigh the cost of reclaiming
+  /// memory from it. Adds the number of completed and total units of work,
+  /// for example drivers of a task, to 'numCompleted' and 'numTotal'. The
+  /// default implementation adds up the progress of the child pools.
+  virtual void progress(
+      const MemoryPool& pool,
+      uint64_t& numCompleted,
+      uint64_t& numTotal) const;
+
   /// Invoked by the memory arbitrator to reclaim from memory 'pool' with
   /// specified 'targetBytes'. It is expected to reclaim at least that amount of
   /// memory bytes but there is no guarantees. If 'targetBytes' is zero, then it
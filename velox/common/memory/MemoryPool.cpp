@@ -17,6 +17,8 @@
 #include "velox/common/memory/MemoryPool.h"
 
 #include <signal.h>
+#include <array>
+#include <map>
 #include <set>
 
 #include "velox/common/base/Counters.h"
@@ -112,13 +114,15 @@ std::vector<MemoryUsage> sortMemoryUsages(MemoryUsageHeap& heap) {
 }
 
 // Invoked by visitChildren() to traverse the memory pool structure to build the
-// memory capacity exceeded exception error message.
+// memory capacity exceeded exception error message. The allocation callsites
+// recorded from the leaf pools in debug mode are appended to 'callsitesOut'.
 void treeMemoryUsageVisitor(
     MemoryPool* pool,
     size_t indent,
     MemoryUsageHeap& topLeafMemUsages,
     bool skipEmptyPool,
-    std::stringstream& out) {
+    std::stringstream& out,
+    std::stringstream& callsitesOut) {
   const MemoryPool::Stats stats = pool->stats();
   // Avoid logging empty pools if 'skipEmptyPool' is true.
   if (stats.empty() && skipEmptyPool) {
@@ -141,11 +145,19 @@ void treeMemoryUsageVisitor(
     if (topLeafMemUsages.size() > kTopNLeafMessages) {
       topLeafMemUsages.pop();
     }
+    static const size_t kTopNCallsites = 5;
+    const auto callsites = pool->debugAllocationCallsites(kTopNCallsites);
+    if (!callsites.empty()) {
+      callsitesOut << "\nTop allocation callsites of " << pool->name()
+                   << ":\n"
+                   << callsites;
+    }
     return;
   }
   pool->visitChildren([&, indent = indent + kCapMessageIndentSize](
                           MemoryPool* pool) {
-    treeMemoryUsageVisitor(pool, indent, topLeafMemUsages, skipEmptyPool, out);
+    treeMemoryUsageVisitor(
+        pool, indent, topLeafMemUsages, skipEmptyPool, out, callsitesOut);
     return true;
   });
 }
@@ -154,6 +166,39 @@ std::string capacityToString(int64_t capacity) {
   return capacity == kMaxMemory ? "UNLIMITED" : succinctBytes(capacity);
 }
 
+// Allocations of at most 1/kThreadCacheAllocationRatio of the chunk size are
+// served from the thread cache.
+constexpr uint64_t kThreadCacheAllocationRatio{16};
+
+// The reservation bytes cached by a thread for the memory pools it allocates
+// from. The least recently added pool is flushed when all entries are in use.
+struct ThreadCache {
+  static constexpr int32_t kMaxPools{8};
+
+  struct Entry {
+    MemoryPoolImpl* pool{nullptr};
+    int64_t bytes{0};
+  };
+
+  // The number of nested ThreadCacheScopes on the thread.
+  int32_t numScopes{0};
+  int32_t numEntries{0};
+  // The next entry to evict when all entries are in use.
+  int32_t nextVictim{0};
+  std::array<Entry, kMaxPools> entries;
+
+  Entry* find(const MemoryPoolImpl* pool) {
+    for (auto i = 0; i < numEntries; ++i) {
+      if (entries[i].pool == pool) {
+        return &entries[i];
+      }
+    }
+    return nullptr;
+  }
+};
+
+thread_local ThreadCache threadCache;
+
 #define DEBUG_RECORD_ALLOC(...)         \
   if (FOLLY_UNLIKELY(debugEnabled())) { \
     recordAllocDbg(__VA_ARGS__);        \
@@ -228,6 +273,8 @@ MemoryPool::MemoryPool(
       threadSafe_(options.threadSafe),
       debugOptions_(options.debugOptions),
       coreOnAllocationFailureEnabled_(options.coreOnAllocationFailureEnabled),
+      hugePageThresholdBytes_(options.hugePageThresholdBytes),
+      threadCacheBytes_(options.threadCacheBytes),
       getPreferredSize_(
           options.getPreferredSize == nullptr
               ? [](size_t size) { return MemoryPool::getPreferredSize(size); }
@@ -451,6 +498,9 @@ MemoryPoolImpl::MemoryPoolImpl(
 }
 
 MemoryPoolImpl::~MemoryPoolImpl() {
+  if (threadCacheBytes_ != 0 && isLeaf()) {
+    flushThreadCacheEntry();
+  }
   DEBUG_LEAK_CHECK();
   if (parent_ != nullptr) {
     toImpl(parent_)->dropChild(this);
@@ -666,7 +716,10 @@ void MemoryPoolImpl::allocateContiguous(
               release(allocBytes);
             }
           },
-          maxPages)) {
+          maxPages,
+          hugePageThresholdBytes_ != 0 &&
+              AllocationTraits::pageBytes(std::max(numPages, maxPages)) >=
+                  hugePageThresholdBytes_)) {
     VELOX_CHECK(out.empty());
     handleAllocationFailure(fmt::format(
         "{} failed with {} pages from {} {}",
@@ -771,6 +824,8 @@ std::shared_ptr<MemoryPool> MemoryPoolImpl::genChild(
           .trackUsage = trackUsage_,
           .threadSafe = threadSafe,
           .coreOnAllocationFailureEnabled = coreOnAllocationFailureEnabled_,
+          .hugePageThresholdBytes = hugePageThresholdBytes_,
+          .threadCacheBytes = threadCacheBytes_,
           .getPreferredSize = getPreferredSize,
           .debugOptions = debugOptions_});
 }
@@ -800,7 +855,9 @@ bool MemoryPoolImpl::maybeReserve(uint64_t increment) {
 void MemoryPoolImpl::reserve(uint64_t size, bool reserveOnly) {
   if (FOLLY_LIKELY(trackUsage_)) {
     if (FOLLY_LIKELY(threadSafe_)) {
-      reserveThreadSafe(size, reserveOnly);
+      if (reserveOnly || !reserveFromThreadCache(size)) {
+        reserveThreadSafe(size, reserveOnly);
+      }
     } else {
       reserveNonThreadSafe(size, reserveOnly);
     }
@@ -854,6 +911,98 @@ void MemoryPoolImpl::reserveThreadSafe(uint64_t size, bool reserveOnly) {
   }
 }
 
+bool MemoryPoolImpl::useThreadCache(uint64_t size) const {
+  return threadCacheBytes_ != 0 &&
+      size <= threadCacheBytes_ / kThreadCacheAllocationRatio &&
+      threadCache.numScopes > 0;
+}
+
+bool MemoryPoolImpl::reserveFromThreadCache(uint64_t size) {
+  if (FOLLY_LIKELY(!useThreadCache(size))) {
+    return false;
+  }
+  auto* entry = threadCache.find(this);
+  if (entry == nullptr || entry->bytes < size) {
+    reserveThreadSafe(threadCacheBytes_);
+    // Looks up the entry again as the memory arbitration might have freed
+    // memory on this thread and changed the cache.
+    entry = threadCache.find(this);
+    if (entry == nullptr) {
+      if (threadCache.numEntries == ThreadCache::kMaxPools) {
+        entry = &threadCache.entries[threadCache.nextVictim];
+        threadCache.nextVictim =
+            (threadCache.nextVictim + 1) % ThreadCache::kMaxPools;
+        if (entry->bytes > 0) {
+          entry->pool->releaseThreadSafe(entry->bytes, false);
+        }
+      } else {
+        entry = &threadCache.entries[threadCache.numEntries++];
+      }
+      *entry = {this, 0};
+    }
+    entry->bytes += threadCacheBytes_;
+  }
+  entry->bytes -= size;
+  return true;
+}
+
+bool MemoryPoolImpl::releaseToThreadCache(uint64_t size) {
+  if (FOLLY_LIKELY(!useThreadCache(size))) {
+    return false;
+  }
+  // Frees of allocations made before this pool entered the cache go to the
+  // pool.
+  auto* entry = threadCache.find(this);
+  if (entry == nullptr) {
+    return false;
+  }
+  entry->bytes += size;
+  if (entry->bytes > 2 * threadCacheBytes_) {
+    releaseThreadSafe(entry->bytes - threadCacheBytes_, false);
+    entry->bytes = threadCacheBytes_;
+  }
+  return true;
+}
+
+void MemoryPoolImpl::flushThreadCacheEntry() {
+  auto* entry = threadCache.find(this);
+  if (entry == nullptr) {
+    return;
+  }
+  if (entry->bytes > 0) {
+    releaseThreadSafe(entry->bytes, false);
+  }
+  *entry = threadCache.entries[--threadCache.numEntries];
+  threadCache.nextVictim = 0;
+}
+
+int64_t MemoryPoolImpl::testingThreadCacheBytes() const {
+  const auto* entry = threadCache.find(this);
+  return entry == nullptr ? 0 : entry->bytes;
+}
+
+// static
+void MemoryPoolImpl::flushThreadCache() {
+  for (auto i = 0; i < threadCache.numEntries; ++i) {
+    auto& entry = threadCache.entries[i];
+    if (entry.bytes > 0) {
+      entry.pool->releaseThreadSafe(entry.bytes, false);
+    }
+  }
+  threadCache.numEntries = 0;
+  threadCache.nextVictim = 0;
+}
+
+ThreadCacheScope::ThreadCacheScope() {
+  ++threadCache.numScopes;
+}
+
+ThreadCacheScope::~ThreadCacheScope() {
+  if (--threadCache.numScopes == 0) {
+    MemoryPoolImpl::flushThreadCache();
+  }
+}
+
 void MemoryPoolImpl::incrementReservationThreadSafe(
     MemoryPool* requestor,
     uint64_t size) {
@@ -934,7 +1083,9 @@ void MemoryPoolImpl::release() {
 void MemoryPoolImpl::release(uint64_t size, bool releaseOnly) {
   if (FOLLY_LIKELY(trackUsage_)) {
     if (FOLLY_LIKELY(threadSafe_)) {
-      releaseThreadSafe(size, releaseOnly);
+      if (releaseOnly || !releaseToThreadCache(size)) {
+        releaseThreadSafe(size, releaseOnly);
+      }
     } else {
       releaseNonThreadSafe(size, releaseOnly);
     }
@@ -1004,8 +1155,10 @@ std::string MemoryPoolImpl::treeMemoryUsage(bool skipEmptyPool) const {
   }
 
   MemoryUsageHeap topLeafMemUsages;
+  std::stringstream callsitesOut;
   visitChildren([&, indent = kCapMessageIndentSize](MemoryPool* pool) {
-    treeMemoryUsageVisitor(pool, indent, topLeafMemUsages, skipEmptyPool, out);
+    treeMemoryUsageVisitor(
+        pool, indent, topLeafMemUsages, skipEmptyPool, out, callsitesOut);
     return true;
   });
 
@@ -1020,7 +1173,7 @@ std::string MemoryPoolImpl::treeMemoryUsage(bool skipEmptyPool) const {
     }
     outTopLeafMemUsages << "\n";
   }
-  return outTopLeafMemUsages.str() + out.str() + "\n";
+  return outTopLeafMemUsages.str() + out.str() + callsitesOut.str() + "\n";
 }
 
 uint64_t MemoryPoolImpl::freeBytes() const {
@@ -1194,8 +1347,13 @@ bool MemoryPoolImpl::needRecordDbg(bool /* isAlloc */) {
   if (debugOptions_->debugPoolNameRegex.empty()) {
     return false;
   }
-  return RE2::FullMatch(name_, debugOptions_->debugPoolNameRegex);
-  // TODO(jtan6): Add sample based condition support.
+  if (!RE2::FullMatch(name_, debugOptions_->debugPoolNameRegex)) {
+    return false;
+  }
+  if (!isAlloc || !sampleAllocDbg()) {
+    return true;
+  }
+  return numDebugAllocs_++ % debugOptions_->allocSampleRate == 0;
 }
 
 void MemoryPoolImpl::recordAllocDbg(const void* addr, uint64_t size) {
@@ -1211,7 +1369,9 @@ void MemoryPoolImpl::recordAllocDbg(const void* addr, uint64_t size) {
 
 void MemoryPoolImpl::recordAllocDbg(const Allocation& allocation) {
   VELOX_CHECK(debugEnabled());
-  if (!needRecordDbg(true) || allocation.empty()) {
+  // NOTE: the sampling decision is left to the buffer overload to make it
+  // once per allocation.
+  if (allocation.empty()) {
     return;
   }
   recordAllocDbg(allocation.runAt(0).data(), allocation.byteSize());
@@ -1219,7 +1379,7 @@ void MemoryPoolImpl::recordAllocDbg(const Allocation& allocation) {
 
 void MemoryPoolImpl::recordAllocDbg(const ContiguousAllocation& allocation) {
   VELOX_CHECK(debugEnabled());
-  if (!needRecordDbg(true) || allocation.empty()) {
+  if (allocation.empty()) {
     return;
   }
   recordAllocDbg(allocation.data(), allocation.size());
@@ -1234,6 +1394,9 @@ void MemoryPoolImpl::recordFreeDbg(const void* addr, uint64_t size) {
   uint64_t addrUint64 = reinterpret_cast<uint64_t>(addr);
   auto allocResult = debugAllocRecords_.find(addrUint64);
   if (allocResult == debugAllocRecords_.end()) {
+    if (sampleAllocDbg()) {
+      return;
+    }
     VELOX_FAIL("Freeing of un-allocated memory. Free address {}.", addrUint64);
   }
   const auto allocRecord = allocResult->second;
@@ -1278,6 +1441,9 @@ void MemoryPoolImpl::recordGrowDbg(const void* addr, uint64_t newSize) {
   uint64_t addrUint64 = reinterpret_cast<uint64_t>(addr);
   auto allocResult = debugAllocRecords_.find(addrUint64);
   if (allocResult == debugAllocRecords_.end()) {
+    if (sampleAllocDbg()) {
+      return;
+    }
     VELOX_FAIL("Growing of un-allocated memory. Free address {}.", addrUint64);
   }
   allocResult->second.size = newSize;
@@ -1324,6 +1490,59 @@ void MemoryPoolImpl::leakCheckDbg() {
   VELOX_FAIL(buf.str());
 }
 
+std::string MemoryPoolImpl::debugAllocationCallsites(
+    size_t maxCallsites) const {
+  if (!debugEnabled() || maxCallsites == 0) {
+    return "";
+  }
+  struct CallsiteStats {
+    const process::StackTrace* callStack{nullptr};
+    uint64_t size{0};
+    uint64_t numAllocations{0};
+  };
+  // NOTE: holds the lock while symbolizing as the reported call stacks are
+  // owned by 'debugAllocRecords_'.
+  std::lock_guard<std::mutex> l(debugAllocMutex_);
+  if (debugAllocRecords_.empty()) {
+    return "";
+  }
+  // Aggregates by the raw call stacks and only symbolizes the reported ones.
+  std::map<std::vector<void*>, CallsiteStats> stackStats;
+  for (const auto& [_, record] : debugAllocRecords_) {
+    auto& stats = stackStats[record.callStack.getStack()];
+    stats.callStack = &record.callStack;
+    stats.size += record.size;
+    ++stats.numAllocations;
+  }
+  std::vector<CallsiteStats> callsites;
+  callsites.reserve(stackStats.size());
+  for (const auto& [_, stats] : stackStats) {
+    callsites.push_back(stats);
+  }
+  std::sort(
+      callsites.begin(),
+      callsites.end(),
+      [](const CallsiteStats& lhs, const CallsiteStats& rhs) {
+        return lhs.size > rhs.size;
+      });
+  if (callsites.size() > maxCallsites) {
+    callsites.resize(maxCallsites);
+  }
+
+  std::stringstream out;
+  const auto sampleRate = debugOptions_->allocSampleRate;
+  for (const auto& callsite : callsites) {
+    out << "======== " << succinctBytes(callsite.size) << " outstanding from "
+        << callsite.numAllocations << " recorded allocations";
+    if (sampleRate > 1) {
+      out << " sampled 1 in " << sampleRate << " (estimated "
+          << succinctBytes(callsite.size * sampleRate) << ")";
+    }
+    out << " ========\n" << callsite.callStack->toString() << "\n";
+  }
+  return out.str();
+}
+
 void MemoryPoolImpl::handleAllocationFailure(
     const std::string& failureMessage) {
   if (coreOnAllocationFailureEnabled_) {
@@ -112,6 +112,13 @@ class MemoryPool : public std::enable_shared_from_this<MemoryPool> {
     /// memory pools whose name matches the specified regular expression. Empty
     /// string means no match for all.
     std::string debugPoolNameRegex;
+
+    /// Records the callsite of one out of every 'allocSampleRate' allocations
+    /// from the matching memory pools. One records all the allocations and
+    /// also validates each free against its recorded allocation. A larger
+    /// rate lowers the cost of attributing the outstanding bytes to callsites
+    /// but can't validate the frees of the allocations not sampled.
+    uint32_t allocSampleRate{1};
   };
 
   struct Options {
@@ -146,6 +153,18 @@ class MemoryPool : public std::enable_shared_from_this<MemoryPool> {
     /// failure
     bool coreOnAllocationFailureEnabled{false};
 
+    /// If not zero, contiguous allocations of at least this many bytes are
+    /// mapped for huge pages. See MemoryAllocator::allocateContiguous(). Set
+    /// at the root memory pool and applies to all its child pools.
+    uint64_t hugePageThresholdBytes{0};
+
+    /// If not zero, small allocations from a thread-safe leaf memory pool take
+    /// their reservation from a per-thread cache which is refilled from the
+    /// pool in chunks of this many bytes. This only applies inside a
+    /// ThreadCacheScope and to allocations of at most 1/16 of the chunk size.
+    /// Set at the root memory pool and applies to all its child pools.
+    uint64_t threadCacheBytes{0};
+
     /// Provides the customized get preferred size function. If not set, uses
     /// the memory pool's default function.
     std::function<size_t(size_t)> getPreferredSize{nullptr};
@@ -460,6 +479,13 @@ class MemoryPool : public std::enable_shared_from_this<MemoryPool> {
   /// with empty memory usage.
   virtual std::string treeMemoryUsage(bool skipEmptyPool = true) const = 0;
 
+  /// Returns up to 'maxCallsites' allocation callsites with the most
+  /// outstanding bytes recorded from this leaf memory pool in debug mode, one
+  /// call stack per callsite. Empty if there is no recorded allocation.
+  virtual std::string debugAllocationCallsites(size_t /*maxCallsites*/) const {
+    return "";
+  }
+
   /// Indicates if this is a leaf memory pool or not.
   FOLLY_ALWAYS_INLINE bool isLeaf() const {
     return kind_ == Kind::kLeaf;
@@ -547,6 +573,8 @@ class MemoryPool : public std::enable_shared_from_this<MemoryPool> {
   const bool threadSafe_;
   const std::optional<DebugOptions> debugOptions_;
   const bool coreOnAllocationFailureEnabled_;
+  const uint64_t hugePageThresholdBytes_;
+  const uint64_t threadCacheBytes_;
   std::function<size_t(size_t)> getPreferredSize_;
 
   /// Indicates if the memory pool has been aborted by the memory arbitrator or
@@ -579,6 +607,21 @@ std::ostream& operator<<(std::ostream& out, MemoryPool::Kind kind);
 
 std::ostream& operator<<(std::ostream& os, const MemoryPool::Stats& stats);
 
+/// Enables the reservation caches of the memory pools with
+/// MemoryPool::Options::threadCacheBytes set on the calling thread for the
+/// lifetime of the scope. A driver holds one while it is on thread so that the
+/// cached reservations are returned to the pools when the driver yields. The
+/// outermost scope flushes the cache on destruction.
+///
+/// NOTE: a pool must not be destroyed while another thread holds cached
+/// reservation from it. The caches of the destroying thread are flushed.
+class ThreadCacheScope {
+ public:
+  ThreadCacheScope();
+
+  ~ThreadCacheScope();
+};
+
 class MemoryPoolImpl : public MemoryPool {
  public:
   /// The callback invoked on the root memory pool destruction. It is set by
@@ -704,6 +747,8 @@ class MemoryPoolImpl : public MemoryPool {
   ///     op.0.0.0.Values usage 0B peak 0B
   std::string treeMemoryUsage(bool skipEmptyPool = true) const override;
 
+  std::string debugAllocationCallsites(size_t maxCallsites) const override;
+
   Stats stats() const override;
 
   void testingSetCapacity(int64_t bytes);
@@ -726,6 +771,13 @@ class MemoryPoolImpl : public MemoryPool {
     return minReservationBytes_;
   }
 
+  /// Returns the cached reservation bytes of the calling thread from this
+  /// pool.
+  int64_t testingThreadCacheBytes() const;
+
+  /// Returns the cached reservations of the calling thread to their pools.
+  static void flushThreadCache();
+
   /// Structure to store allocation details in debug mode.
   struct AllocationRecord {
     uint64_t size;
@@ -825,6 +877,23 @@ class MemoryPoolImpl : public MemoryPool {
 
   void reserveThreadSafe(uint64_t size, bool reserveOnly = false);
 
+  // Returns true if 'threadCacheBytes_' is set, the calling thread is in a
+  // ThreadCacheScope and allocations of 'size' are cached.
+  bool useThreadCache(uint64_t size) const;
+
+  // Takes 'size' bytes from the reservation cached by the calling thread and
+  // refills the cache from this pool in 'threadCacheBytes_' chunks. Returns
+  // false if the calling thread does not cache reservation for 'size'.
+  bool reserveFromThreadCache(uint64_t size);
+
+  // Returns 'size' bytes to the reservation cached by the calling thread and
+  // releases the cached bytes above two chunks to this pool. Returns false if
+  // the calling thread does not cache reservation for 'size'.
+  bool releaseToThreadCache(uint64_t size);
+
+  // Releases the reservation cached by the calling thread from this pool.
+  void flushThreadCacheEntry();
+
   // Increments the reservation and checks against limits at root memory pool.
   // Provokes root memory pool to grow capacity through arbitrator if exceeds
   // capacity. Should be called without holding 'mutex_'. This function throws
@@ -959,9 +1028,16 @@ class MemoryPoolImpl : public MemoryPool {
   // in CPU saturation. Modify this method while debugging to limit the number
   // of times that the allocations are recorded. 'isAlloc' will be true at
   // allocation sites, false at free sites. A good example of this filter would
-  // be based on the 'name_' of the MemoryPool.
+  // be based on the 'name_' of the MemoryPool. Allocations are also sampled by
+  // 'DebugOptions::allocSampleRate'.
   bool needRecordDbg(bool isAlloc);
 
+  // Returns true if only a sample of the allocations is recorded in debug
+  // mode, so a free or grow may not find its allocation.
+  bool sampleAllocDbg() const {
+    return debugOptions_->allocSampleRate > 1;
+  }
+
   // Invoked to record the call stack of a buffer allocation if debug mode of
   // this memory pool is enabled.
   void recordAllocDbg(const void* addr, uint64_t size);
@@ -1060,7 +1136,11 @@ class MemoryPoolImpl : public MemoryPool {
   std::atomic_uint64_t numCapacityGrowths_{0};
 
   // Mutex for 'debugAllocRecords_'.
-  std::mutex debugAllocMutex_;
+  mutable std::mutex debugAllocMutex_;
+
+  // The number of allocations considered for recording in debug mode. Used to
+  // sample one out of every 'DebugOptions::allocSampleRate' of them.
+  std::atomic_uint64_t numDebugAllocs_{0};
 
   // Map from address to 'AllocationRecord'.
   std::unordered_map<uint64_t, AllocationRecord> debugAllocRecords_;
@@ -17,6 +17,13 @@
 #include "velox/common/memory/MmapAllocator.h"
 
 #include <sys/mman.h>
+#include <fstream>
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include "velox/common/base/Counters.h"
 #include "velox/common/base/Portability.h"
@@ -24,6 +31,72 @@
 #include "velox/common/memory/Memory.h"
 
 namespace facebook::velox::memory {
+namespace {
+thread_local std::optional<int32_t> testingThreadNumaNode;
+
+// Returns the number of NUMA nodes of the machine or 1 if this is not known.
+int32_t machineNumaNodes() {
+  std::ifstream in("/sys/devices/system/node/possible");
+  std::string nodes;
+  if (!(in >> nodes)) {
+    return 1;
+  }
+  // The nodes are listed as ranges like 0-1 or 0,2-3 and the last one is the
+  // highest node.
+  const auto lastNode = nodes.find_last_of(",-");
+  try {
+    return std::stoi(
+               lastNode == std::string::npos ? nodes
+                                             : nodes.substr(lastNode + 1)) +
+        1;
+  } catch (const std::exception&) {
+    return 1;
+  }
+}
+
+// Returns the NUMA node of the CPU the calling thread runs on.
+int32_t currentNumaNode() {
+  if (testingThreadNumaNode.has_value()) {
+    return testingThreadNumaNode.value();
+  }
+#ifdef __linux__
+  unsigned cpu;
+  unsigned node;
+  if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return node;
+  }
+#endif
+  return 0;
+}
+
+// Makes the kernel back 'bytes' at 'address' with memory of 'node' when the
+// pages are first touched. Pages that are advised away keep the policy.
+void bindToNumaNode(void* address, size_t bytes, int32_t node) {
+#ifdef __linux__
+  constexpr int32_t kMaxNodes = sizeof(unsigned long) * 8;
+  const unsigned long nodeMask = node < kMaxNodes ? 1UL << node : 0;
+  if (nodeMask == 0 ||
+      ::syscall(
+          SYS_mbind,
+          address,
+          bytes,
+          MPOL_PREFERRED,
+          &nodeMask,
+          kMaxNodes,
+          0) != 0) {
+    VELOX_MEM_LOG_EVERY_MS(WARNING, 1000)
+        << "Could not bind memory to NUMA node " << node << ": "
+        << folly::errnoStr(errno);
+  }
+#endif
+}
+} // namespace
+
+// static
+void MmapAllocator::testingSetThreadNumaNode(std::optional<int32_t> node) {
+  testingThreadNumaNode = node;
+}
+
 MmapAllocator::MmapAllocator(const Options& options)
     : MemoryAllocator(options.largestSizeClass),
       kind_(MemoryAllocator::Kind::kMmap),
@@ -35,9 +108,19 @@ MmapAllocator::MmapAllocator(const Options& options)
               : options.capacity * options.smallAllocationReservePct / 100),
       capacity_(bits::roundUp(
           AllocationTraits::numPages(options.capacity - mallocReservedBytes_),
-          64 * sizeClassSizes_.back())) {
-  for (const auto& size : sizeClassSizes_) {
-    sizeClasses_.push_back(std::make_unique<SizeClass>(capacity_ / size, size));
+          64 * sizeClassSizes_.back())),
+      numNumaNodes_(
+          options.numNumaNodes == 0 ? machineNumaNodes()
+                                    : options.numNumaNodes) {
+  VELOX_CHECK_GT(numNumaNodes_, 0);
+  for (auto node = 0; node < numNumaNodes_; ++node) {
+    for (const auto& size : sizeClassSizes_) {
+      sizeClasses_.push_back(std::make_unique<SizeClass>(
+          capacity_ / size, size, numNumaNodes_ == 1 ? kNoNumaNode : node));
+    }
+  }
+  if (numNumaNodes_ > 1) {
+    stats_.numaNodes.resize(numNumaNodes_);
   }
 
   if (useMmapArena_) {
@@ -91,6 +174,12 @@ bool MmapAllocator::allocateNonContiguousWithoutRetry(
 
   ++numAllocations_;
   numAllocatedPages_ += sizeMix.totalPages;
+  const auto node = allocationNode();
+  if (numNumaNodes_ > 1) {
+    ++stats_.numaNodes[node].numAllocations;
+    stats_.numaNodes[node].totalBytes +=
+        AllocationTraits::pageBytes(sizeMix.totalPages);
+  }
   MachinePageCount newMapsNeeded = 0;
   for (int i = 0; i < sizeMix.numSizes; ++i) {
     bool success;
@@ -98,8 +187,8 @@ bool MmapAllocator::allocateNonContiguousWithoutRetry(
         AllocationTraits::pageBytes(sizeClassSizes_[sizeMix.sizeIndices[i]]),
         sizeMix.sizeCounts[i],
         [&]() {
-          success = sizeClasses_[sizeMix.sizeIndices[i]]->allocate(
-              sizeMix.sizeCounts[i], newMapsNeeded, out);
+          success = sizeClass(node, sizeMix.sizeIndices[i])
+                        .allocate(sizeMix.sizeCounts[i], newMapsNeeded, out);
         });
     if (success && ((i > 0) || (sizeMix.numSizes == 1)) &&
         testingHasInjectedFailure(InjectedFailure::kAllocate)) {
@@ -195,8 +284,8 @@ MachinePageCount MmapAllocator::freeNonContiguousInternal(
       // Increment the free time only if the allocation contained
       // pages in the class. Note that size class indices in the
       // allocator are not necessarily the same as in the stats.
-      const auto sizeIndex =
-          Stats::sizeIndex(AllocationTraits::pageBytes(sizeClassSizes_[i]));
+      const auto sizeIndex = Stats::sizeIndex(AllocationTraits::pageBytes(
+          sizeClassSizes_[i % sizeClassSizes_.size()]));
       stats_.sizes[sizeIndex].freeClocks += clocks;
     }
     numFreed += pages;
@@ -209,10 +298,12 @@ bool MmapAllocator::allocateContiguousWithoutRetry(
     MachinePageCount numPages,
     Allocation* collateral,
     ContiguousAllocation& allocation,
-    MachinePageCount maxPages) {
+    MachinePageCount maxPages,
+    bool hugePages) {
   bool result;
   stats_.recordAllocate(AllocationTraits::pageBytes(numPages), 1, [&]() {
-    result = allocateContiguousImpl(numPages, collateral, allocation, maxPages);
+    result = allocateContiguousImpl(
+        numPages, collateral, allocation, maxPages, hugePages);
   });
   return result;
 }
@@ -221,7 +312,8 @@ bool MmapAllocator::allocateContiguousImpl(
     MachinePageCount numPages,
     Allocation* collateral,
     ContiguousAllocation& allocation,
-    MachinePageCount maxPages) {
+    MachinePageCount maxPages,
+    bool hugePages) {
   if (maxPages == 0) {
     maxPages = numPages;
   } else {
@@ -323,6 +415,7 @@ bool MmapAllocator::allocateContiguousImpl(
   }
 
   void* data;
+  auto mapBytes = AllocationTraits::pageBytes(maxPages);
   if (testingHasInjectedFailure(InjectedFailure::kMmap)) {
     data = nullptr;
   } else {
@@ -330,13 +423,15 @@ bool MmapAllocator::allocateContiguousImpl(
       std::lock_guard<std::mutex> l(arenaMutex_);
       data = managedArenas_->allocate(AllocationTraits::pageBytes(maxPages));
     } else {
-      data = ::mmap(
-          nullptr,
-          AllocationTraits::pageBytes(maxPages),
-          PROT_READ | PROT_WRITE,
-          MAP_PRIVATE | MAP_ANONYMOUS,
-          -1,
-          0);
+      mapBytes = contiguousMapBytes(maxPages, hugePages);
+      data = mmapContiguous(mapBytes, hugePages);
+      if (data != nullptr && numNumaNodes_ > 1) {
+        const auto node = allocationNode();
+        bindToNumaNode(data, mapBytes, node);
+        ++stats_.numaNodes[node].numAllocations;
+        stats_.numaNodes[node].totalBytes +=
+            AllocationTraits::pageBytes(numPages);
+      }
     }
   }
   if (data == nullptr || data == MAP_FAILED) {
@@ -353,10 +448,7 @@ bool MmapAllocator::allocateContiguousImpl(
     rollbackAllocation(numToMap);
     return false;
   }
-  allocation.set(
-      data,
-      AllocationTraits::pageBytes(numPages),
-      AllocationTraits::pageBytes(maxPages));
+  allocation.set(data, AllocationTraits::pageBytes(numPages), mapBytes);
   useHugePages(allocation, true);
   return true;
 }
@@ -499,17 +591,31 @@ void MmapAllocator::markAllMapped(const Allocation& allocation) {
 
 MachinePageCount MmapAllocator::adviseAway(MachinePageCount target) {
   MachinePageCount numAway = 0;
-  for (int32_t i = sizeClasses_.size() - 1; i >= 0; --i) {
-    numAway += sizeClasses_[i]->adviseAway(target - numAway);
-    if (numAway >= target) {
-      break;
+  // Advises away from the largest size classes of all nodes first.
+  for (int32_t i = sizeClassSizes_.size() - 1; i >= 0 && numAway < target;
+       --i) {
+    for (auto node = 0; node < numNumaNodes_; ++node) {
+      numAway += sizeClass(node, i).adviseAway(target - numAway);
+      if (numAway >= target) {
+        break;
+      }
     }
   }
   numAdvisedPages_ += numAway;
   return numAway;
 }
 
-MmapAllocator::SizeClass::SizeClass(size_t capacity, MachinePageCount unitSize)
+int32_t MmapAllocator::allocationNode() const {
+  if (numNumaNodes_ == 1) {
+    return 0;
+  }
+  return currentNumaNode() % numNumaNodes_;
+}
+
+MmapAllocator::SizeClass::SizeClass(
+    size_t capacity,
+    MachinePageCount unitSize,
+    int32_t numaNode)
     : capacity_(capacity),
       unitSize_(unitSize),
       byteSize_(AllocationTraits::pageBytes(capacity_ * unitSize_)),
@@ -538,6 +644,9 @@ MmapAllocator::SizeClass::SizeClass(size_t capacity, MachinePageCount unitSize)
         unitSize_);
   }
   address_ = reinterpret_cast<uint8_t*>(ptr);
+  if (numaNode != kNoNumaNode) {
+    bindToNumaNode(address_, byteSize_, numaNode);
+  }
 }
 
 MmapAllocator::SizeClass::~SizeClass() {
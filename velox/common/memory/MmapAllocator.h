@@ -22,6 +22,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <unordered_set>
 
 #include <folly/ThreadCachedInt.h>
@@ -49,6 +50,12 @@ using ClassPageCount = int32_t;
 /// mmap of the requested size (ContiguousAllocation). Small contiguous memory
 /// allocations less than 3/4 of smallest size class are still delegated to
 /// malloc.
+///
+/// On machines with several NUMA nodes, the allocator can keep a set of size
+/// classes for each node. An allocation is then served from the size classes
+/// of the node of the calling thread and the memory is bound to that node, so
+/// that the thread that allocates and first touches the memory does not
+/// access it across sockets.
 class MmapAllocator : public MemoryAllocator {
  public:
   struct Options {
@@ -80,6 +87,13 @@ class MmapAllocator : public MemoryAllocator {
     /// and 'smallAllocationReservePct' will be automatically set to 0
     /// disregarding any passed in value.
     int32_t maxMallocBytes = 3072;
+
+    /// Number of NUMA nodes with their own size classes. Allocations from the
+    /// size classes and contiguous allocations that are not served by
+    /// ManagedMmapArena are placed on the node of the calling thread. 0 means
+    /// the number of nodes of the machine. Each node reserves address space
+    /// for the whole capacity in each size class.
+    int32_t numNumaNodes = 1;
   };
 
   explicit MmapAllocator(const Options& options);
@@ -159,16 +173,26 @@ class MmapAllocator : public MemoryAllocator {
     return stats;
   }
 
+  int32_t numNumaNodes() const {
+    return numNumaNodes_;
+  }
+
   std::string toString() const override;
 
+  /// Makes the calling thread allocate from the size classes of 'node'
+  /// instead of the node it runs on. std::nullopt restores the default.
+  static void testingSetThreadNumaNode(std::optional<int32_t> node);
+
  private:
   static constexpr uint64_t kAllSet = 0xffffffffffffffff;
+  static constexpr int32_t kNoNumaNode = -1;
 
   // Represents a range of virtual addresses used for allocating entries of
   // 'unitSize_' machine pages.
   class SizeClass {
    public:
-    SizeClass(size_t capacity, MachinePageCount unitSize);
+    // Binds the memory to 'numaNode' unless it is kNoNumaNode.
+    SizeClass(size_t capacity, MachinePageCount unitSize, int32_t numaNode);
 
     ~SizeClass();
 
@@ -326,13 +350,15 @@ class MmapAllocator : public MemoryAllocator {
       MachinePageCount numPages,
       Allocation* collateral,
       ContiguousAllocation& allocation,
-      MachinePageCount maxPages = 0) override;
+      MachinePageCount maxPages = 0,
+      bool hugePages = false) override;
 
   bool allocateContiguousImpl(
       MachinePageCount numPages,
       Allocation* collateral,
       ContiguousAllocation& allocation,
-      MachinePageCount maxPages);
+      MachinePageCount maxPages,
+      bool hugePages);
 
   void freeContiguousImpl(ContiguousAllocation& allocation);
 
@@ -372,6 +398,15 @@ class MmapAllocator : public MemoryAllocator {
 
   bool useMalloc(uint64_t bytes);
 
+  // Returns the NUMA node to allocate from for the calling thread.
+  int32_t allocationNode() const;
+
+  // Returns the size class 'index' of 'numaNode'. The size classes of all
+  // nodes are in 'sizeClasses_' in node order.
+  SizeClass& sizeClass(int32_t numaNode, int32_t index) const {
+    return *sizeClasses_[numaNode * sizeClassSizes_.size() + index];
+  }
+
   const Kind kind_;
 
   // If set true, allocations larger than the largest size class size will be
@@ -400,6 +435,10 @@ class MmapAllocator : public MemoryAllocator {
   // to std::malloc().
   const MachinePageCount capacity_ = 0;
 
+  // Number of NUMA nodes with their own size classes. If 1, the memory is not
+  // bound to any node.
+  const int32_t numNumaNodes_;
+
   std::vector<std::unique_ptr<SizeClass>> sizeClasses_;
 
   // Statistics.
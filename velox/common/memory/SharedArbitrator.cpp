@@ -238,6 +238,14 @@ bool SharedArbitrator::ExtraConfig::globalArbitrationWithoutSpill(
       kDefaultGlobalArbitrationWithoutSpill);
 }
 
+std::string SharedArbitrator::ExtraConfig::globalArbitrationVictimPolicy(
+    const std::unordered_map<std::string, std::string>& configs) {
+  return getConfig<std::string>(
+      configs,
+      kGlobalArbitrationVictimPolicy,
+      std::string(kDefaultGlobalArbitrationVictimPolicy));
+}
+
 double SharedArbitrator::ExtraConfig::globalArbitrationAbortTimeRatio(
     const std::unordered_map<std::string, std::string>& configs) {
   return getConfig<double>(
@@ -274,6 +282,8 @@ SharedArbitrator::SharedArbitrator(const Config& config)
           ExtraConfig::globalArbitrationAbortTimeRatio(config.extraConfigs)),
       globalArbitrationWithoutSpill_(
           ExtraConfig::globalArbitrationWithoutSpill(config.extraConfigs)),
+      victimPolicy_(ArbitrationVictimPolicy::create(
+          ExtraConfig::globalArbitrationVictimPolicy(config.extraConfigs))),
       freeReservedCapacity_(reservedCapacity_),
       freeNonReservedCapacity_(capacity_ - freeReservedCapacity_) {
   VELOX_CHECK_EQ(kind_, config.kind);
@@ -316,7 +326,9 @@ SharedArbitrator::SharedArbitrator(const Config& config)
                         << ", global arbitration abort time ratio "
                         << globalArbitrationAbortTimeRatio_
                         << ", global arbitration skip spill "
-                        << globalArbitrationWithoutSpill_;
+                        << globalArbitrationWithoutSpill_
+                        << ", global arbitration victim policy "
+                        << victimPolicy_->name();
   }
   VELOX_MEM_LOG(INFO) << "Memory pool participant config: "
                       << participantConfig_.toString();
@@ -465,6 +477,7 @@ void SharedArbitrator::finishArbitration(ArbitrationOperation* op) {
     addThreadLocalRuntimeStat(
         kMemoryArbitrationWallNanos,
         RuntimeCounter(stats.executionTimeNs, RuntimeCounter::Unit::kNanos));
+    addThreadLocalLatency(kMemoryArbitrationWallNanos, stats.executionTimeNs);
   }
 
   if (stats.localArbitrationWaitTimeNs != 0) {
@@ -609,25 +622,21 @@ SharedArbitrator::sortAndGroupSpillCandidates(
     }
   }
 
-  // Sort candidates in each group by priority and reclaimable used capacity.
+  // Sort candidates in each group by the victim policy.
   for (auto& candidateGroup : candidateGroups) {
+    for (const auto& candidate : candidateGroup) {
+      if (FOLLY_UNLIKELY(
+              candidate.participant->pool()->reclaimer() == nullptr)) {
+        VELOX_FAIL(
+            "Spill candidates must have memory reclaimer set: '{}'",
+            candidate.participant->name());
+      }
+    }
     std::sort(
         candidateGroup.begin(),
         candidateGroup.end(),
-        [](const ArbitrationCandidate& lhs, const ArbitrationCandidate& rhs) {
-          const auto* lhsReclaimer = lhs.participant->pool()->reclaimer();
-          const auto* rhsReclaimer = rhs.participant->pool()->reclaimer();
-          if (FOLLY_UNLIKELY(
-                  lhsReclaimer == nullptr || rhsReclaimer == nullptr)) {
-            VELOX_FAIL(
-                "Spill candidates must have memory reclaimer set. Left '{}', right '{}'",
-                lhs.participant->name(),
-                rhs.participant->name());
-          }
-          if (lhsReclaimer->priority() == rhsReclaimer->priority()) {
-            return lhs.reclaimableUsedCapacity > rhs.reclaimableUsedCapacity;
-          }
-          return lhsReclaimer->priority() > rhsReclaimer->priority();
+        [&](const ArbitrationCandidate& lhs, const ArbitrationCandidate& rhs) {
+          return victimPolicy_->spillBefore(lhs, rhs);
         });
   }
 
@@ -711,10 +720,11 @@ std::optional<ArbitrationCandidate> SharedArbitrator::findAbortCandidate(
           candidateIdx = i;
           continue;
         }
-        // With the same capacity size bucket, we favor the old participant to
-        // not to be killed, to let long running query proceed first.
-        if (candidateGroup[candidateIdx].participant->id() <
-            candidateGroup[i].participant->id()) {
+        // With the same capacity size bucket, the victim policy decides. The
+        // default policy favors the old participant to not to be killed, to
+        // let long running query proceed first.
+        if (victimPolicy_->abortBefore(
+                candidateGroup[i], candidateGroup[candidateIdx])) {
           candidateIdx = i;
         }
       }
@@ -729,22 +739,23 @@ std::optional<ArbitrationCandidate> SharedArbitrator::findAbortCandidate(
     return std::nullopt;
   }
 
-  // Can't find an eligible abort candidate and then return the youngest
-  // candidate (which has the largest participant id) in the lowest priority
-  // bucket.
+  // Can't find an eligible abort candidate and then return the first
+  // candidate in the victim policy order, which is the youngest one by
+  // default, in the lowest priority bucket.
   VELOX_CHECK(!candidateGroups.empty() && !candidateGroups[0].empty());
   int32_t candidateIdx{0};
   for (auto i = 0; i < candidateGroups[0].size(); ++i) {
-    if (candidateGroups[0][i].participant->id() >
-        candidateGroups[0][candidateIdx].participant->id()) {
+    if (victimPolicy_->abortBefore(
+            candidateGroups[0][i], candidateGroups[0][candidateIdx])) {
       candidateIdx = i;
     }
   }
 
   VELOX_MEM_LOG(WARNING)
-      << "Can't find an eligible abort victim and force to abort the youngest "
+      << "Can't find an eligible abort victim and force to abort the "
          "participant "
-      << candidateGroups[0][candidateIdx].participant->name();
+      << candidateGroups[0][candidateIdx].participant->name()
+      << " selected by victim policy " << victimPolicy_->name();
   return candidateGroups[0][candidateIdx];
 }
 
@@ -1298,6 +1309,7 @@ uint64_t SharedArbitrator::reclaimUsedMemoryBySpill(
 
   RECORD_HISTOGRAM_METRIC_VALUE(
       kMetricArbitratorGlobalArbitrationNumReclaimVictims, victims.size());
+  numSpillVictims_ += victims.size();
 
   struct ReclaimResult {
     uint64_t participantId{0};
@@ -1349,6 +1361,7 @@ uint64_t SharedArbitrator::reclaimUsedMemoryByAbort(bool force) {
     return 0;
   }
   const auto& victim = victimOpt.value();
+  ++numAbortVictims_;
 
   // NOTE: we expect the aborted query will terminate and free up resource soon
   // after abort operation.
@@ -1543,6 +1556,8 @@ MemoryArbitrator::Stats SharedArbitrator::statsLocked() const {
   stats.freeCapacityBytes = freeNonReservedCapacity_ + freeReservedCapacity_;
   stats.freeReservedCapacityBytes = freeReservedCapacity_;
   stats.numNonReclaimableAttempts = numNonReclaimableAttempts_;
+  stats.numSpillVictims = numSpillVictims_;
+  stats.numAbortVictims = numAbortVictims_;
   return stats;
 }
 
@@ -242,6 +242,20 @@ class SharedArbitrator : public memory::MemoryArbitrator {
     static bool globalArbitrationWithoutSpill(
         const std::unordered_map<std::string, std::string>& configs);
 
+    /// The name of the ArbitrationVictimPolicy used by global arbitration to
+    /// order the participants to spill or abort within the capacity buckets
+    /// set by 'memory-pool-spill-capacity-limit' and
+    /// 'memory-pool-abort-capacity-limit'. 'capacity' orders spill candidates
+    /// by reclaimable used capacity and aborts the youngest participant.
+    /// 'cost' also weighs in the progress of the queries, so that queries
+    /// close to finishing are reclaimed from last.
+    static constexpr std::string_view kGlobalArbitrationVictimPolicy{
+        "global-arbitration-victim-policy"};
+    static constexpr std::string_view kDefaultGlobalArbitrationVictimPolicy{
+        ArbitrationVictimPolicy::kCapacity};
+    static std::string globalArbitrationVictimPolicy(
+        const std::unordered_map<std::string, std::string>& configs);
+
     /// If true, do sanity check on the arbitrator state on destruction.
     ///
     /// TODO: deprecate this flag after all the existing memory leak use cases
@@ -499,10 +513,9 @@ class SharedArbitrator : public memory::MemoryArbitrator {
 
   // Sorts and groups 'candidates' for spilling. The sort firstly groups
   // candidates first based on 'globalArbitrationSpillCapacityLimits_', larger
-  // bucket in the front. Then order each group based on priority and
-  // reclaimable used capacity in descending order, with lower priority (higher
-  // priority value) and higher reclaimable used capacity ones in front.
-  // Priority takes precedence over reclaimable used capacity.
+  // bucket in the front. Then order each group with 'victimPolicy_', which by
+  // default puts lower priority (higher priority value) and higher reclaimable
+  // used capacity ones in front.
   std::vector<std::vector<ArbitrationCandidate>> sortAndGroupSpillCandidates(
       std::vector<ArbitrationCandidate>&& candidates);
 
@@ -513,9 +526,11 @@ class SharedArbitrator : public memory::MemoryArbitrator {
   sortAndGroupAbortCandidates(std::vector<ArbitrationCandidate>&& candidates);
 
   // Finds the participant victim to abort to free used memory based on the
-  // participant's memory capacity and age. The function returns std::nullopt if
-  // there is no eligible candidate. If 'force' is true, it picks up the
-  // youngest participant to abort if there is no eligible one.
+  // participant's memory capacity and the order of 'victimPolicy_', which by
+  // default is the age. The function returns std::nullopt if there is no
+  // eligible candidate. If 'force' is true, it picks up the first participant
+  // in the policy order in the lowest priority group if there is no eligible
+  // one.
   std::optional<ArbitrationCandidate> findAbortCandidate(bool force);
 
   // Invoked to use free capacity from arbitrator to grow participant's
@@ -639,6 +654,7 @@ class SharedArbitrator : public memory::MemoryArbitrator {
   const uint32_t globalArbitrationMemoryReclaimPct_;
   const double globalArbitrationAbortTimeRatio_;
   const bool globalArbitrationWithoutSpill_;
+  const std::unique_ptr<ArbitrationVictimPolicy> victimPolicy_;
 
   // The executor used to reclaim memory from multiple participants in parallel
   // at the background for global arbitration or external memory reclamation.
@@ -708,6 +724,8 @@ class SharedArbitrator : public memory::MemoryArbitrator {
   std::atomic_uint64_t reclaimedFreeBytes_{0};
   std::atomic_uint64_t reclaimedUsedBytes_{0};
   std::atomic_uint64_t numNonReclaimableAttempts_{0};
+  std::atomic_uint64_t numSpillVictims_{0};
+  std::atomic_uint64_t numAbortVictims_{0};
 
   friend class GlobalArbitrationSection;
   friend class test::SharedArbitratorTestHelper;
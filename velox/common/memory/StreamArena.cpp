@@ -20,6 +20,9 @@ namespace facebook::velox {
 
 StreamArena::StreamArena(memory::MemoryPool* pool) : pool_(pool) {}
 
+StreamArena::StreamArena(memory::MemoryPool* pool, const Options& options)
+    : pool_(pool), options_(options) {}
+
 void StreamArena::newRange(
     int64_t bytes,
     ByteRange* /*lastRange*/,
@@ -51,6 +54,10 @@ void StreamArena::newRange(
     currentRun_ = 0;
     currentOffset_ = 0;
     size_ += allocation_.byteSize();
+    if (options_.geometricGrowth) {
+      allocationQuantum_ =
+          std::min(allocationQuantum_ * 2, pool_->largestSizeClass());
+    }
   }
   auto run = allocation_.runAt(currentRun_);
   range->buffer = run.data() + currentOffset_;
@@ -67,11 +74,13 @@ void StreamArena::newRange(
 
 void StreamArena::clear() {
   allocations_.clear();
-  pool_->freeNonContiguous(allocation_);
+  if (!options_.retainOnClear) {
+    pool_->freeNonContiguous(allocation_);
+  }
   currentRun_ = 0;
   currentOffset_ = 0;
   largeAllocations_.clear();
-  size_ = 0;
+  size_ = allocation_.byteSize();
 }
 
 } // namespace facebook::velox
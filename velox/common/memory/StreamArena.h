@@ -26,8 +26,23 @@ struct ByteRange;
 /// partition that holds complex types as serialized rows.
 class StreamArena {
  public:
+  struct Options {
+    /// If true, each new non-contiguous allocation is twice the size of the
+    /// previous one, up to the largest size class of the pool. This makes a
+    /// long stream use fewer, larger runs and fewer calls into the pool.
+    bool geometricGrowth{false};
+
+    /// If true, clear() keeps the allocation from which ranges were last
+    /// given out and reuses it after the clear. Used by serializers that are
+    /// flushed and refilled many times so that they do not return and
+    /// reacquire the same memory for each batch.
+    bool retainOnClear{false};
+  };
+
   explicit StreamArena(memory::MemoryPool* pool);
 
+  StreamArena(memory::MemoryPool* pool, const Options& options);
+
   virtual ~StreamArena() = default;
 
   /// Sets range to the request 'bytes' of writable memory owned by
@@ -59,13 +74,20 @@ class StreamArena {
   }
 
   /// Restores 'this' to post-construction state. Used in recycling streams for
-  /// serilizers.
+  /// serilizers. If 'retainOnClear' is set, the last non-contiguous
+  /// allocation stays owned by 'this' and is reused.
   virtual void clear();
 
  private:
+  static constexpr memory::MachinePageCount kMinAllocationQuantum{2};
+
   memory::MemoryPool* const pool_;
 
-  const memory::MachinePageCount allocationQuantum_{2};
+  const Options options_;
+
+  // The minimum number of pages of a new non-contiguous allocation. Grows
+  // with each allocation if 'options_.geometricGrowth' is set.
+  memory::MachinePageCount allocationQuantum_{kMinAllocationQuantum};
 
   // All non-contiguous allocations.
   std::vector<std::unique_ptr<memory::Allocation>> allocations_;
@@ -18,6 +18,7 @@
 #include "velox/common/memory/MallocAllocator.h"
 #include "velox/common/memory/Memory.h"
 #include "velox/common/testutil/TestValue.h"
+#include "velox/exec/tests/utils/TempDirectoryPath.h"
 
 #include <glog/logging.h>
 #include <gtest/gtest.h>
@@ -113,6 +114,52 @@ TEST_F(AllocationPoolTest, hugePages) {
   EXPECT_EQ(0, pool_->usedBytes());
 }
 
+TEST_F(AllocationPoolTest, fileBacked) {
+  auto tempDirectory = exec::test::TempDirectoryPath::create();
+  auto allocationPool = std::make_unique<memory::AllocationPool>(pool_.get());
+  allocationPool->allocateFixed(100);
+  const auto poolBytes = pool_->usedBytes();
+  ASSERT_GT(poolBytes, 0);
+
+  allocationPool->setFileBackedDirectory(tempDirectory->getPath());
+  ASSERT_TRUE(allocationPool->isFileBacked());
+  // The current run is used up before switching to file backed runs.
+  allocationPool->allocateFixed(100);
+  ASSERT_EQ(1, allocationPool->numRanges());
+  ASSERT_EQ(0, allocationPool->fileBackedBytes());
+
+  allocationPool->newRun(1 << 20);
+  ASSERT_EQ(2, allocationPool->numRanges());
+  ASSERT_LE(32 << 20, allocationPool->fileBackedBytes());
+  // Only the first huge page of the file backed run is counted as used.
+  const auto allocatedBytes = allocationPool->allocatedBytes();
+  ASSERT_EQ(
+      allocationPool->testingFreeAddressableBytes(),
+      allocationPool->fileBackedBytes());
+  ASSERT_EQ(
+      memory::AllocationTraits::kHugePageSize, allocationPool->freeBytes());
+
+  // Touch 4MB. The memory counts as used by 'allocationPool' and is resident
+  // but is not taken from 'pool_'.
+  auto* data = allocationPool->allocateFixed(4 << 20);
+  std::memset(data, 1, 4 << 20);
+  ASSERT_EQ(allocatedBytes + (2 << 20), allocationPool->allocatedBytes());
+  ASSERT_LE(4 << 20, allocationPool->residentFileBackedBytes());
+  ASSERT_EQ(poolBytes, pool_->usedBytes());
+  ASSERT_EQ(data, allocationPool->rangeAt(1).data());
+  ASSERT_EQ(4 << 20, allocationPool->rangeAt(1).size());
+
+  // An extra large request gets a region of its own.
+  allocationPool->allocateFixed(64 << 20);
+  ASSERT_EQ(3, allocationPool->numRanges());
+  ASSERT_EQ(64 << 20, allocationPool->rangeAt(2).size());
+
+  allocationPool->clear();
+  ASSERT_EQ(0, allocationPool->numRanges());
+  ASSERT_EQ(0, allocationPool->fileBackedBytes());
+  ASSERT_EQ(0, pool_->usedBytes());
+}
+
 // This test relies on TestValue, so needs to be run in debug mode.
 DEBUG_ONLY_TEST_F(AllocationPoolTest, oomCleanUp) {
   // Test that when an OOM happens while growing an allocation in the
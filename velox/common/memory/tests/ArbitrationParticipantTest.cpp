@@ -1641,6 +1641,59 @@ TEST_F(ArbitrationParticipantTest, arbitrationCandidate) {
       "TaskPool-0 RECLAIMABLE_USED_CAPACITY 1.00MB RECLAIMABLE_FREE_CAPACITY 31.00MB");
 }
 
+TEST_F(ArbitrationParticipantTest, victimPolicy) {
+  auto oldTask = createTask(kMemoryCapacity);
+  auto youngTask = createTask(kMemoryCapacity);
+  const auto config = arbitrationConfig(0, 0, 0.0, 0, 0.0);
+  auto oldParticipant =
+      ArbitrationParticipant::create(10, oldTask->pool(), &config);
+  auto youngParticipant =
+      ArbitrationParticipant::create(11, youngTask->pool(), &config);
+  ArbitrationCandidate oldCandidate(
+      oldParticipant->lock().value(), /*freeCapacityOnly=*/false);
+  ArbitrationCandidate youngCandidate(
+      youngParticipant->lock().value(), /*freeCapacityOnly=*/false);
+  // The mock reclaimers report no progress.
+  ASSERT_EQ(oldCandidate.progress, 0);
+  ASSERT_EQ(oldCandidate.priority, 0);
+
+  // The old query has little reclaimable memory left to spill and is almost
+  // done.
+  oldCandidate.reclaimableUsedCapacity = 64 * MB;
+  oldCandidate.progress = 0.95;
+  oldCandidate.durationNs = 100'000'000'000;
+  youngCandidate.reclaimableUsedCapacity = 48 * MB;
+  youngCandidate.progress = 0.1;
+  youngCandidate.durationNs = 10'000'000'000;
+
+  auto capacityPolicy = ArbitrationVictimPolicy::create("capacity");
+  ASSERT_EQ(capacityPolicy->name(), "capacity");
+  ASSERT_TRUE(capacityPolicy->spillBefore(oldCandidate, youngCandidate));
+  ASSERT_TRUE(capacityPolicy->abortBefore(youngCandidate, oldCandidate));
+
+  auto costPolicy = ArbitrationVictimPolicy::create("cost");
+  ASSERT_EQ(costPolicy->name(), "cost");
+  ASSERT_TRUE(costPolicy->spillBefore(youngCandidate, oldCandidate));
+  ASSERT_FALSE(costPolicy->spillBefore(oldCandidate, youngCandidate));
+  ASSERT_TRUE(costPolicy->abortBefore(youngCandidate, oldCandidate));
+
+  // With equal cost, the younger participant is aborted first.
+  youngCandidate.durationNs = 100'000'000'000;
+  youngCandidate.progress = 0;
+  oldCandidate.progress = 0;
+  ASSERT_TRUE(costPolicy->abortBefore(youngCandidate, oldCandidate));
+  ASSERT_FALSE(costPolicy->abortBefore(oldCandidate, youngCandidate));
+
+  // Priority takes precedence over the cost.
+  oldCandidate.priority = 1;
+  ASSERT_TRUE(costPolicy->spillBefore(oldCandidate, youngCandidate));
+
+  ASSERT_FALSE(ArbitrationVictimPolicy::registerFactory("cost", nullptr));
+  VELOX_ASSERT_THROW(
+      ArbitrationVictimPolicy::create("unknown"),
+      "Arbitration victim policy unknown is not registered");
+}
+
 TEST_F(ArbitrationParticipantTest, arbitrationOperation) {
   auto task = createTask(kMemoryCapacity);
   const auto config = arbitrationConfig(0, 0, 0.0, 0, 0.0);
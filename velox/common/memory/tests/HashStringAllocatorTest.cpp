@@ -202,6 +202,50 @@ TEST_F(HashStringAllocatorTest, allocate) {
   EXPECT_LE(allocator_->retainedSize() - allocator_->freeSpace(), 250);
 }
 
+TEST_F(HashStringAllocatorTest, appendOnly) {
+  allocator_->setAppendOnly(true);
+  ASSERT_TRUE(allocator_->isAppendOnly());
+  for (auto count = 0; count < 2; ++count) {
+    // Allocations are bumped from the end of the arena, so that consecutive
+    // allocations are adjacent.
+    std::vector<HSA::Header*> headers;
+    for (auto i = 0; i < 100; ++i) {
+      headers.push_back(allocate(16 + (i % 5) * 8));
+      if (i > 0) {
+        ASSERT_EQ(headers[i - 1]->next(), headers[i]);
+      }
+    }
+
+    // Writes take the tail and give back what they do not use.
+    ByteOutputStream stream(allocator_.get());
+    auto position = allocator_->newWrite(stream);
+    stream.appendStringView(std::string_view("abcdefghij"));
+    allocator_->finishWrite(stream, 0);
+    ASSERT_EQ(headers.back()->next(), position.header);
+    auto* header = allocate(24);
+    ASSERT_EQ(position.header->next(), header);
+    headers.push_back(header);
+    headers.push_back(position.header);
+    ASSERT_EQ(allocator_->checkConsistency(), allocator_->currentBytes());
+
+    // Freed blocks are merged and the allocator stays consistent.
+    for (auto i = 0; i < headers.size(); i += 3) {
+      allocator_->free(headers[i]);
+    }
+    for (auto i = 0; i < 1'000; ++i) {
+      allocate(100);
+    }
+    ASSERT_EQ(allocator_->checkConsistency(), allocator_->currentBytes());
+    allocator_->clear();
+    ASSERT_TRUE(allocator_->isAppendOnly());
+  }
+
+  allocator_->setAppendOnly(false);
+  ASSERT_FALSE(allocator_->isAppendOnly());
+  allocate(100);
+  ASSERT_EQ(allocator_->checkConsistency(), allocator_->currentBytes());
+}
+
 TEST_F(HashStringAllocatorTest, allocateLarge) {
   // Verify that allocate() can handle sizes larger than the largest class size
   // supported by memory allocators, that is, 256 pages.
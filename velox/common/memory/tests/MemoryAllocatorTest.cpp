@@ -1153,6 +1153,37 @@ TEST_P(MemoryAllocatorTest, allocContiguousGrow) {
   freeSmall(kCapacityPages);
 }
 
+TEST_P(MemoryAllocatorTest, allocContiguousHugePages) {
+  const MachinePageCount hugePagePages =
+      AllocationTraits::numPages(AllocationTraits::kHugePageSize);
+  const auto initialStats = instance_->stats();
+  const auto initialAllocated = instance_->numAllocated();
+  ContiguousAllocation allocation;
+  // The mapping is rounded up to a multiple of the huge page size.
+  const MachinePageCount numPages = hugePagePages + 10;
+  ASSERT_TRUE(instance_->allocateContiguous(
+      numPages, nullptr, allocation, nullptr, 0, true));
+  EXPECT_EQ(
+      reinterpret_cast<uintptr_t>(allocation.data()) %
+          AllocationTraits::kHugePageSize,
+      0);
+  EXPECT_EQ(allocation.size(), AllocationTraits::pageBytes(numPages));
+  EXPECT_EQ(allocation.maxSize(), 2 * AllocationTraits::kHugePageSize);
+  EXPECT_EQ(allocation.hugePageRange()->size(), allocation.maxSize());
+  EXPECT_EQ(instance_->numAllocated() - initialAllocated, numPages);
+  std::memset(allocation.data(), 1, allocation.size());
+
+  const auto stats = instance_->stats() - initialStats;
+  EXPECT_EQ(stats.hugePages.numAllocations, 1);
+  EXPECT_EQ(stats.hugePages.totalBytes, 2 * AllocationTraits::kHugePageSize);
+
+  // The rounded up part of the mapping can be grown into.
+  ASSERT_TRUE(instance_->growContiguous(hugePagePages - 10, allocation));
+  EXPECT_EQ(allocation.size(), allocation.maxSize());
+  instance_->freeContiguous(allocation);
+  EXPECT_EQ(instance_->numAllocated(), initialAllocated);
+}
+
 TEST_P(MemoryAllocatorTest, DISABLED_allocContiguousVsize) {
   // Works with malloc and mmap allocators where MmapArena is not on.
   auto initialSize = processSize();
@@ -1939,6 +1970,48 @@ TEST_P(MemoryAllocatorTest, unmap) {
   }
 }
 
+TEST_P(MemoryAllocatorTest, numaNodes) {
+  if (!useMmap_) {
+    return;
+  }
+  MmapAllocator::Options options;
+  options.capacity = kCapacityBytes;
+  options.numNumaNodes = 2;
+  auto allocator = std::make_shared<MmapAllocator>(options);
+  ASSERT_EQ(allocator->numNumaNodes(), 2);
+  ASSERT_EQ(allocator->stats().numaNodes.size(), 2);
+
+  auto allocateOnNode = [&](int32_t node, Allocation& allocation) {
+    MmapAllocator::testingSetThreadNumaNode(node);
+    ASSERT_TRUE(allocator->allocateNonContiguous(1, allocation));
+    MmapAllocator::testingSetThreadNumaNode(std::nullopt);
+  };
+  Allocation first;
+  allocateOnNode(0, first);
+  auto* firstData = first.runAt(0).data();
+  allocator->freeNonContiguous(first);
+
+  // The page freed on node 0 is not reused for node 1.
+  Allocation second;
+  allocateOnNode(1, second);
+  EXPECT_NE(second.runAt(0).data(), firstData);
+  Allocation third;
+  allocateOnNode(0, third);
+  EXPECT_EQ(third.runAt(0).data(), firstData);
+  ASSERT_TRUE(allocator->checkConsistency());
+
+  const auto stats = allocator->stats();
+  EXPECT_EQ(stats.numaNodes[0].numAllocations, 2);
+  EXPECT_EQ(stats.numaNodes[0].totalBytes, 2 * AllocationTraits::kPageSize);
+  EXPECT_EQ(stats.numaNodes[1].numAllocations, 1);
+  EXPECT_EQ(stats.numaNodes[1].totalBytes, AllocationTraits::kPageSize);
+
+  allocator->freeNonContiguous(second);
+  allocator->freeNonContiguous(third);
+  ASSERT_EQ(allocator->numAllocated(), 0);
+  ASSERT_TRUE(allocator->checkConsistency());
+}
+
 VELOX_INSTANTIATE_TEST_SUITE_P(
     MemoryAllocatorTestSuite,
     MemoryAllocatorTest,
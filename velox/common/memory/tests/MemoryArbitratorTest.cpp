@@ -60,11 +60,13 @@ TEST_F(MemoryArbitrationTest, stats) {
   ASSERT_EQ(
       stats.toString(),
       "numRequests 2 numRunning 0 numSucceded 0 numAborted 3 numFailures 100 numNonReclaimableAttempts 0 "
+      "numSpillVictims 0 numAbortVictims 0 "
       "reclaimedFreeCapacity 95.37MB reclaimedUsedCapacity 9.77KB "
       "maxCapacity 0B freeCapacity 1.95KB freeReservedCapacity 1000B");
   ASSERT_EQ(
       fmt::format("{}", stats),
       "numRequests 2 numRunning 0 numSucceded 0 numAborted 3 numFailures 100 numNonReclaimableAttempts 0 "
+      "numSpillVictims 0 numAbortVictims 0 "
       "reclaimedFreeCapacity 95.37MB reclaimedUsedCapacity 9.77KB "
       "maxCapacity 0B freeCapacity 1.95KB freeReservedCapacity 1000B");
 }
@@ -73,6 +73,7 @@ TEST_P(MemoryCapExceededTest, singleDriver) {
       "capacity 5.00MB.\n"
       "ARBITRATOR[SHARED CAPACITY[6.00GB] STATS[numRequests 1 numRunning 1 "
       "numSucceded 0 numAborted 0 numFailures 0 numNonReclaimableAttempts 0 "
+      "numSpillVictims 0 numAbortVictims 0 "
       "reclaimedFreeCapacity 0B reclaimedUsedCapacity 0B maxCapacity 6.00GB "
       "freeCapacity 5.50GB freeReservedCapacity 0B] CONFIG[kind=SHARED;"
       "capacity=6.00GB;arbitrationStateCheckCb=(set);"
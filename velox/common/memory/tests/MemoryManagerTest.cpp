@@ -124,6 +124,7 @@ TEST_F(MemoryManagerTest, ctor) {
         "capacity 4.00GB allocated bytes 0 allocated pages 0 mapped pages 0]\n"
         "ARBITRATOR[SHARED CAPACITY[4.00GB] STATS[numRequests 0 numRunning 0 "
         "numSucceded 0 numAborted 0 numFailures 0 numNonReclaimableAttempts 0 "
+        "numSpillVictims 0 numAbortVictims 0 "
         "reclaimedFreeCapacity 0B reclaimedUsedCapacity 0B maxCapacity 4.00GB "
         "freeCapacity 4.00GB freeReservedCapacity 0B] "
         "CONFIG[kind=SHARED;capacity=4.00GB;arbitrationStateCheckCb=(unset);]]]");
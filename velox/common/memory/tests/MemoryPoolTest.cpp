@@ -442,6 +442,89 @@ TEST_P(MemoryPoolTest, usedBytes) {
   ASSERT_EQ(root->usedBytes(), 0);
 }
 
+TEST_P(MemoryPoolTest, threadCache) {
+  constexpr int64_t kCacheBytes{64 << 10};
+  MemoryManager::Options options;
+  options.allocatorCapacity = kDefaultCapacity;
+  options.arbitratorCapacity = kDefaultCapacity;
+  options.threadCacheBytes = kCacheBytes;
+  setupMemory(options);
+  auto manager = getMemoryManager();
+  auto root = manager->addRootPool();
+  auto child = root->addLeafChild("threadCache", isLeafThreadSafe_);
+  auto* childImpl = static_cast<MemoryPoolImpl*>(child.get());
+  const int64_t kAllocSize{256};
+
+  // Allocations outside of a scope are not cached.
+  void* buffer = child->allocate(kAllocSize);
+  ASSERT_EQ(child->usedBytes(), kAllocSize);
+  child->free(buffer, kAllocSize);
+  ASSERT_EQ(child->usedBytes(), 0);
+
+  std::vector<void*> buffers;
+  {
+    ThreadCacheScope scope;
+    for (auto i = 0; i < 10; ++i) {
+      buffers.push_back(child->allocate(kAllocSize));
+    }
+    if (isLeafThreadSafe_) {
+      // The reservation is taken from the pool in one chunk.
+      ASSERT_EQ(child->usedBytes(), kCacheBytes);
+      ASSERT_EQ(
+          childImpl->testingThreadCacheBytes(), kCacheBytes - 10 * kAllocSize);
+    } else {
+      ASSERT_EQ(child->usedBytes(), 10 * kAllocSize);
+      ASSERT_EQ(childImpl->testingThreadCacheBytes(), 0);
+    }
+
+    // Large allocations are not cached.
+    void* large = child->allocate(kCacheBytes);
+    child->free(large, kCacheBytes);
+    for (auto i = 0; i < 5; ++i) {
+      child->free(buffers.back(), kAllocSize);
+      buffers.pop_back();
+    }
+    if (isLeafThreadSafe_) {
+      ASSERT_EQ(child->usedBytes(), kCacheBytes);
+      ASSERT_EQ(
+          childImpl->testingThreadCacheBytes(), kCacheBytes - 5 * kAllocSize);
+    }
+
+    // Nested scopes do not flush.
+    { ThreadCacheScope nested; }
+    if (isLeafThreadSafe_) {
+      ASSERT_EQ(child->usedBytes(), kCacheBytes);
+    }
+
+    // Another thread has its own cache.
+    std::thread([&]() {
+      ThreadCacheScope threadScope;
+      void* other = child->allocate(kAllocSize);
+      ASSERT_EQ(
+          childImpl->testingThreadCacheBytes(),
+          isLeafThreadSafe_ ? kCacheBytes - kAllocSize : 0);
+      child->free(other, kAllocSize);
+    }).join();
+  }
+  // The cached reservation is returned on scope exit.
+  ASSERT_EQ(childImpl->testingThreadCacheBytes(), 0);
+  ASSERT_EQ(child->usedBytes(), 5 * kAllocSize);
+  for (auto* buffer : buffers) {
+    child->free(buffer, kAllocSize);
+  }
+  ASSERT_EQ(child->usedBytes(), 0);
+  ASSERT_EQ(root->reservedBytes(), 0);
+
+  // Pool destruction flushes the cache of the destroying thread.
+  {
+    ThreadCacheScope scope;
+    auto other = root->addLeafChild("threadCacheDestroy", isLeafThreadSafe_);
+    other->free(other->allocate(kAllocSize), kAllocSize);
+    other.reset();
+    ASSERT_EQ(root->reservedBytes(), 0);
+  }
+}
+
 TEST_P(MemoryPoolTest, DISABLED_memoryLeakCheck) {
   gflags::FlagSaver flagSaver;
   testing::FLAGS_gtest_death_test_style = "fast";
@@ -2886,6 +2969,58 @@ TEST(MemoryPoolTest, debugModeWithFilter) {
   }
 }
 
+TEST(MemoryPoolTest, debugModeWithSampling) {
+  constexpr int64_t kMaxMemory = 10 * GB;
+  constexpr int32_t kNumAllocs = 100;
+  constexpr uint32_t kSampleRate = 4;
+  MemoryManager::Options options;
+  options.allocatorCapacity = kMaxMemory;
+  MemoryManager manager{options};
+  auto root = manager.addRootPool(
+      "root",
+      kMaxMemory,
+      nullptr,
+      MemoryPool::DebugOptions{
+          .debugPoolNameRegex = ".*", .allocSampleRate = kSampleRate});
+  auto pool = root->addLeafChild("sampledChild");
+  const auto& allocRecords = std::dynamic_pointer_cast<MemoryPoolImpl>(pool)
+                                 ->testingDebugAllocRecords();
+  ASSERT_TRUE(pool->debugAllocationCallsites(5).empty());
+
+  std::vector<void*> buffers;
+  for (int32_t i = 0; i < kNumAllocs; ++i) {
+    buffers.push_back(pool->allocate(1 * KB));
+  }
+  ASSERT_EQ(allocRecords.size(), kNumAllocs / kSampleRate);
+
+  const auto callsites = pool->debugAllocationCallsites(5);
+  ASSERT_THAT(
+      callsites,
+      testing::HasSubstr(
+          "25.00KB outstanding from 25 recorded allocations sampled 1 in 4 "
+          "(estimated 100.00KB)"));
+  ASSERT_TRUE(pool->debugAllocationCallsites(0).empty());
+  ASSERT_THAT(
+      root->treeMemoryUsage(),
+      testing::HasSubstr("Top allocation callsites of sampledChild:\n"));
+
+  // Frees of the allocations not sampled are ignored.
+  for (auto* buffer : buffers) {
+    pool->free(buffer, 1 * KB);
+  }
+  ASSERT_TRUE(allocRecords.empty());
+  ASSERT_TRUE(pool->debugAllocationCallsites(5).empty());
+  ASSERT_THAT(
+      root->treeMemoryUsage(false),
+      testing::Not(testing::HasSubstr("Top allocation callsites")));
+
+  auto nonDebugRoot = manager.addRootPool("nonDebugRoot");
+  auto nonDebugPool = nonDebugRoot->addLeafChild("nonDebugChild");
+  auto* buffer = nonDebugPool->allocate(1 * KB);
+  ASSERT_TRUE(nonDebugPool->debugAllocationCallsites(5).empty());
+  nonDebugPool->free(buffer, 1 * KB);
+}
+
 TEST_P(MemoryPoolTest, shrinkAndGrowAPIs) {
   MemoryManager& manager = *getMemoryManager();
   std::vector<uint64_t> capacities = {kMaxMemory, 128 * MB};
@@ -143,6 +143,52 @@ TEST_F(StreamArenaTest, randomRange) {
   }
 }
 
+TEST_F(StreamArenaTest, geometricGrowth) {
+  const auto pageBytes = AllocationTraits::kPageSize;
+  for (const bool geometricGrowth : {false, true}) {
+    SCOPED_TRACE(fmt::format("geometricGrowth {}", geometricGrowth));
+    StreamArena arena(
+        pool_.get(), StreamArena::Options{.geometricGrowth = geometricGrowth});
+    ByteRange range;
+    // Fill allocations of 2, 4 and 8 pages with growth, 7 allocations of 2
+    // pages without.
+    for (int i = 0; i < 14; ++i) {
+      arena.newRange(pageBytes, nullptr, &range);
+      ASSERT_EQ(range.size, pageBytes);
+    }
+    ASSERT_EQ(arena.size(), 14 * pageBytes);
+    arena.newRange(pageBytes, nullptr, &range);
+    ASSERT_EQ(arena.size(), (geometricGrowth ? 30 : 16) * pageBytes);
+  }
+}
+
+TEST_F(StreamArenaTest, retainOnClear) {
+  StreamArena arena(pool_.get(), StreamArena::Options{.retainOnClear = true});
+  ByteRange range;
+  arena.newRange(100, nullptr, &range);
+  const char* firstBuffer = range.buffer;
+  arena.newRange(
+      2 * pool_->largestSizeClass() * AllocationTraits::kPageSize,
+      nullptr,
+      &range);
+  const auto usedBytes = pool_->usedBytes();
+
+  arena.clear();
+  // The contiguous allocation is freed, the last non-contiguous one is kept.
+  ASSERT_EQ(arena.size(), 2 * AllocationTraits::kPageSize);
+  ASSERT_EQ(pool_->usedBytes(), 2 * AllocationTraits::kPageSize);
+  ASSERT_LT(pool_->usedBytes(), usedBytes);
+
+  arena.newRange(100, nullptr, &range);
+  ASSERT_EQ(range.buffer, firstBuffer);
+  ASSERT_EQ(pool_->usedBytes(), 2 * AllocationTraits::kPageSize);
+
+  StreamArena defaultArena(pool_.get());
+  defaultArena.newRange(100, nullptr, &range);
+  defaultArena.clear();
+  ASSERT_EQ(defaultArena.size(), 0);
+}
+
 TEST_F(StreamArenaTest, error) {
   auto arena = newArena();
   ByteRange range;
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/process/PerfCounters.h"
+
+#include <fmt/format.h>
+#include <memory>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace facebook::velox::process {
+
+std::string PerfCounterValues::toString() const {
+  return fmt::format(
+      "cycles: {}, instructions: {}, llcMisses: {}, dtlbMisses: {}, "
+      "branchMisses: {}",
+      cycles,
+      instructions,
+      llcMisses,
+      dtlbMisses,
+      branchMisses);
+}
+
+// static
+PerfCounters* PerfCounters::forThread() {
+  thread_local std::unique_ptr<PerfCounters> counters = []() {
+    std::unique_ptr<PerfCounters> result(new PerfCounters());
+    if (!result->open()) {
+      result.reset();
+    }
+    return result;
+  }();
+  return counters.get();
+}
+
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+  // Close the group members before the leader.
+  for (auto i = kNumCounters - 1; i >= 0; --i) {
+    if (fds_[i] >= 0) {
+      ::close(fds_[i]);
+    }
+  }
+#endif
+}
+
+bool PerfCounters::open() {
+#ifdef __linux__
+  // The events in the order of the members of PerfCounterValues.
+  const std::pair<uint32_t, uint64_t> events[kNumCounters] = {
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+      {PERF_TYPE_HW_CACHE,
+       PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+           (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+  };
+  for (auto i = 0; i < kNumCounters; ++i) {
+    struct perf_event_attr attr {};
+    attr.size = sizeof(attr);
+    attr.type = events[i].first;
+    attr.config = events[i].second;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    const int32_t fd = ::syscall(
+        __NR_perf_event_open,
+        &attr,
+        0 /*pid*/,
+        -1 /*cpu*/,
+        fds_[0] /*group_fd*/,
+        0 /*flags*/);
+    if (fd < 0) {
+      if (i == 0) {
+        return false;
+      }
+      continue;
+    }
+    fds_[i] = fd;
+    positions_[i] = numOpened_++;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+PerfCounterValues PerfCounters::read() const {
+  PerfCounterValues result;
+#ifdef __linux__
+  // With PERF_FORMAT_GROUP the leader returns the number of counters followed
+  // by their values in the order they were added to the group.
+  uint64_t buffer[1 + kNumCounters] = {};
+  const auto bytes = ::read(fds_[0], buffer, sizeof(buffer));
+  if (bytes < static_cast<ssize_t>(sizeof(uint64_t) * (1 + numOpened_))) {
+    return result;
+  }
+  auto valueAt = [&](int32_t counter) -> uint64_t {
+    return positions_[counter] < 0 ? 0 : buffer[1 + positions_[counter]];
+  };
+  result.cycles = valueAt(0);
+  result.instructions = valueAt(1);
+  result.llcMisses = valueAt(2);
+  result.dtlbMisses = valueAt(3);
+  result.branchMisses = valueAt(4);
+#endif
+  return result;
+}
+
+} // namespace facebook::velox::process
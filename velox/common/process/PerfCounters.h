@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace facebook::velox::process {
+
+/// Hardware event counts of the calling thread as reported by perf_event.
+struct PerfCounterValues {
+  uint64_t cycles{0};
+  uint64_t instructions{0};
+  uint64_t llcMisses{0};
+  uint64_t dtlbMisses{0};
+  uint64_t branchMisses{0};
+
+  void add(const PerfCounterValues& other) {
+    cycles += other.cycles;
+    instructions += other.instructions;
+    llcMisses += other.llcMisses;
+    dtlbMisses += other.dtlbMisses;
+    branchMisses += other.branchMisses;
+  }
+
+  /// Returns the counts accrued between 'start' and 'this'.
+  PerfCounterValues since(const PerfCounterValues& start) const {
+    return PerfCounterValues{
+        cycles - start.cycles,
+        instructions - start.instructions,
+        llcMisses - start.llcMisses,
+        dtlbMisses - start.dtlbMisses,
+        branchMisses - start.branchMisses};
+  }
+
+  std::string toString() const;
+};
+
+/// A group of hardware counters opened for the calling thread. The counters
+/// are opened once per thread on first use and are read together with a
+/// single system call, so that sampling them around an operator call costs
+/// about as much as reading the thread CPU clock. Counters are only available
+/// on Linux and only if the kernel allows perf_event_open for the process,
+/// see /proc/sys/kernel/perf_event_paranoid.
+class PerfCounters {
+ public:
+  /// Returns the counters of the calling thread or nullptr if hardware
+  /// counters are not available. The result is owned by the thread and must
+  /// not be used from other threads.
+  static PerfCounters* forThread();
+
+  ~PerfCounters();
+
+  /// Reads the current counts. Counters that the machine does not support
+  /// read as 0.
+  PerfCounterValues read() const;
+
+ private:
+  PerfCounters() = default;
+
+  // Opens the counters. Returns false if the group leader could not be
+  // opened.
+  bool open();
+
+  static constexpr int32_t kNumCounters = 5;
+
+  // The perf_event file descriptors, -1 for events that could not be opened.
+  // The first one is the group leader.
+  int32_t fds_[kNumCounters] = {-1, -1, -1, -1, -1};
+
+  // The index of each opened counter in the values returned by reading the
+  // group leader, -1 if not opened.
+  int32_t positions_[kNumCounters] = {-1, -1, -1, -1, -1};
+
+  int32_t numOpened_{0};
+};
+
+/// Keeps track of hardware counter deltas from construction time. Does
+/// nothing if counters are not available.
+class DeltaPerfCounterStopWatch {
+ public:
+  DeltaPerfCounterStopWatch()
+      : counters_(PerfCounters::forThread()),
+        start_(counters_ != nullptr ? counters_->read() : PerfCounterValues{}) {
+  }
+
+  /// Returns false if counters are not available on this thread.
+  bool valid() const {
+    return counters_ != nullptr;
+  }
+
+  PerfCounterValues elapsed() const {
+    if (counters_ == nullptr) {
+      return PerfCounterValues{};
+    }
+    return counters_->read().since(start_);
+  }
+
+ private:
+  PerfCounters* const counters_;
+  const PerfCounterValues start_;
+};
+
+} // namespace facebook::velox::process
@@ -17,15 +17,24 @@
 #include "velox/common/process/ProcessBase.h"
 
 #include <limits.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
 #include <stdlib.h>
 #include <time.h>
 #include <unistd.h>
 
+#include <fmt/format.h>
+#include <folly/Conv.h>
 #include <folly/CpuId.h>
 #include <folly/FileUtil.h>
 #include <folly/String.h>
 #include <gflags/gflags.h>
 
+#include <algorithm>
+#include <map>
+#include <thread>
+
 constexpr const char* kProcSelfCmdline = "/proc/self/cmdline";
 
 DECLARE_bool(avx2); // Enables use of AVX2 when available NOLINT
@@ -103,6 +112,132 @@ uint64_t threadCpuNanos() {
   return ts.tv_sec * 1'000'000'000 + ts.tv_nsec;
 }
 
+namespace {
+#ifdef __linux__
+// Parses a CPU list like '0-3,8-11' of sysfs.
+std::vector<int32_t> parseCpuList(const std::string& list) {
+  std::vector<int32_t> cpus;
+  std::vector<folly::StringPiece> ranges;
+  folly::split(',', folly::trimWhitespace(list), ranges, true);
+  for (const auto& range : ranges) {
+    auto dash = range.find('-');
+    const auto first = folly::to<int32_t>(range.subpiece(0, dash));
+    const auto last = dash == folly::StringPiece::npos
+        ? first
+        : folly::to<int32_t>(range.subpiece(dash + 1));
+    for (auto cpu = first; cpu <= last; ++cpu) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+#endif
+} // namespace
+
+std::vector<std::vector<int32_t>> cpuCacheDomains() {
+  std::vector<int32_t> cpus;
+#ifdef __linux__
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+    for (auto cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &allowed)) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+#endif
+  if (cpus.empty()) {
+    const int32_t numCpus = std::thread::hardware_concurrency();
+    for (auto cpu = 0; cpu < std::max(1, numCpus); ++cpu) {
+      cpus.push_back(cpu);
+    }
+    return {cpus};
+  }
+
+#ifdef __linux__
+  // The CPUs that share a cache list the same CPUs for it, index3 being the
+  // L3 cache on common systems.
+  std::map<std::vector<int32_t>, std::vector<int32_t>> cpusByCache;
+  for (auto cpu : cpus) {
+    std::string shared;
+    const auto path = fmt::format(
+        "/sys/devices/system/cpu/cpu{}/cache/index3/shared_cpu_list", cpu);
+    std::vector<int32_t> cacheCpus;
+    try {
+      if (folly::readFile(path.c_str(), shared)) {
+        cacheCpus = parseCpuList(shared);
+      }
+    } catch (const std::exception&) {
+      cacheCpus.clear();
+    }
+    if (cacheCpus.empty()) {
+      return {cpus};
+    }
+    cpusByCache[cacheCpus].push_back(cpu);
+  }
+  std::vector<std::vector<int32_t>> domains;
+  for (auto& [cacheCpus, domainCpus] : cpusByCache) {
+    domains.push_back(std::move(domainCpus));
+  }
+  std::sort(domains.begin(), domains.end());
+  return domains;
+#else
+  return {cpus};
+#endif
+}
+
+std::vector<int32_t> cpuNumaNodes() {
+  std::vector<int32_t> nodes;
+#ifdef __linux__
+  // Node numbers may have gaps, so all possible nodes are probed.
+  constexpr int32_t kMaxNodes = 64;
+  for (auto node = 0; node < kMaxNodes; ++node) {
+    std::string list;
+    const auto path =
+        fmt::format("/sys/devices/system/node/node{}/cpulist", node);
+    std::vector<int32_t> cpus;
+    try {
+      if (!folly::readFile(path.c_str(), list)) {
+        continue;
+      }
+      cpus = parseCpuList(list);
+    } catch (const std::exception&) {
+      continue;
+    }
+    for (auto cpu : cpus) {
+      if (cpu >= nodes.size()) {
+        nodes.resize(cpu + 1, 0);
+      }
+      nodes[cpu] = node;
+    }
+  }
+#endif
+  return nodes;
+}
+
+bool pinThreadToCpu(int32_t cpu) {
+#ifdef __linux__
+  if (cpu < 0 || cpu >= CPU_SETSIZE) {
+    return false;
+  }
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(cpu, &cpus);
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+  return false;
+#endif
+}
+
+int32_t currentCpu() {
+#ifdef __linux__
+  return sched_getcpu();
+#else
+  return -1;
+#endif
+}
+
 namespace {
 bool bmi2CpuFlag = folly::CpuId().bmi2();
 bool avx2CpuFlag = folly::CpuId().avx2();
@@ -42,6 +42,22 @@ std::string getCurrentDirectory();
 /// Returns elapsed CPU nanoseconds on the calling thread
 uint64_t threadCpuNanos();
 
+/// Returns the CPUs the calling thread may run on, grouped by the last level
+/// cache they share, e.g. one group per L3 cache. Returns a single group if
+/// the cache topology is not known.
+std::vector<std::vector<int32_t>> cpuCacheDomains();
+
+/// Returns the NUMA node of each CPU, indexed by CPU number. CPUs past the
+/// end are on node 0. Returns an empty vector if the topology is not known.
+std::vector<int32_t> cpuNumaNodes();
+
+/// Binds the calling thread to 'cpu'. Returns false if binding threads is not
+/// supported or fails.
+bool pinThreadToCpu(int32_t cpu);
+
+/// Returns the CPU the calling thread runs on or -1 if not known.
+int32_t currentCpu();
+
 /// True if the machine has Intel AVX2 instructions and these are not disabled
 /// by flag.
 bool hasAvx2();
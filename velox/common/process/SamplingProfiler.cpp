@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/process/SamplingProfiler.h"
+
+#include <fmt/format.h>
+#include <folly/experimental/symbolizer/StackTrace.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <signal.h>
+#include <sys/time.h>
+#endif
+
+#include "velox/common/process/StackTrace.h"
+
+namespace facebook::velox::process {
+namespace {
+
+constexpr int32_t kMaxFrames = 64;
+
+// Frames of the signal handler and the signal trampoline on top of the
+// interrupted stack.
+constexpr int32_t kSkipFrames = 2;
+
+// Samples held between two drains by the collector thread.
+constexpr int32_t kBufferCapacity = 2048;
+
+constexpr auto kDrainInterval = std::chrono::milliseconds(100);
+
+struct Sample {
+  std::atomic<bool> ready{false};
+  uint32_t labelId{0};
+  int32_t numFrames{0};
+  uintptr_t frames[kMaxFrames + kSkipFrames];
+};
+
+// Samples are appended to the active buffer by the signal handler. The
+// collector switches the handlers to the other buffer and waits for the
+// handlers still writing to the previous one before reading it.
+struct SampleBuffer {
+  std::atomic<int32_t> next{0};
+  std::atomic<int32_t> inFlight{0};
+  Sample samples[kBufferCapacity];
+};
+
+using StackCounts = std::map<std::vector<uintptr_t>, uint64_t>;
+
+struct ProfilerState {
+  SampleBuffer buffers[2];
+  std::atomic<SampleBuffer*> activeBuffer{&buffers[0]};
+  std::atomic<uint64_t> numDropped{0};
+
+  // Serializes start() and stop().
+  std::mutex startStopMutex;
+  bool handlerInstalled{false};
+  std::thread collector;
+  std::condition_variable collectorCv;
+  bool stopCollector{false};
+
+  // Guards the members below.
+  std::mutex mutex;
+  std::vector<std::string> labels{""};
+  std::unordered_map<std::string, uint32_t> labelIds{{"", 0}};
+  std::unordered_map<uint32_t, StackCounts> stacks;
+};
+
+// Kept outside of ProfilerState so that checking it does not allocate the
+// sample buffers.
+std::atomic<bool> profilerRunning{false};
+
+// Never destroyed since the signal handler may run during process exit.
+ProfilerState& profilerState() {
+  static auto* state = new ProfilerState();
+  return *state;
+}
+
+struct ThreadSampleState {
+  uint32_t labelId{0};
+  uint64_t numSamples{0};
+};
+
+thread_local ThreadSampleState threadSampleState;
+
+#ifdef __linux__
+void sampleHandler(int /*signal*/) {
+  const auto savedErrno = errno;
+  if (!profilerRunning.load()) {
+    errno = savedErrno;
+    return;
+  }
+  auto& state = profilerState();
+  ++threadSampleState.numSamples;
+  auto* buffer = state.activeBuffer.load();
+  buffer->inFlight.fetch_add(1);
+  // The collector may have switched buffers between loading 'buffer' and
+  // registering with it. Drop the sample rather than write to a buffer that
+  // is being read.
+  if (state.activeBuffer.load() != buffer) {
+    buffer->inFlight.fetch_sub(1);
+    state.numDropped.fetch_add(1);
+    errno = savedErrno;
+    return;
+  }
+  const auto index = buffer->next.fetch_add(1);
+  if (index < kBufferCapacity) {
+    auto& sample = buffer->samples[index];
+    sample.labelId = threadSampleState.labelId;
+    sample.numFrames = folly::symbolizer::getStackTraceSafe(
+        sample.frames, kMaxFrames + kSkipFrames);
+    sample.ready.store(true, std::memory_order_release);
+  } else {
+    state.numDropped.fetch_add(1);
+  }
+  buffer->inFlight.fetch_sub(1);
+  errno = savedErrno;
+}
+
+void setTimer(int32_t intervalUs) {
+  struct itimerval timer {};
+  timer.it_interval.tv_sec = intervalUs / 1'000'000;
+  timer.it_interval.tv_usec = intervalUs % 1'000'000;
+  timer.it_value = timer.it_interval;
+  setitimer(ITIMER_PROF, &timer, nullptr);
+}
+#endif
+
+// Moves the samples of the active buffer into 'state.stacks'. Must be called
+// with 'state.mutex' held.
+void drainLocked(ProfilerState& state) {
+  auto* buffer = state.activeBuffer.load();
+  state.activeBuffer.store(
+      buffer == &state.buffers[0] ? &state.buffers[1] : &state.buffers[0]);
+  while (buffer->inFlight.load() > 0) {
+    std::this_thread::yield();
+  }
+  const auto numSamples = std::min(buffer->next.load(), kBufferCapacity);
+  for (auto i = 0; i < numSamples; ++i) {
+    auto& sample = buffer->samples[i];
+    if (!sample.ready.load(std::memory_order_acquire)) {
+      continue;
+    }
+    std::vector<uintptr_t> frames;
+    if (sample.numFrames > kSkipFrames) {
+      frames.assign(
+          sample.frames + kSkipFrames, sample.frames + sample.numFrames);
+    }
+    ++state.stacks[sample.labelId][std::move(frames)];
+    sample.ready.store(false, std::memory_order_relaxed);
+  }
+  buffer->next.store(0);
+}
+
+void collectorLoop(ProfilerState& state) {
+  std::unique_lock<std::mutex> l(state.startStopMutex);
+  while (!state.stopCollector) {
+    state.collectorCv.wait_for(l, kDrainInterval);
+    std::lock_guard<std::mutex> stacksLock(state.mutex);
+    drainLocked(state);
+  }
+}
+
+std::string frameName(
+    uintptr_t address,
+    std::unordered_map<uintptr_t, std::string>& cache) {
+  auto it = cache.find(address);
+  if (it != cache.end()) {
+    return it->second;
+  }
+  auto name = StackTrace::translateFrame(reinterpret_cast<void*>(address));
+  if (name.empty()) {
+    name = fmt::format("{:#x}", address);
+  }
+  // ';' separates frames in the folded format.
+  std::replace(name.begin(), name.end(), ';', ',');
+  cache.emplace(address, name);
+  return name;
+}
+
+} // namespace
+
+// static
+bool SamplingProfiler::start(int32_t intervalUs) {
+#ifdef __linux__
+  auto& state = profilerState();
+  std::lock_guard<std::mutex> l(state.startStopMutex);
+  if (profilerRunning.load() || intervalUs <= 0) {
+    return false;
+  }
+  if (!state.handlerInstalled) {
+    // The handler stays installed after stop() since a SIGPROF that is
+    // already pending would otherwise terminate the process.
+    struct sigaction action {};
+    action.sa_handler = sampleHandler;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGPROF, &action, nullptr) != 0) {
+      return false;
+    }
+    state.handlerInstalled = true;
+  }
+  state.stopCollector = false;
+  profilerRunning.store(true);
+  state.collector = std::thread([&state]() { collectorLoop(state); });
+  setTimer(intervalUs);
+  return true;
+#else
+  static_cast<void>(intervalUs);
+  return false;
+#endif
+}
+
+// static
+void SamplingProfiler::stop() {
+#ifdef __linux__
+  auto& state = profilerState();
+  std::thread collector;
+  {
+    std::lock_guard<std::mutex> l(state.startStopMutex);
+    if (!profilerRunning.load()) {
+      return;
+    }
+    setTimer(0);
+    profilerRunning.store(false);
+    state.stopCollector = true;
+    collector = std::move(state.collector);
+  }
+  state.collectorCv.notify_all();
+  collector.join();
+  std::lock_guard<std::mutex> l(state.mutex);
+  drainLocked(state);
+#endif
+}
+
+// static
+bool SamplingProfiler::isRunning() {
+  return profilerRunning.load(std::memory_order_relaxed);
+}
+
+// static
+uint32_t SamplingProfiler::labelId(const std::string& label) {
+  auto& state = profilerState();
+  std::lock_guard<std::mutex> l(state.mutex);
+  auto it = state.labelIds.find(label);
+  if (it != state.labelIds.end()) {
+    return it->second;
+  }
+  const uint32_t id = state.labels.size();
+  state.labels.push_back(label);
+  state.labelIds.emplace(label, id);
+  return id;
+}
+
+// static
+std::unordered_map<std::string, std::string> SamplingProfiler::foldedStacks() {
+  auto& state = profilerState();
+  std::lock_guard<std::mutex> l(state.mutex);
+  drainLocked(state);
+  std::unordered_map<uintptr_t, std::string> names;
+  std::unordered_map<std::string, std::string> result;
+  for (const auto& [labelId, stacks] : state.stacks) {
+    auto& folded = result[state.labels[labelId]];
+    for (const auto& [frames, count] : stacks) {
+      // The stacks are captured innermost frame first.
+      for (auto i = static_cast<int32_t>(frames.size()) - 1; i >= 0; --i) {
+        folded += frameName(frames[i], names);
+        if (i > 0) {
+          folded += ';';
+        }
+      }
+      folded += fmt::format(" {}\n", count);
+    }
+  }
+  return result;
+}
+
+// static
+std::unordered_map<std::string, uint64_t> SamplingProfiler::sampleCounts() {
+  auto& state = profilerState();
+  std::lock_guard<std::mutex> l(state.mutex);
+  drainLocked(state);
+  std::unordered_map<std::string, uint64_t> result;
+  for (const auto& [labelId, stacks] : state.stacks) {
+    auto& total = result[state.labels[labelId]];
+    for (const auto& [frames, count] : stacks) {
+      total += count;
+    }
+  }
+  return result;
+}
+
+// static
+uint64_t SamplingProfiler::numDroppedSamples() {
+  return profilerState().numDropped.load();
+}
+
+// static
+void SamplingProfiler::clear() {
+  auto& state = profilerState();
+  std::lock_guard<std::mutex> l(state.mutex);
+  drainLocked(state);
+  state.stacks.clear();
+  state.numDropped = 0;
+}
+
+// static
+uint64_t SamplingProfiler::threadSampleCount() {
+  return threadSampleState.numSamples;
+}
+
+ScopedSampleLabel::ScopedSampleLabel(uint32_t labelId)
+    : previousLabelId_(threadSampleState.labelId) {
+  threadSampleState.labelId = labelId;
+}
+
+ScopedSampleLabel::~ScopedSampleLabel() {
+  threadSampleState.labelId = previousLabelId_;
+}
+
+} // namespace facebook::velox::process
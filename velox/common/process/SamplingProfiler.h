@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace facebook::velox::process {
+
+/// In-process CPU sampling profiler. While running, every thread of the
+/// process is interrupted with SIGPROF each 'intervalUs' of CPU time it
+/// consumes and the interrupted stack is recorded together with the label
+/// that the thread has set with ScopedSampleLabel. Drivers label their
+/// threads with the task, pipeline and plan node of the running operator, so
+/// the samples can be shown as a flame graph per plan node.
+///
+/// The signal handler only captures frame addresses into a preallocated
+/// buffer. A background thread drains the buffer periodically and aggregates
+/// the stacks per label. Symbolization happens when the stacks are exported.
+class SamplingProfiler {
+ public:
+  /// Starts sampling. Returns false if the profiler is already running or
+  /// sampling is not supported on this platform.
+  static bool start(int32_t intervalUs = 10'000);
+
+  /// Stops sampling and aggregates the pending samples. The aggregated stacks
+  /// are kept until clear().
+  static void stop();
+
+  static bool isRunning();
+
+  /// Returns the id of 'label' for use with ScopedSampleLabel. Labels are
+  /// interned for the lifetime of the process. Id 0 is reserved for samples
+  /// taken without a label.
+  static uint32_t labelId(const std::string& label);
+
+  /// Returns the aggregated samples per label in the folded stack format used
+  /// by flamegraph.pl: one line per distinct stack with the frames from the
+  /// outermost to the innermost separated by ';' followed by a space and the
+  /// number of samples. Samples without a label are under the empty label.
+  static std::unordered_map<std::string, std::string> foldedStacks();
+
+  /// Returns the number of samples per label.
+  static std::unordered_map<std::string, uint64_t> sampleCounts();
+
+  /// Returns the number of samples dropped because the sample buffer was full
+  /// when the signal arrived.
+  static uint64_t numDroppedSamples();
+
+  /// Clears the aggregated samples.
+  static void clear();
+
+  /// Returns the number of samples taken on the calling thread since it
+  /// started. Used to attribute sample counts to the code that runs between
+  /// two calls.
+  static uint64_t threadSampleCount();
+};
+
+/// Sets the label of the calling thread for the profile samples taken while
+/// in scope and restores the previous label on destruction.
+class ScopedSampleLabel {
+ public:
+  explicit ScopedSampleLabel(uint32_t labelId);
+
+  ~ScopedSampleLabel();
+
+ private:
+  const uint32_t previousLabelId_;
+};
+
+} // namespace facebook::velox::process
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/process/PerfCounters.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace facebook::velox::process {
+namespace {
+
+TEST(PerfCountersTest, basic) {
+  auto* counters = PerfCounters::forThread();
+  ASSERT_EQ(counters, PerfCounters::forThread());
+  if (counters == nullptr) {
+    DeltaPerfCounterStopWatch watch;
+    ASSERT_FALSE(watch.valid());
+    ASSERT_EQ(watch.elapsed().cycles, 0);
+    GTEST_SKIP() << "Hardware counters are not available";
+  }
+
+  DeltaPerfCounterStopWatch watch;
+  ASSERT_TRUE(watch.valid());
+  uint64_t sum = 0;
+  for (uint64_t i = 0; i < 1'000'000; ++i) {
+    sum += i * i;
+    asm volatile("" : "+r"(sum));
+  }
+  const auto delta = watch.elapsed();
+  ASSERT_GT(delta.instructions, 1'000'000) << delta.toString();
+  ASSERT_GT(delta.cycles, 0) << delta.toString();
+
+  PerfCounters* otherCounters;
+  std::thread([&]() { otherCounters = PerfCounters::forThread(); }).join();
+  ASSERT_NE(otherCounters, counters);
+}
+
+TEST(PerfCountersTest, values) {
+  PerfCounterValues start{1, 2, 3, 4, 5};
+  PerfCounterValues end{11, 22, 33, 44, 55};
+  auto delta = end.since(start);
+  ASSERT_EQ(delta.cycles, 10);
+  ASSERT_EQ(delta.instructions, 20);
+  ASSERT_EQ(delta.llcMisses, 30);
+  ASSERT_EQ(delta.dtlbMisses, 40);
+  ASSERT_EQ(delta.branchMisses, 50);
+  delta.add(start);
+  ASSERT_EQ(delta.branchMisses, 55);
+  ASSERT_EQ(
+      delta.toString(),
+      "cycles: 11, instructions: 22, llcMisses: 33, dtlbMisses: 44, "
+      "branchMisses: 55");
+}
+
+} // namespace
+} // namespace facebook::velox::process
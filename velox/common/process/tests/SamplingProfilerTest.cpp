@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/process/SamplingProfiler.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+namespace facebook::velox::process {
+namespace {
+
+// Burns CPU on the calling thread for 'millis' of wall time.
+void spin(int32_t millis) {
+  const auto start = std::chrono::steady_clock::now();
+  uint64_t sum = 0;
+  while (std::chrono::steady_clock::now() - start <
+         std::chrono::milliseconds(millis)) {
+    sum = sum * 3 + 1;
+    asm volatile("" : "+r"(sum));
+  }
+}
+
+TEST(SamplingProfilerTest, labels) {
+  const auto label = "task/0/1:HashProbe";
+  ASSERT_EQ(SamplingProfiler::labelId(label), SamplingProfiler::labelId(label));
+  ASSERT_NE(
+      SamplingProfiler::labelId(label), SamplingProfiler::labelId("other"));
+
+  SamplingProfiler::clear();
+  if (!SamplingProfiler::start(1'000)) {
+    GTEST_SKIP() << "Sampling is not supported";
+  }
+  ASSERT_TRUE(SamplingProfiler::isRunning());
+  ASSERT_FALSE(SamplingProfiler::start(1'000));
+
+  const auto numSamplesBefore = SamplingProfiler::threadSampleCount();
+  {
+    ScopedSampleLabel scopedLabel(SamplingProfiler::labelId(label));
+    spin(200);
+  }
+  const auto numLabeledSamples =
+      SamplingProfiler::threadSampleCount() - numSamplesBefore;
+  SamplingProfiler::stop();
+  ASSERT_FALSE(SamplingProfiler::isRunning());
+  ASSERT_GT(numLabeledSamples, 0);
+
+  const auto counts = SamplingProfiler::sampleCounts();
+  ASSERT_EQ(counts.count(label), 1);
+  // Samples that arrive while the buffer is full are counted for the thread
+  // but dropped from the profile.
+  ASSERT_GT(counts.at(label), 0);
+  ASSERT_LE(counts.at(label), numLabeledSamples);
+
+  const auto folded = SamplingProfiler::foldedStacks();
+  ASSERT_EQ(folded.count(label), 1);
+  ASSERT_FALSE(folded.at(label).empty());
+  ASSERT_EQ(folded.at(label).back(), '\n');
+
+  SamplingProfiler::clear();
+  ASSERT_TRUE(SamplingProfiler::sampleCounts().empty());
+}
+
+} // namespace
+} // namespace facebook::velox::process
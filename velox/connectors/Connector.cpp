@@ -16,6 +16,12 @@
 
 #include "velox/connectors/Connector.h"
 
+#include <gflags/gflags.h>
+
+#include "velox/common/caching/ScanHistory.h"
+
+DECLARE_bool(velox_cache_scan_history);
+
 namespace facebook::velox::connector {
 namespace {
 std::unordered_map<std::string, std::shared_ptr<ConnectorFactory>>&
@@ -29,6 +35,11 @@ std::unordered_map<std::string, std::shared_ptr<Connector>>& connectors() {
   static std::unordered_map<std::string, std::shared_ptr<Connector>> connectors;
   return connectors;
 }
+
+cache::ScanHistory* scanHistory() {
+  return FLAGS_velox_cache_scan_history ? cache::ScanHistory::instance()
+                                        : nullptr;
+}
 } // namespace
 
 bool DataSink::Stats::empty() const {
@@ -116,14 +127,14 @@ std::shared_ptr<cache::ScanTracker> Connector::getTracker(
     auto it = trackers.find(scanId);
     if (it == trackers.end()) {
       auto newTracker = std::make_shared<cache::ScanTracker>(
-          scanId, unregisterTracker, loadQuantum);
+          scanId, unregisterTracker, loadQuantum, nullptr, scanHistory());
       trackers[newTracker->id()] = newTracker;
       return newTracker;
     }
     std::shared_ptr<cache::ScanTracker> tracker = it->second.lock();
     if (!tracker) {
       tracker = std::make_shared<cache::ScanTracker>(
-          scanId, unregisterTracker, loadQuantum);
+          scanId, unregisterTracker, loadQuantum, nullptr, scanHistory());
       trackers[tracker->id()] = tracker;
     }
     return tracker;
@@ -293,12 +293,21 @@ class DataSource {
     VELOX_UNSUPPORTED("setFromDataSource");
   }
 
+  /// Hints that the consumer stops reading after 'limit' more rows from this
+  /// source, across all its splits. Called before the first addSplit(). A
+  /// source may then read smaller batches, skip prefetching and release its
+  /// readers once it has produced 'limit' rows. next() must still behave as
+  /// specified, i.e. return nullptr at the end of each split.
+  virtual void setLimit(uint64_t /*limit*/) {}
+
   /// Returns a connector dependent row size if available. This can be
   /// called after addSplit().  This estimates uncompressed data
   /// sizes. This is better than getCompletedBytes()/getCompletedRows()
   /// since these track sizes before decompression and may include
   /// read-ahead and extra IO from coalescing reads and  will not
-  /// fully account for size of sparsely accessed columns.
+  /// fully account for size of sparsely accessed columns. This is called
+  /// before each batch, so a connector may refine the estimate with the
+  /// sizes of the batches it has produced.
   virtual int64_t estimatedRowSize() {
     return kUnknownRowSize;
   }
@@ -586,6 +595,17 @@ class Connector {
     return false;
   }
 
+  /// Divides 'split' into at most 'maxPieces' splits of about 'targetBytes'
+  /// each that together read the same rows and can be read by different
+  /// drivers. Returns an empty vector if 'split' cannot be divided. Used by
+  /// TableScan to spread a large split over idle peer drivers.
+  virtual std::vector<std::shared_ptr<ConnectorSplit>> divideSplit(
+      const std::shared_ptr<ConnectorSplit>& /*split*/,
+      uint64_t /*targetBytes*/,
+      uint32_t /*maxPieces*/) const {
+    return {};
+  }
+
   /// Returns true if the connector supports index lookup, otherwise false.
   virtual bool supportsIndexLookup() const {
     return false;
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/connectors/arrow/ArrowStreamConnector.h"
+
+#include <folly/ScopeGuard.h>
+
+#include "velox/expression/Expr.h"
+#include "velox/vector/DecodedVector.h"
+#include "velox/vector/arrow/Bridge.h"
+
+namespace facebook::velox::connector::arrow {
+
+std::string ArrowStreamTableHandle::toString() const {
+  if (filter_) {
+    return fmt::format("arrow-stream[filter: {}]", filter_->toString());
+  }
+  return "arrow-stream";
+}
+
+ArrowStreamDataSource::ArrowStreamDataSource(
+    const RowTypePtr& outputType,
+    const ConnectorTableHandlePtr& tableHandle,
+    const ColumnHandleMap& columnHandles,
+    folly::Executor* executor,
+    ConnectorQueryCtx* connectorQueryCtx)
+    : outputType_(outputType),
+      executor_(executor),
+      pool_(connectorQueryCtx->memoryPool()),
+      expressionEvaluator_(connectorQueryCtx->expressionEvaluator()) {
+  auto arrowTableHandle =
+      std::dynamic_pointer_cast<const ArrowStreamTableHandle>(tableHandle);
+  VELOX_CHECK_NOT_NULL(
+      arrowTableHandle,
+      "TableHandle must be an instance of ArrowStreamTableHandle");
+  if (arrowTableHandle->filter()) {
+    filter_ = expressionEvaluator_->compile(arrowTableHandle->filter());
+  }
+
+  streamColumns_.reserve(outputType_->size());
+  for (const auto& outputName : outputType_->names()) {
+    auto it = columnHandles.find(outputName);
+    if (it == columnHandles.end()) {
+      // Without a handle the output column reads the stream column of the
+      // same name.
+      streamColumns_.push_back(outputName);
+      continue;
+    }
+    auto handle =
+        std::dynamic_pointer_cast<const ArrowStreamColumnHandle>(it->second);
+    VELOX_CHECK_NOT_NULL(
+        handle,
+        "ColumnHandle must be an instance of ArrowStreamColumnHandle for {}",
+        outputName);
+    streamColumns_.push_back(handle->name());
+  }
+}
+
+ArrowStreamDataSource::~ArrowStreamDataSource() {
+  // The prefetch reads 'stream_' and must finish before it is released.
+  if (prefetch_.valid()) {
+    prefetch_.wait();
+  }
+  releaseStream();
+}
+
+void ArrowStreamDataSource::addSplit(std::shared_ptr<ConnectorSplit> split) {
+  VELOX_CHECK_NULL(
+      stream_,
+      "Previous split has not been processed yet. Call next() to process the split.");
+  auto arrowSplit = std::dynamic_pointer_cast<ArrowStreamConnectorSplit>(split);
+  VELOX_CHECK(arrowSplit, "Wrong type of split for ArrowStreamDataSource.");
+  VELOX_CHECK_NOT_NULL(arrowSplit->stream);
+  stream_ = arrowSplit->stream;
+  if (executor_) {
+    startPrefetch();
+  }
+}
+
+RowVectorPtr ArrowStreamDataSource::readBatch() {
+  ArrowArray array;
+  if (stream_->get_next(stream_.get(), &array) != 0) {
+    const char* error = stream_->get_last_error(stream_.get());
+    VELOX_FAIL(
+        "Failed to call get_next on Arrow stream: {}",
+        error ? error : "unknown error");
+  }
+  if (array.release == nullptr) {
+    // End of stream.
+    return nullptr;
+  }
+  ArrowSchema schema;
+  if (stream_->get_schema(stream_.get(), &schema) != 0) {
+    array.release(&array);
+    const char* error = stream_->get_last_error(stream_.get());
+    VELOX_FAIL(
+        "Failed to call get_schema on Arrow stream: {}",
+        error ? error : "unknown error");
+  }
+  auto batch = std::dynamic_pointer_cast<RowVector>(
+      importFromArrowAsOwner(schema, array, pool_));
+  VELOX_CHECK_NOT_NULL(batch, "Arrow stream must produce struct arrays");
+  return batch;
+}
+
+void ArrowStreamDataSource::startPrefetch() {
+  auto [promise, future] =
+      makeVeloxContinuePromiseContract("ArrowStreamDataSource::prefetch");
+  prefetchDone_ = std::move(future);
+  prefetch_ = folly::via(
+      executor_, [this, promise = std::move(promise)]() mutable {
+        SCOPE_EXIT {
+          promise.setValue();
+        };
+        return readBatch();
+      });
+}
+
+std::optional<RowVectorPtr> ArrowStreamDataSource::next(
+    uint64_t /*size*/,
+    velox::ContinueFuture& future) {
+  VELOX_CHECK_NOT_NULL(stream_, "No split to process. Call addSplit() first.");
+
+  RowVectorPtr batch;
+  if (prefetch_.valid()) {
+    if (!prefetch_.isReady()) {
+      ++numPrefetchWaits_;
+      future = std::move(prefetchDone_);
+      return std::nullopt;
+    }
+    batch = std::move(prefetch_).value();
+  } else {
+    batch = readBatch();
+  }
+
+  if (batch == nullptr) {
+    // Split exhausted.
+    releaseStream();
+    return nullptr;
+  }
+  if (executor_) {
+    startPrefetch();
+  }
+
+  ++numBatches_;
+  completedRows_ += batch->size();
+  completedBytes_ += batch->retainedSize();
+  return project(batch);
+}
+
+RowVectorPtr ArrowStreamDataSource::project(const RowVectorPtr& batch) {
+  const auto& batchType = batch->type()->asRow();
+  std::vector<VectorPtr> children;
+  children.reserve(streamColumns_.size());
+  for (const auto& name : streamColumns_) {
+    children.push_back(batch->childAt(batchType.getChildIdx(name)));
+  }
+  vector_size_t numRows = batch->size();
+
+  if (filter_) {
+    filterRows_.resize(numRows);
+    filterRows_.setAll();
+    expressionEvaluator_->evaluate(
+        filter_.get(), filterRows_, *batch, filterResult_);
+    DecodedVector decoded(*filterResult_, filterRows_);
+    auto indices = allocateIndices(numRows, pool_);
+    auto* rawIndices = indices->asMutable<vector_size_t>();
+    vector_size_t numPassed = 0;
+    for (auto row = 0; row < numRows; ++row) {
+      if (!decoded.isNullAt(row) && decoded.valueAt<bool>(row)) {
+        rawIndices[numPassed++] = row;
+      }
+    }
+    if (numPassed == 0) {
+      // Returning an empty vector lets TableScan call next() again.
+      return RowVector::createEmpty(outputType_, pool_);
+    }
+    if (numPassed < numRows) {
+      for (auto& child : children) {
+        child =
+            BaseVector::wrapInDictionary(nullptr, indices, numPassed, child);
+      }
+      numRows = numPassed;
+    }
+  }
+  return std::make_shared<RowVector>(
+      pool_, outputType_, nullptr, numRows, std::move(children));
+}
+
+void ArrowStreamDataSource::releaseStream() {
+  if (stream_ && stream_->release) {
+    stream_->release(stream_.get());
+  }
+  stream_ = nullptr;
+}
+
+std::unordered_map<std::string, RuntimeCounter>
+ArrowStreamDataSource::runtimeStats() {
+  return {
+      {"numBatches", RuntimeCounter(numBatches_)},
+      {"numPrefetchWaits", RuntimeCounter(numPrefetchWaits_)},
+  };
+}
+
+} // namespace facebook::velox::connector::arrow
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <folly/futures/Future.h>
+
+#include "velox/common/config/Config.h"
+#include "velox/connectors/Connector.h"
+#include "velox/connectors/arrow/ArrowStreamConnectorSplit.h"
+
+namespace facebook::velox::connector::arrow {
+
+/// Column of the stream by its name in the stream schema.
+class ArrowStreamColumnHandle : public ColumnHandle {
+ public:
+  explicit ArrowStreamColumnHandle(std::string name) : name_(std::move(name)) {}
+
+  const std::string& name() const override {
+    return name_;
+  }
+
+ private:
+  const std::string name_;
+};
+
+/// Table handle for ArrowStreamConnector. 'filter' is an optional boolean
+/// expression over the stream columns. It is applied to each imported batch
+/// before projection, so it may use columns that are not in the output.
+class ArrowStreamTableHandle : public ConnectorTableHandle {
+ public:
+  explicit ArrowStreamTableHandle(
+      std::string connectorId,
+      core::TypedExprPtr filter = nullptr)
+      : ConnectorTableHandle(std::move(connectorId)),
+        filter_(std::move(filter)) {}
+
+  std::string toString() const override;
+
+  const core::TypedExprPtr& filter() const {
+    return filter_;
+  }
+
+ private:
+  const core::TypedExprPtr filter_;
+};
+
+/// Reads Arrow C streams given as ArrowStreamConnectorSplits. Batches are
+/// imported with the Arrow bridge without copying. Output columns are picked
+/// from the imported batch by name and the table handle filter is evaluated
+/// on it. If the connector has an executor, the next batch of the stream is
+/// read on it while the current batch is processed.
+class ArrowStreamDataSource : public DataSource {
+ public:
+  ArrowStreamDataSource(
+      const RowTypePtr& outputType,
+      const ConnectorTableHandlePtr& tableHandle,
+      const ColumnHandleMap& columnHandles,
+      folly::Executor* executor,
+      ConnectorQueryCtx* connectorQueryCtx);
+
+  ~ArrowStreamDataSource() override;
+
+  void addSplit(std::shared_ptr<ConnectorSplit> split) override;
+
+  void addDynamicFilter(
+      column_index_t /*outputChannel*/,
+      const std::shared_ptr<common::Filter>& /*filter*/) override {
+    VELOX_NYI("Dynamic filters not supported by ArrowStreamConnector.");
+  }
+
+  std::optional<RowVectorPtr> next(uint64_t size, velox::ContinueFuture& future)
+      override;
+
+  uint64_t getCompletedRows() override {
+    return completedRows_;
+  }
+
+  uint64_t getCompletedBytes() override {
+    return completedBytes_;
+  }
+
+  std::unordered_map<std::string, RuntimeCounter> runtimeStats() override;
+
+ private:
+  // Reads the next batch of 'stream_'. Returns nullptr at end of stream.
+  RowVectorPtr readBatch();
+
+  // Starts reading the next batch on 'executor_'.
+  void startPrefetch();
+
+  // Applies the filter and projection to a batch read from the stream.
+  RowVectorPtr project(const RowVectorPtr& batch);
+
+  void releaseStream();
+
+  const RowTypePtr outputType_;
+  // Stream column name for each output column.
+  std::vector<std::string> streamColumns_;
+  folly::Executor* const executor_;
+  memory::MemoryPool* const pool_;
+  core::ExpressionEvaluator* const expressionEvaluator_;
+  std::unique_ptr<exec::ExprSet> filter_;
+
+  std::shared_ptr<ArrowArrayStream> stream_;
+
+  // Batch being read on 'executor_' and the future that is realized when the
+  // read is done.
+  folly::Future<RowVectorPtr> prefetch_{
+      folly::Future<RowVectorPtr>::makeEmpty()};
+  ContinueFuture prefetchDone_{ContinueFuture::makeEmpty()};
+
+  VectorPtr filterResult_;
+  SelectivityVector filterRows_;
+
+  uint64_t completedRows_{0};
+  uint64_t completedBytes_{0};
+  uint64_t numBatches_{0};
+  uint64_t numPrefetchWaits_{0};
+};
+
+class ArrowStreamConnector final : public Connector {
+ public:
+  ArrowStreamConnector(
+      const std::string& id,
+      std::shared_ptr<const config::ConfigBase> /*config*/,
+      folly::Executor* executor)
+      : Connector(id), executor_(executor) {}
+
+  std::unique_ptr<DataSource> createDataSource(
+      const RowTypePtr& outputType,
+      const ConnectorTableHandlePtr& tableHandle,
+      const connector::ColumnHandleMap& columnHandles,
+      ConnectorQueryCtx* connectorQueryCtx) override final {
+    return std::make_unique<ArrowStreamDataSource>(
+        outputType, tableHandle, columnHandles, executor_, connectorQueryCtx);
+  }
+
+  std::unique_ptr<DataSink> createDataSink(
+      RowTypePtr /*inputType*/,
+      ConnectorInsertTableHandlePtr /*connectorInsertTableHandle*/,
+      ConnectorQueryCtx* /*connectorQueryCtx*/,
+      CommitStrategy /*commitStrategy*/) override final {
+    VELOX_NYI("ArrowStreamConnector does not support data sink.");
+  }
+
+  folly::Executor* executor() const override {
+    return executor_;
+  }
+
+ private:
+  folly::Executor* const executor_;
+};
+
+class ArrowStreamConnectorFactory : public ConnectorFactory {
+ public:
+  static constexpr const char* kArrowStreamConnectorName{"arrow-stream"};
+
+  ArrowStreamConnectorFactory()
+      : ConnectorFactory(kArrowStreamConnectorName) {}
+
+  explicit ArrowStreamConnectorFactory(const char* connectorName)
+      : ConnectorFactory(connectorName) {}
+
+  /// 'ioExecutor' is used to prefetch stream batches. Batches are read on the
+  /// driver thread if it is null.
+  std::shared_ptr<Connector> newConnector(
+      const std::string& id,
+      std::shared_ptr<const config::ConfigBase> config,
+      folly::Executor* ioExecutor = nullptr,
+      folly::Executor* cpuExecutor = nullptr) override {
+    return std::make_shared<ArrowStreamConnector>(id, config, ioExecutor);
+  }
+};
+
+} // namespace facebook::velox::connector::arrow
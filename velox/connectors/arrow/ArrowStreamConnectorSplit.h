@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/connectors/Connector.h"
+#include "velox/vector/arrow/Abi.h"
+
+namespace facebook::velox::connector::arrow {
+
+/// A split is one Arrow C stream, e.g. a local RecordBatchReader or an Arrow
+/// Flight endpoint exported with arrow::ExportRecordBatchReader(). Streams
+/// of different splits are read in parallel by different drivers. The
+/// DataSource releases the stream after reading it to the end.
+struct ArrowStreamConnectorSplit : public connector::ConnectorSplit {
+  ArrowStreamConnectorSplit(
+      const std::string& connectorId,
+      std::shared_ptr<ArrowArrayStream> stream)
+      : ConnectorSplit(connectorId), stream(std::move(stream)) {}
+
+  std::string toString() const override {
+    return fmt::format("Arrow stream split[{}]", connectorId);
+  }
+
+  const std::shared_ptr<ArrowArrayStream> stream;
+};
+
+} // namespace facebook::velox::connector::arrow
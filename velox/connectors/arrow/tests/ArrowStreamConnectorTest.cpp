@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/init/Init.h>
+#include "gtest/gtest.h"
+
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/connectors/arrow/ArrowStreamConnector.h"
+#include "velox/exec/tests/utils/AssertQueryBuilder.h"
+#include "velox/exec/tests/utils/OperatorTestBase.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+#include "velox/vector/arrow/Bridge.h"
+
+namespace facebook::velox::connector::arrow::test {
+namespace {
+
+using exec::test::AssertQueryBuilder;
+using exec::test::PlanBuilder;
+
+class ArrowStreamConnectorTest : public exec::test::OperatorTestBase {
+ protected:
+  const std::string kConnectorId = "test-arrow-stream";
+  const std::string kPrefetchConnectorId = "test-arrow-stream-prefetch";
+
+  void SetUp() override {
+    OperatorTestBase::SetUp();
+    connector::registerConnectorFactory(
+        std::make_shared<ArrowStreamConnectorFactory>());
+    auto factory = connector::getConnectorFactory(
+        ArrowStreamConnectorFactory::kArrowStreamConnectorName);
+    std::shared_ptr<const config::ConfigBase> config;
+    connector::registerConnector(factory->newConnector(kConnectorId, config));
+    connector::registerConnector(factory->newConnector(
+        kPrefetchConnectorId, config, ioExecutor_.get()));
+  }
+
+  void TearDown() override {
+    connector::unregisterConnector(kConnectorId);
+    connector::unregisterConnector(kPrefetchConnectorId);
+    connector::unregisterConnectorFactory(
+        ArrowStreamConnectorFactory::kArrowStreamConnectorName);
+    OperatorTestBase::TearDown();
+  }
+
+  // Mock stream returning 'vectors' one by one.
+  struct StreamState {
+    std::vector<RowVectorPtr> vectors;
+    memory::MemoryPool* pool;
+    size_t next{0};
+    bool failGetNext{false};
+  };
+
+  std::shared_ptr<ArrowArrayStream> makeStream(
+      std::vector<RowVectorPtr> vectors,
+      bool failGetNext = false) {
+    auto* stream = new ArrowArrayStream();
+    stream->private_data = new StreamState{
+        std::move(vectors), pool(), 0, failGetNext};
+    stream->get_schema = [](ArrowArrayStream* self, ArrowSchema* out) {
+      auto* state = static_cast<StreamState*>(self->private_data);
+      exportToArrow(
+          BaseVector::create(state->vectors[0]->type(), 0, state->pool), *out);
+      return 0;
+    };
+    stream->get_next = [](ArrowArrayStream* self, ArrowArray* out) {
+      auto* state = static_cast<StreamState*>(self->private_data);
+      if (state->failGetNext) {
+        return 1;
+      }
+      if (state->next < state->vectors.size()) {
+        exportToArrow(state->vectors[state->next++], *out, state->pool);
+      } else {
+        out->release = nullptr;
+      }
+      return 0;
+    };
+    stream->get_last_error = [](ArrowArrayStream*) -> const char* {
+      return "mock error";
+    };
+    stream->release = [](ArrowArrayStream* self) {
+      delete static_cast<StreamState*>(self->private_data);
+      self->release = nullptr;
+    };
+    return std::shared_ptr<ArrowArrayStream>(stream, [](auto* stream) {
+      if (stream->release) {
+        stream->release(stream);
+      }
+      delete stream;
+    });
+  }
+
+  exec::Split makeSplit(
+      std::vector<RowVectorPtr> vectors,
+      const std::string& connectorId) {
+    return exec::Split(std::make_shared<ArrowStreamConnectorSplit>(
+        connectorId, makeStream(std::move(vectors))));
+  }
+
+  core::PlanNodePtr makeScan(
+      const std::string& connectorId,
+      const RowTypePtr& outputType,
+      core::TypedExprPtr filter = nullptr,
+      connector::ColumnHandleMap assignments = {}) {
+    return PlanBuilder()
+        .startTableScan()
+        .outputType(outputType)
+        .tableHandle(std::make_shared<ArrowStreamTableHandle>(
+            connectorId, std::move(filter)))
+        .assignments(std::move(assignments))
+        .endTableScan()
+        .planNode();
+  }
+
+  std::vector<RowVectorPtr> makeBatches(int32_t numBatches) {
+    std::vector<RowVectorPtr> batches;
+    for (auto i = 0; i < numBatches; ++i) {
+      batches.push_back(makeRowVector(
+          {"a", "b", "c"},
+          {
+              makeFlatVector<int64_t>(
+                  100, [&](auto row) { return i * 100 + row; }),
+              makeFlatVector<double>(100, [](auto row) { return row * 0.5; }),
+              makeFlatVector<std::string>(
+                  100, [](auto row) { return fmt::format("s{}", row); }),
+          }));
+    }
+    return batches;
+  }
+};
+
+TEST_F(ArrowStreamConnectorTest, scan) {
+  auto batches = makeBatches(3);
+  auto type = asRowType(batches[0]->type());
+  for (const auto& connectorId : {kConnectorId, kPrefetchConnectorId}) {
+    SCOPED_TRACE(connectorId);
+    AssertQueryBuilder(makeScan(connectorId, type))
+        .split(makeSplit(batches, connectorId))
+        .assertResults(batches);
+  }
+}
+
+TEST_F(ArrowStreamConnectorTest, projection) {
+  auto batches = makeBatches(2);
+  std::vector<RowVectorPtr> expected;
+  for (const auto& batch : batches) {
+    expected.push_back(
+        makeRowVector({"x", "a"}, {batch->childAt(2), batch->childAt(0)}));
+  }
+  connector::ColumnHandleMap assignments{
+      {"x", std::make_shared<ArrowStreamColumnHandle>("c")},
+      {"a", std::make_shared<ArrowStreamColumnHandle>("a")},
+  };
+  auto type = ROW({"x", "a"}, {VARCHAR(), BIGINT()});
+  AssertQueryBuilder(makeScan(kPrefetchConnectorId, type, nullptr, assignments))
+      .split(makeSplit(batches, kPrefetchConnectorId))
+      .assertResults(expected);
+}
+
+TEST_F(ArrowStreamConnectorTest, filter) {
+  auto batches = makeBatches(3);
+  auto rowType = asRowType(batches[0]->type());
+  // The filter uses 'b', which is not projected.
+  auto filter = parseExpr("a % 7 = 0 AND b < 20.0", rowType);
+  std::vector<int64_t> expectedA;
+  for (auto i = 0; i < 3; ++i) {
+    for (auto row = 0; row < 40; ++row) {
+      const int64_t a = i * 100 + row;
+      if (a % 7 == 0) {
+        expectedA.push_back(a);
+      }
+    }
+  }
+  auto expected = makeRowVector({"a"}, {makeFlatVector(expectedA)});
+  for (const auto& connectorId : {kConnectorId, kPrefetchConnectorId}) {
+    SCOPED_TRACE(connectorId);
+    AssertQueryBuilder(makeScan(connectorId, ROW({"a"}, {BIGINT()}), filter))
+        .split(makeSplit(batches, connectorId))
+        .assertResults(expected);
+  }
+}
+
+TEST_F(ArrowStreamConnectorTest, multipleSplits) {
+  auto batches = makeBatches(2);
+  auto type = asRowType(batches[0]->type());
+  std::vector<exec::Split> splits;
+  std::vector<RowVectorPtr> expected;
+  for (auto i = 0; i < 4; ++i) {
+    splits.push_back(makeSplit(batches, kPrefetchConnectorId));
+    expected.insert(expected.end(), batches.begin(), batches.end());
+  }
+  auto task = AssertQueryBuilder(makeScan(kPrefetchConnectorId, type))
+                  .splits(std::move(splits))
+                  .maxDrivers(2)
+                  .assertResults(expected);
+  auto stats = task->taskStats().pipelineStats[0].operatorStats[0];
+  EXPECT_EQ(stats.runtimeStats.at("numBatches").sum, 8);
+}
+
+TEST_F(ArrowStreamConnectorTest, streamError) {
+  auto batches = makeBatches(1);
+  auto type = asRowType(batches[0]->type());
+  auto split = exec::Split(std::make_shared<ArrowStreamConnectorSplit>(
+      kConnectorId, makeStream(batches, /*failGetNext=*/true)));
+  VELOX_ASSERT_THROW(
+      AssertQueryBuilder(makeScan(kConnectorId, type))
+          .split(std::move(split))
+          .copyResults(pool()),
+      "Failed to call get_next on Arrow stream: mock error");
+}
+
+} // namespace
+} // namespace facebook::velox::connector::arrow::test
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  folly::Init init(&argc, &argv, false);
+  return RUN_ALL_TESTS();
+}
@@ -93,6 +93,11 @@ std::optional<std::string> HiveConfig::gcsMaxRetryTime() const {
       config_->get<std::string>(kGcsMaxRetryTime));
 }
 
+std::optional<std::string> HiveConfig::gcsReadHedgeDelay() const {
+  return static_cast<std::optional<std::string>>(
+      config_->get<std::string>(kGcsReadHedgeDelay));
+}
+
 bool HiveConfig::isOrcUseColumnNames(const config::ConfigBase* session) const {
   return session->get<bool>(
       kOrcUseColumnNamesSession, config_->get<bool>(kOrcUseColumnNames, false));
@@ -154,11 +159,40 @@ int32_t HiveConfig::prefetchRowGroups() const {
   return config_->get<int32_t>(kPrefetchRowGroups, 1);
 }
 
+int32_t HiveConfig::prefetchStripes(const config::ConfigBase* session) const {
+  return session->get<int32_t>(
+      kPrefetchStripesSession, config_->get<int32_t>(kPrefetchStripes, 0));
+}
+
+uint64_t HiveConfig::prefetchStripesMaxBytes(
+    const config::ConfigBase* session) const {
+  return config::toCapacity(
+      session->get<std::string>(
+          kPrefetchStripesMaxBytesSession,
+          config_->get<std::string>(kPrefetchStripesMaxBytes, "256MB")),
+      config::CapacityUnit::BYTE);
+}
+
 int32_t HiveConfig::loadQuantum(const config::ConfigBase* session) const {
   return session->get<int32_t>(
       kLoadQuantumSession, config_->get<int32_t>(kLoadQuantum, 8 << 20));
 }
 
+bool HiveConfig::deferNonFilterStreams(
+    const config::ConfigBase* session) const {
+  return session->get<bool>(
+      kDeferNonFilterStreamsSession,
+      config_->get<bool>(kDeferNonFilterStreams, false));
+}
+
+bool HiveConfig::cacheDecompressedStreams() const {
+  return config_->get<bool>(kCacheDecompressedStreams, false);
+}
+
+bool HiveConfig::cacheDecryptedStreams() const {
+  return config_->get<bool>(kCacheDecryptedStreams, false);
+}
+
 int32_t HiveConfig::numCacheFileHandles() const {
   return config_->get<int32_t>(kNumCacheFileHandles, 20'000);
 }
@@ -171,6 +205,12 @@ bool HiveConfig::isFileHandleCacheEnabled() const {
   return config_->get<bool>(kEnableFileHandleCache, true);
 }
 
+uint64_t HiveConfig::fileMetadataCacheSize() const {
+  return config::toCapacity(
+      config_->get<std::string>(kFileMetadataCacheSize, "0B"),
+      config::CapacityUnit::BYTE);
+}
+
 std::string HiveConfig::writeFileCreateConfig() const {
   return config_->get<std::string>(kWriteFileCreateConfig, "");
 }
@@ -198,6 +238,12 @@ uint64_t HiveConfig::sortWriterFinishTimeSliceLimitMs(
       config_->get<uint64_t>(kSortWriterFinishTimeSliceLimitMs, 5'000));
 }
 
+bool HiveConfig::sortedPartitionWrite(const config::ConfigBase* session) const {
+  return session->get<bool>(
+      kSortedPartitionWriteSession,
+      config_->get<bool>(kSortedPartitionWrite, false));
+}
+
 uint64_t HiveConfig::footerEstimatedSize() const {
   return config_->get<uint64_t>(kFooterEstimatedSize, 256UL << 10);
 }
@@ -230,6 +276,13 @@ bool HiveConfig::readStatsBasedFilterReorderDisabled(
       config_->get<bool>(kReadStatsBasedFilterReorderDisabled, false));
 }
 
+bool HiveConfig::readExpressionFilterPushdown(
+    const config::ConfigBase* session) const {
+  return session->get<bool>(
+      kReadExpressionFilterPushdownSession,
+      config_->get<bool>(kReadExpressionFilterPushdown, false));
+}
+
 std::string HiveConfig::hiveLocalDataPath() const {
   return config_->get<std::string>(kLocalDataPath, "");
 }
@@ -71,6 +71,11 @@ class HiveConfig {
   /// The GCS maximum time allowed to retry transient errors.
   static constexpr const char* kGcsMaxRetryTime = "hive.gcs.max-retry-time";
 
+  /// If set, a GCS range read that has not completed after the p99 read
+  /// latency and at least this delay is sent again and the first result is
+  /// used.
+  static constexpr const char* kGcsReadHedgeDelay = "hive.gcs.read-hedge-delay";
+
   /// Maps table field names to file field names using names, not indices.
   // TODO: remove hive_orc_use_column_names since it doesn't exist in presto,
   // right now this is only used for testing.
@@ -116,11 +121,44 @@ class HiveConfig {
   /// The number of prefetch rowgroups
   static constexpr const char* kPrefetchRowGroups = "prefetch-rowgroups";
 
+  /// The number of DWRF and ORC stripes past the one being read whose IO is
+  /// issued on the connector IO executor. The first stripe of a preloaded
+  /// split is prefetched as well. 0 disables stripe prefetch.
+  static constexpr const char* kPrefetchStripes = "prefetch-stripes";
+  static constexpr const char* kPrefetchStripesSession = "prefetch_stripes";
+
+  /// Stops issuing stripe prefetches while this many prefetched bytes are
+  /// waiting to be read.
+  static constexpr const char* kPrefetchStripesMaxBytes =
+      "prefetch-stripes-max-bytes";
+  static constexpr const char* kPrefetchStripesMaxBytesSession =
+      "prefetch_stripes_max_bytes";
+
   /// The total size in bytes for a direct coalesce request. Up to 8MB load
   /// quantum size is supported when SSD cache is enabled.
   static constexpr const char* kLoadQuantum = "load-quantum";
   static constexpr const char* kLoadQuantumSession = "load-quantum";
 
+  /// Loads the DWRF and ORC streams of the columns without filters on first
+  /// access instead of together with the filter columns when the data cache is
+  /// used. Skips their IO for the stripes where no row passes the filters.
+  static constexpr const char* kDeferNonFilterStreams =
+      "defer-non-filter-streams";
+  static constexpr const char* kDeferNonFilterStreamsSession =
+      "defer_non_filter_streams";
+
+  /// Keeps the decompressed chunks of compressed DWRF and ORC streams in the
+  /// data cache, so that repeated scans of the same files do not decompress
+  /// them again. Costs cache memory for both the raw and decompressed data.
+  static constexpr const char* kCacheDecompressedStreams =
+      "cache-decompressed-streams";
+
+  /// Applies kCacheDecompressedStreams to encrypted DWRF streams too, so that
+  /// repeated scans skip their decryption as well. The decrypted data is then
+  /// held in the shared data cache.
+  static constexpr const char* kCacheDecryptedStreams =
+      "cache-decrypted-streams";
+
   /// Maximum number of entries in the file handle cache.
   static constexpr const char* kNumCacheFileHandles = "num_cached_file_handles";
 
@@ -134,6 +172,13 @@ class HiveConfig {
   static constexpr const char* kEnableFileHandleCache =
       "file-handle-cache-enabled";
 
+  /// Maximum memory of the process-wide cache of parsed file metadata, e.g.
+  /// Parquet footers, shared by the splits and queries that read the same
+  /// file. 0 disables the cache. Only the files whose splits have a
+  /// modification time are cached.
+  static constexpr const char* kFileMetadataCacheSize =
+      "file-metadata-cache-size";
+
   /// The size in bytes to be fetched with Meta data together, used when the
   /// data after meta data will be used later. Optimization to decrease small IO
   /// request
@@ -161,6 +206,15 @@ class HiveConfig {
   static constexpr const char* kSortWriterMaxOutputBytesSession =
       "sort_writer_max_output_bytes";
 
+  /// If true, the writer of a partitioned table that is not bucketed buffers
+  /// the rows in a spillable sort buffer, sorts them by the partition keys and
+  /// writes the partitions one after the other with one open file writer at a
+  /// time. This bounds the memory of inserts with many partitions and is not
+  /// limited by max-partitions-per-writers.
+  static constexpr const char* kSortedPartitionWrite = "sorted-partition-write";
+  static constexpr const char* kSortedPartitionWriteSession =
+      "sorted_partition_write";
+
   /// Sort Writer will exit finish() method after this many milliseconds even if
   /// it has not completed its work yet. Zero means no time limit.
   static constexpr const char* kSortWriterFinishTimeSliceLimitMs =
@@ -184,6 +238,14 @@ class HiveConfig {
   static constexpr const char* kReadStatsBasedFilterReorderDisabledSession =
       "stats_based_filter_reorder_disabled";
 
+  /// Evaluates the remaining filter conjuncts over scalar file columns inside
+  /// the file reader, after the subfield filters and before reading the other
+  /// columns.
+  static constexpr const char* kReadExpressionFilterPushdown =
+      "hive.reader.expression-filter-pushdown";
+  static constexpr const char* kReadExpressionFilterPushdownSession =
+      "hive.reader.expression_filter_pushdown";
+
   static constexpr const char* kLocalDataPath = "hive_local_data_path";
   static constexpr const char* kLocalFileFormat = "hive_local_file_format";
 
@@ -204,6 +266,8 @@ class HiveConfig {
 
   std::optional<std::string> gcsMaxRetryTime() const;
 
+  std::optional<std::string> gcsReadHedgeDelay() const;
+
   bool isOrcUseColumnNames(const config::ConfigBase* session) const;
 
   bool isParquetUseColumnNames(const config::ConfigBase* session) const;
@@ -223,14 +287,26 @@ class HiveConfig {
 
   int32_t prefetchRowGroups() const;
 
+  int32_t prefetchStripes(const config::ConfigBase* session) const;
+
+  uint64_t prefetchStripesMaxBytes(const config::ConfigBase* session) const;
+
   int32_t loadQuantum(const config::ConfigBase* session) const;
 
+  bool deferNonFilterStreams(const config::ConfigBase* session) const;
+
+  bool cacheDecompressedStreams() const;
+
+  bool cacheDecryptedStreams() const;
+
   int32_t numCacheFileHandles() const;
 
   uint64_t fileHandleExpirationDurationMs() const;
 
   bool isFileHandleCacheEnabled() const;
 
+  uint64_t fileMetadataCacheSize() const;
+
   uint64_t fileWriterFlushThresholdBytes() const;
 
   std::string writeFileCreateConfig() const;
@@ -242,6 +318,8 @@ class HiveConfig {
   uint64_t sortWriterFinishTimeSliceLimitMs(
       const config::ConfigBase* session) const;
 
+  bool sortedPartitionWrite(const config::ConfigBase* session) const;
+
   uint64_t footerEstimatedSize() const;
 
   uint64_t filePreloadThreshold() const;
@@ -258,6 +336,10 @@ class HiveConfig {
   bool readStatsBasedFilterReorderDisabled(
       const config::ConfigBase* session) const;
 
+  /// Returns true if remaining filter conjuncts over scalar file columns are
+  /// evaluated by the file reader.
+  bool readExpressionFilterPushdown(const config::ConfigBase* session) const;
+
   /// Returns the file system path containing local data. If non-empty,
   /// initializes LocalHiveConnectorMetadata to provide metadata for the tables
   /// in the directory.
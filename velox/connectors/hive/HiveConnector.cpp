@@ -16,10 +16,13 @@
 
 #include "velox/connectors/hive/HiveConnector.h"
 
+#include "velox/common/base/SuccinctPrinter.h"
 #include "velox/connectors/hive/HiveConfig.h"
+#include "velox/connectors/hive/HiveConnectorSplit.h"
 #include "velox/connectors/hive/HiveDataSink.h"
 #include "velox/connectors/hive/HiveDataSource.h"
 #include "velox/connectors/hive/HivePartitionFunction.h"
+#include "velox/dwio/common/FileMetadataCache.h"
 
 #include <boost/lexical_cast.hpp>
 #include <memory>
@@ -59,6 +62,12 @@ HiveConnector::HiveConnector(
     LOG(INFO) << "Hive connector " << connectorId()
               << " created with file handle cache disabled";
   }
+  if (const auto cacheSize = hiveConfig_->fileMetadataCacheSize();
+      cacheSize > 0 && dwio::common::FileMetadataCache::instance() == nullptr) {
+    dwio::common::FileMetadataCache::init(cacheSize);
+    LOG(INFO) << "File metadata cache created with "
+              << succinctBytes(cacheSize);
+  }
   for (auto& factory : hiveConnectorMetadataFactories()) {
     metadata_ = factory->create(this);
     if (metadata_ != nullptr) {
@@ -82,6 +91,63 @@ std::unique_ptr<DataSource> HiveConnector::createDataSource(
       hiveConfig_);
 }
 
+std::vector<std::shared_ptr<ConnectorSplit>> HiveConnector::divideSplit(
+    const std::shared_ptr<ConnectorSplit>& split,
+    uint64_t targetBytes,
+    uint32_t maxPieces) const {
+  const auto* hiveSplit = dynamic_cast<const HiveConnectorSplit*>(split.get());
+  if (hiveSplit == nullptr || targetBytes == 0 || maxPieces < 2) {
+    return {};
+  }
+  switch (hiveSplit->fileFormat) {
+    case dwio::common::FileFormat::DWRF:
+    case dwio::common::FileFormat::ORC:
+    case dwio::common::FileFormat::PARQUET:
+      break;
+    default:
+      return {};
+  }
+  // A split without a length covers the rest of the file.
+  uint64_t length = hiveSplit->length;
+  if (length == std::numeric_limits<uint64_t>::max()) {
+    if (!hiveSplit->properties.has_value() ||
+        !hiveSplit->properties->fileSize.has_value() ||
+        hiveSplit->properties->fileSize.value() <= hiveSplit->start) {
+      return {};
+    }
+    length = hiveSplit->properties->fileSize.value() - hiveSplit->start;
+  }
+  const auto numPieces = std::min<uint64_t>(
+      maxPieces, bits::divRoundUp(length, targetBytes));
+  if (numPieces < 2) {
+    return {};
+  }
+
+  const auto pieceLength = bits::divRoundUp(length, numPieces);
+  std::vector<std::shared_ptr<ConnectorSplit>> pieces;
+  pieces.reserve(numPieces);
+  for (uint64_t offset = 0; offset < length; offset += pieceLength) {
+    pieces.push_back(std::make_shared<HiveConnectorSplit>(
+        hiveSplit->connectorId,
+        hiveSplit->filePath,
+        hiveSplit->fileFormat,
+        hiveSplit->start + offset,
+        std::min<uint64_t>(pieceLength, length - offset),
+        hiveSplit->partitionKeys,
+        hiveSplit->tableBucketNumber,
+        hiveSplit->customSplitInfo,
+        hiveSplit->extraFileInfo,
+        hiveSplit->serdeParameters,
+        hiveSplit->splitWeight / numPieces,
+        hiveSplit->cacheable,
+        hiveSplit->infoColumns,
+        hiveSplit->properties,
+        hiveSplit->rowIdProperties,
+        hiveSplit->bucketConversion));
+  }
+  return pieces;
+}
+
 std::unique_ptr<DataSink> HiveConnector::createDataSink(
     RowTypePtr inputType,
     ConnectorInsertTableHandlePtr connectorInsertTableHandle,
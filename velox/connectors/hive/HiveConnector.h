@@ -58,6 +58,14 @@ class HiveConnector : public Connector {
     return true;
   }
 
+  /// Divides splits of columnar files by byte range. The readers of these
+  /// formats read the stripes or row groups that start in the range of their
+  /// split, so the pieces meet at stripe or row group boundaries.
+  std::vector<std::shared_ptr<ConnectorSplit>> divideSplit(
+      const std::shared_ptr<ConnectorSplit>& split,
+      uint64_t targetBytes,
+      uint32_t maxPieces) const override;
+
   std::unique_ptr<DataSink> createDataSink(
       RowTypePtr inputType,
       ConnectorInsertTableHandlePtr connectorInsertTableHandle,
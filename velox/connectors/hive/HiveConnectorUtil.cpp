@@ -580,6 +580,9 @@ void configureReaderOptions(
   readerOptions.setFilePreloadThreshold(hiveConfig->filePreloadThreshold());
   readerOptions.setPrefetchRowGroups(hiveConfig->prefetchRowGroups());
   readerOptions.setNoCacheRetention(!hiveSplit->cacheable);
+  readerOptions.setCacheDecompressedStreams(
+      hiveConfig->cacheDecompressedStreams());
+  readerOptions.setCacheDecryptedStreams(hiveConfig->cacheDecryptedStreams());
   const auto& sessionTzName = connectorQueryCtx->sessionTimezone();
   if (!sessionTzName.empty()) {
     const auto timezone = tz::locateZone(sessionTzName);
@@ -628,6 +631,8 @@ void configureRowReaderOptions(
   if (hiveConfig && sessionProperties) {
     rowReaderOptions.setTimestampPrecision(static_cast<TimestampPrecision>(
         hiveConfig->readTimestampUnit(sessionProperties)));
+    rowReaderOptions.setDeferNonFilterStreams(
+        hiveConfig->deferNonFilterStreams(sessionProperties));
   }
   rowReaderOptions.setSerdeParameters(hiveSplit->serdeParameters);
 }
@@ -742,6 +747,22 @@ bool testFilters(
           return false;
         }
       }
+    } else if (
+        child->isFlatMapAsStruct() && child->hasFilter() &&
+        rowType->containsChild(child->fieldName()) &&
+        partitionKeys.count(child->fieldName()) == 0) {
+      const auto& typeWithId = fileTypeWithId->childByName(child->fieldName());
+      const auto columnStats = reader->columnStatistics(typeWithId->id());
+      auto* mapStats =
+          dynamic_cast<dwio::common::MapColumnStatistics*>(columnStats.get());
+      if (mapStats != nullptr && typeWithId->type()->isMap() &&
+          !testFlatMapKeyFilters(
+              *child, *mapStats, totalRows.value(), typeWithId->type())) {
+        VLOG(1) << "Skipping " << filePath
+                << " based on per-key stats and filters for column "
+                << child->fieldName();
+        return false;
+      }
     }
   }
 
@@ -23,8 +23,10 @@
 #include "velox/connectors/hive/HiveConfig.h"
 #include "velox/connectors/hive/HiveConnectorUtil.h"
 #include "velox/connectors/hive/HivePartitionFunction.h"
+#include "velox/connectors/hive/HivePartitionUtil.h"
 #include "velox/connectors/hive/TableHandle.h"
 #include "velox/core/ITypedExpr.h"
+#include "velox/dwio/catalog/fbhive/FileUtils.h"
 #include "velox/dwio/common/Options.h"
 #include "velox/dwio/common/SortingWriter.h"
 #include "velox/exec/OperatorUtils.h"
@@ -35,6 +37,7 @@
 #include <boost/uuid/uuid_io.hpp>
 
 using facebook::velox::common::testutil::TestValue;
+using facebook::velox::dwio::catalog::fbhive::FileUtils;
 
 namespace facebook::velox::connector::hive {
 namespace {
@@ -366,6 +369,36 @@ std::string HiveBucketProperty::toString() const {
   return out.str();
 }
 
+class HiveDataSink::SortedPartitionWriter : public dwio::common::Writer {
+ public:
+  explicit SortedPartitionWriter(HiveDataSink* dataSink)
+      : dataSink_(dataSink) {
+    setState(State::kRunning);
+  }
+
+  void write(const VectorPtr& data) override {
+    dataSink_->writeSortedPartitions(std::static_pointer_cast<RowVector>(data));
+  }
+
+  void flush() override {}
+
+  bool finish() override {
+    return true;
+  }
+
+  // The data sink closes or aborts the writer of the last partition.
+  void close() override {
+    setState(State::kClosed);
+  }
+
+  void abort() override {
+    setState(State::kAborted);
+  }
+
+ private:
+  HiveDataSink* const dataSink_;
+};
+
 HiveDataSink::HiveDataSink(
     RowTypePtr inputType,
     std::shared_ptr<const HiveInsertTableHandle> insertTableHandle,
@@ -402,6 +435,10 @@ HiveDataSink::HiveDataSink(
       maxOpenWriters_(hiveConfig_->maxPartitionsPerWriters(
           connectorQueryCtx->sessionProperties())),
       partitionChannels_(getPartitionChannels(insertTableHandle_)),
+      sortedPartitionWrite_(
+          !partitionChannels_.empty() && bucketCount == 0 &&
+          hiveConfig_->sortedPartitionWrite(
+              connectorQueryCtx->sessionProperties())),
       partitionIdGenerator_(
           !partitionChannels_.empty()
               ? std::make_unique<PartitionIdGenerator>(
@@ -442,6 +479,11 @@ HiveDataSink::HiveDataSink(
     ensureWriter(HiveWriterId::unpartitionedId());
   }
 
+  if (sortedPartitionWrite_) {
+    createSortedPartitionWriter();
+    return;
+  }
+
   if (!isBucketed()) {
     return;
   }
@@ -481,6 +523,14 @@ void HiveDataSink::appendData(RowVectorPtr input) {
     return;
   }
 
+  if (sortedPartitionWrite_) {
+    checkPartitionKeys(input);
+    memory::NonReclaimableSectionGuard guard(
+        sortedPartitionNonReclaimableSection_.get());
+    sortedPartitionWriter_->write(input);
+    return;
+  }
+
   // Compute partition and bucket numbers.
   computePartitionAndBucketIds(input);
 
@@ -536,24 +586,29 @@ std::string HiveDataSink::stateString(State state) {
   }
 }
 
+void HiveDataSink::checkPartitionKeys(const RowVectorPtr& input) const {
+  if (hiveConfig_->allowNullPartitionKeys(
+          connectorQueryCtx_->sessionProperties())) {
+    return;
+  }
+  // Check that there are no nulls in the partition keys.
+  for (auto& partitionIdx : partitionChannels_) {
+    auto col = input->childAt(partitionIdx);
+    if (col->mayHaveNulls()) {
+      for (auto i = 0; i < col->size(); ++i) {
+        VELOX_USER_CHECK(
+            !col->isNullAt(i),
+            "Partition key must not be null: {}",
+            input->type()->asRow().nameOf(partitionIdx));
+      }
+    }
+  }
+}
+
 void HiveDataSink::computePartitionAndBucketIds(const RowVectorPtr& input) {
   VELOX_CHECK(isPartitioned() || isBucketed());
   if (isPartitioned()) {
-    if (!hiveConfig_->allowNullPartitionKeys(
-            connectorQueryCtx_->sessionProperties())) {
-      // Check that there are no nulls in the partition keys.
-      for (auto& partitionIdx : partitionChannels_) {
-        auto col = input->childAt(partitionIdx);
-        if (col->mayHaveNulls()) {
-          for (auto i = 0; i < col->size(); ++i) {
-            VELOX_USER_CHECK(
-                !col->isNullAt(i),
-                "Partition key must not be null: {}",
-                input->type()->asRow().nameOf(partitionIdx));
-          }
-        }
-      }
-    }
+    checkPartitionKeys(input);
     partitionIdGenerator_->run(input, partitionIds_);
   }
 
@@ -562,6 +617,102 @@ void HiveDataSink::computePartitionAndBucketIds(const RowVectorPtr& input) {
   }
 }
 
+void HiveDataSink::createSortedPartitionWriter() {
+  auto* connectorPool = connectorQueryCtx_->connectorMemoryPool();
+  sortedPartitionPool_ = connectorPool->addAggregateChild(
+      fmt::format("{}.sortedPartition", connectorPool->name()));
+  if (connectorPool->reclaimer() != nullptr) {
+    sortedPartitionPool_->setReclaimer(exec::MemoryReclaimer::create());
+  }
+  sortedPartitionSortPool_ = createSortPool(sortedPartitionPool_);
+  sortedPartitionNonReclaimableSection_ =
+      std::make_unique<tsan_atomic<bool>>(false);
+  sortedPartitionSpillStats_ =
+      std::make_unique<folly::Synchronized<common::SpillStats>>();
+
+  // Null partition keys sort first as a partition of their own.
+  std::vector<CompareFlags> compareFlags(
+      partitionChannels_.size(),
+      {true, true, false, CompareFlags::NullHandlingMode::kNullAsValue});
+  auto sortBuffer = std::make_unique<exec::SortBuffer>(
+      inputType_,
+      partitionChannels_,
+      compareFlags,
+      sortedPartitionSortPool_.get(),
+      sortedPartitionNonReclaimableSection_.get(),
+      connectorQueryCtx_->prefixSortConfig(),
+      spillConfig_,
+      sortedPartitionSpillStats_.get());
+  sortedPartitionWriter_ = std::make_unique<dwio::common::SortingWriter>(
+      std::make_unique<SortedPartitionWriter>(this),
+      std::move(sortBuffer),
+      hiveConfig_->sortWriterMaxOutputRows(
+          connectorQueryCtx_->sessionProperties()),
+      hiveConfig_->sortWriterMaxOutputBytes(
+          connectorQueryCtx_->sessionProperties()),
+      sortWriterFinishTimeSliceLimitMs_);
+
+  std::vector<std::string> names;
+  std::vector<TypePtr> types;
+  for (auto channel : partitionChannels_) {
+    names.push_back(inputType_->nameOf(channel));
+    types.push_back(inputType_->childAt(channel));
+  }
+  sortedPartitionKeys_ = BaseVector::create<RowVector>(
+      ROW(std::move(names), std::move(types)),
+      1,
+      connectorQueryCtx_->memoryPool());
+}
+
+void HiveDataSink::writeSortedPartitions(const RowVectorPtr& input) {
+  const auto numRows = input->size();
+  vector_size_t begin = 0;
+  while (begin < numRows) {
+    if (writers_.size() == numClosedWriters_ ||
+        !inSortedPartition(input, begin)) {
+      startSortedPartition(input, begin);
+    }
+    auto end = begin + 1;
+    while (end < numRows && inSortedPartition(input, end)) {
+      ++end;
+    }
+    write(
+        writers_.size() - 1,
+        end - begin == numRows
+            ? input
+            : std::static_pointer_cast<RowVector>(
+                  input->slice(begin, end - begin)));
+    begin = end;
+  }
+}
+
+bool HiveDataSink::inSortedPartition(
+    const RowVectorPtr& input,
+    vector_size_t row) const {
+  for (auto i = 0; i < partitionChannels_.size(); ++i) {
+    if (!input->childAt(partitionChannels_[i])
+             ->equalValueAt(sortedPartitionKeys_->childAt(i).get(), row, 0)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void HiveDataSink::startSortedPartition(
+    const RowVectorPtr& input,
+    vector_size_t row) {
+  if (writers_.size() > numClosedWriters_) {
+    WRITER_NON_RECLAIMABLE_SECTION_GUARD(numClosedWriters_);
+    writers_[numClosedWriters_]->close();
+    ++numClosedWriters_;
+  }
+  for (auto i = 0; i < partitionChannels_.size(); ++i) {
+    sortedPartitionKeys_->childAt(i)->copy(
+        input->childAt(partitionChannels_[i]).get(), 0, row, 1);
+  }
+  appendWriter(HiveWriterId{static_cast<uint32_t>(writers_.size())});
+}
+
 DataSink::Stats HiveDataSink::stats() const {
   Stats stats;
   if (state_ == State::kAborted) {
@@ -590,6 +741,12 @@ DataSink::Stats HiveDataSink::stats() const {
       stats.spillStats += *spillStats;
     }
   }
+  if (sortedPartitionSpillStats_ != nullptr) {
+    const auto spillStats = sortedPartitionSpillStats_->rlock();
+    if (!spillStats->empty()) {
+      stats.spillStats += *spillStats;
+    }
+  }
   return stats;
 }
 
@@ -647,6 +804,13 @@ bool HiveDataSink::finish() {
   // Flush is reentry state.
   setState(State::kFinishing);
 
+  // Sorts the buffered rows and writes the partitions one at a time.
+  if (sortedPartitionWrite_) {
+    memory::NonReclaimableSectionGuard guard(
+        sortedPartitionNonReclaimableSection_.get());
+    return sortedPartitionWriter_->finish();
+  }
+
   // As for now, only sorted writer needs flush buffered data. For non-sorted
   // writer, data is directly written to the underlying file writer.
   if (!sortWrite()) {
@@ -712,13 +876,23 @@ void HiveDataSink::closeInternal() {
   TestValue::adjust(
       "facebook::velox::connector::hive::HiveDataSink::closeInternal", this);
 
+  if (sortedPartitionWriter_ != nullptr) {
+    memory::NonReclaimableSectionGuard guard(
+        sortedPartitionNonReclaimableSection_.get());
+    if (state_ == State::kClosed) {
+      sortedPartitionWriter_->close();
+    } else {
+      sortedPartitionWriter_->abort();
+    }
+  }
+
   if (state_ == State::kClosed) {
-    for (int i = 0; i < writers_.size(); ++i) {
+    for (int i = numClosedWriters_; i < writers_.size(); ++i) {
       WRITER_NON_RECLAIMABLE_SECTION_GUARD(i);
       writers_[i]->close();
     }
   } else {
-    for (int i = 0; i < writers_.size(); ++i) {
+    for (int i = numClosedWriters_; i < writers_.size(); ++i) {
       WRITER_NON_RECLAIMABLE_SECTION_GUARD(i);
       writers_[i]->abort();
     }
@@ -736,14 +910,21 @@ uint32_t HiveDataSink::ensureWriter(const HiveWriterId& id) {
 uint32_t HiveDataSink::appendWriter(const HiveWriterId& id) {
   // Check max open writers.
   VELOX_USER_CHECK_LE(
-      writers_.size(), maxOpenWriters_, "Exceeded open writer limit");
+      writers_.size() - numClosedWriters_,
+      maxOpenWriters_,
+      "Exceeded open writer limit");
   VELOX_CHECK_EQ(writers_.size(), writerInfo_.size());
   VELOX_CHECK_EQ(writerIndexMap_.size(), writerInfo_.size());
 
   std::optional<std::string> partitionName;
   if (isPartitioned()) {
-    partitionName =
-        partitionIdGenerator_->partitionName(id.partitionId.value());
+    // A sorted partition write opens the writer of 'sortedPartitionKeys_'.
+    partitionName = sortedPartitionWrite_
+        ? FileUtils::makePartName(
+              extractPartitionKeyValues(sortedPartitionKeys_, 0),
+              hiveConfig_->isPartitionPathAsLowerCase(
+                  connectorQueryCtx_->sessionProperties()))
+        : partitionIdGenerator_->partitionName(id.partitionId.value());
   }
 
   // Without explicitly setting flush policy, the default memory based flush
@@ -583,6 +583,10 @@ class HiveDataSink : public DataSink {
     io::IoStatistics* const ioStats_;
   };
 
+  // Receives the rows of a sorted partition write from the sort buffer in the
+  // order of the partition keys and passes them to writeSortedPartitions().
+  class SortedPartitionWriter;
+
   FOLLY_ALWAYS_INLINE bool sortWrite() const {
     return !sortColumnIndices_.empty();
   }
@@ -608,9 +612,29 @@ class HiveDataSink : public DataSink {
       HiveWriterInfo* writerInfo,
       io::IoStatistics* ioStats);
 
+  // Checks that the partition keys of 'input' are not null unless null
+  // partition keys are allowed.
+  void checkPartitionKeys(const RowVectorPtr& input) const;
+
   // Compute the partition id and bucket id for each row in 'input'.
   void computePartitionAndBucketIds(const RowVectorPtr& input);
 
+  // Creates the sort buffer writer of a sorted partition write.
+  void createSortedPartitionWriter();
+
+  // Writes 'input' sorted by the partition keys. A row with partition keys
+  // different from the open writer closes it and opens the writer of the next
+  // partition.
+  void writeSortedPartitions(const RowVectorPtr& input);
+
+  // Returns true if 'row' of 'input' has the partition keys of the open writer
+  // of a sorted partition write.
+  bool inSortedPartition(const RowVectorPtr& input, vector_size_t row) const;
+
+  // Closes the open writer of a sorted partition write, if any, and opens a
+  // writer for the partition keys of 'row' in 'input'.
+  void startSortedPartition(const RowVectorPtr& input, vector_size_t row);
+
   // Get the HiveWriter corresponding to the row
   // from partitionIds and bucketIds.
   FOLLY_ALWAYS_INLINE HiveWriterId getWriterId(size_t row) const;
@@ -666,6 +690,10 @@ class HiveDataSink : public DataSink {
   const HiveWriterParameters::UpdateMode updateMode_;
   const uint32_t maxOpenWriters_;
   const std::vector<column_index_t> partitionChannels_;
+  // True if the rows of a partitioned table without buckets are sorted by the
+  // partition keys and written one partition at a time. See
+  // HiveConfig::kSortedPartitionWrite.
+  const bool sortedPartitionWrite_;
   const std::unique_ptr<PartitionIdGenerator> partitionIdGenerator_;
   // Indices of dataChannel are stored in ascending order
   const std::vector<column_index_t> dataChannels_;
@@ -706,6 +734,20 @@ class HiveDataSink : public DataSink {
 
   // Strategy for naming writer files
   std::shared_ptr<const FileNameGenerator> fileNameGenerator_;
+
+  // Below are structures of a sorted partition write. The rows are buffered in
+  // a spillable sort buffer owned by 'sortedPartitionWriter_' and sorted by
+  // the partition keys on finish. The partition keys of the open writer are
+  // the single row of 'sortedPartitionKeys_'.
+  std::shared_ptr<memory::MemoryPool> sortedPartitionPool_;
+  std::shared_ptr<memory::MemoryPool> sortedPartitionSortPool_;
+  std::unique_ptr<tsan_atomic<bool>> sortedPartitionNonReclaimableSection_;
+  std::unique_ptr<folly::Synchronized<common::SpillStats>>
+      sortedPartitionSpillStats_;
+  std::unique_ptr<dwio::common::Writer> sortedPartitionWriter_;
+  RowVectorPtr sortedPartitionKeys_;
+  // The number of leading 'writers_' closed by a sorted partition write.
+  uint32_t numClosedWriters_{0};
 };
 
 FOLLY_ALWAYS_INLINE std::ostream& operator<<(
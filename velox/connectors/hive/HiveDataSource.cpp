@@ -54,6 +54,79 @@ bool shouldEagerlyMaterialize(
   return false;
 }
 
+void flattenConjuncts(
+    const core::TypedExprPtr& expr,
+    std::vector<core::TypedExprPtr>& conjuncts) {
+  auto* call = dynamic_cast<const core::CallTypedExpr*>(expr.get());
+  if (call != nullptr && call->name() == "and") {
+    for (const auto& input : call->inputs()) {
+      flattenConjuncts(input, conjuncts);
+    }
+    return;
+  }
+  conjuncts.push_back(expr);
+}
+
+core::TypedExprPtr makeConjunction(std::vector<core::TypedExprPtr> conjuncts) {
+  if (conjuncts.empty()) {
+    return nullptr;
+  }
+  if (conjuncts.size() == 1) {
+    return conjuncts[0];
+  }
+  return std::make_shared<core::CallTypedExpr>(
+      BOOLEAN(), std::move(conjuncts), "and");
+}
+
+// Evaluates the remaining filter conjuncts pushed down into the file reader.
+class ReaderExpressionFilter : public common::ExpressionFilter {
+ public:
+  ReaderExpressionFilter(
+      std::unique_ptr<exec::ExprSet> exprSet,
+      core::ExpressionEvaluator* evaluator,
+      std::atomic<uint64_t>* totalFilterTimeNs)
+      : exprSet_(std::move(exprSet)),
+        evaluator_(evaluator),
+        totalFilterTimeNs_(totalFilterTimeNs) {
+    for (auto* field : exprSet_->expr(0)->distinctFields()) {
+      inputs_.push_back(field->field());
+    }
+  }
+
+  const std::vector<std::string>& inputs() const override {
+    return inputs_;
+  }
+
+  void filter(const RowVectorPtr& input, std::vector<vector_size_t>& passed)
+      override {
+    uint64_t filterTimeUs{0};
+    {
+      MicrosecondTimer timer(&filterTimeUs);
+      rows_.resize(input->size());
+      rows_.setAll();
+      evaluator_->evaluate(exprSet_.get(), rows_, *input, result_);
+      decoded_.decode(*result_, rows_);
+      passed.clear();
+      for (vector_size_t row = 0; row < input->size(); ++row) {
+        if (!decoded_.isNullAt(row) && decoded_.valueAt<bool>(row)) {
+          passed.push_back(row);
+        }
+      }
+    }
+    totalFilterTimeNs_->fetch_add(
+        filterTimeUs * 1000, std::memory_order_relaxed);
+  }
+
+ private:
+  const std::unique_ptr<exec::ExprSet> exprSet_;
+  core::ExpressionEvaluator* const evaluator_;
+  std::atomic<uint64_t>* const totalFilterTimeNs_;
+  std::vector<std::string> inputs_;
+  SelectivityVector rows_;
+  VectorPtr result_;
+  DecodedVector decoded_;
+};
+
 } // namespace
 
 HiveDataSource::HiveDataSource(
@@ -141,6 +214,17 @@ HiveDataSource::HiveDataSource(
   if (sampleRate != 1) {
     randomSkip_ = std::make_shared<random::RandomSkipTracker>(sampleRate);
   }
+  // The metadata filter uses all conjuncts, including those evaluated by the
+  // file reader.
+  const auto metadataFilterExpr = remainingFilter;
+
+  std::unique_ptr<exec::ExprSet> readerFilterExprSet;
+  if (remainingFilter &&
+      hiveConfig_->readExpressionFilterPushdown(
+          connectorQueryCtx->sessionProperties())) {
+    readerFilterExprSet =
+        extractReaderFilter(remainingFilter, readColumnNames, readColumnTypes);
+  }
 
   if (remainingFilter) {
     remainingFilterExprSet_ = expressionEvaluator_->compile(remainingFilter);
@@ -197,15 +281,73 @@ HiveDataSource::HiveDataSource(
       hiveConfig_->readStatsBasedFilterReorderDisabled(
           connectorQueryCtx_->sessionProperties()),
       pool_);
-  if (remainingFilter) {
+  if (readerFilterExprSet) {
+    scanSpec_->setExpressionFilter(std::make_shared<ReaderExpressionFilter>(
+        std::move(readerFilterExprSet),
+        expressionEvaluator_,
+        &totalRemainingFilterTime_));
+  }
+  if (metadataFilterExpr) {
     metadataFilter_ = std::make_shared<common::MetadataFilter>(
-        *scanSpec_, *remainingFilter, expressionEvaluator_);
+        *scanSpec_, *metadataFilterExpr, expressionEvaluator_);
   }
 
   ioStats_ = std::make_shared<io::IoStatistics>();
   fsStats_ = std::make_shared<filesystems::File::IoStats>();
 }
 
+std::unique_ptr<exec::ExprSet> HiveDataSource::extractReaderFilter(
+    core::TypedExprPtr& remainingFilter,
+    std::vector<std::string>& readColumnNames,
+    std::vector<TypePtr>& readColumnTypes) {
+  std::vector<core::TypedExprPtr> conjuncts;
+  flattenConjuncts(remainingFilter, conjuncts);
+
+  // A conjunct can run in the reader if it is deterministic and reads only
+  // scalar columns that come from the file.
+  auto canPushDown = [&](const exec::Expr& expr) {
+    if (!expr.isDeterministic() || expr.distinctFields().empty()) {
+      return false;
+    }
+    for (auto* field : expr.distinctFields()) {
+      const auto& name = field->field();
+      if (!field->type()->isPrimitiveType() || partitionKeys_.count(name) ||
+          infoColumns_.count(name) || name == specialColumns_.rowIndex ||
+          name == specialColumns_.rowId) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  std::vector<core::TypedExprPtr> pushed;
+  std::vector<core::TypedExprPtr> kept;
+  for (auto& conjunct : conjuncts) {
+    auto exprSet = expressionEvaluator_->compile(conjunct);
+    if (canPushDown(*exprSet->expr(0))) {
+      pushed.push_back(std::move(conjunct));
+    } else {
+      kept.push_back(std::move(conjunct));
+    }
+  }
+  if (pushed.empty()) {
+    return nullptr;
+  }
+  remainingFilter = makeConjunction(std::move(kept));
+
+  auto exprSet = expressionEvaluator_->compile(makeConjunction(pushed));
+  // The reader needs the filter inputs as projected columns.
+  for (auto* field : exprSet->expr(0)->distinctFields()) {
+    if (std::find(
+            readColumnNames.begin(), readColumnNames.end(), field->field()) ==
+        readColumnNames.end()) {
+      readColumnNames.push_back(field->field());
+      readColumnTypes.push_back(field->type());
+    }
+  }
+  return exprSet;
+}
+
 std::unique_ptr<SplitReader> HiveDataSource::createSplitReader() {
   return SplitReader::create(
       split_,
@@ -308,6 +450,7 @@ void HiveDataSource::addSplit(std::shared_ptr<ConnectorSplit> split) {
   if (splitReader_) {
     splitReader_.reset();
   }
+  splitHasBatch_ = false;
 
   std::vector<column_index_t> bucketChannels;
   if (split_->bucketConversion.has_value()) {
@@ -323,6 +466,11 @@ void HiveDataSource::addSplit(std::shared_ptr<ConnectorSplit> split) {
   }
   // Split reader subclasses may need to use the reader options in prepareSplit
   // so we initialize it beforehand.
+  if (limitCountsScannedRows()) {
+    // The limit is reached within a known number of rows. Do not read ahead
+    // of them.
+    splitReader_->disablePrefetch();
+  }
   splitReader_->configureReaderOptions(randomSkip_);
   splitReader_->prepareSplit(metadataFilter_, runtimeStats_);
   readerOutputType_ = splitReader_->readerOutputType();
@@ -342,6 +490,20 @@ std::optional<RowVectorPtr> HiveDataSource::next(
     return nullptr;
   }
 
+  if (remainingLimit_.has_value()) {
+    if (*remainingLimit_ == 0) {
+      // The consumer has all the rows it needs. Free the readers to cancel
+      // their outstanding loads.
+      splitReader_->updateRuntimeStats(runtimeStats_);
+      resetSplit();
+      splitReader_.reset();
+      return nullptr;
+    }
+    if (limitCountsScannedRows()) {
+      size = std::min(size, *remainingLimit_);
+    }
+  }
+
   // Bucket conversion or delta update could add extra column to reader output.
   auto needsExtraColumn = [&] {
     return output_->asUnchecked<RowVector>()->childrenSize() <
@@ -353,6 +515,7 @@ std::optional<RowVectorPtr> HiveDataSource::next(
 
   const auto rowsScanned = splitReader_->next(size, output_);
   completedRows_ += rowsScanned;
+  splitHasBatch_ = true;
   if (rowsScanned == 0) {
     splitReader_->updateRuntimeStats(runtimeStats_);
     resetSplit();
@@ -390,6 +553,10 @@ std::optional<RowVectorPtr> HiveDataSource::next(
     }
   }
 
+  if (remainingLimit_.has_value()) {
+    *remainingLimit_ -= std::min<uint64_t>(*remainingLimit_, rowsRemaining);
+  }
+
   if (outputType_->size() == 0) {
     return exec::wrap(rowsRemaining, remainingIndices, rowVector);
   }
@@ -411,6 +578,12 @@ std::optional<RowVectorPtr> HiveDataSource::next(
       pool_, outputType_, BufferPtr(nullptr), rowsRemaining, outputColumns);
 }
 
+bool HiveDataSource::limitCountsScannedRows() const {
+  return remainingLimit_.has_value() && remainingFilterExprSet_ == nullptr &&
+      !scanSpec_->hasFilter() && randomSkip_ == nullptr &&
+      !(split_ != nullptr && split_->bucketConversion.has_value());
+}
+
 void HiveDataSource::addDynamicFilter(
     column_index_t outputChannel,
     const std::shared_ptr<common::Filter>& filter) {
@@ -467,6 +640,31 @@ std::unordered_map<std::string, RuntimeCounter> HiveDataSource::runtimeStats() {
          RuntimeCounter(
              ioStats_->ramHit().sum(), RuntimeCounter::Unit::kBytes)});
   }
+  if (ioStats_->decompressedCacheHit().count() > 0) {
+    res.insert(
+        {"numDecompressedCacheHit",
+         RuntimeCounter(ioStats_->decompressedCacheHit().count())});
+    res.insert(
+        {"decompressedCacheHitBytes",
+         RuntimeCounter(
+             ioStats_->decompressedCacheHit().sum(),
+             RuntimeCounter::Unit::kBytes)});
+  }
+  if (ioStats_->offloadedDecompress().count() > 0) {
+    res.insert(
+        {"numOffloadedDecompress",
+         RuntimeCounter(ioStats_->offloadedDecompress().count())});
+    res.insert(
+        {"offloadedDecompressBytes",
+         RuntimeCounter(
+             ioStats_->offloadedDecompress().sum(),
+             RuntimeCounter::Unit::kBytes)});
+  }
+  if (ioStats_->offloadFallbackDecompress().count() > 0) {
+    res.insert(
+        {"numOffloadFallbackDecompress",
+         RuntimeCounter(ioStats_->offloadFallbackDecompress().count())});
+  }
   if (numBucketConversion_ > 0) {
     res.insert({"numBucketConversion", RuntimeCounter(numBucketConversion_)});
   }
@@ -494,6 +692,7 @@ void HiveDataSource::setFromDataSource(
   scanSpec_ = std::move(source->scanSpec_);
   splitReader_ = std::move(source->splitReader_);
   splitReader_->setConnectorQueryCtx(connectorQueryCtx_);
+  splitHasBatch_ = false;
   // New io will be accounted on the stats of 'source'. Add the existing
   // balance to that.
   source->ioStats_->merge(*ioStats_);
@@ -508,7 +707,22 @@ int64_t HiveDataSource::estimatedRowSize() {
   if (!splitReader_) {
     return kUnknownRowSize;
   }
-  return splitReader_->estimatedRowSize();
+  // The sizes of the values produced for the previous batches reflect the
+  // projected columns and their actual widths better than file statistics.
+  // Before the first batch of a split, the file statistics may show that the
+  // new file has wider rows than the previous ones.
+  const auto measured = scanSpec_->measuredRowSize();
+  if (measured.has_value() && splitHasBatch_) {
+    return measured.value();
+  }
+  const auto fileRowSize = splitReader_->estimatedRowSize();
+  if (!measured.has_value()) {
+    return fileRowSize;
+  }
+  if (fileRowSize == kUnknownRowSize) {
+    return measured.value();
+  }
+  return std::max<int64_t>(measured.value(), fileRowSize);
 }
 
 vector_size_t HiveDataSource::evaluateRemainingFilter(RowVectorPtr& rowVector) {
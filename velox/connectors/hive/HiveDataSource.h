@@ -68,6 +68,10 @@ class HiveDataSource : public DataSource {
 
   void setFromDataSource(std::unique_ptr<DataSource> sourceUnique) override;
 
+  void setLimit(uint64_t limit) override {
+    remainingLimit_ = limit;
+  }
+
   int64_t estimatedRowSize() override;
 
   const common::SubfieldFilters* getFilters() const override {
@@ -130,6 +134,15 @@ class HiveDataSource : public DataSource {
 
   void setupRowIdColumn();
 
+  // Moves the conjuncts of 'remainingFilter' that the file reader can
+  // evaluate into the returned ExprSet and adds their input columns to
+  // 'readColumnNames' and 'readColumnTypes'. Returns nullptr if there are
+  // none.
+  std::unique_ptr<exec::ExprSet> extractReaderFilter(
+      core::TypedExprPtr& remainingFilter,
+      std::vector<std::string>& readColumnNames,
+      std::vector<TypePtr>& readColumnTypes);
+
   // Evaluates remainingFilter_ on the specified vector. Returns number of rows
   // passed. Populates filterEvalCtx_.selectedIndices and selectedBits if only
   // some rows passed the filter. If none or all rows passed
@@ -140,6 +153,10 @@ class HiveDataSource : public DataSource {
   // hold adaptation.
   void resetSplit();
 
+  // True if a limit is set and every row read from the file is produced, so
+  // that scanning 'remainingLimit_' rows satisfies the limit.
+  bool limitCountsScannedRows() const;
+
   const RowVectorPtr& getEmptyOutput() {
     if (!emptyOutput_) {
       emptyOutput_ = RowVector::createEmpty(outputType_, pool_);
@@ -164,6 +181,10 @@ class HiveDataSource : public DataSource {
   dwio::common::RuntimeStatistics runtimeStats_;
   std::atomic<uint64_t> totalRemainingFilterTime_{0};
   uint64_t completedRows_ = 0;
+  // Rows the consumer still needs if it set a limit with setLimit().
+  std::optional<uint64_t> remainingLimit_;
+  // True once the current split has produced a batch.
+  bool splitHasBatch_{false};
 
   // Field indices referenced in both remaining filter and output type. These
   // columns need to be materialized eagerly to avoid missing values in output.
@@ -22,6 +22,7 @@
 #include "velox/connectors/hive/HiveConnectorUtil.h"
 #include "velox/connectors/hive/TableHandle.h"
 #include "velox/connectors/hive/iceberg/IcebergSplitReader.h"
+#include "velox/dwio/common/PrefetchUnitLoader.h"
 #include "velox/dwio/common/ReaderFactory.h"
 
 namespace facebook::velox::connector::hive {
@@ -154,6 +155,9 @@ void SplitReader::configureReaderOptions(
   baseReaderOpts_.setRandomSkip(std::move(randomSkip));
   baseReaderOpts_.setScanSpec(scanSpec_);
   baseReaderOpts_.setFileFormat(hiveSplit_->fileFormat);
+  if (!prefetch_) {
+    baseReaderOpts_.setPrefetchRowGroups(0);
+  }
 }
 
 void SplitReader::prepareSplit(
@@ -254,6 +258,7 @@ void SplitReader::updateRuntimeStats(
   if (baseRowReader_) {
     baseRowReader_->updateRuntimeStats(stats);
   }
+  stats.unitLoadWaitNanos += unitLoadWaitNanos_;
 }
 
 bool SplitReader::allPrefetchIssued() const {
@@ -320,6 +325,21 @@ void SplitReader::createReader() {
       fsStats_,
       executor_);
 
+  // The readers of the splits of the same version of a file share its parsed
+  // metadata. A file without modification time may change at the same path.
+  std::optional<dwio::common::FileMetadataCache::Key> metadataCacheKey;
+  if (dwio::common::FileMetadataCache::instance() != nullptr &&
+      hiveSplit_->properties.has_value() &&
+      hiveSplit_->properties->modificationTime.has_value()) {
+    metadataCacheKey = dwio::common::FileMetadataCache::Key{
+        hiveSplit_->filePath,
+        fmt::format(
+            "{}:{}",
+            hiveSplit_->properties->modificationTime.value(),
+            hiveSplit_->properties->fileSize.value_or(-1))};
+  }
+  baseReaderOpts_.setFileMetadataCacheKey(std::move(metadataCacheKey));
+
   baseReader_ = dwio::common::getReaderFactory(baseReaderOpts_.fileFormat())
                     ->createReader(std::move(baseFileInput), baseReaderOpts_);
   if (!baseReader_) {
@@ -379,6 +399,24 @@ void SplitReader::createRowReader(
       hiveConfig_,
       connectorQueryCtx_->sessionProperties(),
       baseRowReaderOpts_);
+  std::function<void(std::chrono::high_resolution_clock::duration)>
+      onUnitLoadWait = [this](auto duration) {
+        unitLoadWaitNanos_ +=
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration)
+                .count();
+      };
+  const auto* session = connectorQueryCtx_->sessionProperties();
+  const auto prefetchStripes = hiveConfig_->prefetchStripes(session);
+  if (executor_ != nullptr && prefetchStripes > 0 && prefetch_) {
+    baseRowReaderOpts_.setUnitLoaderFactory(
+        std::make_shared<dwio::common::PrefetchUnitLoaderFactory>(
+            executor_,
+            prefetchStripes,
+            hiveConfig_->prefetchStripesMaxBytes(session),
+            std::move(onUnitLoadWait)));
+  } else {
+    baseRowReaderOpts_.setBlockedOnIoCallback(std::move(onUnitLoadWait));
+  }
   baseRowReader_ = baseReader_->createRowReader(baseRowReaderOpts_);
 }
 
@@ -74,6 +74,13 @@ class SplitReader {
   void configureReaderOptions(
       std::shared_ptr<random::RandomSkipTracker> randomSkip);
 
+  /// Turns off prefetching of row groups and stripes ahead of the one being
+  /// read. Called before configureReaderOptions() when the consumer is
+  /// expected to stop early, e.g. under a small limit.
+  void disablePrefetch() {
+    prefetch_ = false;
+  }
+
   /// This function is used by different table formats like Iceberg and Hudi to
   /// do additional preparations before reading the split, e.g. Open delete
   /// files or log files, and add column adapatations for metadata columns. It
@@ -194,11 +201,15 @@ class SplitReader {
   dwio::common::ReaderOptions baseReaderOpts_;
   dwio::common::RowReaderOptions baseRowReaderOpts_;
   bool emptySplit_;
+  // Time the row reader waited for its stripes to load. Updated from the
+  // thread that creates the row reader, which may be a split preload thread.
+  std::atomic<int64_t> unitLoadWaitNanos_{0};
 
  private:
   folly::F14FastSet<column_index_t> bucketChannels_;
   std::unique_ptr<HivePartitionFunction> partitionFunction_;
   std::vector<uint32_t> partitions_;
+  bool prefetch_{true};
 };
 
 } // namespace facebook::velox::connector::hive
@@ -110,14 +110,16 @@ HiveTableHandle::HiveTableHandle(
     common::SubfieldFilters subfieldFilters,
     const core::TypedExprPtr& remainingFilter,
     const RowTypePtr& dataColumns,
-    const std::unordered_map<std::string, std::string>& tableParameters)
+    const std::unordered_map<std::string, std::string>& tableParameters,
+    std::vector<std::pair<std::string, core::SortOrder>> sortedBy)
     : ConnectorTableHandle(std::move(connectorId)),
       tableName_(tableName),
       filterPushdownEnabled_(filterPushdownEnabled),
       subfieldFilters_(std::move(subfieldFilters)),
       remainingFilter_(remainingFilter),
       dataColumns_(dataColumns),
-      tableParameters_(tableParameters) {}
+      tableParameters_(tableParameters),
+      sortedBy_(std::move(sortedBy)) {}
 
 std::string HiveTableHandle::toString() const {
   std::stringstream out;
@@ -159,6 +161,16 @@ std::string HiveTableHandle::toString() const {
     }
     out << "]";
   }
+  if (!sortedBy_.empty()) {
+    out << ", sorted by: [";
+    for (auto i = 0; i < sortedBy_.size(); ++i) {
+      if (i > 0) {
+        out << ", ";
+      }
+      out << sortedBy_[i].first << " " << sortedBy_[i].second.toString();
+    }
+    out << "]";
+  }
   return out.str();
 }
 
@@ -187,6 +199,16 @@ folly::dynamic HiveTableHandle::serialize() const {
     tableParameters[param.first] = param.second;
   }
   obj["tableParameters"] = tableParameters;
+  if (!sortedBy_.empty()) {
+    folly::dynamic sortedBy = folly::dynamic::array;
+    for (const auto& [column, sortOrder] : sortedBy_) {
+      folly::dynamic key = folly::dynamic::object;
+      key["column"] = column;
+      key["sortOrder"] = sortOrder.serialize();
+      sortedBy.push_back(key);
+    }
+    obj["sortedBy"] = sortedBy;
+  }
 
   return obj;
 }
@@ -226,6 +248,15 @@ ConnectorTableHandlePtr HiveTableHandle::create(
     tableParameters.emplace(key.asString(), value.asString());
   }
 
+  std::vector<std::pair<std::string, core::SortOrder>> sortedBy;
+  if (auto it = obj.find("sortedBy"); it != obj.items().end()) {
+    for (const auto& key : it->second) {
+      sortedBy.emplace_back(
+          key["column"].asString(),
+          core::SortOrder::deserialize(key["sortOrder"]));
+    }
+  }
+
   return std::make_shared<const HiveTableHandle>(
       connectorId,
       tableName,
@@ -233,7 +264,8 @@ ConnectorTableHandlePtr HiveTableHandle::create(
       std::move(subfieldFilters),
       remainingFilter,
       dataColumns,
-      tableParameters);
+      tableParameters,
+      std::move(sortedBy));
 }
 
 void HiveTableHandle::registerSerDe() {
@@ -17,6 +17,7 @@
 
 #include "velox/connectors/Connector.h"
 #include "velox/core/ITypedExpr.h"
+#include "velox/core/PlanNode.h"
 #include "velox/type/Filter.h"
 #include "velox/type/Subfield.h"
 #include "velox/type/Type.h"
@@ -145,7 +146,8 @@ class HiveTableHandle : public ConnectorTableHandle {
       common::SubfieldFilters subfieldFilters,
       const core::TypedExprPtr& remainingFilter,
       const RowTypePtr& dataColumns = nullptr,
-      const std::unordered_map<std::string, std::string>& tableParameters = {});
+      const std::unordered_map<std::string, std::string>& tableParameters = {},
+      std::vector<std::pair<std::string, core::SortOrder>> sortedBy = {});
 
   const std::string& tableName() const {
     return tableName_;
@@ -176,6 +178,16 @@ class HiveTableHandle : public ConnectorTableHandle {
     return tableParameters_;
   }
 
+  /// Columns and orders that the rows of each file of the table are sorted
+  /// on, from the table metadata, e.g. for tables written with sorted
+  /// bucketing. The scan returns the rows of a split in file order, so the
+  /// scans of several splits can be combined with a LocalMerge on these keys
+  /// instead of a full sort. Empty if the files are not known to be sorted.
+  const std::vector<std::pair<std::string, core::SortOrder>>& sortedBy()
+      const {
+    return sortedBy_;
+  }
+
   std::string toString() const override;
 
   folly::dynamic serialize() const override;
@@ -193,6 +205,7 @@ class HiveTableHandle : public ConnectorTableHandle {
   const core::TypedExprPtr remainingFilter_;
   const RowTypePtr dataColumns_;
   const std::unordered_map<std::string, std::string> tableParameters_;
+  const std::vector<std::pair<std::string, core::SortOrder>> sortedBy_;
 };
 
 using HiveTableHandlePtr = std::shared_ptr<const HiveTableHandle>;
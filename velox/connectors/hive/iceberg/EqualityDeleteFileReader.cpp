@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/connectors/hive/iceberg/EqualityDeleteFileReader.h"
+
+#include <folly/String.h>
+
+#include "velox/connectors/hive/HiveConnectorSplit.h"
+#include "velox/connectors/hive/HiveConnectorUtil.h"
+#include "velox/connectors/hive/iceberg/IcebergDeleteFile.h"
+#include "velox/dwio/common/FileMetadataCache.h"
+#include "velox/dwio/common/ReaderFactory.h"
+
+namespace facebook::velox::connector::hive::iceberg {
+
+EqualityDeleteFileReader::EqualityDeleteFileReader(
+    const IcebergDeleteFile& deleteFile,
+    RowTypePtr deleteType,
+    FileHandleFactory* fileHandleFactory,
+    const ConnectorQueryCtx* connectorQueryCtx,
+    folly::Executor* executor,
+    const std::shared_ptr<const HiveConfig>& hiveConfig,
+    const std::shared_ptr<io::IoStatistics>& ioStats,
+    const std::shared_ptr<filesystems::File::IoStats>& fsStats,
+    const std::string& connectorId)
+    : deleteFile_(deleteFile),
+      deleteType_(std::move(deleteType)),
+      fileHandleFactory_(fileHandleFactory),
+      connectorQueryCtx_(connectorQueryCtx),
+      executor_(executor),
+      hiveConfig_(hiveConfig),
+      ioStats_(ioStats),
+      fsStats_(fsStats),
+      connectorId_(connectorId) {
+  VELOX_CHECK(deleteFile_.content == FileContent::kEqualityDeletes);
+  VELOX_CHECK_GT(deleteType_->size(), 0);
+
+  auto* metadataCache = dwio::common::FileMetadataCache::instance();
+  if (metadataCache == nullptr) {
+    deleteSet_ = std::make_shared<EqualityDeleteSet>(
+        readDeletes(connectorQueryCtx_->memoryPool()));
+    return;
+  }
+
+  // Delete files are never rewritten, so the size identifies the content. The
+  // same file can be read with different equality columns.
+  const dwio::common::FileMetadataCache::Key key{
+      deleteFile_.filePath,
+      fmt::format(
+          "{}:{}",
+          deleteFile_.fileSizeInBytes,
+          folly::join(",", deleteType_->names()))};
+  deleteSet_ = metadataCache->get<EqualityDeleteSet>(key);
+  if (deleteSet_ != nullptr) {
+    return;
+  }
+  // The cached rows outlive the query, so they are read with a pool that is
+  // not owned by the query.
+  deleteSet_ = std::make_shared<EqualityDeleteSet>(
+      readDeletes(&memory::deprecatedSharedLeafPool()));
+  metadataCache->put(key, deleteSet_, deleteSet_->memoryUsage());
+}
+
+RowVectorPtr EqualityDeleteFileReader::readDeletes(memory::MemoryPool* pool) {
+  constexpr uint64_t kReadBatchSize = 10'000;
+
+  auto scanSpec = std::make_shared<common::ScanSpec>("<root>");
+  for (auto i = 0; i < deleteType_->size(); ++i) {
+    scanSpec->addFieldRecursively(
+        deleteType_->nameOf(i), *deleteType_->childAt(i), i);
+  }
+
+  auto deleteSplit = std::make_shared<HiveConnectorSplit>(
+      connectorId_,
+      deleteFile_.filePath,
+      deleteFile_.fileFormat,
+      0,
+      deleteFile_.fileSizeInBytes);
+
+  dwio::common::ReaderOptions deleteReaderOpts(pool);
+  configureReaderOptions(
+      hiveConfig_,
+      connectorQueryCtx_,
+      deleteType_,
+      deleteSplit,
+      /*tableParameters=*/{},
+      deleteReaderOpts);
+
+  const FileHandleKey fileHandleKey{
+      .filename = deleteFile_.filePath,
+      .tokenProvider = connectorQueryCtx_->fsTokenProvider()};
+  auto deleteFileHandle = fileHandleFactory_->generate(fileHandleKey);
+  auto deleteFileInput = createBufferedInput(
+      *deleteFileHandle,
+      deleteReaderOpts,
+      connectorQueryCtx_,
+      ioStats_,
+      fsStats_,
+      executor_);
+  auto deleteReader =
+      dwio::common::getReaderFactory(deleteReaderOpts.fileFormat())
+          ->createReader(std::move(deleteFileInput), deleteReaderOpts);
+
+  dwio::common::RowReaderOptions deleteRowReaderOpts;
+  configureRowReaderOptions(
+      {},
+      scanSpec,
+      nullptr,
+      deleteType_,
+      deleteSplit,
+      nullptr,
+      nullptr,
+      deleteRowReaderOpts);
+  auto deleteRowReader = deleteReader->createRowReader(deleteRowReaderOpts);
+
+  auto deletes = BaseVector::create<RowVector>(deleteType_, 0, pool);
+  VectorPtr batch = BaseVector::create(deleteType_, 0, pool);
+  while (deleteRowReader->next(kReadBatchSize, batch) > 0) {
+    if (batch->size() > 0) {
+      batch->loadedVector();
+      deletes->append(batch.get());
+    }
+  }
+  return deletes;
+}
+
+} // namespace facebook::velox::connector::hive::iceberg
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <folly/Executor.h>
+#include <memory>
+
+#include "velox/connectors/Connector.h"
+#include "velox/connectors/hive/FileHandle.h"
+#include "velox/connectors/hive/HiveConfig.h"
+#include "velox/connectors/hive/iceberg/EqualityDeleteSet.h"
+
+namespace facebook::velox::connector::hive::iceberg {
+
+struct IcebergDeleteFile;
+
+/// Reads the rows of an Iceberg equality delete file into an
+/// EqualityDeleteSet. The set is shared through the FileMetadataCache when it
+/// is enabled, so that the delete file is read once for all the splits that
+/// apply it.
+class EqualityDeleteFileReader {
+ public:
+  /// 'deleteType' has the names and types of the equality columns to read
+  /// from the delete file.
+  EqualityDeleteFileReader(
+      const IcebergDeleteFile& deleteFile,
+      RowTypePtr deleteType,
+      FileHandleFactory* fileHandleFactory,
+      const ConnectorQueryCtx* connectorQueryCtx,
+      folly::Executor* executor,
+      const std::shared_ptr<const HiveConfig>& hiveConfig,
+      const std::shared_ptr<io::IoStatistics>& ioStats,
+      const std::shared_ptr<filesystems::File::IoStats>& fsStats,
+      const std::string& connectorId);
+
+  const std::shared_ptr<const EqualityDeleteSet>& deleteSet() const {
+    return deleteSet_;
+  }
+
+ private:
+  RowVectorPtr readDeletes(memory::MemoryPool* pool);
+
+  const IcebergDeleteFile& deleteFile_;
+  const RowTypePtr deleteType_;
+  FileHandleFactory* const fileHandleFactory_;
+  const ConnectorQueryCtx* const connectorQueryCtx_;
+  folly::Executor* const executor_;
+  const std::shared_ptr<const HiveConfig> hiveConfig_;
+  const std::shared_ptr<io::IoStatistics> ioStats_;
+  const std::shared_ptr<filesystems::File::IoStats> fsStats_;
+  const std::string connectorId_;
+
+  std::shared_ptr<const EqualityDeleteSet> deleteSet_;
+};
+
+} // namespace facebook::velox::connector::hive::iceberg
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/connectors/hive/iceberg/EqualityDeleteSet.h"
+
+#include "velox/exec/VectorHasher.h"
+#include "velox/vector/DecodedVector.h"
+
+namespace facebook::velox::connector::hive::iceberg {
+
+namespace {
+
+constexpr vector_size_t kNoRow = -1;
+
+int64_t integerAt(const DecodedVector& decoded, vector_size_t row) {
+  switch (decoded.base()->typeKind()) {
+    case TypeKind::TINYINT:
+      return decoded.valueAt<int8_t>(row);
+    case TypeKind::SMALLINT:
+      return decoded.valueAt<int16_t>(row);
+    case TypeKind::INTEGER:
+      return decoded.valueAt<int32_t>(row);
+    case TypeKind::BIGINT:
+      return decoded.valueAt<int64_t>(row);
+    default:
+      VELOX_UNREACHABLE();
+  }
+}
+
+// Computes the hashes of the 'keys' of 'rows' into 'hashes', combining the
+// keys the same way for the delete rows and the data rows.
+void hashKeys(
+    const std::vector<const BaseVector*>& keys,
+    const SelectivityVector& rows,
+    raw_vector<uint64_t>& hashes) {
+  hashes.resize(rows.end());
+  for (auto i = 0; i < keys.size(); ++i) {
+    exec::VectorHasher hasher(keys[i]->type(), i);
+    hasher.decode(*keys[i], rows);
+    hasher.hash(rows, i > 0, hashes);
+  }
+}
+
+} // namespace
+
+EqualityDeleteSet::EqualityDeleteSet(RowVectorPtr deletes)
+    : deletes_(std::move(deletes)) {
+  VELOX_CHECK_NOT_NULL(deletes_);
+  VELOX_CHECK_GT(deletes_->childrenSize(), 0);
+  if (!isIntegerKey(*deletes_->rowType())) {
+    buildHashTable();
+    return;
+  }
+  SelectivityVector allRows(deletes_->size());
+  DecodedVector decoded(*deletes_->childAt(0), allRows);
+  integerKeys_.reserve(deletes_->size());
+  for (vector_size_t row = 0; row < deletes_->size(); ++row) {
+    if (decoded.isNullAt(row)) {
+      hasNullKey_ = true;
+    } else {
+      integerKeys_.insert(integerAt(decoded, row));
+    }
+  }
+}
+
+// static
+bool EqualityDeleteSet::isIntegerKey(const RowType& type) {
+  if (type.size() != 1) {
+    return false;
+  }
+  switch (type.childAt(0)->kind()) {
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void EqualityDeleteSet::buildHashTable() {
+  std::vector<const BaseVector*> keys;
+  for (const auto& child : deletes_->children()) {
+    keys.push_back(child->loadedVector());
+  }
+  SelectivityVector allRows(deletes_->size());
+  raw_vector<uint64_t> hashes;
+  hashKeys(keys, allRows, hashes);
+
+  firstRow_.reserve(deletes_->size());
+  nextRow_.resize(deletes_->size(), kNoRow);
+  for (vector_size_t row = 0; row < deletes_->size(); ++row) {
+    auto [it, inserted] = firstRow_.emplace(hashes[row], row);
+    if (!inserted) {
+      nextRow_[row] = it->second;
+      it->second = row;
+    }
+  }
+}
+
+vector_size_t EqualityDeleteSet::apply(
+    const RowVector& input,
+    const std::vector<column_index_t>& keyChannels,
+    SelectivityVector& rows) const {
+  VELOX_CHECK_EQ(keyChannels.size(), deletes_->childrenSize());
+  if (deletes_->size() == 0 || !rows.hasSelections()) {
+    return 0;
+  }
+  vector_size_t numDeleted;
+  if (isIntegerKey(*deletes_->rowType())) {
+    numDeleted = applyIntegerKey(*input.childAt(keyChannels[0]), rows);
+  } else {
+    numDeleted = applyHashTable(input, keyChannels, rows);
+  }
+  if (numDeleted > 0) {
+    rows.updateBounds();
+  }
+  return numDeleted;
+}
+
+vector_size_t EqualityDeleteSet::applyIntegerKey(
+    const BaseVector& input,
+    SelectivityVector& rows) const {
+  DecodedVector decoded(input, rows);
+  vector_size_t numDeleted = 0;
+  rows.applyToSelected([&](auto row) {
+    const bool deleted = decoded.isNullAt(row)
+        ? hasNullKey_
+        : integerKeys_.count(integerAt(decoded, row)) > 0;
+    if (deleted) {
+      rows.setValid(row, false);
+      ++numDeleted;
+    }
+  });
+  return numDeleted;
+}
+
+vector_size_t EqualityDeleteSet::applyHashTable(
+    const RowVector& input,
+    const std::vector<column_index_t>& keyChannels,
+    SelectivityVector& rows) const {
+  std::vector<const BaseVector*> keys;
+  for (auto channel : keyChannels) {
+    keys.push_back(input.childAt(channel)->loadedVector());
+  }
+  raw_vector<uint64_t> hashes;
+  hashKeys(keys, rows, hashes);
+
+  auto equalKeys = [&](vector_size_t row, vector_size_t deleteRow) {
+    for (auto i = 0; i < keys.size(); ++i) {
+      if (!keys[i]->equalValueAt(
+              deletes_->childAt(i).get(), row, deleteRow)) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  vector_size_t numDeleted = 0;
+  rows.applyToSelected([&](auto row) {
+    auto it = firstRow_.find(hashes[row]);
+    if (it == firstRow_.end()) {
+      return;
+    }
+    for (auto deleteRow = it->second; deleteRow != kNoRow;
+         deleteRow = nextRow_[deleteRow]) {
+      if (equalKeys(row, deleteRow)) {
+        rows.setValid(row, false);
+        ++numDeleted;
+        return;
+      }
+    }
+  });
+  return numDeleted;
+}
+
+uint64_t EqualityDeleteSet::memoryUsage() const {
+  return sizeof(*this) + deletes_->retainedSize() +
+      integerKeys_.getAllocatedMemorySize() +
+      firstRow_.getAllocatedMemorySize() +
+      nextRow_.capacity() * sizeof(vector_size_t);
+}
+
+} // namespace facebook::velox::connector::hive::iceberg
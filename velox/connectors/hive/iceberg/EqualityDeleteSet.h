@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <folly/container/F14Map.h>
+#include <folly/container/F14Set.h>
+
+#include "velox/vector/ComplexVector.h"
+#include "velox/vector/SelectivityVector.h"
+
+namespace facebook::velox::connector::hive::iceberg {
+
+/// The rows of an Iceberg equality delete file. A data row is deleted when
+/// its values of the equality columns are equal to the values of a delete
+/// row, where null is equal to null. A single integer column is kept as a set
+/// of its values. Other keys are kept in a hash table over the delete rows,
+/// probed like a hash join build side. The set is immutable after
+/// construction so that the splits reading the same delete file can share it
+/// through the FileMetadataCache.
+class EqualityDeleteSet {
+ public:
+  /// 'deletes' has the equality columns of the delete rows. The set keeps a
+  /// reference to it.
+  explicit EqualityDeleteSet(RowVectorPtr deletes);
+
+  /// Clears the bits of the deleted rows in 'rows'. 'keyChannels' are the
+  /// channels of the equality columns in 'input' in the order of the columns
+  /// of the delete rows. Returns the number of deleted rows.
+  vector_size_t apply(
+      const RowVector& input,
+      const std::vector<column_index_t>& keyChannels,
+      SelectivityVector& rows) const;
+
+  /// Returns the number of delete rows.
+  vector_size_t size() const {
+    return deletes_->size();
+  }
+
+  uint64_t memoryUsage() const;
+
+ private:
+  static bool isIntegerKey(const RowType& type);
+
+  void buildHashTable();
+
+  vector_size_t applyIntegerKey(
+      const BaseVector& input,
+      SelectivityVector& rows) const;
+
+  vector_size_t applyHashTable(
+      const RowVector& input,
+      const std::vector<column_index_t>& keyChannels,
+      SelectivityVector& rows) const;
+
+  const RowVectorPtr deletes_;
+
+  // The values of a single TINYINT, SMALLINT, INTEGER or BIGINT key.
+  folly::F14FastSet<int64_t> integerKeys_;
+  bool hasNullKey_{false};
+
+  // The first delete row with a hash for other keys. The other rows with the
+  // same hash are chained through 'nextRow_'.
+  folly::F14FastMap<uint64_t, vector_size_t> firstRow_;
+  std::vector<vector_size_t> nextRow_;
+};
+
+} // namespace facebook::velox::connector::hive::iceberg
@@ -16,6 +16,7 @@
 
 #include "velox/connectors/hive/iceberg/IcebergSplitReader.h"
 
+#include "velox/connectors/hive/iceberg/EqualityDeleteFileReader.h"
 #include "velox/connectors/hive/iceberg/IcebergDeleteFile.h"
 #include "velox/connectors/hive/iceberg/IcebergSplit.h"
 #include "velox/dwio/common/BufferUtil.h"
@@ -59,6 +60,9 @@ void IcebergSplitReader::prepareSplit(
   if (emptySplit_) {
     return;
   }
+  std::shared_ptr<const HiveIcebergSplit> icebergSplit =
+      std::dynamic_pointer_cast<const HiveIcebergSplit>(hiveSplit_);
+  prepareEqualityDeletes(icebergSplit->deleteFiles);
   auto rowType = getAdaptedRowType();
 
   if (checkIfSplitIsEmpty(runtimeStats)) {
@@ -68,8 +72,6 @@ void IcebergSplitReader::prepareSplit(
 
   createRowReader(std::move(metadataFilter), std::move(rowType));
 
-  std::shared_ptr<const HiveIcebergSplit> icebergSplit =
-      std::dynamic_pointer_cast<const HiveIcebergSplit>(hiveSplit_);
   baseReadOffset_ = 0;
   splitOffset_ = baseRowReader_->nextRowNumber();
   positionalDeleteFileReaders_.clear();
@@ -93,11 +95,101 @@ void IcebergSplitReader::prepareSplit(
                 hiveSplit_->connectorId));
       }
     } else {
-      VELOX_NYI();
+      VELOX_CHECK(deleteFile.content == FileContent::kEqualityDeletes);
+    }
+  }
+}
+
+void IcebergSplitReader::prepareEqualityDeletes(
+    const std::vector<IcebergDeleteFile>& deleteFiles) {
+  equalityDeletes_.clear();
+  equalityDeleteChannels_.clear();
+  for (const auto& deleteFile : deleteFiles) {
+    if (deleteFile.content != FileContent::kEqualityDeletes ||
+        deleteFile.recordCount == 0) {
+      continue;
+    }
+    VELOX_CHECK(
+        !deleteFile.equalityFieldIds.empty(),
+        "Iceberg equality delete file has no equality field ids: {}",
+        deleteFile.filePath);
+    const auto& dataColumns = hiveTableHandle_->dataColumns();
+    VELOX_CHECK_NOT_NULL(
+        dataColumns, "Iceberg equality deletes require the data columns");
+
+    // The field ids of the top level columns are their 1-based positions in
+    // the table schema.
+    std::vector<std::string> names;
+    std::vector<TypePtr> types;
+    std::vector<column_index_t> channels;
+    for (auto fieldId : deleteFile.equalityFieldIds) {
+      VELOX_CHECK(
+          fieldId > 0 && fieldId <= dataColumns->size(),
+          "Invalid Iceberg equality field id: {}",
+          fieldId);
+      const auto& name = dataColumns->nameOf(fieldId - 1);
+      const auto& type = dataColumns->childAt(fieldId - 1);
+      auto channel = readerOutputType_->getChildIdxIfExists(name);
+      if (!channel.has_value()) {
+        channel = readerOutputType_->size();
+        auto outputNames = readerOutputType_->names();
+        auto outputTypes = readerOutputType_->children();
+        outputNames.push_back(name);
+        outputTypes.push_back(type);
+        readerOutputType_ =
+            ROW(std::move(outputNames), std::move(outputTypes));
+        scanSpec_->addFieldRecursively(name, *type, *channel);
+      }
+      names.push_back(name);
+      types.push_back(type);
+      channels.push_back(*channel);
     }
+
+    EqualityDeleteFileReader reader(
+        deleteFile,
+        ROW(std::move(names), std::move(types)),
+        fileHandleFactory_,
+        connectorQueryCtx_,
+        executor_,
+        hiveConfig_,
+        ioStats_,
+        fsStats_,
+        hiveSplit_->connectorId);
+    equalityDeletes_.push_back(reader.deleteSet());
+    equalityDeleteChannels_.push_back(std::move(channels));
   }
 }
 
+void IcebergSplitReader::applyEqualityDeletes(VectorPtr& output) {
+  auto* input = output->asChecked<RowVector>();
+  equalityDeleteRows_.resizeFill(input->size(), true);
+  vector_size_t numDeleted = 0;
+  for (auto i = 0; i < equalityDeletes_.size(); ++i) {
+    numDeleted += equalityDeletes_[i]->apply(
+        *input, equalityDeleteChannels_[i], equalityDeleteRows_);
+  }
+  if (numDeleted == 0) {
+    return;
+  }
+
+  // Copies the remaining rows in runs as in the bucket conversion.
+  std::vector<BaseVector::CopyRange> ranges;
+  vector_size_t numRemaining = 0;
+  equalityDeleteRows_.applyToSelected([&](auto row) {
+    if (!ranges.empty() &&
+        ranges.back().sourceIndex + ranges.back().count == row) {
+      ++ranges.back().count;
+    } else {
+      ranges.push_back({row, numRemaining, 1});
+    }
+    ++numRemaining;
+  });
+  auto remaining =
+      BaseVector::create(output->type(), numRemaining, output->pool());
+  remaining->copyRanges(output.get(), ranges);
+  output = std::move(remaining);
+}
+
 uint64_t IcebergSplitReader::next(uint64_t size, VectorPtr& output) {
   Mutation mutation;
   mutation.randomSkip = baseReaderOpts_.randomSkip().get();
@@ -138,6 +230,10 @@ uint64_t IcebergSplitReader::next(uint64_t size, VectorPtr& output) {
   auto rowsScanned = baseRowReader_->next(actualSize, output, &mutation);
   baseReadOffset_ += rowsScanned;
 
+  if (rowsScanned > 0 && output->size() > 0 && !equalityDeletes_.empty()) {
+    applyEqualityDeletes(output);
+  }
+
   return rowsScanned;
 }
 
@@ -18,6 +18,7 @@
 
 #include "velox/connectors/Connector.h"
 #include "velox/connectors/hive/SplitReader.h"
+#include "velox/connectors/hive/iceberg/EqualityDeleteSet.h"
 #include "velox/connectors/hive/iceberg/PositionalDeleteFileReader.h"
 
 namespace facebook::velox::connector::hive::iceberg {
@@ -48,6 +49,14 @@ class IcebergSplitReader : public SplitReader {
   uint64_t next(uint64_t size, VectorPtr& output) override;
 
  private:
+  // Reads the equality delete files of the split and adds the equality
+  // columns that are not read otherwise to the reader output.
+  void prepareEqualityDeletes(
+      const std::vector<IcebergDeleteFile>& deleteFiles);
+
+  // Removes the rows of 'output' deleted by the equality delete files.
+  void applyEqualityDeletes(VectorPtr& output);
+
   // The read offset to the beginning of the split in number of rows for the
   // current batch for the base data file
   uint64_t baseReadOffset_;
@@ -56,5 +65,10 @@ class IcebergSplitReader : public SplitReader {
   std::list<std::unique_ptr<PositionalDeleteFileReader>>
       positionalDeleteFileReaders_;
   BufferPtr deleteBitmap_;
+  std::vector<std::shared_ptr<const EqualityDeleteSet>> equalityDeletes_;
+  // The channels of the equality columns of each of 'equalityDeletes_' in the
+  // reader output.
+  std::vector<std::vector<column_index_t>> equalityDeleteChannels_;
+  SelectivityVector equalityDeleteRows_;
 };
 } // namespace facebook::velox::connector::hive::iceberg
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/connectors/hive/iceberg/PositionalDeleteBitmap.h"
+
+#include <algorithm>
+
+#include "velox/common/base/BitUtil.h"
+#include "velox/common/base/Exceptions.h"
+
+namespace facebook::velox::connector::hive::iceberg {
+
+PositionalDeleteBitmap::PositionalDeleteBitmap(
+    std::vector<int64_t> positions) {
+  if (!std::is_sorted(positions.begin(), positions.end())) {
+    std::sort(positions.begin(), positions.end());
+  }
+  for (auto position : positions) {
+    VELOX_CHECK_GE(position, 0, "Iceberg delete position cannot be negative");
+    const int64_t wordIndex = position / 64;
+    if (wordIndices_.empty() || wordIndices_.back() != wordIndex) {
+      wordIndices_.push_back(wordIndex);
+      words_.push_back(0);
+    }
+    words_.back() |= 1ULL << (position % 64);
+  }
+  wordIndices_.shrink_to_fit();
+  words_.shrink_to_fit();
+  if (!positions.empty()) {
+    lastPosition_ = positions.back();
+  }
+}
+
+uint64_t PositionalDeleteBitmap::apply(
+    int64_t begin,
+    int64_t end,
+    uint64_t* bitmap) const {
+  if (begin >= end || begin > lastPosition_) {
+    return 0;
+  }
+  const int64_t firstWord = begin / 64;
+  const int64_t lastWord = (end - 1) / 64;
+  auto it =
+      std::lower_bound(wordIndices_.begin(), wordIndices_.end(), firstWord);
+  int64_t lastDeleted = -1;
+  for (auto i = it - wordIndices_.begin();
+       i < wordIndices_.size() && wordIndices_[i] <= lastWord;
+       ++i) {
+    const int64_t wordBegin = wordIndices_[i] * 64;
+    uint64_t word = words_[i];
+    if (wordBegin < begin) {
+      word &= ~0ULL << (begin - wordBegin);
+    }
+    if (wordBegin + 64 > end) {
+      word &= bits::lowMask(end - wordBegin);
+    }
+    if (word == 0) {
+      continue;
+    }
+    if (word == ~0ULL) {
+      bits::fillBits(bitmap, wordBegin - begin, wordBegin + 64 - begin, true);
+    } else {
+      for (auto remaining = word; remaining != 0;
+           remaining &= remaining - 1) {
+        bits::setBit(bitmap, wordBegin + __builtin_ctzll(remaining) - begin);
+      }
+    }
+    lastDeleted = wordBegin + 63 - __builtin_clzll(word);
+  }
+  return lastDeleted < 0 ? 0 : bits::nbytes(lastDeleted + 1 - begin);
+}
+
+} // namespace facebook::velox::connector::hive::iceberg
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace facebook::velox::connector::hive::iceberg {
+
+/// The deleted row numbers of one data file in one positional delete file,
+/// stored as the non-zero 64 bit words of a bitmap over the rows of the data
+/// file. A run of deleted rows takes 1 bit per row and a word with few
+/// deletes takes 16 bytes, instead of 8 bytes per deleted row for the decoded
+/// positions. The bitmap is immutable so that the splits of the data file
+/// can share it through the FileMetadataCache.
+class PositionalDeleteBitmap {
+ public:
+  /// 'positions' are the deleted row numbers in the data file. They are
+  /// usually sorted as Iceberg requires but do not have to be.
+  explicit PositionalDeleteBitmap(std::vector<int64_t> positions);
+
+  /// Sets the bits of the deleted rows in [begin, end) in 'bitmap', where
+  /// bit 0 is row 'begin'. Returns the number of bytes of 'bitmap' up to and
+  /// including the last deleted row in the range or 0 if none is deleted.
+  uint64_t apply(int64_t begin, int64_t end, uint64_t* bitmap) const;
+
+  bool empty() const {
+    return words_.empty();
+  }
+
+  /// Returns the largest deleted row number or -1 if no row is deleted.
+  int64_t lastPosition() const {
+    return lastPosition_;
+  }
+
+  uint64_t memoryUsage() const {
+    return sizeof(*this) + wordIndices_.capacity() * sizeof(int64_t) +
+        words_.capacity() * sizeof(uint64_t);
+  }
+
+ private:
+  // The index of each non-zero word in the bitmap, in ascending order.
+  std::vector<int64_t> wordIndices_;
+  std::vector<uint64_t> words_;
+  int64_t lastPosition_{-1};
+};
+
+} // namespace facebook::velox::connector::hive::iceberg
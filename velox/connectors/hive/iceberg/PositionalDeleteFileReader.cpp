@@ -20,10 +20,26 @@
 #include "velox/connectors/hive/TableHandle.h"
 #include "velox/connectors/hive/iceberg/IcebergDeleteFile.h"
 #include "velox/connectors/hive/iceberg/IcebergMetadataColumns.h"
+#include "velox/dwio/common/FileMetadataCache.h"
 #include "velox/dwio/common/ReaderFactory.h"
 
 namespace facebook::velox::connector::hive::iceberg {
 
+namespace {
+
+// Delete files are never rewritten, so the size identifies the content. The
+// base file path is part of the version since a delete file can have the
+// positions of many base files.
+dwio::common::FileMetadataCache::Key deleteBitmapKey(
+    const IcebergDeleteFile& deleteFile,
+    const std::string& baseFilePath) {
+  return {
+      deleteFile.filePath,
+      fmt::format("{}:{}", deleteFile.fileSizeInBytes, baseFilePath)};
+}
+
+} // namespace
+
 PositionalDeleteFileReader::PositionalDeleteFileReader(
     const IcebergDeleteFile& deleteFile,
     const std::string& baseFilePath,
@@ -52,10 +68,20 @@ PositionalDeleteFileReader::PositionalDeleteFileReader(
       deleteRowReader_(nullptr),
       deletePositionsOutput_(nullptr),
       deletePositionsOffset_(0),
-      totalNumRowsScanned_(0) {
+      totalNumRowsScanned_(0),
+      bitmapReadUpperBound_(splitOffset) {
   VELOX_CHECK(deleteFile_.content == FileContent::kPositionalDeletes);
   VELOX_CHECK(deleteFile_.recordCount);
 
+  auto* metadataCache = dwio::common::FileMetadataCache::instance();
+  if (metadataCache != nullptr) {
+    deleteBitmap_ = metadataCache->get<PositionalDeleteBitmap>(
+        deleteBitmapKey(deleteFile_, baseFilePath_));
+    if (deleteBitmap_ != nullptr) {
+      return;
+    }
+  }
+
   // TODO: check if the lowerbounds and upperbounds in deleteFile overlap with
   //  this batch. If not, no need to proceed.
 
@@ -125,6 +151,25 @@ PositionalDeleteFileReader::PositionalDeleteFileReader(
     // bytes.
     runtimeStats.skippedSplitBytes += deleteSplit_->length;
     deleteSplit_.reset();
+    if (metadataCache != nullptr) {
+      deleteBitmap_ =
+          std::make_shared<PositionalDeleteBitmap>(std::vector<int64_t>{});
+      metadataCache->put(
+          deleteBitmapKey(deleteFile_, baseFilePath_),
+          deleteBitmap_,
+          deleteBitmap_->memoryUsage());
+    }
+    return;
+  }
+
+  if (metadataCache != nullptr) {
+    deleteBitmap_ =
+        readAllDeletePositions(scanSpec, deleteFileSchema, *deleteReader);
+    metadataCache->put(
+        deleteBitmapKey(deleteFile_, baseFilePath_),
+        deleteBitmap_,
+        deleteBitmap_->memoryUsage());
+    deleteSplit_.reset();
     return;
   }
 
@@ -143,6 +188,46 @@ PositionalDeleteFileReader::PositionalDeleteFileReader(
   deleteRowReader_ = deleteReader->createRowReader(deleteRowReaderOpts);
 }
 
+std::shared_ptr<const PositionalDeleteBitmap>
+PositionalDeleteFileReader::readAllDeletePositions(
+    const std::shared_ptr<common::ScanSpec>& scanSpec,
+    const RowTypePtr& deleteFileSchema,
+    dwio::common::Reader& deleteReader) {
+  constexpr uint64_t kReadBatchSize = 10'000;
+
+  dwio::common::RowReaderOptions deleteRowReaderOpts;
+  configureRowReaderOptions(
+      {},
+      scanSpec,
+      nullptr,
+      deleteFileSchema,
+      deleteSplit_,
+      nullptr,
+      nullptr,
+      deleteRowReaderOpts);
+  auto rowReader = deleteReader.createRowReader(deleteRowReaderOpts);
+
+  std::vector<int64_t> positions;
+  VectorPtr output =
+      BaseVector::create(ROW({posColumn_->name}, {posColumn_->type}), 0, pool_);
+  while (rowReader->next(kReadBatchSize, output) > 0) {
+    VELOX_CHECK(
+        !output->mayHaveNulls(),
+        "Iceberg delete file pos column cannot have nulls");
+    if (output->size() == 0) {
+      continue;
+    }
+    output->loadedVector();
+    auto* values = std::dynamic_pointer_cast<RowVector>(output)
+                       ->childAt(0)
+                       ->as<FlatVector<int64_t>>();
+    VELOX_CHECK_NOT_NULL(values);
+    const auto* rawValues = values->rawValues();
+    positions.insert(positions.end(), rawValues, rawValues + values->size());
+  }
+  return std::make_shared<PositionalDeleteBitmap>(std::move(positions));
+}
+
 void PositionalDeleteFileReader::readDeletePositions(
     uint64_t baseReadOffset,
     uint64_t size,
@@ -153,6 +238,19 @@ void PositionalDeleteFileReader::readDeletePositions(
   // batch, excluding boundaries
   int64_t rowNumberUpperBound = splitOffset_ + baseReadOffset + size;
 
+  if (deleteBitmap_ != nullptr) {
+    // Sets the bits of whole words of deleted rows at once and skips the
+    // words without deletes.
+    const auto numBytes = deleteBitmap_->apply(
+        splitOffset_ + baseReadOffset,
+        rowNumberUpperBound,
+        deleteBitmapBuffer->asMutable<uint64_t>());
+    deleteBitmapBuffer->setSize(
+        std::max<uint64_t>(deleteBitmapBuffer->size(), numBytes));
+    bitmapReadUpperBound_ = rowNumberUpperBound;
+    return;
+  }
+
   // Finish unused delete positions from last batch.
   if (deletePositionsOutput_ &&
       deletePositionsOffset_ < deletePositionsOutput_->size()) {
@@ -212,6 +310,9 @@ void PositionalDeleteFileReader::readDeletePositions(
 }
 
 bool PositionalDeleteFileReader::noMoreData() {
+  if (deleteBitmap_ != nullptr) {
+    return deleteBitmap_->lastPosition() < bitmapReadUpperBound_;
+  }
   return totalNumRowsScanned_ >= deleteFile_.recordCount &&
       deletePositionsOutput_ &&
       deletePositionsOffset_ >= deletePositionsOutput_->size();
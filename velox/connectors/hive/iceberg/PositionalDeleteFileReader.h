@@ -23,6 +23,7 @@
 #include "velox/connectors/hive/FileHandle.h"
 #include "velox/connectors/hive/HiveConfig.h"
 #include "velox/connectors/hive/HiveConnectorSplit.h"
+#include "velox/connectors/hive/iceberg/PositionalDeleteBitmap.h"
 #include "velox/dwio/common/Reader.h"
 
 namespace facebook::velox::connector::hive::iceberg {
@@ -61,6 +62,13 @@ class PositionalDeleteFileReader {
 
   bool readFinishedForBatch(int64_t rowNumberUpperBound);
 
+  // Reads all the delete positions of the base file into a
+  // PositionalDeleteBitmap.
+  std::shared_ptr<const PositionalDeleteBitmap> readAllDeletePositions(
+      const std::shared_ptr<common::ScanSpec>& scanSpec,
+      const RowTypePtr& deleteFileSchema,
+      dwio::common::Reader& deleteReader);
+
   const IcebergDeleteFile& deleteFile_;
   const std::string& baseFilePath_;
   FileHandleFactory* const fileHandleFactory_;
@@ -89,6 +97,14 @@ class PositionalDeleteFileReader {
   // including the rows filtered out from filters on both filePathColumn_ and
   // posColumn_.
   uint64_t totalNumRowsScanned_;
+
+  // The delete positions of the base file shared with the other splits of it
+  // through the FileMetadataCache. Set instead of 'deleteRowReader_' when the
+  // cache is enabled.
+  std::shared_ptr<const PositionalDeleteBitmap> deleteBitmap_;
+  // The exclusive upper bound of the row numbers of the last batch read from
+  // 'deleteBitmap_'.
+  int64_t bitmapReadUpperBound_{0};
 };
 
 } // namespace facebook::velox::connector::hive::iceberg
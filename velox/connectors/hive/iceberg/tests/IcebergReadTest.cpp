@@ -20,10 +20,13 @@
 #include "velox/connectors/hive/iceberg/IcebergDeleteFile.h"
 #include "velox/connectors/hive/iceberg/IcebergMetadataColumns.h"
 #include "velox/connectors/hive/iceberg/IcebergSplit.h"
+#include "velox/connectors/hive/iceberg/PositionalDeleteBitmap.h"
+#include "velox/dwio/common/FileMetadataCache.h"
 #include "velox/exec/PlanNodeStats.h"
 #include "velox/exec/tests/utils/HiveConnectorTestBase.h"
 #include "velox/exec/tests/utils/PlanBuilder.h"
 
+#include <folly/ScopeGuard.h>
 #include <folly/Singleton.h>
 
 using namespace facebook::velox::exec::test;
@@ -695,6 +698,147 @@ TEST_F(HiveIcebergTest, positionalDeletesMultipleSplits) {
   assertMultipleSplits({1000, 9000, 20000}, 1, 0, 20000, 3);
 }
 
+TEST_F(HiveIcebergTest, positionalDeleteBitmap) {
+  std::vector<int64_t> positions = {5, 2, 64, 200};
+  for (int64_t i = 128; i < 192; ++i) {
+    positions.push_back(i);
+  }
+  PositionalDeleteBitmap deletes(positions);
+  ASSERT_EQ(deletes.lastPosition(), 200);
+
+  std::vector<uint64_t> bitmap(4);
+  ASSERT_EQ(deletes.apply(3, 200, bitmap.data()), bits::nbytes(189));
+  for (int64_t row = 3; row < 200; ++row) {
+    ASSERT_EQ(
+        bits::isBitSet(bitmap.data(), row - 3),
+        row == 5 || row == 64 || (row >= 128 && row < 192))
+        << row;
+  }
+
+  std::fill(bitmap.begin(), bitmap.end(), 0);
+  ASSERT_EQ(deletes.apply(65, 128, bitmap.data()), 0);
+  ASSERT_EQ(bits::countBits(bitmap.data(), 0, 256), 0);
+  ASSERT_EQ(deletes.apply(201, 300, bitmap.data()), 0);
+
+  PositionalDeleteBitmap empty({});
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty.lastPosition(), -1);
+  ASSERT_EQ(empty.apply(0, 100, bitmap.data()), 0);
+}
+
+TEST_F(HiveIcebergTest, positionalDeletesCached) {
+  folly::SingletonVault::singleton()->registrationComplete();
+  FileMetadataCache::init(64 << 20);
+  SCOPE_EXIT {
+    FileMetadataCache::testingReset();
+  };
+
+  // The splits of the same data file share the positions decoded by the
+  // first one.
+  assertPositionalDeletes(
+      {{"data_file_1", {10000, 10000, 10000}}},
+      {{"delete_file_1",
+        {{"data_file_1", makeRandomIncreasingValues(0, 30000)}}}},
+      0,
+      3);
+  auto stats = FileMetadataCache::instance()->stats();
+  ASSERT_EQ(stats.numEntries, 1);
+  ASSERT_EQ(stats.numMisses, 1);
+  ASSERT_GE(stats.numHits, 1);
+
+  assertMultipleSplits(makeRandomIncreasingValues(0, 20000), 3, 0, 20000, 3);
+  assertMultipleSplits(makeContinuousIncreasingValues(0, 20000), 1, 0);
+  assertMultipleSplits({}, 2, 0);
+  assertMultipleSplits({1000, 9000, 20000}, 1, 0, 20000, 3);
+  assertPositionalDeletes(
+      {
+          {"data_file_0", {500}},
+          {"data_file_1", {10000, 10000}},
+          {"data_file_2", {500}},
+      },
+      {{"delete_file_1",
+        {{"data_file_1", makeRandomIncreasingValues(0, 20000)}}}},
+      0,
+      3);
+}
+
+TEST_F(HiveIcebergTest, equalityDeletes) {
+  folly::SingletonVault::singleton()->registrationComplete();
+  const vector_size_t size = 10'000;
+  auto data = makeRowVector(
+      {"c0", "c1", "c2"},
+      {makeFlatVector<int64_t>(size, [](auto row) { return row; }),
+       makeFlatVector<int32_t>(size, [](auto row) { return row % 7; }),
+       makeFlatVector<std::string>(
+           size, [](auto row) { return fmt::format("s{}", row % 11); })});
+  auto dataFilePath = TempFilePath::create();
+  writeToFile(dataFilePath->getPath(), {data}, config_, flushPolicyFactory_);
+  createDuckDbTable({data});
+
+  std::vector<std::shared_ptr<TempFilePath>> deleteFilePaths;
+  std::vector<IcebergDeleteFile> deleteFiles;
+  auto addDeleteFile = [&](const RowVectorPtr& deletes,
+                           std::vector<int32_t> fieldIds) {
+    auto path = TempFilePath::create();
+    writeToFile(path->getPath(), {deletes}, config_, flushPolicyFactory_);
+    deleteFiles.emplace_back(
+        FileContent::kEqualityDeletes,
+        path->getPath(),
+        fileFomat_,
+        deletes->size(),
+        testing::internal::GetFileSize(
+            std::fopen(path->getPath().c_str(), "r")),
+        std::move(fieldIds));
+    deleteFilePaths.push_back(std::move(path));
+  };
+  // A single integer key.
+  addDeleteFile(
+      makeRowVector({"c0"}, {makeFlatVector<int64_t>({1, 5, 100, 20'000})}),
+      {1});
+  // A multi-column key, where only (10, 3) and (15, 1) match data rows.
+  addDeleteFile(
+      makeRowVector(
+          {"c0", "c1"},
+          {makeFlatVector<int64_t>({10, 11, 15}),
+           makeFlatVector<int32_t>({3, 3, 1})}),
+      {1, 2});
+  // A string key.
+  addDeleteFile(
+      makeRowVector({"c2"}, {makeFlatVector<std::string>({"s4", "s40"})}),
+      {3});
+
+  const auto dataColumns = asRowType(data->type());
+  // The equality columns c0 and c2 are not projected.
+  auto plan = PlanBuilder(pool_.get())
+                  .tableScan(ROW({"c1"}, {INTEGER()}), {}, "", dataColumns)
+                  .planNode();
+  const std::string duckDbSql =
+      "SELECT c1 FROM tmp WHERE c0 NOT IN (1, 5, 100) AND "
+      "NOT (c0 = 10 AND c1 = 3) AND NOT (c0 = 15 AND c1 = 1) AND c2 <> 's4'";
+
+  auto runQuery = [&](uint32_t splitCount) {
+    HiveConnectorTestBase::assertQuery(
+        plan,
+        makeIcebergSplits(dataFilePath->getPath(), deleteFiles, {}, splitCount),
+        duckDbSql,
+        0);
+  };
+  runQuery(1);
+  runQuery(3);
+
+  // The splits share the delete rows through the cache.
+  FileMetadataCache::init(64 << 20);
+  SCOPE_EXIT {
+    FileMetadataCache::testingReset();
+  };
+  runQuery(1);
+  runQuery(1);
+  auto stats = FileMetadataCache::instance()->stats();
+  ASSERT_EQ(stats.numEntries, 3);
+  ASSERT_EQ(stats.numMisses, 3);
+  ASSERT_EQ(stats.numHits, 3);
+}
+
 TEST_F(HiveIcebergTest, testPartitionedRead) {
   RowTypePtr rowType{ROW({"c0", "ds"}, {BIGINT(), DateType::get()})};
   std::unordered_map<std::string, std::optional<std::string>> partitionKeys;
@@ -61,6 +61,11 @@ static constexpr const char* kAzureOAuthAuthType = "OAuth";
 
 static constexpr const char* kAzureSASAuthType = "SAS";
 
+// If set, a range read that has not completed after the p99 read latency and
+// at least this delay, e.g. "200ms", is sent again and the first result is
+// used.
+static constexpr const char* kAzureReadHedgeDelay = "fs.azure.read-hedge-delay";
+
 class AbfsConfig {
  public:
   explicit AbfsConfig(std::string_view path, const config::ConfigBase& config);
@@ -20,6 +20,8 @@
 #include <folly/executors/IOThreadPoolExecutor.h>
 #include <glog/logging.h>
 
+#include "velox/common/config/Config.h"
+#include "velox/common/file/HedgedReader.h"
 #include "velox/connectors/hive/storage_adapters/abfs/AbfsConfig.h"
 #include "velox/connectors/hive/storage_adapters/abfs/AbfsReadFile.h"
 #include "velox/connectors/hive/storage_adapters/abfs/AbfsUtil.h"
@@ -27,12 +29,16 @@
 
 namespace facebook::velox::filesystems {
 
-class AbfsReadFile::Impl {
+class AbfsReadFile::Impl : public std::enable_shared_from_this<Impl> {
   constexpr static uint64_t kNaturalReadSize = 4 << 20; // 4M
   constexpr static uint64_t kReadConcurrency = 8;
 
  public:
-  explicit Impl(std::string_view path, const config::ConfigBase& config) {
+  Impl(
+      std::string_view path,
+      const config::ConfigBase& config,
+      std::shared_ptr<HedgedReader> hedgedReader)
+      : hedgedReader_(std::move(hedgedReader)) {
     auto abfsConfig = AbfsConfig(path, config);
     filePath_ = abfsConfig.filePath();
     fileClient_ = abfsConfig.getReadFileClient();
@@ -63,14 +69,14 @@ class AbfsReadFile::Impl {
       uint64_t length,
       void* buffer,
       File::IoStats* stats) const {
-    preadInternal(offset, length, static_cast<char*>(buffer));
+    preadInternal(offset, length, static_cast<char*>(buffer), stats);
     return {static_cast<char*>(buffer), length};
   }
 
   std::string pread(uint64_t offset, uint64_t length, File::IoStats* stats)
       const {
     std::string result(length, 0);
-    preadInternal(offset, length, result.data());
+    preadInternal(offset, length, result.data(), stats);
     return result;
   }
 
@@ -84,7 +90,7 @@ class AbfsReadFile::Impl {
       length += range.size();
     }
     std::string result(length, 0);
-    preadInternal(offset, length, static_cast<char*>(result.data()));
+    preadInternal(offset, length, static_cast<char*>(result.data()), stats);
     size_t resultOffset = 0;
     for (auto range : buffers) {
       if (range.data()) {
@@ -135,7 +141,25 @@ class AbfsReadFile::Impl {
   }
 
  private:
-  void preadInternal(uint64_t offset, uint64_t length, char* position) const {
+  void preadInternal(
+      uint64_t offset,
+      uint64_t length,
+      char* position,
+      File::IoStats* stats) const {
+    if (hedgedReader_ == nullptr) {
+      readRange(offset, length, position);
+      return;
+    }
+    hedgedReader_->read(
+        length,
+        position,
+        [self = shared_from_this(), offset, length](char* buffer) {
+          self->readRange(offset, length, buffer);
+        },
+        stats);
+  }
+
+  void readRange(uint64_t offset, uint64_t length, char* position) const {
     // Read the desired range of bytes.
     Azure::Core::Http::HttpRange range;
     range.Offset = offset;
@@ -151,12 +175,14 @@ class AbfsReadFile::Impl {
   std::string filePath_;
   std::unique_ptr<BlobClient> fileClient_;
   int64_t length_ = -1;
+  const std::shared_ptr<HedgedReader> hedgedReader_;
 };
 
 AbfsReadFile::AbfsReadFile(
     std::string_view path,
-    const config::ConfigBase& config) {
-  impl_ = std::make_shared<Impl>(path, config);
+    const config::ConfigBase& config,
+    std::shared_ptr<HedgedReader> hedgedReader) {
+  impl_ = std::make_shared<Impl>(path, config, std::move(hedgedReader));
 }
 
 void AbfsReadFile::initialize(const FileOptions& options) {
@@ -215,6 +241,11 @@ uint64_t AbfsReadFile::getNaturalReadSize() const {
 AbfsFileSystem::AbfsFileSystem(std::shared_ptr<const config::ConfigBase> config)
     : FileSystem(config) {
   VELOX_CHECK_NOT_NULL(config.get());
+  if (auto delay = config->get<std::string>(kAzureReadHedgeDelay)) {
+    hedgedReader_ = HedgedReader::create(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            velox::config::toDuration(delay.value())));
+  }
 }
 
 std::string AbfsFileSystem::name() const {
@@ -224,7 +255,7 @@ std::string AbfsFileSystem::name() const {
 std::unique_ptr<ReadFile> AbfsFileSystem::openFileForRead(
     std::string_view path,
     const FileOptions& options) {
-  auto abfsfile = std::make_unique<AbfsReadFile>(path, *config_);
+  auto abfsfile = std::make_unique<AbfsReadFile>(path, *config_, hedgedReader_);
   abfsfile->initialize(options);
   return abfsfile;
 }
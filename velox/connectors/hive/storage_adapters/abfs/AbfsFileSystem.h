@@ -19,6 +19,8 @@
 
 namespace facebook::velox::filesystems {
 
+class HedgedReader;
+
 /// Implementation of the ABFS (Azure Blob File Storage) filesystem and file
 /// interface. We provide a registration method for reading and writing files so
 /// that the appropriate type of file can be constructed based on a filename.
@@ -74,6 +76,11 @@ class AbfsFileSystem : public FileSystem {
   void rmdir(std::string_view path) override {
     VELOX_UNSUPPORTED("rmdir for abfs not implemented");
   }
+
+ private:
+  // Hedges the reads of the files opened for read if kAzureReadHedgeDelay is
+  // set.
+  std::shared_ptr<HedgedReader> hedgedReader_;
 };
 
 void registerAbfsFileSystem();
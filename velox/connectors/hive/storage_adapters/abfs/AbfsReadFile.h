@@ -23,11 +23,16 @@ class ConfigBase;
 }
 
 namespace facebook::velox::filesystems {
+class HedgedReader;
+
+/// If 'hedgedReader' is set, the range reads that are slower than its delay
+/// are sent again.
 class AbfsReadFile final : public ReadFile {
  public:
   explicit AbfsReadFile(
       std::string_view path,
-      const config::ConfigBase& config);
+      const config::ConfigBase& config,
+      std::shared_ptr<HedgedReader> hedgedReader = nullptr);
 
   void initialize(const FileOptions& options);
 
@@ -17,6 +17,7 @@
 #include "velox/connectors/hive/storage_adapters/gcs/GcsFileSystem.h"
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/config/Config.h"
+#include "velox/common/file/HedgedReader.h"
 #include "velox/connectors/hive/HiveConfig.h"
 #include "velox/connectors/hive/storage_adapters/gcs/GcsReadFile.h"
 #include "velox/connectors/hive/storage_adapters/gcs/GcsUtil.h"
@@ -100,15 +101,26 @@ class GcsFileSystem::Impl {
     }
 
     client_ = std::make_shared<gcs::Client>(options);
+
+    if (auto delay = hiveConfig_->gcsReadHedgeDelay()) {
+      hedgedReader_ = HedgedReader::create(
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              facebook::velox::config::toDuration(delay.value())));
+    }
   }
 
   std::shared_ptr<gcs::Client> getClient() const {
     return client_;
   }
 
+  const std::shared_ptr<HedgedReader>& hedgedReader() const {
+    return hedgedReader_;
+  }
+
  private:
   const std::shared_ptr<HiveConfig> hiveConfig_;
   std::shared_ptr<gcs::Client> client_;
+  std::shared_ptr<HedgedReader> hedgedReader_;
 };
 
 GcsFileSystem::GcsFileSystem(std::shared_ptr<const config::ConfigBase> config)
@@ -124,7 +136,8 @@ std::unique_ptr<ReadFile> GcsFileSystem::openFileForRead(
     std::string_view path,
     const FileOptions& options) {
   const auto gcspath = gcsPath(path);
-  auto gcsfile = std::make_unique<GcsReadFile>(gcspath, impl_->getClient());
+  auto gcsfile = std::make_unique<GcsReadFile>(
+      gcspath, impl_->getClient(), impl_->hedgedReader());
   gcsfile->initialize(options);
   return gcsfile;
 }
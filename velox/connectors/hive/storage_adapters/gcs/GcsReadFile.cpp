@@ -15,16 +15,20 @@
  */
 
 #include "velox/connectors/hive/storage_adapters/gcs/GcsReadFile.h"
+#include "velox/common/file/HedgedReader.h"
 #include "velox/connectors/hive/storage_adapters/gcs/GcsUtil.h"
 
 namespace facebook::velox::filesystems {
 
 namespace gcs = ::google::cloud::storage;
 
-class GcsReadFile::Impl {
+class GcsReadFile::Impl : public std::enable_shared_from_this<Impl> {
  public:
-  Impl(const std::string& path, std::shared_ptr<gcs::Client> client)
-      : client_(client) {
+  Impl(
+      const std::string& path,
+      std::shared_ptr<gcs::Client> client,
+      std::shared_ptr<HedgedReader> hedgedReader)
+      : client_(client), hedgedReader_(std::move(hedgedReader)) {
     setBucketAndKeyFromGcsPath(path, bucket_, key_);
   }
 
@@ -60,7 +64,8 @@ class GcsReadFile::Impl {
       void* buffer,
       std::atomic<uint64_t>& bytesRead,
       filesystems::File::IoStats* stats = nullptr) const {
-    preadInternal(offset, length, static_cast<char*>(buffer), bytesRead);
+    preadInternal(
+        offset, length, static_cast<char*>(buffer), bytesRead, stats);
     return {static_cast<char*>(buffer), length};
   }
 
@@ -71,7 +76,7 @@ class GcsReadFile::Impl {
       filesystems::File::IoStats* stats = nullptr) const {
     std::string result(length, 0);
     char* position = result.data();
-    preadInternal(offset, length, position, bytesRead);
+    preadInternal(offset, length, position, bytesRead, stats);
     return result;
   }
 
@@ -89,7 +94,8 @@ class GcsReadFile::Impl {
       length += range.size();
     }
     std::string result(length, 0);
-    preadInternal(offset, length, static_cast<char*>(result.data()), bytesRead);
+    preadInternal(
+        offset, length, static_cast<char*>(result.data()), bytesRead, stats);
     size_t resultOffset = 0;
     for (auto range : buffers) {
       if (range.data()) {
@@ -121,7 +127,23 @@ class GcsReadFile::Impl {
       uint64_t offset,
       uint64_t length,
       char* position,
-      std::atomic<uint64_t>& bytesRead_) const {
+      std::atomic<uint64_t>& bytesRead_,
+      filesystems::File::IoStats* stats) const {
+    if (hedgedReader_ == nullptr) {
+      readRange(offset, length, position);
+    } else {
+      hedgedReader_->read(
+          length,
+          position,
+          [self = shared_from_this(), offset, length](char* buffer) {
+            self->readRange(offset, length, buffer);
+          },
+          stats);
+    }
+    bytesRead_ += length;
+  }
+
+  void readRange(uint64_t offset, uint64_t length, char* position) const {
     gcs::ObjectReadStream stream = client_->ReadObject(
         bucket_, key_, gcs::ReadRange(offset, offset + length));
     if (!stream) {
@@ -134,10 +156,10 @@ class GcsReadFile::Impl {
       checkGcsStatus(
           stream.status(), "Failed to get read object", bucket_, key_);
     }
-    bytesRead_ += length;
   }
 
   std::shared_ptr<gcs::Client> client_;
+  const std::shared_ptr<HedgedReader> hedgedReader_;
   std::string bucket_;
   std::string key_;
   std::atomic<int64_t> length_ = -1;
@@ -145,8 +167,9 @@ class GcsReadFile::Impl {
 
 GcsReadFile::GcsReadFile(
     const std::string& path,
-    std::shared_ptr<gcs::Client> client)
-    : impl_(std::make_unique<Impl>(path, client)) {}
+    std::shared_ptr<gcs::Client> client,
+    std::shared_ptr<HedgedReader> hedgedReader)
+    : impl_(std::make_shared<Impl>(path, client, std::move(hedgedReader))) {}
 
 GcsReadFile::~GcsReadFile() = default;
 
@@ -21,14 +21,19 @@
 
 namespace facebook::velox::filesystems {
 
+class HedgedReader;
+
 /**
  * Implementation of gcs read file.
+ * If 'hedgedReader' is set, the range reads that are slower than its delay
+ * are sent again.
  */
 class GcsReadFile : public ReadFile {
  public:
   GcsReadFile(
       const std::string& path,
-      std::shared_ptr<::google::cloud::storage::Client> client);
+      std::shared_ptr<::google::cloud::storage::Client> client,
+      std::shared_ptr<HedgedReader> hedgedReader = nullptr);
 
   ~GcsReadFile() override;
 
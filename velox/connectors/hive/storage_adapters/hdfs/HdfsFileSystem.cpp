@@ -15,6 +15,7 @@
  */
 #include "velox/connectors/hive/storage_adapters/hdfs/HdfsFileSystem.h"
 #include "velox/common/config/Config.h"
+#include "velox/common/file/HedgedReader.h"
 #include "velox/connectors/hive/storage_adapters/hdfs/HdfsReadFile.h"
 #include "velox/connectors/hive/storage_adapters/hdfs/HdfsWriteFile.h"
 #include "velox/external/hdfs/ArrowHdfsInternal.h"
@@ -53,6 +54,12 @@ class HdfsFileSystem::Impl {
         "Unable to connect to HDFS: {}, got error: {}.",
         endpoint.identity(),
         driver_->GetLastExceptionRootCause());
+
+    if (auto delay = config->get<std::string>(kReadHedgeDelay)) {
+      hedgedReader_ = HedgedReader::create(
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              velox::config::toDuration(delay.value())));
+    }
   }
 
   ~Impl() {
@@ -72,9 +79,14 @@ class HdfsFileSystem::Impl {
     return driver_;
   }
 
+  const std::shared_ptr<HedgedReader>& hedgedReader() const {
+    return hedgedReader_;
+  }
+
  private:
   hdfsFS hdfsClient_;
   filesystems::arrow::io::internal::LibHdfsShim* driver_;
+  std::shared_ptr<HedgedReader> hedgedReader_;
 };
 
 HdfsFileSystem::HdfsFileSystem(
@@ -99,7 +111,7 @@ std::unique_ptr<ReadFile> HdfsFileSystem::openFileForRead(
     }
   }
   return std::make_unique<HdfsReadFile>(
-      impl_->hdfsShim(), impl_->hdfsClient(), path);
+      impl_->hdfsShim(), impl_->hdfsClient(), path, impl_->hedgedReader());
 }
 
 std::unique_ptr<WriteFile> HdfsFileSystem::openFileForWrite(
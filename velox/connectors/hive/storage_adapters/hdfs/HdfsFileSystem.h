@@ -92,6 +92,11 @@ class HdfsFileSystem : public FileSystem {
 
   static std::string_view kViewfsScheme;
 
+  /// If set, a read that has not completed after the p99 read latency and at
+  /// least this delay, e.g. "200ms", is sent again and the first result is
+  /// used.
+  static constexpr const char* kReadHedgeDelay = "hive.hdfs.read-hedge-delay";
+
  protected:
   class Impl;
   std::shared_ptr<Impl> impl_;
@@ -15,6 +15,7 @@
  */
 
 #include "HdfsReadFile.h"
+#include "velox/common/file/HedgedReader.h"
 #include "velox/external/hdfs/ArrowHdfsInternal.h"
 
 namespace facebook::velox {
@@ -60,13 +61,17 @@ struct HdfsFile {
   }
 };
 
-class HdfsReadFile::Impl {
+class HdfsReadFile::Impl : public std::enable_shared_from_this<Impl> {
  public:
   Impl(
       filesystems::arrow::io::internal::LibHdfsShim* driver,
       hdfsFS hdfs,
-      const std::string_view path)
-      : driver_(driver), hdfsClient_(hdfs), filePath_(path) {
+      const std::string_view path,
+      std::shared_ptr<filesystems::HedgedReader> hedgedReader)
+      : driver_(driver),
+        hdfsClient_(hdfs),
+        filePath_(path),
+        hedgedReader_(std::move(hedgedReader)) {
     fileInfo_ = driver_->GetPathInfo(hdfsClient_, filePath_.data());
     if (fileInfo_ == nullptr) {
       auto error = fmt::format(
@@ -89,8 +94,27 @@ class HdfsReadFile::Impl {
     }
   }
 
-  void preadInternal(uint64_t offset, uint64_t length, char* pos) const {
+  void preadInternal(
+      uint64_t offset,
+      uint64_t length,
+      char* pos,
+      filesystems::File::IoStats* stats) const {
     checkFileReadParameters(offset, length);
+    if (hedgedReader_ == nullptr) {
+      readRange(offset, length, pos);
+      return;
+    }
+    // Each thread of the hedged reads has its own file handle.
+    hedgedReader_->read(
+        length,
+        pos,
+        [self = shared_from_this(), offset, length](char* buffer) {
+          self->readRange(offset, length, buffer);
+        },
+        stats);
+  }
+
+  void readRange(uint64_t offset, uint64_t length, char* pos) const {
     if (!file_->handle_) {
       file_->open(driver_, hdfsClient_, filePath_);
     }
@@ -103,15 +127,22 @@ class HdfsReadFile::Impl {
     }
   }
 
-  std::string_view pread(uint64_t offset, uint64_t length, void* buf) const {
-    preadInternal(offset, length, static_cast<char*>(buf));
+  std::string_view pread(
+      uint64_t offset,
+      uint64_t length,
+      void* buf,
+      filesystems::File::IoStats* stats) const {
+    preadInternal(offset, length, static_cast<char*>(buf), stats);
     return {static_cast<char*>(buf), length};
   }
 
-  std::string pread(uint64_t offset, uint64_t length) const {
+  std::string pread(
+      uint64_t offset,
+      uint64_t length,
+      filesystems::File::IoStats* stats) const {
     std::string result(length, 0);
     char* pos = result.data();
-    preadInternal(offset, length, pos);
+    preadInternal(offset, length, pos, stats);
     return result;
   }
 
@@ -149,13 +180,19 @@ class HdfsReadFile::Impl {
   std::string filePath_;
   hdfsFileInfo* fileInfo_;
   folly::ThreadLocal<HdfsFile> file_;
+  const std::shared_ptr<filesystems::HedgedReader> hedgedReader_;
 };
 
 HdfsReadFile::HdfsReadFile(
     filesystems::arrow::io::internal::LibHdfsShim* driver,
     hdfsFS hdfs,
-    const std::string_view path)
-    : pImpl(std::make_unique<Impl>(driver, hdfs, path)) {}
+    const std::string_view path,
+    std::shared_ptr<filesystems::HedgedReader> hedgedReader)
+    : pImpl(std::make_shared<Impl>(
+          driver,
+          hdfs,
+          path,
+          std::move(hedgedReader))) {}
 
 HdfsReadFile::~HdfsReadFile() = default;
 
@@ -164,14 +201,14 @@ std::string_view HdfsReadFile::pread(
     uint64_t length,
     void* buf,
     filesystems::File::IoStats* stats) const {
-  return pImpl->pread(offset, length, buf);
+  return pImpl->pread(offset, length, buf, stats);
 }
 
 std::string HdfsReadFile::pread(
     uint64_t offset,
     uint64_t length,
     filesystems::File::IoStats* stats) const {
-  return pImpl->pread(offset, length);
+  return pImpl->pread(offset, length, stats);
 }
 
 uint64_t HdfsReadFile::size() const {
@@ -19,19 +19,26 @@
 
 namespace facebook::velox {
 
+namespace filesystems {
+class HedgedReader;
+}
+
 namespace filesystems::arrow::io::internal {
 class LibHdfsShim;
 }
 
 /**
  * Implementation of hdfs read file.
+ * If 'hedgedReader' is set, the reads that are slower than its delay are sent
+ * again on another file handle, which may read from another datanode.
  */
 class HdfsReadFile final : public ReadFile {
  public:
   explicit HdfsReadFile(
       filesystems::arrow::io::internal::LibHdfsShim* driver,
       hdfsFS hdfs,
-      std::string_view path);
+      std::string_view path,
+      std::shared_ptr<filesystems::HedgedReader> hedgedReader = nullptr);
   ~HdfsReadFile() override;
 
   std::string_view pread(
@@ -61,7 +68,7 @@ class HdfsReadFile final : public ReadFile {
   void checkFileReadParameters(uint64_t offset, uint64_t length) const;
 
   class Impl;
-  std::unique_ptr<Impl> pImpl;
+  std::shared_ptr<Impl> pImpl;
 };
 
 } // namespace facebook::velox
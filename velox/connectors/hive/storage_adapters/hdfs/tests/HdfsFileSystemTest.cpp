@@ -21,6 +21,7 @@
 #include "gtest/gtest.h"
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/base/tests/GTestUtils.h"
+#include "velox/common/file/HedgedReader.h"
 #include "velox/connectors/hive/storage_adapters/hdfs/HdfsReadFile.h"
 #include "velox/connectors/hive/storage_adapters/hdfs/RegisterHdfsFileSystem.h"
 #include "velox/connectors/hive/storage_adapters/hdfs/tests/HdfsMiniCluster.h"
@@ -217,6 +218,20 @@ TEST_F(HdfsFileSystemTest, read) {
   readData(&readFile);
 }
 
+TEST_F(HdfsFileSystemTest, hedgedRead) {
+  filesystems::arrow::io::internal::LibHdfsShim* driver;
+  auto hdfs = connectHdfsDriver(
+      &driver,
+      std::string(miniCluster->host()),
+      std::string(miniCluster->nameNodePort()));
+  // No delay hedges the reads that do not complete right away.
+  auto hedgedReader =
+      filesystems::HedgedReader::create(std::chrono::milliseconds(0));
+  HdfsReadFile readFile(driver, hdfs, kDestinationPath, hedgedReader);
+  readData(&readFile);
+  ASSERT_GE(hedgedReader->numHedgedReads(), hedgedReader->numHedgedReadWins());
+}
+
 TEST_F(HdfsFileSystemTest, rename) {
   auto config = std::make_shared<const config::ConfigBase>(
       std::unordered_map<std::string, std::string>(configurationValues));
@@ -76,6 +76,9 @@ class S3Config {
     kRetryMode,
     kUseProxyFromEnv,
     kCredentialsProvider,
+    kMaxConcurrentReadsPerFile,
+    kReadHedgeDelay,
+    kMaxConcurrentUploadsPerFile,
     kEnd
   };
 
@@ -114,6 +117,12 @@ class S3Config {
              std::make_pair("use-proxy-from-env", "false")},
             {Keys::kCredentialsProvider,
              std::make_pair("aws-credentials-provider", std::nullopt)},
+            {Keys::kMaxConcurrentReadsPerFile,
+             std::make_pair("max-concurrent-reads-per-file", "8")},
+            {Keys::kReadHedgeDelay,
+             std::make_pair("read-hedge-delay", std::nullopt)},
+            {Keys::kMaxConcurrentUploadsPerFile,
+             std::make_pair("max-concurrent-uploads-per-file", "0")},
         };
     return config;
   }
@@ -243,6 +252,27 @@ class S3Config {
     return config_.find(Keys::kCredentialsProvider)->second;
   }
 
+  /// Maximum number of concurrent ranged GETs of a file opened for read. 0
+  /// disables the asynchronous reads.
+  uint32_t maxConcurrentReadsPerFile() const {
+    auto value = config_.find(Keys::kMaxConcurrentReadsPerFile)->second.value();
+    return folly::to<uint32_t>(value);
+  }
+
+  /// Delay after which an asynchronous ranged GET that has not completed is
+  /// sent again. The first response is used.
+  std::optional<std::string> readHedgeDelay() const {
+    return config_.find(Keys::kReadHedgeDelay)->second;
+  }
+
+  /// Maximum number of concurrent part uploads of a file opened for write. 0
+  /// uploads the parts synchronously.
+  uint32_t maxConcurrentUploadsPerFile() const {
+    auto value =
+        config_.find(Keys::kMaxConcurrentUploadsPerFile)->second.value();
+    return folly::to<uint32_t>(value);
+  }
+
  private:
   std::unordered_map<Keys, std::optional<std::string>> config_;
   std::string payloadSigningPolicy_;
@@ -53,4 +53,13 @@ constexpr std::string_view kMetricS3GetObjectErrors{
 constexpr std::string_view kMetricS3GetObjectRetries{
     "velox.s3_get_object_retries"};
 
+// The number of asynchronous S3 getObject calls in flight.
+constexpr std::string_view kMetricS3InFlightGetObjectCalls{
+    "velox.s3_in_flight_get_object_calls"};
+
+// The number of asynchronous S3 getObject calls sent again because the first
+// call did not complete within the hedge delay.
+constexpr std::string_view kMetricS3HedgedGetObjectCalls{
+    "velox.s3_hedged_get_object_calls"};
+
 } // namespace facebook::velox::filesystems
@@ -293,6 +293,15 @@ class S3FileSystem::Impl {
 
     client_ = std::make_shared<Aws::S3::S3Client>(
         credentialsProvider, nullptr /* endpointProvider */, clientConfig);
+
+    readOptions_.maxConcurrentReads = s3Config.maxConcurrentReadsPerFile();
+    if (s3Config.readHedgeDelay().has_value()) {
+      readOptions_.hedgeDelay =
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              facebook::velox::config::toDuration(
+                  s3Config.readHedgeDelay().value()));
+    }
+    maxConcurrentUploads_ = s3Config.maxConcurrentUploadsPerFile();
     ++fileSystemCount;
   }
 
@@ -430,6 +439,14 @@ class S3FileSystem::Impl {
     return client_.get();
   }
 
+  const S3ReadOptions& readOptions() const {
+    return readOptions_;
+  }
+
+  uint32_t maxConcurrentUploads() const {
+    return maxConcurrentUploads_;
+  }
+
   std::string getLogLevelName() const {
     return getAwsInstance()->getLogLevelName();
   }
@@ -440,6 +457,8 @@ class S3FileSystem::Impl {
 
  private:
   std::shared_ptr<Aws::S3::S3Client> client_;
+  S3ReadOptions readOptions_;
+  uint32_t maxConcurrentUploads_{0};
 };
 
 S3FileSystem::S3FileSystem(
@@ -462,7 +481,8 @@ std::unique_ptr<ReadFile> S3FileSystem::openFileForRead(
     std::string_view s3Path,
     const FileOptions& options) {
   const auto path = getPath(s3Path);
-  auto s3file = std::make_unique<S3ReadFile>(path, impl_->s3Client());
+  auto s3file = std::make_unique<S3ReadFile>(
+      path, impl_->s3Client(), impl_->readOptions());
   s3file->initialize(options);
   return s3file;
 }
@@ -471,8 +491,8 @@ std::unique_ptr<WriteFile> S3FileSystem::openFileForWrite(
     std::string_view s3Path,
     const FileOptions& options) {
   const auto path = getPath(s3Path);
-  auto s3file =
-      std::make_unique<S3WriteFile>(path, impl_->s3Client(), options.pool);
+  auto s3file = std::make_unique<S3WriteFile>(
+      path, impl_->s3Client(), options.pool, impl_->maxConcurrentUploads());
   return s3file;
 }
 
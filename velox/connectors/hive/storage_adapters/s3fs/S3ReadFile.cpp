@@ -19,11 +19,17 @@
 #include "velox/connectors/hive/storage_adapters/s3fs/S3Counters.h"
 #include "velox/connectors/hive/storage_adapters/s3fs/S3Util.h"
 
+#include <folly/executors/InlineExecutor.h>
+#include <folly/futures/Future.h>
+
 #include <aws/core/Aws.h>
 #include <aws/s3/S3Client.h>
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/HeadObjectRequest.h>
 
+#include <deque>
+#include <mutex>
+
 namespace facebook::velox::filesystems {
 
 namespace {
@@ -38,10 +44,13 @@ Aws::IOStreamFactory AwsWriteableStreamFactory(void* data, int64_t nbytes) {
 
 } // namespace
 
-class S3ReadFile ::Impl {
+class S3ReadFile ::Impl : public std::enable_shared_from_this<Impl> {
  public:
-  explicit Impl(std::string_view path, Aws::S3::S3Client* client)
-      : client_(client) {
+  Impl(
+      std::string_view path,
+      Aws::S3::S3Client* client,
+      const S3ReadOptions& options)
+      : client_(client), options_(options) {
     getBucketAndKeyFromPath(path, bucket_, key_);
   }
 
@@ -119,6 +128,51 @@ class S3ReadFile ::Impl {
     return length;
   }
 
+  folly::SemiFuture<uint64_t> preadvAsync(
+      uint64_t offset,
+      const std::vector<folly::Range<char*>>& buffers,
+      File::IoStats* stats) {
+    // Each run of adjacent non-gap buffers is read by one ranged GET and the
+    // runs are read in parallel. The gaps are not read.
+    std::vector<std::shared_ptr<RangeRead>> reads;
+    uint64_t position = offset;
+    for (const auto& range : buffers) {
+      if (range.data() != nullptr && !range.empty()) {
+        if (reads.empty() ||
+            reads.back()->offset + reads.back()->length != position) {
+          reads.push_back(std::make_shared<RangeRead>());
+          reads.back()->offset = position;
+        }
+        reads.back()->length += range.size();
+        reads.back()->buffers.push_back(range);
+      }
+      position += range.size();
+    }
+
+    std::vector<folly::SemiFuture<folly::Unit>> futures;
+    futures.reserve(reads.size());
+    for (const auto& read : reads) {
+      futures.push_back(read->promise.getSemiFuture());
+      startGet(read);
+      if (options_.hedgeDelay.has_value()) {
+        scheduleHedge(read);
+      }
+    }
+    // Waits for all the GETs since they write into 'buffers'.
+    return folly::collectAll(std::move(futures))
+        .deferValue([length = position - offset](
+                        std::vector<folly::Try<folly::Unit>>&& results) {
+          for (auto& result : results) {
+            result.throwUnlessValue();
+          }
+          return length;
+        });
+  }
+
+  bool hasPreadvAsync() const {
+    return options_.maxConcurrentReads > 0;
+  }
+
   uint64_t size() const {
     return length_;
   }
@@ -163,14 +217,164 @@ class S3ReadFile ::Impl {
     VELOX_CHECK_AWS_OUTCOME(outcome, "Failed to get S3 object", bucket_, key_);
   }
 
+  // The ranged GETs of one run of adjacent buffers of a preadvAsync. More
+  // than one GET is sent if the first one is hedged.
+  struct RangeRead {
+    uint64_t offset{0};
+    uint64_t length{0};
+    std::vector<folly::Range<char*>> buffers;
+    folly::Promise<folly::Unit> promise;
+
+    std::mutex mutex;
+    int32_t numGets{0};
+    int32_t numFailedGets{0};
+    // Set when 'promise' is fulfilled.
+    bool done{false};
+  };
+
+  // Sends a GET for 'read' or queues it if the file has
+  // 'options_.maxConcurrentReads' GETs in flight.
+  void startGet(const std::shared_ptr<RangeRead>& read) {
+    {
+      std::lock_guard<std::mutex> l(read->mutex);
+      if (read->done) {
+        return;
+      }
+      ++read->numGets;
+    }
+    auto get = [self = shared_from_this(), read]() { self->sendGet(read); };
+    {
+      std::lock_guard<std::mutex> l(mutex_);
+      if (numGetsInFlight_ >= options_.maxConcurrentReads) {
+        queuedGets_.push_back(std::move(get));
+        return;
+      }
+      ++numGetsInFlight_;
+    }
+    get();
+  }
+
+  // Starts the next queued GET, if any, when a GET completes.
+  void releaseGet() {
+    std::function<void()> next;
+    {
+      std::lock_guard<std::mutex> l(mutex_);
+      if (queuedGets_.empty()) {
+        --numGetsInFlight_;
+        return;
+      }
+      next = std::move(queuedGets_.front());
+      queuedGets_.pop_front();
+    }
+    next();
+  }
+
+  void sendGet(const std::shared_ptr<RangeRead>& read) {
+    {
+      // A queued hedged GET is not needed once the first one has completed.
+      std::lock_guard<std::mutex> l(read->mutex);
+      if (read->done) {
+        releaseGet();
+        return;
+      }
+    }
+    // Each GET reads into its own buffer since a hedged GET may complete
+    // while the other one is still writing.
+    auto data = std::make_shared<std::string>(read->length, 0);
+    Aws::S3::Model::GetObjectRequest request;
+    request.SetBucket(awsString(bucket_));
+    request.SetKey(awsString(key_));
+    request.SetRange(awsString(fmt::format(
+        "bytes={}-{}", read->offset, read->offset + read->length - 1)));
+    request.SetResponseStreamFactory(
+        AwsWriteableStreamFactory(data->data(), data->size()));
+    RECORD_METRIC_VALUE(kMetricS3GetObjectCalls);
+    RECORD_METRIC_VALUE(kMetricS3InFlightGetObjectCalls);
+    client_->GetObjectAsync(
+        request,
+        [self = shared_from_this(), read, data](
+            const auto* /*client*/,
+            const auto& /*request*/,
+            auto&& outcome,
+            const auto& /*context*/) {
+          self->getDone(read, *data, outcome);
+        });
+  }
+
+  void getDone(
+      const std::shared_ptr<RangeRead>& read,
+      const std::string& data,
+      const Aws::S3::Model::GetObjectOutcome& outcome) {
+    RECORD_METRIC_VALUE(kMetricS3InFlightGetObjectCalls, -1);
+    if (!outcome.IsSuccess()) {
+      RECORD_METRIC_VALUE(kMetricS3GetObjectErrors);
+    }
+    RECORD_METRIC_VALUE(kMetricS3GetObjectRetries, outcome.GetRetryCount());
+    releaseGet();
+
+    {
+      std::lock_guard<std::mutex> l(read->mutex);
+      if (read->done) {
+        return;
+      }
+      // A failed GET waits for the hedged one, if any.
+      if (!outcome.IsSuccess() && ++read->numFailedGets < read->numGets) {
+        return;
+      }
+      read->done = true;
+    }
+    if (!outcome.IsSuccess()) {
+      try {
+        VELOX_CHECK_AWS_OUTCOME(
+            outcome, "Failed to get S3 object", bucket_, key_);
+      } catch (const std::exception&) {
+        read->promise.setException(
+            folly::exception_wrapper(std::current_exception()));
+      }
+      return;
+    }
+    uint64_t position = 0;
+    for (const auto& buffer : read->buffers) {
+      memcpy(buffer.data(), data.data() + position, buffer.size());
+      position += buffer.size();
+    }
+    read->promise.setValue();
+  }
+
+  // Sends another GET for 'read' if it has not completed within
+  // 'options_.hedgeDelay'.
+  void scheduleHedge(const std::shared_ptr<RangeRead>& read) {
+    folly::futures::sleep(options_.hedgeDelay.value())
+        .via(&folly::InlineExecutor::instance())
+        .thenValue([self = shared_from_this(), read](auto&& /*unused*/) {
+          {
+            std::lock_guard<std::mutex> l(read->mutex);
+            if (read->done) {
+              return;
+            }
+          }
+          RECORD_METRIC_VALUE(kMetricS3HedgedGetObjectCalls);
+          self->startGet(read);
+        });
+  }
+
   Aws::S3::S3Client* client_;
+  const S3ReadOptions options_;
   std::string bucket_;
   std::string key_;
   int64_t length_ = -1;
+
+  // Limits the asynchronous GETs in flight to 'options_.maxConcurrentReads'.
+  std::mutex mutex_;
+  uint32_t numGetsInFlight_{0};
+  std::deque<std::function<void()>> queuedGets_;
 };
 
-S3ReadFile::S3ReadFile(std::string_view path, Aws::S3::S3Client* client) {
-  impl_ = std::make_shared<Impl>(path, client);
+S3ReadFile::S3ReadFile(
+    std::string_view path,
+    Aws::S3::S3Client* client,
+    const S3ReadOptions& options) {
+  impl_ = std::make_shared<Impl>(path, client, options);
 }
 
 S3ReadFile::~S3ReadFile() = default;
@@ -201,6 +405,20 @@ uint64_t S3ReadFile::preadv(
   return impl_->preadv(offset, buffers, stats);
 }
 
+folly::SemiFuture<uint64_t> S3ReadFile::preadvAsync(
+    uint64_t offset,
+    const std::vector<folly::Range<char*>>& buffers,
+    filesystems::File::IoStats* stats) const {
+  if (!impl_->hasPreadvAsync()) {
+    return ReadFile::preadvAsync(offset, buffers, stats);
+  }
+  return impl_->preadvAsync(offset, buffers, stats);
+}
+
+bool S3ReadFile::hasPreadvAsync() const {
+  return impl_->hasPreadvAsync();
+}
+
 uint64_t S3ReadFile::size() const {
   return impl_->size();
 }
@@ -24,10 +24,24 @@ class S3Client;
 
 namespace facebook::velox::filesystems {
 
+/// Options for the asynchronous reads of an S3ReadFile.
+struct S3ReadOptions {
+  /// Maximum number of concurrent ranged GETs of the file. 0 disables the
+  /// asynchronous reads.
+  uint32_t maxConcurrentReads{0};
+
+  /// If set, a ranged GET that has not completed after this delay is sent
+  /// again and the first response is used.
+  std::optional<std::chrono::milliseconds> hedgeDelay;
+};
+
 /// Implementation of s3 read file.
 class S3ReadFile : public ReadFile {
  public:
-  S3ReadFile(std::string_view path, Aws::S3::S3Client* client);
+  S3ReadFile(
+      std::string_view path,
+      Aws::S3::S3Client* client,
+      const S3ReadOptions& options = {});
 
   ~S3ReadFile() override;
 
@@ -47,6 +61,15 @@ class S3ReadFile : public ReadFile {
       const std::vector<folly::Range<char*>>& buffers,
       filesystems::File::IoStats* stats = nullptr) const final;
 
+  /// Sends one ranged GET per run of adjacent non-gap buffers on the
+  /// asynchronous S3 client.
+  folly::SemiFuture<uint64_t> preadvAsync(
+      uint64_t offset,
+      const std::vector<folly::Range<char*>>& buffers,
+      filesystems::File::IoStats* stats = nullptr) const override;
+
+  bool hasPreadvAsync() const override;
+
   uint64_t size() const final;
 
   uint64_t memoryUsage() const final;
@@ -31,15 +31,21 @@
 #include <aws/s3/model/HeadObjectRequest.h>
 #include <aws/s3/model/UploadPartRequest.h>
 
+#include <condition_variable>
+#include <mutex>
+
 namespace facebook::velox::filesystems {
 
-class S3WriteFile::Impl {
+class S3WriteFile::Impl : public std::enable_shared_from_this<Impl> {
  public:
-  explicit Impl(
+  Impl(
       std::string_view path,
       Aws::S3::S3Client* client,
-      memory::MemoryPool* pool)
-      : client_(client), pool_(pool) {
+      memory::MemoryPool* pool,
+      uint32_t maxConcurrentUploads)
+      : client_(client),
+        pool_(pool),
+        maxConcurrentUploads_(maxConcurrentUploads) {
     VELOX_CHECK_NOT_NULL(client);
     VELOX_CHECK_NOT_NULL(pool);
     getBucketAndKeyFromPath(path, bucket_, key_);
@@ -102,6 +108,19 @@ class S3WriteFile::Impl {
   // Appends data to the end of the file.
   void append(std::string_view data) {
     VELOX_CHECK(!closed(), "File is closed");
+    if (maxConcurrentUploads_ > 0) {
+      fileSize_ += data.size();
+      while (!data.empty()) {
+        const auto size = std::min<uint64_t>(
+            data.size(), kPartUploadSize - currentPart_->size());
+        currentPart_->unsafeAppend(data.data(), size);
+        data.remove_prefix(size);
+        if (currentPart_->size() == kPartUploadSize) {
+          uploadPartAsync();
+        }
+      }
+      return;
+    }
     if (data.size() + currentPart_->size() >= kPartUploadSize) {
       upload(data);
     } else {
@@ -125,7 +144,20 @@ class S3WriteFile::Impl {
       return;
     }
     RECORD_METRIC_VALUE(kMetricS3StartedUploads);
-    uploadPart({currentPart_->data(), currentPart_->size()}, true);
+    if (maxConcurrentUploads_ > 0) {
+      waitForUploads();
+      freeParts_.clear();
+      uploadPart({currentPart_->data(), currentPart_->size()}, true);
+      // The parts may complete in any order.
+      std::sort(
+          uploadState_.completedParts.begin(),
+          uploadState_.completedParts.end(),
+          [](const auto& left, const auto& right) {
+            return left.GetPartNumber() < right.GetPartNumber();
+          });
+    } else {
+      uploadPart({currentPart_->data(), currentPart_->size()}, true);
+    }
     VELOX_CHECK_EQ(uploadState_.partNumber, uploadState_.completedParts.size());
     // Complete the multipart upload.
     {
@@ -196,54 +228,149 @@ class S3WriteFile::Impl {
     currentPart_->unsafeAppend(0, dataPtr, dataSize);
   }
 
+  Aws::S3::Model::UploadPartRequest makeUploadPartRequest(
+      const std::string_view part) {
+    Aws::S3::Model::UploadPartRequest request;
+    request.SetBucket(bucket_);
+    request.SetKey(key_);
+    request.SetUploadId(uploadState_.id);
+    request.SetPartNumber(++uploadState_.partNumber);
+    request.SetContentLength(part.size());
+    request.SetBody(
+        std::make_shared<StringViewStream>(part.data(), part.size()));
+    // The default algorithm used is MD5. However, MD5 is not supported with
+    // fips and can cause a SIGSEGV. Set CRC32 instead which is a standard for
+    // checksum computation and is not restricted by fips.
+    request.SetChecksumAlgorithm(Aws::S3::Model::ChecksumAlgorithm::CRC32);
+    return request;
+  }
+
+  // Returns the part to complete the upload with. This will be needed for
+  // upload completion in Close().
+  static Aws::S3::Model::CompletedPart makeCompletedPart(
+      int64_t partNumber,
+      const Aws::S3::Model::UploadPartResult& result) {
+    Aws::S3::Model::CompletedPart part;
+    part.SetPartNumber(partNumber);
+    part.SetETag(result.GetETag());
+    // Don't add the checksum to the part if the checksum is empty.
+    // Some filesystems such as IBM COS require this to be not set.
+    if (!result.GetChecksumCRC32().empty()) {
+      part.SetChecksumCRC32(result.GetChecksumCRC32());
+    }
+    return part;
+  }
+
   void uploadPart(const std::string_view part, bool isLast = false) {
     // Only the last part can be less than kPartUploadSize.
     VELOX_CHECK(isLast || (!isLast && (part.size() == kPartUploadSize)));
-    // Upload the part.
+    auto request = makeUploadPartRequest(part);
+    auto outcome = client_->UploadPart(request);
+    VELOX_CHECK_AWS_OUTCOME(outcome, "Failed to upload", bucket_, key_);
+    uploadState_.completedParts.push_back(
+        makeCompletedPart(uploadState_.partNumber, outcome.GetResult()));
+  }
+
+  // Uploads the full 'currentPart_' asynchronously and continues with a free
+  // part buffer. Waits if 'maxConcurrentUploads_' parts are in flight.
+  void uploadPartAsync() {
+    std::shared_ptr<dwio::common::DataBuffer<char>> part =
+        std::move(currentPart_);
     {
-      Aws::S3::Model::UploadPartRequest request;
-      request.SetBucket(bucket_);
-      request.SetKey(key_);
-      request.SetUploadId(uploadState_.id);
-      request.SetPartNumber(++uploadState_.partNumber);
-      request.SetContentLength(part.size());
-      request.SetBody(
-          std::make_shared<StringViewStream>(part.data(), part.size()));
-      // The default algorithm used is MD5. However, MD5 is not supported with
-      // fips and can cause a SIGSEGV. Set CRC32 instead which is a standard for
-      // checksum computation and is not restricted by fips.
-      request.SetChecksumAlgorithm(Aws::S3::Model::ChecksumAlgorithm::CRC32);
-      auto outcome = client_->UploadPart(request);
-      VELOX_CHECK_AWS_OUTCOME(outcome, "Failed to upload", bucket_, key_);
-      // Append ETag and part number for this uploaded part.
-      // This will be needed for upload completion in Close().
-      auto result = outcome.GetResult();
-      Aws::S3::Model::CompletedPart part;
-
-      part.SetPartNumber(uploadState_.partNumber);
-      part.SetETag(result.GetETag());
-      // Don't add the checksum to the part if the checksum is empty.
-      // Some filesystems such as IBM COS require this to be not set.
-      if (!result.GetChecksumCRC32().empty()) {
-        part.SetChecksumCRC32(result.GetChecksumCRC32());
+      std::unique_lock<std::mutex> l(mutex_);
+      uploadCv_.wait(
+          l, [&]() { return numUploadsInFlight_ < maxConcurrentUploads_; });
+      checkUploadErrorLocked();
+      ++numUploadsInFlight_;
+      if (!freeParts_.empty()) {
+        currentPart_ = std::move(freeParts_.back());
+        freeParts_.pop_back();
       }
-      uploadState_.completedParts.push_back(std::move(part));
+    }
+    if (currentPart_ == nullptr) {
+      currentPart_ = std::make_unique<dwio::common::DataBuffer<char>>(*pool_);
+      currentPart_->reserve(kPartUploadSize);
+    }
+    currentPart_->resize(0);
+
+    auto request = makeUploadPartRequest({part->data(), part->size()});
+    client_->UploadPartAsync(
+        request,
+        [self = shared_from_this(), part, partNumber = uploadState_.partNumber](
+            const auto* /*client*/,
+            const auto& /*request*/,
+            auto&& outcome,
+            const auto& /*context*/) mutable {
+          self->partUploaded(partNumber, std::move(part), outcome);
+        });
+  }
+
+  void partUploaded(
+      int64_t partNumber,
+      std::shared_ptr<dwio::common::DataBuffer<char>> part,
+      const Aws::S3::Model::UploadPartOutcome& outcome) {
+    std::string error;
+    if (!outcome.IsSuccess()) {
+      try {
+        VELOX_CHECK_AWS_OUTCOME(outcome, "Failed to upload", bucket_, key_);
+      } catch (const std::exception& e) {
+        error = e.what();
+      }
+    }
+    {
+      std::lock_guard<std::mutex> l(mutex_);
+      if (outcome.IsSuccess()) {
+        uploadState_.completedParts.push_back(
+            makeCompletedPart(partNumber, outcome.GetResult()));
+      } else if (uploadError_.empty()) {
+        uploadError_ = std::move(error);
+      }
+      // Only the callback holds 'part' at this point.
+      freeParts_.push_back(std::make_unique<dwio::common::DataBuffer<char>>(
+          std::move(*part)));
+      --numUploadsInFlight_;
+    }
+    uploadCv_.notify_all();
+  }
+
+  // Waits for the asynchronous part uploads and throws if one failed.
+  void waitForUploads() {
+    std::unique_lock<std::mutex> l(mutex_);
+    uploadCv_.wait(l, [&]() { return numUploadsInFlight_ == 0; });
+    checkUploadErrorLocked();
+  }
+
+  void checkUploadErrorLocked() const {
+    if (!uploadError_.empty()) {
+      VELOX_FAIL(uploadError_);
     }
   }
 
   Aws::S3::S3Client* client_;
   memory::MemoryPool* pool_;
+  const uint32_t maxConcurrentUploads_;
   std::unique_ptr<dwio::common::DataBuffer<char>> currentPart_;
   std::string bucket_;
   std::string key_;
   size_t fileSize_ = -1;
+
+  // Guards the state of the asynchronous part uploads. 'uploadState_' is
+  // guarded for the completed parts while uploads are in flight.
+  std::mutex mutex_;
+  std::condition_variable uploadCv_;
+  uint32_t numUploadsInFlight_{0};
+  // The buffers of the uploaded parts for reuse.
+  std::vector<std::unique_ptr<dwio::common::DataBuffer<char>>> freeParts_;
+  // The error of the first failed asynchronous upload.
+  std::string uploadError_;
 };
 
 S3WriteFile::S3WriteFile(
     std::string_view path,
     Aws::S3::S3Client* client,
-    memory::MemoryPool* pool) {
-  impl_ = std::make_shared<Impl>(path, client, pool);
+    memory::MemoryPool* pool,
+    uint32_t maxConcurrentUploads) {
+  impl_ = std::make_shared<Impl>(path, client, pool, maxConcurrentUploads);
 }
 
 void S3WriteFile::append(std::string_view data) {
@@ -42,15 +42,18 @@ namespace facebook::velox::filesystems {
 /// https://docs.aws.amazon.com/AmazonS3/latest/userguide/mpuoverview.html
 /// https://github.com/apache/arrow/blob/main/cpp/src/arrow/filesystem/s3fs.cc
 /// S3WriteFile is not thread-safe.
-/// UploadPart is currently synchronous during append and flush.
-/// TODO: Evaluate and add option for asynchronous part uploads.
+/// If 'maxConcurrentUploads' is 0, UploadPart is synchronous during append.
+/// Otherwise, up to 'maxConcurrentUploads' parts are uploaded asynchronously
+/// while append fills the next part. The part buffers are allocated from
+/// 'pool' and append waits when all the parts are in flight.
 /// TODO: Implement retry on failure.
 class S3WriteFile : public WriteFile {
  public:
   S3WriteFile(
       std::string_view path,
       Aws::S3::S3Client* client,
-      memory::MemoryPool* pool);
+      memory::MemoryPool* pool,
+      uint32_t maxConcurrentUploads = 0);
 
   /// Appends data to the end of the file.
   /// Uploads a part on reaching part size limit.
@@ -65,7 +68,7 @@ class S3WriteFile : public WriteFile {
   /// Current file size, i.e. the sum of all previous Appends.
   uint64_t size() const override;
 
-  /// Return the number of parts uploaded so far.
+  /// Return the number of parts uploaded so far, including the ones in flight.
   int numPartsUploaded() const;
 
  protected:
@@ -37,6 +37,9 @@ TEST(S3ConfigTest, defaultConfig) {
   ASSERT_EQ(s3Config.payloadSigningPolicy(), "Never");
   ASSERT_EQ(s3Config.cacheKey("foo", config), "foo");
   ASSERT_EQ(s3Config.bucket(), "");
+  ASSERT_EQ(s3Config.maxConcurrentReadsPerFile(), 8);
+  ASSERT_EQ(s3Config.readHedgeDelay(), std::nullopt);
+  ASSERT_EQ(s3Config.maxConcurrentUploadsPerFile(), 0);
 }
 
 TEST(S3ConfigTest, overrideConfig) {
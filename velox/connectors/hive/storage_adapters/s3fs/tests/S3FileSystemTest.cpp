@@ -76,6 +76,50 @@ TEST_F(S3FileSystemTest, writeAndRead) {
   readData(readFile.get());
 }
 
+TEST_F(S3FileSystemTest, preadvAsync) {
+  const char* bucketName = "async";
+  const char* file = "test.txt";
+  const auto filename = localPath(bucketName) + "/" + file;
+  const auto s3File = s3URI(bucketName, file);
+  addBucket(bucketName);
+  {
+    LocalWriteFile writeFile(filename);
+    writeData(&writeFile);
+  }
+
+  for (const auto& [maxConcurrentReads, hedgeDelay] :
+       std::vector<std::pair<std::string, std::string>>{
+           {"0", ""}, {"1", ""}, {"8", ""}, {"2", "1ms"}}) {
+    SCOPED_TRACE(fmt::format("{} {}", maxConcurrentReads, hedgeDelay));
+    std::unordered_map<std::string, std::string> config = {
+        {"hive.s3.max-concurrent-reads-per-file", maxConcurrentReads}};
+    if (!hedgeDelay.empty()) {
+      config["hive.s3.read-hedge-delay"] = hedgeDelay;
+    }
+    filesystems::S3FileSystem s3fs(
+        bucketName, minioServer_->hiveConfig(config));
+    auto readFile = s3fs.openFileForRead(s3File);
+    ASSERT_EQ(readFile->hasPreadvAsync(), maxConcurrentReads != "0");
+
+    char head[12];
+    char middle[4];
+    char tail[7];
+    std::vector<folly::Range<char*>> buffers = {
+        folly::Range<char*>(head, sizeof(head)),
+        folly::Range<char*>(nullptr, (char*)(uint64_t)500000),
+        folly::Range<char*>(middle, sizeof(middle)),
+        folly::Range<char*>(
+            nullptr,
+            (char*)(uint64_t)(15 + kOneMB - 500000 - sizeof(head) -
+                              sizeof(middle) - sizeof(tail))),
+        folly::Range<char*>(tail, sizeof(tail))};
+    ASSERT_EQ(readFile->preadvAsync(0, buffers).get(), 15 + kOneMB);
+    ASSERT_EQ(std::string_view(head, sizeof(head)), "aaaaabbbbbcc");
+    ASSERT_EQ(std::string_view(middle, sizeof(middle)), "cccc");
+    ASSERT_EQ(std::string_view(tail, sizeof(tail)), "ccddddd");
+  }
+}
+
 TEST_F(S3FileSystemTest, invalidCredentialsConfig) {
   {
     std::unordered_map<std::string, std::string> config(
@@ -300,6 +344,44 @@ TEST_F(S3FileSystemTest, writeFileAndRead) {
   ASSERT_TRUE(s3fs.exists(s3File));
 }
 
+TEST_F(S3FileSystemTest, writeFileAndReadWithConcurrentUploads) {
+  const auto bucketName = "concurrentuploads";
+  const auto file = "test.txt";
+  const auto s3File = s3URI(bucketName, file);
+  addBucket(bucketName);
+
+  auto hiveConfig = minioServer_->hiveConfig(
+      {{"hive.s3.max-concurrent-uploads-per-file", "2"}});
+  filesystems::S3FileSystem s3fs(bucketName, hiveConfig);
+  auto pool = memory::memoryManager()->addLeafPool("S3FileSystemTest");
+  auto writeFile =
+      s3fs.openFileForWrite(s3File, {{}, pool.get(), std::nullopt});
+  auto s3WriteFile = dynamic_cast<filesystems::S3WriteFile*>(writeFile.get());
+
+  // Append 7 * 6'000'000 ~ 40MiB in chunks of different sizes. The chunk of
+  // each row is filled with its row number.
+  constexpr int32_t kChunkSize = 6'000'000;
+  std::vector<char> chunk(kChunkSize);
+  for (int i = 0; i < 7; ++i) {
+    std::fill(chunk.begin(), chunk.end(), 'a' + i);
+    writeFile->append({chunk.data(), kChunkSize / 3});
+    writeFile->append(
+        {chunk.data() + kChunkSize / 3, kChunkSize - kChunkSize / 3});
+  }
+  EXPECT_EQ(writeFile->size(), 7 * kChunkSize);
+  EXPECT_EQ(s3WriteFile->numPartsUploaded(), 4);
+  writeFile->close();
+  EXPECT_EQ(s3WriteFile->numPartsUploaded(), 5);
+
+  auto readFile = s3fs.openFileForRead(s3File);
+  ASSERT_EQ(readFile->size(), 7 * kChunkSize);
+  for (int i = 0; i < 7; ++i) {
+    const auto expected = std::string(10, 'a' + i);
+    ASSERT_EQ(readFile->pread(i * kChunkSize, 10), expected);
+    ASSERT_EQ(readFile->pread((i + 1) * kChunkSize - 10, 10), expected);
+  }
+}
+
 TEST_F(S3FileSystemTest, invalidConnectionSettings) {
   auto hiveConfig =
       minioServer_->hiveConfig({{"hive.s3.connect-timeout", "400"}});
@@ -142,6 +142,22 @@ TEST_F(HiveConnectorSerDeTest, hiveTableHandle) {
       true,
       {{dwio::common::TableParameter::kSkipHeaderLineCount, "1"}});
   testSerde(*tableHandle);
+
+  auto sortedTableHandle = std::make_shared<HiveTableHandle>(
+      tableHandle->connectorId(),
+      tableHandle->tableName(),
+      true,
+      common::SubfieldFilters{},
+      tableHandle->remainingFilter(),
+      nullptr,
+      std::unordered_map<std::string, std::string>{},
+      std::vector<std::pair<std::string, core::SortOrder>>{
+          {"c1", core::kAscNullsLast}, {"c5", core::kDescNullsFirst}});
+  testSerde(*sortedTableHandle);
+  ASSERT_NE(
+      sortedTableHandle->toString().find(
+          "sorted by: [c1 ASC NULLS LAST, c5 DESC NULLS FIRST]"),
+      std::string::npos);
 }
 
 TEST_F(HiveConnectorSerDeTest, hiveColumnHandle) {
@@ -19,6 +19,7 @@
 
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/connectors/hive/HiveConfig.h"
+#include "velox/connectors/hive/HiveConnectorSplit.h"
 #include "velox/connectors/hive/HiveConnectorUtil.h"
 #include "velox/connectors/hive/HiveDataSource.h"
 #include "velox/expression/ExprToSubfieldFilter.h"
@@ -83,6 +84,55 @@ TEST_F(HiveConnectorTest, hiveConfig) {
       "UNKNOWN BEHAVIOR 100");
 }
 
+TEST_F(HiveConnectorTest, divideSplit) {
+  auto connector = connector::getConnector(kHiveConnectorId);
+  auto split = HiveConnectorSplitBuilder("/tmp/file")
+                   .connectorId(kHiveConnectorId)
+                   .fileFormat(dwio::common::FileFormat::DWRF)
+                   .start(100)
+                   .length(1'000)
+                   .splitWeight(40)
+                   .build();
+  auto pieces = connector->divideSplit(split, 300, 8);
+  ASSERT_EQ(pieces.size(), 4);
+  uint64_t offset = 100;
+  for (const auto& piece : pieces) {
+    const auto* hivePiece = dynamic_cast<HiveConnectorSplit*>(piece.get());
+    ASSERT_NE(hivePiece, nullptr);
+    ASSERT_EQ(hivePiece->filePath, "/tmp/file");
+    ASSERT_EQ(hivePiece->start, offset);
+    ASSERT_EQ(hivePiece->splitWeight, 10);
+    offset += hivePiece->length;
+  }
+  ASSERT_EQ(offset, 1'100);
+
+  // The number of pieces is capped.
+  ASSERT_EQ(connector->divideSplit(split, 100, 3).size(), 3);
+  // Splits not larger than the target are not divided.
+  ASSERT_TRUE(connector->divideSplit(split, 1'000, 8).empty());
+
+  // Splits of row oriented formats are not divided.
+  auto textSplit = HiveConnectorSplitBuilder("/tmp/file")
+                       .connectorId(kHiveConnectorId)
+                       .fileFormat(dwio::common::FileFormat::TEXT)
+                       .length(1'000)
+                       .build();
+  ASSERT_TRUE(connector->divideSplit(textSplit, 100, 8).empty());
+
+  // A split without a length needs the file size.
+  auto wholeFileSplit = HiveConnectorSplitBuilder("/tmp/file")
+                            .connectorId(kHiveConnectorId)
+                            .fileFormat(dwio::common::FileFormat::DWRF)
+                            .build();
+  ASSERT_TRUE(connector->divideSplit(wholeFileSplit, 100, 8).empty());
+  wholeFileSplit = HiveConnectorSplitBuilder("/tmp/file")
+                       .connectorId(kHiveConnectorId)
+                       .fileFormat(dwio::common::FileFormat::DWRF)
+                       .fileProperties(FileProperties{.fileSize = 1'000})
+                       .build();
+  ASSERT_EQ(connector->divideSplit(wholeFileSplit, 500, 8).size(), 2);
+}
+
 TEST_F(HiveConnectorTest, makeScanSpecRequiredSubfieldsMultilevel) {
   auto columnType = ROW(
       {{"c0c0", BIGINT()},
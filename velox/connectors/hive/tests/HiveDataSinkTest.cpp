@@ -19,6 +19,7 @@
 #include "velox/exec/tests/utils/HiveConnectorTestBase.h"
 
 #include <folly/init/Init.h>
+#include <folly/json.h>
 #include <re2/re2.h>
 #include "velox/common/base/Fs.h"
 #include "velox/common/base/tests/GTestUtils.h"
@@ -520,10 +521,13 @@ TEST_F(HiveDataSinkTest, basic) {
       stats.toString(),
       "numWrittenBytes 0B numWrittenFiles 0 spillRuns[0] spilledInputBytes[0B] "
       "spilledBytes[0B] spilledRows[0] spilledPartitions[0] spilledFiles[0] "
-      "spillFillTimeNanos[0ns] spillSortTimeNanos[0ns] spillExtractVectorTime[0ns] spillSerializationTimeNanos[0ns] "
+      "spillFillTimeNanos[0ns] spillSortTimeNanos[0ns] "
+      "spillExtractVectorTime[0ns] "
+      "spillExtractAccumulatorTime[0ns] spillSerializationTimeNanos[0ns] "
       "spillWrites[0] spillFlushTimeNanos[0ns] spillWriteTimeNanos[0ns] "
       "maxSpillExceededLimitCount[0] spillReadBytes[0B] spillReads[0] "
-      "spillReadTimeNanos[0ns] spillReadDeserializationTimeNanos[0ns]");
+      "spillReadTimeNanos[0ns] spillReadAheadWaitTimeNanos[0ns] "
+      "spillReadDeserializationTimeNanos[0ns]");
 
   const int numBatches = 10;
   const auto vectors = createVectors(500, numBatches);
@@ -571,10 +575,13 @@ TEST_F(HiveDataSinkTest, basicBucket) {
       stats.toString(),
       "numWrittenBytes 0B numWrittenFiles 0 spillRuns[0] spilledInputBytes[0B] "
       "spilledBytes[0B] spilledRows[0] spilledPartitions[0] spilledFiles[0] "
-      "spillFillTimeNanos[0ns] spillSortTimeNanos[0ns] spillExtractVectorTime[0ns] spillSerializationTimeNanos[0ns] "
+      "spillFillTimeNanos[0ns] spillSortTimeNanos[0ns] "
+      "spillExtractVectorTime[0ns] "
+      "spillExtractAccumulatorTime[0ns] spillSerializationTimeNanos[0ns] "
       "spillWrites[0] spillFlushTimeNanos[0ns] spillWriteTimeNanos[0ns] "
       "maxSpillExceededLimitCount[0] spillReadBytes[0B] spillReads[0] "
-      "spillReadTimeNanos[0ns] spillReadDeserializationTimeNanos[0ns]");
+      "spillReadTimeNanos[0ns] spillReadAheadWaitTimeNanos[0ns] "
+      "spillReadDeserializationTimeNanos[0ns]");
 
   const int numBatches = 10;
   const auto vectors = createVectors(500, numBatches);
@@ -819,6 +826,87 @@ DEBUG_ONLY_TEST_F(HiveDataSinkTest, memoryReclaim) {
   }
 }
 
+TEST_F(HiveDataSinkTest, sortedPartitionWrite) {
+  const int numPartitions = 10;
+  auto vectors = createVectors(500, 10);
+  for (auto& vector : vectors) {
+    vector->childAt(1) = makeFlatVector<int32_t>(
+        vector->size(), [](auto row) { return row % numPartitions; });
+  }
+  connectorSessionProperties_->set(
+      HiveConfig::kMaxPartitionsPerWritersSession, "2");
+
+  // The partitions exceed the open writer limit without sorting.
+  {
+    const auto outputDirectory = TempDirectoryPath::create();
+    auto dataSink = createDataSink(
+        rowType_,
+        outputDirectory->getPath(),
+        dwio::common::FileFormat::DWRF,
+        {"c1"});
+    VELOX_ASSERT_THROW(
+        dataSink->appendData(vectors[0]),
+        "Exceeded limit of 2 distinct partitions");
+    dataSink->abort();
+  }
+
+  connectorSessionProperties_->set(
+      HiveConfig::kSortedPartitionWriteSession, "true");
+  const auto spillDirectory = exec::test::TempDirectoryPath::create();
+  auto spillConfig = getSpillConfig(spillDirectory->getPath(), 0);
+  setConnectorQueryContext(std::make_unique<connector::ConnectorQueryCtx>(
+      opPool_.get(),
+      connectorPool_.get(),
+      connectorSessionProperties_.get(),
+      spillConfig.get(),
+      common::PrefixSortConfig(),
+      nullptr,
+      nullptr,
+      "query.HiveDataSinkTest",
+      "task.HiveDataSinkTest",
+      "planNodeId.HiveDataSinkTest",
+      0,
+      ""));
+  const auto outputDirectory = TempDirectoryPath::create();
+  auto dataSink = createDataSink(
+      rowType_,
+      outputDirectory->getPath(),
+      dwio::common::FileFormat::DWRF,
+      {"c1"});
+  for (const auto& vector : vectors) {
+    dataSink->appendData(vector);
+  }
+  // The buffered rows spill under memory pressure.
+  memory::testingRunArbitration();
+  while (!dataSink->finish()) {
+  }
+  const auto partitions = dataSink->close();
+  ASSERT_EQ(partitions.size(), numPartitions);
+  for (auto i = 0; i < numPartitions; ++i) {
+    ASSERT_EQ(
+        folly::parseJson(partitions[i])["name"].asString(),
+        fmt::format("c1={}", i));
+  }
+  const auto stats = dataSink->stats();
+  ASSERT_EQ(stats.numWrittenFiles, numPartitions);
+  ASSERT_FALSE(stats.spillStats.empty());
+
+  const auto filePaths = listFiles(outputDirectory->getPath());
+  ASSERT_EQ(filePaths.size(), numPartitions);
+  std::vector<std::shared_ptr<connector::ConnectorSplit>> splits;
+  for (const auto& filePath : filePaths) {
+    splits.push_back(makeHiveConnectorSplit(filePath));
+  }
+  createDuckDbTable(vectors);
+  auto dataType = ROW(
+      {"c0", "c2", "c3", "c4", "c5", "c6"},
+      {BIGINT(), SMALLINT(), REAL(), DOUBLE(), VARCHAR(), BOOLEAN()});
+  HiveConnectorTestBase::assertQuery(
+      PlanBuilder().tableScan(dataType).planNode(),
+      splits,
+      "SELECT c0, c2, c3, c4, c5, c6 FROM tmp");
+}
+
 TEST_F(HiveDataSinkTest, memoryReclaimAfterClose) {
   const int numBatches = 10;
   const auto vectors = createVectors(500, 10);
@@ -3077,7 +3077,9 @@ using HashJoinNodePtr = std::shared_ptr<const HashJoinNode>;
 /// exec::MergeJoin operator. Assumes that both left and right input data is
 /// sorted on the join keys. A separate pipeline that puts its output into
 /// exec::MergeJoinSource is produced for the right side when generating
-/// exec::Operators.
+/// exec::Operators. Runs in multiple drivers if both inputs are local
+/// repartitions on the join keys, e.g. on key ranges. Each driver joins one
+/// partition of each side.
 class MergeJoinNode : public AbstractJoinNode {
  public:
   MergeJoinNode(
@@ -4765,6 +4767,10 @@ class MarkDistinctNode : public PlanNode {
     return "MarkDistinct";
   }
 
+  bool canSpill(const QueryConfig& queryConfig) const override {
+    return queryConfig.markDistinctSpillEnabled();
+  }
+
   const std::string& markerName() const {
     return markerName_;
   }
@@ -64,11 +64,31 @@ class QueryConfig {
   static constexpr const char* kExprTrackCpuUsage =
       "expression.track_cpu_usage";
 
+  /// Whether to evaluate trees of simple functions over fixed width types,
+  /// e.g. a * b + c > d, in cache sized blocks of rows without materializing
+  /// a vector for each intermediate result. False by default.
+  static constexpr const char* kExprFuseSimpleFunctions =
+      "expression.fuse_simple_functions";
+
+  /// If not zero, each function call expression times one out of every that
+  /// many calls of its function and records them in the process-wide
+  /// exec::FunctionProfiler by function signature. Zero by default.
+  static constexpr const char* kExprFunctionProfileSampleRate =
+      "expression.function_profile_sample_rate";
+
   /// Whether to track CPU usage for stages of individual operators. True by
   /// default. Can be expensive when processing small batches, e.g. < 10K rows.
   static constexpr const char* kOperatorTrackCpuUsage =
       "track_operator_cpu_usage";
 
+  /// Whether to sample hardware performance counters (cycles, instructions,
+  /// last level cache misses, data TLB misses and branch misses) around the
+  /// calls to individual operators. False by default. Requires Linux and a
+  /// kernel that allows the process to use perf_event_open. The counts are
+  /// reported as 'perf*' operator runtime stats.
+  static constexpr const char* kOperatorTrackPerfCounters =
+      "track_operator_perf_counters";
+
   /// Flags used to configure the CAST operator:
 
   static constexpr const char* kLegacyCast = "legacy_cast";
@@ -149,6 +169,12 @@ class QueryConfig {
   static constexpr const char* kMaxMergeExchangeBufferSize =
       "merge_exchange.max_buffer_size";
 
+  /// Maximum number of batches to buffer from each source of a local merge
+  /// before blocking the producer. A deeper queue lets the merge make
+  /// progress while some sources produce their data in bursts.
+  static constexpr const char* kLocalMergeSourceQueueSize =
+      "local_merge.source_queue_size";
+
   /// The minimum number of bytes to accumulate in the ExchangeQueue
   /// before unblocking a consumer. This is used to avoid creating tiny
   /// batches which may have a negative impact on performance when the
@@ -158,6 +184,20 @@ class QueryConfig {
   static constexpr const char* kMinExchangeOutputBatchBytes =
       "min_exchange_output_batch_bytes";
 
+  /// If true, the exchange client limits the bytes requested from each
+  /// source to what the source is expected to deliver while the consumers
+  /// drain the exchange buffer, based on the observed source throughput and
+  /// consumer drain rate.
+  static constexpr const char* kExchangeAdaptiveFlowControlEnabled =
+      "exchange_adaptive_flow_control_enabled";
+
+  /// If true, the Exchange operator deserializes Presto pages that are held
+  /// in a single contiguous buffer without copying the fixed width values of
+  /// columns without nulls and the string data. The vectors then reference
+  /// the page, which stays in memory for as long as any of them is alive.
+  static constexpr const char* kExchangeZeroCopyDeserializationEnabled =
+      "exchange_zero_copy_deserialization_enabled";
+
   static constexpr const char* kMaxPartialAggregationMemory =
       "max_partial_aggregation_memory";
 
@@ -170,6 +210,36 @@ class QueryConfig {
   static constexpr const char* kAbandonPartialAggregationMinPct =
       "abandon_partial_aggregation_min_pct";
 
+  /// If true, hash aggregations keep the groups of recently seen grouping keys
+  /// in a small direct mapped cache that is looked up before the hash table.
+  /// Speeds up aggregations where a few keys carry most of the rows. The
+  /// cache is disabled at runtime if its hit rate is low.
+  static constexpr const char* kAggregationHotGroupCacheEnabled =
+      "aggregation_hot_group_cache_enabled";
+
+  /// If positive, hash aggregations with many accumulators apply the updates
+  /// of all aggregates to blocks of this many input rows at a time instead of
+  /// updating one aggregate for all rows before the next. The groups of a
+  /// block then stay in cache while each aggregate updates them.
+  static constexpr const char* kAggregationUpdateBlockRows =
+      "aggregation_update_block_rows";
+
+  /// If positive, a partial hash aggregation checks over this many input rows
+  /// whether its input is clustered on the grouping keys, i.e. no group
+  /// appears in two separate runs of rows. If so, and groups span at least two
+  /// rows on average, it switches to streaming mode and flushes the completed
+  /// groups of each batch, as if all grouping keys were pre-grouped.
+  static constexpr const char* kAggregationClusteredInputDetectionRows =
+      "aggregation_clustered_input_detection_rows";
+
+  /// If positive, a distinct aggregation in a hash aggregation stops keeping
+  /// a set of values per group once the sets hold more than this many values
+  /// in total. The inputs are then de-duplicated on (group, value) in a hash
+  /// table shared by all groups and only new pairs are passed to the
+  /// aggregate.
+  static constexpr const char* kDistinctAggregationDedupThreshold =
+      "distinct_aggregation_dedup_threshold";
+
   static constexpr const char* kAbandonPartialTopNRowNumberMinRows =
       "abandon_partial_topn_row_number_min_rows";
 
@@ -188,6 +258,12 @@ class QueryConfig {
   static constexpr const char* kMaxPartitionedOutputBufferSize =
       "max_page_partitioning_buffer_size";
 
+  /// If true, PartitionedOutput serializes each destination into an arena
+  /// whose allocations grow geometrically and which keeps its last
+  /// allocation across flushes instead of returning it to the pool.
+  static constexpr const char* kPartitionedOutputArenaReuseEnabled =
+      "partitioned_output_arena_reuse_enabled";
+
   /// The maximum size in bytes for the task's buffered output.
   ///
   /// The producer Drivers are blocked when the buffered size exceeds
@@ -244,6 +320,13 @@ class QueryConfig {
   static constexpr const char* kMixedGroupedModeHashJoinSpillEnabled =
       "mixed_grouped_mode_hash_join_spill_enabled";
 
+  /// Local directory, preferably on NVMe, for the row storage of hash builds
+  /// that cannot spill. If set and such a build cannot reserve memory for its
+  /// input, its rows and strings are stored in file backed memory under this
+  /// directory which the OS pages as needed. Empty disables the fallback.
+  static constexpr const char* kHashBuildFileBackedDirectory =
+      "hash_build_file_backed_directory";
+
   /// OrderBy spilling flag, only applies if "spill_enabled" flag is set.
   static constexpr const char* kOrderBySpillEnabled = "order_by_spill_enabled";
 
@@ -259,6 +342,11 @@ class QueryConfig {
   static constexpr const char* kRowNumberSpillEnabled =
       "row_number_spill_enabled";
 
+  /// MarkDistinct spilling flag, only applies if "spill_enabled" flag is set.
+  /// MarkDistinct doesn't preserve the input order when spilling is enabled.
+  static constexpr const char* kMarkDistinctSpillEnabled =
+      "mark_distinct_spill_enabled";
+
   /// TopNRowNumber spilling flag, only applies if "spill_enabled" flag is set.
   static constexpr const char* kTopNRowNumberSpillEnabled =
       "topn_row_number_spill_enabled";
@@ -266,6 +354,13 @@ class QueryConfig {
   /// LocalMerge spilling flag, only applies if "spill_enabled" flag is set.
   static constexpr const char* kLocalMergeSpillEnabled = "local_merge_enabled";
 
+  /// Partitioned output buffer spilling flag, only applies if "spill_enabled"
+  /// flag is set. If true, the pages the consumers have not fetched yet are
+  /// spilled when the buffered size reaches kMaxOutputBufferSize instead of
+  /// blocking the producers.
+  static constexpr const char* kOutputBufferSpillEnabled =
+      "output_buffer_spill_enabled";
+
   /// Specify the max number of local sources to merge at a time.
   static constexpr const char* kLocalMergeMaxNumMergeSources =
       "local_merge_max_num_merge_sources";
@@ -312,10 +407,17 @@ class QueryConfig {
       "spill_write_buffer_size";
 
   /// Specifies the buffer size in bytes to read from one spilled file. If the
-  /// underlying filesystem supports async read, we do read-ahead with double
-  /// buffering, which doubles the buffer used to read from each spill file.
+  /// underlying filesystem supports async read, we do read-ahead with
+  /// 'spill_num_read_ahead_buffers' more buffers per spill file.
   static constexpr const char* kSpillReadBufferSize = "spill_read_buffer_size";
 
+  /// The number of read buffers prefetched ahead of the one being consumed
+  /// from each spilled file. If the underlying filesystem does not support
+  /// async read, the prefetch runs on the spill executor if it is set. Zero
+  /// disables read-ahead.
+  static constexpr const char* kSpillNumReadAheadBuffers =
+      "spill_num_read_ahead_buffers";
+
   /// Config used to create spill files. This config is provided to underlying
   /// file system and the config is free form. The form should be defined by the
   /// underlying file system.
@@ -354,6 +456,13 @@ class QueryConfig {
   static constexpr const char* kSpillableReservationGrowthPct =
       "spillable_reservation_growth_pct";
 
+  /// If true, hash build and order by operators record their peak memory
+  /// usage by plan fragment in the process wide ReservationHistory, and a
+  /// later run of the same fragment reserves the recorded usage before its
+  /// first input instead of growing the reservation step by step.
+  static constexpr const char* kOperatorReservationHistoryEnabled =
+      "operator_reservation_history_enabled";
+
   /// Minimum memory footprint size required to reclaim memory from a file
   /// writer by flushing its buffered data to disk.
   static constexpr const char* kWriterFlushThresholdBytes =
@@ -408,6 +517,70 @@ class QueryConfig {
   static constexpr const char* kMinTableRowsForParallelJoinBuild =
       "min_table_rows_for_parallel_join_build";
 
+  /// The maximum number of distinct join keys for which the hash probe pushes
+  /// down a bloom filter to the probe side table scan. Applies to single
+  /// integral join keys whose values do not fit an exact IN-list filter. Zero
+  /// disables bloom filter pushdown. Must fit in int32_t, the capacity type of
+  /// the bloom filter.
+  static constexpr const char* kHashProbeBloomFilterPushdownMaxSize =
+      "hash_probe_bloom_filter_pushdown_max_size";
+
+  /// If true, a spilling hash build makes a bloom filter over the key hashes
+  /// of each spilled partition. The hash probe then drops the probe rows of
+  /// spilled partitions that can't match instead of spilling them. Only
+  /// applies to joins that produce no output for unmatched probe rows.
+  static constexpr const char* kHashProbeSpillInputFilterEnabled =
+      "hash_probe_spill_input_filter_enabled";
+
+  /// If not empty, hash joins whose build side tables can be shared read-only
+  /// cache the built table in the process wide HashTableCache. The cache key
+  /// is this value plus the build side plan fragment. The value must identify
+  /// the build side input, e.g. the snapshot of the scanned tables, since
+  /// tasks with the same key reuse the table without reading their build
+  /// side splits.
+  static constexpr const char* kHashTableCacheKey = "hash_table_cache_key";
+
+  /// If not zero, hash join probes into tables larger than this many bytes
+  /// are radix partitioned by the hash bits that select the table bucket, so
+  /// that the probes of a batch visit the table one partition of about this
+  /// size at a time. Should be set to about the size of the last level
+  /// cache. 0 disables the partitioning.
+  static constexpr const char* kHashProbeRadixPartitionBytes =
+      "hash_probe_radix_partition_bytes";
+
+  /// If true, hash joins that don't spill produce the build side output
+  /// columns as lazy vectors that extract the values from the hash table when
+  /// first loaded. Consumers that drop most joined rows, e.g. a selective
+  /// filter or a limit, then skip copying the build side values of the dropped
+  /// rows.
+  static constexpr const char* kHashProbeLazyBuildColumns =
+      "hash_probe_lazy_build_columns";
+
+  /// If not zero, hash probes keep reading up to this many bytes of probe
+  /// input while the hash table is being built, for joins that produce no
+  /// output on empty probe input. If all the probe operators receive all
+  /// their input, and it is empty, before the table is ready, the build
+  /// operators stop reading the build side.
+  static constexpr const char* kHashProbePreBuildBufferBytes =
+      "hash_probe_pre_build_buffer_bytes";
+
+  /// If not zero, nested loop joins whose condition bounds a build column by a
+  /// probe column, e.g. 'p.ts BETWEEN b.start AND b.end', sort the build side
+  /// on the first such build column and split it into blocks of this many
+  /// rows. The probe skips the blocks whose value range cannot satisfy the
+  /// bounds for the current probe row. Should be small enough for a block to
+  /// fit in the L2 cache. 0 disables the band join optimization.
+  static constexpr const char* kNestedLoopJoinBandBlockRows =
+      "nested_loop_join_band_block_rows";
+
+  /// If true, nested loop joins whose condition has a spatial predicate such
+  /// as ST_Contains or ST_Intersects between a probe and a build geometry
+  /// column index the envelopes of the build geometries in an R-tree. Each
+  /// probe row then evaluates the join condition only against the build rows
+  /// whose envelope intersects its own.
+  static constexpr const char* kNestedLoopJoinSpatialIndexEnabled =
+      "nested_loop_join_spatial_index_enabled";
+
   /// If set to true, then during execution of tasks, the output vectors of
   /// every operator are validated for consistency. This is an expensive check
   /// so should only be used for debugging. It can help debug issues where
@@ -431,16 +604,43 @@ class QueryConfig {
   static constexpr const char* kMaxSharedSubexprResultsCached =
       "max_shared_subexpr_results_cached";
 
+  /// The maximum size in bytes of the results an expression memoizes for the
+  /// base of a dictionary encoded input. Batches over the same base, also if
+  /// it is a new vector over the same values buffer, reuse the results.
+  static constexpr const char* kMaxDictionaryMemoBytes =
+      "max_dictionary_memo_bytes";
+
   /// Maximum number of splits to preload. Set to 0 to disable preloading.
   static constexpr const char* kMaxSplitPreloadPerDriver =
       "max_split_preload_per_driver";
 
+  /// If true, the table scan adapts the number of splits to preload per driver
+  /// to the ratio of the time to open a split to the time to read it, up to
+  /// 'max_split_preload_per_driver'. The scan stops preloading when the query
+  /// memory usage exceeds 'table_scan_scale_up_memory_usage_ratio'.
+  static constexpr const char* kAdaptiveSplitPreloadEnabled =
+      "adaptive_split_preload_enabled";
+
+  /// If not zero, a table scan driver divides a split larger than this many
+  /// bytes into pieces of about this size when its peer drivers are short of
+  /// queued splits, and queues the pieces for the peers. Only the connectors
+  /// that support dividing splits, e.g. Hive for columnar file formats, do
+  /// so. Zero disables the division.
+  static constexpr const char* kTableScanSplitDivisionBytes =
+      "table_scan_split_division_bytes";
+
   /// If not zero, specifies the cpu time slice limit in ms that a driver thread
   /// can continuously run without yielding. If it is zero, then there is no
   /// limit.
   static constexpr const char* kDriverCpuTimeSliceLimitMs =
       "driver_cpu_time_slice_limit_ms";
 
+  /// Relative share of CPU time of the query when its Drivers run on an
+  /// exec::DriverScheduler. The CPU time of the query is divided by the weight
+  /// when choosing the scheduling level of the query. Must be positive.
+  static constexpr const char* kQuerySchedulingWeight =
+      "query_scheduling_weight";
+
   /// Maximum number of bytes to use for the normalized key in prefix-sort. Use
   /// 0 to disable prefix-sort.
   static constexpr const char* kPrefixSortNormalizedKeyMaxBytes =
@@ -455,6 +655,20 @@ class QueryConfig {
   static constexpr const char* kPrefixSortMaxStringPrefixLength =
       "prefixsort_max_string_prefix_length";
 
+  /// Maximum number of threads an OrderBy operator uses to sort its input.
+  /// With more than 1, the input is sorted in runs on the query executor and
+  /// the runs are merged in parallel by key range. 1 sorts on the driver
+  /// thread.
+  static constexpr const char* kOrderByParallelSortThreads =
+      "order_by_parallel_sort_threads";
+
+  /// Maximum number of threads a Window operator uses to compute the window
+  /// functions over sorted partitions. With more than 1, groups of
+  /// partitions are computed on the query executor and output in order. 1
+  /// computes on the driver thread.
+  static constexpr const char* kWindowParallelPartitionThreads =
+      "window_parallel_partition_threads";
+
   /// Enable query tracing flag.
   static constexpr const char* kQueryTraceEnabled = "query_trace_enabled";
 
@@ -522,6 +736,12 @@ class QueryConfig {
   static constexpr const char* kDebugMemoryPoolNameRegex =
       "debug_memory_pool_name_regex";
 
+  /// When debug is enabled for memory manager, the memory pools matching
+  /// 'debug_memory_pool_name_regex' record the callsite of one out of every
+  /// this many allocations. Default to record all of them.
+  static constexpr const char* kDebugMemoryPoolAllocSampleRate =
+      "debug_memory_pool_alloc_sample_rate";
+
   /// Some lambda functions over arrays and maps are evaluated in batches of the
   /// underlying elements that comprise the arrays/maps. This is done to make
   /// the batch size managable as array vectors can have thousands of elements
@@ -591,11 +811,50 @@ class QueryConfig {
   static constexpr const char* kTableScanScaleUpMemoryUsageRatio =
       "table_scan_scale_up_memory_usage_ratio";
 
+  /// If true, enables the scaled processing of the pipelines fed by a round
+  /// robin local exchange. For each such exchange, a driver controller sends
+  /// the data to a subset of the consumer drivers. It adds a consumer driver
+  /// when the running ones do not keep up with the producers and parks one
+  /// when the running ones mostly wait for data.
+  static constexpr const char* kLocalExchangeScaledProcessingEnabled =
+      "local_exchange_scaled_processing_enabled";
+
+  /// The query memory usage ratio below which the local exchange driver
+  /// controller can add a consumer driver. The value is in the range of [0,
+  /// 1].
+  ///
+  /// NOTE: this only applies if 'local_exchange_scaled_processing_enabled' is
+  /// true.
+  static constexpr const char* kLocalExchangeScaleUpMemoryUsageRatio =
+      "local_exchange_scale_up_memory_usage_ratio";
+
+  /// If true, a hash repartitioning local exchange in front of a partial or
+  /// intermediate aggregation or the probe side of a hash join sends the rows
+  /// of a hot partition to several consumer drivers. The partitions are
+  /// rebalanced by a skewed partition balancer which uses the
+  /// 'scaled_writer_*' rebalance thresholds. The results of a split partition
+  /// are merged by the downstream final aggregation or are independent for a
+  /// join probe.
+  static constexpr const char* kLocalExchangeSkewRebalanceEnabled =
+      "local_exchange_skew_rebalance_enabled";
+
   /// Specifies the shuffle compression kind which is defined by
   /// CompressionKind. If it is CompressionKind_NONE, then no compression.
   static constexpr const char* kShuffleCompressionKind =
       "shuffle_compression_codec";
 
+  /// If true, the Presto shuffle serializer sends a column that is constant
+  /// in all the rows of a page, e.g. a partition key of a table scan, as a
+  /// single RLE value instead of repeating it for each row.
+  static constexpr const char* kShufflePreserveConstants =
+      "shuffle_preserve_constants";
+
+  /// If true, the Presto shuffle serializer sends integer, bigint and
+  /// timestamp columns as frame of reference or delta bit packed values when
+  /// that is smaller. The pages can only be read by Velox workers.
+  static constexpr const char* kShuffleLightweightEncodings =
+      "shuffle_lightweight_encodings";
+
   /// If a key is found in multiple given maps, by default that key's value in
   /// the resulting map comes from the last one of those maps. When true, throw
   /// exception on duplicate map key.
@@ -613,6 +872,19 @@ class QueryConfig {
   static constexpr const char* kIndexLookupJoinSplitOutput =
       "index_lookup_join_split_output";
 
+  /// If true, the index join operator sends only the distinct lookup input
+  /// rows of each input batch to the index source, and expands the lookup
+  /// results back to the duplicate input rows.
+  static constexpr const char* kIndexLookupJoinDedupKeys =
+      "index_lookup_join_dedup_keys";
+
+  /// If not zero, each index join operator caches up to this many bytes of
+  /// lookup results per distinct lookup input row in an LRU cache, so that
+  /// keys repeated across input batches are only looked up once. Implies
+  /// 'index_lookup_join_dedup_keys'.
+  static constexpr const char* kIndexLookupJoinResultCacheBytes =
+      "index_lookup_join_result_cache_bytes";
+
   // Max wait time for exchange request in seconds.
   static constexpr const char* kRequestDataSizesMaxWaitSec =
       "request_data_sizes_max_wait_sec";
@@ -647,6 +919,14 @@ class QueryConfig {
   static constexpr const char* kEnableOperatorBatchSizeStats =
       "enable_operator_batch_size_stats";
 
+  /// If this is true, the driver records the rows, the encodings of the top
+  /// level columns and the null ratio of each vector passed between two
+  /// operators as runtime stats of both operators. This shows where the
+  /// encodings are lost and where the batches become small. The cost is
+  /// proportional to the number of columns.
+  static constexpr const char* kEnableOperatorEncodingStats =
+      "enable_operator_encoding_stats";
+
   /// If this is true, then the unnest operator might split output for each
   /// input batch based on the output batch size control. Otherwise, it produces
   /// a single output for each input batch.
@@ -687,6 +967,10 @@ class QueryConfig {
     return get<std::string>(kDebugMemoryPoolNameRegex, "");
   }
 
+  uint32_t debugMemoryPoolAllocSampleRate() const {
+    return get<uint32_t>(kDebugMemoryPoolAllocSampleRate, 1);
+  }
+
   std::optional<uint32_t> debugAggregationApproxPercentileFixedRandomSeed()
       const {
     return get<uint32_t>(kDebugAggregationApproxPercentileFixedRandomSeed);
@@ -724,6 +1008,22 @@ class QueryConfig {
     return get<int32_t>(kAbandonPartialAggregationMinPct, 80);
   }
 
+  bool aggregationHotGroupCacheEnabled() const {
+    return get<bool>(kAggregationHotGroupCacheEnabled, false);
+  }
+
+  int32_t aggregationUpdateBlockRows() const {
+    return get<int32_t>(kAggregationUpdateBlockRows, 0);
+  }
+
+  int64_t aggregationClusteredInputDetectionRows() const {
+    return get<int64_t>(kAggregationClusteredInputDetectionRows, 0);
+  }
+
+  uint64_t distinctAggregationDedupThreshold() const {
+    return get<uint64_t>(kDistinctAggregationDedupThreshold, 0);
+  }
+
   int32_t abandonPartialTopNRowNumberMinRows() const {
     return get<int32_t>(kAbandonPartialTopNRowNumberMinRows, 100'000);
   }
@@ -751,6 +1051,10 @@ class QueryConfig {
     return get<uint64_t>(kMaxPartitionedOutputBufferSize, kDefault);
   }
 
+  bool partitionedOutputArenaReuseEnabled() const {
+    return get<bool>(kPartitionedOutputArenaReuseEnabled, false);
+  }
+
   uint64_t maxOutputBufferSize() const {
     static constexpr uint64_t kDefault = 32UL << 20;
     return get<uint64_t>(kMaxOutputBufferSize, kDefault);
@@ -798,11 +1102,25 @@ class QueryConfig {
     return get<uint64_t>(kMaxMergeExchangeBufferSize, kDefault);
   }
 
+  uint32_t localMergeSourceQueueSize() const {
+    const auto queueSize = get<uint32_t>(kLocalMergeSourceQueueSize, 2);
+    VELOX_CHECK_GT(queueSize, 0);
+    return queueSize;
+  }
+
   uint64_t minExchangeOutputBatchBytes() const {
     static constexpr uint64_t kDefault = 2UL << 20;
     return get<uint64_t>(kMinExchangeOutputBatchBytes, kDefault);
   }
 
+  bool exchangeAdaptiveFlowControlEnabled() const {
+    return get<bool>(kExchangeAdaptiveFlowControlEnabled, false);
+  }
+
+  bool exchangeZeroCopyDeserializationEnabled() const {
+    return get<bool>(kExchangeZeroCopyDeserializationEnabled, false);
+  }
+
   uint64_t preferredOutputBatchBytes() const {
     static constexpr uint64_t kDefault = 10UL << 20;
     return get<uint64_t>(kPreferredOutputBatchBytes, kDefault);
@@ -883,6 +1201,10 @@ class QueryConfig {
     return get<bool>(kJoinSpillEnabled, true);
   }
 
+  std::string hashBuildFileBackedDirectory() const {
+    return get<std::string>(kHashBuildFileBackedDirectory, "");
+  }
+
   bool mixedGroupedModeHashJoinSpillEnabled() const {
     return get<bool>(kMixedGroupedModeHashJoinSpillEnabled, false);
   }
@@ -903,6 +1225,10 @@ class QueryConfig {
     return get<bool>(kRowNumberSpillEnabled, true);
   }
 
+  bool markDistinctSpillEnabled() const {
+    return get<bool>(kMarkDistinctSpillEnabled, false);
+  }
+
   bool topNRowNumberSpillEnabled() const {
     return get<bool>(kTopNRowNumberSpillEnabled, true);
   }
@@ -911,6 +1237,10 @@ class QueryConfig {
     return get<bool>(kLocalMergeSpillEnabled, false);
   }
 
+  bool outputBufferSpillEnabled() const {
+    return get<bool>(kOutputBufferSpillEnabled, false);
+  }
+
   uint32_t localMergeMaxNumMergeSources() const {
     const auto maxNumMergeSources = get<uint32_t>(
         kLocalMergeMaxNumMergeSources, std::numeric_limits<uint32_t>::max());
@@ -961,6 +1291,10 @@ class QueryConfig {
     return get<uint64_t>(kSpillReadBufferSize, 1L << 20);
   }
 
+  uint32_t spillNumReadAheadBuffers() const {
+    return get<uint32_t>(kSpillNumReadAheadBuffers, 1);
+  }
+
   std::string spillFileCreateConfig() const {
     return get<std::string>(kSpillFileCreateConfig, "");
   }
@@ -975,6 +1309,10 @@ class QueryConfig {
     return get<int32_t>(kSpillableReservationGrowthPct, kDefaultPct);
   }
 
+  bool operatorReservationHistoryEnabled() const {
+    return get<bool>(kOperatorReservationHistoryEnabled, false);
+  }
+
   bool queryTraceEnabled() const {
     return get<bool>(kQueryTraceEnabled, false);
   }
@@ -1059,10 +1397,22 @@ class QueryConfig {
     return get<bool>(kExprTrackCpuUsage, false);
   }
 
+  bool exprFuseSimpleFunctions() const {
+    return get<bool>(kExprFuseSimpleFunctions, false);
+  }
+
+  uint32_t exprFunctionProfileSampleRate() const {
+    return get<uint32_t>(kExprFunctionProfileSampleRate, 0);
+  }
+
   bool operatorTrackCpuUsage() const {
     return get<bool>(kOperatorTrackCpuUsage, true);
   }
 
+  bool operatorTrackPerfCounters() const {
+    return get<bool>(kOperatorTrackPerfCounters, false);
+  }
+
   uint32_t taskWriterCount() const {
     return get<uint32_t>(kTaskWriterCount, 4);
   }
@@ -1080,6 +1430,46 @@ class QueryConfig {
     return get<uint32_t>(kMinTableRowsForParallelJoinBuild, 1'000);
   }
 
+  uint64_t hashProbeBloomFilterPushdownMaxSize() const {
+    const auto maxSize = get<uint64_t>(kHashProbeBloomFilterPushdownMaxSize, 0);
+    VELOX_USER_CHECK_LE(
+        maxSize,
+        std::numeric_limits<int32_t>::max(),
+        "{} cannot exceed the int32_t max",
+        kHashProbeBloomFilterPushdownMaxSize);
+    return maxSize;
+  }
+
+  bool hashProbeSpillInputFilterEnabled() const {
+    return get<bool>(kHashProbeSpillInputFilterEnabled, true);
+  }
+
+  std::string hashTableCacheKey() const {
+    return get<std::string>(kHashTableCacheKey, "");
+  }
+
+  uint64_t hashProbeRadixPartitionBytes() const {
+    return get<uint64_t>(kHashProbeRadixPartitionBytes, 0);
+  }
+
+  bool hashProbeLazyBuildColumns() const {
+    return get<bool>(kHashProbeLazyBuildColumns, false);
+  }
+
+  uint64_t hashProbePreBuildBufferBytes() const {
+    return get<uint64_t>(kHashProbePreBuildBufferBytes, 0);
+  }
+
+  vector_size_t nestedLoopJoinBandBlockRows() const {
+    const uint32_t blockRows = get<uint32_t>(kNestedLoopJoinBandBlockRows, 0);
+    VELOX_USER_CHECK_LE(blockRows, std::numeric_limits<vector_size_t>::max());
+    return blockRows;
+  }
+
+  bool nestedLoopJoinSpatialIndexEnabled() const {
+    return get<bool>(kNestedLoopJoinSpatialIndexEnabled, true);
+  }
+
   bool validateOutputFromOperators() const {
     return get<bool>(kValidateOutputFromOperators, false);
   }
@@ -1104,14 +1494,34 @@ class QueryConfig {
     return get<uint32_t>(kMaxSharedSubexprResultsCached, 10);
   }
 
+  uint64_t maxDictionaryMemoBytes() const {
+    static constexpr uint64_t kDefault = 64UL << 20;
+    return get<uint64_t>(kMaxDictionaryMemoBytes, kDefault);
+  }
+
   int32_t maxSplitPreloadPerDriver() const {
     return get<int32_t>(kMaxSplitPreloadPerDriver, 2);
   }
 
+  bool adaptiveSplitPreloadEnabled() const {
+    return get<bool>(kAdaptiveSplitPreloadEnabled, false);
+  }
+
+  uint64_t tableScanSplitDivisionBytes() const {
+    return get<uint64_t>(kTableScanSplitDivisionBytes, 0);
+  }
+
   uint32_t driverCpuTimeSliceLimitMs() const {
     return get<uint32_t>(kDriverCpuTimeSliceLimitMs, 0);
   }
 
+  double querySchedulingWeight() const {
+    const auto weight = get<double>(kQuerySchedulingWeight, 1.0);
+    VELOX_USER_CHECK_GT(
+        weight, 0, "{} must be positive", kQuerySchedulingWeight);
+    return weight;
+  }
+
   uint32_t prefixSortNormalizedKeyMaxBytes() const {
     return get<uint32_t>(kPrefixSortNormalizedKeyMaxBytes, 128);
   }
@@ -1124,6 +1534,14 @@ class QueryConfig {
     return get<uint32_t>(kPrefixSortMaxStringPrefixLength, 16);
   }
 
+  uint32_t orderByParallelSortThreads() const {
+    return get<uint32_t>(kOrderByParallelSortThreads, 1);
+  }
+
+  uint32_t windowParallelPartitionThreads() const {
+    return get<uint32_t>(kWindowParallelPartitionThreads, 1);
+  }
+
   double scaleWriterRebalanceMaxMemoryUsageRatio() const {
     return get<double>(kScaleWriterRebalanceMaxMemoryUsageRatio, 0.7);
   }
@@ -1150,6 +1568,18 @@ class QueryConfig {
     return get<double>(kTableScanScaleUpMemoryUsageRatio, 0.7);
   }
 
+  bool localExchangeScaledProcessingEnabled() const {
+    return get<bool>(kLocalExchangeScaledProcessingEnabled, false);
+  }
+
+  double localExchangeScaleUpMemoryUsageRatio() const {
+    return get<double>(kLocalExchangeScaleUpMemoryUsageRatio, 0.7);
+  }
+
+  bool localExchangeSkewRebalanceEnabled() const {
+    return get<bool>(kLocalExchangeSkewRebalanceEnabled, false);
+  }
+
   uint32_t indexLookupJoinMaxPrefetchBatches() const {
     return get<uint32_t>(kIndexLookupJoinMaxPrefetchBatches, 0);
   }
@@ -1158,10 +1588,26 @@ class QueryConfig {
     return get<bool>(kIndexLookupJoinSplitOutput, true);
   }
 
+  bool indexLookupJoinDedupKeys() const {
+    return get<bool>(kIndexLookupJoinDedupKeys, false);
+  }
+
+  uint64_t indexLookupJoinResultCacheBytes() const {
+    return get<uint64_t>(kIndexLookupJoinResultCacheBytes, 0);
+  }
+
   std::string shuffleCompressionKind() const {
     return get<std::string>(kShuffleCompressionKind, "none");
   }
 
+  bool shufflePreserveConstants() const {
+    return get<bool>(kShufflePreserveConstants, false);
+  }
+
+  bool shuffleLightweightEncodings() const {
+    return get<bool>(kShuffleLightweightEncodings, false);
+  }
+
   int32_t requestDataSizesMaxWaitSec() const {
     return get<int32_t>(kRequestDataSizesMaxWaitSec, 10);
   }
@@ -1191,6 +1637,10 @@ class QueryConfig {
     return get<bool>(kEnableOperatorBatchSizeStats, true);
   }
 
+  bool enableOperatorEncodingStats() const {
+    return get<bool>(kEnableOperatorEncodingStats, false);
+  }
+
   bool unnestSplitOutput() const {
     return get<bool>(kUnnestSplitOutput, true);
   }
@@ -259,6 +259,7 @@ class ExecCtx {
           !queryConfig.debugDisableExpressionsWithLazyInputs();
       maxSharedSubexprResultsCached =
           queryConfig.maxSharedSubexprResultsCached();
+      maxDictionaryMemoBytes = queryConfig.maxDictionaryMemoBytes();
     }
 
     /// True if caches in expression evaluation used for performance are
@@ -281,6 +282,9 @@ class ExecCtx {
     /// The maximum number of distinct inputs to cache results in a
     /// given shared subexpression during experssion evaluation.
     uint32_t maxSharedSubexprResultsCached;
+    /// The maximum size of the results an expression memoizes for the base of
+    /// a dictionary encoded input.
+    uint64_t maxDictionaryMemoBytes;
   };
 
   velox::memory::MemoryPool* pool() const {
@@ -694,6 +694,7 @@ class UDFHolder {
   DECLARE_METHOD_RESOLVER(callNullable_method_resolver, callNullable);
   DECLARE_METHOD_RESOLVER(callNullFree_method_resolver, callNullFree);
   DECLARE_METHOD_RESOLVER(callAscii_method_resolver, callAscii);
+  DECLARE_METHOD_RESOLVER(callBatch_method_resolver, callBatch);
   DECLARE_METHOD_RESOLVER(initialize_method_resolver, initialize);
 
   // Check which flavor of the call()/callNullable()/callNullFree() method is
@@ -713,7 +714,13 @@ class UDFHolder {
   // Optionally, UDFs can also provide the following methods:
   //
   // - bool|void callAscii(...)
+  // - void callBatch(out_type* out, int32_t numRows, const arg_type*...)
   // - void initialize(...)
+  //
+  // callBatch() computes 'numRows' results from arrays of non-null
+  // arguments. It is used together with call() for flat inputs without
+  // nulls and must produce the same results, e.g. with a loop the compiler
+  // can vectorize. 'out' may alias one of the arguments.
 
   // call():
   static constexpr bool udf_has_call_return_bool = util::has_method<
@@ -829,6 +836,15 @@ class UDFHolder {
         (udf_has_callAscii_return_void && udf_has_call_return_bool)),
       "The return type for callAscii() must match the return type for call().");
 
+  // callBatch():
+  static constexpr bool udf_has_callBatch = util::has_method<
+      Fun,
+      callBatch_method_resolver,
+      void,
+      exec_return_type*,
+      int32_t,
+      const exec_arg_type<TArgs>*...>::value;
+
   // initialize():
   static constexpr bool udf_has_initialize = util::has_method<
       Fun,
@@ -978,6 +994,19 @@ class UDFHolder {
     }
   }
 
+  FOLLY_ALWAYS_INLINE void callBatch(
+      exec_return_type* out,
+      int32_t numRows,
+      const typename exec_resolver<TArgs>::in_type*... args) {
+    if constexpr (udf_has_callBatch) {
+      instance_.callBatch(out, numRows, args...);
+    } else {
+      VELOX_UNREACHABLE(
+          "callBatch should never be called if the UDF does not "
+          "implement callBatch.");
+    }
+  }
+
   FOLLY_ALWAYS_INLINE Status callNullFree(
       exec_return_type& out,
       bool& notNull,
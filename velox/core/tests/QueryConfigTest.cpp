@@ -56,6 +56,18 @@ TEST_F(QueryConfigTest, invalidConfig) {
       "session 'session_timezone' set with invalid value 'invalid'");
 }
 
+TEST_F(QueryConfigTest, hashProbeBloomFilterPushdownMaxSize) {
+  EXPECT_EQ(QueryConfig{{}}.hashProbeBloomFilterPushdownMaxSize(), 0);
+  const QueryConfig config{
+      {{QueryConfig::kHashProbeBloomFilterPushdownMaxSize, "1000000"}}};
+  EXPECT_EQ(config.hashProbeBloomFilterPushdownMaxSize(), 1'000'000);
+  const QueryConfig tooLarge{
+      {{QueryConfig::kHashProbeBloomFilterPushdownMaxSize, "4294967296"}}};
+  VELOX_ASSERT_USER_THROW(
+      tooLarge.hashProbeBloomFilterPushdownMaxSize(),
+      "cannot exceed the int32_t max");
+}
+
 TEST_F(QueryConfigTest, taskWriterCountConfig) {
   struct {
     std::optional<int> numWriterCounter;
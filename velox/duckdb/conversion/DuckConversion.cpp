@@ -15,6 +15,8 @@
  */
 #include "velox/duckdb/conversion/DuckConversion.h"
 #include "velox/type/Variant.h"
+#include "velox/vector/ComplexVector.h"
+#include "velox/vector/FlatVector.h"
 
 namespace facebook::velox::duckdb {
 using ::duckdb::DataChunk;
@@ -252,4 +254,231 @@ std::string makeCreateTableSql(
   return sql.str();
 }
 
+namespace {
+
+// Keeps the DuckDB chunk alive while Velox buffers point into it.
+class DataChunkReleaser {
+ public:
+  explicit DataChunkReleaser(std::shared_ptr<DataChunk> chunk)
+      : chunk_(std::move(chunk)) {}
+
+  void addRef() const {}
+  void release() const {}
+
+ private:
+  const std::shared_ptr<DataChunk> chunk_;
+};
+
+BufferPtr wrapDuckBuffer(
+    const void* data,
+    size_t bytes,
+    const std::shared_ptr<DataChunk>& chunk) {
+  return BufferView<DataChunkReleaser>::create(
+      static_cast<const uint8_t*>(data), bytes, DataChunkReleaser(chunk));
+}
+
+// Returns Velox nulls sharing the validity mask of a flat DuckDB vector or
+// nullptr if all rows are valid. Both set the bit of non-null rows, lsb first.
+BufferPtr wrapValidity(
+    Vector& vector,
+    vector_size_t size,
+    const std::shared_ptr<DataChunk>& chunk) {
+  auto& validity = ::duckdb::FlatVector::Validity(vector);
+  if (validity.AllValid()) {
+    return nullptr;
+  }
+  return wrapDuckBuffer(validity.GetData(), bits::nbytes(size), chunk);
+}
+
+template <typename T>
+VectorPtr shareFlat(
+    Vector& vector,
+    const TypePtr& type,
+    vector_size_t size,
+    BufferPtr nulls,
+    const std::shared_ptr<DataChunk>& chunk,
+    memory::MemoryPool* pool) {
+  auto values = wrapDuckBuffer(vector.GetData(), size * sizeof(T), chunk);
+  return std::make_shared<FlatVector<T>>(
+      pool,
+      type,
+      std::move(nulls),
+      size,
+      std::move(values),
+      std::vector<BufferPtr>{});
+}
+
+template <typename From, typename To, typename Convert>
+VectorPtr copyFlat(
+    Vector& vector,
+    const TypePtr& type,
+    vector_size_t size,
+    BufferPtr nulls,
+    memory::MemoryPool* pool,
+    Convert convert) {
+  auto result = BaseVector::create<FlatVector<To>>(type, size, pool);
+  auto* data = reinterpret_cast<const From*>(vector.GetData());
+  for (auto i = 0; i < size; ++i) {
+    result->set(i, convert(data[i]));
+  }
+  if (nulls) {
+    result->setNulls(std::move(nulls));
+  }
+  return result;
+}
+
+// Shares integers whose DuckDB physical width matches Velox and widens the
+// narrower ones, e.g. DECIMAL(4, 2) stored as int16.
+template <typename T>
+VectorPtr integerFlat(
+    Vector& vector,
+    const TypePtr& type,
+    vector_size_t size,
+    BufferPtr nulls,
+    const std::shared_ptr<DataChunk>& chunk,
+    memory::MemoryPool* pool) {
+  const auto physical = vector.GetType().InternalType();
+  if (::duckdb::GetTypeIdSize(physical) == sizeof(T)) {
+    return shareFlat<T>(vector, type, size, std::move(nulls), chunk, pool);
+  }
+  auto widen = [](auto value) { return static_cast<T>(value); };
+  switch (physical) {
+    case ::duckdb::PhysicalType::INT8:
+      return copyFlat<int8_t, T>(
+          vector, type, size, std::move(nulls), pool, widen);
+    case ::duckdb::PhysicalType::INT16:
+      return copyFlat<int16_t, T>(
+          vector, type, size, std::move(nulls), pool, widen);
+    case ::duckdb::PhysicalType::INT32:
+      return copyFlat<int32_t, T>(
+          vector, type, size, std::move(nulls), pool, widen);
+    default:
+      VELOX_NYI(
+          "Unsupported DuckDB physical type for {}: {}",
+          type->toString(),
+          vector.GetType().ToString());
+  }
+}
+
+VectorPtr toVeloxFlat(
+    Vector& vector,
+    const TypePtr& type,
+    vector_size_t size,
+    BufferPtr nulls,
+    const std::shared_ptr<DataChunk>& chunk,
+    memory::MemoryPool* pool) {
+  switch (type->kind()) {
+    case TypeKind::BOOLEAN:
+      // DuckDB uses a byte per value.
+      return copyFlat<bool, bool>(
+          vector, type, size, std::move(nulls), pool, [](bool value) {
+            return value;
+          });
+    case TypeKind::TINYINT:
+      return integerFlat<int8_t>(
+          vector, type, size, std::move(nulls), chunk, pool);
+    case TypeKind::SMALLINT:
+      return integerFlat<int16_t>(
+          vector, type, size, std::move(nulls), chunk, pool);
+    case TypeKind::INTEGER:
+      // DATE is days since epoch in both.
+      return integerFlat<int32_t>(
+          vector, type, size, std::move(nulls), chunk, pool);
+    case TypeKind::BIGINT:
+      return integerFlat<int64_t>(
+          vector, type, size, std::move(nulls), chunk, pool);
+    case TypeKind::HUGEINT:
+      // hugeint_t is {lower, upper}, the little endian layout of int128_t.
+      static_assert(sizeof(::duckdb::hugeint_t) == sizeof(int128_t));
+      return integerFlat<int128_t>(
+          vector, type, size, std::move(nulls), chunk, pool);
+    case TypeKind::REAL:
+      return shareFlat<float>(
+          vector, type, size, std::move(nulls), chunk, pool);
+    case TypeKind::DOUBLE:
+      return shareFlat<double>(
+          vector, type, size, std::move(nulls), chunk, pool);
+    case TypeKind::VARCHAR:
+    case TypeKind::VARBINARY:
+      // string_t and StringView have the same layout: a 4 byte size, a 4 byte
+      // prefix and then either 8 more zero padded inline bytes or a pointer
+      // to the whole string. Non-inline strings stay in the chunk's heap.
+      static_assert(sizeof(string_t) == sizeof(StringView));
+      static_assert(string_t::INLINE_LENGTH == StringView::kInlineSize);
+      return shareFlat<StringView>(
+          vector, type, size, std::move(nulls), chunk, pool);
+    case TypeKind::TIMESTAMP:
+      return copyFlat<timestamp_t, Timestamp>(
+          vector, type, size, std::move(nulls), pool, duckdbTimestampToVelox);
+    default:
+      VELOX_NYI(
+          "Unsupported type for DuckDB vector conversion: {}",
+          type->toString());
+  }
+}
+
+VectorPtr toVeloxVector(
+    Vector& vector,
+    const TypePtr& type,
+    vector_size_t size,
+    const std::shared_ptr<DataChunk>& chunk,
+    memory::MemoryPool* pool) {
+  switch (vector.GetVectorType()) {
+    case VectorType::FLAT_VECTOR:
+      return toVeloxFlat(
+          vector, type, size, wrapValidity(vector, size, chunk), chunk, pool);
+    case VectorType::CONSTANT_VECTOR:
+      if (::duckdb::ConstantVector::IsNull(vector)) {
+        return BaseVector::createNullConstant(type, size, pool);
+      }
+      return BaseVector::wrapInConstant(
+          size, 0, toVeloxFlat(vector, type, 1, nullptr, chunk, pool));
+    case VectorType::DICTIONARY_VECTOR: {
+      auto& selection = ::duckdb::DictionaryVector::SelVector(vector);
+      auto& child = ::duckdb::DictionaryVector::Child(vector);
+      if (selection.data() == nullptr) {
+        // Identity selection.
+        return toVeloxVector(child, type, size, chunk, pool);
+      }
+      // The DuckDB dictionary does not record its size, so convert as many
+      // base rows as the selection references.
+      static_assert(sizeof(::duckdb::sel_t) == sizeof(vector_size_t));
+      vector_size_t baseSize = 0;
+      for (auto i = 0; i < size; ++i) {
+        baseSize =
+            std::max<vector_size_t>(baseSize, selection.get_index(i) + 1);
+      }
+      auto indices = wrapDuckBuffer(
+          selection.data(), size * sizeof(vector_size_t), chunk);
+      return BaseVector::wrapInDictionary(
+          nullptr,
+          std::move(indices),
+          size,
+          toVeloxVector(child, type, baseSize, chunk, pool));
+    }
+    default:
+      // Sequence and compressed vectors have no Velox counterpart.
+      vector.Flatten(size);
+      return toVeloxVector(vector, type, size, chunk, pool);
+  }
+}
+
+} // namespace
+
+RowVectorPtr toVeloxRowVector(
+    const std::shared_ptr<DataChunk>& chunk,
+    const RowTypePtr& rowType,
+    memory::MemoryPool* pool) {
+  VELOX_CHECK_EQ(chunk->ColumnCount(), rowType->size());
+  const vector_size_t size = chunk->size();
+  std::vector<VectorPtr> children;
+  children.reserve(rowType->size());
+  for (auto i = 0; i < rowType->size(); ++i) {
+    children.push_back(toVeloxVector(
+        chunk->data[i], rowType->childAt(i), size, chunk, pool));
+  }
+  return std::make_shared<RowVector>(
+      pool, rowType, nullptr, size, std::move(children));
+}
+
 } // namespace facebook::velox::duckdb
@@ -21,7 +21,12 @@
 
 namespace facebook::velox {
 class Variant;
+class RowVector;
+using RowVectorPtr = std::shared_ptr<RowVector>;
+namespace memory {
+class MemoryPool;
 }
+} // namespace facebook::velox
 
 namespace facebook::velox::duckdb {
 
@@ -211,6 +216,18 @@ struct DuckDateConversion {
   }
 };
 
+/// Converts 'chunk' to a RowVector of 'rowType' without per-row copies where
+/// DuckDB and Velox agree on the physical layout. Flat integer, floating
+/// point, date, long decimal and string vectors share the DuckDB data and
+/// validity buffers. DuckDB constant and dictionary vectors become Velox
+/// constant and dictionary vectors, the dictionary sharing the DuckDB
+/// selection vector as indices. Booleans, timestamps and short decimals
+/// stored narrower than 64 bits are copied. The result keeps 'chunk' alive.
+RowVectorPtr toVeloxRowVector(
+    const std::shared_ptr<::duckdb::DataChunk>& chunk,
+    const RowTypePtr& rowType,
+    memory::MemoryPool* pool);
+
 /// Returns CREATE TABLE <tableName>(<schema>) DuckDB SQL.
 std::string makeCreateTableSql(
     const std::string& tableName,
@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 #include <limits>
 #include "velox/type/Variant.h"
+#include "velox/vector/tests/utils/VectorTestBase.h"
 
 using namespace facebook::velox;
 using namespace facebook::velox::duckdb;
@@ -174,3 +175,109 @@ TEST(DuckConversionTest, createTable) {
                   {ARRAY(INTEGER()), MAP(INTEGER(), VARCHAR()), TIMESTAMP()}),
           }));
 }
+
+class DuckVectorConversionTest : public testing::Test,
+                                 public test::VectorTestBase {
+ protected:
+  static void SetUpTestCase() {
+    memory::MemoryManager::testingSetInstance(memory::MemoryManager::Options{});
+  }
+
+  std::shared_ptr<::duckdb::DataChunk> query(const std::string& sql) {
+    auto result = con_.Query(sql);
+    VELOX_CHECK(!result->HasError(), "{}", result->GetError());
+    return std::shared_ptr<::duckdb::DataChunk>(result->Fetch());
+  }
+
+  ::duckdb::DuckDB db_;
+  ::duckdb::Connection con_{db_};
+};
+
+TEST_F(DuckVectorConversionTest, flat) {
+  auto chunk = query(
+      "SELECT * FROM (VALUES "
+      "(1::BIGINT, 1.5::DOUBLE, 'a'::VARCHAR, 10::SMALLINT, true), "
+      "(NULL, 2.5, 'a string longer than twelve', NULL, false), "
+      "(3, NULL, NULL, 30, NULL)) t(a, b, c, d, e)");
+  auto rowType = ROW(
+      {"a", "b", "c", "d", "e"},
+      {BIGINT(), DOUBLE(), VARCHAR(), SMALLINT(), BOOLEAN()});
+  auto result = toVeloxRowVector(chunk, rowType, pool());
+
+  auto expected = makeRowVector(
+      {"a", "b", "c", "d", "e"},
+      {
+          makeNullableFlatVector<int64_t>({1, std::nullopt, 3}),
+          makeNullableFlatVector<double>({1.5, 2.5, std::nullopt}),
+          makeNullableFlatVector<std::string>(
+              {"a", "a string longer than twelve", std::nullopt}),
+          makeNullableFlatVector<int16_t>({10, std::nullopt, 30}),
+          makeNullableFlatVector<bool>({true, false, std::nullopt}),
+      });
+  test::assertEqualVectors(expected, result);
+
+  // Fixed width values and strings are not copied.
+  EXPECT_EQ(
+      result->childAt(0)->values()->as<uint8_t>(), chunk->data[0].GetData());
+  EXPECT_EQ(
+      result->childAt(2)->values()->as<uint8_t>(), chunk->data[2].GetData());
+}
+
+TEST_F(DuckVectorConversionTest, decimalAndDate) {
+  auto chunk = query(
+      "SELECT 1.25::DECIMAL(4, 2), 123456789.5::DECIMAL(12, 1), "
+      "12345678901234567890.5::DECIMAL(30, 1), DATE '2024-01-02'");
+  auto rowType =
+      ROW({"a", "b", "c", "d"},
+          {DECIMAL(4, 2), DECIMAL(12, 1), DECIMAL(30, 1), DATE()});
+  auto result = toVeloxRowVector(chunk, rowType, pool());
+
+  auto expected = makeRowVector(
+      {"a", "b", "c", "d"},
+      {
+          makeFlatVector<int64_t>({125}, DECIMAL(4, 2)),
+          makeFlatVector<int64_t>({1234567895}, DECIMAL(12, 1)),
+          makeFlatVector<int128_t>(
+              {HugeInt::parse("123456789012345678905")}, DECIMAL(30, 1)),
+          makeFlatVector<int32_t>({19724}, DATE()),
+      });
+  test::assertEqualVectors(expected, result);
+}
+
+TEST_F(DuckVectorConversionTest, constantAndDictionary) {
+  auto chunk = std::make_shared<::duckdb::DataChunk>();
+  chunk->Initialize(
+      ::duckdb::Allocator::DefaultAllocator(),
+      {LogicalType::BIGINT, LogicalType::BIGINT, LogicalType::VARCHAR});
+  chunk->SetCardinality(4);
+
+  chunk->data[0].Reference(Value::BIGINT(7));
+  chunk->data[2].Reference(Value(LogicalType::VARCHAR));
+
+  ::duckdb::Vector base(LogicalType::BIGINT);
+  auto* baseValues = ::duckdb::FlatVector::GetData<int64_t>(base);
+  baseValues[0] = 10;
+  baseValues[1] = 20;
+  baseValues[2] = 30;
+  ::duckdb::SelectionVector selection(4);
+  for (auto i = 0; i < 4; ++i) {
+    selection.set_index(i, 2 - i % 3);
+  }
+  chunk->data[1].Slice(base, selection, 4);
+
+  auto rowType = ROW({"a", "b", "c"}, {BIGINT(), BIGINT(), VARCHAR()});
+  auto result = toVeloxRowVector(chunk, rowType, pool());
+
+  ASSERT_TRUE(result->childAt(0)->isConstantEncoding());
+  ASSERT_EQ(result->childAt(1)->encoding(), VectorEncoding::Simple::DICTIONARY);
+  ASSERT_TRUE(result->childAt(2)->isConstantEncoding());
+
+  auto expected = makeRowVector(
+      {"a", "b", "c"},
+      {
+          makeConstant<int64_t>(7, 4),
+          makeFlatVector<int64_t>({30, 20, 10, 30}),
+          makeNullConstant(TypeKind::VARCHAR, 4),
+      });
+  test::assertEqualVectors(expected, result);
+}
@@ -169,11 +169,71 @@ int32_t decode1To24(
   return i;
 }
 
+// Decodes widths that do not fit a 32 bit gather after shifting by up to 7
+// bits. Each half of the 8 rows is gathered as 4 64 bit words, which are
+// shifted by their bit offsets and masked.
+template <uint8_t width, typename T>
+int32_t decode25To32(
+    const uint64_t* bits,
+    int32_t bitOffset,
+    const int* rows,
+    int32_t numRows,
+    T* result) {
+  static_assert(sizeof(T) == 4 || sizeof(T) == 8);
+  constexpr __m256si kWidthSplat = {
+      width, width, width, width, width, width, width, width};
+  const auto mask = _mm256_set1_epi64x(bits::lowMask(width));
+  // Moves the low 32 bits of 4 64 bit lanes to the low 128 bits.
+  const auto narrow = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+  int32_t i = 0;
+  for (; i + 8 <= numRows; i += 8) {
+    auto indices =
+        *reinterpret_cast<const __m256si_u*>(rows + i) * kWidthSplat +
+        bitOffset;
+    auto byteIndices = as256i(indices >> 3);
+    auto shifts = as256i(indices & 7);
+    __m256i fourInts[2];
+    fourInts[0] = _mm256_i32gather_epi64(
+        reinterpret_cast<const long long*>(bits),
+        _mm256_extracti128_si256(byteIndices, 0),
+        1);
+    fourInts[1] = _mm256_i32gather_epi64(
+        reinterpret_cast<const long long*>(bits),
+        _mm256_extracti128_si256(byteIndices, 1),
+        1);
+    fourInts[0] = _mm256_and_si256(
+        _mm256_srlv_epi64(fourInts[0], as4x64<0>(shifts)), mask);
+    fourInts[1] = _mm256_and_si256(
+        _mm256_srlv_epi64(fourInts[1], as4x64<1>(shifts)), mask);
+    if (sizeof(T) == 8) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + i), fourInts[0]);
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(result + i + 4), fourInts[1]);
+    } else {
+      auto eightInts = _mm256_set_m128i(
+          _mm256_castsi256_si128(
+              _mm256_permutevar8x32_epi32(fourInts[1], narrow)),
+          _mm256_castsi256_si128(
+              _mm256_permutevar8x32_epi32(fourInts[0], narrow)));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + i), eightInts);
+    }
+  }
+  return i;
+}
+
 #define WIDTH_CASE(width)                                                      \
   case width:                                                                  \
     i = decode1To24<width>(bits, bitOffset, rows.data(), numSafeRows, result); \
     break;
 
+#define WIDE_WIDTH_CASE(width)                                \
+  case width:                                                 \
+    if constexpr (sizeof(T) == 4 || sizeof(T) == 8) {         \
+      i = decode25To32<width>(                                \
+          bits, bitOffset, rows.data(), numSafeRows, result); \
+    }                                                         \
+    break;
+
 } // namespace
 
 #endif
@@ -263,6 +323,14 @@ void unpack(
     WIDTH_CASE(22);
     WIDTH_CASE(23);
     WIDTH_CASE(24);
+    WIDE_WIDTH_CASE(25);
+    WIDE_WIDTH_CASE(26);
+    WIDE_WIDTH_CASE(27);
+    WIDE_WIDTH_CASE(28);
+    WIDE_WIDTH_CASE(29);
+    WIDE_WIDTH_CASE(30);
+    WIDE_WIDTH_CASE(31);
+    WIDE_WIDTH_CASE(32);
     default:
       break;
   }
@@ -24,8 +24,26 @@
 // Use WS VRead API to load
 DECLARE_bool(wsVRLoad);
 
+namespace facebook::velox::cache {
+class AsyncDataCache;
+}
+
 namespace facebook::velox::dwio::common {
 
+/// Where to cache the decompressed chunks of a compressed stream. A chunk is
+/// keyed by 'fileNum' and the file offset of its header, i.e. 'streamOffset'
+/// plus the offset of the header in the stream. 'fileNum' is not the file
+/// number of the raw data, so that the decompressed chunks do not collide
+/// with the raw data in 'cache'. Chunks of encrypted streams are cached, after
+/// decryption, only if 'includeEncrypted' is true.
+struct DecompressedChunkCache {
+  cache::AsyncDataCache* cache{nullptr};
+  uint64_t fileNum{0};
+  uint64_t streamOffset{0};
+  IoStatistics* ioStats{nullptr};
+  bool includeEncrypted{false};
+};
+
 class BufferedInput {
  public:
   constexpr static uint64_t kMaxMergeDistance = 1024 * 1024 * 1.25;
@@ -149,8 +167,22 @@ class BufferedInput {
     return nullptr;
   }
 
+  /// Returns where to cache the decompressed chunks of the compressed stream
+  /// at 'offset' or std::nullopt if decompressed chunks are not cached.
+  virtual std::optional<DecompressedChunkCache> decompressedChunkCache(
+      uint64_t /*offset*/) const {
+    return std::nullopt;
+  }
+
   virtual uint64_t nextFetchSize() const;
 
+  /// Sets a predicate selecting the streams that are read only for rows that
+  /// pass the filters of the scan. Implementations may load these on first
+  /// access instead of prefetching them with the other streams. Applies to the
+  /// streams enqueued after the call.
+  virtual void setDeferredStreams(
+      std::function<bool(const StreamIdentifier&)> /*isDeferred*/) {}
+
  protected:
   static int adjustedReadPct(const cache::TrackingData& trackingData) {
     // When this method is called, there is one more reference that is already
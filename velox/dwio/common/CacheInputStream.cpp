@@ -16,6 +16,9 @@
 
 #include <folly/executors/QueuedImmediateExecutor.h>
 
+#include "velox/common/base/Counters.h"
+#include "velox/common/base/RuntimeMetrics.h"
+#include "velox/common/base/StatsReporter.h"
 #include "velox/common/process/TraceContext.h"
 #include "velox/common/time/Timer.h"
 #include "velox/dwio/common/CacheInputStream.h"
@@ -24,6 +27,20 @@
 using ::facebook::velox::common::Region;
 
 namespace facebook::velox::dwio::common {
+namespace {
+
+void recordCacheLoadWait(uint64_t waitUs) {
+  RECORD_HISTOGRAM_METRIC_VALUE(kMetricCacheLoadWaitTimeMs, waitUs / 1'000);
+  addThreadLocalLatency(
+      io::IoStatistics::kCacheLoadWaitLatency, waitUs * 1'000);
+}
+
+void recordStorageRead(uint64_t readUs) {
+  RECORD_HISTOGRAM_METRIC_VALUE(kMetricStorageReadLatencyMs, readUs / 1'000);
+  addThreadLocalLatency(io::IoStatistics::kStorageReadLatency, readUs * 1'000);
+}
+
+} // namespace
 
 using velox::cache::ScanTracker;
 using velox::cache::TrackingId;
@@ -226,6 +243,7 @@ void CacheInputStream::loadSync(const Region& region) {
             .wait();
       }
       ioStats_->queryThreadIoLatency().increment(waitUs);
+      recordCacheLoadWait(waitUs);
       continue;
     }
 
@@ -254,6 +272,7 @@ void CacheInputStream::loadSync(const Region& region) {
     ioStats_->read().increment(region.length);
     ioStats_->queryThreadIoLatency().increment(storageReadUs);
     ioStats_->incTotalScanTime(storageReadUs * 1'000);
+    recordStorageRead(storageReadUs);
     entry->setExclusiveToShared(!noCacheRetention_);
   } while (pin_.empty());
 }
@@ -352,6 +371,7 @@ void CacheInputStream::loadPosition() {
         }
       }
       ioStats_->queryThreadIoLatency().increment(loadUs);
+      recordCacheLoadWait(loadUs);
     }
 
     const auto nextLoadRegion = nextQuantizedLoadRegion(position_);
@@ -15,6 +15,7 @@
  */
 
 #include "velox/dwio/common/CachedBufferedInput.h"
+#include "velox/common/caching/FileIds.h"
 #include "velox/common/memory/Allocation.h"
 #include "velox/common/process/TraceContext.h"
 #include "velox/dwio/common/CacheInputStream.h"
@@ -49,6 +50,8 @@ std::unique_ptr<SeekableInputStream> CachedBufferedInput::enqueue(
   VELOX_CHECK_LE(region.offset + region.length, fileSize_);
   requests_.emplace_back(
       RawFileCacheKey{fileNum_.id(), region.offset}, region.length, id);
+  requests_.back().deferred =
+      sid != nullptr && isDeferred_ != nullptr && isDeferred_(*sid);
   if (tracker_ != nullptr) {
     tracker_->recordReference(id, region.length, fileNum_.id(), groupId_.id());
   }
@@ -174,12 +177,14 @@ void CachedBufferedInput::load(const LogType /*unused*/) {
   std::vector<std::unique_ptr<CacheRequest>> extraRequests;
   std::vector<CacheRequest*> storageLoad[2];
   std::vector<CacheRequest*> ssdLoad[2];
+  std::vector<CacheRequest*> deferredStorageLoad;
+  std::vector<CacheRequest*> deferredSsdLoad;
   for (auto& request : requests) {
     cache::TrackingData trackingData;
     const bool prefetchAnyway = request.trackingId.empty() ||
         request.trackingId.id() == StreamIdentifier::sequentialFile().id_;
     if (!prefetchAnyway && (tracker_ != nullptr)) {
-      trackingData = tracker_->trackingData(request.trackingId);
+      trackingData = tracker_->trackingData(request.trackingId, groupId_.id());
     }
     const int loadIndex =
         (prefetchAnyway || isPrefetchPct(adjustedReadPct(trackingData))) ? 1
@@ -190,6 +195,7 @@ void CachedBufferedInput::load(const LogType /*unused*/) {
       if (cache_->exists(part->key)) {
         continue;
       }
+      part->deferred = request.deferred;
       if (ssdFile != nullptr) {
         part->ssdPin = ssdFile->find(part->key);
         if (!part->ssdPin.empty() && part->ssdPin.run().size() < part->size) {
@@ -198,11 +204,19 @@ void CachedBufferedInput::load(const LogType /*unused*/) {
           part->ssdPin.clear();
         }
         if (!part->ssdPin.empty()) {
-          ssdLoad[loadIndex].push_back(part);
+          if (part->deferred) {
+            deferredSsdLoad.push_back(part);
+          } else {
+            ssdLoad[loadIndex].push_back(part);
+          }
           continue;
         }
       }
-      storageLoad[loadIndex].push_back(part);
+      if (part->deferred) {
+        deferredStorageLoad.push_back(part);
+      } else {
+        storageLoad[loadIndex].push_back(part);
+      }
     }
   }
 
@@ -212,6 +226,23 @@ void CachedBufferedInput::load(const LogType /*unused*/) {
   std::sort(ssdLoad[1].begin(), ssdLoad[1].end(), lessThan<true>);
   makeLoads<false>(storageLoad);
   makeLoads<true>(ssdLoad);
+  std::sort(
+      deferredStorageLoad.begin(), deferredStorageLoad.end(), lessThan<false>);
+  std::sort(deferredSsdLoad.begin(), deferredSsdLoad.end(), lessThan<true>);
+  makeDeferredLoads<false>(deferredStorageLoad);
+  makeDeferredLoads<true>(deferredSsdLoad);
+}
+
+template <bool kSsd>
+void CachedBufferedInput::makeDeferredLoads(
+    const std::vector<CacheRequest*>& requests) {
+  const auto numLoads = allCoalescedLoads_.size();
+  readRegions(requests, false, groupRequests<kSsd>(requests, false));
+  std::move(
+      allCoalescedLoads_.begin() + numLoads,
+      allCoalescedLoads_.end(),
+      std::back_inserter(deferredLoads_));
+  allCoalescedLoads_.resize(numLoads);
 }
 
 template <bool kSsd>
@@ -574,4 +605,16 @@ bool CachedBufferedInput::prefetch(Region region) {
   return true;
 }
 
+// static
+StringIdLease CachedBufferedInput::makeDecompressedFileNum(
+    const StringIdLease& fileNum,
+    const io::ReaderOptions& options) {
+  if (!options.cacheDecompressedStreams() || options.noCacheRetention()) {
+    return {};
+  }
+  return StringIdLease(
+      fileIds(),
+      fmt::format("{}#decompressed", fileIds().string(fileNum.id())));
+}
+
 } // namespace facebook::velox::dwio::common
@@ -49,6 +49,11 @@ struct CacheRequest {
   /// accessed large columns where hitting one piece should not load the
   /// adjacent pieces.
   bool coalesces{true};
+
+  /// True if the stream is read only for rows that pass the filters of the
+  /// scan. Such requests are coalesced among themselves and loaded on first
+  /// access.
+  bool deferred{false};
   const SeekableInputStream* stream;
 };
 
@@ -79,7 +84,8 @@ class CachedBufferedInput : public BufferedInput {
         fsStats_(std::move(fsStats)),
         executor_(executor),
         fileSize_(input_->getLength()),
-        options_(readerOptions) {
+        options_(readerOptions),
+        decompressedFileNum_(makeDecompressedFileNum(fileNum_, options_)) {
     checkLoadQuantum();
   }
 
@@ -102,7 +108,8 @@ class CachedBufferedInput : public BufferedInput {
         fsStats_(std::move(fsStats)),
         executor_(executor),
         fileSize_(input_->getLength()),
-        options_(readerOptions) {
+        options_(readerOptions),
+        decompressedFileNum_(makeDecompressedFileNum(fileNum_, options_)) {
     checkLoadQuantum();
   }
 
@@ -110,6 +117,9 @@ class CachedBufferedInput : public BufferedInput {
     for (auto& load : allCoalescedLoads_) {
       load->cancel();
     }
+    for (auto& load : deferredLoads_) {
+      load->cancel();
+    }
   }
 
   std::unique_ptr<SeekableInputStream> enqueue(
@@ -137,6 +147,11 @@ class CachedBufferedInput : public BufferedInput {
     return true;
   }
 
+  void setDeferredStreams(
+      std::function<bool(const StreamIdentifier&)> isDeferred) override {
+    isDeferred_ = std::move(isDeferred);
+  }
+
   void setNumStripes(int32_t numStripes) override {
     auto stats = tracker_->fileGroupStats();
     if (stats) {
@@ -175,6 +190,19 @@ class CachedBufferedInput : public BufferedInput {
     VELOX_NYI();
   }
 
+  std::optional<DecompressedChunkCache> decompressedChunkCache(
+      uint64_t offset) const override {
+    if (!decompressedFileNum_.hasValue()) {
+      return std::nullopt;
+    }
+    return DecompressedChunkCache{
+        cache_,
+        decompressedFileNum_.id(),
+        offset,
+        ioStats_.get(),
+        options_.cacheDecryptedStreams()};
+  }
+
  private:
   template <bool kSsd>
   std::vector<int32_t> groupRequests(
@@ -198,6 +226,18 @@ class CachedBufferedInput : public BufferedInput {
   template <bool kSsd>
   void makeLoads(std::vector<CacheRequest*> requests[2]);
 
+  // Makes the CoalescedLoads for the deferred 'requests'. These are triggered
+  // by the first access and never scheduled for read-ahead.
+  template <bool kSsd>
+  void makeDeferredLoads(const std::vector<CacheRequest*>& requests);
+
+  // Returns the file number under which the decompressed chunks of the
+  // compressed streams of 'fileNum' are cached or an empty lease if
+  // 'options' does not enable caching decompressed streams.
+  static StringIdLease makeDecompressedFileNum(
+      const StringIdLease& fileNum,
+      const io::ReaderOptions& options);
+
   // We only support up to 8MB load quantum size on SSD and there is no need for
   // larger SSD read size performance wise.
   void checkLoadQuantum() {
@@ -218,6 +258,7 @@ class CachedBufferedInput : public BufferedInput {
   folly::Executor* const executor_;
   const uint64_t fileSize_;
   const io::ReaderOptions options_;
+  const StringIdLease decompressedFileNum_;
 
   // Regions that are candidates for loading.
   std::vector<CacheRequest> requests_;
@@ -230,6 +271,14 @@ class CachedBufferedInput : public BufferedInput {
 
   // Distinct coalesced loads in 'coalescedLoads_'.
   std::vector<std::shared_ptr<cache::CoalescedLoad>> allCoalescedLoads_;
+
+  // Selects the streams whose loads are deferred to first access. See
+  // setDeferredStreams().
+  std::function<bool(const StreamIdentifier&)> isDeferred_;
+
+  // Coalesced loads of deferred requests. Kept apart from
+  // 'allCoalescedLoads_' so that read-ahead does not schedule them.
+  std::vector<std::shared_ptr<cache::CoalescedLoad>> deferredLoads_;
 };
 
 } // namespace facebook::velox::dwio::common
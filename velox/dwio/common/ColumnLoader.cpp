@@ -106,6 +106,8 @@ void ColumnLoader::loadInternal(
       read(structReader_, fieldReader_, version_, rows, selectedRows, hook);
   if (!hook) {
     fieldReader_->getValues(effectiveRows, result);
+    fieldReader_->scanSpec()->recordValueSize(
+        (*result)->estimateFlatSize(), effectiveRows.size());
     if (((rows.back() + 1) < resultSize) ||
         rows.size() != structReader_->outputRows().size()) {
       // We read sparsely. The values that were read should appear
@@ -98,7 +98,7 @@ void DirectBufferedInput::load(const LogType /*unused*/) {
     const bool prefetchAnyway = request.trackingId.empty() ||
         request.trackingId.id() == StreamIdentifier::sequentialFile().id_;
     if (!prefetchAnyway && tracker_) {
-      trackingData = tracker_->trackingData(request.trackingId);
+      trackingData = tracker_->trackingData(request.trackingId, groupId_.id());
     }
     const int loadIndex =
         (prefetchAnyway || isPrefetchablePct(adjustedReadPct(trackingData)))
@@ -16,6 +16,9 @@
 
 #include <folly/executors/QueuedImmediateExecutor.h>
 
+#include "velox/common/base/Counters.h"
+#include "velox/common/base/RuntimeMetrics.h"
+#include "velox/common/base/StatsReporter.h"
 #include "velox/common/process/TraceContext.h"
 #include "velox/common/time/Timer.h"
 #include "velox/dwio/common/DirectBufferedInput.h"
@@ -174,6 +177,10 @@ void DirectInputStream::loadPosition() {
         loadedRegion_.length = load->getData(region_.offset, data_, tinyData_);
       }
       ioStats_->queryThreadIoLatency().increment(loadUs);
+      RECORD_HISTOGRAM_METRIC_VALUE(
+          kMetricStorageReadLatencyMs, loadUs / 1'000);
+      addThreadLocalLatency(
+          io::IoStatistics::kStorageReadLatency, loadUs * 1'000);
     } else {
       // Standalone stream, not part of coalesced load.
       loadedRegion_.offset = 0;
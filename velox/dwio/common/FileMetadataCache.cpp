@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/common/FileMetadataCache.h"
+
+#include "velox/common/base/BitUtil.h"
+#include "velox/common/base/Exceptions.h"
+
+namespace facebook::velox::dwio::common {
+
+// static
+void FileMetadataCache::init(uint64_t maxBytes) {
+  std::unique_lock guard{instanceLock()};
+  auto& instance = instanceRef();
+  VELOX_CHECK_NULL(instance, "FileMetadataCache has already been set");
+  VELOX_CHECK_GT(maxBytes, 0);
+  instance =
+      std::unique_ptr<FileMetadataCache>(new FileMetadataCache(maxBytes));
+}
+
+// static
+FileMetadataCache* FileMetadataCache::instance() {
+  std::shared_lock guard{instanceLock()};
+  return instanceRef().get();
+}
+
+size_t FileMetadataCache::KeyHasher::operator()(const Key& key) const {
+  return bits::hashMix(
+      std::hash<std::string>()(key.path),
+      std::hash<std::string>()(key.version));
+}
+
+std::shared_ptr<const void> FileMetadataCache::getInternal(const Key& key) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    ++numMisses_;
+    return nullptr;
+  }
+  ++numHits_;
+  lru_.splice(lru_.end(), lru_, it->second);
+  return it->second->metadata;
+}
+
+void FileMetadataCache::put(
+    const Key& key,
+    std::shared_ptr<const void> metadata,
+    uint64_t bytes) {
+  VELOX_CHECK_NOT_NULL(metadata);
+  if (bytes > maxBytes_) {
+    return;
+  }
+  std::lock_guard<std::mutex> l(mutex_);
+  if (entries_.find(key) != entries_.end()) {
+    // Another reader of the same file added it first.
+    return;
+  }
+  while (bytes_ + bytes > maxBytes_) {
+    auto& evicted = lru_.front();
+    bytes_ -= evicted.bytes;
+    entries_.erase(evicted.key);
+    lru_.pop_front();
+    ++numEvictions_;
+  }
+  lru_.push_back({key, std::move(metadata), bytes});
+  entries_.emplace(key, std::prev(lru_.end()));
+  bytes_ += bytes;
+}
+
+FileMetadataCache::Stats FileMetadataCache::stats() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  return {entries_.size(), bytes_, numHits_, numMisses_, numEvictions_};
+}
+
+} // namespace facebook::velox::dwio::common
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <folly/SharedMutex.h>
+#include <folly/container/F14Map.h>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace facebook::velox::dwio::common {
+
+/// A process-wide cache of the parsed metadata of files, e.g. the thrift
+/// FileMetaData of a Parquet file or the decoded positions of an Iceberg
+/// positional delete file. The readers of the splits and queries that
+/// open the same file share the entry instead of reading and parsing the
+/// footer again. The entries are evicted in LRU order to stay within the
+/// configured memory.
+class FileMetadataCache {
+ public:
+  /// Identifies a version of a file. 'version' must change when the file is
+  /// rewritten, e.g. it is the modification time or ETag of the file, so that
+  /// a new version of a file does not get stale metadata.
+  struct Key {
+    std::string path;
+    std::string version;
+
+    bool operator==(const Key& other) const {
+      return path == other.path && version == other.version;
+    }
+  };
+
+  struct Stats {
+    uint64_t numEntries{0};
+    uint64_t bytes{0};
+    uint64_t numHits{0};
+    uint64_t numMisses{0};
+    uint64_t numEvictions{0};
+  };
+
+  /// Creates the process-wide cache with a limit of 'maxBytes' of metadata.
+  static void init(uint64_t maxBytes);
+
+  /// Returns the process-wide cache or nullptr if it has not been created.
+  static FileMetadataCache* instance();
+
+  static void testingReset() {
+    instanceRef().reset();
+  }
+
+  /// Returns the metadata of 'key' or nullptr if it is not cached. The
+  /// metadata of a file is produced by the reader of its format, which reads
+  /// it back as the same type 'T'.
+  template <typename T>
+  std::shared_ptr<const T> get(const Key& key) {
+    return std::static_pointer_cast<const T>(getInternal(key));
+  }
+
+  /// Adds 'metadata' of 'key' that uses 'bytes' of memory. Evicts the least
+  /// recently used entries to make space. Metadata larger than the cache is
+  /// not added.
+  void
+  put(const Key& key, std::shared_ptr<const void> metadata, uint64_t bytes);
+
+  Stats stats() const;
+
+  uint64_t maxBytes() const {
+    return maxBytes_;
+  }
+
+ private:
+  struct KeyHasher {
+    size_t operator()(const Key& key) const;
+  };
+
+  struct Entry {
+    Key key;
+    std::shared_ptr<const void> metadata;
+    uint64_t bytes;
+  };
+
+  static folly::SharedMutex& instanceLock() {
+    static folly::SharedMutex mu;
+    return mu;
+  }
+
+  static std::unique_ptr<FileMetadataCache>& instanceRef() {
+    static std::unique_ptr<FileMetadataCache> instance;
+    return instance;
+  }
+
+  explicit FileMetadataCache(uint64_t maxBytes) : maxBytes_(maxBytes) {}
+
+  std::shared_ptr<const void> getInternal(const Key& key);
+
+  const uint64_t maxBytes_;
+
+  mutable std::mutex mutex_;
+  // The entries from the least to the most recently used.
+  std::list<Entry> lru_;
+  folly::F14FastMap<Key, std::list<Entry>::iterator, KeyHasher> entries_;
+  uint64_t bytes_{0};
+  uint64_t numHits_{0};
+  uint64_t numMisses_{0};
+  uint64_t numEvictions_{0};
+};
+
+} // namespace facebook::velox::dwio::common
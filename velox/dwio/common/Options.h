@@ -28,6 +28,7 @@
 #include "velox/common/memory/Memory.h"
 #include "velox/dwio/common/ColumnSelector.h"
 #include "velox/dwio/common/ErrorTolerance.h"
+#include "velox/dwio/common/FileMetadataCache.h"
 #include "velox/dwio/common/FlatMapHelper.h"
 #include "velox/dwio/common/FlushPolicy.h"
 #include "velox/dwio/common/InputStream.h"
@@ -428,6 +429,17 @@ class RowReaderOptions {
     serdeParameters_ = std::move(serdeParameters);
   }
 
+  /// Requests that the streams of columns without filters are loaded on first
+  /// access instead of together with the streams of the filter columns. Their
+  /// IO is then skipped for stripes where no row passes the filters.
+  void setDeferNonFilterStreams(bool defer) {
+    deferNonFilterStreams_ = defer;
+  }
+
+  bool deferNonFilterStreams() const {
+    return deferNonFilterStreams_;
+  }
+
  private:
   uint64_t dataStart_;
   uint64_t dataLength_;
@@ -478,6 +490,7 @@ class RowReaderOptions {
       decodingTimeCallback_;
   std::function<void(uint16_t)> stripeCountCallback_;
   bool eagerFirstStripeLoad_{true};
+  bool deferNonFilterStreams_{false};
   uint64_t skipRows_{0};
 
   std::shared_ptr<UnitLoaderFactory> unitLoaderFactory_;
@@ -665,6 +678,17 @@ class ReaderOptions : public io::ReaderOptions {
     allowEmptyFile_ = value;
   }
 
+  /// The key of the file in the process-wide FileMetadataCache. If set and the
+  /// cache exists, the reader looks up the parsed metadata of the file in the
+  /// cache before reading the footer and adds it after parsing the footer.
+  const std::optional<FileMetadataCache::Key>& fileMetadataCacheKey() const {
+    return fileMetadataCacheKey_;
+  }
+
+  void setFileMetadataCacheKey(std::optional<FileMetadataCache::Key> key) {
+    fileMetadataCacheKey_ = std::move(key);
+  }
+
  private:
   uint64_t tailLocation_;
   FileFormat fileFormat_;
@@ -682,6 +706,7 @@ class ReaderOptions : public io::ReaderOptions {
   bool adjustTimestampToTimezone_{false};
   bool selectiveNimbleReaderEnabled_{false};
   bool allowEmptyFile_{false};
+  std::optional<FileMetadataCache::Key> fileMetadataCacheKey_;
 };
 
 struct WriterOptions {
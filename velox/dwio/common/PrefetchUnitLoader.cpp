@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/common/PrefetchUnitLoader.h"
+
+#include <atomic>
+#include <numeric>
+
+#include "velox/common/base/AsyncSource.h"
+#include "velox/dwio/common/MeasureTime.h"
+#include "velox/dwio/common/UnitLoaderTools.h"
+
+using facebook::velox::dwio::common::measureTimeIfCallback;
+
+namespace facebook::velox::dwio::common {
+
+namespace {
+
+// The result of a unit's prefetch. Returns its bytes to the loader's budget
+// when the unit is loaded or the prefetch is dropped.
+class PrefetchedBytes {
+ public:
+  PrefetchedBytes(std::shared_ptr<std::atomic<uint64_t>> total, uint64_t bytes)
+      : total_{std::move(total)}, bytes_{bytes} {
+    *total_ += bytes_;
+  }
+
+  ~PrefetchedBytes() {
+    *total_ -= bytes_;
+  }
+
+ private:
+  const std::shared_ptr<std::atomic<uint64_t>> total_;
+  const uint64_t bytes_;
+};
+
+class PrefetchUnitLoader : public UnitLoader {
+ public:
+  PrefetchUnitLoader(
+      std::vector<std::unique_ptr<LoadUnit>> loadUnits,
+      uint32_t firstUnit,
+      folly::Executor* executor,
+      uint32_t maxPrefetchUnits,
+      uint64_t maxPrefetchBytes,
+      std::function<void(std::chrono::high_resolution_clock::duration)>
+          blockedOnIoCallback)
+      : loadUnits_{std::move(loadUnits)},
+        executor_{executor},
+        maxPrefetchUnits_{maxPrefetchUnits},
+        maxPrefetchBytes_{maxPrefetchBytes},
+        blockedOnIoCallback_{std::move(blockedOnIoCallback)},
+        prefetches_(loadUnits_.size()),
+        prefetchedBytes_{std::make_shared<std::atomic<uint64_t>>(0)} {
+    if (firstUnit < loadUnits_.size()) {
+      schedulePrefetch(firstUnit);
+    }
+  }
+
+  ~PrefetchUnitLoader() override {
+    // Waits for the prefetches in progress, which reference 'loadUnits_'.
+    for (auto& prefetch : prefetches_) {
+      if (prefetch != nullptr) {
+        prefetch->close();
+      }
+    }
+  }
+
+  LoadUnit& getLoadedUnit(uint32_t unit) override {
+    VELOX_CHECK_LT(unit, loadUnits_.size(), "Unit out of range");
+
+    if (loadedUnit_.has_value()) {
+      if (loadedUnit_.value() == unit) {
+        return *loadUnits_[unit];
+      }
+
+      loadUnits_[*loadedUnit_]->unload();
+      loadedUnit_.reset();
+    }
+
+    {
+      auto measure = measureTimeIfCallback(blockedOnIoCallback_);
+      if (auto prefetch = std::move(prefetches_[unit])) {
+        // Waits if the prefetch is in progress and makes it here if it has
+        // not started.
+        prefetch->move();
+      }
+      loadUnits_[unit]->load();
+    }
+    loadedUnit_ = unit;
+
+    const auto end = std::min<uint64_t>(
+        loadUnits_.size(), static_cast<uint64_t>(unit) + 1 + maxPrefetchUnits_);
+    for (auto next = unit + 1; next < end; ++next) {
+      if (*prefetchedBytes_ >= maxPrefetchBytes_) {
+        break;
+      }
+      schedulePrefetch(next);
+    }
+
+    return *loadUnits_[unit];
+  }
+
+  void onRead(uint32_t unit, uint64_t rowOffsetInUnit, uint64_t /* rowCount */)
+      override {
+    VELOX_CHECK_LT(unit, loadUnits_.size(), "Unit out of range");
+    VELOX_CHECK_LT(
+        rowOffsetInUnit, loadUnits_[unit]->getNumRows(), "Row out of range");
+  }
+
+  void onSeek(uint32_t unit, uint64_t rowOffsetInUnit) override {
+    VELOX_CHECK_LT(unit, loadUnits_.size(), "Unit out of range");
+    VELOX_CHECK_LE(
+        rowOffsetInUnit, loadUnits_[unit]->getNumRows(), "Row out of range");
+  }
+
+ private:
+  void schedulePrefetch(uint32_t unit) {
+    if (prefetches_[unit] != nullptr || loadedUnit_ == unit) {
+      return;
+    }
+    auto* loadUnit = loadUnits_[unit].get();
+    prefetches_[unit] = std::make_shared<AsyncSource<PrefetchedBytes>>(
+        [loadUnit, total = prefetchedBytes_]() {
+          return std::make_unique<PrefetchedBytes>(total, loadUnit->prefetch());
+        });
+    executor_->add([prefetch = prefetches_[unit]]() { prefetch->prepare(); });
+  }
+
+  const std::vector<std::unique_ptr<LoadUnit>> loadUnits_;
+  folly::Executor* const executor_;
+  const uint32_t maxPrefetchUnits_;
+  const uint64_t maxPrefetchBytes_;
+  const std::function<void(std::chrono::high_resolution_clock::duration)>
+      blockedOnIoCallback_;
+  // The prefetch of each unit that is scheduled and not yet loaded.
+  std::vector<std::shared_ptr<AsyncSource<PrefetchedBytes>>> prefetches_;
+  // Bytes fetched by completed prefetches whose units are not loaded yet.
+  const std::shared_ptr<std::atomic<uint64_t>> prefetchedBytes_;
+  std::optional<uint32_t> loadedUnit_;
+};
+
+} // namespace
+
+std::unique_ptr<UnitLoader> PrefetchUnitLoaderFactory::create(
+    std::vector<std::unique_ptr<LoadUnit>> loadUnits,
+    uint64_t rowsToSkip) {
+  std::vector<uint64_t> rowsPerUnit;
+  rowsPerUnit.reserve(loadUnits.size());
+  for (const auto& unit : loadUnits) {
+    rowsPerUnit.push_back(unit->getNumRows());
+  }
+  const auto totalRows =
+      std::accumulate(rowsPerUnit.cbegin(), rowsPerUnit.cend(), 0UL);
+  VELOX_CHECK_LE(
+      rowsToSkip,
+      totalRows,
+      "Can only skip up to the past-the-end row of the file.");
+  const auto skip = unit_loader_tools::howMuchToSkip(
+      rowsToSkip, rowsPerUnit.cbegin(), rowsPerUnit.cend());
+  return std::make_unique<PrefetchUnitLoader>(
+      std::move(loadUnits),
+      skip.first,
+      executor_,
+      maxPrefetchUnits_,
+      maxPrefetchBytes_,
+      blockedOnIoCallback_);
+}
+
+} // namespace facebook::velox::dwio::common
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+
+#include <folly/Executor.h>
+
+#include "velox/common/base/Exceptions.h"
+#include "velox/dwio/common/UnitLoader.h"
+
+namespace facebook::velox::dwio::common {
+
+/// Creates unit loaders that overlap the IO of the next units with the
+/// decoding of the current one. Each unit's LoadUnit::prefetch() runs on
+/// 'executor' ahead of its getLoadedUnit(). The first unit to read is
+/// scheduled when the loader is created, so a reader created for a preloaded
+/// split starts fetching its first stripe before the previous split is done.
+/// At most 'maxPrefetchUnits' units past the loaded one are prefetched, and
+/// no new prefetch is started while 'maxPrefetchBytes' of prefetched data is
+/// waiting to be loaded. 'blockedOnIoCallback' receives the time
+/// getLoadedUnit() spent waiting for and loading a unit.
+class PrefetchUnitLoaderFactory
+    : public velox::dwio::common::UnitLoaderFactory {
+ public:
+  PrefetchUnitLoaderFactory(
+      folly::Executor* executor,
+      uint32_t maxPrefetchUnits,
+      uint64_t maxPrefetchBytes,
+      std::function<void(std::chrono::high_resolution_clock::duration)>
+          blockedOnIoCallback)
+      : executor_{executor},
+        maxPrefetchUnits_{maxPrefetchUnits},
+        maxPrefetchBytes_{maxPrefetchBytes},
+        blockedOnIoCallback_{std::move(blockedOnIoCallback)} {
+    VELOX_CHECK_NOT_NULL(executor_);
+  }
+
+  ~PrefetchUnitLoaderFactory() override = default;
+
+  std::unique_ptr<velox::dwio::common::UnitLoader> create(
+      std::vector<std::unique_ptr<velox::dwio::common::LoadUnit>> loadUnits,
+      uint64_t rowsToSkip) override;
+
+ private:
+  folly::Executor* const executor_;
+  const uint32_t maxPrefetchUnits_;
+  const uint64_t maxPrefetchBytes_;
+  std::function<void(std::chrono::high_resolution_clock::duration)>
+      blockedOnIoCallback_;
+};
+
+} // namespace facebook::velox::dwio::common
@@ -157,7 +157,7 @@ bool ScanSpec::hasFilter() const {
   if (hasFilter_.has_value()) {
     return hasFilter_.value();
   }
-  if (!isConstant() && filter()) {
+  if (!isConstant() && (filter() || expressionFilter())) {
     hasFilter_ = true;
     return true;
   }
@@ -171,6 +171,21 @@ bool ScanSpec::hasFilter() const {
   return false;
 }
 
+std::optional<uint64_t> ScanSpec::measuredRowSize() const {
+  bool measured = false;
+  double size = 0;
+  for (const auto& child : children_) {
+    if (child->valueBytesPerRow_ >= 0) {
+      measured = true;
+      size += child->valueBytesPerRow_;
+    }
+  }
+  if (!measured) {
+    return std::nullopt;
+  }
+  return static_cast<uint64_t>(size);
+}
+
 bool ScanSpec::hasFilterApplicableToConstant() const {
   if (filter_) {
     return true;
@@ -214,6 +229,9 @@ void ScanSpec::moveAdaptationFrom(ScanSpec& other) {
       child->filter_ = std::move(otherChild->filter_);
       child->selectivity_ = otherChild->selectivity_;
     }
+    if (otherChild->valueBytesPerRow_ >= 0) {
+      child->valueBytesPerRow_ = otherChild->valueBytesPerRow_;
+    }
   }
 }
 
@@ -404,6 +422,57 @@ bool testFilter(
   return true;
 }
 
+bool testFlatMapKeyFilters(
+    const ScanSpec& scanSpec,
+    const dwio::common::MapColumnStatistics& stats,
+    uint64_t totalRows,
+    const TypePtr& mapType) {
+  const auto& entryStats = stats.getEntryStatistics();
+  if (entryStats.empty()) {
+    // The writer did not record per-key statistics.
+    return true;
+  }
+  const auto& keyType = mapType->childAt(0);
+  const auto& valueType = mapType->childAt(1);
+  for (const auto& child : scanSpec.children()) {
+    auto* filter = child->filter();
+    if (filter == nullptr || child->isConstant()) {
+      continue;
+    }
+    std::optional<dwio::common::KeyInfo> key;
+    switch (keyType->kind()) {
+      case TypeKind::TINYINT:
+      case TypeKind::SMALLINT:
+      case TypeKind::INTEGER:
+      case TypeKind::BIGINT:
+        if (auto intKey = folly::tryTo<int64_t>(child->fieldName())) {
+          key.emplace(intKey.value());
+        }
+        break;
+      case TypeKind::VARCHAR:
+      case TypeKind::VARBINARY:
+        key.emplace(child->fieldName());
+        break;
+      default:
+        break;
+    }
+    if (!key.has_value()) {
+      continue;
+    }
+    auto it = entryStats.find(*key);
+    if (it == entryStats.end()) {
+      if (filter->isDeterministic() && !filter->testNull()) {
+        return false;
+      }
+      continue;
+    }
+    if (!testFilter(filter, it->second.get(), totalRows, valueType)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 ScanSpec& ScanSpec::getChildByChannel(column_index_t channel) {
   for (auto& child : children_) {
     if (child->channel_ == channel) {
@@ -32,9 +32,31 @@ namespace facebook {
 namespace velox {
 namespace dwio::common {
 class ColumnStatistics;
+class MapColumnStatistics;
 }
 namespace common {
 
+// A filter over several scalar members of a struct that does not reduce to
+// one common::Filter per column, e.g. 'length(s) > 10' or 'a + b > c'. The
+// struct reader evaluates it after the single-column filters and before it
+// reads the members that have no filter, so that these are decoded only for
+// the passing rows.
+class ExpressionFilter {
+ public:
+  virtual ~ExpressionFilter() = default;
+
+  // Names of the struct members read by the filter. They must be projected
+  // out.
+  virtual const std::vector<std::string>& inputs() const = 0;
+
+  // Evaluates the filter on 'input', whose children are the values of
+  // inputs() in the same order. Sets 'passed' to the ascending positions in
+  // 'input' of the rows that pass.
+  virtual void filter(
+      const RowVectorPtr& input,
+      std::vector<vector_size_t>& passed) = 0;
+};
+
 // Describes the filtering and value extraction for a
 // SelectiveColumnReader. This is owned by the TableScan Operator and
 // is passed to SelectiveColumnReaders at construction.  This is
@@ -70,6 +92,17 @@ class ScanSpec {
     filter_ = std::move(filter);
   }
 
+  // Filter evaluated over several members of this struct after their
+  // single-column filters. See ExpressionFilter.
+  ExpressionFilter* expressionFilter() const {
+    return filterDisabled_ ? nullptr : expressionFilter_.get();
+  }
+
+  void setExpressionFilter(std::shared_ptr<ExpressionFilter> filter) {
+    expressionFilter_ = std::move(filter);
+    hasFilter_.reset();
+  }
+
   void setMaxArrayElementsCount(vector_size_t count) {
     maxArrayElementsCount_ = count;
   }
@@ -219,6 +252,25 @@ class ScanSpec {
     return selectivity_;
   }
 
+  // Records the flat size of the values last produced for this struct
+  // member. Like selectivity(), this carries over between batches and
+  // splits.
+  void recordValueSize(uint64_t bytes, vector_size_t numRows) {
+    if (numRows > 0) {
+      valueBytesPerRow_ = static_cast<double>(bytes) / numRows;
+    }
+  }
+
+  // Flat bytes per row of the values last produced for this struct member,
+  // or a negative value if the member has not produced values yet.
+  double valueBytesPerRow() const {
+    return valueBytesPerRow_;
+  }
+
+  // Sum of valueBytesPerRow() over the children that have produced values.
+  // std::nullopt if none has.
+  std::optional<uint64_t> measuredRowSize() const;
+
   ValueHook* valueHook() const {
     return valueHook_;
   }
@@ -431,6 +483,7 @@ class ScanSpec {
   // returned as flat.
   bool makeFlat_ = false;
   std::shared_ptr<const common::Filter> filter_;
+  std::shared_ptr<ExpressionFilter> expressionFilter_;
   bool filterDisabled_ = false;
   dwio::common::DeltaColumnUpdater* deltaUpdate_ = nullptr;
 
@@ -443,6 +496,7 @@ class ScanSpec {
       metadataFilters_;
 
   SelectivityInfo selectivity_;
+  double valueBytesPerRow_{-1};
 
   std::vector<std::shared_ptr<ScanSpec>> children_;
 
@@ -509,6 +563,16 @@ bool testFilter(
     uint64_t totalRows,
     const TypePtr& type);
 
+// Returns false if a key filter of 'scanSpec', a flat map read as struct,
+// cannot pass any value of the key according to the per-key statistics in
+// 'stats'. A key missing from the statistics is absent from all rows and
+// reads as null. True, otherwise.
+bool testFlatMapKeyFilters(
+    const ScanSpec& scanSpec,
+    const dwio::common::MapColumnStatistics& stats,
+    uint64_t totalRows,
+    const TypePtr& mapType);
+
 } // namespace common
 } // namespace velox
 } // namespace facebook
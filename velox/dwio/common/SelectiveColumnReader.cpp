@@ -437,6 +437,34 @@ void SelectiveColumnReader::addStringValue(folly::StringPiece value) {
       StringView(copy, value.size());
 }
 
+void SelectiveColumnReader::computeStringIsAscii(const VectorPtr& result) {
+  if (!result->type()->isVarchar() || result->size() == 0) {
+    return;
+  }
+  auto* flat = result->asFlatVector<StringView>();
+  if (flat == nullptr) {
+    return;
+  }
+  // Flat map values may reuse the result vector across batches.
+  flat->invalidateIsAscii();
+  flat->computeAndSetIsAscii(SelectivityVector(flat->size()));
+}
+
+void SelectiveColumnReader::propagateDictionaryIsAscii(
+    const VectorPtr& dictionary,
+    const VectorPtr& result) {
+  if (!result->type()->isVarchar() || dictionary->size() == 0 ||
+      result->size() == 0) {
+    return;
+  }
+  auto* values = dictionary->asFlatVector<StringView>();
+  if (values == nullptr ||
+      !values->computeAndSetIsAscii(SelectivityVector(values->size()))) {
+    return;
+  }
+  result->asUnchecked<SimpleVector<StringView>>()->setAllIsAscii(true);
+}
+
 void SelectiveColumnReader::setNulls(BufferPtr resultNulls) {
   resultNulls_ = resultNulls;
   rawResultNulls_ = resultNulls ? resultNulls->asMutable<uint64_t>() : nullptr;
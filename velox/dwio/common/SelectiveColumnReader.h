@@ -583,6 +583,18 @@ class SelectiveColumnReader {
 
   void addStringValue(folly::StringPiece value);
 
+  // Computes ASCII-ness of the strings in a flat VARCHAR 'result' while they
+  // are hot in cache so that string functions downstream do not rescan them.
+  // No-op for other types.
+  static void computeStringIsAscii(const VectorPtr& result);
+
+  // Marks a VARCHAR 'result' produced from 'dictionary' as all ASCII if every
+  // entry of 'dictionary' is ASCII. The dictionary is scanned once and the
+  // outcome is cached on the dictionary vector itself.
+  static void propagateDictionaryIsAscii(
+      const VectorPtr& dictionary,
+      const VectorPtr& result);
+
   // Copies 'value' to buffers owned by 'this' and returns the start of the
   // copy.
   char* copyStringValue(folly::StringPiece value);
@@ -18,6 +18,7 @@
 
 #include "velox/common/process/TraceContext.h"
 #include "velox/dwio/common/ColumnLoader.h"
+#include "velox/dwio/common/ParallelFor.h"
 
 namespace facebook::velox::dwio::common {
 namespace {
@@ -391,6 +392,7 @@ void SelectiveStructColumnReaderBase::read(
     const uint64_t* incomingNulls) {
   numReads_ = scanSpec_->newRead();
   prepareRead<char>(offset, rows, incomingNulls);
+  expressionFilterValues_.clear();
   RowSet activeRows = rows;
   if (hasDeletion_) {
     // We handle the mutation after prepareRead so that output rows and format
@@ -427,10 +429,31 @@ void SelectiveStructColumnReaderBase::read(
 
   const auto& childSpecs = scanSpec_->children();
   VELOX_CHECK(!childSpecs.empty());
+  parallelChildren_.clear();
+  // The children with filters come first. The expression filter runs after
+  // them, before the first child without a filter.
+  const bool hasExpressionFilter = scanSpec_->expressionFilter() != nullptr;
+  bool expressionFilterPending = hasExpressionFilter;
+  if (hasExpressionFilter && expressionFilterSpecs_.empty()) {
+    for (const auto& input : scanSpec_->expressionFilter()->inputs()) {
+      auto* childSpec = scanSpec_->childByName(input);
+      VELOX_CHECK_NOT_NULL(
+          childSpec, "Expression filter input not found: {}", input);
+      expressionFilterSpecs_.push_back(childSpec);
+    }
+  }
   for (size_t i = 0; i < childSpecs.size(); ++i) {
     const auto& childSpec = childSpecs[i];
     VELOX_TRACE_HISTORY_PUSH("read %s", childSpec->fieldName().c_str());
 
+    if (expressionFilterPending && !childSpec->hasFilter()) {
+      expressionFilterPending = false;
+      activeRows = applyExpressionFilter(offset, activeRows, structNulls);
+      if (activeRows.empty()) {
+        break;
+      }
+    }
+
     if (childSpec->deltaUpdate()) {
       // Will make LazyVector.
       continue;
@@ -449,10 +472,16 @@ void SelectiveStructColumnReaderBase::read(
       continue;
     }
 
+    if (hasExpressionFilter && !childSpec->hasFilter() &&
+        isExpressionFilterInput(*childSpec)) {
+      // Read by applyExpressionFilter().
+      continue;
+    }
+
     const auto fieldIndex = childSpec->subscript();
     auto* reader = children_.at(fieldIndex);
     if (reader->isTopLevel() && childSpec->projectOut() &&
-        !childSpec->hasFilter() && generateLazyChildren_) {
+        !childSpec->hasFilter() && generateLazyChildren()) {
       // Will make a LazyVector.
       continue;
     }
@@ -474,11 +503,31 @@ void SelectiveStructColumnReaderBase::read(
       if (activeRows.empty()) {
         break;
       }
+    } else if (decodingExecutor_ != nullptr) {
+      parallelChildren_.push_back(reader);
     } else {
       reader->read(offset, activeRows, structNulls);
     }
   }
 
+  if (expressionFilterPending && !activeRows.empty()) {
+    // All children have filters.
+    activeRows = applyExpressionFilter(offset, activeRows, structNulls);
+  }
+
+  if (!parallelChildren_.empty() && !activeRows.empty()) {
+    // The children without filters are independent of each other and see
+    // the rows that passed all filters.
+    ParallelFor(
+        decodingExecutor_,
+        0,
+        parallelChildren_.size(),
+        decodingParallelismFactor_)
+        .execute([&](size_t i) {
+          parallelChildren_[i]->read(offset, activeRows, structNulls);
+        });
+  }
+
   // If this adds nulls, the field readers will miss a value for each null added
   // here.
   recordParentNullsInChildren(offset, rows);
@@ -490,6 +539,84 @@ void SelectiveStructColumnReaderBase::read(
   readOffset_ = offset + rows.back() + 1;
 }
 
+bool SelectiveStructColumnReaderBase::isExpressionFilterInput(
+    const velox::common::ScanSpec& childSpec) const {
+  return std::find(
+             expressionFilterSpecs_.begin(),
+             expressionFilterSpecs_.end(),
+             &childSpec) != expressionFilterSpecs_.end();
+}
+
+RowSet SelectiveStructColumnReaderBase::applyExpressionFilter(
+    int64_t offset,
+    const RowSet& rows,
+    const uint64_t* structNulls) {
+  auto* expressionFilter = scanSpec_->expressionFilter();
+  const auto& inputs = expressionFilter->inputs();
+  VELOX_CHECK(isRoot_, "Expression filters are supported only on the root");
+  VELOX_CHECK_EQ(expressionFilterSpecs_.size(), inputs.size());
+
+  std::vector<VectorPtr> values(inputs.size());
+  std::vector<TypePtr> types;
+  types.reserve(inputs.size());
+  for (auto i = 0; i < inputs.size(); ++i) {
+    auto* childSpec = expressionFilterSpecs_[i];
+    const auto& type = requestedType_->asRow().childAt(childSpec->channel());
+    types.push_back(type);
+    if (childSpec->isConstant()) {
+      values[i] = BaseVector::wrapInConstant(
+          rows.size(), 0, childSpec->constantValue());
+      continue;
+    }
+    if (isChildConstant(*childSpec)) {
+      values[i] =
+          BaseVector::createNullConstant(type, rows.size(), memoryPool_);
+      continue;
+    }
+    VELOX_CHECK(
+        childSpec->keepValues(),
+        "Expression filter input must be projected out: {}",
+        inputs[i]);
+    auto* reader = children_.at(childSpec->subscript());
+    if (!childSpec->hasFilter()) {
+      advanceFieldReader(reader, offset);
+      reader->read(offset, rows, structNulls);
+    }
+    reader->getValues(rows, &values[i]);
+  }
+
+  auto input = std::make_shared<RowVector>(
+      memoryPool_,
+      ROW(std::vector<std::string>(inputs), std::move(types)),
+      nullptr,
+      rows.size(),
+      values);
+  expressionFilter->filter(input, expressionFilterPassed_);
+
+  const vector_size_t numPassed = expressionFilterPassed_.size();
+  expressionFilterRows_.resize(numPassed);
+  for (auto i = 0; i < numPassed; ++i) {
+    expressionFilterRows_[i] = rows[expressionFilterPassed_[i]];
+  }
+  if (numPassed > 0 && numPassed < rows.size()) {
+    auto indices = allocateIndices(numPassed, memoryPool_);
+    std::memcpy(
+        indices->asMutable<vector_size_t>(),
+        expressionFilterPassed_.data(),
+        numPassed * sizeof(vector_size_t));
+    for (auto& value : values) {
+      value = BaseVector::wrapInDictionary(nullptr, indices, numPassed, value);
+    }
+  }
+  for (auto i = 0; i < inputs.size(); ++i) {
+    if (isChildConstant(*expressionFilterSpecs_[i])) {
+      values[i] = nullptr;
+    }
+  }
+  expressionFilterValues_ = std::move(values);
+  return RowSet(expressionFilterRows_.data(), numPassed);
+}
+
 void SelectiveStructColumnReaderBase::recordParentNullsInChildren(
     int64_t offset,
     const RowSet& rows) {
@@ -607,13 +734,33 @@ void SelectiveStructColumnReaderBase::getValues(
       continue;
     }
 
+    if (!expressionFilterValues_.empty()) {
+      auto it = std::find(
+          expressionFilterSpecs_.begin(),
+          expressionFilterSpecs_.end(),
+          childSpec.get());
+      if (it != expressionFilterSpecs_.end()) {
+        auto& values =
+            expressionFilterValues_[it - expressionFilterSpecs_.begin()];
+        VELOX_CHECK_NOT_NULL(values);
+        VELOX_CHECK_EQ(values->size(), rows.size());
+        childResult = values;
+        childSpec->recordValueSize(values->estimateFlatSize(), rows.size());
+        continue;
+      }
+    }
+
     if (childSpec->hasFilter() || !children_[index]->isTopLevel() ||
-        !generateLazyChildren_) {
+        !generateLazyChildren()) {
       children_[index]->getValues(rows, &childResult);
+      if (isRoot_) {
+        childSpec->recordValueSize(
+            childResult->estimateFlatSize(), rows.size());
+      }
       continue;
     }
 
-    // LazyVector result.
+    // LazyVector result. ColumnLoader records the value size on load.
     setOutputRowsForLazy(rows);
     setLazyField(
         std::make_unique<ColumnLoader>(this, children_[index], numReads_),
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <folly/Executor.h>
+
 #include "velox/dwio/common/SelectiveColumnReaderInternal.h"
 
 namespace facebook::velox::dwio::common {
@@ -49,6 +51,17 @@ class SelectiveStructColumnReaderBase : public SelectiveColumnReader {
     return numReads_;
   }
 
+  /// Reads the children without filters in parallel on 'executor' after the
+  /// filters are evaluated. The filter children are still read first and
+  /// serially so that each filter only sees the rows passing the previous
+  /// ones. Children that would otherwise be lazy are read eagerly.
+  void setDecodingExecutor(
+      std::shared_ptr<folly::Executor> executor,
+      size_t parallelismFactor) {
+    decodingExecutor_ = std::move(executor);
+    decodingParallelismFactor_ = parallelismFactor;
+  }
+
   int64_t lazyVectorReadOffset() const {
     return lazyVectorReadOffset_;
   }
@@ -166,6 +179,21 @@ class SelectiveStructColumnReaderBase : public SelectiveColumnReader {
  private:
   void fillOutputRowsFromMutation(vector_size_t size);
 
+  bool generateLazyChildren() const {
+    return generateLazyChildren_ && decodingExecutor_ == nullptr;
+  }
+
+  // Reads the inputs of the scan spec's ExpressionFilter for 'rows' and
+  // evaluates the filter. Keeps the input values for getValues() and returns
+  // the passing subset of 'rows'.
+  RowSet applyExpressionFilter(
+      int64_t offset,
+      const RowSet& rows,
+      const uint64_t* structNulls);
+
+  // True if 'childSpec' is an input of the scan spec's ExpressionFilter.
+  bool isExpressionFilterInput(const velox::common::ScanSpec& childSpec) const;
+
   void setOutputRowsForLazy(const RowSet& rows) {
     if (useOutputRows() && rows.size() != outputRows_.size()) {
       setOutputRows(rows);
@@ -186,6 +214,26 @@ class SelectiveStructColumnReaderBase : public SelectiveColumnReader {
   // Whether or not this should produce lazy vectors for children.
   const bool generateLazyChildren_;
 
+  // Executor for reading the children without filters in parallel. See
+  // setDecodingExecutor().
+  std::shared_ptr<folly::Executor> decodingExecutor_;
+  size_t decodingParallelismFactor_{0};
+
+  // Children deferred to the parallel read in read(). Kept to reuse the
+  // memory.
+  std::vector<SelectiveColumnReader*> parallelChildren_;
+
+  // Specs of the ExpressionFilter inputs, in the order of its inputs().
+  std::vector<velox::common::ScanSpec*> expressionFilterSpecs_;
+  // Values of the ExpressionFilter inputs for the rows that passed the last
+  // read(). The filter produced them, so getValues() returns them instead of
+  // reading the inputs again. Null for constant inputs.
+  std::vector<VectorPtr> expressionFilterValues_;
+  // Positions in the filter input of the passing rows.
+  std::vector<vector_size_t> expressionFilterPassed_;
+  // Row numbers of the passing rows.
+  std::vector<vector_size_t> expressionFilterRows_;
+
   // Dense set of rows to read in next().
   raw_vector<vector_size_t> rows_;
 
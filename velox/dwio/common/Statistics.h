@@ -554,10 +554,17 @@ struct RuntimeStatistics {
   // Number of strides (row groups) processed based on statistics.
   int64_t processedStrides{0};
 
+  // Number of rows skipped inside processed strides based on page level
+  // statistics.
+  int64_t skippedPageRows{0};
+
   int64_t footerBufferOverread{0};
 
   int64_t numStripes{0};
 
+  // Time the reader spent waiting for stripes or row groups to load.
+  int64_t unitLoadWaitNanos{0};
+
   ColumnReaderStatistics columnReaderStatistics;
 
   std::unordered_map<std::string, RuntimeCounter> toMap() {
@@ -579,6 +586,9 @@ struct RuntimeStatistics {
     if (processedStrides > 0) {
       result.emplace("processedStrides", RuntimeCounter(processedStrides));
     }
+    if (skippedPageRows > 0) {
+      result.emplace("skippedPageRows", RuntimeCounter(skippedPageRows));
+    }
     if (footerBufferOverread > 0) {
       result.emplace(
           "footerBufferOverread",
@@ -587,6 +597,11 @@ struct RuntimeStatistics {
     if (numStripes > 0) {
       result.emplace("numStripes", RuntimeCounter(numStripes));
     }
+    if (unitLoadWaitNanos > 0) {
+      result.emplace(
+          "unitLoadWaitNanos",
+          RuntimeCounter(unitLoadWaitNanos, RuntimeCounter::Unit::kNanos));
+    }
     if (columnReaderStatistics.flattenStringDictionaryValues > 0) {
       result.emplace(
           "flattenStringDictionaryValues",
@@ -37,6 +37,14 @@ class LoadUnit {
 
   /// Number of bytes that the IO will read
   virtual uint64_t getIoSize() = 0;
+
+  /// Fetches the data of the unit ahead of load() and returns the number of
+  /// bytes fetched. May run on a background thread, so it must only do IO and
+  /// not touch state shared with the unit being read. Never runs concurrently
+  /// with load() of the same unit. The default does nothing.
+  virtual uint64_t prefetch() {
+    return 0;
+  }
 };
 
 class UnitLoader {
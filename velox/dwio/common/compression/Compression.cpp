@@ -18,6 +18,7 @@
 #include "velox/common/compression/LzoDecompressor.h"
 #include "velox/dwio/common/IntCodecCommon.h"
 #include "velox/dwio/common/compression/PagedInputStream.h"
+#include "velox/dwio/common/compression/QatDecompressor.h"
 
 #include <folly/logging/xlog.h>
 #include <lz4.h>
@@ -651,7 +652,12 @@ std::unique_ptr<dwio::common::SeekableInputStream> createDecompressor(
     const std::string& streamDebugInfo,
     const Decrypter* decrypter,
     bool useRawDecompression,
-    size_t compressedLength) {
+    size_t compressedLength,
+    std::optional<DecompressedChunkCache> chunkCache,
+    IoStatistics* ioStats) {
+  // Hardware offload decompresses whole chunks, so it goes through
+  // PagedInputStream instead of the zlib streaming codec.
+  const bool offload = qatDecompressionEnabled(kind);
   std::unique_ptr<Decompressor> decompressor;
   switch (static_cast<int64_t>(kind)) {
     case CompressionKind::CompressionKind_NONE:
@@ -661,7 +667,7 @@ std::unique_ptr<dwio::common::SeekableInputStream> createDecompressor(
       // decompressor remain as nullptr
       break;
     case CompressionKind::CompressionKind_ZLIB:
-      if (!decrypter) {
+      if (!decrypter && !offload) {
         // When file is not encrypted, we can use zlib streaming codec to avoid
         // copying data
         return std::make_unique<ZlibDecompressionStream>(
@@ -678,7 +684,7 @@ std::unique_ptr<dwio::common::SeekableInputStream> createDecompressor(
           blockSize, options.format.zlib.windowBits, streamDebugInfo, false);
       break;
     case CompressionKind::CompressionKind_GZIP:
-      if (!decrypter) {
+      if (!decrypter && !offload) {
         // When file is not encrypted, we can use zlib streaming codec to avoid
         // copying data
         return std::make_unique<ZlibDecompressionStream>(
@@ -717,6 +723,15 @@ std::unique_ptr<dwio::common::SeekableInputStream> createDecompressor(
     default:
       DWIO_RAISE("Unknown compression codec ", kind);
   }
+  if (offload) {
+    decompressor = makeQatDecompressor(
+        kind,
+        options.format.zlib.windowBits,
+        blockSize,
+        streamDebugInfo,
+        std::move(decompressor),
+        ioStats);
+  }
   return std::make_unique<PagedInputStream>(
       std::move(input),
       pool,
@@ -724,7 +739,10 @@ std::unique_ptr<dwio::common::SeekableInputStream> createDecompressor(
       decrypter,
       streamDebugInfo,
       useRawDecompression,
-      compressedLength);
+      compressedLength,
+      decrypter == nullptr || (chunkCache && chunkCache->includeEncrypted)
+          ? std::move(chunkCache)
+          : std::nullopt);
 }
 
 } // namespace facebook::velox::dwio::common::compression
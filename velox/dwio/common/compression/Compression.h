@@ -17,6 +17,7 @@
 #pragma once
 
 #include "velox/common/compression/Compression.h"
+#include "velox/dwio/common/BufferedInput.h"
 #include "velox/dwio/common/SeekableInputStream.h"
 #include "velox/dwio/common/encryption/Encryption.h"
 
@@ -98,6 +99,10 @@ struct CompressionOptions {
  * @param options The compression options to use
  * @param useRawDecompression Specify whether to perform raw decompression
  * @param compressedLength The compressed block length for raw decompression
+ * @param chunkCache Where to cache the decompressed chunks. Ignored for
+ * zlib and gzip, which decompress incrementally unless offloaded to QAT, and
+ * for encrypted streams
+ * @param ioStats Where to count the chunks offloaded to hardware, if anywhere
  */
 std::unique_ptr<dwio::common::SeekableInputStream> createDecompressor(
     facebook::velox::common::CompressionKind kind,
@@ -108,7 +113,9 @@ std::unique_ptr<dwio::common::SeekableInputStream> createDecompressor(
     const std::string& streamDebugInfo,
     const dwio::common::encryption::Decrypter* decryptr = nullptr,
     bool useRawDecompression = false,
-    size_t compressedLength = 0);
+    size_t compressedLength = 0,
+    std::optional<DecompressedChunkCache> chunkCache = std::nullopt,
+    IoStatistics* ioStats = nullptr);
 
 /**
  * Create a compressor for the given compression kind.
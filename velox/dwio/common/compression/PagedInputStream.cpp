@@ -130,6 +130,7 @@ bool PagedInputStream::readOrSkip(const void** data, int32_t* size) {
 
   // release previous decryption buffer
   decryptionBuffer_ = nullptr;
+  chunkPin_.clear();
 
   if (state_ == State::HEADER || remainingLength_ == 0) {
     readHeader();
@@ -162,8 +163,22 @@ bool PagedInputStream::readOrSkip(const void** data, int32_t* size) {
     input = ensureInput(availSize);
   }
 
+  // A cached chunk of an encrypted stream is neither decrypted nor
+  // decompressed again.
+  const char* cached = nullptr;
+  if (decrypter_ && chunkCache_.has_value() && state_ == State::START) {
+    cached = findCachedChunk();
+  }
+  if (cached) {
+    if (data) {
+      *data = cached;
+    }
+    *size = static_cast<int32_t>(outputBufferLength_);
+    outputBufferPtr_ = cached + outputBufferLength_;
+  }
+
   // perform decryption
-  if (decrypter_) {
+  if (decrypter_ && !cached) {
     decryptionBuffer_ =
         decrypter_->decrypt(folly::StringPiece{input, remainingLength_});
     input = reinterpret_cast<const char*>(decryptionBuffer_->data());
@@ -176,7 +191,7 @@ bool PagedInputStream::readOrSkip(const void** data, int32_t* size) {
   }
 
   // perform decompression
-  if (state_ == State::START) {
+  if (state_ == State::START && !cached) {
     DWIO_ENSURE_NOT_NULL(decompressor_.get(), "invalid stream state");
     DWIO_ENSURE_NOT_NULL(input);
     auto [decompressedLength, exact] =
@@ -185,17 +200,12 @@ bool PagedInputStream::readOrSkip(const void** data, int32_t* size) {
       *size = decompressedLength;
       outputBufferPtr_ = nullptr;
     } else {
-      prepareOutputBuffer(decompressedLength);
-      outputBufferLength_ = decompressor_->decompress(
-          input,
-          remainingLength_,
-          outputBuffer_->data(),
-          outputBuffer_->capacity());
+      const char* output = decompressChunk(input, decompressedLength);
       if (data) {
-        *data = outputBuffer_->data();
+        *data = output;
       }
       *size = static_cast<int32_t>(outputBufferLength_);
-      outputBufferPtr_ = outputBuffer_->data() + outputBufferLength_;
+      outputBufferPtr_ = output + outputBufferLength_;
     }
     // release decryption buffer
     decryptionBuffer_ = nullptr;
@@ -212,6 +222,104 @@ bool PagedInputStream::readOrSkip(const void** data, int32_t* size) {
   return true;
 }
 
+const char* PagedInputStream::decompressChunk(
+    const char* input,
+    uint64_t decompressedLength) {
+  if (chunkCache_.has_value() && !decrypter_) {
+    if (const auto* cached = findCachedChunk()) {
+      return cached;
+    }
+  }
+  prepareOutputBuffer(decompressedLength);
+  outputBufferLength_ = decompressor_->decompress(
+      input,
+      remainingLength_,
+      outputBuffer_->data(),
+      outputBuffer_->capacity());
+  if (chunkCache_.has_value()) {
+    cacheChunk();
+  }
+  return outputBuffer_->data();
+}
+
+const char* PagedInputStream::findCachedChunk() {
+  auto* cache = chunkCache_->cache;
+  const auto key = chunkKey();
+  if (!cache->exists(key)) {
+    return nullptr;
+  }
+  auto pin = cache->findOrCreate(key, 1, nullptr);
+  // An exclusive pin is a new entry made after the chunk was evicted. It is
+  // removed when the pin is cleared.
+  if (pin.empty() || pin.entry()->isExclusive()) {
+    return nullptr;
+  }
+  const auto* entry = pin.entry();
+  outputBufferLength_ = entry->size();
+  const char* chunk;
+  if (entry->tinyData() != nullptr) {
+    chunk = entry->tinyData();
+  } else if (entry->data().numRuns() == 1) {
+    chunk = entry->data().runAt(0).data<char>();
+  } else {
+    // The entry is in non-contiguous runs and is copied to be returned as one
+    // range.
+    prepareOutputBuffer(outputBufferLength_);
+    uint64_t offset{0};
+    for (auto i = 0; i < entry->data().numRuns(); ++i) {
+      const auto run = entry->data().runAt(i);
+      const auto bytes =
+          std::min<uint64_t>(run.numBytes(), outputBufferLength_ - offset);
+      std::memcpy(outputBuffer_->data() + offset, run.data<char>(), bytes);
+      offset += bytes;
+    }
+    chunk = outputBuffer_->data();
+  }
+  if (chunkCache_->ioStats != nullptr) {
+    chunkCache_->ioStats->decompressedCacheHit().increment(
+        outputBufferLength_);
+  }
+  chunkPin_ = std::move(pin);
+  return chunk;
+}
+
+void PagedInputStream::cacheChunk() {
+  if (outputBufferLength_ == 0) {
+    return;
+  }
+  cache::CachePin pin;
+  try {
+    pin = chunkCache_->cache->findOrCreate(
+        chunkKey(), outputBufferLength_, nullptr);
+  } catch (const VeloxException& e) {
+    if (e.errorCode() != error_code::kNoCacheSpace.c_str()) {
+      throw;
+    }
+    // The chunk is not cached if the cache is full of pinned data.
+    return;
+  }
+  // The chunk is already cached or is being added by another stream.
+  if (pin.empty() || !pin.entry()->isExclusive()) {
+    return;
+  }
+  auto* entry = pin.checkedEntry();
+  const auto* data = outputBuffer_->data();
+  if (entry->tinyData() != nullptr) {
+    std::memcpy(entry->tinyData(), data, outputBufferLength_);
+  } else {
+    uint64_t offset{0};
+    for (auto i = 0; i < entry->data().numRuns(); ++i) {
+      const auto run = entry->data().runAt(i);
+      const auto bytes =
+          std::min<uint64_t>(run.numBytes(), outputBufferLength_ - offset);
+      std::memcpy(run.data<char>(), data + offset, bytes);
+      offset += bytes;
+    }
+  }
+  // The SSD cache holds raw file data only.
+  entry->setExclusiveToShared(/*ssdSavable=*/false);
+}
+
 void PagedInputStream::BackUp(int32_t count) {
   VELOX_CHECK_GE(count, 0);
   if (pendingSkip_ > 0) {
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "velox/common/caching/AsyncDataCache.h"
+#include "velox/dwio/common/BufferedInput.h"
 #include "velox/dwio/common/SeekableInputStream.h"
 #include "velox/dwio/common/compression/Compression.h"
 
@@ -30,16 +32,22 @@ class PagedInputStream : public dwio::common::SeekableInputStream {
       const dwio::common::encryption::Decrypter* decrypter,
       const std::string& streamDebugInfo,
       bool useRawDecompression = false,
-      size_t compressedLength = 0)
+      size_t compressedLength = 0,
+      std::optional<DecompressedChunkCache> chunkCache = std::nullopt)
       : input_(std::move(inStream)),
         pool_(memPool),
         inputBuffer_(pool_),
         decompressor_{std::move(decompressor)},
         decrypter_{decrypter},
+        chunkCache_{std::move(chunkCache)},
         streamDebugInfo_{streamDebugInfo} {
     DWIO_ENSURE(
         decompressor_ || decrypter_,
         "one of decompressor or decryptor is required");
+    VELOX_CHECK(
+        !chunkCache_.has_value() || decrypter_ == nullptr ||
+            chunkCache_->includeEncrypted,
+        "Decompressed chunks of encrypted streams are not cached");
     DWIO_ENSURE(
         !useRawDecompression || compressedLength > 0,
         "For raw decompression, compressedLength should be greater than zero");
@@ -114,6 +122,24 @@ class PagedInputStream : public dwio::common::SeekableInputStream {
 
   void clearDecompressionState();
 
+  // Returns the decompressed data of the chunk at 'input' and sets
+  // 'outputBufferLength_' to its size. Takes the data from 'chunkCache_' if
+  // found there, else decompresses it and adds it to 'chunkCache_'. Streams
+  // with a decrypter look up 'chunkCache_' before decrypting instead.
+  const char* decompressChunk(const char* input, uint64_t decompressedLength);
+
+  // Returns the data of the current chunk if found in 'chunkCache_' and pins
+  // it in 'chunkPin_'. Returns nullptr if not found.
+  const char* findCachedChunk();
+
+  // Adds the decompressed current chunk in 'outputBuffer_' to 'chunkCache_'.
+  void cacheChunk();
+
+  cache::RawFileCacheKey chunkKey() const {
+    return {
+        chunkCache_->fileNum, chunkCache_->streamOffset + lastHeaderOffset_};
+  }
+
   enum class State { HEADER, START, ORIGINAL, END };
 
   // make sure input is contiguous for decompression/decryption
@@ -177,6 +203,13 @@ class PagedInputStream : public dwio::common::SeekableInputStream {
 
   int64_t pendingSkip_{0};
 
+  // Where to cache the decompressed chunks. Not set if chunks are not cached.
+  const std::optional<DecompressedChunkCache> chunkCache_;
+
+  // Pin on the cached data of the current chunk if it was found in
+  // 'chunkCache_'.
+  cache::CachePin chunkPin_;
+
  private:
   bool skipAllPending();
 
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/common/compression/QatDecompressor.h"
+
+#include <gflags/gflags.h>
+#include <array>
+#include <limits>
+#include <memory>
+#ifdef VELOX_ENABLE_QAT
+#include <qatzip.h>
+#endif
+
+DECLARE_bool(velox_qat_decompression);
+
+namespace facebook::velox::dwio::common::compression {
+
+using facebook::velox::common::CompressionKind;
+
+#ifdef VELOX_ENABLE_QAT
+namespace {
+
+// QATzip session for one data format. Setting up a session binds a QAT
+// instance to the calling thread and is expensive, and a session may not be
+// used by two threads at once, so each thread keeps its sessions for its
+// lifetime.
+class QatSession {
+ public:
+  explicit QatSession(QzDataFormat_T format) {
+    // No software backup inside QATzip: the caller falls back to its own
+    // decompressor so that fallbacks are counted.
+    auto result = qzInit(&session_, /*sw_backup=*/0);
+    if (result != QZ_OK && result != QZ_DUPLICATE) {
+      return;
+    }
+    initialized_ = true;
+    QzSessionParams_T params;
+    if (qzGetDefaults(&params) != QZ_OK) {
+      return;
+    }
+    params.data_fmt = format;
+    params.sw_backup = 0;
+    result = qzSetupSession(&session_, &params);
+    valid_ = result == QZ_OK || result == QZ_DUPLICATE;
+  }
+
+  ~QatSession() {
+    if (valid_) {
+      qzTeardownSession(&session_);
+    }
+    if (initialized_) {
+      qzClose(&session_);
+    }
+  }
+
+  // Returns the session or nullptr if the calling thread has no QAT instance.
+  QzSession_T* get() {
+    return valid_ ? &session_ : nullptr;
+  }
+
+  static QzSession_T* forThread(QzDataFormat_T format) {
+    thread_local std::array<std::unique_ptr<QatSession>, QZ_FMT_NUM> sessions;
+    auto& session = sessions[format];
+    if (session == nullptr) {
+      session = std::make_unique<QatSession>(format);
+    }
+    return session->get();
+  }
+
+ private:
+  QzSession_T session_{};
+  bool initialized_{false};
+  bool valid_{false};
+};
+
+class QatDecompressor : public Decompressor {
+ public:
+  QatDecompressor(
+      QzDataFormat_T format,
+      uint64_t blockSize,
+      const std::string& streamDebugInfo,
+      std::unique_ptr<Decompressor> fallback,
+      IoStatistics* ioStats)
+      : Decompressor{blockSize, streamDebugInfo},
+        format_{format},
+        fallback_{std::move(fallback)},
+        ioStats_{ioStats} {}
+
+  std::pair<int64_t, bool> getDecompressedLength(
+      const char* src,
+      uint64_t srcLength) const override {
+    return fallback_->getDecompressedLength(src, srcLength);
+  }
+
+  uint64_t decompress(
+      const char* src,
+      uint64_t srcLength,
+      char* dest,
+      uint64_t destLength) override;
+
+ private:
+  const QzDataFormat_T format_;
+  const std::unique_ptr<Decompressor> fallback_;
+  IoStatistics* const ioStats_;
+};
+
+uint64_t QatDecompressor::decompress(
+    const char* src,
+    uint64_t srcLength,
+    char* dest,
+    uint64_t destLength) {
+  auto* session = QatSession::forThread(format_);
+  constexpr uint64_t kMaxLength = std::numeric_limits<unsigned int>::max();
+  if (session != nullptr && srcLength <= kMaxLength &&
+      destLength <= kMaxLength) {
+    auto consumed = static_cast<unsigned int>(srcLength);
+    auto produced = static_cast<unsigned int>(destLength);
+    const auto result = qzDecompress(
+        session,
+        reinterpret_cast<const unsigned char*>(src),
+        &consumed,
+        reinterpret_cast<unsigned char*>(dest),
+        &produced);
+    if (result == QZ_OK && consumed == srcLength) {
+      if (ioStats_ != nullptr) {
+        ioStats_->offloadedDecompress().increment(produced);
+      }
+      return produced;
+    }
+  }
+  const auto size = fallback_->decompress(src, srcLength, dest, destLength);
+  if (ioStats_ != nullptr) {
+    ioStats_->offloadFallbackDecompress().increment(size);
+  }
+  return size;
+}
+} // namespace
+#endif
+
+bool qatDecompressionEnabled(CompressionKind kind) {
+#ifdef VELOX_ENABLE_QAT
+  return FLAGS_velox_qat_decompression &&
+      (kind == CompressionKind::CompressionKind_ZLIB ||
+       kind == CompressionKind::CompressionKind_GZIP);
+#else
+  return false;
+#endif
+}
+
+std::unique_ptr<Decompressor> makeQatDecompressor(
+    CompressionKind kind,
+    int windowBits,
+    uint64_t blockSize,
+    const std::string& streamDebugInfo,
+    std::unique_ptr<Decompressor> fallback,
+    IoStatistics* ioStats) {
+#ifdef VELOX_ENABLE_QAT
+  // QAT takes raw deflate and gzip but not the zlib wrapper.
+  if (windowBits < 0) {
+    return std::make_unique<QatDecompressor>(
+        QZ_DEFLATE_RAW,
+        blockSize,
+        streamDebugInfo,
+        std::move(fallback),
+        ioStats);
+  }
+  if (kind == CompressionKind::CompressionKind_GZIP) {
+    return std::make_unique<QatDecompressor>(
+        QZ_DEFLATE_GZIP,
+        blockSize,
+        streamDebugInfo,
+        std::move(fallback),
+        ioStats);
+  }
+#endif
+  return fallback;
+}
+
+} // namespace facebook::velox::dwio::common::compression
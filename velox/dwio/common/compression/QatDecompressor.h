@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "velox/dwio/common/compression/Compression.h"
+
+namespace facebook::velox::dwio::common::compression {
+
+/// Returns true if Velox is built with Intel QAT support and
+/// --velox_qat_decompression is set, i.e. zlib and gzip chunks of 'kind'
+/// should be decompressed by makeQatDecompressor().
+bool qatDecompressionEnabled(facebook::velox::common::CompressionKind kind);
+
+/// Returns a decompressor that offloads zlib or gzip chunks to an Intel QAT
+/// device through QATzip. 'windowBits' follows the zlib convention: negative
+/// for raw deflate, which is what DWRF/ORC write. A chunk the device does not
+/// accept, or every chunk when the calling thread has no QAT instance, is
+/// decompressed by 'fallback'. Offloaded and fallback chunks are counted in
+/// 'ioStats' if not null.
+std::unique_ptr<Decompressor> makeQatDecompressor(
+    facebook::velox::common::CompressionKind kind,
+    int windowBits,
+    uint64_t blockSize,
+    const std::string& streamDebugInfo,
+    std::unique_ptr<Decompressor> fallback,
+    IoStatistics* ioStats);
+
+} // namespace facebook::velox::dwio::common::compression
@@ -153,6 +153,9 @@ TEST_F(BitPackDecoderTest, allWidths) {
     testUnpack<int32_t>(width, oddRows_);
     testUnpack<int64_t>(width, oddRows_);
   }
+  // 32 bit fields do not fit a signed 32 bit result.
+  testUnpack<int64_t>(32, allRows_);
+  testUnpack<int64_t>(32, oddRows_);
 }
 
 TEST_F(BitPackDecoderTest, uint8AllRows) {
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/common/FileMetadataCache.h"
+
+#include <gtest/gtest.h>
+
+#include "velox/common/base/tests/GTestUtils.h"
+
+namespace facebook::velox::dwio::common {
+namespace {
+
+class FileMetadataCacheTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    FileMetadataCache::testingReset();
+  }
+
+  void TearDown() override {
+    FileMetadataCache::testingReset();
+  }
+};
+
+TEST_F(FileMetadataCacheTest, init) {
+  ASSERT_EQ(FileMetadataCache::instance(), nullptr);
+  FileMetadataCache::init(1'000);
+  ASSERT_NE(FileMetadataCache::instance(), nullptr);
+  ASSERT_EQ(FileMetadataCache::instance()->maxBytes(), 1'000);
+  VELOX_ASSERT_THROW(
+      FileMetadataCache::init(1'000), "FileMetadataCache has already been set");
+}
+
+TEST_F(FileMetadataCacheTest, getAndPut) {
+  FileMetadataCache::init(1'000);
+  auto* cache = FileMetadataCache::instance();
+  const FileMetadataCache::Key key{"/a", "1"};
+  ASSERT_EQ(cache->get<std::string>(key), nullptr);
+
+  cache->put(key, std::make_shared<const std::string>("a1"), 100);
+  ASSERT_EQ(*cache->get<std::string>(key), "a1");
+  // Another version of the same file is a different entry.
+  ASSERT_EQ(cache->get<std::string>({"/a", "2"}), nullptr);
+
+  // The first entry is kept.
+  cache->put(key, std::make_shared<const std::string>("a1 again"), 100);
+  ASSERT_EQ(*cache->get<std::string>(key), "a1");
+
+  // Too large to cache.
+  cache->put({"/b", "1"}, std::make_shared<const std::string>("b1"), 1'001);
+  ASSERT_EQ(cache->get<std::string>({"/b", "1"}), nullptr);
+
+  const auto stats = cache->stats();
+  ASSERT_EQ(stats.numEntries, 1);
+  ASSERT_EQ(stats.bytes, 100);
+  ASSERT_EQ(stats.numHits, 2);
+  ASSERT_EQ(stats.numMisses, 3);
+  ASSERT_EQ(stats.numEvictions, 0);
+}
+
+TEST_F(FileMetadataCacheTest, evict) {
+  FileMetadataCache::init(1'000);
+  auto* cache = FileMetadataCache::instance();
+  for (auto i = 0; i < 4; ++i) {
+    cache->put(
+        {fmt::format("/{}", i), "1"},
+        std::make_shared<const int32_t>(i),
+        300);
+  }
+  // The least recently used entry is evicted.
+  ASSERT_EQ(cache->get<int32_t>({"/0", "1"}), nullptr);
+  ASSERT_EQ(*cache->get<int32_t>({"/1", "1"}), 1);
+
+  cache->put({"/4", "1"}, std::make_shared<const int32_t>(4), 300);
+  ASSERT_EQ(cache->get<int32_t>({"/2", "1"}), nullptr);
+  ASSERT_EQ(*cache->get<int32_t>({"/1", "1"}), 1);
+  ASSERT_EQ(*cache->get<int32_t>({"/3", "1"}), 3);
+  ASSERT_EQ(*cache->get<int32_t>({"/4", "1"}), 4);
+
+  const auto stats = cache->stats();
+  ASSERT_EQ(stats.numEntries, 3);
+  ASSERT_EQ(stats.bytes, 900);
+  ASSERT_EQ(stats.numEvictions, 2);
+}
+
+} // namespace
+} // namespace facebook::velox::dwio::common
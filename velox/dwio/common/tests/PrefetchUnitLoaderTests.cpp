@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/executors/ManualExecutor.h>
+#include <gtest/gtest.h>
+
+#include "velox/dwio/common/PrefetchUnitLoader.h"
+#include "velox/dwio/common/tests/utils/UnitLoaderTestTools.h"
+
+using facebook::velox::dwio::common::LoadUnit;
+using facebook::velox::dwio::common::PrefetchUnitLoaderFactory;
+using facebook::velox::dwio::common::UnitLoader;
+using facebook::velox::dwio::common::test::ReaderMock;
+
+namespace {
+
+class PrefetchCountingUnit : public LoadUnit {
+ public:
+  PrefetchCountingUnit(uint64_t ioSize, std::atomic<int32_t>& numPrefetches)
+      : ioSize_{ioSize}, numPrefetches_{numPrefetches} {}
+
+  void load() override {}
+
+  void unload() override {}
+
+  uint64_t getNumRows() override {
+    return 10;
+  }
+
+  uint64_t getIoSize() override {
+    return ioSize_;
+  }
+
+  uint64_t prefetch() override {
+    ++numPrefetches_;
+    return ioSize_;
+  }
+
+ private:
+  const uint64_t ioSize_;
+  std::atomic<int32_t>& numPrefetches_;
+};
+
+std::vector<std::unique_ptr<LoadUnit>> makeUnits(
+    std::vector<std::atomic<int32_t>>& numPrefetches) {
+  std::vector<std::unique_ptr<LoadUnit>> units;
+  for (auto& count : numPrefetches) {
+    units.push_back(std::make_unique<PrefetchCountingUnit>(10, count));
+  }
+  return units;
+}
+
+std::vector<int32_t> counts(
+    const std::vector<std::atomic<int32_t>>& numPrefetches) {
+  return {numPrefetches.begin(), numPrefetches.end()};
+}
+
+} // namespace
+
+TEST(PrefetchUnitLoaderTests, LoadsCorrectlyWithReader) {
+  folly::CPUThreadPoolExecutor executor(2);
+  size_t blockedOnIoCount = 0;
+  PrefetchUnitLoaderFactory factory(
+      &executor, 2, 1 << 20, [&](auto) { ++blockedOnIoCount; });
+  ReaderMock readerMock{{10, 20, 30}, {0, 0, 0}, factory, 0};
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({false, false, false}));
+
+  EXPECT_TRUE(readerMock.read(3)); // Unit: 0, rows: 0-2, load(0)
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({true, false, false}));
+  EXPECT_EQ(blockedOnIoCount, 1);
+
+  EXPECT_TRUE(readerMock.read(7)); // Unit: 0, rows: 3-9
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({true, false, false}));
+  EXPECT_EQ(blockedOnIoCount, 1);
+
+  EXPECT_TRUE(readerMock.read(20)); // Unit: 1, rows: 0-19, unload(0), load(1)
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({false, true, false}));
+  EXPECT_EQ(blockedOnIoCount, 2);
+
+  EXPECT_TRUE(readerMock.read(30)); // Unit: 2, rows: 0-29, unload(1), load(2)
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({false, false, true}));
+  EXPECT_EQ(blockedOnIoCount, 3);
+
+  EXPECT_FALSE(readerMock.read(30)); // No more data
+  EXPECT_EQ(blockedOnIoCount, 3);
+}
+
+TEST(PrefetchUnitLoaderTests, PrefetchesWithinLimits) {
+  folly::ManualExecutor executor;
+  std::vector<std::atomic<int32_t>> numPrefetches(5);
+  PrefetchUnitLoaderFactory factory(&executor, 3, 15, nullptr);
+  auto loader = factory.create(makeUnits(numPrefetches), 0);
+
+  // The first unit is prefetched on creation.
+  executor.run();
+  EXPECT_EQ(counts(numPrefetches), std::vector<int32_t>({1, 0, 0, 0, 0}));
+
+  // Nothing is waiting to be loaded, so the next 3 units are scheduled.
+  loader->getLoadedUnit(0);
+  executor.run();
+  EXPECT_EQ(counts(numPrefetches), std::vector<int32_t>({1, 1, 1, 1, 0}));
+
+  // Units 2 and 3 hold 20 bytes, over the 15 byte limit.
+  loader->getLoadedUnit(1);
+  executor.run();
+  EXPECT_EQ(counts(numPrefetches), std::vector<int32_t>({1, 1, 1, 1, 0}));
+
+  loader->getLoadedUnit(2);
+  executor.run();
+  EXPECT_EQ(counts(numPrefetches), std::vector<int32_t>({1, 1, 1, 1, 1}));
+}
+
+TEST(PrefetchUnitLoaderTests, PrefetchesOnCallerIfNotStarted) {
+  folly::ManualExecutor executor;
+  std::vector<std::atomic<int32_t>> numPrefetches(3);
+  PrefetchUnitLoaderFactory factory(&executor, 1, 1 << 20, nullptr);
+  // Skipping 15 rows starts at the second unit.
+  auto loader = factory.create(makeUnits(numPrefetches), 15);
+
+  loader->getLoadedUnit(1);
+  EXPECT_EQ(counts(numPrefetches), std::vector<int32_t>({0, 1, 0}));
+
+  // The prefetch made by the loader is not repeated by the executor.
+  executor.run();
+  EXPECT_EQ(counts(numPrefetches), std::vector<int32_t>({0, 1, 1}));
+
+  // Pending prefetches are dropped with the loader.
+  loader->getLoadedUnit(0);
+  loader.reset();
+  executor.run();
+  EXPECT_EQ(counts(numPrefetches), std::vector<int32_t>({0, 1, 1}));
+}
@@ -0,0 +1,438 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/String.h>
+#include <folly/init/Init.h>
+#include <folly/json.h>
+#include <gflags/gflags.h>
+
+#include <fstream>
+
+#include "velox/common/base/SuccinctPrinter.h"
+#include "velox/common/file/File.h"
+#include "velox/common/time/Timer.h"
+#include "velox/dwio/common/FileSink.h"
+#include "velox/dwio/common/ReaderFactory.h"
+#include "velox/dwio/common/tests/utils/DataSetBuilder.h"
+#include "velox/dwio/common/tests/utils/FilterGenerator.h"
+#include "velox/dwio/dwrf/RegisterDwrfReader.h"
+#include "velox/dwio/dwrf/writer/Writer.h"
+#include "velox/dwio/text/RegisterTextReader.h"
+#include "velox/dwio/text/writer/TextWriter.h"
+#ifdef VELOX_ENABLE_PARQUET
+#include "velox/dwio/parquet/RegisterParquetReader.h"
+#include "velox/dwio/parquet/writer/Writer.h"
+#endif
+
+DEFINE_string(
+    formats,
+    "dwrf,parquet,text",
+    "Comma separated file formats to write and read. One of 'dwrf', "
+    "'parquet' and 'text'");
+DEFINE_string(
+    types,
+    "bigint,double,varchar,struct,array,map",
+    "Comma separated column types. 'struct' is row(bigint, varchar), "
+    "'array' is array(bigint) and 'map' is map(bigint, double)");
+DEFINE_string(
+    shapes,
+    "random,runs,sequential,lowcard",
+    "Comma separated value distributions. 'runs' repeats integers in runs "
+    "for RLE, 'sequential' makes increasing integers for delta encoding and "
+    "'lowcard' makes integers or strings with 100 distinct values for "
+    "dictionary encoding. Shapes that do not apply to a type are skipped");
+DEFINE_string(
+    encodings,
+    "dictionary,direct",
+    "Comma separated writer encodings to try. 'dictionary' forces dictionary "
+    "encoding and 'direct' disables it. Text has no encodings");
+DEFINE_string(null_pcts, "0,20", "Comma separated percentages of nulls");
+DEFINE_string(
+    selectivity_pcts,
+    "100,20",
+    "Comma separated percentages of rows passing a range filter on the "
+    "column. 100 means no filter. Only applies to primitive types");
+DEFINE_int32(num_batches, 20, "Number of batches written to each file");
+DEFINE_int32(batch_size, 10'000, "Rows per written batch");
+DEFINE_int32(read_size, 10'000, "Rows per RowReader::next() call");
+DEFINE_int32(num_repeats, 5, "Reads of each file. The median is reported");
+DEFINE_string(
+    output_json,
+    "",
+    "If set, appends one JSON object per case to this file for perf "
+    "tracking");
+
+/// Writes single column files for a matrix of format, type, value shape,
+/// encoding, null ratio and filter selectivity, and reads each back through
+/// the format's RowReader from memory. The files are read from memory so that
+/// the times reflect decoding and filtering in the selective column readers
+/// rather than IO. The selective column reader that runs is determined by the
+/// format, type and encoding of a case. Reports rows/s and file bytes/s per
+/// case.
+
+using namespace facebook::velox;
+using namespace facebook::velox::dwio::common;
+using namespace facebook::velox::test;
+
+namespace {
+
+struct Case {
+  FileFormat format;
+  std::string type;
+  std::string shape;
+  std::string encoding;
+  int32_t nullPct;
+  int32_t selectivityPct;
+
+  std::string name() const {
+    return fmt::format(
+        "{}/{}/{}/{}/nulls_{}/select_{}",
+        toString(format),
+        type,
+        shape,
+        encoding,
+        nullPct,
+        selectivityPct);
+  }
+};
+
+struct Result {
+  uint64_t fileBytes{0};
+  uint64_t rowsRead{0};
+  uint64_t rowsPassed{0};
+  uint64_t nanos{0};
+};
+
+std::vector<std::string> splitFlag(const std::string& value) {
+  std::vector<std::string> parts;
+  folly::split(',', value, parts, true);
+  return parts;
+}
+
+std::vector<int32_t> splitIntFlag(const std::string& value) {
+  std::vector<int32_t> numbers;
+  for (const auto& part : splitFlag(value)) {
+    numbers.push_back(folly::to<int32_t>(part));
+  }
+  return numbers;
+}
+
+TypePtr columnType(const std::string& name) {
+  if (name == "bigint") {
+    return BIGINT();
+  }
+  if (name == "double") {
+    return DOUBLE();
+  }
+  if (name == "varchar") {
+    return VARCHAR();
+  }
+  if (name == "struct") {
+    return ROW({"a", "b"}, {BIGINT(), VARCHAR()});
+  }
+  if (name == "array") {
+    return ARRAY(BIGINT());
+  }
+  if (name == "map") {
+    return MAP(BIGINT(), DOUBLE());
+  }
+  VELOX_USER_FAIL("Unknown column type: {}", name);
+}
+
+bool shapeApplies(const std::string& shape, const TypePtr& type) {
+  if (shape == "random") {
+    return true;
+  }
+  if (shape == "runs" || shape == "sequential") {
+    return type->kind() == TypeKind::BIGINT;
+  }
+  if (shape == "lowcard") {
+    return type->isPrimitiveType();
+  }
+  VELOX_USER_FAIL("Unknown value shape: {}", shape);
+}
+
+class ReaderMatrixBenchmark {
+ public:
+  ReaderMatrixBenchmark()
+      : rootPool_(memory::memoryManager()->addRootPool("ReaderMatrix")),
+        leafPool_(rootPool_->addLeafChild("ReaderMatrix")) {}
+
+  Result run(const Case& testCase) {
+    const auto rowType = ROW({"c0"}, {columnType(testCase.type)});
+    const auto batches = makeBatches(testCase, rowType);
+    const auto file = write(testCase, rowType, *batches);
+
+    std::vector<FilterSpec> filterSpecs;
+    if (testCase.selectivityPct < 100) {
+      filterSpecs.push_back(FilterSpec(
+          "c0",
+          0,
+          testCase.selectivityPct,
+          filterKind(rowType->childAt(0)),
+          false,
+          false));
+    }
+    FilterGenerator filterGenerator(rowType, 0);
+    std::vector<uint64_t> hitRows;
+    auto filters = filterGenerator.makeSubfieldFilters(
+        filterSpecs, *batches, nullptr, hitRows);
+    auto scanSpec = filterGenerator.makeScanSpec(std::move(filters));
+
+    std::vector<Result> results;
+    for (auto i = 0; i < FLAGS_num_repeats; ++i) {
+      auto result = read(testCase.format, rowType, scanSpec, file);
+      result.fileBytes = file.size();
+      results.push_back(result);
+    }
+    std::sort(results.begin(), results.end(), [](auto& left, auto& right) {
+      return left.nanos < right.nanos;
+    });
+    return results[results.size() / 2];
+  }
+
+ private:
+  static FilterKind filterKind(const TypePtr& type) {
+    switch (type->kind()) {
+      case TypeKind::BIGINT:
+        return FilterKind::kBigintRange;
+      case TypeKind::DOUBLE:
+        return FilterKind::kDoubleRange;
+      case TypeKind::VARCHAR:
+        return FilterKind::kBytesRange;
+      default:
+        VELOX_UNSUPPORTED("No range filter for {}", type->toString());
+    }
+  }
+
+  std::unique_ptr<std::vector<RowVectorPtr>> makeBatches(
+      const Case& testCase,
+      const RowTypePtr& rowType) {
+    DataSetBuilder builder(*leafPool_, 0);
+    builder.makeDataset(rowType, FLAGS_num_batches, FLAGS_batch_size);
+    const common::Subfield field("c0");
+    const auto kind = rowType->childAt(0)->kind();
+    if (testCase.shape == "runs") {
+      builder.withIntRleForField<int64_t>(field);
+    } else if (testCase.shape == "lowcard") {
+      if (kind == TypeKind::VARCHAR) {
+        builder.withStringDistributionForField(field, 100, true, false);
+      } else if (kind == TypeKind::DOUBLE) {
+        builder.withQuantizedFloatForField<double>(field, 100, true);
+      } else {
+        builder.withIntDistributionForField<int64_t>(
+            field, 0, 100, 0, 0, 0, 0, true);
+      }
+    }
+    builder.withNullsForField(field, testCase.nullPct);
+    auto batches = builder.build();
+    if (testCase.shape == "sequential") {
+      int64_t value = 0;
+      for (auto& batch : *batches) {
+        auto* values = batch->childAt(0)->asFlatVector<int64_t>();
+        for (auto row = 0; row < values->size(); ++row) {
+          if (!values->isNullAt(row)) {
+            values->set(row, value);
+            value += 1 + row % 3;
+          }
+        }
+      }
+    }
+    return batches;
+  }
+
+  std::string write(
+      const Case& testCase,
+      const RowTypePtr& rowType,
+      const std::vector<RowVectorPtr>& batches) {
+    auto sink = std::make_unique<MemorySink>(
+        200 << 20, FileSink::Options{.pool = leafPool_.get()});
+    auto* sinkPtr = sink.get();
+    const bool dictionary = testCase.encoding == "dictionary";
+    std::unique_ptr<Writer> writer;
+    switch (testCase.format) {
+      case FileFormat::DWRF: {
+        auto config = std::make_shared<dwrf::Config>();
+        config->set(dwrf::Config::COMPRESSION, common::CompressionKind_NONE);
+        config->set(
+            dwrf::Config::INTEGER_DICTIONARY_ENCODING_ENABLED, dictionary);
+        config->set(
+            dwrf::Config::STRING_DICTIONARY_ENCODING_ENABLED, dictionary);
+        const float threshold = dictionary ? 1.0 : 0.0;
+        config->set(
+            dwrf::Config::DICTIONARY_NUMERIC_KEY_SIZE_THRESHOLD, threshold);
+        config->set(
+            dwrf::Config::DICTIONARY_STRING_KEY_SIZE_THRESHOLD, threshold);
+        config->set(dwrf::Config::ENTROPY_KEY_STRING_SIZE_THRESHOLD, threshold);
+        dwrf::WriterOptions options;
+        options.config = config;
+        options.schema = rowType;
+        options.memoryPool = rootPool_.get();
+        writer = std::make_unique<dwrf::Writer>(std::move(sink), options);
+        break;
+      }
+#ifdef VELOX_ENABLE_PARQUET
+      case FileFormat::PARQUET: {
+        parquet::WriterOptions options;
+        options.enableDictionary = dictionary;
+        options.memoryPool = rootPool_.get();
+        writer = std::make_unique<parquet::Writer>(
+            std::move(sink), options, rowType);
+        break;
+      }
+#endif
+      case FileFormat::TEXT: {
+        auto options = std::make_shared<text::WriterOptions>();
+        options->memoryPool = rootPool_.get();
+        writer = std::make_unique<text::TextWriter>(
+            rowType, std::move(sink), options);
+        break;
+      }
+      default:
+        VELOX_UNSUPPORTED("No writer for {}", toString(testCase.format));
+    }
+    for (const auto& batch : batches) {
+      writer->write(batch);
+    }
+    writer->close();
+    return std::string(sinkPtr->data(), sinkPtr->size());
+  }
+
+  Result read(
+      FileFormat format,
+      const RowTypePtr& rowType,
+      const std::shared_ptr<common::ScanSpec>& scanSpec,
+      const std::string& file) {
+    ReaderOptions readerOptions{leafPool_.get()};
+    readerOptions.setFileFormat(format);
+    readerOptions.setFileSchema(rowType);
+    auto input = std::make_unique<BufferedInput>(
+        std::make_shared<InMemoryReadFile>(file), readerOptions.memoryPool());
+    auto reader = getReaderFactory(format)->createReader(
+        std::move(input), readerOptions);
+    RowReaderOptions rowReaderOptions;
+    rowReaderOptions.select(
+        std::make_shared<ColumnSelector>(rowType, rowType->names()));
+    rowReaderOptions.setScanSpec(scanSpec);
+    auto rowReader = reader->createRowReader(rowReaderOptions);
+    rowReader->resetFilterCaches();
+
+    Result result;
+    auto batch = BaseVector::create(rowType, 0, leafPool_.get());
+    {
+      NanosecondTimer timer(&result.nanos);
+      for (;;) {
+        const auto numRead = rowReader->next(FLAGS_read_size, batch);
+        if (numRead == 0) {
+          break;
+        }
+        result.rowsRead += numRead;
+        if (batch->size() == 0) {
+          continue;
+        }
+        auto* rowVector = batch->asUnchecked<RowVector>();
+        rowVector->childAt(0)->loadedVector();
+        result.rowsPassed += rowVector->size();
+      }
+    }
+    return result;
+  }
+
+  std::shared_ptr<memory::MemoryPool> rootPool_;
+  std::shared_ptr<memory::MemoryPool> leafPool_;
+};
+
+std::vector<Case> makeCases() {
+  std::vector<Case> cases;
+  for (const auto& formatName : splitFlag(FLAGS_formats)) {
+    const auto format = toFileFormat(formatName);
+    for (const auto& typeName : splitFlag(FLAGS_types)) {
+      const auto type = columnType(typeName);
+      for (const auto& shape : splitFlag(FLAGS_shapes)) {
+        if (!shapeApplies(shape, type)) {
+          continue;
+        }
+        auto encodings = splitFlag(FLAGS_encodings);
+        if (format == FileFormat::TEXT) {
+          encodings = {"plain"};
+        }
+        for (const auto& encoding : encodings) {
+          for (auto nullPct : splitIntFlag(FLAGS_null_pcts)) {
+            for (auto selectivityPct : splitIntFlag(FLAGS_selectivity_pcts)) {
+              if (selectivityPct < 100 && !type->isPrimitiveType()) {
+                continue;
+              }
+              // A filter over all-null data selects nothing.
+              if (selectivityPct < 100 && nullPct == 100) {
+                continue;
+              }
+              cases.push_back(
+                  {format, typeName, shape, encoding, nullPct, selectivityPct});
+            }
+          }
+        }
+      }
+    }
+  }
+  return cases;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  folly::Init init{&argc, &argv};
+  memory::MemoryManager::initialize(memory::MemoryManager::Options{});
+  dwrf::registerDwrfReaderFactory();
+  text::registerTextReaderFactory();
+#ifdef VELOX_ENABLE_PARQUET
+  parquet::registerParquetReaderFactory();
+#endif
+
+  std::unique_ptr<std::ofstream> json;
+  if (!FLAGS_output_json.empty()) {
+    json = std::make_unique<std::ofstream>(FLAGS_output_json, std::ios::app);
+    VELOX_USER_CHECK(json->good(), "Cannot open {}", FLAGS_output_json);
+  }
+
+  ReaderMatrixBenchmark benchmark;
+  for (const auto& testCase : makeCases()) {
+    const auto result = benchmark.run(testCase);
+    const double seconds = std::max<uint64_t>(result.nanos, 1) / 1e9;
+    const double rowsPerSecond = result.rowsRead / seconds;
+    const double bytesPerSecond = result.fileBytes / seconds;
+    std::cout << fmt::format(
+                     "{:<56} {:>12.0f} rows/s {:>10}/s {:>10} passed {}",
+                     testCase.name(),
+                     rowsPerSecond,
+                     succinctBytes(bytesPerSecond),
+                     succinctBytes(result.fileBytes),
+                     result.rowsPassed)
+              << std::endl;
+    if (json != nullptr) {
+      folly::dynamic record = folly::dynamic::object("name", testCase.name())(
+          "format", std::string(toString(testCase.format)))(
+          "type", testCase.type)(
+          "shape", testCase.shape)("encoding", testCase.encoding)(
+          "nullPct", testCase.nullPct)(
+          "selectivityPct", testCase.selectivityPct)(
+          "fileBytes", result.fileBytes)("rowsRead", result.rowsRead)(
+          "rowsPassed", result.rowsPassed)("nanos", result.nanos)(
+          "rowsPerSecond", rowsPerSecond)("bytesPerSecond", bytesPerSecond);
+      *json << folly::toJson(record) << std::endl;
+    }
+  }
+  return 0;
+}
@@ -105,6 +105,8 @@ inline CompressionOptions getDwrfOrcDecompressionOptions(
  * @param input The input stream that is the underlying source
  * @param bufferSize The maximum size of the buffer
  * @param pool The memory pool
+ * @param chunkCache Where to cache the decompressed chunks, if anywhere
+ * @param ioStats Where to count the chunks offloaded to hardware, if anywhere
  */
 inline std::unique_ptr<dwio::common::SeekableInputStream> createDecompressor(
     facebook::velox::common::CompressionKind kind,
@@ -112,7 +114,10 @@ inline std::unique_ptr<dwio::common::SeekableInputStream> createDecompressor(
     uint64_t bufferSize,
     memory::MemoryPool& pool,
     const std::string& streamDebugInfo,
-    const dwio::common::encryption::Decrypter* decryptr = nullptr) {
+    const dwio::common::encryption::Decrypter* decryptr = nullptr,
+    std::optional<dwio::common::DecompressedChunkCache> chunkCache =
+        std::nullopt,
+    dwio::common::IoStatistics* ioStats = nullptr) {
   const CompressionOptions& options = getDwrfOrcDecompressionOptions(kind);
   return createDecompressor(
       kind,
@@ -121,7 +126,11 @@ inline std::unique_ptr<dwio::common::SeekableInputStream> createDecompressor(
       pool,
       options,
       streamDebugInfo,
-      decryptr);
+      decryptr,
+      /*useRawDecompression=*/false,
+      /*compressedLength=*/0,
+      std::move(chunkCache),
+      ioStats);
 }
 
 } // namespace facebook::velox::dwrf
@@ -47,6 +47,12 @@ class Config : public config::ConfigBase {
   static Entry<float> DICTIONARY_NUMERIC_KEY_SIZE_THRESHOLD;
   static Entry<float> DICTIONARY_STRING_KEY_SIZE_THRESHOLD;
   static Entry<bool> DICTIONARY_SORT_KEYS;
+  /// If non-zero, dictionary encoded columns are checked for dictionary
+  /// efficiency once the first stripe has this many rows, using the same
+  /// thresholds as at the first stripe flush, and columns that do not benefit
+  /// switch to direct encoding before building the dictionary for the whole
+  /// stripe. The decision is kept for the later stripes.
+  static Entry<uint32_t> DICTIONARY_EARLY_SELECTION_ROWS;
   static Entry<float> ENTROPY_KEY_STRING_SIZE_THRESHOLD;
   static Entry<uint32_t> ENTROPY_STRING_MIN_SAMPLES;
   static Entry<float> ENTROPY_STRING_DICT_SAMPLE_FRACTION;
@@ -18,10 +18,104 @@
 #include "velox/dwio/common/SeekableInputStream.h"
 #include "velox/dwio/dwrf/common/Common.h"
 
+#include <folly/lang/Bits.h>
+
 namespace facebook::velox::dwrf {
 
 using memory::MemoryPool;
 
+namespace detail {
+namespace {
+
+// Assembles the field at 'bit' one byte at a time. Used where a word load
+// would read past the end of the input.
+FOLLY_ALWAYS_INLINE int64_t
+unpackOne(const uint8_t* input, uint64_t bit, uint32_t bitWidth) {
+  const uint8_t* byte = input + (bit >> 3);
+  const uint32_t shift = bit & 7;
+  const uint32_t numBytes = (shift + bitWidth + 7) / 8;
+  uint64_t word = 0;
+  for (uint32_t i = 0; i < numBytes; ++i) {
+    word = (word << 8) | byte[i];
+  }
+  word >>= numBytes * 8 - shift - bitWidth;
+  return static_cast<int64_t>(
+      bitWidth == 64 ? word : word & ((1ULL << bitWidth) - 1));
+}
+
+// 'bitWidth' is a compile time constant at every call site below, so the
+// shifts in the main loop are fixed and the loop vectorizes.
+FOLLY_ALWAYS_INLINE void unpackFixed(
+    const uint8_t* input,
+    const uint8_t* inputEnd,
+    uint64_t numValues,
+    uint32_t bitWidth,
+    int64_t* result) {
+  uint64_t i = 0;
+  const uint64_t available = inputEnd - input;
+  if (bitWidth == 64) {
+    const uint64_t numFast = std::min<uint64_t>(numValues, available / 8);
+    for (; i < numFast; ++i) {
+      uint64_t word;
+      memcpy(&word, input + i * 8, sizeof(word));
+      result[i] = static_cast<int64_t>(folly::Endian::big(word));
+    }
+  } else if (available >= sizeof(uint64_t)) {
+    // Fields are at most 56 bits here, so each one fits in the 8 bytes loaded
+    // from its first byte independent of its bit offset in that byte.
+    const uint64_t numFast = std::min<uint64_t>(
+        numValues, (available - sizeof(uint64_t)) * 8 / bitWidth + 1);
+    for (; i < numFast; ++i) {
+      const uint64_t bit = i * bitWidth;
+      uint64_t word;
+      memcpy(&word, input + (bit >> 3), sizeof(word));
+      word = folly::Endian::big(word);
+      result[i] = static_cast<int64_t>((word << (bit & 7)) >> (64 - bitWidth));
+    }
+  }
+  for (; i < numValues; ++i) {
+    result[i] = unpackOne(input, i * bitWidth, bitWidth);
+  }
+}
+
+} // namespace
+
+void unpackBigEndian(
+    const char* input,
+    const char* inputEnd,
+    uint64_t numValues,
+    uint32_t bitWidth,
+    int64_t* result) {
+  auto* bytes = reinterpret_cast<const uint8_t*>(input);
+  auto* bytesEnd = reinterpret_cast<const uint8_t*>(inputEnd);
+  switch (bitWidth) {
+#define VELOX_UNPACK_CASE(width)                            \
+  case width:                                               \
+    unpackFixed(bytes, bytesEnd, numValues, width, result); \
+    return;
+    VELOX_UNPACK_CASE(1)
+    VELOX_UNPACK_CASE(2)
+    VELOX_UNPACK_CASE(4)
+    VELOX_UNPACK_CASE(8)
+    VELOX_UNPACK_CASE(16)
+    VELOX_UNPACK_CASE(24)
+    VELOX_UNPACK_CASE(32)
+    VELOX_UNPACK_CASE(40)
+    VELOX_UNPACK_CASE(48)
+    VELOX_UNPACK_CASE(56)
+    VELOX_UNPACK_CASE(64)
+#undef VELOX_UNPACK_CASE
+    default:
+      // RLEv2 only uses the widths from decodeBitWidth(), so anything not
+      // covered above is narrower than 32 bits.
+      VELOX_DCHECK_GT(bitWidth, 0);
+      VELOX_DCHECK_LT(bitWidth, 32);
+      unpackFixed(bytes, bytesEnd, numValues, bitWidth, result);
+  }
+}
+
+} // namespace detail
+
 struct FixedBitSizes {
   enum FBS {
     ONE = 0,
@@ -427,43 +521,43 @@ uint64_t RleDecoderV2<isSigned>::nextPatched(
     // any remaining bits are thrown out
     resetReadLongs();
 
-    // apply the patch directly when decoding the packed data
+    // Scatter the patches into the unpacked values once per run so that
+    // producing the output below is a plain add of the base.
     patchMask_ = ((static_cast<int64_t>(1) << patchBitSize_) - 1);
-
     adjustGapAndPatch();
-  }
-
-  uint64_t nRead = std::min(runLength_ - runRead_, numValues);
-
-  for (uint64_t pos = offset; pos < offset + nRead; ++pos) {
-    // skip null positions
-    if (nulls && bits::isBitNull(nulls, pos)) {
-      continue;
-    }
-    if (static_cast<int64_t>(unpackedIdx_) != actualGap_) {
-      // no patching required. add base to unpacked value to get final value
-      data[pos] = base_ + unpacked_[unpackedIdx_];
-    } else {
-      // extract the patch value
-      int64_t patchedVal = unpacked_[unpackedIdx_] | (curPatch_ << bitSize_);
-
-      // add base to patched value
-      data[pos] = base_ + patchedVal;
-
+    uint64_t patchPos = actualGap_;
+    while (patchPos < runLength_) {
+      unpacked_[patchPos] |= curPatch_ << bitSize_;
       // increment the patch to point to next entry in patch list
       ++patchIdx_;
+      if (patchIdx_ >= unpackedPatch_.size()) {
+        break;
+      }
+      adjustGapAndPatch();
+      // next gap is relative to the current gap
+      patchPos += actualGap_;
+    }
+  }
 
-      if (patchIdx_ < unpackedPatch_.size()) {
-        adjustGapAndPatch();
+  uint64_t nRead = std::min(runLength_ - runRead_, numValues);
 
-        // next gap is relative to the current gap
-        actualGap_ += unpackedIdx_;
+  const int64_t* unpacked = unpacked_.data() + unpackedIdx_;
+  uint64_t numUnpacked = 0;
+  if (nulls) {
+    for (uint64_t pos = offset; pos < offset + nRead; ++pos) {
+      // skip null positions
+      if (!bits::isBitNull(nulls, pos)) {
+        data[pos] = base_ + unpacked[numUnpacked++];
       }
     }
-
-    ++runRead_;
-    ++unpackedIdx_;
+  } else {
+    for (uint64_t i = 0; i < nRead; ++i) {
+      data[offset + i] = base_ + unpacked[i];
+    }
+    numUnpacked = nRead;
   }
+  runRead_ += numUnpacked;
+  unpackedIdx_ += numUnpacked;
 
   return nRead;
 }
@@ -559,7 +653,23 @@ uint64_t RleDecoderV2<isSigned>::nextDelta(
     uint64_t remaining = (offset + nRead) - pos;
     runRead_ += readLongs(data, pos, remaining, bitSize_, nulls);
 
-    if (deltaBase_ < 0) {
+    if (!nulls) {
+      // Running sum of the unpacked deltas without per-row null checks.
+      int64_t* deltas = data + pos;
+      int64_t value = prevValue_;
+      if (deltaBase_ < 0) {
+        for (uint64_t i = 0; i < remaining; ++i) {
+          value -= deltas[i];
+          deltas[i] = value;
+        }
+      } else {
+        for (uint64_t i = 0; i < remaining; ++i) {
+          value += deltas[i];
+          deltas[i] = value;
+        }
+      }
+      prevValue_ = value;
+    } else if (deltaBase_ < 0) {
       for (; pos < offset + nRead; ++pos) {
         // skip null positions
         if (nulls && bits::isBitNull(nulls, pos)) {
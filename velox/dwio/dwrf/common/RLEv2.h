@@ -26,6 +26,22 @@
 
 namespace facebook::velox::dwrf {
 
+namespace detail {
+
+/// Unpacks 'numValues' fields of 'bitWidth' bits each into 'result'. The
+/// fields are packed most significant bit first starting at the first bit of
+/// 'input', as in RLEv2 DIRECT, PATCHED_BASE and DELTA runs, and must all end
+/// before 'inputEnd'. Word-sized loads are used wherever they stay inside
+/// [input, inputEnd), which lets the per-width loops vectorize.
+void unpackBigEndian(
+    const char* input,
+    const char* inputEnd,
+    uint64_t numValues,
+    uint32_t bitWidth,
+    int64_t* result);
+
+} // namespace detail
+
 template <bool isSigned>
 class RleDecoderV2 : public dwio::common::IntDecoder<isSigned> {
  public:
@@ -160,37 +176,77 @@ class RleDecoderV2 : public dwio::common::IntDecoder<isSigned> {
       uint64_t len,
       uint64_t fb,
       const uint64_t* nulls = nullptr) {
+    if (!nulls) {
+      return readLongsNoNulls(data + offset, len, fb);
+    }
     uint64_t ret = 0;
-
-    // TODO: unroll to improve performance
     for (uint64_t i = offset; i < (offset + len); i++) {
       // skip null positions
-      if (nulls && bits::isBitNull(nulls, i)) {
+      if (bits::isBitNull(nulls, i)) {
         continue;
       }
-      uint64_t result = 0;
-      uint64_t bitsLeftToRead = fb;
-      while (bitsLeftToRead > bitsLeft_) {
-        result <<= bitsLeft_;
-        result |= curByte_ & ((1 << bitsLeft_) - 1);
-        bitsLeftToRead -= bitsLeft_;
-        curByte_ = readByte();
-        bitsLeft_ = 8;
-      }
-
-      // handle the left over bits
-      if (bitsLeftToRead > 0) {
-        result <<= bitsLeftToRead;
-        bitsLeft_ -= static_cast<uint32_t>(bitsLeftToRead);
-        result |= (curByte_ >> bitsLeft_) & ((1 << bitsLeftToRead) - 1);
-      }
-      data[i] = static_cast<int64_t>(result);
+      data[i] = readBits(fb);
       ++ret;
     }
 
     return ret;
   }
 
+  // Reads 'len' consecutive values. Whenever the bit reader is at a byte
+  // boundary, the values that are entirely inside the current buffer are
+  // unpacked in bulk and only the values straddling a buffer boundary go
+  // through readBits().
+  uint64_t readLongsNoNulls(int64_t* data, uint64_t len, uint64_t fb) {
+    auto& bufferStart = dwio::common::IntDecoder<isSigned>::bufferStart_;
+    uint64_t numRead = 0;
+    while (numRead < len) {
+      if (bitsLeft_ == 0 && fb > 0) {
+        const uint64_t available =
+            dwio::common::IntDecoder<isSigned>::bufferEnd_ - bufferStart;
+        const uint64_t numFit = std::min(len - numRead, available * 8 / fb);
+        if (numFit > 0) {
+          detail::unpackBigEndian(
+              bufferStart,
+              bufferStart + available,
+              numFit,
+              fb,
+              data + numRead);
+          const uint64_t numBits = numFit * fb;
+          bufferStart += numBits / 8;
+          if (numBits % 8 != 0) {
+            // Keep the partially consumed byte for the next value.
+            curByte_ = static_cast<unsigned char>(*bufferStart++);
+            bitsLeft_ = 8 - numBits % 8;
+          }
+          numRead += numFit;
+          continue;
+        }
+      }
+      data[numRead++] = readBits(fb);
+    }
+    return numRead;
+  }
+
+  int64_t readBits(uint64_t fb) {
+    uint64_t result = 0;
+    uint64_t bitsLeftToRead = fb;
+    while (bitsLeftToRead > bitsLeft_) {
+      result <<= bitsLeft_;
+      result |= curByte_ & ((1 << bitsLeft_) - 1);
+      bitsLeftToRead -= bitsLeft_;
+      curByte_ = readByte();
+      bitsLeft_ = 8;
+    }
+
+    // handle the left over bits
+    if (bitsLeftToRead > 0) {
+      result <<= bitsLeftToRead;
+      bitsLeft_ -= static_cast<uint32_t>(bitsLeftToRead);
+      result |= (curByte_ >> bitsLeft_) & ((1 << bitsLeftToRead) - 1);
+    }
+    return static_cast<int64_t>(result);
+  }
+
   uint64_t nextShortRepeats(
       int64_t* data,
       uint64_t offset,
@@ -95,6 +95,33 @@ std::unique_ptr<ColumnStatistics> buildColumnStatisticsFromProto(
         return std::make_unique<BinaryColumnStatistics>(
             colStats, static_cast<uint64_t>(binStats.sum()));
       }
+    } else if (stats.hasMapStatistics()) {
+      // Per-key statistics of a flat map.
+      folly::F14FastMap<
+          KeyInfo,
+          std::unique_ptr<ColumnStatistics>,
+          folly::transparent<KeyInfoHash>>
+          entryStatistics;
+      for (const auto& entry : stats.mapStatistics().stats()) {
+        const auto& key = entry.key();
+        if (!key.has_intkey() && !key.has_byteskey()) {
+          continue;
+        }
+        auto keyStats = buildColumnStatisticsFromProto(
+            ColumnStatisticsWrapper(&entry.stats()), statsContext);
+        if (key.has_intkey()) {
+          entryStatistics.emplace(KeyInfo(key.intkey()), std::move(keyStats));
+        } else {
+          entryStatistics.emplace(
+              KeyInfo(key.byteskey()), std::move(keyStats));
+        }
+      }
+      return std::make_unique<MapColumnStatistics>(
+          colStats.getNumberOfValues(),
+          colStats.hasNull(),
+          colStats.getRawSize(),
+          colStats.getSize(),
+          std::move(entryStatistics));
     }
   }
 
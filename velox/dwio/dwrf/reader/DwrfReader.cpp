@@ -35,6 +35,68 @@ using dwio::common::RowReaderOptions;
 using dwio::common::UnitLoader;
 using dwio::common::UnitLoaderFactory;
 
+namespace {
+
+// Defers the loads of the streams of the top level columns of 'scanSpec' that
+// neither have a filter nor are inputs of its expression filter. Does nothing
+// if the scan has no filter.
+void deferNonFilterStreams(
+    const common::ScanSpec& scanSpec,
+    const dwio::common::TypeWithId& fileType,
+    dwio::common::BufferedInput& input) {
+  auto* expressionFilter = scanSpec.expressionFilter();
+  folly::F14FastSet<std::string> filterInputs;
+  if (expressionFilter != nullptr) {
+    filterInputs.insert(
+        expressionFilter->inputs().begin(), expressionFilter->inputs().end());
+  }
+  bool hasFilter = expressionFilter != nullptr;
+  // Inclusive ranges of the node ids of the deferred columns.
+  std::vector<std::pair<uint32_t, uint32_t>> deferredNodes;
+  const auto& rowType = fileType.type()->asRow();
+  for (const auto* childSpec : scanSpec.stableChildren()) {
+    if (childSpec->isConstant() || !childSpec->readFromFile()) {
+      continue;
+    }
+    if (childSpec->hasFilter()) {
+      hasFilter = true;
+      continue;
+    }
+    if (filterInputs.contains(childSpec->fieldName())) {
+      continue;
+    }
+    const auto index = rowType.getChildIdxIfExists(childSpec->fieldName());
+    if (!index.has_value()) {
+      continue;
+    }
+    const auto& childType = fileType.childAt(*index);
+    deferredNodes.emplace_back(childType->id(), childType->maxId());
+  }
+  if (!hasFilter || deferredNodes.empty()) {
+    return;
+  }
+  input.setDeferredStreams(
+      [deferredNodes = std::move(deferredNodes)](
+          const dwio::common::StreamIdentifier& streamId) {
+        const auto& dwrfStreamId =
+            static_cast<const DwrfStreamIdentifier&>(streamId);
+        // The row indexes are read when the stripe is positioned, before any
+        // filter runs.
+        if (isIndexStream(dwrfStreamId.kind())) {
+          return false;
+        }
+        const auto node = dwrfStreamId.encodingKey().node();
+        for (const auto& [first, last] : deferredNodes) {
+          if (node >= first && node <= last) {
+            return true;
+          }
+        }
+        return false;
+      });
+}
+
+} // namespace
+
 class DwrfUnit : public LoadUnit {
  public:
   DwrfUnit(
@@ -71,6 +133,10 @@ class DwrfUnit : public LoadUnit {
   /// Number of bytes that the IO will read
   uint64_t getIoSize() override;
 
+  /// Fetches the stripe footer, and the whole stripe if stripes are
+  /// preloaded, for the next load()
+  uint64_t prefetch() override;
+
   std::unique_ptr<ColumnReader>& getColumnReader() {
     return columnReader_;
   }
@@ -98,6 +164,9 @@ class DwrfUnit : public LoadUnit {
   // Mutables
   bool preloaded_;
   std::optional<uint64_t> cachedIoSize_;
+  // Set by prefetch() and consumed by the next ensureDecoders().
+  std::unique_ptr<const StripeMetadata> prefetchedStripe_;
+  bool prefetchedPreload_{false};
   std::shared_ptr<StripeReadState> stripeReadState_;
   std::unique_ptr<StripeStreamsImpl> stripeStreams_;
   std::unique_ptr<ColumnReader> columnReader_;
@@ -133,16 +202,36 @@ uint64_t DwrfUnit::getIoSize() {
   return *cachedIoSize_;
 }
 
+uint64_t DwrfUnit::prefetch() {
+  if (columnReader_ || selectiveColumnReader_ || prefetchedStripe_) {
+    return 0;
+  }
+  prefetchedPreload_ = options_.preloadStripe();
+  prefetchedStripe_ =
+      stripeReaderBase_.fetchStripe(stripeIndex_, prefetchedPreload_);
+  if (prefetchedPreload_) {
+    return stripeInfo_.indexLength() + stripeInfo_.dataLength() +
+        stripeInfo_.footerLength();
+  }
+  return stripeInfo_.footerLength();
+}
+
 void DwrfUnit::ensureDecoders() {
   if (columnReader_ || selectiveColumnReader_) {
     return;
   }
 
-  preloaded_ = options_.preloadStripe();
+  std::unique_ptr<const StripeMetadata> stripeMetadata;
+  if (prefetchedStripe_) {
+    preloaded_ = prefetchedPreload_;
+    stripeMetadata = std::move(prefetchedStripe_);
+  } else {
+    preloaded_ = options_.preloadStripe();
+    stripeMetadata = stripeReaderBase_.fetchStripe(stripeIndex_, preloaded_);
+  }
 
   stripeReadState_ = std::make_shared<StripeReadState>(
-      stripeReaderBase_.readerBaseShared(),
-      stripeReaderBase_.fetchStripe(stripeIndex_, preloaded_));
+      stripeReaderBase_.readerBaseShared(), std::move(stripeMetadata));
 
   stripeStreams_ = std::make_unique<StripeStreamsImpl>(
       stripeReadState_,
@@ -162,6 +251,10 @@ void DwrfUnit::ensureDecoders() {
   StreamLabels streamLabels(pool);
 
   if (scanSpec) {
+    if (options_.deferNonFilterStreams() && !preloaded_) {
+      deferNonFilterStreams(
+          *scanSpec, *fileType, *stripeReadState_->stripeMetadata->stripeInput);
+    }
     selectiveColumnReader_ = SelectiveDwrfReader::build(
         columnReaderOptions_,
         options_.requestedType() ? options_.requestedType() : fileType->type(),
@@ -216,14 +216,19 @@ class ReaderBase {
   std::unique_ptr<dwio::common::SeekableInputStream> createDecompressedStream(
       std::unique_ptr<dwio::common::SeekableInputStream> compressed,
       const std::string& streamDebugInfo,
-      const dwio::common::encryption::Decrypter* decrypter = nullptr) const {
+      const dwio::common::encryption::Decrypter* decrypter = nullptr,
+      std::optional<dwio::common::DecompressedChunkCache> chunkCache =
+          std::nullopt) const {
     return createDecompressor(
         compressionKind(),
         std::move(compressed),
         compressionBlockSize(),
         options_.memoryPool(),
         streamDebugInfo,
-        decrypter);
+        decrypter,
+        std::move(chunkCache),
+        input_->getInputStream() ? input_->getInputStream()->getStats()
+                                 : nullptr);
   }
 
   template <typename T>
@@ -302,6 +302,11 @@ void SelectiveStringDictionaryColumnReader::getValues(
       scanState_.dictionary.numValues + scanState_.dictionary2.numValues;
   if (scanSpec_->makeFlat() || (!dictionaryValues_ && flatSize < dictSize)) {
     makeFlat(result);
+    // Only reuse ASCII-ness of an already materialized dictionary. Scanning
+    // the dictionary here could cost more than the flat result itself.
+    if (dictionaryValues_) {
+      propagateDictionaryIsAscii(dictionaryValues_, *result);
+    }
     return;
   }
   if (!dictionaryValues_) {
@@ -309,6 +314,7 @@ void SelectiveStringDictionaryColumnReader::getValues(
   }
   *result = std::make_shared<DictionaryVector<StringView>>(
       memoryPool_, resultNulls(), numValues_, dictionaryValues_, values_);
+  propagateDictionaryIsAscii(dictionaryValues_, *result);
 }
 
 void SelectiveStringDictionaryColumnReader::ensureInitialized() {
@@ -52,6 +52,7 @@ class SelectiveStringDirectColumnReader
     rawStringSize_ = 0;
     rawStringUsed_ = 0;
     getFlatValues<StringView, StringView>(rows, result, requestedType());
+    computeStringIsAscii(*result);
   }
 
  private:
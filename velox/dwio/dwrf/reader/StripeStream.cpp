@@ -332,9 +332,12 @@ std::unique_ptr<dwio::common::SeekableInputStream> StripeStreamsImpl::getStream(
     streamInput = getIndexStreamFromCache(info);
   }
 
+  std::optional<dwio::common::DecompressedChunkCache> chunkCache;
   if (!streamInput) {
-    streamInput = readState_->stripeMetadata->stripeInput->enqueue(
-        {info.getOffset() + stripeStart_, info.getLength(), label}, &si);
+    auto& stripeInput = *readState_->stripeMetadata->stripeInput;
+    const auto offset = info.getOffset() + stripeStart_;
+    streamInput = stripeInput.enqueue({offset, info.getLength(), label}, &si);
+    chunkCache = stripeInput.decompressedChunkCache(offset);
   }
 
   if (!streamInput) {
@@ -346,7 +349,8 @@ std::unique_ptr<dwio::common::SeekableInputStream> StripeStreamsImpl::getStream(
   return readState_->readerBase->createDecompressedStream(
       std::move(streamInput),
       streamDebugInfo,
-      getDecrypter(si.encodingKey().node()));
+      getDecrypter(si.encodingKey().node()),
+      std::move(chunkCache));
 }
 
 uint32_t StripeStreamsImpl::visitStreamsOfNode(
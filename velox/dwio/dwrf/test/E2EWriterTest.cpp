@@ -15,6 +15,7 @@
  */
 
 #include <folly/Random.h>
+#include <folly/executors/CPUThreadPoolExecutor.h>
 #include <random>
 #include "velox/common/base/SpillConfig.h"
 #include "velox/common/base/tests/GTestUtils.h"
@@ -376,6 +377,131 @@ TEST_F(E2EWriterTest, E2E) {
   dwrf::E2EWriterTestUtil::testWriter(*leafPool_, type, batches, 1, 1, config);
 }
 
+TEST_F(E2EWriterTest, parallelEncoding) {
+  HiveTypeParser parser;
+  auto type = parser.parse(
+      "struct<"
+      "bool_val:boolean,"
+      "long_val:bigint,"
+      "double_val:double,"
+      "string_val:string,"
+      "timestamp_val:timestamp,"
+      "array_val:array<float>,"
+      "map_val:map<int,string>,"
+      "struct_val:struct<a:float,b:string>"
+      ">");
+  std::vector<VectorPtr> batches;
+  for (auto i = 0; i < 10; ++i) {
+    batches.push_back(
+        BatchMaker::createBatch(type, 1'000, *leafPool_, nullptr, i));
+  }
+  auto executor = std::make_shared<folly::CPUThreadPoolExecutor>(4);
+
+  auto write = [&](bool parallel) {
+    auto config = std::make_shared<dwrf::Config>();
+    config->set<uint64_t>(dwrf::Config::STRIPE_SIZE, 64UL << 10);
+    config->set(
+        dwrf::Config::COMPRESSION,
+        common::CompressionKind::CompressionKind_ZSTD);
+    auto sink = std::make_unique<MemorySink>(
+        200 * 1024 * 1024,
+        dwio::common::FileSink::Options{.pool = leafPool_.get()});
+    auto* sinkPtr = sink.get();
+    dwrf::WriterOptions options;
+    options.config = config;
+    options.schema = type;
+    options.memoryPool = rootPool_.get();
+    if (parallel) {
+      options.encodingExecutor = executor;
+      options.encodingParallelismFactor = 4;
+    }
+    dwrf::Writer writer{std::move(sink), options};
+    for (const auto& batch : batches) {
+      writer.write(batch);
+    }
+    writer.close();
+    return std::string(sinkPtr->data(), sinkPtr->size());
+  };
+
+  // The columns are encoded independently, so the files are the same.
+  const auto serial = write(false);
+  const auto parallel = write(true);
+  ASSERT_EQ(serial, parallel);
+
+  dwio::common::ReaderOptions readerOpts{leafPool_.get()};
+  auto reader = std::make_unique<dwrf::DwrfReader>(
+      readerOpts,
+      std::make_unique<BufferedInput>(
+          std::make_shared<InMemoryReadFile>(parallel), *leafPool_));
+  auto rowReader = reader->createRowReader(RowReaderOptions{});
+  VectorPtr result;
+  auto batchIndex = 0;
+  vector_size_t batchRow = 0;
+  while (rowReader->next(1'000, result) > 0) {
+    for (auto i = 0; i < result->size(); ++i) {
+      ASSERT_TRUE(result->equalValueAt(batches[batchIndex].get(), i, batchRow));
+      if (++batchRow == batches[batchIndex]->size()) {
+        ++batchIndex;
+        batchRow = 0;
+      }
+    }
+  }
+  ASSERT_EQ(batchIndex, batches.size());
+}
+
+TEST_F(E2EWriterTest, earlyEncodingSelection) {
+  auto type = ROW({"unique", "repeated"}, {VARCHAR(), VARCHAR()});
+  VectorMaker maker{leafPool_.get()};
+  std::vector<VectorPtr> batches;
+  for (auto i = 0; i < 10; ++i) {
+    batches.push_back(maker.rowVector(
+        {maker.flatVector<std::string>(
+             1'000,
+             [&](auto row) {
+               return fmt::format("unique {}", i * 1'000 + row);
+             }),
+         maker.flatVector<std::string>(
+             1'000,
+             [](auto row) { return fmt::format("repeated {}", row % 10); })}));
+  }
+
+  auto config = std::make_shared<dwrf::Config>();
+  config->set<uint32_t>(dwrf::Config::DICTIONARY_EARLY_SELECTION_ROWS, 2'000);
+  auto sink = std::make_unique<MemorySink>(
+      200 * 1024 * 1024,
+      dwio::common::FileSink::Options{.pool = leafPool_.get()});
+  auto* sinkPtr = sink.get();
+  dwrf::WriterOptions options;
+  options.config = config;
+  options.schema = type;
+  options.memoryPool = rootPool_.get();
+  dwrf::Writer writer{std::move(sink), options};
+  for (const auto& batch : batches) {
+    writer.write(batch);
+  }
+  writer.close();
+
+  // The unique column switches to direct encoding after the first 2'000 rows
+  // and the repeated column keeps its dictionary.
+  dwio::common::ReaderOptions readerOpts{leafPool_.get()};
+  auto reader = createReader(*sinkPtr, readerOpts);
+  auto rowReader = reader->createRowReader(RowReaderOptions{});
+  auto* dwrfRowReader = dynamic_cast<dwrf::DwrfRowReader*>(rowReader.get());
+  for (int32_t i = 0; i < reader->getNumberOfStripes(); ++i) {
+    auto stripeMetadata = dwrfRowReader->fetchStripe(i, /*preload=*/true);
+    auto& footer = *stripeMetadata->footer;
+    for (int32_t j = 0; j < footer.columnEncodingSize(); ++j) {
+      const auto& encoding = footer.columnEncodingDwrf(j);
+      if (encoding.node() == 1) {
+        EXPECT_EQ(encoding.kind(), dwrf::proto::ColumnEncoding_Kind_DIRECT);
+      } else if (encoding.node() == 2) {
+        EXPECT_EQ(
+            encoding.kind(), dwrf::proto::ColumnEncoding_Kind_DICTIONARY);
+      }
+    }
+  }
+}
+
 // Disabled because test is failing in continuous runs T193531984.
 TEST_F(E2EWriterTest, DISABLED_DisableLinearHeuristics) {
   const size_t batchCount = 100;
@@ -2579,6 +2579,156 @@ TEST_F(TestReader, readStringDictionaryAsFlat) {
   ASSERT_EQ(stats.columnReaderStatistics.flattenStringDictionaryValues, 1);
 }
 
+namespace {
+// Wraps a BytesValues filter and counts the values it tests. The kind is one
+// the string readers do not specialize for, so they call it through the
+// virtual Filter interface.
+class CountingBytesFilter : public common::Filter {
+ public:
+  CountingBytesFilter(
+      std::shared_ptr<const common::BytesValues> filter,
+      std::shared_ptr<int32_t> numTested)
+      : Filter(true, false, common::FilterKind::kMultiRange),
+        filter_(std::move(filter)),
+        numTested_(std::move(numTested)) {}
+
+  std::unique_ptr<Filter> clone(
+      std::optional<bool> /*nullAllowed*/ = std::nullopt) const override {
+    return std::make_unique<CountingBytesFilter>(filter_, numTested_);
+  }
+
+  folly::dynamic serialize() const override {
+    return filter_->serialize();
+  }
+
+  bool testingEquals(const Filter& other) const override {
+    return this == &other;
+  }
+
+  bool testBytes(const char* value, int32_t length) const override {
+    ++*numTested_;
+    return filter_->testBytes(value, length);
+  }
+
+  bool testBytesRange(
+      std::optional<std::string_view> min,
+      std::optional<std::string_view> max,
+      bool hasNull) const override {
+    return filter_->testBytesRange(min, max, hasNull);
+  }
+
+ private:
+  const std::shared_ptr<const common::BytesValues> filter_;
+  const std::shared_ptr<int32_t> numTested_;
+};
+} // namespace
+
+TEST_F(TestReader, stringDictionaryFilterAcrossBatches) {
+  std::vector<std::string> dictionary;
+  for (int i = 0; i < 26; ++i) {
+    dictionary.emplace_back(20 + i, 'a' + i);
+  }
+  constexpr int kSize = 1'000;
+  auto indices = allocateIndices(kSize, pool());
+  auto* rawIndices = indices->asMutable<vector_size_t>();
+  for (int i = 0; i < kSize; ++i) {
+    rawIndices[i] = (i * 7) % dictionary.size();
+  }
+  auto batch = makeRowVector({
+      BaseVector::wrapInDictionary(
+          nullptr, indices, kSize, makeFlatVector(dictionary)),
+  });
+  auto [writer, reader] = createWriterReader(
+      {batch},
+      pool(),
+      std::make_shared<dwrf::Config>(),
+      E2EWriterTestUtil::simpleFlushPolicyFactory(false));
+  auto rowType = reader->rowType();
+  auto spec = std::make_shared<common::ScanSpec>("<root>");
+  spec->addAllChildFields(*rowType);
+  auto numTested = std::make_shared<int32_t>(0);
+  spec->childByName("c0")->setFilter(std::make_unique<CountingBytesFilter>(
+      std::make_shared<common::BytesValues>(
+          std::vector<std::string>{dictionary[1], dictionary[25]}, false),
+      numTested));
+  RowReaderOptions rowReaderOpts;
+  rowReaderOpts.setScanSpec(spec);
+  auto rowReader = reader->createRowReader(rowReaderOpts);
+
+  // The filter results of the dictionary entries are cached by the first
+  // batch and reused by the later ones, so each entry is tested at most once
+  // although the rows are read in 10 batches.
+  std::vector<std::string> expected;
+  for (int i = 0; i < kSize; ++i) {
+    if (rawIndices[i] == 1 || rawIndices[i] == 25) {
+      expected.push_back(dictionary[rawIndices[i]]);
+    }
+  }
+  std::vector<std::string> actual;
+  auto result = BaseVector::create(rowType, 0, pool());
+  while (rowReader->next(100, result) > 0) {
+    DecodedVector decoded(*result->as<RowVector>()->childAt(0));
+    for (vector_size_t i = 0; i < result->size(); ++i) {
+      actual.push_back(decoded.valueAt<StringView>(i).str());
+    }
+  }
+  ASSERT_EQ(actual, expected);
+  ASSERT_GT(*numTested, 0);
+  ASSERT_LE(*numTested, dictionary.size());
+}
+
+TEST_F(TestReader, stringAsciiness) {
+  std::vector<std::string> dictionary;
+  for (int i = 0; i < 26; ++i) {
+    dictionary.emplace_back(20 + i, 'a' + i);
+  }
+  constexpr int kSize = 200;
+  auto indices = allocateIndices(kSize, pool());
+  auto* rawIndices = indices->asMutable<vector_size_t>();
+  for (int i = 0; i < kSize; ++i) {
+    rawIndices[i] = i % dictionary.size();
+  }
+  auto batch = makeRowVector({
+      BaseVector::wrapInDictionary(
+          nullptr, indices, kSize, makeFlatVector(dictionary)),
+      makeFlatVector<std::string>(
+          kSize,
+          [](auto i) {
+            return i == 7 ? std::string("\u00e9t\u00e9")
+                          : fmt::format("value {}", i);
+          }),
+  });
+  auto [writer, reader] = createWriterReader(
+      {batch},
+      pool(),
+      std::make_shared<dwrf::Config>(),
+      E2EWriterTestUtil::simpleFlushPolicyFactory(false));
+  auto rowType = reader->rowType();
+  auto spec = std::make_shared<common::ScanSpec>("<root>");
+  spec->addAllChildFields(*rowType);
+  RowReaderOptions rowReaderOpts;
+  rowReaderOpts.setScanSpec(spec);
+  auto rowReader = reader->createRowReader(rowReaderOpts);
+  auto actual = BaseVector::create(rowType, 0, pool());
+  ASSERT_EQ(rowReader->next(kSize, actual), kSize);
+
+  // Readers record ASCII-ness on the vector that holds the strings, i.e. the
+  // dictionary for dictionary encoded results.
+  auto isAscii = [](BaseVector* vector) {
+    auto* strings = vector->encoding() == VectorEncoding::Simple::DICTIONARY
+        ? vector->valueVector().get()
+        : vector;
+    return strings->as<SimpleVector<StringView>>()->isAscii(
+        SelectivityVector(strings->size()));
+  };
+  auto* c0 = actual->as<RowVector>()->childAt(0)->loadedVector();
+  ASSERT_EQ(c0->encoding(), VectorEncoding::Simple::DICTIONARY);
+  ASSERT_EQ(isAscii(c0), true);
+  ASSERT_EQ(c0->as<SimpleVector<StringView>>()->isAscii(0), true);
+  auto* c1 = actual->as<RowVector>()->childAt(1)->loadedVector();
+  ASSERT_EQ(isAscii(c1), false);
+}
+
 // A primitive subfield is missing in file, and result is not reused.
 TEST_F(TestReader, missingSubfieldsNoResultReusing) {
   constexpr int kSize = 10;
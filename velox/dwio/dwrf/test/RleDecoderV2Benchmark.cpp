@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+
+#include "velox/common/base/BitUtil.h"
+#include "velox/common/memory/Memory.h"
+#include "velox/dwio/common/SeekableInputStream.h"
+#include "velox/dwio/dwrf/common/DecoderUtil.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::dwrf;
+
+namespace {
+
+constexpr uint64_t kRunLength = 512;
+constexpr uint64_t kNumRuns = 2'000;
+constexpr uint64_t kBatchSize = 1'024;
+
+uint32_t widthCode(uint32_t bitWidth) {
+  switch (bitWidth) {
+    case 32:
+      return 27;
+    case 64:
+      return 31;
+    default:
+      VELOX_CHECK_LE(bitWidth, 24);
+      return bitWidth - 1;
+  }
+}
+
+void appendPacked(
+    const std::vector<uint64_t>& values,
+    uint32_t bitWidth,
+    std::string& out) {
+  const auto start = out.size();
+  out.resize(start + bits::nbytes(values.size() * bitWidth));
+  for (size_t i = 0; i < values.size(); ++i) {
+    for (uint32_t bit = 0; bit < bitWidth; ++bit) {
+      if ((values[i] >> (bitWidth - 1 - bit)) & 1) {
+        const auto position = i * bitWidth + bit;
+        out[start + position / 8] |= 0x80 >> (position % 8);
+      }
+    }
+  }
+}
+
+void appendVarint(uint64_t value, std::string& out) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<char>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<char>(value));
+}
+
+void appendHeader(uint32_t type, uint32_t bitWidth, std::string& out) {
+  const auto length = kRunLength - 1;
+  out.push_back(static_cast<char>(
+      (type << 6) | (widthCode(bitWidth) << 1) | (length >> 8)));
+  out.push_back(static_cast<char>(length & 0xff));
+}
+
+// DIRECT runs of pseudo random values that use all of 'bitWidth'.
+std::string makeDirect(uint32_t bitWidth) {
+  const uint64_t mask =
+      bitWidth == 64 ? ~0ULL : (static_cast<uint64_t>(1) << bitWidth) - 1;
+  std::string out;
+  std::vector<uint64_t> values(kRunLength);
+  for (uint64_t run = 0; run < kNumRuns; ++run) {
+    for (uint64_t i = 0; i < kRunLength; ++i) {
+      values[i] = ((run * kRunLength + i) * 0x9E3779B97F4A7C15ULL) & mask;
+    }
+    appendHeader(1, bitWidth, out);
+    appendPacked(values, bitWidth, out);
+  }
+  return out;
+}
+
+// DELTA runs of increasing values with 'bitWidth' bit deltas.
+std::string makeDelta(uint32_t bitWidth) {
+  std::string out;
+  std::vector<uint64_t> deltas(kRunLength - 2);
+  for (uint64_t run = 0; run < kNumRuns; ++run) {
+    for (uint64_t i = 0; i < deltas.size(); ++i) {
+      deltas[i] = (i * 7) & ((1 << bitWidth) - 1);
+    }
+    appendHeader(3, bitWidth, out);
+    // Zigzag encoded first value and delta base.
+    appendVarint(2 * run, out);
+    appendVarint(2, out);
+    appendPacked(deltas, bitWidth, out);
+  }
+  return out;
+}
+
+void decode(const std::string& encoded) {
+  folly::BenchmarkSuspender suspender;
+  auto pool = memory::memoryManager()->addLeafPool();
+  auto decoder = createRleDecoder<true>(
+      std::make_unique<dwio::common::SeekableArrayInputStream>(
+          encoded.data(), encoded.size()),
+      RleVersion_2,
+      *pool,
+      true,
+      dwio::common::INT_BYTE_SIZE);
+  std::vector<int64_t> data(kBatchSize);
+  suspender.dismiss();
+
+  for (uint64_t i = 0; i < kRunLength * kNumRuns; i += kBatchSize) {
+    decoder->next(data.data(), kBatchSize, nullptr);
+  }
+  folly::doNotOptimizeAway(data);
+}
+
+} // namespace
+
+#define DIRECT_BENCHMARK(width)                    \
+  BENCHMARK(direct##width) {                       \
+    static const auto encoded = makeDirect(width); \
+    decode(encoded);                               \
+  }
+
+#define DELTA_BENCHMARK(width)                    \
+  BENCHMARK(delta##width) {                       \
+    static const auto encoded = makeDelta(width); \
+    decode(encoded);                              \
+  }
+
+DIRECT_BENCHMARK(1)
+DIRECT_BENCHMARK(3)
+DIRECT_BENCHMARK(8)
+DIRECT_BENCHMARK(13)
+DIRECT_BENCHMARK(16)
+DIRECT_BENCHMARK(21)
+DIRECT_BENCHMARK(32)
+DIRECT_BENCHMARK(64)
+
+BENCHMARK_DRAW_LINE();
+
+DELTA_BENCHMARK(2)
+DELTA_BENCHMARK(5)
+DELTA_BENCHMARK(12)
+
+int32_t main(int32_t argc, char* argv[]) {
+  folly::Init init{&argc, &argv};
+  memory::MemoryManager::initialize(memory::MemoryManager::Options{});
+  folly::runBenchmarks();
+  return 0;
+}
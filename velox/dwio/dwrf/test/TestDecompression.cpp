@@ -21,13 +21,18 @@
 #include <gtest/gtest.h>
 #include "velox/common/base/BitUtil.h"
 #include "velox/common/base/tests/GTestUtils.h"
+#include "velox/common/caching/AsyncDataCache.h"
 #include "velox/dwio/common/InputStream.h"
 #include "velox/dwio/common/compression/Compression.h"
+#include "velox/dwio/common/compression/QatDecompressor.h"
+#include "velox/dwio/common/encryption/TestProvider.h"
 #include "velox/dwio/dwrf/test/OrcTest.h"
 
 #include <cstdio>
 #include <cstring>
 
+DECLARE_bool(velox_qat_decompression);
+
 using namespace facebook::velox::common;
 using namespace facebook::velox::dwio::common;
 using namespace facebook::velox::dwrf;
@@ -950,6 +955,154 @@ TEST_F(TestSeek, Snappy) {
   runTest(*codec, CompressionKind_SNAPPY);
 }
 
+TEST_F(TestSeek, decompressedChunkCache) {
+  constexpr size_t kInputSize = 1024;
+  constexpr size_t kOutputSize = 4096;
+  constexpr size_t kSkip = 10;
+  char output[kOutputSize];
+  char input1[kInputSize];
+  char input2[kInputSize];
+  size_t offset1;
+  size_t offset2;
+  auto codec = getCodec(CodecType::ZSTD);
+  prepareTestData(*codec, input1, input2, kInputSize, output, offset1, offset2);
+
+  auto dataCache =
+      cache::AsyncDataCache::create(memory::memoryManager()->allocator());
+  auto ioStats = std::make_shared<IoStatistics>();
+  const DecompressedChunkCache chunkCache{
+      dataCache.get(), /*fileNum=*/1, /*streamOffset=*/1'000, ioStats.get()};
+
+  // The first stream decompresses both chunks and the second finds them in
+  // the cache, also after seeking into the second chunk.
+  for (auto i = 0; i < 2; ++i) {
+    auto stream = createDecompressor(
+        CompressionKind_ZSTD,
+        std::make_unique<SeekableArrayInputStream>(output, offset2),
+        kOutputSize,
+        *pool_,
+        "TestSeek Decompressor",
+        nullptr,
+        chunkCache);
+    const void* data;
+    int32_t size;
+    ASSERT_TRUE(stream->Next(&data, &size));
+    ASSERT_EQ(size, kInputSize);
+    EXPECT_EQ(0, memcmp(data, input1, kInputSize));
+
+    std::vector<uint64_t> positions{offset1, kSkip};
+    PositionProvider provider(positions);
+    stream->seekToPosition(provider);
+    ASSERT_TRUE(stream->Next(&data, &size));
+    ASSERT_EQ(size, kInputSize - kSkip);
+    EXPECT_EQ(0, memcmp(data, input2 + kSkip, size));
+    EXPECT_EQ(ioStats->decompressedCacheHit().count(), 2 * i);
+  }
+  EXPECT_EQ(ioStats->decompressedCacheHit().sum(), 2 * kInputSize);
+  dataCache->shutdown();
+}
+
+TEST_F(TestSeek, qatDecompression) {
+  gflags::FlagSaver flagSaver;
+  FLAGS_velox_qat_decompression = true;
+  constexpr size_t kInputSize = 1024;
+  constexpr size_t kOutputSize = 4096;
+  char output[kOutputSize];
+  char input1[kInputSize];
+  char input2[kInputSize];
+  size_t offset1;
+  size_t offset2;
+  auto codec = zlib::getCodec(
+      zlib::Options(zlib::Options::Format::RAW), COMPRESSION_LEVEL_DEFAULT);
+  prepareTestData(*codec, input1, input2, kInputSize, output, offset1, offset2);
+
+  // Without a QAT device the chunks are decompressed in software, either way
+  // the content is the same.
+  auto ioStats = std::make_shared<IoStatistics>();
+  auto stream = createDecompressor(
+      CompressionKind_ZLIB,
+      std::make_unique<SeekableArrayInputStream>(output, offset2),
+      kOutputSize,
+      *pool_,
+      "TestSeek Decompressor",
+      nullptr,
+      std::nullopt,
+      ioStats.get());
+  const void* data;
+  int32_t size;
+  ASSERT_TRUE(stream->Next(&data, &size));
+  ASSERT_EQ(size, kInputSize);
+  EXPECT_EQ(0, memcmp(data, input1, kInputSize));
+  ASSERT_TRUE(stream->Next(&data, &size));
+  ASSERT_EQ(size, kInputSize);
+  EXPECT_EQ(0, memcmp(data, input2, kInputSize));
+
+  const auto numChunks = ioStats->offloadedDecompress().count() +
+      ioStats->offloadFallbackDecompress().count();
+  if (dwio::common::compression::qatDecompressionEnabled(
+          CompressionKind_ZLIB)) {
+    EXPECT_EQ(numChunks, 2);
+  } else {
+    EXPECT_EQ(numChunks, 0);
+  }
+}
+
+TEST_F(TestSeek, decryptedChunkCache) {
+  constexpr size_t kInputSize = 1024;
+  constexpr size_t kOutputSize = 8192;
+  constexpr size_t kHeaderSize = 3;
+  char compressed[kOutputSize];
+  char input[kInputSize];
+  fillInput(input, kInputSize);
+  auto codec = getCodec(CodecType::ZSTD);
+  const auto compressedSize =
+      compress(input, kInputSize, compressed, 0, *codec) - kHeaderSize;
+
+  // Encrypts the chunk payload behind a plaintext header like the writer.
+  encryption::test::TestEncrypter encrypter;
+  encrypter.setKey("key");
+  auto encrypted = encrypter.encrypt(
+      folly::StringPiece(compressed + kHeaderSize, compressedSize));
+  std::vector<char> output(kHeaderSize + encrypted->computeChainDataLength());
+  writeHeader(output.data(), output.size() - kHeaderSize, false);
+  encrypted->coalesce();
+  memcpy(output.data() + kHeaderSize, encrypted->data(), encrypted->length());
+
+  encryption::test::TestDecrypter decrypter;
+  decrypter.setKey("key");
+  auto dataCache =
+      cache::AsyncDataCache::create(memory::memoryManager()->allocator());
+  auto ioStats = std::make_shared<IoStatistics>();
+  const DecompressedChunkCache chunkCache{
+      dataCache.get(),
+      /*fileNum=*/1,
+      /*streamOffset=*/1'000,
+      ioStats.get(),
+      /*includeEncrypted=*/true};
+
+  // The second stream finds the plaintext in the cache and neither decrypts
+  // nor decompresses.
+  for (auto i = 0; i < 2; ++i) {
+    auto stream = createDecompressor(
+        CompressionKind_ZSTD,
+        std::make_unique<SeekableArrayInputStream>(
+            output.data(), output.size()),
+        kOutputSize,
+        *pool_,
+        "TestSeek Decompressor",
+        &decrypter,
+        chunkCache);
+    const void* data;
+    int32_t size;
+    ASSERT_TRUE(stream->Next(&data, &size));
+    ASSERT_EQ(size, kInputSize);
+    EXPECT_EQ(0, memcmp(data, input, kInputSize));
+    EXPECT_EQ(decrypter.getCount(), 1);
+    EXPECT_EQ(ioStats->decompressedCacheHit().count(), i);
+  }
+  dataCache->shutdown();
+}
+
 TEST_F(TestSeek, uncompressed) {
   constexpr int32_t kSize = 1000;
   constexpr int32_t kHeaderSize = 3;
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "velox/dwio/common/ScanSpec.h"
 #include "velox/dwio/dwrf/test/ColumnStatisticsBase.h"
 #include "velox/type/fbhive/HiveTypeParser.h"
 
@@ -498,3 +499,45 @@ TEST(MapStatisticsBuilderTest, mergeKeyStats) {
   EXPECT_TRUE(keyStats.getSize().has_value());
   EXPECT_EQ(42, keyStats.getSize().value());
 }
+
+TEST(MapStatisticsBuilderTest, keyStatsFromProto) {
+  auto type = HiveTypeParser{}.parse("map<bigint, bigint>");
+  MapStatisticsBuilder mapStatsBuilder{*type, options};
+  mapStatsBuilder.increaseValueCount(10);
+  IntegerStatisticsBuilder keyStats{options};
+  keyStats.addValues(int64_t{1});
+  keyStats.addValues(int64_t{5});
+  mapStatsBuilder.addValues(createKeyInfo(1), keyStats);
+
+  proto::ColumnStatistics proto;
+  mapStatsBuilder.toProto(proto);
+  auto stats = buildColumnStatisticsFromProto(
+      ColumnStatisticsWrapper(&proto), StatsContext{WriterVersion_CURRENT});
+  auto* mapStats = dynamic_cast<MapColumnStatistics*>(stats.get());
+  ASSERT_NE(mapStats, nullptr);
+  EXPECT_EQ(mapStats->getNumberOfValues(), 10);
+  ASSERT_EQ(mapStats->getEntryStatistics().size(), 1);
+  auto* intStats = dynamic_cast<IntegerColumnStatistics*>(
+      mapStats->getEntryStatistics().at(KeyInfo{1}).get());
+  ASSERT_NE(intStats, nullptr);
+  EXPECT_EQ(intStats->getNumberOfValues(), 2);
+  EXPECT_EQ(intStats->getMinimum(), 1);
+  EXPECT_EQ(intStats->getMaximum(), 5);
+
+  auto testKeyFilter = [&](const std::string& key,
+                           std::shared_ptr<facebook::velox::common::Filter>
+                               filter) {
+    facebook::velox::common::ScanSpec spec("m");
+    spec.setFlatMapAsStruct(true);
+    spec.getOrCreateChild(key)->setFilter(std::move(filter));
+    return facebook::velox::common::testFlatMapKeyFilters(
+        spec, *mapStats, 10, type);
+  };
+  using facebook::velox::common::BigintRange;
+  using facebook::velox::common::IsNotNull;
+  EXPECT_TRUE(testKeyFilter("1", std::make_shared<BigintRange>(5, 7, false)));
+  EXPECT_FALSE(
+      testKeyFilter("1", std::make_shared<BigintRange>(10, 20, false)));
+  // Key 2 is in no row of the file.
+  EXPECT_FALSE(testKeyFilter("2", std::make_shared<IsNotNull>()));
+}
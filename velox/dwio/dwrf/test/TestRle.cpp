@@ -673,6 +673,80 @@ TEST_F(RLEv2Test, bitsLeftByPreviousStream) {
   }
 };
 
+namespace {
+
+// Encodes 'values' as a single DIRECT run of 'bitWidth' bits per value. The
+// values are taken as already zigzag encoded.
+std::vector<unsigned char> encodeDirect(
+    const std::vector<uint64_t>& values,
+    uint32_t bitWidth) {
+  VELOX_CHECK(!values.empty() && values.size() <= 512);
+  uint32_t widthCode = bitWidth - 1;
+  if (bitWidth > 24) {
+    static const std::vector<uint32_t> kWideWidths = {
+        26, 28, 30, 32, 40, 48, 56, 64};
+    auto it = std::find(kWideWidths.begin(), kWideWidths.end(), bitWidth);
+    VELOX_CHECK(it != kWideWidths.end());
+    widthCode = 24 + (it - kWideWidths.begin());
+  }
+  const auto runLength = values.size() - 1;
+  std::vector<unsigned char> bytes = {
+      static_cast<unsigned char>(0x40 | (widthCode << 1) | (runLength >> 8)),
+      static_cast<unsigned char>(runLength & 0xff)};
+  const auto headerBytes = bytes.size();
+  bytes.resize(headerBytes + bits::nbytes(values.size() * bitWidth));
+  for (size_t i = 0; i < values.size(); ++i) {
+    for (uint32_t bit = 0; bit < bitWidth; ++bit) {
+      if ((values[i] >> (bitWidth - 1 - bit)) & 1) {
+        const auto position = i * bitWidth + bit;
+        bytes[headerBytes + position / 8] |= 0x80 >> (position % 8);
+      }
+    }
+  }
+  return bytes;
+}
+
+} // namespace
+
+TEST_F(RLEv2Test, directAllWidthsAcrossBuffers) {
+  auto pool = memory::memoryManager()->addLeafPool();
+  for (uint32_t bitWidth :
+       {1, 2, 3, 4, 5, 7, 8, 9, 13, 16, 17, 23, 24, 26, 28, 30, 32, 40, 48, 56,
+        64}) {
+    SCOPED_TRACE(fmt::format("bitWidth {}", bitWidth));
+    const uint64_t mask =
+        bitWidth == 64 ? ~0ULL : (static_cast<uint64_t>(1) << bitWidth) - 1;
+    std::vector<uint64_t> encoded(500);
+    std::vector<int64_t> expected(encoded.size());
+    for (size_t i = 0; i < encoded.size(); ++i) {
+      encoded[i] = (i * 0x9E3779B97F4A7C15ULL) & mask;
+      expected[i] = ZigZag::decode<uint64_t>(encoded[i]);
+    }
+    const auto bytes = encodeDirect(encoded, bitWidth);
+    // Small blocks make values straddle buffer boundaries; uneven batch
+    // sizes leave the bit reader mid-byte between calls.
+    for (uint64_t blockSize : {0, 1, 7, 64}) {
+      for (uint64_t batchSize : {1, 11, 500}) {
+        auto rle = createRleDecoder<true>(
+            std::make_unique<dwio::common::SeekableArrayInputStream>(
+                bytes.data(), bytes.size(), blockSize),
+            RleVersion_2,
+            *pool,
+            true /* doesn't matter */,
+            dwio::common::INT_BYTE_SIZE /* doesn't matter */);
+        std::vector<int64_t> data(encoded.size());
+        for (size_t i = 0; i < data.size(); i += batchSize) {
+          rle->next(
+              data.data() + i,
+              std::min<uint64_t>(batchSize, data.size() - i),
+              nullptr);
+        }
+        checkResults(expected, data, batchSize);
+      }
+    }
+  }
+}
+
 class RLEv1Test : public testing::Test {
  protected:
   static void SetUpTestCase() {
@@ -15,8 +15,10 @@
  */
 
 #include "velox/dwio/dwrf/writer/ColumnWriter.h"
+
 #include <velox/dwio/common/exception/Exception.h>
 #include "velox/dwio/common/ChainedBuffer.h"
+#include "velox/dwio/common/ParallelFor.h"
 #include "velox/dwio/dwrf/common/EncoderUtil.h"
 #include "velox/dwio/dwrf/writer/DictionaryEncodingUtils.h"
 #include "velox/dwio/dwrf/writer/EntropyEncodingSelector.h"
@@ -35,7 +37,15 @@ namespace facebook::velox::dwrf {
 WriterContext::LocalDecodedVector BaseColumnWriter::decode(
     const VectorPtr& slice,
     const common::Ranges& ranges) {
-  auto& selected = context_.getSharedSelectivityVector(slice->size());
+  // Columns written in parallel on the encoding executor can not share the
+  // selectivity vector of the context.
+  std::optional<SelectivityVector> localSelected;
+  if (context_.encodingExecutor() != nullptr) {
+    localSelected.emplace(slice->size());
+  }
+  auto& selected = localSelected.has_value()
+      ? *localSelected
+      : context_.getSharedSelectivityVector(slice->size());
   // initialize
   selected.clearAll();
   for (auto& range : ranges.getRanges()) {
@@ -1747,8 +1757,25 @@ uint64_t StructColumnWriter::writeChildrenAndStats(
     uint64_t nullCount) {
   uint64_t rawSize = 0;
   if (ranges.size() > 0) {
-    for (size_t i = 0; i < children_.size(); ++i) {
-      rawSize += children_.at(i)->write(rowSlice->childAt(i), ranges);
+    if (isRoot() && context_.encodingExecutor() != nullptr) {
+      // The top level columns are independent, so they are encoded and
+      // compressed in parallel.
+      std::vector<uint64_t> rawSizes(children_.size());
+      dwio::common::ParallelFor(
+          context_.encodingExecutor(),
+          0,
+          children_.size(),
+          context_.encodingParallelismFactor())
+          .execute([&](size_t i) {
+            rawSizes[i] = children_[i]->write(rowSlice->childAt(i), ranges);
+          });
+      for (auto size : rawSizes) {
+        rawSize += size;
+      }
+    } else {
+      for (size_t i = 0; i < children_.size(); ++i) {
+        rawSize += children_.at(i)->write(rowSlice->childAt(i), ranges);
+      }
     }
   }
   if (nullCount) {
@@ -183,6 +183,14 @@ Writer::Writer(
       "Unexpected memory usage on dwrf writer construction");
   setMemoryReclaimers(pool);
   writerBase_->initBuffers();
+  // Flat map columns share dictionaries and add streams while writing, so they
+  // are not written in parallel.
+  if (options.encodingExecutor != nullptr &&
+      options.encodingParallelismFactor > 1 &&
+      !context.getConfig(Config::FLATTEN_MAP)) {
+    context.setEncodingExecutor(
+        options.encodingExecutor, options.encodingParallelismFactor);
+  }
 
   context.buildPhysicalSizeAggregators(*schema_);
   if (options.flushPolicyFactory == nullptr) {
@@ -309,7 +317,23 @@ void Writer::write(const VectorPtr& input) {
         context.indexRowCount() >= context.indexStride()) {
       createRowIndexEntry();
     }
+    tryEarlyEncodingSelection();
+  }
+}
+
+void Writer::tryEarlyEncodingSelection() {
+  auto& context = getContext();
+  if (earlyEncodingSelectionDone_ || context.stripeIndex() > 0) {
+    return;
+  }
+  const auto earlySelectionRows =
+      context.getConfig(Config::DICTIONARY_EARLY_SELECTION_ROWS);
+  if (earlySelectionRows == 0 ||
+      context.stripeRowCount() < earlySelectionRows) {
+    return;
   }
+  earlyEncodingSelectionDone_ = true;
+  writer_->tryAbandonDictionaries(/*force=*/false);
 }
 
 bool Writer::canReclaim() const {
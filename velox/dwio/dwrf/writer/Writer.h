@@ -45,6 +45,12 @@ struct WriterOptions : public dwio::common::WriterOptions {
   const tz::TimeZone* sessionTimezone{nullptr};
   bool adjustTimestampToTimezone{false};
   DwrfFormat format{DwrfFormat::kDwrf};
+  /// Optional executor on which the top level columns of each write batch are
+  /// encoded and compressed in parallel. Used only if
+  /// 'encodingParallelismFactor' is greater than 1 and no column is written
+  /// as a flat map.
+  std::shared_ptr<folly::Executor> encodingExecutor;
+  size_t encodingParallelismFactor{0};
 
   void processConfigs(
       const config::ConfigBase& connectorConfig,
@@ -204,6 +210,10 @@ class Writer : public dwio::common::Writer {
 
   void flushStripe(bool close);
 
+  // Abandons the inefficient dictionaries once the first stripe has
+  // Config::DICTIONARY_EARLY_SELECTION_ROWS rows.
+  void tryEarlyEncodingSelection();
+
   void createRowIndexEntry() {
     writer_->createIndexEntry();
     writerBase_->getContext().resetIndexRowCount();
@@ -218,6 +228,7 @@ class Writer : public dwio::common::Writer {
   std::unique_ptr<DWRFFlushPolicy> flushPolicy_;
   std::unique_ptr<LayoutPlanner> layoutPlanner_;
   std::unique_ptr<ColumnWriter> writer_;
+  bool earlyEncodingSelectionDone_{false};
 };
 
 class DwrfWriterFactory : public dwio::common::WriterFactory {
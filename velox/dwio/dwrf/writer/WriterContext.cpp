@@ -102,6 +102,32 @@ void WriterContext::initBuffer() {
   }
 }
 
+std::unique_ptr<dwio::common::DataBuffer<char>> WriterContext::getBuffer(
+    uint64_t size) {
+  std::lock_guard<std::mutex> l(mutex_);
+  if (compressionBuffer_ == nullptr && encodingExecutor_ != nullptr &&
+      compression_ != common::CompressionKind_NONE) {
+    VELOX_CHECK_GE(compressionBlockSize_ + PAGE_HEADER_SIZE, size);
+    return std::make_unique<dwio::common::DataBuffer<char>>(
+        *generalPool_, compressionBlockSize_ + PAGE_HEADER_SIZE);
+  }
+  VELOX_CHECK_NOT_NULL(compressionBuffer_);
+  VELOX_CHECK_GE(compressionBuffer_->size(), size);
+  return std::move(compressionBuffer_);
+}
+
+void WriterContext::returnBuffer(
+    std::unique_ptr<dwio::common::DataBuffer<char>> buffer) {
+  VELOX_CHECK_NOT_NULL(buffer);
+  std::lock_guard<std::mutex> l(mutex_);
+  if (compressionBuffer_ != nullptr) {
+    // An extra buffer made for a concurrently written column is freed.
+    VELOX_CHECK_NOT_NULL(encodingExecutor_);
+    return;
+  }
+  compressionBuffer_ = std::move(buffer);
+}
+
 memory::MemoryPool& WriterContext::getMemoryPool(
     const MemoryUsageCategory& category) {
   switch (category) {
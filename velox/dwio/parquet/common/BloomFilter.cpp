@@ -103,6 +103,21 @@ static void validateBloomFilterHeader(const thrift::BloomFilterHeader& header) {
   }
 }
 
+uint32_t BlockSplitBloomFilter::readHeader(
+    const char* data,
+    uint64_t size,
+    uint32_t& numBytes) {
+  std::shared_ptr<thrift::ThriftTransport> transport =
+      std::make_shared<thrift::ThriftBufferedTransport>(data, size);
+  apache::thrift::protocol::TCompactProtocolT<thrift::ThriftTransport> protocol(
+      transport);
+  thrift::BloomFilterHeader header;
+  const uint32_t headerSize = header.read(&protocol);
+  validateBloomFilterHeader(header);
+  numBytes = header.numBytes;
+  return headerSize;
+}
+
 BlockSplitBloomFilter BlockSplitBloomFilter::deserialize(
     dwio::common::SeekableInputStream* input,
     memory::MemoryPool& pool) {
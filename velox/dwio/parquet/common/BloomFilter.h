@@ -308,6 +308,17 @@ class BlockSplitBloomFilter : public BloomFilter {
       dwio::common::SeekableInputStream* input_stream,
       memory::MemoryPool& pool);
 
+  /// Number of bytes read from the start of a serialized Bloom filter to parse
+  /// its header. The header is a few small thrift fields and fits with room
+  /// to spare.
+  static constexpr uint32_t kHeaderSizeGuess = 256;
+
+  /// Parses the header of a serialized Bloom filter from the 'size' bytes at
+  /// 'data'. Sets 'numBytes' to the size of the bitset that follows the header
+  /// and returns the size of the header.
+  static uint32_t
+  readHeader(const char* data, uint64_t size, uint32_t& numBytes);
+
  private:
   inline void insertHashImpl(uint64_t hash);
 
@@ -86,15 +86,70 @@ class DeltaBpDecoder {
     return static_cast<int64_t>(totalValuesRemaining_);
   }
 
+  /// Decodes the next 'numValues' values into 'values'. Values inside a
+  /// miniblock are unpacked and summed in one pass per miniblock. Only the
+  /// first value of each miniblock goes through readLong(), which handles the
+  /// block and miniblock headers.
   template <typename T>
   void readValues(T* values, int32_t numValues) {
     VELOX_DCHECK_LE(numValues, totalValuesRemaining_);
-    for (auto i = 0; i < numValues; i++) {
-      values[i] = T(readLong());
+    int32_t i = 0;
+    while (i < numValues) {
+      if (valuesRemainingCurrentMiniBlock_ == 0 || deltaBitWidth_ > 56) {
+        values[i++] = T(readLong());
+        continue;
+      }
+      const auto numInMiniBlock = std::min<uint64_t>(
+          numValues - i,
+          std::min(valuesRemainingCurrentMiniBlock_, totalValuesRemaining_));
+      readMiniBlock(values + i, numInMiniBlock);
+      i += numInMiniBlock;
     }
   }
 
  private:
+  // Decodes 'numValues' values from the current miniblock. The bit width is
+  // at most 56, so each delta is inside the 8 bytes loaded from its first
+  // byte. Loads that would reach past the last byte of the decoded range
+  // fall back to bits::copyBits().
+  template <typename T>
+  void readMiniBlock(T* values, uint64_t numValues) {
+    const uint64_t firstBit =
+        (valuesPerMiniBlock_ - valuesRemainingCurrentMiniBlock_) *
+        deltaBitWidth_;
+    const uint64_t endByte =
+        bits::nbytes(firstBit + numValues * deltaBitWidth_);
+    const uint64_t mask = bits::lowMask(deltaBitWidth_);
+    // Addition between minDelta_, packed int and lastValue_ should be treated
+    // as unsigned addition. Overflow is as expected.
+    const auto minDelta = static_cast<uint64_t>(minDelta_);
+    auto value = static_cast<uint64_t>(lastValue_);
+    for (uint64_t i = 0; i < numValues; ++i) {
+      const uint64_t bit = firstBit + i * deltaBitWidth_;
+      uint64_t delta;
+      if ((bit >> 3) + sizeof(uint64_t) <= endByte) {
+        memcpy(&delta, bufferStart_ + (bit >> 3), sizeof(delta));
+        delta = (delta >> (bit & 7)) & mask;
+      } else {
+        delta = 0;
+        bits::copyBits(
+            reinterpret_cast<const uint64_t*>(bufferStart_),
+            bit,
+            &delta,
+            0,
+            deltaBitWidth_);
+      }
+      value += minDelta + delta;
+      values[i] = T(static_cast<int64_t>(value));
+    }
+    lastValue_ = static_cast<int64_t>(value);
+    valuesRemainingCurrentMiniBlock_ -= numValues;
+    totalValuesRemaining_ -= numValues;
+    if (valuesRemainingCurrentMiniBlock_ == 0 || totalValuesRemaining_ == 0) {
+      bufferStart_ += bits::nbytes(deltaBitWidth_ * valuesPerMiniBlock_);
+    }
+  }
+
   bool getVlqInt(uint64_t& v) {
     uint64_t tmp = 0;
     for (int i = 0; i < folly::kMaxVarintLength64; i++) {
@@ -31,6 +31,61 @@ class DeltaLengthByteArrayDecoder {
     bufferStart_ = lengthDecoder_->bufferStart();
   }
 
+  void skip(uint64_t numValues) {
+    skip<false>(numValues, 0, nullptr);
+  }
+
+  template <bool hasNulls>
+  inline void skip(int32_t numValues, int32_t current, const uint64_t* nulls) {
+    if (hasNulls) {
+      numValues = bits::countNonNulls(nulls, current, current + numValues);
+    }
+    VELOX_CHECK_LE(
+        lengthIdx_ + numValues,
+        numValidValues_,
+        "skipping past the end of DELTA_LENGTH_BYTE_ARRAY data");
+    // The lengths are all decoded, so skipping only advances the data.
+    for (int32_t i = 0; i < numValues; ++i) {
+      bufferStart_ += bufferedLength_[lengthIdx_++];
+    }
+  }
+
+  template <bool hasNulls, typename Visitor>
+  void readWithVisitor(const uint64_t* nulls, Visitor visitor) {
+    int32_t current = visitor.start();
+    skip<hasNulls>(current, 0, nulls);
+    int32_t toSkip;
+    bool atEnd = false;
+    const bool allowNulls = hasNulls && visitor.allowNulls();
+    for (;;) {
+      if (hasNulls && allowNulls && bits::isBitNull(nulls, current)) {
+        toSkip = visitor.processNull(atEnd);
+      } else {
+        if (hasNulls && !allowNulls) {
+          toSkip = visitor.checkAndSkipNulls(nulls, current, atEnd);
+          if (!Visitor::dense) {
+            skip<false>(toSkip, current, nullptr);
+          }
+          if (atEnd) {
+            return;
+          }
+        }
+
+        // We are at a non-null value on a row to visit.
+        toSkip = visitor.process(readString(), atEnd);
+      }
+      ++current;
+      if (toSkip) {
+        skip<hasNulls>(toSkip, current, nulls);
+        current += toSkip;
+      }
+      if (atEnd) {
+        return;
+      }
+    }
+  }
+
+  /// Returns the next value. The view points into the page data.
   std::string_view readString() {
     const int64_t length = bufferedLength_[lengthIdx_++];
     VELOX_CHECK_GE(length, 0, "negative string delta length");
@@ -57,6 +112,11 @@ class DeltaLengthByteArrayDecoder {
 
 // DeltaByteArrayDecoder is adapted from Apache Arrow:
 // https://github.com/apache/arrow/blob/apache-arrow-15.0.0/cpp/src/parquet/encoding.cc#L3301-L3545
+//
+// Values are reconstructed kBatchSize at a time into one contiguous buffer
+// sized from the prefix and suffix lengths, so there is no allocation or
+// string copy per value. Views returned by readString() stay valid until the
+// next batch is decoded.
 class DeltaByteArrayDecoder {
  public:
   explicit DeltaByteArrayDecoder(const char* start) {
@@ -81,8 +141,14 @@ class DeltaByteArrayDecoder {
     if (hasNulls) {
       numValues = bits::countNonNulls(nulls, current, current + numValues);
     }
-    for (int32_t i = 0; i < numValues; ++i) {
-      readString();
+    while (numValues > 0) {
+      if (batchIdx_ == batchSize()) {
+        decodeBatch();
+      }
+      const auto numSkipped =
+          std::min<int32_t>(numValues, batchSize() - batchIdx_);
+      batchIdx_ += numSkipped;
+      numValues -= numSkipped;
     }
   }
 
@@ -122,61 +188,82 @@ class DeltaByteArrayDecoder {
   }
 
   std::string_view readString() {
-    auto suffix = suffixDecoder_->readString();
-    bool isFirstRun = (prefixLenOffset_ == 0);
-    const int64_t prefixLength = bufferedPrefixLength_[prefixLenOffset_++];
-
-    VELOX_CHECK_GE(
-        prefixLength, 0, "negative prefix length in DELTA_BYTE_ARRAY");
+    if (batchIdx_ == batchSize()) {
+      decodeBatch();
+    }
+    const auto begin = batchOffsets_[batchIdx_];
+    const auto end = batchOffsets_[++batchIdx_];
+    return {batchValues_.data() + begin, end - begin};
+  }
 
-    buildReadValue(isFirstRun, prefixLength, suffix);
+ private:
+  static constexpr int32_t kBatchSize = 1024;
 
-    numValidValues_--;
-    return {lastValue_};
+  int32_t batchSize() const {
+    return batchOffsets_.empty()
+        ? 0
+        : static_cast<int32_t>(batchOffsets_.size() - 1);
   }
 
- private:
-  void buildReadValue(
-      bool isFirstRun,
-      const int64_t prefixLength,
-      std::string_view suffix) {
-    VELOX_CHECK_LE(
-        prefixLength,
-        lastValue_.size(),
-        "prefix length too large in DELTA_BYTE_ARRAY");
-
-    if (prefixLength == 0) {
-      // prefix is empty.
-      lastValue_ = std::string{suffix};
-      return;
+  void decodeBatch() {
+    VELOX_CHECK_GT(
+        numValidValues_, 0, "reading past the end of DELTA_BYTE_ARRAY data");
+    const int32_t numValues = std::min(kBatchSize, numValidValues_);
+    // The first value of the batch takes its prefix from the last value of
+    // the previous batch, which is about to be overwritten.
+    if (batchSize() > 0) {
+      lastValue_.assign(
+          batchValues_.data() + batchOffsets_[batchSize() - 1],
+          batchValues_.data() + batchOffsets_[batchSize()]);
     }
 
-    if (!isFirstRun) {
-      if (suffix.empty()) {
-        // suffix is empty: read value can simply point to the prefix
-        // of the lastValue_. This is not possible for the first run since
-        // the prefix would point to the mutable `lastValue_`.
-        lastValue_ = lastValue_.substr(0, prefixLength);
-        return;
-      }
+    suffixes_.resize(numValues);
+    uint64_t totalSize = 0;
+    for (int32_t i = 0; i < numValues; ++i) {
+      suffixes_[i] = suffixDecoder_->readString();
+      totalSize += bufferedPrefixLength_[prefixLenOffset_ + i] +
+          suffixes_[i].size();
     }
+    batchValues_.resize(totalSize);
+    batchOffsets_.resize(numValues + 1);
+    batchOffsets_[0] = 0;
 
-    lastValue_.resize(prefixLength + suffix.size());
-
-    // Both prefix and suffix are non-empty, so we need to decode the string
-    // into read value.
-    // Just keep the prefix in lastValue_, and copy the suffix.
-    memcpy(lastValue_.data() + prefixLength, suffix.data(), suffix.size());
+    const char* previous = lastValue_.data();
+    uint64_t previousSize = lastValue_.size();
+    char* out = batchValues_.data();
+    for (int32_t i = 0; i < numValues; ++i) {
+      const uint64_t prefixLength = bufferedPrefixLength_[prefixLenOffset_++];
+      VELOX_CHECK_LE(
+          prefixLength,
+          previousSize,
+          "prefix length too large in DELTA_BYTE_ARRAY");
+      const auto& suffix = suffixes_[i];
+      memcpy(out, previous, prefixLength);
+      memcpy(out + prefixLength, suffix.data(), suffix.size());
+      previous = out;
+      previousSize = prefixLength + suffix.size();
+      out += previousSize;
+      batchOffsets_[i + 1] = out - batchValues_.data();
+    }
+    batchIdx_ = 0;
+    numValidValues_ -= numValues;
   }
 
   std::unique_ptr<DeltaBpDecoder> prefixLenDecoder_;
-  std::unique_ptr<DeltaBpDecoder> suffixLenDecoder_;
   std::unique_ptr<DeltaLengthByteArrayDecoder> suffixDecoder_;
 
+  // Last value of the previous batch.
   std::string lastValue_;
   int32_t numValidValues_{0};
   uint32_t prefixLenOffset_{0};
   std::vector<uint32_t> bufferedPrefixLength_;
+
+  // Values of the current batch, back to back, and their start offsets
+  // followed by the end offset of the last value.
+  std::vector<char> batchValues_;
+  std::vector<uint64_t> batchOffsets_;
+  int32_t batchIdx_{0};
+  std::vector<std::string_view> suffixes_;
 };
 
 } // namespace facebook::velox::parquet
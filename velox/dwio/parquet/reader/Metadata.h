@@ -21,6 +21,17 @@
 
 namespace facebook::velox::parquet {
 
+namespace thrift {
+class Statistics;
+} // namespace thrift
+
+/// Builds the column statistics of 'numRows' values of 'type' from the thrift
+/// Statistics of a column chunk or of a page in the column index.
+std::unique_ptr<dwio::common::ColumnStatistics> buildColumnStatisticsFromThrift(
+    const thrift::Statistics& columnChunkStats,
+    const velox::Type& type,
+    uint64_t numRowsInRowGroup);
+
 /// ColumnChunkMetaDataPtr is a proxy around pointer to thrift::ColumnChunk.
 class ColumnChunkMetaDataPtr {
  public:
@@ -74,6 +85,33 @@ class ColumnChunkMetaDataPtr {
   /// This information is optional and may be 0 if omitted.
   int64_t totalUncompressedSize() const;
 
+  /// Check the presence of the bloom filter offset in ColumnChunk metadata.
+  bool hasBloomFilterOffset() const;
+
+  /// File offset of the bloom filter header followed by the bitset.
+  /// Must check for its presence using hasBloomFilterOffset().
+  int64_t bloomFilterOffset() const;
+
+  /// Check the presence of the ColumnIndex of the page index.
+  bool hasColumnIndex() const;
+
+  /// File offset of the ColumnIndex.
+  /// Must check for its presence using hasColumnIndex().
+  int64_t columnIndexOffset() const;
+
+  /// Size of the ColumnIndex in bytes.
+  int32_t columnIndexLength() const;
+
+  /// Check the presence of the OffsetIndex of the page index.
+  bool hasOffsetIndex() const;
+
+  /// File offset of the OffsetIndex.
+  /// Must check for its presence using hasOffsetIndex().
+  int64_t offsetIndexOffset() const;
+
+  /// Size of the OffsetIndex in bytes.
+  int32_t offsetIndexLength() const;
+
  private:
   const void* ptr_;
 };
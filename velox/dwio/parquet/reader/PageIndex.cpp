@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/parquet/reader/PageIndex.h"
+
+#include <thrift/protocol/TCompactProtocol.h> //@manual
+
+#include "velox/dwio/common/ScanSpec.h"
+#include "velox/dwio/parquet/reader/Metadata.h"
+#include "velox/dwio/parquet/thrift/ThriftTransport.h"
+
+namespace facebook::velox::parquet {
+
+namespace {
+
+template <typename T>
+T deserialize(const char* data, uint64_t size) {
+  auto transport =
+      std::make_shared<thrift::ThriftBufferedTransport>(data, size);
+  auto protocol = std::make_unique<
+      apache::thrift::protocol::TCompactProtocolT<thrift::ThriftTransport>>(
+      transport);
+  T result;
+  result.read(protocol.get());
+  return result;
+}
+
+} // namespace
+
+PageIndex::PageIndex(
+    const char* columnIndex,
+    uint64_t columnIndexSize,
+    const char* offsetIndex,
+    uint64_t offsetIndexSize,
+    int64_t numRows)
+    : PageIndex(
+          deserialize<thrift::ColumnIndex>(columnIndex, columnIndexSize),
+          deserialize<thrift::OffsetIndex>(offsetIndex, offsetIndexSize),
+          numRows) {}
+
+PageIndex::PageIndex(
+    thrift::ColumnIndex columnIndex,
+    thrift::OffsetIndex offsetIndex,
+    int64_t numRows)
+    : columnIndex_(std::move(columnIndex)),
+      offsetIndex_(std::move(offsetIndex)),
+      numRows_(numRows) {
+  const auto numPages = offsetIndex_.page_locations.size();
+  VELOX_CHECK_EQ(columnIndex_.null_pages.size(), numPages);
+  VELOX_CHECK_EQ(columnIndex_.min_values.size(), numPages);
+  VELOX_CHECK_EQ(columnIndex_.max_values.size(), numPages);
+  if (columnIndex_.__isset.null_counts) {
+    VELOX_CHECK_EQ(columnIndex_.null_counts.size(), numPages);
+  }
+  for (auto i = 0; i < numPages; ++i) {
+    VELOX_CHECK_LE(offsetIndex_.page_locations[i].first_row_index, numRows_);
+    if (i > 0) {
+      VELOX_CHECK_GE(
+          offsetIndex_.page_locations[i].first_row_index,
+          offsetIndex_.page_locations[i - 1].first_row_index);
+    }
+  }
+}
+
+bool PageIndex::pageMayMatch(
+    int32_t page,
+    const common::Filter& filter,
+    const TypePtr& type) const {
+  const auto numRows =
+      pageEndRow(page) - offsetIndex_.page_locations[page].first_row_index;
+  if (columnIndex_.null_pages[page]) {
+    return filter.testNull();
+  }
+  thrift::Statistics pageStats;
+  pageStats.__set_min_value(columnIndex_.min_values[page]);
+  pageStats.__set_max_value(columnIndex_.max_values[page]);
+  if (columnIndex_.__isset.null_counts) {
+    pageStats.__set_null_count(columnIndex_.null_counts[page]);
+  }
+  auto stats = buildColumnStatisticsFromThrift(pageStats, *type, numRows);
+  return common::testFilter(&filter, stats.get(), numRows, type);
+}
+
+std::vector<RowRange> PageIndex::filterPages(
+    const common::Filter& filter,
+    const TypePtr& type) const {
+  std::vector<RowRange> ranges;
+  for (auto page = 0; page < numPages(); ++page) {
+    const RowRange range{
+        offsetIndex_.page_locations[page].first_row_index, pageEndRow(page)};
+    if (range.size() == 0 || !pageMayMatch(page, filter, type)) {
+      continue;
+    }
+    if (!ranges.empty() && ranges.back().end == range.begin) {
+      ranges.back().end = range.end;
+    } else {
+      ranges.push_back(range);
+    }
+  }
+  return ranges;
+}
+
+// static
+std::vector<RowRange> PageIndex::intersect(
+    const std::vector<RowRange>& left,
+    const std::vector<RowRange>& right) {
+  std::vector<RowRange> result;
+  auto i = 0;
+  auto j = 0;
+  while (i < left.size() && j < right.size()) {
+    const auto begin = std::max(left[i].begin, right[j].begin);
+    const auto end = std::min(left[i].end, right[j].end);
+    if (begin < end) {
+      result.push_back({begin, end});
+    }
+    if (left[i].end < right[j].end) {
+      ++i;
+    } else {
+      ++j;
+    }
+  }
+  return result;
+}
+
+} // namespace facebook::velox::parquet
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "velox/dwio/parquet/thrift/ParquetThriftTypes.h"
+#include "velox/type/Filter.h"
+
+namespace facebook::velox::parquet {
+
+/// A half open range of rows [begin, end) inside a row group.
+struct RowRange {
+  int64_t begin;
+  int64_t end;
+
+  int64_t size() const {
+    return end - begin;
+  }
+
+  bool operator==(const RowRange& other) const {
+    return begin == other.begin && end == other.end;
+  }
+};
+
+/// The page index of one column chunk, i.e. the ColumnIndex with per page
+/// min/max/null statistics and the OffsetIndex with the first row of each
+/// page. Used to find the pages of a row group that may contain rows passing
+/// a filter so that the other pages are skipped without being decompressed
+/// or decoded.
+class PageIndex {
+ public:
+  /// Deserializes the thrift ColumnIndex and OffsetIndex from
+  /// 'columnIndex' and 'offsetIndex'. 'numRows' is the number of rows in the
+  /// row group.
+  PageIndex(
+      const char* columnIndex,
+      uint64_t columnIndexSize,
+      const char* offsetIndex,
+      uint64_t offsetIndexSize,
+      int64_t numRows);
+
+  PageIndex(
+      thrift::ColumnIndex columnIndex,
+      thrift::OffsetIndex offsetIndex,
+      int64_t numRows);
+
+  int32_t numPages() const {
+    return offsetIndex_.page_locations.size();
+  }
+
+  /// Returns the ranges of rows in pages whose statistics do not exclude
+  /// rows passing 'filter'. 'type' is the type of the column in the file.
+  /// Adjacent ranges are coalesced.
+  std::vector<RowRange> filterPages(
+      const common::Filter& filter,
+      const TypePtr& type) const;
+
+  /// Returns the rows that are in both 'left' and 'right'. Both inputs must
+  /// be sorted and non-overlapping, as returned by filterPages().
+  static std::vector<RowRange> intersect(
+      const std::vector<RowRange>& left,
+      const std::vector<RowRange>& right);
+
+ private:
+  int64_t pageEndRow(int32_t page) const {
+    return page + 1 < numPages()
+        ? offsetIndex_.page_locations[page + 1].first_row_index
+        : numRows_;
+  }
+
+  bool pageMayMatch(
+      int32_t page,
+      const common::Filter& filter,
+      const TypePtr& type) const;
+
+  const thrift::ColumnIndex columnIndex_;
+  const thrift::OffsetIndex offsetIndex_;
+  const int64_t numRows_;
+};
+
+} // namespace facebook::velox::parquet
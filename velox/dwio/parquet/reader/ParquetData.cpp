@@ -17,6 +17,7 @@
 #include "velox/dwio/parquet/reader/ParquetData.h"
 
 #include "velox/dwio/common/BufferedInput.h"
+#include "velox/dwio/parquet/common/BloomFilter.h"
 #include "velox/dwio/parquet/reader/ParquetStatsContext.h"
 
 namespace facebook::velox::parquet {
@@ -150,4 +151,123 @@ std::pair<int64_t, int64_t> ParquetData::getRowGroupRegion(
   return {fileOffset, length};
 }
 
+namespace {
+
+// Bloom filters hash the plain encoding of the physical type. Unsigned
+// integers are read into wider types and their values do not round trip
+// through the signed physical type.
+bool isUnsigned(const ParquetTypeWithId& type) {
+  if (type.logicalType_.has_value() && type.logicalType_->__isset.INTEGER) {
+    return !type.logicalType_->INTEGER.isSigned;
+  }
+  if (type.convertedType_.has_value()) {
+    switch (type.convertedType_.value()) {
+      case thrift::ConvertedType::UINT_8:
+      case thrift::ConvertedType::UINT_16:
+      case thrift::ConvertedType::UINT_32:
+      case thrift::ConvertedType::UINT_64:
+        return true;
+      default:
+        return false;
+    }
+  }
+  return false;
+}
+
+template <typename Values>
+bool mayContainAny(
+    const Values& values,
+    const BloomFilter& bloomFilter,
+    thrift::Type::type physicalType) {
+  for (const int64_t value : values) {
+    if (physicalType == thrift::Type::INT32) {
+      if (value < std::numeric_limits<int32_t>::min() ||
+          value > std::numeric_limits<int32_t>::max()) {
+        continue;
+      }
+      if (bloomFilter.findHash(
+              bloomFilter.hash(static_cast<int32_t>(value)))) {
+        return true;
+      }
+    } else if (bloomFilter.findHash(bloomFilter.hash(value))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool mayContain(const std::string_view value, const BloomFilter& bloomFilter) {
+  const ByteArray byteArray(value);
+  return bloomFilter.findHash(bloomFilter.hash(&byteArray));
+}
+
+} // namespace
+
+bool canUseBloomFilter(const common::Filter& filter) {
+  if (filter.testNull()) {
+    return false;
+  }
+  switch (filter.kind()) {
+    case common::FilterKind::kBigintRange:
+      return static_cast<const common::BigintRange&>(filter).isSingleValue();
+    case common::FilterKind::kBytesRange:
+      return static_cast<const common::BytesRange&>(filter).isSingleValue();
+    case common::FilterKind::kBigintValuesUsingHashTable:
+    case common::FilterKind::kBigintValuesUsingBitmask:
+    case common::FilterKind::kBytesValues:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool testBloomFilter(
+    const common::Filter& filter,
+    const BloomFilter& bloomFilter,
+    const ParquetTypeWithId& type) {
+  if (!canUseBloomFilter(filter) || !type.parquetType_.has_value() ||
+      isUnsigned(type)) {
+    return true;
+  }
+  const auto physicalType = type.parquetType_.value();
+  const bool isInteger = physicalType == thrift::Type::INT32 ||
+      physicalType == thrift::Type::INT64;
+  const bool isBytes = physicalType == thrift::Type::BYTE_ARRAY;
+  switch (filter.kind()) {
+    case common::FilterKind::kBigintRange: {
+      const auto& range = static_cast<const common::BigintRange&>(filter);
+      const std::array<int64_t, 1> values{range.lower()};
+      return !isInteger || mayContainAny(values, bloomFilter, physicalType);
+    }
+    case common::FilterKind::kBigintValuesUsingHashTable: {
+      const auto& values =
+          static_cast<const common::BigintValuesUsingHashTable&>(filter)
+              .values();
+      return !isInteger || mayContainAny(values, bloomFilter, physicalType);
+    }
+    case common::FilterKind::kBigintValuesUsingBitmask: {
+      const auto values =
+          static_cast<const common::BigintValuesUsingBitmask&>(filter)
+              .values();
+      return !isInteger || mayContainAny(values, bloomFilter, physicalType);
+    }
+    case common::FilterKind::kBytesRange: {
+      const auto& range = static_cast<const common::BytesRange&>(filter);
+      return !isBytes || mayContain(range.lower(), bloomFilter);
+    }
+    case common::FilterKind::kBytesValues: {
+      if (!isBytes) {
+        return true;
+      }
+      const auto& values =
+          static_cast<const common::BytesValues&>(filter).values();
+      return std::any_of(values.begin(), values.end(), [&](const auto& value) {
+        return mayContain(value, bloomFilter);
+      });
+    }
+    default:
+      return true;
+  }
+}
+
 } // namespace facebook::velox::parquet
@@ -30,6 +30,8 @@ class BufferedInput;
 
 namespace facebook::velox::parquet {
 
+class BloomFilter;
+
 class ParquetParams : public dwio::common::FormatParams {
  public:
   ParquetParams(
@@ -196,6 +198,10 @@ class ParquetData : public dwio::common::FormatData {
     return reader_->isDeltaByteArray();
   }
 
+  bool isDeltaLengthByteArray() const {
+    return reader_->isDeltaLengthByteArray();
+  }
+
   bool parentNullsInLeaves() const override {
     return true;
   }
@@ -232,4 +238,17 @@ class ParquetData : public dwio::common::FormatData {
   int32_t presetNullsConsumed_{0};
 };
 
+/// True if a bloom filter may exclude all values for 'filter', i.e. it is a
+/// single value or IN list filter that does not accept nulls.
+bool canUseBloomFilter(const common::Filter& filter);
+
+/// Returns false if no value passing 'filter' can be in the column chunk of
+/// 'type' according to its 'bloomFilter'. Only filters accepted by
+/// canUseBloomFilter() on integer and byte array columns are checked; true
+/// is returned for other filters.
+bool testBloomFilter(
+    const common::Filter& filter,
+    const BloomFilter& bloomFilter,
+    const ParquetTypeWithId& type);
+
 } // namespace facebook::velox::parquet
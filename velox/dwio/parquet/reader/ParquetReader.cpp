@@ -18,6 +18,8 @@
 
 #include <thrift/protocol/TCompactProtocol.h> //@manual
 
+#include "velox/dwio/parquet/common/BloomFilter.h"
+#include "velox/dwio/parquet/reader/PageIndex.h"
 #include "velox/dwio/parquet/reader/ParquetColumnReader.h"
 #include "velox/dwio/parquet/reader/StructColumnReader.h"
 #include "velox/dwio/parquet/thrift/ThriftTransport.h"
@@ -68,6 +70,12 @@ class ReaderBase {
     return FileMetaDataPtr(reinterpret_cast<const void*>(fileMetaData_.get()));
   }
 
+  /// True if the thrift FileMetaData is shared with other readers of the file
+  /// through the FileMetadataCache. Shared metadata must not be modified.
+  bool isFileMetaDataShared() const {
+    return fileMetaDataShared_;
+  }
+
   const dwio::common::ReaderOptions& options() const {
     return options_;
   }
@@ -113,6 +121,14 @@ class ReaderBase {
   // Reads and parses file footer.
   void loadFileMetaData();
 
+  // Sets 'fileMetaData_' from the FileMetadataCache. Returns false if the
+  // metadata of the file is not cached.
+  bool loadCachedFileMetaData();
+
+  // Adds 'fileMetaData_' that was parsed from a footer of 'footerLength' bytes
+  // to the FileMetadataCache.
+  void cacheFileMetaData(uint32_t footerLength);
+
   void initializeSchema();
 
   void initializeVersion();
@@ -144,7 +160,8 @@ class ReaderBase {
   const dwio::common::ReaderOptions options_;
   std::shared_ptr<velox::dwio::common::BufferedInput> input_;
   uint64_t fileLength_;
-  std::unique_ptr<thrift::FileMetaData> fileMetaData_;
+  std::shared_ptr<thrift::FileMetaData> fileMetaData_;
+  bool fileMetaDataShared_{false};
   RowTypePtr schema_;
   std::shared_ptr<const dwio::common::TypeWithId> schemaWithId_;
 
@@ -176,6 +193,10 @@ void ReaderBase::loadFileMetaData() {
   bool preloadFile =
       fileLength_ <= std::max(filePreloadThreshold_, footerEstimatedSize_);
   uint64_t readSize = preloadFile ? fileLength_ : footerEstimatedSize_;
+  // A preloaded file is read as a whole anyway.
+  if (!preloadFile && loadCachedFileMetaData()) {
+    return;
+  }
 
   std::unique_ptr<dwio::common::SeekableInputStream> stream;
   if (preloadFile) {
@@ -219,8 +240,40 @@ void ReaderBase::loadFileMetaData() {
   auto thriftProtocol = std::make_unique<
       apache::thrift::protocol::TCompactProtocolT<thrift::ThriftTransport>>(
       thriftTransport);
-  fileMetaData_ = std::make_unique<thrift::FileMetaData>();
+  fileMetaData_ = std::make_shared<thrift::FileMetaData>();
   fileMetaData_->read(thriftProtocol.get());
+  if (!preloadFile) {
+    cacheFileMetaData(footerLength);
+  }
+}
+
+bool ReaderBase::loadCachedFileMetaData() {
+  auto* cache = dwio::common::FileMetadataCache::instance();
+  const auto& key = options_.fileMetadataCacheKey();
+  if (cache == nullptr || !key.has_value()) {
+    return false;
+  }
+  auto cached = cache->get<thrift::FileMetaData>(key.value());
+  if (cached == nullptr) {
+    return false;
+  }
+  // The readers of a shared FileMetaData do not modify it.
+  fileMetaData_ = std::const_pointer_cast<thrift::FileMetaData>(cached);
+  fileMetaDataShared_ = true;
+  return true;
+}
+
+void ReaderBase::cacheFileMetaData(uint32_t footerLength) {
+  auto* cache = dwio::common::FileMetadataCache::instance();
+  const auto& key = options_.fileMetadataCacheKey();
+  if (cache == nullptr || !key.has_value()) {
+    return;
+  }
+  // The deserialized thrift objects take a multiple of the compact encoded
+  // size.
+  constexpr uint64_t kDecodedSizeFactor = 4;
+  cache->put(key.value(), fileMetaData_, footerLength * kDecodedSizeFactor);
+  fileMetaDataShared_ = true;
 }
 
 void ReaderBase::initializeSchema() {
@@ -1073,6 +1126,14 @@ class ParquetRowReader::Impl {
         params,
         *options_.scanSpec());
     columnReader_->setIsTopLevel();
+    if (options_.decodingExecutor() != nullptr &&
+        options_.decodingParallelismFactor() > 1) {
+      static_cast<StructColumnReader&>(*columnReader_)
+          .setDecodingExecutor(
+              options_.decodingExecutor(),
+              options_.decodingParallelismFactor());
+    }
+    usePageIndex_ = canUsePageIndex();
 
     filterRowGroups();
     if (!rowGroupIds_.empty()) {
@@ -1096,7 +1157,9 @@ class ParquetRowReader::Impl {
       metadataFilter->eval(res.metadataFilterResults, res.filterResult);
     }
 
-    uint64_t rowNumber = 0;
+    // Row groups that are in range, not empty and not excluded by the
+    // statistics. The bloom filters are read only for these.
+    std::vector<bool> selected(rowGroups_.size());
     for (auto i = 0; i < rowGroups_.size(); i++) {
       VELOX_CHECK_GT(rowGroups_[i].columns.size(), 0);
       auto fileOffset = rowGroups_[i].__isset.file_offset
@@ -1114,29 +1177,158 @@ class ParquetRowReader::Impl {
 
       // Add a row group to read if it is within range and not empty and not in
       // the excluded list.
-      if (rowGroupInRange && !isExcluded && !isEmpty) {
+      selected[i] = rowGroupInRange && !isExcluded && !isEmpty;
+      if (rowGroupInRange && !selected[i]) {
+        skippedStrides_++;
+      }
+    }
+    applyBloomFilters(selected);
+
+    uint64_t rowNumber = 0;
+    for (auto i = 0; i < rowGroups_.size(); i++) {
+      if (selected[i]) {
         rowGroupIds_.push_back(i);
         firstRowOfRowGroup_.push_back(rowNumber);
-      } else {
-        if (i != 0) {
-          // Clear the metadata of row groups that are not read. This helps
-          // reduce the memory consumption. ColumnChunks consume the most
-          // memory. Skip the 0th RowGroup as it is used by estimatedRowSize().
-          rowGroups_[i].columns.clear();
+      } else if (i != 0 && !readerBase_->isFileMetaDataShared()) {
+        // Clear the metadata of row groups that are not read. This helps
+        // reduce the memory consumption. ColumnChunks consume the most
+        // memory. Skip the 0th RowGroup as it is used by estimatedRowSize().
+        // The metadata shared with other readers is kept.
+        rowGroups_[i].columns.clear();
+      }
+      rowNumber += rowGroups_[i].num_rows;
+    }
+  }
+
+  // Clears 'selected' for the row groups in which the bloom filter of a
+  // filtered top level column shows that no row passes the filter. The footer
+  // records only the offset of a bloom filter, so the filters of all selected
+  // row groups are read in two batches of bounded reads: first a prefix of
+  // kHeaderSizeGuess bytes that holds the header, then the exact range of
+  // any bitset that did not fit in the prefix. The reads go through a clone
+  // of the reader's buffered input, so that each batch is coalesced and
+  // cached in the AsyncDataCache when there is one.
+  void applyBloomFilters(std::vector<bool>& selected) {
+    struct Probe {
+      uint32_t rowGroup;
+      const common::Filter* filter;
+      const ParquetTypeWithId* fileType;
+      uint64_t offset;
+      uint64_t prefixSize;
+      std::unique_ptr<dwio::common::SeekableInputStream> stream;
+      std::string data;
+      uint32_t headerSize{0};
+      uint32_t numBytes{0};
+      bool inPrefix{false};
+    };
+    const uint64_t fileLength = readerBase_->fileLength();
+    std::vector<Probe> probes;
+    for (auto i = 0; i < rowGroups_.size(); ++i) {
+      if (!selected[i]) {
+        continue;
+      }
+      auto rowGroup = readerBase_->fileMetaData().rowGroup(i);
+      for (const auto* child : columnReader_->children()) {
+        if (!child || !child->scanSpec()->filter() ||
+            !canUseBloomFilter(*child->scanSpec()->filter())) {
+          continue;
+        }
+        const auto& fileType =
+            static_cast<const ParquetTypeWithId&>(child->fileType());
+        if (!fileType.isLeaf() || fileType.maxRepeat_ > 0) {
+          continue;
+        }
+        auto columnChunk = rowGroup.columnChunk(fileType.column());
+        if (!columnChunk.hasBloomFilterOffset()) {
+          continue;
         }
-        if (rowGroupInRange) {
-          skippedStrides_++;
+        const uint64_t offset = columnChunk.bloomFilterOffset();
+        if (offset == 0 || offset >= fileLength) {
+          continue;
         }
+        probes.push_back(
+            {static_cast<uint32_t>(i),
+             child->scanSpec()->filter(),
+             &fileType,
+             offset,
+             std::min<uint64_t>(
+                 BlockSplitBloomFilter::kHeaderSizeGuess,
+                 fileLength - offset)});
       }
+    }
+    if (probes.empty()) {
+      return;
+    }
 
-      rowNumber += rowGroups_[i].num_rows;
+    auto headerInput = readerBase_->bufferedInput().clone();
+    for (auto& probe : probes) {
+      probe.stream = headerInput->enqueue({probe.offset, probe.prefixSize});
+    }
+    headerInput->load(dwio::common::LogType::STRIPE_INDEX);
+
+    auto bitsetInput = readerBase_->bufferedInput().clone();
+    bool hasBitsetReads = false;
+    for (auto& probe : probes) {
+      readStream(probe.prefixSize, probe.stream.get(), probe.data);
+      probe.headerSize = BlockSplitBloomFilter::readHeader(
+          probe.data.data(), probe.prefixSize, probe.numBytes);
+      VELOX_CHECK_LE(
+          probe.offset + probe.headerSize + probe.numBytes,
+          fileLength,
+          "Bloom filter extends past the end of the file");
+      probe.inPrefix = probe.headerSize + probe.numBytes <= probe.prefixSize;
+      if (probe.inPrefix) {
+        probe.stream.reset();
+      } else {
+        probe.stream = bitsetInput->enqueue(
+            {probe.offset + probe.headerSize, probe.numBytes});
+        hasBitsetReads = true;
+      }
     }
+    if (hasBitsetReads) {
+      bitsetInput->load(dwio::common::LogType::STRIPE_INDEX);
+    }
+
+    for (auto& probe : probes) {
+      if (!selected[probe.rowGroup]) {
+        continue;
+      }
+      const char* bitset = probe.data.data() + probe.headerSize;
+      if (!probe.inPrefix) {
+        readStream(probe.numBytes, probe.stream.get(), probe.data);
+        bitset = probe.data.data();
+      }
+      BlockSplitBloomFilter bloomFilter(&pool_);
+      bloomFilter.init(
+          reinterpret_cast<const uint8_t*>(bitset), probe.numBytes);
+      if (!testBloomFilter(*probe.filter, bloomFilter, *probe.fileType)) {
+        selected[probe.rowGroup] = false;
+        skippedStrides_++;
+      }
+    }
+  }
+
+  // Reads 'length' bytes from 'stream' into 'data'.
+  static void readStream(
+      uint64_t length,
+      dwio::common::SeekableInputStream* stream,
+      std::string& data) {
+    data.resize(length);
+    const char* bufferStart = nullptr;
+    const char* bufferEnd = nullptr;
+    dwio::common::readBytes(
+        length, stream, data.data(), bufferStart, bufferEnd);
   }
 
   int64_t nextRowNumber() {
-    if (currentRowInGroup_ >= rowsInCurrentRowGroup_ &&
-        !advanceToNextRowGroup()) {
-      return kAtEnd;
+    for (;;) {
+      if (currentRowInGroup_ >= rowsInCurrentRowGroup_ &&
+          !advanceToNextRowGroup()) {
+        return kAtEnd;
+      }
+      if (skipToNextRowRange()) {
+        break;
+      }
     }
     return firstRowOfRowGroup_[nextRowGroupIdsIdx_ - 1] + currentRowInGroup_;
   }
@@ -1146,7 +1338,10 @@ class ParquetRowReader::Impl {
     if (nextRowNumber() == kAtEnd) {
       return kAtEnd;
     }
-    return std::min(size, rowsInCurrentRowGroup_ - currentRowInGroup_);
+    const uint64_t rangeEnd = rowRanges_.has_value()
+        ? (*rowRanges_)[nextRowRange_].end
+        : rowsInCurrentRowGroup_;
+    return std::min(size, rangeEnd - currentRowInGroup_);
   }
 
   uint64_t next(
@@ -1186,6 +1381,7 @@ class ParquetRowReader::Impl {
   void updateRuntimeStats(dwio::common::RuntimeStatistics& stats) const {
     stats.skippedStrides += skippedStrides_;
     stats.processedStrides += rowGroupIds_.size();
+    stats.skippedPageRows += skippedPageRows_;
   }
 
   void resetFilterCaches() {
@@ -1212,9 +1408,111 @@ class ParquetRowReader::Impl {
     currentRowInGroup_ = 0;
     nextRowGroupIdsIdx_++;
     columnReader_->seekToRowGroup(nextRowGroupIndex);
+    filterPages(nextRowGroupIndex);
     return true;
   }
 
+  // Page skipping is done by seeking the top level struct reader past
+  // the rows of the skipped pages. This is only supported when all the
+  // projected columns are top level primitive columns, so that the rows of
+  // the struct map one to one to the values in the pages.
+  bool canUsePageIndex() const {
+    bool hasFilter = false;
+    for (const auto* child : columnReader_->children()) {
+      if (!child) {
+        continue;
+      }
+      const auto& fileType =
+          static_cast<const ParquetTypeWithId&>(child->fileType());
+      if (!fileType.isLeaf() || fileType.maxRepeat_ > 0) {
+        return false;
+      }
+      hasFilter |= child->scanSpec()->filter() != nullptr;
+    }
+    return hasFilter;
+  }
+
+  std::string readPageIndex(int64_t offset, int32_t length) const {
+    auto stream = readerBase_->bufferedInput().read(
+        offset, length, dwio::common::LogType::STRIPE_INDEX);
+    std::string data(length, '\0');
+    const char* bufferStart = nullptr;
+    const char* bufferEnd = nullptr;
+    dwio::common::readBytes(
+        length, stream.get(), data.data(), bufferStart, bufferEnd);
+    return data;
+  }
+
+  // Sets 'rowRanges_' to the rows of row group 'index' that are in pages
+  // whose page index statistics may match the filters of the top level
+  // columns. Leaves 'rowRanges_' unset if all rows must be read.
+  void filterPages(uint32_t index) {
+    rowRanges_.reset();
+    nextRowRange_ = 0;
+    if (!usePageIndex_) {
+      return;
+    }
+    auto rowGroup = readerBase_->fileMetaData().rowGroup(index);
+    for (const auto* child : columnReader_->children()) {
+      if (!child || !child->scanSpec()->filter()) {
+        continue;
+      }
+      const auto& fileType = child->fileType();
+      auto columnChunk = rowGroup.columnChunk(fileType.column());
+      if (!columnChunk.hasColumnIndex() || !columnChunk.hasOffsetIndex()) {
+        continue;
+      }
+      const auto columnIndex = readPageIndex(
+          columnChunk.columnIndexOffset(), columnChunk.columnIndexLength());
+      const auto offsetIndex = readPageIndex(
+          columnChunk.offsetIndexOffset(), columnChunk.offsetIndexLength());
+      const PageIndex pageIndex(
+          columnIndex.data(),
+          columnIndex.size(),
+          offsetIndex.data(),
+          offsetIndex.size(),
+          rowGroup.numRows());
+      auto ranges =
+          pageIndex.filterPages(*child->scanSpec()->filter(), fileType.type());
+      rowRanges_ = rowRanges_.has_value()
+          ? PageIndex::intersect(*rowRanges_, ranges)
+          : std::move(ranges);
+      if (rowRanges_->empty()) {
+        break;
+      }
+    }
+    if (rowRanges_.has_value() && rowRanges_->size() == 1 &&
+        rowRanges_->front() == RowRange{0, rowGroup.numRows()}) {
+      rowRanges_.reset();
+    }
+  }
+
+  // Moves 'currentRowInGroup_' to the first row at or after it that is in
+  // 'rowRanges_'. The column readers skip the rows in between without
+  // decoding them and whole pages are skipped without decompression. Returns
+  // false and moves to the end of the row group if no such row is left.
+  bool skipToNextRowRange() {
+    if (!rowRanges_.has_value()) {
+      return true;
+    }
+    const auto& ranges = *rowRanges_;
+    while (nextRowRange_ < ranges.size() &&
+           ranges[nextRowRange_].end <= currentRowInGroup_) {
+      ++nextRowRange_;
+    }
+    uint64_t target = nextRowRange_ < ranges.size()
+        ? std::max<uint64_t>(currentRowInGroup_, ranges[nextRowRange_].begin)
+        : rowsInCurrentRowGroup_;
+    if (target > currentRowInGroup_) {
+      if (target < rowsInCurrentRowGroup_) {
+        columnReader_->seekTo(target, false);
+      }
+      skippedPageRows_ += target - currentRowInGroup_;
+      currentRowInGroup_ = target;
+    }
+    return nextRowRange_ < ranges.size();
+  }
+
   memory::MemoryPool& pool_;
   const std::shared_ptr<ReaderBase> readerBase_;
   const dwio::common::RowReaderOptions options_;
@@ -1231,6 +1529,17 @@ class ParquetRowReader::Impl {
   uint64_t currentRowInGroup_;
   uint32_t skippedStrides_{0};
 
+  // True if the pages of row groups are filtered with the page index.
+  bool usePageIndex_{false};
+  // The ranges of rows of the current row group in pages that may match the
+  // filters. Not set if all rows of the row group are read.
+  std::optional<std::vector<RowRange>> rowRanges_;
+  // Index of the first range in 'rowRanges_' that ends after
+  // 'currentRowInGroup_'.
+  size_t nextRowRange_{0};
+  // Number of rows skipped with the page index.
+  uint64_t skippedPageRows_{0};
+
   std::unique_ptr<dwio::common::SelectiveColumnReader> columnReader_;
 
   TypePtr requestedType_;
@@ -48,15 +48,48 @@ void StringColumnReader::getValues(const RowSet& rows, VectorPtr* result) {
     auto dictionaryValues =
         formatData_->as<ParquetData>().dictionaryValues(fileType_->type());
     compactScalarValues<int32_t, int32_t>(rows, false);
-
-    *result = std::make_shared<DictionaryVector<StringView>>(
-        memoryPool_, resultNulls(), numValues_, dictionaryValues, values_);
+    if (scanSpec_->makeFlat()) {
+      makeFlat(dictionaryValues, result);
+    } else {
+      *result = std::make_shared<DictionaryVector<StringView>>(
+          memoryPool_, resultNulls(), numValues_, dictionaryValues, values_);
+    }
+    // The dictionary is scanned once per dictionary page.
+    propagateDictionaryIsAscii(dictionaryValues, *result);
     return;
   }
   rawStringBuffer_ = nullptr;
   rawStringSize_ = 0;
   rawStringUsed_ = 0;
   getFlatValues<StringView, StringView>(rows, result, fileType_->type());
+  computeStringIsAscii(*result);
+}
+
+void StringColumnReader::makeFlat(
+    const VectorPtr& dictionaryValues,
+    VectorPtr* result) {
+  auto* dictionary = dictionaryValues->asUnchecked<FlatVector<StringView>>();
+  auto* rawDictionary = dictionary->rawValues();
+  auto* indices = reinterpret_cast<const vector_size_t*>(rawValues_);
+  auto values = AlignedBuffer::allocate<StringView>(numValues_, memoryPool_);
+  auto* stringViews = values->asMutable<StringView>();
+  auto nulls = resultNulls();
+  auto* rawNulls = nulls ? nulls->as<uint64_t>() : nullptr;
+  for (vector_size_t i = 0; i < numValues_; ++i) {
+    if (rawNulls && bits::isBitNull(rawNulls, i)) {
+      stringViews[i] = {};
+      continue;
+    }
+    stringViews[i] = rawDictionary[indices[i]];
+  }
+  // The views point into the dictionary strings, which the result keeps.
+  *result = std::make_shared<FlatVector<StringView>>(
+      memoryPool_,
+      fileType_->type(),
+      std::move(nulls),
+      numValues_,
+      std::move(values),
+      std::vector<BufferPtr>(dictionary->stringBuffers()));
 }
 
 void StringColumnReader::dedictionarize() {
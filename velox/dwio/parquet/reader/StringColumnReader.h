@@ -31,7 +31,9 @@ class StringColumnReader : public dwio::common::SelectiveColumnReader {
 
   bool hasBulkPath() const override {
     //  Non-dictionary encodings do not have fast path.
-    return !formatData_->as<ParquetData>().isDeltaByteArray() &&
+    const auto& parquetData = formatData_->as<ParquetData>();
+    return !parquetData.isDeltaByteArray() &&
+        !parquetData.isDeltaLengthByteArray() &&
         scanState_.dictionary.values != nullptr;
   }
 
@@ -50,6 +52,11 @@ class StringColumnReader : public dwio::common::SelectiveColumnReader {
   void getValues(const RowSet& rows, VectorPtr* result) override;
 
   void dedictionarize() override;
+
+ private:
+  // Makes a flat result from the dictionary indices in 'values_' for readers
+  // whose ScanSpec asks for flat output.
+  void makeFlat(const VectorPtr& dictionaryValues, VectorPtr* result);
 };
 
 } // namespace facebook::velox::parquet
@@ -395,3 +395,115 @@ TEST_F(BloomFilterTest, TestBloomFilterHashes) {
         << "Hash with seed 0 Error: " << i;
   }
 }
+
+TEST_F(BloomFilterTest, rowGroupFilter) {
+  auto makeType = [](const TypePtr& type, thrift::Type::type parquetType) {
+    return std::make_shared<ParquetTypeWithId>(
+        type,
+        std::vector<std::unique_ptr<dwio::common::TypeWithId>>{},
+        1,
+        1,
+        0,
+        "c0",
+        parquetType,
+        std::nullopt,
+        std::nullopt,
+        0,
+        1,
+        true,
+        false);
+  };
+  auto intType = makeType(INTEGER(), thrift::Type::INT32);
+  auto bigintType = makeType(BIGINT(), thrift::Type::INT64);
+  auto varcharType = makeType(VARCHAR(), thrift::Type::BYTE_ARRAY);
+
+  BlockSplitBloomFilter intBloomFilter(leafPool_.get());
+  intBloomFilter.init(1024);
+  BlockSplitBloomFilter bigintBloomFilter(leafPool_.get());
+  bigintBloomFilter.init(1024);
+  for (int32_t i = 0; i < 100; ++i) {
+    intBloomFilter.insertHash(intBloomFilter.hash(i * 1'000));
+    bigintBloomFilter.insertHash(
+        bigintBloomFilter.hash(static_cast<int64_t>(i * 1'000)));
+  }
+  BlockSplitBloomFilter bytesBloomFilter(leafPool_.get());
+  bytesBloomFilter.init(1024);
+  for (const std::string_view value : {"apple", "banana", "cherry"}) {
+    const ByteArray byteArray(value);
+    bytesBloomFilter.insertHash(bytesBloomFilter.hash(&byteArray));
+  }
+
+  // The inserted values always pass. Values outside the range of the physical
+  // type never do.
+  common::BigintRange present(5'000, 5'000, false);
+  EXPECT_TRUE(testBloomFilter(present, intBloomFilter, *intType));
+  EXPECT_TRUE(testBloomFilter(present, bigintBloomFilter, *bigintType));
+  common::BigintRange outOfRange(1LL << 40, 1LL << 40, false);
+  EXPECT_FALSE(testBloomFilter(outOfRange, intBloomFilter, *intType));
+
+  common::BigintValuesUsingHashTable inList(
+      0, 1LL << 40, {5'000, 1LL << 40}, false);
+  EXPECT_TRUE(testBloomFilter(inList, bigintBloomFilter, *bigintType));
+
+  common::BytesValues bytesValues({"banana", "durian"}, false);
+  EXPECT_TRUE(testBloomFilter(bytesValues, bytesBloomFilter, *varcharType));
+  common::BytesRange bytesRange(
+      "cherry", false, false, "cherry", false, false, false);
+  EXPECT_TRUE(testBloomFilter(bytesRange, bytesBloomFilter, *varcharType));
+
+  // Absent values are rejected unless there is a false positive.
+  int32_t numRejected = 0;
+  for (int64_t i = 0; i < 100; ++i) {
+    common::BigintRange absent(i * 1'000 + 1, i * 1'000 + 1, false);
+    numRejected += !testBloomFilter(absent, intBloomFilter, *intType);
+    numRejected += !testBloomFilter(absent, bigintBloomFilter, *bigintType);
+  }
+  EXPECT_GT(numRejected, 150);
+
+  // Filters that accept nulls or ranges of values are not checked.
+  common::BigintRange withNulls(1, 1, true);
+  EXPECT_FALSE(canUseBloomFilter(withNulls));
+  EXPECT_TRUE(testBloomFilter(withNulls, intBloomFilter, *intType));
+  common::BigintRange range(1, 999, false);
+  EXPECT_FALSE(canUseBloomFilter(range));
+  EXPECT_TRUE(testBloomFilter(range, intBloomFilter, *intType));
+}
+
+TEST_F(BloomFilterTest, readHeader) {
+  BlockSplitBloomFilter bloomFilter(leafPool_.get());
+  bloomFilter.init(1024);
+  for (int64_t i = 0; i < 100; ++i) {
+    bloomFilter.insertHash(bloomFilter.hash(i));
+  }
+  dwio::common::DataBufferHolder bufferHolder{*leafPool_.get(), 1024};
+  dwio::common::AppendOnlyBufferedStream sink(
+      std::make_unique<dwio::common::BufferedOutputStream>(bufferHolder));
+  bloomFilter.writeTo(&sink);
+  sink.flush();
+  std::string buffer;
+  for (auto& tmpBuffer : bufferHolder.getBuffers()) {
+    buffer.append(tmpBuffer.data(), tmpBuffer.size());
+  }
+
+  // The header is parsed from a bounded prefix and is followed by exactly
+  // the bitset.
+  uint32_t numBytes = 0;
+  const auto prefixSize = std::min<uint64_t>(
+      BlockSplitBloomFilter::kHeaderSizeGuess, buffer.size());
+  const auto headerSize =
+      BlockSplitBloomFilter::readHeader(buffer.data(), prefixSize, numBytes);
+  EXPECT_EQ(numBytes, 1024);
+  EXPECT_LT(headerSize, BlockSplitBloomFilter::kHeaderSizeGuess);
+  EXPECT_EQ(headerSize + numBytes, buffer.size());
+
+  BlockSplitBloomFilter copy(leafPool_.get());
+  copy.init(
+      reinterpret_cast<const uint8_t*>(buffer.data()) + headerSize, numBytes);
+  for (int64_t i = 0; i < 100; ++i) {
+    EXPECT_TRUE(copy.findHash(copy.hash(i)));
+  }
+
+  // A prefix that ends inside the header is rejected.
+  EXPECT_ANY_THROW(
+      BlockSplitBloomFilter::readHeader(buffer.data(), 2, numBytes));
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/parquet/reader/PageIndex.h"
+
+#include <gtest/gtest.h>
+#include <thrift/protocol/TCompactProtocol.h> //@manual
+#include <thrift/transport/TBufferTransports.h> //@manual
+
+using namespace facebook::velox;
+using namespace facebook::velox::parquet;
+
+namespace {
+
+std::string encode(int64_t value) {
+  return std::string(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// Makes a page index for BIGINT pages with the given first rows, min/max
+// values and null pages.
+PageIndex makePageIndex(
+    const std::vector<int64_t>& firstRows,
+    const std::vector<std::pair<int64_t, int64_t>>& minMax,
+    const std::vector<bool>& nullPages,
+    int64_t numRows) {
+  thrift::ColumnIndex columnIndex;
+  thrift::OffsetIndex offsetIndex;
+  for (auto i = 0; i < firstRows.size(); ++i) {
+    thrift::PageLocation location;
+    location.__set_offset(1'000 * i);
+    location.__set_compressed_page_size(1'000);
+    location.__set_first_row_index(firstRows[i]);
+    offsetIndex.page_locations.push_back(location);
+    columnIndex.null_pages.push_back(nullPages[i]);
+    columnIndex.min_values.push_back(
+        nullPages[i] ? std::string() : encode(minMax[i].first));
+    columnIndex.max_values.push_back(
+        nullPages[i] ? std::string() : encode(minMax[i].second));
+    columnIndex.null_counts.push_back(nullPages[i] ? 1 : 0);
+  }
+  columnIndex.__isset.null_counts = true;
+  return PageIndex(std::move(columnIndex), std::move(offsetIndex), numRows);
+}
+
+} // namespace
+
+TEST(PageIndexTest, filterPages) {
+  auto pageIndex = makePageIndex(
+      {0, 100, 200, 300, 400},
+      {{0, 99}, {100, 199}, {200, 299}, {0, 0}, {400, 499}},
+      {false, false, false, true, false},
+      450);
+
+  common::BigintRange oneValue(150, 150, false);
+  EXPECT_EQ(
+      pageIndex.filterPages(oneValue, BIGINT()),
+      (std::vector<RowRange>{{100, 200}}));
+
+  // Adjacent pages are coalesced. The last page ends at the end of the row
+  // group.
+  common::BigintRange range(150, 1'000, false);
+  EXPECT_EQ(
+      pageIndex.filterPages(range, BIGINT()),
+      (std::vector<RowRange>{{100, 300}, {400, 450}}));
+
+  // The all null page matches only filters that accept nulls.
+  common::BigintRange rangeWithNulls(150, 1'000, true);
+  EXPECT_EQ(
+      pageIndex.filterPages(rangeWithNulls, BIGINT()),
+      (std::vector<RowRange>{{100, 450}}));
+
+  common::IsNull isNull;
+  EXPECT_EQ(
+      pageIndex.filterPages(isNull, BIGINT()),
+      (std::vector<RowRange>{{300, 400}}));
+
+  common::BigintRange none(1'000, 2'000, false);
+  EXPECT_TRUE(pageIndex.filterPages(none, BIGINT()).empty());
+}
+
+TEST(PageIndexTest, intersect) {
+  std::vector<RowRange> left{{0, 10}, {20, 30}, {40, 50}};
+  std::vector<RowRange> right{{5, 25}, {28, 45}};
+  EXPECT_EQ(
+      PageIndex::intersect(left, right),
+      (std::vector<RowRange>{{5, 10}, {20, 25}, {28, 30}, {40, 45}}));
+  EXPECT_TRUE(PageIndex::intersect(left, {}).empty());
+  EXPECT_EQ(PageIndex::intersect(left, {{0, 50}}), left);
+}
+
+TEST(PageIndexTest, serde) {
+  thrift::ColumnIndex columnIndex;
+  columnIndex.null_pages = {false, false};
+  columnIndex.min_values = {encode(1), encode(10)};
+  columnIndex.max_values = {encode(5), encode(20)};
+  thrift::OffsetIndex offsetIndex;
+  offsetIndex.page_locations.resize(2);
+  offsetIndex.page_locations[0].__set_first_row_index(0);
+  offsetIndex.page_locations[1].__set_first_row_index(10);
+
+  auto serialize = [](const auto& object) {
+    auto buffer = std::make_shared<apache::thrift::transport::TMemoryBuffer>();
+    apache::thrift::protocol::TCompactProtocolT<
+        apache::thrift::transport::TMemoryBuffer>
+        protocol(buffer);
+    object.write(&protocol);
+    return buffer->getBufferAsString();
+  };
+  const auto columnIndexBytes = serialize(columnIndex);
+  const auto offsetIndexBytes = serialize(offsetIndex);
+  PageIndex pageIndex(
+      columnIndexBytes.data(),
+      columnIndexBytes.size(),
+      offsetIndexBytes.data(),
+      offsetIndexBytes.size(),
+      20);
+  EXPECT_EQ(pageIndex.numPages(), 2);
+
+  common::BigintRange filter(12, 15, false);
+  EXPECT_EQ(
+      pageIndex.filterPages(filter, BIGINT()),
+      (std::vector<RowRange>{{10, 20}}));
+}
@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 
+#include <folly/ScopeGuard.h>
+#include <folly/executors/CPUThreadPoolExecutor.h>
+
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/dwio/parquet/tests/ParquetTestBase.h"
 #include "velox/expression/ExprToSubfieldFilter.h"
@@ -399,6 +402,47 @@ TEST_F(ParquetReaderTest, parseSampleRange1) {
       sampleSchema(), *rowReader, expected, *leafPool_);
 }
 
+TEST_F(ParquetReaderTest, fileMetadataCache) {
+  FileMetadataCache::testingReset();
+  FileMetadataCache::init(1 << 20);
+  SCOPE_EXIT {
+    FileMetadataCache::testingReset();
+  };
+  const std::string sample(getExampleFilePath("sample.parquet"));
+  auto read = [&](uint64_t offset, uint64_t length, int32_t numRows) {
+    dwio::common::ReaderOptions readerOpts{leafPool_.get()};
+    // The footer of a preloaded file is not cached.
+    readerOpts.setFilePreloadThreshold(0).setFooterEstimatedSize(100);
+    readerOpts.setFileMetadataCacheKey(FileMetadataCache::Key{sample, "1"});
+    auto reader = createReader(sample, readerOpts);
+    EXPECT_EQ(reader->numberOfRows(), 20ULL);
+    auto rowReaderOpts = getReaderOpts(sampleSchema());
+    rowReaderOpts.setScanSpec(makeScanSpec(sampleSchema()));
+    rowReaderOpts.range(offset, length);
+    auto rowReader = reader->createRowReader(rowReaderOpts);
+    auto expected = makeRowVector({
+        makeFlatVector<int64_t>(numRows, [](auto row) { return row + 1; }),
+        makeFlatVector<double>(numRows, [](auto row) { return row + 1; }),
+    });
+    assertReadWithReaderAndExpected(
+        sampleSchema(), *rowReader, expected, *leafPool_);
+  };
+
+  // The first reader parses the footer and reads only the first row group.
+  read(0, 200, 10);
+  auto stats = FileMetadataCache::instance()->stats();
+  ASSERT_EQ(stats.numEntries, 1);
+  ASSERT_EQ(stats.numMisses, 1);
+  ASSERT_EQ(stats.numHits, 0);
+
+  // The second reader gets the unmodified metadata of both row groups from the
+  // cache.
+  read(0, 1'000, 20);
+  stats = FileMetadataCache::instance()->stats();
+  ASSERT_EQ(stats.numMisses, 1);
+  ASSERT_EQ(stats.numHits, 1);
+}
+
 TEST_F(ParquetReaderTest, parseSampleRange2) {
   const std::string sample(getExampleFilePath("sample.parquet"));
 
@@ -916,6 +960,44 @@ TEST_F(ParquetReaderTest, readSampleBigintRangeFilter) {
       "sample.parquet", sampleSchema(), std::move(filters), expected);
 }
 
+TEST_F(ParquetReaderTest, parallelDecoding) {
+  const std::string sample(getExampleFilePath("sample.parquet"));
+  dwio::common::ReaderOptions readerOptions{leafPool_.get()};
+  auto executor = std::make_shared<folly::CPUThreadPoolExecutor>(2);
+
+  auto read = [&](std::shared_ptr<common::Filter> filter,
+                  const RowVectorPtr& expected) {
+    auto reader = createReader(sample, readerOptions);
+    auto rowReaderOpts = getReaderOpts(sampleSchema());
+    auto scanSpec = makeScanSpec(sampleSchema());
+    if (filter) {
+      scanSpec->childByName("a")->setFilter(std::move(filter));
+    }
+    rowReaderOpts.setScanSpec(scanSpec);
+    rowReaderOpts.setDecodingExecutor(executor);
+    rowReaderOpts.setDecodingParallelismFactor(2);
+    auto rowReader = reader->createRowReader(rowReaderOpts);
+    assertReadWithReaderAndExpected(
+        sampleSchema(), *rowReader, expected, *leafPool_);
+  };
+
+  // Both columns are decoded in parallel.
+  read(
+      nullptr,
+      makeRowVector({
+          makeFlatVector<int64_t>(20, [](auto row) { return row + 1; }),
+          makeFlatVector<double>(20, [](auto row) { return row + 1; }),
+      }));
+
+  // The filter column is read first and 'b' only for the passing rows.
+  read(
+      exec::between(16, 20),
+      makeRowVector({
+          makeFlatVector<int64_t>(5, [](auto row) { return row + 16; }),
+          makeFlatVector<double>(5, [](auto row) { return row + 16; }),
+      }));
+}
+
 TEST_F(ParquetReaderTest, readSampleBigintValuesUsingBitmaskFilter) {
   // Read sample.parquet with the int filter "a in 16, 17, 18, 19, 20".
   std::vector<int64_t> values{16, 17, 18, 19, 20};
@@ -1426,6 +1508,47 @@ TEST_F(ParquetReaderTest, readComplexType) {
       "foo");
 }
 
+TEST_F(ParquetReaderTest, readStringDictionaryAsFlat) {
+  const std::string sample(
+      getExampleFilePath("complex_with_varchar_varbinary.parquet"));
+  dwio::common::ReaderOptions readerOptions{leafPool_.get()};
+  auto outputRowType =
+      ROW({"a", "b", "c", "d"},
+          {ARRAY(VARCHAR()),
+           ARRAY(VARBINARY()),
+           MAP(VARCHAR(), BIGINT()),
+           MAP(VARBINARY(), BIGINT())});
+  readerOptions.setFileSchema(outputRowType);
+  auto reader = createReader(sample, readerOptions);
+
+  auto rowReaderOpts = getReaderOpts(outputRowType);
+  auto scanSpec = makeScanSpec(outputRowType);
+  scanSpec->childByName("a")
+      ->childByName(common::ScanSpec::kArrayElementsFieldName)
+      ->setMakeFlat(true);
+  rowReaderOpts.setScanSpec(scanSpec);
+  auto rowReader = reader->createRowReader(rowReaderOpts);
+
+  VectorPtr result = BaseVector::create(outputRowType, 0, &(*leafPool_));
+  rowReader->next(1, result);
+  auto aColVector = result->as<RowVector>()
+                        ->childAt(0)
+                        ->loadedVector()
+                        ->as<ArrayVector>()
+                        ->elements();
+  EXPECT_EQ(aColVector->size(), 3);
+  ASSERT_EQ(aColVector->encoding(), VectorEncoding::Simple::FLAT);
+  EXPECT_EQ(aColVector->asFlatVector<StringView>()->valueAt(0).str(), "AAAA");
+
+  // Columns without the flag keep the dictionary.
+  auto mapKeys = result->as<RowVector>()
+                     ->childAt(2)
+                     ->loadedVector()
+                     ->as<MapVector>()
+                     ->mapKeys();
+  EXPECT_EQ(mapKeys->encoding(), VectorEncoding::Simple::DICTIONARY);
+}
+
 TEST_F(ParquetReaderTest, readFixedLenBinaryAsStringFromUuid) {
   const std::string filename("uuid.parquet");
   const std::string sample(getExampleFilePath(filename));
@@ -409,6 +409,62 @@ TEST_F(ParquetTableScanTest, lazy) {
   ASSERT_TRUE(waitForTaskCompletion(cursor->task().get()));
 }
 
+TEST_F(ParquetTableScanTest, lazyNestedWithSiblingFilter) {
+  // A filter on 'id' passes 1% of the rows. The array of structs stays lazy
+  // and is decoded only for the passing rows when loaded.
+  constexpr int32_t kNumRows = 10'000;
+  std::vector<vector_size_t> offsets;
+  vector_size_t numElements = 0;
+  for (auto i = 0; i < kNumRows; ++i) {
+    offsets.push_back(numElements);
+    numElements += i % 3;
+  }
+  auto elements = makeRowVector(
+      {"k", "v"},
+      {
+          makeFlatVector<int32_t>(numElements, [](auto row) { return row; }),
+          makeFlatVector<int64_t>(
+              numElements, [](auto row) { return row * 7; }),
+      });
+  auto vector = makeRowVector(
+      {"id", "payload"},
+      {
+          makeFlatVector<int64_t>(kNumRows, [](auto row) { return row; }),
+          makeArrayVector(offsets, elements),
+      });
+  auto schema = asRowType(vector->type());
+  auto file = TempFilePath::create();
+  writeToParquetFile(file->getPath(), {vector}, WriterOptions{});
+
+  std::vector<std::string> ids;
+  for (auto i = 0; i < kNumRows; i += 100) {
+    ids.push_back(std::to_string(i));
+  }
+  const auto filter = fmt::format("id in ({})", folly::join(", ", ids));
+  CursorParameters params;
+  params.copyResult = false;
+  params.planNode = PlanBuilder().tableScan(schema, {filter}).planNode();
+  auto cursor = TaskCursor::create(params);
+  cursor->task()->addSplit("0", exec::Split(makeSplit(file->getPath())));
+  cursor->task()->noMoreSplits("0");
+  int32_t numResultRows = 0;
+  while (cursor->moveNext()) {
+    auto* result = cursor->current()->asUnchecked<RowVector>();
+    ASSERT_TRUE(result->childAt(1)->isLazy());
+    auto idVector = BaseVector::loadedVectorShared(result->childAt(0));
+    auto payload = BaseVector::loadedVectorShared(result->childAt(1));
+    for (auto i = 0; i < result->size(); ++i) {
+      const auto id =
+          idVector->asUnchecked<SimpleVector<int64_t>>()->valueAt(i);
+      ASSERT_EQ(id % 100, 0);
+      ASSERT_TRUE(payload->equalValueAt(vector->childAt(1).get(), i, id));
+    }
+    numResultRows += result->size();
+  }
+  ASSERT_EQ(numResultRows, kNumRows / 100);
+  ASSERT_TRUE(waitForTaskCompletion(cursor->task().get()));
+}
+
 TEST_F(ParquetTableScanTest, aggregatePushdown) {
   auto keysVector = makeFlatVector<int64_t>({1, 4, 0, 3, 2});
   auto valuesVector = makeFlatVector<int64_t>({8077, 6883, 5805, 10640, 3582});
@@ -875,6 +875,49 @@ TEST_F(ParquetWriterTest, dictionaryEncodedVector) {
   writeToFile(makeRowVector({wrappedVector}));
 };
 
+TEST_F(ParquetWriterTest, dictionaryAndComplexColumns) {
+  // A complex column only flattens itself. The dictionary encoded sibling
+  // in the input is exported as is.
+  constexpr vector_size_t kSize = 1'000;
+  const auto data = makeRowVector(
+      {"c0", "c1"},
+      {
+          wrapInDictionary(
+              makeIndices(kSize, [](auto row) { return (row * 7) % 100; }),
+              kSize,
+              makeFlatVector<int64_t>(100, [](auto row) { return row * 3; })),
+          makeArrayVector<int32_t>(
+              kSize,
+              [](auto row) { return row % 4; },
+              [](auto index) { return index; }),
+      });
+  const auto schema = asRowType(data->type());
+
+  auto sink = std::make_unique<MemorySink>(
+      200 * 1024 * 1024,
+      dwio::common::FileSink::Options{.pool = leafPool_.get()});
+  auto* sinkPtr = sink.get();
+  parquet::WriterOptions writerOptions;
+  writerOptions.memoryPool = leafPool_.get();
+  auto writer = std::make_unique<parquet::Writer>(
+      std::move(sink), writerOptions, rootPool_, schema);
+  // The Arrow schema of the first input is reused for the second.
+  writer->write(data);
+  writer->write(data);
+  writer->close();
+  ASSERT_EQ(data->childAt(0)->encoding(), VectorEncoding::Simple::DICTIONARY);
+
+  auto expected = BaseVector::create<RowVector>(schema, 2 * kSize, pool());
+  expected->copy(data.get(), 0, 0, kSize);
+  expected->copy(data.get(), kSize, 0, kSize);
+
+  dwio::common::ReaderOptions readerOptions{leafPool_.get()};
+  auto reader = createReaderInMemory(*sinkPtr, readerOptions);
+  ASSERT_EQ(reader->numberOfRows(), 2 * kSize);
+  auto rowReader = createRowReaderWithSchema(std::move(reader), schema);
+  assertReadWithReaderAndExpected(schema, *rowReader, expected, *leafPool_);
+}
+
 } // namespace
 
 int main(int argc, char** argv) {
@@ -427,33 +427,26 @@ void Writer::write(const VectorPtr& data) {
       data->type()->equivalent(*schema_),
       "The file schema type should be equal with the input rowvector type.");
 
-  VectorPtr exportData = data;
-  if (needFlatten(exportData)) {
-    BaseVector::flattenVector(exportData);
-  }
-
-  ArrowArray array;
-  ArrowSchema schema;
-  exportToArrow(exportData, array, generalPool_.get(), options_);
-  exportToArrow(exportData, schema, options_);
+  auto exportData = flattenForExport(data);
 
-  // Convert the arrow schema to Schema and then update the column names based
-  // on schema_.
-  auto arrowSchema = ::arrow::ImportSchema(&schema).ValueOrDie();
-  common::testutil::TestValue::adjust(
-      "facebook::velox::parquet::Writer::write", arrowSchema.get());
-  std::vector<std::shared_ptr<::arrow::Field>> newFields;
-  auto childSize = schema_->size();
-  for (auto i = 0; i < childSize; i++) {
-    newFields.push_back(updateFieldNameRecursive(
-        arrowSchema->fields()[i], *schema_->childAt(i), schema_->nameOf(i)));
-  }
-
-  PARQUET_ASSIGN_OR_THROW(
-      auto recordBatch,
-      ::arrow::ImportRecordBatch(&array, ::arrow::schema(newFields)));
   if (!arrowContext_->schema) {
-    arrowContext_->schema = recordBatch->schema();
+    // The Arrow schema only depends on the type, which is the same for all
+    // inputs, so it is converted once.
+    ArrowSchema schema;
+    exportToArrow(exportData, schema, options_);
+
+    // Convert the arrow schema to Schema and then update the column names
+    // based on schema_.
+    auto arrowSchema = ::arrow::ImportSchema(&schema).ValueOrDie();
+    common::testutil::TestValue::adjust(
+        "facebook::velox::parquet::Writer::write", arrowSchema.get());
+    std::vector<std::shared_ptr<::arrow::Field>> newFields;
+    auto childSize = schema_->size();
+    for (auto i = 0; i < childSize; i++) {
+      newFields.push_back(updateFieldNameRecursive(
+          arrowSchema->fields()[i], *schema_->childAt(i), schema_->nameOf(i)));
+    }
+    arrowContext_->schema = ::arrow::schema(newFields);
     for (int colIdx = 0; colIdx < arrowContext_->schema->num_fields();
          colIdx++) {
       arrowContext_->stagingChunks.push_back(
@@ -461,6 +454,12 @@ void Writer::write(const VectorPtr& data) {
     }
   }
 
+  ArrowArray array;
+  exportToArrow(exportData, array, generalPool_.get(), options_);
+  PARQUET_ASSIGN_OR_THROW(
+      auto recordBatch,
+      ::arrow::ImportRecordBatch(&array, arrowContext_->schema));
+
   auto bytes = data->estimateFlatSize();
   auto numRows = data->size();
   if (flushPolicy_->shouldFlush(getStripeProgress(
@@ -519,20 +518,42 @@ void Writer::setMemoryReclaimers() {
   generalPool_->setReclaimer(exec::MemoryReclaimer::create());
 }
 
-bool Writer::needFlatten(const VectorPtr& data) const {
+// static
+bool Writer::needFlatten(const VectorPtr& column) {
+  const bool isNestedWrapped =
+      (column->encoding() == VectorEncoding::Simple::DICTIONARY ||
+       column->encoding() == VectorEncoding::Simple::CONSTANT) &&
+      column->valueVector() && !column->wrappedVector()->isFlatEncoding();
+  const bool isComplex = !column->isScalar();
+  return isNestedWrapped || isComplex;
+}
+
+// static
+VectorPtr Writer::flattenForExport(const VectorPtr& data) {
   auto rowVector = std::dynamic_pointer_cast<RowVector>(data);
   VELOX_CHECK_NOT_NULL(
       rowVector, "Arrow export expects a RowVector as input data.");
 
   const auto& children = rowVector->children();
-  return std::any_of(children.begin(), children.end(), [](const auto& child) {
-    bool isNestedWrapped =
-        (child->encoding() == VectorEncoding::Simple::DICTIONARY ||
-         child->encoding() == VectorEncoding::Simple::CONSTANT) &&
-        child->valueVector() && !child->wrappedVector()->isFlatEncoding();
-    bool isComplex = !child->isScalar();
-    return isNestedWrapped || isComplex;
-  });
+  if (std::none_of(children.begin(), children.end(), [](const auto& child) {
+        return needFlatten(child);
+      })) {
+    return data;
+  }
+  std::vector<VectorPtr> newChildren;
+  newChildren.reserve(children.size());
+  for (const auto& child : children) {
+    newChildren.push_back(child);
+    if (needFlatten(child)) {
+      BaseVector::flattenVector(newChildren.back());
+    }
+  }
+  return std::make_shared<RowVector>(
+      rowVector->pool(),
+      rowVector->type(),
+      rowVector->nulls(),
+      rowVector->size(),
+      std::move(newChildren));
 }
 
 std::unique_ptr<dwio::common::Writer> ParquetWriterFactory::createWriter(
@@ -196,10 +196,16 @@ class Writer : public dwio::common::Writer {
   // Sets the memory reclaimers for all the memory pools used by this writer.
   void setMemoryReclaimers();
 
-  // Checks if the input data contains a nested wrapped vector or complex
-  // vector. If so, flatten the input to make it compatible with
+  // Checks if a column of the input data is a nested wrapped vector or a
+  // complex vector. If so, the column is flattened to make it compatible with
   // 'exportFlattenedVector' in Arrow export.
-  bool needFlatten(const VectorPtr& data) const;
+  static bool needFlatten(const VectorPtr& column);
+
+  // Returns 'data' with the columns for which needFlatten() is true
+  // flattened. The other columns are exported as is, so that dictionary
+  // encoded scalar columns are not copied and are written as Parquet
+  // dictionary pages.
+  static VectorPtr flattenForExport(const VectorPtr& data);
 
   // Pool for 'stream_'.
   std::shared_ptr<memory::MemoryPool> pool_;
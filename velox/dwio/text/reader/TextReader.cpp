@@ -128,6 +128,20 @@ TextRowReader::TextRowReader(
       fileLength_{getStreamLength()},
       varBinBuf_{
           std::make_shared<dwio::common::DataBuffer<char>>(contents_->pool)} {
+  const auto& serDeOptions = contents_->serDeOptions;
+  lineEndBytes_.fill(false);
+  lineEndBytes_['\n'] = true;
+  lineEndBytes_['\r'] = true;
+  for (auto depth = 0; depth < stopBytes_.size(); ++depth) {
+    stopBytes_[depth] = lineEndBytes_;
+    if (serDeOptions.isEscaped) {
+      stopBytes_[depth][serDeOptions.escapeChar] = true;
+    }
+    for (auto i = 0; i <= depth; ++i) {
+      stopBytes_[depth][serDeOptions.separators[i]] = true;
+    }
+  }
+
   // Seek to first line at or after the specified region.
   if (contents_->compression == CompressionKind::CompressionKind_NONE) {
     /**
@@ -440,6 +454,8 @@ TextRowReader::getString(TextRowReader& th, bool& isNull, DelimType& delim) {
   the end of the chunk.
   */
   while (true) {
+    const auto plainBytes = th.nextPlainBytes(th.stopBytes_[th.depth_]);
+    th.ownedString_.append(plainBytes.data(), plainBytes.size());
     auto v = th.getByteOptimized(delim);
     if (!th.isNone(delim)) {
       break;
@@ -687,9 +703,30 @@ bool TextRowReader::getEOR(DelimType& delim, bool& isNull) {
   return false;
 }
 
+std::string_view TextRowReader::nextPlainBytes(
+    const std::array<bool, 256>& stopBytes) {
+  if (atEOL_ || unreadIdx_ >= unreadData_.size()) {
+    return {};
+  }
+  const auto* data = reinterpret_cast<const uint8_t*>(unreadData_.data());
+  const auto begin = unreadIdx_;
+  auto end = begin;
+  while (end < unreadData_.size() && !stopBytes[data[end]]) {
+    ++end;
+  }
+  if (end == begin) {
+    return {};
+  }
+  unreadIdx_ = end;
+  pos_ += end - begin;
+  atSOL_ = false;
+  return std::string_view(unreadData_.data() + begin, end - begin);
+}
+
 bool TextRowReader::skipLine() {
   DelimType delim = DelimTypeNone;
   while (!atEOL_) {
+    (void)nextPlainBytes(lineEndBytes_);
     (void)getByteOptimized(delim);
   }
   /// TODO: Logically should be >=, kept as it is to align with presto reader
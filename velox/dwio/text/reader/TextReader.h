@@ -19,6 +19,7 @@
 #include <array>
 #include <limits>
 #include <string>
+#include <string_view>
 
 #include "folly/CppAttributes.h"
 #include "velox/dwio/common/BufferedInput.h"
@@ -172,6 +173,12 @@ class TextRowReader : public dwio::common::RowReader {
 
   bool getEOR(DelimType& delim, bool& isNull);
 
+  // Consumes the bytes from the read position up to the first byte for which
+  // 'stopBytes' is true or the end of the buffered data and returns them.
+  // These bytes are neither delimiters nor escapes, so they can be consumed
+  // as a run instead of byte by byte.
+  std::string_view nextPlainBytes(const std::array<bool, 256>& stopBytes);
+
   bool skipLine();
 
   void resetLine();
@@ -222,6 +229,11 @@ class TextRowReader : public dwio::common::RowReader {
   uint64_t fileLength_;
   std::string ownedString_;
   std::shared_ptr<dwio::common::DataBuffer<char>> varBinBuf_;
+  // For each depth, the bytes that end a run of plain bytes in a string: line
+  // ends, the escape character and the separators up to the depth.
+  std::array<std::array<bool, 256>, 8> stopBytes_;
+  // The bytes that end a run of plain bytes when skipping to the next line.
+  std::array<bool, 256> lineEndBytes_;
 };
 
 } // namespace facebook::velox::text
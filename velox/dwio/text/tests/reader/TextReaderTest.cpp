@@ -1688,6 +1688,40 @@ TEST_F(TextReaderTest, nestedRows) {
   ASSERT_EQ(rowReader->next(10, result), 0);
 }
 
+TEST_F(TextReaderTest, escapedAndLongStrings) {
+  // Strings are read in runs up to the next delimiter, escape or line end.
+  auto expected = makeRowVector({
+      makeFlatVector<std::string>(
+          {"plain text of some length", "esc,aped", std::string(300, 'x')}),
+      makeNullableFlatVector<std::string>(
+          {"second", "with\nnewline", std::nullopt}),
+  });
+  const auto type = ROW({{"c0", VARCHAR()}, {"c1", VARCHAR()}});
+  auto factory = dwio::common::getReaderFactory(dwio::common::FileFormat::TEXT);
+  auto path = velox::test::getDataFilePath(
+      "velox/dwio/text/tests/reader/", "examples/escaped_long_strings");
+  auto readFile = std::make_shared<LocalReadFile>(path);
+
+  auto readerOptions = dwio::common::ReaderOptions(pool());
+  readerOptions.setFileSchema(type);
+  readerOptions.setSerDeOptions(
+      dwio::common::SerDeOptions(',', '|', '#', '\\', true));
+  auto input =
+      std::make_unique<dwio::common::BufferedInput>(readFile, poolRef());
+  auto reader = factory->createReader(std::move(input), readerOptions);
+  auto rowReaderOptions = dwio::common::RowReaderOptions();
+  setScanSpec(*type, rowReaderOptions);
+  auto rowReader = reader->createRowReader(rowReaderOptions);
+
+  VectorPtr result;
+  ASSERT_EQ(rowReader->next(10, result), 3);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(result->equalValueAt(expected.get(), i, i))
+        << result->toString(i) << " vs " << expected->toString(i);
+  }
+  ASSERT_EQ(rowReader->next(10, result), 0);
+}
+
 } // namespace
 
 } // namespace facebook::velox::text
@@ -523,6 +523,12 @@ struct AggregateFunctionMetadata {
 
   /// Indicates if this is a companion function.
   bool companionFunction{false};
+
+  /// True if the accumulators of the function only append to the
+  /// HashStringAllocator of the grouping set and free their memory only when
+  /// the groups are destroyed. Grouping sets where all aggregates are append
+  /// only use a bump allocating HashStringAllocator.
+  bool appendOnly{false};
 };
 /// Register an aggregate function with the specified name and signatures. If
 /// registerCompanionFunctions is true, also register companion aggregate and
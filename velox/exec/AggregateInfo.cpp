@@ -116,6 +116,7 @@ std::vector<AggregateInfo> toAggregateInfo(
     // order of inputs.
     auto* entry = getAggregateFunctionEntry(aggregate.call->name());
     const auto& metadata = entry->metadata;
+    info.appendOnly = metadata.appendOnly;
     if (metadata.orderSensitive) {
       // Sorting keys and orders.
       const auto numSortingKeys = aggregate.sortingKeys.size();
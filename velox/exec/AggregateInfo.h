@@ -48,6 +48,10 @@ struct AggregateInfo {
   /// aggregating.
   bool distinct{false};
 
+  /// True if the function is registered as append only. See
+  /// AggregateFunctionMetadata::appendOnly.
+  bool appendOnly{false};
+
   /// Index of the result column in the output RowVector.
   column_index_t output{0};
 
@@ -15,6 +15,7 @@
  */
 
 #include "velox/exec/AggregateWindow.h"
+#include <folly/container/F14Set.h>
 #include "velox/common/base/Exceptions.h"
 #include "velox/exec/Aggregate.h"
 #include "velox/exec/WindowFunction.h"
@@ -25,12 +26,35 @@ namespace facebook::velox::exec {
 
 namespace {
 
+// Aggregates whose result does not depend on the order in which
+// accumulators are combined. These may be computed from a segment tree.
+bool supportsSegmentTree(const std::string& name) {
+  static const folly::F14FastSet<std::string> kAggregates = {
+      "sum", "min", "max", "count", "avg"};
+  const auto pos = name.rfind('.');
+  return kAggregates.contains(
+      pos == std::string::npos ? name : name.substr(pos + 1));
+}
+
 // A generic way to compute any aggregation used as a window function.
 // Creates an Aggregate function object for the window function invocation.
 // At each row, computes the aggregation across all rows from the frameStart
 // to frameEnd boundaries at that row using singleGroup.
+//
+// Sliding frames over many rows are computed from a segment tree instead for
+// the aggregates that support it. Each node of the tree holds the
+// intermediate result of kSegmentTreeFanout consecutive nodes of the level
+// below, or rows of the partition for the first level. A frame is then
+// combined from O(kSegmentTreeFanout * log(frame size)) nodes and rows.
 class AggregateWindowFunction : public exec::WindowFunction {
  public:
+  // Number of rows or lower level nodes combined in a segment tree node.
+  static constexpr vector_size_t kSegmentTreeFanout = 16;
+
+  // Minimum average number of rows in the frames of an output block for
+  // using the segment tree.
+  static constexpr vector_size_t kMinSegmentTreeFrameRows = 64;
+
   AggregateWindowFunction(
       const std::string& name,
       const std::vector<exec::WindowFunctionArg>& args,
@@ -91,6 +115,10 @@ class AggregateWindowFunction : public exec::WindowFunction {
         /* needed for out of line allocations */ kRowSizeOffset);
     singleGroupRowSize_ += aggregate_->accumulatorFixedWidthSize();
 
+    // Groups are laid out back to back in segment tree computations.
+    groupRowSize_ = bits::roundUp(
+        singleGroupRowSize_, aggregate_->accumulatorAlignmentSize());
+
     // Construct the single row in the MemoryPool.
     singleGroupRowBufferPtr_ =
         AlignedBuffer::allocate<char>(singleGroupRowSize_, pool_);
@@ -110,12 +138,16 @@ class AggregateWindowFunction : public exec::WindowFunction {
       std::vector<char*> singleGroupRowVector = {rawSingleGroupRow_};
       aggregate_->destroy(folly::Range(singleGroupRowVector.data(), 1));
     }
+    destroyGroups();
   }
 
   void resetPartition(const exec::WindowPartition* partition) override {
     partition_ = partition;
 
     previousFrameMetadata_.reset();
+    segmentTree_.clear();
+    partitionArgs_.clear();
+    segmentTreeFailed_ = false;
   }
 
   void apply(
@@ -163,7 +195,14 @@ class AggregateWindowFunction : public exec::WindowFunction {
           rawFrameEnds,
           resultOffset,
           result);
-    } else {
+    } else if (!useSegmentTree(
+                   validRows, frameMetadata, rawFrameStarts, rawFrameEnds) ||
+               !segmentTreeAggregation(
+                   validRows,
+                   rawFrameStarts,
+                   rawFrameEnds,
+                   resultOffset,
+                   result)) {
       fillArgVectors(frameMetadata.firstRow, frameMetadata.lastRow);
       simpleAggregation(
           validRows,
@@ -345,6 +384,205 @@ class AggregateWindowFunction : public exec::WindowFunction {
     setEmptyFramesResult(validRows, resultOffset, emptyResult_, result);
   }
 
+  // Returns true if the frames of 'validRows' are large enough on average to
+  // be computed from the segment tree. The tree is built over the whole
+  // partition, so partial partitions of streaming window builds are not
+  // supported.
+  bool useSegmentTree(
+      const SelectivityVector& validRows,
+      const FrameMetadata& frameMetadata,
+      const vector_size_t* rawFrameStarts,
+      const vector_size_t* rawFrameEnds) const {
+    if (!supportsSegmentTree_ || segmentTreeFailed_ || partition_->partial() ||
+        frameMetadata.lastRow + 1 - frameMetadata.firstRow <
+            kMinSegmentTreeFrameRows) {
+      return false;
+    }
+    int64_t numFrameRows = 0;
+    validRows.applyToSelected([&](auto i) {
+      numFrameRows += rawFrameEnds[i] + 1 - rawFrameStarts[i];
+    });
+    return numFrameRows >=
+        static_cast<int64_t>(kMinSegmentTreeFrameRows) *
+        validRows.countSelected();
+  }
+
+  // Initializes 'numGroups' groups in 'groups_'.
+  void initializeGroups(vector_size_t numGroups) {
+    destroyGroups();
+    const auto numBytes = numGroups * groupRowSize_;
+    if (groupRows_ == nullptr || groupRows_->capacity() < numBytes) {
+      groupRows_ = AlignedBuffer::allocate<char>(numBytes, pool_);
+    }
+    auto* rawGroupRows = groupRows_->asMutable<char>();
+    memset(rawGroupRows, 0, numBytes);
+    groups_.resize(numGroups);
+    std::vector<vector_size_t> indices(numGroups);
+    for (auto i = 0; i < numGroups; ++i) {
+      groups_[i] = rawGroupRows + i * groupRowSize_;
+      indices[i] = i;
+    }
+    aggregate_->clear();
+    aggregate_->initializeNewGroups(groups_.data(), indices);
+  }
+
+  // Frees any out of line storage of the accumulators in 'groups_'.
+  void destroyGroups() {
+    if (!groups_.empty()) {
+      aggregate_->destroy(folly::Range(groups_.data(), groups_.size()));
+      groups_.clear();
+    }
+  }
+
+  // Adds row or node 'inputs[i]' to group 'groups_[groupIndices[i]]' for all
+  // i. 'level' is 0 for rows of the partition and the level of the nodes + 1
+  // otherwise.
+  void addToGroups(
+      int32_t level,
+      const std::vector<vector_size_t>& inputs,
+      const std::vector<vector_size_t>& groupIndices) {
+    const vector_size_t numInputs = inputs.size();
+    if (numInputs == 0) {
+      return;
+    }
+    auto indices = allocateIndices(numInputs, pool_);
+    memcpy(
+        indices->asMutable<vector_size_t>(),
+        inputs.data(),
+        numInputs * sizeof(vector_size_t));
+    std::vector<char*> groups(numInputs);
+    for (auto i = 0; i < numInputs; ++i) {
+      groups[i] = groups_[groupIndices[i]];
+    }
+    SelectivityVector rows(numInputs);
+    if (level == 0) {
+      std::vector<VectorPtr> args;
+      args.reserve(partitionArgs_.size());
+      for (const auto& arg : partitionArgs_) {
+        args.push_back(
+            BaseVector::wrapInDictionary(nullptr, indices, numInputs, arg));
+      }
+      aggregate_->addRawInput(groups.data(), rows, args, false);
+    } else {
+      aggregate_->addIntermediateResults(
+          groups.data(),
+          rows,
+          {BaseVector::wrapInDictionary(
+              nullptr, indices, numInputs, segmentTree_[level - 1])},
+          false);
+    }
+  }
+
+  // Builds 'segmentTree_' over all rows of 'partition_'.
+  void buildSegmentTree() {
+    const auto numRows = partition_->numRows();
+    partitionArgs_.resize(argIndices_.size());
+    for (auto i = 0; i < argIndices_.size(); ++i) {
+      if (argIndices_[i] == kConstantChannel) {
+        partitionArgs_[i] =
+            BaseVector::wrapInConstant(numRows, 0, argVectors_[i]);
+      } else {
+        partitionArgs_[i] = BaseVector::create(argTypes_[i], numRows, pool_);
+        partition_->extractColumn(
+            argIndices_[i], 0, numRows, 0, partitionArgs_[i]);
+      }
+    }
+
+    // Each level has at least kSegmentTreeFanout nodes, so that a frame may
+    // span a full node of the next level.
+    std::vector<vector_size_t> inputs;
+    std::vector<vector_size_t> groupIndices;
+    for (vector_size_t numInputs = numRows; numInputs >= kSegmentTreeFanout;
+         numInputs = bits::divRoundUp(numInputs, kSegmentTreeFanout)) {
+      const auto numNodes = bits::divRoundUp(numInputs, kSegmentTreeFanout);
+      initializeGroups(numNodes);
+      inputs.resize(numInputs);
+      groupIndices.resize(numInputs);
+      for (auto i = 0; i < numInputs; ++i) {
+        inputs[i] = i;
+        groupIndices[i] = i / kSegmentTreeFanout;
+      }
+      addToGroups(segmentTree_.size(), inputs, groupIndices);
+      VectorPtr nodes;
+      aggregate_->extractAccumulators(groups_.data(), numNodes, &nodes);
+      segmentTree_.push_back(std::move(nodes));
+    }
+    destroyGroups();
+  }
+
+  // Computes the frames of 'validRows' from the segment tree. Returns false
+  // if the aggregate fails, e.g. on overflow in a sum of nodes, so that the
+  // frames are computed row by row and errors are reported as usual.
+  bool segmentTreeAggregation(
+      const SelectivityVector& validRows,
+      const vector_size_t* rawFrameStarts,
+      const vector_size_t* rawFrameEnds,
+      vector_size_t resultOffset,
+      const VectorPtr& result) {
+    try {
+      if (segmentTree_.empty()) {
+        buildSegmentTree();
+      }
+
+      // The rows and nodes to combine for each frame at each level.
+      std::vector<std::vector<vector_size_t>> inputs(segmentTree_.size() + 1);
+      std::vector<std::vector<vector_size_t>> groupIndices(inputs.size());
+      auto addRange = [&](int32_t level,
+                          vector_size_t begin,
+                          vector_size_t end,
+                          vector_size_t group) {
+        for (auto i = begin; i < end; ++i) {
+          inputs[level].push_back(i);
+          groupIndices[level].push_back(group);
+        }
+      };
+      const auto numGroups = validRows.countSelected();
+      vector_size_t group = 0;
+      validRows.applyToSelected([&](auto row) {
+        vector_size_t begin = rawFrameStarts[row];
+        vector_size_t end = rawFrameEnds[row] + 1;
+        int32_t level = 0;
+        for (;;) {
+          const auto fullBegin = bits::roundUp(begin, kSegmentTreeFanout);
+          const auto fullEnd = end / kSegmentTreeFanout * kSegmentTreeFanout;
+          if (level == segmentTree_.size() || fullBegin >= fullEnd) {
+            addRange(level, begin, end, group);
+            break;
+          }
+          addRange(level, begin, fullBegin, group);
+          addRange(level, fullEnd, end, group);
+          begin = fullBegin / kSegmentTreeFanout;
+          end = fullEnd / kSegmentTreeFanout;
+          ++level;
+        }
+        ++group;
+      });
+
+      initializeGroups(numGroups);
+      for (auto level = 0; level < inputs.size(); ++level) {
+        addToGroups(level, inputs[level], groupIndices[level]);
+      }
+      BaseVector::prepareForReuse(aggregateResultVector_, numGroups);
+      aggregate_->extractValues(
+          groups_.data(), numGroups, &aggregateResultVector_);
+    } catch (const VeloxException&) {
+      destroyGroups();
+      segmentTreeFailed_ = true;
+      return false;
+    }
+    destroyGroups();
+
+    vector_size_t group = 0;
+    validRows.applyToSelected([&](auto row) {
+      result->copy(aggregateResultVector_.get(), resultOffset + row, group, 1);
+      ++group;
+    });
+
+    // Set null values for empty (non valid) frames in the output block.
+    setEmptyFramesResult(validRows, resultOffset, emptyResult_, result);
+    return true;
+  }
+
   // Precompute and save the aggregate output for empty input in emptyResult_.
   // This value is returned for rows with empty frames.
   void computeDefaultAggregateValue(const TypePtr& resultType) {
@@ -389,6 +627,27 @@ class AggregateWindowFunction : public exec::WindowFunction {
   // to optimize aggregate computation and reading argument vectors.
   std::optional<FrameMetadata> previousFrameMetadata_;
 
+  // True if the aggregate may be computed from 'segmentTree_'.
+  bool supportsSegmentTree_{false};
+
+  // True if computing a frame from 'segmentTree_' failed for the current
+  // partition.
+  bool segmentTreeFailed_{false};
+
+  // The argument vectors for all rows of the current partition. Set when
+  // building 'segmentTree_'.
+  std::vector<VectorPtr> partitionArgs_;
+
+  // Intermediate results of the nodes of the segment tree over the current
+  // partition, one vector per level from the bottom. Built on first use.
+  std::vector<VectorPtr> segmentTree_;
+
+  // Groups for building 'segmentTree_' and computing frames from it. Each
+  // group takes 'groupRowSize_' bytes of 'groupRows_'.
+  BufferPtr groupRows_;
+  std::vector<char*> groups_;
+  vector_size_t groupRowSize_;
+
   // Stores default result value for empty frame aggregation. Window functions
   // return the default value of an aggregate (aggregation with no rows) for
   // empty frames. e.g. count for empty frames should return 0 and not null.
@@ -15,6 +15,7 @@
  */
 
 #include "velox/exec/ContainerRowSerde.h"
+#include <cstring>
 #include "velox/type/FloatingPointUtil.h"
 #include "velox/vector/ComplexVector.h"
 #include "velox/vector/FlatVector.h"
@@ -1051,6 +1052,82 @@ uint64_t hashSwitch(ByteInputStream& in, const Type* type) {
       hashOne, typeProvidesCustomComparison, type->kind(), in, type);
 }
 
+// Fixed-width layouts. Values are read from a contiguous serialization and
+// 'data' is advanced past the value.
+bool isFixedWidthScalar(const Type& type) {
+  return type.isPrimitiveType() && type.isFixedWidth() &&
+      type.kind() != TypeKind::UNKNOWN && !type.providesCustomComparison();
+}
+
+template <typename T>
+T readFixedWidth(const char*& data) {
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  data += sizeof(T);
+  return value;
+}
+
+template <TypeKind Kind>
+int32_t compareFixedWidthValue(
+    const char*& left,
+    const char*& right,
+    CompareFlags flags) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  const auto result = SimpleVector<T>::comparePrimitiveAsc(
+      readFixedWidth<T>(left), readFixedWidth<T>(right));
+  return flags.ascending ? result : result * -1;
+}
+
+template <TypeKind Kind>
+uint64_t hashFixedWidthValue(const char*& data) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  const auto value = readFixedWidth<T>(data);
+  if constexpr (std::is_floating_point_v<T>) {
+    return util::floating_point::NaNAwareHash<T>()(value);
+  } else {
+    return folly::hasher<T>()(value);
+  }
+}
+
+// Compares the fields of ROW 'type' or the elements of ARRAY 'type' from
+// 'left' and 'right'. Each side starts with the null flags of its 'size'
+// values followed by its non-null values. Values up to the smaller size are
+// compared before the sizes.
+int32_t compareFixedWidthValues(
+    const char* left,
+    const char* right,
+    int32_t leftSize,
+    int32_t rightSize,
+    const Type& type,
+    CompareFlags flags) {
+  const bool isRow = type.kind() == TypeKind::ROW;
+  // Null flags are read one byte at a time since they may not be aligned.
+  const auto* leftNulls = reinterpret_cast<const uint8_t*>(left);
+  const auto* rightNulls = reinterpret_cast<const uint8_t*>(right);
+  left += bits::nwords(leftSize) * sizeof(uint64_t);
+  right += bits::nwords(rightSize) * sizeof(uint64_t);
+  const auto compareSize = std::min(leftSize, rightSize);
+  for (auto i = 0; i < compareSize; ++i) {
+    const bool leftNull = bits::isBitSet(leftNulls, i);
+    const bool rightNull = bits::isBitSet(rightNulls, i);
+    if (leftNull || rightNull) {
+      const auto result =
+          BaseVector::compareNulls(leftNull, rightNull, flags).value();
+      if (result != 0) {
+        return result;
+      }
+      continue;
+    }
+    const auto kind = type.childAt(isRow ? i : 0)->kind();
+    const auto result = VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+        compareFixedWidthValue, kind, left, right, flags);
+    if (result != 0) {
+      return result;
+    }
+  }
+  return flags.ascending ? (leftSize - rightSize) : (rightSize - leftSize);
+}
+
 } // namespace
 
 // static
@@ -1140,4 +1217,64 @@ uint64_t ContainerRowSerde::hash(ByteInputStream& in, const Type* type) {
   }
 }
 
+// static
+bool ContainerRowSerde::isFixedWidthComplexType(const Type& type) {
+  if (type.kind() == TypeKind::ARRAY) {
+    return isFixedWidthScalar(*type.childAt(0));
+  }
+  if (type.kind() != TypeKind::ROW) {
+    return false;
+  }
+  for (const auto& child : type.asRow().children()) {
+    if (!isFixedWidthScalar(*child)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// static
+int32_t ContainerRowSerde::compareFixedWidth(
+    std::string_view left,
+    std::string_view right,
+    const Type& type,
+    CompareFlags flags) {
+  VELOX_DCHECK(flags.nullAsValue(), "not supported null handling mode");
+  VELOX_DCHECK(isFixedWidthComplexType(type));
+  // The null flags and the number of values determine the size of the
+  // serialization, so values of different sizes are not equal.
+  if (flags.equalsOnly && left.size() != right.size()) {
+    return flags.ascending ? 1 : -1;
+  }
+  const char* leftData = left.data();
+  const char* rightData = right.data();
+  if (type.kind() == TypeKind::ROW) {
+    return compareFixedWidthValues(
+        leftData, rightData, type.size(), type.size(), type, flags);
+  }
+  const auto leftSize = readFixedWidth<int32_t>(leftData);
+  const auto rightSize = readFixedWidth<int32_t>(rightData);
+  return compareFixedWidthValues(
+      leftData, rightData, leftSize, rightSize, type, flags);
+}
+
+// static
+uint64_t ContainerRowSerde::hashFixedWidth(const char* data, const Type& type) {
+  VELOX_DCHECK(isFixedWidthComplexType(type));
+  const bool isRow = type.kind() == TypeKind::ROW;
+  const int32_t size =
+      isRow ? static_cast<int32_t>(type.size()) : readFixedWidth<int32_t>(data);
+  const auto* nulls = reinterpret_cast<const uint8_t*>(data);
+  data += bits::nwords(size) * sizeof(uint64_t);
+  uint64_t hash = BaseVector::kNullHash;
+  for (auto i = 0; i < size; ++i) {
+    const auto kind = type.childAt(isRow ? i : 0)->kind();
+    const auto value = bits::isBitSet(nulls, i)
+        ? BaseVector::kNullHash
+        : VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(hashFixedWidthValue, kind, data);
+    hash = (isRow && i == 0) ? value : bits::hashMix(hash, value);
+  }
+  return hash;
+}
+
 } // namespace facebook::velox::exec
@@ -87,6 +87,27 @@ class ContainerRowSerde {
       CompareFlags flags);
 
   static uint64_t hash(ByteInputStream& data, const Type* type);
+
+  /// Returns true if 'type' is a ROW of fixed-width scalar fields or an ARRAY
+  /// of fixed-width scalar elements and no field or element type provides
+  /// custom comparison. The serialization of such a value is a fixed layout
+  /// of null flags and values, which compareFixedWidth() and hashFixedWidth()
+  /// read directly, without a ByteInputStream and a type dispatch for every
+  /// field or element.
+  static bool isFixedWidthComplexType(const Type& type);
+
+  /// Returns the same result as compare() for the contiguous serializations
+  /// 'left' and 'right' of a type for which isFixedWidthComplexType() is
+  /// true.
+  static int32_t compareFixedWidth(
+      std::string_view left,
+      std::string_view right,
+      const Type& type,
+      CompareFlags flags);
+
+  /// Returns the same result as hash() for the contiguous serialization
+  /// 'data' of a type for which isFixedWidthComplexType() is true.
+  static uint64_t hashFixedWidth(const char* data, const Type& type);
 };
 
 } // namespace facebook::velox::exec
@@ -46,10 +46,7 @@ exec::BlockingReason TaskQueue::enqueue(
   if (!vector) {
     std::lock_guard<std::mutex> l(mutex_);
     ++producersFinished_;
-    if (consumerBlocked_) {
-      consumerBlocked_ = false;
-      consumerPromise_.setValue();
-    }
+    notifyConsumersLocked();
     return exec::BlockingReason::kNotBlocked;
   }
 
@@ -63,10 +60,7 @@ exec::BlockingReason TaskQueue::enqueue(
   }
   queue_.push_back(std::move(entry));
   totalBytes_ += bytes;
-  if (consumerBlocked_) {
-    consumerBlocked_ = false;
-    consumerPromise_.setValue();
-  }
+  notifyConsumersLocked();
   if (totalBytes_ > maxBytes_) {
     auto [unblockPromise, unblockFuture] = makeVeloxContinuePromiseContract();
     producerUnblockPromises_.emplace_back(std::move(unblockPromise));
@@ -76,10 +70,11 @@ exec::BlockingReason TaskQueue::enqueue(
   return exec::BlockingReason::kNotBlocked;
 }
 
-RowVectorPtr TaskQueue::dequeue() {
+RowVectorPtr TaskQueue::dequeue(uint64_t* sequenceNumber) {
   for (;;) {
     RowVectorPtr vector;
     std::vector<ContinuePromise> mayContinue;
+    ContinueFuture consumerFuture = ContinueFuture::makeEmpty();
     {
       std::lock_guard<std::mutex> l(mutex_);
       if (closed_) {
@@ -91,6 +86,10 @@ RowVectorPtr TaskQueue::dequeue() {
         queue_.pop_front();
         totalBytes_ -= result.bytes;
         vector = std::move(result.vector);
+        if (sequenceNumber != nullptr) {
+          *sequenceNumber = numDequeued_;
+        }
+        ++numDequeued_;
         if (totalBytes_ < maxBytes_ / 2) {
           mayContinue = std::move(producerUnblockPromises_);
         }
@@ -99,9 +98,9 @@ RowVectorPtr TaskQueue::dequeue() {
         return nullptr;
       }
       if (!vector) {
-        consumerBlocked_ = true;
-        consumerPromise_ = ContinuePromise();
-        consumerFuture_ = consumerPromise_.getFuture();
+        auto [consumerPromise, future] = makeVeloxContinuePromiseContract();
+        consumerPromises_.emplace_back(std::move(consumerPromise));
+        consumerFuture = std::move(future);
       }
     }
     // outside of 'mutex_'
@@ -111,7 +110,7 @@ RowVectorPtr TaskQueue::dequeue() {
     if (vector) {
       return vector;
     }
-    consumerFuture_.wait();
+    consumerFuture.wait();
   }
 }
 
@@ -125,10 +124,14 @@ void TaskQueue::close() {
   producerUnblockPromises_.clear();
 
   // Unblock consumers.
-  if (consumerBlocked_) {
-    consumerBlocked_ = false;
-    consumerPromise_.setValue();
+  notifyConsumersLocked();
+}
+
+void TaskQueue::notifyConsumersLocked() {
+  for (auto& promise : consumerPromises_) {
+    promise.setValue();
   }
+  consumerPromises_.clear();
 }
 
 bool TaskQueue::hasNext() {
@@ -136,7 +139,49 @@ bool TaskQueue::hasNext() {
   return !queue_.empty();
 }
 
-class TaskCursorBase : public TaskCursor {
+namespace {
+// Adds 'vector' from an output driver to 'queue'. Copies 'vector' into the
+// pool of 'queue' if 'copyResult' is true.
+BlockingReason enqueueResult(
+    TaskQueue& queue,
+    const RowVectorPtr& vector,
+    bool copyResult,
+    ContinueFuture* future) {
+  if (!vector || !copyResult) {
+    return queue.enqueue(vector, future);
+  }
+  // Make sure to load lazy vector if not loaded already.
+  for (auto& child : vector->children()) {
+    child->loadedVector();
+  }
+  auto copy = BaseVector::create<RowVector>(
+      vector->type(), vector->size(), queue.pool());
+  copy->copy(vector.get(), 0, 0, vector->size());
+  return queue.enqueue(std::move(copy), future);
+}
+
+// Rethrows the error of 'task' if it failed.
+void checkTaskError(Task& task) {
+  if (!task.error()) {
+    return;
+  }
+  // Wait for the task to finish (there's' a small period of time between
+  // when the error is set on the Task and terminate is called).
+  task.taskCompletionFuture()
+      .within(std::chrono::microseconds(5'000'000))
+      .wait();
+
+  // Wait for all task drivers to finish to avoid destroying the executor_
+  // before task_ finished using it and causing a crash.
+  waitForTaskDriversToFinish(&task);
+  std::rethrow_exception(task.error());
+}
+} // namespace
+
+// Creates the query context and plan fragment of the task of a cursor.
+// 'Cursor' is the interface the cursor implements.
+template <typename Cursor>
+class TaskCursorBase : public Cursor {
  public:
   TaskCursorBase(
       const CursorParameters& params,
@@ -204,7 +249,7 @@ class TaskCursorBase : public TaskCursor {
   std::shared_ptr<folly::Executor> executor_;
 };
 
-class MultiThreadedTaskCursor : public TaskCursorBase {
+class MultiThreadedTaskCursor : public TaskCursorBase<TaskCursor> {
  public:
   explicit MultiThreadedTaskCursor(const CursorParameters& params)
       : TaskCursorBase(
@@ -237,17 +282,7 @@ class MultiThreadedTaskCursor : public TaskCursorBase {
             velox::ContinueFuture* future) {
           VELOX_CHECK(
               !drained, "Unexpected drain in multithreaded task cursor");
-          if (!vector || !copyResult) {
-            return queue->enqueue(vector, future);
-          }
-          // Make sure to load lazy vector if not loaded already.
-          for (auto& child : vector->children()) {
-            child->loadedVector();
-          }
-          auto copy = BaseVector::create<RowVector>(
-              vector->type(), vector->size(), queue->pool());
-          copy->copy(vector.get(), 0, 0, vector->size());
-          return queue->enqueue(std::move(copy), future);
+          return enqueueResult(*queue, vector, copyResult, future);
         },
         0,
         [queue](std::exception_ptr) {
@@ -336,19 +371,7 @@ class MultiThreadedTaskCursor : public TaskCursorBase {
 
  private:
   void checkTaskError() {
-    if (!task_->error()) {
-      return;
-    }
-    // Wait for the task to finish (there's' a small period of time between
-    // when the error is set on the Task and terminate is called).
-    task_->taskCompletionFuture()
-        .within(std::chrono::microseconds(5'000'000))
-        .wait();
-
-    // Wait for all task drivers to finish to avoid destroying the executor_
-    // before task_ finished using it and causing a crash.
-    waitForTaskDriversToFinish(task_.get());
-    std::rethrow_exception(task_->error());
+    exec::checkTaskError(*task_);
   }
 
   const int32_t maxDrivers_;
@@ -364,7 +387,7 @@ class MultiThreadedTaskCursor : public TaskCursorBase {
   std::exception_ptr error_;
 };
 
-class SingleThreadedTaskCursor : public TaskCursorBase {
+class SingleThreadedTaskCursor : public TaskCursorBase<TaskCursor> {
  public:
   explicit SingleThreadedTaskCursor(const CursorParameters& params)
       : TaskCursorBase(params, nullptr) {
@@ -472,6 +495,152 @@ std::unique_ptr<TaskCursor> TaskCursor::create(const CursorParameters& params) {
   return std::make_unique<MultiThreadedTaskCursor>(params);
 }
 
+class MultiConsumerTaskCursor : public TaskCursorBase<ParallelTaskCursor> {
+ public:
+  explicit MultiConsumerTaskCursor(const CursorParameters& params)
+      : TaskCursorBase(
+            params,
+            std::make_shared<folly::CPUThreadPoolExecutor>(
+                std::thread::hardware_concurrency())),
+        numConsumers_{params.numConsumers},
+        maxDrivers_{params.maxDrivers},
+        numConcurrentSplitGroups_{params.numConcurrentSplitGroups},
+        numSplitGroups_{params.numSplitGroups} {
+    VELOX_USER_CHECK(
+        !params.serialExecution,
+        "ParallelTaskCursor does not support serial execution");
+    VELOX_USER_CHECK_GT(numConsumers_, 0);
+    VELOX_CHECK(
+        queryCtx_->isExecutorSupplied(),
+        "Executor should be set in parallel task cursor");
+
+    // With ordered delivery all consumers share one queue.
+    const auto numQueues = params.orderedDelivery ? 1 : numConsumers_;
+    for (auto i = 0; i < numQueues; ++i) {
+      queues_.push_back(
+          std::make_shared<TaskQueue>(params.bufferedBytes, params.outputPool));
+    }
+    queuesAtEnd_ = std::vector<std::atomic<bool>>(numQueues);
+
+    // Captured by the consumer supplier of task_, which is called once per
+    // output driver. Assigns the output drivers to the queues round robin.
+    auto queues = queues_;
+    auto numOutputDrivers = std::make_shared<std::atomic<int32_t>>(0);
+    task_ = Task::create(
+        taskId_,
+        std::move(planFragment_),
+        params.destination,
+        std::move(queryCtx_),
+        Task::ExecutionMode::kParallel,
+        ConsumerSupplier{
+            [queues, numOutputDrivers, copyResult = params.copyResult]() {
+              auto queue = queues[(*numOutputDrivers)++ % queues.size()];
+              return Consumer{[queue, copyResult](
+                                  const RowVectorPtr& vector,
+                                  bool drained,
+                                  velox::ContinueFuture* future) {
+                VELOX_CHECK(
+                    !drained, "Unexpected drain in parallel task cursor");
+                return enqueueResult(*queue, vector, copyResult, future);
+              }};
+            }},
+        0,
+        [queues](std::exception_ptr) {
+          // onError close the queues to unblock producers and consumers.
+          // next() rethrows the error once unblocked.
+          for (auto& queue : queues) {
+            queue->close();
+          }
+        });
+
+    if (!taskSpillDirectory_.empty()) {
+      task_->setSpillDirectory(taskSpillDirectory_);
+    }
+  }
+
+  ~MultiConsumerTaskCursor() override {
+    for (auto& queue : queues_) {
+      queue->close();
+    }
+    const bool atEnd = std::all_of(
+        queuesAtEnd_.begin(), queuesAtEnd_.end(), [](const auto& atEnd) {
+          return atEnd.load();
+        });
+    if (task_ && !atEnd) {
+      task_->requestCancel();
+    }
+  }
+
+  void start() override {
+    if (started_) {
+      return;
+    }
+    started_ = true;
+    task_->start(maxDrivers_, numConcurrentSplitGroups_);
+    // Queue 'i' gets every queues_.size()th output driver starting at 'i'.
+    const int32_t numProducers = numSplitGroups_ * task_->numOutputDrivers();
+    const int32_t numQueues = queues_.size();
+    for (auto i = 0; i < numQueues; ++i) {
+      queues_[i]->setNumProducers(
+          numProducers / numQueues + (i < numProducers % numQueues ? 1 : 0));
+    }
+  }
+
+  int32_t numConsumers() const override {
+    return numConsumers_;
+  }
+
+  std::optional<Batch> next(int32_t consumer) override {
+    VELOX_CHECK(started_, "Call start() before next()");
+    VELOX_CHECK_GE(consumer, 0);
+    VELOX_CHECK_LT(consumer, numConsumers_);
+    if (error_) {
+      std::rethrow_exception(error_);
+    }
+    checkTaskError(*task_);
+
+    const auto queueIndex = consumer % queues_.size();
+    Batch batch;
+    batch.vector = queues_[queueIndex]->dequeue(&batch.sequenceNumber);
+
+    checkTaskError(*task_);
+    if (batch.vector == nullptr) {
+      queuesAtEnd_[queueIndex] = true;
+      return std::nullopt;
+    }
+    return batch;
+  }
+
+  void setError(std::exception_ptr error) override {
+    error_ = error;
+    if (task_) {
+      task_->setError(error);
+    }
+  }
+
+  const std::shared_ptr<Task>& task() override {
+    return task_;
+  }
+
+ private:
+  const int32_t numConsumers_;
+  const int32_t maxDrivers_;
+  const int32_t numConcurrentSplitGroups_;
+  const int32_t numSplitGroups_;
+
+  std::vector<std::shared_ptr<TaskQueue>> queues_;
+  // True for the queues that have returned all their batches.
+  std::vector<std::atomic<bool>> queuesAtEnd_;
+  std::atomic<bool> started_{false};
+  std::shared_ptr<exec::Task> task_;
+  std::exception_ptr error_;
+};
+
+std::unique_ptr<ParallelTaskCursor> ParallelTaskCursor::create(
+    const CursorParameters& params) {
+  return std::make_unique<MultiConsumerTaskCursor>(params);
+}
+
 bool RowCursor::next() {
   if (++currentRow_ < numRows_) {
     return true;
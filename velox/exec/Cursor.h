@@ -47,8 +47,20 @@ struct CursorParameters {
   /// Optional, created if not present.
   std::shared_ptr<core::QueryCtx> queryCtx;
 
+  /// Bytes of results buffered before the producers block. For a
+  /// ParallelTaskCursor without 'orderedDelivery', this applies to each
+  /// consumer.
   uint64_t bufferedBytes{512 * 1024};
 
+  /// Number of threads that consume the results of a ParallelTaskCursor.
+  int32_t numConsumers{1};
+
+  /// If true, the consumers of a ParallelTaskCursor take batches from a single
+  /// queue in the order the task produces them. Otherwise, the output drivers
+  /// are spread over the consumers and each consumer reads only from its
+  /// drivers.
+  bool orderedDelivery{false};
+
   /// An optional memory pool to be used to allocate vectors returned by
   /// MultiThreadedTaskCursor. A new pool is created if not specified.
   ///
@@ -110,8 +122,11 @@ class TaskQueue {
       RowVectorPtr vector,
       velox::ContinueFuture* future);
 
-  // Returns nullptr when all producers are at end. Otherwise blocks.
-  RowVectorPtr dequeue();
+  // Returns nullptr when all producers are at end. Otherwise blocks. May be
+  // called by several consumers concurrently. If 'sequenceNumber' is not
+  // nullptr, sets it to the number of batches dequeued before the returned
+  // one.
+  RowVectorPtr dequeue(uint64_t* sequenceNumber = nullptr);
 
   void close();
 
@@ -122,6 +137,9 @@ class TaskQueue {
   }
 
  private:
+  // Unblocks the consumers waiting in dequeue().
+  void notifyConsumersLocked();
+
   // Owns the vectors in 'queue_', hence must be declared first.
   std::shared_ptr<velox::memory::MemoryPool> pool_;
   std::deque<TaskQueueEntry> queue_;
@@ -133,9 +151,10 @@ class TaskQueue {
   uint64_t maxBytes_;
   std::mutex mutex_;
   std::vector<ContinuePromise> producerUnblockPromises_;
-  bool consumerBlocked_ = false;
-  ContinuePromise consumerPromise_;
-  ContinueFuture consumerFuture_;
+  // Realized when a batch is added, all producers are at end or 'this' is
+  // closed. One per blocked consumer.
+  std::vector<ContinuePromise> consumerPromises_;
+  uint64_t numDequeued_ = 0;
   bool closed_ = false;
 };
 
@@ -165,6 +184,41 @@ class TaskCursor {
   virtual const std::shared_ptr<Task>& task() = 0;
 };
 
+/// Streams the results of a task to several consumer threads. Each consumer
+/// calls next() with its own index from its own thread, so that consumers can
+/// post-process results in parallel. Always uses parallel execution. Vectors
+/// are handed off without a copy if CursorParameters::copyResult is false.
+class ParallelTaskCursor {
+ public:
+  /// A batch of results. 'sequenceNumber' is the position of 'vector' in the
+  /// output of the task if CursorParameters::orderedDelivery is true, or in
+  /// the output of the consumer otherwise.
+  struct Batch {
+    RowVectorPtr vector;
+    uint64_t sequenceNumber;
+  };
+
+  virtual ~ParallelTaskCursor() = default;
+
+  /// Creates a cursor with 'params.numConsumers' consumers.
+  static std::unique_ptr<ParallelTaskCursor> create(
+      const CursorParameters& params);
+
+  /// Starts the task. Must be called before the consumers call next().
+  virtual void start() = 0;
+
+  virtual int32_t numConsumers() const = 0;
+
+  /// Returns the next batch for 'consumer'. Blocks until a batch is available
+  /// and returns std::nullopt at end. Throws the error of the task if it
+  /// failed. Different consumers may call this concurrently.
+  virtual std::optional<Batch> next(int32_t consumer) = 0;
+
+  virtual void setError(std::exception_ptr error) = 0;
+
+  virtual const std::shared_ptr<Task>& task() = 0;
+};
+
 class RowCursor {
  public:
   explicit RowCursor(CursorParameters& params) {
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 #include "velox/exec/DistinctAggregations.h"
+#include <numeric>
+#include "velox/exec/HashTable.h"
 #include "velox/exec/SetAccumulator.h"
 
 namespace facebook::velox::exec {
@@ -28,13 +30,16 @@ class TypedDistinctAggregations : public DistinctAggregations {
   TypedDistinctAggregations(
       std::vector<AggregateInfo*> aggregates,
       const RowTypePtr& inputType,
-      memory::MemoryPool* pool)
+      memory::MemoryPool* pool,
+      uint64_t dedupThreshold)
       : pool_{pool},
         aggregates_{std::move(aggregates)},
         inputs_{aggregates_[0]->inputs},
         inputType_(TypedDistinctAggregations::makeInputTypeForAccumulator(
             inputType,
-            inputs_)) {}
+            inputs_)),
+        dedupThreshold_{dedupThreshold},
+        dedupType_{makeDedupType(inputType, inputs_)} {}
 
   /// Returns metadata about the accumulator used to store unique inputs.
   Accumulator accumulator() const override {
@@ -63,6 +68,22 @@ class TypedDistinctAggregations : public DistinctAggregations {
       char** groups,
       const RowVectorPtr& input,
       const SelectivityVector& rows) override {
+    maybeSwitchToDedup();
+    if (dedupTable_ != nullptr) {
+      auto* groupColumn = prepareGroupColumn(input->size());
+      rows.applyToSelected([&](vector_size_t i) {
+        groupColumn->set(i, reinterpret_cast<intptr_t>(groups[i]));
+      });
+      const auto args = rawInputForAggregation(input);
+      const auto& newRows = dedup(args, input->size(), rows);
+      if (newRows.hasSelections()) {
+        for (const auto* aggregate : aggregates_) {
+          aggregate->function->addRawInput(groups, newRows, args, false);
+        }
+      }
+      return;
+    }
+
     decodeInput(input, rows);
 
     rows.applyToSelected([&](vector_size_t i) {
@@ -71,7 +92,9 @@ class TypedDistinctAggregations : public DistinctAggregations {
 
       RowSizeTracker<char, uint32_t> tracker(
           group[rowSizeOffset_], *allocator_);
+      const auto size = accumulator->size();
       accumulator->addValue(decodedInput_, i, allocator_);
+      numSetValues_ += accumulator->size() - size;
     });
 
     inputForAccumulator_.reset();
@@ -81,13 +104,32 @@ class TypedDistinctAggregations : public DistinctAggregations {
       char* group,
       const RowVectorPtr& input,
       const SelectivityVector& rows) override {
+    maybeSwitchToDedup();
+    if (dedupTable_ != nullptr) {
+      auto* groupColumn = prepareGroupColumn(input->size());
+      rows.applyToSelected([&](vector_size_t i) {
+        groupColumn->set(i, reinterpret_cast<intptr_t>(group));
+      });
+      const auto args = rawInputForAggregation(input);
+      const auto& newRows = dedup(args, input->size(), rows);
+      if (newRows.hasSelections()) {
+        for (const auto* aggregate : aggregates_) {
+          aggregate->function->addSingleGroupRawInput(
+              group, newRows, args, false);
+        }
+      }
+      return;
+    }
+
     decodeInput(input, rows);
 
     auto* accumulator = reinterpret_cast<AccumulatorType*>(group + offset_);
     RowSizeTracker<char, uint32_t> tracker(group[rowSizeOffset_], *allocator_);
+    const auto size = accumulator->size();
     rows.applyToSelected([&](vector_size_t i) {
       accumulator->addValue(decodedInput_, i, allocator_);
     });
+    numSetValues_ += accumulator->size() - size;
 
     inputForAccumulator_.reset();
   }
@@ -102,16 +144,12 @@ class TypedDistinctAggregations : public DistinctAggregations {
       for (auto* group : groups) {
         auto* accumulator = reinterpret_cast<AccumulatorType*>(group + offset_);
 
-        // TODO Process group rows in batches to avoid creating very large input
-        // vectors.
-        auto data = BaseVector::create(inputType_, accumulator->size(), pool_);
-        if constexpr (std::is_same_v<T, ComplexType>) {
-          accumulator->extractValues(*data, 0);
-        } else {
-          accumulator->extractValues(*(data->template as<FlatVector<T>>()), 0);
-        }
-
-        if (data->size() > 0) {
+        // The sets are empty once the inputs are de-duplicated in
+        // 'dedupTable_'.
+        if (accumulator->size() > 0) {
+          // TODO Process group rows in batches to avoid creating very large
+          // input vectors.
+          auto data = extractSet(*accumulator);
           rows.resize(data->size());
           std::vector<VectorPtr> inputForAggregation =
               makeInputForAggregation(data);
@@ -145,6 +183,11 @@ class TypedDistinctAggregations : public DistinctAggregations {
       groups[i][nullByte_] |= nullMask_;
       new (groups[i] + offset_) AccumulatorType(inputType_, allocator_);
     }
+    if (dedupThreshold_ > 0 && dedupTable_ == nullptr) {
+      for (auto i : indices) {
+        setGroups_.push_back(groups[i]);
+      }
+    }
 
     for (auto i = 0; i < aggregates_.size(); ++i) {
       const auto& aggregate = *aggregates_[i];
@@ -157,6 +200,120 @@ class TypedDistinctAggregations : public DistinctAggregations {
     return aggregates_[0]->inputs.size() == 1;
   }
 
+  VectorPtr extractSet(AccumulatorType& accumulator) const {
+    auto data = BaseVector::create(inputType_, accumulator.size(), pool_);
+    if constexpr (std::is_same_v<T, ComplexType>) {
+      accumulator.extractValues(*data, 0);
+    } else {
+      accumulator.extractValues(*(data->template as<FlatVector<T>>()), 0);
+    }
+    return data;
+  }
+
+  // Returns ROW(group BIGINT, inputs...), where 'group' is the address of the
+  // group row.
+  static RowTypePtr makeDedupType(
+      const RowTypePtr& rowType,
+      const std::vector<column_index_t>& inputs) {
+    std::vector<std::string> names{"group"};
+    std::vector<TypePtr> types{BIGINT()};
+    for (auto i = 0; i < inputs.size(); ++i) {
+      names.emplace_back(fmt::format("c{}", i));
+      types.emplace_back(rowType->childAt(inputs[i]));
+    }
+    return ROW(std::move(names), std::move(types));
+  }
+
+  FlatVector<int64_t>* prepareGroupColumn(vector_size_t size) {
+    if (groupColumn_ == nullptr || groupColumn_.use_count() != 1) {
+      groupColumn_ = BaseVector::create<FlatVector<int64_t>>(
+          BIGINT(), size, pool_);
+    } else {
+      groupColumn_->resize(size);
+    }
+    return groupColumn_.get();
+  }
+
+  std::vector<VectorPtr> rawInputForAggregation(
+      const RowVectorPtr& input) const {
+    std::vector<VectorPtr> args;
+    args.reserve(inputs_.size());
+    for (auto channel : inputs_) {
+      args.push_back(input->childAt(channel));
+    }
+    return args;
+  }
+
+  // Probes 'groupColumn_' and 'args' for 'rows' into 'dedupTable_' and returns
+  // the rows that added a new (group, input) pair.
+  const SelectivityVector& dedup(
+      const std::vector<VectorPtr>& args,
+      vector_size_t size,
+      const SelectivityVector& rows) {
+    std::vector<VectorPtr> children{groupColumn_};
+    children.insert(children.end(), args.begin(), args.end());
+    auto dedupInput = std::make_shared<RowVector>(
+        pool_, dedupType_, nullptr, size, std::move(children));
+    dedupRows_ = rows;
+    dedupTable_->prepareForGroupProbe(
+        *dedupLookup_,
+        dedupInput,
+        dedupRows_,
+        BaseHashTable::kNoSpillInputStartPartitionBit);
+    newRows_.resizeFill(size, false);
+    if (!dedupLookup_->rows.empty()) {
+      dedupTable_->groupProbe(
+          *dedupLookup_, BaseHashTable::kNoSpillInputStartPartitionBit);
+      for (auto row : dedupLookup_->newGroups) {
+        newRows_.setValid(row, true);
+      }
+    }
+    newRows_.updateBounds();
+    return newRows_;
+  }
+
+  // Moves the values of the per-group sets into 'dedupTable_' once they exceed
+  // 'dedupThreshold_'. The aggregates receive the values of the sets at this
+  // point and afterwards only the inputs that are new for their group.
+  void maybeSwitchToDedup() {
+    if (dedupThreshold_ == 0 || dedupTable_ != nullptr ||
+        numSetValues_ <= dedupThreshold_) {
+      return;
+    }
+
+    std::vector<column_index_t> channels(dedupType_->size());
+    std::iota(channels.begin(), channels.end(), 0);
+    dedupTable_ = HashTable<false>::createForAggregation(
+        createVectorHashers(dedupType_, channels), {}, pool_);
+    dedupLookup_ =
+        std::make_unique<HashLookup>(dedupTable_->hashers(), pool_);
+
+    SelectivityVector rows;
+    for (auto* group : setGroups_) {
+      auto* accumulator = reinterpret_cast<AccumulatorType*>(group + offset_);
+      if (accumulator->size() > 0) {
+        auto data = extractSet(*accumulator);
+        const auto size = data->size();
+        rows.resize(size);
+        auto* groupColumn = prepareGroupColumn(size);
+        for (auto i = 0; i < size; ++i) {
+          groupColumn->set(i, reinterpret_cast<intptr_t>(group));
+        }
+        const auto args = makeInputForAggregation(data);
+        dedup(args, size, rows);
+        for (const auto* aggregate : aggregates_) {
+          aggregate->function->addSingleGroupRawInput(group, rows, args, false);
+        }
+      }
+      accumulator->free(*allocator_);
+      accumulator->~AccumulatorType();
+      new (accumulator) AccumulatorType(inputType_, allocator_);
+    }
+    setGroups_.clear();
+    setGroups_.shrink_to_fit();
+    numSetValues_ = 0;
+  }
+
   void decodeInput(const RowVectorPtr& input, const SelectivityVector& rows) {
     inputForAccumulator_ = makeInputForAccumulator(input);
     decodedInput_.decode(*inputForAccumulator_, rows);
@@ -204,8 +361,23 @@ class TypedDistinctAggregations : public DistinctAggregations {
   const std::vector<column_index_t> inputs_;
   const TypePtr inputType_;
 
+  const uint64_t dedupThreshold_;
+  const RowTypePtr dedupType_;
+
   DecodedVector decodedInput_;
   VectorPtr inputForAccumulator_;
+
+  // Total number of values in the per-group sets.
+  uint64_t numSetValues_{0};
+  // Groups with a set. Only kept until switching to 'dedupTable_'.
+  std::vector<char*> setGroups_;
+
+  // Distinct (group, input) pairs after switching away from per-group sets.
+  std::unique_ptr<BaseHashTable> dedupTable_;
+  std::unique_ptr<HashLookup> dedupLookup_;
+  FlatVectorPtr<int64_t> groupColumn_;
+  SelectivityVector dedupRows_;
+  SelectivityVector newRows_;
 };
 
 template <TypeKind Kind>
@@ -213,11 +385,12 @@ std::unique_ptr<DistinctAggregations>
 createDistinctAggregationsWithCustomCompare(
     std::vector<AggregateInfo*> aggregates,
     const RowTypePtr& inputType,
-    memory::MemoryPool* pool) {
+    memory::MemoryPool* pool,
+    uint64_t dedupThreshold) {
   return std::make_unique<TypedDistinctAggregations<
       typename TypeTraits<Kind>::NativeType,
       aggregate::prestosql::CustomComparisonSetAccumulator<Kind>>>(
-      aggregates, inputType, pool);
+      aggregates, inputType, pool, dedupThreshold);
 }
 } // namespace
 
@@ -225,14 +398,15 @@ createDistinctAggregationsWithCustomCompare(
 std::unique_ptr<DistinctAggregations> DistinctAggregations::create(
     std::vector<AggregateInfo*> aggregates,
     const RowTypePtr& inputType,
-    memory::MemoryPool* pool) {
+    memory::MemoryPool* pool,
+    uint64_t dedupThreshold) {
   VELOX_CHECK_EQ(aggregates.size(), 1);
   VELOX_CHECK(!aggregates[0]->inputs.empty());
 
   const bool isSingleInput = aggregates[0]->inputs.size() == 1;
   if (!isSingleInput) {
     return std::make_unique<TypedDistinctAggregations<ComplexType>>(
-        aggregates, inputType, pool);
+        aggregates, inputType, pool, dedupThreshold);
   }
 
   const auto type = inputType->childAt(aggregates[0]->inputs[0]);
@@ -243,50 +417,51 @@ std::unique_ptr<DistinctAggregations> DistinctAggregations::create(
         type->kind(),
         aggregates,
         inputType,
-        pool);
+        pool,
+        dedupThreshold);
   }
 
   switch (type->kind()) {
     case TypeKind::BOOLEAN:
       return std::make_unique<TypedDistinctAggregations<bool>>(
-          aggregates, inputType, pool);
+          aggregates, inputType, pool, dedupThreshold);
     case TypeKind::TINYINT:
       return std::make_unique<TypedDistinctAggregations<int8_t>>(
-          aggregates, inputType, pool);
+          aggregates, inputType, pool, dedupThreshold);
     case TypeKind::SMALLINT:
       return std::make_unique<TypedDistinctAggregations<int16_t>>(
-          aggregates, inputType, pool);
+          aggregates, inputType, pool, dedupThreshold);
     case TypeKind::INTEGER:
       return std::make_unique<TypedDistinctAggregations<int32_t>>(
-          aggregates, inputType, pool);
+          aggregates, inputType, pool, dedupThreshold);
     case TypeKind::BIGINT:
       return std::make_unique<TypedDistinctAggregations<int64_t>>(
-          aggregates, inputType, pool);
+          aggregates, inputType, pool, dedupThreshold);
     case TypeKind::HUGEINT:
       return std::make_unique<TypedDistinctAggregations<int128_t>>(
-          aggregates, inputType, pool);
+          aggregates, inputType, pool, dedupThreshold);
     case TypeKind::REAL:
       return std::make_unique<TypedDistinctAggregations<float>>(
-          aggregates, inputType, pool);
+          aggregates, inputType, pool, dedupThreshold);
     case TypeKind::DOUBLE:
       return std::make_unique<TypedDistinctAggregations<double>>(
-          aggregates, inputType, pool);
+          aggregates, inputType, pool, dedupThreshold);
     case TypeKind::TIMESTAMP:
       return std::make_unique<TypedDistinctAggregations<Timestamp>>(
-          aggregates, inputType, pool);
+          aggregates, inputType, pool, dedupThreshold);
     case TypeKind::VARBINARY:
       [[fallthrough]];
     case TypeKind::VARCHAR:
       return std::make_unique<TypedDistinctAggregations<StringView>>(
-          aggregates, inputType, pool);
+          aggregates, inputType, pool, dedupThreshold);
     case TypeKind::ARRAY:
     case TypeKind::MAP:
     case TypeKind::ROW:
       return std::make_unique<TypedDistinctAggregations<ComplexType>>(
-          aggregates, inputType, pool);
+          aggregates, inputType, pool, dedupThreshold);
     case TypeKind::UNKNOWN:
       return std::make_unique<TypedDistinctAggregations<UnknownValue>>(
-          aggregates, inputType, pool);
+          aggregates, inputType, pool, dedupThreshold);
     default:
       VELOX_UNREACHABLE("Unexpected type {}", type->toString());
   }
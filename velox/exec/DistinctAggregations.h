@@ -32,10 +32,15 @@ class DistinctAggregations {
   /// aggregates should have the same inputs.
   /// @param inputType Input row type for the aggregation operator.
   /// @param pool Memory pool.
+  /// @param dedupThreshold If positive, switch from per-group sets to
+  /// de-duplicating (group, input) pairs in a single hash table once the sets
+  /// hold more than this many values in total. Requires that group rows are
+  /// not freed and re-used before all input is added.
   static std::unique_ptr<DistinctAggregations> create(
       std::vector<AggregateInfo*> aggregates,
       const RowTypePtr& inputType,
-      memory::MemoryPool* pool);
+      memory::MemoryPool* pool,
+      uint64_t dedupThreshold = 0);
 
   virtual ~DistinctAggregations() = default;
 
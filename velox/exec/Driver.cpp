@@ -16,7 +16,13 @@
 
 #include "velox/exec/Driver.h"
 
+#include <folly/ScopeGuard.h>
+
+#include "velox/common/process/PerfCounters.h"
+#include "velox/common/process/ProcessBase.h"
+#include "velox/common/process/SamplingProfiler.h"
 #include "velox/common/process/TraceContext.h"
+#include "velox/exec/DriverScheduler.h"
 #include "velox/exec/Task.h"
 
 using facebook::velox::common::testutil::TestValue;
@@ -47,6 +53,121 @@ void recordSilentThrows(Operator& op) {
   }
 }
 
+void recordPerfCounters(Operator& op, const process::PerfCounterValues& delta) {
+  op.stats().withWLock([&](auto& lockedStats) {
+    lockedStats.addRuntimeStat("perfCycles", RuntimeCounter(delta.cycles));
+    lockedStats.addRuntimeStat(
+        "perfInstructions", RuntimeCounter(delta.instructions));
+    lockedStats.addRuntimeStat(
+        "perfLlcMisses", RuntimeCounter(delta.llcMisses));
+    lockedStats.addRuntimeStat(
+        "perfDtlbMisses", RuntimeCounter(delta.dtlbMisses));
+    lockedStats.addRuntimeStat(
+        "perfBranchMisses", RuntimeCounter(delta.branchMisses));
+  });
+}
+
+// The runtime stat names of the encoding stats of the vectors produced or
+// received by an operator.
+struct EncodingStatNames {
+  std::string batchRows;
+  std::string flatColumns;
+  std::string dictionaryColumns;
+  std::string constantColumns;
+  std::string lazyColumns;
+  std::string otherColumns;
+  std::string nullPct;
+};
+
+const EncodingStatNames& encodingStatNames(bool output) {
+  static const EncodingStatNames kOutputNames{
+      "outputBatchRows",
+      "outputFlatColumns",
+      "outputDictionaryColumns",
+      "outputConstantColumns",
+      "outputLazyColumns",
+      "outputOtherColumns",
+      "outputNullPct"};
+  static const EncodingStatNames kInputNames{
+      "inputBatchRows",
+      "inputFlatColumns",
+      "inputDictionaryColumns",
+      "inputConstantColumns",
+      "inputLazyColumns",
+      "inputOtherColumns",
+      "inputNullPct"};
+  return output ? kOutputNames : kInputNames;
+}
+
+// Records the rows, the number of top level columns per encoding and the
+// percentage of null top level values of 'vector' in 'stats'. The column
+// counters are only recorded for the encodings present, so their count is the
+// number of batches with such columns. Flat, row, array and map vectors count
+// as flat. The nulls of dictionary bases and unloaded lazy vectors are not
+// counted to keep this cheap.
+void recordEncodingStats(
+    const RowVectorPtr& vector,
+    bool output,
+    OperatorStats& stats) {
+  const auto& names = encodingStatNames(output);
+  const auto numRows = vector->size();
+  uint64_t numFlat{0};
+  uint64_t numDictionary{0};
+  uint64_t numConstant{0};
+  uint64_t numLazy{0};
+  uint64_t numOther{0};
+  uint64_t numNulls{0};
+  for (const auto& child : vector->children()) {
+    if (isLazyNotLoaded(*child)) {
+      ++numLazy;
+      continue;
+    }
+    const auto* column = child->loadedVector();
+    switch (column->encoding()) {
+      case VectorEncoding::Simple::FLAT:
+      case VectorEncoding::Simple::ROW:
+      case VectorEncoding::Simple::ARRAY:
+      case VectorEncoding::Simple::MAP:
+      case VectorEncoding::Simple::FLAT_MAP:
+        ++numFlat;
+        break;
+      case VectorEncoding::Simple::DICTIONARY:
+        ++numDictionary;
+        break;
+      case VectorEncoding::Simple::CONSTANT:
+        ++numConstant;
+        if (numRows > 0 && column->isNullAt(0)) {
+          numNulls += numRows;
+        }
+        continue;
+      default:
+        ++numOther;
+        break;
+    }
+    if (column->rawNulls() != nullptr) {
+      numNulls += bits::countNulls(column->rawNulls(), 0, numRows);
+    }
+  }
+
+  stats.addRuntimeStat(names.batchRows, RuntimeCounter(numRows));
+  const std::pair<const std::string*, uint64_t> columnCounts[] = {
+      {&names.flatColumns, numFlat},
+      {&names.dictionaryColumns, numDictionary},
+      {&names.constantColumns, numConstant},
+      {&names.lazyColumns, numLazy},
+      {&names.otherColumns, numOther}};
+  for (const auto& [name, count] : columnCounts) {
+    if (count > 0) {
+      stats.addRuntimeStat(*name, RuntimeCounter(count));
+    }
+  }
+  const auto numValues = numRows * vector->childrenSize();
+  if (numValues > 0) {
+    stats.addRuntimeStat(
+        names.nullPct, RuntimeCounter(numNulls * 100 / numValues));
+  }
+}
+
 // Used to generate context for exceptions that are thrown while executing an
 // operator. Eg output: 'Operator: FilterProject(1) PlanNodeId: 1 TaskId:
 // test_cursor_1 PipelineId: 0 DriverId: 0 OperatorAddress: 0x61a000003c80'
@@ -125,7 +246,7 @@ std::optional<common::SpillConfig> DriverCtx::makeSpillConfig(
       [this](uint64_t bytes) {
         task->queryCtx()->updateSpilledBytesAndCheckLimit(bytes);
       };
-  return common::SpillConfig(
+  common::SpillConfig spillConfig(
       std::move(getSpillDirPathCb),
       std::move(updateAndCheckSpillLimitCb),
       spillFilePrefix,
@@ -145,6 +266,8 @@ std::optional<common::SpillConfig> DriverCtx::makeSpillConfig(
           ? std::optional<common::PrefixSortConfig>(prefixSortConfig())
           : std::nullopt,
       queryConfig.spillFileCreateConfig());
+  spillConfig.numReadAheadBuffers = queryConfig.spillNumReadAheadBuffers();
+  return spillConfig;
 }
 
 std::atomic_uint64_t BlockingState::numBlockedDrivers_{0};
@@ -238,8 +361,13 @@ void Driver::enqueue(std::shared_ptr<Driver> driver) {
   if (driver->closed_) {
     return;
   }
-  driver->task()->queryCtx()->executor()->add(
-      [driver]() { Driver::run(driver); });
+  const auto& queryCtx = driver->task()->queryCtx();
+  auto* executor = queryCtx->executor();
+  if (auto* scheduler = dynamic_cast<DriverScheduler*>(executor)) {
+    scheduler->add([driver]() { Driver::run(driver); }, queryCtx);
+    return;
+  }
+  executor->add([driver]() { Driver::run(driver); });
 }
 
 void Driver::init(
@@ -249,11 +377,15 @@ void Driver::init(
   ctx_ = std::move(ctx);
   enableOperatorBatchSizeStats_ =
       ctx_->queryConfig().enableOperatorBatchSizeStats();
+  enableOperatorEncodingStats_ =
+      ctx_->queryConfig().enableOperatorEncodingStats();
   cpuSliceMs_ = task()->driverCpuTimeSliceLimitMs();
   VELOX_CHECK(operators_.empty());
   operators_ = std::move(operators);
   curOperatorId_ = operators_.size() - 1;
   trackOperatorCpuUsage_ = ctx_->queryConfig().operatorTrackCpuUsage();
+  trackOperatorPerfCounters_ =
+      ctx_->queryConfig().operatorTrackPerfCounters();
 }
 
 void Driver::initializeOperators() {
@@ -275,6 +407,9 @@ RowVectorPtr Driver::next(
   facebook::velox::process::ScopedThreadDebugInfo scopedInfo(
       self->driverCtx()->threadDebugInfo);
   ScopedDriverThreadContext scopedDriverThreadContext(self->driverCtx());
+  // Returns the reservations cached by the thread when the driver goes off
+  // thread.
+  memory::ThreadCacheScope threadCacheScope;
   std::shared_ptr<BlockingState> blockingState;
   RowVectorPtr result;
   const auto stop = runInternal(self, blockingState, result);
@@ -477,6 +612,14 @@ StopReason Driver::runInternal(
         RuntimeCounter(queuedTimeUs * 1'000, RuntimeCounter::Unit::kNanos));
     RECORD_HISTOGRAM_METRIC_VALUE(
         kMetricDriverQueueTimeMs, queuedTimeUs / 1'000);
+    const auto cpu = process::currentCpu();
+    if (cpu >= 0) {
+      if (lastCpu_ >= 0 && cpu != lastCpu_) {
+        operators_[curOperatorId_]->addRuntimeStat(
+            "numCpuMigrations", RuntimeCounter(1));
+      }
+      lastCpu_ = cpu;
+    }
   }
 
   CancelGuard guard(self, task().get(), &state_, [&](StopReason reason) {
@@ -583,6 +726,10 @@ StopReason Driver::runInternal(
                 auto lockedStats = op->stats().wlock();
                 lockedStats->addOutputVector(
                     resultBytes, intermediateResult->size());
+                if (enableOperatorEncodingStats()) {
+                  recordEncodingStats(
+                      intermediateResult, /*output=*/true, *lockedStats);
+                }
               }
             });
             if (intermediateResult) {
@@ -592,6 +739,12 @@ StopReason Driver::runInternal(
                       auto lockedStats = nextOp->stats().wlock();
                       lockedStats->addInputVector(
                           resultBytes, intermediateResult->size());
+                      if (enableOperatorEncodingStats()) {
+                        recordEncodingStats(
+                            intermediateResult,
+                            /*output=*/false,
+                            *lockedStats);
+                      }
                     }
                     nextOp->traceInput(intermediateResult);
                     TestValue::adjust(
@@ -672,6 +825,9 @@ StopReason Driver::runInternal(
               }
               auto lockedStats = op->stats().wlock();
               lockedStats->addOutputVector(resultByteSize, result->size());
+              if (enableOperatorEncodingStats()) {
+                recordEncodingStats(result, /*output=*/true, *lockedStats);
+              }
             }
           });
 
@@ -730,6 +886,7 @@ void Driver::run(std::shared_ptr<Driver> self) {
   facebook::velox::process::ScopedThreadDebugInfo scopedInfo(
       self->driverCtx()->threadDebugInfo);
   ScopedDriverThreadContext scopedDriverThreadContext(self->driverCtx());
+  memory::ThreadCacheScope threadCacheScope;
   std::shared_ptr<BlockingState> blockingState;
   RowVectorPtr nullResult;
   auto reason = self->runInternal(self, blockingState, nullResult);
@@ -1154,6 +1311,35 @@ void Driver::withDeltaCpuWallTimer(
     Operator* op,
     TimingMemberPtr opTimingMember,
     Func&& opFunction) {
+  // Hardware counters are sampled outside of the CPU timer so that recording
+  // them is not charged to the operator. The counters belong to the thread, so
+  // the delta only covers 'opFunction' even if the driver moves to another
+  // thread between calls.
+  std::optional<process::DeltaPerfCounterStopWatch> perfWatch;
+  if (FOLLY_UNLIKELY(trackOperatorPerfCounters_)) {
+    perfWatch.emplace();
+  }
+  // Labels the CPU profile samples taken during 'opFunction' with the
+  // operator and counts them in the operator stats.
+  std::optional<process::ScopedSampleLabel> sampleLabel;
+  uint64_t numSamplesBefore{0};
+  if (FOLLY_UNLIKELY(process::SamplingProfiler::isRunning())) {
+    sampleLabel.emplace(sampleLabelId(*op));
+    numSamplesBefore = process::SamplingProfiler::threadSampleCount();
+  }
+  SCOPE_EXIT {
+    if (perfWatch.has_value() && perfWatch->valid()) {
+      recordPerfCounters(*op, perfWatch->elapsed());
+    }
+    if (sampleLabel.has_value()) {
+      const auto numSamples =
+          process::SamplingProfiler::threadSampleCount() - numSamplesBefore;
+      if (numSamples > 0) {
+        op->addRuntimeStat("profileSamples", RuntimeCounter(numSamples));
+      }
+    }
+  };
+
   // If 'trackOperatorCpuUsage_' is true, create and initialize the timer object
   // to track cpu and wall time of the opFunction.
   if (!trackOperatorCpuUsage_) {
@@ -1175,6 +1361,22 @@ void Driver::withDeltaCpuWallTimer(
   opFunction();
 }
 
+uint32_t Driver::sampleLabelId(const Operator& op) {
+  const size_t id = op.operatorId();
+  if (sampleLabelIds_.size() <= id) {
+    sampleLabelIds_.resize(std::max<size_t>(id + 1, operators_.size()), 0);
+  }
+  if (sampleLabelIds_[id] == 0) {
+    sampleLabelIds_[id] = process::SamplingProfiler::labelId(fmt::format(
+        "{}/{}/{}:{}",
+        ctx_->task->taskId(),
+        ctx_->pipelineId,
+        op.planNodeId(),
+        op.operatorType()));
+  }
+  return sampleLabelIds_[id];
+}
+
 void Driver::validateOperatorOutputResult(
     const RowVectorPtr& result,
     const Operator& op) {
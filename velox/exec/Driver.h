@@ -437,6 +437,11 @@ class Driver : public std::enable_shared_from_this<Driver> {
     return enableOperatorBatchSizeStats_;
   }
 
+  /// Inline function to check if operator vector encoding stats are enabled.
+  inline bool enableOperatorEncodingStats() const {
+    return enableOperatorEncodingStats_;
+  }
+
   /// Checks if the associated query is under memory arbitration or not. The
   /// function returns true if it is and set future which is fulfilled when the
   /// memory arbitration finishes.
@@ -657,6 +662,11 @@ class Driver : public std::enable_shared_from_this<Driver> {
       TimingMemberPtr opTimingMember,
       Func&& opFunction);
 
+  // Returns the id of the sampling profiler label of 'op'. The label is
+  // '<task id>/<pipeline id>/<plan node id>:<operator type>', so samples of
+  // all drivers of a plan node aggregate under the same label.
+  uint32_t sampleLabelId(const Operator& op);
+
   // Adjusts 'timing' by removing the lazy load wall time, CPU time, and input
   // bytes accrued since last time timing information was recorded for 'op'. The
   // accrued lazy load times are credited to the source operator of 'this'. The
@@ -681,6 +691,10 @@ class Driver : public std::enable_shared_from_this<Driver> {
   // driver execution.
   bool enableOperatorBatchSizeStats_{false};
 
+  // If set, the rows, column encodings and null ratio of the vectors passed
+  // between operators will be collected during driver execution.
+  bool enableOperatorEncodingStats_{false};
+
   // If not zero, specifies the driver cpu time slice.
   size_t cpuSliceMs_{0};
 
@@ -703,6 +717,10 @@ class Driver : public std::enable_shared_from_this<Driver> {
   // should update.
   size_t curOperatorId_{0};
 
+  // The CPU the Driver last started running on or -1 if not known. Used to
+  // count the runs that start on another CPU than the previous one.
+  int32_t lastCpu_{-1};
+
   std::vector<std::unique_ptr<Operator>> operators_;
 
   BlockingReason blockingReason_{BlockingReason::kNotBlocked};
@@ -710,6 +728,13 @@ class Driver : public std::enable_shared_from_this<Driver> {
 
   bool trackOperatorCpuUsage_;
 
+  // True if hardware performance counters are sampled around operator calls.
+  bool trackOperatorPerfCounters_{false};
+
+  // The sampling profiler label ids of the operators by operator id. 0 if not
+  // yet assigned.
+  std::vector<uint32_t> sampleLabelIds_;
+
   // Indicates that a DriverAdapter can rearrange Operators. Set to false at end
   // of DriverFactory::createDriver().
   bool isAdaptable_{true};
@@ -846,6 +871,12 @@ struct DriverFactory {
     return false;
   }
 
+  /// Returns true if the pipeline gets data from a hash repartitioning local
+  /// exchange and produces correct results when the rows of one partition are
+  /// processed by several drivers. This is the case for a partial or
+  /// intermediate aggregation and for the probe side of a hash join.
+  bool acceptsSkewedLocalPartition() const;
+
   /// Returns true if the pipeline gets data from a table scan. The function
   /// sets plan node id in 'planNodeId'.
   bool needsTableScan(core::PlanNodeId& planNodeId) const {
@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/DriverScheduler.h"
+
+#include <folly/system/ThreadName.h>
+
+#include <algorithm>
+#include <tuple>
+
+#include "velox/common/process/ProcessBase.h"
+
+namespace facebook::velox::exec {
+namespace {
+// Number of new queries after which the states of finished queries are
+// removed.
+constexpr uint32_t kQuerySweepInterval = 1'024;
+
+// The scheduler and the worker the current thread runs for, if any.
+thread_local const DriverScheduler* currentScheduler{nullptr};
+thread_local int32_t currentWorkerId{-1};
+} // namespace
+
+DriverScheduler::DriverScheduler(Options options)
+    : options_(std::move(options)) {
+  const auto numThreads = options_.numThreads > 0
+      ? options_.numThreads
+      : std::max<int32_t>(1, std::thread::hardware_concurrency());
+  for (auto i = 0; i < numThreads; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  if (options_.pinThreads) {
+    // Threads are assigned to the CPUs one cache domain after the other. If
+    // there are more threads than CPUs, the CPUs get several threads.
+    std::vector<std::pair<int32_t, int32_t>> cpus;
+    const auto cacheDomains = process::cpuCacheDomains();
+    const auto cpuNodes = process::cpuNumaNodes();
+    for (auto domain = 0; domain < cacheDomains.size(); ++domain) {
+      for (auto cpu : cacheDomains[domain]) {
+        cpus.emplace_back(cpu, domain);
+      }
+    }
+    domains_.resize(cacheDomains.size());
+    for (auto i = 0; i < numThreads; ++i) {
+      auto& worker = *workers_[i];
+      std::tie(worker.cpu, worker.domain) = cpus[i % cpus.size()];
+      worker.numaNode = worker.cpu < cpuNodes.size() ? cpuNodes[worker.cpu] : 0;
+      domains_[worker.domain].push_back(i);
+    }
+    // A domain without threads is not used for placement.
+    domains_.erase(
+        std::remove_if(
+            domains_.begin(),
+            domains_.end(),
+            [](const auto& workerIds) { return workerIds.empty(); }),
+        domains_.end());
+    // The CPUs that share a last level cache are on one node.
+    for (auto domain = 0; domain < domains_.size(); ++domain) {
+      for (auto workerId : domains_[domain]) {
+        workers_[workerId]->domain = domain;
+      }
+      domainNodes_.push_back(workers_[domains_[domain][0]]->numaNode);
+    }
+  } else {
+    domains_.resize(1);
+    domainNodes_.push_back(0);
+    for (auto i = 0; i < numThreads; ++i) {
+      domains_[0].push_back(i);
+    }
+  }
+  for (auto i = 0; i < numThreads; ++i) {
+    auto& worker = *workers_[i];
+    auto addInOrder = [&](auto include) {
+      for (auto j = 1; j < numThreads; ++j) {
+        const auto other = (i + j) % numThreads;
+        if (include(*workers_[other])) {
+          worker.stealOrder.push_back(other);
+        }
+      }
+    };
+    addInOrder([&](const Worker& other) {
+      return other.domain == worker.domain;
+    });
+    addInOrder([&](const Worker& other) {
+      return other.domain != worker.domain &&
+          other.numaNode == worker.numaNode;
+    });
+    addInOrder([&](const Worker& other) {
+      return other.numaNode != worker.numaNode;
+    });
+  }
+  for (auto i = 0; i < numThreads; ++i) {
+    workers_[i]->thread = std::thread([this, i]() { run(i); });
+  }
+}
+
+DriverScheduler::~DriverScheduler() {
+  {
+    std::lock_guard<std::mutex> l(idleMutex_);
+    stopped_ = true;
+  }
+  idleCondition_.notify_all();
+  for (auto& worker : workers_) {
+    worker->thread.join();
+  }
+}
+
+void DriverScheduler::add(folly::Func func) {
+  enqueue(Item{std::move(func), nullptr, 0});
+}
+
+void DriverScheduler::add(
+    folly::Func func,
+    const std::shared_ptr<core::QueryCtx>& queryCtx) {
+  auto query = queryState(queryCtx);
+  const auto level = levelOf(*query);
+  enqueue(Item{std::move(func), std::move(query), level});
+}
+
+int32_t DriverScheduler::level(const core::QueryCtx& queryCtx) const {
+  std::shared_ptr<QueryState> query;
+  queries_.withRLock([&](const auto& queries) {
+    auto it = queries.find(&queryCtx);
+    if (it != queries.end()) {
+      query = it->second;
+    }
+  });
+  return query == nullptr ? 0 : levelOf(*query);
+}
+
+int32_t DriverScheduler::cacheDomain(const core::QueryCtx& queryCtx) const {
+  return queries_.withRLock([&](const auto& queries) {
+    auto it = queries.find(&queryCtx);
+    return it == queries.end() ? -1 : it->second->domain;
+  });
+}
+
+DriverScheduler::Stats DriverScheduler::stats() const {
+  Stats stats;
+  stats.numRuns = numRuns_;
+  stats.numSteals = numSteals_;
+  stats.numRemoteSteals = numRemoteSteals_;
+  stats.numRemoteNodeSteals = numRemoteNodeSteals_;
+  for (auto i = 0; i < kNumLevels; ++i) {
+    stats.levelCpuNanos[i] = levelCpuNanos_[i];
+  }
+  return stats;
+}
+
+std::shared_ptr<DriverScheduler::QueryState> DriverScheduler::queryState(
+    const std::shared_ptr<core::QueryCtx>& queryCtx) {
+  auto isCurrent = [&](const auto& query) {
+    return query->queryCtx.lock() == queryCtx;
+  };
+  {
+    auto queries = queries_.rlock();
+    auto it = queries->find(queryCtx.get());
+    if (it != queries->end() && isCurrent(it->second)) {
+      return it->second;
+    }
+  }
+  auto queries = queries_.wlock();
+  auto& query = (*queries)[queryCtx.get()];
+  if (query != nullptr && isCurrent(query)) {
+    return query;
+  }
+  // A new query, possibly at the address of a destroyed one.
+  query = std::make_shared<QueryState>(
+      queryCtx,
+      queryCtx->queryConfig().querySchedulingWeight(),
+      nextDomain_++ % domains_.size());
+  auto result = query;
+  if (++numNewQueries_ >= kQuerySweepInterval) {
+    numNewQueries_ = 0;
+    for (auto it = queries->begin(); it != queries->end();) {
+      if (it->second->queryCtx.expired()) {
+        it = queries->erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+  return result;
+}
+
+int32_t DriverScheduler::levelOf(const QueryState& query) const {
+  const auto cpuNanos = query.cpuNanos / query.weight;
+  int32_t level = 0;
+  while (level < kNumLevels - 1 &&
+         cpuNanos >= options_.levelThresholdNanos[level]) {
+    ++level;
+  }
+  return level;
+}
+
+void DriverScheduler::enqueue(Item item) {
+  const auto level = item.level;
+  // A level that had no queued items starts at most 'maxLevelLagNanos' behind
+  // the busy levels, so that it does not take all the threads until it
+  // catches up.
+  if (numQueuedPerLevel_[level]++ == 0) {
+    uint64_t minCpuNanos = std::numeric_limits<uint64_t>::max();
+    for (auto i = 0; i < kNumLevels; ++i) {
+      if (i != level && numQueuedPerLevel_[i] > 0) {
+        minCpuNanos = std::min<uint64_t>(minCpuNanos, levelCpuNanos_[i] << i);
+      }
+    }
+    if (minCpuNanos != std::numeric_limits<uint64_t>::max() &&
+        minCpuNanos > options_.maxLevelLagNanos) {
+      const uint64_t catchUpNanos =
+          (minCpuNanos - options_.maxLevelLagNanos) >> level;
+      auto& levelCpuNanos = levelCpuNanos_[level];
+      uint64_t current = levelCpuNanos;
+      while (current < catchUpNanos &&
+             !levelCpuNanos.compare_exchange_weak(current, catchUpNanos)) {
+      }
+    }
+  }
+
+  const auto workerId = pickWorker(item);
+  auto& worker = *workers_[workerId];
+  ++numQueued_;
+  {
+    std::lock_guard<std::mutex> l(worker.mutex);
+    worker.queues[level].push_back(std::move(item));
+  }
+  if (numIdle_ > 0) {
+    std::lock_guard<std::mutex> l(idleMutex_);
+    idleCondition_.notify_one();
+  }
+}
+
+int32_t DriverScheduler::pickWorker(const Item& item) {
+  const auto domain = item.query == nullptr ? -1 : item.query->domain;
+  if (currentScheduler == this &&
+      (domain < 0 || workers_[currentWorkerId]->domain == domain)) {
+    return currentWorkerId;
+  }
+  if (domain < 0) {
+    return nextWorker_++ % workers_.size();
+  }
+  const auto& workerIds = domains_[domain];
+  return workerIds[nextWorker_++ % workerIds.size()];
+}
+
+bool DriverScheduler::takeFrom(Worker& worker, int32_t level, Item& item) {
+  std::lock_guard<std::mutex> l(worker.mutex);
+  auto& queue = worker.queues[level];
+  if (queue.empty()) {
+    return false;
+  }
+  item = std::move(queue.front());
+  queue.pop_front();
+  return true;
+}
+
+bool DriverScheduler::takeItem(int32_t workerId, Item& item) {
+  // Tries the levels in the order of their CPU time relative to their share.
+  std::array<int32_t, kNumLevels> levels;
+  std::array<uint64_t, kNumLevels> normalizedCpuNanos;
+  for (auto i = 0; i < kNumLevels; ++i) {
+    levels[i] = i;
+    normalizedCpuNanos[i] = levelCpuNanos_[i] << i;
+  }
+  std::sort(levels.begin(), levels.end(), [&](auto left, auto right) {
+    return std::tie(normalizedCpuNanos[left], left) <
+        std::tie(normalizedCpuNanos[right], right);
+  });
+
+  const auto& worker = *workers_[workerId];
+  for (auto level : levels) {
+    if (numQueuedPerLevel_[level] == 0) {
+      continue;
+    }
+    if (takeFrom(*workers_[workerId], level, item)) {
+      return true;
+    }
+    for (auto other : worker.stealOrder) {
+      if (takeFrom(*workers_[other], level, item)) {
+        ++numSteals_;
+        if (workers_[other]->domain != worker.domain) {
+          ++numRemoteSteals_;
+        }
+        if (workers_[other]->numaNode != worker.numaNode) {
+          ++numRemoteNodeSteals_;
+        }
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void DriverScheduler::run(int32_t workerId) {
+  folly::setThreadName(fmt::format("DriverSched{}", workerId));
+  currentScheduler = this;
+  currentWorkerId = workerId;
+  const auto cpu = workers_[workerId]->cpu;
+  if (cpu >= 0 && !process::pinThreadToCpu(cpu)) {
+    LOG(WARNING) << "DriverScheduler could not bind thread " << workerId
+                 << " to CPU " << cpu;
+  }
+  for (;;) {
+    Item item;
+    if (!takeItem(workerId, item)) {
+      std::unique_lock<std::mutex> l(idleMutex_);
+      ++numIdle_;
+      idleCondition_.wait(l, [&]() { return stopped_ || numQueued_ > 0; });
+      --numIdle_;
+      if (numQueued_ == 0) {
+        VELOX_CHECK(stopped_);
+        return;
+      }
+      continue;
+    }
+    --numQueued_;
+    --numQueuedPerLevel_[item.level];
+
+    const auto startNanos = process::threadCpuNanos();
+    try {
+      item.func();
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "DriverScheduler function threw: " << e.what();
+    }
+    const auto cpuNanos = process::threadCpuNanos() - startNanos;
+    levelCpuNanos_[item.level] += cpuNanos;
+    if (item.query != nullptr) {
+      item.query->cpuNanos += cpuNanos;
+    }
+    ++numRuns_;
+  }
+}
+
+} // namespace facebook::velox::exec
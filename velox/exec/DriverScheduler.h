@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <folly/Executor.h>
+#include <folly/Synchronized.h>
+#include <folly/container/F14Map.h>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "velox/core/QueryCtx.h"
+
+namespace facebook::velox::exec {
+
+/// An executor that runs Drivers on its own threads with a multi-level
+/// feedback queue. A query starts at level 0 and moves to the next level each
+/// time the CPU time its Drivers used on the scheduler, divided by the
+/// query's scheduling weight, crosses a threshold. The threads pick the level
+/// that used the least CPU time relative to its share, each level getting
+/// twice the share of the next one, so that short queries do not wait behind
+/// long running ones. This complements the time slicing of Drivers set by
+/// QueryConfig::kDriverCpuTimeSliceLimitMs, which makes long running Drivers
+/// go back to the queue.
+///
+/// Each thread has its own queues. A Driver enqueued by a thread of the
+/// scheduler, e.g. after it yields, goes to the queues of that thread to
+/// continue with its working set in the caches of that thread. Other Drivers
+/// are distributed round robin. A thread without work takes work from the
+/// queues of the other threads.
+///
+/// With Options::pinThreads, each thread is bound to a CPU and the threads are
+/// grouped by the last level cache of their CPUs. The Drivers of a query are
+/// queued on the threads of one group so that the pipelines of its Tasks
+/// share the cache. A thread without work takes work from the threads of its
+/// group, then from the groups on the same NUMA node and last from the groups
+/// on other nodes. MmapAllocator with Options::numNumaNodes serves the
+/// allocations of a thread from the node of its CPU, so the memory of a query
+/// is on the node of the threads that run it and stays local as long as its
+/// Drivers are not taken by a thread of another node.
+///
+/// To use it, make it the executor of the QueryCtx. Driver::enqueue then adds
+/// the Drivers with their query. Functions added with add(folly::Func) run at
+/// level 0.
+class DriverScheduler : public folly::Executor {
+ public:
+  static constexpr int32_t kNumLevels = 5;
+
+  struct Options {
+    /// Number of threads. Uses the number of cores if 0.
+    int32_t numThreads{0};
+
+    /// The CPU time in nanoseconds, after division by the scheduling weight,
+    /// at which a query moves to levels 1, 2, 3 and 4.
+    std::array<uint64_t, kNumLevels - 1> levelThresholdNanos{
+        1'000'000'000UL,
+        10'000'000'000UL,
+        60'000'000'000UL,
+        300'000'000'000UL};
+
+    /// The levels get CPU time in proportion to their shares. A level that
+    /// had nothing to run starts at most this much CPU time per share behind
+    /// the others when it gets work again.
+    uint64_t maxLevelLagNanos{100'000'000UL};
+
+    /// If true, binds each thread to a CPU and places the Drivers of each
+    /// query on the threads that share a last level cache. The cache domains
+    /// are then also grouped by NUMA node for taking work.
+    bool pinThreads{false};
+  };
+
+  struct Stats {
+    /// Number of functions run.
+    uint64_t numRuns{0};
+
+    /// Number of functions taken from the queues of another thread.
+    uint64_t numSteals{0};
+
+    /// Number of functions taken from the queues of a thread in another
+    /// cache domain.
+    uint64_t numRemoteSteals{0};
+
+    /// Number of functions taken from the queues of a thread on another NUMA
+    /// node. These are included in 'numRemoteSteals'.
+    uint64_t numRemoteNodeSteals{0};
+
+    /// CPU time of the functions run at each level.
+    std::array<uint64_t, kNumLevels> levelCpuNanos{};
+  };
+
+  explicit DriverScheduler(Options options);
+
+  /// Runs the functions that are still queued and joins the threads.
+  ~DriverScheduler() override;
+
+  void add(folly::Func func) override;
+
+  /// Adds 'func' to run a Driver of the query of 'queryCtx'. 'func' runs at
+  /// the level of the query and its CPU time counts towards the query.
+  void add(folly::Func func, const std::shared_ptr<core::QueryCtx>& queryCtx);
+
+  /// Returns the level the Drivers of the query of 'queryCtx' are added at.
+  int32_t level(const core::QueryCtx& queryCtx) const;
+
+  Stats stats() const;
+
+  int32_t numThreads() const {
+    return workers_.size();
+  }
+
+  /// Returns the number of groups of threads that share a last level cache.
+  /// This is 1 unless Options::pinThreads is set.
+  int32_t numCacheDomains() const {
+    return domains_.size();
+  }
+
+  /// Returns the NUMA node of the CPUs of cache 'domain'. This is 0 unless
+  /// Options::pinThreads is set and the machine has several nodes.
+  int32_t numaNode(int32_t domain) const {
+    return domainNodes_[domain];
+  }
+
+  /// Returns the cache domain the Drivers of the query of 'queryCtx' are
+  /// queued in or -1 if the query has not added any.
+  int32_t cacheDomain(const core::QueryCtx& queryCtx) const;
+
+  /// Returns the number of functions waiting for a thread.
+  int64_t numQueued() const {
+    return numQueued_;
+  }
+
+ private:
+  struct QueryState {
+    QueryState(
+        std::weak_ptr<core::QueryCtx> _queryCtx,
+        double _weight,
+        int32_t _domain)
+        : queryCtx(std::move(_queryCtx)), weight(_weight), domain(_domain) {}
+
+    const std::weak_ptr<core::QueryCtx> queryCtx;
+    const double weight;
+    // The cache domain the functions of the query are queued in.
+    const int32_t domain;
+    std::atomic<uint64_t> cpuNanos{0};
+  };
+
+  struct Item {
+    folly::Func func;
+    // The query of the function or nullptr if it does not belong to a query.
+    std::shared_ptr<QueryState> query;
+    int32_t level;
+  };
+
+  struct Worker {
+    std::mutex mutex;
+    std::array<std::deque<Item>, kNumLevels> queues;
+    std::thread thread;
+    // The CPU the thread is bound to or -1 if not bound.
+    int32_t cpu{-1};
+    int32_t domain{0};
+    int32_t numaNode{0};
+    // The other workers in the order to take work from, the workers of the
+    // same domain first, then the workers of the same NUMA node.
+    std::vector<int32_t> stealOrder;
+  };
+
+  // Returns the scheduling state of the query of 'queryCtx', creating it on
+  // first use.
+  std::shared_ptr<QueryState> queryState(
+      const std::shared_ptr<core::QueryCtx>& queryCtx);
+
+  int32_t levelOf(const QueryState& query) const;
+
+  void enqueue(Item item);
+
+  // Returns the worker to queue 'item' on.
+  int32_t pickWorker(const Item& item);
+
+  // Takes the next item for the thread 'workerId' from its own queues or
+  // from the queues of another thread. Returns false if all queues are empty.
+  bool takeItem(int32_t workerId, Item& item);
+
+  // Takes the oldest item at 'level' from the queues of 'worker'.
+  bool takeFrom(Worker& worker, int32_t level, Item& item);
+
+  void run(int32_t workerId);
+
+  const Options options_;
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+
+  // The ids of the workers of each cache domain.
+  std::vector<std::vector<int32_t>> domains_;
+
+  // The NUMA node of each cache domain.
+  std::vector<int32_t> domainNodes_;
+
+  folly::Synchronized<
+      folly::F14FastMap<const core::QueryCtx*, std::shared_ptr<QueryState>>>
+      queries_;
+
+  // Number of queries added to 'queries_' since expired queries were last
+  // removed from it. Accessed under the lock of 'queries_'.
+  uint32_t numNewQueries_{0};
+
+  // CPU time of the functions run at each level.
+  std::array<std::atomic<uint64_t>, kNumLevels> levelCpuNanos_{};
+
+  // Number of queued items at each level and overall.
+  std::array<std::atomic<int64_t>, kNumLevels> numQueuedPerLevel_{};
+  std::atomic<int64_t> numQueued_{0};
+
+  std::atomic<uint32_t> nextWorker_{0};
+  std::atomic<uint32_t> nextDomain_{0};
+  std::atomic<uint64_t> numRuns_{0};
+  std::atomic<uint64_t> numSteals_{0};
+  std::atomic<uint64_t> numRemoteSteals_{0};
+  std::atomic<uint64_t> numRemoteNodeSteals_{0};
+
+  // Idle threads wait on 'idleCondition_' until an item is queued or the
+  // scheduler is destroyed.
+  std::mutex idleMutex_;
+  std::condition_variable idleCondition_;
+  std::atomic<int32_t> numIdle_{0};
+  bool stopped_{false};
+};
+
+} // namespace facebook::velox::exec
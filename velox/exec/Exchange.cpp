@@ -166,11 +166,24 @@ RowVectorPtr Exchange::getOutput() {
     if (currentPages_.empty()) {
       return nullptr;
     }
+    auto* prestoOptions = serdeKind_ == VectorSerde::Kind::kPresto &&
+            operatorCtx_->driverCtx()
+                ->queryConfig()
+                .exchangeZeroCopyDeserializationEnabled()
+        ? static_cast<serializer::presto::PrestoVectorSerde::PrestoOptions*>(
+              serdeOptions_.get())
+        : nullptr;
     vector_size_t resultOffset = 0;
-    for (const auto& page : currentPages_) {
+    for (auto& page : currentPages_) {
       rawInputBytes += page->size();
 
-      auto inputStream = page->prepareStreamForDeserialize();
+      // Shared with the vectors that reference the page in zero copy mode.
+      std::shared_ptr<SerializedPage> sharedPage(std::move(page));
+      if (prestoOptions != nullptr) {
+        prestoOptions->zeroCopyBuffer =
+            SerializedPage::contiguousBuffer(sharedPage);
+      }
+      auto inputStream = sharedPage->prepareStreamForDeserialize();
       while (!inputStream->atEnd()) {
         serde->deserialize(
             inputStream.get(),
@@ -182,6 +195,9 @@ RowVectorPtr Exchange::getOutput() {
         resultOffset = result_->size();
       }
     }
+    if (prestoOptions != nullptr) {
+      prestoOptions->zeroCopyBuffer = nullptr;
+    }
     currentPages_.clear();
     recordInputStats(rawInputBytes);
     return result_;
@@ -300,6 +316,11 @@ void Exchange::recordExchangeClientStats() {
     lockedStats->runtimeStats.erase(name);
     lockedStats->runtimeStats.insert({name, value});
   }
+  auto fetchLatency = exchangeClient_->fetchLatency();
+  if (!fetchLatency.empty()) {
+    lockedStats->latencyHistograms[ExchangeClient::kFetchLatency] =
+        std::move(fetchLatency);
+  }
 
   auto backgroundCpuTimeMs =
       exchangeClientStats.find(ExchangeClient::kBackgroundCpuTimeMs);
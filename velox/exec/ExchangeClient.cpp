@@ -19,6 +19,18 @@
 #include "velox/common/base/StatsReporter.h"
 
 namespace facebook::velox::exec {
+namespace {
+// Weight of the latest sample in the throughput and drain rate averages.
+constexpr double kRateSmoothing{0.3};
+
+// Minimum interval over which the consumer drain rate is sampled.
+constexpr uint64_t kDrainRateIntervalMs{100};
+
+double smoothRate(double average, double sample) {
+  return average == 0 ? sample
+                      : average + kRateSmoothing * (sample - average);
+}
+} // namespace
 
 void ExchangeClient::addRemoteTaskId(const std::string& remoteTaskId) {
   std::vector<RequestSpec> requestSpecs;
@@ -116,9 +128,26 @@ folly::F14FastMap<std::string, RuntimeMetric> ExchangeClient::stats() const {
   stats["averageReceivedPageBytes"] = RuntimeMetric(
       queue_->averageReceivedPageBytes(), RuntimeCounter::Unit::kBytes);
 
+  if (adaptiveFlowControl_) {
+    stats[kDrainBytesPerSec] = RuntimeMetric(
+        static_cast<int64_t>(drainBytesPerSec_), RuntimeCounter::Unit::kBytes);
+    RuntimeMetric sourceBytesPerSec(RuntimeCounter::Unit::kBytes);
+    for (const auto& [_, bytesPerSec] : sourceBytesPerSec_) {
+      sourceBytesPerSec.addValue(static_cast<int64_t>(bytesPerSec));
+    }
+    stats[kSourceBytesPerSec] = sourceBytesPerSec;
+    stats[kNumCreditLimitedRequests] =
+        RuntimeMetric(numCreditLimitedRequests_);
+  }
+
   return stats;
 }
 
+LatencyHistogram ExchangeClient::fetchLatency() const {
+  std::lock_guard<std::mutex> l(queue_->mutex());
+  return fetchLatency_;
+}
+
 std::vector<std::unique_ptr<SerializedPage>> ExchangeClient::next(
     int consumerId,
     uint32_t maxBytes,
@@ -137,6 +166,9 @@ std::vector<std::unique_ptr<SerializedPage>> ExchangeClient::next(
     *atEnd = false;
     pages = queue_->dequeueLocked(
         consumerId, maxBytes, atEnd, future, &stalePromise);
+    if (adaptiveFlowControl_) {
+      updateDrainRateLocked(pages);
+    }
     if (*atEnd) {
       return pages;
     }
@@ -169,9 +201,13 @@ void ExchangeClient::request(std::vector<RequestSpec>&& requestSpecs) {
     std::move(future)
         .via(executor_)
         .thenValue(
-            [self, spec = std::move(spec), sendTimeMs = getCurrentTimeMs()](
+            [self,
+             spec = std::move(spec),
+             sendTimeMs = getCurrentTimeMs(),
+             sendTimeNs = getCurrentTimeNano()](
                 ExchangeSource::Response&& response) {
               const auto requestTimeMs = getCurrentTimeMs() - sendTimeMs;
+              const auto requestTimeNs = getCurrentTimeNano() - sendTimeNs;
               if (spec.maxBytes == 0) {
                 RECORD_HISTOGRAM_METRIC_VALUE(
                     kMetricExchangeDataSizeTimeMs, requestTimeMs);
@@ -193,6 +229,13 @@ void ExchangeClient::request(std::vector<RequestSpec>&& requestSpecs) {
                 if (self->closed_) {
                   return;
                 }
+                if (spec.maxBytes > 0) {
+                  self->fetchLatency_.record(requestTimeNs);
+                }
+                if (self->adaptiveFlowControl_ && spec.maxBytes > 0) {
+                  self->updateSourceRateLocked(
+                      currentSource.get(), response.bytes, requestTimeMs);
+                }
                 if (!response.atEnd) {
                   if (!response.remainingBytes.empty()) {
                     for (auto bytes : response.remainingBytes) {
@@ -243,8 +286,13 @@ ExchangeClient::pickSourcesToRequestLocked() {
       maxQueuedBytes_ - queue_->totalBytes() - totalPendingBytes_;
   while (availableSpace > 0 && !producingSources_.empty()) {
     auto& source = producingSources_.front().source;
+    const auto credit = creditLocked(source.get());
     int64_t requestBytes = 0;
     for (auto bytes : producingSources_.front().remainingBytes) {
+      if (requestBytes > 0 && requestBytes + bytes > credit) {
+        ++numCreditLimitedRequests_;
+        break;
+      }
       availableSpace -= bytes;
       if (availableSpace < 0) {
         break;
@@ -283,6 +331,54 @@ ExchangeClient::pickSourcesToRequestLocked() {
   return requestSpecs;
 }
 
+int64_t ExchangeClient::creditLocked(const ExchangeSource* source) const {
+  if (!adaptiveFlowControl_ || drainBytesPerSec_ == 0) {
+    return std::numeric_limits<int64_t>::max();
+  }
+  auto it = sourceBytesPerSec_.find(source);
+  if (it == sourceBytesPerSec_.end()) {
+    return std::numeric_limits<int64_t>::max();
+  }
+  // A source is given credit for what it delivers while the consumers drain
+  // a full queue. Bytes requested beyond that are held as pending while
+  // faster sources could fill the queue.
+  const double drainTimeSec = std::max(
+      static_cast<double>(maxQueuedBytes_) / drainBytesPerSec_,
+      std::chrono::duration<double>(kRequestDataMaxWait).count());
+  return std::max<int64_t>(1, it->second * drainTimeSec);
+}
+
+void ExchangeClient::updateSourceRateLocked(
+    const ExchangeSource* source,
+    int64_t bytes,
+    uint64_t timeMs) {
+  if (bytes <= 0) {
+    return;
+  }
+  const double sample = bytes * 1'000.0 / std::max<uint64_t>(1, timeMs);
+  auto& bytesPerSec = sourceBytesPerSec_[source];
+  bytesPerSec = smoothRate(bytesPerSec, sample);
+}
+
+void ExchangeClient::updateDrainRateLocked(
+    const std::vector<std::unique_ptr<SerializedPage>>& pages) {
+  const auto nowMs = getCurrentTimeMs();
+  if (drainStartMs_ == 0) {
+    drainStartMs_ = nowMs;
+  }
+  for (const auto& page : pages) {
+    drainedBytes_ += page->size();
+  }
+  const auto elapsedMs = nowMs - drainStartMs_;
+  if (elapsedMs < kDrainRateIntervalMs) {
+    return;
+  }
+  drainBytesPerSec_ =
+      smoothRate(drainBytesPerSec_, drainedBytes_ * 1'000.0 / elapsedMs);
+  drainedBytes_ = 0;
+  drainStartMs_ = nowMs;
+}
+
 ExchangeClient::~ExchangeClient() {
   close();
 }
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "velox/common/base/LatencyHistogram.h"
 #include "velox/exec/ExchangeQueue.h"
 #include "velox/exec/ExchangeSource.h"
 
@@ -27,6 +28,19 @@ class ExchangeClient : public std::enable_shared_from_this<ExchangeClient> {
   static constexpr int32_t kDefaultMaxQueuedBytes = 32 << 20; // 32 MB.
   static constexpr std::chrono::milliseconds kRequestDataMaxWait{100};
   static inline const std::string kBackgroundCpuTimeMs = "backgroundCpuTimeMs";
+  /// Runtime metrics of the adaptive flow control.
+  static inline const std::string kDrainBytesPerSec = "drainBytesPerSec";
+  static inline const std::string kSourceBytesPerSec = "sourceBytesPerSec";
+  static inline const std::string kNumCreditLimitedRequests =
+      "numCreditLimitedRequests";
+  /// Latency histogram of the data requests to the sources.
+  static inline const std::string kFetchLatency = "exchangeFetchNanos";
+
+  /// If 'adaptiveFlowControl' is true, the bytes requested from each source
+  /// are limited to what the source is expected to deliver while the consumer
+  /// drains the queue, based on the observed source throughput and consumer
+  /// drain rate. This leaves queue space that slow sources would hold on to
+  /// for the faster ones.
 
   ExchangeClient(
       std::string taskId,
@@ -36,11 +50,13 @@ class ExchangeClient : public std::enable_shared_from_this<ExchangeClient> {
       uint64_t minOutputBatchBytes,
       memory::MemoryPool* pool,
       folly::Executor* executor,
-      int32_t requestDataSizesMaxWaitSec = 10)
+      int32_t requestDataSizesMaxWaitSec = 10,
+      bool adaptiveFlowControl = false)
       : taskId_{std::move(taskId)},
         destination_(destination),
         maxQueuedBytes_{maxQueuedBytes},
         kRequestDataSizesMaxWaitSec_{requestDataSizesMaxWaitSec},
+        adaptiveFlowControl_{adaptiveFlowControl},
         pool_(pool),
         executor_(executor),
         queue_(std::make_shared<ExchangeQueue>(
@@ -90,6 +106,10 @@ class ExchangeClient : public std::enable_shared_from_this<ExchangeClient> {
   // runtime metric named ExchangeClient::kBackgroundCpuTimeMs.
   folly::F14FastMap<std::string, RuntimeMetric> stats() const;
 
+  /// Returns the latency histogram of the data requests to the sources, from
+  /// sending a request to receiving its response, in nanoseconds.
+  LatencyHistogram fetchLatency() const;
+
   const std::shared_ptr<ExchangeQueue>& queue() const {
     return queue_;
   }
@@ -135,11 +155,26 @@ class ExchangeClient : public std::enable_shared_from_this<ExchangeClient> {
 
   void request(std::vector<RequestSpec>&& requestSpecs);
 
+  // Returns the max number of bytes to request from 'source' with adaptive
+  // flow control. A request for the first page of a source is never limited.
+  int64_t creditLocked(const ExchangeSource* source) const;
+
+  // Records a data response of 'bytes' from 'source' that took 'timeMs'.
+  void updateSourceRateLocked(
+      const ExchangeSource* source,
+      int64_t bytes,
+      uint64_t timeMs);
+
+  // Records that the consumers have dequeued 'pages'.
+  void updateDrainRateLocked(
+      const std::vector<std::unique_ptr<SerializedPage>>& pages);
+
   // Handy for ad-hoc logging.
   const std::string taskId_;
   const int destination_;
   const int64_t maxQueuedBytes_;
   const std::chrono::seconds kRequestDataSizesMaxWaitSec_;
+  const bool adaptiveFlowControl_;
 
   memory::MemoryPool* const pool_;
   folly::Executor* const executor_;
@@ -161,6 +196,20 @@ class ExchangeClient : public std::enable_shared_from_this<ExchangeClient> {
   std::queue<ProducingSource> producingSources_;
   // A queue of sources that returned empty response from the latest request.
   std::queue<std::shared_ptr<ExchangeSource>> emptySources_;
+
+  // Exponentially weighted average throughput of the data responses of each
+  // source. Only maintained with adaptive flow control.
+  folly::F14FastMap<const ExchangeSource*, double> sourceBytesPerSec_;
+  // Exponentially weighted average rate at which the consumers dequeue data.
+  double drainBytesPerSec_{0};
+  // Bytes dequeued since 'drainStartMs_'.
+  uint64_t drainedBytes_{0};
+  uint64_t drainStartMs_{0};
+  // Number of requests that were smaller than the available queue space
+  // because of the credit of the source.
+  uint64_t numCreditLimitedRequests_{0};
+  // Latency of the data requests to the sources.
+  LatencyHistogram fetchLatency_;
 };
 
 } // namespace facebook::velox::exec
@@ -50,6 +50,35 @@ std::unique_ptr<ByteInputStream> SerializedPage::prepareStreamForDeserialize() {
   return std::make_unique<BufferInputStream>(std::move(ranges_));
 }
 
+namespace {
+// Releaser of a BufferView over the data of a SerializedPage. Keeps the page
+// alive.
+class PageReleaser {
+ public:
+  explicit PageReleaser(std::shared_ptr<SerializedPage> page)
+      : page_(std::move(page)) {}
+
+  void addRef() const {}
+
+  void release() const {}
+
+ private:
+  const std::shared_ptr<SerializedPage> page_;
+};
+} // namespace
+
+// static
+BufferPtr SerializedPage::contiguousBuffer(
+    std::shared_ptr<SerializedPage> page) {
+  VELOX_CHECK_NOT_NULL(page);
+  const auto& iobuf = *page->iobuf_;
+  if (iobuf.isChained()) {
+    return nullptr;
+  }
+  return BufferView<PageReleaser>::create(
+      iobuf.data(), iobuf.length(), PageReleaser(std::move(page)));
+}
+
 void ExchangeQueue::noMoreSources() {
   std::vector<ContinuePromise> promises;
   {
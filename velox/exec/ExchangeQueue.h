@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "velox/buffer/Buffer.h"
 #include "velox/common/memory/ByteStream.h"
 
 namespace facebook::velox::exec {
@@ -48,6 +49,10 @@ class SerializedPage {
     return iobuf_->clone();
   }
 
+  /// Returns the data of 'page' as a Buffer that keeps 'page' alive, or
+  /// nullptr if the data is not held in a single contiguous IOBuf.
+  static BufferPtr contiguousBuffer(std::shared_ptr<SerializedPage> page);
+
  private:
   static int64_t chainBytes(folly::IOBuf& iobuf) {
     int64_t size = 0;
@@ -228,7 +228,12 @@ vector_size_t FilterProject::filter(
     const SelectivityVector& allRows) {
   std::vector<VectorPtr> results;
   exprs_->eval(0, 1, true, allRows, evalCtx, results);
-  return processFilterResults(results[0], allRows, filterEvalCtx_, pool());
+  const auto numPassed =
+      processFilterResults(results[0], allRows, filterEvalCtx_, pool());
+  // The filter result is consumed here. Return it to the vector pool so that
+  // the next batch reuses its buffers instead of allocating new ones.
+  operatorCtx_->execCtx()->releaseVector(results[0]);
+  return numPassed;
 }
 
 OperatorStats FilterProject::stats(bool clear) {
@@ -30,6 +30,22 @@ bool allAreSinglyReferenced(
   });
 }
 
+// Number of entries in GroupingSet::hotGroups_. Small enough to stay in L1.
+constexpr int32_t kHotGroupCacheSize = 1024;
+
+// Number of lookups after which the hot group cache is disabled if fewer than
+// kHotGroupCacheMinHitPct percent of them were hits.
+constexpr uint64_t kHotGroupCacheMinLookups = 100'000;
+constexpr uint64_t kHotGroupCacheMinHitPct = 50;
+
+// Minimum number of aggregates for updating them in blocks of rows. With fewer
+// aggregates each group row is touched too few times to gain from blocking.
+constexpr int32_t kMinBlockedAggregates = 4;
+
+inline int32_t hotGroupSlot(uint64_t normalizedKey) {
+  return folly::hasher<uint64_t>()(normalizedKey) & (kHotGroupCacheSize - 1);
+}
+
 // Returns true if all vectors are Lazy vectors, possibly wrapped, that haven't
 // been loaded yet.
 bool areAllLazyNotLoaded(const std::vector<VectorPtr>& vectors) {
@@ -73,7 +89,9 @@ GroupingSet::GroupingSet(
       rows_(operatorCtx->pool()),
       isAdaptive_(queryConfig_.hashAdaptivityEnabled()),
       pool_(*operatorCtx->pool()),
-      spillStats_(spillStats) {
+      spillStats_(spillStats),
+      hotGroupCacheEnabled_(queryConfig_.aggregationHotGroupCacheEnabled()),
+      updateBlockRows_(queryConfig_.aggregationUpdateBlockRows()) {
   VELOX_CHECK_NOT_NULL(nonReclaimableSection_);
   VELOX_CHECK(pool_.trackUsage());
 
@@ -81,6 +99,13 @@ GroupingSet::GroupingSet(
     keyChannels_.push_back(hasher->channel());
   }
 
+  // Emitting the groups of clustered input early is only correct if a final
+  // aggregation merges the groups.
+  if (isPartial_ && !isGlobal_ && preGroupedKeyChannels_.empty()) {
+    clusteredInputDetectionRows_ =
+        queryConfig_.aggregationClusteredInputDetectionRows();
+  }
+
   if (groupingKeyOutputProjections_.empty()) {
     groupingKeyOutputProjections_.resize(keyChannels_.size());
     std::iota(
@@ -111,13 +136,18 @@ GroupingSet::GroupingSet(
         "Partial aggregations over sorted inputs are not supported");
   }
 
+  // Groups of pre-grouped keys are freed and re-used while adding input, so
+  // their distinct inputs cannot be keyed on the group row.
+  const auto dedupThreshold = preGroupedKeyChannels_.empty()
+      ? queryConfig_.distinctAggregationDedupThreshold()
+      : 0;
   for (auto& aggregate : aggregates_) {
     if (aggregate.distinct) {
       VELOX_USER_CHECK(
           !isPartial_,
           "Partial aggregations over distinct inputs are not supported");
-      distinctAggregations_.emplace_back(
-          DistinctAggregations::create({&aggregate}, inputType, &pool_));
+      distinctAggregations_.emplace_back(DistinctAggregations::create(
+          {&aggregate}, inputType, &pool_, dedupThreshold));
     } else {
       distinctAggregations_.push_back(nullptr);
     }
@@ -130,28 +160,6 @@ GroupingSet::~GroupingSet() {
   }
 }
 
-std::unique_ptr<GroupingSet> GroupingSet::createForMarkDistinct(
-    const RowTypePtr& inputType,
-    std::vector<std::unique_ptr<VectorHasher>>&& hashers,
-    OperatorCtx* operatorCtx,
-    tsan_atomic<bool>* nonReclaimableSection) {
-  return std::make_unique<GroupingSet>(
-      inputType,
-      std::move(hashers),
-      /*preGroupedKeys=*/std::vector<column_index_t>{},
-      /*groupingKeyOutputProjections=*/std::vector<column_index_t>{},
-      /*aggregates=*/std::vector<AggregateInfo>{},
-      /*ignoreNullKeys=*/false,
-      /*isPartial=*/false,
-      /*isRawInput=*/false,
-      /*globalGroupingSets=*/std::vector<vector_size_t>{},
-      /*groupIdColumn=*/std::nullopt,
-      /*spillConfig=*/nullptr,
-      nonReclaimableSection,
-      operatorCtx,
-      /*spillStats=*/nullptr);
-};
-
 namespace {
 bool equalKeys(
     const std::vector<column_index_t>& keys,
@@ -200,6 +208,43 @@ void GroupingSet::addInput(const RowVectorPtr& input, bool mayPushdown) {
   activeRows_.setAll();
 
   addInputForActiveRows(input, mayPushdown);
+
+  if (clusteredInputDetectionRows_ > 0) {
+    detectClusteredInput(input);
+  }
+}
+
+void GroupingSet::detectClusteredInput(const RowVectorPtr& input) {
+  const auto numRows = input->size();
+  if (numRows == 0) {
+    return;
+  }
+  vector_size_t numRuns = 1;
+  for (auto i = 1; i < numRows; ++i) {
+    if (!equalKeys(keyChannels_, input, i - 1, i)) {
+      ++numRuns;
+    }
+  }
+  detectionRows_ += numRows;
+  detectionKeyRuns_ += numRuns;
+  ++detectionBatches_;
+
+  // With clustered input each run adds a new group, except that the first run
+  // of a batch may continue the last group of the previous batch.
+  const int64_t numDistinct = table_ ? table_->numDistinct() : 0;
+  if (numDistinct + detectionBatches_ < detectionKeyRuns_) {
+    clusteredInputDetectionRows_ = 0;
+    return;
+  }
+  if (detectionRows_ < clusteredInputDetectionRows_) {
+    return;
+  }
+  clusteredInputDetectionRows_ = 0;
+  // Flushing the completed groups pays off only if groups span several rows.
+  if (2 * detectionKeyRuns_ <= detectionRows_) {
+    preGroupedKeyChannels_ = keyChannels_;
+    streamingClusteredInput_ = true;
+  }
 }
 
 void GroupingSet::noMoreInput() {
@@ -255,12 +300,28 @@ void GroupingSet::addInputForActiveRows(
     return;
   }
 
-  table_->groupProbe(*lookup_, BaseHashTable::kNoSpillInputStartPartitionBit);
+  if (lookup_->rows.size() > 1 && hasConstantKeys()) {
+    probeConstantKeys();
+  } else {
+    const bool useHotGroups = useHotGroupCache();
+    if (useHotGroups) {
+      probeHotGroups();
+    }
+    if (!lookup_->rows.empty()) {
+      table_->groupProbe(
+          *lookup_, BaseHashTable::kNoSpillInputStartPartitionBit);
+      if (useHotGroups) {
+        updateHotGroups();
+      }
+    }
+  }
   masks_.addInput(input, activeRows_);
 
   auto* groups = lookup_->hits.data();
   const auto& newGroups = lookup_->newGroups;
 
+  const bool blocked = useBlockedUpdates(input);
+  blockedAggregates_.clear();
   for (auto i = 0; i < aggregates_.size(); ++i) {
     if (!aggregates_[i].sortingKeys.empty()) {
       continue;
@@ -290,6 +351,20 @@ void GroupingSet::addInputForActiveRows(
     }
 
     populateTempVectors(i, input);
+    // Lazy arguments are loaded by the update of the first block, so the
+    // aggregates with lazy arguments are not blocked.
+    if (blocked && &rows == &activeRows_ &&
+        std::none_of(
+            tempVectors_.begin(), tempVectors_.end(), [](const auto& arg) {
+              return isLazyNotLoaded(*arg);
+            })) {
+      if (blockedArgs_.size() <= blockedAggregates_.size()) {
+        blockedArgs_.emplace_back();
+      }
+      blockedArgs_[blockedAggregates_.size()] = std::move(tempVectors_);
+      blockedAggregates_.push_back(i);
+      continue;
+    }
     // TODO(spershin): We disable the pushdown at the moment if selectivity
     // vector has changed after groups generation, we might want to revisit
     // this.
@@ -302,6 +377,9 @@ void GroupingSet::addInputForActiveRows(
     }
   }
   tempVectors_.clear();
+  if (!blockedAggregates_.empty()) {
+    addBlockedInput(groups);
+  }
 
   if (sortedAggregations_) {
     if (!newGroups.empty()) {
@@ -311,6 +389,90 @@ void GroupingSet::addInputForActiveRows(
   }
 }
 
+bool GroupingSet::hasConstantKeys() const {
+  for (const auto& hasher : lookup_->hashers) {
+    if (!hasher->decodedVector().isConstantMapping()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void GroupingSet::probeConstantKeys() {
+  auto& rows = lookup_->rows;
+  const auto numRows = rows.size();
+  // Only 'rows[0]' is probed. The other rows stay in place because shrinking
+  // a raw_vector keeps its contents.
+  rows.resize(1);
+  table_->groupProbe(*lookup_, BaseHashTable::kNoSpillInputStartPartitionBit);
+  rows.resize(numRows);
+  auto* hits = lookup_->hits.data();
+  char* group = hits[rows[0]];
+  for (auto i = 1; i < numRows; ++i) {
+    hits[rows[i]] = group;
+  }
+  constantKeyRows_ += numRows;
+}
+
+bool GroupingSet::useHotGroupCache() {
+  if (!hotGroupCacheEnabled_) {
+    return false;
+  }
+  if (table_->hashMode() != BaseHashTable::HashMode::kNormalizedKey) {
+    // The normalized keys of the cached groups are no longer maintained.
+    hotGroups_.clear();
+    return false;
+  }
+  return true;
+}
+
+void GroupingSet::probeHotGroups() {
+  if (hotGroups_.empty()) {
+    hotGroups_.resize(kHotGroupCacheSize, nullptr);
+  }
+  // Before the probe of the table, 'hashes' has the normalized keys.
+  const auto* normalizedKeys = lookup_->hashes.data();
+  auto* hits = lookup_->hits.data();
+  auto& rows = lookup_->rows;
+  vector_size_t numMisses = 0;
+  for (auto i = 0; i < rows.size(); ++i) {
+    const auto row = rows[i];
+    const auto normalizedKey = normalizedKeys[row];
+    char* group = hotGroups_[hotGroupSlot(normalizedKey)];
+    if (group != nullptr &&
+        RowContainer::normalizedKey(group) == normalizedKey) {
+      hits[row] = group;
+    } else {
+      rows[numMisses++] = row;
+    }
+  }
+  hotGroupCacheLookups_ += rows.size();
+  hotGroupCacheHits_ += rows.size() - numMisses;
+  rows.resize(numMisses);
+}
+
+void GroupingSet::updateHotGroups() {
+  if (table_->hashMode() != BaseHashTable::HashMode::kNormalizedKey) {
+    hotGroups_.clear();
+    return;
+  }
+  if (hotGroupCacheLookups_ >= kHotGroupCacheMinLookups &&
+      hotGroupCacheHits_ * 100 <
+          hotGroupCacheLookups_ * kHotGroupCacheMinHitPct) {
+    // The keys are not skewed enough to pay for the lookups.
+    hotGroupCacheEnabled_ = false;
+    hotGroups_.clear();
+    return;
+  }
+  // After the probe of the table, 'hashes' has the hashes of the normalized
+  // keys and 'normalizedKeys' has the normalized keys.
+  const auto* normalizedKeys = lookup_->normalizedKeys.data();
+  const auto* hits = lookup_->hits.data();
+  for (const auto row : lookup_->rows) {
+    hotGroups_[hotGroupSlot(normalizedKeys[row])] = hits[row];
+  }
+}
+
 void GroupingSet::addRemainingInput() {
   activeRows_.resize(remainingInput_->size());
   activeRows_.clearAll();
@@ -346,6 +508,30 @@ void initializeAggregates(
     ++i;
   }
 }
+
+// Returns true if the accumulators of all 'aggregates' only append to the
+// HashStringAllocator. Sorted and distinct aggregations keep sets and
+// vectors that free memory as they grow, so these are excluded.
+bool allAppendOnly(
+    const std::vector<AggregateInfo>& aggregates,
+    bool hasSortedAggregations,
+    const std::vector<std::unique_ptr<DistinctAggregations>>&
+        distinctAggregations) {
+  if (aggregates.empty() || hasSortedAggregations) {
+    return false;
+  }
+  for (const auto& aggregation : distinctAggregations) {
+    if (aggregation != nullptr) {
+      return false;
+    }
+  }
+  for (const auto& aggregate : aggregates) {
+    if (!aggregate.appendOnly) {
+      return false;
+    }
+  }
+  return true;
+}
 } // namespace
 
 std::vector<Accumulator> GroupingSet::accumulators(bool excludeToIntermediate) {
@@ -382,6 +568,10 @@ void GroupingSet::createHashTable() {
 
   RowContainer& rows = *table_->rows();
   initializeAggregates(aggregates_, rows, false);
+  if (allAppendOnly(
+          aggregates_, sortedAggregations_ != nullptr, distinctAggregations_)) {
+    rows.stringAllocator().setAppendOnly(true);
+  }
 
   auto numColumns = rows.keyTypes().size() + aggregates_.size();
 
@@ -721,6 +911,52 @@ void GroupingSet::populateTempVectors(
   }
 }
 
+bool GroupingSet::useBlockedUpdates(const RowVectorPtr& input) const {
+  if (updateBlockRows_ <= 0 || input->size() <= updateBlockRows_) {
+    return false;
+  }
+  int32_t numAggregates = 0;
+  for (auto i = 0; i < aggregates_.size(); ++i) {
+    const auto& aggregate = aggregates_[i];
+    if (aggregate.sortingKeys.empty() && !aggregate.distinct &&
+        masks_.activeRows(i) == nullptr) {
+      ++numAggregates;
+    }
+  }
+  return numAggregates >= kMinBlockedAggregates;
+}
+
+void GroupingSet::addBlockedInput(char** groups) {
+  blockRows_.resizeFill(activeRows_.size(), false);
+  for (auto begin = activeRows_.begin(); begin < activeRows_.end();
+       begin += updateBlockRows_) {
+    const auto end =
+        std::min<vector_size_t>(begin + updateBlockRows_, activeRows_.end());
+    bits::copyBits(
+        activeRows_.allBits(),
+        begin,
+        blockRows_.asMutableRange().bits(),
+        begin,
+        end - begin);
+    blockRows_.updateBounds();
+    if (blockRows_.hasSelections()) {
+      for (auto i = 0; i < blockedAggregates_.size(); ++i) {
+        auto& function = aggregates_[blockedAggregates_[i]].function;
+        if (isRawInput_) {
+          function->addRawInput(groups, blockRows_, blockedArgs_[i], false);
+        } else {
+          function->addIntermediateResults(
+              groups, blockRows_, blockedArgs_[i], false);
+        }
+      }
+    }
+    blockRows_.setValidRange(begin, end, false);
+  }
+  for (auto i = 0; i < blockedAggregates_.size(); ++i) {
+    blockedArgs_[i].clear();
+  }
+}
+
 const SelectivityVector& GroupingSet::getSelectivityVector(
     size_t aggregateIndex) const {
   auto* rows = masks_.activeRows(aggregateIndex);
@@ -760,9 +996,7 @@ bool GroupingSet::getOutput(
             &iterator, maxOutputRows, maxOutputBytes, groups.data())
       : 0;
   if (numGroups == 0) {
-    if (table_ != nullptr) {
-      table_->clear(/*freeTable=*/true);
-    }
+    resetTable(/*freeTable=*/true);
     return false;
   }
   extractGroups(
@@ -814,6 +1048,10 @@ void GroupingSet::extractGroups(
 }
 
 void GroupingSet::resetTable(bool freeTable) {
+  hotGroups_.clear();
+  detectionRows_ = 0;
+  detectionBatches_ = 0;
+  detectionKeyRuns_ = 0;
   if (table_ != nullptr) {
     table_->clear(freeTable);
   }
@@ -1050,7 +1288,7 @@ void GroupingSet::spill() {
   if (sortedAggregations_) {
     sortedAggregations_->clear();
   }
-  table_->clear(/*freeTable=*/true);
+  resetTable(/*freeTable=*/true);
 }
 
 void GroupingSet::spill(const RowContainerIterator& rowIterator) {
@@ -1072,7 +1310,7 @@ void GroupingSet::spill(const RowContainerIterator& rowIterator) {
   // guarantee we don't accidentally enter an unsafe situation.
   rows->stringAllocator().freezeAndExecute(
       [&]() { outputSpiller_->spill(rowIterator); });
-  table_->clear(/*freeTable=*/true);
+  resetTable(/*freeTable=*/true);
 }
 
 bool GroupingSet::getOutputWithSpill(
@@ -1104,7 +1342,7 @@ bool GroupingSet::getOutputWithSpill(
       initializeAggregates(aggregates_, *mergeRows_, false);
     }
     VELOX_CHECK_EQ(table_->rows()->numRows(), 0);
-    table_->clear(/*freeTable=*/true);
+    resetTable(/*freeTable=*/true);
 
     VELOX_CHECK_NULL(merge_);
     if (inputSpiller_ != nullptr) {
@@ -1135,7 +1373,11 @@ bool GroupingSet::prepareNextSpillPartitionOutput() {
   VELOX_CHECK_NE(outputSpillPartition_, it->first.partitionNumber());
   outputSpillPartition_ = it->first.partitionNumber();
   merge_ = it->second->createOrderedReader(
-      spillConfig_->readBufferSize, &pool_, spillStats_);
+      spillConfig_->readBufferSize,
+      &pool_,
+      spillStats_,
+      spillConfig_->numReadAheadBuffers,
+      spillConfig_->executor);
   spillPartitionSet_.erase(it);
   return true;
 }
@@ -1407,6 +1649,7 @@ void GroupingSet::abandonPartialAggregation() {
       false,
       &pool_);
   initializeAggregates(aggregates_, *intermediateRows_, true);
+  hotGroups_.clear();
   table_.reset();
 }
 
@@ -30,6 +30,19 @@ class AggregationOutputSpiller;
 
 class GroupingSet {
  public:
+  /// Runtime stats for the hot group cache. The hit rate is the number of
+  /// hits over the number of lookups.
+  static inline const std::string kHotGroupCacheLookups{
+      "hotGroupCacheLookups"};
+  static inline const std::string kHotGroupCacheHits{"hotGroupCacheHits"};
+  /// Runtime stat for the number of input rows whose grouping keys were
+  /// constant for the whole batch, so that only one row per batch was probed.
+  static inline const std::string kConstantKeyRows{"constantKeyRows"};
+  /// Runtime stat set to 1 when a partial aggregation found its input to be
+  /// clustered on the grouping keys and switched to streaming output.
+  static inline const std::string kStreamingClusteredInput{
+      "streamingClusteredInput"};
+
   GroupingSet(
       const RowTypePtr& inputType,
       std::vector<std::unique_ptr<VectorHasher>>&& hashers,
@@ -48,13 +61,6 @@ class GroupingSet {
 
   ~GroupingSet();
 
-  /// Used by MarkDistinct operator to identify rows with unique values.
-  static std::unique_ptr<GroupingSet> createForMarkDistinct(
-      const RowTypePtr& inputType,
-      std::vector<std::unique_ptr<VectorHasher>>&& hashers,
-      OperatorCtx* operatorCtx,
-      tsan_atomic<bool>* nonReclaimableSection);
-
   void addInput(const RowVectorPtr& input, bool mayPushdown);
 
   void noMoreInput();
@@ -108,6 +114,28 @@ class GroupingSet {
 
   const HashLookup& hashLookup() const;
 
+  /// Returns the number of rows looked up in the hot group cache.
+  uint64_t hotGroupCacheLookups() const {
+    return hotGroupCacheLookups_;
+  }
+
+  /// Returns the number of rows whose group was found in the hot group cache.
+  uint64_t hotGroupCacheHits() const {
+    return hotGroupCacheHits_;
+  }
+
+  /// Returns the number of rows whose group was found by probing another row
+  /// of a batch with constant grouping keys.
+  uint64_t constantKeyRows() const {
+    return constantKeyRows_;
+  }
+
+  /// True if the input was found to be clustered on the grouping keys and the
+  /// groups are output as they complete.
+  bool streamingClusteredInput() const {
+    return streamingClusteredInput_;
+  }
+
   /// Spills all the rows in container.
   void spill();
 
@@ -161,6 +189,11 @@ class GroupingSet {
 
   void addInputForActiveRows(const RowVectorPtr& input, bool mayPushdown);
 
+  // Counts the runs of equal grouping keys in 'input' after it was added and
+  // switches to treating all grouping keys as pre-grouped once
+  // 'clusteredInputDetectionRows_' rows were consistent with clustered input.
+  void detectClusteredInput(const RowVectorPtr& input);
+
   void addRemainingInput();
 
   void initializeGlobalAggregation();
@@ -182,8 +215,36 @@ class GroupingSet {
 
   void createHashTable();
 
+  // Returns true if the groups of the rows in 'lookup_' are to be looked up in
+  // 'hotGroups_' before probing 'table_'.
+  bool useHotGroupCache();
+
+  // Sets 'lookup_->hits' for the rows in 'lookup_->rows' whose groups are in
+  // 'hotGroups_' and removes these rows from 'lookup_->rows'.
+  void probeHotGroups();
+
+  // Adds the groups of the rows in 'lookup_->rows' to 'hotGroups_' after
+  // probing 'table_'. Disables the cache if its hit rate is too low.
+  void updateHotGroups();
+
+  // Returns true if all the rows in 'lookup_' have the same grouping keys,
+  // e.g. the partition keys of a table scan split.
+  bool hasConstantKeys() const;
+
+  // Probes 'table_' with the first row in 'lookup_->rows' and sets the group
+  // of the other rows to the same group.
+  void probeConstantKeys();
+
   void populateTempVectors(int32_t aggregateIndex, const RowVectorPtr& input);
 
+  // Returns true if the aggregates updated from 'input' are to be updated in
+  // blocks of 'updateBlockRows_' rows.
+  bool useBlockedUpdates(const RowVectorPtr& input) const;
+
+  // Updates the aggregates in 'blockedAggregates_' from 'blockedArgs_' one
+  // block of 'activeRows_' at a time.
+  void addBlockedInput(char** groups);
+
   // If the given aggregation has mask, the method returns reference to the
   // selectivity vector from the maskedActiveRows_ (based on the mask channel
   // index for this aggregation), otherwise it returns reference to activeRows_.
@@ -290,8 +351,9 @@ class GroupingSet {
 
   std::vector<column_index_t> keyChannels_;
 
-  // A subset of grouping keys on which the input is clustered.
-  const std::vector<column_index_t> preGroupedKeyChannels_;
+  // A subset of grouping keys on which the input is clustered. Set to all
+  // grouping keys when a partial aggregation detects clustered input.
+  std::vector<column_index_t> preGroupedKeyChannels_;
 
   // Provides the column projections for extracting the grouping keys from
   // 'table_' for output. The vector index is the output channel and the value
@@ -411,6 +473,39 @@ class GroupingSet {
   std::vector<char*> firstGroup_;
 
   folly::Synchronized<common::SpillStats>* const spillStats_;
+
+  // Direct mapped cache of the groups of recently seen grouping keys, indexed
+  // by a hash of the normalized key. Lets the rows of a few frequent keys
+  // bypass the probe of 'table_'. Used only in kNormalizedKey mode, where the
+  // normalized key stored with the group identifies it. Empty if there are
+  // no cached groups. Cleared whenever the rows of 'table_' are freed.
+  std::vector<char*> hotGroups_;
+  bool hotGroupCacheEnabled_;
+  uint64_t hotGroupCacheLookups_{0};
+  uint64_t hotGroupCacheHits_{0};
+
+  // Number of rows per block for updating many aggregates together. 0 if the
+  // aggregates are updated one at a time.
+  const vector_size_t updateBlockRows_;
+
+  // Indices into 'aggregates_' of the aggregates updated in blocks and their
+  // arguments for the current input.
+  std::vector<int32_t> blockedAggregates_;
+  std::vector<std::vector<VectorPtr>> blockedArgs_;
+
+  // The rows of 'activeRows_' in the current block.
+  SelectivityVector blockRows_;
+  uint64_t constantKeyRows_{0};
+
+  // Number of input rows over which to check whether the input is clustered
+  // on the grouping keys. 0 once the check is done or if it does not apply.
+  int64_t clusteredInputDetectionRows_{0};
+  // Rows, batches and runs of rows with equal keys seen by the check since
+  // the last reset of 'table_'.
+  int64_t detectionRows_{0};
+  int64_t detectionBatches_{0};
+  int64_t detectionKeyRuns_{0};
+  bool streamingClusteredInput_{false};
 };
 
 class AggregationInputSpiller : public SpillerBase {
@@ -242,6 +242,19 @@ void HashAggregation::updateRuntimeStats() {
       RuntimeMetric(hashTableStats.numDistinct);
   runtimeStats[BaseHashTable::kNumTombstones] =
       RuntimeMetric(hashTableStats.numTombstones);
+  if (groupingSet_->hotGroupCacheLookups() > 0) {
+    runtimeStats[GroupingSet::kHotGroupCacheLookups] =
+        RuntimeMetric(groupingSet_->hotGroupCacheLookups());
+    runtimeStats[GroupingSet::kHotGroupCacheHits] =
+        RuntimeMetric(groupingSet_->hotGroupCacheHits());
+  }
+  if (groupingSet_->streamingClusteredInput()) {
+    runtimeStats[GroupingSet::kStreamingClusteredInput] = RuntimeMetric(1);
+  }
+  if (groupingSet_->constantKeyRows() > 0) {
+    runtimeStats[GroupingSet::kConstantKeyRows] =
+        RuntimeMetric(groupingSet_->constantKeyRows());
+  }
 }
 
 void HashAggregation::prepareOutput(vector_size_t size) {
@@ -55,12 +55,15 @@ HashBuild::HashBuild(
           operatorId,
           joinNode->id(),
           "HashBuild",
-          joinNode->canSpill(driverCtx->queryConfig())
+          joinNode->canSpill(driverCtx->queryConfig()) &&
+                  HashTableCache::cacheKey(*joinNode, *driverCtx).empty()
               ? driverCtx->makeSpillConfig(operatorId)
               : std::nullopt),
       joinNode_(std::move(joinNode)),
       joinType_{joinNode_->joinType()},
       nullAware_{joinNode_->isNullAware()},
+      fileBackedDirectory_(
+          driverCtx->queryConfig().hashBuildFileBackedDirectory()),
       needProbedFlagSpill_{needRightSideJoin(joinType_)},
       joinBridge_(operatorCtx_->task()->getHashJoinBridgeLocked(
           operatorCtx_->driverCtx()->splitGroupId,
@@ -70,6 +73,9 @@ HashBuild::HashBuild(
   VELOX_CHECK_NOT_NULL(joinBridge_);
 
   joinBridge_->addBuilder();
+  if (canSpill()) {
+    setupReservationHistory(*joinNode_->sources()[1]);
+  }
 
   const auto& inputType = joinNode_->sources()[1]->outputType();
 
@@ -83,8 +89,10 @@ HashBuild::HashBuild(
     keyChannels_.emplace_back(channel);
   }
 
-  // Identify the non-key build side columns and make a decoder for each.
-  const int32_t numDependents = inputType->size() - numKeys;
+  // Identify the non-key build side columns and make a decoder for each. The
+  // key-only tables of semi and anti joins without filter store none.
+  const bool keyOnly = isHashJoinKeyOnly(*joinNode_);
+  const int32_t numDependents = keyOnly ? 0 : inputType->size() - numKeys;
   if (numDependents > 0) {
     // Number of join keys (numKeys) may be less then number of input columns
     // (inputType->size()). In this case numDependents is negative and cannot be
@@ -94,13 +102,21 @@ HashBuild::HashBuild(
     dependentChannels_.reserve(numDependents);
     decoders_.reserve(numDependents);
   }
-  for (auto i = 0; i < inputType->size(); ++i) {
+  for (auto i = 0; i < inputType->size() && !keyOnly; ++i) {
     if (keyChannelMap_.find(i) == keyChannelMap_.end()) {
       dependentChannels_.emplace_back(i);
       decoders_.emplace_back(std::make_unique<DecodedVector>());
     }
   }
 
+  hashTableCacheKey_ =
+      HashTableCache::cacheKey(*joinNode_, *operatorCtx_->driverCtx());
+  if (!hashTableCacheKey_.empty()) {
+    auto lookup = joinBridge_->hashTableCacheLookup(hashTableCacheKey_);
+    cachedTable_ = std::move(lookup.entry);
+    tablePool_ = std::move(lookup.pool);
+  }
+
   tableType_ = hashJoinTableType(joinNode_);
   setupTable();
   setupSpiller();
@@ -117,6 +133,7 @@ void HashBuild::initialize() {
 
 void HashBuild::setupTable() {
   VELOX_CHECK_NULL(table_);
+  auto* tablePool = tablePool_ != nullptr ? tablePool_.get() : pool();
 
   const auto numKeys = keyChannels_.size();
   std::vector<std::unique_ptr<VectorHasher>> keyHashers;
@@ -143,13 +160,11 @@ void HashBuild::setupTable() {
         operatorCtx_->driverCtx()
             ->queryConfig()
             .minTableRowsForParallelJoinBuild(),
-        pool());
+        tablePool);
   } else {
     // (Left) semi and anti join with no extra filter only needs to know whether
     // there is a match. Hence, no need to store entries with duplicate keys.
-    const bool dropDuplicates = !joinNode_->filter() &&
-        (joinNode_->isLeftSemiFilterJoin() ||
-         joinNode_->isLeftSemiProjectJoin() || isAntiJoin(joinType_));
+    const bool dropDuplicates = isHashJoinKeyOnly(*joinNode_);
     // Right semi join needs to tag build rows that were probed.
     const bool needProbedFlag = joinNode_->isRightSemiFilterJoin();
     if (isLeftNullAwareJoinWithFilter(joinNode_)) {
@@ -163,7 +178,7 @@ void HashBuild::setupTable() {
           operatorCtx_->driverCtx()
               ->queryConfig()
               .minTableRowsForParallelJoinBuild(),
-          pool());
+          tablePool);
     } else {
       // Ignore null keys
       table_ = HashTable<true>::createForJoin(
@@ -174,7 +189,7 @@ void HashBuild::setupTable() {
           operatorCtx_->driverCtx()
               ->queryConfig()
               .minTableRowsForParallelJoinBuild(),
-          pool());
+          tablePool);
     }
   }
   analyzeKeys_ = table_->hashMode() != BaseHashTable::HashMode::kHash;
@@ -203,7 +218,11 @@ void HashBuild::setupSpiller(SpillPartition* spillPartition) {
   uint8_t startPartitionBit = config->startPartitionBit;
   if (spillPartition != nullptr) {
     spillInputReader_ = spillPartition->createUnorderedReader(
-        config->readBufferSize, pool(), spillStats_.get());
+        config->readBufferSize,
+        pool(),
+        spillStats_.get(),
+        config->numReadAheadBuffers,
+        config->executor);
     VELOX_CHECK(!restoringPartitionId_.has_value());
     restoringPartitionId_ = spillPartition->id();
     const auto numPartitionBits = config->numPartitionBits;
@@ -234,6 +253,12 @@ void HashBuild::setupSpiller(SpillPartition* spillPartition) {
           startPartitionBit, startPartitionBit + config->numPartitionBits),
       config,
       spillStats_.get());
+  if (canDropUnmatchedProbeRows(joinType_, nullAware_) &&
+      operatorCtx_->driverCtx()
+          ->queryConfig()
+          .hashProbeSpillInputFilterEnabled()) {
+    spiller_->enableKeyHashFilters();
+  }
 
   const int32_t numPartitions = spiller_->hashBits().numPartitions();
   spillInputIndicesBuffers_.resize(numPartitions);
@@ -308,6 +333,16 @@ void HashBuild::removeInputRowsForAntiJoinFilter() {
 
 void HashBuild::addInput(RowVectorPtr input) {
   checkRunning();
+
+  if (!isInputFromSpill() && joinBridge_->probeSideEmpty()) {
+    // All the probe operators finished without input before the table is
+    // built, so the join produces no output. Finish with the rows collected so
+    // far instead of reading the rest of the build side.
+    stats_.wlock()->addRuntimeStat(kAbandonedOnEmptyProbe, RuntimeCounter(1));
+    noMoreInput();
+    return;
+  }
+
   ensureInputFits(input);
 
   TestValue::adjust("facebook::velox::exec::HashBuild::addInput", this);
@@ -355,9 +390,12 @@ void HashBuild::addInput(RowVectorPtr input) {
     }
   }
 
+  // Rows dropped above, e.g. for null keys, are never stored or spilled, so
+  // the dependent columns are only loaded for the rows that remain.
   for (auto i = 0; i < dependentChannels_.size(); ++i) {
-    decoders_[i]->decode(
-        *input->childAt(dependentChannels_[i])->loadedVector(), activeRows_);
+    const auto& dependent = input->childAt(dependentChannels_[i]);
+    LazyVector::ensureLoadedRows(dependent, activeRows_);
+    decoders_[i]->decode(*dependent, activeRows_);
   }
 
   if (isAntiJoin(joinType_) && joinNode_->filter()) {
@@ -422,12 +460,28 @@ void HashBuild::addInput(RowVectorPtr input) {
       }
     }
   });
+
+  // The table of all rows is built on finish. Expect the usage to peak then.
+  setProjectedPeakMemoryBytes(std::max<uint64_t>(
+      predictedReservationBytes_.value_or(0),
+      pool()->usedBytes() + table_->estimateHashTableSize(rows->numRows())));
 }
 
 void HashBuild::ensureInputFits(RowVectorPtr& input) {
   // NOTE: we don't need memory reservation if all the partitions are spilling
   // as we spill all the input rows to disk directly.
-  if (!canSpill() || spiller_ == nullptr || spiller_->spillTriggered()) {
+  if (!canSpill()) {
+    maybeUseFileBackedStorage(input);
+    return;
+  }
+  if (spiller_ == nullptr || spiller_->spillTriggered()) {
+    return;
+  }
+
+  maybeReservePredictedMemory();
+  if (spiller_->spillTriggered()) {
+    // The predicted reservation made the arbitrator spill this operator.
+    pool()->release();
     return;
   }
 
@@ -509,6 +563,25 @@ void HashBuild::ensureInputFits(RowVectorPtr& input) {
                << ", reservation: " << succinctBytes(pool()->reservedBytes());
 }
 
+void HashBuild::maybeUseFileBackedStorage(const RowVectorPtr& input) {
+  auto* rows = table_->rows();
+  if (fileBackedDirectory_.empty() || rows->isFileBacked()) {
+    return;
+  }
+  const auto incrementBytes =
+      rows->sizeIncrement(input->size(), input->estimateFlatSize() * 2) +
+      table_->hashTableSizeIncrease(input->size());
+  if (pool()->availableReservation() >= incrementBytes ||
+      pool()->maybeReserve(incrementBytes)) {
+    return;
+  }
+  LOG(WARNING) << "Failed to reserve " << succinctBytes(incrementBytes)
+               << " for memory pool " << pool()->name()
+               << ", moving row storage to " << fileBackedDirectory_;
+  rows->enableFileBackedStorage(fileBackedDirectory_);
+  stats_.wlock()->addRuntimeStat(kFileBackedBuilds, RuntimeCounter(1));
+}
+
 void HashBuild::spillInput(const RowVectorPtr& input) {
   VELOX_CHECK_EQ(input->size(), activeRows_.size());
 
@@ -530,6 +603,9 @@ void HashBuild::spillInput(const RowVectorPtr& input) {
     activeRows_.setValid(row, false);
     ++numSpillInputs;
     rawSpillInputIndicesBuffers_[partition][numSpillInputs_[partition]++] = row;
+    if (spiller_->keyHashFiltersEnabled()) {
+      spiller_->addKeyHash(partition, hashes_[row]);
+    }
   }
   if (numSpillInputs == 0) {
     return;
@@ -588,15 +664,7 @@ void HashBuild::computeSpillPartitions(const RowVectorPtr& input) {
   if (hashes_.size() < activeRows_.end()) {
     hashes_.resize(activeRows_.end());
   }
-  const auto& hashers = table_->hashers();
-  for (auto i = 0; i < hashers.size(); ++i) {
-    auto& hasher = hashers[i];
-    if (hasher->channel() != kConstantChannel) {
-      hashers[i]->hash(activeRows_, i > 0, hashes_);
-    } else {
-      hashers[i]->hashPrecomputed(activeRows_, i > 0, hashes_);
-    }
-  }
+  VectorHasher::hashAll(table_->hashers(), activeRows_, hashes_);
 
   spillPartitions_.resize(input->size());
   activeRows_.applyToSelected([&](int32_t row) {
@@ -670,6 +738,13 @@ bool HashBuild::finishHashBuild() {
     }
   };
 
+  if (cachedTable_ != nullptr) {
+    stats_.wlock()->addRuntimeStat(kHashTableCacheHits, RuntimeCounter(1));
+    joinBridge_->setSharedHashTable(
+        HashTableCache::sharedTable(cachedTable_), cachedTable_->hasNullKeys);
+    return true;
+  }
+
   if (joinHasNullKeys_ && isAntiJoin(joinType_) && nullAware_ &&
       !joinNode_->filter()) {
     joinBridge_->setAntiJoinHasNullKeys();
@@ -710,6 +785,7 @@ bool HashBuild::finishHashBuild() {
   std::vector<std::unique_ptr<BaseHashTable>> otherTables;
   otherTables.reserve(peers.size());
   SpillPartitionSet spillPartitions;
+  SpillKeyHashFilters spillKeyHashFilters;
   for (auto* build : otherBuilds) {
     std::unique_ptr<HashBuildSpiller> spiller;
     {
@@ -725,11 +801,13 @@ bool HashBuild::finishHashBuild() {
     }
     if (spiller != nullptr) {
       spiller->finishSpill(spillPartitions);
+      spiller->finishKeyHashFilters(spillKeyHashFilters);
     }
   }
 
   if (spiller_ != nullptr) {
     spiller_->finishSpill(spillPartitions);
+    spiller_->finishKeyHashFilters(spillKeyHashFilters);
     removeEmptyPartitions(spillPartitions);
   }
 
@@ -783,11 +861,20 @@ bool HashBuild::finishHashBuild() {
               spillStats);
         };
   }
+  if (!hashTableCacheKey_.empty()) {
+    VELOX_CHECK(spillPartitions.empty());
+    auto entry = HashTableCache::instance().put(
+        hashTableCacheKey_, tablePool_, std::move(table_), joinHasNullKeys_);
+    joinBridge_->setSharedHashTable(
+        HashTableCache::sharedTable(entry), joinHasNullKeys_);
+    return true;
+  }
   joinBridge_->setHashTable(
       std::move(table_),
       std::move(spillPartitions),
       joinHasNullKeys_,
-      std::move(tableSpillFunc));
+      std::move(tableSpillFunc),
+      std::move(spillKeyHashFilters));
   if (canSpill()) {
     stateCleared_ = true;
   }
@@ -908,6 +995,17 @@ void HashBuild::addRuntimeStats() {
   uint64_t asDistinct{0};
   auto lockedStats = stats_.wlock();
 
+  if (table_->rows()->isFileBacked()) {
+    const auto [fileBackedBytes, residentBytes] =
+        table_->rows()->fileBackedBytes();
+    lockedStats->addRuntimeStat(
+        kFileBackedBytes,
+        RuntimeCounter(fileBackedBytes, RuntimeCounter::Unit::kBytes));
+    lockedStats->addRuntimeStat(
+        kResidentFileBackedBytes,
+        RuntimeCounter(residentBytes, RuntimeCounter::Unit::kBytes));
+  }
+
   for (const auto& timing : table_->parallelJoinBuildStats().partitionTimings) {
     lockedStats->getOutputTiming.add(timing);
     lockedStats->addRuntimeStat(
@@ -965,6 +1063,10 @@ BlockingReason HashBuild::isBlocked(ContinueFuture* future) {
     case State::kRunning:
       if (isInputFromSpill()) {
         processSpillInput();
+      } else if (cachedTable_ != nullptr && !noMoreInput_) {
+        // The table is taken from the HashTableCache without reading the
+        // build side input.
+        noMoreInput();
       }
       break;
     case State::kYield:
@@ -1201,9 +1303,57 @@ HashBuildSpiller::HashBuildSpiller(
 
 void HashBuildSpiller::spill() {
   spillTriggered_ = true;
+  if (keyHashFiltersEnabled_) {
+    addContainerKeyHashes();
+  }
   SpillerBase::spill(nullptr);
 }
 
+void HashBuildSpiller::addKeyHash(uint32_t partition, uint64_t hash) {
+  auto& filter = keyHashFilters_[partition];
+  if (filter == nullptr) {
+    filter = std::make_shared<BloomFilter<>>();
+    filter->reset(kKeyHashFilterCapacity);
+  }
+  filter->insert(hash);
+}
+
+void HashBuildSpiller::addContainerKeyHashes() {
+  constexpr int32_t kHashBatchSize = 4096;
+  std::vector<uint64_t> hashes(kHashBatchSize);
+  std::vector<char*> rows(kHashBatchSize);
+  RowContainerIterator iterator;
+  for (;;) {
+    const auto numRows = container_->listRows(
+        &iterator, rows.size(), RowContainer::kUnlimited, rows.data());
+    if (numRows == 0) {
+      break;
+    }
+    const auto rowSet = folly::Range<char**>(rows.data(), numRows);
+    for (auto i = 0; i < container_->keyTypes().size(); ++i) {
+      container_->hash(i, rowSet, i > 0, hashes.data());
+    }
+    for (auto i = 0; i < numRows; ++i) {
+      addKeyHash(bits_.partition(hashes[i]), hashes[i]);
+    }
+  }
+}
+
+void HashBuildSpiller::finishKeyHashFilters(SpillKeyHashFilters& filters) {
+  for (auto& [partition, filter] : keyHashFilters_) {
+    const auto partitionId = parentId_.has_value()
+        ? SpillPartitionId(parentId_.value(), partition)
+        : SpillPartitionId(partition);
+    auto& mergedFilter = filters[partitionId];
+    if (mergedFilter == nullptr) {
+      mergedFilter = std::move(filter);
+    } else {
+      mergedFilter->merge(*filter);
+    }
+  }
+  keyHashFilters_.clear();
+}
+
 void HashBuildSpiller::spill(
     const SpillPartitionId& partitionId,
     const RowVectorPtr& spillVector) {
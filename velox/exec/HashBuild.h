@@ -61,6 +61,24 @@ class HashBuild final : public Operator {
       DriverCtx* driverCtx,
       std::shared_ptr<const core::HashJoinNode> joinNode);
 
+  /// Runtime stat that counts the builds that used a table from the
+  /// HashTableCache.
+  static inline const std::string kHashTableCacheHits{"hashTableCacheHits"};
+
+  /// Runtime stat that counts the build operators that stopped reading their
+  /// input because the probe side turned out to be empty.
+  static inline const std::string kAbandonedOnEmptyProbe{
+      "abandonedOnEmptyProbe"};
+
+  /// Runtime stats for builds that could neither grow their memory nor spill
+  /// and moved their row storage to file backed memory. Counts such builds and
+  /// reports the size of the file backed storage and the part of it that was
+  /// resident in memory when the build finished.
+  static inline const std::string kFileBackedBuilds{"fileBackedBuilds"};
+  static inline const std::string kFileBackedBytes{"fileBackedBytes"};
+  static inline const std::string kResidentFileBackedBytes{
+      "residentFileBackedBytes"};
+
   void initialize() override;
 
   void addInput(RowVectorPtr input) override;
@@ -70,7 +88,7 @@ class HashBuild final : public Operator {
   }
 
   bool needsInput() const override {
-    return !noMoreInput_;
+    return !noMoreInput_ && cachedTable_ == nullptr;
   }
 
   void noMoreInput() override;
@@ -149,6 +167,12 @@ class HashBuild final : public Operator {
   // enabled.
   void ensureInputFits(RowVectorPtr& input);
 
+  // Invoked instead of ensureInputFits() if spilling is not possible. If the
+  // memory for 'input' cannot be reserved, moves the row storage of 'table_'
+  // to file backed memory under 'fileBackedDirectory_'. No-op if no directory
+  // is configured.
+  void maybeUseFileBackedStorage(const RowVectorPtr& input);
+
   // Invoked to ensure there is sufficient memory to build the join table. The
   // function throws to fail the query if the memory reservation fails.
   void ensureTableFits(uint64_t numRows);
@@ -212,6 +236,9 @@ class HashBuild final : public Operator {
 
   const bool nullAware_;
 
+  // Directory for file backed row storage. See maybeUseFileBackedStorage().
+  const std::string fileBackedDirectory_;
+
   // Sets to true for join type which needs right side join processing. The hash
   // table spiller then needs to record the probed flag, and the spilled input
   // reader also needs to restore the recorded probed flag. This is used to
@@ -244,6 +271,18 @@ class HashBuild final : public Operator {
   // Container for the rows being accumulated.
   std::unique_ptr<BaseHashTable> table_;
 
+  // The key of the table in the HashTableCache. Empty if the table is not
+  // shared with other tasks.
+  std::string hashTableCacheKey_;
+
+  // The table from the HashTableCache. If set, the build side input is not
+  // read.
+  std::shared_ptr<const HashTableCache::Entry> cachedTable_;
+
+  // The memory pool from the HashTableCache in which 'table_' is built if
+  // the table is added to the cache, so that it outlives the task.
+  std::shared_ptr<memory::MemoryPool> tablePool_;
+
   // Key channels in 'input_'
   std::vector<column_index_t> keyChannels_;
 
@@ -345,7 +384,36 @@ class HashBuildSpiller : public SpillerBase {
     return spillTriggered_;
   }
 
+  /// Makes 'this' build a key hash filter for each spilled partition. Must be
+  /// called before the first spill.
+  void enableKeyHashFilters() {
+    VELOX_CHECK(!spillTriggered_);
+    keyHashFiltersEnabled_ = true;
+  }
+
+  bool keyHashFiltersEnabled() const {
+    return keyHashFiltersEnabled_;
+  }
+
+  /// Adds the key 'hash' of a row spilled to 'partition' to its key hash
+  /// filter.
+  void addKeyHash(uint32_t partition, uint64_t hash);
+
+  /// Merges the key hash filters of 'this' into 'filters', keyed by the
+  /// partition ids finishSpill() produces.
+  void finishKeyHashFilters(SpillKeyHashFilters& filters);
+
  private:
+  // The number of expected keys each key hash filter is sized for. All the
+  // filters have the same size so that the filters of the same partition from
+  // different spillers can be merged. A filter only gets less selective when
+  // its partition has more distinct keys.
+  static constexpr int32_t kKeyHashFilterCapacity = 1 << 18;
+
+  // Adds the key hashes of all the rows in 'container_' to the key hash
+  // filters.
+  void addContainerKeyHashes();
+
   void extractSpill(folly::Range<char**> rows, RowVectorPtr& resultPtr)
       override;
 
@@ -360,6 +428,11 @@ class HashBuildSpiller : public SpillerBase {
   const bool spillProbeFlag_;
 
   bool spillTriggered_{false};
+
+  bool keyHashFiltersEnabled_{false};
+
+  // The key hash filters by spill partition number.
+  folly::F14FastMap<uint32_t, std::shared_ptr<BloomFilter<>>> keyHashFilters_;
 };
 } // namespace facebook::velox::exec
 
@@ -23,6 +23,12 @@ namespace {
 static const char* kSpillProbedFlagColumnName = "__probedFlag";
 }
 
+bool isHashJoinKeyOnly(const core::HashJoinNode& joinNode) {
+  return joinNode.filter() == nullptr &&
+      (joinNode.isLeftSemiFilterJoin() || joinNode.isLeftSemiProjectJoin() ||
+       joinNode.isAntiJoin());
+}
+
 RowTypePtr hashJoinTableType(
     const std::shared_ptr<const core::HashJoinNode>& joinNode) {
   const auto inputType = joinNode->sources()[1]->outputType();
@@ -43,6 +49,10 @@ RowTypePtr hashJoinTableType(
     types.emplace_back(inputType->childAt(channel));
   }
 
+  if (isHashJoinKeyOnly(*joinNode)) {
+    return ROW(std::move(names), std::move(types));
+  }
+
   for (auto i = 0; i < inputType->size(); ++i) {
     if (keyChannelSet.find(i) == keyChannelSet.end()) {
       names.emplace_back(inputType->nameOf(i));
@@ -84,6 +94,7 @@ void HashJoinBridge::reclaim() {
 
   appendSpilledHashTablePartitionsLocked(std::move(spillPartitionSet));
   buildResult_->spillPartitionIds = spillPartitionIdSet;
+  buildResult_->spillKeyHashFilters.clear();
   VELOX_CHECK(!restoringSpillPartitionId_.has_value());
 }
 
@@ -215,7 +226,8 @@ void HashJoinBridge::setHashTable(
     std::unique_ptr<BaseHashTable> table,
     SpillPartitionSet spillPartitionSet,
     bool hasNullKeys,
-    HashJoinTableSpillFunc&& tableSpillFunc) {
+    HashJoinTableSpillFunc&& tableSpillFunc,
+    SpillKeyHashFilters spillKeyHashFilters) {
   VELOX_CHECK_NOT_NULL(table, "setHashTable called with null table");
   VELOX_CHECK(table->numDistinct() == 0 || spillPartitionSet.empty());
   std::vector<ContinuePromise> promises;
@@ -234,6 +246,7 @@ void HashJoinBridge::setHashTable(
         std::move(restoringSpillPartitionId_),
         spillPartitionIdSet,
         hasNullKeys);
+    buildResult_->spillKeyHashFilters = std::move(spillKeyHashFilters);
     restoringSpillPartitionId_.reset();
     promises = std::move(promises_);
   }
@@ -257,6 +270,32 @@ void HashJoinBridge::setHashTable(
   notify(std::move(promises));
 }
 
+void HashJoinBridge::setSharedHashTable(
+    std::shared_ptr<BaseHashTable> table,
+    bool hasNullKeys) {
+  VELOX_CHECK_NOT_NULL(table, "setSharedHashTable called with null table");
+  std::vector<ContinuePromise> promises;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    VELOX_CHECK(started_);
+    VELOX_CHECK(!buildResult_.has_value());
+    VELOX_CHECK(restoringSpillShards_.empty());
+    buildResult_ =
+        HashBuildResult(std::move(table), std::nullopt, {}, hasNullKeys);
+    promises = std::move(promises_);
+  }
+  notify(std::move(promises));
+}
+
+HashTableCache::Lookup HashJoinBridge::hashTableCacheLookup(
+    const std::string& key) {
+  std::lock_guard<std::mutex> l(mutex_);
+  if (!hashTableCacheLookup_.has_value()) {
+    hashTableCacheLookup_ = HashTableCache::instance().lookup(key);
+  }
+  return hashTableCacheLookup_.value();
+}
+
 void HashJoinBridge::appendSpilledHashTablePartitions(
     SpillPartitionSet spillPartitionSet) {
   VELOX_CHECK(
@@ -313,6 +352,19 @@ std::optional<HashJoinBridge::HashBuildResult> HashJoinBridge::tableOrFuture(
   return std::nullopt;
 }
 
+void HashJoinBridge::probeInputFinishedBeforeBuild(
+    uint32_t numProbers,
+    bool hasInput) {
+  std::lock_guard<std::mutex> l(mutex_);
+  VELOX_CHECK_LT(numProbersFinishedBeforeBuild_, numProbers);
+  ++numProbersFinishedBeforeBuild_;
+  probeHasInputBeforeBuild_ |= hasInput;
+  if (numProbersFinishedBeforeBuild_ == numProbers &&
+      !probeHasInputBeforeBuild_) {
+    probeSideEmpty_ = true;
+  }
+}
+
 void HashJoinBridge::probeFinished(bool restart) {
   std::vector<ContinuePromise> promises;
   {
@@ -339,6 +391,7 @@ void HashJoinBridge::probeFinished(bool restart) {
       buildResult_->restoredPartitionId = std::nullopt;
       buildResult_->spillPartitionIds =
           toSpillPartitionIdSet(spillPartitionSet_.spillPartitions());
+      buildResult_->spillKeyHashFilters.clear();
       spillPartitionSet_.reset();
       return;
     }
@@ -465,6 +518,13 @@ bool needRightSideJoin(core::JoinType joinType) {
       isRightSemiFilterJoin(joinType) || isRightSemiProjectJoin(joinType);
 }
 
+bool canDropUnmatchedProbeRows(core::JoinType joinType, bool nullAware) {
+  return isInnerJoin(joinType) || isLeftSemiFilterJoin(joinType) ||
+      isRightSemiFilterJoin(joinType) ||
+      (isRightSemiProjectJoin(joinType) && !nullAware) ||
+      isRightJoin(joinType);
+}
+
 RowTypePtr hashJoinTableSpillType(
     const RowTypePtr& tableType,
     core::JoinType joinType) {
@@ -15,8 +15,10 @@
  */
 #pragma once
 
+#include "velox/common/base/BloomFilter.h"
 #include "velox/exec/HashBitRange.h"
 #include "velox/exec/HashTable.h"
+#include "velox/exec/HashTableCache.h"
 #include "velox/exec/JoinBridge.h"
 #include "velox/exec/MemoryReclaimer.h"
 #include "velox/exec/Spill.h"
@@ -26,6 +28,12 @@ struct HashTableHolder;
 }
 
 namespace facebook::velox::exec {
+
+/// Bloom filters over the join key hashes of the build rows of each spilled
+/// partition. HashProbe uses them to drop the probe rows without a match
+/// before spilling them.
+using SpillKeyHashFilters =
+    folly::F14FastMap<SpillPartitionId, std::shared_ptr<BloomFilter<>>>;
 class HashBuildSpiller;
 
 namespace test {
@@ -53,16 +61,31 @@ class HashJoinBridge : public JoinBridge {
   /// Invoked by the build operator to set the built hash table.
   /// 'spillPartitionSet' contains the spilled partitions while building
   /// 'table' which only applies if the disk spilling is enabled.
+  /// 'spillKeyHashFilters' optionally has the key hash filters of the
+  /// partitions in 'spillPartitionSet'.
   void setHashTable(
       std::unique_ptr<BaseHashTable> table,
       SpillPartitionSet spillPartitionSet,
       bool hasNullKeys,
-      HashJoinTableSpillFunc&& tableSpillFunc);
+      HashJoinTableSpillFunc&& tableSpillFunc,
+      SpillKeyHashFilters spillKeyHashFilters = {});
 
   void setHashTable(
       std::shared_ptr<wave::HashTableHolder> table,
       bool hasNullKeys);
 
+  /// Invoked by the build operator to set a read-only 'table' that is shared
+  /// with other tasks through the HashTableCache. The probe operators do not
+  /// spill or free a shared table.
+  void setSharedHashTable(
+      std::shared_ptr<BaseHashTable> table,
+      bool hasNullKeys);
+
+  /// Looks up 'key' in the HashTableCache once for all the HashBuild
+  /// operators of this bridge and returns the result. The operators either
+  /// all use the cached table or all build in the returned memory pool.
+  HashTableCache::Lookup hashTableCacheLookup(const std::string& key);
+
   /// Invoked by the probe operator to append the spilled hash table partitions
   /// while probing. The function appends the spilled table partitions into
   /// 'spillPartitionSets_' stack. This only applies if the disk spilling is
@@ -106,6 +129,10 @@ class HashJoinBridge : public JoinBridge {
     /// fine-grained spilling for hash table, either 'table' is empty or
     /// 'spillPartitionIds' is empty.
     SpillPartitionIdSet spillPartitionIds;
+
+    /// The key hash filters of the partitions in 'spillPartitionIds' that
+    /// have one. A filter covers all the build rows of its partition.
+    SpillKeyHashFilters spillKeyHashFilters;
   };
 
   /// Invoked by HashProbe operator to get the table to probe which is built by
@@ -141,6 +168,19 @@ class HashJoinBridge : public JoinBridge {
   /// 'spillPartition' will be set to null in the returned SpillInput.
   std::optional<SpillInput> spillInputOrFuture(ContinueFuture* future);
 
+  /// Invoked by a HashProbe operator that received all its input before the
+  /// hash table is built. 'numProbers' is the number of the HashProbe
+  /// operators. Once all of them have reported and none had input, the build
+  /// side is not needed.
+  void probeInputFinishedBeforeBuild(uint32_t numProbers, bool hasInput);
+
+  /// Returns true if all the HashProbe operators received all their input
+  /// before the hash table is built and the input is empty. The HashBuild
+  /// operators can then stop reading their input.
+  bool probeSideEmpty() const {
+    return probeSideEmpty_;
+  }
+
   bool testingHasMoreSpilledPartitions();
 
  private:
@@ -149,6 +189,9 @@ class HashJoinBridge : public JoinBridge {
 
   uint32_t numBuilders_{0};
 
+  // The result of looking up the build side table in the HashTableCache.
+  std::optional<HashTableCache::Lookup> hashTableCacheLookup_;
+
   // The result of the build side. It is set by the last build operator when
   // build is done.
   std::optional<HashBuildResult> buildResult_;
@@ -183,6 +226,15 @@ class HashJoinBridge : public JoinBridge {
   // processing.
   bool probeStarted_;
 
+  // The number of HashProbe operators that received all their input before
+  // the hash table is built.
+  uint32_t numProbersFinishedBeforeBuild_{0};
+
+  // True if any of these HashProbe operators had input.
+  bool probeHasInputBeforeBuild_{false};
+
+  std::atomic_bool probeSideEmpty_{false};
+
   friend test::HashJoinBridgeTestHelper;
 };
 
@@ -224,7 +276,19 @@ bool isHashProbeMemoryPool(const memory::MemoryPool& pool);
 
 bool needRightSideJoin(core::JoinType joinType);
 
-/// Returns the type of the hash table associated with this join.
+/// Returns true if a join of 'joinType' produces no output for the probe rows
+/// without a matching build key, so that HashProbe may drop such rows.
+bool canDropUnmatchedProbeRows(core::JoinType joinType, bool nullAware);
+
+/// Returns true if the join only needs to know whether a probe row has a
+/// matching build key, i.e. left semi filter, left semi project and anti joins
+/// without filter. The hash tables of these joins only store the distinct
+/// build keys, without dependent columns or duplicate row chains.
+bool isHashJoinKeyOnly(const core::HashJoinNode& joinNode);
+
+/// Returns the type of the hash table associated with this join. Contains the
+/// build keys followed by the other build columns, or only the build keys if
+/// isHashJoinKeyOnly() is true.
 RowTypePtr hashJoinTableType(
     const std::shared_ptr<const core::HashJoinNode>& joinNode);
 
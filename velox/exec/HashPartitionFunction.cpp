@@ -84,16 +84,31 @@ std::optional<uint32_t> HashPartitionFunction::partition(
   rows_.resize(size);
   rows_.setAll();
 
-  hashes_.resize(size);
-  for (auto i = 0; i < hashers_.size(); ++i) {
-    auto& hasher = hashers_[i];
+  bool allConstant = true;
+  for (auto& hasher : hashers_) {
     if (hasher->channel() != kConstantChannel) {
-      hashers_[i]->decode(*input.childAt(hasher->channel()), rows_);
-      hashers_[i]->hash(rows_, i > 0, hashes_);
-    } else {
-      hashers_[i]->hashPrecomputed(rows_, i > 0, hashes_);
+      hasher->decode(*input.childAt(hasher->channel()), rows_);
+      allConstant &= hasher->decodedVector().isConstantMapping();
     }
   }
+  if (allConstant && size > 0) {
+    // All the rows have the same keys, e.g. the partition keys of a split, so
+    // they go to the partition of the first row.
+    rows_.resize(1);
+  }
+
+  hashes_.resize(rows_.end());
+  VectorHasher::hashAll(hashers_, rows_, hashes_);
+
+  if (allConstant && size > 0) {
+    const uint64_t hash =
+        localExchange_ ? localExchangeHash(hashes_[0]) : hashes_[0];
+    const uint32_t partition = hashBitRange_.has_value()
+        ? hashBitRange_->partition(hash)
+        : hash % numPartitions_;
+    partitions.assign(size, partition);
+    return partition;
+  }
 
   partitions.resize(size);
   if (hashBitRange_.has_value()) {
@@ -21,6 +21,7 @@
 #include "velox/exec/OperatorUtils.h"
 #include "velox/exec/Task.h"
 #include "velox/expression/FieldReference.h"
+#include "velox/vector/LazyVector.h"
 
 using facebook::velox::common::testutil::TestValue;
 
@@ -30,6 +31,66 @@ namespace {
 
 // Batch size used when iterating the row container.
 constexpr int kBatchSize = 1024;
+
+template <typename T>
+std::unique_ptr<common::Filter> makeBloomFilter(
+    const BaseHashTable& table,
+    column_index_t key) {
+  auto bloomFilter = std::make_shared<BloomFilter<>>();
+  // The caller checks that the number of distinct keys is within the max size
+  // from QueryConfig, which fits in int32_t.
+  VELOX_DCHECK_LE(table.numDistinct(), std::numeric_limits<int32_t>::max());
+  bloomFilter->reset(static_cast<int32_t>(table.numDistinct()));
+  int64_t min = std::numeric_limits<int64_t>::max();
+  int64_t max = std::numeric_limits<int64_t>::min();
+  char* rows[kBatchSize];
+  for (auto* container : table.allRows()) {
+    const auto column = container->columnAt(key);
+    RowContainerIterator iter;
+    int32_t numRows;
+    while ((numRows = container->listRows(&iter, kBatchSize, rows)) > 0) {
+      for (auto i = 0; i < numRows; ++i) {
+        if (RowContainer::isNullAt(rows[i], column)) {
+          continue;
+        }
+        const int64_t value =
+            *reinterpret_cast<const T*>(rows[i] + column.offset());
+        bloomFilter->insert(common::BigintValuesUsingBloomFilter::hash(value));
+        min = std::min(min, value);
+        max = std::max(max, value);
+      }
+    }
+  }
+  if (min > max) {
+    return nullptr;
+  }
+  return std::make_unique<common::BigintValuesUsingBloomFilter>(
+      min, max, std::move(bloomFilter), false);
+}
+
+// Returns a bloom filter over the values of join key 'key' in 'table', or
+// nullptr if the key is not integral or 'table' has more than 'maxSize'
+// distinct keys.
+std::unique_ptr<common::Filter> makeBloomFilter(
+    const BaseHashTable& table,
+    column_index_t key,
+    uint64_t maxSize) {
+  if (table.numDistinct() == 0 || table.numDistinct() > maxSize) {
+    return nullptr;
+  }
+  switch (table.hashers()[key]->typeKind()) {
+    case TypeKind::TINYINT:
+      return makeBloomFilter<int8_t>(table, key);
+    case TypeKind::SMALLINT:
+      return makeBloomFilter<int16_t>(table, key);
+    case TypeKind::INTEGER:
+      return makeBloomFilter<int32_t>(table, key);
+    case TypeKind::BIGINT:
+      return makeBloomFilter<int64_t>(table, key);
+    default:
+      return nullptr;
+  }
+}
 } // namespace
 
 // static
@@ -83,6 +144,61 @@ void extractColumns(
   }
 }
 
+// Extracts a build side column of the joined rows from the hash table when
+// loaded. Holds a reference to the table to keep the rows valid.
+class BuildColumnLoader : public VectorLoader {
+ public:
+  BuildColumnLoader(
+      std::shared_ptr<BaseHashTable> table,
+      BufferPtr rows,
+      int32_t columnIndex,
+      TypePtr type,
+      memory::MemoryPool* pool)
+      : table_(std::move(table)),
+        rows_(std::move(rows)),
+        columnIndex_(columnIndex),
+        type_(std::move(type)),
+        pool_(pool) {}
+
+ protected:
+  void loadInternal(
+      RowSet rows,
+      ValueHook* hook,
+      vector_size_t resultSize,
+      VectorPtr* result) override {
+    VELOX_CHECK_NULL(hook);
+    const auto* rawRows = rows_->as<char*>();
+    BufferPtr selectedRows;
+    if (rows.size() < resultSize) {
+      // Only extract the requested rows. The other rows are left null.
+      selectedRows = AlignedBuffer::allocate<char*>(resultSize, pool_);
+      auto* rawSelectedRows = selectedRows->asMutable<char*>();
+      std::fill(rawSelectedRows, rawSelectedRows + resultSize, nullptr);
+      for (const auto row : rows) {
+        rawSelectedRows[row] = rawRows[row];
+      }
+      rawRows = rawSelectedRows;
+    }
+    if (*result == nullptr || !BaseVector::isVectorWritable(*result) ||
+        !(*result)->isFlatEncoding()) {
+      *result = BaseVector::create(type_, resultSize, pool_);
+    } else {
+      (*result)->resize(resultSize);
+    }
+    table_->extractColumn(
+        folly::Range<char* const*>(rawRows, resultSize),
+        columnIndex_,
+        *result);
+  }
+
+ private:
+  const std::shared_ptr<BaseHashTable> table_;
+  const BufferPtr rows_;
+  const int32_t columnIndex_;
+  const TypePtr type_;
+  memory::MemoryPool* const pool_;
+};
+
 BlockingReason fromStateToBlockingReason(ProbeOperatorState state) {
   switch (state) {
     case ProbeOperatorState::kRunning:
@@ -118,7 +234,8 @@ HashProbe::HashProbe(
           operatorId,
           joinNode->id(),
           "HashProbe",
-          joinNode->canSpill(driverCtx->queryConfig())
+          joinNode->canSpill(driverCtx->queryConfig()) &&
+                  HashTableCache::cacheKey(*joinNode, *driverCtx).empty()
               ? driverCtx->makeSpillConfig(operatorId)
               : std::nullopt),
       outputBatchSize_{outputBatchRows()},
@@ -132,6 +249,7 @@ HashProbe::HashProbe(
       filterResult_(1),
       outputTableRowsCapacity_(outputBatchSize_) {
   VELOX_CHECK_NOT_NULL(joinBridge_);
+  sharedTable_ = !HashTableCache::cacheKey(*joinNode_, *driverCtx).empty();
 }
 
 void HashProbe::initialize() {
@@ -148,6 +266,8 @@ void HashProbe::initialize() {
 
   VELOX_CHECK_NULL(lookup_);
   lookup_ = std::make_unique<HashLookup>(hashers_, pool());
+  lookup_->probePartitionBytes =
+      operatorCtx_->driverCtx()->queryConfig().hashProbeRadixPartitionBytes();
   auto buildType = joinNode_->sources()[1]->outputType();
   auto tableType = makeTableType(buildType.get(), joinNode_->rightKeys());
   if (joinNode_->filter()) {
@@ -185,6 +305,19 @@ void HashProbe::initialize() {
   if (nullAware_) {
     filterTableResult_.resize(1);
   }
+
+  lazyBuildColumns_ = !canSpill() &&
+      operatorCtx_->driverCtx()->queryConfig().hashProbeLazyBuildColumns();
+
+  // Right, full and right semi project joins need the whole build side even
+  // if the probe side is empty, so there is nothing to gain from buffering.
+  if (!isRightJoin(joinType_) && !isFullJoin(joinType_) &&
+      !isRightSemiProjectJoin(joinType_) &&
+      !operatorCtx_->task()->hasMixedExecutionGroupJoin(joinNode_.get())) {
+    preBuildBufferBytes_ = operatorCtx_->driverCtx()
+                               ->queryConfig()
+                               .hashProbePreBuildBufferBytes();
+  }
 }
 
 void HashProbe::initializeFilter(
@@ -288,7 +421,11 @@ void HashProbe::maybeSetupSpillInputReader(
   VELOX_CHECK_EQ(partition->id(), restoredPartitionId.value());
   restoringPartitionId_ = restoredPartitionId;
   spillInputReader_ = partition->createUnorderedReader(
-      spillConfig_->readBufferSize, pool(), spillStats_.get());
+      spillConfig_->readBufferSize,
+      pool(),
+      spillStats_.get(),
+      spillConfig_->numReadAheadBuffers,
+      spillConfig_->executor);
   inputSpillPartitionSet_.erase(iter);
 }
 
@@ -375,6 +512,9 @@ void HashProbe::initializeResultIter() {
 
 void HashProbe::pushdownDynamicFilters() {
   auto* driver = operatorCtx_->driverCtx()->driver;
+  const auto bloomFilterMaxSize = operatorCtx_->driverCtx()
+                                      ->queryConfig()
+                                      .hashProbeBloomFilterPushdownMaxSize();
   auto numFilters = driver->pushdownFilters(
       this,
       keyChannels_,
@@ -383,22 +523,37 @@ void HashProbe::pushdownDynamicFilters() {
         if (dynamicFiltersProducedOnChannels_.contains(sourceChannel)) {
           return true;
         }
-        filter = table_->hashers()[sourceChannel]->getFilter(false);
+        // The hashers only track the distinct values if the table is not in
+        // hash mode.
+        if (table_->hashMode() != BaseHashTable::HashMode::kHash) {
+          filter = table_->hashers()[sourceChannel]->getFilter(false);
+        }
+        if (!filter && keyChannels_.size() == 1 && bloomFilterMaxSize > 0) {
+          // The bloom filter is only pushed down for a single key as it does
+          // not reject anything for the combination of multiple keys.
+          filter = makeBloomFilter(*table_, sourceChannel, bloomFilterMaxSize);
+        }
         if (!filter) {
           return false;
         }
+        const bool isBloomFilter =
+            filter->kind() == common::FilterKind::kBigintValuesUsingBloomFilter;
         for (auto* peer : findPeerOperators()) {
           peer->dynamicFiltersProducedOnChannels_.insert(sourceChannel);
+          peer->bloomFilterPushedDown_ |= isBloomFilter;
         }
         return true;
       });
   // The join can be completely replaced with a pushed down filter when the
   // following conditions are met:
   //  * hash table has a single key with unique values,
-  //  * build side has no dependent columns.
+  //  * build side has no dependent columns,
+  //  * the pushed down filter is exact, i.e. not a bloom filter.
   if (keyChannels_.size() == 1 && !table_->hasDuplicateKeys() &&
       tableOutputProjections_.empty() && !filter_ && numFilters > 0 &&
-      !isRightJoin(joinType_)) {
+      !isRightJoin(joinType_) && !bloomFilterPushedDown_ &&
+      preBuildInputs_.empty()) {
+    // NOTE: the input buffered before the table was built is not filtered.
     canReplaceWithDynamicFilter_ = true;
   }
 }
@@ -425,6 +580,7 @@ void HashProbe::asyncWaitForHashTable() {
       // always returns nothing.
       // The flag must be set on the first (and only) built 'table_'.
       VELOX_CHECK(inputSpillPartitionSet_.empty());
+      preBuildInputs_.clear();
       noMoreInput();
       return;
     }
@@ -438,6 +594,12 @@ void HashProbe::asyncWaitForHashTable() {
 
   maybeSetupSpillInputReader(hashBuildResult->restoredPartitionId);
   maybeSetupInputSpiller(hashBuildResult->spillPartitionIds);
+  if (canDropUnmatchedProbeRows(joinType_, nullAware_)) {
+    spillInputKeyHashFilters_ =
+        std::move(hashBuildResult->spillKeyHashFilters);
+  } else {
+    spillInputKeyHashFilters_.clear();
+  }
   checkMaxSpillLevel(hashBuildResult->restoredPartitionId);
 
   if (table_->numDistinct() == 0) {
@@ -447,6 +609,7 @@ void HashProbe::asyncWaitForHashTable() {
             operatorCtx_->driverCtx()
                 ->queryConfig()
                 .hashProbeFinishEarlyOnEmptyBuild()) {
+          preBuildInputs_.clear();
           noMoreInput();
         } else {
           skipInput_ = true;
@@ -458,8 +621,11 @@ void HashProbe::asyncWaitForHashTable() {
        isRightSemiFilterJoin(joinType_) ||
        (isRightSemiProjectJoin(joinType_) && !nullAware_) ||
        isRightJoin(joinType_)) &&
-      table_->hashMode() != BaseHashTable::HashMode::kHash && !isSpillInput() &&
-      !hasMoreSpillData()) {
+      (table_->hashMode() != BaseHashTable::HashMode::kHash ||
+       operatorCtx_->driverCtx()
+               ->queryConfig()
+               .hashProbeBloomFilterPushdownMaxSize() > 0) &&
+      !isSpillInput() && !hasMoreSpillData()) {
     // Find out whether there are any upstream operators that can accept dynamic
     // filters on all or a subset of the join keys. Create dynamic filters to
     // push down.
@@ -550,17 +716,45 @@ void HashProbe::spillInput(RowVectorPtr& input) {
       input->size(), inputSpiller_->state().spilledPartitionIdSet());
 
   spillPartitionFunction_->partition(*input, spillPartitions_);
+  hasSpillInputKeyHashes_ = table_ != nullptr &&
+      table_->hashMode() == BaseHashTable::HashMode::kHash;
 
   vector_size_t numNonSpillingInput = 0;
+  vector_size_t numFilteredInput = 0;
+  const auto& keyHashes = spillPartitionFunction_->hashes();
+  // The key hash filter of the partition of the previous spilled row.
+  std::optional<SpillPartitionId> filterPartitionId;
+  const BloomFilter<>* filter{nullptr};
   for (auto row = 0; row < numInputRows; ++row) {
     const auto& partitionId = spillPartitions_[row];
     if (!inputSpiller_->state().isPartitionSpilled(partitionId)) {
       rawNonSpillInputIndicesBuffer_[numNonSpillingInput++] = row;
       continue;
     }
+    if (!spillInputKeyHashFilters_.empty()) {
+      if (filterPartitionId != partitionId) {
+        filterPartitionId = partitionId;
+        auto it = spillInputKeyHashFilters_.find(partitionId);
+        filter =
+            it == spillInputKeyHashFilters_.end() ? nullptr : it->second.get();
+      }
+      if (filter != nullptr && !filter->mayContain(keyHashes[row])) {
+        ++numFilteredInput;
+        continue;
+      }
+    }
     rawSpillInputIndicesBuffers_.at(
         partitionId)[numSpillInputs_.at(partitionId)++] = row;
   }
+  if (numFilteredInput > 0) {
+    addRuntimeStat(kSpillInputFilteredRows, RuntimeCounter(numFilteredInput));
+  }
+  if (hasSpillInputKeyHashes_) {
+    spillInputKeyHashes_.resize(numNonSpillingInput);
+    for (auto i = 0; i < numNonSpillingInput; ++i) {
+      spillInputKeyHashes_[i] = keyHashes[rawNonSpillInputIndicesBuffer_[i]];
+    }
+  }
   if (numNonSpillingInput == numInputRows) {
     return;
   }
@@ -621,10 +815,19 @@ BlockingReason HashProbe::isBlocked(ContinueFuture* future) {
   switch (state_) {
     case ProbeOperatorState::kWaitForBuild:
       VELOX_CHECK_NULL(table_);
+      if (future_.valid() && future_.isReady()) {
+        // The table got built while buffering the probe input.
+        future_ = ContinueFuture::makeEmpty();
+      }
       if (!future_.valid()) {
         setRunning();
         asyncWaitForHashTable();
       }
+      if (future_.valid() && canBufferPreBuildInput()) {
+        // Keep 'future_' and read more probe input while the table is being
+        // built.
+        return BlockingReason::kNotBlocked;
+      }
       break;
     case ProbeOperatorState::kRunning:
       VELOX_CHECK_NOT_NULL(table_);
@@ -668,7 +871,22 @@ void HashProbe::decodeAndDetectNonNullKeys() {
   }
 }
 
+bool HashProbe::canBufferPreBuildInput() const {
+  return state_ == ProbeOperatorState::kWaitForBuild && !noMoreInput_ &&
+      preBuildInputBytes_ < preBuildBufferBytes_;
+}
+
 void HashProbe::addInput(RowVectorPtr input) {
+  if (state_ == ProbeOperatorState::kWaitForBuild) {
+    VELOX_CHECK(canBufferPreBuildInput());
+    const auto numInput = input->size();
+    numPreBuildInputRows_ += numInput;
+    preBuildInputBytes_ += input->retainedSize();
+    addRuntimeStat(kPreBuildBufferedRows, RuntimeCounter(numInput));
+    preBuildInputs_.push_back(std::move(input));
+    return;
+  }
+
   if (skipInput_) {
     VELOX_CHECK_NULL(input_);
     return;
@@ -690,6 +908,7 @@ void HashProbe::addInput(RowVectorPtr input) {
   }
 
   bool hasDecoded = false;
+  hasSpillInputKeyHashes_ = false;
 
   if (needToSpillInput()) {
     if (isRightSemiProjectJoin(joinType_) && !probeSideHasNullKeys_) {
@@ -740,7 +959,12 @@ void HashProbe::addInput(RowVectorPtr input) {
         activeRows_.size() - activeRows_.countSelected();
   }
 
-  table_->prepareForJoinProbe(*lookup_.get(), input_, activeRows_, false);
+  table_->prepareForJoinProbe(
+      *lookup_.get(),
+      input_,
+      activeRows_,
+      false,
+      hasSpillInputKeyHashes_ ? spillInputKeyHashes_.data() : nullptr);
 
   if (joinIncludesMissesFromLeft(joinType_)) {
     // Make sure to allocate an entry in 'hits' for every input row to allow for
@@ -840,16 +1064,19 @@ void HashProbe::fillLeftSemiProjectMatchColumn(vector_size_t size) {
 void HashProbe::fillOutput(vector_size_t size) {
   prepareOutput(size);
 
+  std::vector<std::pair<const Buffer*, BufferPtr>> composedIndices;
   for (auto [in, out] : projectedInputColumns_) {
     // Load input vector if it is being split into multiple batches. It is not
     // safe to wrap unloaded LazyVector into two different dictionaries.
     ensureLoadedIfNotAtEnd(in);
-    auto inputChild = input_->childAt(in);
-    output_->childAt(out) = wrapChild(size, outputRowMapping_, inputChild);
+    output_->childAt(out) =
+        wrapProbeColumn(size, input_->childAt(in), composedIndices);
   }
 
   if (isLeftSemiProjectJoin(joinType_)) {
     fillLeftSemiProjectMatchColumn(size);
+  } else if (lazyBuildColumns_) {
+    fillLazyBuildColumns(size);
   } else {
     extractColumns(
         table_.get(),
@@ -861,6 +1088,62 @@ void HashProbe::fillOutput(vector_size_t size) {
   }
 }
 
+VectorPtr HashProbe::wrapProbeColumn(
+    vector_size_t size,
+    const VectorPtr& column,
+    std::vector<std::pair<const Buffer*, BufferPtr>>& composedIndices) {
+  if (outputRowMapping_ == nullptr ||
+      column->encoding() != VectorEncoding::Simple::DICTIONARY ||
+      column->nulls() != nullptr) {
+    return wrapChild(size, outputRowMapping_, column);
+  }
+
+  // In a chain of joins, e.g. a star join, every join would otherwise add a
+  // dictionary level over the fact table columns.
+  const auto& innerIndices = column->wrapInfo();
+  BufferPtr indices;
+  for (const auto& [buffer, composed] : composedIndices) {
+    if (buffer == innerIndices.get()) {
+      indices = composed;
+      break;
+    }
+  }
+  if (indices == nullptr) {
+    indices = allocateIndices(size, pool());
+    auto* rawIndices = indices->asMutable<vector_size_t>();
+    const auto* rawInnerIndices = innerIndices->as<vector_size_t>();
+    const auto* rawMapping = outputRowMapping_->as<vector_size_t>();
+    for (auto i = 0; i < size; ++i) {
+      rawIndices[i] = rawInnerIndices[rawMapping[i]];
+    }
+    composedIndices.emplace_back(innerIndices.get(), indices);
+  }
+  return BaseVector::wrapInDictionary(
+      nullptr, indices, size, column->valueVector());
+}
+
+void HashProbe::fillLazyBuildColumns(vector_size_t size) {
+  if (tableOutputProjections_.empty()) {
+    return;
+  }
+  // 'outputTableRows_' is reused for the next output batch, so the lazy
+  // vectors share a copy of the rows.
+  auto rows = AlignedBuffer::allocate<char*>(size, pool());
+  std::memcpy(
+      rows->asMutable<char*>(),
+      outputTableRows_->as<char*>(),
+      size * sizeof(char*));
+  for (const auto& projection : tableOutputProjections_) {
+    const auto& type = outputType_->childAt(projection.outputChannel);
+    output_->childAt(projection.outputChannel) = std::make_shared<LazyVector>(
+        pool(),
+        type,
+        size,
+        std::make_unique<BuildColumnLoader>(
+            table_, rows, projection.inputChannel, type, pool()));
+  }
+}
+
 RowVectorPtr HashProbe::getBuildSideOutput() {
   auto* outputTableRows =
       initBuffer<char*>(outputTableRows_, outputTableRowsCapacity_, pool());
@@ -1004,9 +1287,34 @@ RowVectorPtr HashProbe::getOutput() {
   SCOPE_EXIT {
     pool()->release();
   };
+  if (state_ == ProbeOperatorState::kWaitForBuild) {
+    // Buffering the probe input until the table is built.
+    return nullptr;
+  }
+  if (isRunning() && processPreBuildInput()) {
+    return nullptr;
+  }
   return getOutputInternal(/*toSpillOutput=*/false);
 }
 
+bool HashProbe::processPreBuildInput() {
+  if (input_ != nullptr || table_ == nullptr) {
+    return false;
+  }
+  if (!preBuildInputs_.empty()) {
+    auto input = std::move(preBuildInputs_.front());
+    preBuildInputs_.pop_front();
+    addInput(std::move(input));
+    return false;
+  }
+  if (deferredNoMoreInput_) {
+    deferredNoMoreInput_ = false;
+    noMoreInputInternal();
+    return true;
+  }
+  return false;
+}
+
 RowVectorPtr HashProbe::getOutputInternal(bool toSpillOutput) {
   if (isFinished()) {
     return nullptr;
@@ -1070,7 +1378,8 @@ RowVectorPtr HashProbe::getOutputInternal(bool toSpillOutput) {
           }
         } else {
           joinBridge_->probeFinished();
-          if (table_ != nullptr) {
+          // A table shared through the HashTableCache is used by other tasks.
+          if (table_ != nullptr && !sharedTable_) {
             table_->clear(true);
           }
         }
@@ -1681,7 +1990,20 @@ void HashProbe::ensureLoaded(column_index_t channel) {
 }
 
 void HashProbe::noMoreInput() {
+  const bool waitForBuild = state_ == ProbeOperatorState::kWaitForBuild;
+  if (waitForBuild && !noMoreInput_ && preBuildBufferBytes_ > 0) {
+    // Lets the build side stop early if no prober has seen any input.
+    joinBridge_->probeInputFinishedBeforeBuild(
+        operatorCtx_->task()->numDrivers(operatorCtx_->driver()),
+        numPreBuildInputRows_ > 0);
+  }
   Operator::noMoreInput();
+  if (waitForBuild || !preBuildInputs_.empty()) {
+    // Finish the input after processing the buffered input.
+    deferredNoMoreInput_ = true;
+    return;
+  }
+  deferredNoMoreInput_ = false;
   noMoreInputInternal();
 }
 
@@ -2021,7 +2343,11 @@ void HashProbe::maybeSetupSpillOutputReader() {
 
   spillOutputReader_ =
       spillOutputPartitionSet_.begin()->second->createUnorderedReader(
-          spillConfig_->readBufferSize, pool(), spillStats_.get());
+          spillConfig_->readBufferSize,
+          pool(),
+          spillStats_.get(),
+          spillConfig_->numReadAheadBuffers,
+          spillConfig_->executor);
   spillOutputPartitionSet_.clear();
 }
 
@@ -2067,6 +2393,7 @@ void HashProbe::close() {
   restoringPartitionId_.reset();
   spillOutputPartitionSet_.clear();
   spillOutputReader_.reset();
+  preBuildInputs_.clear();
   clearBuffers();
 
   // Fullfill any pending promises
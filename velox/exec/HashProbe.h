@@ -32,6 +32,16 @@ class HashProbe : public Operator {
       DriverCtx* driverCtx,
       const std::shared_ptr<const core::HashJoinNode>& hashJoinNode);
 
+  /// Runtime stat that counts the probe input rows buffered while the hash
+  /// table is being built. See QueryConfig::kHashProbePreBuildBufferBytes.
+  static inline const std::string kPreBuildBufferedRows{"preBuildBufferedRows"};
+
+  /// Runtime stat that counts the probe input rows of spilled partitions that
+  /// were dropped instead of spilled because the key hash filter of their
+  /// build partition showed they have no match.
+  static inline const std::string kSpillInputFilteredRows{
+      "spillInputFilteredRows"};
+
   void initialize() override;
 
   bool needsInput() const override {
@@ -40,6 +50,10 @@ class HashProbe : public Operator {
       return false;
     }
     if (table_) {
+      // Process the input buffered before the table was built first.
+      return preBuildInputs_.empty();
+    }
+    if (canBufferPreBuildInput()) {
       return true;
     }
     // NOTE: if we can't apply dynamic filtering, then we can start early to
@@ -155,6 +169,21 @@ class HashProbe : public Operator {
   // Populate output columns.
   void fillOutput(vector_size_t size);
 
+  // Wraps probe input 'column' in a dictionary over the first 'size' rows of
+  // 'outputRowMapping_'. If 'column' is a dictionary without nulls, e.g. the
+  // output of an upstream join, composes its indices with the mapping instead
+  // of adding a dictionary level. The composed indices are cached in
+  // 'composedIndices' by the indices buffer of 'column', so the probe columns
+  // of one upstream join share a single buffer.
+  VectorPtr wrapProbeColumn(
+      vector_size_t size,
+      const VectorPtr& column,
+      std::vector<std::pair<const Buffer*, BufferPtr>>& composedIndices);
+
+  // Sets the build side output columns to lazy vectors over the first 'size'
+  // rows in 'outputTableRows_'.
+  void fillLazyBuildColumns(vector_size_t size);
+
   // Populate 'match' output column for the left semi join project,
   void fillLeftSemiProjectMatchColumn(vector_size_t size);
 
@@ -303,6 +332,9 @@ class HashProbe : public Operator {
   // NOTE: this method keeps 'input' as is if no row needs spilling; resets it
   // to null if all rows have been spilled; wraps in a dictionary using rows
   // number that do not need spilling otherwise.
+  //
+  // If 'table_' is in kHash mode, also sets 'spillInputKeyHashes_' to the key
+  // hashes of the rows left in 'input' for reuse in the join probe.
   void spillInput(RowVectorPtr& input);
 
   // Invoked to prepare indices buffers for input spill processing.
@@ -319,6 +351,15 @@ class HashProbe : public Operator {
   // next hash table from the spilled data.
   void noMoreInputInternal();
 
+  // Returns true if the probe input can be buffered while waiting for the hash
+  // table to be built.
+  bool canBufferPreBuildInput() const;
+
+  // Processes the next input buffered before the hash table was built, or
+  // finishes the input once all of it has been processed. Returns true if the
+  // probe input finished.
+  bool processPreBuildInput();
+
   // Indicates if this hash probe operator is under non-reclaimable state or
   // not.
   bool nonReclaimableState() const;
@@ -415,6 +456,35 @@ class HashProbe : public Operator {
 
   folly::F14FastSet<column_index_t> dynamicFiltersProducedOnChannels_;
 
+  // True if a bloom filter has been pushed down on the join key by this or a
+  // peer operator. The bloom filter is not exact and the join can't be replaced
+  // with it.
+  bool bloomFilterPushedDown_{false};
+
+  // True if the table is shared with other tasks through the HashTableCache.
+  // The table is then not spilled or cleared.
+  bool sharedTable_{false};
+
+  // True if the build side output columns are produced as lazy vectors. Only
+  // set if the join can't spill, since spilling frees the table rows that
+  // unloaded vectors refer to.
+  bool lazyBuildColumns_{false};
+
+  // The max bytes of probe input to buffer while waiting for the hash table
+  // to be built. 0 if the join type needs the build side even without probe
+  // input.
+  uint64_t preBuildBufferBytes_{0};
+
+  // The probe input received while waiting for the hash table. Processed in
+  // order once the table is ready, before the new input.
+  std::deque<RowVectorPtr> preBuildInputs_;
+  uint64_t preBuildInputBytes_{0};
+  uint64_t numPreBuildInputRows_{0};
+
+  // True if noMoreInput() was received before the hash table is ready or
+  // before all of 'preBuildInputs_' is processed.
+  bool deferredNoMoreInput_{false};
+
   // True if the join can become a no-op starting with the next batch of input.
   bool canReplaceWithDynamicFilter_{false};
 
@@ -697,6 +767,10 @@ class HashProbe : public Operator {
   // Used to calculate the spill partition numbers of the probe inputs.
   std::unique_ptr<SpillPartitionFunction> spillPartitionFunction_;
 
+  // The key hash filters of the build side spilled partitions. Only set if
+  // the join drops the probe rows without a match.
+  SpillKeyHashFilters spillInputKeyHashFilters_;
+
   // Reusable memory for spill hash partition calculation.
   std::vector<SpillPartitionId> spillPartitions_;
 
@@ -708,6 +782,12 @@ class HashProbe : public Operator {
   BufferPtr nonSpillInputIndicesBuffer_;
   vector_size_t* rawNonSpillInputIndicesBuffer_;
 
+  // The key hashes of the probe input rows kept by spillInput(). They are
+  // computed for spill partitioning with the same hash function as 'table_'
+  // in kHash mode, so the join probe does not need to hash the keys again.
+  raw_vector<uint64_t> spillInputKeyHashes_;
+  bool hasSpillInputKeyHashes_{false};
+
   // 'spillInputReader_' is only created if 'table_' is built from the
   // previously spilled data. It is used to read the probe inputs from the
   // corresponding spilled data on disk.
@@ -22,6 +22,7 @@
 #include "velox/common/process/ProcessBase.h"
 #include "velox/common/process/TraceContext.h"
 #include "velox/common/testutil/TestValue.h"
+#include "velox/exec/HashBitRange.h"
 #include "velox/exec/OperatorUtils.h"
 #include "velox/vector/VectorTypeUtils.h"
 
@@ -65,6 +66,7 @@ HashTable<ignoreNullKeys>::HashTable(
       hashMode_ = HashMode::kHash;
     }
   }
+  keyShape_ = keyShapeOf(hashers_);
 
   rows_ = std::make_unique<RowContainer>(
       keys,
@@ -347,23 +349,82 @@ char* HashTable<ignoreNullKeys>::insertEntry(
   return group;
 }
 
+// static
 template <bool ignoreNullKeys>
-bool HashTable<ignoreNullKeys>::compareKeys(
+BaseHashTable::KeyShape HashTable<ignoreNullKeys>::keyShapeOf(
+    const std::vector<std::unique_ptr<VectorHasher>>& hashers) {
+  if (hashers.empty() || hashers.size() > 2) {
+    return KeyShape::kGeneric;
+  }
+  for (const auto& hasher : hashers) {
+    if (hasher->type()->providesCustomComparison()) {
+      return KeyShape::kGeneric;
+    }
+  }
+  const auto first = hashers[0]->typeKind();
+  if (hashers.size() == 1) {
+    switch (first) {
+      case TypeKind::BIGINT:
+        return KeyShape::kBigint;
+      case TypeKind::VARCHAR:
+        return KeyShape::kVarchar;
+      default:
+        return KeyShape::kGeneric;
+    }
+  }
+  if (first != TypeKind::BIGINT) {
+    return KeyShape::kGeneric;
+  }
+  switch (hashers[1]->typeKind()) {
+    case TypeKind::BIGINT:
+      return KeyShape::kTwoBigints;
+    case TypeKind::VARCHAR:
+      return KeyShape::kBigintVarchar;
+    default:
+      return KeyShape::kGeneric;
+  }
+}
+
+template <bool ignoreNullKeys>
+template <BaseHashTable::KeyShape shape>
+FOLLY_ALWAYS_INLINE bool HashTable<ignoreNullKeys>::compareKeys(
     const char* group,
     HashLookup& lookup,
     vector_size_t row) {
-  int32_t numKeys = lookup.hashers.size();
-  // The loop runs at least once. Allow for first comparison to fail
-  // before loop end check.
-  int32_t i = 0;
-  do {
-    auto& hasher = lookup.hashers[i];
-    if (!rows_->equals<!ignoreNullKeys>(
-            group, rows_->columnAt(i), hasher->decodedVector(), row)) {
-      return false;
-    }
-  } while (++i < numKeys);
-  return true;
+  constexpr bool mayHaveNulls = !ignoreNullKeys;
+  constexpr auto kBigintKind = TypeKind::BIGINT;
+  constexpr auto kVarcharKind = TypeKind::VARCHAR;
+  const auto& hashers = lookup.hashers;
+  if constexpr (shape == KeyShape::kBigint) {
+    return rows_->equalsTyped<mayHaveNulls, kBigintKind>(
+        group, rows_->columnAt(0), hashers[0]->decodedVector(), row);
+  } else if constexpr (shape == KeyShape::kVarchar) {
+    return rows_->equalsTyped<mayHaveNulls, kVarcharKind>(
+        group, rows_->columnAt(0), hashers[0]->decodedVector(), row);
+  } else if constexpr (shape == KeyShape::kTwoBigints) {
+    return rows_->equalsTyped<mayHaveNulls, kBigintKind>(
+               group, rows_->columnAt(0), hashers[0]->decodedVector(), row) &&
+        rows_->equalsTyped<mayHaveNulls, kBigintKind>(
+            group, rows_->columnAt(1), hashers[1]->decodedVector(), row);
+  } else if constexpr (shape == KeyShape::kBigintVarchar) {
+    return rows_->equalsTyped<mayHaveNulls, kBigintKind>(
+               group, rows_->columnAt(0), hashers[0]->decodedVector(), row) &&
+        rows_->equalsTyped<mayHaveNulls, kVarcharKind>(
+            group, rows_->columnAt(1), hashers[1]->decodedVector(), row);
+  } else {
+    int32_t numKeys = lookup.hashers.size();
+    // The loop runs at least once. Allow for first comparison to fail
+    // before loop end check.
+    int32_t i = 0;
+    do {
+      auto& hasher = hashers[i];
+      if (!rows_->equals<mayHaveNulls>(
+              group, rows_->columnAt(i), hasher->decodedVector(), row)) {
+        return false;
+      }
+    } while (++i < numKeys);
+    return true;
+  }
 }
 
 template <bool ignoreNullKeys>
@@ -381,7 +442,7 @@ bool HashTable<ignoreNullKeys>::compareKeys(
 }
 
 template <bool ignoreNullKeys>
-template <bool isJoin, bool isNormalizedKey>
+template <bool isJoin, bool isNormalizedKey, BaseHashTable::KeyShape shape>
 FOLLY_ALWAYS_INLINE void HashTable<ignoreNullKeys>::fullProbe(
     HashLookup& lookup,
     ProbeState& state,
@@ -408,7 +469,9 @@ FOLLY_ALWAYS_INLINE void HashTable<ignoreNullKeys>::fullProbe(
   lookup.hits[state.row()] = state.fullProbe<op>(
       *this,
       0,
-      [&](char* group, int32_t row) { return compareKeys(group, lookup, row); },
+      [&](char* group, int32_t row) INLINE_LAMBDA {
+        return compareKeys<shape>(group, lookup, row);
+      },
       [&](int32_t row, uint64_t index) {
         return isJoin ? nullptr : insertEntry(lookup, index, row);
       },
@@ -420,6 +483,11 @@ namespace {
 // Group prefetch size for join build & probe.
 constexpr int32_t kPrefetchSize = 64;
 
+// Maximum number of hash bits for radix partitioning a join probe batch.
+// Probe batches are about a thousand rows, so that more partitions would hold
+// too few rows to benefit from the partitioning.
+constexpr uint8_t kMaxProbePartitionBits = 8;
+
 // Normalized keys have non0-random bits. Bits need to be propagated
 // up to make a tag byte and down so that non-lowest bits of
 // normalized key affect the hash table index.
@@ -468,6 +536,28 @@ void HashTable<ignoreNullKeys>::groupProbe(
     groupNormalizedKeyProbe(lookup);
     return;
   }
+  switch (keyShape_) {
+    case KeyShape::kBigint:
+      groupHashProbe<KeyShape::kBigint>(lookup);
+      break;
+    case KeyShape::kTwoBigints:
+      groupHashProbe<KeyShape::kTwoBigints>(lookup);
+      break;
+    case KeyShape::kVarchar:
+      groupHashProbe<KeyShape::kVarchar>(lookup);
+      break;
+    case KeyShape::kBigintVarchar:
+      groupHashProbe<KeyShape::kBigintVarchar>(lookup);
+      break;
+    default:
+      groupHashProbe<KeyShape::kGeneric>(lookup);
+      break;
+  }
+}
+
+template <bool ignoreNullKeys>
+template <BaseHashTable::KeyShape shape>
+void HashTable<ignoreNullKeys>::groupHashProbe(HashLookup& lookup) {
   ProbeState state1;
   ProbeState state2;
   ProbeState state3;
@@ -490,16 +580,16 @@ void HashTable<ignoreNullKeys>::groupProbe(
     state3.firstProbe<ProbeState::Operation::kInsert>(*this, 0);
     state4.firstProbe<ProbeState::Operation::kInsert>(*this, 0);
 
-    fullProbe<false>(lookup, state1, false);
-    fullProbe<false>(lookup, state2, true);
-    fullProbe<false>(lookup, state3, true);
-    fullProbe<false>(lookup, state4, true);
+    fullProbe<false, false, shape>(lookup, state1, false);
+    fullProbe<false, false, shape>(lookup, state2, true);
+    fullProbe<false, false, shape>(lookup, state3, true);
+    fullProbe<false, false, shape>(lookup, state4, true);
   }
   for (; probeIndex < numProbes; ++probeIndex) {
     int32_t row = rows[probeIndex];
     state1.preProbe(*this, lookup.hashes[row], row);
     state1.firstProbe(*this, 0);
-    fullProbe<false>(lookup, state1, false);
+    fullProbe<false, false, shape>(lookup, state1, false);
   }
 }
 
@@ -602,9 +692,33 @@ void HashTable<ignoreNullKeys>::joinProbe(HashLookup& lookup) {
     joinNormalizedKeyProbe(lookup);
     return;
   }
+  const vector_size_t* rows = joinProbeRows(lookup);
+  switch (keyShape_) {
+    case KeyShape::kBigint:
+      joinHashProbe<KeyShape::kBigint>(lookup, rows);
+      break;
+    case KeyShape::kTwoBigints:
+      joinHashProbe<KeyShape::kTwoBigints>(lookup, rows);
+      break;
+    case KeyShape::kVarchar:
+      joinHashProbe<KeyShape::kVarchar>(lookup, rows);
+      break;
+    case KeyShape::kBigintVarchar:
+      joinHashProbe<KeyShape::kBigintVarchar>(lookup, rows);
+      break;
+    default:
+      joinHashProbe<KeyShape::kGeneric>(lookup, rows);
+      break;
+  }
+}
+
+template <bool ignoreNullKeys>
+template <BaseHashTable::KeyShape shape>
+void HashTable<ignoreNullKeys>::joinHashProbe(
+    HashLookup& lookup,
+    const vector_size_t* rows) {
   int32_t probeIndex = 0;
   int32_t numProbes = lookup.rows.size();
-  const vector_size_t* rows = lookup.rows.data();
   ProbeState state1;
   ProbeState state2;
   ProbeState state3;
@@ -622,16 +736,16 @@ void HashTable<ignoreNullKeys>::joinProbe(HashLookup& lookup) {
     state2.firstProbe(*this, 0);
     state3.firstProbe(*this, 0);
     state4.firstProbe(*this, 0);
-    fullProbe<true>(lookup, state1, false);
-    fullProbe<true>(lookup, state2, false);
-    fullProbe<true>(lookup, state3, false);
-    fullProbe<true>(lookup, state4, false);
+    fullProbe<true, false, shape>(lookup, state1, false);
+    fullProbe<true, false, shape>(lookup, state2, false);
+    fullProbe<true, false, shape>(lookup, state3, false);
+    fullProbe<true, false, shape>(lookup, state4, false);
   }
   for (; probeIndex < numProbes; ++probeIndex) {
     int32_t row = rows[probeIndex];
     state1.preProbe(*this, lookup.hashes[row], row);
     state1.firstProbe(*this, 0);
-    fullProbe<true>(lookup, state1, false);
+    fullProbe<true, false, shape>(lookup, state1, false);
   }
 }
 
@@ -681,7 +795,7 @@ template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::joinNormalizedKeyProbe(HashLookup& lookup) {
   int32_t probeIndex = 0;
   int32_t numProbes = lookup.rows.size();
-  const vector_size_t* rows = lookup.rows.data();
+  const vector_size_t* rows = joinProbeRows(lookup);
   ProbeState states[kPrefetchSize];
   const uint64_t* keys = lookup.normalizedKeys.data();
   const uint64_t* hashes = lookup.hashes.data();
@@ -708,6 +822,41 @@ void HashTable<ignoreNullKeys>::joinNormalizedKeyProbe(HashLookup& lookup) {
   }
 }
 
+template <bool ignoreNullKeys>
+const vector_size_t* HashTable<ignoreNullKeys>::joinProbeRows(
+    HashLookup& lookup) {
+  const auto numProbes = lookup.rows.size();
+  if (lookup.probePartitionBytes == 0 || numProbes < 2 * kPrefetchSize) {
+    return lookup.rows.data();
+  }
+  const int32_t partitionBytesBits =
+      __builtin_ctzll(bits::nextPowerOfTwo(lookup.probePartitionBytes));
+  if (sizeBits_ <= partitionBytesBits) {
+    return lookup.rows.data();
+  }
+  // The bucket offset is the low 'sizeBits_' bits of the hash, so that its
+  // high bits select a contiguous range of the table.
+  const uint8_t numBits = std::min<int32_t>(
+      kMaxProbePartitionBits, sizeBits_ - partitionBytesBits);
+  const HashBitRange bitRange(sizeBits_ - numBits, sizeBits_);
+  const uint64_t* hashes = lookup.hashes.data();
+
+  // Counting sort of the rows by partition.
+  std::array<int32_t, (1 << kMaxProbePartitionBits) + 1> offsets{};
+  for (auto i = 0; i < numProbes; ++i) {
+    ++offsets[bitRange.partition(hashes[lookup.rows[i]]) + 1];
+  }
+  for (auto i = 1; i <= bitRange.numPartitions(); ++i) {
+    offsets[i] += offsets[i - 1];
+  }
+  lookup.partitionedRows.resize(numProbes);
+  for (auto i = 0; i < numProbes; ++i) {
+    const auto row = lookup.rows[i];
+    lookup.partitionedRows[offsets[bitRange.partition(hashes[row])]++] = row;
+  }
+  return lookup.partitionedRows.data();
+}
+
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::allocateTables(
     uint64_t size,
@@ -2160,14 +2309,13 @@ void HashTable<ignoreNullKeys>::prepareForGroupProbe(
 
   bool rehash = false;
   const auto mode = hashMode();
-  for (auto i = 0; i < hashers.size(); ++i) {
-    auto& hasher = hashers[i];
-    if (mode != BaseHashTable::HashMode::kHash) {
+  if (mode == BaseHashTable::HashMode::kHash) {
+    VectorHasher::hashAll(hashers, rows, lookup.hashes);
+  } else {
+    for (auto& hasher : hashers) {
       if (!hasher->computeValueIds(rows, lookup.hashes)) {
         rehash = true;
       }
-    } else {
-      hasher->hash(rows, i > 0, lookup.hashes);
     }
   }
 
@@ -2189,7 +2337,8 @@ void HashTable<ignoreNullKeys>::prepareForJoinProbe(
     HashLookup& lookup,
     const RowVectorPtr& input,
     SelectivityVector& rows,
-    bool decodeAndRemoveNulls) {
+    bool decodeAndRemoveNulls,
+    const uint64_t* keyHashes) {
   auto& hashers = lookup.hashers;
 
   if (decodeAndRemoveNulls) {
@@ -2205,14 +2354,19 @@ void HashTable<ignoreNullKeys>::prepareForJoinProbe(
   lookup.reset(rows.end());
 
   const auto mode = hashMode();
-  for (auto i = 0; i < hashers.size(); ++i) {
-    auto& hasher = hashers[i];
-    if (mode != BaseHashTable::HashMode::kHash) {
-      auto& key = input->childAt(hasher->channel());
+  if (mode == BaseHashTable::HashMode::kHash && keyHashes != nullptr) {
+    rows.applyToSelected(
+        [&](auto row) { lookup.hashes[row] = keyHashes[row]; });
+    populateLookupRows(rows, lookup.rows);
+    return;
+  }
+  if (mode == BaseHashTable::HashMode::kHash) {
+    VectorHasher::hashAll(hashers, rows, lookup.hashes);
+  } else {
+    for (auto i = 0; i < hashers.size(); ++i) {
+      auto& key = input->childAt(hashers[i]->channel());
       hashers_[i]->lookupValueIds(
           *key, rows, lookup.scratchMemory, lookup.hashes);
-    } else {
-      hasher->hash(rows, i > 0, lookup.hashes);
     }
   }
 
@@ -63,7 +63,8 @@ struct HashLookup {
         rows(raw_vector<vector_size_t>(pool)),
         hashes(raw_vector<uint64_t>(pool)),
         hits(raw_vector<char*>(pool)),
-        normalizedKeys(raw_vector<uint64_t>(pool)) {}
+        normalizedKeys(raw_vector<uint64_t>(pool)),
+        partitionedRows(raw_vector<vector_size_t>(pool)) {}
 
   void reset(vector_size_t size) {
     rows.resize(size);
@@ -87,6 +88,12 @@ struct HashLookup {
   /// the row number.
   raw_vector<uint64_t> hashes;
 
+  /// If not zero, joinProbe on a hash table larger than this many bytes
+  /// probes 'rows' grouped by the partition of the table they fall in, the
+  /// partitions being about this many bytes each. Does not change the order
+  /// of 'rows'.
+  uint64_t probePartitionBytes{0};
+
   /// Results of groupProbe and joinProbe APIs.
 
   /// Contains one entry for each row in 'rows'. Index is the row number.
@@ -102,6 +109,10 @@ struct HashLookup {
   /// If using valueIds, list of concatenated valueIds. 1:1 with 'hashes'.
   /// Populated by groupProbe and joinProbe.
   raw_vector<uint64_t> normalizedKeys;
+
+  /// Scratch memory for 'rows' reordered by partition when
+  /// 'probePartitionBytes' is set.
+  raw_vector<vector_size_t> partitionedRows;
 };
 
 struct HashTableStats {
@@ -136,6 +147,16 @@ class BaseHashTable {
   /// Specifies the hash mode of a table.
   enum class HashMode { kHash, kArray, kNormalizedKey };
 
+  /// Key layouts for which kHash mode probes use key comparisons specialized
+  /// at compile time. Any other combination of keys is kGeneric.
+  enum class KeyShape {
+    kGeneric,
+    kBigint,
+    kTwoBigints,
+    kVarchar,
+    kBigintVarchar
+  };
+
   static constexpr int8_t kNoSpillInputStartPartitionBit = -1;
 
   /// The name of the runtime stats collected and reported by operators that use
@@ -255,11 +276,16 @@ class BaseHashTable {
   /// to remove entries with null grouping keys. Otherwise, assumes the caller
   /// has done that already. After this call, 'rows' may have no entries
   /// selected.
+  ///
+  /// If 'keyHashes' is not null and the hash mode is kHash, uses it as the
+  /// hashes of the rows instead of hashing the keys again. It must be computed
+  /// by VectorHasher::hash() over the keys of 'lookup.hashers' in order.
   virtual void prepareForJoinProbe(
       HashLookup& lookup,
       const RowVectorPtr& input,
       SelectivityVector& rows,
-      bool decodeAndRemoveNulls) = 0;
+      bool decodeAndRemoveNulls,
+      const uint64_t* keyHashes = nullptr) = 0;
 
   /// Fills 'hits' with consecutive hash join results. The corresponding element
   /// of 'inputRows' is set to the corresponding row number in probe keys.
@@ -591,6 +617,11 @@ class HashTable : public BaseHashTable {
     return hashMode_;
   }
 
+  /// Returns the key layout used to pick the key comparison in kHash mode.
+  KeyShape keyShape() const {
+    return keyShape_;
+  }
+
   void decideHashMode(
       int32_t numNew,
       int8_t spillInputStartPartitionBit,
@@ -617,7 +648,8 @@ class HashTable : public BaseHashTable {
       HashLookup& lookup,
       const RowVectorPtr& input,
       SelectivityVector& rows,
-      bool decodeAndRemoveNulls) override;
+      bool decodeAndRemoveNulls,
+      const uint64_t* keyHashes = nullptr) override;
 
   void prepareForGroupProbe(
       HashLookup& lookup,
@@ -688,6 +720,12 @@ class HashTable : public BaseHashTable {
     return table_;
   }
 
+  /// Makes kHash mode probes use the generic key comparison regardless of the
+  /// key types.
+  void testingDisableKeyShape() {
+    keyShape_ = KeyShape::kGeneric;
+  }
+
  private:
   // Enables debug stats for collisions for debug build.
 #ifdef NDEBUG
@@ -903,13 +941,33 @@ class HashTable : public BaseHashTable {
 
   char* insertEntry(HashLookup& lookup, uint64_t index, vector_size_t row);
 
+  // Returns the KeyShape for 'hashers'.
+  static KeyShape keyShapeOf(
+      const std::vector<std::unique_ptr<VectorHasher>>& hashers);
+
+  // Compares the keys of 'group' with the keys at 'row' in 'lookup'. 'shape'
+  // gives the key types for all but kGeneric, so that the per-column type
+  // dispatch and the loop over the keys are resolved at compile time.
+  template <KeyShape shape = KeyShape::kGeneric>
   bool compareKeys(const char* group, HashLookup& lookup, vector_size_t row);
 
   bool compareKeys(const char* group, const char* inserted);
 
-  template <bool isJoin, bool isNormalizedKey = false>
+  template <
+      bool isJoin,
+      bool isNormalizedKey = false,
+      KeyShape shape = KeyShape::kGeneric>
   void fullProbe(HashLookup& lookup, ProbeState& state, bool extraCheck);
 
+  // kHash mode group probe with key comparisons specialized for 'shape'.
+  template <KeyShape shape>
+  void groupHashProbe(HashLookup& lookup);
+
+  // kHash mode join probe of 'rows' with key comparisons specialized for
+  // 'shape'.
+  template <KeyShape shape>
+  void joinHashProbe(HashLookup& lookup, const vector_size_t* rows);
+
   // Shortcut path for group by with normalized keys.
   void groupNormalizedKeyProbe(HashLookup& lookup);
 
@@ -919,6 +977,13 @@ class HashTable : public BaseHashTable {
   // Shortcut for probe with normalized keys.
   void joinNormalizedKeyProbe(HashLookup& lookup);
 
+  // Returns the rows of 'lookup' in the order in which to probe them. If the
+  // table is larger than 'lookup.probePartitionBytes', these are 'lookup.rows'
+  // radix partitioned by the high bits of their bucket offset, so that
+  // consecutive probes hit the same range of 'table_'. Otherwise returns
+  // 'lookup.rows'.
+  const vector_size_t* joinProbeRows(HashLookup& lookup);
+
   // Returns the total size of the variable size 'columns' in 'row'.
   // NOTE: No checks are done in the method for performance considerations.
   // Caller needs to make sure only variable size columns are inside of
@@ -1065,6 +1130,8 @@ class HashTable : public BaseHashTable {
   // Counts the number of rehash() calls.
   int64_t numRehashes_{0};
   HashMode hashMode_ = HashMode::kArray;
+  // Layout of the keys, decided at construction from the key types.
+  KeyShape keyShape_{KeyShape::kGeneric};
   // Owns the memory of multiple build side hash join tables that are
   // combined into a single probe hash table.
   std::vector<std::unique_ptr<HashTable<ignoreNullKeys>>> otherTables_;
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/HashTableCache.h"
+#include "velox/exec/Driver.h"
+#include "velox/exec/Task.h"
+
+namespace facebook::velox::exec {
+
+// static
+HashTableCache& HashTableCache::instance() {
+  static HashTableCache cache;
+  return cache;
+}
+
+// static
+std::string HashTableCache::cacheKey(
+    const core::HashJoinNode& joinNode,
+    const DriverCtx& driverCtx) {
+  const auto key = driverCtx.queryConfig().hashTableCacheKey();
+  if (key.empty()) {
+    return "";
+  }
+  // In grouped execution the table is built and probed per split group.
+  if (driverCtx.splitGroupId != kUngroupedGroupId ||
+      driverCtx.task->hasMixedExecutionGroupJoin(&joinNode)) {
+    return "";
+  }
+  // Probes of right, full and right semi joins set the probed flags in the
+  // table and null-aware anti joins may finish without a table.
+  if (joinNode.isNullAware() ||
+      !(joinNode.isInnerJoin() || joinNode.isLeftJoin() ||
+        joinNode.isLeftSemiFilterJoin() || joinNode.isLeftSemiProjectJoin() ||
+        joinNode.isAntiJoin())) {
+    return "";
+  }
+  // The table layout depends on the join type, the keys and whether the join
+  // has a filter in addition to the build side input.
+  std::stringstream out;
+  out << key << "\n"
+      << core::JoinTypeName::toName(joinNode.joinType()) << " "
+      << (joinNode.filter() != nullptr) << " [";
+  for (const auto& rightKey : joinNode.rightKeys()) {
+    out << rightKey->name() << " ";
+  }
+  out << "]\n" << joinNode.sources()[1]->toString(true, true);
+  return out.str();
+}
+
+HashTableCache::Lookup HashTableCache::lookup(const std::string& key) {
+  uint64_t poolId;
+  {
+    auto state = state_.wlock();
+    auto it = state->tables.find(key);
+    if (it != state->tables.end()) {
+      it->second.lastUse = ++state->useCounter;
+      return {it->second.entry, nullptr};
+    }
+    poolId = state->poolCounter++;
+  }
+  return {
+      nullptr,
+      rootPool()->addLeafChild(fmt::format("hashTableCache.{}", poolId))};
+}
+
+std::shared_ptr<const HashTableCache::Entry> HashTableCache::put(
+    const std::string& key,
+    std::shared_ptr<memory::MemoryPool> pool,
+    std::shared_ptr<BaseHashTable> table,
+    bool hasNullKeys) {
+  VELOX_CHECK_NOT_NULL(pool);
+  VELOX_CHECK_NOT_NULL(table);
+  auto entry = std::make_shared<Entry>();
+  entry->pool = std::move(pool);
+  entry->table = std::move(table);
+  entry->hasNullKeys = hasNullKeys;
+
+  auto state = state_.wlock();
+  if (state->tables.count(key) == 0) {
+    state->tables[key] = {entry, ++state->useCounter};
+    evictLocked(*state);
+  }
+  return entry;
+}
+
+void HashTableCache::drop(const std::string& key) {
+  state_.wlock()->tables.erase(key);
+}
+
+void HashTableCache::clear() {
+  state_.wlock()->tables.clear();
+}
+
+void HashTableCache::setMaxBytes(uint64_t maxBytes) {
+  auto state = state_.wlock();
+  state->maxBytes = maxBytes;
+  evictLocked(*state);
+}
+
+size_t HashTableCache::size() const {
+  return state_.rlock()->tables.size();
+}
+
+uint64_t HashTableCache::usedBytes() const {
+  return usedBytesLocked(*state_.rlock());
+}
+
+// static
+uint64_t HashTableCache::usedBytesLocked(const State& state) {
+  uint64_t usedBytes{0};
+  for (const auto& [_, table] : state.tables) {
+    usedBytes += table.entry->pool->usedBytes();
+  }
+  return usedBytes;
+}
+
+// static
+void HashTableCache::evictLocked(State& state) {
+  auto usedBytes = usedBytesLocked(state);
+  while (usedBytes > state.maxBytes) {
+    // Tables referenced by a running task are not evicted since this would
+    // not free their memory. Users of a table hold its entry through
+    // sharedTable().
+    auto victim = state.tables.end();
+    for (auto it = state.tables.begin(); it != state.tables.end(); ++it) {
+      if (it->second.entry.use_count() > 1) {
+        continue;
+      }
+      if (victim == state.tables.end() ||
+          it->second.lastUse < victim->second.lastUse) {
+        victim = it;
+      }
+    }
+    if (victim == state.tables.end()) {
+      return;
+    }
+    usedBytes -= victim->second.entry->pool->usedBytes();
+    state.tables.erase(victim);
+  }
+}
+
+std::shared_ptr<memory::MemoryPool> HashTableCache::rootPool() {
+  auto pool = rootPool_.wlock();
+  if (*pool == nullptr) {
+    *pool = memory::memoryManager()->addRootPool("hashTableCache");
+  }
+  return *pool;
+}
+
+} // namespace facebook::velox::exec
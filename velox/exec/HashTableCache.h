@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <folly/Synchronized.h>
+
+#include "velox/core/PlanNode.h"
+#include "velox/core/QueryConfig.h"
+#include "velox/exec/HashTable.h"
+
+namespace facebook::velox::exec {
+
+struct DriverCtx;
+
+/// Process wide cache of hash join build side tables. Tasks that join
+/// against the same build input, as identified by the 'hash_table_cache_key'
+/// query config and the build side plan fragment, reuse a read-only table
+/// built by an earlier task instead of building their own. The tables are
+/// allocated from memory pools owned by the cache, so that they outlive the
+/// task that built them, and are shared by reference counting.
+class HashTableCache {
+ public:
+  /// Default limit on the memory used by the cached tables.
+  static constexpr uint64_t kDefaultMaxBytes = 1UL << 30;
+
+  struct Entry {
+    // Declared before 'table' so that the table is freed before the pool
+    // it is allocated from.
+    std::shared_ptr<memory::MemoryPool> pool;
+    std::shared_ptr<BaseHashTable> table;
+    bool hasNullKeys{false};
+  };
+
+  /// Returns a reference to the table of 'entry' which keeps 'entry' and so
+  /// the memory pool of the table alive.
+  static std::shared_ptr<BaseHashTable> sharedTable(
+      const std::shared_ptr<const Entry>& entry) {
+    return std::shared_ptr<BaseHashTable>(entry, entry->table.get());
+  }
+
+  /// The result of looking up a key. Either 'entry' is set to the cached
+  /// table or 'pool' is set to a new memory pool in which the caller builds
+  /// the table to add with put().
+  struct Lookup {
+    std::shared_ptr<const Entry> entry;
+    std::shared_ptr<memory::MemoryPool> pool;
+  };
+
+  static HashTableCache& instance();
+
+  /// Returns the cache key for the table of 'joinNode' or an empty string if
+  /// the table cannot be cached in the driver of 'driverCtx'. The build and
+  /// probe operators of a cached table do not spill or free the table.
+  static std::string cacheKey(
+      const core::HashJoinNode& joinNode,
+      const DriverCtx& driverCtx);
+
+  Lookup lookup(const std::string& key);
+
+  /// Adds 'table' built in 'pool' under 'key' and returns its entry. Keeps
+  /// the existing entry if another task has added one for 'key' first; the
+  /// returned entry is then not cached. Evicts the least recently used tables
+  /// that are not in use by any task if the cache exceeds its memory limit.
+  std::shared_ptr<const Entry> put(
+      const std::string& key,
+      std::shared_ptr<memory::MemoryPool> pool,
+      std::shared_ptr<BaseHashTable> table,
+      bool hasNullKeys);
+
+  /// Removes the table for 'key'. Tasks using the table keep their
+  /// reference.
+  void drop(const std::string& key);
+
+  void clear();
+
+  void setMaxBytes(uint64_t maxBytes);
+
+  size_t size() const;
+
+  /// Returns the memory used by the cached tables.
+  uint64_t usedBytes() const;
+
+ private:
+  struct CachedTable {
+    std::shared_ptr<const Entry> entry;
+    uint64_t lastUse;
+  };
+
+  struct State {
+    std::unordered_map<std::string, CachedTable> tables;
+    uint64_t maxBytes{kDefaultMaxBytes};
+    uint64_t useCounter{0};
+    uint64_t poolCounter{0};
+  };
+
+  static uint64_t usedBytesLocked(const State& state);
+
+  static void evictLocked(State& state);
+
+  std::shared_ptr<memory::MemoryPool> rootPool();
+
+  folly::Synchronized<State> state_;
+
+  folly::Synchronized<std::shared_ptr<memory::MemoryPool>> rootPool_;
+};
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/IndexLookupDedup.h"
+
+#include "velox/row/CompactRow.h"
+
+namespace facebook::velox::exec {
+
+RowVectorPtr IndexLookupResultCache::get(const std::string& key) {
+  auto* rows = cache_.get(key);
+  if (rows == nullptr) {
+    ++numMisses_;
+    return nullptr;
+  }
+  ++numHits_;
+  auto result = *rows;
+  cache_.release(key);
+  return result;
+}
+
+void IndexLookupResultCache::put(const std::string& key, RowVectorPtr rows) {
+  const auto size = key.size() + rows->estimateFlatSize();
+  auto* value = new RowVectorPtr(std::move(rows));
+  if (!cache_.add(key, value, size)) {
+    delete value;
+  }
+}
+
+DedupLookupResultIterator::DedupLookupResultIterator(
+    connector::IndexSource* indexSource,
+    const connector::IndexSource::LookupRequest& request,
+    const RowTypePtr& outputType,
+    IndexLookupResultCache* cache,
+    IndexLookupDedupStats& stats,
+    memory::MemoryPool* pool)
+    : outputType_(outputType), cache_(cache), pool_(pool) {
+  const auto& input = request.input;
+  computeDistinctRows(input);
+  distinctResults_.resize(distinctKeys_.size());
+
+  // Distinct rows are numbered in the order of their first input row.
+  std::vector<vector_size_t> requestRows;
+  vector_size_t numDistinctRows{0};
+  for (vector_size_t row = 0; row < input->size(); ++row) {
+    const auto distinctRow = rowToDistinct_[row];
+    if (distinctRow < numDistinctRows) {
+      continue;
+    }
+    ++numDistinctRows;
+    if (cache_ != nullptr) {
+      auto rows = cache_->get(distinctKeys_[distinctRow]);
+      if (rows != nullptr) {
+        distinctResults_[distinctRow] =
+            DistinctRowResult{rows, 0, rows->size()};
+        continue;
+      }
+    }
+    requestRows.push_back(row);
+    requestDistinctRows_.push_back(distinctRow);
+  }
+  VELOX_CHECK_EQ(numDistinctRows, distinctKeys_.size());
+
+  stats.numInputRows += input->size();
+  stats.numDistinctRows += distinctKeys_.size();
+  stats.numRequestRows += requestRows.size();
+
+  if (requestRows.empty()) {
+    sourceDone_ = true;
+    return;
+  }
+
+  RowVectorPtr requestInput;
+  if (requestRows.size() == input->size()) {
+    requestInput = input;
+  } else {
+    const vector_size_t numRequestRows = requestRows.size();
+    auto indices = allocateIndices(numRequestRows, pool_);
+    std::memcpy(
+        indices->asMutable<vector_size_t>(),
+        requestRows.data(),
+        numRequestRows * sizeof(vector_size_t));
+    std::vector<VectorPtr> children;
+    children.reserve(input->childrenSize());
+    for (const auto& child : input->children()) {
+      children.push_back(BaseVector::wrapInDictionary(
+          nullptr, indices, numRequestRows, child));
+    }
+    requestInput = std::make_shared<RowVector>(
+        pool_, input->type(), nullptr, numRequestRows, std::move(children));
+  }
+  sourceIter_ = indexSource->lookup(
+      connector::IndexSource::LookupRequest{std::move(requestInput)});
+}
+
+void DedupLookupResultIterator::computeDistinctRows(const RowVectorPtr& input) {
+  const row::CompactRow compactRow(input);
+  const auto fixedRowSize =
+      row::CompactRow::fixedRowSize(asRowType(input->type()));
+  folly::F14FastMap<std::string, vector_size_t> distinctRows;
+  rowToDistinct_.resize(input->size());
+  std::string key;
+  for (vector_size_t row = 0; row < input->size(); ++row) {
+    const auto rowSize = fixedRowSize.has_value() ? fixedRowSize.value()
+                                                  : compactRow.rowSize(row);
+    key.assign(rowSize, '\0');
+    compactRow.serialize(row, key.data());
+    const auto [it, inserted] =
+        distinctRows.emplace(key, static_cast<vector_size_t>(
+                                      distinctKeys_.size()));
+    if (inserted) {
+      distinctKeys_.push_back(key);
+    }
+    rowToDistinct_[row] = it->second;
+  }
+}
+
+std::optional<std::unique_ptr<connector::IndexSource::LookupResult>>
+DedupLookupResultIterator::next(
+    vector_size_t size,
+    velox::ContinueFuture& future) {
+  while (!sourceDone_) {
+    auto result = sourceIter_->next(size, future);
+    if (!result.has_value()) {
+      return std::nullopt;
+    }
+    if (result.value() == nullptr) {
+      sourceDone_ = true;
+      break;
+    }
+    sourceResults_.push_back(std::move(result).value());
+  }
+
+  if (output_ == nullptr) {
+    expandResults();
+  }
+  if (nextOutputRow_ == output_->size()) {
+    return nullptr;
+  }
+
+  const auto numRows =
+      std::min<vector_size_t>(size, output_->size() - nextOutputRow_);
+  std::unique_ptr<connector::IndexSource::LookupResult> result;
+  if (numRows == output_->size()) {
+    result = std::make_unique<connector::IndexSource::LookupResult>(
+        inputHits_, output_);
+  } else {
+    result = std::make_unique<connector::IndexSource::LookupResult>(
+        Buffer::slice<vector_size_t>(
+            inputHits_, nextOutputRow_, numRows, pool_),
+        std::static_pointer_cast<RowVector>(
+            output_->slice(nextOutputRow_, numRows)));
+  }
+  nextOutputRow_ += numRows;
+  return result;
+}
+
+void DedupLookupResultIterator::expandResults() {
+  VELOX_CHECK(sourceDone_);
+
+  // Gathers the index source results into one vector so that the output rows
+  // of each looked up row are contiguous.
+  RowVectorPtr sourceOutput;
+  BufferPtr sourceHits;
+  if (sourceResults_.size() == 1) {
+    sourceOutput = sourceResults_[0]->output;
+    sourceHits = sourceResults_[0]->inputHits;
+  } else if (sourceResults_.size() > 1) {
+    vector_size_t numSourceRows{0};
+    for (const auto& result : sourceResults_) {
+      numSourceRows += result->size();
+    }
+    sourceOutput =
+        BaseVector::create<RowVector>(outputType_, numSourceRows, pool_);
+    sourceHits = allocateIndices(numSourceRows, pool_);
+    auto* rawSourceHits = sourceHits->asMutable<vector_size_t>();
+    vector_size_t offset{0};
+    for (const auto& result : sourceResults_) {
+      sourceOutput->copy(result->output.get(), offset, 0, result->size());
+      std::memcpy(
+          rawSourceHits + offset,
+          result->inputHits->as<vector_size_t>(),
+          result->size() * sizeof(vector_size_t));
+      offset += result->size();
+    }
+  }
+  sourceResults_.clear();
+
+  if (sourceOutput != nullptr) {
+    const auto* rawSourceHits = sourceHits->as<vector_size_t>();
+    const auto numSourceRows = sourceOutput->size();
+    for (vector_size_t i = 0; i < numSourceRows;) {
+      const auto requestRow = rawSourceHits[i];
+      auto j = i + 1;
+      while (j < numSourceRows && rawSourceHits[j] == requestRow) {
+        ++j;
+      }
+      distinctResults_[requestDistinctRows_[requestRow]] =
+          DistinctRowResult{sourceOutput, i, j - i};
+      i = j;
+    }
+  }
+  for (const auto distinctRow : requestDistinctRows_) {
+    auto& result = distinctResults_[distinctRow];
+    if (!result.has_value()) {
+      // The looked up row has no match.
+      result = DistinctRowResult{};
+    }
+    if (cache_ != nullptr) {
+      auto rows =
+          BaseVector::create<RowVector>(outputType_, result->size, pool_);
+      if (result->size > 0) {
+        rows->copy(result->rows.get(), 0, result->offset, result->size);
+      }
+      cache_->put(distinctKeys_[distinctRow], std::move(rows));
+    }
+  }
+
+  // Output rows reference the distinct row results through dictionaries. If
+  // some results come from the cache, gather all results into one vector.
+  bool singleSource{true};
+  uint64_t numDistinctOutputRows{0};
+  for (const auto& result : distinctResults_) {
+    if (result->size > 0 && result->rows != sourceOutput) {
+      singleSource = false;
+    }
+    numDistinctOutputRows += result->size;
+  }
+  RowVectorPtr base = sourceOutput;
+  if (!singleSource) {
+    base = BaseVector::create<RowVector>(
+        outputType_, numDistinctOutputRows, pool_);
+    vector_size_t offset{0};
+    for (auto& result : distinctResults_) {
+      if (result->size > 0) {
+        base->copy(result->rows.get(), offset, result->offset, result->size);
+        result = DistinctRowResult{base, offset, result->size};
+        offset += result->size;
+      }
+    }
+  }
+
+  uint64_t numOutputRows{0};
+  for (const auto distinctRow : rowToDistinct_) {
+    numOutputRows += distinctResults_[distinctRow]->size;
+  }
+  VELOX_CHECK_LE(numOutputRows, std::numeric_limits<vector_size_t>::max());
+  inputHits_ = allocateIndices(numOutputRows, pool_);
+  if (numOutputRows == 0) {
+    output_ = BaseVector::create<RowVector>(outputType_, 0, pool_);
+    return;
+  }
+  auto indices = allocateIndices(numOutputRows, pool_);
+  auto* rawInputHits = inputHits_->asMutable<vector_size_t>();
+  auto* rawIndices = indices->asMutable<vector_size_t>();
+  vector_size_t outputRow{0};
+  for (vector_size_t row = 0; row < rowToDistinct_.size(); ++row) {
+    const auto& result = distinctResults_[rowToDistinct_[row]].value();
+    for (auto i = 0; i < result.size; ++i) {
+      rawInputHits[outputRow] = row;
+      rawIndices[outputRow] = result.offset + i;
+      ++outputRow;
+    }
+  }
+  std::vector<VectorPtr> children;
+  children.reserve(base->childrenSize());
+  for (const auto& child : base->children()) {
+    children.push_back(
+        BaseVector::wrapInDictionary(nullptr, indices, numOutputRows, child));
+  }
+  output_ = std::make_shared<RowVector>(
+      pool_, outputType_, nullptr, numOutputRows, std::move(children));
+}
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/common/caching/SimpleLRUCache.h"
+#include "velox/connectors/Connector.h"
+
+namespace facebook::velox::exec {
+
+/// LRU cache of index lookup results keyed by the serialized lookup input row.
+/// A value holds all the lookup output rows of the key, and no rows if the key
+/// has no match. The cached bytes are bounded by the capacity passed to the
+/// constructor. Not thread-safe; each IndexLookupJoin operator owns one.
+class IndexLookupResultCache {
+ public:
+  explicit IndexLookupResultCache(uint64_t maxBytes) : cache_(maxBytes) {}
+
+  /// Returns the cached lookup output rows of 'key' or nullptr on cache miss.
+  RowVectorPtr get(const std::string& key);
+
+  /// Caches the lookup output rows of 'key'. The value is dropped if it does
+  /// not fit in the cache.
+  void put(const std::string& key, RowVectorPtr rows);
+
+  uint64_t numHits() const {
+    return numHits_;
+  }
+
+  uint64_t numMisses() const {
+    return numMisses_;
+  }
+
+  uint64_t currentBytes() const {
+    return cache_.currentSize();
+  }
+
+ private:
+  SimpleLRUCache<std::string, RowVectorPtr> cache_;
+  uint64_t numHits_{0};
+  uint64_t numMisses_{0};
+};
+
+/// Counters of the lookup input rows that are deduplicated before sending
+/// lookup requests to the index source.
+struct IndexLookupDedupStats {
+  /// Number of lookup input rows.
+  uint64_t numInputRows{0};
+  /// Number of distinct lookup input rows.
+  uint64_t numDistinctRows{0};
+  /// Number of lookup input rows sent to the index source.
+  uint64_t numRequestRows{0};
+};
+
+/// Lookup result iterator that deduplicates the lookup input rows of a
+/// request. Only the distinct rows not found in 'cache' are looked up from
+/// the index source. Once the index source results are all fetched, the
+/// results of the distinct rows are expanded back to the rows of the request,
+/// and the results of the looked up rows are added to 'cache'. The produced
+/// results follow the order of the request input rows like the index source
+/// results do.
+class DedupLookupResultIterator
+    : public connector::IndexSource::LookupResultIterator {
+ public:
+  /// 'cache' may be nullptr to only deduplicate the rows within the request.
+  DedupLookupResultIterator(
+      connector::IndexSource* indexSource,
+      const connector::IndexSource::LookupRequest& request,
+      const RowTypePtr& outputType,
+      IndexLookupResultCache* cache,
+      IndexLookupDedupStats& stats,
+      memory::MemoryPool* pool);
+
+  std::optional<std::unique_ptr<connector::IndexSource::LookupResult>> next(
+      vector_size_t size,
+      velox::ContinueFuture& future) override;
+
+ private:
+  // Lookup output rows of a distinct lookup input row.
+  struct DistinctRowResult {
+    RowVectorPtr rows;
+    vector_size_t offset{0};
+    vector_size_t size{0};
+  };
+
+  // Serializes the rows of 'input' into 'rowKeys_' and assigns each row to a
+  // distinct row in 'rowToDistinct_'.
+  void computeDistinctRows(const RowVectorPtr& input);
+
+  // Builds the results of the distinct rows from the cache and the index
+  // source results, and expands them to the request input rows.
+  void expandResults();
+
+  const RowTypePtr outputType_;
+  IndexLookupResultCache* const cache_;
+  memory::MemoryPool* const pool_;
+
+  // The serialized key of each distinct lookup input row.
+  std::vector<std::string> distinctKeys_;
+  // The distinct row index of each lookup input row.
+  std::vector<vector_size_t> rowToDistinct_;
+  // The results of the distinct rows. Set for cache hits when constructed and
+  // for the rest after the index source results are all fetched.
+  std::vector<std::optional<DistinctRowResult>> distinctResults_;
+  // The distinct row indices looked up from the index source, in the order of
+  // the rows in the index source request.
+  std::vector<vector_size_t> requestDistinctRows_;
+
+  std::shared_ptr<connector::IndexSource::LookupResultIterator> sourceIter_;
+  std::vector<std::unique_ptr<connector::IndexSource::LookupResult>>
+      sourceResults_;
+  bool sourceDone_{false};
+
+  // The results expanded to the request input rows and the next row to return.
+  BufferPtr inputHits_;
+  RowVectorPtr output_;
+  vector_size_t nextOutputRow_{0};
+};
+
+} // namespace facebook::velox::exec
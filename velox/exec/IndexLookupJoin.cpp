@@ -165,7 +165,15 @@ IndexLookupJoin::IndexLookupJoin(
       connector_(connector::getConnector(lookupTableHandle_->connectorId())),
       maxNumInputBatches_(
           1 + driverCtx->queryConfig().indexLookupJoinMaxPrefetchBatches()),
+      dedupLookupKeys_(
+          driverCtx->queryConfig().indexLookupJoinDedupKeys() ||
+          driverCtx->queryConfig().indexLookupJoinResultCacheBytes() > 0),
       joinNode_{joinNode} {
+  const auto resultCacheBytes =
+      driverCtx->queryConfig().indexLookupJoinResultCacheBytes();
+  if (resultCacheBytes > 0) {
+    resultCache_ = std::make_unique<IndexLookupResultCache>(resultCacheBytes);
+  }
   duplicateJoinKeyCheck(joinNode_->leftKeys());
   duplicateJoinKeyCheck(joinNode_->rightKeys());
 }
@@ -544,8 +552,18 @@ void IndexLookupJoin::startLookup(InputBatchState& batch) {
     return;
   }
 
-  batch.lookupResultIter = indexSource_->lookup(
-      connector::IndexSource::LookupRequest{batch.lookupInput});
+  const connector::IndexSource::LookupRequest request{batch.lookupInput};
+  if (dedupLookupKeys_) {
+    batch.lookupResultIter = std::make_shared<DedupLookupResultIterator>(
+        indexSource_.get(),
+        request,
+        lookupOutputType_,
+        resultCache_.get(),
+        dedupStats_,
+        pool());
+  } else {
+    batch.lookupResultIter = indexSource_->lookup(request);
+  }
   auto lookupResultOr =
       batch.lookupResultIter->next(outputBatchSize_, batch.lookupFuture);
   if (!lookupResultOr.has_value()) {
@@ -940,6 +958,8 @@ void IndexLookupJoin::prepareOutputRowMappings(size_t outputBatchSize) {
 
 void IndexLookupJoin::close() {
   recordConnectorStats();
+  recordDedupStats();
+  resultCache_.reset();
   // TODO: add close method for index source if needed to free up resource
   // or shutdown index source gracefully.
   indexSource_.reset();
@@ -976,4 +996,23 @@ void IndexLookupJoin::recordConnectorStats() {
     lockedStats->backgroundTiming.add(backgroundTiming);
   }
 }
+
+void IndexLookupJoin::recordDedupStats() {
+  if (dedupStats_.numInputRows == 0) {
+    return;
+  }
+  auto lockedStats = stats_.wlock();
+  lockedStats->addRuntimeStat(
+      kDedupLookupInputRows, RuntimeCounter(dedupStats_.numInputRows));
+  lockedStats->addRuntimeStat(
+      kDedupDistinctLookupRows, RuntimeCounter(dedupStats_.numDistinctRows));
+  lockedStats->addRuntimeStat(
+      kDedupLookupRequestRows, RuntimeCounter(dedupStats_.numRequestRows));
+  if (resultCache_ != nullptr) {
+    lockedStats->addRuntimeStat(
+        kResultCacheHits, RuntimeCounter(resultCache_->numHits()));
+    lockedStats->addRuntimeStat(
+        kResultCacheMisses, RuntimeCounter(resultCache_->numMisses()));
+  }
+}
 } // namespace facebook::velox::exec
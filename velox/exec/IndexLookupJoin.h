@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #pragma once
+#include "velox/exec/IndexLookupDedup.h"
 #include "velox/exec/Operator.h"
 #include "velox/exec/VectorHasher.h"
 
@@ -81,6 +82,18 @@ class IndexLookupJoin : public Operator {
   /// The number of lazy decoded result batches.
   static inline const std::string kClientNumLazyDecodedResultBatches{
       "clientNumLazyDecodedResultBatches"};
+  /// The number of lookup input rows, distinct lookup input rows and lookup
+  /// input rows sent to the index source with lookup key deduplication.
+  static inline const std::string kDedupLookupInputRows{
+      "dedupLookupInputRows"};
+  static inline const std::string kDedupDistinctLookupRows{
+      "dedupDistinctLookupRows"};
+  static inline const std::string kDedupLookupRequestRows{
+      "dedupLookupRequestRows"};
+  /// The number of distinct lookup input rows found and not found in the
+  /// lookup result cache.
+  static inline const std::string kResultCacheHits{"resultCacheHits"};
+  static inline const std::string kResultCacheMisses{"resultCacheMisses"};
 
  private:
   using LookupResultIter = connector::IndexSource::LookupResultIterator;
@@ -190,6 +203,10 @@ class IndexLookupJoin : public Operator {
   // Invoked at operator close to record the lookup stats.
   void recordConnectorStats();
 
+  // Invoked at operator close to record the lookup key deduplication and
+  // result cache stats.
+  void recordDedupStats();
+
   // Returns true if we support to fetch more than one input batch for index
   // lookup prefetch.
   bool lookupPrefetchEnabled() const {
@@ -232,6 +249,8 @@ class IndexLookupJoin : public Operator {
   const std::shared_ptr<connector::ConnectorQueryCtx> connectorQueryCtx_;
   const std::shared_ptr<connector::Connector> connector_;
   const size_t maxNumInputBatches_;
+  // If true, only distinct lookup input rows are sent to the index source.
+  const bool dedupLookupKeys_;
 
   // The lookup join plan node used to initialize this operator and reset after
   // that.
@@ -266,6 +285,11 @@ class IndexLookupJoin : public Operator {
 
   std::shared_ptr<connector::IndexSource> indexSource_;
 
+  // Caches lookup results across input batches if
+  // 'index_lookup_join_result_cache_bytes' is set.
+  std::unique_ptr<IndexLookupResultCache> resultCache_;
+  IndexLookupDedupStats dedupStats_;
+
   // Points to the next output row in 'lookupResult_' for processing until
   // reaches to the end of 'lookupResult_'.
   vector_size_t nextOutputResultRow_{0};
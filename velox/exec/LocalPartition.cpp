@@ -15,6 +15,7 @@
  */
 
 #include "velox/exec/LocalPartition.h"
+#include "velox/exec/ScaledDriverController.h"
 #include "velox/exec/Task.h"
 #include "velox/vector/EncodedVectorCopy.h"
 
@@ -30,27 +31,35 @@ void notify(std::vector<ContinuePromise>& promises) {
 bool LocalExchangeMemoryManager::increaseMemoryUsage(
     ContinueFuture* future,
     int64_t added) {
-  std::lock_guard<std::mutex> l(mutex_);
-  bufferedBytes_ += added;
-
-  if (bufferedBytes_ >= maxBufferSize_) {
-    promises_.emplace_back("LocalExchangeMemoryManager::updateMemoryUsage");
-    *future = promises_.back().getSemiFuture();
-    return true;
+  if (bufferedBytes_.fetch_add(added) + added < maxBufferSize_) {
+    return false;
   }
 
-  return false;
+  std::lock_guard<std::mutex> l(mutex_);
+  hasPromises_ = true;
+  if (bufferedBytes_ < maxBufferSize_) {
+    // A consumer has freed memory since the increase.
+    return false;
+  }
+  promises_.emplace_back("LocalExchangeMemoryManager::updateMemoryUsage");
+  *future = promises_.back().getSemiFuture();
+  return true;
 }
 
 std::vector<ContinuePromise> LocalExchangeMemoryManager::decreaseMemoryUsage(
     int64_t removed) {
+  if (bufferedBytes_.fetch_sub(removed) - removed >= maxBufferSize_ ||
+      !hasPromises_) {
+    return {};
+  }
+
   std::vector<ContinuePromise> promises;
   {
     std::lock_guard<std::mutex> l(mutex_);
-    bufferedBytes_ -= removed;
-
     if (bufferedBytes_ < maxBufferSize_) {
       promises = std::move(promises_);
+      promises_.clear();
+      hasPromises_ = false;
     }
   }
   return promises;
@@ -120,22 +129,29 @@ BlockingReason LocalExchangeQueue::enqueue(
     int64_t inputBytes,
     ContinueFuture* future) {
   std::vector<ContinuePromise> consumerPromises;
-  bool blockedOnConsumer = false;
+  // Accounts the memory before the consumer can dequeue and release it.
+  const bool blockedOnConsumer =
+      memoryManager_->increaseMemoryUsage(future, inputBytes);
   const bool isClosed = queue_.withWLock([&](auto& queue) {
     if (closed_) {
       return true;
     }
     queue.emplace(std::move(input), inputBytes);
-    consumerPromises = std::move(consumerPromises_);
-
-    if (memoryManager_->increaseMemoryUsage(future, inputBytes)) {
-      blockedOnConsumer = true;
+    if (!consumerPromises_.empty()) {
+      consumerPromises = std::move(consumerPromises_);
+      consumerPromises_.clear();
     }
-
     return false;
   });
 
   if (isClosed) {
+    notify(memoryManager_->decreaseMemoryUsage(inputBytes));
+    if (blockedOnConsumer) {
+      // The memory manager may still hold the promise if other queues keep
+      // the memory usage over the limit. Nothing is enqueued, hence no need to
+      // wait.
+      *future = ContinueFuture::makeEmpty();
+    }
     return BlockingReason::kNotBlocked;
   }
 
@@ -188,11 +204,12 @@ BlockingReason LocalExchangeQueue::next(
 
     std::tie(*data, size) = std::move(queue.front());
     queue.pop();
-
-    memoryPromises = memoryManager_->decreaseMemoryUsage(size);
     return BlockingReason::kNotBlocked;
   });
 
+  if (*data != nullptr) {
+    memoryPromises = memoryManager_->decreaseMemoryUsage(size);
+  }
   notify(memoryPromises);
   if (*data != nullptr) {
     vectorPool_->push(*data, size);
@@ -268,17 +285,14 @@ LocalExchange::LocalExchange(
       queue_{operatorCtx_->task()->getLocalExchangeQueue(
           ctx->splitGroupId,
           planNodeId,
-          partition)} {}
+          partition)},
+      scaledDriverController_{
+          operatorCtx_->task()->getScaledDriverController(
+              ctx->splitGroupId,
+              planNodeId)} {}
 
 BlockingReason LocalExchange::isBlocked(ContinueFuture* future) {
-  if (blockingReason_ != BlockingReason::kNotBlocked) {
-    *future = std::move(future_);
-    auto reason = blockingReason_;
-    blockingReason_ = BlockingReason::kNotBlocked;
-    return reason;
-  }
-
-  return BlockingReason::kNotBlocked;
+  return awaiter_.isBlocked(future);
 }
 
 RowVectorPtr LocalExchange::getOutput() {
@@ -288,10 +302,15 @@ RowVectorPtr LocalExchange::getOutput() {
 
   RowVectorPtr data;
   bool drained{false};
-  blockingReason_ = queue_->next(&future_, pool(), &data, drained);
-  if (blockingReason_ != BlockingReason::kNotBlocked) {
-    VELOX_CHECK(future_.valid());
+  ContinueFuture future;
+  const auto blockingReason = queue_->next(&future, pool(), &data, drained);
+  if (scaledDriverController_ != nullptr) {
+    scaledDriverController_->recordConsumerFetch(
+        partition_, blockingReason == BlockingReason::kWaitForProducer);
+  }
+  if (blockingReason != BlockingReason::kNotBlocked) {
     VELOX_CHECK(!drained);
+    awaiter_.await(blockingReason, std::move(future));
     return nullptr;
   }
 
@@ -316,6 +335,12 @@ bool LocalExchange::isFinished() {
 }
 
 void LocalExchange::close() {
+  if (scaledDriverController_ != nullptr && partition_ == 0) {
+    const auto scaledStats = scaledDriverController_->stats();
+    auto lockedStats = stats_.wlock();
+    lockedStats->addRuntimeStat(
+        kMaxRunningDrivers, RuntimeCounter(scaledStats.maxRunningDrivers));
+  }
   Operator::close();
   if (queue_) {
     queue_->close();
@@ -341,6 +366,9 @@ LocalPartition::LocalPartition(
                               : planNode->partitionFunctionSpec().create(
                                     numPartitions_,
                                     /*localExchange=*/true)),
+      scaledDriverController_{ctx->task->getScaledDriverController(
+          ctx->splitGroupId,
+          planNode->id())},
       singlePartitionBufferSize_{
           (numPartitions_ <
                ctx->queryConfig()
@@ -434,7 +462,11 @@ void LocalPartition::copy(
   if (!target) {
     target = BaseVector::create<RowVector>(outputType_, 0, pool());
   }
-  target->resize(target->size() + ranges.size());
+  vector_size_t numRows{0};
+  for (const auto& range : ranges) {
+    numRows += range.count;
+  }
+  target->resize(target->size() + numRows);
   target->copyRanges(input.get(), ranges);
 }
 
@@ -458,14 +490,22 @@ RowVectorPtr LocalPartition::processPartition(
     if (partitionBuffer) {
       targetIndex = partitionBuffer->size();
     }
+    // Copies runs of consecutive rows at once.
+    size_t numRanges = 0;
     for (int i = 0; i < size; i++) {
-      copyRanges_[i] = {rawIndices[i], targetIndex, 1};
-      targetIndex++;
+      if (numRanges > 0) {
+        auto& last = copyRanges_[numRanges - 1];
+        if (last.sourceIndex + last.count == rawIndices[i]) {
+          ++last.count;
+          continue;
+        }
+      }
+      copyRanges_[numRanges++] = {rawIndices[i], targetIndex + i, 1};
     }
 
     copy(
         input,
-        folly::Range{copyRanges_.data(), static_cast<size_t>(size)},
+        folly::Range{copyRanges_.data(), numRanges},
         partitionBuffer);
 
     if (partitionBuffer &&
@@ -484,9 +524,14 @@ RowVectorPtr LocalPartition::processPartition(
 void LocalPartition::addInput(RowVectorPtr input) {
   prepareForInput(input);
 
-  const auto singlePartition = numPartitions_ == 1
-      ? 0
-      : partitionFunction_->partition(*input, partitions_);
+  std::optional<uint32_t> singlePartition;
+  if (numPartitions_ == 1) {
+    singlePartition = 0;
+  } else if (scaledDriverController_ != nullptr) {
+    singlePartition = scaledDriverController_->nextDriver();
+  } else {
+    singlePartition = partitionFunction_->partition(*input, partitions_);
+  }
   if (singlePartition.has_value()) {
     ContinueFuture future;
     auto blockingReason = queues_[singlePartition.value()]->enqueue(
@@ -16,12 +16,17 @@
 #pragma once
 
 #include "velox/exec/Operator.h"
+#include "velox/exec/OperatorAwaiter.h"
 #include "velox/exec/VectorHasher.h"
 
 namespace facebook::velox::exec {
 
+class ScaledDriverController;
+
 /// Keeps track of the total size in bytes of the data buffered in all
-/// LocalExchangeQueues.
+/// LocalExchangeQueues. The memory usage is updated without locking unless it
+/// crosses the limit, so that the producers and consumers of different queues
+/// do not contend on the memory manager.
 class LocalExchangeMemoryManager {
  public:
   explicit LocalExchangeMemoryManager(int64_t maxBufferSize)
@@ -48,8 +53,13 @@ class LocalExchangeMemoryManager {
 
  private:
   const int64_t maxBufferSize_;
+  std::atomic<int64_t> bufferedBytes_{0};
+  // True if 'promises_' may be not empty. Set by a producer before it
+  // re-checks the memory usage under 'mutex_' and checked by a consumer after
+  // it decreases the memory usage, so that either the producer sees the
+  // decrease or the consumer sees the promise.
+  std::atomic<bool> hasPromises_{false};
   std::mutex mutex_;
-  tsan_atomic<int64_t> bufferedBytes_{0};
   std::vector<ContinuePromise> promises_;
 };
 
@@ -193,11 +203,17 @@ class LocalExchange : public SourceOperator {
   /// notifies the producer that no more data is needed.
   void close() override;
 
+  /// The name of runtime stats specific to local exchange.
+  /// The maximum number of running consumer drivers of a scaled round robin
+  /// exchange. Reported by the consumer of partition 0.
+  static inline const std::string kMaxRunningDrivers{"maxRunningDrivers"};
+
  private:
   const int partition_;
   const std::shared_ptr<LocalExchangeQueue> queue_{nullptr};
-  ContinueFuture future_;
-  BlockingReason blockingReason_{BlockingReason::kNotBlocked};
+  // Set if the consumer drivers are scaled.
+  const std::shared_ptr<ScaledDriverController> scaledDriverController_;
+  OperatorAwaiter awaiter_;
 };
 
 /// Hash partitions the data using specified keys. The number of partitions is
@@ -250,6 +266,9 @@ class LocalPartition : public Operator {
   const std::vector<std::shared_ptr<LocalExchangeQueue>> queues_;
   const size_t numPartitions_;
   std::unique_ptr<core::PartitionFunction> partitionFunction_;
+  // Set if the consumer drivers are scaled. Picks the queue of each input
+  // batch instead of 'partitionFunction_'.
+  const std::shared_ptr<ScaledDriverController> scaledDriverController_;
 
   std::vector<BlockingReason> blockingReasons_;
   std::vector<ContinueFuture> futures_;
@@ -25,6 +25,7 @@
 #include "velox/exec/GroupId.h"
 #include "velox/exec/HashAggregation.h"
 #include "velox/exec/HashBuild.h"
+#include "velox/exec/HashPartitionFunction.h"
 #include "velox/exec/HashProbe.h"
 #include "velox/exec/IndexLookupJoin.h"
 #include "velox/exec/Limit.h"
@@ -67,6 +68,30 @@ bool eagerFlush(const core::PlanNode& node) {
   return eagerFlush(*node.sources()[0]);
 }
 
+// Returns the number of rows after which the Limit fed by the TableScan at
+// 'planNodes[scanIndex]' stops reading. Returns std::nullopt if other than
+// projections run in between or if the limit is over 'maxLimit' rows.
+std::optional<uint64_t> scanLimit(
+    const std::vector<core::PlanNodePtr>& planNodes,
+    size_t scanIndex,
+    uint64_t maxLimit) {
+  for (auto i = scanIndex + 1; i < planNodes.size(); ++i) {
+    const auto* node = planNodes[i].get();
+    if (auto* limit = dynamic_cast<const core::LimitNode*>(node)) {
+      const uint64_t numRows = limit->offset() + limit->count();
+      if (numRows > maxLimit) {
+        return std::nullopt;
+      }
+      return numRows;
+    }
+    // Projections keep all rows.
+    if (dynamic_cast<const core::ProjectNode*>(node) == nullptr) {
+      return std::nullopt;
+    }
+  }
+  return std::nullopt;
+}
+
 } // namespace
 
 namespace detail {
@@ -146,7 +171,16 @@ OperatorSupplier makeOperatorSupplier(
     }
     bool useEagerFlush = eagerFlush(*planNode);
     return [localPartitionNode, useEagerFlush](
-               int32_t operatorId, DriverCtx* ctx) {
+               int32_t operatorId,
+               DriverCtx* ctx) -> std::unique_ptr<Operator> {
+      // The task creates a partition balancer if the consumer accepts
+      // skewed partitions.
+      if (ctx->queryConfig().localExchangeSkewRebalanceEnabled() &&
+          ctx->task->getScaleWriterPartitionBalancer(
+              ctx->splitGroupId, localPartitionNode->id()) != nullptr) {
+        return std::make_unique<SkewedLocalPartition>(
+            operatorId, ctx, localPartitionNode);
+      }
       return std::make_unique<LocalPartition>(
           operatorId, ctx, localPartitionNode, useEagerFlush);
     };
@@ -177,8 +211,8 @@ OperatorSupplier makeOperatorSupplier(
           std::dynamic_pointer_cast<const core::MergeJoinNode>(planNode)) {
     auto planNodeId = planNode->id();
     return [planNodeId](int32_t operatorId, DriverCtx* ctx) {
-      auto source =
-          ctx->task->getMergeJoinSource(ctx->splitGroupId, planNodeId);
+      auto source = ctx->task->getMergeJoinSource(
+          ctx->splitGroupId, planNodeId, ctx->driverId);
       auto consumer =
           [source](RowVectorPtr input, bool drained, ContinueFuture* future) {
             if (drained) {
@@ -230,10 +264,31 @@ void plan(
   currentPlanNodes->push_back(planNode);
 }
 
+// Returns true if 'node' is a merge join with local repartitions on both
+// sides, e.g. on key ranges. Such a merge join runs in multiple drivers. Each
+// driver joins one partition of the left side with the same partition of the
+// right side.
+bool isParallelMergeJoin(const std::shared_ptr<const core::PlanNode>& node) {
+  if (!std::dynamic_pointer_cast<const core::MergeJoinNode>(node)) {
+    return false;
+  }
+  for (const auto& source : node->sources()) {
+    auto localPartition =
+        std::dynamic_pointer_cast<const core::LocalPartitionNode>(source);
+    if (localPartition == nullptr ||
+        localPartition->type() !=
+            core::LocalPartitionNode::Type::kRepartition) {
+      return false;
+    }
+  }
+  return true;
+}
+
 // Sometimes consumer limits the number of drivers its producer can run.
 uint32_t maxDriversForConsumer(
     const std::shared_ptr<const core::PlanNode>& node) {
-  if (std::dynamic_pointer_cast<const core::MergeJoinNode>(node)) {
+  if (std::dynamic_pointer_cast<const core::MergeJoinNode>(node) &&
+      !isParallelMergeJoin(node)) {
     // MergeJoinNode must run single-threaded.
     return 1;
   }
@@ -295,8 +350,11 @@ uint32_t maxDrivers(
       // Merge exchange must run single-threaded.
       return 1;
     } else if (std::dynamic_pointer_cast<const core::MergeJoinNode>(node)) {
-      // Merge join must run single-threaded.
-      return 1;
+      // Merge join must run single-threaded unless both sides are
+      // repartitioned.
+      if (!isParallelMergeJoin(node)) {
+        return 1;
+      }
     } else if (
         auto join = std::dynamic_pointer_cast<const core::HashJoinNode>(node)) {
       // Right semi project doesn't support multi-threaded execution.
@@ -367,6 +425,22 @@ void LocalPlanner::plan(
     factory->maxDrivers = detail::maxDrivers(*factory, queryConfig);
     factory->numDrivers = std::min(factory->maxDrivers, maxDrivers);
 
+    // The right side of a merge join runs one driver per merge join driver.
+    // The pipeline of the merge join is planned before its right side.
+    if (detail::isParallelMergeJoin(factory->consumerNode)) {
+      const auto& joinId = factory->consumerNode->id();
+      for (auto& other : *driverFactories) {
+        if (other.get() == factory.get()) {
+          break;
+        }
+        for (const auto& node : other->planNodes) {
+          if (node->id() == joinId) {
+            factory->numDrivers = other->numDrivers;
+          }
+        }
+      }
+    }
+
     // Pipelines running grouped/bucketed execution would have separate groups
     // of drivers dealing with separate split groups (one driver can access
     // splits from only one designated split group), hence we will have total
@@ -508,8 +582,14 @@ std::shared_ptr<Driver> DriverFactory::createDriver(
     } else if (
         auto tableScanNode =
             std::dynamic_pointer_cast<const core::TableScanNode>(planNode)) {
-      operators.push_back(
-          std::make_unique<TableScan>(id, ctx.get(), tableScanNode));
+      auto tableScan =
+          std::make_unique<TableScan>(id, ctx.get(), tableScanNode);
+      // A limit that fits in one batch lets the scan stop reading early.
+      if (const auto limit = scanLimit(
+              planNodes, i, ctx->queryConfig().maxOutputBatchRows())) {
+        tableScan->setLimit(limit.value());
+      }
+      operators.push_back(std::move(tableScan));
     } else if (
         auto tableWriteNode =
             std::dynamic_pointer_cast<const core::TableWriteNode>(planNode)) {
@@ -618,7 +698,8 @@ std::shared_ptr<Driver> DriverFactory::createDriver(
         auto mergeJoin =
             std::dynamic_pointer_cast<const core::MergeJoinNode>(planNode)) {
       auto mergeJoinOp = std::make_unique<MergeJoin>(id, ctx.get(), mergeJoin);
-      ctx->task->createMergeJoinSource(ctx->splitGroupId, mergeJoin->id());
+      ctx->task->createMergeJoinSource(
+          ctx->splitGroupId, mergeJoin->id(), ctx->driverId);
       operators.push_back(std::move(mergeJoinOp));
     } else if (
         auto localPartitionNode =
@@ -745,6 +826,36 @@ std::vector<core::PlanNodeId> DriverFactory::needsHashJoinBridges() const {
   return planNodeIds;
 }
 
+bool DriverFactory::acceptsSkewedLocalPartition() const {
+  VELOX_CHECK(!planNodes.empty());
+  const auto localPartition =
+      std::dynamic_pointer_cast<const core::LocalPartitionNode>(
+          planNodes.front());
+  if (localPartition == nullptr || localPartition->scaleWriter() ||
+      localPartition->type() != core::LocalPartitionNode::Type::kRepartition ||
+      dynamic_cast<const HashPartitionFunctionSpec*>(
+          &localPartition->partitionFunctionSpec()) == nullptr) {
+    return false;
+  }
+  for (auto i = 1; i < planNodes.size(); ++i) {
+    const auto* node = planNodes[i].get();
+    // Filters and projections process each row independently.
+    if (dynamic_cast<const core::FilterNode*>(node) != nullptr ||
+        dynamic_cast<const core::ProjectNode*>(node) != nullptr) {
+      continue;
+    }
+    // The partial results of a split partition are merged downstream.
+    if (const auto* aggregation =
+            dynamic_cast<const core::AggregationNode*>(node)) {
+      return aggregation->step() == core::AggregationNode::Step::kPartial ||
+          aggregation->step() == core::AggregationNode::Step::kIntermediate;
+    }
+    // All probe drivers share the hash table.
+    return dynamic_cast<const core::HashJoinNode*>(node) != nullptr;
+  }
+  return false;
+}
+
 std::vector<core::PlanNodeId> DriverFactory::needsNestedLoopJoinBridges()
     const {
   std::vector<core::PlanNodeId> planNodeIds;
@@ -16,8 +16,10 @@
 
 #pragma once
 
-#include "velox/exec/GroupingSet.h"
+#include "velox/exec/HashPartitionFunction.h"
+#include "velox/exec/HashTable.h"
 #include "velox/exec/Operator.h"
+#include "velox/exec/Spiller.h"
 
 namespace facebook::velox::exec {
 
@@ -28,8 +30,10 @@ class MarkDistinct : public Operator {
       DriverCtx* driverCtx,
       const std::shared_ptr<const core::MarkDistinctNode>& planNode);
 
+  /// The output order is preserved unless spilling is enabled. Spilled input
+  /// is processed after the unspilled input, one spill partition at a time.
   bool preservesOrder() const override {
-    return true;
+    return !spillEnabled();
   }
 
   bool needsInput() const override {
@@ -38,6 +42,8 @@ class MarkDistinct : public Operator {
 
   void addInput(RowVectorPtr input) override;
 
+  void noMoreInput() override;
+
   RowVectorPtr getOutput() override;
 
   BlockingReason isBlocked(ContinueFuture* /*future*/) override {
@@ -46,8 +52,103 @@ class MarkDistinct : public Operator {
 
   bool isFinished() override;
 
+  void reclaim(uint64_t targetBytes, memory::MemoryReclaimer::Stats& stats)
+      override;
+
+ private:
+  bool spillEnabled() const {
+    return spillConfig_.has_value();
+  }
+
+  // Sets the distinct marker of 'input_' from the new groups in 'lookup_'.
+  void fillDistinctMarker(vector_size_t size);
+
+  void ensureInputFits(const RowVectorPtr& input);
+
+  void spill();
+
+  SpillPartitionIdSet spillHashTable();
+
+  void setupInputSpiller(const SpillPartitionIdSet& spillPartitionIdSet);
+
+  void spillInput(const RowVectorPtr& input, memory::MemoryPool* pool);
+
+  // Finishes the current input spilling and restores the next processing
+  // partition.
+  void finishSpillInputAndRestoreNext();
+
+  // Restores the hash table of the next spilled partition and starts reading
+  // the input spilled for the partition.
+  void restoreNextSpillPartition();
+
+  // Used by recursive spill processing to read the spilled input data from the
+  // previous spill run through 'spillInputReader_' and then spill them back
+  // into a number of sub-partitions. Same as in RowNumber.
+  void recursiveSpillInput();
+
+  // Set 'spillPartitionBits_' for (recursive) spill. If 'restoredPartitionId'
+  // is not null, use it to set 'spillPartitionBits_', otherwise use
+  // 'spillConfig_'. If the new 'spillPartitionBits_' exceeds the
+  // 'maxSpillLevel', set 'exceededMaxSpillLevelLimit_' to true.
+  void setSpillPartitionBits(
+      const SpillPartitionId* restoredPartitionId = nullptr);
+
+  const RowTypePtr inputType_;
+
+  // Hash table over the distinct keys seen so far. The rows only store the
+  // keys.
+  std::unique_ptr<BaseHashTable> table_;
+  std::unique_ptr<HashLookup> lookup_;
+
+  // The spill partition bits used by both hash table content spill and input
+  // data spill.
+  HashBitRange spillPartitionBits_;
+
+  SpillPartitionSet spillHashTablePartitionSet_;
+
+  // Spiller for input received after spilling has been triggered.
+  std::unique_ptr<NoRowContainerSpiller> inputSpiller_;
+
+  // Used to restore previously spilled input.
+  std::unique_ptr<UnorderedStreamReader<BatchStream>> spillInputReader_;
+
+  // The spill partition id for the currently restoring partition, corresponding
+  // to 'spillInputReader_'. Not set if the operator hasn't spilled yet.
+  std::optional<SpillPartitionId> restoringPartitionId_;
+
+  SpillPartitionSet spillInputPartitionSet_;
+
+  // Used to calculate the spill partition numbers of the inputs.
+  std::unique_ptr<HashPartitionFunction> spillHashFunction_;
+
+  // The cpu may be voluntarily yield after running too long when processing
+  // input from spilled file.
+  bool yield_{false};
+
+  bool exceededMaxSpillLevelLimit_{false};
+};
+
+class MarkDistinctHashTableSpiller : public SpillerBase {
+ public:
+  static constexpr std::string_view kType = "MarkDistinctHashTableSpiller";
+
+  MarkDistinctHashTableSpiller(
+      RowContainer* container,
+      std::optional<SpillPartitionId> parentId,
+      RowTypePtr rowType,
+      HashBitRange bits,
+      const common::SpillConfig* spillConfig,
+      folly::Synchronized<common::SpillStats>* spillStats);
+
+  void spill();
+
  private:
-  // TODO: Document spilling configuration in spilling.rst.
-  std::unique_ptr<GroupingSet> groupingSet_;
+  bool needSort() const override {
+    return false;
+  }
+
+  std::string type() const override {
+    return std::string(kType);
+  }
 };
 } // namespace facebook::velox::exec
@@ -163,7 +163,12 @@ void Merge::setupSpillMerger() {
     spillReadFiles.reserve(spillFiles.size());
     for (const auto& spillFile : spillFiles) {
       spillReadFiles.emplace_back(SpillReadFile::create(
-          spillFile, spillConfig_->readBufferSize, pool(), spillStats_.get()));
+          spillFile,
+          spillConfig_->readBufferSize,
+          pool(),
+          spillStats_.get(),
+          spillConfig_->numReadAheadBuffers,
+          spillConfig_->executor));
     }
     spillReadFilesGroups.push_back(std::move(spillReadFiles));
   }
@@ -196,8 +201,7 @@ void Merge::maybeStartNextMergeSourceGroup() {
   std::vector<std::unique_ptr<SourceStream>> cursors;
   cursors.reserve(sources.size());
   for (auto* source : sources) {
-    cursors.push_back(
-        std::make_unique<SourceStream>(source, sortingKeys_, outputBatchSize_));
+    cursors.push_back(std::make_unique<SourceStream>(source, sortingKeys_));
   }
 
   sourceMerger_ = std::make_unique<SourceMerger>(
@@ -326,7 +330,17 @@ RowVectorPtr SourceMerger::getOutput(
       return std::move(output_);
     }
 
-    if (stream->setOutputRow(outputSize_)) {
+    // Takes the rows of the winning stream up to the first row of the next
+    // stream at once. The other streams do not move while these rows are
+    // taken.
+    vector_size_t maxRows = 1;
+    const SourceStream* bound = nullptr;
+    if (stream->shouldProbeRun()) {
+      maxRows = outputBatchSize_ - outputSize_;
+      bound = merger_->runnerUp();
+    }
+    vector_size_t numRows;
+    if (stream->setOutputRows(outputSize_, maxRows, bound, numRows)) {
       // The stream is at end of input batch. Need to copy out the rows before
       // fetching next batch in 'pop'.
       stream->copyToOutput(output_);
@@ -335,7 +349,7 @@ RowVectorPtr SourceMerger::getOutput(
           &sourceBlockingFutures);
     }
 
-    ++outputSize_;
+    outputSize_ += numRows;
 
     // Advance the stream.
     stream->pop(sourceBlockingFutures);
@@ -375,11 +389,60 @@ bool SourceStream::operator<(const MergeStream& other) const {
   return false;
 }
 
+bool SourceStream::isNotGreater(
+    vector_size_t row,
+    const SourceStream& other) const {
+  for (auto i = 0; i < sortingKeys_.size(); ++i) {
+    if (auto result = keyColumns_[i]
+                          ->compare(
+                              other.keyColumns_[i],
+                              row,
+                              other.currentSourceRow_,
+                              sortingKeys_[i].second)
+                          .value()) {
+      return result < 0;
+    }
+  }
+  return true;
+}
+
+bool SourceStream::setOutputRows(
+    vector_size_t firstOutputRow,
+    vector_size_t maxRows,
+    const SourceStream* bound,
+    vector_size_t& numRows) {
+  VELOX_DCHECK_GT(maxRows, 0);
+  const vector_size_t firstSourceRow = currentSourceRow_;
+  const vector_size_t endRow =
+      std::min<vector_size_t>(data_->size(), firstSourceRow + maxRows);
+  vector_size_t row = firstSourceRow + 1;
+  if (bound == nullptr) {
+    row = endRow;
+  } else {
+    while (row < endRow && isNotGreater(row, *bound)) {
+      ++row;
+    }
+  }
+  numRows = row - firstSourceRow;
+  if (endRow - firstSourceRow > 1) {
+    numSkippedRunProbes_ = numRows == 1 ? kRunProbeBackoff : 0;
+  }
+
+  const BaseVector::CopyRange range{firstSourceRow, firstOutputRow, numRows};
+  if (!copyRanges_.empty() && copyRanges_.back().mergeable(range)) {
+    copyRanges_.back().count += numRows;
+  } else {
+    copyRanges_.push_back(range);
+  }
+  currentSourceRow_ = row - 1;
+  return currentSourceRow_ == data_->size() - 1;
+}
+
 bool SourceStream::pop(std::vector<ContinueFuture>& futures) {
   ++currentSourceRow_;
   if (currentSourceRow_ == data_->size()) {
     // Make sure all current data has been copied out.
-    VELOX_CHECK(!outputRows_.hasSelections());
+    VELOX_CHECK(copyRanges_.empty());
     return fetchMoreData(futures);
   }
 
@@ -387,28 +450,14 @@ bool SourceStream::pop(std::vector<ContinueFuture>& futures) {
 }
 
 void SourceStream::copyToOutput(RowVectorPtr& output) {
-  outputRows_.updateBounds();
-
-  if (!outputRows_.hasSelections()) {
+  if (copyRanges_.empty()) {
     return;
   }
 
-  vector_size_t sourceRow = firstSourceRow_;
-  outputRows_.applyToSelected(
-      [&](auto row) { sourceRows_[row] = sourceRow++; });
-
   for (auto i = 0; i < output->type()->size(); ++i) {
-    output->childAt(i)->copy(
-        data_->childAt(i).get(), outputRows_, sourceRows_.data());
-  }
-
-  outputRows_.clearAll();
-
-  if (sourceRow == data_->size()) {
-    firstSourceRow_ = 0;
-  } else {
-    firstSourceRow_ = sourceRow;
+    output->childAt(i)->copyRanges(data_->childAt(i).get(), copyRanges_);
   }
+  copyRanges_.clear();
 }
 
 bool SourceStream::fetchMoreData(std::vector<ContinueFuture>& futures) {
@@ -517,8 +566,8 @@ std::unique_ptr<SourceMerger> SpillMerger::createSourceMerger(
   std::vector<std::unique_ptr<SourceStream>> streams;
   streams.reserve(sources.size());
   for (const auto& source : sources) {
-    streams.push_back(std::make_unique<SourceStream>(
-        source.get(), sortingKeys, outputBatchSize));
+    streams.push_back(
+        std::make_unique<SourceStream>(source.get(), sortingKeys));
   }
   return std::make_unique<SourceMerger>(
       type, outputBatchSize, std::move(streams), pool);
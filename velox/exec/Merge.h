@@ -146,12 +146,8 @@ class SourceStream final : public MergeStream {
  public:
   SourceStream(
       MergeSource* source,
-      const std::vector<SpillSortKey>& sortingKeys,
-      uint32_t outputBatchSize)
-      : source_{source},
-        sortingKeys_{sortingKeys},
-        outputRows_(outputBatchSize, false),
-        sourceRows_(outputBatchSize) {
+      const std::vector<SpillSortKey>& sortingKeys)
+      : source_{source}, sortingKeys_{sortingKeys} {
     keyColumns_.reserve(sortingKeys.size());
   }
 
@@ -178,24 +174,51 @@ class SourceStream final : public MergeStream {
   /// 'is-blocked'.
   bool pop(std::vector<ContinueFuture>& futures);
 
-  /// Records the output row number for the current row. Returns true if
-  /// current row is the last row in the current batch, in which case the
-  /// caller must call 'copyToOutput' before calling pop(). The caller must
-  /// call 'setOutputRow' before calling 'pop'. The output rows must
-  /// monotonically increase in between calls to 'copyToOutput'.
-  bool setOutputRow(vector_size_t row) {
-    outputRows_.setValid(row, true);
-    return currentSourceRow_ == data_->size() - 1;
+  /// Returns true if the caller should look for a run of rows from 'this' to
+  /// copy at once, i.e. with 'maxRows' > 1 in 'setOutputRows'. Returns false
+  /// for a while after a probe found a run of a single row, since finding the
+  /// bound of a run costs comparisons that do not pay off if the sources
+  /// interleave row by row.
+  bool shouldProbeRun() {
+    if (numSkippedRunProbes_ == 0) {
+      return true;
+    }
+    --numSkippedRunProbes_;
+    return false;
   }
 
+  /// Records the output rows for a run of up to 'maxRows' consecutive rows of
+  /// the current batch that starts at the current row. The rows after the
+  /// first are included while they are not greater than the current row of
+  /// 'bound'. If 'bound' is nullptr, the run extends to the end of the
+  /// current batch. 'firstOutputRow' is the output row number of the first row
+  /// of the run. Sets 'numRows' to the length of the run and makes the last
+  /// row of the run the current row. Returns true if the current row is the
+  /// last row in the current batch, in which case the caller must call
+  /// 'copyToOutput' before calling pop(). The caller must call
+  /// 'setOutputRows' before calling 'pop'. The output rows must monotonically
+  /// increase in between calls to 'copyToOutput'.
+  bool setOutputRows(
+      vector_size_t firstOutputRow,
+      vector_size_t maxRows,
+      const SourceStream* bound,
+      vector_size_t& numRows);
+
   /// Called if either current row is the last row in the current batch or the
   /// caller accumulated enough output rows across all sources to produce an
   /// output batch.
   void copyToOutput(RowVectorPtr& output);
 
  private:
+  // Number of run probes to skip after a probe that found a single row.
+  static constexpr int32_t kRunProbeBackoff = 16;
+
   bool fetchMoreData(std::vector<ContinueFuture>& futures);
 
+  // Returns true if 'row' of the current batch is not greater than the
+  // current row of 'other'.
+  bool isNotGreater(vector_size_t row, const SourceStream& other) const;
+
   MergeSource* source_;
 
   const std::vector<SpillSortKey>& sortingKeys_;
@@ -217,14 +240,13 @@ class SourceStream final : public MergeStream {
   /// returned by 'source_->next()'.
   bool needData_{true};
 
-  /// First source row that hasn't been copied out yet.
-  vector_size_t firstSourceRow_{0};
-
-  /// Output row numbers for source rows that haven't been copied out yet.
-  SelectivityVector outputRows_;
+  /// Ranges of source rows that haven't been copied out yet and their
+  /// positions in the output.
+  std::vector<BaseVector::CopyRange> copyRanges_;
 
-  /// Reusable memory.
-  std::vector<vector_size_t> sourceRows_;
+  /// Number of calls to 'shouldProbeRun' that return false before probing for
+  /// a run again.
+  int32_t numSkippedRunProbes_{0};
 };
 
 /// A utility class for sort-merging data from data spilled by the `LocalMerge`
@@ -860,7 +860,9 @@ RowVectorPtr MergeJoin::getOutput() {
     if (!rightHasNoInput() && !futureRightSideInput_.valid() && !rightInput_) {
       if (!rightSource_) {
         rightSource_ = operatorCtx_->task()->getMergeJoinSource(
-            operatorCtx_->driverCtx()->splitGroupId, planNodeId());
+            operatorCtx_->driverCtx()->splitGroupId,
+            planNodeId(),
+            operatorCtx_->driverCtx()->driverId);
       }
 
       while (!rightHasNoInput() && !rightInput_) {
@@ -25,6 +25,7 @@ class MergeSource {
  public:
   static constexpr int32_t kMaxQueuedBytesUpperLimit = 32 << 20; // 32 MB.
   static constexpr int32_t kMaxQueuedBytesLowerLimit = 1 << 20; // 1 MB.
+  static constexpr uint32_t kDefaultLocalQueueSize = 2;
 
   virtual ~MergeSource() = default;
 
@@ -46,7 +47,11 @@ class MergeSource {
   virtual void close() = 0;
 
   // Factory methods to create MergeSources.
-  static std::shared_ptr<MergeSource> createLocalMergeSource();
+
+  /// Creates a source that buffers up to 'queueSize' batches from its producer
+  /// before blocking it.
+  static std::shared_ptr<MergeSource> createLocalMergeSource(
+      uint32_t queueSize = kDefaultLocalQueueSize);
 
   static std::shared_ptr<MergeSource> createMergeExchangeSource(
       MergeExchange* mergeExchange,
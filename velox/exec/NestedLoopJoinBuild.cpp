@@ -15,20 +15,286 @@
  */
 #include "velox/exec/NestedLoopJoinBuild.h"
 #include "velox/exec/Task.h"
+#include "velox/expression/SimpleFunctionRegistry.h"
 
 namespace facebook::velox::exec {
+namespace {
 
-void NestedLoopJoinBridge::setData(std::vector<RowVectorPtr> buildVectors) {
+bool isBandConditionType(const TypePtr& type) {
+  if (type->providesCustomComparison()) {
+    return false;
+  }
+  switch (type->kind()) {
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+    case TypeKind::TIMESTAMP:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void collectConjuncts(
+    const core::TypedExprPtr& expr,
+    std::vector<core::TypedExprPtr>& conjuncts) {
+  const auto* call = dynamic_cast<const core::CallTypedExpr*>(expr.get());
+  if (call != nullptr && call->name() == "and") {
+    for (const auto& input : call->inputs()) {
+      collectConjuncts(input, conjuncts);
+    }
+    return;
+  }
+  conjuncts.push_back(expr);
+}
+
+// Adds a band condition for 'lower <= upper' or 'lower < upper' if one side
+// is a probe column and the other one is a build column.
+void addBandCondition(
+    const core::TypedExprPtr& lower,
+    const core::TypedExprPtr& upper,
+    const RowTypePtr& probeType,
+    const RowTypePtr& buildType,
+    std::vector<NestedLoopJoinBandCondition>& conditions) {
+  const auto lowerField = core::TypedExprs::asFieldAccess(lower);
+  const auto upperField = core::TypedExprs::asFieldAccess(upper);
+  if (lowerField == nullptr || upperField == nullptr ||
+      !lowerField->isInputColumn() || !upperField->isInputColumn()) {
+    return;
+  }
+  if (!isBandConditionType(lowerField->type()) ||
+      !lowerField->type()->equivalent(*upperField->type())) {
+    return;
+  }
+
+  // Join condition fields resolve to the probe side first, like in
+  // NestedLoopJoinProbe::initializeFilter().
+  const auto lowerProbe = probeType->getChildIdxIfExists(lowerField->name());
+  const auto upperProbe = probeType->getChildIdxIfExists(upperField->name());
+  if (lowerProbe.has_value() && !upperProbe.has_value()) {
+    const auto upperBuild = buildType->getChildIdxIfExists(upperField->name());
+    if (upperBuild.has_value()) {
+      conditions.push_back({lowerProbe.value(), upperBuild.value(), true});
+    }
+  } else if (!lowerProbe.has_value() && upperProbe.has_value()) {
+    const auto lowerBuild = buildType->getChildIdxIfExists(lowerField->name());
+    if (lowerBuild.has_value()) {
+      conditions.push_back({upperProbe.value(), lowerBuild.value(), false});
+    }
+  }
+}
+
+// Predicates that are false unless the envelopes of their arguments
+// intersect.
+const std::vector<std::string>& spatialPredicateNames() {
+  static const std::vector<std::string> kNames{
+      "st_contains",
+      "st_within",
+      "st_intersects",
+      "st_overlaps",
+      "st_touches",
+      "st_crosses"};
+  return kNames;
+}
+
+// Returns the prefix of 'name' if it is a spatial predicate, e.g. "presto."
+// for "presto.st_contains".
+std::optional<std::string> spatialPredicatePrefix(const std::string& name) {
+  for (const auto& predicate : spatialPredicateNames()) {
+    if (name.size() >= predicate.size() &&
+        name.compare(
+            name.size() - predicate.size(), predicate.size(), predicate) ==
+            0) {
+      return name.substr(0, name.size() - predicate.size());
+    }
+  }
+  return std::nullopt;
+}
+
+} // namespace
+
+std::optional<NestedLoopJoinSpatialCondition>
+extractNestedLoopJoinSpatialCondition(
+    const core::TypedExprPtr& condition,
+    const RowTypePtr& probeType,
+    const RowTypePtr& buildType) {
+  std::vector<core::TypedExprPtr> conjuncts;
+  collectConjuncts(condition, conjuncts);
+
+  for (const auto& conjunct : conjuncts) {
+    const auto* call = dynamic_cast<const core::CallTypedExpr*>(conjunct.get());
+    if (call == nullptr || call->inputs().size() != 2) {
+      continue;
+    }
+    const auto prefix = spatialPredicatePrefix(call->name());
+    if (!prefix.has_value()) {
+      continue;
+    }
+    const auto left = core::TypedExprs::asFieldAccess(call->inputs()[0]);
+    const auto right = core::TypedExprs::asFieldAccess(call->inputs()[1]);
+    if (left == nullptr || right == nullptr || !left->isInputColumn() ||
+        !right->isInputColumn() || !left->type()->equivalent(*right->type())) {
+      continue;
+    }
+
+    // Join condition fields resolve to the probe side first, like in
+    // NestedLoopJoinProbe::initializeFilter().
+    std::optional<column_index_t> probeChannel;
+    std::optional<column_index_t> buildChannel;
+    if (const auto channel = probeType->getChildIdxIfExists(left->name())) {
+      probeChannel = channel;
+      if (!probeType->containsChild(right->name())) {
+        buildChannel = buildType->getChildIdxIfExists(right->name());
+      }
+    } else if (
+        const auto channel = probeType->getChildIdxIfExists(right->name())) {
+      probeChannel = channel;
+      buildChannel = buildType->getChildIdxIfExists(left->name());
+    }
+    if (!probeChannel.has_value() || !buildChannel.has_value()) {
+      continue;
+    }
+
+    NestedLoopJoinSpatialCondition spatialCondition{
+        probeChannel.value(), buildChannel.value(), left->type(), {}};
+    bool registered = true;
+    for (const auto* suffix : {"st_xmin", "st_ymin", "st_xmax", "st_ymax"}) {
+      auto name = prefix.value() + suffix;
+      if (!simpleFunctions()
+               .resolveFunction(name, {spatialCondition.geometryType})
+               .has_value()) {
+        registered = false;
+        break;
+      }
+      spatialCondition.envelopeFunctions.push_back(std::move(name));
+    }
+    if (registered) {
+      return spatialCondition;
+    }
+  }
+  return std::nullopt;
+}
+
+SpatialEnvelopeEvaluator::SpatialEnvelopeEvaluator(
+    const NestedLoopJoinSpatialCondition& condition,
+    core::ExecCtx* execCtx)
+    : execCtx_(execCtx), inputType_(ROW({"g"}, {condition.geometryType})) {
+  const auto geometry =
+      std::make_shared<core::FieldAccessTypedExpr>(condition.geometryType, "g");
+  std::vector<core::TypedExprPtr> exprs;
+  for (const auto& name : condition.envelopeFunctions) {
+    exprs.push_back(std::make_shared<core::CallTypedExpr>(
+        DOUBLE(), std::vector<core::TypedExprPtr>{geometry}, name));
+  }
+  exprSet_ = std::make_unique<ExprSet>(std::move(exprs), execCtx_);
+}
+
+void SpatialEnvelopeEvaluator::evaluate(
+    const VectorPtr& geometries,
+    std::vector<Envelope>& envelopes) {
+  const auto numRows = geometries->size();
+  envelopes.assign(numRows, Envelope::empty());
+  if (numRows == 0) {
+    return;
+  }
+  auto input = std::make_shared<RowVector>(
+      execCtx_->pool(),
+      inputType_,
+      nullptr,
+      numRows,
+      std::vector<VectorPtr>{geometries});
+  SelectivityVector rows(numRows);
+  EvalCtx evalCtx(execCtx_, exprSet_.get(), input.get());
+  exprSet_->eval(rows, evalCtx, results_);
+
+  // The envelope functions return null for null and empty geometries. A NaN
+  // bound keeps the envelope of such rows empty.
+  static constexpr double Envelope::*kBounds[] = {
+      &Envelope::minX, &Envelope::minY, &Envelope::maxX, &Envelope::maxY};
+  for (auto i = 0; i < 4; ++i) {
+    decoded_.decode(*results_[i], rows);
+    for (vector_size_t row = 0; row < numRows; ++row) {
+      if (decoded_.isNullAt(row)) {
+        envelopes[row].minX = std::numeric_limits<double>::quiet_NaN();
+      } else {
+        envelopes[row].*kBounds[i] = decoded_.valueAt<double>(row);
+      }
+    }
+  }
+}
+
+std::vector<NestedLoopJoinBandCondition> extractNestedLoopJoinBandConditions(
+    const core::TypedExprPtr& condition,
+    const RowTypePtr& probeType,
+    const RowTypePtr& buildType) {
+  std::vector<core::TypedExprPtr> conjuncts;
+  collectConjuncts(condition, conjuncts);
+
+  std::vector<NestedLoopJoinBandCondition> conditions;
+  for (const auto& conjunct : conjuncts) {
+    const auto* call = dynamic_cast<const core::CallTypedExpr*>(conjunct.get());
+    if (call == nullptr) {
+      continue;
+    }
+    const auto& name = call->name();
+    const auto& inputs = call->inputs();
+    if ((name == "lt" || name == "lte") && inputs.size() == 2) {
+      addBandCondition(inputs[0], inputs[1], probeType, buildType, conditions);
+    } else if ((name == "gt" || name == "gte") && inputs.size() == 2) {
+      addBandCondition(inputs[1], inputs[0], probeType, buildType, conditions);
+    } else if (name == "between" && inputs.size() == 3) {
+      addBandCondition(inputs[1], inputs[0], probeType, buildType, conditions);
+      addBandCondition(inputs[0], inputs[2], probeType, buildType, conditions);
+    }
+  }
+  return conditions;
+}
+
+std::optional<int64_t> nestedLoopJoinBandKey(
+    const DecodedVector& decoded,
+    vector_size_t row) {
+  if (decoded.isNullAt(row)) {
+    return std::nullopt;
+  }
+  switch (decoded.base()->typeKind()) {
+    case TypeKind::TINYINT:
+      return decoded.valueAt<int8_t>(row);
+    case TypeKind::SMALLINT:
+      return decoded.valueAt<int16_t>(row);
+    case TypeKind::INTEGER:
+      return decoded.valueAt<int32_t>(row);
+    case TypeKind::BIGINT:
+      return decoded.valueAt<int64_t>(row);
+    case TypeKind::TIMESTAMP:
+      return decoded.valueAt<Timestamp>(row).getSeconds();
+    default:
+      VELOX_UNREACHABLE(
+          "Unsupported band condition type: {}",
+          decoded.base()->type()->toString());
+  }
+}
+
+void NestedLoopJoinBridge::setData(
+    std::vector<RowVectorPtr> buildVectors,
+    std::shared_ptr<const SpatialIndex> spatialIndex) {
   std::vector<ContinuePromise> promises;
   {
     std::lock_guard<std::mutex> l(mutex_);
     VELOX_CHECK(!buildVectors_.has_value(), "setData must be called only once");
     buildVectors_ = std::move(buildVectors);
+    spatialIndex_ = std::move(spatialIndex);
     promises = std::move(promises_);
   }
   notify(std::move(promises));
 }
 
+std::shared_ptr<const SpatialIndex> NestedLoopJoinBridge::spatialIndex() {
+  std::lock_guard<std::mutex> l(mutex_);
+  VELOX_CHECK(buildVectors_.has_value());
+  return spatialIndex_;
+}
+
 std::optional<std::vector<RowVectorPtr>> NestedLoopJoinBridge::dataOrFuture(
     ContinueFuture* future) {
   std::lock_guard<std::mutex> l(mutex_);
@@ -50,7 +316,26 @@ NestedLoopJoinBuild::NestedLoopJoinBuild(
           nullptr,
           operatorId,
           joinNode->id(),
-          "NestedLoopJoinBuild") {}
+          "NestedLoopJoinBuild"),
+      bandBlockRows_{
+          driverCtx->queryConfig().nestedLoopJoinBandBlockRows()} {
+  if (bandBlockRows_ > 0 && joinNode->joinCondition() != nullptr) {
+    const auto conditions = extractNestedLoopJoinBandConditions(
+        joinNode->joinCondition(),
+        joinNode->sources()[0]->outputType(),
+        joinNode->sources()[1]->outputType());
+    if (!conditions.empty()) {
+      bandBuildChannel_ = conditions[0].buildChannel;
+    }
+  }
+  if (driverCtx->queryConfig().nestedLoopJoinSpatialIndexEnabled() &&
+      joinNode->joinCondition() != nullptr) {
+    spatialCondition_ = extractNestedLoopJoinSpatialCondition(
+        joinNode->joinCondition(),
+        joinNode->sources()[0]->outputType(),
+        joinNode->sources()[1]->outputType());
+  }
+}
 
 void NestedLoopJoinBuild::addInput(RowVectorPtr input) {
   if (input->size() > 0) {
@@ -103,6 +388,77 @@ std::vector<RowVectorPtr> NestedLoopJoinBuild::mergeDataVectors() const {
   return merged;
 }
 
+std::vector<RowVectorPtr> NestedLoopJoinBuild::sortIntoBandBlocks() const {
+  VELOX_CHECK(bandBuildChannel_.has_value());
+  struct BuildRow {
+    std::optional<int64_t> key;
+    uint32_t vectorIndex;
+    vector_size_t row;
+  };
+  std::vector<BuildRow> rows;
+  DecodedVector decoded;
+  for (auto i = 0; i < dataVectors_.size(); ++i) {
+    const auto& data = dataVectors_[i];
+    decoded.decode(*data->childAt(bandBuildChannel_.value()));
+    for (vector_size_t row = 0; row < data->size(); ++row) {
+      rows.push_back({nestedLoopJoinBandKey(decoded, row), i, row});
+    }
+  }
+  std::stable_sort(
+      rows.begin(), rows.end(), [](const auto& left, const auto& right) {
+        if (!left.key.has_value()) {
+          return false;
+        }
+        return !right.key.has_value() || left.key.value() < right.key.value();
+      });
+
+  // Copies the rows of each block with one copyRanges() call per source
+  // vector.
+  std::vector<RowVectorPtr> blocks;
+  std::vector<std::vector<BaseVector::CopyRange>> ranges(dataVectors_.size());
+  for (size_t start = 0; start < rows.size(); start += bandBlockRows_) {
+    const auto numRows =
+        std::min<size_t>(bandBlockRows_, rows.size() - start);
+    auto block = BaseVector::create<RowVector>(
+        dataVectors_[0]->type(), numRows, pool());
+    for (vector_size_t i = 0; i < numRows; ++i) {
+      const auto& row = rows[start + i];
+      auto& vectorRanges = ranges[row.vectorIndex];
+      if (!vectorRanges.empty() &&
+          vectorRanges.back().sourceIndex + vectorRanges.back().count ==
+              row.row &&
+          vectorRanges.back().targetIndex + vectorRanges.back().count == i) {
+        ++vectorRanges.back().count;
+      } else {
+        vectorRanges.push_back({row.row, i, 1});
+      }
+    }
+    for (auto i = 0; i < dataVectors_.size(); ++i) {
+      if (!ranges[i].empty()) {
+        block->copyRanges(dataVectors_[i].get(), ranges[i]);
+        ranges[i].clear();
+      }
+    }
+    blocks.push_back(std::move(block));
+  }
+  return blocks;
+}
+
+std::shared_ptr<const SpatialIndex> NestedLoopJoinBuild::buildSpatialIndex() {
+  VELOX_CHECK(spatialCondition_.has_value());
+  SpatialEnvelopeEvaluator evaluator(
+      spatialCondition_.value(), operatorCtx_->execCtx());
+  std::vector<Envelope> envelopes;
+  std::vector<Envelope> vectorEnvelopes;
+  for (const auto& data : dataVectors_) {
+    evaluator.evaluate(
+        data->childAt(spatialCondition_->buildChannel), vectorEnvelopes);
+    envelopes.insert(
+        envelopes.end(), vectorEnvelopes.begin(), vectorEnvelopes.end());
+  }
+  return std::make_shared<const SpatialIndex>(envelopes);
+}
+
 void NestedLoopJoinBuild::noMoreInput() {
   Operator::noMoreInput();
   std::vector<ContinuePromise> promises;
@@ -138,11 +494,16 @@ void NestedLoopJoinBuild::noMoreInput() {
     }
   }
 
-  dataVectors_ = mergeDataVectors();
+  dataVectors_ = bandBuildChannel_.has_value() ? sortIntoBandBlocks()
+                                              : mergeDataVectors();
+  std::shared_ptr<const SpatialIndex> spatialIndex;
+  if (spatialCondition_.has_value()) {
+    spatialIndex = buildSpatialIndex();
+  }
   operatorCtx_->task()
       ->getNestedLoopJoinBridge(
           operatorCtx_->driverCtx()->splitGroupId, planNodeId())
-      ->setData(std::move(dataVectors_));
+      ->setData(std::move(dataVectors_), std::move(spatialIndex));
 }
 
 bool NestedLoopJoinBuild::isFinished() {
@@ -17,17 +17,96 @@
 
 #include "velox/exec/JoinBridge.h"
 #include "velox/exec/Operator.h"
+#include "velox/exec/SpatialIndex.h"
+#include "velox/expression/Expr.h"
+#include "velox/vector/DecodedVector.h"
 
 namespace facebook::velox::exec {
 
+/// A conjunct of a nested loop join condition that bounds a build column by a
+/// probe column, e.g. 'p.ts <= b.end'. Only integer, date and timestamp
+/// columns of the same type on both sides are recognized.
+struct NestedLoopJoinBandCondition {
+  column_index_t probeChannel;
+  column_index_t buildChannel;
+  /// True if the build column is an upper bound of the probe column, i.e.
+  /// 'probe <= build' or 'probe < build'. False for lower bounds.
+  bool buildIsUpperBound;
+};
+
+/// Returns the band conditions among the top level conjuncts of 'condition'.
+/// 'x BETWEEN lo AND hi' is treated as 'lo <= x AND x <= hi'.
+std::vector<NestedLoopJoinBandCondition> extractNestedLoopJoinBandConditions(
+    const core::TypedExprPtr& condition,
+    const RowTypePtr& probeType,
+    const RowTypePtr& buildType);
+
+/// Returns a key that orders the values of a band condition column like the
+/// column type does, or std::nullopt if the value at 'row' is null. Timestamps
+/// map to whole seconds, so distinct values may have equal keys. Comparisons
+/// of keys are therefore only conclusive when the keys differ.
+std::optional<int64_t> nestedLoopJoinBandKey(
+    const DecodedVector& decoded,
+    vector_size_t row);
+
+/// A conjunct of a nested loop join condition that is a spatial predicate
+/// between a probe and a build geometry column, e.g.
+/// 'ST_Contains(b.polygon, p.point)'. The predicate can only be true if the
+/// envelopes of the two geometries intersect.
+struct NestedLoopJoinSpatialCondition {
+  column_index_t probeChannel;
+  column_index_t buildChannel;
+  TypePtr geometryType;
+  /// Names of the registered functions returning the min x, min y, max x and
+  /// max y of a geometry, with the same prefix as the predicate.
+  std::vector<std::string> envelopeFunctions;
+};
+
+/// Returns the first spatial predicate among the top level conjuncts of
+/// 'condition', or std::nullopt if there is none or if the envelope functions
+/// of its prefix are not registered.
+std::optional<NestedLoopJoinSpatialCondition>
+extractNestedLoopJoinSpatialCondition(
+    const core::TypedExprPtr& condition,
+    const RowTypePtr& probeType,
+    const RowTypePtr& buildType);
+
+/// Computes the envelopes of the geometries of one side of a spatial
+/// condition.
+class SpatialEnvelopeEvaluator {
+ public:
+  SpatialEnvelopeEvaluator(
+      const NestedLoopJoinSpatialCondition& condition,
+      core::ExecCtx* execCtx);
+
+  /// Sets 'envelopes' to the envelope of each row of 'geometries'. Null and
+  /// empty geometries get empty envelopes.
+  void evaluate(const VectorPtr& geometries, std::vector<Envelope>& envelopes);
+
+ private:
+  core::ExecCtx* const execCtx_;
+  const RowTypePtr inputType_;
+  std::unique_ptr<ExprSet> exprSet_;
+  std::vector<VectorPtr> results_;
+  DecodedVector decoded_;
+};
+
 class NestedLoopJoinBridge : public JoinBridge {
  public:
-  void setData(std::vector<RowVectorPtr> buildVectors);
+  void setData(
+      std::vector<RowVectorPtr> buildVectors,
+      std::shared_ptr<const SpatialIndex> spatialIndex = nullptr);
 
   std::optional<std::vector<RowVectorPtr>> dataOrFuture(ContinueFuture* future);
 
+  /// Returns the index of the build envelopes of the spatial condition, or
+  /// nullptr if there is none. The ids in the index are row numbers across
+  /// all build vectors, in order. Valid once the data is set.
+  std::shared_ptr<const SpatialIndex> spatialIndex();
+
  private:
   std::optional<std::vector<RowVectorPtr>> buildVectors_;
+  std::shared_ptr<const SpatialIndex> spatialIndex_;
 };
 
 class NestedLoopJoinBuild : public Operator {
@@ -60,9 +139,29 @@ class NestedLoopJoinBuild : public Operator {
 
   std::vector<RowVectorPtr> mergeDataVectors() const;
 
+  /// Sorts the rows of all data vectors on 'bandBuildChannel_', nulls last,
+  /// and splits them into vectors of 'bandBlockRows_' rows.
+  std::vector<RowVectorPtr> sortIntoBandBlocks() const;
+
+  /// Returns an index over the envelopes of the build geometries of
+  /// 'spatialCondition_' in 'dataVectors_'.
+  std::shared_ptr<const SpatialIndex> buildSpatialIndex();
+
  private:
   std::vector<RowVectorPtr> dataVectors_;
 
+  // Number of rows per build vector when sorting on a band condition column.
+  // 0 if the band join optimization is disabled.
+  const vector_size_t bandBlockRows_;
+
+  // The build column of the first band condition of the join condition. Set
+  // only if 'bandBlockRows_' is not zero and there is a band condition.
+  std::optional<column_index_t> bandBuildChannel_;
+
+  // Spatial predicate of the join condition. Set only if the spatial index
+  // is enabled.
+  std::optional<NestedLoopJoinSpatialCondition> spatialCondition_;
+
   // Future for synchronizing with other Drivers of the same pipeline. All build
   // Drivers must be completed before making data available for the probe side.
   ContinueFuture future_{ContinueFuture::makeEmpty()};
@@ -74,6 +74,22 @@ void NestedLoopJoinProbe::initialize() {
         joinNode_->joinCondition(),
         joinNode_->sources()[0]->outputType(),
         joinNode_->sources()[1]->outputType());
+    if (operatorCtx_->driverCtx()->queryConfig().nestedLoopJoinBandBlockRows() >
+        0) {
+      bandConditions_ = extractNestedLoopJoinBandConditions(
+          joinNode_->joinCondition(),
+          joinNode_->sources()[0]->outputType(),
+          joinNode_->sources()[1]->outputType());
+      probeBandColumns_.resize(bandConditions_.size());
+    }
+    if (operatorCtx_->driverCtx()
+            ->queryConfig()
+            .nestedLoopJoinSpatialIndexEnabled()) {
+      spatialCondition_ = extractNestedLoopJoinSpatialCondition(
+          joinNode_->joinCondition(),
+          joinNode_->sources()[0]->outputType(),
+          joinNode_->sources()[1]->outputType());
+    }
   }
 
   joinNode_.reset();
@@ -152,6 +168,7 @@ BlockingReason NestedLoopJoinProbe::isBlocked(ContinueFuture* future) {
           buildMatched_[i].resizeFill(buildVectors_.value()[i]->size(), false);
         }
       }
+      initializeBandRanges();
 
       setState(ProbeOperatorState::kRunning);
       return BlockingReason::kNotBlocked;
@@ -165,6 +182,17 @@ void NestedLoopJoinProbe::close() {
   if (joinCondition_ != nullptr) {
     joinCondition_->clear();
   }
+  if (numBandSkippedBuildVectors_ > 0) {
+    addRuntimeStat(
+        kNumBandSkippedBuildVectors,
+        RuntimeCounter(numBandSkippedBuildVectors_));
+  }
+  if (numSpatialCandidateRows_ > 0) {
+    addRuntimeStat(
+        kNumSpatialCandidateRows, RuntimeCounter(numSpatialCandidateRows_));
+  }
+  probeEnvelopeEvaluator_.reset();
+  spatialIndex_.reset();
   buildVectors_.reset();
   Operator::close();
 }
@@ -179,6 +207,15 @@ void NestedLoopJoinProbe::addInput(RowVectorPtr input) {
     child->loadedVector();
   }
   input_ = std::move(input);
+  for (auto i = 0; i < bandConditions_.size(); ++i) {
+    probeBandColumns_[i].decode(
+        *input_->childAt(bandConditions_[i].probeChannel));
+  }
+  if (useSpatialIndex()) {
+    probeEnvelopeEvaluator_->evaluate(
+        input_->childAt(spatialCondition_->probeChannel), probeEnvelopes_);
+    spatialCandidatesProbeRow_ = -1;
+  }
   if (input_->size() > 0) {
     probeSideEmpty_ = false;
   }
@@ -200,19 +237,99 @@ void NestedLoopJoinProbe::noMoreInput() {
 bool NestedLoopJoinProbe::getBuildData(ContinueFuture* future) {
   VELOX_CHECK(!buildVectors_.has_value());
 
-  auto buildData =
-      operatorCtx_->task()
-          ->getNestedLoopJoinBridge(
-              operatorCtx_->driverCtx()->splitGroupId, planNodeId())
-          ->dataOrFuture(future);
+  auto bridge = operatorCtx_->task()->getNestedLoopJoinBridge(
+      operatorCtx_->driverCtx()->splitGroupId, planNodeId());
+  auto buildData = bridge->dataOrFuture(future);
   if (!buildData.has_value()) {
     return false;
   }
 
   buildVectors_ = std::move(buildData);
+  if (spatialCondition_.has_value()) {
+    spatialIndex_ = bridge->spatialIndex();
+  }
+  if (useSpatialIndex()) {
+    probeEnvelopeEvaluator_ = std::make_unique<SpatialEnvelopeEvaluator>(
+        spatialCondition_.value(), operatorCtx_->execCtx());
+    buildVectorOffsets_.resize(buildVectors_->size() + 1);
+    buildVectorOffsets_[0] = 0;
+    for (auto i = 0; i < buildVectors_->size(); ++i) {
+      buildVectorOffsets_[i + 1] =
+          buildVectorOffsets_[i] + buildVectors_.value()[i]->size();
+    }
+  }
   return true;
 }
 
+void NestedLoopJoinProbe::initializeBandRanges() {
+  if (bandConditions_.empty()) {
+    return;
+  }
+  DecodedVector decoded;
+  buildBandRanges_.resize(buildVectors_->size());
+  for (auto i = 0; i < buildVectors_->size(); ++i) {
+    const auto& buildVector = buildVectors_.value()[i];
+    auto& ranges = buildBandRanges_[i];
+    ranges.resize(bandConditions_.size());
+    for (auto j = 0; j < bandConditions_.size(); ++j) {
+      decoded.decode(*buildVector->childAt(bandConditions_[j].buildChannel));
+      for (auto row = 0; row < buildVector->size(); ++row) {
+        const auto key = nestedLoopJoinBandKey(decoded, row);
+        if (!key.has_value()) {
+          continue;
+        }
+        if (!ranges[j].has_value()) {
+          ranges[j] = std::make_pair(key.value(), key.value());
+        } else {
+          ranges[j]->first = std::min(ranges[j]->first, key.value());
+          ranges[j]->second = std::max(ranges[j]->second, key.value());
+        }
+      }
+    }
+  }
+}
+
+bool NestedLoopJoinProbe::skipBuildVectorByBand() const {
+  if (bandConditions_.empty()) {
+    return false;
+  }
+  const auto& ranges = buildBandRanges_[buildIndex_];
+  for (auto i = 0; i < bandConditions_.size(); ++i) {
+    // A band condition on an all null build column is never true.
+    if (!ranges[i].has_value()) {
+      return true;
+    }
+    const auto probeKey =
+        nestedLoopJoinBandKey(probeBandColumns_[i], probeRow_);
+    if (!probeKey.has_value()) {
+      continue;
+    }
+    // Strict comparisons keep the skip conservative for equal keys.
+    if (bandConditions_[i].buildIsUpperBound
+            ? ranges[i]->second < probeKey.value()
+            : ranges[i]->first > probeKey.value()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void NestedLoopJoinProbe::findSpatialCandidateRows() {
+  if (spatialCandidatesProbeRow_ != probeRow_) {
+    spatialCandidates_.clear();
+    spatialIndex_->query(probeEnvelopes_[probeRow_], spatialCandidates_);
+    spatialCandidatesProbeRow_ = probeRow_;
+  }
+  const auto begin = buildVectorOffsets_[buildIndex_];
+  const auto end = buildVectorOffsets_[buildIndex_ + 1];
+  auto it = std::lower_bound(
+      spatialCandidates_.begin(), spatialCandidates_.end(), begin);
+  spatialCandidateRows_.clear();
+  for (; it != spatialCandidates_.end() && *it < end; ++it) {
+    spatialCandidateRows_.push_back(*it - begin);
+  }
+}
+
 RowVectorPtr NestedLoopJoinProbe::getOutput() {
   if (state_ == ProbeOperatorState::kFinish ||
       state_ == ProbeOperatorState::kWaitForPeers) {
@@ -362,6 +479,23 @@ bool NestedLoopJoinProbe::addToOutput() {
       return true;
     }
 
+    // Skip build vectors that cannot match the probe row. They produce no
+    // output and no build side matches.
+    if (buildRow_ == 0 && skipBuildVectorByBand()) {
+      ++numBandSkippedBuildVectors_;
+      ++buildIndex_;
+      continue;
+    }
+
+    if (buildRow_ == 0 && useSpatialIndex()) {
+      findSpatialCandidateRows();
+      if (spatialCandidateRows_.empty()) {
+        ++buildIndex_;
+        continue;
+      }
+      numSpatialCandidateRows_ += spatialCandidateRows_.size();
+    }
+
     // Only re-calculate the filter if we have a new build vector.
     if (buildRow_ == 0) {
       evaluateJoinFilter(currentBuild);
@@ -373,7 +507,8 @@ bool NestedLoopJoinProbe::addToOutput() {
         continue;
       }
 
-      addOutputRow(i);
+      const auto buildRow = filterBuildRow(i);
+      addOutputRow(buildRow);
       ++numOutputRows_;
       probeRowHasMatch_ = true;
 
@@ -410,7 +545,7 @@ bool NestedLoopJoinProbe::addToOutput() {
       // records that got a hit (key match), so that at end we know which
       // build records to add and which to skip.
       if (needsBuildMismatch(joinType_)) {
-        buildMatched_[buildIndex_].setValid(i, true);
+        buildMatched_[buildIndex_].setValid(buildRow, true);
       }
 
       // If the buffer is full, save state and produce it as output.
@@ -476,11 +611,17 @@ void NestedLoopJoinProbe::prepareOutput() {
 void NestedLoopJoinProbe::evaluateJoinFilter(const RowVectorPtr& buildVector) {
   // First step to process is to get a batch so we can evaluate the join
   // filter.
-  auto filterInput = getNextCrossProductBatch(
-      buildVector,
-      filterInputType_,
-      filterProbeProjections_,
-      filterBuildProjections_);
+  auto filterInput = useSpatialIndex()
+      ? genCrossProductSpatialCandidates(
+            buildVector,
+            filterInputType_,
+            filterProbeProjections_,
+            filterBuildProjections_)
+      : getNextCrossProductBatch(
+            buildVector,
+            filterInputType_,
+            filterProbeProjections_,
+            filterBuildProjections_);
 
   if (filterInputRows_.size() != filterInput->size()) {
     filterInputRows_.resizeFill(filterInput->size(), true);
@@ -619,6 +760,39 @@ RowVectorPtr NestedLoopJoinProbe::genCrossProductMultipleBuildVectors(
       pool(), outputType, nullptr, numOutputRows, std::move(projectedChildren));
 }
 
+RowVectorPtr NestedLoopJoinProbe::genCrossProductSpatialCandidates(
+    const RowVectorPtr& buildVector,
+    const RowTypePtr& outputType,
+    const std::vector<IdentityProjection>& probeProjections,
+    const std::vector<IdentityProjection>& buildProjections) {
+  std::vector<VectorPtr> projectedChildren(outputType->size());
+  const size_t numOutputRows = spatialCandidateRows_.size();
+  probeRowCount_ = 1;
+
+  // Project the candidate rows from the build side.
+  auto rawBuildIndices =
+      initializeRowNumberMapping(spatialBuildIndices_, numOutputRows, pool());
+  std::copy(
+      spatialCandidateRows_.begin(),
+      spatialCandidateRows_.end(),
+      rawBuildIndices.begin());
+  projectChildren(
+      projectedChildren,
+      buildVector,
+      buildProjections,
+      numOutputRows,
+      spatialBuildIndices_);
+
+  // Wrap projections from the probe side as constants.
+  for (const auto [inputChannel, outputChannel] : probeProjections) {
+    projectedChildren[outputChannel] = BaseVector::wrapInConstant(
+        numOutputRows, probeRow_, input_->childAt(inputChannel));
+  }
+
+  return std::make_shared<RowVector>(
+      pool(), outputType, nullptr, numOutputRows, std::move(projectedChildren));
+}
+
 void NestedLoopJoinProbe::addOutputRow(vector_size_t buildRow) {
   // Probe side is always a dictionary; just populate the index.
   rawProbeOutputIndices_[numOutputRows_] = probeRow_;
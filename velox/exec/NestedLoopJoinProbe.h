@@ -61,6 +61,18 @@ namespace facebook::velox::exec {
 /// c) If build side has multiple vectors, take one probe row are at a time,
 /// wrapping it as a constant, and produce it along with build batches.
 ///
+/// If 'nested_loop_join_band_block_rows' is set and the join condition bounds
+/// build columns by probe columns (see NestedLoopJoinBandCondition), the build
+/// side arrives sorted in small blocks. Case c) then skips the build vectors
+/// whose min/max range of a band column cannot satisfy the bound for the
+/// current probe row, without evaluating the join condition.
+///
+/// If 'nested_loop_join_spatial_index_enabled' is set and the join condition
+/// has a spatial predicate (see NestedLoopJoinSpatialCondition), the build
+/// side comes with an R-tree over the build envelopes. Case c) then evaluates
+/// the join condition only on the build rows whose envelopes intersect the
+/// envelope of the current probe row, and skips build vectors without any.
+///
 /// If needed, buid-side copies are done lazily; it first accumulates the ranges
 /// to be copied, then performs the copies in batch, column-by-column. It
 /// produces at most `outputBatchSize_` records, but it may produce fewer since
@@ -93,6 +105,16 @@ class NestedLoopJoinProbe : public Operator {
 
   void close() override;
 
+  /// Runtime stat with the number of build vectors skipped for a probe row by
+  /// the band join optimization.
+  static inline const std::string kNumBandSkippedBuildVectors{
+      "numBandSkippedBuildVectors"};
+
+  /// Runtime stat with the number of build rows that passed the spatial index
+  /// and were evaluated against the join condition.
+  static inline const std::string kNumSpatialCandidateRows{
+      "numSpatialCandidateRows"};
+
  private:
   // TODO: maybe consolidate initializeFilter routine across operators like
   // HashProbe and MergeJoin.
@@ -107,6 +129,19 @@ class NestedLoopJoinProbe : public Operator {
   // `buildVectors_` before it can produce output.
   bool getBuildData(ContinueFuture* future);
 
+  // Computes the min and max band keys of each build vector into
+  // `buildBandRanges_`.
+  void initializeBandRanges();
+
+  // Returns true if no row of the current build vector can satisfy the band
+  // conditions for the current probe row.
+  bool skipBuildVectorByBand() const;
+
+  // Sets `spatialCandidateRows_` to the rows of the current build vector whose
+  // envelopes intersect the envelope of the current probe row. Queries the
+  // spatial index once per probe row.
+  void findSpatialCandidateRows();
+
   // Generates output from join matches between probe and build sides, as well
   // as probe mismatches (for left and full outer joins). As much as possible,
   // generates outputs `outputBatchSize_` records at a time, but batches may be
@@ -190,6 +225,15 @@ class NestedLoopJoinProbe : public Operator {
       const std::vector<IdentityProjection>& probeProjections,
       const std::vector<IdentityProjection>& buildProjections);
 
+  // Processes the current probe row against the `spatialCandidateRows_` of
+  // the build vector (probe row as constant, and build rows wrapped in a
+  // dictionary).
+  RowVectorPtr genCrossProductSpatialCandidates(
+      const RowVectorPtr& buildVector,
+      const RowTypePtr& outputType,
+      const std::vector<IdentityProjection>& probeProjections,
+      const std::vector<IdentityProjection>& buildProjections);
+
   // Add a single record to `output_` based on buildRow from buildVector, and
   // the current probeRow and probe vector (input_). Probe side projections are
   // zero-copy (dictionary indices), and build side projections are marked to be
@@ -230,6 +274,17 @@ class NestedLoopJoinProbe : public Operator {
         noMoreInput_;
   }
 
+  // Whether the join condition is only evaluated on the build rows found in
+  // the spatial index.
+  bool useSpatialIndex() const {
+    return spatialIndex_ != nullptr;
+  }
+
+  // Returns the build row of row 'i' of the join condition result.
+  vector_size_t filterBuildRow(vector_size_t i) const {
+    return useSpatialIndex() ? spatialCandidateRows_[i] : i;
+  }
+
   // Whether we have processed all build data for the current probe row (based
   // on buildIndex_'s value).
   bool hasProbedAllBuildData() const {
@@ -380,6 +435,54 @@ class NestedLoopJoinProbe : public Operator {
   std::vector<IdentityProjection> filterBuildProjections_;
 
   BufferPtr buildOutMapping_;
+
+  // Band conditions of the join condition. Empty unless the band join
+  // optimization is enabled.
+  std::vector<NestedLoopJoinBandCondition> bandConditions_;
+
+  // Decoded probe columns of `bandConditions_` for `input_`.
+  std::vector<DecodedVector> probeBandColumns_;
+
+  // For each build vector, the min and max keys of the build column of each
+  // band condition. std::nullopt if all values of the column are null.
+  std::vector<std::vector<std::optional<std::pair<int64_t, int64_t>>>>
+      buildBandRanges_;
+
+  // Number of build vectors skipped by skipBuildVectorByBand().
+  uint64_t numBandSkippedBuildVectors_{0};
+
+  // Spatial predicate of the join condition. Set only if the spatial index
+  // is enabled.
+  std::optional<NestedLoopJoinSpatialCondition> spatialCondition_;
+
+  // Index over the envelopes of the build rows. Null unless the build side
+  // has built one for `spatialCondition_`.
+  std::shared_ptr<const SpatialIndex> spatialIndex_;
+
+  // Computes `probeEnvelopes_` for `input_`.
+  std::unique_ptr<SpatialEnvelopeEvaluator> probeEnvelopeEvaluator_;
+  std::vector<Envelope> probeEnvelopes_;
+
+  // Row number across all build vectors of the first row of each build
+  // vector, followed by the total number of build rows. The ids in
+  // `spatialIndex_` are such row numbers.
+  std::vector<int64_t> buildVectorOffsets_;
+
+  // Ids of the build rows whose envelopes intersect the envelope of probe row
+  // `spatialCandidatesProbeRow_` of `input_`, in increasing order.
+  std::vector<int32_t> spatialCandidates_;
+  vector_size_t spatialCandidatesProbeRow_{-1};
+
+  // Rows of the current build vector among `spatialCandidates_`.
+  std::vector<vector_size_t> spatialCandidateRows_;
+
+  // Dictionary indices over `spatialCandidateRows_` for the build columns of
+  // the join condition input.
+  BufferPtr spatialBuildIndices_;
+
+  // Number of build rows evaluated against the join condition after the
+  // spatial index lookup.
+  uint64_t numSpatialCandidateRows_{0};
 };
 
 } // namespace facebook::velox::exec
@@ -20,6 +20,7 @@
 #include "velox/common/testutil/TestValue.h"
 #include "velox/exec/Driver.h"
 #include "velox/exec/OperatorUtils.h"
+#include "velox/exec/ReservationHistory.h"
 #include "velox/exec/TraceUtil.h"
 #include "velox/expression/Expr.h"
 
@@ -342,6 +343,7 @@ void Operator::close() {
   input_ = nullptr;
   results_.clear();
   recordSpillStats();
+  recordReservationHistory();
   finishTrace();
 
   // Release the unused memory reservation on close.
@@ -389,6 +391,66 @@ void Operator::recordBlockingTime(uint64_t start, BlockingReason reason) {
       fmt::format("blocked{}Times", blockReason), RuntimeCounter(1));
 }
 
+void Operator::setupReservationHistory(const core::PlanNode& source) {
+  if (!operatorCtx_->driverCtx()
+           ->queryConfig()
+           .operatorReservationHistoryEnabled()) {
+    return;
+  }
+  reservationHistoryKey_ =
+      fmt::format("{}\n{}", operatorType(), source.toString(true, true));
+}
+
+void Operator::maybeReservePredictedMemory() {
+  if (reservationHistoryKey_.empty() || reservationPredictionDone_) {
+    return;
+  }
+  reservationPredictionDone_ = true;
+  predictedReservationBytes_ =
+      ReservationHistory::instance().predict(reservationHistoryKey_);
+  if (!predictedReservationBytes_.has_value()) {
+    return;
+  }
+  setProjectedPeakMemoryBytes(predictedReservationBytes_.value());
+  const uint64_t usedBytes = pool()->usedBytes();
+  if (predictedReservationBytes_.value() <= usedBytes) {
+    return;
+  }
+  const auto incrementBytes = predictedReservationBytes_.value() - usedBytes;
+  ReclaimableSectionGuard guard(this);
+  if (!pool()->maybeReserve(incrementBytes)) {
+    LOG(WARNING) << "Failed to reserve predicted "
+                 << succinctBytes(incrementBytes) << " for memory pool "
+                 << pool()->name();
+  }
+}
+
+void Operator::recordReservationHistory() {
+  if (reservationHistoryKey_.empty() || !reservationPredictionDone_) {
+    return;
+  }
+  const uint64_t peakBytes = pool()->peakBytes();
+  ReservationHistory::instance().record(
+      reservationHistoryKey_,
+      peakBytes,
+      spillStats_->rlock()->spilledBytes > 0);
+  if (predictedReservationBytes_.has_value()) {
+    const auto predictedBytes = predictedReservationBytes_.value();
+    auto lockedStats = stats_.wlock();
+    lockedStats->addRuntimeStat(
+        kPredictedReservationBytes,
+        RuntimeCounter(predictedBytes, RuntimeCounter::Unit::kBytes));
+    lockedStats->addRuntimeStat(
+        kReservationPredictionErrorBytes,
+        RuntimeCounter(
+            predictedBytes > peakBytes ? predictedBytes - peakBytes
+                                       : peakBytes - predictedBytes,
+            RuntimeCounter::Unit::kBytes));
+  }
+  // close() may be called more than once.
+  reservationHistoryKey_.clear();
+}
+
 void Operator::recordSpillStats() {
   const auto lockedSpillStats = spillStats_->wlock();
   auto lockedStats = stats_.wlock();
@@ -418,6 +480,14 @@ void Operator::recordSpillStats() {
             static_cast<int64_t>(lockedSpillStats->spillExtractVectorTimeNanos),
             RuntimeCounter::Unit::kNanos});
   }
+  if (lockedSpillStats->spillExtractAccumulatorTimeNanos != 0) {
+    lockedStats->addRuntimeStat(
+        kSpillExtractAccumulatorTime,
+        RuntimeCounter{
+            static_cast<int64_t>(
+                lockedSpillStats->spillExtractAccumulatorTimeNanos),
+            RuntimeCounter::Unit::kNanos});
+  }
   if (lockedSpillStats->spillSerializationTimeNanos != 0) {
     lockedStats->addRuntimeStat(
         kSpillSerializationTime,
@@ -482,6 +552,15 @@ void Operator::recordSpillStats() {
             RuntimeCounter::Unit::kNanos});
   }
 
+  if (lockedSpillStats->spillReadAheadWaitTimeNanos != 0) {
+    lockedStats->addRuntimeStat(
+        kSpillReadAheadWaitTime,
+        RuntimeCounter{
+            static_cast<int64_t>(
+                lockedSpillStats->spillReadAheadWaitTimeNanos),
+            RuntimeCounter::Unit::kNanos});
+  }
+
   if (lockedSpillStats->spillDeserializationTimeNanos != 0) {
     lockedStats->addRuntimeStat(
         kSpillDeserializationTime,
@@ -592,6 +671,10 @@ void OperatorStats::add(const OperatorStats& other) {
     }
   }
 
+  for (const auto& [name, histogram] : other.latencyHistograms) {
+    latencyHistograms[name].merge(histogram);
+  }
+
   for (const auto& [name, exprStats] : other.expressionStats) {
     if (UNLIKELY(expressionStats.count(name) == 0)) {
       expressionStats.insert(std::make_pair(name, exprStats));
@@ -636,6 +719,7 @@ void OperatorStats::clear() {
   memoryStats.clear();
 
   runtimeStats.clear();
+  latencyHistograms.clear();
   expressionStats.clear();
 
   numDrivers = 0;
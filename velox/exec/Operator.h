@@ -164,6 +164,9 @@ class Operator : public BaseRuntimeStatWriter {
   static inline const std::string kSpillSortTime{"spillSortWallNanos"};
   static inline const std::string kSpillExtractVectorTime{
       "spillExtractVectorWallNanos"};
+  /// The part of the extract vector time spent on aggregate accumulators.
+  static inline const std::string kSpillExtractAccumulatorTime{
+      "spillExtractAccumulatorWallNanos"};
   static inline const std::string kSpillSerializationTime{
       "spillSerializationWallNanos"};
   static inline const std::string kSpillFlushTime{"spillFlushWallNanos"};
@@ -176,6 +179,9 @@ class Operator : public BaseRuntimeStatWriter {
   static inline const std::string kSpillReadBytes{"spillReadBytes"};
   static inline const std::string kSpillReads{"spillReads"};
   static inline const std::string kSpillReadTime{"spillReadWallNanos"};
+  /// The time spent waiting for prefetched spill reads to complete.
+  static inline const std::string kSpillReadAheadWaitTime{
+      "spillReadAheadWaitNanos"};
   static inline const std::string kSpillDeserializationTime{
       "spillDeserializationWallNanos"};
 
@@ -188,6 +194,13 @@ class Operator : public BaseRuntimeStatWriter {
   static inline const std::string kShuffleCompressionKind{
       "shuffleCompressionKind"};
 
+  /// The memory reserved up front from the ReservationHistory prediction and
+  /// the difference between the prediction and the actual peak usage.
+  static inline const std::string kPredictedReservationBytes{
+      "predictedReservationBytes"};
+  static inline const std::string kReservationPredictionErrorBytes{
+      "reservationPredictionErrorBytes"};
+
   /// 'operatorId' is the initial index of the 'this' in the Driver's list of
   /// Operators. This is used as in index into OperatorStats arrays in the Task.
   /// 'planNodeId' is a query-level unique identifier of the PlanNode to which
@@ -346,6 +359,12 @@ class Operator : public BaseRuntimeStatWriter {
     stats_.wlock()->addRuntimeStat(name, value);
   }
 
+  /// Records a latency in the operator stats under the write lock. This member
+  /// overrides BaseRuntimeStatWriter's member.
+  void addLatency(const std::string& name, uint64_t nanos) override {
+    stats_.wlock()->latencyHistograms[name].record(nanos);
+  }
+
   /// Returns reference to the operator stats synchronized object to gain bulk
   /// read/write access to the stats.
   folly::Synchronized<OperatorStats>& stats() {
@@ -367,6 +386,16 @@ class Operator : public BaseRuntimeStatWriter {
     return operatorCtx_->pool();
   }
 
+  /// Returns the memory in bytes this operator is expected to peak at. This is
+  /// at least the peak usage of pool() so far. Operators whose memory grows
+  /// with their input publish a forecast with setProjectedPeakMemoryBytes().
+  /// Used by Task::memoryForecast(). Can be called from any thread.
+  uint64_t projectedPeakMemoryBytes() const {
+    return std::max<uint64_t>(
+        projectedPeakMemoryBytes_.load(std::memory_order_relaxed),
+        pool()->peakBytes());
+  }
+
   /// Returns true if the operator is reclaimable. Currently, we only support
   /// to reclaim memory from a spillable operator.
   FOLLY_ALWAYS_INLINE virtual bool canReclaim() const {
@@ -617,6 +646,31 @@ class Operator : public BaseRuntimeStatWriter {
   /// Invoked to record spill stats in operator stats.
   virtual void recordSpillStats();
 
+  /// Invoked on close to record the peak memory usage in ReservationHistory
+  /// and the prediction stats.
+  void recordReservationHistory();
+
+  /// Records the peak memory usage of 'this' in ReservationHistory under the
+  /// operator type and 'source' on close if the
+  /// 'operator_reservation_history_enabled' query config is set. 'source' is
+  /// the plan fragment whose output determines the memory usage. Invoked from
+  /// the constructor of a spillable operator.
+  void setupReservationHistory(const core::PlanNode& source);
+
+  /// Reserves the memory predicted by ReservationHistory for this operator.
+  /// Only the first call reserves and only if setupReservationHistory() found
+  /// a recorded run. Invoked before the first input is added.
+  ///
+  /// NOTE: Caller must make sure operator is in a reclaimable state when making
+  /// this call.
+  void maybeReservePredictedMemory();
+
+  /// Publishes the expected peak memory of this operator. See
+  /// projectedPeakMemoryBytes().
+  void setProjectedPeakMemoryBytes(uint64_t bytes) {
+    projectedPeakMemoryBytes_.store(bytes, std::memory_order_relaxed);
+  }
+
   const std::unique_ptr<OperatorCtx> operatorCtx_;
   const RowTypePtr outputType_;
   /// Contains the disk spilling related configs if spilling is enabled (e.g.
@@ -647,6 +701,16 @@ class Operator : public BaseRuntimeStatWriter {
   /// input is processed.
   RowVectorPtr input_;
 
+  /// The ReservationHistory key of this operator. Empty if the history is not
+  /// used.
+  std::string reservationHistoryKey_;
+  /// The memory reserved by maybeReservePredictedMemory(), if any.
+  std::optional<uint64_t> predictedReservationBytes_;
+  bool reservationPredictionDone_{false};
+
+  /// Set with setProjectedPeakMemoryBytes(). Read from other threads.
+  std::atomic<uint64_t> projectedPeakMemoryBytes_{0};
+
   bool noMoreInput_ = false;
   std::vector<IdentityProjection> identityProjections_;
   std::vector<VectorPtr> results_;
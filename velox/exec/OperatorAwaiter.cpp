@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/OperatorAwaiter.h"
+
+namespace facebook::velox::exec {
+
+void OperatorAwaiter::await(
+    BlockingReason reason,
+    ContinueFuture future,
+    Continuation continuation) {
+  VELOX_CHECK(!isSuspended(), "Operator is already suspended");
+  VELOX_CHECK_NE(reason, BlockingReason::kNotBlocked);
+  VELOX_CHECK(future.valid());
+  reason_ = reason;
+  future_ = std::move(future);
+  continuation_ = std::move(continuation);
+}
+
+void OperatorAwaiter::await(
+    BlockingReason reason,
+    std::vector<ContinueFuture> futures,
+    Continuation continuation) {
+  if (futures.empty()) {
+    VELOX_CHECK(!isSuspended(), "Operator is already suspended");
+    continuation_ = std::move(continuation);
+    return;
+  }
+  if (futures.size() == 1) {
+    await(reason, std::move(futures[0]), std::move(continuation));
+    return;
+  }
+  await(
+      reason,
+      folly::collectAll(futures.begin(), futures.end()).unit(),
+      std::move(continuation));
+}
+
+BlockingReason OperatorAwaiter::isBlocked(ContinueFuture* future) {
+  if (!isSuspended()) {
+    return BlockingReason::kNotBlocked;
+  }
+  *future = std::move(future_);
+  const auto reason = reason_;
+  reason_ = BlockingReason::kNotBlocked;
+  return reason;
+}
+
+bool OperatorAwaiter::resume() {
+  if (isSuspended() || continuation_ == nullptr) {
+    return false;
+  }
+  // Moves the continuation out first so that it can await again.
+  auto continuation = std::move(continuation_);
+  continuation_ = nullptr;
+  continuation();
+  return true;
+}
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/exec/Driver.h"
+
+namespace facebook::velox::exec {
+
+/// Lets an operator suspend at a point of its processing until asynchronous
+/// work completes and continue from that point after the wake-up, instead of
+/// re-checking its state from the top of getOutput() or addInput(). The
+/// waits integrate with the regular blocking protocol: the operator forwards
+/// isBlocked() to the awaiter, which hands the pending future to the Driver,
+/// and the Driver resumes the operator through BlockingState once the future
+/// completes.
+///
+/// Usage:
+///
+///   RowVectorPtr MyOperator::getOutput() {
+///     if (awaiter_.resume()) {
+///       return std::move(result_);
+///     }
+///     ...
+///     awaiter_.await(
+///         BlockingReason::kWaitForConnector,
+///         std::move(ioFutures),
+///         [this]() { result_ = makeResult(); });
+///     return nullptr;
+///   }
+///
+///   BlockingReason MyOperator::isBlocked(ContinueFuture* future) {
+///     return awaiter_.isBlocked(future);
+///   }
+///
+/// Several requests can be kept in flight by awaiting all of them at once.
+/// The awaiter is not thread safe and is used from the driver thread only.
+class OperatorAwaiter {
+ public:
+  using Continuation = std::function<void()>;
+
+  /// Suspends the operator until 'future' completes for 'reason'. The
+  /// optional 'continuation' runs at the next resume() after the wake-up.
+  void await(
+      BlockingReason reason,
+      ContinueFuture future,
+      Continuation continuation = nullptr);
+
+  /// Suspends the operator until all 'futures' complete. Does not suspend if
+  /// 'futures' is empty, in which case 'continuation' runs at the next
+  /// resume().
+  void await(
+      BlockingReason reason,
+      std::vector<ContinueFuture> futures,
+      Continuation continuation = nullptr);
+
+  /// To be called from Operator::isBlocked(). Returns the reason of the
+  /// pending wait and moves its future to 'future', or kNotBlocked if there
+  /// is no pending wait.
+  BlockingReason isBlocked(ContinueFuture* future);
+
+  /// Runs the continuation of the last wait after the operator is woken up.
+  /// Returns true if a continuation ran. The continuation may await again.
+  bool resume();
+
+  /// Returns true if the operator waits for a future not yet handed to the
+  /// Driver.
+  bool isSuspended() const {
+    return reason_ != BlockingReason::kNotBlocked;
+  }
+
+ private:
+  BlockingReason reason_{BlockingReason::kNotBlocked};
+  ContinueFuture future_{ContinueFuture::makeEmpty()};
+  Continuation continuation_;
+};
+
+} // namespace facebook::velox::exec
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "velox/common/base/LatencyHistogram.h"
 #include "velox/common/memory/MemoryPool.h"
 #include "velox/common/time/CpuWallTimer.h"
 #include "velox/expression/ExprStats.h"
@@ -182,6 +183,10 @@ struct OperatorStats {
 
   std::unordered_map<std::string, RuntimeMetric> runtimeStats;
 
+  // Latency histograms in nanoseconds by name, e.g. of storage reads or
+  // exchange fetches.
+  std::unordered_map<std::string, LatencyHistogram> latencyHistograms;
+
   // A map of expression name to its respective stats.
   // These are only populated when a copy of the stats is returned via
   // Operator::stats(bool) API.
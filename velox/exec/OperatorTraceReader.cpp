@@ -89,6 +89,15 @@ OperatorTraceSummary OperatorTraceSummaryReader::read() const {
       summaryObj[OperatorTraceTraits::kRawInputRowsKey].asInt();
   summary.rawInputBytes =
       summaryObj[OperatorTraceTraits::kRawInputBytesKey].asInt();
+  // The timing keys are absent from the traces written by older builds.
+  if (summaryObj.count(OperatorTraceTraits::kCpuTimeNanosKey) != 0) {
+    summary.cpuTimeNanos =
+        summaryObj[OperatorTraceTraits::kCpuTimeNanosKey].asInt();
+  }
+  if (summaryObj.count(OperatorTraceTraits::kWallTimeNanosKey) != 0) {
+    summary.wallTimeNanos =
+        summaryObj[OperatorTraceTraits::kWallTimeNanosKey].asInt();
+  }
   return summary;
 }
 
@@ -40,6 +40,13 @@ void recordOperatorSummary(Operator* op, folly::dynamic& obj) {
   obj[OperatorTraceTraits::kInputBytesKey] = stats.inputBytes;
   obj[OperatorTraceTraits::kRawInputRowsKey] = stats.rawInputPositions;
   obj[OperatorTraceTraits::kRawInputBytesKey] = stats.rawInputBytes;
+  CpuWallTiming timing;
+  timing.add(stats.addInputTiming);
+  timing.add(stats.getOutputTiming);
+  timing.add(stats.finishTiming);
+  timing.add(stats.isBlockedTiming);
+  obj[OperatorTraceTraits::kCpuTimeNanosKey] = timing.cpuNanos;
+  obj[OperatorTraceTraits::kWallTimeNanosKey] = timing.wallNanos;
 }
 } // namespace
 
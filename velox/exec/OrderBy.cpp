@@ -67,12 +67,22 @@ OrderBy::OrderBy(
       &nonReclaimableSection_,
       driverCtx->prefixSortConfig(),
       spillConfig_.has_value() ? &(spillConfig_.value()) : nullptr,
-      spillStats_.get());
+      spillStats_.get(),
+      operatorCtx_->task()->queryCtx()->executor(),
+      driverCtx->queryConfig().orderByParallelSortThreads());
+  if (canSpill()) {
+    setupReservationHistory(*orderByNode);
+  }
 }
 
 void OrderBy::addInput(RowVectorPtr input) {
   loadLazyReclaimable(input);
+  maybeReservePredictedMemory();
   sortBuffer_->addInput(input);
+  // The sort on noMoreInput() allocates a pointer for each row.
+  setProjectedPeakMemoryBytes(std::max<uint64_t>(
+      predictedReservationBytes_.value_or(0),
+      pool()->usedBytes() + sortBuffer_->numInputRows() * sizeof(char*)));
 }
 
 void OrderBy::reclaim(
@@ -92,15 +92,18 @@ void DestinationBuffer::Stats::recordEnqueue(const SerializedPage& data) {
 void DestinationBuffer::Stats::recordAcknowledge(const SerializedPage& data) {
   const auto numRows = data.numRows();
   VELOX_CHECK(numRows.has_value(), "SerializedPage's numRows must be valid");
-  const int64_t size = data.size();
-  bytesBuffered -= size;
+  recordAcknowledge(data.size(), numRows.value());
+}
+
+void DestinationBuffer::Stats::recordAcknowledge(int64_t bytes, int64_t rows) {
+  bytesBuffered -= bytes;
   VELOX_DCHECK_GE(bytesBuffered, 0, "bytesBuffered must be non-negative");
-  rowsBuffered -= numRows.value();
+  rowsBuffered -= rows;
   VELOX_DCHECK_GE(rowsBuffered, 0, "rowsBuffered must be non-negative");
   --pagesBuffered;
   VELOX_DCHECK_GE(pagesBuffered, 0, "pagesBuffered must be non-negative");
-  bytesSent += size;
-  rowsSent += numRows.value();
+  bytesSent += bytes;
+  rowsSent += rows;
   ++pagesSent;
 }
 
@@ -120,8 +123,9 @@ DestinationBuffer::Data DestinationBuffer::getData(
     loadData(arbitraryBuffer, maxBytes);
   }
 
-  if (sequence - sequence_ >= data_.size()) {
-    if (sequence - sequence_ > data_.size()) {
+  const auto numPages = this->numPages();
+  if (sequence - sequence_ >= numPages) {
+    if (sequence - sequence_ > numPages) {
       VLOG(1) << this << " Out of order get: " << sequence << " over "
               << sequence_ << " Setting second notify " << notifySequence_
               << " / " << sequence;
@@ -137,7 +141,7 @@ DestinationBuffer::Data DestinationBuffer::getData(
     }
     notify_ = std::move(notify);
     aliveCheck_ = std::move(activeCheck);
-    if (sequence - sequence_ > data_.size()) {
+    if (sequence - sequence_ > numPages) {
       notifySequence_ = std::min(notifySequence_, sequence);
     } else {
       notifySequence_ = sequence;
@@ -150,31 +154,34 @@ DestinationBuffer::Data DestinationBuffer::getData(
   uint64_t resultBytes = 0;
   auto i = sequence - sequence_;
   if (maxBytes > 0) {
-    for (; i < data_.size(); ++i) {
+    for (; i < numPages; ++i) {
+      const auto page = pageAt(i);
       // nullptr is used as end marker
-      if (data_[i] == nullptr) {
-        VELOX_CHECK_EQ(i, data_.size() - 1, "null marker found in the middle");
+      if (page == nullptr) {
+        VELOX_CHECK_EQ(i, numPages - 1, "null marker found in the middle");
         data.push_back(nullptr);
         break;
       }
-      data.push_back(data_[i]->getIOBuf());
-      resultBytes += data_[i]->size();
+      data.push_back(page->getIOBuf());
+      resultBytes += page->size();
       if (resultBytes >= maxBytes) {
         ++i;
         break;
       }
     }
   }
+  fetchedSequence_ = std::max(fetchedSequence_, sequence_ + i);
   bool atEnd = false;
   std::vector<int64_t> remainingBytes;
-  remainingBytes.reserve(data_.size() - i);
-  for (; i < data_.size(); ++i) {
-    if (data_[i] == nullptr) {
-      VELOX_CHECK_EQ(i, data_.size() - 1, "null marker found in the middle");
+  remainingBytes.reserve(numPages - i);
+  for (; i < numPages; ++i) {
+    const auto pageSize = pageSizeAt(i);
+    if (pageSize < 0) {
+      VELOX_CHECK_EQ(i, numPages - 1, "null marker found in the middle");
       atEnd = true;
       break;
     }
-    remainingBytes.push_back(data_[i]->size());
+    remainingBytes.push_back(pageSize);
   }
   if (!atEnd && arbitraryBuffer) {
     arbitraryBuffer->getAvailablePageSizes(remainingBytes);
@@ -185,16 +192,47 @@ DestinationBuffer::Data DestinationBuffer::getData(
   return {std::move(data), std::move(remainingBytes), true};
 }
 
+std::shared_ptr<SerializedPage> DestinationBuffer::pageAt(int64_t index) {
+  if (index < data_.size()) {
+    return data_[index];
+  }
+  index -= data_.size();
+  if (index < spilledPages_.size()) {
+    for (auto& reader : spillReaders_) {
+      if (index < reader->numPages()) {
+        return reader->at(index);
+      }
+      index -= reader->numPages();
+    }
+    VELOX_UNREACHABLE();
+  }
+  return dataAfterSpill_[index - spilledPages_.size()];
+}
+
+int64_t DestinationBuffer::pageSizeAt(int64_t index) const {
+  const SerializedPage* page;
+  if (index < data_.size()) {
+    page = data_[index].get();
+  } else if (index - data_.size() < spilledPages_.size()) {
+    return spilledPages_[index - data_.size()].first;
+  } else {
+    page = dataAfterSpill_[index - data_.size() - spilledPages_.size()].get();
+  }
+  return page == nullptr ? -1 : page->size();
+}
+
 void DestinationBuffer::enqueue(std::shared_ptr<SerializedPage> data) {
+  // New pages go after the spilled ones.
+  auto& pages = spilledPages_.empty() ? data_ : dataAfterSpill_;
   // Drop duplicate end markers.
-  if (data == nullptr && !data_.empty() && data_.back() == nullptr) {
+  if (data == nullptr && !pages.empty() && pages.back() == nullptr) {
     return;
   }
 
   if (data != nullptr) {
     stats_.recordEnqueue(*data);
   }
-  data_.push_back(std::move(data));
+  pages.push_back(std::move(data));
 }
 
 DataAvailable DestinationBuffer::getAndClearNotify() {
@@ -221,7 +259,9 @@ void DestinationBuffer::clearNotify() {
 
 void DestinationBuffer::finish() {
   VELOX_CHECK_NULL(notify_, "notify must be cleared before finish");
-  VELOX_CHECK(data_.empty(), "data must be fetched before finish");
+  VELOX_CHECK(
+      data_.empty() && spilledPages_.empty() && dataAfterSpill_.empty(),
+      "data must be fetched before finish");
   stats_.finished = true;
 }
 
@@ -267,44 +307,143 @@ std::vector<std::shared_ptr<SerializedPage>> DestinationBuffer::acknowledge(
   }
 
   VELOX_CHECK_LE(
-      numDeleted, data_.size(), "Ack received for a not yet produced item");
+      numDeleted, numPages(), "Ack received for a not yet produced item");
   std::vector<std::shared_ptr<SerializedPage>> freed;
-  for (auto i = 0; i < numDeleted; ++i) {
-    if (data_[i] == nullptr) {
-      VELOX_CHECK_EQ(i, data_.size() - 1, "null marker found in the middle");
-      break;
-    }
-    stats_.recordAcknowledge(*data_[i]);
-    freed.push_back(std::move(data_[i]));
-  }
-  data_.erase(data_.begin(), data_.begin() + numDeleted);
+  deleteFront(numDeleted, freed);
   sequence_ += numDeleted;
   return freed;
 }
 
+void DestinationBuffer::deleteFront(
+    int64_t numPages,
+    std::vector<std::shared_ptr<SerializedPage>>& freed) {
+  auto deleteInMemory = [&]() {
+    const int64_t numDeleted = std::min<int64_t>(numPages, data_.size());
+    for (auto i = 0; i < numDeleted; ++i) {
+      if (data_[i] == nullptr) {
+        VELOX_CHECK_EQ(i, data_.size() - 1, "null marker found in the middle");
+        break;
+      }
+      stats_.recordAcknowledge(*data_[i]);
+      freed.push_back(std::move(data_[i]));
+    }
+    data_.erase(data_.begin(), data_.begin() + numDeleted);
+    numPages -= numDeleted;
+  };
+
+  deleteInMemory();
+  while (numPages > 0 && !spillReaders_.empty()) {
+    auto& reader = spillReaders_.front();
+    const int64_t numDeleted =
+        std::min<int64_t>(numPages, reader->numPages());
+    reader->deleteFront(numDeleted);
+    for (auto i = 0; i < numDeleted; ++i) {
+      const auto [bytes, rows] = spilledPages_.front();
+      stats_.recordAcknowledge(bytes, rows);
+      spilledPages_.pop_front();
+    }
+    if (reader->empty()) {
+      spillReaders_.pop_front();
+    }
+    numPages -= numDeleted;
+  }
+  if (spilledPages_.empty() && !dataAfterSpill_.empty()) {
+    VELOX_CHECK(data_.empty());
+    data_.swap(dataAfterSpill_);
+    deleteInMemory();
+  }
+  VELOX_CHECK_EQ(numPages, 0);
+}
+
 std::vector<std::shared_ptr<SerializedPage>>
 DestinationBuffer::deleteResults() {
   std::vector<std::shared_ptr<SerializedPage>> freed;
-  for (auto i = 0; i < data_.size(); ++i) {
-    if (data_[i] == nullptr) {
-      VELOX_CHECK_EQ(i, data_.size() - 1, "null marker found in the middle");
-      break;
+  for (auto* pages : {&data_, &dataAfterSpill_}) {
+    for (auto i = 0; i < pages->size(); ++i) {
+      auto& page = (*pages)[i];
+      if (page == nullptr) {
+        VELOX_CHECK_EQ(
+            i, pages->size() - 1, "null marker found in the middle");
+        break;
+      }
+      stats_.recordDelete(*page);
+      freed.push_back(std::move(page));
     }
-    stats_.recordDelete(*data_[i]);
-    freed.push_back(std::move(data_[i]));
+    pages->clear();
+  }
+  for (const auto& [bytes, rows] : spilledPages_) {
+    stats_.recordAcknowledge(bytes, rows);
+  }
+  spilledPages_.clear();
+  for (auto& reader : spillReaders_) {
+    reader->deleteAll();
   }
-  data_.clear();
+  spillReaders_.clear();
   return freed;
 }
 
+int64_t DestinationBuffer::spillableBytes() const {
+  const auto& pages = spilledPages_.empty() ? data_ : dataAfterSpill_;
+  const int64_t pagesSequence = sequence_ +
+      (spilledPages_.empty() ? 0 : data_.size() + spilledPages_.size());
+  const int64_t first = std::max<int64_t>(0, fetchedSequence_ - pagesSequence);
+  if ((!spilledPages_.empty() && first > 0) || first >= pages.size() ||
+      pages.back() == nullptr) {
+    return 0;
+  }
+  int64_t bytes{0};
+  for (auto i = first; i < pages.size(); ++i) {
+    bytes += pages[i]->size();
+  }
+  return bytes;
+}
+
+std::vector<std::shared_ptr<SerializedPage>> DestinationBuffer::spill(
+    OutputBufferSpillConfig& config,
+    const std::string& pathPrefix) {
+  if (spillableBytes() == 0) {
+    return {};
+  }
+  // The pages to spill are at the end of 'pages'.
+  auto& pages = spilledPages_.empty() ? data_ : dataAfterSpill_;
+  const int64_t first = spilledPages_.empty()
+      ? std::max<int64_t>(0, fetchedSequence_ - sequence_)
+      : 0;
+  std::vector<std::shared_ptr<SerializedPage>> spilled(
+      pages.begin() + first, pages.end());
+
+  SerializedPageSpiller spiller(
+      config.writeBufferSize,
+      config.maxFileSize,
+      pathPrefix,
+      config.fileCreateConfig,
+      config.updateAndCheckSpillLimitCb,
+      config.pool,
+      config.stats);
+  spiller.spill(spilled);
+  spillReaders_.push_back(std::make_unique<SerializedPageSpillReader>(
+      spiller.finishSpill(), config.readBufferSize, config.pool, config.stats));
+
+  // The remaining in-memory pages of 'pages' are before the spilled ones.
+  pages.resize(first);
+  for (const auto& page : spilled) {
+    spilledPages_.emplace_back(page->size(), page->numRows().value_or(0));
+    stats_.bytesSpilled += page->size();
+    ++stats_.pagesSpilled;
+  }
+  return spilled;
+}
+
 DestinationBuffer::Stats DestinationBuffer::stats() const {
   return stats_;
 }
 
 std::string DestinationBuffer::toString() {
   std::stringstream out;
-  out << "[available: " << data_.size() << ", " << "sequence: " << sequence_
-      << ", " << (notify_ ? "notify registered, " : "") << this << "]";
+  out << "[available: " << data_.size() + dataAfterSpill_.size() << ", "
+      << "spilled: " << spilledPages_.size() << ", "
+      << "sequence: " << sequence_ << ", "
+      << (notify_ ? "notify registered, " : "") << this << "]";
   return out.str();
 }
 
@@ -341,6 +480,25 @@ OutputBuffer::OutputBuffer(
     buffers_.push_back(std::make_unique<DestinationBuffer>());
   }
   finishedBufferStats_.resize(numDestinations);
+
+  const auto& queryConfig = task_->queryCtx()->queryConfig();
+  if (isPartitioned() && queryConfig.spillEnabled() &&
+      queryConfig.outputBufferSpillEnabled() &&
+      (!task_->spillDirectory().empty() ||
+       task_->hasCreateSpillDirectoryCb())) {
+    spillPool_ = task_->pool()->addLeafChild("outputBufferSpill");
+    spillConfig_ = std::make_unique<OutputBufferSpillConfig>();
+    spillConfig_->updateAndCheckSpillLimitCb =
+        [queryCtx = task_->queryCtx()](uint64_t bytes) {
+          queryCtx->updateSpilledBytesAndCheckLimit(bytes);
+        };
+    spillConfig_->writeBufferSize = queryConfig.spillWriteBufferSize();
+    spillConfig_->readBufferSize = queryConfig.spillReadBufferSize();
+    spillConfig_->maxFileSize = queryConfig.maxSpillFileSize();
+    spillConfig_->fileCreateConfig = queryConfig.spillFileCreateConfig();
+    spillConfig_->pool = spillPool_.get();
+    spillConfig_->stats = &spillStats_;
+  }
 }
 
 void OutputBuffer::updateOutputBuffers(int numBuffers, bool noMoreBuffers) {
@@ -473,6 +631,10 @@ bool OutputBuffer::enqueue(
         break;
     }
 
+    if (bufferedBytes_ >= maxSize_ && spillConfig_ != nullptr) {
+      spillLocked();
+    }
+
     if (bufferedBytes_ >= maxSize_ && future) {
       common::testutil::TestValue::adjust(
           "facebook::velox::exec::OutputBuffer::enqueue", this);
@@ -491,6 +653,39 @@ bool OutputBuffer::enqueue(
   return blocked;
 }
 
+void OutputBuffer::spillLocked() {
+  VELOX_CHECK(isPartitioned());
+  std::vector<std::pair<int64_t, int32_t>> candidates;
+  for (auto i = 0; i < buffers_.size(); ++i) {
+    if (buffers_[i] == nullptr) {
+      continue;
+    }
+    const auto bytes = buffers_[i]->spillableBytes();
+    if (bytes > 0) {
+      candidates.emplace_back(bytes, i);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end(), std::greater<>());
+
+  for (const auto& [bytes, destination] : candidates) {
+    if (bufferedBytes_ < continueSize_) {
+      break;
+    }
+    const auto pathPrefix = fmt::format(
+        "{}/outputBuffer-{}-{}",
+        task_->getOrCreateSpillDirectory(),
+        destination,
+        numSpills_++);
+    const auto spilled =
+        buffers_[destination]->spill(*spillConfig_, pathPrefix);
+    int64_t spilledBytes{0};
+    for (const auto& page : spilled) {
+      spilledBytes += page->size();
+    }
+    updateStatsWithFreedPagesLocked(spilled.size(), spilledBytes);
+  }
+}
+
 void OutputBuffer::enqueueBroadcastOutputLocked(
     std::unique_ptr<SerializedPage> data,
     std::vector<DataAvailable>& dataAvailableCbs) {
@@ -846,7 +1041,7 @@ OutputBuffer::Stats OutputBuffer::stats() {
 
   updateTotalBufferedBytesMsLocked();
 
-  return OutputBuffer::Stats(
+  OutputBuffer::Stats result(
       kind_,
       noMoreBuffers_,
       atEnd_,
@@ -859,6 +1054,8 @@ OutputBuffer::Stats OutputBuffer::stats() {
       getAverageBufferTimeMsLocked(),
       countTopBuffers(bufferStats, numOutputBytes_),
       bufferStats);
+  result.spillStats = spillStats_.copy();
+  return result;
 }
 
 } // namespace facebook::velox::exec
@@ -17,6 +17,7 @@
 
 #include "velox/core/PlanNode.h"
 #include "velox/exec/ExchangeQueue.h"
+#include "velox/exec/SerializedPageSpiller.h"
 
 namespace facebook::velox::exec {
 
@@ -90,6 +91,18 @@ class ArbitraryBuffer {
   std::deque<std::shared_ptr<SerializedPage>> pages_;
 };
 
+/// Settings for spilling the pages of destination buffers.
+struct OutputBufferSpillConfig {
+  common::UpdateAndCheckSpillLimitCB updateAndCheckSpillLimitCb;
+  uint64_t writeBufferSize{0};
+  uint64_t readBufferSize{0};
+  uint64_t maxFileSize{0};
+  std::string fileCreateConfig;
+  /// The pool for the write buffers and the pages read back.
+  memory::MemoryPool* pool{nullptr};
+  folly::Synchronized<common::SpillStats>* stats{nullptr};
+};
+
 class DestinationBuffer {
  public:
   /// The data transferred by the destination buffer has two phases:
@@ -102,6 +115,9 @@ class DestinationBuffer {
 
     void recordAcknowledge(const SerializedPage& data);
 
+    /// Records the acknowledge of a spilled page of 'bytes' and 'rows'.
+    void recordAcknowledge(int64_t bytes, int64_t rows);
+
     void recordDelete(const SerializedPage& data);
 
     bool finished{false};
@@ -115,6 +131,10 @@ class DestinationBuffer {
     int64_t bytesSent{0};
     int64_t rowsSent{0};
     int64_t pagesSent{0};
+
+    /// Number of bytes / pages spilled to disk.
+    int64_t bytesSpilled{0};
+    int64_t pagesSpilled{0};
   };
 
   void enqueue(std::shared_ptr<SerializedPage> data);
@@ -172,6 +192,18 @@ class DestinationBuffer {
   /// Removes all remaining data from the queue and returns the removed data.
   std::vector<std::shared_ptr<SerializedPage>> deleteResults();
 
+  /// Returns the bytes of the in-memory pages that spill() would spill.
+  int64_t spillableBytes() const;
+
+  /// Spills the pages that have not been returned by getData() to files
+  /// starting with 'pathPrefix'. The pages are read back when they are fetched.
+  /// Returns the spilled pages. The spilled pages of 'this' are always
+  /// followed by in-memory pages, so pages after a fetched page that follows
+  /// spilled pages are not spilled.
+  std::vector<std::shared_ptr<SerializedPage>> spill(
+      OutputBufferSpillConfig& config,
+      const std::string& pathPrefix);
+
   /// Returns and clears the notify callback, if any, along with arguments for
   /// the callback.
   DataAvailable getAndClearNotify();
@@ -187,7 +219,35 @@ class DestinationBuffer {
  private:
   void clearNotify();
 
+  // Returns the number of pages from 'sequence_' on.
+  int64_t numPages() const {
+    return data_.size() + spilledPages_.size() + dataAfterSpill_.size();
+  }
+
+  // Returns the page at 'index' from 'sequence_' on, reading it back if
+  // spilled.
+  std::shared_ptr<SerializedPage> pageAt(int64_t index);
+
+  // Returns the size of the page at 'index' from 'sequence_' on or -1 if it is
+  // the end marker.
+  int64_t pageSizeAt(int64_t index) const;
+
+  // Removes 'numPages' from the front. Adds the removed in-memory pages to
+  // 'freed'.
+  void deleteFront(
+      int64_t numPages,
+      std::vector<std::shared_ptr<SerializedPage>>& freed);
+
+  // The pages from 'sequence_' on are 'data_', followed by the pages of
+  // 'spillReaders_' and then 'dataAfterSpill_'. 'dataAfterSpill_' is empty if
+  // there are no spilled pages.
   std::vector<std::shared_ptr<SerializedPage>> data_;
+  std::deque<std::unique_ptr<SerializedPageSpillReader>> spillReaders_;
+  // The size and number of rows of each page of 'spillReaders_'.
+  std::deque<std::pair<int64_t, int64_t>> spilledPages_;
+  std::vector<std::shared_ptr<SerializedPage>> dataAfterSpill_;
+  // The sequence number of the first page not returned by getData() yet.
+  int64_t fetchedSequence_{0};
   // The sequence number of the first in 'data_'.
   int64_t sequence_ = 0;
   DataAvailableCallback notify_{nullptr};
@@ -254,6 +314,10 @@ class OutputBuffer {
     /// Stats of the OutputBuffer's destinations.
     std::vector<DestinationBuffer::Stats> buffersStats;
 
+    /// Stats of spilling the pages of slow consumers, including the time to
+    /// read the pages back.
+    common::SpillStats spillStats;
+
     std::string toString() const;
   };
 
@@ -335,6 +399,11 @@ class OutputBuffer {
 
   void updateTotalBufferedBytesMsLocked();
 
+  // Spills the pages the consumers have not fetched yet, starting with the
+  // destinations with the most of them, until the buffered size is below
+  // 'continueSize_'.
+  void spillLocked();
+
   int64_t getAverageBufferTimeMsLocked() const;
 
   // If this is called due to a driver processed all its data (no more data),
@@ -389,6 +458,16 @@ class OutputBuffer {
   const uint64_t continueSize_;
   const std::unique_ptr<ArbitraryBuffer> arbitraryBuffer_;
 
+  // Set if the pages the consumers have not fetched are spilled when the
+  // buffer is full instead of blocking the producers. Only used for
+  // partitioned output.
+  std::shared_ptr<memory::MemoryPool> spillPool_;
+  folly::Synchronized<common::SpillStats> spillStats_;
+  std::unique_ptr<OutputBufferSpillConfig> spillConfig_;
+  // Number of spill() calls on the destination buffers. Used to name the
+  // spill files.
+  uint32_t numSpills_{0};
+
   // Total number of drivers expected to produce results. This number will
   // decrease in the end of grouped execution, when we understand the real
   // number of producer drivers (depending on the number of split groups).
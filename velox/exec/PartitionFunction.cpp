@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <velox/exec/HashPartitionFunction.h>
+#include <velox/exec/RangePartitionFunction.h>
 #include <velox/exec/RoundRobinPartitionFunction.h>
 #include "velox/core/PlanNode.h"
 
@@ -27,6 +28,8 @@ void registerPartitionFunctionSerDe() {
   registry.Register(
       "RoundRobinPartitionFunctionSpec",
       RoundRobinPartitionFunctionSpec::deserialize);
+  registry.Register(
+      "RangePartitionFunctionSpec", RangePartitionFunctionSpec::deserialize);
 }
 
 } // namespace facebook::velox::exec
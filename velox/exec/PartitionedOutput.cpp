@@ -23,10 +23,17 @@ namespace {
 std::unique_ptr<VectorSerde::Options> getVectorSerdeOptions(
     const core::QueryConfig& queryConfig,
     VectorSerde::Kind kind) {
-  std::unique_ptr<VectorSerde::Options> options =
-      kind == VectorSerde::Kind::kPresto
-      ? std::make_unique<serializer::presto::PrestoVectorSerde::PrestoOptions>()
-      : std::make_unique<VectorSerde::Options>();
+  std::unique_ptr<VectorSerde::Options> options;
+  if (kind == VectorSerde::Kind::kPresto) {
+    auto prestoOptions =
+        std::make_unique<serializer::presto::PrestoVectorSerde::PrestoOptions>();
+    prestoOptions->preserveConstants = queryConfig.shufflePreserveConstants();
+    prestoOptions->lightweightEncodings =
+        queryConfig.shuffleLightweightEncodings();
+    options = std::move(prestoOptions);
+  } else {
+    options = std::make_unique<VectorSerde::Options>();
+  }
   options->compressionKind =
       common::stringToCompressionKind(queryConfig.shuffleCompressionKind());
   options->minCompressionRatio = PartitionedOutput::minCompressionRatio();
@@ -42,7 +49,8 @@ Destination::Destination(
     VectorSerde::Options* serdeOptions,
     memory::MemoryPool* pool,
     bool eagerFlush,
-    std::function<void(uint64_t bytes, uint64_t rows)> recordEnqueued)
+    std::function<void(uint64_t bytes, uint64_t rows)> recordEnqueued,
+    const StreamArena::Options& arenaOptions)
     : taskId_(taskId),
       destination_(destination),
       serde_(serde),
@@ -50,6 +58,7 @@ Destination::Destination(
       pool_(pool),
       eagerFlush_(eagerFlush),
       recordEnqueued_(std::move(recordEnqueued)),
+      arenaOptions_(arenaOptions),
       rows_(raw_vector<vector_size_t>(pool)) {
   setTargetSizePct();
 }
@@ -66,54 +75,77 @@ BlockingReason Destination::advance(
     ContinueFuture* future,
     Scratch& scratch) {
   VELOX_CHECK_LE(!!outputCompactRow + !!outputUnsafeRow, 1);
-  if (rowIdx_ >= rows_.size()) {
-    *atEnd = true;
-    return BlockingReason::kNotBlocked;
+  if (!prepared_) {
+    if (rowIdx_ >= rows_.size()) {
+      *atEnd = true;
+      return BlockingReason::kNotBlocked;
+    }
+
+    if (bytesInCurrent_ >= adjustedMaxBytes(maxBytes)) {
+      return flush(bufferManager, bufferReleaseFn, future);
+    }
+
+    collectRows(maxBytes, sizes, output);
+
+    // Serialize
+    const auto rows = preparedRows();
+    if (serde_->kind() == VectorSerde::Kind::kCompactRow) {
+      VELOX_CHECK_NOT_NULL(outputCompactRow);
+      current_->append(*outputCompactRow, rows, sizes);
+    } else if (serde_->kind() == VectorSerde::Kind::kUnsafeRow) {
+      VELOX_CHECK_NOT_NULL(outputUnsafeRow);
+      current_->append(*outputUnsafeRow, rows, sizes);
+    } else {
+      VELOX_CHECK_EQ(serde_->kind(), VectorSerde::Kind::kPresto);
+      current_->append(output, rows, scratch);
+    }
   }
+  prepared_ = false;
 
-  const auto firstRow = rowIdx_;
-  const uint32_t adjustedMaxBytes = (maxBytes * targetSizePct_) / 100;
-  if (bytesInCurrent_ >= adjustedMaxBytes) {
+  // Update output state variable.
+  if (rowIdx_ == rows_.size()) {
+    *atEnd = true;
+  }
+  if (shouldFlush_ || (eagerFlush_ && rowsInCurrent_ > 0)) {
     return flush(bufferManager, bufferReleaseFn, future);
   }
+  return BlockingReason::kNotBlocked;
+}
+
+bool Destination::prepareAppend(
+    uint64_t maxBytes,
+    const std::vector<vector_size_t>& sizes,
+    const RowVectorPtr& output) {
+  if (prepared_ || rowIdx_ >= rows_.size() ||
+      bytesInCurrent_ >= adjustedMaxBytes(maxBytes)) {
+    return false;
+  }
+  collectRows(maxBytes, sizes, output);
+  prepared_ = true;
+  return true;
+}
 
-  // Collect rows to serialize.
-  bool shouldFlush = false;
-  while (rowIdx_ < rows_.size() && !shouldFlush) {
+void Destination::collectRows(
+    uint64_t maxBytes,
+    const std::vector<vector_size_t>& sizes,
+    const RowVectorPtr& output) {
+  firstPreparedRow_ = rowIdx_;
+  const auto maxBytesInCurrent = adjustedMaxBytes(maxBytes);
+  shouldFlush_ = false;
+  while (rowIdx_ < rows_.size() && !shouldFlush_) {
     bytesInCurrent_ += sizes[rows_[rowIdx_]];
     ++rowIdx_;
     ++rowsInCurrent_;
-    shouldFlush =
-        bytesInCurrent_ >= adjustedMaxBytes || rowsInCurrent_ >= targetNumRows_;
+    shouldFlush_ = bytesInCurrent_ >= maxBytesInCurrent ||
+        rowsInCurrent_ >= targetNumRows_;
   }
 
-  // Serialize
   if (current_ == nullptr) {
-    current_ = std::make_unique<VectorStreamGroup>(pool_, serde_);
+    current_ =
+        std::make_unique<VectorStreamGroup>(pool_, serde_, arenaOptions_);
     const auto rowType = asRowType(output->type());
     current_->createStreamTree(rowType, rowsInCurrent_, serdeOptions_);
   }
-
-  const auto rows = folly::Range(&rows_[firstRow], rowIdx_ - firstRow);
-  if (serde_->kind() == VectorSerde::Kind::kCompactRow) {
-    VELOX_CHECK_NOT_NULL(outputCompactRow);
-    current_->append(*outputCompactRow, rows, sizes);
-  } else if (serde_->kind() == VectorSerde::Kind::kUnsafeRow) {
-    VELOX_CHECK_NOT_NULL(outputUnsafeRow);
-    current_->append(*outputUnsafeRow, rows, sizes);
-  } else {
-    VELOX_CHECK_EQ(serde_->kind(), VectorSerde::Kind::kPresto);
-    current_->append(output, rows, scratch);
-  }
-
-  // Update output state variable.
-  if (rowIdx_ == rows_.size()) {
-    *atEnd = true;
-  }
-  if (shouldFlush || (eagerFlush_ && rowsInCurrent_ > 0)) {
-    return flush(bufferManager, bufferReleaseFn, future);
-  }
-  return BlockingReason::kNotBlocked;
 }
 
 BlockingReason Destination::flush(
@@ -201,10 +233,16 @@ PartitionedOutput::PartitionedOutput(
                             ->queryConfig()
                             .maxPartitionedOutputBufferSize()),
       eagerFlush_(eagerFlush),
+      arenaReuseEnabled_(operatorCtx_->driverCtx()
+                             ->queryConfig()
+                             .partitionedOutputArenaReuseEnabled()),
       serde_(getNamedVectorSerde(planNode->serdeKind())),
       serdeOptions_(getVectorSerdeOptions(
           operatorCtx_->driverCtx()->queryConfig(),
-          planNode->serdeKind())) {
+          planNode->serdeKind())),
+      scatterAppend_(
+          numDestinations_ > 1 &&
+          planNode->serdeKind() == VectorSerde::Kind::kPresto) {
   if (!planNode->isPartitioned()) {
     VELOX_USER_CHECK_EQ(numDestinations_, 1);
   }
@@ -266,7 +304,10 @@ void PartitionedOutput::initializeDestinations() {
           [&](uint64_t bytes, uint64_t rows) {
             auto lockedStats = stats_.wlock();
             lockedStats->addOutputVector(bytes, rows);
-          }));
+          },
+          StreamArena::Options{
+              .geometricGrowth = arenaReuseEnabled_,
+              .retainOnClear = arenaReuseEnabled_}));
     }
   }
 }
@@ -407,6 +448,9 @@ RowVectorPtr PartitionedOutput::getOutput() {
   bool workLeft;
   do {
     workLeft = false;
+    if (scatterAppend_) {
+      appendScatter(maxPageSize);
+    }
     for (auto& destination : destinations_) {
       bool atEnd = false;
       blockingReason_ = destination->advance(
@@ -471,6 +515,19 @@ RowVectorPtr PartitionedOutput::getOutput() {
   return nullptr;
 }
 
+void PartitionedOutput::appendScatter(uint64_t maxPageSize) {
+  scatterGroups_.clear();
+  scatterRows_.clear();
+  for (auto& destination : destinations_) {
+    if (destination->prepareAppend(maxPageSize, rowSize_, output_)) {
+      scatterGroups_.push_back(destination->current());
+      scatterRows_.push_back(destination->preparedRows());
+    }
+  }
+  VectorStreamGroup::appendScatter(
+      output_, scatterGroups_, scatterRows_, scratch_);
+}
+
 bool PartitionedOutput::isFinished() {
   return finished_;
 }
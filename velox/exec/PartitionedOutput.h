@@ -36,7 +36,8 @@ class Destination {
       VectorSerde::Options* options,
       memory::MemoryPool* pool,
       bool eagerFlush,
-      std::function<void(uint64_t bytes, uint64_t rows)> recordEnqueued);
+      std::function<void(uint64_t bytes, uint64_t rows)> recordEnqueued,
+      const StreamArena::Options& arenaOptions = {});
 
   /// Resets the destination before starting a new batch.
   void beginBatch() {
@@ -68,6 +69,25 @@ class Destination {
       ContinueFuture* future,
       Scratch& scratch);
 
+  /// Selects the rows the next advance() serializes and creates the stream
+  /// for them. The caller then appends preparedRows() to current() of this
+  /// and other destinations with VectorStreamGroup::appendScatter, after which
+  /// advance() completes the step without serializing. Returns false if no rows
+  /// are left or if the serialized data must be flushed first.
+  bool prepareAppend(
+      uint64_t maxBytes,
+      const std::vector<vector_size_t>& sizes,
+      const RowVectorPtr& output);
+
+  folly::Range<const vector_size_t*> preparedRows() const {
+    return folly::Range(
+        rows_.data() + firstPreparedRow_, rowIdx_ - firstPreparedRow_);
+  }
+
+  VectorStreamGroup* current() const {
+    return current_.get();
+  }
+
   BlockingReason flush(
       OutputBufferManager& bufferManager,
       const std::function<void()>& bufferReleaseFn,
@@ -96,6 +116,17 @@ class Destination {
   // traffic pattern where all consumers contend for the network at
   // the same time. This is done for each batch so that the average
   // batch size for each converges.
+  uint32_t adjustedMaxBytes(uint64_t maxBytes) const {
+    return (maxBytes * targetSizePct_) / 100;
+  }
+
+  // Adds the rows to serialize next until 'maxBytes' or the target number of
+  // rows is reached and makes sure 'current_' exists.
+  void collectRows(
+      uint64_t maxBytes,
+      const std::vector<vector_size_t>& sizes,
+      const RowVectorPtr& output);
+
   void setTargetSizePct() {
     // Flush at 70 to 120% of target row or byte count.
     targetSizePct_ = 70 + (folly::Random::rand32(rng_) % 50);
@@ -109,6 +140,8 @@ class Destination {
   memory::MemoryPool* const pool_;
   const bool eagerFlush_;
   const std::function<void(uint64_t bytes, uint64_t rows)> recordEnqueued_;
+  // Options for the arena of 'current_'.
+  const StreamArena::Options arenaOptions_;
 
   // Bytes serialized in 'current_'
   uint64_t bytesInCurrent_{0};
@@ -119,6 +152,15 @@ class Destination {
   // First index of 'rows_' that is not appended to 'current_'.
   vector_size_t rowIdx_{0};
 
+  // The rows from 'firstPreparedRow_' to 'rowIdx_' are collected by
+  // collectRows(). If 'prepared_' is true, prepareAppend() collected them and
+  // the caller appends them to 'current_'.
+  vector_size_t firstPreparedRow_{0};
+  bool prepared_{false};
+
+  // True if 'current_' is to be flushed after appending the collected rows.
+  bool shouldFlush_{false};
+
   // The current stream where the input is serialized to. This is cleared on
   // every flush() call.
   std::unique_ptr<VectorStreamGroup> current_;
@@ -205,6 +247,10 @@ class PartitionedOutput : public Operator {
   // Collect all rows with null keys into nullRows_.
   void collectNullRows();
 
+  // Appends the next rows of all destinations that have rows to serialize
+  // column by column. The destinations complete the appends in advance().
+  void appendScatter(uint64_t maxPageSize);
+
   // If compression in serde is enabled, this is the minimum compression that
   // must be achieved before starting to skip compression. Used for testing.
   inline static float minCompressionRatio_ = 0.8;
@@ -219,8 +265,14 @@ class PartitionedOutput : public Operator {
   const std::function<void()> bufferReleaseFn_;
   const int64_t maxBufferedBytes_;
   const bool eagerFlush_;
+  const bool arenaReuseEnabled_;
   VectorSerde* const serde_;
   const std::unique_ptr<VectorSerde::Options> serdeOptions_;
+  // True if the rows of all destinations are serialized together column by
+  // column. With many destinations each gets few rows of a batch and
+  // serializing each column for all of them at once is cheaper than
+  // serializing all columns for each destination in turn.
+  const bool scatterAppend_;
 
   BlockingReason blockingReason_{BlockingReason::kNotBlocked};
   ContinueFuture future_;
@@ -249,6 +301,8 @@ class PartitionedOutput : public Operator {
   SelectivityVector nullRows_;
   std::vector<uint32_t> partitions_;
   std::vector<DecodedVector> decodedVectors_;
+  std::vector<VectorStreamGroup*> scatterGroups_;
+  std::vector<folly::Range<const vector_size_t*>> scatterRows_;
   Scratch scratch_;
 };
 
@@ -349,8 +349,10 @@ uint32_t PrefixSort::maxRequiredBytes() const {
   const auto numRows = rowContainer_->numRows();
   const auto numPages =
       memory::AllocationTraits::numPages(numRows * sortLayout_.entrySize);
-  // Prefix data size + swap buffer size.
-  return memory::AllocationTraits::pageBytes(numPages) +
+  // Prefix data size + swap buffer size. A radix sort needs a second buffer
+  // of prefix data.
+  return memory::AllocationTraits::pageBytes(numPages) *
+      (useRadixSort(numRows) ? 2 : 1) +
       pool_->preferredSize(checkedPlus<size_t>(
           sortLayout_.entrySize, AlignedBuffer::kPaddedSize)) +
       2 * pool_->alignment();
@@ -387,12 +389,28 @@ void PrefixSort::sortInternal(
           RuntimeCounter(
               sortLayout_.numNormalizedKeys, RuntimeCounter::Unit::kNone));
     }
-    if (sortLayout_.hasNonNormalizedKey ||
+    if (useRadixSort(numRows)) {
+      memory::ContiguousAllocation radixBufferAlloc;
+      pool_->allocateContiguous(
+          memory::AllocationTraits::numPages(numRows * entrySize),
+          radixBufferAlloc);
+      sortRunner.radixSort(
+          prefixBufferStart,
+          prefixBufferEnd,
+          sortLayout_.normalizedBufferSize,
+          sortLayout_.numPaddingBytes,
+          radixBufferAlloc.data<char>());
+    } else if (
+        sortLayout_.hasNonNormalizedKey ||
         sortLayout_.nonPrefixSortStartIndex < sortLayout_.numNormalizedKeys) {
       sortRunner.quickSort(
           prefixBufferStart, prefixBufferEnd, [&](char* lhs, char* rhs) {
             return comparePartNormalizedKeys(lhs, rhs);
           });
+    } else if (sortLayout_.normalizedBufferSize == sizeof(uint64_t)) {
+      sortRunner.quickSortWordKeys<1>(prefixBufferStart, prefixBufferEnd);
+    } else if (sortLayout_.normalizedBufferSize == 2 * sizeof(uint64_t)) {
+      sortRunner.quickSortWordKeys<2>(prefixBufferStart, prefixBufferEnd);
     } else {
       sortRunner.quickSort(
           prefixBufferStart, prefixBufferEnd, [&](char* lhs, char* rhs) {
@@ -163,6 +163,13 @@ class PrefixSort {
   /// The number of prefix sort keys.
   static inline const std::string kNumPrefixSortKeys{"numPrefixSortKeys"};
 
+  /// Minimum number of rows to sort with a radix sort instead of quick-sort.
+  static constexpr uint64_t kMinRadixSortRows = 4'096;
+
+  /// Maximum number of normalized key bytes, including padding, to sort with a
+  /// radix sort. Longer keys take too many passes.
+  static constexpr uint32_t kMaxRadixSortKeyBytes = 16;
+
  private:
   /// Fallback to stdSort when prefix sort conditions such as config and memory
   /// are not satisfied. stdSort provides >2X performance win than std::sort for
@@ -207,6 +214,15 @@ class PrefixSort {
   // swap buffer.
   uint32_t maxRequiredBytes() const;
 
+  // Returns true if 'numRows' rows are sorted with a radix sort. The sort keys
+  // must all be fully normalized in the prefix.
+  bool useRadixSort(uint64_t numRows) const {
+    return !sortLayout_.hasNonNormalizedKey &&
+        sortLayout_.nonPrefixSortStartIndex >= sortLayout_.numNormalizedKeys &&
+        sortLayout_.normalizedBufferSize <= kMaxRadixSortKeyBytes &&
+        numRows >= kMinRadixSortRows;
+  }
+
   void sortInternal(std::vector<char*, memory::StlAllocator<char*>>& rows);
 
   int compareAllNormalizedKeys(char* left, char* right);
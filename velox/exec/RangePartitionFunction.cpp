@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/RangePartitionFunction.h"
+#include "velox/common/encode/Base64.h"
+#include "velox/vector/VectorSaver.h"
+
+namespace facebook::velox::exec {
+namespace {
+std::vector<CompareFlags> toCompareFlags(
+    const std::vector<core::SortOrder>& sortOrders) {
+  std::vector<CompareFlags> flags;
+  flags.reserve(sortOrders.size());
+  for (const auto& order : sortOrders) {
+    flags.push_back(
+        {order.isNullsFirst(),
+         order.isAscending(),
+         false,
+         CompareFlags::NullHandlingMode::kNullAsValue});
+  }
+  return flags;
+}
+} // namespace
+
+RangePartitionFunction::RangePartitionFunction(
+    int numPartitions,
+    const std::vector<column_index_t>& keyChannels,
+    const std::vector<core::SortOrder>& sortOrders,
+    const RowVectorPtr& splitters)
+    : numPartitions_{numPartitions},
+      keyChannels_{keyChannels},
+      splitters_{splitters},
+      compareFlags_{toCompareFlags(sortOrders)} {
+  VELOX_CHECK(!keyChannels_.empty());
+  VELOX_CHECK_EQ(keyChannels_.size(), compareFlags_.size());
+  VELOX_CHECK_NOT_NULL(splitters_);
+  VELOX_CHECK_EQ(splitters_->childrenSize(), keyChannels_.size());
+  VELOX_USER_CHECK_EQ(
+      splitters_->size() + 1,
+      numPartitions_,
+      "Range partitioning into {} partitions requires {} splitters",
+      numPartitions_,
+      numPartitions_ - 1);
+}
+
+int32_t RangePartitionFunction::compare(
+    const std::vector<const BaseVector*>& keys,
+    vector_size_t row,
+    vector_size_t splitter) const {
+  for (auto i = 0; i < keys.size(); ++i) {
+    const auto result =
+        keys[i]
+            ->compare(
+                splitters_->childAt(i).get(), row, splitter, compareFlags_[i])
+            .value();
+    if (result != 0) {
+      return result;
+    }
+  }
+  return 0;
+}
+
+std::optional<uint32_t> RangePartitionFunction::partition(
+    const RowVector& input,
+    std::vector<uint32_t>& partitions) {
+  const auto numRows = input.size();
+  partitions.resize(numRows);
+  if (numPartitions_ == 1) {
+    return 0;
+  }
+
+  std::vector<const BaseVector*> keys;
+  keys.reserve(keyChannels_.size());
+  for (auto channel : keyChannels_) {
+    keys.push_back(input.childAt(channel)->loadedVector());
+  }
+
+  const vector_size_t numSplitters = splitters_->size();
+  for (auto row = 0; row < numRows; ++row) {
+    // Binary search for the first splitter that is greater than 'row'.
+    vector_size_t low = 0;
+    vector_size_t high = numSplitters;
+    while (low < high) {
+      const auto mid = (low + high) / 2;
+      if (compare(keys, row, mid) >= 0) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    partitions[row] = low;
+  }
+  return std::nullopt;
+}
+
+RangePartitionFunctionSpec::RangePartitionFunctionSpec(
+    RowTypePtr inputType,
+    std::vector<column_index_t> keyChannels,
+    std::vector<core::SortOrder> sortOrders,
+    RowVectorPtr splitters)
+    : inputType_{std::move(inputType)},
+      keyChannels_{std::move(keyChannels)},
+      sortOrders_{std::move(sortOrders)},
+      splitters_{std::move(splitters)} {
+  VELOX_CHECK_EQ(keyChannels_.size(), sortOrders_.size());
+  VELOX_CHECK_NOT_NULL(splitters_);
+  VELOX_CHECK_EQ(splitters_->childrenSize(), keyChannels_.size());
+  for (auto i = 0; i < keyChannels_.size(); ++i) {
+    VELOX_CHECK(
+        inputType_->childAt(keyChannels_[i])
+            ->equivalent(*splitters_->childAt(i)->type()),
+        "Splitter type does not match type of key {}",
+        inputType_->nameOf(keyChannels_[i]));
+  }
+}
+
+std::unique_ptr<core::PartitionFunction> RangePartitionFunctionSpec::create(
+    int numPartitions,
+    bool /*localExchange*/) const {
+  return std::make_unique<RangePartitionFunction>(
+      numPartitions, keyChannels_, sortOrders_, splitters_);
+}
+
+std::string RangePartitionFunctionSpec::toString() const {
+  std::ostringstream keys;
+  for (auto i = 0; i < keyChannels_.size(); ++i) {
+    if (i > 0) {
+      keys << ", ";
+    }
+    keys << inputType_->nameOf(keyChannels_[i]) << " "
+         << sortOrders_[i].toString();
+  }
+  return fmt::format(
+      "RANGE({}) with {} splitters", keys.str(), splitters_->size());
+}
+
+folly::dynamic RangePartitionFunctionSpec::serialize() const {
+  folly::dynamic obj = folly::dynamic::object;
+  obj["name"] = "RangePartitionFunctionSpec";
+  obj["inputType"] = inputType_->serialize();
+  obj["keyChannels"] = ISerializable::serialize(keyChannels_);
+  auto sortOrders = folly::dynamic::array();
+  for (const auto& order : sortOrders_) {
+    sortOrders.push_back(order.serialize());
+  }
+  obj["sortOrders"] = sortOrders;
+  std::ostringstream out;
+  saveVector(*splitters_, out);
+  const auto serialized = out.str();
+  obj["splitters"] =
+      encoding::Base64::encode(serialized.data(), serialized.size());
+  return obj;
+}
+
+// static
+core::PartitionFunctionSpecPtr RangePartitionFunctionSpec::deserialize(
+    const folly::dynamic& obj,
+    void* context) {
+  auto keys = ISerializable::deserialize<std::vector<column_index_t>>(
+      obj["keyChannels"], context);
+  std::vector<core::SortOrder> sortOrders;
+  for (const auto& order : obj["sortOrders"]) {
+    sortOrders.push_back(core::SortOrder::deserialize(order));
+  }
+
+  auto* pool = static_cast<memory::MemoryPool*>(context);
+  const auto encoded = obj["splitters"].asString();
+  std::istringstream in(encoding::Base64::decode(encoded));
+  auto splitters =
+      std::dynamic_pointer_cast<RowVector>(restoreVector(in, pool));
+  VELOX_CHECK_NOT_NULL(splitters);
+  return std::make_shared<RangePartitionFunctionSpec>(
+      ISerializable::deserialize<RowType>(obj["inputType"]),
+      std::move(keys),
+      std::move(sortOrders),
+      std::move(splitters));
+}
+
+// static
+RowVectorPtr RangePartitionFunctionSpec::makeSplitters(
+    const std::vector<RowVectorPtr>& samples,
+    const std::vector<core::SortOrder>& sortOrders,
+    int numPartitions,
+    memory::MemoryPool* pool) {
+  VELOX_CHECK(!samples.empty());
+  VELOX_CHECK_GT(numPartitions, 0);
+  const auto flags = toCompareFlags(sortOrders);
+  const auto& type = samples[0]->type();
+  VELOX_CHECK_EQ(samples[0]->childrenSize(), flags.size());
+
+  // Sample rows as pairs of sample index and row number.
+  std::vector<std::pair<int32_t, vector_size_t>> rows;
+  for (auto i = 0; i < samples.size(); ++i) {
+    VELOX_CHECK(samples[i]->type()->equivalent(*type));
+    for (auto row = 0; row < samples[i]->size(); ++row) {
+      rows.emplace_back(i, row);
+    }
+  }
+  VELOX_CHECK(!rows.empty(), "Cannot make splitters from empty samples");
+
+  std::sort(rows.begin(), rows.end(), [&](const auto& left, const auto& right) {
+    const auto& leftSample = samples[left.first];
+    const auto& rightSample = samples[right.first];
+    for (auto i = 0; i < flags.size(); ++i) {
+      const auto result = leftSample->childAt(i)
+                              ->compare(
+                                  rightSample->childAt(i).get(),
+                                  left.second,
+                                  right.second,
+                                  flags[i])
+                              .value();
+      if (result != 0) {
+        return result < 0;
+      }
+    }
+    return false;
+  });
+
+  auto splitters = std::static_pointer_cast<RowVector>(
+      BaseVector::create(type, numPartitions - 1, pool));
+  for (auto i = 1; i < numPartitions; ++i) {
+    const auto& [sample, row] = rows[(i * rows.size()) / numPartitions];
+    splitters->copy(samples[sample].get(), i - 1, row, 1);
+  }
+  return splitters;
+}
+} // namespace facebook::velox::exec
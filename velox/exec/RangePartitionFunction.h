@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/core/PlanNode.h"
+
+namespace facebook::velox::exec {
+
+/// Calculates partition number for each row of the specified vector by
+/// comparing its keys with a sorted list of splitters. A row goes to the
+/// partition whose number is the number of splitters that are less than or
+/// equal to its keys. With N - 1 splitters, each partition covers a
+/// contiguous range of keys, so that inputs that are sorted on the keys
+/// remain sorted within each partition and equal keys from different inputs
+/// go to the same partition. Used to run merge joins over key ranges in
+/// parallel.
+class RangePartitionFunction : public core::PartitionFunction {
+ public:
+  /// 'splitters' has one column per key channel and is sorted by
+  /// 'sortOrders'.
+  RangePartitionFunction(
+      int numPartitions,
+      const std::vector<column_index_t>& keyChannels,
+      const std::vector<core::SortOrder>& sortOrders,
+      const RowVectorPtr& splitters);
+
+  ~RangePartitionFunction() override = default;
+
+  std::optional<uint32_t> partition(
+      const RowVector& input,
+      std::vector<uint32_t>& partitions) override;
+
+  int numPartitions() const {
+    return numPartitions_;
+  }
+
+ private:
+  // Returns the result of comparing the keys of 'row' in 'keys' with
+  // 'splitter', in the order of 'compareFlags_'.
+  int32_t compare(
+      const std::vector<const BaseVector*>& keys,
+      vector_size_t row,
+      vector_size_t splitter) const;
+
+  const int numPartitions_;
+  const std::vector<column_index_t> keyChannels_;
+  const RowVectorPtr splitters_;
+  std::vector<CompareFlags> compareFlags_;
+};
+
+/// Factory class to create RangePartitionFunction. 'splitters' has one column
+/// per key channel and numPartitions - 1 rows, sorted by 'sortOrders'.
+class RangePartitionFunctionSpec : public core::PartitionFunctionSpec {
+ public:
+  RangePartitionFunctionSpec(
+      RowTypePtr inputType,
+      std::vector<column_index_t> keyChannels,
+      std::vector<core::SortOrder> sortOrders,
+      RowVectorPtr splitters);
+
+  std::unique_ptr<core::PartitionFunction> create(
+      int numPartitions,
+      bool localExchange) const override;
+
+  std::string toString() const override;
+
+  folly::dynamic serialize() const override;
+
+  static core::PartitionFunctionSpecPtr deserialize(
+      const folly::dynamic& obj,
+      void* context);
+
+  /// Returns 'numPartitions' - 1 splitters that divide the rows of 'samples'
+  /// into 'numPartitions' ranges of about the same size. The columns of each
+  /// sample are the keys in order. For a merge join, samples of both sides
+  /// should be included so that the ranges are balanced for both.
+  static RowVectorPtr makeSplitters(
+      const std::vector<RowVectorPtr>& samples,
+      const std::vector<core::SortOrder>& sortOrders,
+      int numPartitions,
+      memory::MemoryPool* pool);
+
+ private:
+  const RowTypePtr inputType_;
+  const std::vector<column_index_t> keyChannels_;
+  const std::vector<core::SortOrder> sortOrders_;
+  const RowVectorPtr splitters_;
+};
+} // namespace facebook::velox::exec
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/ReservationHistory.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace facebook::velox::exec {
+
+// static
+ReservationHistory& ReservationHistory::instance() {
+  static ReservationHistory history;
+  return history;
+}
+
+std::optional<uint64_t> ReservationHistory::predict(
+    const std::string& key) const {
+  auto state = state_.rlock();
+  auto it = state->entries.find(key);
+  if (it == state->entries.end()) {
+    return std::nullopt;
+  }
+  return it->second.peakBytes;
+}
+
+void ReservationHistory::record(
+    const std::string& key,
+    uint64_t peakBytes,
+    bool spilled) {
+  auto state = state_.wlock();
+  auto [it, inserted] = state->entries.try_emplace(key, Entry{peakBytes, 0});
+  auto& entry = it->second;
+  entry.lastUse = ++state->useCounter;
+  if (inserted || peakBytes >= entry.peakBytes) {
+    entry.peakBytes = peakBytes;
+  } else if (!spilled) {
+    entry.peakBytes -= (entry.peakBytes - peakBytes) / 2;
+  }
+  if (inserted) {
+    evictLocked(*state);
+  }
+}
+
+void ReservationHistory::clear() {
+  state_.wlock()->entries.clear();
+}
+
+void ReservationHistory::setMaxEntries(size_t maxEntries) {
+  auto state = state_.wlock();
+  state->maxEntries = maxEntries;
+  evictLocked(*state);
+}
+
+size_t ReservationHistory::size() const {
+  return state_.rlock()->entries.size();
+}
+
+// static
+void ReservationHistory::evictLocked(State& state) {
+  if (state.entries.size() <= state.maxEntries) {
+    return;
+  }
+  // Evicts down to 7/8 of the limit so that the scan is amortized over many
+  // inserts.
+  const auto numToEvict =
+      state.entries.size() - state.maxEntries + state.maxEntries / 8;
+  std::vector<uint64_t> lastUses;
+  lastUses.reserve(state.entries.size());
+  for (const auto& [_, entry] : state.entries) {
+    lastUses.push_back(entry.lastUse);
+  }
+  const auto numKept = lastUses.size() - std::min(numToEvict, lastUses.size());
+  if (numKept == 0) {
+    state.entries.clear();
+    return;
+  }
+  std::nth_element(
+      lastUses.begin(),
+      lastUses.begin() + (lastUses.size() - numKept),
+      lastUses.end());
+  const auto minLastUse = lastUses[lastUses.size() - numKept];
+  for (auto it = state.entries.begin(); it != state.entries.end();) {
+    if (it->second.lastUse < minLastUse) {
+      it = state.entries.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+} // namespace facebook::velox::exec
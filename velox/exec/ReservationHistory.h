@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <folly/Synchronized.h>
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace facebook::velox::exec {
+
+/// Process wide record of the peak memory usage of spillable operators, keyed
+/// by the operator type and the plan fragment that feeds the operator. A later
+/// run of the same fragment reserves the predicted memory up front instead of
+/// growing its reservation in 'spillable_reservation_growth_pct' steps, each of
+/// which may be a round trip to the memory arbitrator. Enabled by the
+/// 'operator_reservation_history_enabled' query config.
+class ReservationHistory {
+ public:
+  /// Default limit on the number of remembered keys.
+  static constexpr size_t kDefaultMaxEntries = 10'000;
+
+  static ReservationHistory& instance();
+
+  /// Returns the predicted peak memory usage for 'key' or std::nullopt if no
+  /// run of 'key' has been recorded.
+  std::optional<uint64_t> predict(const std::string& key) const;
+
+  /// Records a run of 'key' which used at most 'peakBytes'. The prediction
+  /// follows an increase right away but only goes halfway down on a decrease,
+  /// so that one small run does not make the next large run grow its
+  /// reservation step by step again. A run that spilled was capped by its
+  /// memory capacity and does not decrease the prediction.
+  void record(const std::string& key, uint64_t peakBytes, bool spilled);
+
+  void clear();
+
+  void setMaxEntries(size_t maxEntries);
+
+  size_t size() const;
+
+ private:
+  struct Entry {
+    uint64_t peakBytes;
+    uint64_t lastUse;
+  };
+
+  struct State {
+    std::unordered_map<std::string, Entry> entries;
+    size_t maxEntries{kDefaultMaxEntries};
+    uint64_t useCounter{0};
+  };
+
+  // Evicts the least recently recorded keys if there are more than
+  // 'maxEntries'.
+  static void evictLocked(State& state);
+
+  folly::Synchronized<State> state_;
+};
+
+} // namespace facebook::velox::exec
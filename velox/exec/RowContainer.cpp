@@ -568,6 +568,17 @@ void RowContainer::store(
   }
 }
 
+// static
+std::optional<std::string_view> RowContainer::contiguousComplexValue(
+    const char* row,
+    int32_t offset) {
+  const auto& view = *reinterpret_cast<const std::string_view*>(row + offset);
+  if (HashStringAllocator::headerOf(view.data())->isContinued()) {
+    return std::nullopt;
+  }
+  return view;
+}
+
 HashStringAllocator::InputStream RowContainer::prepareRead(
     const char* row,
     int32_t offset) {
@@ -854,6 +865,15 @@ int32_t RowContainer::compareComplexType(
     CompareFlags flags) const {
   VELOX_DCHECK(flags.nullAsValue(), "not supported null handling mode");
 
+  if (ContainerRowSerde::isFixedWidthComplexType(*type)) {
+    const auto leftValue = contiguousComplexValue(left, leftOffset);
+    const auto rightValue = contiguousComplexValue(right, rightOffset);
+    if (leftValue.has_value() && rightValue.has_value()) {
+      return ContainerRowSerde::compareFixedWidth(
+          leftValue.value(), rightValue.value(), *type, flags);
+    }
+  }
+
   auto leftStream = prepareRead(left, leftOffset);
   auto rightStream = prepareRead(right, rightOffset);
   return ContainerRowSerde::compare(leftStream, rightStream, type, flags);
@@ -882,6 +902,13 @@ void RowContainer::hashTyped(
   std::string storage;
   auto numRows = rows.size();
 
+  bool fixedWidthComplexType = false;
+  if constexpr (
+      Kind == TypeKind::ROW || Kind == TypeKind::ARRAY ||
+      Kind == TypeKind::MAP) {
+    fixedWidthComplexType = ContainerRowSerde::isFixedWidthComplexType(*type);
+  }
+
   for (int32_t i = 0; i < numRows; ++i) {
     char* row = rows[i];
     if (nullable && isNullAt(row, column)) {
@@ -896,8 +923,16 @@ void RowContainer::hashTyped(
       } else if constexpr (
           Kind == TypeKind::ROW || Kind == TypeKind::ARRAY ||
           Kind == TypeKind::MAP) {
-        auto in = prepareRead(row, offset);
-        hash = ContainerRowSerde::hash(in, type);
+        std::optional<std::string_view> value;
+        if (fixedWidthComplexType) {
+          value = contiguousComplexValue(row, offset);
+        }
+        if (value.has_value()) {
+          hash = ContainerRowSerde::hashFixedWidth(value->data(), *type);
+        } else {
+          auto in = prepareRead(row, offset);
+          hash = ContainerRowSerde::hash(in, type);
+        }
       } else if constexpr (typeProvidesCustomComparison) {
         hash = static_cast<const CanProvideCustomComparisonType<Kind>*>(type)
                    ->hash(valueAt<T>(row, offset));
@@ -976,6 +1011,74 @@ void RowContainer::clear() {
   rowColumnsStats_.resize(types_.size());
 }
 
+int64_t RowContainer::compactStringData() {
+  VELOX_CHECK(
+      accumulators_.empty(),
+      "Cannot compact string data of a container with accumulators");
+  std::vector<column_index_t> stringColumns;
+  for (auto i = 0; i < types_.size(); ++i) {
+    if (types_[i]->isFixedWidth()) {
+      continue;
+    }
+    const auto kind = types_[i]->kind();
+    if (kind != TypeKind::VARCHAR && kind != TypeKind::VARBINARY) {
+      // Complex type values are serialized across multiple allocator blocks
+      // which we do not relocate.
+      return 0;
+    }
+    stringColumns.push_back(i);
+  }
+  if (stringColumns.empty() || numRows_ == 0) {
+    return 0;
+  }
+
+  const int64_t retainedBefore = stringAllocator_->retainedSize();
+  auto newAllocator = std::make_unique<HashStringAllocator>(pool());
+  if (isFileBacked()) {
+    newAllocator->setFileBackedDirectory(fileBackedDirectory_);
+  }
+  constexpr int32_t kBatch = 1000;
+  std::vector<char*> rows(kBatch);
+  std::string storage;
+  RowContainerIterator iter;
+  while (auto numRows = listRows(&iter, kBatch, rows.data())) {
+    for (auto columnIndex : stringColumns) {
+      const auto column = columnAt(columnIndex);
+      for (auto i = 0; i < numRows; ++i) {
+        char* row = rows[i];
+        if (isNullAt(row, column)) {
+          continue;
+        }
+        const auto value = valueAt<StringView>(row, column.offset());
+        if (value.isInline()) {
+          continue;
+        }
+        newAllocator->copyMultipart(
+            HashStringAllocator::contiguousString(value, storage),
+            row,
+            column.offset());
+      }
+    }
+  }
+  stringAllocator_ = std::move(newAllocator);
+  return retainedBefore - stringAllocator_->retainedSize();
+}
+
+void RowContainer::enableFileBackedStorage(const std::string& directory) {
+  VELOX_CHECK(!directory.empty());
+  fileBackedDirectory_ = directory;
+  rows_.setFileBackedDirectory(directory);
+  stringAllocator_->setFileBackedDirectory(directory);
+}
+
+std::pair<int64_t, int64_t> RowContainer::fileBackedBytes() const {
+  const auto [stringBytes, residentStringBytes] =
+      stringAllocator_->fileBackedBytes();
+  return {
+      rows_.fileBackedBytes() + stringBytes,
+      rows_.residentFileBackedBytes() + residentStringBytes};
+}
+
 void RowContainer::setProbedFlag(char** rows, int32_t numRows) {
   for (auto i = 0; i < numRows; i++) {
     // Row may be null in case of a FULL join.
@@ -681,6 +681,16 @@ class RowContainer {
       const DecodedVector& decoded,
       vector_size_t index) const;
 
+  /// Same as equals() for a column of 'Kind' whose type does not provide custom
+  /// comparison. Resolves the type dispatch at compile time. Strings of
+  /// different size or that are inlined in the row compare without copying.
+  template <bool mayHaveNulls, TypeKind Kind>
+  bool equalsTyped(
+      const char* row,
+      RowColumn column,
+      const DecodedVector& decoded,
+      vector_size_t index) const;
+
   /// Compares the value at 'column' in 'row' with the value at 'index' in
   /// 'decoded'. Returns 0 for equal, < 0 for 'row' < 'decoded', > 0 otherwise.
   int32_t compare(
@@ -785,6 +795,31 @@ class RowContainer {
   /// Resets the state to be as after construction. Frees memory for payload.
   void clear();
 
+  /// Moves the out-of-line VARCHAR and VARBINARY values of all live rows into
+  /// a fresh HashStringAllocator and frees the old one. This drops the free
+  /// space left behind by erased or overwritten values without spilling.
+  /// Returns the number of bytes released by the old allocator net of the
+  /// new one. Returns 0 without doing anything if the container has other
+  /// variable width columns. Must not be called on a container with
+  /// accumulators since these may hold pointers into the allocator.
+  /// References previously obtained from stringAllocator() are invalidated.
+  int64_t compactStringData();
+
+  /// Makes the row and string storage allocated from now on come from file
+  /// backed memory under 'directory' instead of pool(). The OS pages this
+  /// memory, so it is not counted in pool(). Existing rows stay where they
+  /// are. Used as a fallback when pool() cannot grow and spilling is not
+  /// possible.
+  void enableFileBackedStorage(const std::string& directory);
+
+  bool isFileBacked() const {
+    return !fileBackedDirectory_.empty();
+  }
+
+  /// Returns the total size of the file backed storage and how much of it is
+  /// resident in memory.
+  std::pair<int64_t, int64_t> fileBackedBytes() const;
+
   int32_t compareRows(
       const char* left,
       const char* right,
@@ -1158,6 +1193,12 @@ class RowContainer {
       const char* row,
       int32_t offset);
 
+  // Returns the serialization of the complex type value at 'offset' in 'row'
+  // if it is contiguous in memory, otherwise std::nullopt.
+  static std::optional<std::string_view> contiguousComplexValue(
+      const char* row,
+      int32_t offset);
+
   template <bool typeProvidesCustomComparison, TypeKind Kind>
   void hashTyped(
       const Type* type,
@@ -1488,7 +1529,11 @@ class RowContainer {
   // True if normalized keys are enabled in initial state.
   const bool hasNormalizedKeys_;
 
-  const std::unique_ptr<HashStringAllocator> stringAllocator_;
+  std::unique_ptr<HashStringAllocator> stringAllocator_;
+
+  // Directory for file backed storage. Empty unless enableFileBackedStorage()
+  // was called.
+  std::string fileBackedDirectory_;
 
   // Indicates if we can add new row to this row container. It is set to false
   // after user calls 'getRowPartitions()' to create 'rowPartitions' object for
@@ -1757,6 +1802,33 @@ inline bool RowContainer::equals(
   }
 }
 
+template <bool mayHaveNulls, TypeKind Kind>
+inline bool RowContainer::equalsTyped(
+    const char* row,
+    RowColumn column,
+    const DecodedVector& decoded,
+    vector_size_t index) const {
+  if constexpr (mayHaveNulls) {
+    const bool rowIsNull = isNullAt(row, column.nullByte(), column.nullMask());
+    const bool indexIsNull = decoded.isNullAt(index);
+    if (rowIsNull || indexIsNull) {
+      return rowIsNull == indexIsNull;
+    }
+  }
+  if constexpr (Kind == TypeKind::VARCHAR || Kind == TypeKind::VARBINARY) {
+    const auto stored = valueAt<StringView>(row, column.offset());
+    const auto value = decoded.valueAt<StringView>(index);
+    if (stored.size() != value.size()) {
+      return false;
+    }
+    // A string that is not inlined may be split over several allocations.
+    if (stored.isInline()) {
+      return stored == value;
+    }
+  }
+  return equalsNoNulls<false, Kind>(row, column.offset(), decoded, index);
+}
+
 inline int RowContainer::compare(
     const char* row,
     RowColumn column,
@@ -81,6 +81,23 @@ class ScaleWriterPartitioningLocalPartition : public LocalPartition {
   std::vector<vector_size_t*> rawWriterAssignmmentIndicesBuffers_;
 };
 
+/// Hash repartitioning local partition which splits hot partitions across
+/// several consumer drivers. Used in front of partial and intermediate
+/// aggregations and hash join probes, which accept the rows of one partition at
+/// several drivers. Shares the partition rebalancing of the writer scaling.
+class SkewedLocalPartition : public ScaleWriterPartitioningLocalPartition {
+ public:
+  SkewedLocalPartition(
+      int32_t operatorId,
+      DriverCtx* ctx,
+      const std::shared_ptr<const core::LocalPartitionNode>& planNode)
+      : ScaleWriterPartitioningLocalPartition(operatorId, ctx, planNode) {}
+
+  std::string toString() const override {
+    return fmt::format("SkewedLocalPartition({})", numPartitions_);
+  }
+};
+
 /// Customized local partition for writer scaling for un-partitioned table
 /// write.
 class ScaleWriterLocalPartition : public LocalPartition {
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/ScaledDriverController.h"
+
+#include "velox/exec/DriverScheduler.h"
+#include "velox/exec/LocalPartition.h"
+
+namespace facebook::velox::exec {
+
+ScaledDriverController::ScaledDriverController(
+    memory::MemoryPool* queryPool,
+    std::shared_ptr<LocalExchangeMemoryManager> memoryManager,
+    uint32_t numDrivers,
+    double scaleUpMemoryUsageRatio,
+    folly::Executor* executor)
+    : queryPool_(queryPool),
+      memoryManager_(std::move(memoryManager)),
+      numDrivers_(numDrivers),
+      scaleUpMemoryUsageRatio_(scaleUpMemoryUsageRatio),
+      executor_(executor) {
+  VELOX_CHECK_NOT_NULL(queryPool_);
+  VELOX_CHECK_NOT_NULL(memoryManager_);
+  VELOX_CHECK_GT(numDrivers_, 0);
+  VELOX_CHECK_GE(scaleUpMemoryUsageRatio_, 0.0);
+  VELOX_CHECK_LE(scaleUpMemoryUsageRatio_, 1.0);
+}
+
+uint32_t ScaledDriverController::nextDriver() {
+  const auto batch = nextBatch_++;
+  if (batch % kBatchesPerScaleUpCheck == 0 &&
+      numRunningDrivers_ < numDrivers_) {
+    std::lock_guard<std::mutex> l(mutex_);
+    tryScaleUpLocked(batch);
+  }
+  return batch % numRunningDrivers_;
+}
+
+void ScaledDriverController::tryScaleUpLocked(uint64_t batch) {
+  const auto numRunningDrivers = numRunningDrivers_.load();
+  if (numRunningDrivers == numDrivers_) {
+    return;
+  }
+  // Gives the last added driver time to catch up before adding another one.
+  if (batch < lastScaleBatch_ + kBatchesPerScaleUpCheck * numRunningDrivers) {
+    return;
+  }
+  if (memoryManager_->bufferedBytes() < memoryManager_->maxBufferBytes() / 2) {
+    return;
+  }
+  if (queryPool_->reservedBytes() >=
+      queryPool_->maxCapacity() * scaleUpMemoryUsageRatio_) {
+    return;
+  }
+  if (!hasIdleThreads()) {
+    return;
+  }
+  numRunningDrivers_ = numRunningDrivers + 1;
+  maxRunningDrivers_ = std::max(maxRunningDrivers_, numRunningDrivers + 1);
+  ++numScaleUps_;
+  lastScaleBatch_ = batch;
+  numFetches_ = 0;
+  numStarvedFetches_ = 0;
+}
+
+void ScaledDriverController::recordConsumerFetch(
+    uint32_t driverIdx,
+    bool starved) {
+  VELOX_CHECK_LT(driverIdx, numDrivers_);
+  std::lock_guard<std::mutex> l(mutex_);
+  const auto numRunningDrivers = numRunningDrivers_.load();
+  if (driverIdx >= numRunningDrivers) {
+    // A parked driver draining what was sent to it before it was parked.
+    return;
+  }
+  ++numFetches_;
+  if (starved) {
+    ++numStarvedFetches_;
+  }
+  if (numFetches_ < kFetchesPerScaleDownCheck) {
+    return;
+  }
+  // Parks a driver if the running ones wait for data in 3 fetches out of 4
+  // while the exchange buffers are mostly empty.
+  if (numRunningDrivers > 1 && numStarvedFetches_ * 4 >= numFetches_ * 3 &&
+      memoryManager_->bufferedBytes() < memoryManager_->maxBufferBytes() / 4) {
+    numRunningDrivers_ = numRunningDrivers - 1;
+    ++numScaleDowns_;
+    lastScaleBatch_ = nextBatch_;
+  }
+  numFetches_ = 0;
+  numStarvedFetches_ = 0;
+}
+
+bool ScaledDriverController::hasIdleThreads() const {
+  if (const auto* scheduler = dynamic_cast<DriverScheduler*>(executor_)) {
+    return scheduler->numQueued() < scheduler->numThreads();
+  }
+  return true;
+}
+
+ScaledDriverController::Stats ScaledDriverController::stats() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  return {
+      .numRunningDrivers = numRunningDrivers_,
+      .maxRunningDrivers = maxRunningDrivers_,
+      .numScaleUps = numScaleUps_,
+      .numScaleDowns = numScaleDowns_};
+}
+
+std::string ScaledDriverController::Stats::toString() const {
+  return fmt::format(
+      "numRunningDrivers: {}, maxRunningDrivers: {}, numScaleUps: {}, "
+      "numScaleDowns: {}",
+      numRunningDrivers,
+      maxRunningDrivers,
+      numScaleUps,
+      numScaleDowns);
+}
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <folly/Executor.h>
+
+#include "velox/common/memory/Memory.h"
+
+namespace facebook::velox::exec {
+
+class LocalExchangeMemoryManager;
+
+/// Controls the number of running consumer drivers of a round robin local
+/// exchange based on how fast they consume the exchange data. The producers
+/// send data only to the queues of the first 'numRunningDrivers' consumers. The
+/// other consumers stay blocked on their empty queues. They do not take a
+/// thread and their operators do not allocate memory until they get data, or
+/// until the producers finish, at which point they finish right away.
+///
+/// Starts with one running driver. Adds a driver when the exchange buffers hold
+/// at least half of their capacity, i.e. the running consumers do not keep up
+/// with the producers, the query memory usage is below
+/// 'scaleUpMemoryUsageRatio' of the query capacity and the executor has idle
+/// threads. Parks the last running driver, i.e. stops sending data to it, when
+/// the running consumers mostly find their queues empty and wait for the
+/// producers.
+class ScaledDriverController {
+ public:
+  ScaledDriverController(
+      memory::MemoryPool* queryPool,
+      std::shared_ptr<LocalExchangeMemoryManager> memoryManager,
+      uint32_t numDrivers,
+      double scaleUpMemoryUsageRatio,
+      folly::Executor* executor);
+
+  ScaledDriverController(const ScaledDriverController&) = delete;
+  ScaledDriverController& operator=(const ScaledDriverController&) = delete;
+
+  /// Invoked by a producer to get the consumer driver to send the next batch
+  /// to. May add a running driver.
+  uint32_t nextDriver();
+
+  /// Invoked by the consumer driver 'driverIdx' each time it fetches from its
+  /// queue. 'starved' is true if the queue was empty and the consumer has to
+  /// wait for the producers. May park a running driver.
+  void recordConsumerFetch(uint32_t driverIdx, bool starved);
+
+  struct Stats {
+    uint32_t numRunningDrivers{0};
+    uint32_t maxRunningDrivers{0};
+    uint32_t numScaleUps{0};
+    uint32_t numScaleDowns{0};
+
+    std::string toString() const;
+  };
+
+  Stats stats() const;
+
+ private:
+  // Number of batches sent by the producers between scale up decisions.
+  static constexpr uint64_t kBatchesPerScaleUpCheck = 16;
+
+  // Number of fetches by the running consumers between scale down decisions.
+  static constexpr uint32_t kFetchesPerScaleDownCheck = 64;
+
+  void tryScaleUpLocked(uint64_t batch);
+
+  // Returns true if the executor has idle threads to run another driver.
+  bool hasIdleThreads() const;
+
+  memory::MemoryPool* const queryPool_;
+  const std::shared_ptr<LocalExchangeMemoryManager> memoryManager_;
+  const uint32_t numDrivers_;
+  const double scaleUpMemoryUsageRatio_;
+  folly::Executor* const executor_;
+
+  std::atomic<uint32_t> numRunningDrivers_{1};
+  std::atomic<uint64_t> nextBatch_{0};
+
+  mutable std::mutex mutex_;
+  // The batch number at the last change of 'numRunningDrivers_'.
+  uint64_t lastScaleBatch_{0};
+  // Fetches and starved fetches by the running consumers since the last
+  // scale down decision.
+  uint32_t numFetches_{0};
+  uint32_t numStarvedFetches_{0};
+  uint32_t maxRunningDrivers_{1};
+  uint32_t numScaleUps_{0};
+  uint32_t numScaleDowns_{0};
+};
+
+} // namespace facebook::velox::exec
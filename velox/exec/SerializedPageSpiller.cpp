@@ -213,7 +213,17 @@ std::shared_ptr<SerializedPage> SerializedPageSpillReader::unspillNextPage() {
   // Read payload
   VELOX_CHECK_GE(curFileStream_->remainingSize(), iobufBytes);
   void* rawBuf = pool_->allocate(iobufBytes);
-  curFileStream_->readBytes(reinterpret_cast<uint8_t*>(rawBuf), iobufBytes);
+  uint64_t readTimeNs{0};
+  {
+    NanosecondTimer timer(&readTimeNs);
+    curFileStream_->readBytes(reinterpret_cast<uint8_t*>(rawBuf), iobufBytes);
+  }
+  if (spillStats_ != nullptr) {
+    auto lockedStats = spillStats_->wlock();
+    ++lockedStats->spillReads;
+    lockedStats->spillReadBytes += iobufBytes;
+    lockedStats->spillReadTimeNanos += readTimeNs;
+  }
 
   auto* userData = new FreeData{pool_->shared_from_this(), iobufBytes};
   auto iobuf =
@@ -81,12 +81,23 @@ struct SetAccumulator {
     VELOX_DCHECK(!arrayVector.isNullAt(index));
     const auto size = arrayVector.sizeAt(index);
     const auto offset = arrayVector.offsetAt(index);
+    reserveForMerge(size);
 
     for (auto i = 0; i < size; ++i) {
       addValue(values, offset + i, allocator);
     }
   }
 
+  /// Sizes an empty set for 'numValues' values. The values of an intermediate
+  /// result are distinct, so merging one into a new group, as happens when
+  /// restoring spilled groups, then inserts without rehashing. No-op if the
+  /// set already has values since the merged values may overlap with them.
+  void reserveForMerge(vector_size_t numValues) {
+    if (uniqueValues.empty()) {
+      uniqueValues.reserve(numValues);
+    }
+  }
+
   /// Adds non-null value if new. No-op if the value is NULL or was added
   /// before.
   void addNonNullValue(
@@ -181,6 +192,7 @@ struct StringViewSetAccumulator {
     VELOX_DCHECK(!arrayVector.isNullAt(index));
     const auto size = arrayVector.sizeAt(index);
     const auto offset = arrayVector.offsetAt(index);
+    base.reserveForMerge(size);
 
     for (auto i = 0; i < size; ++i) {
       addValue(values, offset + i, allocator);
@@ -281,6 +293,7 @@ struct ComplexTypeSetAccumulator {
     VELOX_DCHECK(!arrayVector.isNullAt(index));
     const auto size = arrayVector.sizeAt(index);
     const auto offset = arrayVector.offsetAt(index);
+    base.reserveForMerge(size);
 
     for (auto i = 0; i < size; ++i) {
       addValue(values_2, offset + i, allocator);
@@ -15,11 +15,87 @@
  */
 
 #include "SortBuffer.h"
+#include "velox/common/base/AsyncSource.h"
 #include "velox/exec/MemoryReclaimer.h"
 #include "velox/exec/Spiller.h"
 
 namespace facebook::velox::exec {
 
+namespace {
+using SortedRows = std::vector<char*, memory::StlAllocator<char*>>;
+
+// A range of sorted rows to merge with TreeOfLosers.
+class SortedRunStream : public MergeStream {
+ public:
+  SortedRunStream(
+      const RowContainer* data,
+      const std::vector<CompareFlags>& compareFlags,
+      char* const* begin,
+      char* const* end)
+      : data_(data), compareFlags_(compareFlags), current_(begin), end_(end) {}
+
+  bool hasData() const override {
+    return current_ < end_;
+  }
+
+  bool operator<(const MergeStream& other) const override {
+    return data_->compareRows(
+               *current_,
+               *static_cast<const SortedRunStream&>(other).current_,
+               compareFlags_) < 0;
+  }
+
+  char* pop() {
+    return *current_++;
+  }
+
+ private:
+  const RowContainer* const data_;
+  const std::vector<CompareFlags>& compareFlags_;
+  char* const* current_;
+  char* const* const end_;
+};
+
+// Runs 'work' for each of 'numItems' items on 'executor' and waits for all
+// of them. Rethrows the first error after all items have finished.
+void runParallel(
+    folly::Executor* executor,
+    int32_t numItems,
+    const std::function<void(int32_t)>& work) {
+  // Passing driver context directly to avoid cross thread access to thread
+  // local driver thread context.
+  const DriverCtx* driverCtx{nullptr};
+  if (const auto* driverThreadCtx = driverThreadContext()) {
+    driverCtx = driverThreadCtx->driverCtx();
+  }
+  std::vector<std::shared_ptr<AsyncSource<bool>>> items;
+  items.reserve(numItems);
+  for (auto i = 0; i < numItems; ++i) {
+    items.push_back(std::make_shared<AsyncSource<bool>>([&work, i]() {
+      work(i);
+      return std::make_unique<bool>(true);
+    }));
+    executor->add([driverCtx, item = items.back()]() {
+      ScopedDriverThreadContext scopedDriverThreadContext(driverCtx);
+      item->prepare();
+    });
+  }
+  // All items must be waited for also in case of error because they
+  // reference the caller's state.
+  std::exception_ptr error;
+  for (auto& item : items) {
+    try {
+      item->move();
+    } catch (const std::exception&) {
+      error = std::current_exception();
+    }
+  }
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+} // namespace
+
 SortBuffer::SortBuffer(
     const RowTypePtr& input,
     const std::vector<column_index_t>& sortColumnIndices,
@@ -28,7 +104,9 @@ SortBuffer::SortBuffer(
     tsan_atomic<bool>* nonReclaimableSection,
     common::PrefixSortConfig prefixSortConfig,
     const common::SpillConfig* spillConfig,
-    folly::Synchronized<velox::common::SpillStats>* spillStats)
+    folly::Synchronized<velox::common::SpillStats>* spillStats,
+    folly::Executor* sortExecutor,
+    uint32_t maxSortThreads)
     : input_(input),
       sortCompareFlags_(sortCompareFlags),
       pool_(pool),
@@ -36,6 +114,8 @@ SortBuffer::SortBuffer(
       prefixSortConfig_(prefixSortConfig),
       spillConfig_(spillConfig),
       spillStats_(spillStats),
+      sortExecutor_(sortExecutor),
+      maxSortThreads_(std::max<uint32_t>(maxSortThreads, 1)),
       sortedRows_(0, memory::StlAllocator<char*>(*pool)) {
   VELOX_CHECK_GE(input_->size(), sortCompareFlags_.size());
   VELOX_CHECK_GT(sortCompareFlags_.size(), 0);
@@ -131,8 +211,7 @@ void SortBuffer::noMoreInput() {
     sortedRows_.resize(numInputRows_);
     RowContainerIterator iter;
     data_->listRows(&iter, numInputRows_, sortedRows_.data());
-    PrefixSort::sort(
-        data_.get(), sortCompareFlags_, prefixSortConfig_, pool_, sortedRows_);
+    sortRows();
   } else {
     // Spill the remaining in-memory state to disk if spilling has been
     // triggered on this sort buffer. This is to simplify query OOM prevention
@@ -147,6 +226,99 @@ void SortBuffer::noMoreInput() {
   pool_->release();
 }
 
+uint32_t SortBuffer::numSortRuns() const {
+  if (sortExecutor_ == nullptr) {
+    return 1;
+  }
+  return std::clamp<uint64_t>(
+      numInputRows_ / kMinParallelSortRunRows, 1, maxSortThreads_);
+}
+
+void SortBuffer::sortRows() {
+  const auto numRuns = numSortRuns();
+  if (numRuns == 1) {
+    PrefixSort::sort(
+        data_.get(), sortCompareFlags_, prefixSortConfig_, pool_, sortedRows_);
+    return;
+  }
+
+  // Sorts the runs.
+  std::vector<SortedRows> runs;
+  runs.reserve(numRuns);
+  const auto runSize = bits::divRoundUp(sortedRows_.size(), numRuns);
+  for (auto i = 0; i < numRuns; ++i) {
+    const auto begin = std::min(i * runSize, sortedRows_.size());
+    const auto end = std::min(begin + runSize, sortedRows_.size());
+    runs.emplace_back(
+        sortedRows_.begin() + begin,
+        sortedRows_.begin() + end,
+        memory::StlAllocator<char*>(*pool_));
+  }
+  runParallel(sortExecutor_, numRuns, [&](int32_t i) {
+    PrefixSort::sort(
+        data_.get(), sortCompareFlags_, prefixSortConfig_, pool_, runs[i]);
+  });
+
+  // Picks numRuns - 1 splitters from a sample of every run so that the key
+  // ranges between splitters have about the same number of rows.
+  constexpr int32_t kSamplesPerRun = 64;
+  const auto lessThan = [&](const char* left, const char* right) {
+    return data_->compareRows(left, right, sortCompareFlags_) < 0;
+  };
+  std::vector<char*> samples;
+  samples.reserve(numRuns * kSamplesPerRun);
+  for (const auto& run : runs) {
+    for (auto i = 0; i < kSamplesPerRun; ++i) {
+      samples.push_back(run[run.size() * i / kSamplesPerRun]);
+    }
+  }
+  std::sort(samples.begin(), samples.end(), lessThan);
+  std::vector<char*> splitters(numRuns - 1);
+  for (auto i = 1; i < numRuns; ++i) {
+    splitters[i - 1] = samples[samples.size() * i / numRuns];
+  }
+
+  // The bounds of the key ranges in each run and the offset of each range in
+  // the result.
+  std::vector<std::vector<size_t>> bounds(numRuns);
+  std::vector<size_t> rangeOffsets(numRuns + 1, 0);
+  for (auto i = 0; i < numRuns; ++i) {
+    const auto& run = runs[i];
+    bounds[i].push_back(0);
+    for (auto* splitter : splitters) {
+      bounds[i].push_back(
+          std::lower_bound(
+              run.begin() + bounds[i].back(), run.end(), splitter, lessThan) -
+          run.begin());
+    }
+    bounds[i].push_back(run.size());
+    for (auto range = 0; range < numRuns; ++range) {
+      rangeOffsets[range + 1] += bounds[i][range + 1] - bounds[i][range];
+    }
+  }
+  for (auto range = 0; range < numRuns; ++range) {
+    rangeOffsets[range + 1] += rangeOffsets[range];
+  }
+  VELOX_CHECK_EQ(rangeOffsets.back(), sortedRows_.size());
+
+  // Merges each key range of the runs into its place in 'sortedRows_'.
+  runParallel(sortExecutor_, numRuns, [&](int32_t range) {
+    std::vector<std::unique_ptr<SortedRunStream>> streams;
+    for (auto i = 0; i < numRuns; ++i) {
+      streams.push_back(std::make_unique<SortedRunStream>(
+          data_.get(),
+          sortCompareFlags_,
+          runs[i].data() + bounds[i][range],
+          runs[i].data() + bounds[i][range + 1]));
+    }
+    TreeOfLosers<SortedRunStream> merger(std::move(streams));
+    auto* output = sortedRows_.data() + rangeOffsets[range];
+    while (auto* stream = merger.next()) {
+      *output++ = stream->pop();
+    }
+  });
+}
+
 RowVectorPtr SortBuffer::getOutput(vector_size_t maxOutputRows) {
   SCOPE_EXIT {
     pool_->release();
@@ -310,8 +482,9 @@ void SortBuffer::ensureSortFits() {
   }
 
   // The memory for std::vector sorted rows and prefix sort required buffer.
+  // A parallel sort copies the sorted rows into runs.
   uint64_t sortBufferToReserve =
-      numInputRows_ * sizeof(char*) +
+      numInputRows_ * sizeof(char*) * (numSortRuns() > 1 ? 2 : 1) +
       PrefixSort::maxRequiredBytes(
           data_.get(), sortCompareFlags_, prefixSortConfig_, pool_);
   {
@@ -488,7 +661,11 @@ void SortBuffer::prepareOutputWithSpill() {
 
   VELOX_CHECK_EQ(spillPartitionSet_.size(), 1);
   spillMerger_ = spillPartitionSet_.begin()->second->createOrderedReader(
-      spillConfig_->readBufferSize, pool(), spillStats_);
+      spillConfig_->readBufferSize,
+      pool(),
+      spillStats_,
+      spillConfig_->numReadAheadBuffers,
+      spillConfig_->executor);
   spillPartitionSet_.clear();
 }
 } // namespace facebook::velox::exec
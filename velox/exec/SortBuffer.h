@@ -40,7 +40,12 @@ class SortBuffer {
       tsan_atomic<bool>* nonReclaimableSection,
       common::PrefixSortConfig prefixSortConfig,
       const common::SpillConfig* spillConfig = nullptr,
-      folly::Synchronized<velox::common::SpillStats>* spillStats = nullptr);
+      folly::Synchronized<velox::common::SpillStats>* spillStats = nullptr,
+      folly::Executor* sortExecutor = nullptr,
+      uint32_t maxSortThreads = 1);
+
+  /// Minimum number of rows per sorted run when sorting in parallel.
+  static constexpr uint64_t kMinParallelSortRunRows = 64 << 10;
 
   ~SortBuffer();
 
@@ -69,6 +74,11 @@ class SortBuffer {
 
   std::optional<uint64_t> estimateOutputRowSize() const;
 
+  /// Returns the number of rows added so far.
+  uint64_t numInputRows() const {
+    return numInputRows_;
+  }
+
  private:
   // Ensures there is sufficient memory reserved to process 'input'.
   void ensureInputFits(const VectorPtr& input);
@@ -83,6 +93,16 @@ class SortBuffer {
 
   void updateEstimatedOutputRowSize();
 
+  // Returns the number of runs to sort in parallel. 1 if the rows are sorted
+  // on the calling thread.
+  uint32_t numSortRuns() const;
+
+  // Sorts 'sortedRows_'. If there are enough rows and 'sortExecutor_' is set,
+  // splits the rows into runs that are sorted in parallel with PrefixSort.
+  // The runs are then split into key ranges at sampled splitters and the
+  // ranges are merged in parallel into 'sortedRows_'.
+  void sortRows();
+
   // Invoked to initialize or reset the reusable output buffer to get output.
   void prepareOutput(vector_size_t outputBatchSize);
 
@@ -127,6 +147,12 @@ class SortBuffer {
 
   folly::Synchronized<common::SpillStats>* const spillStats_;
 
+  // Runs the parallel sort if not null.
+  folly::Executor* const sortExecutor_;
+
+  // Maximum number of runs to sort in parallel.
+  const uint32_t maxSortThreads_;
+
   // The column projection map between 'input_' and 'spillerStoreType_' as sort
   // buffer stores the sort columns first in 'data_'.
   std::vector<IdentityProjection> columnMap_;
@@ -55,6 +55,11 @@ class SortWindowBuild : public WindowBuild {
 
   std::shared_ptr<WindowPartition> nextPartition() override;
 
+  /// Partitions of spilled input are read into the same rows one at a time.
+  bool supportsParallelPartitions() const override {
+    return merge_ == nullptr;
+  }
+
  private:
   void ensureInputFits(const RowVectorPtr& input);
 
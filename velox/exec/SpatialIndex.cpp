@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/SpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "velox/common/base/Exceptions.h"
+
+namespace facebook::velox::exec {
+
+void Envelope::expand(const Envelope& other) {
+  minX = std::min(minX, other.minX);
+  minY = std::min(minY, other.minY);
+  maxX = std::max(maxX, other.maxX);
+  maxY = std::max(maxY, other.maxY);
+}
+
+SpatialIndex::SpatialIndex(
+    const std::vector<Envelope>& envelopes,
+    int32_t nodeCapacity) {
+  VELOX_CHECK_GE(nodeCapacity, 2);
+  VELOX_CHECK_LE(envelopes.size(), std::numeric_limits<int32_t>::max());
+  const int32_t numEnvelopes = envelopes.size();
+  entries_.reserve(numEnvelopes);
+  for (int32_t i = 0; i < numEnvelopes; ++i) {
+    if (!envelopes[i].isEmpty()) {
+      entries_.push_back({envelopes[i], i});
+    }
+  }
+  if (entries_.empty()) {
+    return;
+  }
+  levels_.push_back(pack(entries_, nodeCapacity));
+  while (levels_.back().size() > 1) {
+    // Packing reorders the nodes of the current top level, which is fine
+    // because each node keeps its own child range.
+    auto parents = pack(levels_.back(), nodeCapacity);
+    levels_.push_back(std::move(parents));
+  }
+}
+
+template <typename T>
+std::vector<SpatialIndex::Node> SpatialIndex::pack(
+    std::vector<T>& items,
+    int32_t capacity) {
+  const auto centerX = [](const T& item) {
+    return item.envelope.minX + item.envelope.maxX;
+  };
+  const auto centerY = [](const T& item) {
+    return item.envelope.minY + item.envelope.maxY;
+  };
+
+  // Cut the items sorted on x into about sqrt(numNodes) vertical slices of
+  // whole nodes, then sort each slice on y.
+  const int64_t numItems = items.size();
+  const int64_t numNodes = (numItems + capacity - 1) / capacity;
+  const int64_t numSlices = std::ceil(std::sqrt(numNodes));
+  const int64_t sliceSize = ((numNodes + numSlices - 1) / numSlices) * capacity;
+  std::sort(items.begin(), items.end(), [&](const T& left, const T& right) {
+    return centerX(left) < centerX(right);
+  });
+  for (int64_t begin = 0; begin < numItems; begin += sliceSize) {
+    const auto end = std::min(begin + sliceSize, numItems);
+    std::sort(
+        items.begin() + begin,
+        items.begin() + end,
+        [&](const T& left, const T& right) {
+          return centerY(left) < centerY(right);
+        });
+  }
+
+  std::vector<Node> nodes;
+  nodes.reserve(numNodes);
+  for (int64_t begin = 0; begin < numItems; begin += capacity) {
+    const auto end = std::min<int64_t>(begin + capacity, numItems);
+    Node node{Envelope::empty(), int32_t(begin), int32_t(end)};
+    for (auto i = begin; i < end; ++i) {
+      node.envelope.expand(items[i].envelope);
+    }
+    nodes.push_back(node);
+  }
+  return nodes;
+}
+
+void SpatialIndex::query(const Envelope& probe, std::vector<int32_t>& result)
+    const {
+  if (levels_.empty() || probe.isEmpty()) {
+    return;
+  }
+  const auto numResults = result.size();
+  std::vector<std::pair<int32_t, int32_t>> stack;
+  stack.emplace_back(levels_.size() - 1, 0);
+  while (!stack.empty()) {
+    const auto [level, index] = stack.back();
+    stack.pop_back();
+    const auto& node = levels_[level][index];
+    if (!node.envelope.intersects(probe)) {
+      continue;
+    }
+    if (level == 0) {
+      for (auto i = node.begin; i < node.end; ++i) {
+        if (entries_[i].envelope.intersects(probe)) {
+          result.push_back(entries_[i].id);
+        }
+      }
+      continue;
+    }
+    for (auto i = node.begin; i < node.end; ++i) {
+      stack.emplace_back(level - 1, i);
+    }
+  }
+  std::sort(result.begin() + numResults, result.end());
+}
+
+} // namespace facebook::velox::exec
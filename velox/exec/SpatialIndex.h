@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace facebook::velox::exec {
+
+/// Axis aligned bounding box of a geometry. An envelope whose min is greater
+/// than its max, or that has NaN bounds, is empty and intersects nothing.
+struct Envelope {
+  double minX;
+  double minY;
+  double maxX;
+  double maxY;
+
+  static constexpr Envelope empty() {
+    return {
+        std::numeric_limits<double>::infinity(),
+        std::numeric_limits<double>::infinity(),
+        -std::numeric_limits<double>::infinity(),
+        -std::numeric_limits<double>::infinity()};
+  }
+
+  bool isEmpty() const {
+    return !(minX <= maxX && minY <= maxY);
+  }
+
+  /// Returns true if the closed boxes 'this' and 'other' share a point.
+  bool intersects(const Envelope& other) const {
+    return minX <= other.maxX && other.minX <= maxX && minY <= other.maxY &&
+        other.minY <= maxY;
+  }
+
+  /// Grows 'this' to cover 'other'.
+  void expand(const Envelope& other);
+};
+
+/// Immutable R-tree over a set of envelopes, bulk loaded with Sort-Tile-
+/// Recursive (STR) packing. Nodes are completely filled and stored level by
+/// level in flat arrays, so a query touches a few contiguous runs of memory.
+/// Used to find the candidate pairs of a spatial join before evaluating the
+/// exact geometric predicate.
+class SpatialIndex {
+ public:
+  static constexpr int32_t kDefaultNodeCapacity = 16;
+
+  /// Indexes 'envelopes'. Empty envelopes are not indexed and never returned
+  /// by query().
+  explicit SpatialIndex(
+      const std::vector<Envelope>& envelopes,
+      int32_t nodeCapacity = kDefaultNodeCapacity);
+
+  /// Appends to 'result', in increasing order, the positions in the
+  /// constructor's 'envelopes' of the envelopes that intersect 'probe'.
+  void query(const Envelope& probe, std::vector<int32_t>& result) const;
+
+  /// Returns the number of indexed envelopes.
+  int32_t size() const {
+    return entries_.size();
+  }
+
+  /// Returns the number of levels of the tree, 0 if the index is empty.
+  int32_t numLevels() const {
+    return levels_.size();
+  }
+
+ private:
+  struct Entry {
+    Envelope envelope;
+    int32_t id;
+  };
+
+  // Covers the range [begin, end) of entries for a leaf, or of nodes of the
+  // next lower level otherwise.
+  struct Node {
+    Envelope envelope;
+    int32_t begin;
+    int32_t end;
+  };
+
+  // Sorts 'items' in STR order. Returns one parent node for each group of
+  // 'capacity' consecutive items.
+  template <typename T>
+  static std::vector<Node> pack(std::vector<T>& items, int32_t capacity);
+
+  std::vector<Entry> entries_;
+
+  // levels_[0] holds the leaves and levels_.back() the single root.
+  std::vector<std::vector<Node>> levels_;
+};
+
+} // namespace facebook::velox::exec
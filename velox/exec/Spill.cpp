@@ -278,13 +278,20 @@ std::unique_ptr<UnorderedStreamReader<BatchStream>>
 SpillPartition::createUnorderedReader(
     uint64_t bufferSize,
     memory::MemoryPool* pool,
-    folly::Synchronized<common::SpillStats>* spillStats) {
+    folly::Synchronized<common::SpillStats>* spillStats,
+    uint32_t numReadAheadBuffers,
+    folly::Executor* readAheadExecutor) {
   VELOX_CHECK_NOT_NULL(pool);
   std::vector<std::unique_ptr<BatchStream>> streams;
   streams.reserve(files_.size());
   for (auto& fileInfo : files_) {
-    streams.push_back(FileSpillBatchStream::create(
-        SpillReadFile::create(fileInfo, bufferSize, pool, spillStats)));
+    streams.push_back(FileSpillBatchStream::create(SpillReadFile::create(
+        fileInfo,
+        bufferSize,
+        pool,
+        spillStats,
+        numReadAheadBuffers,
+        readAheadExecutor)));
   }
   files_.clear();
   return std::make_unique<UnorderedStreamReader<BatchStream>>(
@@ -295,12 +302,19 @@ std::unique_ptr<TreeOfLosers<SpillMergeStream>>
 SpillPartition::createOrderedReader(
     uint64_t bufferSize,
     memory::MemoryPool* pool,
-    folly::Synchronized<common::SpillStats>* spillStats) {
+    folly::Synchronized<common::SpillStats>* spillStats,
+    uint32_t numReadAheadBuffers,
+    folly::Executor* readAheadExecutor) {
   std::vector<std::unique_ptr<SpillMergeStream>> streams;
   streams.reserve(files_.size());
   for (auto& fileInfo : files_) {
-    streams.push_back(FileSpillMergeStream::create(
-        SpillReadFile::create(fileInfo, bufferSize, pool, spillStats)));
+    streams.push_back(FileSpillMergeStream::create(SpillReadFile::create(
+        fileInfo,
+        bufferSize,
+        pool,
+        spillStats,
+        numReadAheadBuffers,
+        readAheadExecutor)));
   }
   files_.clear();
   // Check if the partition is empty or not.
@@ -677,11 +691,10 @@ void SpillPartitionFunction::partition(
   rows_.setAll();
 
   hashes_.resize(size);
-  for (auto i = 0; i < hashers_.size(); ++i) {
-    auto& hasher = hashers_[i];
-    hashers_[i]->decode(*input.childAt(hasher->channel()), rows_);
-    hashers_[i]->hash(rows_, i > 0, hashes_);
+  for (auto& hasher : hashers_) {
+    hasher->decode(*input.childAt(hasher->channel()), rows_);
   }
+  VectorHasher::hashAll(hashers_, rows_, hashes_);
 
   partitionIds.resize(size);
 
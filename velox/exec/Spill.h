@@ -418,6 +418,13 @@ class SpillPartitionFunction {
       const RowVector& input,
       std::vector<SpillPartitionId>& partitionIds);
 
+  /// Returns the key hashes of the rows from the last partition() call. These
+  /// are the hashes computed by VectorHasher::hash() over the key channels in
+  /// order, so a hash table in kHash mode over the same keys can reuse them.
+  const raw_vector<uint64_t>& hashes() const {
+    return hashes_;
+  }
+
  private:
   const SpillPartitionIdLookup lookup_;
 
@@ -473,24 +480,30 @@ class SpillPartition {
   /// Invoked to create an unordered stream reader from this spill partition.
   /// The created reader will take the ownership of the spill files.
   /// 'bufferSize' specifies the read size from the storage. If the file
-  /// system supports async read mode, then reader allocates two buffers with
-  /// one buffer prefetch ahead. 'spillStats' is provided to collect the spill
-  /// stats when reading data from spilled files.
+  /// system supports async read mode or 'readAheadExecutor' is set, then
+  /// reader allocates 'numReadAheadBuffers' more buffers per file to prefetch
+  /// ahead. 'spillStats' is provided to collect the spill stats when reading
+  /// data from spilled files.
   std::unique_ptr<UnorderedStreamReader<BatchStream>> createUnorderedReader(
       uint64_t bufferSize,
       memory::MemoryPool* pool,
-      folly::Synchronized<common::SpillStats>* spillStats);
+      folly::Synchronized<common::SpillStats>* spillStats,
+      uint32_t numReadAheadBuffers = 1,
+      folly::Executor* readAheadExecutor = nullptr);
 
   /// Invoked to create an ordered stream reader from this spill partition.
   /// The created reader will take the ownership of the spill files.
   /// 'bufferSize' specifies the read size from the storage. If the file
-  /// system supports async read mode, then reader allocates two buffers with
-  /// one buffer prefetch ahead. 'spillStats' is provided to collect the spill
-  /// stats when reading data from spilled files.
+  /// system supports async read mode or 'readAheadExecutor' is set, then
+  /// reader allocates 'numReadAheadBuffers' more buffers per file to prefetch
+  /// ahead. 'spillStats' is provided to collect the spill stats when reading
+  /// data from spilled files.
   std::unique_ptr<TreeOfLosers<SpillMergeStream>> createOrderedReader(
       uint64_t bufferSize,
       memory::MemoryPool* pool,
-      folly::Synchronized<common::SpillStats>* spillStats);
+      folly::Synchronized<common::SpillStats>* spillStats,
+      uint32_t numReadAheadBuffers = 1,
+      folly::Executor* readAheadExecutor = nullptr);
 
   std::string toString() const;
 
@@ -15,10 +15,14 @@
  */
 
 #include "velox/exec/SpillFile.h"
+#include <gflags/gflags.h>
+#include <numeric>
 #include "velox/common/base/RuntimeMetrics.h"
 #include "velox/common/file/FileSystems.h"
 #include "velox/vector/VectorStream.h"
 
+DECLARE_bool(velox_spill_io_uring);
+
 namespace facebook::velox::exec {
 namespace {
 // Spilling currently uses the default PrestoSerializer which by default
@@ -27,6 +31,21 @@ namespace {
 // nanosecond precision, we use this serde option to ensure the serializer
 // preserves precision.
 static const bool kDefaultUseLosslessTimestamp = true;
+
+// The batch header holds the row count and the column count as int32_t,
+// followed by the int64_t byte size of each column page.
+uint64_t batchHeaderSize(size_t numColumns) {
+  return 2 * sizeof(int32_t) + numColumns * sizeof(int64_t);
+}
+
+std::vector<RowTypePtr> makeColumnTypes(const RowTypePtr& type) {
+  std::vector<RowTypePtr> columnTypes;
+  columnTypes.reserve(type->size());
+  for (auto i = 0; i < type->size(); ++i) {
+    columnTypes.push_back(ROW({type->nameOf(i)}, {type->childAt(i)}));
+  }
+  return columnTypes;
+}
 } // namespace
 
 std::unique_ptr<SpillWriteFile> SpillWriteFile::create(
@@ -43,13 +62,13 @@ SpillWriteFile::SpillWriteFile(
     const std::string& fileCreateConfig)
     : id_(id), path_(fmt::format("{}-{}", pathPrefix, ordinalCounter_++)) {
   auto fs = filesystems::getFileSystem(path_, nullptr);
-  file_ = fs->openFileForWrite(
-      path_,
-      filesystems::FileOptions{
-          {{filesystems::FileOptions::kFileCreateConfig.toString(),
-            fileCreateConfig}},
-          nullptr,
-          std::nullopt});
+  filesystems::FileOptions options{
+      {{filesystems::FileOptions::kFileCreateConfig.toString(),
+        fileCreateConfig}},
+      nullptr,
+      std::nullopt};
+  options.useIoUring = FLAGS_velox_spill_io_uring;
+  file_ = fs->openFileForWrite(path_, options);
 }
 
 void SpillWriteFile::finish() {
@@ -218,15 +237,30 @@ void SpillWriter::flushBuffer(
     uint64_t& writtenBytes,
     uint64_t& flushTimeNs,
     uint64_t& writeTimeNs) {
-  IOBufOutputStream out(
-      *pool_, nullptr, std::max<int64_t>(64 * 1024, batch_->size()));
+  const auto numColumns = columnBatches_.size();
+  auto iobuf = folly::IOBuf::create(batchHeaderSize(numColumns));
+  auto* header = iobuf->writableData();
+  VELOX_CHECK_LE(numBufferedRows_, std::numeric_limits<int32_t>::max());
+  *reinterpret_cast<int32_t*>(header) = numBufferedRows_;
+  *reinterpret_cast<int32_t*>(header + sizeof(int32_t)) = numColumns;
+  auto* columnSizes = reinterpret_cast<int64_t*>(header + 2 * sizeof(int32_t));
+  iobuf->append(batchHeaderSize(numColumns));
   {
     NanosecondTimer timer(&flushTimeNs);
-    batch_->flush(&out);
+    for (auto i = 0; i < numColumns; ++i) {
+      IOBufOutputStream out(
+          *pool_,
+          nullptr,
+          std::max<int64_t>(64 * 1024, columnBatches_[i]->size()));
+      columnBatches_[i]->flush(&out);
+      auto columnBuf = out.getIOBuf();
+      columnSizes[i] = columnBuf->computeChainDataLength();
+      iobuf->prependChain(std::move(columnBuf));
+    }
   }
-  batch_.reset();
+  columnBatches_.clear();
+  numBufferedRows_ = 0;
 
-  auto iobuf = out.getIOBuf();
   {
     NanosecondTimer timer(&writeTimeNs);
     writtenBytes = file->write(std::move(iobuf));
@@ -237,23 +271,47 @@ uint64_t SpillWriter::write(
     const RowVectorPtr& rows,
     const folly::Range<IndexRange*>& indices) {
   return writeWithBufferControl([&]() {
-    if (batch_ == nullptr) {
+    const auto& rowType = asRowType(rows->type());
+    if (numBufferedRows_ == 0) {
       serializer::presto::PrestoVectorSerde::PrestoOptions options = {
           kDefaultUseLosslessTimestamp,
           compressionKind_,
           0.8,
           /*nullsFirst=*/true};
-      batch_ = std::make_unique<VectorStreamGroup>(pool_, serde_);
-      batch_->createStreamTree(
-          std::static_pointer_cast<const RowType>(rows->type()),
-          1'000,
-          &options);
+      const auto columnTypes = makeColumnTypes(rowType);
+      columnBatches_.clear();
+      columnBatches_.reserve(columnTypes.size());
+      for (const auto& columnType : columnTypes) {
+        columnBatches_.push_back(
+            std::make_unique<VectorStreamGroup>(pool_, serde_));
+        columnBatches_.back()->createStreamTree(columnType, 1'000, &options);
+      }
+    }
+    VELOX_CHECK_EQ(columnBatches_.size(), rows->childrenSize());
+    for (auto i = 0; i < columnBatches_.size(); ++i) {
+      auto column = std::make_shared<RowVector>(
+          pool_,
+          ROW({rowType->nameOf(i)}, {rowType->childAt(i)}),
+          nullptr,
+          rows->size(),
+          std::vector<VectorPtr>{rows->childAt(i)});
+      columnBatches_[i]->append(column, indices);
+    }
+    for (const auto& range : indices) {
+      numBufferedRows_ += range.size;
     }
-    batch_->append(rows, indices);
     return rows->size();
   });
 }
 
+uint64_t SpillWriter::bufferSize() const {
+  uint64_t size = batchHeaderSize(columnBatches_.size());
+  for (const auto& batch : columnBatches_) {
+    size += batch->size();
+  }
+  return size;
+}
+
 void SpillWriter::addFinishedFile(SpillWriteFile* file) {
   finishedFiles_.push_back(SpillFileInfo{
       .id = file->id(),
@@ -294,7 +352,9 @@ std::unique_ptr<SpillReadFile> SpillReadFile::create(
     const SpillFileInfo& fileInfo,
     uint64_t bufferSize,
     memory::MemoryPool* pool,
-    folly::Synchronized<common::SpillStats>* stats) {
+    folly::Synchronized<common::SpillStats>* stats,
+    uint32_t numReadAheadBuffers,
+    folly::Executor* readAheadExecutor) {
   return std::unique_ptr<SpillReadFile>(new SpillReadFile(
       fileInfo.id,
       fileInfo.path,
@@ -304,7 +364,9 @@ std::unique_ptr<SpillReadFile> SpillReadFile::create(
       fileInfo.sortingKeys,
       fileInfo.compressionKind,
       pool,
-      stats));
+      stats,
+      numReadAheadBuffers,
+      readAheadExecutor));
 }
 
 SpillReadFile::SpillReadFile(
@@ -316,11 +378,14 @@ SpillReadFile::SpillReadFile(
     const std::vector<SpillSortKey>& sortingKeys,
     common::CompressionKind compressionKind,
     memory::MemoryPool* pool,
-    folly::Synchronized<common::SpillStats>* stats)
+    folly::Synchronized<common::SpillStats>* stats,
+    uint32_t numReadAheadBuffers,
+    folly::Executor* readAheadExecutor)
     : id_(id),
       path_(path),
       size_(size),
       type_(type),
+      columnTypes_(makeColumnTypes(type_)),
       sortingKeys_(sortingKeys),
       compressionKind_(compressionKind),
       readOptions_{
@@ -330,11 +395,39 @@ SpillReadFile::SpillReadFile(
           /*nullsFirst=*/true},
       pool_(pool),
       serde_(getNamedVectorSerde(VectorSerde::Kind::kPresto)),
-      stats_(stats) {
+      stats_(stats),
+      outputType_(type_),
+      outputChannels_(type_->size()) {
+  std::iota(outputChannels_.begin(), outputChannels_.end(), 0);
   auto fs = filesystems::getFileSystem(path_, nullptr);
-  auto file = fs->openFileForRead(path_);
+  filesystems::FileOptions options;
+  options.useIoUring = FLAGS_velox_spill_io_uring;
+  auto file = fs->openFileForRead(path_, options);
   input_ = std::make_unique<common::FileInputStream>(
-      std::move(file), bufferSize, pool_);
+      std::move(file),
+      bufferSize,
+      pool_,
+      numReadAheadBuffers,
+      readAheadExecutor);
+}
+
+void SpillReadFile::setProjection(const std::vector<column_index_t>& channels) {
+  std::vector<std::string> names;
+  std::vector<TypePtr> types;
+  std::fill(outputChannels_.begin(), outputChannels_.end(), kConstantChannel);
+  for (auto i = 0; i < channels.size(); ++i) {
+    const auto channel = channels[i];
+    VELOX_CHECK_LT(channel, type_->size());
+    VELOX_CHECK_EQ(
+        outputChannels_[channel],
+        kConstantChannel,
+        "Duplicate spill column in projection: {}",
+        channel);
+    outputChannels_[channel] = i;
+    names.push_back(type_->nameOf(channel));
+    types.push_back(type_->childAt(channel));
+  }
+  outputType_ = ROW(std::move(names), std::move(types));
 }
 
 bool SpillReadFile::nextBatch(RowVectorPtr& rowVector) {
@@ -346,8 +439,34 @@ bool SpillReadFile::nextBatch(RowVectorPtr& rowVector) {
   uint64_t timeNs{0};
   {
     NanosecondTimer timer{&timeNs};
-    VectorStreamGroup::read(
-        input_.get(), pool_, type_, serde_, &rowVector, &readOptions_);
+    const auto numRows = input_->read<int32_t>();
+    const auto numColumns = input_->read<int32_t>();
+    VELOX_CHECK_EQ(numColumns, type_->size());
+    std::vector<int64_t> columnSizes(numColumns);
+    input_->readBytes(
+        reinterpret_cast<uint8_t*>(columnSizes.data()),
+        numColumns * sizeof(int64_t));
+
+    std::vector<VectorPtr> children(outputType_->size());
+    for (auto i = 0; i < numColumns; ++i) {
+      const auto channel = outputChannels_[i];
+      if (channel == kConstantChannel) {
+        input_->seekp(input_->tellp() + columnSizes[i]);
+        continue;
+      }
+      RowVectorPtr column;
+      VectorStreamGroup::read(
+          input_.get(),
+          pool_,
+          columnTypes_[i],
+          serde_,
+          &column,
+          &readOptions_);
+      VELOX_CHECK_EQ(column->size(), numRows);
+      children[channel] = column->childAt(0);
+    }
+    rowVector = std::make_shared<RowVector>(
+        pool_, outputType_, nullptr, numRows, std::move(children));
   }
   stats_->wlock()->spillDeserializationTimeNanos += timeNs;
   common::updateGlobalSpillDeserializationTimeNs(timeNs);
@@ -362,6 +481,8 @@ void SpillReadFile::recordSpillStats() {
   auto lockedSpillStats = stats_->wlock();
   lockedSpillStats->spillReads += readStats.numReads;
   lockedSpillStats->spillReadTimeNanos += readStats.readTimeNs;
+  lockedSpillStats->spillReadAheadWaitTimeNanos +=
+      readStats.readAheadWaitTimeNs;
   lockedSpillStats->spillReadBytes += readStats.readBytes;
 }
 } // namespace facebook::velox::exec
@@ -200,6 +200,11 @@ class SpillWriterBase {
 
 /// If data is sorted, each file is sorted. The globally sorted order is
 /// produced by merging the constituent files.
+///
+/// The file is a sequence of batches in columnar layout. Each batch starts
+/// with its row count, column count and the byte size of each column,
+/// followed by one serialized and separately compressed page per column. This
+/// lets SpillReadFile skip the columns that are not needed on restore.
 class SpillWriter : public SpillWriterBase {
  public:
   /// 'type' is a RowType describing the content. 'numSortKeys' is the number
@@ -240,12 +245,10 @@ class SpillWriter : public SpillWriterBase {
 
  private:
   bool bufferEmpty() const override {
-    return batch_ == nullptr;
+    return numBufferedRows_ == 0;
   }
 
-  uint64_t bufferSize() const override {
-    return batch_->size();
-  }
+  uint64_t bufferSize() const override;
 
   void flushBuffer(
       SpillWriteFile* file,
@@ -263,7 +266,11 @@ class SpillWriter : public SpillWriterBase {
 
   VectorSerde* const serde_;
 
-  std::unique_ptr<VectorStreamGroup> batch_;
+  // One serializer per column of the buffered batch, each over a single
+  // column row type.
+  std::vector<std::unique_ptr<VectorStreamGroup>> columnBatches_;
+
+  uint64_t numBufferedRows_{0};
 };
 
 /// Represents a spill file for read which turns the serialized spilled data
@@ -275,11 +282,17 @@ class SpillWriter : public SpillWriterBase {
 /// rmdir() call.
 class SpillReadFile {
  public:
+  /// Opens the spill file of 'fileInfo' for read. The file is read
+  /// 'bufferSize' bytes at a time with up to 'numReadAheadBuffers' buffers
+  /// read ahead, see common::FileInputStream. If the file system does not
+  /// support async read, the read-ahead runs on 'readAheadExecutor' if set.
   static std::unique_ptr<SpillReadFile> create(
       const SpillFileInfo& fileInfo,
       uint64_t bufferSize,
       memory::MemoryPool* pool,
-      folly::Synchronized<common::SpillStats>* stats);
+      folly::Synchronized<common::SpillStats>* stats,
+      uint32_t numReadAheadBuffers = 1,
+      folly::Executor* readAheadExecutor = nullptr);
 
   uint32_t id() const {
     return id_;
@@ -289,6 +302,11 @@ class SpillReadFile {
     return sortingKeys_;
   }
 
+  /// Restricts the batches returned by nextBatch() to the columns of the
+  /// spilled type at 'channels', in that order. The other columns are skipped
+  /// without being deserialized.
+  void setProjection(const std::vector<column_index_t>& channels);
+
   bool nextBatch(RowVectorPtr& rowVector);
 
   /// Returns the file size in bytes.
@@ -310,7 +328,9 @@ class SpillReadFile {
       const std::vector<SpillSortKey>& sortingKeys,
       common::CompressionKind compressionKind,
       memory::MemoryPool* pool,
-      folly::Synchronized<common::SpillStats>* stats);
+      folly::Synchronized<common::SpillStats>* stats,
+      uint32_t numReadAheadBuffers,
+      folly::Executor* readAheadExecutor);
 
   // Invoked to record spill read stats at the end of read input.
   void recordSpillStats();
@@ -323,6 +343,8 @@ class SpillReadFile {
   const uint64_t size_;
   // The data type of spilled data.
   const RowTypePtr type_;
+  // The single column row type of each column page.
+  const std::vector<RowTypePtr> columnTypes_;
   const std::vector<SpillSortKey> sortingKeys_;
   const common::CompressionKind compressionKind_;
   const serializer::presto::PrestoVectorSerde::PrestoOptions readOptions_;
@@ -330,6 +352,13 @@ class SpillReadFile {
   VectorSerde* const serde_;
   folly::Synchronized<common::SpillStats>* const stats_;
 
+  // The type of the batches returned by nextBatch(). Same as 'type_' unless
+  // set by setProjection().
+  RowTypePtr outputType_;
+  // The output channel of each spilled column or kConstantChannel if the
+  // column is skipped.
+  std::vector<column_index_t> outputChannels_;
+
   std::unique_ptr<common::FileInputStream> input_;
 };
 } // namespace facebook::velox::exec
@@ -299,11 +299,19 @@ void SpillerBase::extractSpill(
     container_->extractColumn(rows.data(), rows.size(), i, result->childAt(i));
   }
   const auto& accumulators = container_->accumulators();
-  column_index_t accumulatorColumnOffset = types.size();
-  for (auto i = 0; i < accumulators.size(); ++i) {
-    accumulators[i].extractForSpill(
-        rows, result->childAt(i + accumulatorColumnOffset));
+  if (accumulators.empty()) {
+    return;
+  }
+  uint64_t extractAccumulatorNs{0};
+  {
+    NanosecondTimer timer(&extractAccumulatorNs);
+    column_index_t accumulatorColumnOffset = types.size();
+    for (auto i = 0; i < accumulators.size(); ++i) {
+      accumulators[i].extractForSpill(
+          rows, result->childAt(i + accumulatorColumnOffset));
+    }
   }
+  updateSpillExtractAccumulatorTime(extractAccumulatorNs);
 }
 
 void SpillerBase::updateSpillExtractVectorTime(uint64_t timeNs) {
@@ -311,6 +319,11 @@ void SpillerBase::updateSpillExtractVectorTime(uint64_t timeNs) {
   common::updateGlobalSpillExtractVectorTime(timeNs);
 }
 
+void SpillerBase::updateSpillExtractAccumulatorTime(uint64_t timeNs) {
+  spillStats_->wlock()->spillExtractAccumulatorTimeNanos += timeNs;
+  common::updateGlobalSpillExtractAccumulatorTime(timeNs);
+}
+
 void SpillerBase::updateSpillSortTime(uint64_t timeNs) {
   spillStats_->wlock()->spillSortTimeNanos += timeNs;
   common::updateGlobalSpillSortTime(timeNs);
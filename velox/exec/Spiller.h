@@ -176,6 +176,8 @@ class SpillerBase {
 
   void updateSpillExtractVectorTime(uint64_t timeNs);
 
+  void updateSpillExtractAccumulatorTime(uint64_t timeNs);
+
   void updateSpillSortTime(uint64_t timeNs);
 
   // Sorts 'run' if not already sorted.
@@ -82,6 +82,10 @@ TableScan::TableScan(
       driverCtx_(driverCtx),
       maxSplitPreloadPerDriver_(
           driverCtx_->queryConfig().maxSplitPreloadPerDriver()),
+      adaptiveSplitPreload_(
+          driverCtx_->queryConfig().adaptiveSplitPreloadEnabled()),
+      splitDivisionBytes_(
+          driverCtx_->queryConfig().tableScanSplitDivisionBytes()),
       maxReadBatchSize_(driverCtx_->queryConfig().maxOutputBatchRows()),
       connectorPool_(driverCtx_->task->addConnectorPoolLocked(
           planNodeId(),
@@ -180,15 +184,17 @@ RowVectorPtr TableScan::getOutput() {
         }
         continue;
       }
-      const auto estimatedRowSize = dataSource_->estimatedRowSize();
-      readBatchSize_ =
-          estimatedRowSize == connector::DataSource::kUnknownRowSize
-          ? outputBatchRows()
-          : outputBatchRows(estimatedRowSize);
     }
     VELOX_CHECK(!needNewSplit_);
     VELOX_CHECK(!hasDrained());
 
+    // Size each batch from the latest row size estimate so that batches of
+    // highly variable row widths stay within the preferred output bytes.
+    const auto estimatedRowSize = dataSource_->estimatedRowSize();
+    readBatchSize_ = estimatedRowSize == connector::DataSource::kUnknownRowSize
+        ? outputBatchRows()
+        : outputBatchRows(estimatedRowSize);
+
     int32_t readBatchSize = readBatchSize_;
     if (maxFilteringRatio_ > 0) {
       readBatchSize = std::min(
@@ -202,6 +208,7 @@ RowVectorPtr TableScan::getOutput() {
       auto lk = driverCtx_->driver->pushdownFilters()->at(0).rlock();
       dataOptional = dataSource_->next(readBatchSize, blockingFuture_);
     }
+    currentSplitReadWallNanos_ += ioTimeUs * 1'000;
 
     checkPreload();
     {
@@ -209,6 +216,8 @@ RowVectorPtr TableScan::getOutput() {
       lockedStats->addRuntimeStat(
           "dataSourceReadWallNanos",
           RuntimeCounter(ioTimeUs * 1'000, RuntimeCounter::Unit::kNanos));
+      lockedStats->addRuntimeStat(
+          "readBatchSize", RuntimeCounter(readBatchSize));
 
       if (!dataOptional.has_value()) {
         blockingReason_ = BlockingReason::kWaitForConnector;
@@ -266,6 +275,7 @@ RowVectorPtr TableScan::getOutput() {
 
     driverCtx_->task->splitFinished(true, currentSplitWeight_);
     needNewSplit_ = true;
+    finishSplitPreloadTiming();
 
     // We only update scaled controller when we have finished a non-empty split.
     // Otherwise, it can lead to the wrong scale up decisions if the first few
@@ -321,7 +331,9 @@ bool TableScan::getSplit() {
     splitTracer_->write(split);
   }
   const auto& connectorSplit = split.connectorSplit;
+  // The task accounts the running split with its weight before the division.
   currentSplitWeight_ = connectorSplit->splitWeight;
+  maybeDivideSplit(split);
   needNewSplit_ = false;
 
   // A point for test code injection.
@@ -343,6 +355,9 @@ bool TableScan::getSplit() {
         tableHandle_,
         columnHandles_,
         connectorQueryCtx_.get());
+    if (limit_.has_value()) {
+      dataSource_->setLimit(limit_.value());
+    }
   }
 
   debugString_ = fmt::format(
@@ -362,8 +377,10 @@ bool TableScan::getSplit() {
     // will be nullptr if there was a cancellation.
     numReadyPreloadedSplits_ += connectorSplit->dataSource->hasValue();
     auto preparedDataSource = connectorSplit->dataSource->move();
-    stats_.wlock()->getOutputTiming.add(
-        connectorSplit->dataSource->prepareTiming());
+    const auto& prepareTiming = connectorSplit->dataSource->prepareTiming();
+    stats_.wlock()->getOutputTiming.add(prepareTiming);
+    splitOpenWallNanos_ += prepareTiming.wallNanos;
+    ++numOpenedSplits_;
     if (!preparedDataSource) {
       // There must be a cancellation.
       VELOX_CHECK(operatorCtx_->task()->isCancelled());
@@ -380,11 +397,43 @@ bool TableScan::getSplit() {
     stats_.wlock()->addRuntimeStat(
         "dataSourceAddSplitWallNanos",
         RuntimeCounter(addSplitTimeUs * 1'000, RuntimeCounter::Unit::kNanos));
+    splitOpenWallNanos_ += addSplitTimeUs * 1'000;
+    ++numOpenedSplits_;
   }
   ++stats_.wlock()->numSplits;
   return true;
 }
 
+void TableScan::maybeDivideSplit(exec::Split& split) {
+  // A preloaded split is already open.
+  if (splitDivisionBytes_ == 0 || split.connectorSplit->dataSource != nullptr) {
+    return;
+  }
+  const auto numDrivers = driverCtx_->task->numDrivers(driverCtx_->driver);
+  if (numDrivers < 2) {
+    return;
+  }
+  const auto numQueuedSplits = driverCtx_->task->numQueuedSplits(
+      driverCtx_->splitGroupId, planNodeId());
+  if (numQueuedSplits + 1 >= numDrivers) {
+    return;
+  }
+  auto pieces = connector_->divideSplit(
+      split.connectorSplit, splitDivisionBytes_, numDrivers - numQueuedSplits);
+  if (pieces.empty()) {
+    return;
+  }
+  std::vector<exec::Split> peerSplits;
+  peerSplits.reserve(pieces.size() - 1);
+  for (auto i = 1; i < pieces.size(); ++i) {
+    peerSplits.emplace_back(std::move(pieces[i]), split.groupId);
+  }
+  driverCtx_->task->addDividedSplits(
+      driverCtx_->splitGroupId, planNodeId(), std::move(peerSplits));
+  split.connectorSplit = std::move(pieces[0]);
+  stats_.wlock()->addRuntimeStat(kNumDividedSplits, RuntimeCounter(1));
+}
+
 bool TableScan::shouldWaitForScaleUp() {
   if (scaledController_ == nullptr) {
     return false;
@@ -456,13 +505,15 @@ void TableScan::preload(
 
 void TableScan::checkPreload() {
   auto* executor = connector_->executor();
+  // A scan under a limit is expected to finish before reaching the splits it
+  // would preload.
   if (maxSplitPreloadPerDriver_ == 0 || !executor ||
-      !connector_->supportsSplitPreload()) {
+      !connector_->supportsSplitPreload() || limit_.has_value()) {
     return;
   }
   if (dataSource_->allPrefetchIssued()) {
     maxPreloadedSplits_ = driverCtx_->task->numDrivers(driverCtx_->driver) *
-        maxSplitPreloadPerDriver_;
+        splitPreloadDepth();
     if (!splitPreloader_) {
       splitPreloader_ =
           [executor,
@@ -478,6 +529,41 @@ void TableScan::checkPreload() {
   }
 }
 
+int32_t TableScan::splitPreloadDepth() const {
+  if (!adaptiveSplitPreload_ || numOpenedSplits_ == 0 || numReadSplits_ == 0) {
+    return maxSplitPreloadPerDriver_;
+  }
+  // Preloaded data sources hold memory until their splits are read.
+  const auto* queryPool = pool()->root();
+  if (queryPool->reservedBytes() >=
+      queryPool->maxCapacity() *
+          driverCtx_->queryConfig().tableScanScaleUpMemoryUsageRatio()) {
+    return 0;
+  }
+  // Splits that open in a small fraction of their read time gain little from
+  // preloading.
+  constexpr double kMinOpenToReadRatio = 0.125;
+  const double openNanos = 1.0 * splitOpenWallNanos_ / numOpenedSplits_;
+  const double readNanos =
+      std::max(1.0, 1.0 * splitReadWallNanos_ / numReadSplits_);
+  const double ratio = openNanos / readNanos;
+  if (ratio < kMinOpenToReadRatio) {
+    return 0;
+  }
+  return std::min<double>(maxSplitPreloadPerDriver_, std::ceil(ratio));
+}
+
+void TableScan::finishSplitPreloadTiming() {
+  splitReadWallNanos_ += currentSplitReadWallNanos_;
+  ++numReadSplits_;
+  currentSplitReadWallNanos_ = 0;
+  if (!adaptiveSplitPreload_ || maxSplitPreloadPerDriver_ == 0) {
+    return;
+  }
+  stats_.wlock()->addRuntimeStat(
+      kSplitPreloadDepth, RuntimeCounter(splitPreloadDepth()));
+}
+
 bool TableScan::isFinished() {
   return noMoreSplits_;
 }
@@ -52,6 +52,14 @@ class TableScan : public SourceOperator {
     return connector_->canAddDynamicFilter();
   }
 
+  /// Sets the number of rows after which the consumer of this scan in the
+  /// same pipeline, e.g. a Limit right above it, stops reading. The scan does
+  /// not preload splits then and passes the limit to its DataSource as a hint.
+  /// Must be called before the first getOutput().
+  void setLimit(uint64_t limit) {
+    limit_ = limit;
+  }
+
   void addDynamicFilterLocked(
       const core::PlanNodeId& producer,
       const PushdownFilters& filters) override;
@@ -64,6 +72,13 @@ class TableScan : public SourceOperator {
   static inline const std::string kNumRunningScaleThreads{
       "numRunningScaleThreads"};
 
+  /// The number of splits to preload per driver, reported at the end of each
+  /// split if 'adaptive_split_preload_enabled' is true.
+  static inline const std::string kSplitPreloadDepth{"splitPreloadDepth"};
+
+  /// The number of splits divided into pieces for the peer drivers.
+  static inline const std::string kNumDividedSplits{"numDividedSplits"};
+
   std::shared_ptr<ScaledScanController> testingScaledController() const {
     return scaledController_;
   }
@@ -80,11 +95,25 @@ class TableScan : public SourceOperator {
   // Returns true if a new split is fetched from the task otherwise false.
   bool getSplit();
 
+  // Divides 'split' if it is larger than 'splitDivisionBytes_' and the peer
+  // drivers are short of queued splits. Replaces 'split' with the first piece
+  // and queues the other pieces for the peers.
+  void maybeDivideSplit(exec::Split& split);
+
   // Sets 'maxPreloadSplits' and 'splitPreloader' if prefetching splits is
   // appropriate. The preloader will be applied to the 'first 'maxPreloadSplits'
   // of the Task's split queue for 'this' when getting splits.
   void checkPreload();
 
+  // Returns the number of splits to preload per driver. This is
+  // 'maxSplitPreloadPerDriver_' unless the preload is adaptive, in which case
+  // it covers the time to open a split with the time to read the splits before
+  // it.
+  int32_t splitPreloadDepth() const;
+
+  // Records the time to read the finished split and reports the preload depth.
+  void finishSplitPreloadTiming();
+
   // Sets 'split->dataSource' to be an AsyncSource that makes a DataSource to
   // read 'split'. This source will be prepared in the background on the
   // executor of the connector. If the DataSource is needed before prepare is
@@ -103,6 +132,8 @@ class TableScan : public SourceOperator {
   const connector::ColumnHandleMap columnHandles_;
   DriverCtx* const driverCtx_;
   const int32_t maxSplitPreloadPerDriver_{0};
+  const bool adaptiveSplitPreload_;
+  const uint64_t splitDivisionBytes_;
   const vector_size_t maxReadBatchSize_;
   memory::MemoryPool* const connectorPool_;
   const std::shared_ptr<connector::Connector> connector_;
@@ -114,6 +145,9 @@ class TableScan : public SourceOperator {
   // operators instantiated from the same table scan node.
   const std::shared_ptr<ScaledScanController> scaledController_;
 
+  // Set if the consumer stops reading after this many rows.
+  std::optional<uint64_t> limit_;
+
   vector_size_t readBatchSize_;
 
   ContinueFuture blockingFuture_{ContinueFuture::makeEmpty()};
@@ -139,6 +173,20 @@ class TableScan : public SourceOperator {
   // Count of splits that finished preloading before being read.
   int32_t numReadyPreloadedSplits_{0};
 
+  // Total wall time to open splits, i.e. to create their data sources in the
+  // background or to add them to 'dataSource_', and the number of splits
+  // opened. Used by the adaptive split preload.
+  uint64_t splitOpenWallNanos_{0};
+  uint32_t numOpenedSplits_{0};
+
+  // Total wall time in DataSource::next() of the finished splits and the
+  // number of finished splits. Used by the adaptive split preload.
+  uint64_t splitReadWallNanos_{0};
+  uint32_t numReadSplits_{0};
+
+  // Wall time in DataSource::next() of the current split.
+  uint64_t currentSplitReadWallNanos_{0};
+
   double maxFilteringRatio_{0};
 
   // String shown in ExceptionContext inside DataSource and LazyVector loading.
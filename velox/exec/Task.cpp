@@ -16,6 +16,7 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
+#include <filesystem>
 #include <string>
 
 #include "velox/common/base/Counters.h"
@@ -31,6 +32,8 @@
 #include "velox/exec/OperatorUtils.h"
 #include "velox/exec/OutputBufferManager.h"
 #include "velox/exec/PlanNodeStats.h"
+#include "velox/exec/RoundRobinPartitionFunction.h"
+#include "velox/exec/ScaledDriverController.h"
 #include "velox/exec/Task.h"
 #include "velox/exec/TraceUtil.h"
 
@@ -495,17 +498,26 @@ bool Task::allNodesReceivedNoMoreSplitsMessageLocked() const {
   return true;
 }
 
+void Task::setSpillDirectories(
+    const std::vector<std::string>& spillDirectories,
+    bool alreadyCreated) {
+  VELOX_CHECK(!spillDirectories.empty());
+  spillDirectories_ = spillDirectories;
+  spillDirectoryPicks_.assign(spillDirectories_.size(), 0);
+  setSpillDirectory(spillDirectories_[0], alreadyCreated);
+}
+
 const std::string& Task::getOrCreateSpillDirectory() {
   VELOX_CHECK(
       !spillDirectory_.empty() || spillDirectoryCallback_,
       "Spill directory or spill directory callback must be set ");
   if (spillDirectoryCreated_) {
-    return spillDirectory_;
+    return nextSpillDirectory();
   }
 
   std::lock_guard<std::mutex> l(spillDirCreateMutex_);
   if (spillDirectoryCreated_) {
-    return spillDirectory_;
+    return nextSpillDirectory();
   }
 
   try {
@@ -519,6 +531,10 @@ const std::string& Task::getOrCreateSpillDirectory() {
 
     auto fileSystem = filesystems::getFileSystem(spillDirectory_, nullptr);
     fileSystem->mkdir(spillDirectory_);
+    for (auto i = 1; i < spillDirectories_.size(); ++i) {
+      filesystems::getFileSystem(spillDirectories_[i], nullptr)
+          ->mkdir(spillDirectories_[i]);
+    }
   } catch (const std::exception& e) {
     VELOX_FAIL(
         "Failed to create spill directory '{}' for Task {}: {}",
@@ -527,19 +543,50 @@ const std::string& Task::getOrCreateSpillDirectory() {
         e.what());
   }
   spillDirectoryCreated_ = true;
-  return spillDirectory_;
+  return nextSpillDirectory();
+}
+
+const std::string& Task::nextSpillDirectory() {
+  if (spillDirectories_.size() <= 1) {
+    return spillDirectory_;
+  }
+  // Picks the directory with the most free space per earlier pick. This
+  // alternates between directories with equal free space and favors the
+  // emptier disks otherwise. Directories whose free space is not known, e.g.
+  // on a remote file system, count as having equal free space.
+  std::lock_guard<std::mutex> l(spillDirPickMutex_);
+  size_t pick{0};
+  double maxScore{-1};
+  for (auto i = 0; i < spillDirectories_.size(); ++i) {
+    std::error_code error;
+    const auto space = std::filesystem::space(spillDirectories_[i], error);
+    const double freeBytes =
+        error ? 1 : std::max<std::uintmax_t>(space.available, 1);
+    const double score = freeBytes / (1 + spillDirectoryPicks_[i]);
+    if (score > maxScore) {
+      maxScore = score;
+      pick = i;
+    }
+  }
+  ++spillDirectoryPicks_[pick];
+  return spillDirectories_[pick];
 }
 
 void Task::removeSpillDirectoryIfExists() {
   if (spillDirectory_.empty() || !spillDirectoryCreated_) {
     return;
   }
-  try {
-    auto fs = filesystems::getFileSystem(spillDirectory_, nullptr);
-    fs->rmdir(spillDirectory_);
-  } catch (const std::exception& e) {
-    LOG(ERROR) << "Failed to remove spill directory '" << spillDirectory_
-               << "' for Task " << taskId() << ": " << e.what();
+  const auto& directories = spillDirectories_.empty()
+      ? std::vector<std::string>{spillDirectory_}
+      : spillDirectories_;
+  for (const auto& directory : directories) {
+    try {
+      auto fs = filesystems::getFileSystem(directory, nullptr);
+      fs->rmdir(directory);
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Failed to remove spill directory '" << directory
+                 << "' for Task " << taskId() << ": " << e.what();
+    }
   }
 }
 
@@ -1207,7 +1254,10 @@ void Task::createSplitGroupStateLocked(uint32_t splitGroupId) {
     if (factory->needsLocalExchange(partitionNode)) {
       VELOX_CHECK_NOT_NULL(partitionNode);
       createLocalExchangeQueuesLocked(
-          splitGroupId, partitionNode, factory->numDrivers);
+          splitGroupId,
+          partitionNode,
+          factory->numDrivers,
+          factory->acceptsSkewedLocalPartition());
     }
     addHashJoinBridgesLocked(splitGroupId, factory->needsHashJoinBridges());
     addNestedLoopJoinBridgesLocked(
@@ -1845,6 +1895,46 @@ bool Task::isAllSplitsFinishedLocked() {
       allNodesReceivedNoMoreSplitsMessageLocked();
 }
 
+size_t Task::numQueuedSplits(
+    uint32_t splitGroupId,
+    const core::PlanNodeId& planNodeId) const {
+  std::lock_guard<std::timed_mutex> l(mutex_);
+  auto stateIt = splitsStates_.find(planNodeId);
+  VELOX_CHECK(stateIt != splitsStates_.end());
+  const auto& stores = stateIt->second.groupSplitsStores;
+  auto storeIt = stores.find(splitGroupId);
+  return storeIt == stores.end() ? 0 : storeIt->second.splits.size();
+}
+
+void Task::addDividedSplits(
+    uint32_t splitGroupId,
+    const core::PlanNodeId& planNodeId,
+    std::vector<exec::Split> splits) {
+  std::vector<ContinuePromise> promises;
+  {
+    std::lock_guard<std::timed_mutex> l(mutex_);
+    auto& splitsState = getPlanNodeSplitsStateLocked(planNodeId);
+    VELOX_CHECK(splitsState.sourceIsTableScan);
+    auto& splitsStore = splitsState.groupSplitsStores[splitGroupId];
+    for (auto it = splits.rbegin(); it != splits.rend(); ++it) {
+      VELOX_CHECK(it->hasConnectorSplit());
+      ++taskStats_.numTotalSplits;
+      ++taskStats_.numQueuedSplits;
+      ++taskStats_.numQueuedTableScanSplits;
+      taskStats_.queuedTableScanSplitWeights += it->connectorSplit->splitWeight;
+      splitsStore.splits.push_front(std::move(*it));
+    }
+    while (promises.size() < splits.size() &&
+           !splitsStore.splitPromises.empty()) {
+      promises.push_back(std::move(splitsStore.splitPromises.back()));
+      splitsStore.splitPromises.pop_back();
+    }
+  }
+  for (auto& promise : promises) {
+    promise.setValue();
+  }
+}
+
 BlockingReason Task::getSplitOrFuture(
     uint32_t splitGroupId,
     const core::PlanNodeId& planNodeId,
@@ -2596,6 +2686,37 @@ void Task::addDriverStats(int pipelineId, DriverStats stats) {
   taskStats_.pipelineStats[pipelineId].driverStats.push_back(std::move(stats));
 }
 
+std::vector<Task::OperatorMemoryForecast> Task::memoryForecast() const {
+  std::vector<OperatorMemoryForecast> forecasts;
+  std::lock_guard<std::timed_mutex> l(mutex_);
+  for (const auto& driver : drivers_) {
+    // Driver can be null.
+    if (driver == nullptr) {
+      continue;
+    }
+    for (auto* op : driver->operators()) {
+      const auto* pool = op->pool();
+      forecasts.push_back(OperatorMemoryForecast{
+          .pipelineId = driver->driverCtx()->pipelineId,
+          .driverId = driver->driverCtx()->driverId,
+          .planNodeId = op->planNodeId(),
+          .operatorType = op->operatorType(),
+          .currentBytes = static_cast<uint64_t>(pool->usedBytes()),
+          .peakBytes = static_cast<uint64_t>(pool->peakBytes()),
+          .projectedPeakBytes = op->projectedPeakMemoryBytes()});
+    }
+  }
+  return forecasts;
+}
+
+uint64_t Task::projectedPeakMemoryBytes() const {
+  uint64_t bytes{0};
+  for (const auto& forecast : memoryForecast()) {
+    bytes += forecast.projectedPeakBytes;
+  }
+  return bytes;
+}
+
 TaskStats Task::taskStats() const {
   std::lock_guard<std::timed_mutex> l(mutex_);
 
@@ -2657,6 +2778,14 @@ TaskStats Task::taskStats() const {
   if (!taskStats.outputBufferStats.has_value()) {
     taskStats.outputBufferStats = bufferManager->stats(taskId_);
   }
+
+  for (const auto& pipelineStats : taskStats.pipelineStats) {
+    for (const auto& operatorStats : pipelineStats.operatorStats) {
+      for (const auto& [name, histogram] : operatorStats.latencyHistograms) {
+        taskStats.latencyHistograms[name].merge(histogram);
+      }
+    }
+  }
   return taskStats;
 }
 
@@ -2924,7 +3053,8 @@ std::shared_ptr<MergeSource> Task::addLocalMergeSource(
     uint32_t splitGroupId,
     const core::PlanNodeId& planNodeId,
     const RowTypePtr& rowType) {
-  auto source = MergeSource::createLocalMergeSource();
+  auto source = MergeSource::createLocalMergeSource(
+      queryCtx_->queryConfig().localMergeSourceQueueSize());
   splitGroupStates_[splitGroupId].localMergeSources[planNodeId].push_back(
       source);
   return source;
@@ -2938,22 +3068,24 @@ const std::vector<std::shared_ptr<MergeSource>>& Task::getLocalMergeSources(
 
 void Task::createMergeJoinSource(
     uint32_t splitGroupId,
-    const core::PlanNodeId& planNodeId) {
-  auto& splitGroupState = splitGroupStates_[splitGroupId];
-
-  VELOX_CHECK(
-      splitGroupState.mergeJoinSources.find(planNodeId) ==
-          splitGroupState.mergeJoinSources.end(),
-      "Merge join sources already exist: {}",
-      planNodeId);
-
-  splitGroupState.mergeJoinSources.insert(
-      {planNodeId, std::make_shared<MergeJoinSource>()});
+    const core::PlanNodeId& planNodeId,
+    uint32_t driverId) {
+  auto& sources = splitGroupStates_[splitGroupId].mergeJoinSources[planNodeId];
+  if (sources.size() <= driverId) {
+    sources.resize(driverId + 1);
+  }
+  VELOX_CHECK_NULL(
+      sources[driverId],
+      "Merge join source already exists: {}, driver {}",
+      planNodeId,
+      driverId);
+  sources[driverId] = std::make_shared<MergeJoinSource>();
 }
 
 std::shared_ptr<MergeJoinSource> Task::getMergeJoinSource(
     uint32_t splitGroupId,
-    const core::PlanNodeId& planNodeId) {
+    const core::PlanNodeId& planNodeId,
+    uint32_t driverId) {
   auto& splitGroupState = splitGroupStates_[splitGroupId];
 
   auto it = splitGroupState.mergeJoinSources.find(planNodeId);
@@ -2961,13 +3093,19 @@ std::shared_ptr<MergeJoinSource> Task::getMergeJoinSource(
       it != splitGroupState.mergeJoinSources.end(),
       "Merge join source for specified plan node doesn't exist: {}",
       planNodeId);
-  return it->second;
+  VELOX_CHECK(
+      driverId < it->second.size() && it->second[driverId] != nullptr,
+      "Merge join source for specified driver doesn't exist: {}, driver {}",
+      planNodeId,
+      driverId);
+  return it->second[driverId];
 }
 
 void Task::createLocalExchangeQueuesLocked(
     uint32_t splitGroupId,
     const core::PlanNodePtr& planNode,
-    int numPartitions) {
+    int numPartitions,
+    bool acceptsSkewedPartitions) {
   auto& splitGroupState = splitGroupStates_[splitGroupId];
   const auto& planNodeId = planNode->id();
   VELOX_CHECK(
@@ -2992,7 +3130,9 @@ void Task::createLocalExchangeQueuesLocked(
   const auto partitionNode =
       std::dynamic_pointer_cast<const core::LocalPartitionNode>(planNode);
   VELOX_CHECK_NOT_NULL(partitionNode);
-  if (partitionNode->scaleWriter()) {
+  if (partitionNode->scaleWriter() ||
+      (acceptsSkewedPartitions && numPartitions > 1 &&
+       queryCtx_->queryConfig().localExchangeSkewRebalanceEnabled())) {
     exchange.scaleWriterPartitionBalancer =
         std::make_shared<common::SkewedPartitionRebalancer>(
             queryCtx_->queryConfig().scaleWriterMaxPartitionsPerWriter() *
@@ -3002,6 +3142,19 @@ void Task::createLocalExchangeQueuesLocked(
                 .scaleWriterMinPartitionProcessedBytesRebalanceThreshold(),
             queryCtx_->queryConfig()
                 .scaleWriterMinProcessedBytesRebalanceThreshold());
+  } else if (
+      queryCtx_->queryConfig().localExchangeScaledProcessingEnabled() &&
+      numPartitions > 1 &&
+      partitionNode->type() ==
+          core::LocalPartitionNode::Type::kRepartition &&
+      dynamic_cast<const RoundRobinPartitionFunctionSpec*>(
+          &partitionNode->partitionFunctionSpec()) != nullptr) {
+    exchange.scaledDriverController = std::make_shared<ScaledDriverController>(
+        queryCtx_->pool(),
+        exchange.memoryManager,
+        numPartitions,
+        queryCtx_->queryConfig().localExchangeScaleUpMemoryUsageRatio(),
+        queryCtx_->executor());
   }
 
   splitGroupState.localExchanges.insert({planNodeId, std::move(exchange)});
@@ -3062,6 +3215,21 @@ Task::getScaleWriterPartitionBalancer(
   return it->second.scaleWriterPartitionBalancer;
 }
 
+const std::shared_ptr<ScaledDriverController>& Task::getScaledDriverController(
+    uint32_t splitGroupId,
+    const core::PlanNodeId& planNodeId) {
+  auto& splitGroupState = splitGroupStates_[splitGroupId];
+
+  auto it = splitGroupState.localExchanges.find(planNodeId);
+  VELOX_CHECK(
+      it != splitGroupState.localExchanges.end(),
+      "Incorrect local exchange ID {} for group {}, task {}",
+      planNodeId,
+      splitGroupId,
+      taskId());
+  return it->second.scaledDriverController;
+}
+
 const std::shared_ptr<LocalExchangeMemoryManager>&
 Task::getLocalExchangeMemoryManager(
     uint32_t splitGroupId,
@@ -3375,7 +3543,8 @@ void Task::createExchangeClientLocked(
       queryCtx()->queryConfig().minExchangeOutputBatchBytes(),
       addExchangeClientPool(planNodeId, pipelineId),
       queryCtx()->executor(),
-      queryCtx()->queryConfig().requestDataSizesMaxWaitSec());
+      queryCtx()->queryConfig().requestDataSizesMaxWaitSec(),
+      queryCtx()->queryConfig().exchangeAdaptiveFlowControlEnabled());
   exchangeClientByPlanNode_.emplace(planNodeId, exchangeClients_[pipelineId]);
 }
 
@@ -3494,6 +3663,22 @@ uint64_t Task::MemoryReclaimer::reclaim(
   return reclaimedBytes;
 }
 
+void Task::MemoryReclaimer::progress(
+    const memory::MemoryPool& /*unused*/,
+    uint64_t& numCompleted,
+    uint64_t& numTotal) const {
+  auto task = ensureTask();
+  if (FOLLY_UNLIKELY(task == nullptr)) {
+    return;
+  }
+  std::unique_lock<std::timed_mutex> l(task->mutex_, std::try_to_lock);
+  if (!l.owns_lock()) {
+    return;
+  }
+  numCompleted += task->numFinishedDrivers_;
+  numTotal += task->numTotalDrivers_;
+}
+
 uint64_t Task::MemoryReclaimer::reclaimTask(
     const std::shared_ptr<Task>& task,
     uint64_t targetBytes,
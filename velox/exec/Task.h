@@ -111,6 +111,14 @@ class Task : public std::enable_shared_from_this<Task> {
     spillDirectoryCreated_ = alreadyCreated;
   }
 
+  /// Like setSpillDirectory() but with several directories, e.g. one per local
+  /// disk. Each call to getOrCreateSpillDirectory() then returns one of them,
+  /// so that the spill writers of the task are striped across the
+  /// directories in proportion to their free space.
+  void setSpillDirectories(
+      const std::vector<std::string>& spillDirectories,
+      bool alreadyCreated = true);
+
   void setCreateSpillDirectoryCb(
       std::function<std::string()> spillDirectoryCallback) {
     VELOX_CHECK_NULL(spillDirectoryCallback_);
@@ -330,6 +338,28 @@ class Task : public std::enable_shared_from_this<Task> {
   /// structure.
   TaskStats taskStats() const;
 
+  /// Memory forecast for a running operator. See memoryForecast().
+  struct OperatorMemoryForecast {
+    int32_t pipelineId;
+    int32_t driverId;
+    core::PlanNodeId planNodeId;
+    std::string operatorType;
+    /// Current and peak usage of the operator's memory pool.
+    uint64_t currentBytes;
+    uint64_t peakBytes;
+    /// The expected peak usage. See Operator::projectedPeakMemoryBytes().
+    uint64_t projectedPeakBytes;
+  };
+
+  /// Returns the memory forecasts of the operators of the drivers that are
+  /// still running. Meant for schedulers that admit work by expected rather
+  /// than current memory usage, e.g. through AdmissionController::update().
+  std::vector<OperatorMemoryForecast> memoryForecast() const;
+
+  /// Returns the sum of the projected peaks of memoryForecast(). As the
+  /// peaks of different operators need not coincide this is an upper bound.
+  uint64_t projectedPeakMemoryBytes() const;
+
   /// Information about an operator call that helps debugging stuck calls.
   struct OpCallInfo {
     size_t durationMs;
@@ -441,6 +471,20 @@ class Task : public std::enable_shared_from_this<Task> {
   /// signal is received. If 'maxPreloadSplits' is given, ensures that
   /// so many of splits at the head of the queue are preloading. If
   /// they are not, calls preload on them to start preload.
+  /// Returns the number of splits queued for the source operator of
+  /// 'planNodeId' in 'splitGroupId'.
+  size_t numQueuedSplits(
+      uint32_t splitGroupId,
+      const core::PlanNodeId& planNodeId) const;
+
+  /// Adds 'splits', the pieces of a split divided by a TableScan driver, at
+  /// the front of the split queue of 'planNodeId' in 'splitGroupId' so that
+  /// idle peer drivers read them next.
+  void addDividedSplits(
+      uint32_t splitGroupId,
+      const core::PlanNodeId& planNodeId,
+      std::vector<exec::Split> splits);
+
   BlockingReason getSplitOrFuture(
       uint32_t splitGroupId,
       const core::PlanNodeId& planNodeId,
@@ -473,18 +517,29 @@ class Task : public std::enable_shared_from_this<Task> {
       uint32_t splitGroupId,
       const core::PlanNodeId& planNodeId);
 
+  /// Creates the MergeJoinSource for the specified driver of a merge join.
+  /// A merge join runs in multiple drivers when both of its inputs are range
+  /// partitioned. The right side driver with the same 'driverId' feeds the
+  /// source.
   void createMergeJoinSource(
       uint32_t splitGroupId,
-      const core::PlanNodeId& planNodeId);
+      const core::PlanNodeId& planNodeId,
+      uint32_t driverId);
 
   std::shared_ptr<MergeJoinSource> getMergeJoinSource(
       uint32_t splitGroupId,
-      const core::PlanNodeId& planNodeId);
+      const core::PlanNodeId& planNodeId,
+      uint32_t driverId);
 
+  /// Creates the queues of the local exchange 'planNode'. If
+  /// 'acceptsSkewedPartitions' is true, the consumers accept the rows of one
+  /// partition at several drivers and the exchange may get a partition
+  /// balancer.
   void createLocalExchangeQueuesLocked(
       uint32_t splitGroupId,
       const core::PlanNodePtr& planNode,
-      int numPartitions);
+      int numPartitions,
+      bool acceptsSkewedPartitions);
 
   void noMoreLocalExchangeProducers(uint32_t splitGroupId);
 
@@ -503,13 +558,20 @@ class Task : public std::enable_shared_from_this<Task> {
       uint32_t splitGroupId,
       const core::PlanNodeId& planNodeId);
 
-  /// Returns the shared skewed partition balancer for scale writer local
-  /// partitioning with the given split group id and plan node id.
+  /// Returns the shared skewed partition balancer for scale writer or skewed
+  /// local partitioning with the given split group id and plan node id.
   const std::shared_ptr<common::SkewedPartitionRebalancer>&
   getScaleWriterPartitionBalancer(
       uint32_t splitGroupId,
       const core::PlanNodeId& planNodeId);
 
+  /// Returns the driver controller of the round robin local exchange with the
+  /// given split group id and plan node id, or null if its consumer drivers
+  /// are not scaled.
+  const std::shared_ptr<ScaledDriverController>& getScaledDriverController(
+      uint32_t splitGroupId,
+      const core::PlanNodeId& planNodeId);
+
   void setError(const std::exception_ptr& exception);
 
   void setError(const std::string& message);
@@ -729,7 +791,8 @@ class Task : public std::enable_shared_from_this<Task> {
   /// Returns the spill directory path. Ensures that the spill directory is
   /// created before returning. Is thread safe. Returns an empty string if
   /// either the spill directory is not specified during task creation or the
-  /// folder could not be created.
+  /// folder could not be created. If set by setSpillDirectories(), returns
+  /// the directory with the highest free space per earlier pick.
   const std::string& getOrCreateSpillDirectory();
 
   /// True if produces output via OutputBufferManager.
@@ -848,6 +911,9 @@ class Task : public std::enable_shared_from_this<Task> {
   // spilling.
   void removeSpillDirectoryIfExists();
 
+  // Returns 'spillDirectory_' or the next pick from 'spillDirectories_'.
+  const std::string& nextSpillDirectory();
+
   // Invoked to initialize the memory pool for this task on creation.
   void initTaskPool();
 
@@ -920,6 +986,14 @@ class Task : public std::enable_shared_from_this<Task> {
     void abort(memory::MemoryPool* pool, const std::exception_ptr& error)
         override;
 
+    /// Adds the finished and total drivers of the task. Adds nothing if the
+    /// task is busy, so that the memory arbitrator never waits for the task
+    /// lock.
+    void progress(
+        const memory::MemoryPool& pool,
+        uint64_t& numCompleted,
+        uint64_t& numTotal) const override;
+
    private:
     MemoryReclaimer(const std::shared_ptr<Task>& task, int64_t priority)
         : exec::MemoryReclaimer(priority), task_(task) {
@@ -1379,6 +1453,14 @@ class Task : public std::enable_shared_from_this<Task> {
   std::vector<ContinuePromise> resumePromises_;
   // Base spill directory for this task.
   std::string spillDirectory_;
+  // All spill directories of this task if set by setSpillDirectories(). The
+  // first one is also 'spillDirectory_'.
+  std::vector<std::string> spillDirectories_;
+  // The number of times each of 'spillDirectories_' has been returned by
+  // getOrCreateSpillDirectory().
+  std::vector<uint64_t> spillDirectoryPicks_;
+  // Serializes the picks from 'spillDirectories_'.
+  std::mutex spillDirPickMutex_;
   // Spill directory callback for this task. This callback will be used to
   // create the spill directory for this task. This callback returns
   // a path that will be into spillDirectory_
@@ -124,6 +124,10 @@ struct TaskStats {
   uint32_t memoryReclaimCount{0};
   /// The total memory reclamation time.
   uint64_t memoryReclaimMs{0};
+
+  /// The latency histograms of all operators of the task merged by name. See
+  /// OperatorStats::latencyHistograms.
+  std::unordered_map<std::string, LatencyHistogram> latencyHistograms;
 };
 
 } // namespace facebook::velox::exec
@@ -25,6 +25,7 @@ class JoinBridge;
 class LocalExchangeMemoryManager;
 class MergeSource;
 class MergeJoinSource;
+class ScaledDriverController;
 struct Split;
 
 /// Corresponds to Presto TaskState, needed for reporting query completion.
@@ -90,8 +91,12 @@ struct LocalExchangeState {
   std::shared_ptr<LocalExchangeMemoryManager> memoryManager;
   std::shared_ptr<LocalExchangeVectorPool> vectorPool;
   std::vector<std::shared_ptr<LocalExchangeQueue>> queues;
+  /// Set for a scale writer exchange and for a hash repartitioning exchange
+  /// that splits skewed partitions across its consumers.
   std::shared_ptr<common::SkewedPartitionRebalancer>
       scaleWriterPartitionBalancer;
+  /// Set if the consumer drivers of a round robin exchange are scaled.
+  std::shared_ptr<ScaledDriverController> scaledDriverController;
 };
 
 /// Stores inter-operator state (exchange, bridges) for split groups.
@@ -110,8 +115,11 @@ struct SplitGroupState {
       unordered_map<core::PlanNodeId, std::vector<std::shared_ptr<MergeSource>>>
           localMergeSources;
 
-  /// Map of merge join sources keyed on MergeJoinNode plan node ID.
-  std::unordered_map<core::PlanNodeId, std::shared_ptr<MergeJoinSource>>
+  /// Map of merge join sources keyed on MergeJoinNode plan node ID. Holds one
+  /// source per driver of the merge join.
+  std::unordered_map<
+      core::PlanNodeId,
+      std::vector<std::shared_ptr<MergeJoinSource>>>
       mergeJoinSources;
 
   /// Map of local exchanges keyed on LocalPartition plan node ID.
@@ -16,10 +16,36 @@
 #include <folly/container/F14Map.h>
 
 #include "velox/exec/ContainerRowSerde.h"
+#include "velox/exec/Driver.h"
 #include "velox/exec/TopN.h"
 #include "velox/vector/FlatVector.h"
 
 namespace facebook::velox::exec {
+
+namespace {
+bool supportsThreshold(TypeKind kind) {
+  switch (kind) {
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+    case TypeKind::TIMESTAMP:
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <typename T>
+int128_t thresholdValue(T value) {
+  if constexpr (std::is_same_v<T, Timestamp>) {
+    return static_cast<int128_t>(value.getSeconds()) * 1'000'000'000 +
+        value.getNanos();
+  } else {
+    return value;
+  }
+}
+} // namespace
 TopN::TopN(
     int32_t operatorId,
     DriverCtx* driverCtx,
@@ -38,7 +64,12 @@ TopN::TopN(
           topNNode->sortingOrders(),
           data_.get()),
       topRows_(comparator_),
-      decodedVectors_(outputType_->children().size()) {
+      decodedVectors_(outputType_->children().size()),
+      firstKeyKind_(topNNode->sortingKeys()[0]->type()->kind()),
+      firstKeyAscending_(topNNode->sortingOrders()[0].isAscending()),
+      firstKeyNullsFirst_(topNNode->sortingOrders()[0].isNullsFirst()),
+      firstKeyColumn_(data_->columnAt(
+          exprToChannel(topNNode->sortingKeys()[0].get(), outputType_))) {
   const auto numColumns{outputType_->children().size()};
   const auto numSortingKeys{topNNode->sortingKeys().size()};
   sortingKeyColumns_.reserve(numSortingKeys);
@@ -66,29 +97,23 @@ void TopN::addInput(RowVectorPtr input) {
   // Maps passed rows of 'data_' to the corresponding input row number. These
   // input rows of non-key columns are later stored into data_.
   folly::F14FastMap<void*, vector_size_t> passedRows;
-  for (auto row = 0; row < input->size(); ++row) {
-    char* newRow = nullptr;
-    if (topRows_.size() < count_) {
-      newRow = data_->newRow();
-    } else {
-      char* topRow = topRows_.top();
-
-      if (!comparator_(decodedVectors_, row, topRow)) {
-        continue;
-      }
-      topRows_.pop();
-      // Reuse the topRow's memory.
-      newRow = data_->initializeRow(topRow, true /* reuse */);
-    }
-
-    data_->initializeFields(newRow);
-    for (const auto col : sortingKeyColumns_) {
-      data_->store(decodedVectors_[col], row, newRow, col);
+  const vector_size_t numRows = input->size();
+  vector_size_t row = 0;
+  for (; row < numRows && topRows_.size() < count_; ++row) {
+    addRow(row, passedRows);
+  }
+  // Once there are 'count_' rows, most rows are usually rejected on the first
+  // key alone.
+  if (row < numRows && selectCandidates(row, numRows)) {
+    addRuntimeStat(
+        "numThresholdRejectedRows",
+        RuntimeCounter(numRows - row - candidates_.size()));
+    for (const auto candidate : candidates_) {
+      addRow(candidate, passedRows);
     }
-
-    topRows_.push(newRow);
-    if (hasNonKeyColumn) {
-      passedRows[newRow] = row;
+  } else {
+    for (; row < numRows; ++row) {
+      addRow(row, passedRows);
     }
   }
 
@@ -104,6 +129,160 @@ void TopN::addInput(RowVectorPtr input) {
       }
     }
   }
+  maybePushdownThreshold();
+}
+
+void TopN::addRow(
+    vector_size_t row,
+    folly::F14FastMap<void*, vector_size_t>& passedRows) {
+  char* newRow = nullptr;
+  if (topRows_.size() < count_) {
+    newRow = data_->newRow();
+  } else {
+    char* topRow = topRows_.top();
+
+    if (!comparator_(decodedVectors_, row, topRow)) {
+      return;
+    }
+    topRows_.pop();
+    // Reuse the topRow's memory.
+    newRow = data_->initializeRow(topRow, true /* reuse */);
+  }
+
+  data_->initializeFields(newRow);
+  for (const auto col : sortingKeyColumns_) {
+    data_->store(decodedVectors_[col], row, newRow, col);
+  }
+
+  topRows_.push(newRow);
+  if (!nonKeyColumns_.empty()) {
+    passedRows[newRow] = row;
+  }
+}
+
+bool TopN::selectCandidates(vector_size_t begin, vector_size_t end) {
+  if (!supportsThreshold(firstKeyKind_) ||
+      !decodedVectors_[sortingKeyColumns_[0]].isIdentityMapping() ||
+      RowContainer::isNullAt(topRows_.top(), firstKeyColumn_)) {
+    return false;
+  }
+  switch (firstKeyKind_) {
+    case TypeKind::TINYINT:
+      selectCandidatesTyped<int8_t>(begin, end);
+      break;
+    case TypeKind::SMALLINT:
+      selectCandidatesTyped<int16_t>(begin, end);
+      break;
+    case TypeKind::INTEGER:
+      selectCandidatesTyped<int32_t>(begin, end);
+      break;
+    case TypeKind::BIGINT:
+      selectCandidatesTyped<int64_t>(begin, end);
+      break;
+    case TypeKind::TIMESTAMP:
+      selectCandidatesTyped<Timestamp>(begin, end);
+      break;
+    default:
+      VELOX_UNREACHABLE();
+  }
+  return true;
+}
+
+template <typename T>
+void TopN::selectCandidatesTyped(vector_size_t begin, vector_size_t end) {
+  auto& decoded = decodedVectors_[sortingKeyColumns_[0]];
+  const auto* values = decoded.data<T>();
+  const auto* nulls = decoded.nulls();
+  const auto threshold =
+      RowContainer::valueAt<T>(topRows_.top(), firstKeyColumn_.offset());
+  candidateBits_.resize(bits::nwords(end));
+  // A branch free loop over each word of rows so that integer compares are
+  // vectorized.
+  for (auto word = begin / 64; word < candidateBits_.size(); ++word) {
+    const auto wordBegin = word * 64;
+    const auto wordEnd = std::min<vector_size_t>(wordBegin + 64, end);
+    uint64_t mask = 0;
+    for (auto row = wordBegin; row < wordEnd; ++row) {
+      const bool notWorse = firstKeyAscending_ ? !(threshold < values[row])
+                                               : !(values[row] < threshold);
+      mask |= static_cast<uint64_t>(notWorse) << (row - wordBegin);
+    }
+    // Null keys are left to the comparator.
+    if (nulls != nullptr) {
+      mask |= ~nulls[word];
+    }
+    candidateBits_[word] = mask;
+  }
+  candidates_.resize(end - begin);
+  candidates_.resize(simd::indicesOfSetBits(
+      candidateBits_.data(), begin, end, candidates_.data()));
+}
+
+void TopN::maybePushdownThreshold() {
+  if (!canPushdownThreshold_ || topRows_.size() < count_ ||
+      !supportsThreshold(firstKeyKind_) ||
+      RowContainer::isNullAt(topRows_.top(), firstKeyColumn_)) {
+    return;
+  }
+  switch (firstKeyKind_) {
+    case TypeKind::TINYINT:
+      pushdownThreshold<int8_t>();
+      break;
+    case TypeKind::SMALLINT:
+      pushdownThreshold<int16_t>();
+      break;
+    case TypeKind::INTEGER:
+      pushdownThreshold<int32_t>();
+      break;
+    case TypeKind::BIGINT:
+      pushdownThreshold<int64_t>();
+      break;
+    case TypeKind::TIMESTAMP:
+      pushdownThreshold<Timestamp>();
+      break;
+    default:
+      VELOX_UNREACHABLE();
+  }
+}
+
+template <typename T>
+void TopN::pushdownThreshold() {
+  const auto threshold =
+      RowContainer::valueAt<T>(topRows_.top(), firstKeyColumn_.offset());
+  if (pushedThreshold_ == thresholdValue(threshold)) {
+    return;
+  }
+  pushedThreshold_ = thresholdValue(threshold);
+  // Rows with a first key equal to the threshold may still be among the top
+  // rows on the other keys. Nulls are among the top rows only if they sort
+  // first.
+  common::FilterPtr filter;
+  if constexpr (std::is_same_v<T, Timestamp>) {
+    filter = firstKeyAscending_
+        ? std::make_unique<common::TimestampRange>(
+              Timestamp::min(), threshold, firstKeyNullsFirst_)
+        : std::make_unique<common::TimestampRange>(
+              threshold, Timestamp::max(), firstKeyNullsFirst_);
+  } else {
+    filter = firstKeyAscending_
+        ? std::make_unique<common::BigintRange>(
+              std::numeric_limits<int64_t>::min(),
+              threshold,
+              firstKeyNullsFirst_)
+        : std::make_unique<common::BigintRange>(
+              threshold,
+              std::numeric_limits<int64_t>::max(),
+              firstKeyNullsFirst_);
+  }
+  auto* driver = operatorCtx_->driverCtx()->driver;
+  const auto numFilters = driver->pushdownFilters(
+      this,
+      {sortingKeyColumns_[0]},
+      [&](column_index_t /*channel*/, common::FilterPtr& pushedFilter) {
+        pushedFilter = std::move(filter);
+        return true;
+      });
+  canPushdownThreshold_ = numFilters > 0;
 }
 
 RowVectorPtr TopN::getOutput() {
@@ -44,6 +44,30 @@ class TopN : public Operator {
   bool isFinished() override;
 
  private:
+  // Adds input row 'row' to 'topRows_' if it is among the top 'count_' rows
+  // so far. Records the row of 'data_' in 'passedRows' if there are non-key
+  // columns to store.
+  void addRow(
+      vector_size_t row,
+      folly::F14FastMap<void*, vector_size_t>& passedRows);
+
+  // Sets 'candidates_' to the input rows in [begin, end) whose first sorting
+  // key is not worse than the first key of the top of 'topRows_'. The other
+  // rows cannot be among the top rows. Returns false if the first key is not
+  // a flat integer or timestamp or the threshold is null.
+  bool selectCandidates(vector_size_t begin, vector_size_t end);
+
+  template <typename T>
+  void selectCandidatesTyped(vector_size_t begin, vector_size_t end);
+
+  // Pushes the first key of the top of 'topRows_' down to the source of the
+  // pipeline as a range filter on the first sorting key, if it changed since
+  // the last push.
+  void maybePushdownThreshold();
+
+  template <typename T>
+  void pushdownThreshold();
+
   const int32_t count_;
 
   bool finished_ = false;
@@ -68,5 +92,22 @@ class TopN : public Operator {
 
   std::vector<DecodedVector> decodedVectors_;
   vector_size_t outputBatchSize_;
+
+  // The type and sort order of the first sorting key.
+  const TypeKind firstKeyKind_;
+  const bool firstKeyAscending_;
+  const bool firstKeyNullsFirst_;
+  const RowColumn firstKeyColumn_;
+
+  // False after the upstream operators did not accept the threshold filter.
+  bool canPushdownThreshold_{true};
+
+  // The threshold of the last pushed down filter in the order of the first
+  // key.
+  std::optional<int128_t> pushedThreshold_;
+
+  // Reusable memory for selectCandidates().
+  std::vector<uint64_t> candidateBits_;
+  std::vector<vector_size_t> candidates_;
 };
 } // namespace facebook::velox::exec
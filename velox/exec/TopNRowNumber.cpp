@@ -330,7 +330,11 @@ void TopNRowNumber::noMoreInput() {
     spiller_->finishSpill(spillPartitionSet);
     VELOX_CHECK_EQ(spillPartitionSet.size(), 1);
     merge_ = spillPartitionSet.begin()->second->createOrderedReader(
-        spillConfig_->readBufferSize, pool(), spillStats_.get());
+        spillConfig_->readBufferSize,
+        pool(),
+        spillStats_.get(),
+        spillConfig_->numReadAheadBuffers,
+        spillConfig_->executor);
   } else {
     outputRows_.resize(outputBatchSize_);
   }
@@ -677,7 +681,7 @@ void TopNRowNumber::close() {
 }
 
 void TopNRowNumber::reclaim(
-    uint64_t /*targetBytes*/,
+    uint64_t targetBytes,
     memory::MemoryReclaimer::Stats& stats) {
   VELOX_CHECK(canReclaim());
   VELOX_CHECK(!nonReclaimableSection_);
@@ -701,9 +705,41 @@ void TopNRowNumber::reclaim(
     return;
   }
 
+  if (compactData(targetBytes)) {
+    return;
+  }
+
   spill();
 }
 
+bool TopNRowNumber::compactData(uint64_t targetBytes) {
+  // Compaction copies all live strings, so only attempt it when at least
+  // half of the string storage is free and there is enough to matter.
+  constexpr uint64_t kMinCompactionBytes = 1 << 20;
+  if (targetBytes == 0) {
+    return false;
+  }
+  const auto& allocator = data_->stringAllocator();
+  const auto retainedBytes = allocator.retainedSize();
+  if (retainedBytes < kMinCompactionBytes ||
+      allocator.freeSpace() * 2 < retainedBytes) {
+    return false;
+  }
+
+  const auto reservedBytes = pool()->reservedBytes();
+  const auto compactedBytes = data_->compactStringData();
+  if (compactedBytes <= 0) {
+    return false;
+  }
+  addRuntimeStat(
+      kCompactedBytes,
+      RuntimeCounter(compactedBytes, RuntimeCounter::Unit::kBytes));
+  pool()->release();
+  const auto newReservedBytes = pool()->reservedBytes();
+  return newReservedBytes < reservedBytes &&
+      reservedBytes - newReservedBytes >= targetBytes;
+}
+
 void TopNRowNumber::ensureInputFits(const RowVectorPtr& input) {
   if (!spillEnabled()) {
     // Spilling is disabled.
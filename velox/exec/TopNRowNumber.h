@@ -70,6 +70,10 @@ class TopNRowNumber : public Operator {
   void reclaim(uint64_t targetBytes, memory::MemoryReclaimer::Stats& stats)
       override;
 
+  /// Bytes of out-of-line string storage released by compacting 'data_'
+  /// instead of spilling it.
+  static inline const std::string kCompactedBytes{"compactedBytes"};
+
  private:
   // A priority queue to keep track of top 'limit' rows for a given partition.
   struct TopRows {
@@ -139,6 +143,11 @@ class TopNRowNumber : public Operator {
   // Sorts, spills and clears all of 'data_'. Clears 'table_'.
   void spill();
 
+  // Compacts the string storage of 'data_' if a large part of it is free.
+  // Returns true if this released at least 'targetBytes' of reservation so
+  // that spilling is not needed.
+  bool compactData(uint64_t targetBytes);
+
   void setupSpiller();
 
   RowVectorPtr getOutputFromSpill();
@@ -27,24 +27,28 @@ std::string OperatorTraceSummary::toString() const {
   if (numSplits.has_value()) {
     VELOX_CHECK_EQ(opType, "TableScan");
     return fmt::format(
-        "opType {}, numSplits {}, inputRows {}, inputBytes {}, rawInputRows {}, rawInputBytes {}, peakMemory {}",
+        "opType {}, numSplits {}, inputRows {}, inputBytes {}, rawInputRows {}, rawInputBytes {}, peakMemory {}, cpuTime {}, wallTime {}",
         opType,
         numSplits.value(),
         inputRows,
         succinctBytes(inputBytes),
         rawInputRows,
         succinctBytes(rawInputBytes),
-        succinctBytes(peakMemory));
+        succinctBytes(peakMemory),
+        succinctNanos(cpuTimeNanos),
+        succinctNanos(wallTimeNanos));
   } else {
     VELOX_CHECK_NE(opType, "TableScan");
     return fmt::format(
-        "opType {}, inputRows {},  inputBytes {}, rawInputRows {}, rawInputBytes {}, peakMemory {}",
+        "opType {}, inputRows {},  inputBytes {}, rawInputRows {}, rawInputBytes {}, peakMemory {}, cpuTime {}, wallTime {}",
         opType,
         inputRows,
         succinctBytes(inputBytes),
         rawInputRows,
         succinctBytes(rawInputBytes),
-        succinctBytes(peakMemory));
+        succinctBytes(peakMemory),
+        succinctNanos(cpuTimeNanos),
+        succinctNanos(wallTimeNanos));
   }
 }
 } // namespace facebook::velox::exec::trace
@@ -44,6 +44,8 @@ struct OperatorTraceTraits {
   static inline const std::string kRawInputRowsKey = "rawInputRows";
   static inline const std::string kRawInputBytesKey = "rawInputBytes";
   static inline const std::string kNumSplitsKey = "numSplits";
+  static inline const std::string kCpuTimeNanosKey = "cpuTimeNanos";
+  static inline const std::string kWallTimeNanosKey = "wallTimeNanos";
 };
 
 /// Contains the summary of an operator trace.
@@ -58,6 +60,10 @@ struct OperatorTraceSummary {
   uint64_t rawInputRows{0};
   uint64_t rawInputBytes{0};
   uint64_t peakMemory{0};
+  /// The cpu and wall time spent in the traced operator when its trace was
+  /// written. They are zero for traces written without timing.
+  uint64_t cpuTimeNanos{0};
+  uint64_t wallTimeNanos{0};
 
   std::string toString() const;
 };
@@ -123,6 +123,31 @@ class TreeOfLosers {
     return lastIndex_ == kEmpty ? nullptr : streams_[lastIndex_].get();
   }
 
+  /// Returns the stream with the lowest first element among the streams other
+  /// than the one returned by the last call to next(), or nullptr if there is
+  /// no other stream with data. The caller may take all the elements of the
+  /// stream returned by next() that are not greater than the first element of
+  /// the returned stream before calling next() again. Must be called before
+  /// the caller pops off any element of the stream returned by next().
+  Stream* runnerUp() const {
+    if (values_.empty() || lastIndex_ == kEmpty) {
+      return nullptr;
+    }
+    // The runner-up lost to the winner on the path from the winner's leaf to
+    // the root, so it is the lowest of the losers kept on this path.
+    TIndex runnerUp = kEmpty;
+    int32_t node = firstStream_ + lastIndex_;
+    do {
+      node = parent(node);
+      const auto loser = values_[node];
+      if (loser != kEmpty &&
+          (runnerUp == kEmpty || *streams_[loser] < *streams_[runnerUp])) {
+        runnerUp = loser;
+      }
+    } while (node != 0);
+    return runnerUp == kEmpty ? nullptr : streams_[runnerUp].get();
+  }
+
   /// Returns the stream with the lowest first element and a flag that is true
   /// if there is another equal value to come from some other stream. The
   /// streams should have ordered unique values when using this function. This
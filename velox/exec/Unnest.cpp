@@ -122,6 +122,14 @@ void Unnest::addInput(RowVectorPtr input) {
     // Count max number of elements per row.
     auto* currentSizes = rawSizes_[channel];
     auto* currentIndices = rawIndices_[channel];
+    if (currentDecoded.isIdentityMapping() && !currentDecoded.mayHaveNulls()) {
+      // Fast path for flat arrays without nulls. The loop has no branches and
+      // gets vectorized.
+      for (auto row = 0; row < size; ++row) {
+        rawMaxSizes_[row] = std::max(rawMaxSizes_[row], currentSizes[row]);
+      }
+      continue;
+    }
     for (auto row = 0; row < size; ++row) {
       if (!currentDecoded.isNullAt(row)) {
         const auto unnestSize = currentSizes[currentIndices[row]];
@@ -231,6 +239,19 @@ Unnest::RowRange Unnest::extractRowRange(vector_size_t inputSize) const {
 void Unnest::generateRepeatedColumns(
     const RowRange& range,
     std::vector<VectorPtr>& outputs) {
+  if (range.numInputRows == 1) {
+    // All the output rows come from the same input row, e.g. when a large
+    // array is split into multiple output batches. Wrap the replicated
+    // columns in constant encoding to avoid building the indices.
+    for (const auto& projection : identityProjections_) {
+      outputs.at(projection.outputChannel) = BaseVector::wrapInConstant(
+          range.numInnerRows,
+          range.startInputRow,
+          input_->childAt(projection.inputChannel));
+    }
+    return;
+  }
+
   // Create "indices" buffer to repeat rows as many times as there are elements
   // in the array (or map) in unnestDecoded.
   auto repeatedIndices = allocateIndices(range.numInnerRows, pool());
@@ -296,6 +317,11 @@ const Unnest::UnnestChannelEncoding Unnest::generateEncodingForChannel(
 
   // Make dictionary index for elements column since they may be out of order.
   vector_size_t index = 0;
+  // The offset in the base elements of the first output element. The output
+  // is a slice of the base elements if all the output elements are contiguous
+  // from this offset. This also holds for the partially processed rows when
+  // the output is split into multiple batches.
+  std::optional<vector_size_t> firstElementOffset;
   bool identityMapping = true;
   VELOX_DCHECK_GT(range.numInputRows, 0);
 
@@ -308,24 +334,31 @@ const Unnest::UnnestChannelEncoding Unnest::generateEncodingForChannel(
         } else if (!currentDecoded.isNullAt(row)) {
           const auto offset = currentOffsets[currentIndices[row]];
           const auto unnestSize = currentSizes[currentIndices[row]];
-          // The 'identityMapping' is false when there exists a partially
-          // processed row.
-          if (index != offset || start != 0 || end != rawMaxSizes_[row] ||
+          if (!firstElementOffset.has_value()) {
+            firstElementOffset = offset + start;
+          }
+          if (offset + start != firstElementOffset.value() + index ||
               unnestSize < end) {
             identityMapping = false;
           }
           const auto currentUnnestSize = std::min(end, unnestSize);
-          for (auto i = start; i < currentUnnestSize; ++i) {
-            rawInnerRowIndices[index++] = offset + i;
+          if (start < currentUnnestSize) {
+            const auto numElements = currentUnnestSize - start;
+            std::iota(
+                rawInnerRowIndices + index,
+                rawInnerRowIndices + index + numElements,
+                offset + start);
+            index += numElements;
           }
-          for (auto i = std::max(start, currentUnnestSize); i < end; ++i) {
-            bits::setNull(rawNulls, index++, true);
+          const auto numNulls = end - std::max(start, currentUnnestSize);
+          if (numNulls > 0) {
+            bits::fillBits(rawNulls, index, index + numNulls, bits::kNull);
+            index += numNulls;
           }
         } else if (size > 0) {
           identityMapping = false;
-          for (auto i = start; i < end; ++i) {
-            bits::setNull(rawNulls, index++, true);
-          }
+          bits::fillBits(rawNulls, index, index + size, bits::kNull);
+          index += size;
         }
       },
       rawMaxSizes_,
@@ -85,6 +85,12 @@ void VectorHasher::hashValues(
     const SelectivityVector& rows,
     bool mix,
     uint64_t* result) {
+  if constexpr (Kind == TypeKind::ROW || Kind == TypeKind::ARRAY) {
+    if (!decoded_.isConstantMapping() &&
+        hashComplexValues(rows, mix, result)) {
+      return;
+    }
+  }
   if (decoded_.isConstantMapping()) {
     auto hash = decoded_.isNullAt(rows.begin())
         ? kNullHash
@@ -122,6 +128,96 @@ void VectorHasher::hashValues(
   }
 }
 
+bool VectorHasher::hashComplexValues(
+    const SelectivityVector& rows,
+    bool mix,
+    uint64_t* result) {
+  const auto* base = decoded_.base();
+  baseRows_.resizeFill(base->size(), false);
+  rows.applyToSelected([&](vector_size_t row) {
+    if (!decoded_.isNullAt(row)) {
+      baseRows_.setValid(decoded_.index(row), true);
+    }
+  });
+  baseRows_.updateBounds();
+  baseHashes_.resize(base->size());
+
+  if (typeKind_ == TypeKind::ROW) {
+    if (!hashRowFields(*base->asUnchecked<RowVector>())) {
+      return false;
+    }
+  } else {
+    hashArrayElements(*base->asUnchecked<ArrayVector>());
+  }
+
+  rows.applyToSelected([&](vector_size_t row) {
+    const auto hash =
+        decoded_.isNullAt(row) ? kNullHash : baseHashes_[decoded_.index(row)];
+    result[row] = mix ? bits::hashMix(result[row], hash) : hash;
+  });
+  return true;
+}
+
+bool VectorHasher::hashRowFields(const RowVector& base) {
+  const auto numFields = type_->size();
+  if (base.childrenSize() != numFields) {
+    return false;
+  }
+  for (const auto& child : base.children()) {
+    if (child == nullptr) {
+      return false;
+    }
+  }
+  if (numFields == 0) {
+    baseRows_.applyToSelected(
+        [&](vector_size_t row) { baseHashes_[row] = kNullHash; });
+    return true;
+  }
+  if (childHashers_.empty()) {
+    for (auto i = 0; i < numFields; ++i) {
+      childHashers_.push_back(create(type_->childAt(i), i));
+    }
+  }
+  // The first field sets the hash and later fields are mixed in, as in
+  // RowVector::hashValueAt().
+  for (auto i = 0; i < numFields; ++i) {
+    childHashers_[i]->decode(*base.childAt(i), baseRows_);
+    childHashers_[i]->hash(baseRows_, i > 0, baseHashes_);
+  }
+  return true;
+}
+
+void VectorHasher::hashArrayElements(const ArrayVector& base) {
+  const auto& elements = base.elements();
+  const auto* rawOffsets = base.rawOffsets();
+  const auto* rawSizes = base.rawSizes();
+  elementRows_.resizeFill(elements->size(), false);
+  baseRows_.applyToSelected([&](vector_size_t row) {
+    elementRows_.setValidRange(
+        rawOffsets[row], rawOffsets[row] + rawSizes[row], true);
+  });
+  elementRows_.updateBounds();
+
+  if (elementRows_.hasSelections()) {
+    if (childHashers_.empty()) {
+      childHashers_.push_back(create(type_->childAt(0), 0));
+    }
+    elementHashes_.resize(elements->size());
+    childHashers_[0]->decode(*elements, elementRows_);
+    childHashers_[0]->hash(elementRows_, false, elementHashes_);
+  }
+
+  // Elements are mixed in order, as in ArrayVector::hashValueAt().
+  baseRows_.applyToSelected([&](vector_size_t row) {
+    uint64_t hash = kNullHash;
+    const auto offset = rawOffsets[row];
+    for (auto i = 0; i < rawSizes[row]; ++i) {
+      hash = bits::hashMix(hash, elementHashes_[offset + i]);
+    }
+    baseHashes_[row] = hash;
+  });
+}
+
 template <TypeKind Kind>
 bool VectorHasher::makeValueIds(
     const SelectivityVector& rows,
@@ -562,6 +658,110 @@ void VectorHasher::hash(
   }
 }
 
+namespace {
+template <typename T>
+FOLLY_ALWAYS_INLINE uint64_t
+hashFlatValue(const void* values, vector_size_t row) {
+  const T value = reinterpret_cast<const T*>(values)[row];
+  if constexpr (std::is_floating_point_v<T>) {
+    return util::floating_point::NaNAwareHash<T>()(value);
+  } else {
+    return folly::hasher<T>()(value);
+  }
+}
+} // namespace
+
+bool VectorHasher::makeFlatKey(FlatKey& key) {
+  if (channel_ == kConstantChannel || !decoded_.isIdentityMapping() ||
+      type_->providesCustomComparison()) {
+    return false;
+  }
+  switch (typeKind_) {
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+    case TypeKind::REAL:
+    case TypeKind::DOUBLE:
+      break;
+    default:
+      return false;
+  }
+  key.kind = typeKind_;
+  key.values = decoded_.data<char>();
+  key.nulls = decoded_.nulls();
+  return true;
+}
+
+void VectorHasher::hashFlatKeys(
+    const FlatKey* keys,
+    int32_t numKeys,
+    const SelectivityVector& rows,
+    bool mix,
+    uint64_t* result) {
+  // Gives the same hash as hashOne() for the key types accepted by
+  // makeFlatKey(). The switch goes the same way for all rows of a key.
+  auto hashKey = [](const FlatKey& key, vector_size_t row) INLINE_LAMBDA {
+    if (key.nulls != nullptr && bits::isBitNull(key.nulls, row)) {
+      return kNullHash;
+    }
+    switch (key.kind) {
+      case TypeKind::TINYINT:
+        return hashFlatValue<int8_t>(key.values, row);
+      case TypeKind::SMALLINT:
+        return hashFlatValue<int16_t>(key.values, row);
+      case TypeKind::INTEGER:
+        return hashFlatValue<int32_t>(key.values, row);
+      case TypeKind::BIGINT:
+        return hashFlatValue<int64_t>(key.values, row);
+      case TypeKind::REAL:
+        return hashFlatValue<float>(key.values, row);
+      case TypeKind::DOUBLE:
+        return hashFlatValue<double>(key.values, row);
+      default:
+        VELOX_UNREACHABLE();
+    }
+  };
+  rows.applyToSelected([&](vector_size_t row) {
+    uint64_t hash = hashKey(keys[0], row);
+    if (mix) {
+      hash = bits::hashMix(result[row], hash);
+    }
+    for (auto i = 1; i < numKeys; ++i) {
+      hash = bits::hashMix(hash, hashKey(keys[i], row));
+    }
+    result[row] = hash;
+  });
+}
+
+// static
+void VectorHasher::hashAll(
+    const std::vector<std::unique_ptr<VectorHasher>>& hashers,
+    const SelectivityVector& rows,
+    raw_vector<uint64_t>& result) {
+  std::array<FlatKey, kMaxFlatKeys> keys;
+  size_t i = 0;
+  while (i < hashers.size()) {
+    int32_t numKeys = 0;
+    while (numKeys < kMaxFlatKeys && i + numKeys < hashers.size() &&
+           hashers[i + numKeys]->makeFlatKey(keys[numKeys])) {
+      ++numKeys;
+    }
+    if (numKeys > 1) {
+      hashFlatKeys(keys.data(), numKeys, rows, i > 0, result.data());
+      i += numKeys;
+      continue;
+    }
+    auto& hasher = hashers[i];
+    if (hasher->channel() == kConstantChannel) {
+      hasher->hashPrecomputed(rows, i > 0, result);
+    } else {
+      hasher->hash(rows, i > 0, result);
+    }
+    ++i;
+  }
+}
+
 void VectorHasher::hashPrecomputed(
     const SelectivityVector& rows,
     bool mix,
@@ -183,6 +183,19 @@ class VectorHasher {
   void
   hash(const SelectivityVector& rows, bool mix, raw_vector<uint64_t>& result);
 
+  // Computes the hashes of 'rows' over all 'hashers' into 'result', the same
+  // as calling hash() with 'mix' set for all but the first hasher, or
+  // hashPrecomputed() for hashers of constant channels. Runs of up to
+  // kMaxFlatKeys consecutive flat keys of fixed-width types are hashed in a
+  // single pass over the rows instead of one pass per key.
+  static void hashAll(
+      const std::vector<std::unique_ptr<VectorHasher>>& hashers,
+      const SelectivityVector& rows,
+      raw_vector<uint64_t>& result);
+
+  // Maximum number of flat keys that hashAll() hashes in one pass.
+  static constexpr int32_t kMaxFlatKeys = 8;
+
   // Computes a hash for 'rows' using precomputedHash_ (just like from a const
   // vector) and stores it in 'result'.
   // If 'mix' is true, mixes the hash with existing value in 'result'.
@@ -548,6 +561,41 @@ class VectorHasher {
   template <bool typeProvidesCustomComparison, TypeKind Kind>
   void hashValues(const SelectivityVector& rows, bool mix, uint64_t* result);
 
+  // Hashes the ROW or ARRAY values of 'decoded_' one field or all elements at
+  // a time instead of one value at a time. Gives the same hashes as
+  // BaseVector::hashValueAt(). Returns false if the values cannot be hashed
+  // this way.
+  bool hashComplexValues(
+      const SelectivityVector& rows,
+      bool mix,
+      uint64_t* result);
+
+  // Values and nulls of a flat key of fixed-width type.
+  struct FlatKey {
+    TypeKind kind;
+    const void* values;
+    const uint64_t* nulls;
+  };
+
+  // Sets 'key' to 'decoded_' and returns true if this is a flat key of a
+  // fixed-width type without custom hash, which hashFlatKeys() can hash.
+  bool makeFlatKey(FlatKey& key);
+
+  // Hashes 'numKeys' 'keys' for 'rows' in a single pass, mixing into 'result'
+  // if 'mix' is true and otherwise starting from the hash of the first key.
+  static void hashFlatKeys(
+      const FlatKey* keys,
+      int32_t numKeys,
+      const SelectivityVector& rows,
+      bool mix,
+      uint64_t* result);
+
+  // Sets 'baseHashes_' for 'baseRows_' of RowVector 'base'.
+  bool hashRowFields(const RowVector& base);
+
+  // Sets 'baseHashes_' for 'baseRows_' of ArrayVector 'base'.
+  void hashArrayElements(const ArrayVector& base);
+
   const column_index_t channel_;
   const TypePtr type_;
   const TypeKind typeKind_;
@@ -555,6 +603,17 @@ class VectorHasher {
   DecodedVector decoded_;
   raw_vector<uint64_t> cachedHashes_;
 
+  // Hashers for the fields of a ROW or the elements of an ARRAY. Created on
+  // first use by hashComplexValues().
+  std::vector<std::unique_ptr<VectorHasher>> childHashers_;
+  // Non-null rows of the base vector of 'decoded_' that are hashed by
+  // hashComplexValues() and their hashes.
+  SelectivityVector baseRows_;
+  raw_vector<uint64_t> baseHashes_;
+  // Elements of the arrays in 'baseRows_' and their hashes.
+  SelectivityVector elementRows_;
+  raw_vector<uint64_t> elementHashes_;
+
   // Single precomputed hash for constant partition keys.
   uint64_t precomputedHash_{0};
 
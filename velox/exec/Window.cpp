@@ -36,9 +36,7 @@ Window::Window(
               ? driverCtx->makeSpillConfig(operatorId)
               : std::nullopt),
       numInputColumns_(windowNode->inputType()->size()),
-      windowNode_(windowNode),
-      currentPartition_(nullptr),
-      stringAllocator_(pool()) {
+      windowNode_(windowNode) {
   auto* spillConfig =
       spillConfig_.has_value() ? &spillConfig_.value() : nullptr;
   if (spillConfig == nullptr &&
@@ -71,12 +69,42 @@ Window::Window(
 void Window::initialize() {
   Operator::initialize();
   VELOX_CHECK_NOT_NULL(windowNode_);
-  createWindowFunctions();
-  createPeerAndFrameBuffers();
+  // TODO: This computation needs to be revised. It only takes into account
+  // the input columns size. We need to also account for the output columns.
+  numRowsPerOutput_ = outputBatchRows(windowBuild_->estimateRowSize());
+  const auto& config = operatorCtx_->driverCtx()->queryConfig();
+  evaluator_ = std::make_unique<PartitionEvaluator>(
+      windowNode_, numRowsPerOutput_, pool(), config);
+
+  // Only a sort based build has all partitions available at once.
+  const auto numThreads = config.windowParallelPartitionThreads();
+  if (numThreads > 1 && !windowNode_->inputsSorted()) {
+    parallelExecutor_ = operatorCtx_->task()->queryCtx()->executor();
+  }
+  if (parallelExecutor_ != nullptr) {
+    for (auto i = 0; i < numThreads; ++i) {
+      parallelEvaluators_.push_back(std::make_unique<PartitionEvaluator>(
+          windowNode_, numRowsPerOutput_, pool(), config));
+      freeEvaluators_.push_back(parallelEvaluators_.back().get());
+    }
+  }
   windowBuild_->setNumRowsPerOutput(numRowsPerOutput_);
   windowNode_.reset();
 }
 
+Window::PartitionEvaluator::PartitionEvaluator(
+    const std::shared_ptr<const core::WindowNode>& windowNode,
+    vector_size_t numRowsPerOutput,
+    memory::MemoryPool* pool,
+    const core::QueryConfig& config)
+    : pool_(pool),
+      numInputColumns_(windowNode->inputType()->size()),
+      numRowsPerOutput_(numRowsPerOutput),
+      stringAllocator_(pool) {
+  createWindowFunctions(windowNode, config);
+  createPeerAndFrameBuffers();
+}
+
 namespace {
 void checkRowFrameBounds(const core::WindowNode::Frame& frame) {
   auto frameBoundCheck = [&](const core::TypedExprPtr& frameValue) -> void {
@@ -129,7 +157,8 @@ void checkKRangeFrameBounds(
 
 } // namespace
 
-Window::WindowFrame Window::createWindowFrame(
+Window::PartitionEvaluator::WindowFrame
+Window::PartitionEvaluator::createWindowFrame(
     const std::shared_ptr<const core::WindowNode>& windowNode,
     const core::WindowNode::Frame& frame,
     const RowTypePtr& inputType) {
@@ -161,7 +190,7 @@ Window::WindowFrame Window::createWindowFrame(
     } else {
       return std::make_optional(FrameChannelArg{
           frameChannel,
-          BaseVector::create(frame->type(), 0, pool()),
+          BaseVector::create(frame->type(), 0, pool_),
           std::nullopt});
     }
   };
@@ -176,13 +205,14 @@ Window::WindowFrame Window::createWindowFrame(
        std::move(endFrameArg)});
 }
 
-void Window::createWindowFunctions() {
-  VELOX_CHECK_NOT_NULL(windowNode_);
+void Window::PartitionEvaluator::createWindowFunctions(
+    const std::shared_ptr<const core::WindowNode>& windowNode,
+    const core::QueryConfig& config) {
   VELOX_CHECK(windowFunctions_.empty());
   VELOX_CHECK(windowFrames_.empty());
 
-  const auto& inputType = windowNode_->sources()[0]->outputType();
-  for (const auto& windowNodeFunction : windowNode_->windowFunctions()) {
+  const auto& inputType = windowNode->sources()[0]->outputType();
+  for (const auto& windowNodeFunction : windowNode->windowFunctions()) {
     std::vector<WindowFunctionArg> functionArgs;
     functionArgs.reserve(windowNodeFunction.functionCall->inputs().size());
     for (auto& arg : windowNodeFunction.functionCall->inputs()) {
@@ -190,7 +220,7 @@ void Window::createWindowFunctions() {
       if (channel == kConstantChannel) {
         const auto constantArg = core::TypedExprs::asConstant(arg);
         functionArgs.push_back(
-            {arg->type(), constantArg->toConstantVector(pool()), std::nullopt});
+            {arg->type(), constantArg->toConstantVector(pool_), std::nullopt});
       } else {
         functionArgs.push_back({arg->type(), nullptr, channel});
       }
@@ -201,12 +231,12 @@ void Window::createWindowFunctions() {
         functionArgs,
         windowNodeFunction.functionCall->type(),
         windowNodeFunction.ignoreNulls,
-        operatorCtx_->pool(),
+        pool_,
         &stringAllocator_,
-        operatorCtx_->driverCtx()->queryConfig()));
+        config));
 
     windowFrames_.push_back(
-        createWindowFrame(windowNode_, windowNodeFunction.frame, inputType));
+        createWindowFrame(windowNode, windowNodeFunction.frame, inputType));
   }
 }
 
@@ -259,15 +289,11 @@ void Window::reclaim(
   windowBuild_->spill();
 }
 
-void Window::createPeerAndFrameBuffers() {
-  // TODO: This computation needs to be revised. It only takes into account
-  // the input columns size. We need to also account for the output columns.
-  numRowsPerOutput_ = outputBatchRows(windowBuild_->estimateRowSize());
-
-  peerStartBuffer_ = AlignedBuffer::allocate<vector_size_t>(
-      numRowsPerOutput_, operatorCtx_->pool());
-  peerEndBuffer_ = AlignedBuffer::allocate<vector_size_t>(
-      numRowsPerOutput_, operatorCtx_->pool());
+void Window::PartitionEvaluator::createPeerAndFrameBuffers() {
+  peerStartBuffer_ =
+      AlignedBuffer::allocate<vector_size_t>(numRowsPerOutput_, pool_);
+  peerEndBuffer_ =
+      AlignedBuffer::allocate<vector_size_t>(numRowsPerOutput_, pool_);
 
   const auto numFuncs = windowFunctions_.size();
   frameStartBuffers_.reserve(numFuncs);
@@ -275,10 +301,10 @@ void Window::createPeerAndFrameBuffers() {
   validFrames_.reserve(numFuncs);
 
   for (auto i = 0; i < numFuncs; i++) {
-    BufferPtr frameStartBuffer = AlignedBuffer::allocate<vector_size_t>(
-        numRowsPerOutput_, operatorCtx_->pool());
-    BufferPtr frameEndBuffer = AlignedBuffer::allocate<vector_size_t>(
-        numRowsPerOutput_, operatorCtx_->pool());
+    BufferPtr frameStartBuffer =
+        AlignedBuffer::allocate<vector_size_t>(numRowsPerOutput_, pool_);
+    BufferPtr frameEndBuffer =
+        AlignedBuffer::allocate<vector_size_t>(numRowsPerOutput_, pool_);
     frameStartBuffers_.push_back(frameStartBuffer);
     frameEndBuffers_.push_back(frameEndBuffer);
     validFrames_.push_back(SelectivityVector(numRowsPerOutput_));
@@ -291,12 +317,18 @@ void Window::noMoreInput() {
 }
 
 void Window::callResetPartition() {
+  evaluator_->resetPartition(
+      windowBuild_->hasNextPartition() ? windowBuild_->nextPartition()
+                                       : nullptr);
+}
+
+void Window::PartitionEvaluator::resetPartition(
+    std::shared_ptr<WindowPartition> partition) {
   partitionOffset_ = 0;
   peerStartRow_ = 0;
   peerEndRow_ = 0;
-  currentPartition_ = nullptr;
-  if (windowBuild_->hasNextPartition()) {
-    currentPartition_ = windowBuild_->nextPartition();
+  currentPartition_ = std::move(partition);
+  if (currentPartition_ != nullptr) {
     for (int i = 0; i < windowFunctions_.size(); ++i) {
       windowFunctions_[i]->resetPartition(currentPartition_.get());
     }
@@ -345,7 +377,7 @@ void updateKRowsOffsetsColumn(
 
 } // namespace
 
-void Window::updateKRowsFrameBounds(
+void Window::PartitionEvaluator::updateKRowsFrameBounds(
     bool isKPreceding,
     const FrameChannelArg& frameArg,
     vector_size_t startRow,
@@ -403,7 +435,7 @@ void Window::updateKRowsFrameBounds(
   }
 }
 
-void Window::updateFrameBounds(
+void Window::PartitionEvaluator::updateFrameBounds(
     const WindowFrame& windowFrame,
     const bool isStartBound,
     const vector_size_t startRow,
@@ -510,7 +542,7 @@ void computeValidFrames(
 }
 } // namespace
 
-void Window::computePeerAndFrameBuffers(
+void Window::PartitionEvaluator::computePeerAndFrameBuffers(
     vector_size_t startRow,
     vector_size_t endRow) {
   const vector_size_t numRows = endRow - startRow;
@@ -580,7 +612,7 @@ void Window::computePeerAndFrameBuffers(
   }
 }
 
-void Window::getInputColumns(
+void Window::PartitionEvaluator::getInputColumns(
     vector_size_t startRow,
     vector_size_t endRow,
     vector_size_t resultOffset,
@@ -592,11 +624,12 @@ void Window::getInputColumns(
   }
 }
 
-void Window::callApplyForPartitionRows(
-    vector_size_t startRow,
-    vector_size_t endRow,
+void Window::PartitionEvaluator::apply(
+    vector_size_t numRows,
     vector_size_t resultOffset,
     const RowVectorPtr& result) {
+  const auto startRow = partitionOffset_;
+  const auto endRow = partitionOffset_ + numRows;
   // NOTE: for a partial window partition, the last row of the previously
   // processed rows (used for peer group comparison) will be deleted by
   // computePeerAndFrameBuffers after peer group comparison. Hence we need to
@@ -616,8 +649,6 @@ void Window::callApplyForPartitionRows(
         result->childAt(numInputColumns_ + i));
   }
 
-  const vector_size_t numRows = endRow - startRow;
-  numProcessedRows_ += numRows;
   partitionOffset_ += numRows;
 
   if (currentPartition_->partial()) {
@@ -625,6 +656,41 @@ void Window::callApplyForPartitionRows(
   }
 }
 
+std::vector<RowVectorPtr> Window::PartitionEvaluator::applyAll(
+    const std::vector<std::shared_ptr<WindowPartition>>& partitions,
+    const RowTypePtr& outputType) {
+  vector_size_t numRowsLeft = 0;
+  for (const auto& partition : partitions) {
+    numRowsLeft += partition->numRows();
+  }
+  std::vector<RowVectorPtr> results;
+  RowVectorPtr result;
+  vector_size_t resultOffset = 0;
+  for (const auto& partition : partitions) {
+    resetPartition(partition);
+    while (partitionOffset_ < currentPartition_->numRows()) {
+      if (result == nullptr) {
+        result = BaseVector::create<RowVector>(
+            outputType, std::min(numRowsPerOutput_, numRowsLeft), pool_);
+        resultOffset = 0;
+      }
+      const auto numRows = std::min(
+          currentPartition_->numRows() - partitionOffset_,
+          result->size() - resultOffset);
+      apply(numRows, resultOffset, result);
+      resultOffset += numRows;
+      numRowsLeft -= numRows;
+      if (resultOffset == result->size()) {
+        results.push_back(std::move(result));
+        result = nullptr;
+      }
+    }
+  }
+  // Releases the partition since it references the rows of the WindowBuild.
+  resetPartition(nullptr);
+  return results;
+}
+
 vector_size_t Window::callApplyLoop(
     vector_size_t numOutputRows,
     const RowVectorPtr& result) {
@@ -633,30 +699,29 @@ vector_size_t Window::callApplyLoop(
   vector_size_t resultIndex = 0;
   vector_size_t numOutputRowsLeft = numOutputRows;
 
-  // This function requires that the currentPartition_ is available for output.
-  VELOX_DCHECK_NOT_NULL(currentPartition_);
+  // This function requires that the current partition is available for
+  // output.
+  VELOX_DCHECK_NOT_NULL(evaluator_->partition());
   while (numOutputRowsLeft > 0) {
+    const auto& partition = evaluator_->partition();
     const auto numPartitionRows =
-        currentPartition_->numRowsForProcessing(partitionOffset_);
+        partition->numRowsForProcessing(evaluator_->partitionOffset());
     if (numPartitionRows <= numOutputRowsLeft) {
       // Current partition can fit completely in the output buffer.
       // So output all its rows.
-      callApplyForPartitionRows(
-          partitionOffset_,
-          partitionOffset_ + numPartitionRows,
-          resultIndex,
-          result);
+      evaluator_->apply(numPartitionRows, resultIndex, result);
+      numProcessedRows_ += numPartitionRows;
       resultIndex += numPartitionRows;
       numOutputRowsLeft -= numPartitionRows;
 
-      if (!currentPartition_->complete()) {
+      if (!partition->complete()) {
         // There are more data need to process for a partial partition.
-        VELOX_CHECK(currentPartition_->partial());
+        VELOX_CHECK(partition->partial());
         break;
       }
 
       callResetPartition();
-      if (currentPartition_ == nullptr) {
+      if (evaluator_->partition() == nullptr) {
         // The WindowBuild doesn't have any more partitions to process right
         // now. So break until the next getOutput call.
         break;
@@ -665,11 +730,8 @@ vector_size_t Window::callApplyLoop(
       // Current partition can fit only partially in the output buffer.
       // Call apply for the rows that can fit in the buffer and break from
       // outputting.
-      callApplyForPartitionRows(
-          partitionOffset_,
-          partitionOffset_ + numOutputRowsLeft,
-          resultIndex,
-          result);
+      evaluator_->apply(numOutputRowsLeft, resultIndex, result);
+      numProcessedRows_ += numOutputRowsLeft;
       numOutputRowsLeft = 0;
       break;
     }
@@ -689,16 +751,21 @@ RowVectorPtr Window::getOutput() {
     return nullptr;
   }
 
-  if (currentPartition_ == nullptr) {
+  if (useParallelOutput()) {
+    return getParallelOutput();
+  }
+
+  if (evaluator_->partition() == nullptr) {
     callResetPartition();
-    if (currentPartition_ == nullptr) {
+    if (evaluator_->partition() == nullptr) {
       // WindowBuild doesn't have a partition to output.
       return nullptr;
     }
   }
 
-  if (!currentPartition_->complete() &&
-      (currentPartition_->numRowsForProcessing(partitionOffset_) == 0)) {
+  const auto& partition = evaluator_->partition();
+  if (!partition->complete() &&
+      (partition->numRowsForProcessing(evaluator_->partitionOffset()) == 0)) {
     return nullptr;
   }
 
@@ -713,4 +780,85 @@ RowVectorPtr Window::getOutput() {
       : result;
 }
 
+bool Window::useParallelOutput() {
+  // Partitions are computed in parallel from the first partition on, once
+  // all input is sorted, unless the sorted input is spilled.
+  if (!parallelOutput_ && parallelExecutor_ != nullptr && noMoreInput_ &&
+      evaluator_->partition() == nullptr && numProcessedRows_ == 0) {
+    parallelOutput_ = windowBuild_->supportsParallelPartitions();
+  }
+  return parallelOutput_;
+}
+
+RowVectorPtr Window::getParallelOutput() {
+  // Passing driver context directly to avoid cross thread access to thread
+  // local driver thread context.
+  const DriverCtx* driverCtx{nullptr};
+  if (const auto* driverThreadCtx = driverThreadContext()) {
+    driverCtx = driverThreadCtx->driverCtx();
+  }
+  // Each group has at least a block of rows so that small partitions are
+  // output together. The number of groups in flight is bounded by the number
+  // of evaluators, which bounds the memory for the results.
+  while (!freeEvaluators_.empty() && windowBuild_->hasNextPartition()) {
+    std::vector<std::shared_ptr<WindowPartition>> partitions;
+    vector_size_t numGroupRows = 0;
+    while (numGroupRows < numRowsPerOutput_ &&
+           windowBuild_->hasNextPartition()) {
+      partitions.push_back(windowBuild_->nextPartition());
+      numGroupRows += partitions.back()->numRows();
+    }
+    auto* evaluator = freeEvaluators_.back();
+    freeEvaluators_.pop_back();
+    auto source = std::make_shared<AsyncSource<std::vector<RowVectorPtr>>>(
+        [evaluator, partitions = std::move(partitions), this]() {
+          return std::make_unique<std::vector<RowVectorPtr>>(
+              evaluator->applyAll(partitions, outputType_));
+        });
+    parallelExecutor_->add([driverCtx, source]() {
+      ScopedDriverThreadContext scopedDriverThreadContext(driverCtx);
+      source->prepare();
+    });
+    parallelOutputs_.push_back({std::move(source), evaluator});
+  }
+
+  if (parallelResults_.empty()) {
+    if (parallelOutputs_.empty()) {
+      return nullptr;
+    }
+    auto output = std::move(parallelOutputs_.front());
+    parallelOutputs_.pop_front();
+    auto results = output.source->move();
+    freeEvaluators_.push_back(output.evaluator);
+    for (auto& result : *results) {
+      parallelResults_.push_back(std::move(result));
+    }
+    if (parallelResults_.empty()) {
+      return nullptr;
+    }
+  }
+  auto result = std::move(parallelResults_.front());
+  parallelResults_.pop_front();
+  numProcessedRows_ += result->size();
+  return result;
+}
+
+void Window::waitForParallelOutput() {
+  // The scheduled groups reference the evaluators and partitions of this
+  // operator.
+  for (auto& output : parallelOutputs_) {
+    try {
+      output.source->move();
+    } catch (const std::exception&) {
+    }
+  }
+  parallelOutputs_.clear();
+}
+
+void Window::close() {
+  waitForParallelOutput();
+  parallelResults_.clear();
+  Operator::close();
+}
+
 } // namespace facebook::velox::exec
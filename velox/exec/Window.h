@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "velox/common/base/AsyncSource.h"
 #include "velox/exec/Operator.h"
 #include "velox/exec/RowContainer.h"
 #include "velox/exec/WindowBuild.h"
@@ -67,25 +68,185 @@ class Window : public Operator {
   void reclaim(uint64_t targetBytes, memory::MemoryReclaimer::Stats& stats)
       override;
 
+  void close() override;
+
  private:
-  // Used for k preceding/following frames. Index is the column index if k is a
-  // column. value is used to read column values from the column index when k
-  // is a column. The field constant stores constant k values.
-  struct FrameChannelArg {
-    column_index_t index;
-    VectorPtr value;
-    std::optional<int64_t> constant;
+  // Computes the window functions over the rows of one partition at a time.
+  // Holds the functions, their frames and the buffers passed to them, so
+  // that partitions can be computed in parallel with one evaluator per
+  // thread.
+  class PartitionEvaluator {
+   public:
+    PartitionEvaluator(
+        const std::shared_ptr<const core::WindowNode>& windowNode,
+        vector_size_t numRowsPerOutput,
+        memory::MemoryPool* pool,
+        const core::QueryConfig& config);
+
+    // Starts computing 'partition'. 'partition' may be nullptr.
+    void resetPartition(std::shared_ptr<WindowPartition> partition);
+
+    const std::shared_ptr<WindowPartition>& partition() const {
+      return currentPartition_;
+    }
+
+    // Returns the number of rows of the current partition that are output.
+    vector_size_t partitionOffset() const {
+      return partitionOffset_;
+    }
+
+    // Computes the result vector for the next 'numRows' rows of the current
+    // partition. A single partition could span multiple output blocks and a
+    // single output block could also have multiple partitions in it. So
+    // resultOffset is the offset in the result vector corresponding to the
+    // current range of partition rows.
+    void apply(
+        vector_size_t numRows,
+        vector_size_t resultOffset,
+        const RowVectorPtr& result);
+
+    // Computes the results for all rows of 'partitions' into vectors of
+    // 'outputType' with at most 'numRowsPerOutput_' rows each.
+    std::vector<RowVectorPtr> applyAll(
+        const std::vector<std::shared_ptr<WindowPartition>>& partitions,
+        const RowTypePtr& outputType);
+
+   private:
+    // Used for k preceding/following frames. Index is the column index if k
+    // is a column. value is used to read column values from the column index
+    // when k is a column. The field constant stores constant k values.
+    struct FrameChannelArg {
+      column_index_t index;
+      VectorPtr value;
+      std::optional<int64_t> constant;
+    };
+
+    // Structure for the window frame for each function.
+    struct WindowFrame {
+      const core::WindowNode::WindowType type;
+      const core::WindowNode::BoundType startType;
+      const core::WindowNode::BoundType endType;
+      // Set only when startType is BoundType::kPreceding or kFollowing.
+      const std::optional<FrameChannelArg> start;
+      // Set only when endType is BoundType::kPreceding or kFollowing.
+      const std::optional<FrameChannelArg> end;
+    };
+
+    // Creates WindowFunction and frame objects for this operator.
+    void createWindowFunctions(
+        const std::shared_ptr<const core::WindowNode>& windowNode,
+        const core::QueryConfig& config);
+
+    // Converts WindowNode::Frame to Window::WindowFrame.
+    WindowFrame createWindowFrame(
+        const std::shared_ptr<const core::WindowNode>& windowNode,
+        const core::WindowNode::Frame& frame,
+        const RowTypePtr& inputType);
+
+    // Creates the buffers for peer and frame row
+    // indices to send in window function apply invocations.
+    void createPeerAndFrameBuffers();
+
+    // Compute the peer and frame buffers for rows between
+    // startRow and endRow in the current partition.
+    void computePeerAndFrameBuffers(
+        vector_size_t startRow,
+        vector_size_t endRow);
+
+    // Gets the input columns of the current window partition
+    // between startRow and endRow in result at resultOffset.
+    void getInputColumns(
+        vector_size_t startRow,
+        vector_size_t endRow,
+        vector_size_t resultOffset,
+        const RowVectorPtr& result);
+
+    // Update frame bounds for kPreceding, kFollowing row frames.
+    void updateKRowsFrameBounds(
+        bool isKPreceding,
+        const FrameChannelArg& frameArg,
+        vector_size_t startRow,
+        vector_size_t numRows,
+        vector_size_t* rawFrameBounds);
+
+    // Populate frame bounds in the current partition into rawFrameBounds.
+    // Unselect rows from validFrames where the frame bounds are NaN that are
+    // invalid.
+    void updateFrameBounds(
+        const WindowFrame& windowFrame,
+        const bool isStartBound,
+        const vector_size_t startRow,
+        const vector_size_t numRows,
+        const vector_size_t* rawPeerStarts,
+        const vector_size_t* rawPeerEnds,
+        vector_size_t* rawFrameBounds,
+        SelectivityVector& validFrames);
+
+    memory::MemoryPool* const pool_;
+
+    const vector_size_t numInputColumns_;
+
+    // Number of rows that be fit into an output block.
+    const vector_size_t numRowsPerOutput_;
+
+    // Used to access window partition rows and columns by the window
+    // operator and functions. This structure is owned by the WindowBuild.
+    std::shared_ptr<WindowPartition> currentPartition_;
+
+    // HashStringAllocator required by functions that allocate out of line
+    // buffers.
+    HashStringAllocator stringAllocator_;
+
+    // Vector of WindowFunction objects required by this operator.
+    // WindowFunction is the base API implemented by all the window functions.
+    // The functions are ordered by their positions in the output columns.
+    std::vector<std::unique_ptr<exec::WindowFunction>> windowFunctions_;
+
+    // Vector of WindowFrames corresponding to each windowFunction above.
+    // It represents the frame spec for the function computation.
+    std::vector<WindowFrame> windowFrames_;
+
+    // The following 4 Buffers are used to pass peer and frame start and end
+    // values to the WindowFunction::apply method. These buffers can be
+    // allocated once and reused across all the getOutput calls.
+    // Only a single peer start and peer end buffer is needed across all
+    // functions (as the peer values are based on the ORDER BY clause).
+    BufferPtr peerStartBuffer_;
+    BufferPtr peerEndBuffer_;
+    // A separate BufferPtr is required for the frame indexes of each
+    // function. Each function has its own frame clause and style. So we have
+    // as many buffers as the number of functions.
+    std::vector<BufferPtr> frameStartBuffers_;
+    std::vector<BufferPtr> frameEndBuffers_;
+
+    // Frame types for kPreceding or kFollowing could result in empty frames
+    // if the frameStart > frameEnds, or frameEnds < firstPartitionRow or
+    // frameStarts > lastPartitionRow. Such frames usually evaluate to NULL in
+    // the window function.
+    // This SelectivityVector captures the valid (non-empty) frames in the
+    // buffer being worked on. The window function can use this to compute
+    // output values. There is one SelectivityVector per window function.
+    std::vector<SelectivityVector> validFrames_;
+
+    // Tracks how far along the partition rows have been output.
+    vector_size_t partitionOffset_ = 0;
+
+    // When traversing input partition rows, the peers are the rows with the
+    // same values for the ORDER BY clause. These rows are equal in some ways
+    // and affect the results of ranking functions. Since all rows between the
+    // peerStartRow_ and peerEndRow_ have the same values for peerStartRow_
+    // and peerEndRow_, we needn't compute them for each row independently.
+    // Since these rows might cross getOutput boundaries and be called in
+    // subsequent calls to computePeerBuffers they are saved here.
+    vector_size_t peerStartRow_ = 0;
+    vector_size_t peerEndRow_ = 0;
   };
 
-  // Structure for the window frame for each function.
-  struct WindowFrame {
-    const core::WindowNode::WindowType type;
-    const core::WindowNode::BoundType startType;
-    const core::WindowNode::BoundType endType;
-    // Set only when startType is BoundType::kPreceding or kFollowing.
-    const std::optional<FrameChannelArg> start;
-    // Set only when endType is BoundType::kPreceding or kFollowing.
-    const std::optional<FrameChannelArg> end;
+  // The results of a group of consecutive partitions computed on
+  // 'parallelExecutor_'.
+  struct ParallelOutput {
+    std::shared_ptr<AsyncSource<std::vector<RowVectorPtr>>> source;
+    PartitionEvaluator* evaluator;
   };
 
   // Returns if a window operator support rows-wise streaming processing or not.
@@ -93,46 +254,9 @@ class Window : public Operator {
   // any frame type. Also supports the agg window function with default frame.
   bool supportRowsStreaming();
 
-  // Creates WindowFunction and frame objects for this operator.
-  void createWindowFunctions();
-
-  // Converts WindowNode::Frame to Window::WindowFrame.
-  WindowFrame createWindowFrame(
-      const std::shared_ptr<const core::WindowNode>& windowNode,
-      const core::WindowNode::Frame& frame,
-      const RowTypePtr& inputType);
-
-  // Creates the buffers for peer and frame row
-  // indices to send in window function apply invocations.
-  void createPeerAndFrameBuffers();
-
-  // Compute the peer and frame buffers for rows between
-  // startRow and endRow in the current partition.
-  void computePeerAndFrameBuffers(vector_size_t startRow, vector_size_t endRow);
-
   // Updates all the state for the next partition.
   void callResetPartition();
 
-  // Computes the result vector for a subset of the current
-  // partition rows starting from startRow to endRow. A single partition
-  // could span multiple output blocks and a single output block could
-  // also have multiple partitions in it. So resultOffset is the
-  // offset in the result vector corresponding to the current range of
-  // partition rows.
-  void callApplyForPartitionRows(
-      vector_size_t startRow,
-      vector_size_t endRow,
-      vector_size_t resultOffset,
-      const RowVectorPtr& result);
-
-  // Gets the input columns of the current window partition
-  // between startRow and endRow in result at resultOffset.
-  void getInputColumns(
-      vector_size_t startRow,
-      vector_size_t endRow,
-      vector_size_t resultOffset,
-      const RowVectorPtr& result);
-
   // Computes the result vector for a single output block. The result
   // consists of all the input columns followed by the results of the
   // window function.
@@ -141,26 +265,15 @@ class Window : public Operator {
       vector_size_t numOutputRows,
       const RowVectorPtr& result);
 
-  // Update frame bounds for kPreceding, kFollowing row frames.
-  void updateKRowsFrameBounds(
-      bool isKPreceding,
-      const FrameChannelArg& frameArg,
-      vector_size_t startRow,
-      vector_size_t numRows,
-      vector_size_t* rawFrameBounds);
-
-  // Populate frame bounds in the current partition into rawFrameBounds.
-  // Unselect rows from validFrames where the frame bounds are NaN that are
-  // invalid.
-  void updateFrameBounds(
-      const WindowFrame& windowFrame,
-      const bool isStartBound,
-      const vector_size_t startRow,
-      const vector_size_t numRows,
-      const vector_size_t* rawPeerStarts,
-      const vector_size_t* rawPeerEnds,
-      vector_size_t* rawFrameBounds,
-      SelectivityVector& validFrames);
+  // Returns true if the partitions are computed on 'parallelExecutor_'.
+  bool useParallelOutput();
+
+  // Schedules groups of partitions on 'parallelExecutor_' while there are
+  // free evaluators and returns the next block of the earliest group.
+  RowVectorPtr getParallelOutput();
+
+  // Waits for all scheduled groups of partitions.
+  void waitForParallelOutput();
 
   const vector_size_t numInputColumns_;
 
@@ -172,44 +285,24 @@ class Window : public Operator {
   // reset after the initialization.
   std::shared_ptr<const core::WindowNode> windowNode_;
 
-  // Used to access window partition rows and columns by the window
-  // operator and functions. This structure is owned by the WindowBuild.
-  std::shared_ptr<WindowPartition> currentPartition_;
-
-  // HashStringAllocator required by functions that allocate out of line
-  // buffers.
-  HashStringAllocator stringAllocator_;
-
-  // Vector of WindowFunction objects required by this operator.
-  // WindowFunction is the base API implemented by all the window functions.
-  // The functions are ordered by their positions in the output columns.
-  std::vector<std::unique_ptr<exec::WindowFunction>> windowFunctions_;
-
-  // Vector of WindowFrames corresponding to each windowFunction above.
-  // It represents the frame spec for the function computation.
-  std::vector<WindowFrame> windowFrames_;
-
-  // The following 4 Buffers are used to pass peer and frame start and end
-  // values to the WindowFunction::apply method. These buffers can be allocated
-  // once and reused across all the getOutput calls.
-  // Only a single peer start and peer end buffer is needed across all
-  // functions (as the peer values are based on the ORDER BY clause).
-  BufferPtr peerStartBuffer_;
-  BufferPtr peerEndBuffer_;
-  // A separate BufferPtr is required for the frame indexes of each function.
-  // Each function has its own frame clause and style. So we have as many
-  // buffers as the number of functions.
-  std::vector<BufferPtr> frameStartBuffers_;
-  std::vector<BufferPtr> frameEndBuffers_;
-
-  // Frame types for kPreceding or kFollowing could result in empty frames if
-  // the frameStart > frameEnds, or frameEnds < firstPartitionRow or frameStarts
-  // > lastPartitionRow. Such frames usually evaluate to NULL in the window
-  // function.
-  // This SelectivityVector captures the valid (non-empty) frames in the buffer
-  // being worked on. The window function can use this to compute output values.
-  // There is one SelectivityVector per window function.
-  std::vector<SelectivityVector> validFrames_;
+  // Computes the partitions on the driver thread.
+  std::unique_ptr<PartitionEvaluator> evaluator_;
+
+  // Executor and evaluators for computing partitions in parallel. Set if the
+  // query allows more than one thread per Window operator.
+  folly::Executor* parallelExecutor_{nullptr};
+  std::vector<std::unique_ptr<PartitionEvaluator>> parallelEvaluators_;
+  std::vector<PartitionEvaluator*> freeEvaluators_;
+
+  // True if the output is computed on 'parallelExecutor_'. Decided when the
+  // first partition is output.
+  bool parallelOutput_{false};
+
+  // The scheduled groups of partitions in output order.
+  std::deque<ParallelOutput> parallelOutputs_;
+
+  // The computed blocks of the earliest group that are not output yet.
+  std::deque<RowVectorPtr> parallelResults_;
 
   // Number of input rows.
   vector_size_t numRows_ = 0;
@@ -222,19 +315,6 @@ class Window : public Operator {
   // value is updated as the WindowFunction::apply() function is
   // called on the partition blocks.
   vector_size_t numProcessedRows_ = 0;
-
-  // Tracks how far along the partition rows have been output.
-  vector_size_t partitionOffset_ = 0;
-
-  // When traversing input partition rows, the peers are the rows with the same
-  // values for the ORDER BY clause. These rows are equal in some ways and
-  // affect the results of ranking functions. Since all rows between the
-  // peerStartRow_ and peerEndRow_ have the same values for peerStartRow_ and
-  // peerEndRow_, we needn't compute them for each row independently. Since
-  // these rows might cross getOutput boundaries and be called in subsequent
-  // calls to computePeerBuffers they are saved here.
-  vector_size_t peerStartRow_ = 0;
-  vector_size_t peerEndRow_ = 0;
 };
 
 } // namespace facebook::velox::exec
@@ -68,6 +68,13 @@ class WindowBuild {
   /// called when no partition is available.
   virtual std::shared_ptr<WindowPartition> nextPartition() = 0;
 
+  /// Returns true if the partitions returned by nextPartition() stay valid
+  /// after the next partitions are returned, so that the Window operator can
+  /// process several partitions at a time. Called after noMoreInput().
+  virtual bool supportsParallelPartitions() const {
+    return false;
+  }
+
   /// Returns the average size of input rows in bytes stored in the data
   /// container of the WindowBuild.
   std::optional<int64_t> estimateRowSize() {
@@ -192,18 +192,38 @@ bool WindowPartition::compareRowsWithSortKeys(const char* lhs, const char* rhs)
 
 vector_size_t WindowPartition::findPeerRowEndIndex(
     vector_size_t startRow,
-    vector_size_t lastRow,
-    const std::function<bool(const char*, const char*)>& peerCompare) {
-  auto peerEnd = startRow;
-  while (peerEnd <= lastRow) {
-    if (peerCompare(
-            partition_[startRow - startRow_],
-            partition_[peerEnd - startRow_])) {
+    vector_size_t lastRow) const {
+  if (startRow > lastRow) {
+    return startRow;
+  }
+  const auto* first = partition_[startRow - startRow_];
+  const auto isPeer = [&](vector_size_t row) {
+    return !compareRowsWithSortKeys(first, partition_[row - startRow_]);
+  };
+
+  // The peers of 'startRow' are adjacent in sort order. Gallop forward until
+  // a row is not a peer, then binary search between the last peer seen and
+  // that row. This takes one comparison for a single row peer group and
+  // O(log(n)) comparisons for a group of n rows. 'low' is always a peer and
+  // 'high' is past the last peer.
+  vector_size_t low = startRow;
+  vector_size_t high = lastRow + 1;
+  for (int64_t step = 1; step <= lastRow - low; step *= 2) {
+    if (!isPeer(low + step)) {
+      high = low + step;
       break;
     }
-    ++peerEnd;
+    low += step;
+  }
+  while (high - low > 1) {
+    const auto middle = low + (high - low) / 2;
+    if (isPeer(middle)) {
+      low = middle;
+    } else {
+      high = middle;
+    }
   }
-  return peerEnd;
+  return high;
 }
 
 void WindowPartition::removePreviousRow() {
@@ -239,7 +259,7 @@ std::pair<vector_size_t, vector_size_t> WindowPartition::computePeerBuffers(
     removePreviousRow();
 
     if (!peerGroup) {
-      peerEnd = findPeerRowEndIndex(start, lastPartitionRow, peerCompare);
+      peerEnd = findPeerRowEndIndex(start, lastPartitionRow);
 
       for (; next < std::min(end, peerEnd); ++next, ++index) {
         rawPeerStarts[index] = peerStart;
@@ -261,7 +281,7 @@ std::pair<vector_size_t, vector_size_t> WindowPartition::computePeerBuffers(
       // Compute peerStart and peerEnd rows for the first row of the partition
       // or when past the previous peerGroup.
       peerStart = next;
-      peerEnd = findPeerRowEndIndex(peerStart, lastPartitionRow, peerCompare);
+      peerEnd = findPeerRowEndIndex(peerStart, lastPartitionRow);
     }
 
     rawPeerStarts[index] = peerStart;
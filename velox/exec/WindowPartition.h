@@ -183,11 +183,11 @@ class WindowPartition {
 
   bool compareRowsWithSortKeys(const char* lhs, const char* rhs) const;
 
-  // Finds the index of the last peer row in range of ['startRow', 'lastRow'].
+  // Returns the index of the first row in range of ['startRow', 'lastRow']
+  // that is not a peer of 'startRow', or 'lastRow' + 1 if all are peers.
   vector_size_t findPeerRowEndIndex(
       vector_size_t startRow,
-      vector_size_t lastRow,
-      const std::function<bool(const char*, const char*)>& peerCompare);
+      vector_size_t lastRow) const;
 
   // Removes 'numRows' from 'data_' and 'rows_'.
   void eraseRows(vector_size_t numRows);
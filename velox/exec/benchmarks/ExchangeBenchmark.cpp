@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <folly/Benchmark.h>
+#include <folly/String.h>
 #include <folly/init/Init.h>
 
 #include "velox/core/QueryConfig.h"
@@ -41,6 +42,11 @@ DEFINE_int64(
     "task-wide buffer in local exchange");
 DEFINE_int64(exchange_buffer_mb, 32, "task-wide buffer in remote exchange");
 DEFINE_int32(dict_pct, 0, "Percentage of columns wrapped in dictionary");
+DEFINE_string(
+    num_destinations,
+    "64,256,1024",
+    "Comma separated numbers of destinations of the leaf shuffle in the "
+    "destination scaling runs");
 // Add the following definitions to allow Clion runs
 DEFINE_bool(gtest_color, false, "");
 DEFINE_string(gtest_filter, "*", "");
@@ -122,7 +128,14 @@ class ExchangeBenchmark : public VectorTestBase {
       int32_t taskWidth,
       int64_t& wallUs,
       PlanNodeStats& partitionedOutputStats,
-      PlanNodeStats& exchangeStats) {
+      PlanNodeStats& exchangeStats,
+      int32_t numDestinations = 0) {
+    // The leaf tasks partition their output for 'numDestinations' consumer
+    // tasks. Many consumers run on one thread each.
+    if (numDestinations == 0) {
+      numDestinations = width;
+    }
+    const auto consumerWidth = numDestinations > width ? 1 : taskWidth;
     core::PlanNodePtr plan;
     core::PlanNodeId exchangeId;
     core::PlanNodeId leafPartitionedOutputId;
@@ -145,7 +158,7 @@ class ExchangeBenchmark : public VectorTestBase {
       std::vector<std::string> leafTaskIds;
       auto leafPlan = exec::test::PlanBuilder()
                           .values(vectors, true)
-                          .partitionedOutput({"c0"}, width)
+                          .partitionedOutput({"c0"}, numDestinations)
                           .capturePlanNodeId(leafPartitionedOutputId)
                           .planNode();
 
@@ -169,13 +182,13 @@ class ExchangeBenchmark : public VectorTestBase {
               .capturePlanNodeId(finalAggPartitionedOutputId)
               .planNode();
 
-      for (int i = 0; i < width; i++) {
+      for (int i = 0; i < numDestinations; i++) {
         auto taskId = makeTaskId(iteration, "final-agg", i);
         finalAggSplits.push_back(
             exec::Split(std::make_shared<exec::RemoteConnectorSplit>(taskId)));
         auto finalAggTask = makeTask(taskId, finalAggPlan, i);
         finalAggTasks.push_back(finalAggTask);
-        finalAggTask->start(taskWidth);
+        finalAggTask->start(consumerWidth);
         addRemoteSplits(finalAggTask, leafTaskIds);
       }
 
@@ -509,6 +522,32 @@ void runBenchmarks() {
     return 1;
   });
 
+  // The same shuffle with more destinations, each getting fewer rows of each
+  // batch.
+  std::vector<int32_t> numDestinations;
+  folly::splitTo<int32_t>(
+      ',', FLAGS_num_destinations, std::back_inserter(numDestinations), true);
+  std::vector<int64_t> destinationsWallUs(numDestinations.size());
+  std::vector<PlanNodeStats> destinationsPartitionedOutputStats(
+      numDestinations.size());
+  std::vector<PlanNodeStats> destinationsExchangeStats(numDestinations.size());
+  for (auto i = 0; i < numDestinations.size(); ++i) {
+    folly::addBenchmark(
+        __FILE__,
+        fmt::format("exchangeFlat10kDestinations{}", numDestinations[i]),
+        [&, i]() {
+          bm->run(
+              flat10k,
+              FLAGS_width,
+              FLAGS_task_width,
+              destinationsWallUs[i],
+              destinationsPartitionedOutputStats[i],
+              destinationsExchangeStats[i],
+              numDestinations[i]);
+          return 1;
+        });
+  }
+
   int64_t localPartitionWallUs;
   PlanNodeStats localPartitionStatsFlat10K;
   LocalPartitionWaitStats localPartitionWaitStats;
@@ -565,6 +604,17 @@ void runBenchmarks() {
             << std::endl;
   std::cout << "Exchange: " << exchangeStatsStruct1K.toString() << std::endl;
 
+  for (auto i = 0; i < numDestinations.size(); ++i) {
+    std::cout << "---------------------------Flat10K " << numDestinations[i]
+              << " destinations---------------------------" << std::endl;
+    std::cout << "Wall Time (ms): " << succinctMicros(destinationsWallUs[i])
+              << std::endl;
+    std::cout << "PartitionOutput: "
+              << destinationsPartitionedOutputStats[i].toString() << std::endl;
+    std::cout << "Exchange: " << destinationsExchangeStats[i].toString()
+              << std::endl;
+  }
+
   std::cout
       << "--------------------------------LocalFlat10K-------------------------------"
       << std::endl;
@@ -36,7 +36,8 @@ struct HashTableBenchmarkParams {
   //  -the build & probe row schema,
   //  -the expected hash table size,
   //  -number of probing rows,
-  //  -build key repetition distribution.
+  //  -build key repetition distribution,
+  //  -the radix partition size of the probe, 0 for no partitioning.
   HashTableBenchmarkParams(
       BaseHashTable::HashMode mode,
       const TypePtr& buildType,
@@ -44,13 +45,15 @@ struct HashTableBenchmarkParams {
       int64_t probeSize,
       const std::vector<std::pair<int32_t, int32_t>>&
           keyRepeatTimesDistribution,
-      bool runErase)
+      bool runErase,
+      uint64_t probePartitionBytes = 0)
       : mode{mode},
         buildType{buildType},
         hashTableSize{hashTableSize},
         probeSize{probeSize},
         keyRepeatTimesDistribution{keyRepeatTimesDistribution},
-        runErase{runErase} {
+        runErase{runErase},
+        probePartitionBytes{probePartitionBytes} {
     int32_t distSum = 0;
     buildSize = 0;
     buildKeyRepeat.reserve(keyRepeatTimesDistribution.size());
@@ -113,6 +116,9 @@ struct HashTableBenchmarkParams {
 
   bool runErase;
 
+  // Sets HashLookup::probePartitionBytes for the probe.
+  uint64_t probePartitionBytes{0};
+
   // Title for reporting
   std::string title;
 
@@ -444,6 +450,7 @@ class HashTableListJoinResultBenchmark : public VectorTestBase {
   int64_t probeTableAndListResult() {
     auto lookup =
         std::make_unique<HashLookup>(topTable_->hashers(), pool_.get());
+    lookup->probePartitionBytes = params_.probePartitionBytes;
     const auto numBatch = params_.probeSize / params_.hashTableSize;
     const auto batchSize = params_.hashTableSize;
     BufferPtr outputRowMapping;
@@ -579,6 +586,30 @@ int main(int argc, char** argv) {
     }
   }
 
+  // Probes of tables from a few MBs to ones much larger than the last level
+  // cache, without and with radix partitioning the probe rows into 16MB
+  // partitions of the table, to show the crossover point.
+  for (auto mode :
+       {BaseHashTable::HashMode::kNormalizedKey,
+        BaseHashTable::HashMode::kHash}) {
+    for (auto tableSize : {1L << 16, 1L << 20, 1L << 22, 1L << 24}) {
+      for (uint64_t partitionBytes : {0UL, 16UL << 20}) {
+        params.emplace_back(HashTableBenchmarkParams(
+            mode,
+            onlyKeyType,
+            tableSize - 3,
+            probeRowSize,
+            {{100, 0}},
+            false,
+            partitionBytes));
+        params.back().title += fmt::format(
+            ",table:{},partition:{}",
+            tableSize - 3,
+            succinctBytes(partitionBytes));
+      }
+    }
+  }
+
   for (auto& param : params) {
     folly::addBenchmark(__FILE__, param.title, [param, &bm, &results]() {
       combineResults(results, bm->run(param));
@@ -35,6 +35,14 @@ DEFINE_int32(custom_hit_rate, 0, "Percentage of hits in custom test");
 DEFINE_int32(custom_key_spacing, 1, "Spacing between key values");
 
 DEFINE_int32(custom_num_ways, 10, "Number of build threads");
+DEFINE_uint64(
+    custom_probe_partition_bytes,
+    0,
+    "Radix partition size of the probe in custom test, 0 for none");
+DEFINE_bool(
+    custom_huge_pages,
+    false,
+    "Map the table of the custom test for huge pages");
 
 DEFINE_bool(profile, false, "Generate perf profiles and memory stats");
 
@@ -89,13 +97,32 @@ struct HashTableBenchmarkParams {
   // VectorHasher.
   int32_t keySpacing{1};
 
+  // Sets HashLookup::probePartitionBytes for the probe.
+  uint64_t probePartitionBytes{0};
+
+  // Maps the table for huge pages.
+  bool hugePages{false};
+
+  // Spreads the key values over their whole range so that VectorHashers find
+  // neither a range nor few distinct values and the table is in kHash mode.
+  // VARCHAR keys stay short enough to be inlined.
+  bool scrambleKeys{false};
+
+  // Compares keys with the generic, per-column dispatched path even if the
+  // table has a specialized comparison for its key types.
+  bool genericKeys{false};
+
   std::string toString() const {
     return fmt::format(
-        "{}: Rows={} Hit%={} NumProbes={}",
+        "{}: Rows={} Hit%={} NumProbes={} PartitionBytes={} HugePages={} "
+        "GenericKeys={}",
         title,
         buildSize,
         insertPct,
-        size * numWays);
+        size * numWays,
+        probePartitionBytes,
+        hugePages,
+        genericKeys);
   }
 };
 
@@ -182,7 +209,10 @@ class HashTableBenchmark : public VectorTestBase {
           true,
           false,
           1'000,
-          pool_.get());
+          params_.hugePages ? hugePagePool_.get() : pool_.get());
+      if (params_.genericKeys) {
+        table->testingDisableKeyShape();
+      }
 
       makeRows(params_.size, 1, sequence, params_.buildType, batches);
       copyVectorsToTable(batches, startOffset, table.get());
@@ -363,11 +393,18 @@ class HashTableBenchmark : public VectorTestBase {
   // between the next call will not overlap with the results of the
   // previous one.
   VectorPtr makeVector(TypePtr type, int32_t size, int32_t sequence) {
+    // Multiplying by an odd number is a bijection modulo any power of two.
+    constexpr uint64_t kScramble = 0x9E3779B97F4A7C15ULL;
+    // 44 bits print as at most 11 hex digits, which are inlined in StringView.
+    constexpr uint64_t kShortStringMask = (1ULL << 44) - 1;
     switch (type->kind()) {
       case TypeKind::BIGINT:
         return vectorMaker_->flatVector<int64_t>(
             size,
-            [&](vector_size_t row) {
+            [&](vector_size_t row) -> int64_t {
+              if (params_.scrambleKeys) {
+                return static_cast<uint64_t>(sequence + row) * kScramble;
+              }
               return params_.keySpacing * (sequence + row);
             },
             nullptr);
@@ -376,6 +413,13 @@ class HashTableBenchmark : public VectorTestBase {
         auto strings = BaseVector::create<FlatVector<StringView>>(
             VARCHAR(), size, pool_.get());
         for (auto row = 0; row < size; ++row) {
+          if (params_.scrambleKeys) {
+            const auto value = (static_cast<uint64_t>(sequence + row) *
+                kScramble) &
+                kShortStringMask;
+            strings->set(row, StringView(fmt::format("{:x}", value)));
+            continue;
+          }
           auto string =
               fmt::format("{}", params_.keySpacing * (sequence + row));
           // Make strings that overflow the inline limit for 1/10 of
@@ -418,6 +462,7 @@ class HashTableBenchmark : public VectorTestBase {
   void testProbe() {
     auto lookup =
         std::make_unique<HashLookup>(topTable_->hashers(), pool_.get());
+    lookup->probePartitionBytes = params_.probePartitionBytes;
     auto batchSize = batches_[0]->size();
     SelectivityVector rows(batchSize);
     auto mode = topTable_->hashMode();
@@ -572,6 +617,18 @@ class HashTableBenchmark : public VectorTestBase {
 
   std::shared_ptr<memory::MemoryPool> pool_{
       memory::memoryManager()->addLeafPool()};
+
+  // Memory manager whose pools map the hash tables for huge pages. Does not
+  // use MmapArena since its allocations are not aligned to huge pages.
+  std::unique_ptr<memory::MemoryManager> hugePageManager_{[]() {
+    memory::MemoryManager::Options options;
+    options.useMmapAllocator = true;
+    options.allocatorCapacity = 64UL << 30;
+    options.hugePageThresholdBytes = memory::AllocationTraits::kHugePageSize;
+    return std::make_unique<memory::MemoryManager>(options);
+  }()};
+  std::shared_ptr<memory::MemoryPool> hugePagePool_{
+      hugePageManager_->addLeafPool()};
   std::unique_ptr<VectorMaker> vectorMaker_{
       std::make_unique<VectorMaker>(pool_.get())};
   // Bitmap of positions in batches_ that end up in the table.
@@ -658,6 +715,49 @@ int main(int argc, char** argv) {
       HashTableBenchmarkParams("Miss32M", 32000000, 5),
 
       HashTableBenchmarkParams("Hit128M", 128000000, 100)};
+
+  // The same probes radix partitioned into 16MB ranges of the table. Tables
+  // that fit in the last level cache are not expected to gain, tables much
+  // larger than it are.
+  for (const auto& [title, size, hitRate] :
+       std::vector<std::tuple<std::string, int64_t, int32_t>>{
+           {"Hit4MPart", 4000000, 100},
+           {"Miss4MPart", 4000000, 5},
+           {"Hit32MPart", 32000000, 100},
+           {"Miss32MPart", 32000000, 5},
+           {"Hit128MPart", 128000000, 100}}) {
+    params.push_back(HashTableBenchmarkParams(title, size, hitRate));
+    params.back().probePartitionBytes = 16 << 20;
+  }
+
+  // The same tables mapped for huge pages. The gain is from fewer TLB misses
+  // on the random table accesses and grows with the table size.
+  for (const auto& [title, size, hitRate] :
+       std::vector<std::tuple<std::string, int64_t, int32_t>>{
+           {"Hit4MHuge", 4000000, 100},
+           {"Hit32MHuge", 32000000, 100},
+           {"Miss32MHuge", 32000000, 5},
+           {"Hit128MHuge", 128000000, 100}}) {
+    params.push_back(HashTableBenchmarkParams(title, size, hitRate));
+    params.back().hugePages = true;
+  }
+  // kHash mode tables for the key types with specialized comparisons, each
+  // followed by the same table probed with the generic comparison.
+  for (const auto& [title, buildType, numKeys] :
+       std::vector<std::tuple<std::string, TypePtr, int32_t>>{
+           {"Bigint4M", ROW({"k1"}, {BIGINT()}), 1},
+           {"TwoBigints4M", ROW({"k1", "k2"}, {BIGINT(), BIGINT()}), 2},
+           {"Varchar4M", ROW({"k1"}, {VARCHAR()}), 1},
+           {"BigintVarchar4M", ROW({"k1", "k2"}, {BIGINT(), VARCHAR()}), 2}}) {
+    for (auto genericKeys : {false, true}) {
+      params.push_back(HashTableBenchmarkParams(
+          genericKeys ? title + "Generic" : title, 4000000, 100));
+      params.back().buildType = buildType;
+      params.back().numKeys = numKeys;
+      params.back().scrambleKeys = true;
+      params.back().genericKeys = genericKeys;
+    }
+  }
   if (FLAGS_custom_size != 0) {
     params.push_back(HashTableBenchmarkParams(
         "Custom",
@@ -665,6 +765,8 @@ int main(int argc, char** argv) {
         FLAGS_custom_hit_rate,
         FLAGS_custom_key_spacing,
         FLAGS_custom_num_ways));
+    params.back().probePartitionBytes = FLAGS_custom_probe_partition_bytes;
+    params.back().hugePages = FLAGS_custom_huge_pages;
   }
 
   for (auto& param : params) {
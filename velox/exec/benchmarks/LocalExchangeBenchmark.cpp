@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+
+#include <gflags/gflags.h>
+
+#include "velox/core/QueryConfig.h"
+#include "velox/exec/LocalPartition.h"
+#include "velox/exec/tests/utils/AssertQueryBuilder.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+#include "velox/functions/prestosql/aggregates/RegisterAggregateFunctions.h"
+#include "velox/functions/prestosql/registration/RegistrationFunctions.h"
+#include "velox/parse/TypeResolver.h"
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+DEFINE_int64(
+    local_exchange_buffer_mb,
+    32,
+    "task-wide buffer in local exchange");
+
+/// Benchmarks the local exchange with many drivers on each side. The queue
+/// benchmarks run one thread per producer and per consumer directly on
+/// LocalExchangeQueues, each producer sending small batches round robin to
+/// all queues, to measure the synchronization cost. The partition benchmarks
+/// run a query that hash partitions its input with LocalPartition, with and
+/// without copying the partitions into partition buffers.
+
+using namespace facebook::velox;
+using namespace facebook::velox::exec;
+
+namespace {
+
+class LocalExchangeBenchmark : public facebook::velox::test::VectorTestBase {
+ public:
+  void addQueueBenchmarks(int32_t numDrivers) {
+    folly::addBenchmark(
+        __FILE__, fmt::format("queues{}", numDrivers), [this, numDrivers]() {
+          runQueues(numDrivers);
+          return 1;
+        });
+  }
+
+  void addPartitionBenchmarks(int32_t numDrivers) {
+    for (bool buffered : {true, false}) {
+      folly::addBenchmark(
+          __FILE__,
+          fmt::format(
+              "{}partition{}_{}",
+              buffered ? "" : "%",
+              numDrivers,
+              buffered ? "buffered" : "wrapped"),
+          [this, numDrivers, buffered]() {
+            runPartition(numDrivers, buffered);
+            return 1;
+          });
+    }
+  }
+
+ private:
+  static constexpr int32_t kBatchesPerProducer = 2'000;
+  static constexpr int64_t kBatchBytes = 1'000;
+
+  void runQueues(int32_t numDrivers) {
+    std::vector<std::shared_ptr<LocalExchangeQueue>> queues;
+    RowVectorPtr batch;
+    BENCHMARK_SUSPEND {
+      const auto maxBufferBytes = FLAGS_local_exchange_buffer_mb << 20;
+      auto memoryManager =
+          std::make_shared<LocalExchangeMemoryManager>(maxBufferBytes);
+      auto vectorPool =
+          std::make_shared<LocalExchangeVectorPool>(maxBufferBytes);
+      for (auto i = 0; i < numDrivers; ++i) {
+        queues.push_back(std::make_shared<LocalExchangeQueue>(
+            memoryManager, vectorPool, i));
+        for (auto producer = 0; producer < numDrivers; ++producer) {
+          queues.back()->addProducer();
+        }
+        queues.back()->noMoreProducers();
+      }
+      batch = makeRowVector(
+          {makeFlatVector<int64_t>(100, [](auto row) { return row; })});
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(2 * numDrivers);
+    for (auto producer = 0; producer < numDrivers; ++producer) {
+      threads.emplace_back([&, producer]() {
+        for (auto i = 0; i < kBatchesPerProducer; ++i) {
+          ContinueFuture future;
+          auto& queue = queues[(producer + i) % numDrivers];
+          if (queue->enqueue(batch, kBatchBytes, &future) !=
+              BlockingReason::kNotBlocked) {
+            std::move(future).wait();
+          }
+        }
+        for (auto& queue : queues) {
+          queue->noMoreData();
+        }
+      });
+    }
+    for (auto consumer = 0; consumer < numDrivers; ++consumer) {
+      threads.emplace_back([&, consumer]() {
+        auto* pool = this->pool();
+        for (;;) {
+          RowVectorPtr data;
+          bool drained;
+          ContinueFuture future;
+          if (queues[consumer]->next(&future, pool, &data, drained) !=
+              BlockingReason::kNotBlocked) {
+            std::move(future).wait();
+            continue;
+          }
+          if (data == nullptr) {
+            break;
+          }
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  void runPartition(int32_t numDrivers, bool buffered) {
+    core::PlanNodePtr plan;
+    BENCHMARK_SUSPEND {
+      std::vector<RowVectorPtr> vectors;
+      for (auto i = 0; i < 10; ++i) {
+        vectors.push_back(makeRowVector({
+            makeFlatVector<int64_t>(10'000, [](auto row) { return row; }),
+            makeFlatVector<double>(10'000, [](auto row) { return row * 0.1; }),
+            makeFlatVector<StringView>(
+                10'000,
+                [](auto row) {
+                  return StringView::makeInline(fmt::format("{}", row));
+                }),
+        }));
+      }
+      plan = exec::test::PlanBuilder()
+                 .values(vectors, true)
+                 .localPartition({"c0"})
+                 .singleAggregation({}, {"count(1)"})
+                 .planNode();
+    }
+
+    auto result =
+        exec::test::AssertQueryBuilder(plan)
+            .maxDrivers(numDrivers)
+            .config(
+                core::QueryConfig::kMaxLocalExchangeBufferSize,
+                fmt::format("{}", FLAGS_local_exchange_buffer_mb << 20))
+            // Partitions are copied into partition buffers only if there are
+            // at least this many partitions.
+            .config(
+                core::QueryConfig::
+                    kMinLocalExchangePartitionCountToUsePartitionBuffer,
+                buffered ? 1 : numDrivers + 1)
+            .copyResults(pool());
+    folly::doNotOptimizeAway(result);
+  }
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  folly::Init init{&argc, &argv};
+  ::gflags::ParseCommandLineFlags(&argc, &argv, true);
+  memory::initializeMemoryManager(memory::MemoryManager::Options{});
+  functions::prestosql::registerAllScalarFunctions();
+  aggregate::prestosql::registerAllAggregateFunctions();
+  parse::registerTypeResolver();
+
+  LocalExchangeBenchmark benchmark;
+  for (auto numDrivers : {8, 32, 64}) {
+    benchmark.addQueueBenchmarks(numDrivers);
+  }
+  for (auto numDrivers : {8, 32, 64}) {
+    benchmark.addPartitionBenchmarks(numDrivers);
+  }
+  folly::runBenchmarks();
+  return 0;
+}
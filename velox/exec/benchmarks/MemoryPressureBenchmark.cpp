@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/String.h>
+#include <folly/Synchronized.h>
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/init/Init.h>
+#include <gflags/gflags.h>
+
+#include "velox/common/base/LatencyHistogram.h"
+#include "velox/common/base/SuccinctPrinter.h"
+#include "velox/common/file/FileSystems.h"
+#include "velox/common/memory/SharedArbitrator.h"
+#include "velox/common/time/Timer.h"
+#include "velox/exec/tests/utils/ArbitratorTestUtil.h"
+#include "velox/exec/tests/utils/AssertQueryBuilder.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+#include "velox/exec/tests/utils/QueryAssertions.h"
+#include "velox/exec/tests/utils/TempDirectoryPath.h"
+#include "velox/functions/prestosql/aggregates/RegisterAggregateFunctions.h"
+#include "velox/functions/prestosql/registration/RegistrationFunctions.h"
+#include "velox/parse/TypeResolver.h"
+#include "velox/vector/tests/utils/VectorMaker.h"
+
+DEFINE_int32(
+    num_concurrent_queries,
+    8,
+    "Number of queries running at the same time");
+DEFINE_int32(num_queries, 64, "Total number of queries to run");
+DEFINE_int32(num_drivers, 4, "Number of drivers per query");
+DEFINE_int32(num_executor_threads, 32, "Threads shared by all the queries");
+DEFINE_string(
+    query_mix,
+    "aggregation,join,orderby",
+    "Comma separated query shapes, assigned to queries round-robin. One of "
+    "'aggregation', 'join' and 'orderby'");
+DEFINE_int32(num_batches, 100, "Input batches per driver of each query");
+DEFINE_int32(batch_size, 10'000, "Rows per input batch");
+DEFINE_int64(
+    num_keys,
+    1'000'000,
+    "Number of distinct grouping and join keys in the input");
+DEFINE_int64(allocator_capacity, 16L << 30, "Allocator capacity in bytes");
+DEFINE_int64(
+    arbitrator_capacity,
+    2L << 30,
+    "Memory shared by all the queries in bytes");
+DEFINE_int64(
+    query_capacity,
+    std::numeric_limits<int64_t>::max(),
+    "Memory cap of a single query in bytes");
+DEFINE_string(
+    arbitrator_kind,
+    "SHARED",
+    "Memory arbitrator kind. 'SHARED' or 'NOOP'");
+DEFINE_bool(
+    global_arbitration,
+    true,
+    "Enables global arbitration in the shared arbitrator");
+DEFINE_string(
+    memory_pool_initial_capacity,
+    "256MB",
+    "Initial capacity of each query pool with the shared arbitrator");
+DEFINE_string(
+    max_arbitration_time,
+    "5m",
+    "Max time a query waits for memory arbitration before it fails");
+DEFINE_bool(enable_spill, true, "Enables spilling of all the operators");
+DEFINE_string(
+    spill_directory,
+    "",
+    "Directory to spill to. A temporary directory is used if empty");
+
+/// Runs a stream of synthetic aggregation, hash join and order by queries
+/// with --num_concurrent_queries in flight, all sharing one MemoryManager.
+/// The capacity, arbitrator policy and spilling are configurable so that
+/// arbitrator and spill changes can be compared under memory pressure. At the
+/// end, prints the throughput, query latency percentiles, spilled bytes and
+/// time spent in memory arbitration, followed by the arbitrator stats.
+
+using namespace facebook::velox;
+using namespace facebook::velox::exec;
+using namespace facebook::velox::exec::test;
+
+namespace {
+
+struct QueryStats {
+  LatencyHistogram latencies;
+  int64_t numSucceeded{0};
+  int64_t numFailed{0};
+  int64_t numOutOfMemory{0};
+  int64_t numInputRows{0};
+  uint64_t spilledBytes{0};
+  uint64_t spilledFiles{0};
+  uint64_t arbitrationNanos{0};
+};
+
+class MemoryPressureBenchmark {
+ public:
+  MemoryPressureBenchmark()
+      : pool_(memory::memoryManager()->addLeafPool()),
+        vectorMaker_(pool_.get()),
+        executor_(std::make_unique<folly::CPUThreadPoolExecutor>(
+            FLAGS_num_executor_threads)) {
+    if (FLAGS_spill_directory.empty()) {
+      tempSpillDirectory_ = TempDirectoryPath::create();
+      spillDirectory_ = tempSpillDirectory_->getPath();
+    } else {
+      spillDirectory_ = FLAGS_spill_directory;
+    }
+    makeInput();
+    makePlans();
+  }
+
+  void run() {
+    std::atomic_int32_t nextQuery{0};
+    std::vector<std::thread> threads;
+    threads.reserve(FLAGS_num_concurrent_queries);
+    const auto startNanos = getCurrentTimeNano();
+    for (auto i = 0; i < FLAGS_num_concurrent_queries; ++i) {
+      threads.emplace_back([&]() {
+        for (;;) {
+          const auto queryId = nextQuery++;
+          if (queryId >= FLAGS_num_queries) {
+            return;
+          }
+          runQuery(queryId);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    const auto elapsedNanos = getCurrentTimeNano() - startNanos;
+    waitForAllTasksToBeDeleted();
+    printStats(elapsedNanos);
+  }
+
+ private:
+  void makeInput() {
+    const auto numKeys = FLAGS_num_keys;
+    std::string value;
+    for (auto i = 0; i < FLAGS_num_batches; ++i) {
+      const int64_t firstRow = static_cast<int64_t>(i) * FLAGS_batch_size;
+      input_.push_back(vectorMaker_.rowVector(
+          {"k", "v", "s"},
+          {vectorMaker_.flatVector<int64_t>(
+               FLAGS_batch_size,
+               [&](auto row) {
+                 // Scatter the keys so that the order by input is unsorted.
+                 return ((firstRow + row) * 0x9E3779B97F4A7C15ULL) % numKeys;
+               }),
+           vectorMaker_.flatVector<int64_t>(
+               FLAGS_batch_size, [&](auto row) { return firstRow + row; }),
+           vectorMaker_.flatVector<StringView>(
+               FLAGS_batch_size,
+               [&](auto row) {
+                 // The vector copies the value before the next call.
+                 value =
+                     fmt::format("string value {}", (firstRow + row) % 9973);
+                 return StringView(value);
+               })}));
+    }
+    buildInput_.push_back(vectorMaker_.rowVector(
+        {"bk", "bv"},
+        {vectorMaker_.flatVector<int64_t>(
+             numKeys, [](auto row) { return row; }),
+         vectorMaker_.flatVector<int64_t>(
+             numKeys, [](auto row) { return row * 2; })}));
+  }
+
+  void makePlans() {
+    std::vector<std::string> shapes;
+    folly::split(',', FLAGS_query_mix, shapes, true);
+    VELOX_USER_CHECK(!shapes.empty(), "--query_mix must not be empty");
+    for (const auto& shape : shapes) {
+      plans_.push_back(makePlan(shape));
+    }
+  }
+
+  core::PlanNodePtr makePlan(const std::string& shape) const {
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    if (shape == "aggregation") {
+      return PlanBuilder(planNodeIdGenerator)
+          .values(input_, true)
+          .partialAggregation({"k"}, {"sum(v)", "max(s)", "count(1)"})
+          .localPartition({"k"})
+          .finalAggregation()
+          .partialAggregation({}, {"count(1)"})
+          .localPartition(std::vector<std::string>{})
+          .finalAggregation()
+          .planNode();
+    }
+    if (shape == "join") {
+      return PlanBuilder(planNodeIdGenerator)
+          .values(input_, true)
+          .hashJoin(
+              {"k"},
+              {"bk"},
+              PlanBuilder(planNodeIdGenerator)
+                  .values(buildInput_)
+                  .planNode(),
+              "",
+              {"v", "bv"})
+          .partialAggregation({}, {"sum(v)", "sum(bv)"})
+          .localPartition(std::vector<std::string>{})
+          .finalAggregation()
+          .planNode();
+    }
+    if (shape == "orderby") {
+      return PlanBuilder(planNodeIdGenerator)
+          .values(input_, true)
+          .orderBy({"k", "s"}, true)
+          .partialAggregation({}, {"count(1)"})
+          .localPartition(std::vector<std::string>{})
+          .finalAggregation()
+          .planNode();
+    }
+    VELOX_USER_FAIL("Unknown query shape in --query_mix: {}", shape);
+  }
+
+  std::unordered_map<std::string, std::string> queryConfigs() const {
+    const auto enabled = FLAGS_enable_spill ? "true" : "false";
+    return {
+        {core::QueryConfig::kSpillEnabled, enabled},
+        {core::QueryConfig::kAggregationSpillEnabled, enabled},
+        {core::QueryConfig::kJoinSpillEnabled, enabled},
+        {core::QueryConfig::kOrderBySpillEnabled, enabled}};
+  }
+
+  void runQuery(int32_t queryId) {
+    const auto& plan = plans_[queryId % plans_.size()];
+    auto queryCtx = newQueryCtx(
+        memory::memoryManager(),
+        executor_.get(),
+        FLAGS_query_capacity,
+        fmt::format("query_{}", queryId));
+    std::shared_ptr<Task> task;
+    const auto startNanos = getCurrentTimeNano();
+    bool outOfMemory = false;
+    try {
+      AssertQueryBuilder(plan)
+          .queryCtx(queryCtx)
+          .maxDrivers(FLAGS_num_drivers)
+          .configs(queryConfigs())
+          .spillDirectory(fmt::format("{}/query_{}", spillDirectory_, queryId))
+          .runWithoutResults(task);
+    } catch (const VeloxException& e) {
+      outOfMemory = e.errorCode() == error_code::kMemCapExceeded.c_str() ||
+          e.errorCode() == error_code::kMemAborted.c_str();
+      LOG(WARNING) << "Query " << queryId << " failed: " << e.message();
+    }
+    const auto elapsedNanos = getCurrentTimeNano() - startNanos;
+
+    QueryStats queryStats;
+    if (task != nullptr) {
+      for (const auto& pipeline : task->taskStats().pipelineStats) {
+        for (const auto& op : pipeline.operatorStats) {
+          queryStats.spilledBytes += op.spilledBytes;
+          queryStats.spilledFiles += op.spilledFiles;
+          auto it = op.runtimeStats.find(
+              memory::SharedArbitrator::kMemoryArbitrationWallNanos);
+          if (it != op.runtimeStats.end()) {
+            queryStats.arbitrationNanos += it->second.sum;
+          }
+        }
+      }
+    }
+
+    auto locked = stats_.wlock();
+    if (task != nullptr) {
+      locked->latencies.record(elapsedNanos);
+      ++locked->numSucceeded;
+      locked->numInputRows += static_cast<int64_t>(FLAGS_num_batches) *
+          FLAGS_batch_size * FLAGS_num_drivers;
+    } else {
+      ++locked->numFailed;
+      locked->numOutOfMemory += outOfMemory;
+    }
+    locked->spilledBytes += queryStats.spilledBytes;
+    locked->spilledFiles += queryStats.spilledFiles;
+    locked->arbitrationNanos += queryStats.arbitrationNanos;
+  }
+
+  void printStats(uint64_t elapsedNanos) const {
+    auto locked = stats_.rlock();
+    const double seconds = elapsedNanos / 1'000'000'000.0;
+    std::cout << fmt::format(
+                     "{} queries in {}, {} concurrent: {:.2f} queries/s, "
+                     "{:.0f} input rows/s",
+                     FLAGS_num_queries,
+                     succinctNanos(elapsedNanos),
+                     FLAGS_num_concurrent_queries,
+                     locked->numSucceeded / seconds,
+                     locked->numInputRows / seconds)
+              << std::endl;
+    std::cout << fmt::format(
+                     "Succeeded: {}, failed: {} ({} out of memory)",
+                     locked->numSucceeded,
+                     locked->numFailed,
+                     locked->numOutOfMemory)
+              << std::endl;
+    std::cout << fmt::format(
+                     "Latency p50: {}, p90: {}, p99: {}, max: {}",
+                     succinctNanos(locked->latencies.percentile(50)),
+                     succinctNanos(locked->latencies.percentile(90)),
+                     succinctNanos(locked->latencies.percentile(99)),
+                     succinctNanos(locked->latencies.max()))
+              << std::endl;
+    std::cout << fmt::format(
+                     "Spilled: {} in {} files, memory arbitration time: {}",
+                     succinctBytes(locked->spilledBytes),
+                     locked->spilledFiles,
+                     succinctNanos(locked->arbitrationNanos))
+              << std::endl;
+    std::cout << memory::memoryManager()->arbitrator()->stats().toString()
+              << std::endl;
+  }
+
+  std::shared_ptr<memory::MemoryPool> pool_;
+  test::VectorMaker vectorMaker_;
+  std::unique_ptr<folly::CPUThreadPoolExecutor> executor_;
+  std::shared_ptr<TempDirectoryPath> tempSpillDirectory_;
+  std::string spillDirectory_;
+  std::vector<RowVectorPtr> input_;
+  std::vector<RowVectorPtr> buildInput_;
+  std::vector<core::PlanNodePtr> plans_;
+  folly::Synchronized<QueryStats> stats_;
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+  folly::Init init{&argc, &argv};
+  memory::SharedArbitrator::registerFactory();
+  memory::MemoryManager::Options options;
+  options.allocatorCapacity = FLAGS_allocator_capacity;
+  options.arbitratorCapacity = FLAGS_arbitrator_capacity;
+  options.arbitratorKind = FLAGS_arbitrator_kind;
+  options.extraArbitratorConfigs = {
+      {std::string(
+           memory::SharedArbitrator::ExtraConfig::kGlobalArbitrationEnabled),
+       FLAGS_global_arbitration ? "true" : "false"},
+      {std::string(
+           memory::SharedArbitrator::ExtraConfig::kMemoryPoolInitialCapacity),
+       FLAGS_memory_pool_initial_capacity},
+      {std::string(
+           memory::SharedArbitrator::ExtraConfig::kMaxMemoryArbitrationTime),
+       FLAGS_max_arbitration_time}};
+  memory::MemoryManager::initialize(options);
+  filesystems::registerLocalFileSystem();
+  functions::prestosql::registerAllScalarFunctions();
+  aggregate::prestosql::registerAllAggregateFunctions();
+  parse::registerTypeResolver();
+
+  MemoryPressureBenchmark().run();
+  return 0;
+}
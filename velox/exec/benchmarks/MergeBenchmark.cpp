@@ -19,10 +19,13 @@
 
 #include <gflags/gflags.h>
 
+#include "velox/exec/Merge.h"
 #include "velox/exec/TreeOfLosers.h"
 #include "velox/exec/tests/utils/MergeTestBase.h"
+#include "velox/vector/tests/utils/VectorTestBase.h"
 
 using namespace facebook::velox;
+using namespace facebook::velox::exec;
 using namespace facebook::velox::exec::test;
 
 TestData narrow;
@@ -53,6 +56,124 @@ BENCHMARK_RELATIVE(wideArray) {
   MergeTestBase::test<MergeArray<TestingStream>>(wide, false);
 }
 
+namespace {
+
+// Merges sorted sources with the SourceMerger of LocalMerge. Each source has
+// runs of 'runLength' consecutive keys that sort between the runs of the
+// other sources, so that a run length of 1 interleaves the sources row by row.
+// The producers are run on the benchmark thread: whenever the merge blocks on
+// an empty source, every source is filled up to its queue size, which is the
+// prefetch depth of the merge.
+class SourceMergeBenchmark : public facebook::velox::test::VectorTestBase {
+ public:
+  static constexpr vector_size_t kBatchSize = 1'024;
+  static constexpr int64_t kNumRows = 1 << 20;
+
+  void addBenchmarks(int32_t numSources) {
+    for (auto runLength : {1, 16, 1'024}) {
+      for (auto queueSize : {1, 8}) {
+        folly::addBenchmark(
+            __FILE__,
+            fmt::format(
+                "{}sources{}_run{}_queue{}",
+                queueSize == 1 ? "" : "%",
+                numSources,
+                runLength,
+                queueSize),
+            [this, numSources, runLength, queueSize]() {
+              std::vector<std::vector<RowVectorPtr>> inputs;
+              BENCHMARK_SUSPEND {
+                inputs = makeInputs(numSources, runLength);
+              }
+              merge(inputs, queueSize);
+              return 1;
+            });
+      }
+    }
+  }
+
+ private:
+  std::vector<std::vector<RowVectorPtr>> makeInputs(
+      int32_t numSources,
+      int32_t runLength) {
+    const auto numBatches =
+        std::max<int64_t>(1, kNumRows / numSources / kBatchSize);
+    std::vector<std::vector<RowVectorPtr>> inputs(numSources);
+    for (auto source = 0; source < numSources; ++source) {
+      for (auto i = 0; i < numBatches; ++i) {
+        inputs[source].push_back(makeRowVector({
+            makeFlatVector<int64_t>(
+                kBatchSize,
+                [&](auto row) {
+                  const int64_t index = i * kBatchSize + row;
+                  return (index / runLength) * numSources * runLength +
+                      source * runLength + index % runLength;
+                }),
+            makeFlatVector<int64_t>(kBatchSize, [](auto row) { return row; }),
+        }));
+      }
+    }
+    return inputs;
+  }
+
+  void merge(
+      const std::vector<std::vector<RowVectorPtr>>& inputs,
+      uint32_t queueSize) {
+    std::vector<std::shared_ptr<MergeSource>> sources;
+    std::vector<std::unique_ptr<SourceStream>> streams;
+    for (auto i = 0; i < inputs.size(); ++i) {
+      sources.push_back(MergeSource::createLocalMergeSource(queueSize));
+      sources.back()->start();
+      streams.push_back(
+          std::make_unique<SourceStream>(sources.back().get(), sortingKeys_));
+    }
+    SourceMerger merger(
+        asRowType(inputs[0][0]->type()),
+        kBatchSize,
+        std::move(streams),
+        pool());
+
+    std::vector<size_t> numEnqueued(inputs.size(), 0);
+    auto produce = [&]() {
+      for (auto i = 0; i < inputs.size(); ++i) {
+        ContinueFuture future;
+        while (numEnqueued[i] < inputs[i].size()) {
+          const auto reason =
+              sources[i]->enqueue(inputs[i][numEnqueued[i]++], &future);
+          if (reason != BlockingReason::kNotBlocked) {
+            break;
+          }
+        }
+        if (numEnqueued[i] == inputs[i].size()) {
+          sources[i]->enqueue(nullptr, &future);
+          ++numEnqueued[i];
+        }
+      }
+    };
+
+    std::vector<ContinueFuture> futures;
+    int64_t numRows = 0;
+    bool atEnd = false;
+    while (!atEnd) {
+      produce();
+      futures.clear();
+      merger.isBlocked(futures);
+      if (!futures.empty()) {
+        continue;
+      }
+      if (auto output = merger.getOutput(futures, atEnd)) {
+        numRows += output->size();
+      }
+    }
+    folly::doNotOptimizeAway(numRows);
+  }
+
+  const std::vector<SpillSortKey> sortingKeys_{
+      {0, CompareFlags{.nullsFirst = true, .ascending = true}}};
+};
+
+} // namespace
+
 int main(int argc, char* argv[]) {
   folly::Init init{&argc, &argv};
   ::gflags::ParseCommandLineFlags(&argc, &argv, true);
@@ -61,6 +182,12 @@ int main(int argc, char* argv[]) {
   narrow = test.makeTestData(100'000'000, 7);
   medium = test.makeTestData(10'000'0000, 37);
   wide = test.makeTestData(10'000'0000, 1029);
+
+  memory::initializeMemoryManager(memory::MemoryManager::Options{});
+  SourceMergeBenchmark sourceMerge;
+  for (auto numSources : {16, 64, 256}) {
+    sourceMerge.addBenchmarks(numSources);
+  }
   folly::runBenchmarks();
   return 0;
 }
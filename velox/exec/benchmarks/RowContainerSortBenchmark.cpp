@@ -17,6 +17,8 @@
 #include <folly/Benchmark.h>
 #include <folly/init/Init.h>
 
+#include <random>
+
 #include "velox/dwio/common/tests/utils/DataFiles.h"
 #include "velox/dwio/parquet/reader/ParquetReader.h"
 #include "velox/exec/RowContainer.h"
@@ -213,6 +215,53 @@ void BM_STR_timSort(uint32_t iterations) {
     suspender.rehire();
   }
 }
+
+// Sorts 'cardinality' ROW or ARRAY keys made by 'makeKeys'.
+void complexKeyStdSortBenchmark(
+    uint32_t iterations,
+    size_t cardinality,
+    const std::function<VectorPtr(VectorMaker&, size_t)>& makeKeys) {
+  folly::BenchmarkSuspender suspender;
+  auto pool = memory::memoryManager()->addLeafPool();
+  VectorMaker vectorMaker(pool.get());
+  auto vector = makeKeys(vectorMaker, cardinality);
+  DecodedVector decoded(*vector);
+  std::vector<TypePtr> types{vector->type()};
+  auto rowContainer =
+      std::make_unique<velox::exec::RowContainer>(types, pool.get());
+  auto rows = store(*rowContainer, decoded, vector->size());
+  for (size_t k = 0; k < iterations; ++k) {
+    std::shuffle(rows.begin(), rows.end(), std::mt19937(k));
+    suspender.dismiss();
+    std::sort(
+        rows.begin(), rows.end(), [&](const char* left, const char* right) {
+          return rowContainer->compareRows(left, right) < 0;
+        });
+    suspender.rehire();
+  }
+}
+
+void BM_Row_stdSort(uint32_t iterations, size_t cardinality) {
+  complexKeyStdSortBenchmark(
+      iterations, cardinality, [](VectorMaker& maker, size_t size) {
+        return maker.rowVector(
+            {maker.flatVector<int64_t>(
+                 size, [](auto row) { return (row * 7'919) % 1'000; }),
+             maker.flatVector<int32_t>(
+                 size, [](auto row) { return (row * 104'729) % 997; }),
+             maker.flatVector<double>(size, [](auto row) { return row; })});
+      });
+}
+
+void BM_Array_stdSort(uint32_t iterations, size_t cardinality) {
+  complexKeyStdSortBenchmark(
+      iterations, cardinality, [](VectorMaker& maker, size_t size) {
+        return maker.arrayVector<int64_t>(
+            size,
+            [](auto row) { return 1 + row % 5; },
+            [](auto index) { return (index * 7'919) % 100; });
+      });
+}
 } // namespace
 
 BENCHMARK_NAMED_PARAM(BM_Int64_stdSort, 100k_uni_noseq, 100000);
@@ -227,6 +276,10 @@ BENCHMARK_NAMED_PARAM(BM_Int64_stdSort, 1k_uni_noseq, 1000);
 BENCHMARK_RELATIVE_NAMED_PARAM(BM_Int64_timSort, 1k_uni_noseq, 1000);
 BENCHMARK_DRAW_LINE();
 
+BENCHMARK_NAMED_PARAM(BM_Row_stdSort, 100k, 100000);
+BENCHMARK_NAMED_PARAM(BM_Array_stdSort, 100k, 100000);
+BENCHMARK_DRAW_LINE();
+
 BENCHMARK_NAMED_PARAM(BM_STR_stdSort, RealWorldData_stdSort);
 BENCHMARK_RELATIVE_NAMED_PARAM(BM_STR_timSort, RealWorldData_timSort);
 BENCHMARK_DRAW_LINE();
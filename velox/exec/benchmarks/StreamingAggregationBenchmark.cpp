@@ -109,6 +109,74 @@ class StreamingAggregationBenchmark : public VectorTestBase {
     }
   }
 
+  // Make benchmarks of a partial hash aggregation over input clustered on the
+  // grouping key, with and without detection of the clustering, and of the
+  // equivalent streaming aggregation. 'numRowsPerGroup' consecutive rows have
+  // the same key and groups span batches.
+  void makeClusteredInputBenchmarks(int32_t numRowsPerGroup) {
+    constexpr int32_t kNumBatches = 100;
+    constexpr int32_t kBatchSize = 10'000;
+    constexpr int32_t kNumPayloads = 10;
+    auto test = std::make_unique<TestCase>();
+    for (auto i = 0; i < kNumBatches; ++i) {
+      std::vector<VectorPtr> children;
+      children.push_back(makeFlatVector<int64_t>(kBatchSize, [&](auto row) {
+        return (i * kBatchSize + row) / numRowsPerGroup;
+      }));
+      for (auto j = 0; j < kNumPayloads; ++j) {
+        children.push_back(makeFlatVector<int64_t>(
+            kBatchSize, [&](auto row) { return row + j; }));
+      }
+      test->data.push_back(makeRowVector(children));
+    }
+    for (auto j = 0; j < kNumPayloads; ++j) {
+      test->aggregates.push_back(fmt::format("sum(c{})", j + 1));
+    }
+
+    for (const auto detectionRows : {0, 100'000}) {
+      auto plan = exec::test::PlanBuilder()
+                      .values(test->data)
+                      .partialAggregation({"c0"}, test->aggregates)
+                      .planNode();
+      auto name = fmt::format(
+          "partial_hash_{}_rows_per_group{}",
+          numRowsPerGroup,
+          detectionRows > 0 ? "_detected" : "");
+      folly::addBenchmark(__FILE__, name, [plan, detectionRows]() {
+        std::shared_ptr<Task> task;
+        exec::test::AssertQueryBuilder(plan)
+            .config(
+                core::QueryConfig::kAggregationClusteredInputDetectionRows,
+                detectionRows)
+            .serialExecution(true)
+            .runWithoutResults(task);
+        return 1;
+      });
+    }
+
+    test->plan = exec::test::PlanBuilder()
+                     .values(test->data)
+                     .streamingAggregation(
+                         {"c0"},
+                         test->aggregates,
+                         {},
+                         core::AggregationNode::Step::kPartial,
+                         false)
+                     .planNode();
+    folly::addBenchmark(
+        __FILE__,
+        fmt::format("partial_streaming_{}_rows_per_group", numRowsPerGroup),
+        [plan = &test->plan]() {
+          std::shared_ptr<Task> task;
+          exec::test::AssertQueryBuilder(*plan)
+              .serialExecution(true)
+              .runWithoutResults(task);
+          return 1;
+        });
+
+    cases_.push_back(std::move(test));
+  }
+
  private:
   // Make the test data with one key column and 'numPayloads' payloads with
   // the same data type.
@@ -180,6 +248,10 @@ int main(int argc, char** argv) {
   bm.makeBenchmarks("arbitrary", REAL());
   BENCHMARK_DRAW_LINE();
   bm.makeBenchmarks("arbitrary", ARRAY(BIGINT()));
+  BENCHMARK_DRAW_LINE();
+  bm.makeClusteredInputBenchmarks(10);
+  BENCHMARK_DRAW_LINE();
+  bm.makeClusteredInputBenchmarks(1'000);
 
   folly::runBenchmarks();
 
@@ -270,6 +270,132 @@ BENCHMARK(computeValueIdsDictionaryForFiltering) {
   }
 }
 
+// Hashes ROW or ARRAY values with VectorHasher, which hashes one field or all
+// elements at a time, or with BaseVector::hashValueAt() one value at a time.
+void benchmarkHashComplexType(
+    const std::function<VectorPtr(BenchmarkBase&)>& makeValues,
+    bool vectorHasher) {
+  folly::BenchmarkSuspender suspender;
+  BenchmarkBase base;
+  auto values = makeValues(base);
+  const auto size = values->size();
+  raw_vector<uint64_t> hashes(size, base.pool());
+  SelectivityVector rows(size);
+  VectorHasher hasher(values->type(), 0);
+  suspender.dismiss();
+
+  for (int i = 0; i < 100; i++) {
+    if (vectorHasher) {
+      hasher.decode(*values, rows);
+      hasher.hash(rows, false, hashes);
+    } else {
+      for (auto row = 0; row < size; ++row) {
+        hashes[row] = values->hashValueAt(row);
+      }
+    }
+    folly::doNotOptimizeAway(hashes);
+  }
+}
+
+VectorPtr makeRowValues(BenchmarkBase& base) {
+  vector_size_t size = 10'000;
+  return base.vectorMaker().rowVector(
+      {base.vectorMaker().flatVector<int64_t>(
+           size, [](auto row) { return row % 1'000; }),
+       base.vectorMaker().flatVector<int32_t>(
+           size,
+           [](auto row) { return row % 17; },
+           VectorMaker::nullEvery(7)),
+       base.vectorMaker().flatVector<double>(
+           size, [](auto row) { return row * 0.1; })});
+}
+
+VectorPtr makeArrayValues(BenchmarkBase& base) {
+  return base.vectorMaker().arrayVector<int64_t>(
+      10'000,
+      [](auto row) { return row % 7; },
+      [](auto index) { return index % 1'000; });
+}
+
+BENCHMARK(hashRowValueAt) {
+  benchmarkHashComplexType(makeRowValues, false);
+}
+
+BENCHMARK_RELATIVE(hashRowVectorHasher) {
+  benchmarkHashComplexType(makeRowValues, true);
+}
+
+BENCHMARK(hashArrayValueAt) {
+  benchmarkHashComplexType(makeArrayValues, false);
+}
+
+BENCHMARK_RELATIVE(hashArrayVectorHasher) {
+  benchmarkHashComplexType(makeArrayValues, true);
+}
+
+// Hashes 'numKeys' flat fixed-width keys column by column or with
+// VectorHasher::hashAll(), which hashes runs of such keys in one pass.
+void benchmarkHashMultipleKeys(int32_t numKeys, bool hashAll) {
+  folly::BenchmarkSuspender suspender;
+  BenchmarkBase base;
+  constexpr vector_size_t size = 10'000;
+  std::vector<VectorPtr> keys;
+  std::vector<std::unique_ptr<VectorHasher>> hashers;
+  for (auto i = 0; i < numKeys; ++i) {
+    if (i % 2 == 0) {
+      keys.push_back(base.vectorMaker().flatVector<int64_t>(
+          size, [i](auto row) { return row * (i + 1); }));
+    } else {
+      keys.push_back(base.vectorMaker().flatVector<int32_t>(
+          size,
+          [i](auto row) { return row % (100 * i); },
+          VectorMaker::nullEvery(9)));
+    }
+    hashers.push_back(VectorHasher::create(keys.back()->type(), i));
+  }
+  raw_vector<uint64_t> hashes(size, base.pool());
+  SelectivityVector rows(size);
+  suspender.dismiss();
+
+  for (int i = 0; i < 100; i++) {
+    for (auto j = 0; j < numKeys; ++j) {
+      hashers[j]->decode(*keys[j], rows);
+    }
+    if (hashAll) {
+      VectorHasher::hashAll(hashers, rows, hashes);
+    } else {
+      for (auto j = 0; j < numKeys; ++j) {
+        hashers[j]->hash(rows, j > 0, hashes);
+      }
+    }
+    folly::doNotOptimizeAway(hashes);
+  }
+}
+
+BENCHMARK(hashTwoKeysByColumn) {
+  benchmarkHashMultipleKeys(2, false);
+}
+
+BENCHMARK_RELATIVE(hashTwoKeysHashAll) {
+  benchmarkHashMultipleKeys(2, true);
+}
+
+BENCHMARK(hashFourKeysByColumn) {
+  benchmarkHashMultipleKeys(4, false);
+}
+
+BENCHMARK_RELATIVE(hashFourKeysHashAll) {
+  benchmarkHashMultipleKeys(4, true);
+}
+
+BENCHMARK(hashEightKeysByColumn) {
+  benchmarkHashMultipleKeys(8, false);
+}
+
+BENCHMARK_RELATIVE(hashEightKeysHashAll) {
+  benchmarkHashMultipleKeys(8, true);
+}
+
 int main(int argc, char** argv) {
   folly::Init init{&argc, &argv};
   memory::MemoryManager::initialize(memory::MemoryManager::Options{});
@@ -132,7 +132,8 @@ class WindowPrefixSortBenchmark : public HiveConnectorTestBase {
   void run(
       const std::string& key,
       const std::string& aggregate,
-      bool prefixSort = true) {
+      bool prefixSort = true,
+      const std::string& orderBy = "k_sort") {
     folly::BenchmarkSuspender suspender1;
 
     if ((prefixSort && !lastRunPrefixSort_) ||
@@ -143,7 +144,7 @@ class WindowPrefixSortBenchmark : public HiveConnectorTestBase {
 
     lastRunPrefixSort_ = prefixSort;
     std::string functionSql = fmt::format(
-        "{} over (partition by {} order by k_sort)", aggregate, key);
+        "{} over (partition by {} order by {})", aggregate, key, orderBy);
 
     core::PlanNodeId tableScanPlanId;
     core::PlanFragment plan = PlanBuilder()
@@ -227,6 +228,12 @@ void doPrefixSortRun(
   benchmark->run(key, aggregate, true);
 }
 
+// Ranking functions ordered by a key with 300 values, which gives peer groups
+// of about 100 rows.
+void doRankingRun(uint32_t, const std::string& function) {
+  benchmark->run("k_array", function, true, "k_norm");
+}
+
 #define AGG_BENCHMARKS(_name_, _key_)              \
   BENCHMARK_NAMED_PARAM(                           \
       doSortRun,                                   \
@@ -374,6 +381,14 @@ MULTI_KEY_AGG_BENCHMARKS(max, k_hash, f32)
 MULTI_KEY_AGG_BENCHMARKS(max, k_hash, f64)
 BENCHMARK_DRAW_LINE();
 
+// Ranking functions.
+BENCHMARK_NAMED_PARAM(doRankingRun, rank, "rank()");
+BENCHMARK_NAMED_PARAM(doRankingRun, dense_rank, "dense_rank()");
+BENCHMARK_NAMED_PARAM(doRankingRun, percent_rank, "percent_rank()");
+BENCHMARK_NAMED_PARAM(doRankingRun, cume_dist, "cume_dist()");
+BENCHMARK_NAMED_PARAM(doRankingRun, row_number, "row_number()");
+BENCHMARK_DRAW_LINE();
+
 } // namespace
 
 int main(int argc, char** argv) {
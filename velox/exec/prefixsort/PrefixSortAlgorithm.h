@@ -15,12 +15,14 @@
  */
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <memory>
 
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/base/SimdUtil.h"
+#include "velox/common/base/SortingNetwork.h"
 
 namespace facebook::velox::exec::prefixsort {
 
@@ -124,6 +126,28 @@ class PrefixSortIterator {
   const uint64_t entrySize_;
   char* prefix_;
 };
+
+/// A prefix entry with a key of 'kKeyWords' uint64_t words followed by the
+/// row address.
+template <int kKeyWords>
+struct WordKeyEntry {
+  uint64_t words[kKeyWords];
+  char* row;
+};
+
+template <int kKeyWords>
+FOLLY_ALWAYS_INLINE bool wordKeyLess(
+    const WordKeyEntry<kKeyWords>& lhs,
+    const WordKeyEntry<kKeyWords>& rhs) {
+  static_assert(kKeyWords == 1 || kKeyWords == 2);
+  if constexpr (kKeyWords == 1) {
+    return lhs.words[0] < rhs.words[0];
+  } else {
+    // Compares as one 128 bit value so that there is no branch.
+    return ((static_cast<__uint128_t>(lhs.words[0]) << 64) | lhs.words[1]) <
+        ((static_cast<__uint128_t>(rhs.words[0]) << 64) | rhs.words[1]);
+  }
+}
 } // namespace detail
 
 /// Provides methods (mostly required by the sort
@@ -156,7 +180,98 @@ class PrefixSortRunner {
     quickSort(
         detail::PrefixSortIterator(start, entrySize_),
         detail::PrefixSortIterator(end, entrySize_),
-        compare);
+        compare,
+        [](const auto& /*start*/, const auto& /*end*/) { return false; });
+  }
+
+  /// Same as quickSort() for entries of detail::WordKeyEntry<kKeyWords>, i.e.
+  /// keys of 1 or 2 words compared as uint64_t. Ranges of up to
+  /// kSortingNetworkMaxSize entries, e.g. most of a sort of small window
+  /// partitions, are sorted with a branch free sorting network.
+  template <int kKeyWords>
+  void quickSortWordKeys(char* start, char* end) const {
+    using Entry = detail::WordKeyEntry<kKeyWords>;
+    VELOX_CHECK_EQ(entrySize_, sizeof(Entry));
+    quickSort(
+        detail::PrefixSortIterator(start, entrySize_),
+        detail::PrefixSortIterator(end, entrySize_),
+        [](char* lhs, char* rhs) {
+          const auto& left = *reinterpret_cast<const Entry*>(lhs);
+          const auto& right = *reinterpret_cast<const Entry*>(rhs);
+          return detail::wordKeyLess(left, right)
+              ? -1
+              : (detail::wordKeyLess(right, left) ? 1 : 0);
+        },
+        [](const detail::PrefixSortIterator& start,
+           const detail::PrefixSortIterator& end) {
+          const auto size = end - start;
+          if (size > kSortingNetworkMaxSize) {
+            return false;
+          }
+          sortingNetwork(
+              reinterpret_cast<Entry*>(*start),
+              size,
+              [](const Entry& lhs, const Entry& rhs) {
+                return detail::wordKeyLess(lhs, rhs);
+              });
+          return true;
+        });
+  }
+
+  /// Sorts the entries in [start, end) by their first 'keyBytes' bytes with a
+  /// LSD radix sort. The key is compared as a sequence of little-endian
+  /// uint64_t words, like compareByWord() in PrefixSort. The sort is stable.
+  /// @param keyBytes A multiple of 8.
+  /// @param numZeroBytes The number of least significant key bytes that are 0
+  /// for all entries, e.g. padding. These are skipped.
+  /// @param buffer The buffer must be at least 'end' - 'start' bytes long.
+  void radixSort(
+      char* start,
+      char* end,
+      uint32_t keyBytes,
+      uint32_t numZeroBytes,
+      char* buffer) const {
+    VELOX_CHECK(end >= start, "Invalid sort range.");
+    constexpr uint32_t kWordBytes = sizeof(uint64_t);
+    VELOX_CHECK_EQ(keyBytes % kWordBytes, 0);
+    const uint64_t numEntries = (end - start) / entrySize_;
+    if (numEntries < 2) {
+      return;
+    }
+    std::array<uint64_t, 256> offsets;
+    char* from = start;
+    char* to = buffer;
+    for (auto byte = numZeroBytes; byte < keyBytes; ++byte) {
+      // Byte 'byte' in order of significance, starting from the least
+      // significant byte of the last word.
+      const auto word = keyBytes / kWordBytes - 1 - byte / kWordBytes;
+      const auto offset = word * kWordBytes + byte % kWordBytes;
+      offsets.fill(0);
+      for (auto i = 0; i < numEntries; ++i) {
+        ++offsets[static_cast<uint8_t>(from[i * entrySize_ + offset])];
+      }
+      if (offsets[static_cast<uint8_t>(from[offset])] == numEntries) {
+        // All entries have the same byte.
+        continue;
+      }
+      uint64_t sum = 0;
+      for (auto& count : offsets) {
+        const auto numWithByte = count;
+        count = sum;
+        sum += numWithByte;
+      }
+      for (auto i = 0; i < numEntries; ++i) {
+        const char* entry = from + i * entrySize_;
+        simd::memcpy(
+            to + offsets[static_cast<uint8_t>(entry[offset])]++ * entrySize_,
+            entry,
+            entrySize_);
+      }
+      std::swap(from, to);
+    }
+    if (from != start) {
+      simd::memcpy(start, from, numEntries * entrySize_);
+    }
   }
 
   /// For testing only.
@@ -247,13 +362,19 @@ class PrefixSortRunner {
   // of this, quickSort`s implementations also need to be placed in the header
   // file.
   // TCompare is a compare function : int compare(char*, char*).
-  template <typename TCompare>
+  // TSmallSort is a function: bool smallSort(start, end) that returns true if
+  // it has sorted the range, e.g. with a sorting network.
+  template <typename TCompare, typename TSmallSort>
   void quickSort(
       const detail::PrefixSortIterator& start,
       const detail::PrefixSortIterator& end,
-      TCompare compare) const {
+      TCompare compare,
+      TSmallSort smallSort) const {
     VELOX_CHECK(end >= start, "Invalid sort range.");
     const uint64_t len = end - start;
+    if (smallSort(start, end)) {
+      return;
+    }
 
     // Insertion sort on smallest arrays
     if (len < kSmallSort) {
@@ -339,11 +460,11 @@ class PrefixSortRunner {
     // Recursively sort non-partition-elements
     s = b - a;
     if (s > 1) {
-      quickSort(start, start + s, compare);
+      quickSort(start, start + s, compare, smallSort);
     }
     s = d - c;
     if (s > 1) {
-      quickSort(n - s, n, compare);
+      quickSort(n - s, n, compare, smallSort);
     }
   }
 
@@ -44,6 +44,59 @@ class PrefixSortAlgorithmBenchmark {
         });
   }
 
+  // Sorts the same entries as runQuickSort() as words with a radix sort.
+  void runRadixSort(std::vector<int64_t> vec) {
+    char* start = (char*)vec.data();
+    uint32_t entrySize = sizeof(int64_t);
+    auto swapBuffer = AlignedBuffer::allocate<char>(entrySize, pool_.get());
+    auto buffer =
+        AlignedBuffer::allocate<char>(entrySize * vec.size(), pool_.get());
+    auto sortRunner =
+        prefixsort::PrefixSortRunner(entrySize, swapBuffer->asMutable<char>());
+    sortRunner.radixSort(
+        start,
+        start + entrySize * vec.size(),
+        entrySize,
+        0,
+        buffer->asMutable<char>());
+  }
+
+  // Sorts consecutive partitions of 'partitionSize' entries of a one word key
+  // and a row address, as in a sort of small window partitions.
+  void runSmallSorts(
+      std::vector<prefixsort::detail::WordKeyEntry<1>> entries,
+      int32_t partitionSize,
+      bool sortingNetwork) {
+    constexpr uint32_t kEntrySize = sizeof(entries[0]);
+    auto swapBuffer = AlignedBuffer::allocate<char>(kEntrySize, pool_.get());
+    auto sortRunner =
+        prefixsort::PrefixSortRunner(kEntrySize, swapBuffer->asMutable<char>());
+    for (auto i = 0; i < entries.size(); i += partitionSize) {
+      char* start = reinterpret_cast<char*>(entries.data() + i);
+      char* end = reinterpret_cast<char*>(
+          entries.data() + std::min<size_t>(i + partitionSize, entries.size()));
+      if (sortingNetwork) {
+        sortRunner.quickSortWordKeys<1>(start, end);
+      } else {
+        sortRunner.quickSort(start, end, [](char* a, char* b) {
+          const auto left = *reinterpret_cast<uint64_t*>(a);
+          const auto right = *reinterpret_cast<uint64_t*>(b);
+          return left < right ? -1 : (left == right ? 0 : 1);
+        });
+      }
+    }
+  }
+
+  std::vector<prefixsort::detail::WordKeyEntry<1>> generateEntries(
+      int32_t size) {
+    std::vector<prefixsort::detail::WordKeyEntry<1>> entries(size);
+    for (auto& entry : entries) {
+      entry.words[0] = folly::Random::rand64(rng_);
+      entry.row = nullptr;
+    }
+    return entries;
+  }
+
   std::vector<int64_t> generateTestVector(int32_t size) {
     std::vector<int64_t> randomTestVec(size);
     std::generate(randomTestVec.begin(), randomTestVec.end(), [&]() {
@@ -65,23 +118,56 @@ std::vector<int64_t> data10k;
 std::vector<int64_t> data100k;
 std::vector<int64_t> data1000k;
 std::vector<int64_t> data10000k;
+std::vector<prefixsort::detail::WordKeyEntry<1>> entries1000k;
 
 BENCHMARK(PrefixSort_algorithm_10k) {
   bm->runQuickSort(data10k);
 }
 
+BENCHMARK_RELATIVE(PrefixSort_algorithm_radix_10k) {
+  bm->runRadixSort(data10k);
+}
+
 BENCHMARK(PrefixSort_algorithm_100k) {
   bm->runQuickSort(data100k);
 }
 
+BENCHMARK_RELATIVE(PrefixSort_algorithm_radix_100k) {
+  bm->runRadixSort(data100k);
+}
+
 BENCHMARK(PrefixSort_algorithm_1000k) {
   bm->runQuickSort(data1000k);
 }
 
+BENCHMARK_RELATIVE(PrefixSort_algorithm_radix_1000k) {
+  bm->runRadixSort(data1000k);
+}
+
 BENCHMARK(PrefixSort_algorithm_10000k) {
   bm->runQuickSort(data10000k);
 }
 
+BENCHMARK_RELATIVE(PrefixSort_algorithm_radix_10000k) {
+  bm->runRadixSort(data10000k);
+}
+
+BENCHMARK(PrefixSort_small_partitions_12) {
+  bm->runSmallSorts(entries1000k, 12, false);
+}
+
+BENCHMARK_RELATIVE(PrefixSort_small_partitions_12_sorting_network) {
+  bm->runSmallSorts(entries1000k, 12, true);
+}
+
+BENCHMARK(PrefixSort_small_partitions_100) {
+  bm->runSmallSorts(entries1000k, 100, false);
+}
+
+BENCHMARK_RELATIVE(PrefixSort_small_partitions_100_sorting_network) {
+  bm->runSmallSorts(entries1000k, 100, true);
+}
+
 } // namespace
 
 int main(int argc, char** argv) {
@@ -93,6 +179,7 @@ int main(int argc, char** argv) {
   data100k = bm->generateTestVector(100'000);
   data1000k = bm->generateTestVector(1'000'000);
   data10000k = bm->generateTestVector(10'000'000);
+  entries1000k = bm->generateEntries(1'000'000);
   folly::runBenchmarks();
   return 0;
 }
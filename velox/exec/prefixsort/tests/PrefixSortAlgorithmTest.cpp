@@ -55,6 +55,42 @@ class PrefixSortAlgorithmTest : public testing::Test,
     ASSERT_EQ(data1, data2);
   }
 
+  template <int kKeyWords>
+  void testQuickSortWordKeys(size_t size, uint64_t maxKey) {
+    SCOPED_TRACE(fmt::format("{} {} {}", kKeyWords, size, maxKey));
+    using Entry = detail::WordKeyEntry<kKeyWords>;
+    std::vector<Entry> entries(size);
+    for (auto i = 0; i < size; ++i) {
+      for (auto j = 0; j < kKeyWords; ++j) {
+        entries[i].words[j] = folly::Random::rand64(maxKey);
+      }
+      entries[i].row = reinterpret_cast<char*>(static_cast<uintptr_t>(i));
+    }
+    auto expected = entries;
+    std::sort(
+        expected.begin(), expected.end(), [](const auto& a, const auto& b) {
+          return detail::wordKeyLess(a, b);
+        });
+
+    char* start = reinterpret_cast<char*>(entries.data());
+    auto swapBuffer = AlignedBuffer::allocate<char>(sizeof(Entry), pool());
+    PrefixSortRunner sortRunner(sizeof(Entry), swapBuffer->asMutable<char>());
+    sortRunner.quickSortWordKeys<kKeyWords>(
+        start, start + size * sizeof(Entry));
+    std::vector<char*> rows;
+    for (auto i = 0; i < size; ++i) {
+      for (auto j = 0; j < kKeyWords; ++j) {
+        ASSERT_EQ(entries[i].words[j], expected[i].words[j]);
+      }
+      rows.push_back(entries[i].row);
+    }
+    // The row addresses move with their keys.
+    std::sort(rows.begin(), rows.end());
+    for (auto i = 0; i < size; ++i) {
+      ASSERT_EQ(rows[i], reinterpret_cast<char*>(static_cast<uintptr_t>(i)));
+    }
+  }
+
  protected:
   static void SetUpTestCase() {
     memory::MemoryManager::testingSetInstance(memory::MemoryManager::Options{});
@@ -70,6 +106,61 @@ TEST_F(PrefixSortAlgorithmTest, quickSort) {
   testQuickSort(PrefixSortRunner::kMediumSort + 1000);
 }
 
+TEST_F(PrefixSortAlgorithmTest, quickSortWordKeys) {
+  constexpr auto kMaxKey = std::numeric_limits<int64_t>::max();
+  for (auto size : {0, 1, 2, 7, 15, 16, 17, 40, 1'000}) {
+    testQuickSortWordKeys<1>(size, 5);
+    testQuickSortWordKeys<1>(size, kMaxKey);
+    testQuickSortWordKeys<2>(size, 3);
+    testQuickSortWordKeys<2>(size, kMaxKey);
+  }
+}
+
+TEST_F(PrefixSortAlgorithmTest, radixSort) {
+  // Entries of a 16 byte key compared by word and the original position.
+  struct Entry {
+    uint64_t key[2];
+    uint64_t position;
+  };
+  auto testRadixSort = [&](size_t size, uint64_t maxKey, uint32_t shift) {
+    SCOPED_TRACE(fmt::format("{} {} {}", size, maxKey, shift));
+    std::vector<Entry> entries(size);
+    for (auto i = 0; i < size; ++i) {
+      entries[i] = {
+          {folly::Random::rand64(3), folly::Random::rand64(maxKey) << shift},
+          static_cast<uint64_t>(i)};
+    }
+    auto expected = entries;
+    std::stable_sort(
+        expected.begin(), expected.end(), [](const auto& a, const auto& b) {
+          return std::make_pair(a.key[0], a.key[1]) <
+              std::make_pair(b.key[0], b.key[1]);
+        });
+
+    char* start = reinterpret_cast<char*>(entries.data());
+    auto swapBuffer = AlignedBuffer::allocate<char>(sizeof(Entry), pool());
+    PrefixSortRunner sortRunner(sizeof(Entry), swapBuffer->asMutable<char>());
+    std::vector<Entry> buffer(size);
+    sortRunner.radixSort(
+        start,
+        start + size * sizeof(Entry),
+        sizeof(Entry::key),
+        shift / 8,
+        reinterpret_cast<char*>(buffer.data()));
+    for (auto i = 0; i < size; ++i) {
+      ASSERT_EQ(entries[i].key[0], expected[i].key[0]);
+      ASSERT_EQ(entries[i].key[1], expected[i].key[1]);
+      // The sort is stable.
+      ASSERT_EQ(entries[i].position, expected[i].position);
+    }
+  };
+  testRadixSort(0, 100, 0);
+  testRadixSort(1, 100, 0);
+  testRadixSort(1'000, 100, 0);
+  testRadixSort(10'000, std::numeric_limits<uint32_t>::max(), 16);
+  testRadixSort(10'000, 2, 56);
+}
+
 TEST_F(PrefixSortAlgorithmTest, testingMedian3) {
   // Generate 3 elements randomly as input data.
   std::vector<int64_t> data1(3);
@@ -130,6 +130,8 @@ void checkSpillStats(PlanNodeStats& stats, bool expectedSpill) {
     ASSERT_EQ(stats.customStats[Operator::kSpillFillTime].sum, 0);
     ASSERT_EQ(stats.customStats[Operator::kSpillSortTime].sum, 0);
     ASSERT_EQ(stats.customStats[Operator::kSpillExtractVectorTime].sum, 0);
+    ASSERT_EQ(
+        stats.customStats[Operator::kSpillExtractAccumulatorTime].sum, 0);
     ASSERT_EQ(stats.customStats[Operator::kSpillSerializationTime].sum, 0);
     ASSERT_EQ(stats.customStats[Operator::kSpillFlushTime].sum, 0);
     ASSERT_EQ(stats.customStats[Operator::kSpillWrites].sum, 0);
@@ -1045,6 +1047,215 @@ TEST_F(AggregationTest, distinctWithGroupingKeysReordered) {
           .assertResults("SELECT distinct c4, c1, c3, c2, c0 FROM tmp");
 }
 
+TEST_F(AggregationTest, hotGroupCache) {
+  // 90% of the rows have one of 4 keys. The other keys are distinct. The keys
+  // are too far apart for an array hash table.
+  std::vector<RowVectorPtr> vectors;
+  for (auto i = 0; i < 10; ++i) {
+    vectors.push_back(makeRowVector(
+        {makeFlatVector<int64_t>(
+             10'000,
+             [&](auto row) {
+               return row % 10 == 0 ? (i * 10'000L + row) * 1'000 + 7
+                                    : (row % 4) * 1'000'000'000L;
+             }),
+         makeFlatVector<int64_t>(10'000, [](auto row) { return row; })}));
+  }
+  createDuckDbTable(vectors);
+
+  core::PlanNodeId aggregationId;
+  const auto plan = PlanBuilder()
+                        .values(vectors)
+                        .singleAggregation({"c0"}, {"sum(c1)", "count(1)"})
+                        .capturePlanNodeId(aggregationId)
+                        .planNode();
+  for (const auto enabled : {false, true}) {
+    SCOPED_TRACE(fmt::format("enabled: {}", enabled));
+    auto task =
+        AssertQueryBuilder(plan, duckDbQueryRunner_)
+            .config(QueryConfig::kAggregationHotGroupCacheEnabled, enabled)
+            .maxDrivers(1)
+            .assertResults("SELECT c0, sum(c1), count(1) FROM tmp GROUP BY 1");
+    const auto runtimeStats =
+        toPlanStats(task->taskStats()).at(aggregationId).customStats;
+    if (!enabled) {
+      EXPECT_EQ(0, runtimeStats.count(GroupingSet::kHotGroupCacheLookups));
+      continue;
+    }
+    const auto lookups =
+        runtimeStats.at(GroupingSet::kHotGroupCacheLookups).sum;
+    const auto hits = runtimeStats.at(GroupingSet::kHotGroupCacheHits).sum;
+    EXPECT_EQ(100'000, lookups);
+    EXPECT_GE(hits * 100, lookups * 85);
+  }
+}
+
+TEST_F(AggregationTest, blockedUpdates) {
+  std::vector<RowVectorPtr> vectors;
+  for (auto i = 0; i < 5; ++i) {
+    vectors.push_back(makeRowVector({
+        makeFlatVector<int64_t>(
+            10'000, [&](auto row) { return (row * 7 + i) % 3'000; }),
+        makeFlatVector<int64_t>(
+            10'000, [](auto row) { return row; }, nullEvery(7)),
+        makeFlatVector<double>(10'000, [](auto row) { return row * 0.1; }),
+        makeFlatVector<int32_t>(
+            10'000, [](auto row) { return row % 11; }, nullEvery(5)),
+        makeFlatVector<bool>(10'000, [](auto row) { return row % 3 == 0; }),
+    }));
+  }
+  createDuckDbTable(vectors);
+
+  // The masked aggregate is not blocked. The rows of the other aggregates are
+  // updated 100 at a time.
+  const auto plan =
+      PlanBuilder()
+          .values(vectors)
+          .singleAggregation(
+              {"c0"},
+              {"sum(c1)",
+               "count(c1)",
+               "min(c2)",
+               "max(c3)",
+               "sum(c3)",
+               "count(1)",
+               "sum(c1)"},
+              {"", "", "", "", "", "", "c4"})
+          .planNode();
+  for (const auto blockRows : {0, 100, 4'096}) {
+    SCOPED_TRACE(fmt::format("blockRows: {}", blockRows));
+    AssertQueryBuilder(plan, duckDbQueryRunner_)
+        .config(QueryConfig::kAggregationUpdateBlockRows, blockRows)
+        .maxDrivers(1)
+        .assertResults(
+            "SELECT c0, sum(c1), count(c1), min(c2), max(c3), sum(c3), "
+            "count(1), sum(c1) FILTER (WHERE c4) FROM tmp GROUP BY 1");
+  }
+}
+
+TEST_F(AggregationTest, distinctDedup) {
+  std::vector<RowVectorPtr> vectors;
+  for (auto i = 0; i < 5; ++i) {
+    vectors.push_back(makeRowVector({
+        makeFlatVector<int64_t>(
+            10'000, [&](auto row) { return (row * 7 + i) % 1'000; }),
+        makeFlatVector<int64_t>(
+            10'000, [&](auto row) { return (row + i) % 2'000; }, nullEvery(7)),
+        makeFlatVector<StringView>(
+            10'000,
+            [&](auto row) {
+              return StringView::makeInline(fmt::format("{}", row % 500));
+            }),
+    }));
+  }
+  createDuckDbTable(vectors);
+
+  const auto groupByPlan = PlanBuilder()
+                               .values(vectors)
+                               .singleAggregation(
+                                   {"c0"},
+                                   {"count(distinct c1)",
+                                    "sum(distinct c1)",
+                                    "count(distinct c2)"})
+                               .planNode();
+  const auto globalPlan =
+      PlanBuilder()
+          .values(vectors)
+          .singleAggregation({}, {"count(distinct c1)", "max(distinct c2)"})
+          .planNode();
+  // Threshold 1 switches to de-duplication after the first batch, 20'000
+  // during the input and 1'000'000 never.
+  for (const auto threshold : {0, 1, 20'000, 1'000'000}) {
+    SCOPED_TRACE(fmt::format("threshold: {}", threshold));
+    AssertQueryBuilder(groupByPlan, duckDbQueryRunner_)
+        .config(QueryConfig::kDistinctAggregationDedupThreshold, threshold)
+        .maxDrivers(1)
+        .assertResults(
+            "SELECT c0, count(distinct c1), sum(distinct c1), "
+            "count(distinct c2) FROM tmp GROUP BY 1");
+    AssertQueryBuilder(globalPlan, duckDbQueryRunner_)
+        .config(QueryConfig::kDistinctAggregationDedupThreshold, threshold)
+        .maxDrivers(1)
+        .assertResults(
+            "SELECT count(distinct c1), max(distinct c2) FROM tmp");
+  }
+}
+
+TEST_F(AggregationTest, clusteredInputDetection) {
+  auto makeVectors = [&](auto keyAt) {
+    std::vector<RowVectorPtr> vectors;
+    for (auto i = 0; i < 10; ++i) {
+      vectors.push_back(makeRowVector({
+          makeFlatVector<int64_t>(
+              1'000, [&](auto row) { return keyAt(i * 1'000 + row); }),
+          makeFlatVector<int64_t>(1'000, [](auto row) { return row; }),
+      }));
+    }
+    return vectors;
+  };
+
+  // Groups of 10 consecutive rows, some of which span two batches, and the
+  // same keys in round robin order.
+  for (const bool clustered : {true, false}) {
+    SCOPED_TRACE(fmt::format("clustered: {}", clustered));
+    const auto vectors = makeVectors([&](auto row) -> int64_t {
+      return clustered ? (row + 5) / 10 : row % 1'000;
+    });
+    createDuckDbTable(vectors);
+
+    core::PlanNodeId partialId;
+    const auto plan = PlanBuilder()
+                          .values(vectors)
+                          .partialAggregation({"c0"}, {"sum(c1)", "count(1)"})
+                          .capturePlanNodeId(partialId)
+                          .finalAggregation()
+                          .planNode();
+    auto task =
+        AssertQueryBuilder(plan, duckDbQueryRunner_)
+            .config(QueryConfig::kAggregationClusteredInputDetectionRows, 2'000)
+            .maxDrivers(1)
+            .assertResults("SELECT c0, sum(c1), count(1) FROM tmp GROUP BY 1");
+    const auto runtimeStats =
+        toPlanStats(task->taskStats()).at(partialId).customStats;
+    EXPECT_EQ(
+        clustered, runtimeStats.count(GroupingSet::kStreamingClusteredInput));
+    if (clustered) {
+      // Groups are emitted as batches complete them.
+      EXPECT_LT(
+          1, toPlanStats(task->taskStats()).at(partialId).outputVectors);
+    }
+  }
+}
+
+TEST_F(AggregationTest, constantKeys) {
+  // Each batch has constant keys, like the partition keys of a split.
+  std::vector<RowVectorPtr> vectors;
+  for (auto i = 0; i < 10; ++i) {
+    vectors.push_back(makeRowVector({
+        makeConstant<int64_t>(i % 3, 1'000),
+        makeConstant<std::string>(fmt::format("p{}", i % 2), 1'000),
+        makeFlatVector<int64_t>(1'000, [](auto row) { return row; }),
+    }));
+  }
+  createDuckDbTable(vectors);
+
+  core::PlanNodeId aggregationId;
+  const auto plan =
+      PlanBuilder()
+          .values(vectors)
+          .singleAggregation({"c0", "c1"}, {"sum(c2)", "count(1)"})
+          .capturePlanNodeId(aggregationId)
+          .planNode();
+  auto task =
+      AssertQueryBuilder(plan, duckDbQueryRunner_)
+          .maxDrivers(1)
+          .assertResults(
+              "SELECT c0, c1, sum(c2), count(1) FROM tmp GROUP BY 1, 2");
+  const auto runtimeStats =
+      toPlanStats(task->taskStats()).at(aggregationId).customStats;
+  EXPECT_EQ(10'000, runtimeStats.at(GroupingSet::kConstantKeyRows).sum);
+}
+
 TEST_F(AggregationTest, largeValueRangeArray) {
   // We have keys that map to integer range. The keys are
   // a little under max array hash table size apart. This wastes 16MB of
@@ -1413,6 +1624,57 @@ TEST_F(AggregationTest, groupingSets) {
       "SELECT k1, k2, count(1), sum(a), max(b) FROM tmp GROUP BY ROLLUP (k1, k2)");
 }
 
+TEST_F(AggregationTest, groupingSetsAggregation) {
+  vector_size_t size = 1'000;
+  auto data = makeRowVector(
+      {"k1", "k2", "a", "b"},
+      {
+          makeFlatVector<int64_t>(size, [](auto row) { return row % 11; }),
+          makeFlatVector<int64_t>(size, [](auto row) { return row % 17; }),
+          makeFlatVector<int64_t>(size, [](auto row) { return row; }),
+          makeFlatVector<std::string>(
+              size, [](auto row) { return std::string(row % 12, 'x'); }),
+      });
+
+  createDuckDbTable({data});
+
+  struct {
+    std::vector<std::vector<std::string>> groupingSets;
+    std::string groupBy;
+  } testSettings[] = {
+      {{{"k1", "k2"}, {"k1"}, {"k2"}, {}}, "CUBE (k1, k2)"},
+      {{{"k1", "k2"}, {"k1"}, {}}, "ROLLUP (k1, k2)"},
+      {{{"k1"}, {"k2"}}, "GROUPING SETS ((k1), (k2))"}};
+  for (const auto& testData : testSettings) {
+    SCOPED_TRACE(testData.groupBy);
+    auto plan =
+        PlanBuilder()
+            .values({data})
+            .groupingSetsAggregation(
+                {"k1", "k2"},
+                testData.groupingSets,
+                {"count(1) as count_1", "sum(a) as sum_a", "max(b) as max_b"})
+            .project({"k1", "k2", "count_1", "sum_a", "max_b"})
+            .planNode();
+
+    auto task = assertQuery(
+        plan,
+        fmt::format(
+            "SELECT k1, k2, count(1), sum(a), max(b) FROM tmp GROUP BY {}",
+            testData.groupBy));
+
+    // GroupId replicates one row per distinct (k1, k2) instead of one row per
+    // input row.
+    const auto& groupIdNode = plan->sources()[0]->sources()[0];
+    ASSERT_EQ(groupIdNode->name(), "GroupId");
+    const auto planStats = toPlanStats(task->taskStats());
+    ASSERT_EQ(planStats.at(groupIdNode->id()).inputRows, 11 * 17);
+    ASSERT_EQ(
+        planStats.at(groupIdNode->id()).outputRows,
+        11 * 17 * testData.groupingSets.size());
+  }
+}
+
 TEST_F(AggregationTest, groupingSetsOutput) {
   vector_size_t size = 1'000;
   auto data = makeRowVector(
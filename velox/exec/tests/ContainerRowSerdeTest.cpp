@@ -693,5 +693,89 @@ TEST_F(ContainerRowSerdeTest, rowOfCustomComparison) {
               test::BIGINT_TYPE_WITH_CUSTOM_COMPARISON())}));
 }
 
+TEST_F(ContainerRowSerdeTest, fixedWidth) {
+  auto testFixedWidth = [&](const VectorPtr& data) {
+    SCOPED_TRACE(data->type()->toString());
+    ASSERT_TRUE(ContainerRowSerde::isFixedWidthComplexType(*data->type()));
+    std::vector<HashStringAllocator::Position> positions;
+    std::vector<std::string_view> values;
+    exec::ContainerRowSerdeOptions options{.isKey = true};
+    for (auto i = 0; i < data->size(); ++i) {
+      ByteOutputStream out(&allocator_);
+      auto position = allocator_.newWrite(out);
+      ContainerRowSerde::serialize(*data, i, out, options);
+      allocator_.finishWrite(out, 0);
+      positions.push_back(position);
+      values.emplace_back(
+          reinterpret_cast<const char*>(position.position), out.size());
+    }
+
+    for (auto i = 0; i < data->size(); ++i) {
+      HashStringAllocator::InputStream in(positions[i].header);
+      ASSERT_EQ(
+          ContainerRowSerde::hash(in, data->type().get()),
+          ContainerRowSerde::hashFixedWidth(values[i].data(), *data->type()));
+      for (auto j = 0; j < data->size(); ++j) {
+        for (auto flags :
+             {CompareFlags{true, true, false},
+              CompareFlags{false, false, false},
+              CompareFlags{true, true, true}}) {
+          HashStringAllocator::InputStream left(positions[i].header);
+          HashStringAllocator::InputStream right(positions[j].header);
+          const auto expected = ContainerRowSerde::compare(
+              left, right, data->type().get(), flags);
+          const auto result = ContainerRowSerde::compareFixedWidth(
+              values[i], values[j], *data->type(), flags);
+          if (flags.equalsOnly) {
+            ASSERT_EQ(expected == 0, result == 0) << i << ", " << j;
+          } else {
+            ASSERT_EQ(expected < 0, result < 0) << i << ", " << j;
+            ASSERT_EQ(expected > 0, result > 0) << i << ", " << j;
+          }
+        }
+      }
+    }
+    allocator_.clear();
+  };
+
+  testFixedWidth(makeNullableArrayVector<int64_t>({
+      {1, 2},
+      {1, 5},
+      {},
+      {1, 3, 5},
+      {1, 2, 3, 4},
+      {1, 2, std::nullopt, 4},
+      {1, std::nullopt, 5},
+      {std::nullopt},
+  }));
+  testFixedWidth(makeNullableArrayVector<double>({
+      {1.0, std::nan("1")},
+      {1.0, std::nan("2")},
+      {-0.0},
+      {0.0},
+  }));
+  testFixedWidth(makeRowVector({
+      makeNullableFlatVector<int32_t>({1, 1, std::nullopt, 2, std::nullopt}),
+      makeNullableFlatVector<double>({0.5, -1.0, 2.0, std::nullopt, 2.0}),
+      makeFlatVector<bool>({true, false, true, false, true}),
+      makeFlatVector<Timestamp>(
+          {Timestamp(1, 0),
+           Timestamp(0, 1),
+           Timestamp(1, 0),
+           Timestamp(5, 5),
+           Timestamp(1, 0)}),
+  }));
+
+  ASSERT_FALSE(ContainerRowSerde::isFixedWidthComplexType(*VARCHAR()));
+  ASSERT_FALSE(
+      ContainerRowSerde::isFixedWidthComplexType(*ARRAY(ARRAY(BIGINT()))));
+  ASSERT_FALSE(
+      ContainerRowSerde::isFixedWidthComplexType(*ROW({BIGINT(), VARCHAR()})));
+  ASSERT_FALSE(ContainerRowSerde::isFixedWidthComplexType(
+      *MAP(BIGINT(), BIGINT())));
+  ASSERT_FALSE(ContainerRowSerde::isFixedWidthComplexType(
+      *ARRAY(test::BIGINT_TYPE_WITH_CUSTOM_COMPARISON())));
+}
+
 } // namespace
 } // namespace facebook::velox::exec
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/DriverScheduler.h"
+#include "velox/common/process/ProcessBase.h"
+#include "velox/exec/tests/utils/AssertQueryBuilder.h"
+#include "velox/exec/tests/utils/OperatorTestBase.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+
+#include <folly/synchronization/Baton.h>
+
+namespace facebook::velox::exec::test {
+namespace {
+
+class DriverSchedulerTest : public OperatorTestBase {
+ protected:
+  static void burnCpu(uint64_t nanos) {
+    const auto start = process::threadCpuNanos();
+    while (process::threadCpuNanos() - start < nanos) {
+    }
+  }
+
+  static std::shared_ptr<core::QueryCtx> makeQueryCtx(
+      DriverScheduler& scheduler,
+      double weight = 1.0) {
+    return core::QueryCtx::create(
+        &scheduler,
+        core::QueryConfig(
+            {{core::QueryConfig::kQuerySchedulingWeight,
+              std::to_string(weight)}}));
+  }
+};
+
+TEST_F(DriverSchedulerTest, runAll) {
+  std::atomic<int32_t> numRuns{0};
+  {
+    DriverScheduler scheduler({.numThreads = 4});
+    ASSERT_EQ(scheduler.numThreads(), 4);
+    for (auto i = 0; i < 10'000; ++i) {
+      scheduler.add([&]() { ++numRuns; });
+    }
+    // Functions added by functions also run before the scheduler is
+    // destroyed.
+    scheduler.add([&]() {
+      for (auto i = 0; i < 100; ++i) {
+        scheduler.add([&]() { ++numRuns; });
+      }
+    });
+  }
+  ASSERT_EQ(numRuns, 10'100);
+}
+
+TEST_F(DriverSchedulerTest, steal) {
+  DriverScheduler scheduler({.numThreads = 4});
+  std::atomic<int32_t> numRuns{0};
+  folly::Baton<> done;
+  // The functions are added to the queue of the thread that runs the first
+  // function. The other threads take them from there.
+  scheduler.add([&]() {
+    for (auto i = 0; i < 100; ++i) {
+      scheduler.add([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if (++numRuns == 100) {
+          done.post();
+        }
+      });
+    }
+  });
+  done.wait();
+  EXPECT_GT(scheduler.stats().numSteals, 0);
+}
+
+TEST_F(DriverSchedulerTest, levels) {
+  DriverScheduler::Options options;
+  options.numThreads = 1;
+  options.levelThresholdNanos = {
+      1'000'000UL, 10'000'000UL, 1'000'000'000UL, 10'000'000'000UL};
+  DriverScheduler scheduler(options);
+  auto first = makeQueryCtx(scheduler);
+  auto second = makeQueryCtx(scheduler);
+  auto weighted = makeQueryCtx(scheduler, 100);
+
+  auto runAndWait = [&](const auto& queryCtx, uint64_t cpuNanos) {
+    folly::Baton<> done;
+    scheduler.add(
+        [&]() {
+          burnCpu(cpuNanos);
+          done.post();
+        },
+        queryCtx);
+    done.wait();
+  };
+
+  ASSERT_EQ(scheduler.level(*first), 0);
+  runAndWait(first, 2'000'000);
+  ASSERT_EQ(scheduler.level(*first), 1);
+  runAndWait(first, 10'000'000);
+  ASSERT_EQ(scheduler.level(*first), 2);
+  runAndWait(first, 20'000'000);
+  ASSERT_EQ(scheduler.level(*first), 2);
+  ASSERT_EQ(scheduler.level(*second), 0);
+
+  // The CPU time of a query is divided by its weight.
+  runAndWait(weighted, 20'000'000);
+  ASSERT_EQ(scheduler.level(*weighted), 0);
+
+  // The queued functions of the second query, which is at level 0, run
+  // before the ones of the first query since level 2 used more CPU time
+  // relative to its share.
+  folly::Baton<> gate;
+  scheduler.add([&]() { gate.wait(); });
+  std::mutex mutex;
+  std::vector<std::string> order;
+  std::atomic<int32_t> numRuns{0};
+  folly::Baton<> done;
+  auto record = [&](const std::string& name) {
+    return [&, name]() {
+      {
+        std::lock_guard<std::mutex> l(mutex);
+        order.push_back(name);
+      }
+      if (++numRuns == 6) {
+        done.post();
+      }
+    };
+  };
+  for (auto i = 0; i < 3; ++i) {
+    scheduler.add(record("first"), first);
+  }
+  for (auto i = 0; i < 3; ++i) {
+    scheduler.add(record("second"), second);
+  }
+  gate.post();
+  done.wait();
+  ASSERT_EQ(
+      order,
+      (std::vector<std::string>{
+          "second", "second", "second", "first", "first", "first"}));
+
+  const auto stats = scheduler.stats();
+  EXPECT_GE(stats.levelCpuNanos[0], 2'000'000);
+  EXPECT_GE(stats.levelCpuNanos[1], 10'000'000);
+  EXPECT_GE(stats.levelCpuNanos[2], 20'000'000);
+}
+
+TEST_F(DriverSchedulerTest, query) {
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(1'000, [](auto row) { return row % 17; }),
+      makeFlatVector<int64_t>(1'000, [](auto row) { return row; }),
+  });
+  auto plan = PlanBuilder()
+                  .values({data}, true)
+                  .partialAggregation({"c0"}, {"sum(c1)"})
+                  .localPartition({"c0"})
+                  .finalAggregation()
+                  .planNode();
+  createDuckDbTable({data});
+
+  DriverScheduler scheduler({.numThreads = 3});
+  for (auto i = 0; i < 3; ++i) {
+    AssertQueryBuilder(plan, duckDbQueryRunner_)
+        .queryCtx(makeQueryCtx(scheduler))
+        .maxDrivers(4)
+        .assertResults("SELECT c0, sum(c1) FROM tmp GROUP BY 1");
+  }
+  EXPECT_GT(scheduler.stats().numRuns, 0);
+}
+
+TEST_F(DriverSchedulerTest, pinThreads) {
+  DriverScheduler scheduler({.numThreads = 4, .pinThreads = true});
+  ASSERT_GE(scheduler.numCacheDomains(), 1);
+  ASSERT_LE(scheduler.numCacheDomains(), 4);
+
+  // A bound thread stays on its CPU.
+  std::atomic<int32_t> numMoved{0};
+  std::atomic<int32_t> numRuns{0};
+  folly::Baton<> done;
+  auto queryCtx = makeQueryCtx(scheduler);
+  for (auto i = 0; i < 20; ++i) {
+    scheduler.add(
+        [&]() {
+          const auto cpu = process::currentCpu();
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+          if (cpu != process::currentCpu()) {
+            ++numMoved;
+          }
+          if (++numRuns == 20) {
+            done.post();
+          }
+        },
+        queryCtx);
+  }
+  done.wait();
+  EXPECT_EQ(numMoved, 0);
+
+  // Each query is placed in one of the cache domains.
+  const auto domain = scheduler.cacheDomain(*queryCtx);
+  EXPECT_GE(domain, 0);
+  EXPECT_LT(domain, scheduler.numCacheDomains());
+  EXPECT_EQ(scheduler.cacheDomain(*makeQueryCtx(scheduler)), -1);
+  const auto stats = scheduler.stats();
+  EXPECT_LE(stats.numRemoteSteals, stats.numSteals);
+  EXPECT_LE(stats.numRemoteNodeSteals, stats.numRemoteSteals);
+
+  // The cache domains are on the NUMA nodes the allocator places memory on.
+  const auto cpuNodes = process::cpuNumaNodes();
+  for (auto i = 0; i < scheduler.numCacheDomains(); ++i) {
+    EXPECT_GE(scheduler.numaNode(i), 0);
+    if (cpuNodes.empty()) {
+      EXPECT_EQ(scheduler.numaNode(i), 0);
+    }
+  }
+}
+
+} // namespace
+} // namespace facebook::velox::exec::test
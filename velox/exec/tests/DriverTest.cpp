@@ -1181,6 +1181,61 @@ TEST_F(DriverTest, enableOperatorBatchSizeStatsConfig) {
   EXPECT_GT(operatorStats[1].outputBytes, 0);
 }
 
+TEST_F(DriverTest, enableOperatorEncodingStatsConfig) {
+  constexpr vector_size_t kSize = 100;
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(kSize, [](auto row) { return row; }),
+      BaseVector::wrapInDictionary(
+          nullptr,
+          makeIndicesInReverse(kSize),
+          kSize,
+          makeFlatVector<int64_t>(kSize, [](auto row) { return row; })),
+      makeNullConstant(TypeKind::BIGINT, kSize),
+  });
+  core::PlanNodeId valuesId;
+  core::PlanNodeId projectId;
+  const auto plan = PlanBuilder()
+                        .values({data, data})
+                        .capturePlanNodeId(valuesId)
+                        .project({"c0 + 1", "c1", "c2"})
+                        .capturePlanNodeId(projectId)
+                        .planNode();
+
+  for (const bool enabled : {false, true}) {
+    SCOPED_TRACE(fmt::format("enabled: {}", enabled));
+    std::shared_ptr<Task> task;
+    AssertQueryBuilder(plan)
+        .config(
+            core::QueryConfig::kEnableOperatorEncodingStats,
+            enabled ? "true" : "false")
+        .copyResults(pool(), task);
+    const auto planStats = toPlanStats(task->taskStats());
+    const auto& valuesStats = planStats.at(valuesId).customStats;
+    const auto& projectStats = planStats.at(projectId).customStats;
+    if (!enabled) {
+      ASSERT_EQ(valuesStats.count("outputBatchRows"), 0);
+      ASSERT_EQ(projectStats.count("inputBatchRows"), 0);
+      continue;
+    }
+
+    ASSERT_EQ(valuesStats.at("outputBatchRows").count, 2);
+    ASSERT_EQ(valuesStats.at("outputBatchRows").sum, 2 * kSize);
+    ASSERT_EQ(valuesStats.at("outputFlatColumns").sum, 2);
+    ASSERT_EQ(valuesStats.at("outputDictionaryColumns").sum, 2);
+    ASSERT_EQ(valuesStats.at("outputConstantColumns").sum, 2);
+    ASSERT_EQ(valuesStats.count("outputLazyColumns"), 0);
+    ASSERT_EQ(valuesStats.count("outputOtherColumns"), 0);
+    ASSERT_EQ(valuesStats.at("outputNullPct").max, 33);
+
+    // The identity projections keep the dictionary and constant encodings.
+    ASSERT_EQ(projectStats.at("inputBatchRows").sum, 2 * kSize);
+    ASSERT_EQ(projectStats.at("inputDictionaryColumns").sum, 2);
+    ASSERT_EQ(projectStats.at("outputFlatColumns").sum, 2);
+    ASSERT_EQ(projectStats.at("outputDictionaryColumns").sum, 2);
+    ASSERT_EQ(projectStats.at("outputConstantColumns").sum, 2);
+  }
+}
+
 DEBUG_ONLY_TEST_F(DriverTest, driverSuspensionRaceWithTaskPause) {
   struct {
     int numDrivers;
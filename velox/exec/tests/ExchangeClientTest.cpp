@@ -283,6 +283,60 @@ TEST_P(ExchangeClientTest, flowControl) {
   client->close();
 }
 
+TEST_P(ExchangeClientTest, adaptiveFlowControl) {
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(10'000, [](auto row) { return row; }),
+  });
+
+  auto page = test::toSerializedPage(data, serdeKind_, bufferManager_, pool());
+
+  auto client = std::make_shared<ExchangeClient>(
+      "adaptive.flow.control",
+      17,
+      page->size() * 3.5,
+      1,
+      1024,
+      pool(),
+      executor(),
+      10,
+      /*adaptiveFlowControl=*/true);
+
+  std::vector<std::shared_ptr<Task>> tasks;
+  for (auto i = 0; i < 10; ++i) {
+    auto taskId = fmt::format("local://t{}", i);
+    auto task = makeTask(taskId);
+
+    bufferManager_->initializeTask(
+        task, core::PartitionedOutputNode::Kind::kPartitioned, 100, 16);
+
+    for (auto j = 0; j < 3; ++j) {
+      enqueue(taskId, 17, data);
+    }
+
+    tasks.push_back(task);
+    client->addRemoteTaskId(taskId);
+  }
+
+  fetchPages(1, *client, 3 * tasks.size());
+
+  const auto stats = client->stats();
+  EXPECT_LE(stats.at("peakBytes").sum, page->size() * 4);
+  EXPECT_EQ(30, stats.at("numReceivedPages").sum);
+  // Each source has returned data at least once.
+  EXPECT_EQ(
+      tasks.size(), stats.at(ExchangeClient::kSourceBytesPerSec).count);
+  EXPECT_GT(stats.at(ExchangeClient::kSourceBytesPerSec).min, 0);
+  EXPECT_EQ(1, stats.count(ExchangeClient::kDrainBytesPerSec));
+  EXPECT_EQ(1, stats.count(ExchangeClient::kNumCreditLimitedRequests));
+
+  for (auto& task : tasks) {
+    task->requestCancel();
+    bufferManager_->removeTask(task->taskId());
+  }
+
+  client->close();
+}
+
 // Test that small pages will block and we will keep
 // requesting from the queue if we do not have enough buffer
 // to fillout minOutputBatchBytes
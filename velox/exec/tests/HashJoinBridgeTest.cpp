@@ -621,14 +621,16 @@ TEST_P(HashJoinBridgeTest, hashJoinTableType) {
     RowTypePtr buildKeyType;
     RowTypePtr probeSourceType;
     RowTypePtr buildSourceType;
+    bool hasFilter{true};
     std::string debugString() const {
       return fmt::format(
-          "joinType {} probeKeyType {} buildKeyType {} probeSourceType {} buildSourceType {}",
+          "joinType {} probeKeyType {} buildKeyType {} probeSourceType {} buildSourceType {} hasFilter {}",
           joinType,
           probeKeyType->toString(),
           buildKeyType->toString(),
           buildSourceType->toString(),
-          probeSourceType->toString());
+          probeSourceType->toString(),
+          hasFilter);
     }
   };
   std::vector<TestSetting> testSettings{
@@ -646,7 +648,30 @@ TEST_P(HashJoinBridgeTest, hashJoinTableType) {
        ROW({"p1"}, {BIGINT()}),
        ROW({"b1"}, {BIGINT()}),
        ROW({"p0", "p1"}, {BIGINT(), BIGINT()}),
-       ROW({"b0", "b1"}, {BIGINT(), BIGINT()})}};
+       ROW({"b0", "b1"}, {BIGINT(), BIGINT()})},
+      {core::JoinType::kLeftSemiFilter,
+       ROW({"p1"}, {BIGINT()}),
+       ROW({"b1"}, {BIGINT()}),
+       ROW({"p0", "p1"}, {BIGINT(), BIGINT()}),
+       ROW({"b0", "b1"}, {BIGINT(), BIGINT()})},
+      {core::JoinType::kLeftSemiFilter,
+       ROW({"p1"}, {BIGINT()}),
+       ROW({"b1"}, {BIGINT()}),
+       ROW({"p0", "p1"}, {BIGINT(), BIGINT()}),
+       ROW({"b0", "b1"}, {BIGINT(), BIGINT()}),
+       false},
+      {core::JoinType::kAnti,
+       ROW({"p1", "p0"}, {BIGINT(), BIGINT()}),
+       ROW({"b1", "b0"}, {BIGINT(), BIGINT()}),
+       ROW({"p0", "p1", "p2"}, {BIGINT(), BIGINT(), BIGINT()}),
+       ROW({"b0", "b1", "b2"}, {BIGINT(), BIGINT(), BIGINT()}),
+       false},
+      {core::JoinType::kRightSemiFilter,
+       ROW({"p1"}, {BIGINT()}),
+       ROW({"b1"}, {BIGINT()}),
+       ROW({"p0", "p1"}, {BIGINT(), BIGINT()}),
+       ROW({"b0", "b1"}, {BIGINT(), BIGINT()}),
+       false}};
   for (const auto& testData : testSettings) {
     SCOPED_TRACE(testData.debugString());
     const auto emptyBuildVector = {std::make_shared<RowVector>(
@@ -683,13 +708,19 @@ TEST_P(HashJoinBridgeTest, hashJoinTableType) {
         false,
         probeKeys,
         buildKeys,
-        filter,
+        testData.hasFilter ? filter : nullptr,
         probeValueNode,
         buildValueNode,
         ROW({}));
 
     auto tableType = hashJoinTableType(joinNode);
-    ASSERT_EQ(tableType->size(), testData.buildSourceType->size());
+    const bool keyOnly = !testData.hasFilter &&
+        testData.joinType != core::JoinType::kRightSemiFilter;
+    ASSERT_EQ(isHashJoinKeyOnly(*joinNode), keyOnly);
+    ASSERT_EQ(
+        tableType->size(),
+        keyOnly ? testData.buildKeyType->size()
+                : testData.buildSourceType->size());
     for (uint32_t i = 0; i < buildKeys.size(); i++) {
       ASSERT_EQ(tableType->childAt(i), testData.buildKeyType->childAt(i));
     }
@@ -24,6 +24,8 @@
 #include "velox/exec/Cursor.h"
 #include "velox/exec/HashBuild.h"
 #include "velox/exec/HashJoinBridge.h"
+#include "velox/exec/HashTableCache.h"
+#include "velox/exec/ReservationHistory.h"
 #include "velox/exec/OperatorUtils.h"
 #include "velox/exec/PlanNodeStats.h"
 #include "velox/exec/tests/utils/ArbitratorTestUtil.h"
@@ -213,6 +215,19 @@ TEST_P(MultiThreadedHashJoinTest, normalizedKeyOverflow) {
       .run();
 }
 
+TEST_P(MultiThreadedHashJoinTest, hashModeProbeWithSpill) {
+  // Complex type keys put the table in kHash mode, so the probe side reuses
+  // the key hashes computed for spill partitioning.
+  HashJoinBuilder(*pool_, duckDbQueryRunner_, driverExecutor_.get())
+      .numDrivers(numDrivers_)
+      .keyTypes({ARRAY(BIGINT()), VARCHAR()})
+      .probeVectors(1600, 5)
+      .buildVectors(1500, 5)
+      .referenceQuery(
+          "SELECT t_k0, t_k1, t_data, u_k0, u_k1, u_data FROM t, u WHERE t_k0 = u_k0 AND t_k1 = u_k1")
+      .run();
+}
+
 DEBUG_ONLY_TEST_P(MultiThreadedHashJoinTest, parallelJoinBuildCheck) {
   std::atomic<bool> isParallelBuild{false};
   SCOPED_TESTVALUE_SET(
@@ -4637,6 +4652,308 @@ TEST_F(HashJoinTest, dynamicFiltersPushDownThroughAgg) {
       .run();
 }
 
+TEST_F(HashJoinTest, bloomFilterPushdown) {
+  // More distinct keys than VectorHasher::kMaxDistinct spread over a wide
+  // range to put the table in hash mode.
+  const int32_t numRowsBuild = 150'000;
+  const int32_t numRowsProbe = 20'000;
+  const int64_t kStride = 1'000'003;
+
+  std::vector<RowVectorPtr> buildVectors{makeRowVector(
+      {"u0", "u1"},
+      {makeFlatVector<int64_t>(
+           numRowsBuild, [&](auto row) { return row * 2 * kStride; }),
+       makeFlatVector<int64_t>(numRowsBuild, folly::identity)})};
+  // Every 10th probe row has a match.
+  std::vector<RowVectorPtr> probeVectors{makeRowVector(
+      {"c0", "c1"},
+      {makeFlatVector<int64_t>(
+           numRowsProbe,
+           [&](auto row) {
+             return row % 10 == 0 ? row * 2 * kStride : row * kStride + 1;
+           }),
+       makeFlatVector<int64_t>(numRowsProbe, folly::identity)})};
+  auto probeFile = TempFilePath::create();
+  writeToFile(probeFile->getPath(), probeVectors);
+
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", buildVectors);
+
+  auto probeType = ROW({"c0", "c1"}, {BIGINT(), BIGINT()});
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto buildSide =
+      PlanBuilder(planNodeIdGenerator).values(buildVectors).planNode();
+
+  core::PlanNodeId scanNodeId;
+  core::PlanNodeId joinNodeId;
+  auto op = PlanBuilder(planNodeIdGenerator, pool_.get())
+                .tableScan(probeType)
+                .capturePlanNodeId(scanNodeId)
+                .hashJoin(
+                    {"c0"},
+                    {"u0"},
+                    buildSide,
+                    "",
+                    {"c0", "c1", "u1"},
+                    core::JoinType::kInner)
+                .capturePlanNodeId(joinNodeId)
+                .planNode();
+  SplitInput splitInput = {
+      {scanNodeId, {Split(makeHiveConnectorSplit(probeFile->getPath()))}}};
+
+  for (bool enableBloomFilter : {false, true}) {
+    SCOPED_TRACE(fmt::format("enableBloomFilter: {}", enableBloomFilter));
+    HashJoinBuilder(*pool_, duckDbQueryRunner_, driverExecutor_.get())
+        .planNode(op)
+        .inputSplits(splitInput)
+        .injectSpill(false)
+        .checkSpillStats(false)
+        .config(
+            core::QueryConfig::kHashProbeBloomFilterPushdownMaxSize,
+            enableBloomFilter ? "1000000" : "0")
+        .referenceQuery("SELECT c0, c1, u1 FROM t, u WHERE c0 = u0")
+        .verifier([&](const std::shared_ptr<Task>& task, bool /*hasSpill*/) {
+          const auto joinIndex = getOperatorIndex(joinNodeId);
+          const auto scanIndex = getOperatorIndex(scanNodeId);
+          if (enableBloomFilter) {
+            ASSERT_EQ(1, getFiltersProduced(task, joinIndex).sum);
+            ASSERT_EQ(1, getFiltersAccepted(task, scanIndex).sum);
+            // The bloom filter is not exact and must not replace the join.
+            ASSERT_EQ(0, getReplacedWithFilterRows(task, joinIndex).sum);
+            ASSERT_LT(getInputPositions(task, joinIndex), numRowsProbe / 2);
+          } else {
+            ASSERT_EQ(0, getFiltersProduced(task, joinIndex).sum);
+            ASSERT_EQ(getInputPositions(task, joinIndex), numRowsProbe);
+          }
+        })
+        .run();
+  }
+}
+
+TEST_F(HashJoinTest, hashTableCache) {
+  std::vector<RowVectorPtr> buildVectors{makeRowVector(
+      {"u0", "u1"},
+      {makeFlatVector<int64_t>(1'000, [](auto row) { return row * 3; }),
+       makeFlatVector<int64_t>(1'000, folly::identity)})};
+  std::vector<RowVectorPtr> probeVectors{makeRowVector(
+      {"c0", "c1"},
+      {makeFlatVector<int64_t>(2'000, folly::identity),
+       makeFlatVector<int64_t>(2'000, folly::identity)})};
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", buildVectors);
+
+  auto makePlan = [&](core::JoinType joinType) {
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    return PlanBuilder(planNodeIdGenerator)
+        .values(probeVectors)
+        .hashJoin(
+            {"c0"},
+            {"u0"},
+            PlanBuilder(planNodeIdGenerator).values(buildVectors).planNode(),
+            "",
+            joinType == core::JoinType::kLeftSemiFilter
+                ? std::vector<std::string>{"c0", "c1"}
+                : std::vector<std::string>{"c0", "c1", "u1"},
+            joinType)
+        .planNode();
+  };
+
+  auto buildStats = [](const std::shared_ptr<Task>& task) {
+    std::pair<int64_t, int64_t> cacheHitsAndInputRows{0, 0};
+    for (auto& pipeline : task->taskStats().pipelineStats) {
+      for (auto& op : pipeline.operatorStats) {
+        if (op.operatorType == "HashBuild") {
+          auto it = op.runtimeStats.find(HashBuild::kHashTableCacheHits);
+          if (it != op.runtimeStats.end()) {
+            cacheHitsAndInputRows.first += it->second.sum;
+          }
+          cacheHitsAndInputRows.second += op.inputPositions;
+        }
+      }
+    }
+    return cacheHitsAndInputRows;
+  };
+
+  auto& cache = HashTableCache::instance();
+  cache.clear();
+  auto innerPlan = makePlan(core::JoinType::kInner);
+  const std::string innerSql = "SELECT c0, c1, u1 FROM t, u WHERE c0 = u0";
+  for (int32_t i = 0; i < 3; ++i) {
+    SCOPED_TRACE(fmt::format("run {}", i));
+    auto task = AssertQueryBuilder(innerPlan, duckDbQueryRunner_)
+                    .maxDrivers(4)
+                    .config(core::QueryConfig::kHashTableCacheKey, "snapshot1")
+                    .assertResults(innerSql);
+    const auto [cacheHits, inputRows] = buildStats(task);
+    if (i == 0) {
+      ASSERT_EQ(cacheHits, 0);
+      ASSERT_EQ(inputRows, 1'000);
+    } else {
+      // The table is reused and the build side input is not read.
+      ASSERT_EQ(cacheHits, 1);
+      ASSERT_EQ(inputRows, 0);
+    }
+    ASSERT_EQ(cache.size(), 1);
+  }
+
+  // A different key or join type does not use the cached table.
+  auto task = AssertQueryBuilder(innerPlan, duckDbQueryRunner_)
+                  .maxDrivers(4)
+                  .config(core::QueryConfig::kHashTableCacheKey, "snapshot2")
+                  .assertResults(innerSql);
+  ASSERT_EQ(buildStats(task).first, 0);
+  task = AssertQueryBuilder(
+             makePlan(core::JoinType::kLeftSemiFilter), duckDbQueryRunner_)
+             .maxDrivers(4)
+             .config(core::QueryConfig::kHashTableCacheKey, "snapshot1")
+             .assertResults(
+                 "SELECT c0, c1 FROM t WHERE c0 IN (SELECT u0 FROM u)");
+  ASSERT_EQ(buildStats(task).first, 0);
+  ASSERT_EQ(cache.size(), 3);
+
+  // Right joins mark the probed rows in the table and are not cached.
+  task = AssertQueryBuilder(
+             makePlan(core::JoinType::kRight), duckDbQueryRunner_)
+             .maxDrivers(4)
+             .config(core::QueryConfig::kHashTableCacheKey, "snapshot1")
+             .assertResults(
+                 "SELECT c0, c1, u1 FROM t RIGHT JOIN u ON c0 = u0");
+  ASSERT_EQ(cache.size(), 3);
+
+  // Tables that are not in use are evicted to stay within the memory limit.
+  ASSERT_GT(cache.usedBytes(), 0);
+  cache.setMaxBytes(0);
+  ASSERT_EQ(cache.size(), 0);
+  cache.setMaxBytes(HashTableCache::kDefaultMaxBytes);
+}
+
+TEST_F(HashJoinTest, reservationHistory) {
+  std::vector<RowVectorPtr> buildVectors;
+  for (auto i = 0; i < 10; ++i) {
+    buildVectors.push_back(makeRowVector(
+        {"u0", "u1"},
+        {makeFlatVector<int64_t>(
+             1'000, [&](auto row) { return i * 1'000 + row; }),
+         makeFlatVector<int64_t>(1'000, [](auto row) { return row; })}));
+  }
+  std::vector<RowVectorPtr> probeVectors{makeRowVector(
+      {"c0"}, {makeFlatVector<int64_t>(2'000, [](auto row) { return row; })})};
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", buildVectors);
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  const auto plan =
+      PlanBuilder(planNodeIdGenerator)
+          .values(probeVectors)
+          .hashJoin(
+              {"c0"},
+              {"u0"},
+              PlanBuilder(planNodeIdGenerator).values(buildVectors).planNode(),
+              "",
+              {"c0", "u1"})
+          .planNode();
+
+  auto& history = ReservationHistory::instance();
+  history.clear();
+  const auto spillDirectory = exec::test::TempDirectoryPath::create();
+  for (int32_t i = 0; i < 2; ++i) {
+    SCOPED_TRACE(fmt::format("run {}", i));
+    auto task =
+        AssertQueryBuilder(plan, duckDbQueryRunner_)
+            .spillDirectory(spillDirectory->getPath())
+            .config(core::QueryConfig::kSpillEnabled, true)
+            .config(core::QueryConfig::kJoinSpillEnabled, true)
+            .config(core::QueryConfig::kOperatorReservationHistoryEnabled, true)
+            .assertResults("SELECT c0, u1 FROM t, u WHERE c0 = u0");
+    auto opStats = toOperatorStats(task->taskStats());
+    auto& runtimeStats = opStats.at("HashBuild").runtimeStats;
+    ASSERT_EQ(history.size(), 1);
+    if (i == 0) {
+      // Nothing to predict from on the first run.
+      ASSERT_EQ(runtimeStats.count(Operator::kPredictedReservationBytes), 0);
+    } else {
+      ASSERT_GT(runtimeStats.at(Operator::kPredictedReservationBytes).sum, 0);
+      ASSERT_EQ(
+          runtimeStats.count(Operator::kReservationPredictionErrorBytes), 1);
+    }
+  }
+
+  // The history follows an increase right away and a decrease halfway.
+  history.record("key", 1'000, false);
+  history.record("key", 3'000, false);
+  ASSERT_EQ(history.predict("key"), 3'000);
+  history.record("key", 1'000, false);
+  ASSERT_EQ(history.predict("key"), 2'000);
+  history.record("key", 1'000, true);
+  ASSERT_EQ(history.predict("key"), 2'000);
+  ASSERT_FALSE(history.predict("other").has_value());
+
+  history.setMaxEntries(0);
+  ASSERT_EQ(history.size(), 0);
+  history.setMaxEntries(ReservationHistory::kDefaultMaxEntries);
+}
+
+DEBUG_ONLY_TEST_F(HashJoinTest, memoryForecast) {
+  std::vector<RowVectorPtr> buildVectors;
+  for (auto i = 0; i < 10; ++i) {
+    buildVectors.push_back(makeRowVector(
+        {"u0", "u1"},
+        {makeFlatVector<int64_t>(
+             1'000, [&](auto row) { return i * 1'000 + row; }),
+         makeFlatVector<int64_t>(1'000, [](auto row) { return row; })}));
+  }
+  std::vector<RowVectorPtr> probeVectors{makeRowVector(
+      {"c0"}, {makeFlatVector<int64_t>(2'000, [](auto row) { return row; })})};
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", buildVectors);
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  const auto plan =
+      PlanBuilder(planNodeIdGenerator)
+          .values(probeVectors)
+          .hashJoin(
+              {"c0"},
+              {"u0"},
+              PlanBuilder(planNodeIdGenerator).values(buildVectors).planNode(),
+              "",
+              {"c0", "u1"})
+          .planNode();
+
+  // Capture the forecast right before the build reserves memory for the
+  // table.
+  std::vector<Task::OperatorMemoryForecast> forecasts;
+  uint64_t projectedPeakBytes{0};
+  SCOPED_TESTVALUE_SET(
+      "facebook::velox::exec::HashBuild::ensureTableFits",
+      std::function<void(HashBuild*)>([&](HashBuild* buildOp) {
+        auto* task = buildOp->operatorCtx()->task().get();
+        forecasts = task->memoryForecast();
+        projectedPeakBytes = task->projectedPeakMemoryBytes();
+      }));
+
+  const auto spillDirectory = exec::test::TempDirectoryPath::create();
+  AssertQueryBuilder(plan, duckDbQueryRunner_)
+      .spillDirectory(spillDirectory->getPath())
+      .config(core::QueryConfig::kSpillEnabled, true)
+      .config(core::QueryConfig::kJoinSpillEnabled, true)
+      .assertResults("SELECT c0, u1 FROM t, u WHERE c0 = u0");
+
+  ASSERT_FALSE(forecasts.empty());
+  bool foundBuild{false};
+  for (const auto& forecast : forecasts) {
+    ASSERT_GE(forecast.projectedPeakBytes, forecast.peakBytes);
+    ASSERT_GE(forecast.peakBytes, forecast.currentBytes);
+    if (forecast.operatorType == "HashBuild") {
+      foundBuild = true;
+      // The table for the 10K rows is not allocated yet but is forecast.
+      ASSERT_GT(forecast.projectedPeakBytes, forecast.peakBytes);
+    }
+  }
+  ASSERT_TRUE(foundBuild);
+  // Taken from a second snapshot that other drivers may have grown since.
+  ASSERT_GT(projectedPeakBytes, 0);
+}
+
 TEST_F(HashJoinTest, noDynamicFiltersPushDownThroughRightJoin) {
   std::vector<RowVectorPtr> innerBuild = {makeRowVector(
       {"a"},
@@ -4821,6 +5138,54 @@ TEST_F(HashJoinTest, spillFileSize) {
   }
 }
 
+TEST_F(HashJoinTest, spillInputKeyHashFilter) {
+  // Only a tenth of the probe keys match, so most of the probe rows of the
+  // spilled partitions are dropped instead of spilled.
+  std::vector<RowVectorPtr> probeVectors;
+  std::vector<RowVectorPtr> buildVectors;
+  for (auto i = 0; i < 5; ++i) {
+    probeVectors.push_back(makeRowVector(
+        {"t_k0", "t_data"},
+        {makeFlatVector<int64_t>(
+             1'000, [&](auto row) { return i * 1'000 + row; }),
+         makeFlatVector<int64_t>(1'000, [](auto row) { return row; })}));
+    buildVectors.push_back(makeRowVector(
+        {"u_k0", "u_data"},
+        {makeFlatVector<int64_t>(
+             100, [&](auto row) { return i * 1'000 + row; }),
+         makeFlatVector<int64_t>(100, [](auto row) { return row; })}));
+  }
+
+  for (const bool filterEnabled : {false, true}) {
+    SCOPED_TRACE(fmt::format("filterEnabled: {}", filterEnabled));
+    HashJoinBuilder(*pool_, duckDbQueryRunner_, driverExecutor_.get())
+        .numDrivers(numDrivers_)
+        .keyTypes({BIGINT()})
+        .probeVectors(std::vector<RowVectorPtr>(probeVectors))
+        .buildVectors(std::vector<RowVectorPtr>(buildVectors))
+        .referenceQuery(
+            "SELECT t_k0, t_data, u_k0, u_data FROM t, u WHERE t.t_k0 = u.u_k0")
+        .config(
+            core::QueryConfig::kHashProbeSpillInputFilterEnabled,
+            filterEnabled ? "true" : "false")
+        .maxSpillLevel(0)
+        .verifier([&](const std::shared_ptr<Task>& task, bool hasSpill) {
+          auto opStats = toOperatorStats(task->taskStats());
+          const auto numFilteredRows =
+              opStats.at("HashProbe")
+                  .runtimeStats[HashProbe::kSpillInputFilteredRows]
+                  .sum;
+          if (!hasSpill || !filterEnabled) {
+            ASSERT_EQ(numFilteredRows, 0);
+            return;
+          }
+          ASSERT_GT(numFilteredRows, 0);
+          ASSERT_LE(numFilteredRows, 4'500);
+        })
+        .run();
+  }
+}
+
 TEST_F(HashJoinTest, spillPartitionBitsOverlap) {
   auto builder =
       HashJoinBuilder(*pool_, duckDbQueryRunner_, driverExecutor_.get())
@@ -7792,6 +8157,157 @@ TEST_F(HashJoinTest, nanKeys) {
   facebook::velox::test::assertEqualVectors(expected, result);
 }
 
+TEST_F(HashJoinTest, lazyBuildColumns) {
+  auto probeInput = makeRowVector(
+      {"t0", "t1"},
+      {makeFlatVector<int64_t>(1'000, [](auto row) { return row % 23; }),
+       makeFlatVector<int64_t>(1'000, [](auto row) { return row; })});
+  auto buildInput = makeRowVector(
+      {"u0", "u1", "u2"},
+      {makeFlatVector<int64_t>(100, [](auto row) { return row % 31; }),
+       makeFlatVector<int64_t>(100, [](auto row) { return row * 10; }),
+       makeFlatVector<StringView>(
+           100,
+           [](auto row) {
+             return StringView::makeInline(fmt::format("s{}", row));
+           },
+           nullEvery(7))});
+  createDuckDbTable("t", {probeInput});
+  createDuckDbTable("u", {buildInput});
+
+  for (const auto joinType : {core::JoinType::kInner, core::JoinType::kLeft}) {
+    SCOPED_TRACE(std::string(core::JoinTypeName::toName(joinType)));
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    // The filter after the join loads the build side columns only for a
+    // subset of the joined rows.
+    auto plan = PlanBuilder(planNodeIdGenerator)
+                    .values({probeInput})
+                    .hashJoin(
+                        {"t0"},
+                        {"u0"},
+                        PlanBuilder(planNodeIdGenerator)
+                            .values({buildInput})
+                            .planNode(),
+                        "u1 <> t1",
+                        {"t0", "t1", "u1", "u2"},
+                        joinType)
+                    .filter("t1 % 3 = 0")
+                    .planNode();
+    const auto sql = fmt::format(
+        "SELECT t0, t1, u1, u2 FROM t {} JOIN u ON t0 = u0 AND u1 <> t1 "
+        "WHERE t1 % 3 = 0",
+        joinType == core::JoinType::kInner ? "INNER" : "LEFT");
+    AssertQueryBuilder(plan, duckDbQueryRunner_)
+        .config(core::QueryConfig::kHashProbeLazyBuildColumns, "true")
+        .assertResults(sql);
+  }
+}
+
+TEST_F(HashJoinTest, joinChain) {
+  auto probeInput = makeRowVector(
+      {"t0", "t1", "t2"},
+      {makeFlatVector<int64_t>(1'000, [](auto row) { return row % 23; }),
+       makeFlatVector<int64_t>(1'000, [](auto row) { return row % 17; }),
+       makeFlatVector<int64_t>(1'000, [](auto row) { return row; })});
+  auto firstBuildInput = makeRowVector(
+      {"u0", "u1"},
+      {makeFlatVector<int64_t>(20, [](auto row) { return row; }),
+       makeFlatVector<int64_t>(20, [](auto row) { return row * 10; })});
+  auto secondBuildInput = makeRowVector(
+      {"v0", "v1"},
+      {makeFlatVector<int64_t>(30, [](auto row) { return row % 15; }),
+       makeFlatVector<int64_t>(30, [](auto row) { return row * 100; })});
+  createDuckDbTable("t", {probeInput});
+  createDuckDbTable("u", {firstBuildInput});
+  createDuckDbTable("v", {secondBuildInput});
+
+  // The second join wraps the probe columns produced by the first one.
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto plan =
+      PlanBuilder(planNodeIdGenerator)
+          .values({probeInput})
+          .hashJoin(
+              {"t0"},
+              {"u0"},
+              PlanBuilder(planNodeIdGenerator)
+                  .values({firstBuildInput})
+                  .planNode(),
+              "",
+              {"t1", "t2", "u1"})
+          .hashJoin(
+              {"t1"},
+              {"v0"},
+              PlanBuilder(planNodeIdGenerator)
+                  .values({secondBuildInput})
+                  .planNode(),
+              "",
+              {"t1", "t2", "u1", "v1"},
+              core::JoinType::kLeft)
+          .planNode();
+  for (const auto& batchRows : {"7", "1024"}) {
+    SCOPED_TRACE(batchRows);
+    AssertQueryBuilder(plan, duckDbQueryRunner_)
+        .config(core::QueryConfig::kPreferredOutputBatchRows, batchRows)
+        .config(core::QueryConfig::kMaxOutputBatchRows, batchRows)
+        .assertResults(
+            "SELECT t1, t2, u1, v1 FROM t JOIN u ON t0 = u0 "
+            "LEFT JOIN v ON t1 = v0");
+  }
+}
+
+TEST_F(HashJoinTest, preBuildProbeBuffering) {
+  auto probeInput = makeRowVector(
+      {"t0", "t1"},
+      {makeFlatVector<int64_t>(1'000, [](auto row) { return row % 23; }),
+       makeFlatVector<int64_t>(1'000, [](auto row) { return row; })});
+  std::vector<RowVectorPtr> buildInputs;
+  for (auto i = 0; i < 10; ++i) {
+    buildInputs.push_back(makeRowVector(
+        {"u0", "u1"},
+        {makeFlatVector<int64_t>(100, [](auto row) { return row % 31; }),
+         makeFlatVector<int64_t>(
+             100, [i](auto row) { return i * 100 + row; })}));
+  }
+  createDuckDbTable("t", {probeInput});
+  createDuckDbTable("u", buildInputs);
+
+  const auto makePlan = [&](const std::string& probeFilter,
+                            core::JoinType joinType) {
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    return PlanBuilder(planNodeIdGenerator)
+        .values({probeInput})
+        .filter(probeFilter)
+        .hashJoin(
+            {"t0"},
+            {"u0"},
+            PlanBuilder(planNodeIdGenerator).values(buildInputs).planNode(),
+            "",
+            {"t0", "t1", "u1"},
+            joinType)
+        .planNode();
+  };
+
+  for (const auto joinType : {core::JoinType::kInner, core::JoinType::kLeft}) {
+    SCOPED_TRACE(std::string(core::JoinTypeName::toName(joinType)));
+    const auto joinSql = joinType == core::JoinType::kInner ? "INNER" : "LEFT";
+    for (const auto& bufferBytes : {"1", "1048576"}) {
+      SCOPED_TRACE(bufferBytes);
+      AssertQueryBuilder(makePlan("t1 % 3 = 0", joinType), duckDbQueryRunner_)
+          .config(core::QueryConfig::kHashProbePreBuildBufferBytes, bufferBytes)
+          .assertResults(fmt::format(
+              "SELECT t0, t1, u1 FROM (SELECT * FROM t WHERE t1 % 3 = 0) "
+              "{} JOIN u ON t0 = u0",
+              joinSql));
+
+      // Empty probe side. The build side may be abandoned before it is fully
+      // read.
+      AssertQueryBuilder(makePlan("t1 < 0", joinType), duckDbQueryRunner_)
+          .config(core::QueryConfig::kHashProbePreBuildBufferBytes, bufferBytes)
+          .assertEmptyResults();
+    }
+  }
+}
+
 DEBUG_ONLY_TEST_F(HashJoinTest, spillOnBlockedProbe) {
   auto blockedOperatorFactoryUniquePtr =
       std::make_unique<BlockedOperatorFactory>();
@@ -264,3 +264,34 @@ TEST_F(HashPartitionFunctionTest, noKeyAndBitRange) {
     EXPECT_EQ(singlePartition.value(), 0u);
   }
 }
+
+TEST_F(HashPartitionFunctionTest, constantKeys) {
+  const vector_size_t numRows = 1'000;
+  auto flat = makeRowVector({
+      makeFlatVector<int64_t>(numRows, [](auto /*row*/) { return 17; }),
+      makeFlatVector<std::string>(numRows, [](auto /*row*/) { return "a"; }),
+      makeFlatVector<int64_t>(numRows, [](auto row) { return row; }),
+  });
+  auto constant = makeRowVector({
+      makeConstant<int64_t>(17, numRows),
+      makeConstant<std::string>("a", numRows),
+      flat->childAt(2),
+  });
+  auto rowType = asRowType(flat->type());
+  for (bool localExchange : {false, true}) {
+    SCOPED_TRACE(fmt::format("localExchange: {}", localExchange));
+    HashPartitionFunction function(localExchange, 8, rowType, {0, 1});
+    std::vector<uint32_t> expected(numRows);
+    function.partition(*flat, expected);
+
+    std::vector<uint32_t> partitions;
+    const auto singlePartition = function.partition(*constant, partitions);
+    ASSERT_TRUE(singlePartition.has_value());
+    EXPECT_EQ(singlePartition.value(), expected[0]);
+    EXPECT_EQ(partitions, expected);
+
+    // A non-constant key takes the row by row path.
+    HashPartitionFunction mixed(localExchange, 8, rowType, {0, 2});
+    EXPECT_FALSE(mixed.partition(*constant, partitions).has_value());
+  }
+}
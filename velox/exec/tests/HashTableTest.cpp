@@ -28,6 +28,8 @@
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace facebook::velox;
 using namespace facebook::velox::exec;
@@ -455,6 +457,7 @@ class HashTableTest : public testing::TestWithParam<bool>,
 
   void testProbe() {
     auto lookup = std::make_unique<HashLookup>(topTable_->hashers(), pool());
+    lookup->probePartitionBytes = probePartitionBytes_;
     const auto batchSize = batches_[0]->size();
     SelectivityVector rows(batchSize);
     const auto mode = topTable_->hashMode();
@@ -585,6 +588,8 @@ class HashTableTest : public testing::TestWithParam<bool>,
   // Spacing between consecutive generated keys. Affects whether
   // Vectorhashers make ranges or ids of distinct values.
   int64_t keySpacing_ = 1;
+  // Sets HashLookup::probePartitionBytes for the join probes.
+  uint64_t probePartitionBytes_{0};
   // Base string for varchar fields when making string vector.
   std::string baseString_;
   std::unique_ptr<folly::CPUThreadPoolExecutor> executor_;
@@ -640,6 +645,24 @@ TEST_P(HashTableTest, mixed6Sparse) {
 }
 
 // It should be safe to call clear() before we insert any data into HashTable
+TEST_P(HashTableTest, radixPartitionedNormalizedKeyProbe) {
+  // The table of a few hundred KB is probed in 4KB partitions.
+  probePartitionBytes_ = 4 << 10;
+  auto type = ROW({"k1", "k2"}, {BIGINT(), BIGINT()});
+  keySpacing_ = 1000;
+  insertPct_ = 50;
+  testCycle(BaseHashTable::HashMode::kNormalizedKey, 10000, 2, type, 2);
+}
+
+TEST_P(HashTableTest, radixPartitionedHashProbe) {
+  probePartitionBytes_ = 4 << 10;
+  auto type =
+      ROW({"key"}, {ROW({"k1", "k2", "k3"}, {BIGINT(), VARCHAR(), BIGINT()})});
+  keySpacing_ = 1000;
+  insertPct_ = 50;
+  testCycle(BaseHashTable::HashMode::kHash, 10000, 4, type, 1);
+}
+
 TEST_P(HashTableTest, clearBeforeInsert) {
   std::vector<std::unique_ptr<VectorHasher>> keyHashers;
   keyHashers.push_back(std::make_unique<VectorHasher>(BIGINT(), 0 /*channel*/));
@@ -1006,6 +1029,79 @@ TEST_P(HashTableTest, listNullKeyRows) {
   testListNullKeyRows(keys, BaseHashTable::HashMode::kHash);
 }
 
+TEST_P(HashTableTest, keyShapes) {
+  constexpr int32_t kSize = 1'000;
+  constexpr int32_t kNumDistinct = 300;
+  auto bigints = makeFlatVector<int64_t>(
+      kSize,
+      [](auto row) { return (row % kNumDistinct) * 1'000'000'007LL; },
+      nullEvery(17));
+  // Mixes inlined strings with longer ones of the same size.
+  auto strings = makeFlatVector<std::string>(
+      kSize,
+      [](auto row) {
+        const auto key = row % kNumDistinct;
+        return key % 3 == 0 ? fmt::format("long-string-key-{:04}", key)
+                            : fmt::format("{}", key);
+      },
+      nullEvery(13));
+
+  struct TestParam {
+    std::vector<VectorPtr> keys;
+    BaseHashTable::KeyShape shape;
+  };
+  const std::vector<TestParam> testParams = {
+      {{bigints}, BaseHashTable::KeyShape::kBigint},
+      {{bigints, bigints}, BaseHashTable::KeyShape::kTwoBigints},
+      {{strings}, BaseHashTable::KeyShape::kVarchar},
+      {{bigints, strings}, BaseHashTable::KeyShape::kBigintVarchar},
+      {{strings, bigints}, BaseHashTable::KeyShape::kGeneric},
+      {{bigints, bigints, bigints}, BaseHashTable::KeyShape::kGeneric}};
+  for (const auto& testParam : testParams) {
+    auto input = makeRowVector(testParam.keys);
+    SCOPED_TRACE(input->type()->toString());
+    auto table = createHashTableForAggregation(
+        input->type(), testParam.keys.size());
+    ASSERT_EQ(table->keyShape(), testParam.shape);
+    auto genericTable = createHashTableForAggregation(
+        input->type(), testParam.keys.size());
+    genericTable->testingDisableKeyShape();
+    HashTableTestHelper<false>::create(table.get())
+        .setHashMode(BaseHashTable::HashMode::kHash, kSize);
+    HashTableTestHelper<false>::create(genericTable.get())
+        .setHashMode(BaseHashTable::HashMode::kHash, kSize);
+
+    HashLookup lookup(table->hashers(), pool());
+    insertGroups(*input, lookup, *table);
+    HashLookup genericLookup(genericTable->hashers(), pool());
+    insertGroups(*input, genericLookup, *genericTable);
+    ASSERT_EQ(table->hashMode(), BaseHashTable::HashMode::kHash);
+    ASSERT_EQ(table->numDistinct(), genericTable->numDistinct());
+
+    // Rows in the same group with the specialized comparison are in the same
+    // group with the generic one and the other way around.
+    std::unordered_map<char*, char*> genericGroups;
+    std::unordered_set<char*> seenGenericGroups;
+    for (auto row = 0; row < kSize; ++row) {
+      auto [it, inserted] =
+          genericGroups.emplace(lookup.hits[row], genericLookup.hits[row]);
+      if (inserted) {
+        ASSERT_TRUE(seenGenericGroups.insert(genericLookup.hits[row]).second);
+      } else {
+        ASSERT_EQ(it->second, genericLookup.hits[row]);
+      }
+    }
+
+    // Inserting the same keys again finds the existing groups.
+    std::vector<char*> groups(lookup.hits.begin(), lookup.hits.begin() + kSize);
+    insertGroups(*input, lookup, *table);
+    ASSERT_TRUE(lookup.newGroups.empty());
+    for (auto row = 0; row < kSize; ++row) {
+      ASSERT_EQ(lookup.hits[row], groups[row]);
+    }
+  }
+}
+
 TEST(HashTableTest, modeString) {
   ASSERT_EQ("HASH", BaseHashTable::modeString(BaseHashTable::HashMode::kHash));
   ASSERT_EQ(
@@ -2624,6 +2624,111 @@ TEST_P(IndexLookupJoinTest, tableRowsWithDuplicateKeys) {
       GetParam().numPrefetches,
       "SELECT u.c0, u.c1, u.c2, u.c3, u.c4, u.c5 FROM t, u WHERE t.c0 = u.c0 AND t.c1 = u.c1 AND u.c2 = t.c2");
 }
+
+TEST_P(IndexLookupJoinTest, dedupKeysAndResultCache) {
+  SequenceTableData tableData;
+  generateIndexTableData({20, 1, 1}, tableData, pool_);
+  const auto probeVectors = generateProbeInput(
+      10,
+      128,
+      1,
+      tableData,
+      pool_,
+      {"t0", "t1", "t2"},
+      GetParam().hasNullKeys,
+      {},
+      {},
+      /*equalMatchPct=*/80);
+  std::vector<std::shared_ptr<TempFilePath>> probeFiles =
+      createProbeFiles(probeVectors);
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", {tableData.tableData});
+
+  const auto indexTable = TestIndexTable::create(
+      /*numEqualJoinKeys=*/3, tableData.keyData, tableData.valueData, *pool());
+  const auto indexTableHandle =
+      makeIndexTableHandle(indexTable, GetParam().asyncLookup);
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  const auto indexScanNode = makeIndexScanNode(
+      planNodeIdGenerator,
+      indexTableHandle,
+      makeScanOutputType({"u0", "u1", "u2", "u3", "u5"}),
+      makeIndexColumnHandles({"u0", "u1", "u2", "u3", "u5"}));
+
+  struct {
+    core::JoinType joinType;
+    uint64_t resultCacheBytes;
+    std::string duckDbSql;
+
+    std::string debugString() const {
+      return fmt::format(
+          "joinType {}, resultCacheBytes {}",
+          core::JoinTypeName::toName(joinType),
+          resultCacheBytes);
+    }
+  } testSettings[] = {
+      {core::JoinType::kInner,
+       0,
+       "SELECT u.c3, t.c5 FROM t, u WHERE t.c0 = u.c0 AND t.c1 = u.c1 AND t.c2 = u.c2"},
+      {core::JoinType::kInner,
+       1 << 20,
+       "SELECT u.c3, t.c5 FROM t, u WHERE t.c0 = u.c0 AND t.c1 = u.c1 AND t.c2 = u.c2"},
+      {core::JoinType::kLeft,
+       0,
+       "SELECT u.c3, t.c5 FROM t LEFT JOIN u ON t.c0 = u.c0 AND t.c1 = u.c1 AND t.c2 = u.c2"},
+      {core::JoinType::kLeft,
+       1 << 20,
+       "SELECT u.c3, t.c5 FROM t LEFT JOIN u ON t.c0 = u.c0 AND t.c1 = u.c1 AND t.c2 = u.c2"}};
+  for (const auto& testData : testSettings) {
+    SCOPED_TRACE(testData.debugString());
+    const auto plan = makeLookupPlan(
+        planNodeIdGenerator,
+        indexScanNode,
+        {"t0", "t1", "t2"},
+        {"u0", "u1", "u2"},
+        {},
+        testData.joinType,
+        {"u3", "t5"});
+    auto task =
+        AssertQueryBuilder(duckDbQueryRunner_)
+            .plan(plan)
+            .splits(probeScanNodeId_, makeHiveConnectorSplits(probeFiles))
+            .serialExecution(GetParam().serialExecution)
+            .config(core::QueryConfig::kMaxOutputBatchRows, "32")
+            .config(
+                core::QueryConfig::kIndexLookupJoinMaxPrefetchBatches,
+                std::to_string(GetParam().numPrefetches))
+            .config(core::QueryConfig::kIndexLookupJoinDedupKeys, "true")
+            .config(
+                core::QueryConfig::kIndexLookupJoinResultCacheBytes,
+                std::to_string(testData.resultCacheBytes))
+            .assertResults(testData.duckDbSql);
+
+    const auto runtimeStats =
+        toPlanStats(task->taskStats()).at(joinNodeId_).customStats;
+    const auto numInputRows =
+        runtimeStats.at(IndexLookupJoin::kDedupLookupInputRows).sum;
+    const auto numDistinctRows =
+        runtimeStats.at(IndexLookupJoin::kDedupDistinctLookupRows).sum;
+    const auto numRequestRows =
+        runtimeStats.at(IndexLookupJoin::kDedupLookupRequestRows).sum;
+    ASSERT_LT(numDistinctRows, numInputRows);
+    ASSERT_LE(numRequestRows, numDistinctRows);
+    if (testData.resultCacheBytes == 0) {
+      ASSERT_EQ(numRequestRows, numDistinctRows);
+      ASSERT_EQ(runtimeStats.count(IndexLookupJoin::kResultCacheHits), 0);
+      continue;
+    }
+    const auto numHits = runtimeStats.at(IndexLookupJoin::kResultCacheHits).sum;
+    ASSERT_EQ(
+        numHits + runtimeStats.at(IndexLookupJoin::kResultCacheMisses).sum,
+        numDistinctRows);
+    ASSERT_EQ(numRequestRows, numDistinctRows - numHits);
+    if (GetParam().numPrefetches == 0) {
+      ASSERT_GT(numHits, 0);
+    }
+  }
+}
 } // namespace
 
 VELOX_INSTANTIATE_TEST_SUITE_P(
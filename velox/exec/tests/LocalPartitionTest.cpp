@@ -1077,6 +1077,140 @@ TEST_F(
   thread.join();
 }
 
+TEST_F(LocalPartitionTest, scaledRoundRobin) {
+  std::vector<RowVectorPtr> vectors;
+  for (auto i = 0; i < 100; ++i) {
+    vectors.emplace_back(makeRowVector(
+        {makeFlatVector<int64_t>(100, [i](auto row) { return i + row; })}));
+  }
+  createDuckDbTable(vectors);
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  core::PlanNodeId exchangeId;
+  auto plan =
+      PlanBuilder(planNodeIdGenerator)
+          .localPartitionRoundRobin(
+              {PlanBuilder(planNodeIdGenerator).values(vectors).planNode()})
+          .capturePlanNodeId(exchangeId)
+          .project({"c0 % 10 as c0"})
+          .singleAggregation({"c0"}, {"count(1)"})
+          .planNode();
+
+  for (bool enabled : {false, true}) {
+    SCOPED_TRACE(fmt::format("enabled {}", enabled));
+    // A small buffer fills up quickly to trigger the scale up.
+    auto task =
+        AssertQueryBuilder(duckDbQueryRunner_)
+            .plan(plan)
+            .maxDrivers(4)
+            .config(
+                core::QueryConfig::kLocalExchangeScaledProcessingEnabled,
+                enabled)
+            .config(core::QueryConfig::kMaxLocalExchangeBufferSize, "1024")
+            .assertResults("SELECT c0 % 10, count(1) FROM tmp GROUP BY 1");
+    auto stats = toPlanStats(task->taskStats()).at(exchangeId).customStats;
+    if (!enabled) {
+      ASSERT_EQ(stats.count(LocalExchange::kMaxRunningDrivers), 0);
+      continue;
+    }
+    const auto& maxRunningDrivers = stats.at(LocalExchange::kMaxRunningDrivers);
+    ASSERT_GE(maxRunningDrivers.max, 1);
+    ASSERT_LE(maxRunningDrivers.max, 4);
+  }
+}
+
+TEST_F(LocalPartitionTest, skewedPartitions) {
+  // Key 0 has 30% of the rows.
+  std::vector<RowVectorPtr> vectors;
+  for (auto i = 0; i < 100; ++i) {
+    vectors.emplace_back(makeRowVector({
+        makeFlatVector<int64_t>(
+            1'000, [i](auto row) { return row % 10 < 3 ? 0 : i + row; }),
+        makeFlatVector<int64_t>(1'000, [](auto row) { return row; }),
+    }));
+  }
+  createDuckDbTable(vectors);
+
+  // The intermediate aggregations of the split partitions are merged by the
+  // final aggregation after a second exchange.
+  auto aggregationPlan = PlanBuilder()
+                             .values(vectors, true)
+                             .partialAggregation({"c0"}, {"sum(c1)"})
+                             .localPartition({"c0"})
+                             .intermediateAggregation()
+                             .localPartition({"c0"})
+                             .finalAggregation()
+                             .planNode();
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto joinPlan =
+      PlanBuilder(planNodeIdGenerator)
+          .values(vectors, true)
+          .localPartition({"c0"})
+          .hashJoin(
+              {"c0"},
+              {"u0"},
+              PlanBuilder(planNodeIdGenerator)
+                  .values({makeRowVector(
+                      {"u0"}, {makeFlatVector<int64_t>({0, 5, 50, 500})})})
+                  .planNode(),
+              "",
+              {"c0", "c1"})
+          .planNode();
+
+  for (bool enabled : {false, true}) {
+    SCOPED_TRACE(fmt::format("enabled {}", enabled));
+    // A small buffer fills up quickly and small thresholds trigger the
+    // rebalancing early.
+    auto assertQuery = [&](const core::PlanNodePtr& plan,
+                           const std::string& duckDbSql) {
+      AssertQueryBuilder(duckDbQueryRunner_)
+          .plan(plan)
+          .maxDrivers(4)
+          .config(
+              core::QueryConfig::kLocalExchangeSkewRebalanceEnabled, enabled)
+          .config(core::QueryConfig::kMaxLocalExchangeBufferSize, "1024")
+          .config(
+              core::QueryConfig::
+                  kScaleWriterMinPartitionProcessedBytesRebalanceThreshold,
+              "1")
+          .config(
+              core::QueryConfig::
+                  kScaleWriterMinProcessedBytesRebalanceThreshold,
+              "1")
+          .assertResults(duckDbSql);
+    };
+    assertQuery(aggregationPlan, "SELECT c0, sum(c1) FROM tmp GROUP BY 1");
+    assertQuery(
+        joinPlan, "SELECT c0, c1 FROM tmp WHERE c0 IN (0, 5, 50, 500)");
+  }
+}
+
+TEST_F(LocalPartitionTest, memoryManagerConcurrentUpdates) {
+  auto memoryManager = std::make_shared<LocalExchangeMemoryManager>(1'000);
+  // Each thread adds and removes memory. A thread blocked over the limit must
+  // be woken up by the removals of the other threads.
+  std::vector<std::thread> threads;
+  for (auto i = 0; i < 8; ++i) {
+    threads.emplace_back([&]() {
+      for (auto j = 0; j < 10'000; ++j) {
+        ContinueFuture future;
+        const bool blocked = memoryManager->increaseMemoryUsage(&future, 300);
+        for (auto& promise : memoryManager->decreaseMemoryUsage(300)) {
+          promise.setValue();
+        }
+        if (blocked) {
+          std::move(future).wait();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(memoryManager->bufferedBytes(), 0);
+}
+
 TEST_F(LocalPartitionTest, vectorPool) {
   LocalExchangeVectorPool vectorPool(10);
   std::vector<RowVector*> vectors;
@@ -14,9 +14,12 @@
  * limitations under the License.
  */
 
+#include "velox/common/file/FileSystems.h"
+#include "velox/exec/PlanNodeStats.h"
 #include "velox/exec/tests/utils/AssertQueryBuilder.h"
 #include "velox/exec/tests/utils/OperatorTestBase.h"
 #include "velox/exec/tests/utils/PlanBuilder.h"
+#include "velox/exec/tests/utils/TempDirectoryPath.h"
 
 using namespace facebook::velox;
 using namespace facebook::velox::test;
@@ -141,3 +144,58 @@ TEST_F(MarkDistinctTest, aggregation) {
       .assertResults(
           "SELECT c0, sum(distinct c1), sum(distinct c2) FROM tmp GROUP BY 1");
 }
+
+TEST_F(MarkDistinctTest, spill) {
+  filesystems::registerLocalFileSystem();
+
+  std::vector<RowVectorPtr> vectors;
+  for (int32_t i = 0; i < 8; ++i) {
+    vectors.push_back(makeRowVector({
+        makeFlatVector<int64_t>(1'000, [](auto row) { return row % 17; }),
+        makeFlatVector<int64_t>(
+            1'000, [&](auto row) { return (row + i * 1'000) % 3'001; }),
+    }));
+  }
+  createDuckDbTable(vectors);
+
+  struct {
+    uint32_t spillPartitionBits;
+
+    std::string debugString() const {
+      return fmt::format("spillPartitionBits {}", spillPartitionBits);
+    }
+  } testSettings[] = {{1}, {3}};
+
+  for (const auto& testData : testSettings) {
+    SCOPED_TRACE(testData.debugString());
+    const auto spillDirectory = TempDirectoryPath::create();
+    exec::TestScopedSpillInjection scopedSpillInjection(100, ".*", 1);
+
+    core::PlanNodeId markDistinctPlanNodeId;
+    auto plan = PlanBuilder()
+                    .values(vectors)
+                    .markDistinct("c1_distinct", {"c0", "c1"})
+                    .capturePlanNodeId(markDistinctPlanNodeId)
+                    .singleAggregation(
+                        {"c0"}, {"count(c1)", "sum(c1)"}, {"c1_distinct"})
+                    .planNode();
+    auto task =
+        AssertQueryBuilder(plan, duckDbQueryRunner_)
+            .spillDirectory(spillDirectory->getPath())
+            .config(core::QueryConfig::kSpillEnabled, true)
+            .config(core::QueryConfig::kMarkDistinctSpillEnabled, true)
+            .config(
+                core::QueryConfig::kSpillNumPartitionBits,
+                testData.spillPartitionBits)
+            .assertResults(
+                "SELECT c0, count(distinct c1), sum(distinct c1) FROM tmp GROUP BY 1");
+    const auto planStats = exec::toPlanStats(task->taskStats());
+    const auto& markDistinctStats = planStats.at(markDistinctPlanNodeId);
+    ASSERT_GT(markDistinctStats.spilledBytes, 0);
+    ASSERT_GT(markDistinctStats.spilledRows, 0);
+    ASSERT_GT(markDistinctStats.spilledPartitions, 0);
+
+    task.reset();
+    waitForAllTasksToBeDeleted();
+  }
+}
@@ -16,6 +16,7 @@
 
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/common/testutil/TestValue.h"
+#include "velox/exec/RangePartitionFunction.h"
 #include "velox/exec/tests/utils/AssertQueryBuilder.h"
 #include "velox/exec/tests/utils/HiveConnectorTestBase.h"
 #include "velox/exec/tests/utils/PlanBuilder.h"
@@ -806,6 +807,57 @@ TEST_F(MergeJoinTest, numDrivers) {
   EXPECT_EQ(2, task->numFinishedDrivers());
 }
 
+TEST_F(MergeJoinTest, rangePartitioned) {
+  auto left = makeRowVector(
+      {"t_c0", "t_c1"},
+      {makeFlatVector<int64_t>(10'000, [](auto row) { return row / 3; }),
+       makeFlatVector<int64_t>(10'000, [](auto row) { return row; })});
+  auto right = makeRowVector(
+      {"u_c0", "u_c1"},
+      {makeFlatVector<int64_t>(
+           6'000, [](auto row) { return 1'000 + row / 2; }),
+       makeFlatVector<int64_t>(6'000, [](auto row) { return -row; })});
+  createDuckDbTable("t", {left});
+  createDuckDbTable("u", {right});
+
+  // Splitters are sampled from the keys of both sides.
+  auto splitters = RangePartitionFunctionSpec::makeSplitters(
+      {makeRowVector({left->childAt(0)}), makeRowVector({right->childAt(0)})},
+      {core::kAscNullsLast},
+      4,
+      pool());
+
+  for (auto joinType : {core::JoinType::kInner, core::JoinType::kFull}) {
+    SCOPED_TRACE(std::string(core::JoinTypeName::toName(joinType)));
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    auto plan = PlanBuilder(planNodeIdGenerator)
+                    .values({left})
+                    .localPartitionByRange({"t_c0"}, splitters)
+                    .mergeJoin(
+                        {"t_c0"},
+                        {"u_c0"},
+                        PlanBuilder(planNodeIdGenerator)
+                            .values({right})
+                            .localPartitionByRange({"u_c0"}, splitters)
+                            .planNode(),
+                        "",
+                        {"t_c0", "t_c1", "u_c0", "u_c1"},
+                        joinType)
+                    .planNode();
+
+    auto task = AssertQueryBuilder(plan, duckDbQueryRunner_)
+                    .maxDrivers(4)
+                    .assertResults(fmt::format(
+                        "SELECT t_c0, t_c1, u_c0, u_c1 FROM t {} JOIN u "
+                        "ON t_c0 = u_c0",
+                        joinType == core::JoinType::kInner ? "INNER"
+                                                           : "FULL OUTER"));
+
+    // One driver for each Values and 4 drivers for each side of the join.
+    EXPECT_EQ(10, task->numTotalDrivers());
+  }
+}
+
 TEST_F(MergeJoinTest, lazyVectors) {
   // A dataset of multiple row groups with multiple columns. We create
   // different dictionary wrappings for different columns and load the
@@ -147,18 +147,20 @@ class MergerTest : public OperatorTestBase {
       uint64_t outputBatchSize) const {
     std::vector<std::unique_ptr<SourceStream>> sourceStreams;
     for (const auto& source : sources) {
-      sourceStreams.push_back(std::make_unique<SourceStream>(
-          source.get(), sortingKeys_, outputBatchSize));
+      sourceStreams.push_back(
+          std::make_unique<SourceStream>(source.get(), sortingKeys_));
     }
     return std::make_unique<SourceMerger>(
         inputType_, outputBatchSize, std::move(sourceStreams), pool());
   }
 
-  static std::vector<std::shared_ptr<MergeSource>> createMergeSources(int num) {
+  static std::vector<std::shared_ptr<MergeSource>> createMergeSources(
+      int num,
+      uint32_t queueSize = MergeSource::kDefaultLocalQueueSize) {
     std::vector<std::shared_ptr<MergeSource>> sources;
     sources.reserve(num);
     for (auto i = 0; i < num; ++i) {
-      sources.push_back(MergeSource::createLocalMergeSource());
+      sources.push_back(MergeSource::createLocalMergeSource(queueSize));
     }
     for (const auto& source : sources) {
       source->start();
@@ -365,6 +367,60 @@ TEST_F(MergerTest, sourceMergerWithEmptySources) {
   checkResults(expectedResults, results);
 }
 
+TEST_F(MergerTest, sourceMergerWithRuns) {
+  struct {
+    int32_t runLength;
+    uint32_t queueSize;
+    size_t maxOutputRows;
+
+    std::string debugString() const {
+      return fmt::format(
+          "runLength:{} queueSize:{} maxOutputRows:{}",
+          runLength,
+          queueSize,
+          maxOutputRows);
+    }
+  } testSettings[] = {
+      {1, 1, 7},
+      {1, 4, 1024},
+      {3, 2, 7},
+      {3, 4, 32},
+      {40, 1, 7},
+      {40, 4, 1024},
+      {1000, 2, 32}};
+  constexpr int32_t kNumSources = 5;
+  constexpr int32_t kNumVectors = 6;
+  constexpr vector_size_t kVectorSize = 16;
+  for (const auto& testData : testSettings) {
+    SCOPED_TRACE(testData.debugString());
+    // Each source has runs of 'runLength' consecutive keys that sort between
+    // the runs of the other sources.
+    const auto runLength = testData.runLength;
+    std::vector<std::vector<RowVectorPtr>> inputs(kNumSources);
+    for (auto source = 0; source < kNumSources; ++source) {
+      for (auto i = 0; i < kNumVectors; ++i) {
+        inputs[source].push_back(makeRowVector(
+            {makeFlatVector<int64_t>(
+                 kVectorSize,
+                 [&](auto row) {
+                   const auto index = i * kVectorSize + row;
+                   return (index / runLength) * kNumSources * runLength +
+                       source * runLength + index % runLength;
+                 }),
+             makeFlatVector<int16_t>(
+                 kVectorSize, [](auto row) { return row % 5; })}));
+      }
+    }
+    const auto sources = createMergeSources(kNumSources, testData.queueSize);
+    const auto sourceMerger =
+        createSourceMerger(sources, testData.maxOutputRows);
+    createProducers(kNumSources, inputs, sources);
+    const auto results = getOutputFromSourceMerger(sourceMerger.get());
+    const auto expectedResults = makeExpectedResults(inputs, kVectorSize);
+    checkResults(expectedResults, results);
+  }
+}
+
 TEST_F(MergerTest, spillMerger) {
   struct {
     size_t maxOutputRows;
@@ -15,10 +15,13 @@
  */
 #include "velox/core/PlanNode.h"
 #include "velox/exec/NestedLoopJoinBuild.h"
+#include "velox/exec/NestedLoopJoinProbe.h"
+#include "velox/exec/PlanNodeStats.h"
 #include "velox/exec/tests/utils/AssertQueryBuilder.h"
 #include "velox/exec/tests/utils/HiveConnectorTestBase.h"
 #include "velox/exec/tests/utils/PlanBuilder.h"
 #include "velox/exec/tests/utils/VectorTestUtil.h"
+#include "velox/functions/prestosql/types/GeometryType.h"
 #include "velox/vector/fuzzer/VectorFuzzer.h"
 
 namespace facebook::velox::exec::test {
@@ -730,5 +733,255 @@ TEST_F(NestedLoopJoinTest, mergeBuildVectorsOverflow) {
   ASSERT_EQ(mergeResult.size(), 2);
 }
 
+TEST_F(NestedLoopJoinTest, bandConditions) {
+  const auto probeType = ROW({"t0", "t1"}, {BIGINT(), VARCHAR()});
+  const auto buildType = ROW({"u0", "u1"}, {BIGINT(), BIGINT()});
+  auto extract = [&](const std::string& condition) {
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    auto plan = PlanBuilder(planNodeIdGenerator)
+                    .tableScan(probeType)
+                    .nestedLoopJoin(
+                        PlanBuilder(planNodeIdGenerator)
+                            .tableScan(buildType)
+                            .planNode(),
+                        condition,
+                        {"t0", "u0"})
+                    .planNode();
+    return extractNestedLoopJoinBandConditions(
+        std::dynamic_pointer_cast<const core::NestedLoopJoinNode>(plan)
+            ->joinCondition(),
+        probeType,
+        buildType);
+  };
+
+  auto conditions = extract("t0 BETWEEN u0 AND u1");
+  ASSERT_EQ(conditions.size(), 2);
+  ASSERT_EQ(conditions[0].probeChannel, 0);
+  ASSERT_EQ(conditions[0].buildChannel, 0);
+  ASSERT_FALSE(conditions[0].buildIsUpperBound);
+  ASSERT_EQ(conditions[1].buildChannel, 1);
+  ASSERT_TRUE(conditions[1].buildIsUpperBound);
+
+  conditions = extract("u1 > t0 AND t1 <> 'a' AND t0 + 1 < u0");
+  ASSERT_EQ(conditions.size(), 1);
+  ASSERT_EQ(conditions[0].buildChannel, 1);
+  ASSERT_TRUE(conditions[0].buildIsUpperBound);
+
+  ASSERT_TRUE(extract("t0 < u0 OR t0 > u1").empty());
+  ASSERT_TRUE(extract("u0 < u1").empty());
+}
+
+TEST_F(NestedLoopJoinTest, bandJoin) {
+  const vector_size_t kNumProbeRows = 1'000;
+  const vector_size_t kNumBuildRows = 300;
+  std::vector<RowVectorPtr> probeVectors;
+  for (auto i = 0; i < 4; ++i) {
+    probeVectors.push_back(makeRowVector(
+        {"t0", "t1"},
+        {makeFlatVector<int64_t>(
+             kNumProbeRows / 4,
+             [&](auto row) { return (row * 7 + i * 13) % kNumProbeRows; },
+             nullEvery(17)),
+         makeFlatVector<Timestamp>(kNumProbeRows / 4, [&](auto row) {
+           return Timestamp(row * 11 % 500, row * 1'000);
+         })}));
+  }
+  std::vector<RowVectorPtr> buildVectors;
+  for (auto i = 0; i < 3; ++i) {
+    buildVectors.push_back(makeRowVector(
+        {"u0", "u1", "u2"},
+        {makeFlatVector<int64_t>(
+             kNumBuildRows / 3,
+             [&](auto row) { return (row * 31 + i * 101) % kNumProbeRows; },
+             nullEvery(23)),
+         makeFlatVector<int64_t>(
+             kNumBuildRows / 3,
+             [&](auto row) {
+               return (row * 31 + i * 101) % kNumProbeRows + row % 10;
+             }),
+         makeFlatVector<Timestamp>(kNumBuildRows / 3, [&](auto row) {
+           return Timestamp(row * 13 % 500, 0);
+         })}));
+  }
+
+  for (const auto& condition :
+       {"t0 BETWEEN u0 AND u1", "t0 >= u0 AND t0 < u1 AND t1 > u2"}) {
+    for (const auto joinType :
+         {core::JoinType::kInner,
+          core::JoinType::kLeft,
+          core::JoinType::kRight,
+          core::JoinType::kFull,
+          core::JoinType::kLeftSemiProject}) {
+      SCOPED_TRACE(fmt::format(
+          "{} {}", condition, core::JoinTypeName::toName(joinType)));
+      const std::vector<std::string> outputLayout =
+          joinType == core::JoinType::kLeftSemiProject
+          ? std::vector<std::string>{"t0", "match"}
+          : std::vector<std::string>{"t0", "u0", "u1"};
+      core::PlanNodeId joinNodeId;
+      auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+      auto plan = PlanBuilder(planNodeIdGenerator)
+                      .values(probeVectors)
+                      .nestedLoopJoin(
+                          PlanBuilder(planNodeIdGenerator)
+                              .values(buildVectors)
+                              .planNode(),
+                          condition,
+                          outputLayout,
+                          joinType)
+                      .capturePlanNodeId(joinNodeId)
+                      .planNode();
+
+      auto expected = AssertQueryBuilder(plan).copyResults(pool());
+      std::shared_ptr<Task> task;
+      auto result =
+          AssertQueryBuilder(plan)
+              .config(core::QueryConfig::kNestedLoopJoinBandBlockRows, "16")
+              .copyResults(pool(), task);
+      assertEqualResults({expected}, {result});
+
+      const auto stats = toPlanStats(task->taskStats()).at(joinNodeId);
+      ASSERT_GT(
+          stats.customStats
+              .at(NestedLoopJoinProbe::kNumBandSkippedBuildVectors)
+              .sum,
+          0);
+    }
+  }
+}
+
+TEST_F(NestedLoopJoinTest, spatialConditions) {
+  const auto probeType = ROW({"t0", "t1"}, {GEOMETRY(), BIGINT()});
+  const auto buildType = ROW({"u0", "u1"}, {GEOMETRY(), GEOMETRY()});
+  auto extract = [&](const std::string& condition) {
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    auto plan = PlanBuilder(planNodeIdGenerator)
+                    .tableScan(probeType)
+                    .nestedLoopJoin(
+                        PlanBuilder(planNodeIdGenerator)
+                            .tableScan(buildType)
+                            .planNode(),
+                        condition,
+                        {"t1"})
+                    .planNode();
+    return extractNestedLoopJoinSpatialCondition(
+        std::dynamic_pointer_cast<const core::NestedLoopJoinNode>(plan)
+            ->joinCondition(),
+        probeType,
+        buildType);
+  };
+
+  auto condition = extract("ST_Contains(u1, t0)");
+  ASSERT_TRUE(condition.has_value());
+  ASSERT_EQ(condition->probeChannel, 0);
+  ASSERT_EQ(condition->buildChannel, 1);
+  ASSERT_EQ(condition->envelopeFunctions.size(), 4);
+
+  condition = extract("t1 > 10 AND ST_Intersects(t0, u0)");
+  ASSERT_TRUE(condition.has_value());
+  ASSERT_EQ(condition->probeChannel, 0);
+  ASSERT_EQ(condition->buildChannel, 0);
+
+  ASSERT_FALSE(extract("ST_Contains(u0, u1)").has_value());
+  ASSERT_FALSE(extract("NOT ST_Contains(u0, t0)").has_value());
+  ASSERT_FALSE(extract("ST_Contains(u0, t0) OR t1 > 10").has_value());
+  ASSERT_FALSE(extract("ST_Equals(u0, t0)").has_value());
+}
+
+TEST_F(NestedLoopJoinTest, spatialJoin) {
+  const vector_size_t kNumProbeRows = 1'000;
+  const vector_size_t kNumBuildRows = 300;
+  std::vector<RowVectorPtr> probeVectors;
+  for (auto i = 0; i < 4; ++i) {
+    probeVectors.push_back(makeRowVector(
+        {"x", "y"},
+        {makeFlatVector<double>(
+             kNumProbeRows / 4,
+             [&](auto row) { return (row * 7 + i * 13) % 100 + 0.5; },
+             nullEvery(17)),
+         makeFlatVector<double>(kNumProbeRows / 4, [&](auto row) {
+           return (row * 11 + i) % 100 + 0.5;
+         })}));
+  }
+  // Squares of side 1 to 5 at points of a 100 x 100 grid, and some empty
+  // polygons.
+  std::vector<RowVectorPtr> buildVectors;
+  for (auto i = 0; i < 3; ++i) {
+    buildVectors.push_back(makeRowVector(
+        {"id", "wkt"},
+        {makeFlatVector<int64_t>(
+             kNumBuildRows / 3,
+             [&](auto row) { return i * kNumBuildRows + row; }),
+         makeFlatVector<std::string>(
+             kNumBuildRows / 3,
+             [&](auto row) -> std::string {
+               if (row % 29 == 0) {
+                 return "POLYGON EMPTY";
+               }
+               const auto x = (row * 37 + i * 101) % 100;
+               const auto y = (row * 53 + i * 7) % 100;
+               const auto size = 1 + row % 5;
+               return fmt::format(
+                   "POLYGON (({0} {1}, {2} {1}, {2} {3}, {0} {3}, {0} {1}))",
+                   x,
+                   y,
+                   x + size,
+                   y + size);
+             },
+             nullEvery(31))}));
+  }
+
+  for (const auto& condition :
+       {"ST_Contains(polygon, point)",
+        "ST_Intersects(point, polygon) AND id % 2 = 0"}) {
+    for (const auto joinType :
+         {core::JoinType::kInner,
+          core::JoinType::kLeft,
+          core::JoinType::kRight,
+          core::JoinType::kFull,
+          core::JoinType::kLeftSemiProject}) {
+      SCOPED_TRACE(fmt::format(
+          "{} {}", condition, core::JoinTypeName::toName(joinType)));
+      const std::vector<std::string> outputLayout =
+          joinType == core::JoinType::kLeftSemiProject
+          ? std::vector<std::string>{"x", "y", "match"}
+          : std::vector<std::string>{"x", "y", "id"};
+      core::PlanNodeId joinNodeId;
+      auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+      auto plan =
+          PlanBuilder(planNodeIdGenerator)
+              .values(probeVectors)
+              .project({"x", "y", "ST_Point(x, y) AS point"})
+              .nestedLoopJoin(
+                  PlanBuilder(planNodeIdGenerator)
+                      .values(buildVectors)
+                      .project({"id", "ST_GeometryFromText(wkt) AS polygon"})
+                      .planNode(),
+                  condition,
+                  outputLayout,
+                  joinType)
+              .capturePlanNodeId(joinNodeId)
+              .planNode();
+
+      auto expected =
+          AssertQueryBuilder(plan)
+              .config(
+                  core::QueryConfig::kNestedLoopJoinSpatialIndexEnabled,
+                  "false")
+              .copyResults(pool());
+      std::shared_ptr<Task> task;
+      auto result = AssertQueryBuilder(plan).copyResults(pool(), task);
+      assertEqualResults({expected}, {result});
+
+      const auto stats = toPlanStats(task->taskStats()).at(joinNodeId);
+      const auto numCandidates =
+          stats.customStats.at(NestedLoopJoinProbe::kNumSpatialCandidateRows)
+              .sum;
+      ASSERT_GT(numCandidates, 0);
+      ASSERT_LT(numCandidates, kNumProbeRows * kNumBuildRows / 10);
+    }
+  }
+}
+
 } // namespace
 } // namespace facebook::velox::exec::test
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/OperatorAwaiter.h"
+#include "velox/common/base/tests/GTestUtils.h"
+
+#include <gtest/gtest.h>
+
+namespace facebook::velox::exec {
+namespace {
+
+TEST(OperatorAwaiterTest, basic) {
+  OperatorAwaiter awaiter;
+  ContinueFuture future;
+  ASSERT_FALSE(awaiter.isSuspended());
+  ASSERT_EQ(awaiter.isBlocked(&future), BlockingReason::kNotBlocked);
+  ASSERT_FALSE(awaiter.resume());
+
+  auto [promise, waitFuture] = makeVeloxContinuePromiseContract("basic");
+  int32_t step{0};
+  awaiter.await(
+      BlockingReason::kWaitForConnector,
+      std::move(waitFuture),
+      [&]() { step = 1; });
+  ASSERT_TRUE(awaiter.isSuspended());
+  // Does not resume before the future is handed to the driver.
+  ASSERT_FALSE(awaiter.resume());
+  VELOX_ASSERT_THROW(
+      awaiter.await(BlockingReason::kYield, ContinueFuture{folly::Unit{}}),
+      "Operator is already suspended");
+
+  ASSERT_EQ(awaiter.isBlocked(&future), BlockingReason::kWaitForConnector);
+  ASSERT_TRUE(future.valid());
+  ASSERT_FALSE(awaiter.isSuspended());
+  ASSERT_EQ(awaiter.isBlocked(&future), BlockingReason::kNotBlocked);
+  promise.setValue();
+  std::move(future).wait();
+
+  ASSERT_TRUE(awaiter.resume());
+  ASSERT_EQ(step, 1);
+  ASSERT_FALSE(awaiter.resume());
+}
+
+TEST(OperatorAwaiterTest, awaitAgainFromContinuation) {
+  OperatorAwaiter awaiter;
+  std::vector<int32_t> steps;
+  std::function<void()> next = [&]() {
+    steps.push_back(steps.size());
+    if (steps.size() < 3) {
+      awaiter.await(
+          BlockingReason::kYield, ContinueFuture{folly::Unit{}}, next);
+    }
+  };
+  awaiter.await(BlockingReason::kYield, ContinueFuture{folly::Unit{}}, next);
+  ContinueFuture future;
+  while (awaiter.isBlocked(&future) != BlockingReason::kNotBlocked) {
+    std::move(future).wait();
+    ASSERT_TRUE(awaiter.resume());
+  }
+  ASSERT_EQ(steps, std::vector<int32_t>({0, 1, 2}));
+}
+
+TEST(OperatorAwaiterTest, awaitAll) {
+  OperatorAwaiter awaiter;
+  std::vector<ContinuePromise> promises;
+  std::vector<ContinueFuture> futures;
+  for (auto i = 0; i < 3; ++i) {
+    auto [promise, future] = makeVeloxContinuePromiseContract("awaitAll");
+    promises.push_back(std::move(promise));
+    futures.push_back(std::move(future));
+  }
+  bool resumed{false};
+  awaiter.await(
+      BlockingReason::kWaitForIndexLookup,
+      std::move(futures),
+      [&]() { resumed = true; });
+  ContinueFuture future;
+  ASSERT_EQ(awaiter.isBlocked(&future), BlockingReason::kWaitForIndexLookup);
+  promises[0].setValue();
+  promises[2].setValue();
+  ASSERT_FALSE(future.isReady());
+  promises[1].setValue();
+  std::move(future).wait();
+  ASSERT_TRUE(awaiter.resume());
+  ASSERT_TRUE(resumed);
+
+  // No futures to wait for runs the continuation at the next resume.
+  resumed = false;
+  awaiter.await(
+      BlockingReason::kWaitForIndexLookup,
+      std::vector<ContinueFuture>{},
+      [&]() { resumed = true; });
+  ASSERT_FALSE(awaiter.isSuspended());
+  ASSERT_TRUE(awaiter.resume());
+  ASSERT_TRUE(resumed);
+}
+
+} // namespace
+} // namespace facebook::velox::exec
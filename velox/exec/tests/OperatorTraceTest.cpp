@@ -241,6 +241,7 @@ TEST_F(OperatorTraceTest, traceData) {
     ASSERT_EQ(summary.rawInputRows, 0);
     ASSERT_EQ(summary.rawInputBytes, 0);
     ASSERT_FALSE(summary.numSplits.has_value());
+    ASSERT_GT(summary.wallTimeNanos, 0);
 
     const auto reader = OperatorTraceInputReader(opTraceDir, dataType_, pool());
     RowVectorPtr actual;
@@ -21,6 +21,7 @@
 #include "velox/exec/Task.h"
 #include "velox/exec/tests/utils/PlanBuilder.h"
 #include "velox/exec/tests/utils/SerializedPageUtil.h"
+#include "velox/exec/tests/utils/TempDirectoryPath.h"
 #include "velox/serializers/CompactRowSerializer.h"
 #include "velox/serializers/PrestoSerializer.h"
 #include "velox/serializers/UnsafeRowSerializer.h"
@@ -89,7 +90,8 @@ class OutputBufferManagerTest : public testing::Test {
       PartitionedOutputNode::Kind kind,
       int numDestinations,
       int numDrivers,
-      int maxOutputBufferSize = 0) {
+      int maxOutputBufferSize = 0,
+      const std::string& spillDirectory = "") {
     bufferManager_->removeTask(taskId);
 
     auto planFragment = exec::test::PlanBuilder()
@@ -101,6 +103,10 @@ class OutputBufferManagerTest : public testing::Test {
       configSettings[core::QueryConfig::kMaxPartitionedOutputBufferSize] =
           std::to_string(maxOutputBufferSize);
     }
+    if (!spillDirectory.empty()) {
+      configSettings[core::QueryConfig::kSpillEnabled] = "true";
+      configSettings[core::QueryConfig::kOutputBufferSpillEnabled] = "true";
+    }
     auto queryCtx = core::QueryCtx::create(
         executor_.get(), core::QueryConfig(std::move(configSettings)));
 
@@ -110,6 +116,9 @@ class OutputBufferManagerTest : public testing::Test {
         0,
         std::move(queryCtx),
         Task::ExecutionMode::kParallel);
+    if (!spillDirectory.empty()) {
+      task->setSpillDirectory(spillDirectory);
+    }
 
     bufferManager_->initializeTask(task, kind, numDestinations, numDrivers);
     return task;
@@ -1447,6 +1456,63 @@ TEST_P(OutputBufferManagerWithDifferentSerdeKindsTest, outOfOrderAcks) {
   bufferManager_->removeTask(taskId);
 }
 
+TEST_F(OutputBufferManagerTest, spillSlowConsumer) {
+  const std::string taskId = std::to_string(folly::Random::rand32());
+  const auto spillDirectory = exec::test::TempDirectoryPath::create();
+  const int kNumPages = 10;
+  // Every enqueue fills the buffer and spills the unfetched pages.
+  initializeTask(
+      taskId,
+      rowType_,
+      PartitionedOutputNode::Kind::kPartitioned,
+      2,
+      1,
+      1,
+      spillDirectory->getPath());
+
+  std::vector<std::vector<uint64_t>> pageSizes(2);
+  for (int i = 0; i < kNumPages; ++i) {
+    for (int destination = 0; destination < 2; ++destination) {
+      pageSizes[destination].push_back(
+          enqueue(taskId, destination, rowType_, 100));
+    }
+  }
+  auto stats = getStats(taskId);
+  ASSERT_GT(stats.spillStats.spilledBytes, 0);
+  ASSERT_EQ(stats.buffersStats[0].pagesSpilled, kNumPages);
+  ASSERT_EQ(stats.buffersStats[1].pagesSpilled, kNumPages);
+  ASSERT_EQ(stats.bufferedPages, 0);
+  noMoreData(taskId);
+
+  for (int destination = 0; destination < 2; ++destination) {
+    const auto& sizes = pageSizes[destination];
+    for (int sequence = 0; sequence < sizes.size(); ++sequence) {
+      bool receivedData = false;
+      ASSERT_TRUE(bufferManager_->getData(
+          taskId,
+          destination,
+          1,
+          sequence,
+          [&](std::vector<std::unique_ptr<folly::IOBuf>> pages,
+              int64_t inSequence,
+              std::vector<int64_t> /*remainingBytes*/) {
+            ASSERT_EQ(pages.size(), 1);
+            ASSERT_EQ(inSequence, sequence);
+            ASSERT_EQ(pages[0]->computeChainDataLength(), sizes[sequence]);
+            receivedData = true;
+          }));
+      ASSERT_TRUE(receivedData);
+    }
+    fetchEndMarker(taskId, destination, sizes.size());
+  }
+
+  stats = getStats(taskId);
+  ASSERT_GT(stats.spillStats.spillReads, 0);
+  ASSERT_GT(stats.spillStats.spillReadBytes, 0);
+  ASSERT_EQ(stats.totalPagesSent, 2 * kNumPages);
+  bufferManager_->removeTask(taskId);
+}
+
 TEST_F(OutputBufferManagerTest, errorInQueue) {
   auto queue = std::make_shared<ExchangeQueue>(1, 0);
   queue->setError("Forced failure");
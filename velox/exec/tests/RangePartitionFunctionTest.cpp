@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/RangePartitionFunction.h"
+#include <gtest/gtest.h>
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+using namespace facebook;
+using namespace facebook::velox;
+using namespace facebook::velox::exec;
+
+class RangePartitionFunctionTest : public velox::test::VectorTestBase,
+                                   public testing::Test {
+ protected:
+  static void SetUpTestCase() {
+    memory::MemoryManager::testingSetInstance(memory::MemoryManager::Options{});
+  }
+};
+
+TEST_F(RangePartitionFunctionTest, basic) {
+  auto data = makeRowVector({
+      makeFlatVector<std::string>({"a", "x", "b", "y", "c", "z"}),
+      makeNullableFlatVector<int64_t>({1, 10, 25, 20, 30, std::nullopt}),
+  });
+  auto splitters = makeRowVector({makeFlatVector<int64_t>({10, 20, 20})});
+
+  RangePartitionFunction partitionFunction(
+      4, {1}, {core::kAscNullsLast}, splitters);
+  std::vector<uint32_t> partitions;
+  ASSERT_FALSE(partitionFunction.partition(*data, partitions).has_value());
+  ASSERT_EQ(std::vector<uint32_t>({0, 1, 3, 3, 3, 3}), partitions);
+
+  // Descending order with nulls first.
+  splitters = makeRowVector({makeFlatVector<int64_t>({25, 10, 1})});
+  RangePartitionFunction descending(4, {1}, {core::kDescNullsFirst}, splitters);
+  descending.partition(*data, partitions);
+  ASSERT_EQ(std::vector<uint32_t>({3, 2, 1, 1, 0, 0}), partitions);
+
+  VELOX_ASSERT_THROW(
+      RangePartitionFunction(3, {1}, {core::kAscNullsLast}, splitters),
+      "Range partitioning into 3 partitions requires 2 splitters");
+}
+
+TEST_F(RangePartitionFunctionTest, multipleKeys) {
+  auto data = makeRowVector({
+      makeFlatVector<int32_t>({1, 1, 2, 2, 3}),
+      makeFlatVector<std::string>({"b", "d", "a", "c", "a"}),
+  });
+  auto splitters = makeRowVector({
+      makeFlatVector<int32_t>({1, 2}),
+      makeFlatVector<std::string>({"c", "b"}),
+  });
+
+  RangePartitionFunction partitionFunction(
+      3, {0, 1}, {core::kAscNullsLast, core::kAscNullsLast}, splitters);
+  std::vector<uint32_t> partitions;
+  partitionFunction.partition(*data, partitions);
+  ASSERT_EQ(std::vector<uint32_t>({0, 1, 1, 2, 2}), partitions);
+}
+
+TEST_F(RangePartitionFunctionTest, makeSplitters) {
+  auto left = makeRowVector(
+      {makeFlatVector<int64_t>(1'000, [](auto row) { return row * 2; })});
+  auto right = makeRowVector(
+      {makeFlatVector<int64_t>(1'000, [](auto row) { return row * 2 + 1; })});
+
+  auto splitters = RangePartitionFunctionSpec::makeSplitters(
+      {left, right}, {core::kAscNullsLast}, 4, pool());
+  ASSERT_EQ(3, splitters->size());
+  test::assertEqualVectors(
+      makeRowVector({makeFlatVector<int64_t>({500, 1'000, 1'500})}),
+      splitters);
+
+  splitters = RangePartitionFunctionSpec::makeSplitters(
+      {left}, {core::kAscNullsLast}, 1, pool());
+  ASSERT_EQ(0, splitters->size());
+}
+
+TEST_F(RangePartitionFunctionTest, spec) {
+  auto inputType = ROW({"c0", "c1"}, {VARCHAR(), BIGINT()});
+  auto splitters = makeRowVector({makeFlatVector<int64_t>({20, 10})});
+  auto spec = std::make_unique<RangePartitionFunctionSpec>(
+      inputType,
+      std::vector<column_index_t>{1},
+      std::vector<core::SortOrder>{core::kDescNullsFirst},
+      splitters);
+  ASSERT_EQ("RANGE(c1 DESC NULLS FIRST) with 2 splitters", spec->toString());
+
+  auto copy =
+      RangePartitionFunctionSpec::deserialize(spec->serialize(), pool());
+  ASSERT_EQ(spec->toString(), copy->toString());
+
+  auto data = makeRowVector({
+      makeFlatVector<std::string>({"a", "b", "c"}),
+      makeFlatVector<int64_t>({5, 15, 25}),
+  });
+  std::vector<uint32_t> partitions;
+  copy->create(3, true)->partition(*data, partitions);
+  ASSERT_EQ(std::vector<uint32_t>({2, 1, 0}), partitions);
+}
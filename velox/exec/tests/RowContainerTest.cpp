@@ -18,6 +18,7 @@
 #include "velox/exec/Aggregate.h"
 #include "velox/exec/VectorHasher.h"
 #include "velox/exec/tests/utils/RowContainerTestBase.h"
+#include "velox/exec/tests/utils/TempDirectoryPath.h"
 #include "velox/expression/VectorReaders.h"
 #include "velox/type/tests/utils/CustomTypesForTesting.h"
 #include "velox/vector/fuzzer/VectorFuzzer.h"
@@ -2746,4 +2747,143 @@ TEST_F(RowContainerTest, setAllNull) {
       (row[accColumn.initializedByte()] & accColumn.initializedMask()), 0);
 }
 
+TEST_F(RowContainerTest, fileBackedStorage) {
+  constexpr vector_size_t kNumRows = 100'000;
+  auto data = makeRowVector(
+      {makeFlatVector<int64_t>(kNumRows, [](auto row) { return row; }),
+       makeFlatVector<std::string>(kNumRows, [](auto row) {
+         return std::string(50 + row % 50, 'a' + row % 26);
+       })});
+  auto rowContainer = makeRowContainer({BIGINT()}, {VARCHAR()}, false);
+  auto tempDirectory = TempDirectoryPath::create();
+  rowContainer->enableFileBackedStorage(tempDirectory->getPath());
+  ASSERT_TRUE(rowContainer->isFileBacked());
+
+  std::vector<DecodedVector> decoded;
+  for (const auto& child : data->children()) {
+    decoded.emplace_back(*child);
+  }
+  std::vector<char*> rows(kNumRows);
+  const auto poolBytes = pool()->usedBytes();
+  for (auto i = 0; i < kNumRows; ++i) {
+    rows[i] = rowContainer->newRow();
+    for (auto column = 0; column < decoded.size(); ++column) {
+      rowContainer->store(decoded[column], i, rows[i], column);
+    }
+  }
+
+  // Rows and strings are in file backed memory and not taken from the pool.
+  const auto [fileBackedBytes, residentBytes] = rowContainer->fileBackedBytes();
+  ASSERT_GT(fileBackedBytes, 0);
+  ASSERT_GT(residentBytes, 0);
+  ASSERT_LE(residentBytes, fileBackedBytes);
+  ASSERT_EQ(pool()->usedBytes(), poolBytes);
+
+  for (auto column = 0; column < decoded.size(); ++column) {
+    auto result =
+        BaseVector::create(data->childAt(column)->type(), kNumRows, pool());
+    RowContainer::extractColumn(
+        rows.data(), kNumRows, rowContainer->columnAt(column), false, result);
+    assertEqualVectors(data->childAt(column), result);
+  }
+  rowContainer->clear();
+  ASSERT_EQ(rowContainer->fileBackedBytes().first, 0);
+}
+
+TEST_F(RowContainerTest, compactStringData) {
+  constexpr vector_size_t kNumRows = 10'000;
+  auto data = makeFlatVector<std::string>(
+      kNumRows, [](auto row) { return std::string(100, 'a' + row % 26); });
+  auto rowContainer = makeRowContainer({VARCHAR()}, {}, false);
+  DecodedVector decoded(*data);
+  auto rows = storeRows(decoded, kNumRows, *rowContainer);
+
+  // Erase 3 out of 4 rows. This leaves most of the string storage free.
+  std::vector<char*> erased;
+  std::vector<char*> kept;
+  std::vector<vector_size_t> keptIndices;
+  for (auto i = 0; i < kNumRows; ++i) {
+    if (i % 4 == 0) {
+      kept.push_back(rows[i]);
+      keptIndices.push_back(i);
+    } else {
+      erased.push_back(rows[i]);
+    }
+  }
+  rowContainer->eraseRows(folly::Range(erased.data(), erased.size()));
+
+  const auto retainedBytes = rowContainer->stringAllocator().retainedSize();
+  const auto compactedBytes = rowContainer->compactStringData();
+  ASSERT_GT(compactedBytes, 0);
+  ASSERT_EQ(
+      rowContainer->stringAllocator().retainedSize(),
+      retainedBytes - compactedBytes);
+  ASSERT_LT(
+      rowContainer->stringAllocator().freeSpace(),
+      rowContainer->stringAllocator().retainedSize() / 2);
+
+  auto result = BaseVector::create(VARCHAR(), kept.size(), pool());
+  RowContainer::extractColumn(
+      kept.data(), kept.size(), rowContainer->columnAt(0), false, result);
+  for (auto i = 0; i < kept.size(); ++i) {
+    ASSERT_TRUE(result->equalValueAt(data.get(), i, keptIndices[i])) << i;
+  }
+
+  // Containers with complex type columns are left as is.
+  auto complexContainer = makeRowContainer({ARRAY(BIGINT())}, {}, false);
+  ASSERT_EQ(complexContainer->compactStringData(), 0);
+}
+
 } // namespace facebook::velox::exec::test
+
+TEST_F(RowContainerTest, fixedWidthComplexKeys) {
+  // ROW and ARRAY keys of fixed-width scalars are compared and hashed on their
+  // serialization. Results must match the ones for the vectors. The last array
+  // is large enough to span multiple allocations.
+  auto arrays = makeNullableArrayVector<int64_t>(
+      {{{1, 2}},
+       {{1, std::nullopt, 3}},
+       {{}},
+       {{1, 2, 3}},
+       {{1, 2}},
+       std::vector<std::optional<int64_t>>(20'000, 7)});
+  auto rows = makeRowVector(
+      {makeNullableFlatVector<int32_t>({1, std::nullopt, 1, 2, 1, 3}),
+       makeNullableFlatVector<double>(
+           {0.5, 1.0, std::nan("1"), std::nullopt, 0.5, -1.0})});
+
+  for (const auto& data : {VectorPtr(arrays), VectorPtr(rows)}) {
+    SCOPED_TRACE(data->type()->toString());
+    const auto numRows = data->size();
+    auto rowContainer = makeRowContainer({data->type()}, {}, false);
+    DecodedVector decoded(*data);
+    auto storedRows = storeRows(decoded, numRows, *rowContainer);
+
+    std::vector<uint64_t> hashes(numRows);
+    rowContainer->hash(
+        0, folly::Range(storedRows.data(), numRows), false, hashes.data());
+    auto hasher = VectorHasher::create(data->type(), 0);
+    SelectivityVector allRows(numRows);
+    raw_vector<uint64_t> expectedHashes(numRows);
+    hasher->decode(*data, allRows);
+    hasher->hash(allRows, false, expectedHashes);
+
+    for (auto i = 0; i < numRows; ++i) {
+      ASSERT_EQ(expectedHashes[i], hashes[i]) << i;
+      for (auto j = 0; j < numRows; ++j) {
+        for (auto flags :
+             {CompareFlags{true, true, false},
+              CompareFlags{true, false, false},
+              CompareFlags{true, true, true}}) {
+          const auto expected = data->compare(data.get(), i, j, flags).value();
+          const auto result =
+              rowContainer->compare(storedRows[i], storedRows[j], 0, flags);
+          ASSERT_EQ(expected == 0, result == 0) << i << ", " << j;
+          if (!flags.equalsOnly) {
+            ASSERT_EQ(expected < 0, result < 0) << i << ", " << j;
+          }
+        }
+      }
+    }
+  }
+}
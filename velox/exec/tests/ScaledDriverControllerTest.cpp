@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/ScaledDriverController.h"
+
+#include <set>
+
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/exec/LocalPartition.h"
+#include "velox/exec/tests/utils/OperatorTestBase.h"
+
+using namespace facebook::velox;
+
+namespace facebook::velox::exec::test {
+namespace {
+
+class ScaledDriverControllerTest : public OperatorTestBase {
+ protected:
+  // Fills the exchange buffers over half of their capacity.
+  void fillBuffers() {
+    ContinueFuture future;
+    memoryManager_->increaseMemoryUsage(&future, kMaxBufferBytes * 3 / 4);
+  }
+
+  void drainBuffers() {
+    memoryManager_->decreaseMemoryUsage(memoryManager_->bufferedBytes());
+  }
+
+  // Returns the drivers picked for the next 'numBatches' batches.
+  std::set<uint32_t> nextDrivers(
+      ScaledDriverController& controller,
+      int32_t numBatches) {
+    std::set<uint32_t> drivers;
+    for (auto i = 0; i < numBatches; ++i) {
+      drivers.insert(controller.nextDriver());
+    }
+    return drivers;
+  }
+
+  static constexpr int64_t kMaxBufferBytes = 1'000;
+
+  const std::shared_ptr<memory::MemoryPool> queryPool_{
+      memory::memoryManager()->addRootPool("", 1L << 30)};
+  const std::shared_ptr<LocalExchangeMemoryManager> memoryManager_{
+      std::make_shared<LocalExchangeMemoryManager>(kMaxBufferBytes)};
+};
+
+TEST_F(ScaledDriverControllerTest, scaleUpAndDown) {
+  ScaledDriverController controller(
+      queryPool_.get(), memoryManager_, 4, 0.7, /*executor=*/nullptr);
+  ASSERT_EQ(controller.stats().numRunningDrivers, 1);
+
+  // The running driver keeps up with the producers.
+  ASSERT_EQ(nextDrivers(controller, 64), std::set<uint32_t>({0}));
+  ASSERT_EQ(controller.stats().numScaleUps, 0);
+
+  // The buffers fill up. Adds one driver at a time until all run.
+  fillBuffers();
+  ASSERT_EQ(nextDrivers(controller, 1'000), std::set<uint32_t>({0, 1, 2, 3}));
+  auto stats = controller.stats();
+  ASSERT_EQ(stats.numRunningDrivers, 4);
+  ASSERT_EQ(stats.maxRunningDrivers, 4);
+  ASSERT_EQ(stats.numScaleUps, 3);
+
+  // The running drivers mostly wait for data. Parks the last running driver.
+  drainBuffers();
+  for (auto i = 0; i < 64; ++i) {
+    controller.recordConsumerFetch(i % 4, i % 4 != 0);
+  }
+  stats = controller.stats();
+  ASSERT_EQ(stats.numRunningDrivers, 3);
+  ASSERT_EQ(stats.numScaleDowns, 1);
+  ASSERT_EQ(nextDrivers(controller, 64), std::set<uint32_t>({0, 1, 2}));
+
+  // The fetches of a parked driver do not count.
+  for (auto i = 0; i < 64; ++i) {
+    controller.recordConsumerFetch(3, true);
+  }
+  ASSERT_EQ(controller.stats().numRunningDrivers, 3);
+
+  // Keeps at least one running driver.
+  for (auto i = 0; i < 1'000; ++i) {
+    controller.recordConsumerFetch(0, true);
+  }
+  stats = controller.stats();
+  ASSERT_EQ(stats.numRunningDrivers, 1);
+  ASSERT_EQ(stats.numScaleDowns, 3);
+  ASSERT_EQ(stats.maxRunningDrivers, 4);
+}
+
+TEST_F(ScaledDriverControllerTest, memoryLimit) {
+  // The query memory usage is never below a zero ratio of its capacity.
+  ScaledDriverController controller(
+      queryPool_.get(), memoryManager_, 4, 0.0, /*executor=*/nullptr);
+  fillBuffers();
+  ASSERT_EQ(nextDrivers(controller, 1'000), std::set<uint32_t>({0}));
+  ASSERT_EQ(controller.stats().numScaleUps, 0);
+}
+
+TEST_F(ScaledDriverControllerTest, invalidArguments) {
+  VELOX_ASSERT_THROW(
+      ScaledDriverController(
+          queryPool_.get(), memoryManager_, 0, 0.7, /*executor=*/nullptr),
+      "");
+  VELOX_ASSERT_THROW(
+      ScaledDriverController(
+          queryPool_.get(), memoryManager_, 4, 1.5, /*executor=*/nullptr),
+      "");
+}
+
+} // namespace
+} // namespace facebook::velox::exec::test
@@ -274,6 +274,53 @@ TEST_P(SortBufferTest, multipleKeys) {
   }
 }
 
+TEST_P(SortBufferTest, parallelSort) {
+  const auto numRows = 5 * SortBuffer::kMinParallelSortRunRows + 123;
+  VectorFuzzer fuzzer({.vectorSize = 10'000, .nullRatio = 0.1}, pool_.get());
+  std::vector<RowVectorPtr> inputs;
+  for (uint64_t numInputRows = 0; numInputRows < numRows;) {
+    inputs.push_back(fuzzer.fuzzRow(inputType_));
+    numInputRows += inputs.back()->size();
+  }
+
+  const auto sort = [&](uint32_t maxSortThreads) {
+    auto sortBuffer = std::make_unique<SortBuffer>(
+        inputType_,
+        sortColumnIndices_,
+        sortCompareFlags_,
+        pool_.get(),
+        &nonReclaimableSection_,
+        prefixSortConfig_,
+        nullptr,
+        nullptr,
+        executor_.get(),
+        maxSortThreads);
+    for (const auto& input : inputs) {
+      sortBuffer->addInput(input);
+    }
+    sortBuffer->noMoreInput();
+    std::vector<RowVectorPtr> outputs;
+    while (auto output = sortBuffer->getOutput(1'000)) {
+      // The output vector is reused between calls.
+      outputs.push_back(
+          std::static_pointer_cast<RowVector>(BaseVector::copy(*output)));
+    }
+    return outputs;
+  };
+
+  const auto expected = sort(1);
+  const auto actual = sort(4);
+  ASSERT_EQ(expected.size(), actual.size());
+  for (auto i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(expected[i]->size(), actual[i]->size());
+    // Rows with equal keys may come in a different order.
+    for (auto channel : sortColumnIndices_) {
+      assertEqualVectors(
+          expected[i]->childAt(channel), actual[i]->childAt(channel));
+    }
+  }
+}
+
 // TODO: enable it later with test utility to compare the sorted result.
 TEST_P(SortBufferTest, DISABLED_randomData) {
   struct {
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/SpatialIndex.h"
+
+#include <folly/Random.h>
+#include <gtest/gtest.h>
+
+#include "velox/common/base/tests/GTestUtils.h"
+
+namespace facebook::velox::exec {
+namespace {
+
+class SpatialIndexTest : public testing::Test {
+ protected:
+  Envelope randomEnvelope(double maxSize) {
+    const double x = folly::Random::randDouble(0, 1'000, rng_);
+    const double y = folly::Random::randDouble(0, 1'000, rng_);
+    return {
+        x,
+        y,
+        x + folly::Random::randDouble(0, maxSize, rng_),
+        y + folly::Random::randDouble(0, maxSize, rng_)};
+  }
+
+  static std::vector<int32_t> bruteForce(
+      const std::vector<Envelope>& envelopes,
+      const Envelope& probe) {
+    std::vector<int32_t> result;
+    for (auto i = 0; i < envelopes.size(); ++i) {
+      if (!envelopes[i].isEmpty() && !probe.isEmpty() &&
+          envelopes[i].intersects(probe)) {
+        result.push_back(i);
+      }
+    }
+    return result;
+  }
+
+  folly::Random::DefaultGenerator rng_{1};
+};
+
+TEST_F(SpatialIndexTest, query) {
+  for (const auto numEnvelopes : {1, 15, 16, 17, 300, 10'000}) {
+    for (const auto nodeCapacity : {2, 16}) {
+      SCOPED_TRACE(fmt::format("{} {}", numEnvelopes, nodeCapacity));
+      std::vector<Envelope> envelopes;
+      for (auto i = 0; i < numEnvelopes; ++i) {
+        envelopes.push_back(randomEnvelope(i % 10 == 0 ? 100 : 10));
+      }
+      SpatialIndex index(envelopes, nodeCapacity);
+      ASSERT_EQ(index.size(), numEnvelopes);
+      ASSERT_GT(index.numLevels(), 0);
+
+      std::vector<int32_t> result;
+      for (auto i = 0; i < 100; ++i) {
+        const auto probe = randomEnvelope(50);
+        result.clear();
+        index.query(probe, result);
+        ASSERT_EQ(result, bruteForce(envelopes, probe));
+      }
+    }
+  }
+}
+
+TEST_F(SpatialIndexTest, touchingEnvelopes) {
+  std::vector<Envelope> envelopes{{0, 0, 1, 1}, {1, 1, 2, 2}, {3, 0, 3, 0}};
+  SpatialIndex index(envelopes);
+  std::vector<int32_t> result;
+  index.query({1, 1, 1, 1}, result);
+  ASSERT_EQ(result, (std::vector<int32_t>{0, 1}));
+
+  result.clear();
+  index.query({2, 0, 3, 0}, result);
+  ASSERT_EQ(result, (std::vector<int32_t>{2}));
+}
+
+TEST_F(SpatialIndexTest, emptyEnvelopes) {
+  const auto nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<Envelope> envelopes{
+      Envelope::empty(), {0, 0, 10, 10}, {nan, 0, 1, 1}, {5, 5, 6, 6}};
+  SpatialIndex index(envelopes);
+  ASSERT_EQ(index.size(), 2);
+
+  std::vector<int32_t> result;
+  index.query({0, 0, 10, 10}, result);
+  ASSERT_EQ(result, (std::vector<int32_t>{1, 3}));
+
+  result.clear();
+  index.query(Envelope::empty(), result);
+  ASSERT_TRUE(result.empty());
+  index.query({nan, nan, nan, nan}, result);
+  ASSERT_TRUE(result.empty());
+
+  SpatialIndex emptyIndex({Envelope::empty()});
+  ASSERT_EQ(emptyIndex.size(), 0);
+  ASSERT_EQ(emptyIndex.numLevels(), 0);
+  emptyIndex.query({0, 0, 10, 10}, result);
+  ASSERT_TRUE(result.empty());
+}
+
+TEST_F(SpatialIndexTest, invalidNodeCapacity) {
+  VELOX_ASSERT_THROW(SpatialIndex({}, 1), "(1 vs. 2)");
+}
+
+} // namespace
+} // namespace facebook::velox::exec
@@ -541,9 +541,12 @@ class SpillTest : public ::testing::TestWithParam<uint32_t>,
         fmt::format(
             "spillRuns[{}] spilledInputBytes[{}] spilledBytes[{}] spilledRows[{}] "
             "spilledPartitions[{}] spilledFiles[{}] spillFillTimeNanos[{}] "
-            "spillSortTimeNanos[{}] spillExtractVectorTime[{}] spillSerializationTimeNanos[{}] spillWrites[{}] "
+            "spillSortTimeNanos[{}] spillExtractVectorTime[{}] "
+            "spillExtractAccumulatorTime[{}] spillSerializationTimeNanos[{}] "
+            "spillWrites[{}] "
             "spillFlushTimeNanos[{}] spillWriteTimeNanos[{}] maxSpillExceededLimitCount[0] "
             "spillReadBytes[{}] spillReads[{}] spillReadTimeNanos[{}] "
+            "spillReadAheadWaitTimeNanos[{}] "
             "spillReadDeserializationTimeNanos[{}]",
             finalStats.spillRuns,
             succinctBytes(finalStats.spilledInputBytes),
@@ -554,6 +557,7 @@ class SpillTest : public ::testing::TestWithParam<uint32_t>,
             succinctNanos(finalStats.spillFillTimeNanos),
             succinctNanos(finalStats.spillSortTimeNanos),
             succinctNanos(finalStats.spillExtractVectorTimeNanos),
+            succinctNanos(finalStats.spillExtractAccumulatorTimeNanos),
             succinctNanos(finalStats.spillSerializationTimeNanos),
             finalStats.spillWrites,
             succinctNanos(finalStats.spillFlushTimeNanos),
@@ -561,6 +565,7 @@ class SpillTest : public ::testing::TestWithParam<uint32_t>,
             succinctBytes(finalStats.spillReadBytes),
             finalStats.spillReads,
             succinctNanos(finalStats.spillReadTimeNanos),
+            succinctNanos(finalStats.spillReadAheadWaitTimeNanos),
             succinctNanos(finalStats.spillDeserializationTimeNanos)));
     // Verify the spilled files are still there after spill state destruction.
     for (const auto& spilledFile : spilledFileSet) {
@@ -1392,6 +1397,80 @@ TEST_P(SpillTest, nonExistSpillFileOnDeletion) {
   state_.reset();
 }
 
+TEST_P(SpillTest, spillReadProjection) {
+  const auto rowType =
+      ROW({"k", "s", "v"}, {BIGINT(), VARCHAR(), ARRAY(INTEGER())});
+  std::vector<RowVectorPtr> batches;
+  for (auto i = 0; i < 3; ++i) {
+    batches.push_back(makeRowVector(
+        rowType->names(),
+        {makeFlatVector<int64_t>(100, [&](auto row) { return i * 100 + row; }),
+         makeFlatVector<StringView>(
+             100,
+             [](auto row) {
+               return StringView::makeInline(fmt::format("s{}", row));
+             },
+             [](auto row) { return row % 7 == 0; }),
+         makeArrayVector<int32_t>(
+             100,
+             [](auto row) { return row % 5; },
+             [](auto row, auto index) { return row + index; })}));
+  }
+
+  auto tempDirectory = exec::test::TempDirectoryPath::create();
+  SpillWriter writer(
+      rowType,
+      {},
+      compressionKind_,
+      tempDirectory->getPath() + "/projection",
+      kGB,
+      1 << 10,
+      "",
+      updateSpilledBytesCb_,
+      pool(),
+      &spillStats_);
+  for (const auto& batch : batches) {
+    IndexRange range{0, batch->size()};
+    writer.write(batch, folly::Range<IndexRange*>(&range, 1));
+  }
+  const auto files = writer.finish();
+  ASSERT_EQ(files.size(), 1);
+
+  struct {
+    std::vector<column_index_t> projection;
+
+    std::string debugString() const {
+      return fmt::format("projection: {}", folly::join(",", projection));
+    }
+  } testSettings[] = {{{}}, {{0, 1, 2}}, {{2, 0}}, {{1}}};
+
+  for (const auto& testData : testSettings) {
+    SCOPED_TRACE(testData.debugString());
+    auto reader =
+        SpillReadFile::create(files[0], 1 << 20, pool(), &spillStats_);
+    std::vector<column_index_t> channels = testData.projection;
+    if (channels.empty()) {
+      channels = {0, 1, 2};
+    } else {
+      reader->setProjection(channels);
+    }
+    RowVectorPtr output;
+    for (const auto& batch : batches) {
+      ASSERT_TRUE(reader->nextBatch(output));
+      ASSERT_EQ(output->size(), batch->size());
+      ASSERT_EQ(output->childrenSize(), channels.size());
+      for (auto i = 0; i < channels.size(); ++i) {
+        ASSERT_EQ(
+            asRowType(output->type())->nameOf(i),
+            rowType->nameOf(channels[i]));
+        facebook::velox::test::assertEqualVectors(
+            batch->childAt(channels[i]), output->childAt(i));
+      }
+    }
+    ASSERT_FALSE(reader->nextBatch(output));
+  }
+}
+
 TEST_P(SpillTest, validatePerSpillWriteSize) {
   struct TestRowVector : RowVector {
     explicit TestRowVector(std::shared_ptr<const Type> type)
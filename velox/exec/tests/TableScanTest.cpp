@@ -278,6 +278,63 @@ TEST_F(TableScanTest, columnAliases) {
   assertQuery(op, {filePath}, "SELECT c0 FROM tmp WHERE c0 % 2 = 1");
 }
 
+TEST_F(TableScanTest, sortedSplits) {
+  // Each file is sorted on c0, e.g. the files of one bucket of a sorted
+  // bucketed table.
+  const int32_t numFiles = 3;
+  std::vector<RowVectorPtr> vectors;
+  std::vector<std::shared_ptr<TempFilePath>> filePaths;
+  for (auto i = 0; i < numFiles; ++i) {
+    vectors.push_back(makeRowVector({
+        makeFlatVector<int64_t>(
+            1'000, [&](auto row) { return row * numFiles + i; }),
+        makeFlatVector<int32_t>(1'000, [](auto row) { return row % 7; }),
+    }));
+    filePaths.push_back(TempFilePath::create());
+    writeToFile(filePaths.back()->getPath(), {vectors.back()});
+  }
+  createDuckDbTable(vectors);
+
+  const auto rowType = asRowType(vectors[0]->type());
+  auto tableHandle = std::make_shared<HiveTableHandle>(
+      kHiveConnectorId,
+      "hive_table",
+      true,
+      SubfieldFilters{},
+      nullptr,
+      nullptr,
+      std::unordered_map<std::string, std::string>{},
+      std::vector<std::pair<std::string, core::SortOrder>>{
+          {"c0", core::kAscNullsLast}});
+
+  // The scans of the splits are merged on the declared order instead of
+  // sorted.
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  std::vector<core::PlanNodeId> scanIds(numFiles);
+  std::vector<core::PlanNodePtr> sources;
+  for (auto i = 0; i < numFiles; ++i) {
+    sources.push_back(PlanBuilder(planNodeIdGenerator)
+                          .startTableScan()
+                          .outputType(rowType)
+                          .tableHandle(tableHandle)
+                          .endTableScan()
+                          .capturePlanNodeId(scanIds[i])
+                          .planNode());
+  }
+  std::vector<std::string> keys;
+  for (const auto& [column, sortOrder] : tableHandle->sortedBy()) {
+    keys.push_back(fmt::format("{} {}", column, sortOrder.toString()));
+  }
+  auto plan = PlanBuilder(planNodeIdGenerator)
+                  .localMerge(keys, std::move(sources))
+                  .planNode();
+  AssertQueryBuilder builder(plan, duckDbQueryRunner_);
+  for (auto i = 0; i < numFiles; ++i) {
+    builder.split(scanIds[i], makeHiveConnectorSplit(filePaths[i]->getPath()));
+  }
+  builder.assertResults("SELECT * FROM tmp ORDER BY c0", {{0}});
+}
+
 TEST_F(TableScanTest, partitionKeyAlias) {
   auto vectors = makeVectors(1, 1'000);
   auto filePath = TempFilePath::create();
@@ -1266,6 +1323,47 @@ TEST_F(TableScanTest, count) {
   EXPECT_EQ(numRead, 10'000);
 }
 
+TEST_F(TableScanTest, limit) {
+  auto rowType = ROW({"c0", "c1"}, {INTEGER(), BIGINT()});
+  const vector_size_t size = 5'000;
+  auto rowVector = makeRowVector(
+      {makeFlatVector<int32_t>(size, [](auto row) { return row; }),
+       makeFlatVector<int64_t>(size, [](auto row) { return row * 2; })});
+  auto filePaths = makeFilePaths(3);
+  for (const auto& filePath : filePaths) {
+    writeToFile(filePath->getPath(), rowVector);
+  }
+
+  auto makeExpected = [&](int32_t firstRow) {
+    return makeRowVector(
+        {makeFlatVector<int32_t>(
+             10, [firstRow](auto row) { return firstRow + row; }),
+         makeFlatVector<int64_t>(
+             10, [firstRow](auto row) { return (firstRow + row) * 2 + 1; })});
+  };
+  auto makePlan = [&](const std::vector<std::string>& filters) {
+    return PlanBuilder(pool_.get())
+        .tableScan(rowType, filters)
+        .project({"c0", "c1 + 1"})
+        .limit(0, 10, true)
+        .planNode();
+  };
+
+  // Without filters the scan reads only as many rows as the limit needs.
+  auto task = AssertQueryBuilder(makePlan({}))
+                  .splits(makeHiveConnectorSplits(filePaths))
+                  .assertResults(makeExpected(0));
+  EXPECT_EQ(getTableScanStats(task).rawInputRows, 10);
+  EXPECT_EQ(getTableScanStats(task).numSplits, 1);
+
+  // With a filter the number of rows to scan is not known.
+  task = AssertQueryBuilder(makePlan({"c0 >= 100"}))
+             .splits(makeHiveConnectorSplits(filePaths))
+             .assertResults(makeExpected(100));
+  EXPECT_GT(getTableScanStats(task).rawInputRows, 10);
+  EXPECT_EQ(getTableScanStats(task).numSplits, 1);
+}
+
 TEST_F(TableScanTest, batchSize) {
   // Make a wide row of many BIGINT columns to ensure that row size is
   // larger than 1KB.
@@ -1451,6 +1549,67 @@ TEST_F(TableScanTest, multipleSplits) {
   }
 }
 
+TEST_F(TableScanTest, adaptiveSplitPreload) {
+  auto filePaths = makeFilePaths(50);
+  auto vectors = makeVectors(50, 100);
+  for (int32_t i = 0; i < vectors.size(); i++) {
+    writeToFile(filePaths[i]->getPath(), vectors[i]);
+  }
+  createDuckDbTable(vectors);
+
+  for (bool adaptive : {false, true}) {
+    SCOPED_TRACE(fmt::format("adaptive {}", adaptive));
+    auto task =
+        AssertQueryBuilder(tableScanNode(), duckDbQueryRunner_)
+            .config(core::QueryConfig::kMaxSplitPreloadPerDriver, "3")
+            .config(core::QueryConfig::kAdaptiveSplitPreloadEnabled, adaptive)
+            .splits(makeHiveConnectorSplits(filePaths))
+            .assertResults("SELECT * FROM tmp");
+    auto stats = getTableScanRuntimeStats(task);
+    if (!adaptive) {
+      ASSERT_EQ(stats.count(TableScan::kSplitPreloadDepth), 0);
+      continue;
+    }
+    // Reported at the end of each split.
+    const auto& depth = stats.at(TableScan::kSplitPreloadDepth);
+    ASSERT_EQ(depth.count, filePaths.size());
+    ASSERT_GE(depth.min, 0);
+    ASSERT_LE(depth.max, 3);
+  }
+}
+
+TEST_F(TableScanTest, divideLargeSplit) {
+  auto vectors = makeVectors(20, 1'000);
+  createDuckDbTable(vectors);
+  auto file = TempFilePath::create();
+  // Writes one stripe per vector.
+  auto writeConfig = std::make_shared<dwrf::Config>();
+  writeConfig->set<uint64_t>(dwrf::Config::STRIPE_SIZE, 1'000);
+  writeToFile(file->getPath(), vectors, writeConfig);
+  const auto fileSize = fs::file_size(file->getPath());
+
+  for (uint64_t divisionBytes : {0UL, fileSize / 4}) {
+    SCOPED_TRACE(fmt::format("divisionBytes {}", divisionBytes));
+    auto task =
+        AssertQueryBuilder(tableScanNode(), duckDbQueryRunner_)
+            .maxDrivers(4)
+            .config(
+                core::QueryConfig::kTableScanSplitDivisionBytes,
+                std::to_string(divisionBytes))
+            .split(makeHiveConnectorSplit(file->getPath(), 0, fileSize))
+            .assertResults("SELECT * FROM tmp");
+    auto stats = getTableScanRuntimeStats(task);
+    const auto tableScanStats = getTableScanStats(task);
+    if (divisionBytes == 0) {
+      ASSERT_EQ(stats.count(TableScan::kNumDividedSplits), 0);
+      ASSERT_EQ(tableScanStats.numSplits, 1);
+      continue;
+    }
+    ASSERT_EQ(stats.at(TableScan::kNumDividedSplits).sum, 1);
+    ASSERT_EQ(tableScanStats.numSplits, 4);
+  }
+}
+
 TEST_F(TableScanTest, preloadingSplitClose) {
   auto filePaths = makeFilePaths(100);
   auto vectors = makeVectors(100, 100);
@@ -3553,6 +3712,82 @@ TEST_F(TableScanTest, remainingFilter) {
       "SELECT * FROM tmp WHERE not (c0 > 0 or c1 > c0)");
 }
 
+TEST_F(TableScanTest, remainingFilterReaderPushdown) {
+  constexpr int kSize = 10'000;
+  auto vector = makeRowVector(
+      {"c0", "c1", "c2", "c3"},
+      {
+          makeFlatVector<int64_t>(kSize, folly::identity),
+          makeFlatVector<int64_t>(
+              kSize, [](auto row) { return row * 3 % 101; }),
+          makeFlatVector<std::string>(
+              kSize,
+              [](auto row) { return std::string(row % 17, 'x'); },
+              nullEvery(11)),
+          makeFlatVector<double>(kSize, [](auto row) { return row * 0.1; }),
+      });
+  auto rowType = asRowType(vector->type());
+  auto filePaths = makeFilePaths(2);
+  for (const auto& filePath : filePaths) {
+    writeToFile(filePath->getPath(), {vector});
+  }
+  createDuckDbTable({vector, vector});
+
+  auto assertPushdown = [&](const core::PlanNodePtr& plan,
+                            const std::string& duckDbSql) {
+    for (auto pushdown : {false, true}) {
+      SCOPED_TRACE(fmt::format("pushdown: {}", pushdown));
+      AssertQueryBuilder(duckDbQueryRunner_)
+          .plan(plan)
+          .connectorSessionProperty(
+              kHiveConnectorId,
+              connector::hive::HiveConfig::kReadExpressionFilterPushdownSession,
+              pushdown ? "true" : "false")
+          .splits(makeHiveConnectorSplits(filePaths))
+          .assertResults(duckDbSql);
+    }
+  };
+
+  assertPushdown(
+      PlanBuilder().tableScan(rowType, {}, "length(c2) > 10").planNode(),
+      "SELECT * FROM tmp WHERE length(c2) > 10");
+  assertPushdown(
+      PlanBuilder()
+          .tableScan(rowType, {}, "c0 % 7 = 0 AND c0 + c1 > 3 * c1")
+          .planNode(),
+      "SELECT * FROM tmp WHERE c0 % 7 = 0 AND c0 + c1 > 3 * c1");
+
+  // Subfield filter followed by an expression filter on the same column.
+  assertPushdown(
+      PlanBuilder()
+          .tableScan(rowType, {"c0 >= 100"}, "c0 % 7 = 0 AND length(c2) > 5")
+          .planNode(),
+      "SELECT * FROM tmp WHERE c0 >= 100 AND c0 % 7 = 0 AND length(c2) > 5");
+
+  // Non-deterministic conjuncts stay in the remaining filter.
+  assertPushdown(
+      PlanBuilder()
+          .tableScan(rowType, {}, "c1 % 3 = 0 AND rand() < 2.0")
+          .planNode(),
+      "SELECT * FROM tmp WHERE c1 % 3 = 0");
+
+  // Filter inputs that are not projected out.
+  assertPushdown(
+      PlanBuilder()
+          .startTableScan()
+          .outputType(ROW({"c3"}, {DOUBLE()}))
+          .remainingFilter("c0 % 5 = 1 AND length(c2) < 3")
+          .dataColumns(rowType)
+          .endTableScan()
+          .planNode(),
+      "SELECT c3 FROM tmp WHERE c0 % 5 = 1 AND length(c2) < 3");
+
+  // No row passes.
+  assertPushdown(
+      PlanBuilder().tableScan(rowType, {}, "c1 > 1000").planNode(),
+      "SELECT * FROM tmp WHERE c1 > 1000");
+}
+
 TEST_F(TableScanTest, remainingFilterLazyWithMultiReferences) {
   constexpr int kSize = 10;
   auto vector = makeRowVector({
@@ -5745,6 +5980,91 @@ TEST_F(TableScanTest, statsBasedFilterReorderDisabled) {
   }
 }
 
+TEST_F(TableScanTest, batchSizeAdaptsToRowWidth) {
+  constexpr vector_size_t kSize = 200;
+  constexpr size_t kWideStringBytes = 50 << 10;
+  constexpr size_t kPreferredOutputBatchBytes = 1 << 20;
+  auto makeStrings = [&](size_t stringBytes) {
+    return makeRowVector({
+        makeFlatVector<int64_t>(kSize, folly::identity),
+        makeFlatVector<std::string>(
+            kSize, [&](auto row) { return std::string(stringBytes, 'a'); }),
+    });
+  };
+  auto narrow = makeStrings(10);
+  auto wide = makeStrings(kWideStringBytes);
+  auto narrowFile = TempFilePath::create();
+  writeToFile(narrowFile->getPath(), {narrow});
+  auto wideFile = TempFilePath::create();
+  writeToFile(wideFile->getPath(), {wide});
+  createDuckDbTable({narrow, wide});
+
+  auto plan = PlanBuilder().tableScan(asRowType(narrow->type())).planNode();
+  auto task = AssertQueryBuilder(duckDbQueryRunner_)
+                  .plan(plan)
+                  .split(makeHiveConnectorSplit(narrowFile->getPath()))
+                  .split(makeHiveConnectorSplit(wideFile->getPath()))
+                  .config(
+                      QueryConfig::kPreferredOutputBatchBytes,
+                      folly::to<std::string>(kPreferredOutputBatchBytes))
+                  .assertResults("SELECT * FROM tmp");
+  const auto opStats = task->taskStats().pipelineStats[0].operatorStats[0];
+  const auto& readBatchSize = opStats.runtimeStats.at("readBatchSize");
+  // The narrow file is read in one batch. The wide file, including its first
+  // batch, is read in batches of about the preferred size.
+  EXPECT_GE(readBatchSize.max, kSize);
+  EXPECT_LE(readBatchSize.min, kPreferredOutputBatchBytes / kWideStringBytes);
+  EXPECT_GE(
+      opStats.outputVectors,
+      1 + kSize * kWideStringBytes / kPreferredOutputBatchBytes);
+}
+
+TEST_F(TableScanTest, deferNonFilterStreams) {
+  gflags::FlagSaver gflagSaver;
+  // Prefetch every stream that is not deferred.
+  FLAGS_cache_prefetch_min_pct = 0;
+  constexpr vector_size_t kSize = 1'000;
+  folly::Random::DefaultGenerator rng(1);
+  // No row has c0 = 50, but the column statistics do not exclude it.
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(
+          kSize, [](auto row) { return row % 100 == 50 ? 51 : row % 100; }),
+      makeFlatVector<std::string>(
+          kSize,
+          [&](auto /*row*/) {
+            std::string value(1'000, ' ');
+            for (auto& c : value) {
+              c = static_cast<char>(folly::Random::rand32(256, rng));
+            }
+            return value;
+          }),
+  });
+  createDuckDbTable({data});
+  auto plan = PlanBuilder()
+                  .tableScan(asRowType(data->type()), {"c0 = 50"})
+                  .planNode();
+  auto readBytes = [&](bool defer) {
+    // A new file each time, so that the data cache is not hit.
+    auto file = TempFilePath::create();
+    writeToFile(file->getPath(), {data});
+    auto task = AssertQueryBuilder(duckDbQueryRunner_)
+                    .plan(plan)
+                    .split(makeHiveConnectorSplit(file->getPath()))
+                    .connectorSessionProperty(
+                        kHiveConnectorId,
+                        connector::hive::HiveConfig::
+                            kDeferNonFilterStreamsSession,
+                        defer ? "true" : "false")
+                    .assertResults("SELECT * FROM tmp WHERE c0 = 50");
+    return getTableScanRuntimeStats(task).at("storageReadBytes").sum;
+  };
+  const auto prefetched = readBytes(false);
+  const auto deferred = readBytes(true);
+  // The payload column is not read when no row passes the filter.
+  EXPECT_GT(prefetched, kSize * 900);
+  EXPECT_LT(deferred, prefetched / 10);
+}
+
 TEST_F(TableScanTest, prevBatchEmptyAdaptivity) {
   auto rowType = ROW({"c0", "c1"}, {BIGINT(), VARCHAR()});
 
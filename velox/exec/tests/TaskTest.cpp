@@ -930,6 +930,82 @@ TEST_F(TaskTest, testTerminateDeadlock) {
       cursor->task()->toString().find("zombie drivers:"), std::string::npos);
 }
 
+TEST_F(TaskTest, parallelTaskCursor) {
+  std::vector<RowVectorPtr> data;
+  for (auto i = 0; i < 10; ++i) {
+    data.push_back(makeRowVector({makeFlatVector<int64_t>(
+        100, [i](auto row) { return i * 100 + row; })}));
+  }
+  createDuckDbTable(data);
+
+  // Reads all batches with one thread per consumer.
+  auto consume = [](ParallelTaskCursor& cursor) {
+    std::vector<std::vector<ParallelTaskCursor::Batch>> batches(
+        cursor.numConsumers());
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < cursor.numConsumers(); ++i) {
+      threads.emplace_back([&, i]() {
+        while (auto batch = cursor.next(i)) {
+          batches[i].push_back(std::move(batch.value()));
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    return batches;
+  };
+
+  // Four output drivers spread over three consumers.
+  CursorParameters params;
+  params.planNode = PlanBuilder().values(data, true).planNode();
+  params.maxDrivers = 4;
+  params.numConsumers = 3;
+  {
+    auto cursor = ParallelTaskCursor::create(params);
+    cursor->start();
+    auto batches = consume(*cursor);
+    std::vector<RowVectorPtr> result;
+    for (const auto& consumerBatches : batches) {
+      ASSERT_FALSE(consumerBatches.empty());
+      for (auto i = 0; i < consumerBatches.size(); ++i) {
+        ASSERT_EQ(consumerBatches[i].sequenceNumber, i);
+        result.push_back(consumerBatches[i].vector);
+      }
+    }
+    assertResults(
+        result,
+        params.planNode->outputType(),
+        "SELECT * FROM tmp UNION ALL SELECT * FROM tmp "
+        "UNION ALL SELECT * FROM tmp UNION ALL SELECT * FROM tmp",
+        duckDbQueryRunner_);
+    ASSERT_TRUE(waitForTaskCompletion(cursor->task().get()));
+  }
+
+  // With ordered delivery the sequence numbers restore the output order.
+  params.planNode = PlanBuilder().values(data).planNode();
+  params.maxDrivers = 1;
+  params.orderedDelivery = true;
+  {
+    auto cursor = ParallelTaskCursor::create(params);
+    cursor->start();
+    auto batches = consume(*cursor);
+    std::vector<RowVectorPtr> result(data.size());
+    for (const auto& consumerBatches : batches) {
+      for (const auto& batch : consumerBatches) {
+        ASSERT_LT(batch.sequenceNumber, result.size());
+        ASSERT_EQ(result[batch.sequenceNumber], nullptr);
+        result[batch.sequenceNumber] = batch.vector;
+      }
+    }
+    for (auto i = 0; i < data.size(); ++i) {
+      ASSERT_NE(result[i], nullptr);
+      velox::test::assertEqualVectors(data[i], result[i]);
+    }
+    ASSERT_TRUE(waitForTaskCompletion(cursor->task().get()));
+  }
+}
+
 TEST_F(TaskTest, serialExecution) {
   auto data = makeRowVector({
       makeFlatVector<int64_t>(1'000, [](auto row) { return row; }),
@@ -2062,6 +2138,50 @@ TEST_F(TaskTest, spillDirectoryLifecycleManagement) {
   OperatorTestBase::deleteTaskAndCheckSpillDirectory(task);
 }
 
+TEST_F(TaskTest, spillDirectoryStriping) {
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(1'000, [](auto row) { return row % 300; }),
+      makeFlatVector<int64_t>(1'000, [](auto row) { return row; }),
+  });
+  const auto plan = PlanBuilder()
+                        .values({data})
+                        .singleAggregation({"c0"}, {"sum(c1)"}, {})
+                        .planNode();
+  CursorParameters params;
+  params.planNode = plan;
+  params.queryCtx = core::QueryCtx::create(driverExecutor_.get());
+  params.maxDrivers = 1;
+
+  auto cursor = TaskCursor::create(params);
+  std::shared_ptr<Task> task = cursor->task();
+  auto rootTempDir = exec::test::TempDirectoryPath::create();
+  const std::vector<std::string> spillDirectories{
+      rootTempDir->getPath() + "/disk0", rootTempDir->getPath() + "/disk1"};
+  task->setSpillDirectories(spillDirectories, false);
+  ASSERT_EQ(task->spillDirectory(), spillDirectories[0]);
+
+  // Both directories are on the same disk and are picked in turn.
+  std::unordered_map<std::string, int32_t> numPicks;
+  for (auto i = 0; i < 6; ++i) {
+    ++numPicks[task->getOrCreateSpillDirectory()];
+  }
+  auto fs = filesystems::getFileSystem(spillDirectories[0], nullptr);
+  for (const auto& directory : spillDirectories) {
+    ASSERT_TRUE(fs->exists(directory));
+    ASSERT_EQ(numPicks[directory], 3);
+  }
+
+  while (cursor->moveNext()) {
+  }
+  ASSERT_TRUE(waitForTaskCompletion(task.get(), 5'000'000));
+  cursor.reset();
+  task.reset();
+  waitForAllTasksToBeDeleted();
+  for (const auto& directory : spillDirectories) {
+    ASSERT_FALSE(fs->exists(directory));
+  }
+}
+
 TEST_F(TaskTest, spillDirNotCreated) {
   // Verify that no spill directory is created if spilling is not engaged.
   const std::vector<RowVectorPtr> probeVectors = {makeRowVector(
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "velox/common/base/tests/GTestUtils.h"
+#include "velox/exec/PlanNodeStats.h"
 #include "velox/exec/tests/utils/OperatorTestBase.h"
 #include "velox/exec/tests/utils/PlanBuilder.h"
 
@@ -128,6 +129,47 @@ TEST_F(TopNTest, selectiveFilter) {
   testSingleKey(vectors, "c1", "c1 % 333 = 0");
 }
 
+TEST_F(TopNTest, threshold) {
+  vector_size_t batchSize = 1000;
+  std::vector<RowVectorPtr> vectors;
+  for (int32_t i = 0; i < 10; ++i) {
+    auto c0 = makeFlatVector<int64_t>(
+        batchSize,
+        [&](vector_size_t row) {
+          return (batchSize * i + row) * 7'919 % 10'007;
+        },
+        nullEvery(17));
+    auto c1 = makeFlatVector<int32_t>(
+        batchSize, [](vector_size_t row) { return row % 5; });
+    auto c2 = makeFlatVector<Timestamp>(
+        batchSize,
+        [&](vector_size_t row) {
+          return Timestamp(row % 101, (batchSize * i + row) % 1'000);
+        },
+        nullEvery(13));
+    vectors.push_back(makeRowVector({c0, c1, c2}));
+  }
+  createDuckDbTable(vectors);
+
+  testSingleKey(vectors, "c0", 10);
+  testSingleKey(vectors, "c2", 10);
+  // Rows with a first key equal to the threshold are decided on the second
+  // key.
+  testTwoKeys(vectors, "c1", "c0", 10);
+
+  core::PlanNodeId topNId;
+  auto plan = PlanBuilder()
+                  .values(vectors)
+                  .topN({"c0"}, 10, false)
+                  .capturePlanNodeId(topNId)
+                  .planNode();
+  auto task = assertQueryOrdered(
+      plan, "SELECT * FROM tmp ORDER BY c0 NULLS LAST LIMIT 10", {0});
+  auto stats = toPlanStats(task->taskStats()).at(topNId);
+  // Most rows after the first batch are rejected on the threshold.
+  ASSERT_GT(stats.customStats.at("numThresholdRejectedRows").sum, 5'000);
+}
+
 TEST_F(TopNTest, singleKey) {
   vector_size_t batchSize = 1000;
   std::vector<RowVectorPtr> vectors;
@@ -90,14 +90,16 @@ TEST_F(TraceUtilTest, OperatorTraceSummary) {
   summary.peakMemory = 200;
   ASSERT_EQ(
       summary.toString(),
-      "opType summary, inputRows 100,  inputBytes 0B, rawInputRows 0, rawInputBytes 0B, peakMemory 200B");
+      "opType summary, inputRows 100,  inputBytes 0B, rawInputRows 0, rawInputBytes 0B, peakMemory 200B, cpuTime 0ns, wallTime 0ns");
   summary.numSplits = 10;
   summary.rawInputBytes = 222;
+  summary.cpuTimeNanos = 1'000;
+  summary.wallTimeNanos = 2'000;
   VELOX_ASSERT_THROW(summary.toString(), "summary vs. TableScan");
   summary.opType = "TableScan";
   ASSERT_EQ(
       summary.toString(),
-      "opType TableScan, numSplits 10, inputRows 100, inputBytes 0B, rawInputRows 0, rawInputBytes 222B, peakMemory 200B");
+      "opType TableScan, numSplits 10, inputRows 100, inputBytes 0B, rawInputRows 0, rawInputBytes 222B, peakMemory 200B, cpuTime 1.00us, wallTime 2.00us");
 }
 
 TEST_F(TraceUtilTest, traceDirectoryLayoutUtilities) {
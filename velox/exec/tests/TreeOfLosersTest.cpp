@@ -178,6 +178,47 @@ TEST_F(TreeOfLosersTest, allSorted) {
   }
 }
 
+TEST_F(TreeOfLosersTest, runnerUp) {
+  for (int numStreams : {1, 2, 5, 16, 37}) {
+    SCOPED_TRACE(fmt::format("numStreams: {}", numStreams));
+    std::vector<std::unique_ptr<TestingStream>> mergeStreams;
+    std::vector<TestingStream*> streams;
+    for (int i = 0; i < numStreams; ++i) {
+      std::vector<uint32_t> numbers;
+      const auto numValues = folly::Random::rand32(200, rng_);
+      for (auto j = 0; j < numValues; ++j) {
+        numbers.push_back(folly::Random::rand32(1'000, rng_));
+      }
+      // TestingStream produces reverse order.
+      std::sort(numbers.rbegin(), numbers.rend());
+      mergeStreams.push_back(
+          std::make_unique<TestingStream>(std::move(numbers)));
+      streams.push_back(mergeStreams.back().get());
+    }
+    TreeOfLosers<TestingStream> merge(std::move(mergeStreams));
+    while (auto* stream = merge.next()) {
+      std::optional<uint32_t> expected;
+      for (auto* other : streams) {
+        if (other != stream && other->hasData() &&
+            (!expected.has_value() ||
+             other->current()->value() < expected.value())) {
+          expected = other->current()->value();
+        }
+      }
+      auto* runnerUp = merge.runnerUp();
+      if (!expected.has_value()) {
+        ASSERT_TRUE(runnerUp == nullptr);
+      } else {
+        ASSERT_TRUE(runnerUp != nullptr);
+        ASSERT_NE(runnerUp, stream);
+        ASSERT_EQ(runnerUp->current()->value(), expected.value());
+        ASSERT_LE(stream->current()->value(), expected.value());
+      }
+      stream->pop();
+    }
+  }
+}
+
 TEST_F(TreeOfLosersTest, allEmpty) {
   for (bool testNextEqual : {false, true}) {
     for (int numStreams : {0, 1, 5, 100}) {
@@ -906,6 +906,42 @@ TEST_P(UnnestTest, barrier) {
   }
 }
 
+TEST_P(UnnestTest, splitOutputZeroCopy) {
+  // Large arrays split into multiple output batches produce slices of the
+  // input elements instead of copies.
+  const vector_size_t numRows = 3;
+  const vector_size_t arraySize = 1'000;
+  auto vector = makeRowVector({
+      makeFlatVector<int64_t>(numRows, [](auto row) { return row; }),
+      makeArrayVector<int32_t>(
+          numRows,
+          [&](auto /*row*/) { return arraySize; },
+          [](auto row, auto index) { return row * 10'000 + index; }),
+  });
+  createDuckDbTable({vector});
+
+  auto plan = PlanBuilder().values({vector}).unnest({"c0"}, {"c1"}).planNode();
+  auto params = makeCursorParameters(plan);
+  params.queryConfigs[core::QueryConfig::kUnnestSplitOutput] = "true";
+  auto [cursor, results] = readCursor(params);
+
+  const auto* rawElements = vector->childAt(1)
+                                ->as<ArrayVector>()
+                                ->elements()
+                                ->values()
+                                ->as<int32_t>();
+  vector_size_t numOutputRows{0};
+  for (const auto& result : results) {
+    ASSERT_LE(result->size(), batchSize_);
+    const auto& elements = result->childAt(1);
+    ASSERT_EQ(elements->encoding(), VectorEncoding::Simple::FLAT);
+    ASSERT_EQ(elements->values()->as<int32_t>(), rawElements + numOutputRows);
+    numOutputRows += result->size();
+  }
+  ASSERT_EQ(numOutputRows, numRows * arraySize);
+  assertQuery(params, "SELECT c0, UNNEST(c1) FROM tmp");
+}
+
 TEST_P(UnnestTest, spiltOutput) {
   std::vector<RowVectorPtr> vectors;
   const auto numBatches = 3;
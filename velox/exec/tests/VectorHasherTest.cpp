@@ -1197,3 +1197,106 @@ TEST_F(VectorHasherTest, customComparisonRow) {
               {std::nullopt, 0, 1, 0, 1, 0, 1},
               velox::test::BIGINT_TYPE_WITH_CUSTOM_COMPARISON())}));
 }
+
+TEST_F(VectorHasherTest, complexTypes) {
+  // ROW and ARRAY values are hashed one field or all elements at a time. The
+  // hashes must be the same as the ones of BaseVector::hashValueAt().
+  auto array = makeNullableArrayVector<int64_t>(
+      {{{1, 2}},
+       std::nullopt,
+       {{}},
+       {{1, std::nullopt, 3}},
+       {{4, 5, 6, 7}},
+       {{2, 1}}});
+  auto row = makeRowVector(
+      {makeNullableFlatVector<int32_t>({1, std::nullopt, 3, 4, 5, 6}),
+       makeFlatVector<std::string>({"a", "b", "c", "d", "e", "f"}),
+       array},
+      [](auto row) { return row == 4; });
+  auto test = [&](const VectorPtr& vector) {
+    SCOPED_TRACE(vector->toString());
+    auto hasher = exec::VectorHasher::create(vector->type(), 0);
+    SelectivityVector rows(vector->size());
+    rows.setValid(2, false);
+    rows.updateBounds();
+    for (auto mix : {false, true}) {
+      raw_vector<uint64_t> hashes(vector->size());
+      std::fill(hashes.begin(), hashes.end(), 11);
+      hasher->decode(*vector, rows);
+      hasher->hash(rows, mix, hashes);
+      rows.applyToSelected([&](auto i) {
+        const auto expected = vector->hashValueAt(i);
+        EXPECT_EQ(mix ? bits::hashMix(11, expected) : expected, hashes[i])
+            << "at " << i;
+      });
+    }
+  };
+
+  test(array);
+  test(row);
+  test(wrapInDictionary(makeIndices({5, 0, 0, 3, 1, 4, 2}), row));
+  test(BaseVector::wrapInConstant(4, 3, row));
+}
+
+TEST_F(VectorHasherTest, hashAll) {
+  const vector_size_t size = 100;
+  // Runs of flat fixed-width keys are separated by keys hashed one at a time.
+  std::vector<VectorPtr> keys{
+      makeFlatVector<int64_t>(
+          size, [](auto row) { return row * 7; }, nullEvery(5)),
+      makeFlatVector<int32_t>(size, [](auto row) { return row % 13; }),
+      makeFlatVector<double>(
+          size,
+          [](auto row) {
+            return row % 11 == 0 ? std::numeric_limits<double>::quiet_NaN()
+                                 : row * 0.5;
+          },
+          nullEvery(3)),
+      makeFlatVector<std::string>(
+          size, [](auto row) { return fmt::format("s{}", row % 17); }),
+      makeFlatVector<int16_t>(size, [](auto row) { return row % 300; }),
+      wrapInDictionary(
+          makeIndicesInReverse(size),
+          makeFlatVector<int64_t>(size, [](auto row) { return row; })),
+      makeConstant<int8_t>(3, size),
+      makeFlatVector<float>(size, [](auto row) { return row * 0.25f; }),
+      makeFlatVector<int8_t>(
+          size, [](auto row) { return row % 100; }, nullEvery(7)),
+      makeFlatVector<int64_t>(
+          size,
+          [](auto row) { return row % 256; },
+          nullptr,
+          BIGINT_TYPE_WITH_CUSTOM_COMPARISON())};
+  // More consecutive flat keys than are hashed in one pass.
+  for (auto i = 0; i < VectorHasher::kMaxFlatKeys + 2; ++i) {
+    keys.push_back(makeFlatVector<int64_t>(
+        size, [i](auto row) { return row * i; }, nullEvery(11 + i)));
+  }
+
+  std::vector<std::unique_ptr<VectorHasher>> hashers;
+  for (auto i = 0; i < keys.size(); ++i) {
+    hashers.push_back(VectorHasher::create(keys[i]->type(), i));
+  }
+  // A precomputed constant key.
+  hashers.push_back(VectorHasher::create(BIGINT(), kConstantChannel));
+  hashers.back()->precompute(*makeConstant<int64_t>(12, 1));
+
+  for (const auto* rows : {&allRows_, &oddRows_}) {
+    for (auto i = 0; i < keys.size(); ++i) {
+      hashers[i]->decode(*keys[i], *rows);
+    }
+    raw_vector<uint64_t> expected(size);
+    for (auto i = 0; i < hashers.size(); ++i) {
+      if (hashers[i]->channel() == kConstantChannel) {
+        hashers[i]->hashPrecomputed(*rows, i > 0, expected);
+      } else {
+        hashers[i]->hash(*rows, i > 0, expected);
+      }
+    }
+
+    raw_vector<uint64_t> hashes(size);
+    VectorHasher::hashAll(hashers, *rows, hashes);
+    rows->applyToSelected(
+        [&](auto row) { ASSERT_EQ(hashes[row], expected[row]) << row; });
+  }
+}
@@ -157,6 +157,45 @@ TEST_F(WindowTest, spillUnsupported) {
       opStats.at("Window").runtimeStats[Operator::kSpillNotSupported].sum, 1);
 }
 
+TEST_F(WindowTest, parallelPartitions) {
+  const vector_size_t size = 10'000;
+  auto data = makeRowVector(
+      {"d", "p", "s"},
+      {
+          // Payload.
+          makeFlatVector<int64_t>(
+              size, [](auto row) { return row * 7 % 101; }, nullEvery(9)),
+          // Partition key with a few large and many small partitions.
+          makeFlatVector<int32_t>(
+              size, [](auto row) { return row % 3 == 0 ? row % 4 : row; }),
+          // Sorting key.
+          makeFlatVector<int32_t>(size, [](auto row) { return row; }),
+      });
+
+  createDuckDbTable({data});
+
+  const std::vector<std::string> functions = {
+      "row_number() over (partition by p order by s)",
+      "sum(d) over (partition by p order by s rows between 100 preceding and "
+      "current row)",
+      "nth_value(d, 3) over (partition by p order by s)",
+  };
+  auto plan = PlanBuilder()
+                  .values(split(data, 10))
+                  .window(functions)
+                  .planNode();
+  const auto sql =
+      fmt::format("SELECT *, {} FROM tmp", folly::join(", ", functions));
+  for (const auto* numThreads : {"1", "4"}) {
+    SCOPED_TRACE(numThreads);
+    AssertQueryBuilder(plan, duckDbQueryRunner_)
+        .config(core::QueryConfig::kPreferredOutputBatchRows, "100")
+        .config(core::QueryConfig::kMaxOutputBatchRows, "100")
+        .config(core::QueryConfig::kWindowParallelPartitionThreads, numThreads)
+        .assertResults(sql);
+  }
+}
+
 TEST_F(WindowTest, rowBasedStreamingWindowOOM) {
   const vector_size_t size = 1'000'000;
   auto data = makeRowVector(
@@ -17,14 +17,14 @@
 #include "velox/exec/tests/utils/LocalRunnerTestBase.h"
 #include "velox/connectors/hive/HiveConfig.h"
 #include "velox/connectors/hive/HiveConnector.h"
-#include "velox/exec/tests/utils/LocalExchangeSource.h"
+#include "velox/runner/LocalExchangeSource.h"
 
 namespace facebook::velox::exec::test {
 
 void LocalRunnerTestBase::SetUp() {
   HiveConnectorTestBase::SetUp();
   exec::ExchangeSource::factories().clear();
-  exec::ExchangeSource::registerFactory(createLocalExchangeSource);
+  exec::ExchangeSource::registerFactory(runner::createLocalExchangeSource);
   ensureTestData();
 }
 
@@ -21,6 +21,7 @@
 #include "velox/duckdb/conversion/DuckParser.h"
 #include "velox/exec/Aggregate.h"
 #include "velox/exec/HashPartitionFunction.h"
+#include "velox/exec/RangePartitionFunction.h"
 #include "velox/exec/RoundRobinPartitionFunction.h"
 #include "velox/exec/TableWriter.h"
 #include "velox/exec/WindowFunction.h"
@@ -770,14 +771,15 @@ class AggregateTypeResolver {
 
 core::PlanNodePtr PlanBuilder::createIntermediateOrFinalAggregation(
     core::AggregationNode::Step step,
-    const core::AggregationNode* partialAggNode) {
+    const core::AggregationNode* partialAggNode,
+    const std::optional<std::vector<core::FieldAccessTypedExprPtr>>&
+        groupingKeys) {
   // Create intermediate or final aggregation using same grouping keys and same
   // aggregate function names.
   const auto& partialAggregates = partialAggNode->aggregates();
-  const auto& groupingKeys = partialAggNode->groupingKeys();
 
   auto numAggregates = partialAggregates.size();
-  auto numGroupingKeys = groupingKeys.size();
+  auto numGroupingKeys = partialAggNode->groupingKeys().size();
 
   std::vector<core::AggregationNode::Aggregate> aggregates;
   aggregates.reserve(numAggregates);
@@ -811,7 +813,7 @@ core::PlanNodePtr PlanBuilder::createIntermediateOrFinalAggregation(
   auto aggregationNode = std::make_shared<core::AggregationNode>(
       nextPlanNodeId(),
       step,
-      groupingKeys,
+      groupingKeys.value_or(partialAggNode->groupingKeys()),
       partialAggNode->preGroupedKeys(),
       partialAggNode->aggregateNames(),
       aggregates,
@@ -1093,6 +1095,35 @@ PlanBuilder& PlanBuilder::groupId(
   return *this;
 }
 
+PlanBuilder& PlanBuilder::groupingSetsAggregation(
+    const std::vector<std::string>& groupingKeys,
+    const std::vector<std::vector<std::string>>& groupingSets,
+    const std::vector<std::string>& aggregates,
+    const std::string& groupIdName) {
+  partialAggregation(groupingKeys, aggregates);
+  const auto partialAggNode =
+      std::dynamic_pointer_cast<const core::AggregationNode>(planNode_);
+  VELOX_CHECK_NOT_NULL(partialAggNode);
+  VELOX_CHECK(
+      partialAggNode->preGroupedKeys().empty(),
+      "Pre-grouped keys are not supported");
+
+  // Replicate the partial aggregation results for each grouping set.
+  groupId(
+      groupingKeys,
+      groupingSets,
+      partialAggNode->aggregateNames(),
+      groupIdName);
+
+  std::vector<std::string> finalGroupingKeys = groupingKeys;
+  finalGroupingKeys.push_back(groupIdName);
+  planNode_ = createIntermediateOrFinalAggregation(
+      core::AggregationNode::Step::kFinal,
+      partialAggNode.get(),
+      fields(finalGroupingKeys));
+  return *this;
+}
+
 namespace {
 core::PlanNodePtr createLocalMergeNode(
     const core::PlanNodeId& id,
@@ -1459,6 +1490,30 @@ PlanBuilder& PlanBuilder::localPartition(
   return *this;
 }
 
+PlanBuilder& PlanBuilder::localPartitionByRange(
+    const std::vector<std::string>& keys,
+    const RowVectorPtr& splitters) {
+  const auto& inputType = planNode_->outputType();
+  std::vector<column_index_t> keyChannels;
+  keyChannels.reserve(keys.size());
+  for (const auto& key : keys) {
+    keyChannels.push_back(inputType->getChildIdx(key));
+  }
+  auto rangePartitionFunctionSpec =
+      std::make_shared<RangePartitionFunctionSpec>(
+          inputType,
+          std::move(keyChannels),
+          std::vector<core::SortOrder>(keys.size(), core::kAscNullsLast),
+          splitters);
+  planNode_ = std::make_shared<core::LocalPartitionNode>(
+      nextPlanNodeId(),
+      core::LocalPartitionNode::Type::kRepartition,
+      /*scaleWriter=*/false,
+      std::move(rangePartitionFunctionSpec),
+      std::vector<core::PlanNodePtr>{planNode_});
+  return *this;
+}
+
 PlanBuilder& PlanBuilder::localPartitionByBucket(
     const std::shared_ptr<connector::hive::HiveBucketProperty>&
         bucketProperty) {
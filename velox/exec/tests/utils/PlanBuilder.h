@@ -919,6 +919,31 @@ class PlanBuilder {
       const std::vector<std::string>& aggregationInputs,
       std::string groupIdName = "group_id");
 
+  /// Add a plan that computes aggregates over grouping sets, e.g. for GROUPING
+  /// SETS, CUBE and ROLLUP, without replicating the input rows. The plan is a
+  /// partial aggregation over all the grouping keys, followed by a GroupIdNode
+  /// over the partial aggregation results and a final aggregation over the
+  /// grouping keys and the group ID column. The output consists of grouping
+  /// keys, followed by the group ID column, followed by the aggregates.
+  ///
+  /// The GroupIdNode replicates one row per distinct combination of all the
+  /// grouping keys instead of one row per input row. The aggregates must be
+  /// decomposable into partial and final steps, i.e. can't use masks,
+  /// DISTINCT or ORDER BY. Use groupId() followed by singleAggregation() for
+  /// these.
+  ///
+  /// @param groupingKeys Names of grouping key input columns. Aliases are not
+  /// supported.
+  /// @param groupingSets Grouping sets over 'groupingKeys'.
+  /// @param aggregates Aggregate expressions over the input columns. See
+  /// 'partialAggregation' method for the supported types of aggregate
+  /// expressions.
+  PlanBuilder& groupingSetsAggregation(
+      const std::vector<std::string>& groupingKeys,
+      const std::vector<std::vector<std::string>>& groupingSets,
+      const std::vector<std::string>& aggregates,
+      const std::string& groupIdName = "group_id");
+
   /// Add an ExpandNode using specified projections. See comments for
   /// ExpandNode class for description of this plan node.
   ///
@@ -1082,6 +1107,15 @@ class PlanBuilder {
       const std::shared_ptr<connector::hive::HiveBucketProperty>&
           bucketProperty);
 
+  /// A convenience method to add a LocalPartitionNode with a single source (the
+  /// current plan node) that partitions the input on ranges of 'keys' in
+  /// ascending order with nulls last. 'splitters' has one column per key and
+  /// separates the ranges. Partitions of inputs sorted on 'keys' remain
+  /// sorted, e.g. to run a merge join over the ranges in parallel.
+  PlanBuilder& localPartitionByRange(
+      const std::vector<std::string>& keys,
+      const RowVectorPtr& splitters);
+
   /// Add a LocalPartitionNode to partition the input using batch-level
   /// round-robin. Number of partitions is determined at runtime based on
   /// parallelism of the downstream pipeline.
@@ -1435,9 +1469,15 @@ class PlanBuilder {
       const RowTypePtr& inputType,
       const std::string& name);
 
+  // Creates intermediate or final aggregation over the current plan node to
+  // match 'partialAggNode'. Uses the grouping keys of 'partialAggNode' unless
+  // 'groupingKeys' is specified. The aggregation inputs are expected to follow
+  // the first 'partialAggNode' grouping keys in the current plan node output.
   core::PlanNodePtr createIntermediateOrFinalAggregation(
       core::AggregationNode::Step step,
-      const core::AggregationNode* partialAggNode);
+      const core::AggregationNode* partialAggNode,
+      const std::optional<std::vector<core::FieldAccessTypedExprPtr>>&
+          groupingKeys = std::nullopt);
 
   struct AggregatesAndNames {
     std::vector<core::AggregationNode::Aggregate> aggregates;
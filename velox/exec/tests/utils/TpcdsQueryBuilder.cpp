@@ -0,0 +1,1063 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/tests/utils/TpcdsQueryBuilder.h"
+#include "velox/common/base/Fs.h"
+#include "velox/common/file/FileSystems.h"
+#include "velox/dwio/common/ReaderFactory.h"
+
+#include <fstream>
+
+namespace facebook::velox::exec::test {
+
+namespace {
+
+/// Returns a 'between' filter on a date column. DWRF files store dates as
+/// VARCHAR, so the bounds are only cast to DATE for other formats.
+std::string dateBetweenFilter(
+    const std::string& column,
+    const RowTypePtr& rowType,
+    const std::string& lowerBound,
+    const std::string& upperBound) {
+  const bool isVarchar = rowType->findChild(column)->isVarchar();
+  const auto* suffix = isVarchar ? "" : "::DATE";
+  return fmt::format(
+      "{} between {}{} and {}{}",
+      column,
+      lowerBound,
+      suffix,
+      upperBound,
+      suffix);
+}
+
+} // namespace
+
+void TpcdsQueryBuilder::readFileSchema(
+    const std::string& tableName,
+    const std::string& filePath,
+    const std::vector<std::string>& columns) {
+  dwio::common::ReaderOptions readerOptions{pool_.get()};
+  readerOptions.setFileFormat(format_);
+  auto uniqueReadFile =
+      filesystems::getFileSystem(filePath, nullptr)->openFileForRead(filePath);
+  std::shared_ptr<ReadFile> readFile;
+  readFile.reset(uniqueReadFile.release());
+  auto input = std::make_unique<dwio::common::BufferedInput>(
+      readFile, readerOptions.memoryPool());
+  std::unique_ptr<dwio::common::Reader> reader =
+      dwio::common::getReaderFactory(readerOptions.fileFormat())
+          ->createReader(std::move(input), readerOptions);
+  const auto fileType = reader->rowType();
+  const auto& fileColumnNames = fileType->names();
+  // There can be extra columns in the file towards the end.
+  VELOX_CHECK_GE(
+      fileColumnNames.size(),
+      columns.size(),
+      "Too few columns in {} file {}",
+      tableName,
+      filePath);
+  std::unordered_map<std::string, std::string> fileColumnNamesMap(
+      columns.size());
+  for (auto i = 0; i < columns.size(); ++i) {
+    fileColumnNamesMap[columns[i]] = fileColumnNames[i];
+  }
+  auto columnNames = columns;
+  auto types = fileType->children();
+  types.resize(columnNames.size());
+  auto& metadata = tableMetadata_[tableName];
+  metadata.type =
+      std::make_shared<RowType>(std::move(columnNames), std::move(types));
+  metadata.fileColumnNames = std::move(fileColumnNamesMap);
+}
+
+void TpcdsQueryBuilder::initialize(const std::string& dataPath) {
+  for (const auto& [tableName, columns] : kTables_) {
+    const fs::path tablePath{dataPath + "/" + tableName};
+    std::vector<std::string> dataFiles;
+    std::error_code error;
+    for (auto const& dirEntry : fs::directory_iterator{
+             tablePath, std::filesystem::directory_options(), error}) {
+      if (!dirEntry.is_regular_file()) {
+        continue;
+      }
+      // Ignore hidden files.
+      if (dirEntry.path().filename().c_str()[0] == '.') {
+        continue;
+      }
+      dataFiles.push_back(dirEntry.path());
+    }
+    if (dataFiles.empty() && error) {
+      // 'tablePath' is a file listing one data file path per line.
+      std::ifstream file(tablePath);
+      std::string line;
+      while (std::getline(file, line)) {
+        dataFiles.push_back(line);
+      }
+    }
+    if (dataFiles.empty()) {
+      continue;
+    }
+    readFileSchema(tableName, dataFiles.front(), columns);
+    tableMetadata_[tableName].dataFiles = std::move(dataFiles);
+  }
+}
+
+const std::vector<int>& TpcdsQueryBuilder::getQueryIds() {
+  static const std::vector<int> kQueryIds = {3, 7, 27, 69, 98};
+  return kQueryIds;
+}
+
+const std::vector<std::string>& TpcdsQueryBuilder::getTableNames() {
+  return kTableNames_;
+}
+
+TpchPlan TpcdsQueryBuilder::getQueryPlan(int queryId) const {
+  switch (queryId) {
+    case 3:
+      return getQ3Plan();
+    case 7:
+      return getQ7Plan();
+    case 27:
+      return getQ27Plan();
+    case 69:
+      return getQ69Plan();
+    case 98:
+      return getQ98Plan();
+    default:
+      VELOX_NYI("TPC-DS query {} is not supported yet", queryId);
+  }
+}
+
+const std::vector<std::string>& TpcdsQueryBuilder::getTableFilePaths(
+    const std::string& tableName) const {
+  auto it = tableMetadata_.find(tableName);
+  VELOX_USER_CHECK(
+      it != tableMetadata_.end(),
+      "No data files found for TPC-DS table {}",
+      tableName);
+  return it->second.dataFiles;
+}
+
+RowTypePtr TpcdsQueryBuilder::getRowType(
+    const std::string& tableName,
+    const std::vector<std::string>& columnNames) const {
+  auto it = tableMetadata_.find(tableName);
+  VELOX_USER_CHECK(
+      it != tableMetadata_.end(),
+      "No data files found for TPC-DS table {}",
+      tableName);
+  auto columnSelector = std::make_shared<dwio::common::ColumnSelector>(
+      it->second.type, columnNames);
+  return columnSelector->buildSelectedReordered();
+}
+
+const std::unordered_map<std::string, std::string>&
+TpcdsQueryBuilder::getFileColumnNames(const std::string& tableName) const {
+  return tableMetadata_.at(tableName).fileColumnNames;
+}
+
+TpchPlan TpcdsQueryBuilder::getQ3Plan() const {
+  // select d_year, i_brand_id, i_brand, sum(ss_ext_sales_price) sum_agg
+  // from date_dim, store_sales, item
+  // where d_date_sk = ss_sold_date_sk and ss_item_sk = i_item_sk
+  //   and i_manufact_id = 128 and d_moy = 11
+  // group by d_year, i_brand, i_brand_id
+  // order by d_year, sum_agg desc, i_brand_id limit 100
+  const auto dateRowType =
+      getRowType(kDateDim, {"d_date_sk", "d_year", "d_moy"});
+  const auto itemRowType = getRowType(
+      kItem, {"i_item_sk", "i_brand_id", "i_brand", "i_manufact_id"});
+  const auto storeSalesRowType = getRowType(
+      kStoreSales, {"ss_sold_date_sk", "ss_item_sk", "ss_ext_sales_price"});
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  core::PlanNodeId dateScanId;
+  core::PlanNodeId itemScanId;
+  core::PlanNodeId storeSalesScanId;
+
+  auto dates =
+      PlanBuilder(planNodeIdGenerator, pool_.get())
+          .tableScan(
+              kDateDim,
+              dateRowType,
+              getFileColumnNames(kDateDim),
+              {"d_moy = 11"})
+          .captureScanNodeId(dateScanId)
+          .planNode();
+
+  auto items =
+      PlanBuilder(planNodeIdGenerator, pool_.get())
+          .tableScan(
+              kItem,
+              itemRowType,
+              getFileColumnNames(kItem),
+              {"i_manufact_id = 128"})
+          .captureScanNodeId(itemScanId)
+          .planNode();
+
+  auto plan =
+      PlanBuilder(planNodeIdGenerator, pool_.get())
+          .tableScan(
+              kStoreSales, storeSalesRowType, getFileColumnNames(kStoreSales))
+          .captureScanNodeId(storeSalesScanId)
+          .hashJoin(
+              {"ss_sold_date_sk"},
+              {"d_date_sk"},
+              dates,
+              "",
+              {"ss_item_sk", "ss_ext_sales_price", "d_year"})
+          .hashJoin(
+              {"ss_item_sk"},
+              {"i_item_sk"},
+              items,
+              "",
+              {"d_year", "i_brand_id", "i_brand", "ss_ext_sales_price"})
+          .partialAggregation(
+              {"d_year", "i_brand", "i_brand_id"},
+              {"sum(ss_ext_sales_price) AS sum_agg"})
+          .localPartition({"d_year", "i_brand", "i_brand_id"})
+          .finalAggregation()
+          .topN({"d_year", "sum_agg DESC", "i_brand_id"}, 100, true)
+          .localPartition(std::vector<std::string>{})
+          .topN({"d_year", "sum_agg DESC", "i_brand_id"}, 100, false)
+          .project({"d_year", "i_brand_id", "i_brand", "sum_agg"})
+          .planNode();
+
+  TpchPlan context;
+  context.plan = std::move(plan);
+  context.dataFiles[dateScanId] = getTableFilePaths(kDateDim);
+  context.dataFiles[itemScanId] = getTableFilePaths(kItem);
+  context.dataFiles[storeSalesScanId] = getTableFilePaths(kStoreSales);
+  context.dataFileFormat = format_;
+  return context;
+}
+
+TpchPlan TpcdsQueryBuilder::getQ7Plan() const {
+  // select i_item_id, avg(ss_quantity) agg1, avg(ss_list_price) agg2,
+  //   avg(ss_coupon_amt) agg3, avg(ss_sales_price) agg4
+  // from store_sales, customer_demographics, date_dim, item, promotion
+  // where ss_sold_date_sk = d_date_sk and ss_item_sk = i_item_sk
+  //   and ss_cdemo_sk = cd_demo_sk and ss_promo_sk = p_promo_sk
+  //   and cd_gender = 'M' and cd_marital_status = 'S'
+  //   and cd_education_status = 'College'
+  //   and (p_channel_email = 'N' or p_channel_event = 'N')
+  //   and d_year = 2000
+  // group by i_item_id order by i_item_id limit 100
+  const auto storeSalesRowType = getRowType(
+      kStoreSales,
+      {"ss_sold_date_sk",
+       "ss_item_sk",
+       "ss_cdemo_sk",
+       "ss_promo_sk",
+       "ss_quantity",
+       "ss_list_price",
+       "ss_sales_price",
+       "ss_coupon_amt"});
+  const auto demographicsRowType = getRowType(
+      kCustomerDemographics,
+      {"cd_demo_sk", "cd_gender", "cd_marital_status", "cd_education_status"});
+  const auto dateRowType = getRowType(kDateDim, {"d_date_sk", "d_year"});
+  const auto itemRowType = getRowType(kItem, {"i_item_sk", "i_item_id"});
+  const auto promotionRowType = getRowType(
+      kPromotion, {"p_promo_sk", "p_channel_email", "p_channel_event"});
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  core::PlanNodeId storeSalesScanId;
+  core::PlanNodeId demographicsScanId;
+  core::PlanNodeId dateScanId;
+  core::PlanNodeId itemScanId;
+  core::PlanNodeId promotionScanId;
+
+  auto demographics = PlanBuilder(planNodeIdGenerator, pool_.get())
+                          .tableScan(
+                              kCustomerDemographics,
+                              demographicsRowType,
+                              getFileColumnNames(kCustomerDemographics),
+                              {"cd_gender = 'M'",
+                               "cd_marital_status = 'S'",
+                               "cd_education_status = 'College'"})
+                          .captureScanNodeId(demographicsScanId)
+                          .planNode();
+
+  auto dates =
+      PlanBuilder(planNodeIdGenerator, pool_.get())
+          .tableScan(
+              kDateDim,
+              dateRowType,
+              getFileColumnNames(kDateDim),
+              {"d_year = 2000"})
+          .captureScanNodeId(dateScanId)
+          .planNode();
+
+  auto items =
+      PlanBuilder(planNodeIdGenerator, pool_.get())
+          .tableScan(kItem, itemRowType, getFileColumnNames(kItem))
+          .captureScanNodeId(itemScanId)
+          .planNode();
+
+  auto promotions =
+      PlanBuilder(planNodeIdGenerator, pool_.get())
+          .tableScan(
+              kPromotion,
+              promotionRowType,
+              getFileColumnNames(kPromotion),
+              {},
+              "p_channel_email = 'N' OR p_channel_event = 'N'")
+          .captureScanNodeId(promotionScanId)
+          .planNode();
+
+  const std::vector<std::string> measures = {
+      "ss_quantity", "ss_list_price", "ss_sales_price", "ss_coupon_amt"};
+  auto withKeys = [&](std::vector<std::string> keys) {
+    keys.insert(keys.end(), measures.begin(), measures.end());
+    return keys;
+  };
+
+  auto plan =
+      PlanBuilder(planNodeIdGenerator, pool_.get())
+          .tableScan(
+              kStoreSales, storeSalesRowType, getFileColumnNames(kStoreSales))
+          .captureScanNodeId(storeSalesScanId)
+          .hashJoin(
+              {"ss_cdemo_sk"},
+              {"cd_demo_sk"},
+              demographics,
+              "",
+              withKeys({"ss_sold_date_sk", "ss_item_sk", "ss_promo_sk"}))
+          .hashJoin(
+              {"ss_sold_date_sk"},
+              {"d_date_sk"},
+              dates,
+              "",
+              withKeys({"ss_item_sk", "ss_promo_sk"}))
+          .hashJoin(
+              {"ss_promo_sk"},
+              {"p_promo_sk"},
+              promotions,
+              "",
+              withKeys({"ss_item_sk"}))
+          .hashJoin(
+              {"ss_item_sk"}, {"i_item_sk"}, items, "", withKeys({"i_item_id"}))
+          .partialAggregation(
+              {"i_item_id"},
+              {"avg(ss_quantity) AS agg1",
+               "avg(ss_list_price) AS agg2",
+               "avg(ss_coupon_amt) AS agg3",
+               "avg(ss_sales_price) AS agg4"})
+          .localPartition({"i_item_id"})
+          .finalAggregation()
+          .topN({"i_item_id"}, 100, true)
+          .localPartition(std::vector<std::string>{})
+          .topN({"i_item_id"}, 100, false)
+          .planNode();
+
+  TpchPlan context;
+  context.plan = std::move(plan);
+  context.dataFiles[storeSalesScanId] = getTableFilePaths(kStoreSales);
+  context.dataFiles[demographicsScanId] =
+      getTableFilePaths(kCustomerDemographics);
+  context.dataFiles[dateScanId] = getTableFilePaths(kDateDim);
+  context.dataFiles[itemScanId] = getTableFilePaths(kItem);
+  context.dataFiles[promotionScanId] = getTableFilePaths(kPromotion);
+  context.dataFileFormat = format_;
+  return context;
+}
+
+TpchPlan TpcdsQueryBuilder::getQ27Plan() const {
+  // select i_item_id, s_state, grouping(s_state) g_state,
+  //   avg(ss_quantity) agg1, avg(ss_list_price) agg2,
+  //   avg(ss_coupon_amt) agg3, avg(ss_sales_price) agg4
+  // from store_sales, customer_demographics, date_dim, store, item
+  // where ss_sold_date_sk = d_date_sk and ss_item_sk = i_item_sk
+  //   and ss_store_sk = s_store_sk and ss_cdemo_sk = cd_demo_sk
+  //   and cd_gender = 'M' and cd_marital_status = 'S'
+  //   and cd_education_status = 'College' and d_year = 2002
+  //   and s_state in ('TN')
+  // group by rollup (i_item_id, s_state)
+  // order by i_item_id, s_state limit 100
+  const auto storeSalesRowType = getRowType(
+      kStoreSales,
+      {"ss_sold_date_sk",
+       "ss_item_sk",
+       "ss_cdemo_sk",
+       "ss_store_sk",
+       "ss_quantity",
+       "ss_list_price",
+       "ss_sales_price",
+       "ss_coupon_amt"});
+  const auto demographicsRowType = getRowType(
+      kCustomerDemographics,
+      {"cd_demo_sk", "cd_gender", "cd_marital_status", "cd_education_status"});
+  const auto dateRowType = getRowType(kDateDim, {"d_date_sk", "d_year"});
+  const auto storeRowType = getRowType(kStore, {"s_store_sk", "s_state"});
+  const auto itemRowType = getRowType(kItem, {"i_item_sk", "i_item_id"});
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  core::PlanNodeId storeSalesScanId;
+  core::PlanNodeId demographicsScanId;
+  core::PlanNodeId dateScanId;
+  core::PlanNodeId storeScanId;
+  core::PlanNodeId itemScanId;
+
+  auto demographics = PlanBuilder(planNodeIdGenerator, pool_.get())
+                          .tableScan(
+                              kCustomerDemographics,
+                              demographicsRowType,
+                              getFileColumnNames(kCustomerDemographics),
+                              {"cd_gender = 'M'",
+                               "cd_marital_status = 'S'",
+                               "cd_education_status = 'College'"})
+                          .captureScanNodeId(demographicsScanId)
+                          .planNode();
+
+  auto dates =
+      PlanBuilder(planNodeIdGenerator, pool_.get())
+          .tableScan(
+              kDateDim,
+              dateRowType,
+              getFileColumnNames(kDateDim),
+              {"d_year = 2002"})
+          .captureScanNodeId(dateScanId)
+          .planNode();
+
+  auto stores =
+      PlanBuilder(planNodeIdGenerator, pool_.get())
+          .tableScan(
+              kStore,
+              storeRowType,
+              getFileColumnNames(kStore),
+              {"s_state = 'TN'"})
+          .captureScanNodeId(storeScanId)
+          .planNode();
+
+  auto items =
+      PlanBuilder(planNodeIdGenerator, pool_.get())
+          .tableScan(kItem, itemRowType, getFileColumnNames(kItem))
+          .captureScanNodeId(itemScanId)
+          .planNode();
+
+  const std::vector<std::string> measures = {
+      "ss_quantity", "ss_list_price", "ss_sales_price", "ss_coupon_amt"};
+  auto withKeys = [&](std::vector<std::string> keys) {
+    keys.insert(keys.end(), measures.begin(), measures.end());
+    return keys;
+  };
+
+  auto plan =
+      PlanBuilder(planNodeIdGenerator, pool_.get())
+          .tableScan(
+              kStoreSales, storeSalesRowType, getFileColumnNames(kStoreSales))
+          .captureScanNodeId(storeSalesScanId)
+          .hashJoin(
+              {"ss_cdemo_sk"},
+              {"cd_demo_sk"},
+              demographics,
+              "",
+              withKeys({"ss_sold_date_sk", "ss_item_sk", "ss_store_sk"}))
+          .hashJoin(
+              {"ss_sold_date_sk"},
+              {"d_date_sk"},
+              dates,
+              "",
+              withKeys({"ss_item_sk", "ss_store_sk"}))
+          .hashJoin(
+              {"ss_store_sk"},
+              {"s_store_sk"},
+              stores,
+              "",
+              withKeys({"ss_item_sk", "s_state"}))
+          .hashJoin(
+              {"ss_item_sk"},
+              {"i_item_sk"},
+              items,
+              "",
+              withKeys({"i_item_id", "s_state"}))
+          // ROLLUP (i_item_id, s_state) expands every row into 3 grouping
+          // sets numbered 0, 1 and 2 in 'group_id'.
+          .groupId(
+              {"i_item_id", "s_state"},
+              {{"i_item_id", "s_state"}, {"i_item_id"}, {}},
+              measures)
+          .partialAggregation(
+              {"i_item_id", "s_state", "group_id"},
+              {"avg(ss_quantity) AS agg1",
+               "avg(ss_list_price) AS agg2",
+               "avg(ss_coupon_amt) AS agg3",
+               "avg(ss_sales_price) AS agg4"})
+          .localPartition({"i_item_id", "s_state", "group_id"})
+          .finalAggregation()
+          .project(
+              {"i_item_id",
+               "s_state",
+               "if(group_id = 0, 0, 1) AS g_state",
+               "agg1",
+               "agg2",
+               "agg3",
+               "agg4"})
+          .topN({"i_item_id", "s_state"}, 100, true)
+          .localPartition(std::vector<std::string>{})
+          .topN({"i_item_id", "s_state"}, 100, false)
+          .planNode();
+
+  TpchPlan context;
+  context.plan = std::move(plan);
+  context.dataFiles[storeSalesScanId] = getTableFilePaths(kStoreSales);
+  context.dataFiles[demographicsScanId] =
+      getTableFilePaths(kCustomerDemographics);
+  context.dataFiles[dateScanId] = getTableFilePaths(kDateDim);
+  context.dataFiles[storeScanId] = getTableFilePaths(kStore);
+  context.dataFiles[itemScanId] = getTableFilePaths(kItem);
+  context.dataFileFormat = format_;
+  return context;
+}
+
+TpchPlan TpcdsQueryBuilder::getQ69Plan() const {
+  // select cd_gender, cd_marital_status, cd_education_status, count(*) cnt1,
+  //   cd_purchase_estimate, count(*) cnt2, cd_credit_rating, count(*) cnt3
+  // from customer c, customer_address ca, customer_demographics
+  // where c.c_current_addr_sk = ca.ca_address_sk
+  //   and ca_state in ('KY', 'GA', 'NM')
+  //   and cd_demo_sk = c.c_current_cdemo_sk
+  //   and exists (select * from store_sales, date_dim
+  //     where c.c_customer_sk = ss_customer_sk and ss_sold_date_sk = d_date_sk
+  //       and d_year = 2001 and d_moy between 4 and 6)
+  //   and not exists (select * from web_sales, date_dim
+  //     where c.c_customer_sk = ws_bill_customer_sk
+  //       and ws_sold_date_sk = d_date_sk
+  //       and d_year = 2001 and d_moy between 4 and 6)
+  //   and not exists (select * from catalog_sales, date_dim
+  //     where c.c_customer_sk = cs_ship_customer_sk
+  //       and cs_sold_date_sk = d_date_sk
+  //       and d_year = 2001 and d_moy between 4 and 6)
+  // group by cd_gender, cd_marital_status, cd_education_status,
+  //   cd_purchase_estimate, cd_credit_rating
+  // order by cd_gender, cd_marital_status, cd_education_status,
+  //   cd_purchase_estimate, cd_credit_rating
+  // limit 100
+  const auto customerRowType = getRowType(
+      kCustomer, {"c_customer_sk", "c_current_cdemo_sk", "c_current_addr_sk"});
+  const auto addressRowType =
+      getRowType(kCustomerAddress, {"ca_address_sk", "ca_state"});
+  const auto demographicsRowType = getRowType(
+      kCustomerDemographics,
+      {"cd_demo_sk",
+       "cd_gender",
+       "cd_marital_status",
+       "cd_education_status",
+       "cd_purchase_estimate",
+       "cd_credit_rating"});
+  const auto dateRowType =
+      getRowType(kDateDim, {"d_date_sk", "d_year", "d_moy"});
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  core::PlanNodeId customerScanId;
+  core::PlanNodeId addressScanId;
+  core::PlanNodeId demographicsScanId;
+  std::vector<core::PlanNodeId> dateScanIds;
+  std::vector<core::PlanNodeId> salesScanIds;
+
+  // Returns the customers with a sale in the 'sales' table in Q2 2001.
+  auto customersWithSales = [&](const char* sales,
+                                const std::string& dateKey,
+                                const std::string& customerKey) {
+    core::PlanNodeId dateScanId;
+    auto dates = PlanBuilder(planNodeIdGenerator, pool_.get())
+                     .tableScan(
+                         kDateDim,
+                         dateRowType,
+                         getFileColumnNames(kDateDim),
+                         {"d_year = 2001", "d_moy between 4 and 6"})
+                     .captureScanNodeId(dateScanId)
+                     .planNode();
+    dateScanIds.push_back(dateScanId);
+
+    core::PlanNodeId salesScanId;
+    auto plan = PlanBuilder(planNodeIdGenerator, pool_.get())
+                    .tableScan(
+                        sales,
+                        getRowType(sales, {dateKey, customerKey}),
+                        getFileColumnNames(sales))
+                    .captureScanNodeId(salesScanId)
+                    .hashJoin(
+                        {dateKey}, {"d_date_sk"}, dates, "", {customerKey})
+                    .planNode();
+    salesScanIds.push_back(salesScanId);
+    return plan;
+  };
+
+  auto addresses = PlanBuilder(planNodeIdGenerator, pool_.get())
+                       .tableScan(
+                           kCustomerAddress,
+                           addressRowType,
+                           getFileColumnNames(kCustomerAddress),
+                           {"ca_state IN ('KY', 'GA', 'NM')"})
+                       .captureScanNodeId(addressScanId)
+                       .planNode();
+
+  auto demographics = PlanBuilder(planNodeIdGenerator, pool_.get())
+                          .tableScan(
+                              kCustomerDemographics,
+                              demographicsRowType,
+                              getFileColumnNames(kCustomerDemographics))
+                          .captureScanNodeId(demographicsScanId)
+                          .planNode();
+
+  const std::vector<std::string> customerKeys = {
+      "c_customer_sk", "c_current_cdemo_sk"};
+  const std::vector<std::string> groupingKeys = {
+      "cd_gender",
+      "cd_marital_status",
+      "cd_education_status",
+      "cd_purchase_estimate",
+      "cd_credit_rating"};
+
+  auto plan =
+      PlanBuilder(planNodeIdGenerator, pool_.get())
+          .tableScan(kCustomer, customerRowType, getFileColumnNames(kCustomer))
+          .captureScanNodeId(customerScanId)
+          .hashJoin(
+              {"c_current_addr_sk"},
+              {"ca_address_sk"},
+              addresses,
+              "",
+              customerKeys)
+          .hashJoin(
+              {"c_customer_sk"},
+              {"ss_customer_sk"},
+              customersWithSales(
+                  kStoreSales, "ss_sold_date_sk", "ss_customer_sk"),
+              "",
+              customerKeys,
+              core::JoinType::kLeftSemiFilter)
+          .hashJoin(
+              {"c_customer_sk"},
+              {"ws_bill_customer_sk"},
+              customersWithSales(
+                  kWebSales, "ws_sold_date_sk", "ws_bill_customer_sk"),
+              "",
+              customerKeys,
+              core::JoinType::kAnti)
+          .hashJoin(
+              {"c_customer_sk"},
+              {"cs_ship_customer_sk"},
+              customersWithSales(
+                  kCatalogSales, "cs_sold_date_sk", "cs_ship_customer_sk"),
+              "",
+              customerKeys,
+              core::JoinType::kAnti)
+          .hashJoin(
+              {"c_current_cdemo_sk"},
+              {"cd_demo_sk"},
+              demographics,
+              "",
+              groupingKeys)
+          .partialAggregation(groupingKeys, {"count(0) AS cnt1"})
+          .localPartition(groupingKeys)
+          .finalAggregation()
+          .topN(groupingKeys, 100, true)
+          .localPartition(std::vector<std::string>{})
+          .topN(groupingKeys, 100, false)
+          .project(
+              {"cd_gender",
+               "cd_marital_status",
+               "cd_education_status",
+               "cnt1",
+               "cd_purchase_estimate",
+               "cnt1 AS cnt2",
+               "cd_credit_rating",
+               "cnt1 AS cnt3"})
+          .planNode();
+
+  TpchPlan context;
+  context.plan = std::move(plan);
+  context.dataFiles[customerScanId] = getTableFilePaths(kCustomer);
+  context.dataFiles[addressScanId] = getTableFilePaths(kCustomerAddress);
+  context.dataFiles[demographicsScanId] =
+      getTableFilePaths(kCustomerDemographics);
+  for (const auto& dateScanId : dateScanIds) {
+    context.dataFiles[dateScanId] = getTableFilePaths(kDateDim);
+  }
+  context.dataFiles[salesScanIds[0]] = getTableFilePaths(kStoreSales);
+  context.dataFiles[salesScanIds[1]] = getTableFilePaths(kWebSales);
+  context.dataFiles[salesScanIds[2]] = getTableFilePaths(kCatalogSales);
+  context.dataFileFormat = format_;
+  return context;
+}
+
+TpchPlan TpcdsQueryBuilder::getQ98Plan() const {
+  // select i_item_id, i_item_desc, i_category, i_class, i_current_price,
+  //   sum(ss_ext_sales_price) as itemrevenue,
+  //   sum(ss_ext_sales_price) * 100 / sum(sum(ss_ext_sales_price))
+  //     over (partition by i_class) as revenueratio
+  // from store_sales, item, date_dim
+  // where ss_item_sk = i_item_sk
+  //   and i_category in ('Sports', 'Books', 'Home')
+  //   and ss_sold_date_sk = d_date_sk
+  //   and d_date between cast('1999-02-22' as date)
+  //     and (cast('1999-02-22' as date) + interval '30' day)
+  // group by i_item_id, i_item_desc, i_category, i_class, i_current_price
+  // order by i_category, i_class, i_item_id, i_item_desc, revenueratio
+  const auto storeSalesRowType = getRowType(
+      kStoreSales, {"ss_sold_date_sk", "ss_item_sk", "ss_ext_sales_price"});
+  const auto itemRowType = getRowType(
+      kItem,
+      {"i_item_sk",
+       "i_item_id",
+       "i_item_desc",
+       "i_current_price",
+       "i_class",
+       "i_category"});
+  const auto dateRowType = getRowType(kDateDim, {"d_date_sk", "d_date"});
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  core::PlanNodeId storeSalesScanId;
+  core::PlanNodeId itemScanId;
+  core::PlanNodeId dateScanId;
+
+  auto items = PlanBuilder(planNodeIdGenerator, pool_.get())
+                   .tableScan(
+                       kItem,
+                       itemRowType,
+                       getFileColumnNames(kItem),
+                       {"i_category IN ('Sports', 'Books', 'Home')"})
+                   .captureScanNodeId(itemScanId)
+                   .planNode();
+
+  auto dates = PlanBuilder(planNodeIdGenerator, pool_.get())
+                   .tableScan(
+                       kDateDim,
+                       dateRowType,
+                       getFileColumnNames(kDateDim),
+                       {dateBetweenFilter(
+                           "d_date",
+                           dateRowType,
+                           "'1999-02-22'",
+                           "'1999-03-24'")})
+                   .captureScanNodeId(dateScanId)
+                   .planNode();
+
+  const std::vector<std::string> groupingKeys = {
+      "i_item_id", "i_item_desc", "i_category", "i_class", "i_current_price"};
+  auto joinOutput = groupingKeys;
+  joinOutput.push_back("ss_ext_sales_price");
+
+  auto plan =
+      PlanBuilder(planNodeIdGenerator, pool_.get())
+          .tableScan(
+              kStoreSales, storeSalesRowType, getFileColumnNames(kStoreSales))
+          .captureScanNodeId(storeSalesScanId)
+          .hashJoin(
+              {"ss_sold_date_sk"},
+              {"d_date_sk"},
+              dates,
+              "",
+              {"ss_item_sk", "ss_ext_sales_price"})
+          .hashJoin({"ss_item_sk"}, {"i_item_sk"}, items, "", joinOutput)
+          .partialAggregation(
+              groupingKeys, {"sum(ss_ext_sales_price) AS itemrevenue"})
+          .localPartition({"i_class"})
+          .finalAggregation()
+          .window(
+              {"sum(itemrevenue) OVER (PARTITION BY i_class) AS classrevenue"})
+          .project(
+              {"i_item_id",
+               "i_item_desc",
+               "i_category",
+               "i_class",
+               "i_current_price",
+               "itemrevenue",
+               "cast(itemrevenue as double) * 100.0 / "
+               "cast(classrevenue as double) AS revenueratio"})
+          .orderBy(
+              {"i_category",
+               "i_class",
+               "i_item_id",
+               "i_item_desc",
+               "revenueratio"},
+              true)
+          .localMerge(
+              {"i_category",
+               "i_class",
+               "i_item_id",
+               "i_item_desc",
+               "revenueratio"})
+          .planNode();
+
+  TpchPlan context;
+  context.plan = std::move(plan);
+  context.dataFiles[storeSalesScanId] = getTableFilePaths(kStoreSales);
+  context.dataFiles[itemScanId] = getTableFilePaths(kItem);
+  context.dataFiles[dateScanId] = getTableFilePaths(kDateDim);
+  context.dataFileFormat = format_;
+  return context;
+}
+
+const std::vector<std::string> TpcdsQueryBuilder::kTableNames_ = {
+    kStoreSales,
+    kWebSales,
+    kCatalogSales,
+    kDateDim,
+    kItem,
+    kStore,
+    kCustomer,
+    kCustomerAddress,
+    kCustomerDemographics,
+    kPromotion};
+
+// Column names in the order of the TPC-DS specification.
+const std::unordered_map<std::string, std::vector<std::string>>
+    TpcdsQueryBuilder::kTables_ = {
+        {"store_sales",
+         {"ss_sold_date_sk",
+          "ss_sold_time_sk",
+          "ss_item_sk",
+          "ss_customer_sk",
+          "ss_cdemo_sk",
+          "ss_hdemo_sk",
+          "ss_addr_sk",
+          "ss_store_sk",
+          "ss_promo_sk",
+          "ss_ticket_number",
+          "ss_quantity",
+          "ss_wholesale_cost",
+          "ss_list_price",
+          "ss_sales_price",
+          "ss_ext_discount_amt",
+          "ss_ext_sales_price",
+          "ss_ext_wholesale_cost",
+          "ss_ext_list_price",
+          "ss_ext_tax",
+          "ss_coupon_amt",
+          "ss_net_paid",
+          "ss_net_paid_inc_tax",
+          "ss_net_profit"}},
+        {"web_sales",
+         {"ws_sold_date_sk",
+          "ws_sold_time_sk",
+          "ws_ship_date_sk",
+          "ws_item_sk",
+          "ws_bill_customer_sk",
+          "ws_bill_cdemo_sk",
+          "ws_bill_hdemo_sk",
+          "ws_bill_addr_sk",
+          "ws_ship_customer_sk",
+          "ws_ship_cdemo_sk",
+          "ws_ship_hdemo_sk",
+          "ws_ship_addr_sk",
+          "ws_web_page_sk",
+          "ws_web_site_sk",
+          "ws_ship_mode_sk",
+          "ws_warehouse_sk",
+          "ws_promo_sk",
+          "ws_order_number",
+          "ws_quantity",
+          "ws_wholesale_cost",
+          "ws_list_price",
+          "ws_sales_price",
+          "ws_ext_discount_amt",
+          "ws_ext_sales_price",
+          "ws_ext_wholesale_cost",
+          "ws_ext_list_price",
+          "ws_ext_tax",
+          "ws_coupon_amt",
+          "ws_ext_ship_cost",
+          "ws_net_paid",
+          "ws_net_paid_inc_tax",
+          "ws_net_paid_inc_ship",
+          "ws_net_paid_inc_ship_tax",
+          "ws_net_profit"}},
+        {"catalog_sales",
+         {"cs_sold_date_sk",
+          "cs_sold_time_sk",
+          "cs_ship_date_sk",
+          "cs_bill_customer_sk",
+          "cs_bill_cdemo_sk",
+          "cs_bill_hdemo_sk",
+          "cs_bill_addr_sk",
+          "cs_ship_customer_sk",
+          "cs_ship_cdemo_sk",
+          "cs_ship_hdemo_sk",
+          "cs_ship_addr_sk",
+          "cs_call_center_sk",
+          "cs_catalog_page_sk",
+          "cs_ship_mode_sk",
+          "cs_warehouse_sk",
+          "cs_item_sk",
+          "cs_promo_sk",
+          "cs_order_number",
+          "cs_quantity",
+          "cs_wholesale_cost",
+          "cs_list_price",
+          "cs_sales_price",
+          "cs_ext_discount_amt",
+          "cs_ext_sales_price",
+          "cs_ext_wholesale_cost",
+          "cs_ext_list_price",
+          "cs_ext_tax",
+          "cs_coupon_amt",
+          "cs_ext_ship_cost",
+          "cs_net_paid",
+          "cs_net_paid_inc_tax",
+          "cs_net_paid_inc_ship",
+          "cs_net_paid_inc_ship_tax",
+          "cs_net_profit"}},
+        {"date_dim",
+         {"d_date_sk",
+          "d_date_id",
+          "d_date",
+          "d_month_seq",
+          "d_week_seq",
+          "d_quarter_seq",
+          "d_year",
+          "d_dow",
+          "d_moy",
+          "d_dom",
+          "d_qoy",
+          "d_fy_year",
+          "d_fy_quarter_seq",
+          "d_fy_week_seq",
+          "d_day_name",
+          "d_quarter_name",
+          "d_holiday",
+          "d_weekend",
+          "d_following_holiday",
+          "d_first_dom",
+          "d_last_dom",
+          "d_same_day_ly",
+          "d_same_day_lq",
+          "d_current_day",
+          "d_current_week",
+          "d_current_month",
+          "d_current_quarter",
+          "d_current_year"}},
+        {"item",
+         {"i_item_sk",
+          "i_item_id",
+          "i_rec_start_date",
+          "i_rec_end_date",
+          "i_item_desc",
+          "i_current_price",
+          "i_wholesale_cost",
+          "i_brand_id",
+          "i_brand",
+          "i_class_id",
+          "i_class",
+          "i_category_id",
+          "i_category",
+          "i_manufact_id",
+          "i_manufact",
+          "i_size",
+          "i_formulation",
+          "i_color",
+          "i_units",
+          "i_container",
+          "i_manager_id",
+          "i_product_name"}},
+        {"store",
+         {"s_store_sk",
+          "s_store_id",
+          "s_rec_start_date",
+          "s_rec_end_date",
+          "s_closed_date_sk",
+          "s_store_name",
+          "s_number_employees",
+          "s_floor_space",
+          "s_hours",
+          "s_manager",
+          "s_market_id",
+          "s_geography_class",
+          "s_market_desc",
+          "s_market_manager",
+          "s_division_id",
+          "s_division_name",
+          "s_company_id",
+          "s_company_name",
+          "s_street_number",
+          "s_street_name",
+          "s_street_type",
+          "s_suite_number",
+          "s_city",
+          "s_county",
+          "s_state",
+          "s_zip",
+          "s_country",
+          "s_gmt_offset",
+          "s_tax_precentage"}},
+        {"customer",
+         {"c_customer_sk",
+          "c_customer_id",
+          "c_current_cdemo_sk",
+          "c_current_hdemo_sk",
+          "c_current_addr_sk",
+          "c_first_shipto_date_sk",
+          "c_first_sales_date_sk",
+          "c_salutation",
+          "c_first_name",
+          "c_last_name",
+          "c_preferred_cust_flag",
+          "c_birth_day",
+          "c_birth_month",
+          "c_birth_year",
+          "c_birth_country",
+          "c_login",
+          "c_email_address",
+          "c_last_review_date_sk"}},
+        {"customer_address",
+         {"ca_address_sk",
+          "ca_address_id",
+          "ca_street_number",
+          "ca_street_name",
+          "ca_street_type",
+          "ca_suite_number",
+          "ca_city",
+          "ca_county",
+          "ca_state",
+          "ca_zip",
+          "ca_country",
+          "ca_gmt_offset",
+          "ca_location_type"}},
+        {"customer_demographics",
+         {"cd_demo_sk",
+          "cd_gender",
+          "cd_marital_status",
+          "cd_education_status",
+          "cd_purchase_estimate",
+          "cd_credit_rating",
+          "cd_dep_count",
+          "cd_dep_employed_count",
+          "cd_dep_college_count"}},
+        {"promotion",
+         {"p_promo_sk",
+          "p_promo_id",
+          "p_start_date_sk",
+          "p_end_date_sk",
+          "p_item_sk",
+          "p_cost",
+          "p_response_target",
+          "p_promo_name",
+          "p_channel_dmail",
+          "p_channel_email",
+          "p_channel_catalog",
+          "p_channel_tv",
+          "p_channel_radio",
+          "p_channel_press",
+          "p_channel_event",
+          "p_channel_demo",
+          "p_channel_details",
+          "p_purpose",
+          "p_discount_active"}}};
+
+} // namespace facebook::velox::exec::test
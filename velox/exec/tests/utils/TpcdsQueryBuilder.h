@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "velox/dwio/common/Options.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+#include "velox/exec/tests/utils/TpchQueryBuilder.h"
+
+namespace facebook::velox::exec::test {
+
+/// Builds a subset of TPC-DS queries using TPC-DS data files located in the
+/// specified directory. The data layout follows the same conventions as
+/// TpchQueryBuilder: one sub-directory (or file listing) per table, named after
+/// the table. Example:
+/// ls -R data/
+///  date_dim   item   store_sales ...
+///
+///  data/store_sales:
+///  store_sales1.parquet  store_sales2.parquet
+///
+/// Columns are mapped by position to the standard TPC-DS column names, so
+/// the files must store the columns in the order of the TPC-DS specification.
+/// Extra columns may exist towards the end.
+///
+/// The queries are chosen to cover operators that TPC-H does not exercise
+/// much: multi-way star joins (Q3, Q7), ROLLUP via GroupId (Q27), semi and
+/// anti joins (Q69) and window functions over aggregates (Q98). Plans are
+/// returned as TpchPlan so that they run unchanged on QueryBenchmarkBase.
+class TpcdsQueryBuilder {
+ public:
+  explicit TpcdsQueryBuilder(dwio::common::FileFormat format)
+      : format_(format) {}
+
+  /// Reads a sample data file of each table present under 'dataPath' and
+  /// initializes the row types and data file paths. Tables without data are
+  /// skipped; queries that need them fail in getQueryPlan().
+  void initialize(const std::string& dataPath);
+
+  /// Returns the query plan for the given TPC-DS query number. Throws if the
+  /// query is not in the supported subset.
+  TpchPlan getQueryPlan(int queryId) const;
+
+  /// Returns the TPC-DS query numbers supported by getQueryPlan().
+  static const std::vector<int>& getQueryIds();
+
+  /// Returns the TPC-DS table names this builder reads.
+  static const std::vector<std::string>& getTableNames();
+
+ private:
+  void readFileSchema(
+      const std::string& tableName,
+      const std::string& filePath,
+      const std::vector<std::string>& columns);
+
+  TpchPlan getQ3Plan() const;
+  TpchPlan getQ7Plan() const;
+  TpchPlan getQ27Plan() const;
+  TpchPlan getQ69Plan() const;
+  TpchPlan getQ98Plan() const;
+
+  const std::vector<std::string>& getTableFilePaths(
+      const std::string& tableName) const;
+
+  RowTypePtr getRowType(
+      const std::string& tableName,
+      const std::vector<std::string>& columnNames) const;
+
+  const std::unordered_map<std::string, std::string>& getFileColumnNames(
+      const std::string& tableName) const;
+
+  std::unordered_map<std::string, TpchTableMetadata> tableMetadata_;
+  const dwio::common::FileFormat format_;
+  static const std::unordered_map<std::string, std::vector<std::string>>
+      kTables_;
+  static const std::vector<std::string> kTableNames_;
+
+  static constexpr const char* kStoreSales = "store_sales";
+  static constexpr const char* kWebSales = "web_sales";
+  static constexpr const char* kCatalogSales = "catalog_sales";
+  static constexpr const char* kDateDim = "date_dim";
+  static constexpr const char* kItem = "item";
+  static constexpr const char* kStore = "store";
+  static constexpr const char* kCustomer = "customer";
+  static constexpr const char* kCustomerAddress = "customer_address";
+  static constexpr const char* kCustomerDemographics = "customer_demographics";
+  static constexpr const char* kPromotion = "promotion";
+  std::shared_ptr<memory::MemoryPool> pool_ =
+      memory::memoryManager()->addLeafPool();
+};
+
+} // namespace facebook::velox::exec::test
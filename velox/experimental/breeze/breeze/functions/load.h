@@ -246,6 +246,68 @@ ATTR void BlockLoadFrom(PlatformT p, const InputSlice in,
       in, offsets, p.thread_idx(), items, num_items);
 }
 
+// loads bit-packed unsigned values of |bit_width| bits (1-32) stored lsb
+// first in 32-bit words. the same kernel serves as the portable decoder
+// for bit-packed columns on CPU and GPU platforms.
+template <int STRIDE, int ITEMS_PER_THREAD, typename InputSlice,
+          typename ItemSlice>
+ATTR void BlockLoadBitPacked(const InputSlice in, int bit_width,
+                             int thread_offset, ItemSlice items,
+                             int num_items) {
+  using namespace utils;
+  using T = typename ItemSlice::data_type;
+
+  static_assert(InputSlice::ARRANGEMENT == BLOCKED,
+                "input must have blocked arrangement");
+
+  const unsigned mask = bit_width == 32 ? ~0u : (1u << bit_width) - 1u;
+
+#pragma unroll
+  for (int i = 0; i < ITEMS_PER_THREAD; ++i) {
+    int index = thread_offset + (i * STRIDE);
+    if (index < num_items) {
+      int bit = index * bit_width;
+      int word = bit >> 5;
+      int shift = bit & 31;
+      unsigned value = in[word] >> shift;
+      // value straddles two words
+      if (shift + bit_width > 32) {
+        value |= in[word + 1] << (32 - shift);
+      }
+      items[i] = static_cast<T>(value & mask);
+    }
+  }
+}
+
+// |in| must start at the first bit of the block. this is the case for
+// every block when BLOCK_THREADS * ITEMS_PER_THREAD is a multiple of 32.
+template <int BLOCK_THREADS, int ITEMS_PER_THREAD, typename PlatformT,
+          typename InputSlice, typename ItemSlice>
+ATTR void BlockLoadBitPacked(PlatformT p, const InputSlice in, int bit_width,
+                             ItemSlice items, int num_items) {
+  using namespace utils;
+
+  static_assert(ItemSlice::ARRANGEMENT == STRIPED ||
+                    ItemSlice::ARRANGEMENT == WARP_STRIPED,
+                "output must have striped or warp-striped arrangement");
+
+  if constexpr (ItemSlice::ARRANGEMENT == WARP_STRIPED) {
+    enum {
+      WARP_THREADS = PlatformT::WARP_THREADS,
+      WARP_ITEMS = WARP_THREADS * ITEMS_PER_THREAD,
+    };
+    // load items into warp-striped arrangement
+    BlockLoadBitPacked</*STRIDE=*/WARP_THREADS, ITEMS_PER_THREAD>(
+        in, bit_width, p.warp_idx() * WARP_ITEMS + p.lane_idx(), items,
+        num_items);
+    return;
+  }
+
+  // load items into striped arrangement
+  BlockLoadBitPacked</*STRIDE=*/BLOCK_THREADS, ITEMS_PER_THREAD>(
+      in, bit_width, p.thread_idx(), items, num_items);
+}
+
 template <int BLOCK_THREADS, int ITEMS_PER_THREAD, typename PlatformT,
           typename InputSlice, typename OffsetSlice,
           typename SelectionFlagSlice, typename ItemSlice>
@@ -94,6 +94,19 @@ void BlockLoadFrom(const T* in, const int* in_offsets, T* out, int num_items) {
       breeze::utils::make_slice<breeze::utils::GLOBAL>(out), num_items);
 }
 
+template <int BLOCK_THREADS, int ITEMS_PER_THREAD, typename T>
+PLATFORM("p")
+void BlockLoadBitPacked(const unsigned* in, const int* bit_width, T* out,
+                        int num_items) {
+  T items[ITEMS_PER_THREAD];
+  breeze::functions::BlockLoadBitPacked<BLOCK_THREADS, ITEMS_PER_THREAD>(
+      p, breeze::utils::make_slice<breeze::utils::GLOBAL>(in), *bit_width,
+      breeze::utils::make_slice(items), num_items);
+  breeze::functions::BlockStore<BLOCK_THREADS, ITEMS_PER_THREAD>(
+      p, breeze::utils::make_slice(items),
+      breeze::utils::make_slice<breeze::utils::GLOBAL>(out), num_items);
+}
+
 template <int BLOCK_THREADS, int ITEMS_PER_THREAD, typename T>
 PLATFORM("p")
 void BlockStore(const T* in, T* out, int num_items) {
@@ -53,6 +53,9 @@ class FunctionTest : public ::testing::Test {
   void BlockLoadFrom(USE_AS_SIZE const std::vector<T>& in,
                      const std::vector<int>& offsets, std::vector<T>& out);
   template <int BLOCK_THREADS, int ITEMS_PER_THREAD>
+  void BlockLoadBitPacked(const std::vector<unsigned>& in, int bit_width,
+                          USE_AS_SIZE std::vector<T>& out);
+  template <int BLOCK_THREADS, int ITEMS_PER_THREAD>
   void BlockStore(const std::vector<T>& in, USE_AS_SIZE std::vector<T>& out);
   template <int BLOCK_THREADS, int ITEMS_PER_THREAD>
   void BlockStoreIf(const std::vector<T>& in,
@@ -121,3 +121,20 @@ TYPED_TEST(FunctionTest, LoadFromFewItems) {
                                       std::end(expected_result));
   EXPECT_EQ(expected_out, out);
 }
+
+TYPED_TEST(FunctionTest, LoadBitPacked) {
+  // 3-bit values 0..7 followed by 7..0, packed lsb first. value 10 straddles
+  // the first and second word.
+  unsigned src[] = {0x77fac688u, 0x00000539u};
+
+  std::vector<unsigned> in(std::begin(src), std::end(src));
+  std::vector<TypeParam> out(16, 0);
+
+  this->template BlockLoadBitPacked<4, 4>(in, 3, out);
+
+  TypeParam expected_result[] = {0, 1, 2, 3, 4, 5, 6, 7,
+                                 7, 6, 5, 4, 3, 2, 1, 0};
+  std::vector<TypeParam> expected_out(std::begin(expected_result),
+                                      std::end(expected_result));
+  EXPECT_EQ(expected_out, out);
+}
@@ -63,6 +63,16 @@ class FunctionTest : public ::testing::Test {
         offsets, out, in.size());
   }
 
+  template <int BLOCK_THREADS, int ITEMS_PER_THREAD>
+  void BlockLoadBitPacked(const std::vector<unsigned>& in, int bit_width,
+                          std::vector<T>& out) {
+    const std::vector<int> vec_bit_width(1, bit_width);
+    CudaTestLaunch<BLOCK_THREADS>(
+        /*num_blocks=*/1,
+        &kernels::BlockLoadBitPacked<BLOCK_THREADS, ITEMS_PER_THREAD, T>, in,
+        vec_bit_width, out, out.size());
+  }
+
   template <int BLOCK_THREADS, int ITEMS_PER_THREAD>
   void BlockStore(const std::vector<T>& in, std::vector<T>& out) {
     CudaTestLaunch<BLOCK_THREADS>(
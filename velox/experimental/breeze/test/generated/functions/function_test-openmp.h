@@ -65,6 +65,15 @@ class FunctionTest : public ::testing::Test {
         offsets.data(), out.data(), in.size());
   }
 
+  template <int BLOCK_THREADS, int ITEMS_PER_THREAD>
+  void BlockLoadBitPacked(const std::vector<unsigned>& in, int bit_width,
+                          std::vector<T>& out) {
+    OpenMPTestLaunch<BLOCK_THREADS>(
+        /*num_blocks=*/1,
+        &kernels::BlockLoadBitPacked<BLOCK_THREADS, ITEMS_PER_THREAD, T>,
+        in.data(), &bit_width, out.data(), out.size());
+  }
+
   template <int BLOCK_THREADS, int ITEMS_PER_THREAD>
   void BlockStore(const std::vector<T>& in, std::vector<T>& out) {
     OpenMPTestLaunch<BLOCK_THREADS>(
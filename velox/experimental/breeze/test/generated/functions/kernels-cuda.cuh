@@ -88,6 +88,20 @@ __global__ void BlockLoadFrom(const T* in, const int* in_offsets, T* out,
       breeze::utils::make_slice<breeze::utils::GLOBAL>(out), num_items);
 }
 
+template <int BLOCK_THREADS, int ITEMS_PER_THREAD, typename T>
+__global__ void BlockLoadBitPacked(const unsigned* in, const int* bit_width,
+                                   T* out, int num_items) {
+  using PlatformT = CudaPlatform<BLOCK_THREADS, WARP_THREADS>;
+  PlatformT p;
+  T items[ITEMS_PER_THREAD];
+  breeze::functions::BlockLoadBitPacked<BLOCK_THREADS, ITEMS_PER_THREAD>(
+      p, breeze::utils::make_slice<breeze::utils::GLOBAL>(in), *bit_width,
+      breeze::utils::make_slice(items), num_items);
+  breeze::functions::BlockStore<BLOCK_THREADS, ITEMS_PER_THREAD>(
+      p, breeze::utils::make_slice(items),
+      breeze::utils::make_slice<breeze::utils::GLOBAL>(out), num_items);
+}
+
 template <int BLOCK_THREADS, int ITEMS_PER_THREAD, typename T>
 __global__ void BlockStore(const T* in, T* out, int num_items) {
   using PlatformT = CudaPlatform<BLOCK_THREADS, WARP_THREADS>;
@@ -23,6 +23,7 @@
 #include "velox/experimental/cudf/exec/VeloxCudfInterop.h"
 #include "velox/experimental/cudf/vector/CudfVector.h"
 
+#include "velox/common/time/Timer.h"
 #include "velox/expression/FieldReference.h"
 
 #include <cudf/io/parquet.hpp>
@@ -145,11 +146,16 @@ std::optional<RowVectorPtr> ParquetDataSource::next(
   }
 
   // Read a table chunk
-  auto [table, metadata] = splitReader_->read_chunk();
-  auto cudfTable = std::move(table);
+  cudf::io::table_with_metadata chunk;
+  {
+    NanosecondTimer timer(&readChunkWallNanos_);
+    chunk = splitReader_->read_chunk();
+  }
+  ++numReadChunks_;
+  auto cudfTable = std::move(chunk.tbl);
   // Fill in the column names if reading the first chunk.
   if (columnNames_.empty()) {
-    for (const auto& schema : metadata.schema_info) {
+    for (const auto& schema : chunk.metadata.schema_info) {
       columnNames_.emplace_back(schema.name);
     }
   }
@@ -229,6 +235,7 @@ void ParquetDataSource::addSplit(std::shared_ptr<ConnectorSplit> split) {
 
   // Create a `cudf::io::chunked_parquet_reader` SplitReader
   splitReader_ = createSplitReader();
+  ++numSplits_;
 
   // TODO: `completedBytes_` should be updated in `next()` as we read more and
   // more table bytes
@@ -306,6 +313,17 @@ ParquetDataSource::createSplitReader() {
       cudf::get_current_device_resource_ref());
 }
 
+std::unordered_map<std::string, RuntimeCounter>
+ParquetDataSource::runtimeStats() {
+  return {
+      {kNumSplits, RuntimeCounter(numSplits_)},
+      {kNumReadChunks, RuntimeCounter(numReadChunks_)},
+      {kReadChunkWallNanos,
+       RuntimeCounter(readChunkWallNanos_, RuntimeCounter::Unit::kNanos)},
+      {kSplitFileBytes,
+       RuntimeCounter(completedBytes_, RuntimeCounter::Unit::kBytes)}};
+}
+
 void ParquetDataSource::resetSplit() {
   split_.reset();
   splitReader_.reset();
@@ -66,10 +66,15 @@ class ParquetDataSource : public DataSource, public NvtxHelper {
     return completedBytes_;
   }
 
-  std::unordered_map<std::string, RuntimeCounter> runtimeStats() override {
-    // TODO: Which stats do we want to expose here?
-    return {};
-  }
+  /// Runtime stat names.
+  static inline const std::string kNumSplits{"numSplits"};
+  static inline const std::string kNumReadChunks{"numReadChunks"};
+  static inline const std::string kReadChunkWallNanos{"readChunkWallNanos"};
+  static inline const std::string kSplitFileBytes{"splitFileBytes"};
+
+  /// Returns the read stats accumulated over all the splits. The read time
+  /// includes the file I/O, the host to device copies and the decoding.
+  std::unordered_map<std::string, RuntimeCounter> runtimeStats() override;
 
  private:
   // Create a cudf::io::chunked_parquet_reader with the given split.
@@ -119,6 +124,10 @@ class ParquetDataSource : public DataSource, public NvtxHelper {
   size_t completedRows_{0};
   size_t completedBytes_{0};
 
+  uint64_t numSplits_{0};
+  uint64_t numReadChunks_{0};
+  uint64_t readChunkWallNanos_{0};
+
   // The row type for the data source output, not including filter-only columns
   const RowTypePtr outputType_;
 
@@ -36,6 +36,7 @@
 #include "velox/exec/TableScan.h"
 
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/pinned_memory.hpp>
 
 #include <cuda.h>
 
@@ -45,6 +46,17 @@ DEFINE_bool(velox_cudf_enabled, true, "Enable cuDF-Velox acceleration");
 DEFINE_string(velox_cudf_memory_resource, "async", "Memory resource for cuDF");
 DEFINE_bool(velox_cudf_debug, false, "Enable debug printing");
 DEFINE_bool(velox_cudf_table_scan, true, "Enable cuDF table scan");
+DEFINE_uint64(
+    velox_cudf_pinned_host_threshold_bytes,
+    0,
+    "Host buffers allocated by cuDF up to this size, e.g. for staging file "
+    "reads before copying them to the device, use pinned memory. 0 keeps the "
+    "cuDF default");
+DEFINE_bool(
+    velox_cudf_keep_light_runs_on_cpu,
+    false,
+    "Keep runs of filter, project and limit operators between CPU operators "
+    "on CPU instead of converting their input to and from GPU");
 
 namespace facebook::velox::cudf_velox {
 
@@ -140,6 +152,40 @@ bool CompileState::compile() {
       operators.end(),
       isSupportedGpuOperators.begin(),
       isSupportedGpuOperator);
+
+  // A run of operators between CPU operators pays for one conversion to GPU
+  // and one back. Filter, project and limit are cheap enough on CPU that the
+  // conversions cost more than they save. Operators that share state with
+  // other pipelines (joins, local exchange) are never moved.
+  auto isLightGpuOperator = [isFilterProjectSupported](
+                                const exec::Operator* op) {
+    return isFilterProjectSupported(op) || isAnyOf<exec::Limit>(op);
+  };
+  if (FLAGS_velox_cudf_keep_light_runs_on_cpu) {
+    int32_t runStart = 0;
+    while (runStart < operators.size()) {
+      if (!isSupportedGpuOperators[runStart]) {
+        ++runStart;
+        continue;
+      }
+      auto runEnd = runStart;
+      bool allLight = true;
+      while (runEnd < operators.size() && isSupportedGpuOperators[runEnd]) {
+        allLight &= isLightGpuOperator(operators[runEnd]);
+        ++runEnd;
+      }
+      const bool fromCpu = runStart > 0;
+      const bool toCpu = runEnd < operators.size() ||
+          driverFactory_.outputDriver;
+      if (allLight && fromCpu && toCpu) {
+        std::fill(
+            isSupportedGpuOperators.begin() + runStart,
+            isSupportedGpuOperators.begin() + runEnd,
+            false);
+      }
+      runStart = runEnd;
+    }
+  }
   auto acceptsGpuInput = [isFilterProjectSupported,
                           isJoinSupported](const exec::Operator* op) {
     return isAnyOf<
@@ -170,6 +216,9 @@ bool CompileState::compile() {
     exec::Operator* oper = operators[operatorIndex];
     auto replacingOperatorIndex = operatorIndex + operatorsOffset;
     VELOX_CHECK(oper);
+    if (!isSupportedGpuOperators[operatorIndex]) {
+      continue;
+    }
 
     const bool previousOperatorIsNotGpu =
         (operatorIndex > 0 and !isSupportedGpuOperators[operatorIndex - 1]);
@@ -321,6 +370,13 @@ void registerCudf(const CudfOptions& options) {
   auto mr = cudf_velox::createMemoryResource(mrMode);
   cudf::set_current_device_resource(mr.get());
 
+  if (options.pinnedHostThresholdBytes > 0) {
+    // Pinned host buffers let the host to device copies run asynchronously
+    // with DMA instead of going through a pageable bounce buffer.
+    cudf::set_allocate_host_as_pinned_threshold(
+        options.pinnedHostThresholdBytes);
+  }
+
   exec::Operator::registerOperator(
       std::make_unique<CudfHashJoinBridgeTranslator>());
   CudfDriverAdapter cda{mr};
@@ -25,6 +25,8 @@ DECLARE_bool(velox_cudf_enabled);
 DECLARE_string(velox_cudf_memory_resource);
 DECLARE_bool(velox_cudf_debug);
 DECLARE_bool(velox_cudf_table_scan);
+DECLARE_uint64(velox_cudf_pinned_host_threshold_bytes);
+DECLARE_bool(velox_cudf_keep_light_runs_on_cpu);
 
 namespace facebook::velox::cudf_velox {
 
@@ -65,12 +67,14 @@ class CudfOptions {
   const bool cudfEnabled;
   const std::string cudfMemoryResource;
   const bool cudfTableScan;
+  const uint64_t pinnedHostThresholdBytes;
 
  private:
   CudfOptions()
       : cudfEnabled(FLAGS_velox_cudf_enabled),
         cudfMemoryResource(FLAGS_velox_cudf_memory_resource),
         cudfTableScan(FLAGS_velox_cudf_table_scan),
+        pinnedHostThresholdBytes(FLAGS_velox_cudf_pinned_host_threshold_bytes),
         prefix_("") {}
   CudfOptions(const CudfOptions&) = delete;
   CudfOptions& operator=(const CudfOptions&) = delete;
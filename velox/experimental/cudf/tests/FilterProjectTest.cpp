@@ -796,4 +796,34 @@ TEST_F(CudfFilterProjectTest, dereference) {
              .planNode();
   assertQuery(plan, "SELECT c1, c2 FROM tmp WHERE c1 % 10 = 5");
 }
+
+TEST_F(CudfFilterProjectTest, keepLightRunsOnCpu) {
+  auto vectors = makeVectors(rowType_, 2, 100);
+  createDuckDbTable(vectors);
+  auto plan = PlanBuilder()
+                  .values(vectors)
+                  .filter("c0 % 3 = 1")
+                  .project({"c0 + 1 AS c0", "c1"})
+                  .planNode();
+
+  const auto countCudfOperators = [](const exec::Task& task) {
+    int32_t count = 0;
+    for (const auto& pipeline : task.taskStats().pipelineStats) {
+      for (const auto& op : pipeline.operatorStats) {
+        count += op.operatorType.find("Cudf") != std::string::npos;
+      }
+    }
+    return count;
+  };
+
+  auto task = assertQuery(plan, "SELECT c0 + 1, c1 FROM tmp WHERE c0 % 3 = 1");
+  ASSERT_GT(countCudfOperators(*task), 0);
+
+  // The filter and project run between the CPU values node and the CPU
+  // output, so they stay on CPU.
+  gflags::FlagSaver flagSaver;
+  FLAGS_velox_cudf_keep_light_runs_on_cpu = true;
+  task = assertQuery(plan, "SELECT c0 + 1, c1 FROM tmp WHERE c0 % 3 = 1");
+  ASSERT_EQ(countCudfOperators(*task), 0);
+}
 } // namespace
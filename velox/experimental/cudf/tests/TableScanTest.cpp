@@ -188,8 +188,13 @@ TEST_F(TableScanTest, allColumns) {
   //  Verifies there is no dynamic filter stats.
   ASSERT_TRUE(it->second.dynamicFilterStats.empty());
 
-  // TODO: We are not writing any customStats yet so disable this check
-  // ASSERT_LT(0, it->second.customStats.at("ioWaitWallNanos").sum);
+  using DataSource =
+      facebook::velox::cudf_velox::connector::parquet::ParquetDataSource;
+  const auto& customStats = it->second.customStats;
+  ASSERT_EQ(customStats.at(DataSource::kNumSplits).sum, 1);
+  ASSERT_GT(customStats.at(DataSource::kNumReadChunks).sum, 0);
+  ASSERT_GT(customStats.at(DataSource::kReadChunkWallNanos).sum, 0);
+  ASSERT_GT(customStats.at(DataSource::kSplitFileBytes).sum, 0);
 }
 
 TEST_F(TableScanTest, directBufferInputRawInputBytes) {
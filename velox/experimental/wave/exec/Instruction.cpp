@@ -23,6 +23,13 @@ DEFINE_int32(
     80 * 1024,
     "Max batch for Wave table scan");
 
+DEFINE_int64(
+    wave_agg_device_row_bytes_limit,
+    0,
+    "Max bytes of device memory for the rows of a Wave hash aggregation. "
+    "Row ranges past the limit are allocated from pinned host memory that "
+    "the device accesses over the bus. 0 means no limit");
+
 namespace facebook::velox::wave {
 
 std::string rowTypeString(const Type& type) {
@@ -75,7 +82,23 @@ void restockAllocator(
     state.ranges.push_back(std::move(allocator->ranges[0]));
     allocator->ranges[0] = std::move(allocator->ranges[1]);
   }
-  auto buffer = state.arena->allocate<char>(size);
+  WaveBufferPtr buffer;
+  if (FLAGS_wave_agg_device_row_bytes_limit > 0 &&
+      state.deviceRowBytes + size > FLAGS_wave_agg_device_row_bytes_limit) {
+    // Overflow rows go to pinned host memory. The kernels address these
+    // through the unified address space, so the table keeps working past the
+    // device budget at the cost of slower access to the overflow rows.
+    if (!state.hostArena) {
+      state.hostArena = std::make_shared<GpuArena>(
+          std::max<int64_t>(size, 64 << 20), getHostAllocator(getDevice()));
+    }
+    buffer = state.hostArena->allocate<char>(size);
+    state.hostRowBytes += size;
+    TR1(fmt::format("Made host range of {} bytes", size));
+  } else {
+    buffer = state.arena->allocate<char>(size);
+    state.deviceRowBytes += size;
+  }
   state.buffers.push_back(buffer);
   AllocationRange newRange(
       reinterpret_cast<uintptr_t>(buffer->as<char>()),
@@ -318,6 +318,17 @@ struct AggregateOperatorState : public OperatorState {
   /// Device side bytes in the hash table and rows.
   int64_t bytes{0};
 
+  /// Bytes of row ranges allocated from 'arena'.
+  int64_t deviceRowBytes{0};
+
+  /// Bytes of row ranges allocated from 'hostArena' after 'deviceRowBytes'
+  /// reached FLAGS_wave_agg_device_row_bytes_limit.
+  int64_t hostRowBytes{0};
+
+  /// Pinned host memory for row ranges that do not fit the device budget.
+  /// Created on first overflow.
+  std::shared_ptr<GpuArena> hostArena;
+
   /// Next range to be prepared for return.
   int32_t rangeIdx{0};
 
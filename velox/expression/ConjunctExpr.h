@@ -68,6 +68,12 @@ class ConjunctExpr : public SpecialForm {
     return selectivity_[inputOrder_[index]];
   }
 
+  /// Returns the selectivity of inputs()[index], regardless of the order in
+  /// which the inputs are evaluated.
+  const SelectivityInfo& inputSelectivity(int32_t index) const {
+    return selectivity_[index];
+  }
+
   std::string toSql(
       std::vector<VectorPtr>* complexConstants = nullptr) const override;
 
@@ -531,6 +531,12 @@ class EvalCtx {
     return execCtx_->optimizationParams().maxSharedSubexprResultsCached;
   }
 
+  /// Returns the maximum size of the results an expression memoizes for the
+  /// base of a dictionary encoded input.
+  uint64_t maxDictionaryMemoBytes() const {
+    return execCtx_->optimizationParams().maxDictionaryMemoBytes;
+  }
+
   /// Returns true if peeling is enabled.
   bool peelingEnabled() const {
     return execCtx_->optimizationParams().peelingEnabled;
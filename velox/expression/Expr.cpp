@@ -16,6 +16,7 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
+#include <folly/String.h>
 
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/base/Fs.h"
@@ -23,10 +24,12 @@
 #include "velox/common/process/ThreadDebugInfo.h"
 #include "velox/common/testutil/TestValue.h"
 #include "velox/expression/CastExpr.h"
+#include "velox/expression/ConjunctExpr.h"
 #include "velox/expression/ConstantExpr.h"
 #include "velox/expression/Expr.h"
 #include "velox/expression/ExprCompiler.h"
 #include "velox/expression/FieldReference.h"
+#include "velox/expression/FunctionProfiler.h"
 #include "velox/expression/LambdaExpr.h"
 #include "velox/expression/PeeledEncoding.h"
 #include "velox/expression/ScopedVarSetter.h"
@@ -1229,20 +1232,38 @@ void Expr::evalWithMemo(
   //
   //    try(coalesce(array_min_by(array[1, 2, 3], x -> x / 0), 0::INTEGER))
 
-  if (base.get() != baseOfDictionaryRawPtr_ ||
-      baseOfDictionaryWeakPtr_.expired()) {
+  if (!isMemoizedBase(base)) {
     baseOfDictionaryRepeats_ = 0;
     baseOfDictionaryWeakPtr_.reset();
     baseOfDictionaryRawPtr_ = nullptr;
+    baseOfDictionaryValues_.reset();
+    baseOfDictionaryNulls_.reset();
     context.releaseVector(baseOfDictionary_);
     context.releaseVector(dictionaryCache_);
 
     evalWithNulls(rows, context, result);
     baseOfDictionaryWeakPtr_ = base;
     baseOfDictionaryRawPtr_ = base.get();
+    // A flat base is also identified by its buffers, so that a new vector
+    // over the same values, e.g. the dictionary of a stripe read again for
+    // each batch, reuses the memoized results. The buffers are held so that
+    // they are neither freed nor modified in place.
+    if (base->isFlatEncoding() && base->values() != nullptr &&
+        base->values()->capacity() <= context.maxDictionaryMemoBytes()) {
+      baseOfDictionaryValues_ = base->values();
+      baseOfDictionaryNulls_ = base->nulls();
+    }
     return;
   }
 
+  if (base.get() != baseOfDictionaryRawPtr_) {
+    baseOfDictionaryWeakPtr_ = base;
+    baseOfDictionaryRawPtr_ = base.get();
+    if (baseOfDictionary_ != nullptr) {
+      baseOfDictionary_ = base;
+    }
+  }
+
   if (baseOfDictionaryRepeats_ == 0) {
     evalWithNulls(rows, context, result);
 
@@ -1255,6 +1276,8 @@ void Expr::evalWithMemo(
     }
     *cachedDictionaryIndices_ = rows;
     context.deselectErrors(*cachedDictionaryIndices_);
+    stats_.numMemoMissRows += rows.countSelected();
+    releaseMemoOverBudget(context);
     return;
   }
 
@@ -1268,6 +1291,7 @@ void Expr::evalWithMemo(
     if (cached->hasSelections()) {
       context.ensureWritable(rows, type(), result);
       result->copy(dictionaryCache_.get(), *cached, nullptr);
+      stats_.numMemoHitRows += cached->countSelected();
     }
   }
   LocalSelectivityVector uncachedHolder(context, rows);
@@ -1284,6 +1308,7 @@ void Expr::evalWithMemo(
         context, &rows, uncached->countSelected() < rows.countSelected());
 
     evalWithNulls(*uncached, context, result);
+    stats_.numMemoMissRows += uncached->countSelected();
     context.deselectErrors(*uncached);
 
     if (uncached->hasSelections()) {
@@ -1312,11 +1337,35 @@ void Expr::evalWithMemo(
         dictionaryCache_->resize(uncached->end());
       }
       dictionaryCache_->copy(result.get(), *uncached, nullptr);
+      releaseMemoOverBudget(context);
     }
   }
   context.releaseVector(base);
 }
 
+bool Expr::isMemoizedBase(const VectorPtr& base) const {
+  if (base.get() == baseOfDictionaryRawPtr_ &&
+      !baseOfDictionaryWeakPtr_.expired()) {
+    return true;
+  }
+  return baseOfDictionaryValues_ != nullptr && base->isFlatEncoding() &&
+      base->values() == baseOfDictionaryValues_ &&
+      base->nulls() == baseOfDictionaryNulls_;
+}
+
+void Expr::releaseMemoOverBudget(EvalCtx& context) {
+  if (dictionaryCache_->retainedSize() <= context.maxDictionaryMemoBytes()) {
+    return;
+  }
+  // Starts over with the next batch over the same base.
+  baseOfDictionaryRepeats_ = 0;
+  context.releaseVector(baseOfDictionary_);
+  baseOfDictionary_.reset();
+  context.releaseVector(dictionaryCache_);
+  dictionaryCache_.reset();
+  cachedDictionaryIndices_->clearAll();
+}
+
 void Expr::setAllNulls(
     const SelectivityVector& rows,
     EvalCtx& context,
@@ -1563,8 +1612,9 @@ void Expr::applyFunction(
     const SelectivityVector& rows,
     EvalCtx& context,
     VectorPtr& result) {
+  const auto numRows = rows.countSelected();
   stats_.numProcessedVectors += 1;
-  stats_.numProcessedRows += rows.countSelected();
+  stats_.numProcessedRows += numRows;
   auto timer = cpuWallTimer();
 
   computeIsAsciiForInputs(vectorFunction_.get(), inputValues_, rows);
@@ -1572,6 +1622,14 @@ void Expr::applyFunction(
       ? computeIsAsciiForResult(vectorFunction_.get(), inputValues_, rows)
       : std::nullopt;
 
+  CpuWallTiming profileTiming;
+  std::optional<CpuWallTimer> profileTimer;
+  if (functionProfileSampleRate_ != 0 &&
+      --numCallsToFunctionProfileSample_ == 0) {
+    numCallsToFunctionProfileSample_ = functionProfileSampleRate_;
+    profileTimer.emplace(profileTiming);
+  }
+
   try {
     vectorFunction_->apply(rows, inputValues_, type(), context, result);
   } catch (const VeloxException&) {
@@ -1580,6 +1638,11 @@ void Expr::applyFunction(
     VELOX_USER_FAIL(e.what());
   }
 
+  if (profileTimer.has_value()) {
+    profileTimer.reset();
+    recordFunctionProfile(numRows, profileTiming);
+  }
+
   if (!result) {
     MutableRemainingRows remainingRows(rows, context);
 
@@ -1607,6 +1670,42 @@ void Expr::applyFunction(
   }
 }
 
+void Expr::recordFunctionProfile(
+    uint64_t numRows,
+    const CpuWallTiming& timing) const {
+  std::string inputEncodings;
+  for (const auto& input : inputValues_) {
+    if (!inputEncodings.empty()) {
+      inputEncodings.append(", ");
+    }
+    inputEncodings.append(
+        input == nullptr ? "NULL"
+                         : VectorEncoding::mapSimpleToName(input->encoding()));
+  }
+  FunctionProfiler::instance().record(
+      functionProfileSignature_, inputEncodings, numRows, timing);
+}
+
+void Expr::setFunctionProfileSampleRate(uint32_t sampleRate) {
+  for (const auto& input : inputs_) {
+    input->setFunctionProfileSampleRate(sampleRate);
+  }
+  if (vectorFunction_ == nullptr) {
+    return;
+  }
+  functionProfileSampleRate_ = sampleRate;
+  numCallsToFunctionProfileSample_ = sampleRate;
+  if (sampleRate != 0 && functionProfileSignature_.empty()) {
+    std::vector<std::string> inputTypes;
+    inputTypes.reserve(inputs_.size());
+    for (const auto& input : inputs_) {
+      inputTypes.push_back(input->type()->toString());
+    }
+    functionProfileSignature_ =
+        fmt::format("{}({})", name_, folly::join(", ", inputTypes));
+  }
+}
+
 void Expr::evalSpecialFormWithStats(
     const SelectivityVector& rows,
     EvalCtx& context,
@@ -1805,6 +1904,13 @@ ExprSet::ExprSet(
     Expr::mergeFields(
         distinctFields_, multiplyReferencedFields_, expr->distinctFields());
   }
+  const auto profileSampleRate =
+      execCtx->queryCtx()->queryConfig().exprFunctionProfileSampleRate();
+  if (profileSampleRate != 0) {
+    for (auto& expr : exprs_) {
+      expr->setFunctionProfileSampleRate(profileSampleRate);
+    }
+  }
 }
 
 namespace {
@@ -1829,6 +1935,20 @@ void addStats(
     stats[expr.name()].add(expr.stats());
   }
 
+  if (const auto* conjunct = expr.as<ConjunctExpr>()) {
+    for (auto i = 0; i < expr.inputs().size(); ++i) {
+      const auto& selectivity = conjunct->inputSelectivity(i);
+      if (selectivity.numIn() == 0) {
+        continue;
+      }
+      auto& inputStats = stats[expr.inputs()[i]->name()];
+      inputStats.numConjunctInputRows += selectivity.numIn();
+      inputStats.numConjunctDecidedRows +=
+          selectivity.numIn() - selectivity.numOut();
+      inputStats.conjunctClocks += selectivity.timeClocks();
+    }
+  }
+
   for (const auto& input : expr.inputs()) {
     addStats(*input, stats, uniqueExprs, excludeSpecialForm);
   }
@@ -236,6 +236,8 @@ class Expr {
     baseOfDictionaryRawPtr_ = nullptr;
     baseOfDictionaryWeakPtr_.reset();
     baseOfDictionary_.reset();
+    baseOfDictionaryValues_.reset();
+    baseOfDictionaryNulls_.reset();
     dictionaryCache_ = nullptr;
     cachedDictionaryIndices_ = nullptr;
   }
@@ -406,6 +408,11 @@ class Expr {
     return stats_;
   }
 
+  /// Times one out of every 'sampleRate' calls of the vector functions of
+  /// this expression and its inputs and records them in FunctionProfiler.
+  /// Zero disables the sampling.
+  void setFunctionProfileSampleRate(uint32_t sampleRate);
+
   void addNulls(
       const SelectivityVector& rows,
       const uint64_t* rawNulls,
@@ -475,6 +482,13 @@ class Expr {
       EvalCtx& context,
       VectorPtr& result);
 
+  // Returns true if 'base' is the base of the memoized dictionary results.
+  bool isMemoizedBase(const VectorPtr& base) const;
+
+  // Drops the memoized dictionary results if they exceed
+  // EvalCtx::maxDictionaryMemoBytes().
+  void releaseMemoOverBudget(EvalCtx& context);
+
   void evalWithNulls(
       const SelectivityVector& rows,
       EvalCtx& context,
@@ -599,6 +613,11 @@ class Expr {
                           : nullptr;
   }
 
+  // Records a sampled call of 'vectorFunction_' over 'numRows' rows in
+  // FunctionProfiler, along with the encodings of 'inputValues_'.
+  void recordFunctionProfile(uint64_t numRows, const CpuWallTiming& timing)
+      const;
+
   // Should be called only after computeMetadata() has been called on 'inputs_'.
   // Computes distinctFields for this expression. Also updates any multiply
   // referenced fields.
@@ -695,6 +714,11 @@ class Expr {
   // not modified and re-used in-place.
   VectorPtr baseOfDictionary_;
 
+  // The values and nulls of the last base vector if it is flat. A base that
+  // is a different vector over the same buffers matches the memo.
+  BufferPtr baseOfDictionaryValues_;
+  BufferPtr baseOfDictionaryNulls_;
+
   // Number of times currently held cacheable vector is seen for a non-first
   // time. Is reset everytime 'baseOfDictionaryRawPtr_' is different from the
   // current input's base.
@@ -710,6 +734,17 @@ class Expr {
   /// Runtime statistics. CPU time, wall time and number of processed rows.
   ExprStats stats_;
 
+  // If not zero, one out of every 'functionProfileSampleRate_' calls of
+  // 'vectorFunction_' is timed and recorded in FunctionProfiler.
+  uint32_t functionProfileSampleRate_{0};
+
+  // The number of calls of 'vectorFunction_' left until the next sampled one.
+  uint32_t numCallsToFunctionProfileSample_{0};
+
+  // 'name_' with the input types. The key of the sampled calls in
+  // FunctionProfiler.
+  std::string functionProfileSignature_;
+
   // If true computeMetaData returns, otherwise meta data is computed and the
   // flag is set to true.
   bool metaDataComputed_ = false;
@@ -18,6 +18,7 @@
 #include "velox/expression/ConstantExpr.h"
 #include "velox/expression/Expr.h"
 #include "velox/expression/FieldReference.h"
+#include "velox/expression/FusedExpr.h"
 #include "velox/expression/LambdaExpr.h"
 #include "velox/expression/RowConstructor.h"
 #include "velox/expression/SimpleFunctionRegistry.h"
@@ -80,6 +81,10 @@ struct Scope {
 
   std::vector<TypedExprPtr> rewrittenExpressions;
 
+  // Replacements from 'expressionSetRewrites'. Only set for a top level
+  // Scope.
+  ExpressionReplacements replacements;
+
   Scope(std::vector<std::string>&& _locals, Scope* _parent, ExprSet* _exprSet)
       : locals(std::move(_locals)), parent(_parent), exprSet(_exprSet) {}
 
@@ -564,6 +569,13 @@ ExprPtr compileRewrittenExpression(
     compiled = result;
   }
 
+  if (config.exprFuseSimpleFunctions()) {
+    if (auto fused = FusedExpr::tryFuse(compiled, trackCpuUsage)) {
+      fused->computeMetadata();
+      compiled = fused;
+    }
+  }
+
   scope->visited[expr.get()] = compiled;
   return compiled;
 }
@@ -575,6 +587,16 @@ ExprPtr compileExpression(
     memory::MemoryPool* pool,
     const std::unordered_set<std::string>& flatteningCandidates,
     bool enableConstantFolding) {
+  auto replacement = scope->replacements.find(expr.get());
+  if (replacement != scope->replacements.end()) {
+    return compileExpression(
+        replacement->second,
+        scope,
+        config,
+        pool,
+        flatteningCandidates,
+        enableConstantFolding);
+  }
   auto rewritten = rewriteExpression(expr);
   if (rewritten.get() != expr.get()) {
     scope->rewrittenExpressions.push_back(rewritten);
@@ -632,6 +654,9 @@ std::vector<std::shared_ptr<Expr>> compileExpressions(
     ExprSet* exprSet,
     bool enableConstantFolding) {
   Scope scope({}, nullptr, exprSet);
+  for (const auto& rewrite : expressionSetRewrites()) {
+    scope.replacements.merge(rewrite(sources));
+  }
   std::vector<std::shared_ptr<Expr>> exprs;
   exprs.reserve(sources.size());
 
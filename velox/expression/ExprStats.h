@@ -35,20 +35,52 @@ struct ExprStats {
   /// evaluation of rows.
   bool defaultNullRowsSkipped{false};
 
+  /// Number of rows of dictionary encoded inputs whose results were reused
+  /// from the results memoized for an earlier batch over the same base.
+  uint64_t numMemoHitRows{0};
+
+  /// Number of rows of dictionary encoded inputs that were evaluated and
+  /// added to the memoized results.
+  uint64_t numMemoMissRows{0};
+
+  /// Number of rows on which the expression was evaluated as a conjunct of
+  /// an AND or OR.
+  uint64_t numConjunctInputRows{0};
+
+  /// Number of rows for which the expression as a conjunct decided the
+  /// result, i.e. was false for an AND or true for an OR. Rows decided by an
+  /// earlier conjunct are not counted.
+  uint64_t numConjunctDecidedRows{0};
+
+  /// Clock ticks spent evaluating the expression as a conjunct. Divided by
+  /// 'numConjunctDecidedRows' this is the cost by which adaptive filter
+  /// reordering orders the conjuncts.
+  uint64_t conjunctClocks{0};
+
   void add(const ExprStats& other) {
     timing.add(other.timing);
     numProcessedRows += other.numProcessedRows;
     numProcessedVectors += other.numProcessedVectors;
     defaultNullRowsSkipped |= other.defaultNullRowsSkipped;
+    numMemoHitRows += other.numMemoHitRows;
+    numMemoMissRows += other.numMemoMissRows;
+    numConjunctInputRows += other.numConjunctInputRows;
+    numConjunctDecidedRows += other.numConjunctDecidedRows;
+    conjunctClocks += other.conjunctClocks;
   }
 
   std::string toString() const {
     return fmt::format(
-        "timing: {}, numProcessedRows: {}, numProcessedVectors: {}, defaultNullRowsSkipped: {}",
+        "timing: {}, numProcessedRows: {}, numProcessedVectors: {}, defaultNullRowsSkipped: {}, numMemoHitRows: {}, numMemoMissRows: {}, numConjunctInputRows: {}, numConjunctDecidedRows: {}, conjunctClocks: {}",
         timing.toString(),
         numProcessedRows,
         numProcessedVectors,
-        defaultNullRowsSkipped ? "true" : "false");
+        defaultNullRowsSkipped ? "true" : "false",
+        numMemoHitRows,
+        numMemoMissRows,
+        numConjunctInputRows,
+        numConjunctDecidedRows,
+        conjunctClocks);
   }
 };
 } // namespace facebook::velox::exec
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/expression/FunctionProfiler.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <sstream>
+
+#include "velox/common/base/SuccinctPrinter.h"
+
+namespace facebook::velox::exec {
+
+std::string FunctionProfile::toString() const {
+  std::string encodings;
+  for (const auto& [inputEncoding, count] : inputEncodings) {
+    if (!encodings.empty()) {
+      encodings.append(", ");
+    }
+    encodings.append(fmt::format("[{}]: {}", inputEncoding, count));
+  }
+  return fmt::format(
+      "{}: cpu time: {}, wall time: {}, samples: {}, rows: {}, "
+      "avg batch: {}, max batch: {}, input encodings: {{{}}}",
+      signature,
+      succinctNanos(timing.cpuNanos),
+      succinctNanos(timing.wallNanos),
+      timing.count,
+      numRows,
+      timing.count == 0 ? 0 : numRows / timing.count,
+      maxBatchSize,
+      encodings);
+}
+
+// static
+FunctionProfiler& FunctionProfiler::instance() {
+  static FunctionProfiler profiler;
+  return profiler;
+}
+
+void FunctionProfiler::record(
+    const std::string& signature,
+    const std::string& inputEncodings,
+    uint64_t numRows,
+    const CpuWallTiming& timing) {
+  auto profiles = profiles_.wlock();
+  auto& profile = (*profiles)[signature];
+  if (profile.signature.empty()) {
+    profile.signature = signature;
+  }
+  profile.timing.add(timing);
+  profile.numRows += numRows;
+  profile.maxBatchSize = std::max(profile.maxBatchSize, numRows);
+  ++profile.inputEncodings[inputEncodings];
+}
+
+std::vector<FunctionProfile> FunctionProfiler::topFunctions(size_t n) const {
+  std::vector<FunctionProfile> functions;
+  {
+    const auto profiles = profiles_.rlock();
+    functions.reserve(profiles->size());
+    for (const auto& [_, profile] : *profiles) {
+      functions.push_back(profile);
+    }
+  }
+  std::sort(
+      functions.begin(),
+      functions.end(),
+      [](const FunctionProfile& lhs, const FunctionProfile& rhs) {
+        return lhs.timing.cpuNanos > rhs.timing.cpuNanos;
+      });
+  if (functions.size() > n) {
+    functions.resize(n);
+  }
+  return functions;
+}
+
+std::string FunctionProfiler::toString(size_t n) const {
+  std::stringstream out;
+  for (const auto& profile : topFunctions(n)) {
+    out << profile.toString() << std::endl;
+  }
+  return out.str();
+}
+
+void FunctionProfiler::clear() {
+  profiles_.wlock()->clear();
+}
+} // namespace facebook::velox::exec
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <folly/Synchronized.h>
+#include <folly/container/F14Map.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "velox/common/time/CpuWallTimer.h"
+
+namespace facebook::velox::exec {
+
+/// The sampled cost of one function signature, aggregated over all the
+/// expressions evaluating it in the process.
+struct FunctionProfile {
+  /// The function name with its input types, e.g. 'plus(BIGINT, BIGINT)'.
+  std::string signature;
+
+  /// The cpu and wall time of the sampled calls. 'timing.count' is the number
+  /// of sampled calls.
+  CpuWallTiming timing;
+
+  /// The number of rows processed by the sampled calls. Divided by
+  /// 'timing.count' this is the average batch size.
+  uint64_t numRows{0};
+
+  /// The largest batch of the sampled calls.
+  uint64_t maxBatchSize{0};
+
+  /// The number of sampled calls per combination of input encodings, e.g.
+  /// 'FLAT, CONSTANT'.
+  std::map<std::string, uint64_t> inputEncodings;
+
+  std::string toString() const;
+};
+
+/// Process-wide aggregation of the sampled cost of the function calls made by
+/// expression evaluation. Expressions compiled with a non-zero
+/// 'expression.function_profile_sample_rate' query config time one out of
+/// every that many calls of their vector function and record it here. The
+/// profiles rank the functions by their cpu time on real traffic, together
+/// with the input encodings and batch sizes they see.
+class FunctionProfiler {
+ public:
+  static FunctionProfiler& instance();
+
+  /// Records a sampled call of 'signature' over 'numRows' rows.
+  void record(
+      const std::string& signature,
+      const std::string& inputEncodings,
+      uint64_t numRows,
+      const CpuWallTiming& timing);
+
+  /// Returns up to 'n' functions with the most sampled cpu time, in
+  /// descending order of cpu time.
+  std::vector<FunctionProfile> topFunctions(size_t n) const;
+
+  /// Returns the top 'n' functions, one per line.
+  std::string toString(size_t n) const;
+
+  /// Drops all the recorded profiles.
+  void clear();
+
+ private:
+  folly::Synchronized<folly::F14FastMap<std::string, FunctionProfile>>
+      profiles_;
+};
+} // namespace facebook::velox::exec
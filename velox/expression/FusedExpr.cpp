@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/expression/FusedExpr.h"
+#include "velox/expression/ConstantExpr.h"
+#include "velox/expression/FieldReference.h"
+#include "velox/expression/VectorFunction.h"
+
+namespace facebook::velox::exec {
+
+namespace {
+
+bool isDenseFunction(const Expr& expr) {
+  return !expr.isSpecialForm() && expr.vectorFunction() != nullptr &&
+      expr.vectorFunctionMetadata().deterministic &&
+      expr.vectorFunction()->supportsDenseEvaluation();
+}
+
+// Adds the functions of the tree rooted at 'expr' to 'steps' in post order.
+// Returns the slot of the result of 'expr', with leaves numbered from 0 and
+// step i numbered -1 - i, or std::nullopt if the tree cannot be fused.
+std::optional<int32_t> addToFusion(
+    const ExprPtr& expr,
+    bool isRoot,
+    std::vector<ExprPtr>& leaves,
+    std::vector<FusedExpr::Step>& steps) {
+  if (expr->is<FieldReference>() || expr->is<ConstantExpr>()) {
+    auto it = std::find(leaves.begin(), leaves.end(), expr);
+    if (it != leaves.end()) {
+      return it - leaves.begin();
+    }
+    leaves.push_back(expr);
+    return leaves.size() - 1;
+  }
+  // A multiply referenced subtree is evaluated once by its own Expr.
+  if (!isRoot && expr->isMultiplyReferenced()) {
+    return std::nullopt;
+  }
+  const Expr* function = expr.get();
+  if (const auto* fused = expr->as<FusedExpr>()) {
+    function = fused->original().get();
+  }
+  if (!isDenseFunction(*function)) {
+    return std::nullopt;
+  }
+  std::vector<TypePtr> argTypes;
+  std::vector<int32_t> args;
+  for (const auto& input : function->inputs()) {
+    auto arg = addToFusion(input, false, leaves, steps);
+    if (!arg.has_value()) {
+      return std::nullopt;
+    }
+    argTypes.push_back(input->type());
+    args.push_back(arg.value());
+  }
+  steps.push_back(
+      {function->vectorFunction().get(),
+       std::move(argTypes),
+       std::move(args),
+       static_cast<int32_t>(function->type()->cppSizeInBytes())});
+  return -static_cast<int32_t>(steps.size());
+}
+
+bool applyStep(
+    const FusedExpr::Step& step,
+    vector_size_t numRows,
+    const void* const* args,
+    void* result) {
+  try {
+    return step.function->applyDense(step.argTypes, numRows, args, result);
+  } catch (const std::exception&) {
+    // The rows are evaluated again without fusion to report the error.
+    return false;
+  }
+}
+
+} // namespace
+
+// static
+ExprPtr FusedExpr::tryFuse(const ExprPtr& expr, bool trackCpuUsage) {
+  if (expr->is<FusedExpr>() || !isDenseFunction(*expr)) {
+    return nullptr;
+  }
+  std::vector<ExprPtr> leaves;
+  std::vector<Step> steps;
+  if (!addToFusion(expr, true, leaves, steps).has_value() ||
+      steps.size() < 2) {
+    return nullptr;
+  }
+  const int32_t numLeaves = leaves.size();
+  for (auto& step : steps) {
+    for (auto& arg : step.args) {
+      if (arg < 0) {
+        arg = numLeaves - 1 - arg;
+      }
+    }
+  }
+  return std::make_shared<FusedExpr>(
+      expr, std::move(leaves), std::move(steps), trackCpuUsage);
+}
+
+FusedExpr::FusedExpr(
+    ExprPtr original,
+    std::vector<ExprPtr> leaves,
+    std::vector<Step> steps,
+    bool trackCpuUsage)
+    : SpecialForm(
+          SpecialFormKind::kCustom,
+          original->type(),
+          std::move(leaves),
+          original->name(),
+          original->supportsFlatNoNullsFastPath(),
+          trackCpuUsage),
+      original_(std::move(original)),
+      steps_(std::move(steps)) {
+  VELOX_CHECK(!steps_.empty());
+}
+
+void FusedExpr::evalSpecialForm(
+    const SelectivityVector& rows,
+    EvalCtx& context,
+    VectorPtr& result) {
+  std::vector<VectorPtr> leafValues(inputs_.size());
+  bool canFuse = true;
+  for (auto i = 0; i < inputs_.size(); ++i) {
+    inputs_[i]->eval(rows, context, leafValues[i]);
+    const auto& values = leafValues[i];
+    if (values->isConstantEncoding()) {
+      canFuse &= !values->isNullAt(0);
+    } else {
+      canFuse &= values->isFlatEncoding() && values->valuesAsVoid() != nullptr;
+    }
+  }
+  if (canFuse && evalBlocks(rows, leafValues, context, result)) {
+    return;
+  }
+  original_->eval(rows, context, result);
+}
+
+bool FusedExpr::evalBlocks(
+    const SelectivityVector& rows,
+    const std::vector<VectorPtr>& leafValues,
+    EvalCtx& context,
+    VectorPtr& result) {
+  const auto numLeaves = inputs_.size();
+  const auto numSlots = numLeaves + steps_.size();
+  scratch_.resize(numSlots);
+  auto ensureScratch = [&](auto slot, auto width) {
+    if (scratch_[slot] == nullptr) {
+      scratch_[slot] =
+          AlignedBuffer::allocate<char>(kBlockSize * width, context.pool());
+    }
+    return scratch_[slot]->template asMutable<char>();
+  };
+
+  // Flat leaves are read in place. Constant leaves are repeated to fill a
+  // block.
+  std::vector<const char*> slotValues(numSlots);
+  std::vector<int32_t> leafWidths(numLeaves);
+  for (auto i = 0; i < numLeaves; ++i) {
+    const auto width = inputs_[i]->type()->cppSizeInBytes();
+    leafWidths[i] = width;
+    if (!leafValues[i]->isConstantEncoding()) {
+      continue;
+    }
+    const auto* values =
+        static_cast<const char*>(leafValues[i]->valuesAsVoid());
+    auto* repeated = ensureScratch(i, width);
+    for (auto row = 0; row < kBlockSize; ++row) {
+      memcpy(repeated + row * width, values, width);
+    }
+    slotValues[i] = repeated;
+  }
+
+  context.ensureWritable(rows, type(), result);
+  const auto resultWidth = steps_.back().width;
+  const bool isBoolean = type()->kind() == TypeKind::BOOLEAN;
+  auto* rawResult = result->values()->asMutable<char>();
+  const auto* selected = rows.asRange().bits();
+  std::vector<const void*> args;
+  for (auto begin = rows.begin(); begin < rows.end(); begin += kBlockSize) {
+    const auto end = std::min(begin + kBlockSize, rows.end());
+    for (auto i = 0; i < numLeaves; ++i) {
+      if (!leafValues[i]->isConstantEncoding()) {
+        slotValues[i] = static_cast<const char*>(
+                            leafValues[i]->valuesAsVoid()) +
+            begin * leafWidths[i];
+      }
+    }
+    for (auto i = 0; i < steps_.size(); ++i) {
+      const auto& step = steps_[i];
+      args.clear();
+      for (auto arg : step.args) {
+        args.push_back(slotValues[arg]);
+      }
+      auto* values = ensureScratch(numLeaves + i, step.width);
+      if (!applyStep(step, end - begin, args.data(), values)) {
+        return false;
+      }
+      slotValues[numLeaves + i] = values;
+    }
+
+    const auto* values = slotValues.back();
+    if (isBoolean) {
+      auto* rawBits = reinterpret_cast<uint64_t*>(rawResult);
+      bits::forEachSetBit(selected, begin, end, [&](auto row) {
+        bits::setBit(rawBits, row, values[row - begin]);
+      });
+    } else if (bits::isAllSet(selected, begin, end)) {
+      memcpy(
+          rawResult + begin * resultWidth,
+          values,
+          (end - begin) * resultWidth);
+    } else {
+      bits::forEachSetBit(selected, begin, end, [&](auto row) {
+        memcpy(
+            rawResult + row * resultWidth,
+            values + (row - begin) * resultWidth,
+            resultWidth);
+      });
+    }
+  }
+
+  // A null in any leaf makes the result null since all functions have
+  // default null behavior.
+  result->clearNulls(rows);
+  for (const auto& values : leafValues) {
+    if (values->isConstantEncoding() || !values->mayHaveNulls()) {
+      continue;
+    }
+    const auto* leafNulls = values->rawNulls();
+    auto* rawNulls = result->mutableRawNulls();
+    rows.applyToSelected([&](auto row) {
+      if (bits::isBitNull(leafNulls, row)) {
+        bits::setNull(rawNulls, row);
+      }
+    });
+  }
+  return true;
+}
+
+} // namespace facebook::velox::exec
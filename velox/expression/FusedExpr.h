@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/expression/SpecialForm.h"
+
+namespace facebook::velox::exec {
+
+/// Evaluates a tree of simple functions over fixed width types, e.g. a * b +
+/// c > d, in blocks of consecutive rows. Each function runs a dense loop over
+/// the values of its arguments in cache resident scratch buffers, so that
+/// intermediate results are not materialized as vectors. The leaves of the
+/// tree are field references and constants. Evaluates the original tree
+/// instead if a leaf is not flat or constant or if a function fails for any
+/// row of a block, e.g. on overflow, so that errors are reported as usual.
+class FusedExpr : public SpecialForm {
+ public:
+  /// Number of rows evaluated by each function at a time.
+  static constexpr vector_size_t kBlockSize = 1'024;
+
+  /// A function of the tree. 'args' are the slots of its arguments. The
+  /// leaves are slots [0, number of leaves) and the i-th step is slot number
+  /// of leaves + i.
+  struct Step {
+    const VectorFunction* function;
+    std::vector<TypePtr> argTypes;
+    std::vector<int32_t> args;
+    // Byte width of a result value.
+    int32_t width;
+  };
+
+  /// Returns a FusedExpr that evaluates 'expr' or nullptr if 'expr' and its
+  /// inputs do not form a tree of at least two functions that support dense
+  /// evaluation.
+  static ExprPtr tryFuse(const ExprPtr& expr, bool trackCpuUsage);
+
+  FusedExpr(
+      ExprPtr original,
+      std::vector<ExprPtr> leaves,
+      std::vector<Step> steps,
+      bool trackCpuUsage);
+
+  void evalSpecialForm(
+      const SelectivityVector& rows,
+      EvalCtx& context,
+      VectorPtr& result) override;
+
+  std::string toString(bool recursive = true) const override {
+    return original_->toString(recursive);
+  }
+
+  std::string toSql(
+      std::vector<VectorPtr>* complexConstants = nullptr) const override {
+    return original_->toSql(complexConstants);
+  }
+
+  void clearCache() override {
+    Expr::clearCache();
+    original_->clearCache();
+  }
+
+  const ExprPtr& original() const {
+    return original_;
+  }
+
+  /// Returns the number of functions evaluated per block of rows.
+  size_t numSteps() const {
+    return steps_.size();
+  }
+
+ private:
+  void computePropagatesNulls() override {
+    propagatesNulls_ = true;
+  }
+
+  // Evaluates the steps over the flat or constant 'leafValues'. Returns false
+  // if a function fails for any row.
+  bool evalBlocks(
+      const SelectivityVector& rows,
+      const std::vector<VectorPtr>& leafValues,
+      EvalCtx& context,
+      VectorPtr& result);
+
+  // The tree of functions. Evaluated instead of 'this' when the steps fail.
+  const ExprPtr original_;
+
+  // The functions of 'original_' in post order. The last step produces the
+  // result.
+  const std::vector<Step> steps_;
+
+  // kBlockSize values for each slot that is a constant leaf or a step.
+  // Allocated on first use.
+  std::vector<BufferPtr> scratch_;
+};
+
+} // namespace facebook::velox::exec
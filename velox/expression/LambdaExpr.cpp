@@ -37,10 +37,14 @@ class ExprCallable : public Callable {
       : signature_(std::move(signature)),
         capture_(std::move(capture)),
         body_(std::move(body)),
-        sharedExprsToReset_(std::move(sharedExprsToReset)) {}
+        sharedExprsToReset_(std::move(sharedExprsToReset)) {
+    for (auto i = signature_->size(); i < capture_->childrenSize(); ++i) {
+      hasNonConstantCapture_ |= !capture_->childAt(i)->isConstantEncoding();
+    }
+  }
 
   bool hasCapture() const override {
-    return capture_->childrenSize() > signature_->size();
+    return hasNonConstantCapture_;
   }
 
   void apply(
@@ -120,7 +124,12 @@ class ExprCallable : public Callable {
     for (auto index = args.size(); index < capture_->childrenSize(); ++index) {
       auto values = capture_->childAt(index);
       VELOX_DCHECK(!isLazyNotLoaded(*values));
-      if (wrapCapture) {
+      if (values->isConstantEncoding()) {
+        // Constant captures are resized instead of wrapped in a dictionary.
+        if (values->size() != size) {
+          values = BaseVector::wrapInConstant(size, 0, values);
+        }
+      } else if (wrapCapture) {
         values = BaseVector::wrapInDictionary(
             BufferPtr(nullptr), wrapCapture, size, values);
       }
@@ -142,6 +151,9 @@ class ExprCallable : public Callable {
   // List of Shared Exprs that are decendants of 'body_' for which reset() needs
   // to be called before calling `body_->eval()`.
   std::vector<std::shared_ptr<Expr>> sharedExprsToReset_;
+  // True if a capture is not constant, so that the captures need to be
+  // aligned with the arguments.
+  bool hasNonConstantCapture_{false};
 };
 
 void extractSharedExpressions(
@@ -238,6 +250,38 @@ void LambdaExpr::evalSpecialForm(
   if (!typeWithCapture_) {
     makeTypeWithCapture(context);
   }
+  std::shared_ptr<Callable> callable;
+  if (capture_.empty()) {
+    // Without captures the callable does not depend on the batch.
+    if (!captureFreeCallable_) {
+      auto capture = std::make_shared<RowVector>(
+          context.pool(),
+          typeWithCapture_,
+          BufferPtr(nullptr),
+          0,
+          std::vector<VectorPtr>(typeWithCapture_->size()),
+          0);
+      captureFreeCallable_ = std::make_shared<ExprCallable>(
+          signature_, capture, body_, sharedExprsToReset_);
+    }
+    callable = captureFreeCallable_;
+  } else {
+    callable = makeCallable(rows, context);
+  }
+  std::shared_ptr<FunctionVector> functions;
+  if (!result) {
+    functions = std::make_shared<FunctionVector>(context.pool(), type_);
+    result = functions;
+  } else {
+    VELOX_CHECK(result->encoding() == VectorEncoding::Simple::FUNCTION);
+    functions = std::static_pointer_cast<FunctionVector>(result);
+  }
+  functions->addFunction(callable, rows);
+}
+
+std::shared_ptr<Callable> LambdaExpr::makeCallable(
+    const SelectivityVector& rows,
+    EvalCtx& context) {
   std::vector<VectorPtr> values(typeWithCapture_->size());
   for (auto i = 0; i < captureChannels_.size(); ++i) {
     assert(!values.empty());
@@ -254,17 +298,8 @@ void LambdaExpr::evalSpecialForm(
       rows.end(),
       values,
       0);
-  auto callable = std::make_shared<ExprCallable>(
+  return std::make_shared<ExprCallable>(
       signature_, capture, body_, sharedExprsToReset_);
-  std::shared_ptr<FunctionVector> functions;
-  if (!result) {
-    functions = std::make_shared<FunctionVector>(context.pool(), type_);
-    result = functions;
-  } else {
-    VELOX_CHECK(result->encoding() == VectorEncoding::Simple::FUNCTION);
-    functions = std::static_pointer_cast<FunctionVector>(result);
-  }
-  functions->addFunction(callable, rows);
 }
 
 void LambdaExpr::makeTypeWithCapture(EvalCtx& context) {
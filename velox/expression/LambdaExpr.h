@@ -16,6 +16,7 @@
 #pragma once
 
 #include "velox/expression/SpecialForm.h"
+#include "velox/vector/FunctionVector.h"
 
 namespace facebook::velox::exec {
 
@@ -60,6 +61,11 @@ class LambdaExpr : public SpecialForm {
   /// Used to initialize captureChannels_ and typeWithCapture_ on first use.
   void makeTypeWithCapture(EvalCtx& context);
 
+  /// Returns a callable over the values of the captures for 'rows'.
+  std::shared_ptr<Callable> makeCallable(
+      const SelectivityVector& rows,
+      EvalCtx& context);
+
   void computePropagatesNulls() override {
     // A null capture does not result in a null function.
     propagatesNulls_ = false;
@@ -95,5 +101,9 @@ class LambdaExpr : public SpecialForm {
   /// create an input row vector which is fed to the inner expression. Filled on
   /// first use.
   RowTypePtr typeWithCapture_;
+
+  /// The callable of a lambda without captures. Created on first use and
+  /// shared by all batches.
+  std::shared_ptr<Callable> captureFreeCallable_;
 };
 } // namespace facebook::velox::exec
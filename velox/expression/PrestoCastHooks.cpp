@@ -15,6 +15,7 @@
  */
 
 #include <cmath>
+#include <limits>
 
 #include <double-conversion/double-conversion.h>
 #include <folly/Expected.h>
@@ -88,6 +89,62 @@ namespace {
 
 using double_conversion::StringToDoubleConverter;
 
+// Parses plain decimal strings of the form -?[0-9]+(.[0-9]+)? whose digits fit
+// in the mantissa of T and whose number of fractional digits is an exactly
+// representable power of ten. For such input a single division is correctly
+// rounded (Clinger's fast path), so the result matches double-conversion.
+// Returns false for anything else, e.g. exponents, NaN, Infinity, trailing
+// spaces or long mantissas, and the caller falls back to the full parser.
+template <typename T>
+bool tryParseSimpleDecimal(const char* begin, const char* end, T& result) {
+  static constexpr T kPowersOfTen[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  // Largest exactly representable integer and power of ten for T.
+  constexpr uint64_t kMaxMantissa =
+      uint64_t(1) << std::numeric_limits<T>::digits;
+  constexpr int32_t kMaxPower = std::is_same_v<T, float> ? 10 : 22;
+  // At most 19 digits so that the mantissa cannot overflow uint64_t.
+  constexpr int32_t kMaxDigits = 19;
+
+  const char* pos = begin;
+  const bool negative = pos < end && *pos == '-';
+  if (negative) {
+    ++pos;
+  }
+  uint64_t mantissa = 0;
+  int32_t numDigits = 0;
+  const char* digitsBegin = pos;
+  for (; pos < end && *pos >= '0' && *pos <= '9'; ++pos) {
+    mantissa = mantissa * 10 + (*pos - '0');
+    ++numDigits;
+  }
+  if (pos == digitsBegin) {
+    return false;
+  }
+  int32_t power = 0;
+  if (pos < end && *pos == '.') {
+    const char* fractionBegin = ++pos;
+    for (; pos < end && *pos >= '0' && *pos <= '9'; ++pos) {
+      mantissa = mantissa * 10 + (*pos - '0');
+      ++numDigits;
+    }
+    power = pos - fractionBegin;
+    if (power == 0) {
+      return false;
+    }
+  }
+  if (pos != end || numDigits > kMaxDigits || mantissa > kMaxMantissa ||
+      power > kMaxPower) {
+    return false;
+  }
+  result = static_cast<T>(mantissa) / kPowersOfTen[power];
+  if (negative) {
+    result = -result;
+  }
+  return true;
+}
+
 template <typename T>
 Expected<T> doCastToFloatingPoint(const StringView& data) {
   static const T kNan = std::numeric_limits<T>::quiet_NaN();
@@ -107,6 +164,9 @@ Expected<T> doCastToFloatingPoint(const StringView& data) {
     // 'data' only contains white spaces.
     return folly::makeUnexpected(Status::UserError());
   }
+  if (tryParseSimpleDecimal<T>(begin, data.end(), result)) {
+    return result;
+  }
   if constexpr (std::is_same_v<T, float>) {
     result = stringToDoubleConverter.StringToFloat(
         begin, length, &processedCharactersCount);
@@ -151,6 +151,60 @@ class SimpleFunctionAdapter : public VectorFunction {
     }() && ...);
   }
 
+  template <size_t... Is>
+  constexpr bool static allArgsDenseEvaluationEligibleImpl(
+      std::index_sequence<Is...>) {
+    return ([&]() {
+      if constexpr (isVariadicType<arg_at<Is>>::value) {
+        return false;
+      } else {
+        return isArgFlatConstantFastPathEligible<Is> &&
+            SimpleTypeTrait<arg_at<Is>>::isFixedWidth;
+      }
+    }() && ...);
+  }
+
+  /// True if the function can be evaluated over dense arrays of fixed width
+  /// values with applyDense(). The function must not produce nulls for non
+  /// null arguments.
+  constexpr bool static denseEvaluationEligible() {
+    if constexpr (
+        !fastPathIteration || !FUNC::udf_has_call ||
+        !FUNC::is_default_null_behavior || FUNC::can_produce_null_output ||
+        FUNC::num_args == 0) {
+      return false;
+    } else {
+      return allArgsDenseEvaluationEligibleImpl(
+          std::make_index_sequence<FUNC::num_args>());
+    }
+  }
+
+  template <size_t... Is>
+  bool applyDenseImpl(
+      vector_size_t numRows,
+      const void* const* args,
+      T* result,
+      std::index_sequence<Is...>) const {
+    const std::tuple<const exec_arg_at<Is>*...> values{
+        static_cast<const exec_arg_at<Is>*>(args[Is])...};
+    bool allOk = true;
+    for (vector_size_t row = 0; row < numRows; ++row) {
+      bool notNull;
+      auto status =
+          (*fn_).call(result[row], notNull, std::get<Is>(values)[row]...);
+      allOk &= status.ok() & notNull;
+    }
+    return allOk;
+  }
+
+  /// True if apply() can evaluate the function over contiguous arrays of
+  /// flat arguments without nulls, either with callBatch() or with a dense
+  /// loop over call() that the compiler can vectorize.
+  constexpr bool static batchEvaluationEligible() {
+    return denseEvaluationEligible() &&
+        return_type_traits::typeKind != TypeKind::BOOLEAN;
+  }
+
   /// When true, a fast path for each possible combination of encodings will be
   /// used for reading arguments when all arguments are flat or constant
   /// primitivies.
@@ -216,6 +270,47 @@ class SimpleFunctionAdapter : public VectorFunction {
     bool mayHaveNullsRecursive{false};
   };
 
+  // Evaluates a contiguous range of 'rows' where all 'args' are flat without
+  // nulls over the raw values of the arguments and the result. Returns false
+  // if the rows are not contiguous, an argument is not eligible or the
+  // function fails for any row. In that case the rows are evaluated again
+  // one at a time to report errors.
+  template <size_t... Is>
+  bool tryApplyBatch(
+      const SelectivityVector& rows,
+      const std::vector<VectorPtr>& args,
+      ApplyContext& applyContext,
+      std::index_sequence<Is...>) const {
+    const auto begin = rows.begin();
+    const auto numRows = rows.end() - begin;
+    if (numRows == 0 ||
+        !bits::isAllSet(rows.asRange().bits(), begin, rows.end())) {
+      return false;
+    }
+    for (const auto& arg : args) {
+      if (!arg->isFlatEncoding() || arg->mayHaveNulls()) {
+        return false;
+      }
+    }
+    auto* result = applyContext.result->mutableRawValues() + begin;
+    const std::tuple<const exec_arg_at<Is>*...> values{
+        args[Is]->template asUnchecked<FlatVector<exec_arg_at<Is>>>()
+            ->rawValues() +
+        begin...};
+    try {
+      if constexpr (FUNC::udf_has_callBatch) {
+        (*fn_).callBatch(result, numRows, std::get<Is>(values)...);
+        return true;
+      } else {
+        const void* const rawArgs[] = {std::get<Is>(values)...};
+        return applyDenseImpl(
+            numRows, rawArgs, result, std::index_sequence<Is...>{});
+      }
+    } catch (const std::exception&) {
+      return false;
+    }
+  }
+
   template <int32_t POSITION, typename... Values>
   void unpackInitialize(
       const std::vector<TypePtr>& inputTypes,
@@ -369,6 +464,19 @@ class SimpleFunctionAdapter : public VectorFunction {
       }
     }
 
+    if constexpr (batchEvaluationEligible()) {
+      if (tryApplyBatch(
+              rows,
+              args,
+              applyContext,
+              std::make_index_sequence<FUNC::num_args>())) {
+        if (isResultReused) {
+          result = std::move(*reusableResult);
+        }
+        return;
+      }
+    }
+
     std::vector<std::optional<LocalDecodedVector>> decoded;
     if (allPrimitiveArgsFlatConstant(args)) {
       if constexpr (
@@ -451,6 +559,30 @@ class SimpleFunctionAdapter : public VectorFunction {
     }
   }
 
+  bool supportsDenseEvaluation() const override {
+    if constexpr (denseEvaluationEligible()) {
+      return initializeException_ == nullptr;
+    } else {
+      return false;
+    }
+  }
+
+  bool applyDense(
+      const std::vector<TypePtr>& /*argTypes*/,
+      vector_size_t numRows,
+      const void* const* args,
+      void* result) const override {
+    if constexpr (denseEvaluationEligible()) {
+      return applyDenseImpl(
+          numRows,
+          args,
+          static_cast<T*>(result),
+          std::make_index_sequence<FUNC::num_args>());
+    } else {
+      VELOX_UNSUPPORTED("Dense evaluation is not supported");
+    }
+  }
+
   bool ensureStringEncodingSetAtAllInputs() const override {
     return fn_->has_ascii;
   }
@@ -91,6 +91,27 @@ class VectorFunction {
     return false;
   }
 
+  /// Returns true if applyDense() is supported. Only deterministic functions
+  /// over fixed width arguments that never produce a null for non-null
+  /// arguments may support it.
+  virtual bool supportsDenseEvaluation() const {
+    return false;
+  }
+
+  /// Computes the function for 'numRows' consecutive rows. 'args' has a
+  /// pointer to 'numRows' values of each of 'argTypes' and 'result' has space
+  /// for 'numRows' values of the result type. Booleans are one byte per
+  /// value. Returns false if the function fails for any row. May also throw,
+  /// in which case the caller evaluates the rows with apply() to report
+  /// errors.
+  virtual bool applyDense(
+      const std::vector<TypePtr>& /*argTypes*/,
+      vector_size_t /*numRows*/,
+      const void* const* /*args*/,
+      void* /*result*/) const {
+    VELOX_UNSUPPORTED("Dense evaluation is not supported");
+  }
+
   // The evaluation engine will scan and set the string encoding of the
   // specified input arguments when presented if their type is VARCHAR before
   // applying the function
@@ -295,6 +316,30 @@ std::vector<ExpressionRewrite>& expressionRewrites();
 /// non-null result terminates the re-write for this particular expression.
 void registerExpressionRewrite(ExpressionRewrite rewrite);
 
+/// Replacements for subexpressions of the expressions of an ExprSet. Maps a
+/// subexpression to an equivalent expression.
+using ExpressionReplacements =
+    std::unordered_map<const core::ITypedExpr*, core::TypedExprPtr>;
+
+/// An expression re-writer that takes all the expressions compiled together
+/// into one ExprSet and returns replacements for some of their
+/// subexpressions. Allows combining subexpressions of different expressions,
+/// e.g. to share work between calls that read the same input. Replacements
+/// do not apply inside lambda functions.
+using ExpressionSetRewrite = std::function<ExpressionReplacements(
+    const std::vector<core::TypedExprPtr>&)>;
+
+/// Returns a list of registered expression set re-writes.
+std::vector<ExpressionSetRewrite>& expressionSetRewrites();
+
+/// Appends a 'rewrite' to 'expressionSetRewrites'. All registered rewrites
+/// are applied to the expressions of an ExprSet before compilation. If more
+/// than one rewrite replaces the same subexpression, the first one wins.
+/// Replaced subexpressions are then compiled as if they were the
+/// replacement, so that identical replacements are compiled once as common
+/// subexpressions.
+void registerExpressionSetRewrite(ExpressionSetRewrite rewrite);
+
 } // namespace facebook::velox::exec
 
 // Private. Return the external function name given a UDF tag.
@@ -99,6 +99,10 @@ int main(int argc, char** argv) {
       "construct_tdigest",
       "destructure_tdigest",
       "trimmed_mean",
+      // Internal function produced by rewriting an OR of LIKE patterns.
+      "$internal$re2_search_any",
+      // Internal function produced by sharing json_extract_scalar calls.
+      "$internal$json_extract_scalar_multi",
       // Fuzzer cannot generate valid 'comparator' lambda.
       "array_sort(array(T),constant function(T,T,bigint)) -> array(T)",
       "array_sort(array(T),constant function(T,U)) -> array(T)",
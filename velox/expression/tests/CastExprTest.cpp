@@ -1220,6 +1220,31 @@ TEST_F(CastExprTest, primitiveValidCornerCases) {
     testCast<std::string, float>("real", {"  NaN  "}, {kNan});
     testCast<std::string, float>("real", {"  -NaN  "}, {kNan});
     testCast<std::string, float>("real", {"  +NaN  "}, {kNan});
+
+    // Plain decimals take a fast path when the digits fit in the mantissa and
+    // fall back to the general parser otherwise.
+    testCast<std::string, double>(
+        "double",
+        {"0.1",
+         "-0",
+         "-123.456",
+         "0012.50",
+         "9007199254740993",
+         "0.30000000000000004",
+         "1.5e3",
+         "12.5  "},
+        {0.1,
+         -0.0,
+         -123.456,
+         12.5,
+         9007199254740992.0,
+         0.30000000000000004,
+         1500.0,
+         12.5});
+    testCast<std::string, float>(
+        "real",
+        {"0.1", "-2.75", "16777217", "3.4028235e38"},
+        {0.1f, -2.75f, 16777216.0f, 3.4028235e38f});
   }
 
   // To boolean.
@@ -18,6 +18,7 @@
 #include "velox/core/Expressions.h"
 #include "velox/expression/EvalCtx.h"
 #include "velox/expression/Expr.h"
+#include "velox/expression/FunctionProfiler.h"
 #include "velox/functions/prestosql/registration/RegistrationFunctions.h"
 #include "velox/functions/prestosql/tests/utils/FunctionBaseTest.h"
 #include "velox/parse/Expressions.h"
@@ -345,6 +346,83 @@ TEST_F(ExprStatsTest, specialForms) {
   ASSERT_TRUE(exec::unregisterExprSetListener(listener));
 }
 
+TEST_F(ExprStatsTest, conjuncts) {
+  vector_size_t size = 1'024;
+  auto data = makeRowVector({
+      makeFlatVector<int32_t>(size, [](auto row) { return row; }),
+      makeFlatVector<int32_t>(size, [](auto row) { return row % 7; }),
+  });
+
+  // 'lt' is false for 924 rows. 'eq' runs on the other 100 rows and is false
+  // for 85 of them.
+  auto exprSet =
+      compileExpression("c0 < 100 and c1 = 0", asRowType(data->type()));
+  evaluate(*exprSet, data);
+  auto stats = exprSet->stats();
+  ASSERT_EQ(1024, stats.at("lt").numConjunctInputRows);
+  ASSERT_EQ(924, stats.at("lt").numConjunctDecidedRows);
+  ASSERT_LT(0, stats.at("lt").conjunctClocks);
+  ASSERT_EQ(100, stats.at("eq").numConjunctInputRows);
+  ASSERT_EQ(85, stats.at("eq").numConjunctDecidedRows);
+  ASSERT_EQ(0, stats.at("and").numConjunctInputRows);
+
+  // 'gt' is true for 1019 rows. 'eq' runs on the other 5 rows and is true
+  // for 1 of them.
+  exprSet = compileExpression("c0 > 4 or c1 = 0", asRowType(data->type()));
+  evaluate(*exprSet, data);
+  stats = exprSet->stats();
+  ASSERT_EQ(1024, stats.at("gt").numConjunctInputRows);
+  ASSERT_EQ(1019, stats.at("gt").numConjunctDecidedRows);
+  ASSERT_EQ(5, stats.at("eq").numConjunctInputRows);
+  ASSERT_EQ(1, stats.at("eq").numConjunctDecidedRows);
+}
+
+TEST_F(ExprStatsTest, functionProfile) {
+  queryCtx_->testingOverrideConfigUnsafe({
+      {core::QueryConfig::kExprTrackCpuUsage, "true"},
+      {core::QueryConfig::kExprFunctionProfileSampleRate, "2"},
+  });
+  auto& profiler = exec::FunctionProfiler::instance();
+  profiler.clear();
+
+  vector_size_t size = 1'024;
+  auto data = makeRowVector({
+      makeFlatVector<int32_t>(size, [](auto row) { return row; }),
+      makeFlatVector<int32_t>(size, [](auto row) { return row % 7; }),
+  });
+  auto exprSet = compileExpression("c0 + c1", asRowType(data->type()));
+  for (auto i = 0; i < 4; ++i) {
+    evaluate(*exprSet, data);
+  }
+
+  auto constantData = makeRowVector({
+      makeFlatVector<int32_t>(100, [](auto row) { return row; }),
+      makeConstant(1, 100),
+  });
+  for (auto i = 0; i < 2; ++i) {
+    evaluate(*exprSet, constantData);
+  }
+
+  auto functions = profiler.topFunctions(10);
+  ASSERT_EQ(1, functions.size());
+  const auto& profile = functions[0];
+  ASSERT_EQ("plus(INTEGER, INTEGER)", profile.signature);
+  ASSERT_EQ(3, profile.timing.count);
+  ASSERT_LT(0, profile.timing.cpuNanos);
+  ASSERT_EQ(2 * size + 100, profile.numRows);
+  ASSERT_EQ(size, profile.maxBatchSize);
+  ASSERT_EQ(2, profile.inputEncodings.size());
+  ASSERT_EQ(2, profile.inputEncodings.at("FLAT, FLAT"));
+  ASSERT_EQ(1, profile.inputEncodings.at("FLAT, CONSTANT"));
+  ASSERT_THAT(
+      profiler.toString(10),
+      testing::HasSubstr("plus(INTEGER, INTEGER): cpu time: "));
+
+  ASSERT_TRUE(profiler.topFunctions(0).empty());
+  profiler.clear();
+  ASSERT_TRUE(profiler.topFunctions(10).empty());
+}
+
 TEST_F(ExprStatsTest, errorLog) {
   // Register a listener to log exceptions.
   std::vector<Event> events;
@@ -2170,6 +2170,56 @@ TEST_F(ExprTest, memo) {
   VELOX_CHECK_EQ(base.use_count(), 1);
 }
 
+TEST_F(ExprTest, memoSharedValues) {
+  // Dictionaries over different base vectors that share the values buffer,
+  // as produced by a reader for each batch of a stripe, reuse the memo.
+  auto base = makeFlatVector<int64_t>(1'000, [](auto row) { return row; });
+  auto sameValues = [&]() {
+    return std::make_shared<FlatVector<int64_t>>(
+        pool(),
+        BIGINT(),
+        nullptr,
+        1'000,
+        base->values(),
+        std::vector<BufferPtr>{});
+  };
+  auto indices = makeIndices(100, [](auto row) { return row * 3; });
+  auto expectedResult =
+      makeFlatVector<int64_t>(100, [](auto row) { return row * 3 + 1; });
+
+  auto exprSet = compileExpression("c0 + 1", ROW({"c0"}, {BIGINT()}));
+  for (auto i = 0; i < 3; ++i) {
+    auto result = evaluateWithStats(
+                      exprSet.get(),
+                      makeRowVector(
+                          {wrapInDictionary(indices, 100, sameValues())}))
+                      .first;
+    assertEqualVectors(expectedResult, result);
+  }
+  auto stats = exprSet->stats();
+  ASSERT_EQ(stats["plus"].numProcessedRows, 200);
+  ASSERT_EQ(stats["plus"].numMemoMissRows, 100);
+  ASSERT_EQ(stats["plus"].numMemoHitRows, 100);
+
+  // Results larger than the budget are not memoized.
+  auto queryCtx = velox::core::QueryCtx::create(
+      nullptr,
+      core::QueryConfig({{core::QueryConfig::kMaxDictionaryMemoBytes, "1"}}));
+  auto execCtx = std::make_unique<core::ExecCtx>(pool_.get(), queryCtx.get());
+  exprSet = compileExpression("c0 + 1", ROW({"c0"}, {BIGINT()}));
+  for (auto i = 0; i < 3; ++i) {
+    auto result = evaluateWithStats(
+                      exprSet.get(),
+                      makeRowVector({wrapInDictionary(indices, 100, base)}),
+                      execCtx.get())
+                      .first;
+    assertEqualVectors(expectedResult, result);
+  }
+  stats = exprSet->stats();
+  ASSERT_EQ(stats["plus"].numProcessedRows, 300);
+  ASSERT_EQ(stats["plus"].numMemoHitRows, 0);
+}
+
 // This test triggers the situation when peelEncodings() produces an empty
 // selectivity vector, which if passed to evalWithMemo() causes the latter to
 // produce null Expr::dictionaryCache_, which leads to a crash in evaluation
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/expression/FusedExpr.h"
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/functions/prestosql/tests/utils/FunctionBaseTest.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::test;
+
+namespace facebook::velox::exec {
+namespace {
+
+class FusedExprTest : public functions::test::FunctionBaseTest {
+ protected:
+  void setFuseSimpleFunctions(bool value) {
+    queryCtx_->testingOverrideConfigUnsafe({
+        {core::QueryConfig::kExprFuseSimpleFunctions, std::to_string(value)},
+    });
+  }
+
+  // Returns the result of 'expression' over 'data' with fusion disabled.
+  VectorPtr evaluateUnfused(
+      const std::string& expression,
+      const RowVectorPtr& data) {
+    setFuseSimpleFunctions(false);
+    auto result = evaluate(expression, data);
+    setFuseSimpleFunctions(true);
+    return result;
+  }
+
+  // Returns the number of fused functions at the root of 'expression' or 0 if
+  // the root is not fused.
+  size_t numFusedSteps(const std::string& expression, const RowTypePtr& type) {
+    auto exprSet = compileExpression(expression, type);
+    const auto* fused = exprSet->expr(0)->as<FusedExpr>();
+    return fused == nullptr ? 0 : fused->numSteps();
+  }
+
+  void testFused(const std::string& expression, const RowVectorPtr& data) {
+    SCOPED_TRACE(expression);
+    auto expected = evaluateUnfused(expression, data);
+    assertEqualVectors(expected, evaluate(expression, data));
+
+    // Every other row.
+    SelectivityVector rows(data->size(), false);
+    for (auto i = 0; i < data->size(); i += 2) {
+      rows.setValid(i, true);
+    }
+    rows.updateBounds();
+    auto result = evaluate(expression, data, rows);
+    assertEqualVectors(expected, result, rows);
+  }
+};
+
+TEST_F(FusedExprTest, arithmeticAndComparison) {
+  setFuseSimpleFunctions(true);
+  const vector_size_t size = 3 * FusedExpr::kBlockSize + 17;
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(size, [](auto row) { return row; }),
+      makeFlatVector<int64_t>(size, [](auto row) { return row % 7; }),
+      makeFlatVector<int64_t>(
+          size, [](auto row) { return row * 3; }, nullEvery(11)),
+      makeFlatVector<int64_t>(size, [](auto row) { return row * 5; }),
+      makeFlatVector<double>(size, [](auto row) { return row * 0.5; }),
+  });
+  const auto rowType = asRowType(data->type());
+
+  EXPECT_EQ(numFusedSteps("c0 * c1 + c2 > c3", rowType), 3);
+  EXPECT_EQ(numFusedSteps("c0 * c1", rowType), 0);
+  EXPECT_EQ(numFusedSteps("c4 * 2.0 + c4", rowType), 2);
+
+  testFused("c0 * c1 + c2 > c3", data);
+  testFused("c0 * c1 + c2 - c3", data);
+  testFused("c4 * 2.0 + c4 <= cast(c3 as double)", data);
+  testFused("(c0 + 1) * (c0 - 1)", data);
+}
+
+TEST_F(FusedExprTest, fallback) {
+  setFuseSimpleFunctions(true);
+  const vector_size_t size = 2 * FusedExpr::kBlockSize;
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(
+          size,
+          [](auto row) {
+            return row == 1'501 ? std::numeric_limits<int64_t>::max() : row;
+          }),
+      makeFlatVector<int64_t>(size, [](auto row) { return row % 3; }),
+  });
+  ASSERT_EQ(numFusedSteps("c0 * c1 + 1", asRowType(data->type())), 2);
+
+  // Overflow in one row reports the error of the unfused evaluation.
+  VELOX_ASSERT_THROW(evaluate("c0 * c1 + 1", data), "overflow");
+  testFused("try(c0 * c1 + 1)", data);
+
+  // Dictionary encoded inputs are evaluated without fusion.
+  auto indices = makeIndicesInReverse(size);
+  auto dictionary = makeRowVector({
+      wrapInDictionary(indices, size, data->childAt(0)),
+      data->childAt(1),
+  });
+  testFused("try(c0 * c1 + 1)", dictionary);
+  testFused("try(c1 * c1 + c1)", dictionary);
+}
+
+} // namespace
+} // namespace facebook::velox::exec
@@ -1609,6 +1609,79 @@ TEST_F(SimpleFunctionTest, callNullFreeNoThrow) {
   EXPECT_EQ(2, result);
 }
 
+template <typename TExec>
+struct BatchPlusOneFunction {
+  VELOX_DEFINE_FUNCTION_TYPES(TExec);
+
+  static inline int32_t numBatches{0};
+
+  void call(out_type<int64_t>& out, const arg_type<int64_t>& in) {
+    VELOX_USER_CHECK_GE(in, 0, "Input must not be negative");
+    out = in + 1;
+  }
+
+  void callBatch(int64_t* out, int32_t numRows, const int64_t* in) {
+    ++numBatches;
+    for (auto i = 0; i < numRows; ++i) {
+      VELOX_USER_CHECK_GE(in[i], 0, "Input must not be negative");
+      out[i] = in[i] + 1;
+    }
+  }
+};
+
+TEST_F(SimpleFunctionTest, callBatch) {
+  registerFunction<BatchPlusOneFunction, int64_t, int64_t>({"batch_plus_one"});
+  auto& numBatches = BatchPlusOneFunction<exec::VectorExec>::numBatches;
+  const vector_size_t size = 1'000;
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(size, [](auto row) { return row; }),
+      makeFlatVector<int64_t>(
+          size, [](auto row) { return row; }, nullEvery(7)),
+      makeFlatVector<int64_t>(
+          size, [](auto row) { return row == 500 ? -1 : row; }),
+  });
+  auto expected = makeFlatVector<int64_t>(size, [](auto row) {
+    return row + 1;
+  });
+
+  // Flat inputs without nulls are evaluated in one batch.
+  numBatches = 0;
+  auto result = evaluate("batch_plus_one(c0)", data);
+  assertEqualVectors(expected, result);
+  EXPECT_EQ(1, numBatches);
+
+  // Inputs with nulls are evaluated one row at a time.
+  numBatches = 0;
+  result = evaluate("batch_plus_one(c1)", data);
+  assertEqualVectors(
+      makeFlatVector<int64_t>(
+          size, [](auto row) { return row + 1; }, nullEvery(7)),
+      result);
+  EXPECT_EQ(0, numBatches);
+
+  // Rows that are not contiguous are evaluated one row at a time.
+  numBatches = 0;
+  SelectivityVector rows(size);
+  rows.setValid(10, false);
+  rows.updateBounds();
+  result = evaluate("batch_plus_one(c0)", data, rows);
+  assertEqualVectors(expected, result, rows);
+  EXPECT_EQ(0, numBatches);
+
+  // A failed batch is evaluated again one row at a time to report errors.
+  numBatches = 0;
+  VELOX_ASSERT_THROW(
+      evaluate("batch_plus_one(c2)", data), "Input must not be negative");
+  EXPECT_EQ(1, numBatches);
+  result = evaluate("try(batch_plus_one(c2))", data);
+  assertEqualVectors(
+      makeFlatVector<int64_t>(
+          size,
+          [](auto row) { return row + 1; },
+          [](auto row) { return row == 500; }),
+      result);
+}
+
 template <typename TExec>
 struct DecimalPlusValueFunction {
   VELOX_DEFINE_FUNCTION_TYPES(TExec);
@@ -125,8 +125,41 @@ DEFINE_int32(
     80,
     "Minimum percentage of actual uses over references to a column for prefetching. No prefetch if > 100");
 
+DEFINE_bool(
+    velox_cache_scan_history,
+    false,
+    "Record the read density of streams by file group across scans, so that "
+    "streams that earlier scans of the group read densely are prefetched on "
+    "first use");
+
 DEFINE_bool(velox_ssd_odirect, true, "Use O_DIRECT for SSD cache IO");
 
+DEFINE_bool(
+    velox_ssd_io_uring,
+    false,
+    "Use io_uring for SSD cache IO if Velox is built with io_uring support");
+
+// Used in dwio/common/compression/QatDecompressor.cpp
+
+DEFINE_bool(
+    velox_qat_decompression,
+    false,
+    "Offload zlib and gzip decompression of DWRF/ORC and Parquet streams to "
+    "Intel QAT if Velox is built with QAT support");
+
+DEFINE_bool(
+    velox_ssd_async_recovery,
+    false,
+    "Read the SSD cache checkpoints in the background. The recovered entries "
+    "are readable while the rest of the checkpoint is read and writes to a "
+    "shard are dropped until its recovery is done");
+
+DEFINE_bool(
+    velox_spill_io_uring,
+    false,
+    "Use io_uring for local spill file IO if Velox is built with io_uring "
+    "support");
+
 DEFINE_bool(
     velox_ssd_verify_write,
     false,
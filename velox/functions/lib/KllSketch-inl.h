@@ -307,6 +307,43 @@ void KllSketch<T, A, C>::insert(T value) {
   doInsert(value);
 }
 
+template <typename T, typename A, typename C>
+void KllSketch<T, A, C>::insertBatch(const T* values, size_t count) {
+  if (count == 0) {
+    return;
+  }
+  T minValue = n_ == 0 ? values[0] : minValue_;
+  T maxValue = n_ == 0 ? values[0] : maxValue_;
+  for (size_t i = 0; i < count; ++i) {
+    minValue = std::min(minValue, values[i], C());
+    maxValue = std::max(maxValue, values[i], C());
+  }
+  minValue_ = minValue;
+  maxValue_ = maxValue;
+  size_t i = 0;
+  while (i < count) {
+    if (items_.size() < k_ && numLevels() == 1) {
+      const size_t num = std::min<size_t>(k_ - items_.size(), count - i);
+      items_.insert(items_.end(), values + i, values + i + num);
+      levels_[1] += num;
+      n_ += num;
+      i += num;
+    } else if (levels_[0] > 0) {
+      // Level 0 is not sorted, so the order of the values within the free
+      // space does not matter.
+      const size_t num = std::min<size_t>(levels_[0], count - i);
+      std::copy(values + i, values + i + num, &items_[levels_[0] - num]);
+      levels_[0] -= num;
+      n_ += num;
+      i += num;
+    } else {
+      // No free space, insertPosition() compacts a level.
+      doInsert(values[i++]);
+    }
+  }
+  isLevelZeroSorted_ = false;
+}
+
 template <typename T, typename A, typename C>
 void KllSketch<T, A, C>::doInsert(T value) {
   VELOX_DCHECK_GT(k_, 0);
@@ -82,6 +82,11 @@ struct KllSketch {
   /// Add one new value to the sketch.
   void insert(T value);
 
+  /// Add `count` values to the sketch.  Equivalent to calling insert() on each
+  /// of them, but fills the free space of level 0 with bulk copies and only
+  /// compacts when level 0 is full.
+  void insertBatch(const T* values, size_t count);
+
   /// Call this before serialization can optimize the space used.
   void compact();
 
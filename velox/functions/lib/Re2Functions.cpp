@@ -14,6 +14,11 @@
  * limitations under the License.
  */
 #include "velox/functions/lib/Re2Functions.h"
+
+#include <re2/set.h>
+
+#include "velox/common/base/SimdUtil.h"
+#include "velox/core/Expressions.h"
 #include "velox/functions/lib/string/StringImpl.h"
 #include "velox/vector/FunctionVector.h"
 
@@ -674,9 +679,11 @@ bool matchSuffixPattern(
 bool matchSubstringPattern(
     const StringView& input,
     const std::string& fixedPattern) {
-  return (
-      std::string_view(input).find(std::string_view(fixedPattern)) !=
-      std::string::npos);
+  return simd::simdStrstr(
+             input.data(),
+             input.size(),
+             fixedPattern.data(),
+             fixedPattern.size()) != std::string::npos;
 }
 
 bool matchSubstringsPattern(
@@ -684,9 +691,8 @@ bool matchSubstringsPattern(
     const std::vector<std::string>& patterns) {
   const char* data = input.data();
   for (int i = 0; i < patterns.size(); i++) {
-    auto curPos =
-        std::string_view(data, input.end() - data)
-            .find(std::string_view(patterns[i].c_str(), patterns[i].size()));
+    auto curPos = simd::simdStrstr(
+        data, input.end() - data, patterns[i].data(), patterns[i].size());
     if (curPos == std::string::npos) {
       return false;
     }
@@ -1643,8 +1649,219 @@ class RegexpReplaceWithLambdaFunction : public exec::VectorFunction {
   mutable detail::ReCache cache_;
 };
 
+// Returns an RE2::Set that searches for 'patterns' anywhere in the input or
+// nullptr if any of the patterns is invalid or the set does not compile.
+std::unique_ptr<RE2::Set> makeSearchSet(
+    const std::vector<std::string>& patterns) {
+  auto set = std::make_unique<RE2::Set>(RE2::Quiet, RE2::UNANCHORED);
+  for (const auto& pattern : patterns) {
+    if (set->Add(pattern, nullptr) < 0) {
+      return nullptr;
+    }
+  }
+  if (!set->Compile()) {
+    return nullptr;
+  }
+  return set;
+}
+
+// Returns true if the input matches any of a set of constant patterns. The
+// patterns are matched in a single pass over the input.
+class Re2SearchAny final : public exec::VectorFunction {
+ public:
+  explicit Re2SearchAny(std::unique_ptr<RE2::Set> set) : set_(std::move(set)) {}
+
+  void apply(
+      const SelectivityVector& rows,
+      std::vector<VectorPtr>& args,
+      const TypePtr& /* outputType */,
+      exec::EvalCtx& context,
+      VectorPtr& resultRef) const final {
+    FlatVector<bool>& result = ensureWritableBool(rows, context, resultRef);
+    exec::LocalDecodedVector toSearch(context, *args[0], rows);
+    context.applyToSelectedNoThrow(rows, [&](vector_size_t row) {
+      result.set(
+          row,
+          set_->Match(
+              toStringPiece(toSearch->valueAt<StringView>(row)), nullptr));
+    });
+  }
+
+ private:
+  const std::unique_ptr<RE2::Set> set_;
+};
+
+// Disjuncts with fewer patterns over the same input are left as is.
+constexpr size_t kMinSearchAnyPatterns = 4;
+
+std::optional<std::string> getConstantString(const core::TypedExprPtr& expr) {
+  auto constant =
+      std::dynamic_pointer_cast<const core::ConstantTypedExpr>(expr);
+  if (constant == nullptr || constant->isNull() ||
+      constant->type()->kind() != TypeKind::VARCHAR) {
+    return std::nullopt;
+  }
+  if (constant->hasValueVector()) {
+    return std::string(constant->valueVector()
+                           ->as<ConstantVector<StringView>>()
+                           ->valueAt(0));
+  }
+  return constant->value().value<TypeKind::VARCHAR>();
+}
+
+// If 'expr' is a LIKE or a regexp_like with constant patterns, sets 'input'
+// to the string to match and returns an RE2 pattern that matches the same
+// strings anywhere in the input.
+std::optional<std::string> toSearchPattern(
+    const std::string& prefix,
+    const core::TypedExprPtr& expr,
+    core::TypedExprPtr& input) {
+  auto call = std::dynamic_pointer_cast<const core::CallTypedExpr>(expr);
+  if (call == nullptr || call->inputs().size() < 2 ||
+      call->inputs()[0]->type()->kind() != TypeKind::VARCHAR) {
+    return std::nullopt;
+  }
+  const auto& inputs = call->inputs();
+  auto pattern = getConstantString(inputs[1]);
+  if (!pattern.has_value()) {
+    return std::nullopt;
+  }
+  if (call->name() == prefix + "regexp_like" && inputs.size() == 2) {
+    input = inputs[0];
+    return pattern;
+  }
+  if (call->name() != prefix + "like" || inputs.size() > 3) {
+    return std::nullopt;
+  }
+  std::optional<char> escapeChar;
+  if (inputs.size() == 3) {
+    auto escape = getConstantString(inputs[2]);
+    if (!escape.has_value() || escape->size() != 1) {
+      return std::nullopt;
+    }
+    escapeChar = escape->at(0);
+  }
+  bool validPattern;
+  auto regex = likePatternToRe2(StringView(*pattern), escapeChar, validPattern);
+  if (!validPattern) {
+    return std::nullopt;
+  }
+  input = inputs[0];
+  // LIKE wildcards match new lines.
+  return fmt::format("(?s:{})", regex);
+}
+
+void flattenOr(
+    const core::TypedExprPtr& expr,
+    std::vector<core::TypedExprPtr>& disjuncts) {
+  auto call = std::dynamic_pointer_cast<const core::CallTypedExpr>(expr);
+  if (call != nullptr && call->name() == "or") {
+    for (const auto& input : call->inputs()) {
+      flattenOr(input, disjuncts);
+    }
+  } else {
+    disjuncts.push_back(expr);
+  }
+}
+
 } // namespace
 
+core::TypedExprPtr rewriteMultiPatternSearch(
+    const std::string& prefix,
+    const core::TypedExprPtr& expr) {
+  auto call = std::dynamic_pointer_cast<const core::CallTypedExpr>(expr);
+  if (call == nullptr || call->name() != "or") {
+    return nullptr;
+  }
+  std::vector<core::TypedExprPtr> disjuncts;
+  flattenOr(expr, disjuncts);
+
+  // Disjuncts that match patterns over the same input.
+  struct Group {
+    core::TypedExprPtr input;
+    std::vector<size_t> disjuncts;
+    std::vector<std::string> patterns;
+  };
+  std::vector<Group> groups;
+  for (auto i = 0; i < disjuncts.size(); ++i) {
+    core::TypedExprPtr input;
+    auto pattern = toSearchPattern(prefix, disjuncts[i], input);
+    if (!pattern.has_value()) {
+      continue;
+    }
+    auto it = std::find_if(groups.begin(), groups.end(), [&](auto& group) {
+      return *group.input == *input;
+    });
+    if (it == groups.end()) {
+      it = groups.insert(groups.end(), Group{input, {}, {}});
+    }
+    it->disjuncts.push_back(i);
+    it->patterns.push_back(std::move(pattern.value()));
+  }
+
+  // Replaces the first disjunct of each group by a single search and drops
+  // the others.
+  bool rewritten = false;
+  for (const auto& group : groups) {
+    if (group.patterns.size() < kMinSearchAnyPatterns ||
+        makeSearchSet(group.patterns) == nullptr) {
+      continue;
+    }
+    std::vector<core::TypedExprPtr> inputs{group.input};
+    for (const auto& pattern : group.patterns) {
+      inputs.push_back(
+          std::make_shared<core::ConstantTypedExpr>(VARCHAR(), pattern));
+    }
+    for (auto i : group.disjuncts) {
+      disjuncts[i] = nullptr;
+    }
+    disjuncts[group.disjuncts[0]] = std::make_shared<core::CallTypedExpr>(
+        BOOLEAN(), std::move(inputs), kRe2SearchAny);
+    rewritten = true;
+  }
+  if (!rewritten) {
+    return nullptr;
+  }
+
+  disjuncts.erase(
+      std::remove(disjuncts.begin(), disjuncts.end(), nullptr),
+      disjuncts.end());
+  if (disjuncts.size() == 1) {
+    return disjuncts[0];
+  }
+  return std::make_shared<core::CallTypedExpr>(
+      BOOLEAN(), std::move(disjuncts), "or");
+}
+
+std::shared_ptr<exec::VectorFunction> makeRe2SearchAny(
+    const std::string& name,
+    const std::vector<exec::VectorFunctionArg>& inputArgs,
+    const core::QueryConfig& /*config*/) {
+  std::vector<std::string> patterns;
+  for (auto i = 1; i < inputArgs.size(); ++i) {
+    auto* pattern = inputArgs[i].constantValue.get();
+    VELOX_USER_CHECK(
+        pattern != nullptr && !pattern->isNullAt(0),
+        "{} requires constant non-null patterns",
+        name);
+    patterns.emplace_back(
+        pattern->as<ConstantVector<StringView>>()->valueAt(0));
+  }
+  auto set = makeSearchSet(patterns);
+  VELOX_USER_CHECK_NOT_NULL(set, "Invalid patterns for {}", name);
+  return std::make_shared<Re2SearchAny>(std::move(set));
+}
+
+std::vector<std::shared_ptr<exec::FunctionSignature>> re2SearchAnySignatures() {
+  // varchar, varchar... -> boolean
+  return {exec::FunctionSignatureBuilder()
+              .returnType("boolean")
+              .argumentType("varchar")
+              .constantArgumentType("varchar")
+              .variableArity()
+              .build()};
+}
+
 std::shared_ptr<exec::VectorFunction> makeRe2Match(
     const std::string& name,
     const std::vector<exec::VectorFunctionArg>& inputArgs,
@@ -226,6 +226,33 @@ std::shared_ptr<exec::VectorFunction> makeLike(
 
 std::vector<std::shared_ptr<exec::FunctionSignature>> likeSignatures();
 
+/// Name of the internal function that searches for any of a list of patterns.
+constexpr const char* kRe2SearchAny = "$internal$re2_search_any";
+
+/// $internal$re2_search_any(string, pattern, pattern...) → bool
+///
+/// Returns whether str has a substr that matches any of the constant regex
+/// patterns. All patterns are matched in a single pass over str using an
+/// RE2::Set. Produced by rewriteMultiPatternSearch().
+std::shared_ptr<exec::VectorFunction> makeRe2SearchAny(
+    const std::string& name,
+    const std::vector<exec::VectorFunctionArg>& inputArgs,
+    const core::QueryConfig& config);
+
+std::vector<std::shared_ptr<exec::FunctionSignature>> re2SearchAnySignatures();
+
+/// Rewrites an OR of at least 4 LIKE or regexp_like calls with constant
+/// patterns over the same input, e.g. log classification rules, into a call
+/// to $internal$re2_search_any(input, pattern...) so that the input is
+/// matched against all patterns at once instead of once per pattern. Other
+/// disjuncts are kept. 'prefix' is the prefix of the names of the 'like' and
+/// 'regexp_like' functions.
+///
+/// Returns new expression or nullptr if rewrite is not possible.
+core::TypedExprPtr rewriteMultiPatternSearch(
+    const std::string& prefix,
+    const core::TypedExprPtr& expr);
+
 /// re2ExtractAll(string, pattern, group_id) → array<string>
 /// re2ExtractAll(string, pattern) → array<string>
 ///
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <xsimd/xsimd.hpp>
+
+#include "velox/common/base/BitUtil.h"
+#include "velox/type/FloatingPointUtil.h"
+
+namespace facebook::velox::functions {
+
+/// Set of fixed-width values or StringViews for the set operations of array
+/// functions. One instance is meant to serve all the rows of a batch: clear()
+/// is O(1) and keeps the memory, so that a row does not allocate unless it has
+/// more distinct values than any row before it.
+///
+/// Up to kMaxLinearSize values are found by a linear scan, vectorized for 32
+/// and 64 bit integers. Larger sets switch to an open addressing table with
+/// linear probing. The table slots carry the generation of the set they
+/// belong to, so that a new set reuses the table without erasing it.
+///
+/// Hashing and equality are those of HashSetNaNAware<T>, i.e. NaNs are equal.
+template <typename T>
+class ReusableSet {
+ public:
+  static constexpr int32_t kMaxLinearSize = 16;
+
+  /// Adds 'value'. Returns true if it was not in the set.
+  bool insert(const T& value) {
+    if (!hashed_) {
+      if (findLinear(value)) {
+        return false;
+      }
+      if (values_.size() < kMaxLinearSize) {
+        values_.push_back(value);
+        return true;
+      }
+      makeTable();
+    }
+    auto& slot = table_[findPosition(value)];
+    if (slot.generation == generation_) {
+      return false;
+    }
+    slot = {generation_, static_cast<int32_t>(values_.size())};
+    values_.push_back(value);
+    if (values_.size() * 2 > table_.size()) {
+      makeTable();
+    }
+    return true;
+  }
+
+  bool contains(const T& value) const {
+    if (!hashed_) {
+      return findLinear(value);
+    }
+    return table_[findPosition(value)].generation == generation_;
+  }
+
+  size_t size() const {
+    return values_.size();
+  }
+
+  bool empty() const {
+    return values_.empty();
+  }
+
+  /// Makes the set empty without freeing memory.
+  void clear() {
+    values_.clear();
+    hashed_ = false;
+  }
+
+ private:
+  using Hash = typename util::floating_point::HashSetNaNAware<T>::hasher;
+  using Equal = typename util::floating_point::HashSetNaNAware<T>::key_equal;
+
+  // A table entry. Valid if 'generation' is the set's current generation.
+  struct Slot {
+    uint32_t generation{0};
+    int32_t index{0};
+  };
+
+  bool findLinear(const T& value) const {
+    const auto numValues = values_.size();
+    if constexpr (
+        std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>) {
+      using Batch = xsimd::batch<T>;
+      const auto target = xsimd::broadcast<T>(value);
+      size_t i = 0;
+      for (; i + Batch::size <= numValues; i += Batch::size) {
+        if (xsimd::any(Batch::load_unaligned(values_.data() + i) == target)) {
+          return true;
+        }
+      }
+      for (; i < numValues; ++i) {
+        if (values_[i] == value) {
+          return true;
+        }
+      }
+      return false;
+    } else {
+      for (size_t i = 0; i < numValues; ++i) {
+        if (Equal()(values_[i], value)) {
+          return true;
+        }
+      }
+      return false;
+    }
+  }
+
+  // Returns the position of the slot holding 'value' or of the free slot
+  // where it would go.
+  size_t findPosition(const T& value) const {
+    const size_t mask = table_.size() - 1;
+    for (size_t position = Hash()(value) & mask;;
+         position = (position + 1) & mask) {
+      const auto& slot = table_[position];
+      if (slot.generation != generation_ ||
+          Equal()(values_[slot.index], value)) {
+        return position;
+      }
+    }
+  }
+
+  // Sizes the table to at most half full and inserts all of 'values_' in it.
+  void makeTable() {
+    const size_t size =
+        bits::nextPowerOfTwo(std::max<uint64_t>(values_.size() * 4, 64));
+    if (size > table_.size()) {
+      table_.assign(size, Slot{});
+      generation_ = 1;
+    } else if (++generation_ == 0) {
+      // After 4G generations, slots of an earlier set could look live.
+      std::fill(table_.begin(), table_.end(), Slot{});
+      generation_ = 1;
+    }
+    hashed_ = true;
+    for (int32_t i = 0; i < values_.size(); ++i) {
+      table_[findPosition(values_[i])] = {generation_, i};
+    }
+  }
+
+  // All values in insertion order.
+  std::vector<T> values_;
+
+  // Open addressing table of indices into 'values_'. Used if 'hashed_'.
+  std::vector<Slot> table_;
+
+  uint32_t generation_{1};
+
+  // True if 'values_' has outgrown the linear scan and is in 'table_'.
+  bool hashed_{false};
+};
+
+} // namespace facebook::velox::functions
@@ -22,6 +22,7 @@
 #include "velox/common/memory/MemoryPool.h"
 #include "velox/functions/lib/SubscriptUtil.h"
 #include "velox/type/Type.h"
+#include "velox/vector/FlatMapVector.h"
 #include "velox/vector/TypeAliases.h"
 
 namespace facebook::velox::functions {
@@ -186,6 +187,41 @@ VectorPtr applyMapTyped(
       true /*flattenIfRedundant*/);
 }
 
+/// Subscripts flat maps by a constant key. The values vector of the key is
+/// wrapped in a dictionary without materializing the maps, so that projecting
+/// a few keys out of wide maps is cheap.
+VectorPtr applyFlatMapConstantKey(
+    const SelectivityVector& rows,
+    const DecodedVector& decodedMap,
+    const VectorPtr& indexArg,
+    exec::EvalCtx& context) {
+  const auto* flatMap = decodedMap.base()->asUnchecked<FlatMapVector>();
+  const auto channel = flatMap->getKeyChannel(indexArg, 0);
+  if (!channel.has_value()) {
+    return BaseVector::createNullConstant(
+        flatMap->valueType(), rows.end(), context.pool());
+  }
+
+  auto* pool = context.pool();
+  BufferPtr indices = allocateIndices(rows.end(), pool);
+  auto* rawIndices = indices->asMutable<vector_size_t>();
+  NullsBuilder nullsBuilder(rows.end(), pool);
+  const auto* rawInMap = flatMap->rawInMapsAt(channel.value());
+  rows.applyToSelected([&](vector_size_t row) {
+    const auto mapIndex = decodedMap.index(row);
+    rawIndices[row] = mapIndex;
+    if (decodedMap.isNullAt(row) ||
+        (rawInMap != nullptr && !bits::isBitSet(rawInMap, mapIndex))) {
+      nullsBuilder.setNull(row);
+    }
+  });
+  return BaseVector::wrapInDictionary(
+      nullsBuilder.build(),
+      std::move(indices),
+      rows.end(),
+      flatMap->mapValuesAt(channel.value()));
+}
+
 VectorPtr applyMapComplexType(
     const SelectivityVector& rows,
     const VectorPtr& mapArg,
@@ -328,6 +364,22 @@ VectorPtr MapSubscript::applyMap(
   // Ensure map key type and second argument are the same.
   VELOX_CHECK(mapArg->type()->childAt(0)->equivalent(*indexArg->type()));
 
+  // Flat maps are subscripted in place by a constant key. Otherwise they are
+  // converted to a MapVector for the generic lookup below.
+  if (mapArg->wrappedVector()->encoding() == VectorEncoding::Simple::FLAT_MAP) {
+    exec::LocalDecodedVector mapHolder(context, *mapArg, rows);
+    if (indexArg->isConstantEncoding() && !indexArg->isNullAt(0)) {
+      return applyFlatMapConstantKey(rows, *mapHolder, indexArg, context);
+    }
+    std::vector<VectorPtr> mapArgs = {
+        mapHolder->wrap(
+            mapHolder->base()->asUnchecked<FlatMapVector>()->toMapVector(),
+            *mapArg,
+            rows),
+        indexArg};
+    return applyMap(rows, mapArgs, context);
+  }
+
   bool triggerCaching = shouldTriggerCaching(mapArg);
   if (indexArg->type()->isPrimitiveType() &&
       !indexArg->type()->providesCustomComparison()) {
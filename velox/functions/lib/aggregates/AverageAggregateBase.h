@@ -17,6 +17,7 @@
 
 #include "velox/exec/Aggregate.h"
 #include "velox/functions/lib/aggregates/DecimalAggregate.h"
+#include "velox/functions/lib/aggregates/SingleGroupKernels.h"
 #include "velox/type/DecimalUtil.h"
 #include "velox/vector/ComplexVector.h"
 #include "velox/vector/DecodedVector.h"
@@ -181,6 +182,21 @@ class AverageAggregateBase : public exec::Aggregate {
         const auto numRows = rows.countSelected();
         updateNonNullValue(group, numRows, TAccumulator(value) * numRows);
       }
+    } else if (decodedRaw_.isIdentityMapping()) {
+      // Flat values are summed one run of selected non-null rows at a time.
+      const TInput* data = decodedRaw_.data<TInput>();
+      TAccumulator totalSum(0);
+      int64_t count = 0;
+      forEachDenseRange(
+          rows, decodedRaw_.nulls(&rows), [&](auto begin, auto end) {
+            for (auto i = begin; i < end; ++i) {
+              totalSum += data[i];
+            }
+            count += end - begin;
+          });
+      if (count > 0) {
+        updateNonNullValue(group, count, totalSum);
+      }
     } else if (decodedRaw_.mayHaveNulls()) {
       rows.applyToSelected([&](vector_size_t i) {
         if (!decodedRaw_.isNullAt(i)) {
@@ -188,11 +204,6 @@ class AverageAggregateBase : public exec::Aggregate {
               group, TAccumulator(decodedRaw_.valueAt<TInput>(i)));
         }
       });
-    } else if (!exec::Aggregate::numNulls_ && decodedRaw_.isIdentityMapping()) {
-      const TInput* data = decodedRaw_.data<TInput>();
-      TAccumulator totalSum(0);
-      rows.applyToSelected([&](vector_size_t i) { totalSum += data[i]; });
-      updateNonNullValue<false>(group, rows.countSelected(), totalSum);
     } else {
       TAccumulator totalSum(0);
       rows.applyToSelected(
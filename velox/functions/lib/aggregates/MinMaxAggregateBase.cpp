@@ -21,6 +21,7 @@
 #include "velox/functions/lib/CheckNestedNulls.h"
 #include "velox/functions/lib/aggregates/Compare.h"
 #include "velox/functions/lib/aggregates/SimpleNumericAggregate.h"
+#include "velox/functions/lib/aggregates/SingleGroupKernels.h"
 #include "velox/functions/lib/aggregates/SingleValueAccumulator.h"
 #include "velox/type/FloatingPointUtil.h"
 
@@ -31,6 +32,12 @@ namespace {
 template <typename T>
 struct MinMaxTrait : public std::numeric_limits<T> {};
 
+// True if single group min and max of T reduce runs of flat values with
+// integerMinMax().
+template <typename T>
+constexpr bool kSimdMinMax = std::is_integral_v<T> &&
+    !std::is_same_v<T, bool> && sizeof(T) <= sizeof(int64_t);
+
 template <typename T>
 class SimpleNumericMinMaxAggregate : public SimpleNumericAggregate<T, T, T> {
   using BaseAggregate = SimpleNumericAggregate<T, T, T>;
@@ -143,14 +150,28 @@ class SimpleNumericMaxAggregate : public SimpleNumericMinMaxAggregate<T> {
       const SelectivityVector& rows,
       const std::vector<VectorPtr>& args,
       bool mayPushdown) override {
-    BaseAggregate::updateOneGroup(
-        group,
-        rows,
-        args[0],
-        updateGroup,
-        [](T& result, T value, int /* unused */) { result = value; },
-        mayPushdown,
-        kInitialValue_);
+    if constexpr (kSimdMinMax<T>) {
+      BaseAggregate::updateOneGroup(
+          group,
+          rows,
+          args[0],
+          updateGroup,
+          [](T& result, T value, int /* unused */) { result = value; },
+          mayPushdown,
+          kInitialValue_,
+          [](T partial, const T* values, auto begin, auto end) {
+            return integerMinMax<false>(partial, values, begin, end);
+          });
+    } else {
+      BaseAggregate::updateOneGroup(
+          group,
+          rows,
+          args[0],
+          updateGroup,
+          [](T& result, T value, int /* unused */) { result = value; },
+          mayPushdown,
+          kInitialValue_);
+    }
   }
 
   void addSingleGroupIntermediateResults(
@@ -245,14 +266,28 @@ class SimpleNumericMinAggregate : public SimpleNumericMinMaxAggregate<T> {
       const SelectivityVector& rows,
       const std::vector<VectorPtr>& args,
       bool mayPushdown) override {
-    BaseAggregate::updateOneGroup(
-        group,
-        rows,
-        args[0],
-        updateGroup,
-        [](T& result, T value, int /* unused */) { result = value; },
-        mayPushdown,
-        kInitialValue_);
+    if constexpr (kSimdMinMax<T>) {
+      BaseAggregate::updateOneGroup(
+          group,
+          rows,
+          args[0],
+          updateGroup,
+          [](T& result, T value, int /* unused */) { result = value; },
+          mayPushdown,
+          kInitialValue_,
+          [](T partial, const T* values, auto begin, auto end) {
+            return integerMinMax<true>(partial, values, begin, end);
+          });
+    } else {
+      BaseAggregate::updateOneGroup(
+          group,
+          rows,
+          args[0],
+          updateGroup,
+          [](T& result, T value, int /* unused */) { result = value; },
+          mayPushdown,
+          kInitialValue_);
+    }
   }
 
   void addSingleGroupIntermediateResults(
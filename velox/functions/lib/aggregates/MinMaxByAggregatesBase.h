@@ -15,6 +15,8 @@
  */
 #pragma once
 
+#include <folly/lang/Bits.h>
+
 #include "velox/exec/Aggregate.h"
 #include "velox/exec/ContainerRowSerde.h"
 #include "velox/functions/lib/CheckNestedNulls.h"
@@ -113,6 +115,12 @@ class MinMaxByAggregateBase : public exec::Aggregate {
       typename AccumulatorTypeTraits<U, compareTypeUsesCustomComparison>::
           AccumulatorType;
 
+  /// Values that are not numeric, e.g. strings or rows, are copied into the
+  /// accumulator only once per batch for the row that last improved the
+  /// comparison value of the group, instead of on every improvement.
+  static constexpr bool kDeferValues =
+      std::is_same_v<ValueAccumulatorType, SingleValueAccumulator>;
+
   explicit MinMaxByAggregateBase(
       TypePtr resultType,
       bool throwOnNestedNulls = false)
@@ -120,7 +128,7 @@ class MinMaxByAggregateBase : public exec::Aggregate {
 
   int32_t accumulatorFixedWidthSize() const override {
     return sizeof(ValueAccumulatorType) + sizeof(ComparisonAccumulatorType) +
-        sizeof(bool);
+        sizeof(bool) + (kDeferValues ? sizeof(vector_size_t) : 0);
   }
 
   void addRawInput(
@@ -330,6 +338,7 @@ class MinMaxByAggregateBase : public exec::Aggregate {
             groups[i], decodedValue_, decodedComparison_, i, false, mayUpdate);
       });
     }
+    storePendingValues();
   }
 
   template <typename MayUpdate>
@@ -375,6 +384,7 @@ class MinMaxByAggregateBase : public exec::Aggregate {
             mayUpdate);
       });
     }
+    storePendingValues();
   }
 
   template <typename MayUpdate>
@@ -427,6 +437,7 @@ class MinMaxByAggregateBase : public exec::Aggregate {
             group, decodedValue_, decodedComparison_, i, false, mayUpdate);
       });
     }
+    storePendingValues();
   }
 
   /// Final aggregation takes (value, comparisonValue) structs as inputs. It
@@ -484,6 +495,7 @@ class MinMaxByAggregateBase : public exec::Aggregate {
             mayUpdate);
       });
     }
+    storePendingValues();
   }
 
   void initializeNewGroupsInternal(
@@ -493,6 +505,9 @@ class MinMaxByAggregateBase : public exec::Aggregate {
     for (const vector_size_t i : indices) {
       auto group = groups[i];
       valueIsNull(group) = true;
+      if constexpr (kDeferValues) {
+        setPendingRow(group, kNoPendingRow);
+      }
 
       if constexpr (std::is_same_v<
                         ValueAccumulatorType,
@@ -544,7 +559,12 @@ class MinMaxByAggregateBase : public exec::Aggregate {
     if (mayUpdate(
             comparisonValue(group), decodedComparisons, index, isFirstValue)) {
       valueIsNull(group) = isValueNull;
-      if (LIKELY(!isValueNull)) {
+      if constexpr (kDeferValues) {
+        if (pendingRow(group) == kNoPendingRow) {
+          pendingGroups_.push_back(group);
+        }
+        setPendingRow(group, index);
+      } else if (LIKELY(!isValueNull)) {
         store<T>(value(group), decodedValues, index, allocator_);
       }
       store<U>(comparisonValue(group), decodedComparisons, index, allocator_);
@@ -566,10 +586,43 @@ class MinMaxByAggregateBase : public exec::Aggregate {
         sizeof(ComparisonAccumulatorType));
   }
 
+  // Row of 'decodedValue_' in the current batch with the value of 'group', or
+  // kNoPendingRow. Follows 'valueIsNull' and may be unaligned.
+  inline char* pendingRowAddress(char* group) {
+    return group + Aggregate::offset_ + sizeof(ValueAccumulatorType) +
+        sizeof(ComparisonAccumulatorType) + sizeof(bool);
+  }
+
+  inline vector_size_t pendingRow(char* group) {
+    return folly::loadUnaligned<vector_size_t>(pendingRowAddress(group));
+  }
+
+  inline void setPendingRow(char* group, vector_size_t row) {
+    folly::storeUnaligned<vector_size_t>(pendingRowAddress(group), row);
+  }
+
+  // Copies the values of the pending rows of the current batch into their
+  // groups.
+  void storePendingValues() {
+    if constexpr (kDeferValues) {
+      for (auto* group : pendingGroups_) {
+        if (!valueIsNull(group)) {
+          store<T>(value(group), decodedValue_, pendingRow(group), allocator_);
+        }
+        setPendingRow(group, kNoPendingRow);
+      }
+      pendingGroups_.clear();
+    }
+  }
+
+  static constexpr vector_size_t kNoPendingRow = -1;
+
   const bool throwOnNestedNulls_;
   DecodedVector decodedValue_;
   DecodedVector decodedComparison_;
   DecodedVector decodedIntermediateResult_;
+  // Groups with a pending row in the current batch.
+  std::vector<char*> pendingGroups_;
 };
 
 template <
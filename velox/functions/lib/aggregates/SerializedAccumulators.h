@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/vector/FlatVector.h"
+
+namespace facebook::velox::functions::aggregate {
+
+/// Serializes the accumulators of 'numGroups' groups into 'result' for
+/// extractAccumulators() of aggregates with a VARBINARY intermediate type.
+/// All values that are not inlined are written into one string buffer of
+/// 'result' allocated for their exact total size, so that no temporary is
+/// built and copied per group. The sizes are computed for all groups before
+/// any of them is serialized.
+///
+/// @param serializedSize Returns the serialized size of the accumulator of
+/// group 'i', or a negative value if the result for the group is null.
+/// @param serialize Serializes the accumulator of group 'i' into the
+/// given buffer, which holds exactly the size returned for the group.
+template <typename SizeFunc, typename SerializeFunc>
+void extractSerializedAccumulators(
+    int32_t numGroups,
+    FlatVector<StringView>& result,
+    SizeFunc serializedSize,
+    SerializeFunc serialize) {
+  result.resize(numGroups);
+  std::vector<int32_t> sizes(numGroups);
+  size_t totalSize = 0;
+  for (auto i = 0; i < numGroups; ++i) {
+    sizes[i] = serializedSize(i);
+    if (sizes[i] > 0 && !StringView::isInline(sizes[i])) {
+      totalSize += sizes[i];
+    }
+  }
+
+  char* buffer = totalSize > 0
+      ? result.getRawStringBufferWithSpace(totalSize, /*exactSize=*/true)
+      : nullptr;
+  char inlined[StringView::kInlineSize];
+  for (auto i = 0; i < numGroups; ++i) {
+    const auto size = sizes[i];
+    if (size < 0) {
+      result.setNull(i, true);
+    } else if (StringView::isInline(size)) {
+      serialize(i, inlined);
+      result.setNoCopy(i, StringView(inlined, size));
+    } else {
+      serialize(i, buffer);
+      result.setNoCopy(i, StringView(buffer, size));
+      buffer += size;
+    }
+  }
+}
+
+} // namespace facebook::velox::functions::aggregate
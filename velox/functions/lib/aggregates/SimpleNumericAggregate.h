@@ -17,6 +17,7 @@
 
 #include "velox/exec/Aggregate.h"
 #include "velox/exec/AggregationHook.h"
+#include "velox/functions/lib/aggregates/SingleGroupKernels.h"
 #include "velox/vector/DecodedVector.h"
 #include "velox/vector/FlatVector.h"
 #include "velox/vector/LazyVector.h"
@@ -153,12 +154,15 @@ class SimpleNumericAggregate : public exec::Aggregate {
   // TAccumulator or TResult, which in most cases are the same, but for
   // sum(real) can differ. TValue is used to decode the update input 'args'.
   // It can be either TAccumulator or TInput, which is most cases are the same
-  // but for sum(real) can differ.
+  // but for sum(real) can differ. Flat values are reduced into a partial result
+  // starting at 'initialValue' one run of selected non-null rows at a time,
+  // with 'reduceDense(partial, values, begin, end)' if given.
   template <
       typename TData = TResult,
       typename TValue = TInput,
       typename UpdateSingle,
-      typename UpdateDuplicate>
+      typename UpdateDuplicate,
+      typename ReduceDense = std::nullptr_t>
   void updateOneGroup(
       char* group,
       const SelectivityVector& rows,
@@ -166,7 +170,8 @@ class SimpleNumericAggregate : public exec::Aggregate {
       UpdateSingle updateSingleValue,
       UpdateDuplicate updateDuplicateValues,
       bool /*mayPushdown*/,
-      TData initialValue) {
+      TData initialValue,
+      ReduceDense reduceDense = nullptr) {
     DecodedVector decoded(*arg, rows);
 
     // Do row by row if not all rows are selected.
@@ -178,6 +183,24 @@ class SimpleNumericAggregate : public exec::Aggregate {
             rows.countSelected());
         updateNonNullValue<true, TData>(group, initialValue, updateSingleValue);
       }
+    } else if (decoded.isIdentityMapping() && !std::is_same_v<TValue, bool>) {
+      auto data = decoded.data<TValue>();
+      TData partial = initialValue;
+      bool hasValues = false;
+      forEachDenseRange(
+          rows, decoded.nulls(&rows), [&](auto begin, auto end) {
+            if constexpr (std::is_null_pointer_v<ReduceDense>) {
+              for (auto i = begin; i < end; ++i) {
+                updateSingleValue(partial, TData(data[i]));
+              }
+            } else {
+              partial = reduceDense(partial, data, begin, end);
+            }
+            hasValues = true;
+          });
+      if (hasValues) {
+        updateNonNullValue<true, TData>(group, partial, updateSingleValue);
+      }
     } else if (decoded.mayHaveNulls()) {
       rows.applyToSelected([&](vector_size_t i) {
         if (decoded.isNullAt(i)) {
@@ -186,12 +209,6 @@ class SimpleNumericAggregate : public exec::Aggregate {
         updateNonNullValue<true, TData>(
             group, TData(decoded.valueAt<TValue>(i)), updateSingleValue);
       });
-    } else if (decoded.isIdentityMapping() && !std::is_same_v<TValue, bool>) {
-      auto data = decoded.data<TValue>();
-      rows.applyToSelected([&](vector_size_t i) {
-        updateNonNullValue<true, TData>(
-            group, TData(data[i]), updateSingleValue);
-      });
     } else {
       rows.applyToSelected([&](vector_size_t i) {
         updateNonNullValue<true, TData>(
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/common/base/BitUtil.h"
+#include "velox/common/base/SimdUtil.h"
+#include "velox/vector/SelectivityVector.h"
+
+/// Kernels for aggregating flat values into a single group. They take the
+/// selected rows and the nulls of the input, which may be nullptr, and give
+/// the aggregates a loop over dense values without per-row null checks.
+namespace facebook::velox::functions::aggregate {
+
+namespace detail {
+// Calls 'func(begin, end)' for each run of consecutive set bits in 'word',
+// the bits of rows [64 * index, 64 * index + 64).
+template <typename Func>
+inline void forEachRunInWord(int32_t index, uint64_t word, Func func) {
+  const vector_size_t base = index * 64;
+  if (word == ~0ULL) {
+    func(base, base + 64);
+    return;
+  }
+  while (word != 0) {
+    const int32_t start = __builtin_ctzll(word);
+    // The bits above the run are set in '~(word >> start)' since 'word' is not
+    // all ones.
+    const int32_t length = __builtin_ctzll(~(word >> start));
+    func(base + start, base + start + length);
+    if (start + length == 64) {
+      return;
+    }
+    word &= ~bits::lowMask(start + length);
+  }
+}
+} // namespace detail
+
+/// Calls 'func(begin, end)' for each maximal run of consecutive rows that are
+/// selected in 'rows' and not null in 'nulls'. Dense input is a single run.
+template <typename Func>
+void forEachDenseRange(
+    const SelectivityVector& rows,
+    const uint64_t* nulls,
+    Func func) {
+  const auto* selected = rows.allBits();
+  vector_size_t runBegin = 0;
+  vector_size_t runEnd = 0;
+  auto addRun = [&](vector_size_t begin, vector_size_t end) {
+    if (begin == runEnd) {
+      runEnd = end;
+      return;
+    }
+    if (runBegin < runEnd) {
+      func(runBegin, runEnd);
+    }
+    runBegin = begin;
+    runEnd = end;
+  };
+  bits::forEachWord(
+      rows.begin(),
+      rows.end(),
+      [&](int32_t index, uint64_t mask) {
+        const auto word =
+            selected[index] & mask & (nulls ? nulls[index] : ~0ULL);
+        detail::forEachRunInWord(index, word, addRun);
+      },
+      [&](int32_t index) {
+        const auto word = selected[index] & (nulls ? nulls[index] : ~0ULL);
+        detail::forEachRunInWord(index, word, addRun);
+      });
+  if (runBegin < runEnd) {
+    func(runBegin, runEnd);
+  }
+}
+
+/// Returns the number of rows selected in 'rows' that are not null in 'nulls'
+/// and, if 'values' is not nullptr, have their bit set in 'values'.
+inline int64_t countSelectedBits(
+    const SelectivityVector& rows,
+    const uint64_t* nulls,
+    const uint64_t* values = nullptr) {
+  const auto* selected = rows.allBits();
+  int64_t count = 0;
+  auto countWord = [&](int32_t index, uint64_t mask) {
+    auto word = selected[index] & mask;
+    if (nulls) {
+      word &= nulls[index];
+    }
+    if (values) {
+      word &= values[index];
+    }
+    count += __builtin_popcountll(word);
+  };
+  bits::forEachWord(rows.begin(), rows.end(), countWord, [&](int32_t index) {
+    countWord(index, ~0ULL);
+  });
+  return count;
+}
+
+/// Returns the sum of values[begin, end). Integers narrower than 64 bits are
+/// summed into an int64_t, which the sum of 2^31 of them cannot overflow, so
+/// the loop needs no overflow checks and vectorizes into widening adds.
+template <typename T>
+int64_t sumNarrowIntegers(
+    const T* values,
+    vector_size_t begin,
+    vector_size_t end) {
+  static_assert(std::is_integral_v<T> && sizeof(T) < sizeof(int64_t));
+  int64_t sum = 0;
+  for (auto i = begin; i < end; ++i) {
+    sum += values[i];
+  }
+  return sum;
+}
+
+/// Returns the minimum, or the maximum if 'isMin' is false, of 'initial' and
+/// values[begin, end).
+template <bool isMin, typename T>
+T integerMinMax(
+    T initial,
+    const T* values,
+    vector_size_t begin,
+    vector_size_t end) {
+  static_assert(std::is_integral_v<T> && sizeof(T) <= sizeof(int64_t));
+  using Batch = xsimd::batch<T>;
+  auto combine = [](auto x, auto y) {
+    if constexpr (isMin) {
+      return xsimd::min(x, y);
+    } else {
+      return xsimd::max(x, y);
+    }
+  };
+  auto i = begin;
+  if (end - begin >= Batch::size) {
+    auto result = xsimd::broadcast<T>(initial);
+    for (; i + Batch::size <= end; i += Batch::size) {
+      result = combine(result, Batch::load_unaligned(values + i));
+    }
+    T lanes[Batch::size];
+    result.store_unaligned(lanes);
+    for (auto lane = 0; lane < Batch::size; ++lane) {
+      initial = isMin ? std::min(initial, lanes[lane])
+                      : std::max(initial, lanes[lane]);
+    }
+  }
+  for (; i < end; ++i) {
+    initial =
+        isMin ? std::min(initial, values[i]) : std::max(initial, values[i]);
+  }
+  return initial;
+}
+
+} // namespace facebook::velox::functions::aggregate
@@ -85,14 +85,34 @@ class SumAggregateBase
       const SelectivityVector& rows,
       const std::vector<VectorPtr>& args,
       bool mayPushdown) override {
-    BaseAggregate::template updateOneGroup<TAccumulator>(
-        group,
-        rows,
-        args[0],
-        &updateSingleValue<TAccumulator>,
-        &updateDuplicateValues<TAccumulator>,
-        mayPushdown,
-        TAccumulator(0));
+    if constexpr (
+        std::is_integral_v<TInput> && sizeof(TInput) < sizeof(int64_t) &&
+        std::is_same_v<TAccumulator, int64_t>) {
+      // Runs of values are summed without overflow checks, then added to the
+      // partial sum with one check.
+      BaseAggregate::template updateOneGroup<TAccumulator>(
+          group,
+          rows,
+          args[0],
+          &updateSingleValue<TAccumulator>,
+          &updateDuplicateValues<TAccumulator>,
+          mayPushdown,
+          TAccumulator(0),
+          [](int64_t partial, const TInput* values, auto begin, auto end) {
+            updateSingleValue<int64_t>(
+                partial, sumNarrowIntegers(values, begin, end));
+            return partial;
+          });
+    } else {
+      BaseAggregate::template updateOneGroup<TAccumulator>(
+          group,
+          rows,
+          args[0],
+          &updateSingleValue<TAccumulator>,
+          &updateDuplicateValues<TAccumulator>,
+          mayPushdown,
+          TAccumulator(0));
+    }
   }
 
   void addSingleGroupIntermediateResults(
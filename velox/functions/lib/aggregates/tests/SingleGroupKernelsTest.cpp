@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/functions/lib/aggregates/SingleGroupKernels.h"
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include "velox/common/base/Nulls.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::functions::aggregate;
+
+namespace {
+
+// Returns the rows in [0, size) for which 'isSet' is true.
+template <typename IsSet>
+SelectivityVector makeRows(vector_size_t size, IsSet isSet) {
+  SelectivityVector rows(size, false);
+  for (auto i = 0; i < size; ++i) {
+    rows.setValid(i, isSet(i));
+  }
+  rows.updateBounds();
+  return rows;
+}
+
+template <typename IsNull>
+std::vector<uint64_t> makeNulls(vector_size_t size, IsNull isNull) {
+  std::vector<uint64_t> nulls(bits::nwords(size), bits::kNotNull64);
+  for (auto i = 0; i < size; ++i) {
+    if (isNull(i)) {
+      bits::setNull(nulls.data(), i);
+    }
+  }
+  return nulls;
+}
+
+// Returns the rows covered by the runs of forEachDenseRange() and checks that
+// the runs are maximal.
+std::vector<vector_size_t> denseRows(
+    const SelectivityVector& rows,
+    const uint64_t* nulls) {
+  std::vector<vector_size_t> result;
+  vector_size_t lastEnd = -1;
+  forEachDenseRange(rows, nulls, [&](auto begin, auto end) {
+    EXPECT_LT(begin, end);
+    EXPECT_LT(lastEnd, begin);
+    lastEnd = end;
+    for (auto i = begin; i < end; ++i) {
+      result.push_back(i);
+    }
+  });
+  return result;
+}
+
+std::vector<vector_size_t> expectedRows(
+    const SelectivityVector& rows,
+    const uint64_t* nulls) {
+  std::vector<vector_size_t> result;
+  rows.applyToSelected([&](auto row) {
+    if (nulls == nullptr || !bits::isBitNull(nulls, row)) {
+      result.push_back(row);
+    }
+  });
+  return result;
+}
+
+TEST(SingleGroupKernelsTest, forEachDenseRange) {
+  for (auto size : {1, 63, 64, 65, 1'000, 1'024}) {
+    SCOPED_TRACE(fmt::format("size: {}", size));
+    auto all = makeRows(size, [](auto) { return true; });
+    auto some = makeRows(size, [](auto row) { return row % 5 != 2; });
+    auto tail = makeRows(size, [](auto row) { return row > 60; });
+    auto nulls = makeNulls(size, [](auto row) { return row % 7 == 3; });
+
+    int32_t numRuns = 0;
+    forEachDenseRange(all, nullptr, [&](auto begin, auto end) {
+      EXPECT_EQ(0, begin);
+      EXPECT_EQ(size, end);
+      ++numRuns;
+    });
+    EXPECT_EQ(1, numRuns);
+
+    for (const auto* rows : {&all, &some, &tail}) {
+      EXPECT_EQ(expectedRows(*rows, nullptr), denseRows(*rows, nullptr));
+      EXPECT_EQ(
+          expectedRows(*rows, nulls.data()), denseRows(*rows, nulls.data()));
+      EXPECT_EQ(
+          expectedRows(*rows, nulls.data()).size(),
+          countSelectedBits(*rows, nulls.data()));
+    }
+  }
+}
+
+TEST(SingleGroupKernelsTest, countSelectedBits) {
+  const vector_size_t size = 1'000;
+  auto rows = makeRows(size, [](auto row) { return row % 3 != 0; });
+  auto nulls = makeNulls(size, [](auto row) { return row % 11 == 0; });
+  std::vector<uint64_t> values(bits::nwords(size));
+  for (auto i = 0; i < size; i += 2) {
+    bits::setBit(values.data(), i);
+  }
+
+  int64_t numTrue = 0;
+  rows.applyToSelected([&](auto row) {
+    numTrue += !bits::isBitNull(nulls.data(), row) && row % 2 == 0;
+  });
+  EXPECT_EQ(numTrue, countSelectedBits(rows, nulls.data(), values.data()));
+  EXPECT_EQ(rows.countSelected(), countSelectedBits(rows, nullptr));
+}
+
+template <typename T>
+void testMinMax() {
+  std::vector<T> values;
+  for (auto i = 0; i < 1'000; ++i) {
+    values.push_back(static_cast<T>((i * 7'919) % 251 - 125));
+  }
+  for (auto [begin, end] : std::vector<std::pair<int32_t, int32_t>>{
+           {0, 1'000}, {3, 5}, {17, 900}, {999, 1'000}}) {
+    auto [min, max] = std::minmax_element(
+        values.begin() + begin, values.begin() + end);
+    EXPECT_EQ(
+        *min,
+        integerMinMax<true>(
+            std::numeric_limits<T>::max(), values.data(), begin, end));
+    EXPECT_EQ(
+        *max,
+        integerMinMax<false>(
+            std::numeric_limits<T>::lowest(), values.data(), begin, end));
+  }
+  EXPECT_EQ(-126, integerMinMax<true>(T(-126), values.data(), 0, 1'000));
+}
+
+TEST(SingleGroupKernelsTest, integerMinMax) {
+  testMinMax<int8_t>();
+  testMinMax<int16_t>();
+  testMinMax<int32_t>();
+  testMinMax<int64_t>();
+}
+
+TEST(SingleGroupKernelsTest, sumNarrowIntegers) {
+  std::vector<int32_t> values(10'000, std::numeric_limits<int32_t>::max());
+  EXPECT_EQ(
+      10'000LL * std::numeric_limits<int32_t>::max(),
+      sumNarrowIntegers(values.data(), 0, values.size()));
+
+  std::vector<int8_t> small{-1, 2, -3, 4, -5};
+  EXPECT_EQ(-3, sumNarrowIntegers(small.data(), 0, small.size()));
+  EXPECT_EQ(3, sumNarrowIntegers(small.data(), 1, 4));
+}
+
+} // namespace
@@ -16,6 +16,7 @@
 #include <fmt/format.h>
 #include <folly/Benchmark.h>
 #include <folly/Conv.h>
+#include <folly/String.h>
 #include <folly/init/Init.h>
 #include <string>
 
@@ -56,6 +57,40 @@ BENCHMARK_NAMED_PARAM_MULTI(regexSearch, bs1k, 1 << 10, "re2_search");
 BENCHMARK_NAMED_PARAM_MULTI(regexSearch, bs10k, 10 << 10, "re2_search");
 BENCHMARK_NAMED_PARAM_MULTI(regexSearch, bs100k, 100 << 10, "re2_search");
 
+// OR of 8 patterns searched one at a time with re2_search or at once with
+// regexp_like, which is rewritten to $internal$re2_search_any.
+int regexSearchAny(int n, int blockSize, const char* functionName) {
+  folly::BenchmarkSuspender kSuspender;
+  FunctionBenchmarkBase benchmarkBase;
+
+  VectorFuzzer::Options opts;
+  opts.vectorSize = blockSize;
+  auto vector = VectorFuzzer(opts, benchmarkBase.pool()).fuzzFlat(VARCHAR());
+  const auto data = benchmarkBase.maker().rowVector({vector});
+
+  std::vector<std::string> disjuncts;
+  for (auto i = 0; i < 8; ++i) {
+    disjuncts.push_back(
+        fmt::format("{}(c0, '{}[^{}]{{3,5}}')", functionName, i, i + 1));
+  }
+  exec::ExprSet expr = benchmarkBase.compileExpression(
+      folly::join(" or ", disjuncts), data->type());
+  kSuspender.dismiss();
+  for (int i = 0; i != n; ++i) {
+    benchmarkBase.evaluate(expr, data);
+  }
+  return n * blockSize;
+}
+
+BENCHMARK_NAMED_PARAM_MULTI(regexSearchAny, bs1k, 1 << 10, "re2_search");
+BENCHMARK_NAMED_PARAM_MULTI(regexSearchAny, bs1k_set, 1 << 10, "regexp_like");
+BENCHMARK_NAMED_PARAM_MULTI(regexSearchAny, bs10k, 10 << 10, "re2_search");
+BENCHMARK_NAMED_PARAM_MULTI(
+    regexSearchAny,
+    bs10k_set,
+    10 << 10,
+    "regexp_like");
+
 int regexExtract(int n, int blockSize) {
   folly::BenchmarkSuspender kSuspender;
   FunctionBenchmarkBase benchmarkBase;
@@ -98,6 +133,13 @@ void registerRe2Functions() {
       "re2_search", re2SearchSignatures(), makeRe2Search);
   exec::registerStatefulVectorFunction(
       "re2_extract", re2ExtractSignatures(), makeRegexExtract);
+  exec::registerStatefulVectorFunction(
+      "regexp_like", re2SearchSignatures(), makeRe2Search);
+  exec::registerStatefulVectorFunction(
+      kRe2SearchAny, re2SearchAnySignatures(), makeRe2SearchAny);
+  exec::registerExpressionRewrite([](const auto& expr) {
+    return rewriteMultiPatternSearch("", expr);
+  });
 }
 
 } // namespace facebook::velox::functions::test
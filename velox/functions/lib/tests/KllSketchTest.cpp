@@ -352,6 +352,37 @@ TEST_F(KllSketchTest, fromRepeatedValue) {
   }
 }
 
+TEST_F(KllSketchTest, insertBatch) {
+  constexpr int N = 1e5;
+  constexpr int M = 1001;
+  std::default_random_engine gen(0);
+  std::uniform_real_distribution<> dist;
+  std::vector<double> values(N);
+  for (auto& v : values) {
+    v = dist(gen);
+  }
+  KllSketch<double> expected(kDefaultK, {}, 0);
+  for (auto v : values) {
+    expected.insert(v);
+  }
+  // Batches of varying sizes end both inside and across the growth phase and
+  // the compactions.
+  KllSketch<double> kll(kDefaultK, {}, 0);
+  std::uniform_int_distribution<> batchSize(0, 3000);
+  for (int i = 0; i < N;) {
+    int size = std::min(batchSize(gen), N - i);
+    kll.insertBatch(values.data() + i, size);
+    i += size;
+  }
+  EXPECT_EQ(kll.totalCount(), N);
+  expected.finish();
+  kll.finish();
+  auto q = linspace(M);
+  EXPECT_EQ(
+      kll.estimateQuantiles(folly::Range(q.begin(), q.end())),
+      expected.estimateQuantiles(folly::Range(q.begin(), q.end())));
+}
+
 TEST_F(KllSketchTest, mergeDeserialized) {
   constexpr int N = 1e4;
   constexpr int M = 1001;
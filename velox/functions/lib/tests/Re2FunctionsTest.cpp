@@ -1558,5 +1558,45 @@ TEST_F(Re2FunctionsTest, parseSubstrings) {
   test("%aa%bb%%", {"aa", "bb"});
   test("%aa%bb%%%cc%", {"aa", "bb", "cc"});
 }
+
+TEST_F(Re2FunctionsTest, multiPatternSearch) {
+  auto data = makeRowVector({
+      makeNullableFlatVector<std::string>(
+          {"GET /index.html",
+           "POST /api\nv1",
+           "error: disk full",
+           "warning",
+           std::nullopt,
+           ""}),
+      makeFlatVector<int64_t>({0, 0, 0, 20, 0, 0}),
+  });
+  const auto rowType = asRowType(data->type());
+  auto isRewritten = [&](const std::string& expression) {
+    auto exprSet = compileExpression(expression, rowType);
+    return exprSet->expr(0)->toString().find(kRe2SearchAny) !=
+        std::string::npos;
+  };
+
+  const std::string expression =
+      "like(c0, 'GET %') or like(c0, '%api_v1') or c1 > 10 or "
+      "regexp_like(c0, 'err(or)?:') or like(c0, '%disk%')";
+  ASSERT_TRUE(isRewritten(expression));
+  assertEqualVectors(
+      makeNullableFlatVector<bool>(
+          {true, true, true, true, std::nullopt, false}),
+      evaluate(expression, data));
+
+  // Too few patterns.
+  ASSERT_FALSE(isRewritten(
+      "like(c0, 'GET %') or like(c0, '%api_v1') or like(c0, '%disk%')"));
+
+  // Invalid patterns report errors as usual.
+  const std::string invalid =
+      "like(c0, 'GET %') or like(c0, '%api_v1') or like(c0, '%disk%') or "
+      "regexp_like(c0, '(')";
+  ASSERT_FALSE(isRewritten(invalid));
+  VELOX_ASSERT_THROW(evaluate(invalid, data), "invalid regular expression");
+}
+
 } // namespace
 } // namespace facebook::velox::functions
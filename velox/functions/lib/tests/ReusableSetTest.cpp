@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/functions/lib/ReusableSet.h"
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <functional>
+
+#include "velox/type/StringView.h"
+
+namespace facebook::velox::functions {
+namespace {
+
+template <typename T>
+void testSizes(const std::function<T(int32_t)>& makeValue) {
+  ReusableSet<T> set;
+  // Alternates sets that stay in linear mode with ones that use the table.
+  for (auto size : {0, 1, 16, 17, 1'000, 5, 100, 3, 10'000, 40}) {
+    SCOPED_TRACE(fmt::format("size: {}", size));
+    set.clear();
+    ASSERT_TRUE(set.empty());
+    for (auto i = 0; i < size; ++i) {
+      ASSERT_TRUE(set.insert(makeValue(i)));
+      ASSERT_FALSE(set.insert(makeValue(i)));
+    }
+    ASSERT_EQ(set.size(), size);
+    for (auto i = 0; i < size; ++i) {
+      ASSERT_TRUE(set.contains(makeValue(i)));
+      ASSERT_FALSE(set.insert(makeValue(i)));
+    }
+    // Values from the larger sets before must not be found.
+    for (auto i = size; i < size + 10'000; ++i) {
+      ASSERT_FALSE(set.contains(makeValue(i)));
+    }
+  }
+}
+
+TEST(ReusableSetTest, integers) {
+  testSizes<int64_t>([](auto i) { return i * 1'000'003; });
+  testSizes<int32_t>([](auto i) { return -i; });
+  testSizes<int16_t>([](auto i) { return i; });
+}
+
+TEST(ReusableSetTest, strings) {
+  std::vector<std::string> strings;
+  for (auto i = 0; i < 20'000; ++i) {
+    strings.push_back(
+        i % 2 == 0 ? std::to_string(i)
+                   : fmt::format("long enough not to be inlined {}", i));
+  }
+  testSizes<StringView>([&](auto i) { return StringView(strings[i]); });
+}
+
+TEST(ReusableSetTest, nan) {
+  ReusableSet<double> set;
+  for (auto i = 0; i < 100; ++i) {
+    ASSERT_TRUE(set.insert(i));
+    ASSERT_EQ(set.insert(std::numeric_limits<double>::quiet_NaN()), i == 0);
+    ASSERT_FALSE(set.insert(-std::numeric_limits<double>::quiet_NaN()));
+  }
+  ASSERT_EQ(set.size(), 101);
+}
+
+} // namespace
+} // namespace facebook::velox::functions
@@ -37,9 +37,8 @@ class RankFunction : public exec::WindowFunction {
       : WindowFunction(resultType, nullptr, nullptr) {}
 
   void resetPartition(const exec::WindowPartition* partition) override {
-    rank_ = 1;
-    currentPeerGroupStart_ = 0;
-    previousPeerCount_ = 0;
+    denseRank_ = 0;
+    currentPeerGroupStart_ = -1;
     numPartitionRows_ = partition->numRows();
   }
 
@@ -53,37 +52,39 @@ class RankFunction : public exec::WindowFunction {
       const VectorPtr& result) override {
     int numRows = peerGroupStarts->size() / sizeof(vector_size_t);
     auto* rawPeerStarts = peerGroupStarts->as<vector_size_t>();
-    auto rawValues = result->asFlatVector<TResult>()->mutableRawValues();
-
-    for (int i = 0; i < numRows; i++) {
-      auto start = rawPeerStarts[i];
-      if (start != currentPeerGroupStart_) {
-        currentPeerGroupStart_ = start;
-        if constexpr (TRank == RankType::kDenseRank) {
-          if (previousPeerCount_ > 0) {
-            ++rank_;
-          }
-        } else {
-          rank_ += previousPeerCount_;
-        }
-        previousPeerCount_ = 0;
+    auto* rawValues =
+        result->asFlatVector<TResult>()->mutableRawValues() + resultOffset;
+
+    // The peer group starts are row numbers in the partition, so the rank of
+    // a row is one more than the start of its peer group. The loops have no
+    // branches on the peer group boundaries.
+    if constexpr (TRank == RankType::kRank) {
+      for (auto i = 0; i < numRows; ++i) {
+        rawValues[i] = rawPeerStarts[i] + 1;
       }
-
-      if constexpr (TRank == RankType::kPercentRank) {
-        rawValues[resultOffset + i] = (numPartitionRows_ == 1)
-            ? 0
-            : double(rank_ - 1) / (numPartitionRows_ - 1);
-      } else {
-        rawValues[resultOffset + i] = rank_;
+    } else if constexpr (TRank == RankType::kDenseRank) {
+      for (auto i = 0; i < numRows; ++i) {
+        denseRank_ += rawPeerStarts[i] != currentPeerGroupStart_;
+        currentPeerGroupStart_ = rawPeerStarts[i];
+        rawValues[i] = denseRank_;
+      }
+    } else {
+      if (numPartitionRows_ == 1) {
+        std::fill(rawValues, rawValues + numRows, 0);
+        return;
+      }
+      const double denominator = numPartitionRows_ - 1;
+      for (auto i = 0; i < numRows; ++i) {
+        rawValues[i] = rawPeerStarts[i] / denominator;
       }
-      previousPeerCount_ += 1;
     }
   }
 
  private:
-  int32_t currentPeerGroupStart_ = 0;
-  int32_t previousPeerCount_ = 0;
-  int64_t rank_ = 1;
+  // Number of peer groups up to and including the current one. Used by
+  // dense_rank.
+  int64_t denseRank_ = 0;
+  int32_t currentPeerGroupStart_ = -1;
   vector_size_t numPartitionRows_ = 1;
 };
 
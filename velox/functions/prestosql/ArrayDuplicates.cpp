@@ -14,12 +14,11 @@
  * limitations under the License.
  */
 
-#include <folly/container/F14Map.h>
-
 #include "velox/expression/EvalCtx.h"
 #include "velox/expression/Expr.h"
 #include "velox/expression/VectorFunction.h"
 #include "velox/functions/lib/ComparatorUtil.h"
+#include "velox/functions/lib/ReusableSet.h"
 #include "velox/functions/lib/RowsTranslationUtil.h"
 
 namespace facebook::velox::functions {
@@ -29,8 +28,8 @@ namespace {
 ///
 /// Implements the array_duplicates function.
 ///
-/// Along with the hash map, we maintain a `hasNull` flag that indicates
-/// whether null is present in the array.
+/// Along with the sets of values seen and of values reported as duplicate, we
+/// count the nulls in the array.
 ///
 /// Zero element copy:
 ///
@@ -99,9 +98,10 @@ class ArrayDuplicatesFunction : public exec::VectorFunction {
     auto* rawSizes = newSizes->asMutable<vector_size_t>();
     auto* rawOffsets = newOffsets->asMutable<vector_size_t>();
 
-    // Process the rows: use a hashmap to store unique values and
-    // whether it occurred once or more than once.
-    folly::F14FastMap<T, bool> uniqueMap;
+    // Process the rows: the values seen in the row and the ones already added
+    // to the result. The sets are reused for all rows.
+    ReusableSet<T> seen;
+    ReusableSet<T> duplicates;
 
     rows.applyToSelected([&](vector_size_t row) {
       auto size = arrayVector->sizeAt(row);
@@ -119,18 +119,15 @@ class ArrayDuplicatesFunction : public exec::VectorFunction {
           }
         } else {
           T value = elements->valueAt<T>(i);
-          auto it = uniqueMap.find(value);
-          if (it == uniqueMap.end()) {
-            uniqueMap[value] = true;
-          } else if (it->second) {
-            it->second = false;
+          if (!seen.insert(value) && duplicates.insert(value)) {
             rawIndices[indexCursor] = i;
             indexCursor++;
           }
         }
       }
 
-      uniqueMap.clear();
+      seen.clear();
+      duplicates.clear();
       rawSizes[row] = indexCursor - rawOffsets[row];
 
       std::sort(
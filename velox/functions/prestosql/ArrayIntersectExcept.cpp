@@ -15,6 +15,7 @@
  */
 #include "velox/expression/VectorFunction.h"
 #include "velox/functions/lib/LambdaFunctionUtil.h"
+#include "velox/functions/lib/ReusableSet.h"
 #include "velox/functions/lib/RowsTranslationUtil.h"
 #include "velox/type/FloatingPointUtil.h"
 
@@ -22,19 +23,17 @@ namespace facebook::velox::functions {
 namespace {
 constexpr vector_size_t kInitialSetSize{128};
 
+// Primitive values are kept in a ReusableSet, so that resetting the set for
+// the next row does not free memory.
 template <typename T>
 struct SetWithNull {
-  SetWithNull(vector_size_t initialSetSize = kInitialSetSize) {
-    set.reserve(initialSetSize);
-  }
-
   bool insert(const DecodedVector* decodedElements, vector_size_t offset) {
-    return set.insert(decodedElements->valueAt<T>(offset)).second;
+    return set.insert(decodedElements->valueAt<T>(offset));
   }
 
   size_t count(const DecodedVector* decodedElements, vector_size_t offset)
       const {
-    return set.count(decodedElements->valueAt<T>(offset));
+    return set.contains(decodedElements->valueAt<T>(offset));
   }
 
   void reset() {
@@ -46,7 +45,7 @@ struct SetWithNull {
     return !hasNull && set.empty();
   }
 
-  util::floating_point::HashSetNaNAware<T> set;
+  ReusableSet<T> set;
   bool hasNull{false};
 };
 
@@ -210,10 +209,15 @@ class ArraysIntersectSingleParam : public exec::VectorFunction {
     auto rawNewNulls = newNulls->asMutable<uint64_t>();
     auto indicesCursor = 0;
 
+    // The sets are reused for all rows. 'finalSet' holds the intersection of
+    // the arrays seen so far in a row, 'intermediateSet' the intersection with
+    // the current one.
+    SetWithNull<T> finalSet;
+    SetWithNull<T> intermediateSet;
     rows.applyToSelected([&](vector_size_t row) {
       rawNewOffsets[row] = indicesCursor;
       std::optional<vector_size_t> finalNullIndex;
-      SetWithNull<T> finalSet;
+      finalSet.reset();
 
       auto idx = decodedOuterArray->index(row);
       auto offset = outerArray->offsetAt(idx);
@@ -222,7 +226,7 @@ class ArraysIntersectSingleParam : public exec::VectorFunction {
       for (auto i = offset; i < (offset + size); ++i) {
         // 1. prepare for next iteration
         indicesCursor = rawNewOffsets[row];
-        SetWithNull<T> intermediateSet;
+        intermediateSet.reset();
         std::optional<vector_size_t> intermediateNullIndex;
 
         // 2. Null array
@@ -257,7 +261,7 @@ class ArraysIntersectSingleParam : public exec::VectorFunction {
           }
         }
         setInitialized = true;
-        finalSet = intermediateSet;
+        std::swap(finalSet, intermediateSet);
         finalNullIndex = intermediateNullIndex;
         rawNewLengths[row] = indicesCursor - rawNewOffsets[row];
       }
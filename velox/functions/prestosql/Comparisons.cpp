@@ -126,6 +126,26 @@ struct SimdComparator {
     }
   }
 
+  // Compares 'numRows' consecutive values of two arguments of type 'kind'.
+  template <TypeKind kind>
+  bool applyDense(vector_size_t numRows, const void* const* args, bool* result)
+      const {
+    using T = typename TypeTraits<kind>::NativeType;
+    if constexpr (
+        kind == TypeKind::BOOLEAN || !TypeTraits<kind>::isFixedWidth) {
+      return false;
+    } else {
+      const auto* lhs = static_cast<const T*>(args[0]);
+      const auto* rhs = static_cast<const T*>(args[1]);
+      for (vector_size_t row = 0; row < numRows; ++row) {
+        T l = lhs[row];
+        T r = rhs[row];
+        result[row] = compare(l, r);
+      }
+      return true;
+    }
+  }
+
   template <
       TypeKind kind,
       typename std::enable_if_t<
@@ -210,6 +230,24 @@ class ComparisonSimdFunction : public exec::VectorFunction {
     return true;
   }
 
+  bool supportsDenseEvaluation() const override {
+    return true;
+  }
+
+  bool applyDense(
+      const std::vector<TypePtr>& argTypes,
+      vector_size_t numRows,
+      const void* const* args,
+      void* result) const override {
+    auto comparator = SimdComparator<ComparisonOp>{};
+    return VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+        comparator.template applyDense,
+        argTypes[0]->kind(),
+        numRows,
+        args,
+        static_cast<bool*>(result));
+  }
+
   exec::FunctionCanonicalName getCanonicalName() const override {
     return std::is_same_v<ComparisonOp, Lt>
         ? exec::FunctionCanonicalName::kLt
@@ -24,6 +24,76 @@
 namespace facebook::velox::functions {
 namespace {
 
+// Checks a batch of decimal results. Overflows are accumulated in a flag
+// instead of branching per row, so that the loops over the batch have no
+// control flow. If any row overflows, throws and the caller evaluates the
+// rows one at a time to report the error of the failing row.
+FOLLY_ALWAYS_INLINE void checkBatchOverflow(bool overflow) {
+  if (overflow) {
+    VELOX_ARITHMETIC_ERROR("Decimal overflow");
+  }
+}
+
+template <typename R>
+FOLLY_ALWAYS_INLINE bool outOfRange(R value) {
+  if constexpr (std::is_same_v<R, int64_t>) {
+    // Any int64_t is in the range of long decimals.
+    return false;
+  } else {
+    return value < DecimalUtil::kLongDecimalMin ||
+        value > DecimalUtil::kLongDecimalMax;
+  }
+}
+
+// Computes a + b or a - b over 'numRows' values rescaled by the powers of ten
+// 'aRescale' and 'bRescale'.
+template <bool kPlus, typename R, typename A, typename B>
+void plusOrMinusBatch(
+    R* out,
+    int32_t numRows,
+    const A* a,
+    const B* b,
+    uint8_t aRescale,
+    uint8_t bRescale) {
+  bool overflow = false;
+  if constexpr (
+      std::is_same_v<R, int64_t> && std::is_same_v<A, int64_t> &&
+      std::is_same_v<B, int64_t>) {
+    if (aRescale == 0 && bRescale == 0) {
+      // Same scale short decimals. Wrapping unsigned arithmetic with the
+      // overflow taken from the sign bits vectorizes.
+      for (auto i = 0; i < numRows; ++i) {
+        const auto x = static_cast<uint64_t>(a[i]);
+        const auto y = static_cast<uint64_t>(b[i]);
+        const auto result = kPlus ? x + y : x - y;
+        const auto signs = kPlus ? (x ^ result) & (y ^ result)
+                                 : (x ^ y) & (x ^ result);
+        overflow |= static_cast<bool>(signs >> 63);
+        out[i] = static_cast<int64_t>(result);
+      }
+      checkBatchOverflow(overflow);
+      return;
+    }
+  }
+  const int128_t aFactor = DecimalUtil::kPowersOfTen[aRescale];
+  const int128_t bFactor = DecimalUtil::kPowersOfTen[bRescale];
+  for (auto i = 0; i < numRows; ++i) {
+    int128_t aRescaled;
+    int128_t bRescaled;
+    overflow |= __builtin_mul_overflow(a[i], aFactor, &aRescaled);
+    overflow |= __builtin_mul_overflow(b[i], bFactor, &bRescaled);
+    R result;
+    if constexpr (kPlus) {
+      overflow |= __builtin_add_overflow(R(aRescaled), R(bRescaled), &result);
+    } else {
+      overflow |= __builtin_sub_overflow(R(aRescaled), R(bRescaled), &result);
+    }
+    overflow |= outOfRange(result);
+    out[i] = result;
+  }
+  checkBatchOverflow(overflow);
+}
+
 template <typename TExec>
 struct DecimalPlusFunction {
   VELOX_DEFINE_FUNCTION_TYPES(TExec);
@@ -62,6 +132,11 @@ struct DecimalPlusFunction {
     DecimalUtil::valueInRange(out);
   }
 
+  template <typename R, typename A, typename B>
+  void callBatch(R* out, int32_t numRows, const A* a, const B* b) {
+    plusOrMinusBatch<true>(out, numRows, a, b, aRescale_, bRescale_);
+  }
+
  private:
   inline static uint8_t computeRescaleFactor(
       uint8_t fromScale,
@@ -111,6 +186,11 @@ struct DecimalMinusFunction {
     DecimalUtil::valueInRange(out);
   }
 
+  template <typename R, typename A, typename B>
+  void callBatch(R* out, int32_t numRows, const A* a, const B* b) {
+    plusOrMinusBatch<false>(out, numRows, a, b, aRescale_, bRescale_);
+  }
+
  private:
   inline static uint8_t computeRescaleFactor(
       uint8_t fromScale,
@@ -131,6 +211,18 @@ struct DecimalMultiplyFunction {
     out = checkedMultiply<R>(checkedMultiply<R>(R(a), R(b)), R(1));
     DecimalUtil::valueInRange(out);
   }
+
+  template <typename R, typename A, typename B>
+  void callBatch(R* out, int32_t numRows, const A* a, const B* b) {
+    bool overflow = false;
+    for (auto i = 0; i < numRows; ++i) {
+      R result;
+      overflow |= __builtin_mul_overflow(R(a[i]), R(b[i]), &result);
+      overflow |= outOfRange(result);
+      out[i] = result;
+    }
+    checkBatchOverflow(overflow);
+  }
 };
 
 template <typename TExec>
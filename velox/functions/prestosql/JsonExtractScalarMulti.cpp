@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/functions/prestosql/JsonExtractScalarMulti.h"
+#include "velox/core/Expressions.h"
+#include "velox/expression/VectorWriters.h"
+#include "velox/functions/prestosql/JsonFunctions.h"
+
+namespace facebook::velox::functions {
+
+namespace {
+
+class JsonExtractScalarMultiFunction : public exec::VectorFunction {
+ public:
+  explicit JsonExtractScalarMultiFunction(std::vector<std::string> paths)
+      : paths_(std::move(paths)) {}
+
+  void apply(
+      const SelectivityVector& rows,
+      std::vector<VectorPtr>& args,
+      const TypePtr& outputType,
+      exec::EvalCtx& context,
+      VectorPtr& result) const override {
+    auto* pool = context.pool();
+    std::vector<VectorPtr> fields(paths_.size());
+    std::vector<exec::VectorWriter<Varchar>> writers(paths_.size());
+    for (auto i = 0; i < paths_.size(); ++i) {
+      fields[i] = BaseVector::create(VARCHAR(), rows.end(), pool);
+      writers[i].init(*fields[i]->asFlatVector<StringView>());
+    }
+
+    exec::DecodedArgs decodedArgs(rows, {args[0]}, context);
+    const auto* json = decodedArgs.at(0);
+    context.applyToSelectedNoThrow(rows, [&](auto row) {
+      for (auto& writer : writers) {
+        writer.setOffset(row);
+      }
+      if (json->isNullAt(row)) {
+        for (auto& writer : writers) {
+          writer.commitNull();
+        }
+        return;
+      }
+      const auto value = json->valueAt<StringView>(row);
+      simdjson::padded_string paddedJson(value.data(), value.size());
+      extractRow(paddedJson, writers);
+    });
+
+    for (auto& writer : writers) {
+      writer.finish();
+    }
+    auto rowResult = std::make_shared<RowVector>(
+        pool, outputType, nullptr, rows.end(), std::move(fields));
+    context.moveOrCopyResult(rowResult, rows, result);
+  }
+
+ private:
+  // Extracts all paths from one document. The document is parsed once and
+  // rewound between paths. It is parsed again after a path fails since a
+  // document in an error state cannot be rewound.
+  void extractRow(
+      const simdjson::padded_string& json,
+      std::vector<exec::VectorWriter<Varchar>>& writers) const {
+    simdjson::ondemand::document jsonDoc;
+    bool needsParse = true;
+    for (auto i = 0; i < paths_.size(); ++i) {
+      if (needsParse) {
+        if (simdjsonParse(json).get(jsonDoc)) {
+          // Invalid JSON gives null for all paths.
+          for (auto j = i; j < paths_.size(); ++j) {
+            writers[j].commitNull();
+          }
+          return;
+        }
+        needsParse = false;
+      } else {
+        jsonDoc.rewind();
+      }
+
+      // The extractors are cached per thread with eviction. Looks up the
+      // extractor for every document instead of keeping references.
+      auto& extractor = SIMDJsonExtractor::getInstance(paths_[i]);
+      std::optional<std::string> value;
+      if (detail::extractScalar(extractor, jsonDoc, value) !=
+          simdjson::SUCCESS) {
+        needsParse = true;
+        writers[i].commitNull();
+      } else if (value.has_value()) {
+        writers[i].current().copy_from(*value);
+        writers[i].commit(true);
+      } else {
+        writers[i].commitNull();
+      }
+    }
+  }
+
+  const std::vector<std::string> paths_;
+};
+
+// Returns the path of a json_extract_scalar call with a constant valid path
+// or std::nullopt if 'expr' is not such a call.
+std::optional<std::string> getConstantJsonPath(
+    const std::string& prefix,
+    const core::TypedExprPtr& expr) {
+  auto call = std::dynamic_pointer_cast<const core::CallTypedExpr>(expr);
+  if (call == nullptr || call->name() != prefix + "json_extract_scalar" ||
+      call->inputs().size() != 2) {
+    return std::nullopt;
+  }
+  auto constant = std::dynamic_pointer_cast<const core::ConstantTypedExpr>(
+      call->inputs()[1]);
+  if (constant == nullptr || constant->isNull() ||
+      constant->type()->kind() != TypeKind::VARCHAR) {
+    return std::nullopt;
+  }
+  std::string path = constant->hasValueVector()
+      ? std::string(constant->valueVector()
+                        ->as<ConstantVector<StringView>>()
+                        ->valueAt(0))
+      : constant->value().value<TypeKind::VARCHAR>();
+  try {
+    SIMDJsonExtractor::getInstance(path);
+  } catch (const VeloxUserError&) {
+    // Invalid paths fail at evaluation as usual.
+    return std::nullopt;
+  }
+  return path;
+}
+
+// The json_extract_scalar calls over one input.
+struct JsonExtractGroup {
+  core::TypedExprPtr input;
+  std::vector<std::string> paths;
+  // The calls and the index of the path of each.
+  std::vector<std::pair<const core::ITypedExpr*, int32_t>> calls;
+};
+
+void collectJsonExtracts(
+    const std::string& prefix,
+    const core::TypedExprPtr& expr,
+    std::vector<JsonExtractGroup>& groups) {
+  // Lambda bodies are compiled separately.
+  if (expr->isLambdaKind()) {
+    return;
+  }
+  if (auto path = getConstantJsonPath(prefix, expr)) {
+    const auto& input = expr->inputs()[0];
+    auto group = std::find_if(groups.begin(), groups.end(), [&](auto& g) {
+      return *g.input == *input;
+    });
+    if (group == groups.end()) {
+      groups.push_back({input, {}, {}});
+      group = groups.end() - 1;
+    }
+    auto& paths = group->paths;
+    auto it = std::find(paths.begin(), paths.end(), path.value());
+    if (it == paths.end()) {
+      paths.push_back(path.value());
+      it = paths.end() - 1;
+    }
+    group->calls.emplace_back(expr.get(), it - paths.begin());
+  }
+  for (const auto& input : expr->inputs()) {
+    collectJsonExtracts(prefix, input, groups);
+  }
+}
+
+} // namespace
+
+std::shared_ptr<exec::VectorFunction> makeJsonExtractScalarMulti(
+    const std::string& name,
+    const std::vector<exec::VectorFunctionArg>& inputArgs,
+    const core::QueryConfig& /*config*/) {
+  VELOX_USER_CHECK_GE(
+      inputArgs.size(), 2, "{} requires at least one path", name);
+  std::vector<std::string> paths;
+  for (auto i = 1; i < inputArgs.size(); ++i) {
+    const auto& constant = inputArgs[i].constantValue;
+    VELOX_USER_CHECK(
+        constant != nullptr && !constant->isNullAt(0),
+        "{} requires constant non-null paths",
+        name);
+    paths.emplace_back(
+        constant->as<ConstantVector<StringView>>()->valueAt(0));
+  }
+  return std::make_shared<JsonExtractScalarMultiFunction>(std::move(paths));
+}
+
+std::vector<std::shared_ptr<exec::FunctionSignature>>
+jsonExtractScalarMultiSignatures() {
+  std::vector<std::shared_ptr<exec::FunctionSignature>> signatures;
+  for (const auto* inputType : {"json", "varchar"}) {
+    signatures.push_back(exec::FunctionSignatureBuilder()
+                             .returnType("row(unknown)")
+                             .argumentType(inputType)
+                             .constantArgumentType("varchar")
+                             .variableArity()
+                             .build());
+  }
+  return signatures;
+}
+
+exec::ExpressionReplacements rewriteSharedJsonExtracts(
+    const std::string& prefix,
+    const std::vector<core::TypedExprPtr>& exprs) {
+  std::vector<JsonExtractGroup> groups;
+  for (const auto& expr : exprs) {
+    collectJsonExtracts(prefix, expr, groups);
+  }
+
+  exec::ExpressionReplacements replacements;
+  for (auto& group : groups) {
+    if (group.paths.size() < 2) {
+      continue;
+    }
+    std::vector<core::TypedExprPtr> inputs{group.input};
+    std::vector<std::string> names;
+    for (auto i = 0; i < group.paths.size(); ++i) {
+      inputs.push_back(
+          std::make_shared<core::ConstantTypedExpr>(VARCHAR(), group.paths[i]));
+      names.push_back(fmt::format("p{}", i));
+    }
+    std::vector<TypePtr> types(names.size(), VARCHAR());
+    // All calls share this expression and thus one evaluation per batch.
+    auto multi = std::make_shared<core::CallTypedExpr>(
+        ROW(std::move(names), std::move(types)),
+        std::move(inputs),
+        kJsonExtractScalarMulti);
+    for (const auto& [call, index] : group.calls) {
+      replacements.emplace(
+          call,
+          std::make_shared<core::DereferenceTypedExpr>(
+              VARCHAR(), multi, index));
+    }
+  }
+  return replacements;
+}
+
+} // namespace facebook::velox::functions
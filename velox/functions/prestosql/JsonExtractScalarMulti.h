@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/expression/VectorFunction.h"
+
+namespace facebook::velox::functions {
+
+/// Name of the internal function that evaluates several json_extract_scalar
+/// calls over the same input.
+constexpr const char* kJsonExtractScalarMulti =
+    "$internal$json_extract_scalar_multi";
+
+/// $internal$json_extract_scalar_multi(json, path, path...) -> row(varchar...)
+///
+/// Returns the results of json_extract_scalar(json, path) for each of the
+/// constant paths as the fields of a row. Parses each document once and
+/// extracts all paths from the parsed document.
+std::shared_ptr<exec::VectorFunction> makeJsonExtractScalarMulti(
+    const std::string& name,
+    const std::vector<exec::VectorFunctionArg>& inputArgs,
+    const core::QueryConfig& config);
+
+std::vector<std::shared_ptr<exec::FunctionSignature>>
+jsonExtractScalarMultiSignatures();
+
+/// Finds json_extract_scalar calls with constant paths over the same input
+/// in 'exprs', e.g. projections that extract many fields from one JSON
+/// column. Replaces the calls over an input with at least 2 distinct paths
+/// by
+///     $internal$json_extract_scalar_multi(json, path1, path2, ...).pN
+/// so that each document is parsed once for all the paths. Calls with
+/// invalid paths are left as is. 'prefix' is the prefix of the name of the
+/// json_extract_scalar function.
+exec::ExpressionReplacements rewriteSharedJsonExtracts(
+    const std::string& prefix,
+    const std::vector<core::TypedExprPtr>& exprs);
+
+} // namespace facebook::velox::functions
@@ -96,6 +96,10 @@ struct KllSketchAccumulator {
     sketch_.insert(value);
   }
 
+  void append(const T* values, size_t count) {
+    sketch_.insertBatch(values, count);
+  }
+
   void append(
       T value,
       int64_t count,
@@ -457,20 +461,26 @@ class ApproxPercentileAggregate : public exec::Aggregate {
         checkWeight(weight);
         accumulator->append(value, weight, allocator_, fixedRandomSeed_);
       });
+    } else if (
+        decodedValue_.isIdentityMapping() && !decodedValue_.mayHaveNulls() &&
+        rows.isAllSelected()) {
+      accumulator->append(
+          decodedValue_.data<T>() + rows.begin(), rows.end() - rows.begin());
     } else {
+      // Gather the values so that the sketch can insert them in bulk.
+      values_.clear();
       if (decodedValue_.mayHaveNulls()) {
         rows.applyToSelected([&](auto row) {
-          if (decodedValue_.isNullAt(row)) {
-            return;
+          if (!decodedValue_.isNullAt(row)) {
+            values_.push_back(decodedValue_.valueAt<T>(row));
           }
-
-          accumulator->append(decodedValue_.valueAt<T>(row));
         });
       } else {
         rows.applyToSelected([&](auto row) {
-          accumulator->append(decodedValue_.valueAt<T>(row));
+          values_.push_back(decodedValue_.valueAt<T>(row));
         });
       }
+      accumulator->append(values_.data(), values_.size());
     }
   }
 
@@ -696,6 +706,8 @@ class ApproxPercentileAggregate : public exec::Aggregate {
   DecodedVector decodedWeight_;
   DecodedVector decodedAccuracy_;
   DecodedVector decodedDigest_;
+  // Scratch buffer for the non-null values of addSingleGroupRawInput().
+  std::vector<T> values_;
 
  private:
   template <bool kSingleGroup, bool checkIntermediateInputs>
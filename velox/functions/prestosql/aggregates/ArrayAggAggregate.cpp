@@ -405,6 +405,9 @@ void registerArrayAggAggregate(
         return std::make_unique<ArrayAggAggregate>(
             resultType, config.prestoArrayAggIgnoreNulls());
       },
+      {true /*orderSensitive*/,
+       false /*companionFunction*/,
+       true /*appendOnly*/},
       withCompanionFunctions,
       overwrite);
 }
@@ -436,6 +439,9 @@ void registerInternalArrayAggAggregate(
         return std::make_unique<ArrayAggAggregate>(
             resultType, /*ignoreNulls*/ false);
       },
+      {true /*orderSensitive*/,
+       false /*companionFunction*/,
+       true /*appendOnly*/},
       withCompanionFunctions,
       overwrite);
 }
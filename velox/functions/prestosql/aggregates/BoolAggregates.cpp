@@ -18,6 +18,7 @@
 #include "velox/exec/Aggregate.h"
 #include "velox/expression/FunctionSignature.h"
 #include "velox/functions/lib/aggregates/SimpleNumericAggregate.h"
+#include "velox/functions/lib/aggregates/SingleGroupKernels.h"
 #include "velox/functions/prestosql/aggregates/AggregateNames.h"
 
 using namespace facebook::velox::functions::aggregate;
@@ -73,6 +74,30 @@ class BoolAndOrAggregate : public SimpleNumericAggregate<bool, bool, bool> {
     }
   }
 
+  // Updates 'group' from flat booleans by counting the true and non-null bits
+  // of the selected rows a word at a time. Returns false if 'arg' is not flat.
+  bool updateOneGroupFromBits(
+      char* group,
+      const SelectivityVector& rows,
+      const VectorPtr& arg,
+      bool isAnd) {
+    if (!arg->isFlatEncoding()) {
+      return false;
+    }
+    const auto* nulls = arg->rawNulls();
+    const auto numNonNull = countSelectedBits(rows, nulls);
+    if (numNonNull == 0) {
+      return true;
+    }
+    const auto* values =
+        arg->asUnchecked<FlatVector<bool>>()->rawValues<uint64_t>();
+    const auto numTrue = countSelectedBits(rows, nulls, values);
+    clearNull(group);
+    auto& result = *value<bool>(group);
+    result = isAnd ? result && numTrue == numNonNull : result || numTrue > 0;
+    return true;
+  }
+
   const bool initialValue_;
 };
 
@@ -106,6 +131,9 @@ class BoolAndAggregate final : public BoolAndOrAggregate {
       const SelectivityVector& rows,
       const std::vector<VectorPtr>& args,
       bool mayPushdown) override {
+    if (updateOneGroupFromBits(group, rows, args[0], true)) {
+      return;
+    }
     BaseAggregate::updateOneGroup(
         group,
         rows,
@@ -157,6 +185,9 @@ class BoolOrAggregate final : public BoolAndOrAggregate {
       const SelectivityVector& rows,
       const std::vector<VectorPtr>& args,
       bool mayPushdown) override {
+    if (updateOneGroupFromBits(group, rows, args[0], false)) {
+      return;
+    }
     BaseAggregate::updateOneGroup(
         group,
         rows,
@@ -16,6 +16,7 @@
 #include "velox/functions/prestosql/aggregates/CountAggregate.h"
 #include "velox/common/base/Exceptions.h"
 #include "velox/expression/FunctionSignature.h"
+#include "velox/functions/lib/aggregates/SingleGroupKernels.h"
 #include "velox/functions/lib/aggregates/SumAggregateBase.h"
 #include "velox/functions/prestosql/aggregates/AggregateNames.h"
 
@@ -97,6 +98,10 @@ class CountAggregate : public SimpleNumericAggregate<bool, int64_t, int64_t> {
         addToGroup(group, rows.countSelected());
       }
     } else if (decoded.mayHaveNulls()) {
+      if (decoded.isIdentityMapping()) {
+        addToGroup(group, countSelectedBits(rows, decoded.nulls(&rows)));
+        return;
+      }
       int64_t nonNullCount = 0;
       rows.applyToSelected([&](vector_size_t i) {
         if (!decoded.isNullAt(i)) {
@@ -17,6 +17,7 @@
 #include "velox/functions/prestosql/aggregates/CountIfAggregate.h"
 #include "velox/exec/Aggregate.h"
 #include "velox/expression/FunctionSignature.h"
+#include "velox/functions/lib/aggregates/SingleGroupKernels.h"
 #include "velox/functions/prestosql/aggregates/AggregateNames.h"
 #include "velox/vector/DecodedVector.h"
 #include "velox/vector/FlatVector.h"
@@ -123,7 +124,10 @@ class CountIfAggregate : public exec::Aggregate {
     }
 
     int64_t numTrue = 0;
-    if (decoded.mayHaveNulls()) {
+    if (decoded.isIdentityMapping()) {
+      numTrue = functions::aggregate::countSelectedBits(
+          rows, decoded.nulls(&rows), decoded.data<uint64_t>());
+    } else if (decoded.mayHaveNulls()) {
       rows.applyToSelected([&](vector_size_t i) {
         if (decoded.isNullAt(i)) {
           return;
@@ -24,6 +24,7 @@
 #include "velox/common/hyperloglog/SparseHll.h"
 #include "velox/common/memory/HashStringAllocator.h"
 #include "velox/exec/Aggregate.h"
+#include "velox/functions/lib/aggregates/SerializedAccumulators.h"
 #include "velox/vector/DecodedVector.h"
 #include "velox/vector/FlatVector.h"
 
@@ -91,6 +92,18 @@ struct HllAccumulator {
     }
   }
 
+  void appendHashes(const uint64_t* hashes, int32_t count) {
+    auto i = 0;
+    for (; isSparse_ && i < count; ++i) {
+      if (sparseHll_.insertHash(hashes[i])) {
+        toDense();
+      }
+    }
+    if (i < count) {
+      denseHll_.insertHashes(hashes + i, count - i);
+    }
+  }
+
   int64_t cardinality() const {
     return isSparse_ ? sparseHll_.cardinality() : denseHll_.cardinality();
   }
@@ -107,8 +120,7 @@ struct HllAccumulator {
           toDense();
         }
       } else {
-        SparseHll other{input, allocator};
-        other.toDense(denseHll_);
+        SparseHll::mergeToDense(input, denseHll_);
       }
     } else if (DenseHll::canDeserialize(input)) {
       if (isSparse_) {
@@ -257,26 +269,21 @@ class HyperLogLogAggregate : public exec::Aggregate {
 
     } else {
       auto* flatResult = (*result)->asFlatVector<StringView>();
+      VELOX_CHECK(flatResult);
 
-      extract<false>(
-          groups,
+      functions::aggregate::extractSerializedAccumulators(
           numGroups,
-          flatResult,
-          [&](HllAccumulator<T, HllAsFinalResult>* accumulator,
-              FlatVector<StringView>* result,
-              vector_size_t index) {
-            auto size = accumulator->serializedSize();
-            StringView serialized;
-            if (StringView::isInline(size)) {
-              std::string buffer(size, '\0');
-              accumulator->serialize(buffer.data());
-              serialized = StringView::makeInline(buffer);
-            } else {
-              char* rawBuffer = flatResult->getRawStringBufferWithSpace(size);
-              accumulator->serialize(rawBuffer);
-              serialized = StringView(rawBuffer, size);
+          *flatResult,
+          [&](auto i) -> int32_t {
+            if (isNull(groups[i])) {
+              return -1;
             }
-            result->setNoCopy(index, serialized);
+            return value<HllAccumulator<T, HllAsFinalResult>>(groups[i])
+                ->serializedSize();
+          },
+          [&](auto i, char* out) {
+            value<HllAccumulator<T, HllAsFinalResult>>(groups[i])->serialize(
+                out);
           });
     }
   }
@@ -337,6 +344,25 @@ class HyperLogLogAggregate : public exec::Aggregate {
     } else {
       decodeArguments(rows, args);
 
+      if constexpr (!std::is_same_v<T, bool>) {
+        // Hashes the values in a tight loop, then inserts them in one batch.
+        hashes_.clear();
+        rows.applyToSelected([&](auto row) {
+          if (!decodedValue_.isNullAt(row)) {
+            hashes_.push_back(
+                hashOne<T, HllAsFinalResult>(decodedValue_.valueAt<T>(row)));
+          }
+        });
+        if (!hashes_.empty()) {
+          auto accumulator =
+              value<HllAccumulator<T, HllAsFinalResult>>(group);
+          clearNull(group);
+          accumulator->setIndexBitLength(indexBitLength_);
+          accumulator->appendHashes(hashes_.data(), hashes_.size());
+        }
+        return;
+      }
+
       rows.applyToSelected([&](auto row) {
         if (decodedValue_.isNullAt(row)) {
           return;
@@ -499,6 +525,9 @@ class HyperLogLogAggregate : public exec::Aggregate {
   DecodedVector decodedValue_;
   DecodedVector decodedMaxStandardError_;
   DecodedVector decodedHll_;
+
+  // Hashes of the values of the current batch in addSingleGroupRawInput().
+  std::vector<uint64_t> hashes_;
 };
 
 template <TypeKind kind>
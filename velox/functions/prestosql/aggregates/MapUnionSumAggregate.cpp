@@ -25,6 +25,30 @@ namespace facebook::velox::aggregate::prestosql {
 
 namespace {
 
+// Adds 'value' to 'sum'. Throws if an integer sum overflows.
+template <typename S>
+void addToSum(S& sum, S value) {
+  if constexpr (std::is_same_v<S, double> || std::is_same_v<S, float>) {
+    sum += value;
+  } else {
+    S checkedSum;
+    if (UNLIKELY(__builtin_add_overflow(sum, value, &checkedSum))) {
+      auto errorValue = (int128_t(sum) + int128_t(value));
+
+      if (errorValue < 0) {
+        VELOX_ARITHMETIC_ERROR(
+            "Value {} is less than {}",
+            errorValue,
+            std::numeric_limits<S>::min());
+      } else {
+        VELOX_ARITHMETIC_ERROR(
+            "Value {} exceeds {}", errorValue, std::numeric_limits<S>::max());
+      }
+    }
+    sum = checkedSum;
+  }
+}
+
 template <typename K, typename S>
 struct Accumulator {
   using ValuesMap = typename util::floating_point::HashMapNaNAwareTypeTraits<
@@ -46,11 +70,21 @@ struct Accumulator {
       const VectorPtr& mapValues,
       vector_size_t row,
       HashStringAllocator* allocator) {
-    auto keys = mapKeys->template as<SimpleVector<K>>();
-    auto values = mapValues->template as<SimpleVector<S>>();
     auto offset = mapVector->offsetAt(row);
     auto size = mapVector->sizeAt(row);
 
+    if constexpr (std::is_integral_v<K> && !std::is_same_v<K, bool>) {
+      // Fast path for flat integer keys and values, e.g. sparse counters.
+      auto* flatKeys = mapKeys->template asFlatVector<K>();
+      auto* flatValues = mapValues->template asFlatVector<S>();
+      if (flatKeys != nullptr && flatValues != nullptr) {
+        addFlatValues(*flatKeys, *flatValues, offset, size);
+        return;
+      }
+    }
+
+    auto keys = mapKeys->template as<SimpleVector<K>>();
+    auto values = mapValues->template as<SimpleVector<S>>();
     for (auto i = 0; i < size; ++i) {
       // Ignore null map keys.
       if (!keys->isNullAt(offset + i)) {
@@ -65,33 +99,38 @@ struct Accumulator {
       const SimpleVector<S>* mapValues,
       vector_size_t row,
       TypeKind valueKind) {
-    if (mapValues->isNullAt(row)) {
-      sums[key] += 0;
-    } else {
-      auto value = mapValues->valueAt(row);
-
-      if constexpr (std::is_same_v<S, double> || std::is_same_v<S, float>) {
-        sums[key] += value;
-      } else {
-        S checkedSum;
-        auto overflow = __builtin_add_overflow(sums[key], value, &checkedSum);
-
-        if (UNLIKELY(overflow)) {
-          auto errorValue = (int128_t(sums[key]) + int128_t(value));
+    // A null value adds the key with a sum of 0.
+    auto& sum = sums[key];
+    if (!mapValues->isNullAt(row)) {
+      addToSum(sum, mapValues->valueAt(row));
+    }
+  }
 
-          if (errorValue < 0) {
-            VELOX_ARITHMETIC_ERROR(
-                "Value {} is less than {}",
-                errorValue,
-                std::numeric_limits<S>::min());
-          } else {
-            VELOX_ARITHMETIC_ERROR(
-                "Value {} exceeds {}",
-                errorValue,
-                std::numeric_limits<S>::max());
-          }
-        }
-        sums[key] = checkedSum;
+  // Adds the entries [offset, offset + size) of flat 'keys' and 'values'
+  // without virtual calls per entry.
+  void addFlatValues(
+      const FlatVector<K>& keys,
+      const FlatVector<S>& values,
+      vector_size_t offset,
+      vector_size_t size) {
+    const auto* rawKeys = keys.rawValues();
+    const auto* rawValues = values.rawValues();
+    const auto* keyNulls = keys.rawNulls();
+    const auto* valueNulls = values.rawNulls();
+    if (keyNulls == nullptr && valueNulls == nullptr) {
+      for (auto i = offset; i < offset + size; ++i) {
+        addToSum(sums[rawKeys[i]], rawValues[i]);
+      }
+      return;
+    }
+    for (auto i = offset; i < offset + size; ++i) {
+      // Ignore null map keys.
+      if (keyNulls != nullptr && bits::isBitNull(keyNulls, i)) {
+        continue;
+      }
+      auto& sum = sums[rawKeys[i]];
+      if (valueNulls == nullptr || !bits::isBitNull(valueNulls, i)) {
+        addToSum(sum, rawValues[i]);
       }
     }
   }
@@ -213,36 +252,11 @@ struct ComplexTypeAccumulator {
         auto value =
             (values->isNullAt(offset + i)) ? 0 : values->valueAt(offset + i);
 
-        // New entry.
-        if (!sums.contains(entry)) {
-          sums[entry] = value;
-        } else {
-          // Existing entry.
-          if constexpr (std::is_same_v<V, double> || std::is_same_v<V, float>) {
-            sums[entry] += value;
-          } else {
-            V checkedSum;
-            auto overflow =
-                __builtin_add_overflow(sums[entry], value, &checkedSum);
-
-            if (UNLIKELY(overflow)) {
-              auto errorValue = (int128_t(sums[entry]) + int128_t(value));
-
-              if (errorValue < 0) {
-                VELOX_ARITHMETIC_ERROR(
-                    "Value {} is less than {}",
-                    errorValue,
-                    std::numeric_limits<V>::min());
-              } else {
-                VELOX_ARITHMETIC_ERROR(
-                    "Value {} exceeds {}",
-                    errorValue,
-                    std::numeric_limits<V>::max());
-              }
-            }
-            sums[entry] = checkedSum;
-            serializedKeys.removeLast(entry);
-          }
+        auto [it, inserted] = sums.try_emplace(entry, value);
+        if (!inserted) {
+          // Existing entry. The key is already stored.
+          addToSum(it->second, value);
+          serializedKeys.removeLast(entry);
         }
       }
     }
@@ -18,6 +18,7 @@
 
 #include "velox/exec/Aggregate.h"
 #include "velox/functions/lib/TDigest.h"
+#include "velox/functions/lib/aggregates/SerializedAccumulators.h"
 #include "velox/vector/DecodedVector.h"
 #include "velox/vector/FlatVector.h"
 
@@ -90,26 +91,20 @@ class MergeTDigestAggregate : public exec::Aggregate {
       override {
     VELOX_CHECK(result);
     auto* flatResult = (*result)->asFlatVector<StringView>();
+    VELOX_CHECK(flatResult);
     std::vector<int16_t> positions;
-    extract(
-        groups,
+    functions::aggregate::extractSerializedAccumulators(
         numGroups,
-        flatResult,
-        [&](TDigestAccumulator* accumulator,
-            FlatVector<StringView>* result,
-            vector_size_t index) {
-          auto size = accumulator->serializedSize(positions);
-          StringView serialized;
-          if (StringView::isInline(size)) {
-            std::string buffer(size, '\0');
-            accumulator->serialize(buffer.data());
-            serialized = StringView::makeInline(buffer);
-          } else {
-            char* rawBuffer = flatResult->getRawStringBufferWithSpace(size);
-            accumulator->serialize(rawBuffer);
-            serialized = StringView(rawBuffer, size);
+        *flatResult,
+        [&](auto i) -> int32_t {
+          if (isNull(groups[i])) {
+            return -1;
           }
-          result->setNoCopy(index, serialized);
+          return value<TDigestAccumulator>(groups[i])->serializedSize(
+              positions);
+        },
+        [&](auto i, char* out) {
+          value<TDigestAccumulator>(groups[i])->serialize(out);
         });
   }
 
@@ -195,35 +190,6 @@ class MergeTDigestAggregate : public exec::Aggregate {
     accumulator->mergeWith(serialized, allocator_, positions);
   }
 
-  template <typename ExtractResult, typename ExtractFunc>
-  void extract(
-      char** groups,
-      int32_t numGroups,
-      FlatVector<ExtractResult>* result,
-      ExtractFunc extractFunction) {
-    VELOX_CHECK(result);
-    result->resize(numGroups);
-
-    uint64_t* rawNulls = nullptr;
-    if (result->mayHaveNulls()) {
-      BufferPtr& nulls = result->mutableNulls(result->size());
-      rawNulls = nulls->asMutable<uint64_t>();
-    }
-
-    for (auto i = 0; i < numGroups; ++i) {
-      char* group = groups[i];
-      if (isNull(group)) {
-        // Set null for null input
-        result->setNull(i, true);
-      } else {
-        if (rawNulls) {
-          bits::clearBit(rawNulls, i);
-        }
-        auto accumulator = value<TDigestAccumulator>(group);
-        extractFunction(accumulator, result, i);
-      }
-    }
-  }
   DecodedVector decodedTDigest_;
 };
 
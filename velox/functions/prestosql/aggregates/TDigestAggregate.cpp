@@ -17,6 +17,7 @@
 #include "velox/common/memory/HashStringAllocator.h"
 #include "velox/exec/Aggregate.h"
 #include "velox/functions/lib/TDigest.h"
+#include "velox/functions/lib/aggregates/SerializedAccumulators.h"
 #include "velox/functions/prestosql/aggregates/AggregateNames.h"
 #include "velox/vector/FlatVector.h"
 
@@ -258,33 +259,26 @@ class TDigestAggregate : public exec::Aggregate {
       return;
     }
     auto flatResult = (*result)->asFlatVector<facebook::velox::StringView>();
-    flatResult->resize(numGroups);
+    VELOX_CHECK(flatResult);
     std::vector<int16_t> positions;
-    for (int32_t i = 0; i < numGroups; ++i) {
-      auto group = groups[i];
-      if (!group) {
-        flatResult->setNull(i, true);
-        continue;
-      }
-      auto accumulator = getAccumulator(group);
-      if ((!isInitialized(group)) || accumulator->digest.size() == 0) {
-        flatResult->setNull(i, true);
-        continue;
-      }
-      accumulator->digest.compress(positions);
-      auto size = accumulator->digest.serializedByteSize();
-      facebook::velox::StringView serialized;
-      if (facebook::velox::StringView::isInline(size)) {
-        std::string buffer(size, '\0');
-        accumulator->digest.serialize(buffer.data());
-        serialized = facebook::velox::StringView::makeInline(buffer);
-      } else {
-        char* rawBuffer = flatResult->getRawStringBufferWithSpace(size);
-        accumulator->digest.serialize(rawBuffer);
-        serialized = facebook::velox::StringView(rawBuffer, size);
-      }
-      flatResult->setNoCopy(i, serialized);
-    }
+    functions::aggregate::extractSerializedAccumulators(
+        numGroups,
+        *flatResult,
+        [&](auto i) -> int32_t {
+          auto group = groups[i];
+          if (!group) {
+            return -1;
+          }
+          auto accumulator = getAccumulator(group);
+          if ((!isInitialized(group)) || accumulator->digest.size() == 0) {
+            return -1;
+          }
+          accumulator->digest.compress(positions);
+          return accumulator->digest.serializedByteSize();
+        },
+        [&](auto i, char* out) {
+          getAccumulator(groups[i])->digest.serialize(out);
+        });
   }
 };
 } // namespace
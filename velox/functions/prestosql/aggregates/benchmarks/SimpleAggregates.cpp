@@ -134,17 +134,20 @@ class SimpleAggregatesBenchmark : public HiveConnectorTestBase {
     return flatTarget;
   }
 
-  void run(const std::string& key, const std::string& aggregate) {
+  void run(
+      const std::string& key,
+      const std::vector<std::string>& aggregates,
+      int32_t updateBlockRows = 0) {
     folly::BenchmarkSuspender suspender;
 
     auto plan = PlanBuilder()
                     .tableScan(inputType_)
-                    .partialAggregation({key}, {aggregate})
+                    .partialAggregation({key}, aggregates)
                     .finalAggregation()
                     .planFragment();
 
     vector_size_t numResultRows = 0;
-    auto task = makeTask(plan);
+    auto task = makeTask(plan, updateBlockRows);
 
     task->addSplit(
         "0", exec::Split(makeHiveConnectorSplit(filePath_->getPath())));
@@ -159,12 +162,18 @@ class SimpleAggregatesBenchmark : public HiveConnectorTestBase {
     folly::doNotOptimizeAway(numResultRows);
   }
 
-  std::shared_ptr<exec::Task> makeTask(core::PlanFragment plan) {
+  std::shared_ptr<exec::Task> makeTask(
+      core::PlanFragment plan,
+      int32_t updateBlockRows) {
     return exec::Task::create(
         "t",
         std::move(plan),
         0,
-        core::QueryCtx::create(executor_.get()),
+        core::QueryCtx::create(
+            executor_.get(),
+            core::QueryConfig(
+                {{core::QueryConfig::kAggregationUpdateBlockRows,
+                  std::to_string(updateBlockRows)}})),
         exec::Task::ExecutionMode::kSerial);
   }
 
@@ -176,7 +185,21 @@ class SimpleAggregatesBenchmark : public HiveConnectorTestBase {
 std::unique_ptr<SimpleAggregatesBenchmark> benchmark;
 
 void doRun(uint32_t, const std::string& key, const std::string& aggregate) {
-  benchmark->run(key, aggregate);
+  benchmark->run(key, {aggregate});
+}
+
+// Runs sum, min and max of all the value columns, 24 aggregates in total,
+// updating the accumulators in blocks of 'updateBlockRows' rows.
+void doRunMany(uint32_t, const std::string& key, int32_t updateBlockRows) {
+  std::vector<std::string> aggregates;
+  for (const auto* name : {"sum", "min", "max"}) {
+    for (const auto* column :
+         {"i32", "i64", "f32", "f64", "i32_halfnull", "i64_halfnull",
+          "f32_halfnull", "f64_halfnull"}) {
+      aggregates.push_back(fmt::format("{}({})", name, column));
+    }
+  }
+  benchmark->run(key, aggregates, updateBlockRows);
 }
 
 #define AGG_BENCHMARKS(_name_, _key_)              \
@@ -266,6 +289,15 @@ AGG_BENCHMARKS(stddev, k_norm)
 AGG_BENCHMARKS(stddev, k_hash)
 BENCHMARK_DRAW_LINE();
 
+// Many aggregates per group, one at a time and in blocks of rows.
+BENCHMARK_NAMED_PARAM(doRunMany, many_k_array, "k_array", 0);
+BENCHMARK_RELATIVE_NAMED_PARAM(doRunMany, many_k_array_blocked, "k_array", 256);
+BENCHMARK_NAMED_PARAM(doRunMany, many_k_norm, "k_norm", 0);
+BENCHMARK_RELATIVE_NAMED_PARAM(doRunMany, many_k_norm_blocked, "k_norm", 256);
+BENCHMARK_NAMED_PARAM(doRunMany, many_k_hash, "k_hash", 0);
+BENCHMARK_RELATIVE_NAMED_PARAM(doRunMany, many_k_hash_blocked, "k_hash", 256);
+BENCHMARK_DRAW_LINE();
+
 } // namespace
 
 int main(int argc, char** argv) {
@@ -73,7 +73,7 @@ class TwoStringKeysBenchmark : public HiveConnectorTestBase {
                     .singleAggregation({"k1", "k2"}, {"sum(n)"})
                     .planFragment();
 
-    auto task = makeTask(plan);
+    auto task = makeTask(plan, 0);
 
     while (auto result = task->next()) {
       // no action
@@ -83,15 +83,18 @@ class TwoStringKeysBenchmark : public HiveConnectorTestBase {
         *plan.planNode, task->taskStats(), true);
   }
 
-  void run() {
+  // Runs 'numSums' sums per group, updating the accumulators in blocks of
+  // 'updateBlockRows' rows.
+  void run(int32_t numSums, int32_t updateBlockRows) {
     folly::BenchmarkSuspender suspender;
 
+    std::vector<std::string> aggregates(numSums, "sum(n)");
     auto plan = PlanBuilder()
                     .tableScan(inputType_)
-                    .singleAggregation({"k1", "k2"}, {"sum(n)"})
+                    .singleAggregation({"k1", "k2"}, aggregates)
                     .planFragment();
 
-    auto task = makeTask(plan);
+    auto task = makeTask(plan, updateBlockRows);
 
     suspender.dismiss();
 
@@ -107,12 +110,18 @@ class TwoStringKeysBenchmark : public HiveConnectorTestBase {
   }
 
  private:
-  std::shared_ptr<exec::Task> makeTask(core::PlanFragment plan) {
+  std::shared_ptr<exec::Task> makeTask(
+      core::PlanFragment plan,
+      int32_t updateBlockRows) {
     auto task = exec::Task::create(
         "t",
         std::move(plan),
         0,
-        core::QueryCtx::create(executor_.get()),
+        core::QueryCtx::create(
+            executor_.get(),
+            core::QueryConfig(
+                {{core::QueryConfig::kAggregationUpdateBlockRows,
+                  std::to_string(updateBlockRows)}})),
         exec::Task::ExecutionMode::kSerial);
 
     task->addSplit(
@@ -128,7 +137,15 @@ class TwoStringKeysBenchmark : public HiveConnectorTestBase {
 std::unique_ptr<TwoStringKeysBenchmark> benchmark;
 
 BENCHMARK(two_string_keys) {
-  benchmark->run();
+  benchmark->run(1, 0);
+}
+
+BENCHMARK(two_string_keys_20_sums) {
+  benchmark->run(20, 0);
+}
+
+BENCHMARK_RELATIVE(two_string_keys_20_sums_blocked) {
+  benchmark->run(20, 256);
 }
 
 } // namespace
@@ -321,6 +321,35 @@ TEST_F(MapUnionSumTest, doubleNan) {
   testAggregations({data}, {}, {"map_union_sum(c0)"}, {expected});
 }
 
+TEST_F(MapUnionSumTest, nullValues) {
+  // Null values add the key with a sum of 0.
+  auto data = makeRowVector({
+      makeFlatVector<int32_t>({1, 2, 1, 2}),
+      makeNullableMapVector<int32_t, int64_t>({
+          {{{1, 10}, {2, std::nullopt}}},
+          {{{7, std::nullopt}}},
+          {{{2, 5}, {3, std::nullopt}, {1, 1}}},
+          {{{7, 3}}},
+      }),
+  });
+
+  auto expected = makeRowVector({
+      makeFlatVector<int32_t>({1, 2}),
+      makeMapVector<int32_t, int64_t>({
+          {{1, 11}, {2, 5}, {3, 0}},
+          {{7, 3}},
+      }),
+  });
+  testAggregations({data}, {"c0"}, {"map_union_sum(c1)"}, {expected});
+
+  expected = makeRowVector({
+      makeMapVector<int32_t, int64_t>({
+          {{1, 11}, {2, 5}, {3, 0}, {7, 3}},
+      }),
+  });
+  testAggregations({data}, {}, {"map_union_sum(c1)"}, {expected});
+}
+
 TEST_F(MapUnionSumTest, groupBy) {
   auto data = makeRowVector({
       makeFlatVector<int64_t>({1, 2, 1, 2, 1}),
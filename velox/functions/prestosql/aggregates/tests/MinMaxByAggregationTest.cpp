@@ -1161,6 +1161,41 @@ TEST_F(MinMaxByComplexTypes, array) {
       {data}, {}, {"min_by(c0, c1)", "max_by(c0, c1)"}, {expected});
 }
 
+TEST_F(MinMaxByComplexTypes, varcharImprovedOnEveryRow) {
+  // The comparison value grows with every row, so that the max_by value of a
+  // group improves many times per batch. A null value must win if it comes
+  // with the largest comparison value.
+  auto makeValue = [](auto row) {
+    return fmt::format("long value for row {} stored out of line", row);
+  };
+  std::vector<std::string> values;
+  for (auto row = 0; row < 5'000; ++row) {
+    values.push_back(makeValue(row));
+  }
+  std::vector<RowVectorPtr> data;
+  for (auto i = 0; i < 5; ++i) {
+    data.push_back(makeRowVector({
+        makeFlatVector<int64_t>(
+            1'000, [&](auto row) { return (i * 1'000 + row) % 3; }),
+        makeFlatVector<StringView>(
+            1'000,
+            [&](auto row) { return StringView(values[i * 1'000 + row]); },
+            [&](auto row) { return (i * 1'000 + row) % 5 == 4; }),
+        makeFlatVector<int64_t>(
+            1'000, [&](auto row) { return i * 1'000 + row; }),
+    }));
+  }
+
+  auto expected = makeRowVector({
+      makeFlatVector<int64_t>({0, 1, 2}),
+      makeNullableFlatVector<std::string>(
+          {makeValue(4'998), std::nullopt, makeValue(4'997)}),
+      makeFlatVector<std::string>({makeValue(0), makeValue(1), makeValue(2)}),
+  });
+  testAggregations(
+      data, {"c0"}, {"max_by(c1, c2)", "min_by(c1, c2)"}, {expected});
+}
+
 TEST_F(MinMaxByComplexTypes, arrayGroupBy) {
   auto data = makeRowVector({
       makeFlatVector<int64_t>({5, 6, 5, 6}),
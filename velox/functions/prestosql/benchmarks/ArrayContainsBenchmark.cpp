@@ -90,6 +90,39 @@ int main(int argc, char** argv) {
       .addExpression("vector", "contains(c0,  c1)")
       .addExpression("simple", "contains_alt(c0, c1)");
 
+  // Set operations on arrays. Each expression computes something different,
+  // so the results are not compared. The constant right-hand side is hashed
+  // once per expression, the others once per row.
+  auto setInputType = ROW({"c0", "c1"}, {ARRAY(INTEGER()), ARRAY(INTEGER())});
+  const std::string kConstantArray = "ARRAY[1, 2, 3, 4, 5, 6, 7, 8]";
+  for (const auto& [name, containerLength] :
+       std::vector<std::pair<std::string, size_t>>{
+           {"array_sets_small", 10}, {"array_sets_large", 200}}) {
+    benchmarkBuilder.addBenchmarkSet(name, setInputType)
+        .withFuzzerOptions(
+            {.vectorSize = 1000, .containerLength = containerLength})
+        .disableTesting()
+        .addExpression("distinct", "array_distinct(c0)")
+        .addExpression("intersect", "array_intersect(c0, c1)")
+        .addExpression(
+            "intersect_constant",
+            fmt::format("array_intersect(c0, {})", kConstantArray))
+        .addExpression("intersect_nested", "array_intersect(array[c0, c1])")
+        .addExpression("except", "array_except(c0, c1)")
+        .addExpression(
+            "except_constant",
+            fmt::format("array_except(c0, {})", kConstantArray))
+        .addExpression("overlap", "arrays_overlap(c0, c1)")
+        .addExpression(
+            "overlap_constant",
+            fmt::format("arrays_overlap(c0, {})", kConstantArray));
+  }
+
+  benchmarkBuilder
+      .addBenchmarkSet("array_duplicates", ROW({"c0"}, {ARRAY(BIGINT())}))
+      .withFuzzerOptions({.vectorSize = 1000, .containerLength = 100})
+      .addExpression("duplicates", "array_duplicates(c0)");
+
   benchmarkBuilder.registerBenchmarks();
   // Make sure all expressions within benchmarkSets have the same results.
   benchmarkBuilder.testBenchmarks();
@@ -96,13 +96,32 @@ class DateTimeBenchmark : public functions::test::FunctionBenchmarkBase {
         std::make_unique<HourFunction>());
   }
 
-  void run(const std::string& functionName) {
-    folly::BenchmarkSuspender suspender;
+  // Converts timestamps to 'timeZone' as the session time zone.
+  void setSessionTimezone(const std::string& timeZone) {
+    queryCtx_->testingOverrideConfigUnsafe({
+        {core::QueryConfig::kSessionTimezone, timeZone},
+        {core::QueryConfig::kAdjustTimestampToTimezone, "true"},
+    });
+  }
 
+  // Fuzzed timestamps cover a wide range of years. Timestamps in a session
+  // time zone are in recent years, one every hour or so.
+  RowVectorPtr makeData(bool recent) {
+    if (recent) {
+      return vectorMaker_.rowVector({vectorMaker_.flatVector<Timestamp>(
+          10'000,
+          [](auto row) { return Timestamp(1'600'000'000 + row * 3'607, 0); })});
+    }
     VectorFuzzer::Options opts;
     opts.vectorSize = 10'000;
-    auto data = vectorMaker_.rowVector(
+    return vectorMaker_.rowVector(
         {VectorFuzzer(opts, pool()).fuzzFlat(TIMESTAMP())});
+  }
+
+  void run(const std::string& functionName, bool recent = false) {
+    folly::BenchmarkSuspender suspender;
+
+    auto data = makeData(recent);
     auto exprSet =
         compileExpression(fmt::format("{}(c0)", functionName), data->type());
     suspender.dismiss();
@@ -110,12 +129,9 @@ class DateTimeBenchmark : public functions::test::FunctionBenchmarkBase {
     doRun(exprSet, data);
   }
 
-  void runDateTrunc(const std::string& unit) {
+  void runDateTrunc(const std::string& unit, bool recent = false) {
     folly::BenchmarkSuspender suspender;
-    VectorFuzzer::Options opts;
-    opts.vectorSize = 10'000;
-    auto data = vectorMaker_.rowVector(
-        {VectorFuzzer(opts, pool()).fuzzFlat(TIMESTAMP())});
+    auto data = makeData(recent);
     auto exprSet = compileExpression(
         fmt::format("date_trunc('{}', c0)", unit), data->type());
     suspender.dismiss();
@@ -196,6 +212,30 @@ BENCHMARK(second) {
   DateTimeBenchmark benchmark;
   benchmark.run("second");
 }
+
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK(truncDayUtc) {
+  DateTimeBenchmark benchmark;
+  benchmark.runDateTrunc("day", true);
+}
+
+BENCHMARK_RELATIVE(truncDayLosAngeles) {
+  DateTimeBenchmark benchmark;
+  benchmark.setSessionTimezone("America/Los_Angeles");
+  benchmark.runDateTrunc("day", true);
+}
+
+BENCHMARK(hourUtc) {
+  DateTimeBenchmark benchmark;
+  benchmark.run("hour", true);
+}
+
+BENCHMARK_RELATIVE(hourLosAngeles) {
+  DateTimeBenchmark benchmark;
+  benchmark.setSessionTimezone("America/Los_Angeles");
+  benchmark.run("hour", true);
+}
 } // namespace
 
 int main(int argc, char** argv) {
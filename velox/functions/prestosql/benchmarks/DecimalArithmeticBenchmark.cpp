@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+
+#include "velox/benchmarks/ExpressionBenchmarkBuilder.h"
+#include "velox/functions/prestosql/registration/RegistrationFunctions.h"
+
+using namespace facebook;
+using namespace facebook::velox;
+
+int main(int argc, char** argv) {
+  folly::Init init(&argc, &argv);
+  memory::MemoryManager::initialize(memory::MemoryManager::Options{});
+
+  functions::prestosql::registerAllScalarFunctions();
+
+  ExpressionBenchmarkBuilder benchmarkBuilder;
+
+  // Short decimals of the same and of different scales, long decimals and
+  // doubles for reference. Inputs without nulls are evaluated in batches.
+  auto inputType = ROW(
+      {"s0", "s1", "s2", "l0", "l1", "d0", "d1"},
+      {DECIMAL(12, 2),
+       DECIMAL(12, 2),
+       DECIMAL(12, 4),
+       DECIMAL(30, 2),
+       DECIMAL(30, 2),
+       DOUBLE(),
+       DOUBLE()});
+  for (auto nullRatio : {0.0, 0.1}) {
+    benchmarkBuilder
+        .addBenchmarkSet(
+            fmt::format("decimal_{}", nullRatio > 0 ? "nulls" : "nullfree"),
+            inputType)
+        .withFuzzerOptions({.vectorSize = 1000, .nullRatio = nullRatio})
+        .addExpression("plus_double", "d0 + d1")
+        .addExpression("plus_short", "s0 + s1")
+        .addExpression("minus_short", "s0 - s1")
+        .addExpression("plus_short_rescale", "s0 + s2")
+        .addExpression("plus_long", "l0 + l1")
+        .addExpression("multiply_double", "d0 * d1")
+        .addExpression("multiply_short", "s0 * s1")
+        .withIterations(100);
+  }
+
+  benchmarkBuilder.registerBenchmarks();
+  folly::runBenchmarks();
+  return 0;
+}
@@ -73,6 +73,29 @@ class InBenchmark : public functions::test::FunctionBenchmarkBase {
     doRun(exprSet, data);
   }
 
+  // Evaluates an IN list of 'numValues' strings over rows that match with
+  // probability 1/2.
+  void runStrings(size_t numValues) {
+    folly::BenchmarkSuspender suspender;
+    std::vector<std::string> rows;
+    for (auto i = 0; i < 1'000; ++i) {
+      rows.push_back(fmt::format("value-{}", (i * 7'919) % (2 * numValues)));
+    }
+    auto data = vectorMaker_.rowVector({vectorMaker_.flatVector(rows)});
+
+    std::ostringstream inList;
+    inList << "'value-0'";
+    for (auto i = 1; i < numValues; ++i) {
+      inList << ", 'value-" << i * 2 << "'";
+    }
+
+    auto sql = fmt::format("c0 IN ({})", inList.str());
+    auto exprSet = compileExpression(sql, data->type());
+    suspender.dismiss();
+
+    doRun(exprSet, data);
+  }
+
   void doRun(ExprSet& exprSet, const RowVectorPtr& rowVector) {
     int cnt = 0;
     for (auto i = 0; i < 1000; i++) {
@@ -126,6 +149,21 @@ BENCHMARK_RELATIVE(in1K) {
   benchmark.run(1'000);
 }
 
+BENCHMARK(inStrings10) {
+  InBenchmark benchmark;
+  benchmark.runStrings(10);
+}
+
+BENCHMARK(inStrings10K) {
+  InBenchmark benchmark;
+  benchmark.runStrings(10'000);
+}
+
+BENCHMARK(inStrings100K) {
+  InBenchmark benchmark;
+  benchmark.runStrings(100'000);
+}
+
 } // namespace
 
 int main(int argc, char** argv) {
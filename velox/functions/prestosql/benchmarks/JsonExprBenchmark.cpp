@@ -18,9 +18,11 @@
  * expression framework and Velox vectors.
  */
 #include <folly/Benchmark.h>
+#include <folly/String.h>
 #include <folly/init/Init.h>
 #include "velox/functions/Registerer.h"
 #include "velox/functions/lib/benchmarks/FunctionBenchmarkBase.h"
+#include "velox/functions/prestosql/JsonExtractScalarMulti.h"
 #include "velox/functions/prestosql/JsonFunctions.h"
 #include "velox/functions/prestosql/json/JsonExtractor.h"
 #include "velox/functions/prestosql/types/JsonRegistration.h"
@@ -29,6 +31,19 @@
 namespace facebook::velox::functions {
 void registerJsonVectorFunctions() {
   VELOX_REGISTER_VECTOR_FUNCTION(udf_json_extract, "json_extract");
+  exec::registerStatefulVectorFunction(
+      kJsonExtractScalarMulti,
+      jsonExtractScalarMultiSignatures(),
+      makeJsonExtractScalarMulti);
+}
+
+// Shares the parsing of json_extract_scalar calls over the same input.
+// Registered once since rewrites cannot be unregistered.
+void registerSharedJsonExtracts() {
+  exec::registerExpressionSetRewrite(
+      [](const std::vector<core::TypedExprPtr>& exprs) {
+        return rewriteSharedJsonExtracts("", exprs);
+      });
 }
 } // namespace facebook::velox::functions
 
@@ -198,6 +213,9 @@ class JsonBenchmark : public velox::functions::test::FunctionBenchmarkBase {
         {"folly_json_extract_scalar"});
     registerFunction<JsonExtractScalarFunction, Varchar, Json, Varchar>(
         {"json_extract_scalar"});
+    // Not matched by the rewrite that shares parsing between calls.
+    registerFunction<JsonExtractScalarFunction, Varchar, Json, Varchar>(
+        {"unshared_json_extract_scalar"});
     registerFunction<FollyJsonExtractFunction, Varchar, Json, Varchar>(
         {"folly_json_extract"});
     registerFunction<JsonSizeFunction, int64_t, Json, Varchar>({"json_size"});
@@ -215,6 +233,38 @@ class JsonBenchmark : public velox::functions::test::FunctionBenchmarkBase {
     return jsonData;
   }
 
+  // Returns an object with 'numFields' fields f0, f1, ... of bigint, double
+  // and varchar values, in the order of the fields or reversed.
+  std::string prepareStructData(int numFields, bool reversed) {
+    std::vector<std::string> fields;
+    for (auto i = 0; i < numFields; ++i) {
+      switch (i % 3) {
+        case 0:
+          fields.push_back(fmt::format(R"("f{}":{})", i, i * 1'000));
+          break;
+        case 1:
+          fields.push_back(fmt::format(R"("f{}":{}.25)", i, i));
+          break;
+        default:
+          fields.push_back(fmt::format(R"("f{}":"value{}")", i, i));
+      }
+    }
+    if (reversed) {
+      std::reverse(fields.begin(), fields.end());
+    }
+    return "{" + folly::join(",", fields) + "}";
+  }
+
+  // Returns the struct type of the objects of prepareStructData().
+  static std::string structType(int numFields) {
+    static const char* kTypes[] = {"bigint", "double", "varchar"};
+    std::vector<std::string> fields;
+    for (auto i = 0; i < numFields; ++i) {
+      fields.push_back(fmt::format("f{} {}", i, kTypes[i % 3]));
+    }
+    return "struct(" + folly::join(", ", fields) + ")";
+  }
+
   velox::VectorPtr makeJsonData(const std::string& json, int vectorSize) {
     auto jsonVector =
         vectorMaker_.flatVector<velox::StringView>(vectorSize, JSON());
@@ -259,6 +309,53 @@ class JsonBenchmark : public velox::functions::test::FunctionBenchmarkBase {
     doRun(iter, exprSet, rowVector);
   }
 
+  // Evaluates 'numPaths' projections fnName(c0, '$.key[i].k1').
+  void runWithJsonExtracts(
+      int iter,
+      int vectorSize,
+      const std::string& fnName,
+      const std::string& json,
+      int numPaths) {
+    folly::BenchmarkSuspender suspender;
+
+    auto rowVector = vectorMaker_.rowVector({makeJsonData(json, vectorSize)});
+    std::vector<core::TypedExprPtr> exprs;
+    for (auto i = 0; i < numPaths; ++i) {
+      auto untyped = parse::parseExpr(
+          fmt::format("{}(c0, '$.key[{}].k1')", fnName, i), options_);
+      exprs.push_back(
+          core::Expressions::inferTypes(untyped, rowVector->type(), pool()));
+    }
+    exec::ExprSet exprSet(std::move(exprs), &execCtx_);
+    SelectivityVector rows(vectorSize);
+    suspender.dismiss();
+
+    uint32_t cnt = 0;
+    for (auto i = 0; i < iter; i++) {
+      exec::EvalCtx evalCtx(&execCtx_, &exprSet, rowVector.get());
+      std::vector<VectorPtr> results(numPaths);
+      exprSet.eval(rows, evalCtx, results);
+      cnt += results[0]->size();
+    }
+    folly::doNotOptimizeAway(cnt);
+  }
+
+  void runWithJsonCast(
+      int iter,
+      int vectorSize,
+      const std::string& json,
+      const std::string& type) {
+    folly::BenchmarkSuspender suspender;
+
+    auto jsonVector = makeJsonData(json, vectorSize);
+
+    auto rowVector = vectorMaker_.rowVector({jsonVector});
+    auto exprSet = compileExpression(
+        fmt::format("cast(c0 as {})", type), rowVector->type());
+    suspender.dismiss();
+    doRun(iter, exprSet, rowVector);
+  }
+
   void runWithJsonContains(
       int iter,
       int vectorSize,
@@ -355,6 +452,24 @@ void SIMDJsonExtractScalar(int iter, int vectorSize, int jsonSize) {
       iter, vectorSize, "json_extract_scalar", json, "$.key[7].k1");
 }
 
+void UnsharedJsonExtractScalars(int iter, int vectorSize, int jsonSize) {
+  folly::BenchmarkSuspender suspender;
+  JsonBenchmark benchmark;
+  auto json = benchmark.prepareData(jsonSize);
+  suspender.dismiss();
+  benchmark.runWithJsonExtracts(
+      iter, vectorSize, "unshared_json_extract_scalar", json, 8);
+}
+
+void SharedJsonExtractScalars(int iter, int vectorSize, int jsonSize) {
+  folly::BenchmarkSuspender suspender;
+  JsonBenchmark benchmark;
+  auto json = benchmark.prepareData(jsonSize);
+  suspender.dismiss();
+  benchmark.runWithJsonExtracts(
+      iter, vectorSize, "json_extract_scalar", json, 8);
+}
+
 void FollyJsonExtract(int iter, int vectorSize, int jsonSize) {
   folly::BenchmarkSuspender suspender;
   JsonBenchmark benchmark;
@@ -390,6 +505,37 @@ void SIMDJsonSize(int iter, int vectorSize, int jsonSize) {
   benchmark.runWithJsonExtract(iter, vectorSize, "json_size", json, "$.key");
 }
 
+void CastJsonToStruct(int iter, int vectorSize, int numFields) {
+  folly::BenchmarkSuspender suspender;
+  JsonBenchmark benchmark;
+  auto json = benchmark.prepareStructData(numFields, false);
+  suspender.dismiss();
+  benchmark.runWithJsonCast(
+      iter, vectorSize, json, JsonBenchmark::structType(numFields));
+}
+
+void CastJsonToStructReversedKeys(int iter, int vectorSize, int numFields) {
+  folly::BenchmarkSuspender suspender;
+  JsonBenchmark benchmark;
+  auto json = benchmark.prepareStructData(numFields, true);
+  suspender.dismiss();
+  benchmark.runWithJsonCast(
+      iter, vectorSize, json, JsonBenchmark::structType(numFields));
+}
+
+void CastJsonToArrayOfStruct(int iter, int vectorSize, int numFields) {
+  folly::BenchmarkSuspender suspender;
+  JsonBenchmark benchmark;
+  auto element = benchmark.prepareStructData(numFields, false);
+  auto json = fmt::format("[{0},{0},{0},{0}]", element);
+  suspender.dismiss();
+  benchmark.runWithJsonCast(
+      iter,
+      vectorSize,
+      json,
+      fmt::format("array({})", JsonBenchmark::structType(numFields)));
+}
+
 BENCHMARK_DRAW_LINE();
 
 BENCHMARK_NAMED_PARAM(FollyIsJsonScalar, 100_iters_10bytes_size, 100, 10);
@@ -555,6 +701,30 @@ BENCHMARK_RELATIVE_NAMED_PARAM(
     10000);
 BENCHMARK_DRAW_LINE();
 
+BENCHMARK_NAMED_PARAM(
+    UnsharedJsonExtractScalars,
+    100_iters_1000bytes_size,
+    100,
+    1000);
+BENCHMARK_RELATIVE_NAMED_PARAM(
+    SharedJsonExtractScalars,
+    100_iters_1000bytes_size,
+    100,
+    1000);
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK_NAMED_PARAM(
+    UnsharedJsonExtractScalars,
+    100_iters_10000bytes_size,
+    100,
+    10000);
+BENCHMARK_RELATIVE_NAMED_PARAM(
+    SharedJsonExtractScalars,
+    100_iters_10000bytes_size,
+    100,
+    10000);
+BENCHMARK_DRAW_LINE();
+
 BENCHMARK_DRAW_LINE();
 BENCHMARK_NAMED_PARAM(FollyJsonExtract, 100_iters_10bytes_size, 100, 10);
 BENCHMARK_RELATIVE_NAMED_PARAM(
@@ -613,6 +783,26 @@ BENCHMARK_RELATIVE_NAMED_PARAM(
     10000);
 BENCHMARK_DRAW_LINE();
 
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(CastJsonToStruct, 100_iters_10_fields, 100, 10);
+BENCHMARK_RELATIVE_NAMED_PARAM(
+    CastJsonToStructReversedKeys,
+    100_iters_10_fields,
+    100,
+    10);
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK_NAMED_PARAM(CastJsonToStruct, 100_iters_100_fields, 100, 100);
+BENCHMARK_RELATIVE_NAMED_PARAM(
+    CastJsonToStructReversedKeys,
+    100_iters_100_fields,
+    100,
+    100);
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK_NAMED_PARAM(CastJsonToArrayOfStruct, 100_iters_100_fields, 100, 100);
+BENCHMARK_DRAW_LINE();
+
 } // namespace
 } // namespace facebook::velox::functions::prestosql
 
@@ -621,6 +811,7 @@ int main(int argc, char** argv) {
 
   facebook::velox::memory::MemoryManager::initialize(
       facebook::velox::memory::MemoryManager::Options{});
+  facebook::velox::functions::registerSharedJsonExtracts();
 
   folly::runBenchmarks();
   return 0;
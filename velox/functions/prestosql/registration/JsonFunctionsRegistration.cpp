@@ -15,6 +15,7 @@
  */
 
 #include "velox/functions/Registerer.h"
+#include "velox/functions/prestosql/JsonExtractScalarMulti.h"
 #include "velox/functions/prestosql/JsonFunctions.h"
 #include "velox/functions/prestosql/types/JsonRegistration.h"
 
@@ -31,6 +32,14 @@ void registerJsonFunctions(const std::string& prefix) {
       {prefix + "json_extract_scalar"});
   registerFunction<JsonExtractScalarFunction, Varchar, Varchar, Varchar>(
       {prefix + "json_extract_scalar"});
+  exec::registerStatefulVectorFunction(
+      kJsonExtractScalarMulti,
+      jsonExtractScalarMultiSignatures(),
+      makeJsonExtractScalarMulti);
+  exec::registerExpressionSetRewrite(
+      [prefix](const std::vector<core::TypedExprPtr>& exprs) {
+        return rewriteSharedJsonExtracts(prefix, exprs);
+      });
 
   registerFunction<JsonArrayLengthFunction, int64_t, Json>(
       {prefix + "json_array_length"});
@@ -433,6 +433,31 @@ TEST_F(ArrayDistinctTest, timestampWithTimezone) {
       {pack(1, 0), pack(2, 1), pack(3, 2), std::nullopt, pack(4, 3)});
 }
 
+// Mixes arrays small enough for a linear scan with larger ones that are
+// hashed, so that the set reused across rows switches between the two.
+TEST_F(ArrayDistinctTest, largeArrays) {
+  const std::vector<vector_size_t> sizes = {0, 20, 3, 1'000, 16, 17, 500, 2};
+  std::vector<std::vector<int64_t>> arrays;
+  std::vector<std::vector<int64_t>> expected;
+  for (auto size : sizes) {
+    arrays.emplace_back();
+    expected.emplace_back();
+    // Each value occurs about 3 times. None of the 'numDistinct' is a multiple
+    // of 7, so the first 'numDistinct' values are the distinct ones.
+    const auto numDistinct = std::max(1, size / 3);
+    for (auto i = 0; i < size; ++i) {
+      arrays.back().push_back((i * 7) % numDistinct);
+      if (i < numDistinct) {
+        expected.back().push_back((i * 7) % numDistinct);
+      }
+    }
+  }
+  testExpr(
+      makeArrayVector<int64_t>(expected),
+      "array_distinct(c0)",
+      {makeArrayVector<int64_t>(arrays)});
+}
+
 TEST_F(ArrayDistinctTest, overlappingRanges) {
   auto size = 4;
   auto elements = makeFlatVector<int64_t>({0, 1, 2, 1, 2, 1, 2, 3});
@@ -583,6 +583,53 @@ TEST_F(ArrayIntersectTest, constant) {
   testExpr(expected, "array_intersect(ARRAY[1,NULL,4], C0)", {array1});
 }
 
+// Arrays large enough for hash tables next to small ones that are scanned
+// linearly, with a constant and a non-constant right-hand side.
+TEST_F(ArrayIntersectTest, largeArrays) {
+  const std::vector<vector_size_t> sizes = {100, 3, 1'000, 17, 0, 16, 400};
+  auto left = makeArrayVector<int32_t>(
+      sizes.size(),
+      [&](auto row) { return sizes[row]; },
+      [](auto /*row*/, auto index) { return index % 50; });
+  auto right = makeArrayVector<int32_t>(
+      sizes.size(),
+      [&](auto row) { return sizes[row]; },
+      [](auto /*row*/, auto index) { return 2 * index; });
+
+  std::vector<std::vector<int32_t>> expected;
+  for (auto size : sizes) {
+    expected.emplace_back();
+    // Even values below both 50 and 2 * 'size', in order of first occurrence.
+    for (auto i = 0; i < std::min(size, 50); ++i) {
+      if (i % 2 == 0 && i < 2 * size) {
+        expected.back().push_back(i);
+      }
+    }
+  }
+  testExpr(
+      makeArrayVector<int32_t>(expected),
+      "array_intersect(c0, c1)",
+      {left, right});
+
+  std::string constant = "0";
+  for (auto i = 1; i < 100; ++i) {
+    constant += fmt::format(", {}", i * 3);
+  }
+  expected.clear();
+  for (auto size : sizes) {
+    expected.emplace_back();
+    for (auto i = 0; i < std::min(size, 50); ++i) {
+      if (i % 3 == 0) {
+        expected.back().push_back(i);
+      }
+    }
+  }
+  testExpr(
+      makeArrayVector<int32_t>(expected),
+      fmt::format("array_intersect(c0, ARRAY[{}])", constant),
+      {left});
+}
+
 // Check that results are deterministic regardless of the encoding; literals
 // (constant exprs) and regular columns should always return the same results.
 TEST_F(ArrayIntersectTest, deterministic) {
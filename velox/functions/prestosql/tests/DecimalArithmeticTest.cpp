@@ -301,6 +301,61 @@ TEST_F(DecimalArithmeticTest, multiply) {
       "");
 }
 
+TEST_F(DecimalArithmeticTest, batch) {
+  // Flat inputs without nulls are evaluated in batches.
+  const vector_size_t size = 1'000;
+  auto shortA = makeFlatVector<int64_t>(
+      size, [](auto row) { return row * 1'001 - 500'000; }, nullptr,
+      DECIMAL(10, 2));
+  auto shortB = makeFlatVector<int64_t>(
+      size, [](auto row) { return row * 7; }, nullptr, DECIMAL(10, 2));
+  auto shortC = makeFlatVector<int64_t>(
+      size, [](auto row) { return row; }, nullptr, DECIMAL(10, 4));
+
+  testDecimalExpr<TypeKind::BIGINT>(
+      makeFlatVector<int64_t>(
+          size, [](auto row) { return row * 1'008 - 500'000; }, nullptr,
+          DECIMAL(11, 2)),
+      "c0 + c1",
+      {shortA, shortB});
+  testDecimalExpr<TypeKind::BIGINT>(
+      makeFlatVector<int64_t>(
+          size, [](auto row) { return row * 994 - 500'000; }, nullptr,
+          DECIMAL(11, 2)),
+      "c0 - c1",
+      {shortA, shortB});
+  testDecimalExpr<TypeKind::BIGINT>(
+      makeFlatVector<int64_t>(
+          size, [](auto row) { return row * 100'101 - 50'000'000; }, nullptr,
+          DECIMAL(13, 4)),
+      "c0 + c1",
+      {shortA, shortC});
+  testDecimalExpr<TypeKind::HUGEINT>(
+      makeFlatVector<int128_t>(
+          size,
+          [](auto row) { return int128_t(row * 1'001 - 500'000) * row * 7; },
+          nullptr,
+          DECIMAL(20, 4)),
+      "c0 * c1",
+      {shortA, shortB});
+
+  // An overflow in one row of a batch reports the error of that row.
+  auto longA = makeFlatVector<int128_t>(
+      size,
+      [](auto row) { return row == 500 ? DecimalUtil::kLongDecimalMax : row; },
+      nullptr,
+      DECIMAL(38, 0));
+  VELOX_ASSERT_USER_THROW(
+      evaluate(
+          "c0 + c1",
+          makeRowVector(
+              {longA,
+               makeFlatVector<int64_t>(
+                   size, [](auto /*row*/) { return 1; }, nullptr,
+                   DECIMAL(2, 0))})),
+      "Decimal overflow. Value '100000000000000000000000000000000000000' is not in the range of Decimal Type");
+}
+
 TEST_F(DecimalArithmeticTest, decimalDivTest) {
   auto shortFlat = makeFlatVector<int64_t>({1000, 2000}, DECIMAL(17, 3));
   // Divide short and short, returning long.
@@ -232,6 +232,40 @@ TEST_F(ElementAtTest, mapWithDictionaryKeys) {
   }
 }
 
+TEST_F(ElementAtTest, flatMap) {
+  auto flatMap = makeNullableFlatMapVector<int64_t, int64_t>({
+      {{{1, 10}, {2, 20}}},
+      {{{2, std::nullopt}, {3, 30}}},
+      std::nullopt,
+      {{{1, 11}}},
+      {{{3, 33}}},
+  });
+  auto map = flatMap->toMapVector();
+  auto keys = makeFlatVector<int64_t>({2, 3, 1, 1, 1});
+  auto dictionary = wrapInDictionary(makeIndicesInReverse(5), flatMap);
+
+  auto testFlatMap = [&](const std::string& expression) {
+    SCOPED_TRACE(expression);
+    auto expected = evaluate(expression, makeRowVector({map, keys}));
+    auto result = evaluate(expression, makeRowVector({flatMap, keys}));
+    test::assertEqualVectors(expected, result);
+
+    expected = evaluate(
+        expression,
+        makeRowVector({wrapInDictionary(makeIndicesInReverse(5), map), keys}));
+    result = evaluate(expression, makeRowVector({dictionary, keys}));
+    test::assertEqualVectors(expected, result);
+  };
+
+  // Constant keys are looked up in the flat map, other keys go through a
+  // conversion to MapVector.
+  testFlatMap("element_at(c0, 1)");
+  testFlatMap("element_at(c0, 2)");
+  testFlatMap("element_at(c0, 4)");
+  testFlatMap("c0[3]");
+  testFlatMap("element_at(c0, c1)");
+}
+
 TEST_F(ElementAtTest, arrayWithDictionaryElements) {
   {
     auto elementsIndices = makeIndices({6, 5, 4, 3, 2, 1, 0});
@@ -1439,6 +1439,45 @@ TEST_F(JsonCastTest, toRow) {
   testCast(null, nullExpected);
 }
 
+TEST_F(JsonCastTest, toRowKeyOrder) {
+  // Keys in the order of the fields, in another order, with missing and
+  // unknown keys, in different case, and after a null value.
+  auto data = makeNullableFlatVector<JsonNativeType>(
+      {R"({"a":1,"b":"x","c":1.5})"_sv,
+       R"({"c":2.5,"b":"y","a":2})"_sv,
+       R"({"a":3,"d":true,"c":3.5})"_sv,
+       R"({"A":4,"B":"z","C":4.5})"_sv,
+       R"({"b":null,"a":5,"b":"w"})"_sv},
+      JSON());
+  auto expected = makeRowVector(
+      {"a", "b", "c"},
+      {makeFlatVector<int64_t>({1, 2, 3, 4, 5}),
+       makeNullableFlatVector<StringView>(
+           {"x"_sv, "y"_sv, std::nullopt, "z"_sv, "w"_sv}),
+       makeNullableFlatVector<double>({1.5, 2.5, 3.5, 4.5, std::nullopt})});
+  testCast(data, expected);
+
+  // Rows in arrays use the same field mapping for every element.
+  data = makeNullableFlatVector<JsonNativeType>(
+      {R"([{"a":1,"b":"x"},{"b":"y","a":2},{"a":3}])"_sv,
+       R"([{"B":"z","a":4}])"_sv},
+      JSON());
+  auto arrayExpected = makeArrayVector(
+      {0, 3},
+      makeRowVector(
+          {"a", "b"},
+          {makeFlatVector<int64_t>({1, 2, 3, 4}),
+           makeNullableFlatVector<StringView>(
+               {"x"_sv, "y"_sv, std::nullopt, "z"_sv})}));
+  testCast(data, arrayExpected);
+
+  testThrow<std::string>(
+      JSON(),
+      ROW({"a", "b"}, {BIGINT(), BIGINT()}),
+      {R"({"a":1,"b":2,"A":3})"},
+      "Duplicate field: a");
+}
+
 TEST_F(JsonCastTest, toNested) {
   auto array = makeNullableFlatVector<JsonNativeType>(
       {R"([[1,2],[3]])"_sv, R"([[null,null,4]])"_sv, "[[]]"_sv, "[]"_sv},
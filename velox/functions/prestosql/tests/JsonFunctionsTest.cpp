@@ -1167,6 +1167,62 @@ TEST_F(JsonFunctionsTest, jsonExtractVarcharInput) {
   EXPECT_EQ(std::nullopt, jsonExtract(kJson, "$.book[1:2]", true));
 }
 
+TEST_F(JsonFunctionsTest, sharedJsonExtractScalar) {
+  auto data = makeRowVector({
+      makeNullableFlatVector<std::string>({
+          R"({"a": 1, "b": "x", "c": [1, 2], "d": {"e": true}})",
+          std::nullopt,
+          R"({"a": 2, "b": null})",
+          R"({"a": 1, "b": "2""})",
+          R"([1, 2, 3])",
+          R"({"b": "y", "c": [3, 4, 5]})",
+      }),
+      makeFlatVector<std::string>({"{}", "{}", "{}", "{}", "{}", "{}"}),
+  });
+  const std::vector<std::string> expressions = {
+      "json_extract_scalar(c0, '$.a')",
+      "json_extract_scalar(c0, '$.b')",
+      "concat(json_extract_scalar(c0, '$.a'), json_extract_scalar(c0, '$.x'))",
+      "json_extract_scalar(c0, '$.c[1]')",
+      "json_extract_scalar(c0, '$.d.e')",
+      "json_extract_scalar(c0, '$.d')",
+      "json_extract_scalar(c1, '$.a')",
+  };
+  const auto rowType = asRowType(data->type());
+
+  // A set with these expressions shares one parse of c0 between the calls.
+  auto exprSet = compileExpressions(expressions, rowType);
+  ASSERT_NE(
+      exprSet->toString().find("$internal$json_extract_scalar_multi"),
+      std::string::npos);
+  exec::EvalCtx context(&execCtx_, exprSet.get(), data.get());
+  SelectivityVector rows(data->size());
+  std::vector<VectorPtr> results(expressions.size());
+  exprSet->eval(rows, context, results);
+
+  // Each expression alone has a single path per input and is not rewritten.
+  for (auto i = 0; i < expressions.size(); ++i) {
+    SCOPED_TRACE(expressions[i]);
+    auto single = compileExpression(expressions[i], rowType);
+    ASSERT_EQ(
+        single->toString().find("$internal$json_extract_scalar_multi"),
+        std::string::npos);
+    assertEqualVectors(evaluate(*single, data), results[i]);
+  }
+
+  // Invalid paths are not shared and fail as usual.
+  exprSet = compileExpressions(
+      {"json_extract_scalar(c0, '$.a')",
+       "json_extract_scalar(c0, '$.b')",
+       "json_extract_scalar(c0, '$.book[1:2]')"},
+      rowType);
+  exec::EvalCtx invalidContext(&execCtx_, exprSet.get(), data.get());
+  results.clear();
+  results.resize(3);
+  VELOX_ASSERT_THROW(
+      exprSet->eval(rows, invalidContext, results), "Invalid JSON path");
+}
+
 // The following tests ensure that the internal json functions
 // $internal$json_string_to_array/map/row_cast can be invoked without issues
 // from Prestissimo. The actual functionality is tested in JsonCastTest.
@@ -88,6 +88,44 @@ TEST_F(TransformTest, differentResultType) {
   assertEqualVectors(expectedResult, result);
 }
 
+TEST_F(TransformTest, constantCapture) {
+  vector_size_t size = 1'000;
+  auto indexAt = [](vector_size_t /*row*/, vector_size_t index) -> int64_t {
+    return index;
+  };
+  auto input = makeRowVector({
+      makeArrayVector<int64_t>(size, modN(5), indexAt, nullEvery(11)),
+      makeConstant<int64_t>(10, size),
+      makeFlatVector<int64_t>(size, [](auto row) { return row; }),
+      makeNullConstant(TypeKind::BIGINT, size),
+  });
+
+  auto result = evaluate<ArrayVector>("transform(c0, x -> x + c1)", input);
+  auto expectedResult = makeArrayVector<int64_t>(
+      size,
+      modN(5),
+      [](vector_size_t /*row*/, vector_size_t index) -> int64_t {
+        return index + 10;
+      },
+      nullEvery(11));
+  assertEqualVectors(expectedResult, result);
+
+  result = evaluate<ArrayVector>(
+      "transform(c0, x -> coalesce(c3, x) + c1)", input);
+  assertEqualVectors(expectedResult, result);
+
+  // Constant and non-constant captures.
+  result = evaluate<ArrayVector>("transform(c0, x -> x * c1 + c2)", input);
+  expectedResult = makeArrayVector<int64_t>(
+      size,
+      modN(5),
+      [](vector_size_t row, vector_size_t index) -> int64_t {
+        return index * 10 + row;
+      },
+      nullEvery(11));
+  assertEqualVectors(expectedResult, result);
+}
+
 // Test different lambdas applied to different rows
 TEST_F(TransformTest, conditional) {
   vector_size_t size = 1'000;
@@ -739,11 +739,56 @@ simdjson::error_code appendMapKey<TypeKind::TIMESTAMP>(
   return simdjson::INCORRECT_TYPE;
 }
 
+// Plan for casting JSON values to one level of the result type. Built once per
+// batch so that casting a value neither dispatches on the type kind nor sets
+// up the field mapping of a row again.
+struct JsonCastPlan {
+  using CastFunction = simdjson::error_code (*)(
+      simdjson::ondemand::value,
+      exec::GenericWriter&,
+      JsonCastPlan&);
+  using AppendKeyFunction =
+      simdjson::error_code (*)(const std::string_view&, exec::GenericWriter&);
+
+  explicit JsonCastPlan(const TypePtr& type);
+
+  const TypePtr type;
+
+  // If casting to JSON, nulls in arrays and maps become the JSON text "null".
+  const bool isJson;
+
+  // Casts a value to 'type'.
+  const CastFunction cast;
+
+  // Plans for the children of 'type'.
+  std::vector<JsonCastPlan> children;
+
+  // Appends a key to a map. Only set for MAP.
+  AppendKeyFunction appendKey{nullptr};
+
+  // The members below are only set for ROW.
+
+  bool allFieldsAreAscii{true};
+
+  // Lower-case field names and the mapping from them to field indices.
+  std::vector<std::string> fieldNames;
+  folly::F14FastMap<std::string, int32_t> fieldIndices;
+
+  // True if no two fields have the same lower-case name. Object keys that
+  // follow the order of the fields then match without a lookup.
+  bool uniqueFieldNames{true};
+
+  // Scratch state for decoding an object.
+  std::vector<bool> seenFields;
+  std::string key;
+};
+
 template <typename Input>
 struct CastFromJsonTypedImpl {
   template <TypeKind kind>
-  static simdjson::error_code apply(Input input, exec::GenericWriter& writer) {
-    return KindDispatcher<kind>::apply(input, writer);
+  static simdjson::error_code
+  apply(Input input, exec::GenericWriter& writer, JsonCastPlan& plan) {
+    return KindDispatcher<kind>::apply(input, writer, plan);
   }
 
  private:
@@ -751,7 +796,8 @@ struct CastFromJsonTypedImpl {
   // class.
   template <TypeKind kind, typename Dummy = void>
   struct KindDispatcher {
-    static simdjson::error_code apply(Input, exec::GenericWriter&) {
+    static simdjson::error_code
+    apply(Input, exec::GenericWriter&, JsonCastPlan&) {
       VELOX_NYI(
           "Casting from JSON to {} is not supported.", TypeTraits<kind>::name);
       return simdjson::error_code::UNEXPECTED_ERROR; // Make compiler happy.
@@ -762,10 +808,11 @@ struct CastFromJsonTypedImpl {
   struct KindDispatcher<TypeKind::VARCHAR, Dummy> {
     static simdjson::error_code apply(
         Input value,
-        exec::GenericWriter& writer) {
+        exec::GenericWriter& writer,
+        JsonCastPlan& plan) {
       SIMDJSON_ASSIGN_OR_RAISE(auto type, value.type());
 
-      if (isJsonType(writer.type())) {
+      if (plan.isJson) {
         std::string_view json;
         SIMDJSON_ASSIGN_OR_RAISE(json, rawJson(value, type));
         auto& vectorWriter = writer.castTo<Varchar>();
@@ -806,7 +853,8 @@ struct CastFromJsonTypedImpl {
   struct KindDispatcher<TypeKind::BOOLEAN, Dummy> {
     static simdjson::error_code apply(
         Input value,
-        exec::GenericWriter& writer) {
+        exec::GenericWriter& writer,
+        JsonCastPlan& /*plan*/) {
       SIMDJSON_ASSIGN_OR_RAISE(auto type, value.type());
       auto& w = writer.castTo<bool>();
       switch (type) {
@@ -848,7 +896,8 @@ struct CastFromJsonTypedImpl {
   struct KindDispatcher<TypeKind::TINYINT, Dummy> {
     static simdjson::error_code apply(
         Input value,
-        exec::GenericWriter& writer) {
+        exec::GenericWriter& writer,
+        JsonCastPlan& /*plan*/) {
       return castJsonToInt<int8_t>(value, writer);
     }
   };
@@ -857,7 +906,8 @@ struct CastFromJsonTypedImpl {
   struct KindDispatcher<TypeKind::SMALLINT, Dummy> {
     static simdjson::error_code apply(
         Input value,
-        exec::GenericWriter& writer) {
+        exec::GenericWriter& writer,
+        JsonCastPlan& /*plan*/) {
       return castJsonToInt<int16_t>(value, writer);
     }
   };
@@ -866,7 +916,8 @@ struct CastFromJsonTypedImpl {
   struct KindDispatcher<TypeKind::INTEGER, Dummy> {
     static simdjson::error_code apply(
         Input value,
-        exec::GenericWriter& writer) {
+        exec::GenericWriter& writer,
+        JsonCastPlan& /*plan*/) {
       return castJsonToInt<int32_t>(value, writer);
     }
   };
@@ -875,7 +926,8 @@ struct CastFromJsonTypedImpl {
   struct KindDispatcher<TypeKind::BIGINT, Dummy> {
     static simdjson::error_code apply(
         Input value,
-        exec::GenericWriter& writer) {
+        exec::GenericWriter& writer,
+        JsonCastPlan& /*plan*/) {
       return castJsonToInt<int64_t>(value, writer);
     }
   };
@@ -884,7 +936,8 @@ struct CastFromJsonTypedImpl {
   struct KindDispatcher<TypeKind::REAL, Dummy> {
     static simdjson::error_code apply(
         Input value,
-        exec::GenericWriter& writer) {
+        exec::GenericWriter& writer,
+        JsonCastPlan& /*plan*/) {
       return castJsonToFloatingPoint<float>(value, writer);
     }
   };
@@ -893,7 +946,8 @@ struct CastFromJsonTypedImpl {
   struct KindDispatcher<TypeKind::DOUBLE, Dummy> {
     static simdjson::error_code apply(
         Input value,
-        exec::GenericWriter& writer) {
+        exec::GenericWriter& writer,
+        JsonCastPlan& /*plan*/) {
       return castJsonToFloatingPoint<double>(value, writer);
     }
   };
@@ -902,22 +956,20 @@ struct CastFromJsonTypedImpl {
   struct KindDispatcher<TypeKind::ARRAY, Dummy> {
     static simdjson::error_code apply(
         Input value,
-        exec::GenericWriter& writer) {
+        exec::GenericWriter& writer,
+        JsonCastPlan& plan) {
       auto& writerTyped = writer.castTo<Array<Any>>();
-      auto& elementType = writer.type()->childAt(0);
+      auto& elementPlan = plan.children[0];
       SIMDJSON_ASSIGN_OR_RAISE(auto array, value.get_array());
       for (auto elementResult : array) {
         SIMDJSON_ASSIGN_OR_RAISE(auto element, elementResult);
         // If casting to array of JSON, nulls in array elements should become
         // the JSON text "null".
-        if (!isJsonType(elementType) && element.is_null()) {
+        if (!elementPlan.isJson && element.is_null()) {
           writerTyped.add_null();
         } else {
-          SIMDJSON_TRY(VELOX_DYNAMIC_TYPE_DISPATCH(
-              CastFromJsonTypedImpl<simdjson::ondemand::value>::apply,
-              elementType->kind(),
-              element,
-              writerTyped.add_item()));
+          SIMDJSON_TRY(
+              elementPlan.cast(element, writerTyped.add_item(), elementPlan));
         }
       }
       return simdjson::SUCCESS;
@@ -928,65 +980,42 @@ struct CastFromJsonTypedImpl {
   struct KindDispatcher<TypeKind::MAP, Dummy> {
     static simdjson::error_code apply(
         Input value,
-        exec::GenericWriter& writer) {
+        exec::GenericWriter& writer,
+        JsonCastPlan& plan) {
       auto& writerTyped = writer.castTo<Map<Any, Any>>();
-      auto& keyType = writer.type()->childAt(0);
-      auto& valueType = writer.type()->childAt(1);
+      auto& valuePlan = plan.children[1];
       SIMDJSON_ASSIGN_OR_RAISE(auto object, value.get_object());
       for (auto fieldResult : object) {
         SIMDJSON_ASSIGN_OR_RAISE(auto field, fieldResult);
         SIMDJSON_ASSIGN_OR_RAISE(auto key, field.unescaped_key(true));
         // If casting to map of JSON values, nulls in map values should become
         // the JSON text "null".
-        if (!isJsonType(valueType) && field.value().is_null()) {
-          SIMDJSON_TRY(VELOX_DYNAMIC_TYPE_DISPATCH(
-              appendMapKey, keyType->kind(), key, writerTyped.add_null()));
+        if (!valuePlan.isJson && field.value().is_null()) {
+          SIMDJSON_TRY(plan.appendKey(key, writerTyped.add_null()));
         } else {
           auto writers = writerTyped.add_item();
-          SIMDJSON_TRY(VELOX_DYNAMIC_TYPE_DISPATCH(
-              appendMapKey, keyType->kind(), key, std::get<0>(writers)));
-          SIMDJSON_TRY(VELOX_DYNAMIC_TYPE_DISPATCH(
-              CastFromJsonTypedImpl<simdjson::ondemand::value>::apply,
-              valueType->kind(),
-              field.value(),
-              std::get<1>(writers)));
+          SIMDJSON_TRY(plan.appendKey(key, std::get<0>(writers)));
+          SIMDJSON_TRY(valuePlan.cast(
+              field.value(), std::get<1>(writers), valuePlan));
         }
       }
       return simdjson::SUCCESS;
     }
   };
 
-  static folly::F14FastMap<std::string, int32_t> makeFieldIndicesMap(
-      const RowType& rowType,
-      bool allFieldsAreAscii) {
-    folly::F14FastMap<std::string, int32_t> fieldIndices;
-    const auto size = rowType.size();
-    for (auto i = 0; i < size; ++i) {
-      std::string key = rowType.nameOf(i);
-      if (allFieldsAreAscii) {
-        folly::toLowerAscii(key);
-      } else {
-        boost::algorithm::to_lower(key);
-      }
-
-      fieldIndices[key] = i;
-    }
-
-    return fieldIndices;
-  }
-
   template <typename Dummy>
   struct KindDispatcher<TypeKind::ROW, Dummy> {
     static simdjson::error_code apply(
         Input value,
-        exec::GenericWriter& writer) {
-      auto& rowType = writer.type()->asRow();
+        exec::GenericWriter& writer,
+        JsonCastPlan& plan) {
+      auto& rowType = plan.type->asRow();
       auto& writerTyped = writer.castTo<DynamicRow>();
       SIMDJSON_ASSIGN_OR_RAISE(auto type, value.type());
       if (type == simdjson::ondemand::json_type::array) {
         SIMDJSON_ASSIGN_OR_RAISE(auto array, value.get_array());
         SIMDJSON_ASSIGN_OR_RAISE(auto arraySize, array.count_elements());
-        if (arraySize != writer.type()->size()) {
+        if (arraySize != rowType.size()) {
           return simdjson::INCORRECT_TYPE;
         }
         column_index_t i = 0;
@@ -995,63 +1024,64 @@ struct CastFromJsonTypedImpl {
           if (element.is_null()) {
             writerTyped.set_null_at(i);
           } else {
-            SIMDJSON_TRY(VELOX_DYNAMIC_TYPE_DISPATCH(
-                CastFromJsonTypedImpl<simdjson::ondemand::value>::apply,
-                rowType.childAt(i)->kind(),
-                element,
-                writerTyped.get_writer_at(i)));
+            auto& childPlan = plan.children[i];
+            SIMDJSON_TRY(childPlan.cast(
+                element, writerTyped.get_writer_at(i), childPlan));
           }
           ++i;
         }
       } else {
         SIMDJSON_ASSIGN_OR_RAISE(auto object, value.get_object());
-
-        // TODO Populate this mapping once, not per-row.
-        // Mapping from lower-case field names of the target RowType to their
-        // indices.
-        bool allFieldsAreAscii = true;
         const auto size = rowType.size();
-        for (auto i = 0; i < size; ++i) {
-          const auto& name = rowType.nameOf(i);
-          allFieldsAreAscii &=
-              functions::stringCore::isAscii(name.data(), name.size());
-        }
+        plan.seenFields.assign(size, false);
 
-        auto fieldIndices = makeFieldIndicesMap(rowType, allFieldsAreAscii);
-
-        std::string key;
+        // The field expected next if the keys follow the order of the fields.
+        column_index_t nextField = 0;
         for (auto fieldResult : object) {
           SIMDJSON_ASSIGN_OR_RAISE(auto field, fieldResult);
-          if (!field.value().is_null()) {
-            SIMDJSON_ASSIGN_OR_RAISE(key, field.unescaped_key(true));
-
+          if (field.value().is_null()) {
+            ++nextField;
+            continue;
+          }
+          SIMDJSON_ASSIGN_OR_RAISE(
+              std::string_view key, field.unescaped_key(true));
+
+          column_index_t index;
+          if (plan.uniqueFieldNames && nextField < size &&
+              (key == rowType.nameOf(nextField) ||
+               key == plan.fieldNames[nextField])) {
+            index = nextField;
+          } else {
+            plan.key.assign(key);
             // boost::algorithm::to_lower is very slow. Use much faster
             // folly::toLowerAscii if possible.
-            if (allFieldsAreAscii) {
-              folly::toLowerAscii(key);
+            if (plan.allFieldsAreAscii) {
+              folly::toLowerAscii(plan.key);
             } else {
-              boost::algorithm::to_lower(key);
+              boost::algorithm::to_lower(plan.key);
             }
-
-            auto it = fieldIndices.find(key);
-            if (it != fieldIndices.end()) {
-              const auto index = it->second;
-
-              VELOX_USER_CHECK_GE(index, 0, "Duplicate field: {}", key);
-              it->second = -1;
-
-              SIMDJSON_TRY(VELOX_DYNAMIC_TYPE_DISPATCH(
-                  CastFromJsonTypedImpl<simdjson::ondemand::value>::apply,
-                  rowType.childAt(index)->kind(),
-                  field.value(),
-                  writerTyped.get_writer_at(index)));
+            auto it = plan.fieldIndices.find(plan.key);
+            if (it == plan.fieldIndices.end()) {
+              continue;
             }
+            index = it->second;
           }
+
+          VELOX_USER_CHECK(
+              !plan.seenFields[index],
+              "Duplicate field: {}",
+              plan.fieldNames[index]);
+          plan.seenFields[index] = true;
+          nextField = index + 1;
+
+          auto& childPlan = plan.children[index];
+          SIMDJSON_TRY(childPlan.cast(
+              field.value(), writerTyped.get_writer_at(index), childPlan));
         }
 
-        for (const auto& [key, index] : fieldIndices) {
-          if (index >= 0) {
-            writerTyped.set_null_at(index);
+        for (column_index_t i = 0; i < size; ++i) {
+          if (!plan.seenFields[i]) {
+            writerTyped.set_null_at(i);
           }
         }
       }
@@ -1140,17 +1170,66 @@ struct CastFromJsonTypedImpl {
   }
 };
 
+template <TypeKind kind>
+JsonCastPlan::CastFunction castFromJsonFunction() {
+  return CastFromJsonTypedImpl<simdjson::ondemand::value>::apply<kind>;
+}
+
+template <TypeKind kind>
+JsonCastPlan::AppendKeyFunction appendMapKeyFunction() {
+  return appendMapKey<kind>;
+}
+
+JsonCastPlan::JsonCastPlan(const TypePtr& type)
+    : type{type},
+      isJson{isJsonType(type)},
+      cast{VELOX_DYNAMIC_TYPE_DISPATCH(castFromJsonFunction, type->kind())} {
+  children.reserve(type->size());
+  for (auto i = 0; i < type->size(); ++i) {
+    children.emplace_back(type->childAt(i));
+  }
+
+  if (type->isMap()) {
+    appendKey = VELOX_DYNAMIC_TYPE_DISPATCH(
+        appendMapKeyFunction, type->childAt(0)->kind());
+  } else if (type->isRow()) {
+    const auto& rowType = type->asRow();
+    const auto size = rowType.size();
+    for (auto i = 0; i < size; ++i) {
+      const auto& name = rowType.nameOf(i);
+      allFieldsAreAscii &=
+          functions::stringCore::isAscii(name.data(), name.size());
+    }
+
+    // Mapping from lower-case field names of the target RowType to their
+    // indices.
+    fieldNames.reserve(size);
+    for (auto i = 0; i < size; ++i) {
+      std::string name = rowType.nameOf(i);
+      if (allFieldsAreAscii) {
+        folly::toLowerAscii(name);
+      } else {
+        boost::algorithm::to_lower(name);
+      }
+      fieldIndices[name] = i;
+      fieldNames.push_back(std::move(name));
+    }
+    uniqueFieldNames = fieldIndices.size() == size;
+  }
+}
+
 template <TypeKind kind>
 simdjson::error_code castFromJsonOneRow(
     simdjson::padded_string_view input,
-    exec::VectorWriter<Any>& writer) {
+    exec::VectorWriter<Any>& writer,
+    JsonCastPlan& plan) {
   SIMDJSON_ASSIGN_OR_RAISE(auto doc, simdjsonParse(input));
   if (doc.is_null()) {
     writer.commitNull();
   } else {
     SIMDJSON_TRY(
         CastFromJsonTypedImpl<simdjson::ondemand::document&>::apply<kind>(
-            doc, writer.current()));
+            doc, writer.current(), plan));
     writer.commit(true);
   }
   return simdjson::SUCCESS;
@@ -1229,6 +1308,7 @@ void JsonCastOperator::castFromJson(
     maxSize = std::max(maxSize, input.size());
   });
   paddedInput_.resize(maxSize + simdjson::SIMDJSON_PADDING);
+  JsonCastPlan plan(result.type());
   context.applyToSelectedNoThrow(
       rows,
       [&](auto row) INLINE_LAMBDA {
@@ -1241,7 +1321,8 @@ void JsonCastOperator::castFromJson(
         memcpy(paddedInput_.data(), input.data(), input.size());
         simdjson::padded_string_view paddedInput(
             paddedInput_.data(), input.size(), paddedInput_.size());
-        if (auto error = castFromJsonOneRow<kind>(paddedInput, writer)) {
+        if (auto error =
+                castFromJsonOneRow<kind>(paddedInput, writer, plan)) {
           context.setVeloxExceptionError(row, errors_[error]);
           writer.commitNull();
         }
@@ -27,9 +27,6 @@ class CumeDistFunction : public exec::WindowFunction {
   explicit CumeDistFunction() : WindowFunction(DOUBLE(), nullptr, nullptr) {}
 
   void resetPartition(const exec::WindowPartition* partition) override {
-    runningTotal_ = 0;
-    cumeDist_ = 0;
-    currentPeerGroupStart_ = -1;
     numPartitionRows_ = partition->numRows();
   }
 
@@ -42,25 +39,19 @@ class CumeDistFunction : public exec::WindowFunction {
       vector_size_t resultOffset,
       const VectorPtr& result) override {
     int numRows = peerGroupStarts->size() / sizeof(vector_size_t);
-    auto* rawValues = result->asFlatVector<double>()->mutableRawValues();
-    auto* peerGroupStartsVector = peerGroupStarts->as<vector_size_t>();
-    auto* peerGroupEndsVector = peerGroupEnds->as<vector_size_t>();
+    auto* rawValues =
+        result->asFlatVector<double>()->mutableRawValues() + resultOffset;
+    auto* rawPeerEnds = peerGroupEnds->as<vector_size_t>();
 
-    for (int i = 0; i < numRows; i++) {
-      auto peerStart = peerGroupStartsVector[i];
-      if (peerStart != currentPeerGroupStart_) {
-        currentPeerGroupStart_ = peerStart;
-        runningTotal_ += peerGroupEndsVector[i] - peerStart + 1;
-        cumeDist_ = static_cast<double>(runningTotal_) / numPartitionRows_;
-      }
-      rawValues[resultOffset + i] = cumeDist_;
+    // The peer group ends are row numbers in the partition, so the number of
+    // rows up to and including the peer group of a row is its end plus one.
+    for (auto i = 0; i < numRows; ++i) {
+      rawValues[i] =
+          static_cast<double>(rawPeerEnds[i] + 1) / numPartitionRows_;
     }
   }
 
  private:
-  int64_t runningTotal_ = 0;
-  double cumeDist_ = 0;
-  int64_t currentPeerGroupStart_ = -1;
   vector_size_t numPartitionRows_ = 1;
 };
 
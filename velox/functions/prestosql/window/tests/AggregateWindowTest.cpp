@@ -388,6 +388,33 @@ TEST_F(AggregateWindowTest, integerOverflowRowsFrame) {
       expected);
 }
 
+// Tests sliding frames that are large enough to be computed from a segment
+// tree.
+TEST_F(AggregateWindowTest, largeSlidingFrames) {
+  const vector_size_t size = 3'000;
+  auto input = makeRowVector({
+      makeFlatVector<int32_t>(size, [](auto row) { return row % 3; }),
+      makeFlatVector<int64_t>(size, [](auto row) { return row; }),
+      makeFlatVector<int64_t>(
+          size, [](auto row) { return row * 7 % 101; }, nullEvery(7)),
+      makeFlatVector<int32_t>(size, [](auto row) { return row % 5; }),
+  });
+  const std::string overClause = "partition by c0 order by c1";
+  const std::vector<std::string> frameClauses = {
+      "rows between 100 preceding and 50 following",
+      "rows between 300 preceding and current row",
+      "rows between current row and 500 following",
+      "range between 1000 preceding and 200 following",
+  };
+  createDuckDbTable({input});
+  for (const auto& function : kAggregateFunctions) {
+    WindowTestBase::testWindowFunction(
+        {input}, function, {overClause}, frameClauses, false);
+  }
+  WindowTestBase::testWindowFunction(
+      {input}, "min(c2)", {"partition by c3 order by c1"}, frameClauses, false);
+}
+
 TEST_F(AggregateWindowTest, zeroRangeFrame) {
   auto p0 = makeFlatVector<int32_t>({1, 1, 1, 2, 2});
   auto s0 = makeFlatVector<int32_t>({1, 2, 3, 4, 5});
@@ -97,6 +97,18 @@ TEST_P(RankTest, randomInput) {
   testWindowFunction({makeRandomInputVector(30)});
 }
 
+// Tests all functions with a dataset with peer groups of many rows.
+TEST_P(RankTest, largePeerGroups) {
+  const vector_size_t size = 1'000;
+  testWindowFunction({makeRowVector({
+      makeFlatVector<int32_t>(size, [](auto row) { return row % 2; }),
+      makeFlatVector<int32_t>(
+          size, [](auto row) { return row / 37; }, nullEvery(11)),
+      makeFlatVector<int64_t>(size, [](auto row) { return row / 200; }),
+      makeFlatVector<int32_t>(size, [](auto row) { return row / 500; }),
+  })});
+}
+
 // Run above tests for all combinations of rank function and over clauses.
 VELOX_INSTANTIATE_TEST_SUITE_P(
     RankTestInstantiation,
@@ -54,6 +54,18 @@ int main(int argc, char** argv) {
   // recognize the function registered above (remote.xxx).
   registerFunction<PlusFunction, int64_t, int64_t, int64_t>({"plus"});
 
+  // Register remote adapters for PlusFunction that split each batch into
+  // requests of at most 'maxRowsPerRequest' rows, all of them in flight at
+  // the same time.
+  for (const auto maxRowsPerRequest : {100, 250}) {
+    const auto name = fmt::format("remote_plus_{}", maxRowsPerRequest);
+    RemoteVectorFunctionMetadata pipelinedMetadata = metadata;
+    pipelinedMetadata.maxRowsPerRequest = maxRowsPerRequest;
+    registerRemoteFunction(name, plusSignatures, pipelinedMetadata);
+    registerFunction<PlusFunction, int64_t, int64_t, int64_t>(
+        {param.functionPrefix + "." + name});
+  }
+
   // Register the remote adapter for SubstrFunction
   auto substrSignatures = {exec::FunctionSignatureBuilder()
                                .returnType("varchar")
@@ -94,6 +106,8 @@ int main(int argc, char** argv) {
               {fuzzer.fuzzFlat(BIGINT()), fuzzer.fuzzFlat(BIGINT())}))
       .addExpression("local_plus", "plus(c0, c1) ")
       .addExpression("remote_plus", "remote_plus(c0, c1) ")
+      .addExpression("remote_plus_100", "remote_plus_100(c0, c1) ")
+      .addExpression("remote_plus_250", "remote_plus_250(c0, c1) ")
       .withIterations(1000);
 
   // benchmark comparaing SubstrFunction running locally (same thread)
@@ -16,6 +16,7 @@
 
 #include "velox/functions/remote/client/Remote.h"
 
+#include <folly/futures/Future.h>
 #include <folly/io/async/EventBase.h>
 #include "velox/expression/Expr.h"
 #include "velox/expression/VectorFunction.h"
@@ -43,6 +44,7 @@ class RemoteFunction : public exec::VectorFunction {
         location_(metadata.location),
         thriftClient_(getThriftClient(location_, &eventBase_)),
         serdeFormat_(metadata.serdeFormat),
+        maxRowsPerRequest_(metadata.maxRowsPerRequest),
         serde_(getSerde(serdeFormat_)) {
     std::vector<TypePtr> types;
     types.reserve(inputArgs.size());
@@ -85,8 +87,53 @@ class RemoteFunction : public exec::VectorFunction {
         rows.end(),
         std::move(args));
 
-    // Send to remote server.
-    remote::RemoteFunctionResponse remoteResponse;
+    const vector_size_t numRows = remoteRowVector->size();
+    if (maxRowsPerRequest_ == 0 || numRows <= maxRowsPerRequest_) {
+      remote::RemoteFunctionResponse remoteResponse;
+      auto request = makeRequest(remoteRowVector, outputType, context);
+      try {
+        thriftClient_->sync_invokeFunction(remoteResponse, request);
+      } catch (const std::exception& e) {
+        throwRemoteError(e.what());
+      }
+      result = processResponse(remoteResponse, outputType, context, 0);
+      return;
+    }
+
+    // Send all the requests before waiting for the first response to overlap
+    // their round trips.
+    std::vector<vector_size_t> offsets;
+    std::vector<folly::SemiFuture<remote::RemoteFunctionResponse>> responses;
+    for (vector_size_t offset = 0; offset < numRows;
+         offset += maxRowsPerRequest_) {
+      const auto size = std::min(maxRowsPerRequest_, numRows - offset);
+      auto request = makeRequest(
+          std::static_pointer_cast<RowVector>(
+              remoteRowVector->slice(offset, size)),
+          outputType,
+          context);
+      offsets.push_back(offset);
+      responses.push_back(thriftClient_->semifuture_invokeFunction(request));
+    }
+    auto remoteResponses = folly::collectAll(std::move(responses))
+                               .via(&eventBase_)
+                               .getVia(&eventBase_);
+
+    result = BaseVector::create(outputType, numRows, context.pool());
+    for (auto i = 0; i < remoteResponses.size(); ++i) {
+      if (remoteResponses[i].hasException()) {
+        throwRemoteError(remoteResponses[i].exception().what().toStdString());
+      }
+      auto output = processResponse(
+          remoteResponses[i].value(), outputType, context, offsets[i]);
+      result->copy(output.get(), offsets[i], 0, output->size());
+    }
+  }
+
+  remote::RemoteFunctionRequest makeRequest(
+      const RowVectorPtr& remoteRowVector,
+      const TypePtr& outputType,
+      exec::EvalCtx& context) const {
     remote::RemoteFunctionRequest request;
     request.throwOnError_ref() = context.throwOnError();
 
@@ -101,24 +148,34 @@ class RemoteFunction : public exec::VectorFunction {
 
     // TODO: serialize only active rows.
     requestInputs->payload_ref() = rowVectorToIOBuf(
-        remoteRowVector, rows.end(), *context.pool(), serde_.get());
+        remoteRowVector,
+        remoteRowVector->size(),
+        *context.pool(),
+        serde_.get());
+    return request;
+  }
 
-    try {
-      thriftClient_->sync_invokeFunction(remoteResponse, request);
-    } catch (const std::exception& e) {
-      VELOX_FAIL(
-          "Error while executing remote function '{}' at '{}': {}",
-          functionName_,
-          location_.describe(),
-          e.what());
-    }
+  [[noreturn]] void throwRemoteError(const std::string& error) const {
+    VELOX_FAIL(
+        "Error while executing remote function '{}' at '{}': {}",
+        functionName_,
+        location_.describe(),
+        error);
+  }
 
+  // Returns the result vector of 'remoteResponse' and sets the errors it
+  // reports in 'context'. 'offset' is the first row of the batch the request
+  // was made for.
+  VectorPtr processResponse(
+      remote::RemoteFunctionResponse& remoteResponse,
+      const TypePtr& outputType,
+      exec::EvalCtx& context,
+      vector_size_t offset) const {
     auto outputRowVector = IOBufToRowVector(
         remoteResponse.result().value().payload().value(),
         ROW({outputType}),
         *context.pool(),
         serde_.get());
-    result = outputRowVector->childAt(0);
 
     if (auto errorPayload = remoteResponse.result().value().errorPayload()) {
       auto errorsRowVector = IOBufToRowVector(
@@ -135,18 +192,21 @@ class RemoteFunction : public exec::VectorFunction {
         try {
           throw std::runtime_error(errorsVector->valueAt(i));
         } catch (const std::exception&) {
-          context.setError(i, std::current_exception());
+          context.setError(offset + i, std::current_exception());
         }
       });
     }
+    return outputRowVector->childAt(0);
   }
 
   const std::string functionName_;
   folly::SocketAddress location_;
 
-  folly::EventBase eventBase_;
+  // Mutable to wait for the in-flight requests from const apply().
+  mutable folly::EventBase eventBase_;
   std::unique_ptr<RemoteFunctionClient> thriftClient_;
   remote::PageFormat serdeFormat_;
+  const vector_size_t maxRowsPerRequest_;
   std::unique_ptr<VectorSerde> serde_;
 
   // Structures we construct once to cache:
@@ -30,6 +30,12 @@ struct RemoteVectorFunctionMetadata : public exec::VectorFunctionMetadata {
 
   /// The serialization format to be used
   remote::PageFormat serdeFormat{remote::PageFormat::PRESTO_PAGE};
+
+  /// If greater than 0, splits the rows of each batch into requests of at most
+  /// this many rows. All the requests of a batch are sent before waiting for
+  /// any response, so they are in flight at the same time and the server can
+  /// process them concurrently. 0 sends the whole batch in one request.
+  vector_size_t maxRowsPerRequest{0};
 };
 
 /// Registers a new remote function. It will use the meatadata defined in
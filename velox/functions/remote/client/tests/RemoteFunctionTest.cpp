@@ -114,6 +114,13 @@ class RemoteFunctionTest
                               .build()};
     registerRemoteFunction("remote_divide", divSignatures, metadata);
 
+    RemoteVectorFunctionMetadata chunkedMetadata = metadata;
+    chunkedMetadata.maxRowsPerRequest = 2;
+    registerRemoteFunction(
+        "remote_plus_chunked", plusSignatures, chunkedMetadata);
+    registerRemoteFunction(
+        "remote_divide_chunked", divSignatures, chunkedMetadata);
+
     auto substrSignatures = {exec::FunctionSignatureBuilder()
                                  .returnType("varchar")
                                  .argumentType("varchar")
@@ -135,6 +142,10 @@ class RemoteFunctionTest
         {params.functionPrefix + ".remote_fail"});
     registerFunction<CheckedDivideFunction, double, double, double>(
         {params.functionPrefix + ".remote_divide"});
+    registerFunction<PlusFunction, int64_t, int64_t, int64_t>(
+        {params.functionPrefix + ".remote_plus_chunked"});
+    registerFunction<CheckedDivideFunction, double, double, double>(
+        {params.functionPrefix + ".remote_divide_chunked"});
     registerFunction<SubstrFunction, Varchar, Varchar, int32_t>(
         {params.functionPrefix + ".remote_substr"});
     registerFunction<OpaqueTypeFunction, int64_t, std::shared_ptr<Foo>>(
@@ -181,6 +192,23 @@ TEST_P(RemoteFunctionTest, tryException) {
   assertEqualVectors(expected, results);
 }
 
+TEST_P(RemoteFunctionTest, multipleRequests) {
+  // The 5 rows are sent in 3 requests of at most 2 rows.
+  auto inputVector = makeFlatVector<int64_t>({1, 2, 3, 4, 5});
+  auto results = evaluate<SimpleVector<int64_t>>(
+      "remote_plus_chunked(c0, c0)", makeRowVector({inputVector}));
+  assertEqualVectors(makeFlatVector<int64_t>({2, 4, 6, 8, 10}), results);
+
+  // The errors are reported at the rows of the whole batch.
+  auto numeratorVector = makeFlatVector<double>({1, 4, 9, 16, 25});
+  auto denominatorVector = makeFlatVector<double>({1, 2, 3, 0, 5});
+  results = evaluate<SimpleVector<double>>(
+      "TRY(remote_divide_chunked(c0, c1))",
+      makeRowVector({numeratorVector, denominatorVector}));
+  auto expected = makeNullableFlatVector<double>({1, 2, 3, std::nullopt, 5});
+  assertEqualVectors(expected, results);
+}
+
 TEST_P(RemoteFunctionTest, conditionalConjunction) {
   // conditional conjunction disables throwing on error.
   auto inputVector0 = makeFlatVector<bool>({true, true});
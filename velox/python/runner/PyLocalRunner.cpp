@@ -17,6 +17,7 @@
 #include "velox/python/runner/PyLocalRunner.h"
 
 #include <pybind11/stl.h>
+#include <cerrno>
 #include "velox/connectors/hive/HiveConnectorSplit.h"
 #include "velox/core/PlanNode.h"
 #include "velox/dwio/common/Options.h"
@@ -24,6 +25,7 @@
 #include "velox/exec/PlanNodeStats.h"
 #include "velox/exec/Spill.h"
 #include "velox/python/vector/PyVector.h"
+#include "velox/vector/arrow/Bridge.h"
 
 namespace facebook::velox::py {
 namespace {
@@ -38,6 +40,79 @@ std::mutex& taskRegistryLock() {
   return lock;
 }
 
+// Private data of the ArrowArrayStream exported by arrowStream().
+struct CursorStream {
+  std::shared_ptr<exec::TaskCursor> cursor;
+  RowTypePtr type;
+  std::shared_ptr<memory::MemoryPool> pool;
+  std::string error;
+};
+
+// Private data of an exported batch. Keeps the pool the batch was allocated
+// from alive until the consumer releases the batch.
+struct CursorBatch {
+  void (*release)(ArrowArray*);
+  void* privateData;
+  std::shared_ptr<memory::MemoryPool> pool;
+};
+
+void releaseCursorBatch(ArrowArray* array) {
+  auto* batch = static_cast<CursorBatch*>(array->private_data);
+  array->release = batch->release;
+  array->private_data = batch->privateData;
+  array->release(array);
+  delete batch;
+}
+
+int cursorStreamGetSchema(ArrowArrayStream* stream, ArrowSchema* out) {
+  auto* state = static_cast<CursorStream*>(stream->private_data);
+  try {
+    exportToArrow(BaseVector::create(state->type, 0, state->pool.get()), *out);
+  } catch (const std::exception& e) {
+    state->error = e.what();
+    return EINVAL;
+  }
+  return 0;
+}
+
+int cursorStreamGetNext(ArrowArrayStream* stream, ArrowArray* out) {
+  auto* state = static_cast<CursorStream*>(stream->private_data);
+  try {
+    if (!state->cursor->moveNext()) {
+      // End of stream.
+      out->release = nullptr;
+      return 0;
+    }
+    exportToArrow(state->cursor->current(), *out, state->pool.get());
+  } catch (const std::exception& e) {
+    state->error = e.what();
+    return EIO;
+  }
+  out->private_data =
+      new CursorBatch{out->release, out->private_data, state->pool};
+  out->release = releaseCursorBatch;
+  return 0;
+}
+
+const char* cursorStreamGetLastError(ArrowArrayStream* stream) {
+  auto* state = static_cast<CursorStream*>(stream->private_data);
+  return state->error.empty() ? nullptr : state->error.c_str();
+}
+
+void cursorStreamRelease(ArrowArrayStream* stream) {
+  delete static_cast<CursorStream*>(stream->private_data);
+  stream->release = nullptr;
+}
+
+void releaseStreamCapsule(PyObject* capsule) {
+  auto* stream = static_cast<ArrowArrayStream*>(
+      PyCapsule_GetPointer(capsule, "arrow_array_stream"));
+  if (stream->release != nullptr) {
+    stream->release(stream);
+  }
+  delete stream;
+}
+
 } // namespace
 
 namespace py = pybind11;
@@ -47,6 +122,9 @@ PyVector PyTaskIterator::Iterator::operator*() const {
 }
 
 void PyTaskIterator::Iterator::advance() {
+  // Drivers do not need Python state, so let other Python threads run while
+  // waiting for the next batch.
+  py::gil_scoped_release release;
   if (cursor_ && cursor_->moveNext()) {
     vector_ = cursor_->current();
   } else {
@@ -80,8 +158,8 @@ void PyLocalRunner::addQueryConfig(
   queryConfigs_[configName] = configValue;
 }
 
-py::iterator PyLocalRunner::execute(int32_t maxDrivers) {
-  if (pyIterator_) {
+void PyLocalRunner::startCursor(int32_t maxDrivers) {
+  if (cursor_) {
     throw std::runtime_error("PyLocalRunner can only be executed once.");
   }
 
@@ -113,11 +191,29 @@ py::iterator PyLocalRunner::execute(int32_t maxDrivers) {
     std::lock_guard<std::mutex> guard(taskRegistryLock());
     taskRegistry().push_back(cursor_->task());
   }
+}
 
+py::iterator PyLocalRunner::execute(int32_t maxDrivers) {
+  startCursor(maxDrivers);
   pyIterator_ = std::make_shared<PyTaskIterator>(cursor_, outputPool_);
   return py::make_iterator(pyIterator_->begin(), pyIterator_->end());
 }
 
+py::capsule PyLocalRunner::arrowStream(
+    py::object /*requestedSchema*/,
+    int32_t maxDrivers) {
+  startCursor(maxDrivers);
+  auto stream = std::make_unique<ArrowArrayStream>();
+  stream->get_schema = cursorStreamGetSchema;
+  stream->get_next = cursorStreamGetNext;
+  stream->get_last_error = cursorStreamGetLastError;
+  stream->release = cursorStreamRelease;
+  stream->private_data = new CursorStream{
+      cursor_, planNode_->outputType(), outputPool_, ""};
+  return py::capsule(
+      stream.release(), "arrow_array_stream", &releaseStreamCapsule);
+}
+
 std::string PyLocalRunner::printPlanWithStats() const {
   return exec::printPlanWithStats(
       *planNode_, cursor_->task()->taskStats(), true);
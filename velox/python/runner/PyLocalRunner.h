@@ -66,6 +66,18 @@ class PyLocalRunner {
   /// plan.
   pybind11::iterator execute(int32_t maxDrivers = 1);
 
+  /// Execute the task and returns its output as an "arrow_array_stream"
+  /// PyCapsule (Arrow PyCapsule interface). The stream pulls batches from
+  /// the task cursor without touching Python state, so consumers can read it
+  /// with the GIL released.
+  ///
+  /// @param requestedSchema Accepted for protocol compatibility and ignored.
+  /// @param maxDrivers Maximum number of drivers to use when executing the
+  /// plan.
+  pybind11::capsule arrowStream(
+      pybind11::object requestedSchema,
+      int32_t maxDrivers = 1);
+
   /// Prints a descriptive debug message containing plan and execution stats.
   /// If the task hasn't finished, will print the plan with the current stats.
   std::string printPlanWithStats() const;
@@ -73,6 +85,9 @@ class PyLocalRunner {
  private:
   friend class PyTaskIterator;
 
+  // Creates 'cursor_' and adds the scan splits. Throws if called twice.
+  void startCursor(int32_t maxDrivers);
+
   // Memory pools and thread pool to be used by queryCtx.
   std::shared_ptr<memory::MemoryPool> rootPool_;
   std::shared_ptr<memory::MemoryPool> outputPool_;
@@ -54,6 +54,22 @@ PYBIND11_MODULE(runner, m) {
           max_drivers: Maximum number of drivers (threads) to use when
           executing the plan.
           )"))
+      .def(
+          "__arrow_c_stream__",
+          &velox::py::PyLocalRunner::arrowStream,
+          py::arg("requested_schema") = py::none(),
+          py::arg("max_drivers") = 1,
+          py::doc(R"(
+        Executes a given plan and exports its output through the Arrow
+        PyCapsule stream interface, e.g.
+        pyarrow.RecordBatchReader.from_stream(runner). Batches are
+        produced without holding the GIL.
+
+        Args:
+          requested_schema: Ignored.
+          max_drivers: Maximum number of drivers (threads) to use when
+          executing the plan.
+          )"))
       .def(
           "print_plan_with_stats",
           &velox::py::PyLocalRunner::printPlanWithStats,
@@ -21,6 +21,9 @@ from pyvelox.vector import Vector
 class LocalRunner:
     def __init__(self, PlanNode) -> None: ...
     def execute(self, max_drivers: Optional[int] = None) -> Iterator[Vector]: ...
+    def __arrow_c_stream__(
+        self, requested_schema: Optional[object] = None, max_drivers: int = 1
+    ) -> object: ...
     def add_file_split(self, plan_id: str, file_path: str) -> None: ...
     def add_query_config(self, config_name: str, config_value: str) -> None: ...
     def print_plan_with_stats(self) -> str: ...
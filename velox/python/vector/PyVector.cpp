@@ -18,8 +18,48 @@
 #include "velox/vector/ComplexVector.h"
 #include "velox/vector/VectorPrinter.h"
 #include "velox/vector/VectorSaver.h"
+#include "velox/vector/arrow/Bridge.h"
 
 namespace facebook::velox::py {
+namespace {
+
+// Capsule destructors. A consumer that imports the structure moves it out and
+// leaves 'release' null, otherwise we release it here.
+void releaseSchemaCapsule(PyObject* capsule) {
+  auto* schema =
+      static_cast<ArrowSchema*>(PyCapsule_GetPointer(capsule, "arrow_schema"));
+  if (schema->release != nullptr) {
+    schema->release(schema);
+  }
+  delete schema;
+}
+
+void releaseArrayCapsule(PyObject* capsule) {
+  auto* array =
+      static_cast<ArrowArray*>(PyCapsule_GetPointer(capsule, "arrow_array"));
+  if (array->release != nullptr) {
+    array->release(array);
+  }
+  delete array;
+}
+
+} // namespace
+
+pybind11::capsule PyVector::arrowCSchema() const {
+  auto schema = std::make_unique<ArrowSchema>();
+  exportToArrow(vector_, *schema);
+  return pybind11::capsule(
+      schema.release(), "arrow_schema", &releaseSchemaCapsule);
+}
+
+pybind11::tuple PyVector::arrowCArray(
+    pybind11::object /*requestedSchema*/) const {
+  auto array = std::make_unique<ArrowArray>();
+  exportToArrow(vector_, *array, vector_->pool());
+  auto arrayCapsule =
+      pybind11::capsule(array.release(), "arrow_array", &releaseArrayCapsule);
+  return pybind11::make_tuple(arrowCSchema(), std::move(arrayCapsule));
+}
 
 std::string PyVector::summarizeToText() const {
   return velox::VectorPrinter::summarizeToText(*vector_);
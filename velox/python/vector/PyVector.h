@@ -124,6 +124,16 @@ class PyVector {
     return vector_;
   }
 
+  /// Exports the vector type through the Arrow PyCapsule interface as an
+  /// "arrow_schema" capsule.
+  pybind11::capsule arrowCSchema() const;
+
+  /// Exports the vector through the Arrow PyCapsule interface as a pair of
+  /// "arrow_schema" and "arrow_array" capsules. Buffers are shared with the
+  /// vector wherever the Arrow bridge allows it. 'requestedSchema' is
+  /// accepted for protocol compatibility and ignored.
+  pybind11::tuple arrowCArray(pybind11::object requestedSchema) const;
+
  private:
   std::shared_ptr<memory::MemoryPool> pool_;
   VectorPtr vector_;
@@ -40,6 +40,20 @@ PYBIND11_MODULE(vector, m) {
       .def("__eq__", &velox::py::PyVector::equals, py::doc(R"(
         Returns if two PyVectors have the same size and contents.
       )"))
+      .def(
+          "__arrow_c_schema__",
+          &velox::py::PyVector::arrowCSchema,
+          py::doc(R"(
+        Exports the Vector type through the Arrow PyCapsule interface.
+      )"))
+      .def(
+          "__arrow_c_array__",
+          &velox::py::PyVector::arrowCArray,
+          py::arg("requested_schema") = py::none(),
+          py::doc(R"(
+        Exports the Vector through the Arrow PyCapsule interface, sharing
+        buffers with Velox wherever possible, e.g. pyarrow.array(vector).
+      )"))
       .def("type", &velox::py::PyVector::type, py::doc(R"(
         Returns the Type of the Vector.
       )"))
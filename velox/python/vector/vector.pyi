@@ -14,6 +14,8 @@
 
 # pyre-unsafe
 
+from typing import Optional, Tuple
+
 class Vector:
     def size(self) -> int: ...
     def print_all(self) -> str: ...
@@ -24,5 +26,9 @@ class Vector:
     def null_count(self) -> int: ...
     def is_null_at(self, int) -> bool: ...
     def __getitem__(self, int) -> str: ...
+    def __arrow_c_schema__(self) -> object: ...
+    def __arrow_c_array__(
+        self, requested_schema: Optional[object] = None
+    ) -> Tuple[object, object]: ...
 
 def restore_from_file(file_path: str) -> Vector: ...
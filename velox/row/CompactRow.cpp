@@ -33,16 +33,6 @@ int32_t readInt32(const char* buffer) {
   return n;
 }
 
-FOLLY_ALWAYS_INLINE void writeFixedWidth(
-    const char* rawData,
-    vector_size_t index,
-    size_t valueBytes,
-    char* buffer,
-    size_t& offset) {
-  ::memcpy(buffer + offset, rawData + index * valueBytes, valueBytes);
-  offset += valueBytes;
-}
-
 FOLLY_ALWAYS_INLINE void
 writeTimestamp(const Timestamp& timestamp, char* buffer, size_t& offset) {
   // Write micros(int64_t) for timestamp value.
@@ -63,30 +53,61 @@ writeString(const StringView& value, char* buffer, size_t& offset) {
 // Serialize the child vector of a row type within a range of consecutive rows.
 // Write the serialized data at offsets of buffer row by row.
 // Update offsets with the actual serialized size.
+//
+// 'consecutiveRows' is true if 'rows' are consecutive and 'decoded' is flat.
+// The values are then copied from consecutive positions and the null flags
+// are set only for the null rows, which are found a word of null bits at a
+// time.
 template <TypeKind kind>
 void serializeTyped(
     const raw_vector<vector_size_t>& rows,
+    bool consecutiveRows,
     uint32_t childIdx,
     const DecodedVector& decoded,
-    size_t valueBytes,
+    size_t /* unused */,
     const raw_vector<uint8_t*>& nulls,
     char* buffer,
     std::vector<size_t>& offsets) {
-  const auto* rawData = decoded.data<char>();
+  using T = typename TypeTraits<kind>::NativeType;
+  const auto* rawData = decoded.data<T>();
+  if (consecutiveRows && !rows.empty()) {
+    const auto begin = rows[0];
+    const auto end = begin + rows.size();
+    // rawData can be null if all values are null.
+    if (rawData != nullptr) {
+      const auto* values = rawData + begin;
+      for (auto i = 0; i < rows.size(); ++i) {
+        ::memcpy(buffer + offsets[i], values + i, sizeof(T));
+      }
+    }
+    if (const auto* rawNulls = decoded.base()->rawNulls()) {
+      bits::forEachUnsetBit(rawNulls, begin, end, [&](auto row) {
+        const auto i = row - begin;
+        bits::setBit(nulls[i], childIdx, true);
+        ::memset(buffer + offsets[i], 0, sizeof(T));
+      });
+    }
+    for (auto i = 0; i < rows.size(); ++i) {
+      offsets[i] += sizeof(T);
+    }
+    return;
+  }
+
   if (!decoded.mayHaveNulls()) {
     for (auto i = 0; i < rows.size(); ++i) {
-      writeFixedWidth(
-          rawData, decoded.index(rows[i]), valueBytes, buffer, offsets[i]);
+      ::memcpy(
+          buffer + offsets[i], rawData + decoded.index(rows[i]), sizeof(T));
+      offsets[i] += sizeof(T);
     }
   } else {
     for (auto i = 0; i < rows.size(); ++i) {
       if (decoded.isNullAt(rows[i])) {
         bits::setBit(nulls[i], childIdx, true);
-        offsets[i] += valueBytes;
       } else {
-        writeFixedWidth(
-            rawData, decoded.index(rows[i]), valueBytes, buffer, offsets[i]);
+        ::memcpy(
+            buffer + offsets[i], rawData + decoded.index(rows[i]), sizeof(T));
       }
+      offsets[i] += sizeof(T);
     }
   }
 }
@@ -94,6 +115,7 @@ void serializeTyped(
 template <>
 void serializeTyped<TypeKind::UNKNOWN>(
     const raw_vector<vector_size_t>& rows,
+    bool /* unused */,
     uint32_t childIdx,
     const DecodedVector& /* unused */,
     size_t /* unused */,
@@ -108,6 +130,7 @@ void serializeTyped<TypeKind::UNKNOWN>(
 template <>
 void serializeTyped<TypeKind::BOOLEAN>(
     const raw_vector<vector_size_t>& rows,
+    bool /* unused */,
     uint32_t childIdx,
     const DecodedVector& decoded,
     size_t /* unused */,
@@ -135,6 +158,7 @@ void serializeTyped<TypeKind::BOOLEAN>(
 template <>
 void serializeTyped<TypeKind::TIMESTAMP>(
     const raw_vector<vector_size_t>& rows,
+    bool /* unused */,
     uint32_t childIdx,
     const DecodedVector& decoded,
     size_t /* unused */,
@@ -163,6 +187,7 @@ void serializeTyped<TypeKind::TIMESTAMP>(
 template <>
 void serializeTyped<TypeKind::VARCHAR>(
     const raw_vector<vector_size_t>& rows,
+    bool /* unused */,
     uint32_t childIdx,
     const DecodedVector& decoded,
     size_t valueBytes,
@@ -187,6 +212,7 @@ void serializeTyped<TypeKind::VARCHAR>(
 template <>
 void serializeTyped<TypeKind::VARBINARY>(
     const raw_vector<vector_size_t>& rows,
+    bool /* unused */,
     uint32_t childIdx,
     const DecodedVector& decoded,
     size_t valueBytes,
@@ -194,7 +220,7 @@ void serializeTyped<TypeKind::VARBINARY>(
     char* buffer,
     std::vector<size_t>& offsets) {
   serializeTyped<TypeKind::VARCHAR>(
-      rows, childIdx, decoded, valueBytes, nulls, buffer, offsets);
+      rows, false, childIdx, decoded, valueBytes, nulls, buffer, offsets);
 }
 } // namespace
 
@@ -394,6 +420,7 @@ void CompactRow::serializeRow(
       rows[i] = decoded_.index(offset + i);
     }
   }
+  const bool consecutiveRows = decoded_.isIdentityMapping();
 
   // After serializing each column, the 'offsets' are updated accordingly.
   std::vector<size_t> offsets(size);
@@ -414,6 +441,7 @@ void CompactRow::serializeRow(
           serializeTyped,
           child.typeKind_,
           rows,
+          consecutiveRows && child.decoded_.isIdentityMapping(),
           childIdx,
           child.decoded_,
           child.valueBytes_,
@@ -770,13 +798,31 @@ VectorPtr deserializeFixedWidth(
 
   const auto numRows = data.size();
   auto flatVector = BaseVector::create<FlatVector<T>>(type, numRows, pool);
-
   auto* rawNulls = nulls->as<uint64_t>();
-
-  for (auto i = 0; i < numRows; ++i) {
-    const bool isNull = bits::isBitNull(rawNulls, i);
-    readFixedWidthValue<T>(
-        isNull, data[i].data() + offsets[i], flatVector.get(), i);
+  const bool hasNulls = !bits::isAllSet(rawNulls, 0, numRows);
+
+  // Gathers the values into the values buffer. The values of the null rows
+  // are not read since the offsets of the null structs are not valid.
+  auto* rawValues = flatVector->mutableRawValues();
+  auto gather = [&](auto row) {
+    const auto* value = data[row].data() + offsets[row];
+    if constexpr (std::is_same_v<T, bool>) {
+      bits::setBit(reinterpret_cast<uint64_t*>(rawValues), row, *value != 0);
+    } else if constexpr (std::is_same_v<T, Timestamp>) {
+      int64_t micros;
+      ::memcpy(&micros, value, sizeof(int64_t));
+      rawValues[row] = Timestamp::fromMicros(micros);
+    } else {
+      ::memcpy(rawValues + row, value, sizeof(T));
+    }
+  };
+  if (hasNulls) {
+    bits::forEachSetBit(rawNulls, 0, numRows, gather);
+    ::memcpy(flatVector->mutableRawNulls(), rawNulls, bits::nbytes(numRows));
+  } else {
+    for (auto row = 0; row < numRows; ++row) {
+      gather(row);
+    }
   }
 
   return flatVector;
@@ -1175,25 +1221,34 @@ RowVectorPtr deserializeRows(
 
   auto* rawNulls = nulls != nullptr ? nulls->as<uint64_t>() : nullptr;
 
+  const size_t nullLength = bits::nbytes(numFields);
+
+  // The fields of a null struct are null. Otherwise, the null flags of a row
+  // are read a byte at a time and only the set flags are scattered to the
+  // fields.
   std::vector<BufferPtr> fieldNulls;
+  std::vector<uint64_t*> rawFieldNulls;
   fieldNulls.reserve(numFields);
+  rawFieldNulls.reserve(numFields);
   for (auto i = 0; i < numFields; ++i) {
     fieldNulls.emplace_back(allocateNulls(numRows, pool));
-    auto* rawFieldNulls = fieldNulls.back()->asMutable<uint8_t>();
-    for (auto row = 0; row < numRows; ++row) {
-      auto* serializedNulls = readNulls(data[row].data() + offsets[row]);
-      const auto isNull =
-          (rawNulls != nullptr && bits::isBitNull(rawNulls, row)) ||
-          bits::isBitSet(serializedNulls, i);
-      bits::setBit(rawFieldNulls, row, !isNull);
-    }
+    rawFieldNulls.push_back(fieldNulls.back()->asMutable<uint64_t>());
   }
-
-  const size_t nullLength = bits::nbytes(numFields);
   for (auto row = 0; row < numRows; ++row) {
     if (rawNulls != nullptr && bits::isBitNull(rawNulls, row)) {
+      for (auto i = 0; i < numFields; ++i) {
+        bits::setNull(rawFieldNulls[i], row);
+      }
       continue;
     }
+    auto* serializedNulls = readNulls(data[row].data() + offsets[row]);
+    for (auto byte = 0; byte < nullLength; ++byte) {
+      uint16_t flags = serializedNulls[byte];
+      while (flags != 0) {
+        const auto field = byte * 8 + bits::getAndClearLastSetBit(flags);
+        bits::setNull(rawFieldNulls[field], row);
+      }
+    }
     offsets[row] += nullLength;
   }
 
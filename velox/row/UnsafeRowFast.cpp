@@ -450,6 +450,26 @@ inline int32_t valueSize() {
   }
 }
 
+// Calls 'func' with the index of each non-null row. Copies the null flags to
+// 'vector' if there are nulls. The values of the null rows are not read, so
+// the loop over the rows without nulls has no per-row null check.
+template <typename Func>
+void forEachNonNullRow(
+    const BufferPtr& nulls,
+    vector_size_t numRows,
+    BaseVector& vector,
+    Func func) {
+  const auto* rawNulls = nulls->as<uint64_t>();
+  if (bits::isAllSet(rawNulls, 0, numRows)) {
+    for (auto row = 0; row < numRows; ++row) {
+      func(row);
+    }
+    return;
+  }
+  bits::forEachSetBit(rawNulls, 0, numRows, func);
+  ::memcpy(vector.mutableRawNulls(), rawNulls, bits::nbytes(numRows));
+}
+
 // Deserializes one fixed-width value from each 'row' in 'data'.
 // Each value starts at data[row] + offsets[row].
 // Advances the offsets past the fixed field width.
@@ -466,43 +486,20 @@ VectorPtr deserializeFixedWidth(
 
   const auto numRows = data.size();
   auto flatVector = BaseVector::create<FlatVector<T>>(type, numRows, pool);
-  auto rawValues = flatVector->mutableRawValues();
-  auto* rawNulls = nulls->as<uint64_t>();
-
-  for (auto i = 0; i < numRows; ++i) {
-    const bool isNull = bits::isBitNull(rawNulls, i);
-    if (isNull) {
-      flatVector->setNull(i, true);
-    } else {
-      readFixedWidthValue<T>(data[i] + offsets[i], rawValues, i);
-    }
-    offsets[i] += kFieldWidth;
+  // One pass over the column gathers the values from their 8-byte slots.
+  if constexpr (std::is_same_v<T, bool>) {
+    auto* rawValues = flatVector->template mutableRawValues<uint64_t>();
+    forEachNonNullRow(nulls, numRows, *flatVector, [&](auto row) {
+      bits::setBit(rawValues, row, data[row][offsets[row]] != 0);
+    });
+  } else {
+    auto* rawValues = flatVector->mutableRawValues();
+    forEachNonNullRow(nulls, numRows, *flatVector, [&](auto row) {
+      readFixedWidthValue<T>(data[row] + offsets[row], rawValues, row);
+    });
   }
-
-  return flatVector;
-}
-
-template <>
-VectorPtr deserializeFixedWidth<TypeKind::BOOLEAN>(
-    const TypePtr& type,
-    const std::vector<char*>& data,
-    const BufferPtr& nulls,
-    std::vector<size_t>& offsets,
-    memory::MemoryPool* pool) {
-  const auto numRows = data.size();
-  auto flatVector = BaseVector::create<FlatVector<bool>>(type, numRows, pool);
-  auto rawValues = flatVector->mutableRawValues<uint64_t>();
-  auto* rawNulls = nulls->as<uint64_t>();
-
-  for (auto i = 0; i < numRows; ++i) {
-    const bool isNull = bits::isBitNull(rawNulls, i);
-    if (isNull) {
-      flatVector->setNull(i, true);
-    } else {
-      bool value = reinterpret_cast<const bool*>(data[i] + offsets[i])[0];
-      bits::setBit(rawValues, i, value);
-    }
-    offsets[i] += kFieldWidth;
+  for (auto row = 0; row < numRows; ++row) {
+    offsets[row] += kFieldWidth;
   }
 
   return flatVector;
@@ -650,6 +647,9 @@ VectorPtr deserializeUnknowns(
 // String format is:
 // <string size and offset> |...| <string bytes>
 // Advances the offsets past the fixed field width.
+//
+// The strings that are not inlined are copied to a single string buffer that
+// is sized by a first pass over the lengths.
 VectorPtr deserializeStrings(
     const TypePtr& type,
     const std::vector<char*>& data,
@@ -660,15 +660,41 @@ VectorPtr deserializeStrings(
   auto flatVector =
       BaseVector::create<FlatVector<StringView>>(type, numRows, pool);
 
-  auto* rawNulls = nulls->as<uint64_t>();
+  size_t totalBytes = 0;
+  forEachNonNullRow(nulls, numRows, *flatVector, [&](auto row) {
+    const auto size = readInt32(data[row] + offsets[row]);
+    if (!StringView::isInline(size)) {
+      totalBytes += size;
+    }
+  });
 
-  for (auto i = 0; i < numRows; ++i) {
-    if (bits::isBitNull(rawNulls, i)) {
-      flatVector->setNull(i, true);
+  char* rawBuffer = nullptr;
+  if (totalBytes > 0) {
+    rawBuffer = flatVector->getRawStringBufferWithSpace(totalBytes, true);
+  }
+  auto* rawValues = flatVector->mutableRawValues();
+  const auto* rawNulls = nulls->as<uint64_t>();
+  auto read = [&](auto row) {
+    const auto* sizeAndOffset = readInt32Ptr(data[row] + offsets[row]);
+    const auto size = sizeAndOffset[0];
+    const auto* value = data[row] + sizeAndOffset[1];
+    if (StringView::isInline(size)) {
+      rawValues[row] = StringView(value, size);
     } else {
-      readString(data[i] + offsets[i], data[i], flatVector.get(), i);
+      ::memcpy(rawBuffer, value, size);
+      rawValues[row] = StringView(rawBuffer, size);
+      rawBuffer += size;
     }
-    offsets[i] += kFieldWidth;
+  };
+  if (flatVector->rawNulls() == nullptr) {
+    for (auto row = 0; row < numRows; ++row) {
+      read(row);
+    }
+  } else {
+    bits::forEachSetBit(rawNulls, 0, numRows, read);
+  }
+  for (auto row = 0; row < numRows; ++row) {
+    offsets[row] += kFieldWidth;
   }
 
   return flatVector;
@@ -1055,25 +1081,34 @@ RowVectorPtr deserializeRows(
 
   auto* rawNulls = nulls != nullptr ? nulls->as<uint64_t>() : nullptr;
 
+  const size_t nullLength = alignBits(numFields);
+
+  // The fields of a null struct are null. Otherwise, the null bit set of a
+  // row is read a word at a time and only the set bits are scattered to the
+  // fields.
   std::vector<BufferPtr> fieldNulls;
+  std::vector<uint64_t*> rawFieldNulls;
   fieldNulls.reserve(numFields);
+  rawFieldNulls.reserve(numFields);
   for (auto i = 0; i < numFields; ++i) {
     fieldNulls.emplace_back(allocateNulls(numRows, pool));
-    auto* rawFieldNulls = fieldNulls.back()->asMutable<uint8_t>();
-    for (auto row = 0; row < numRows; ++row) {
-      auto* serializedNulls = readNulls(data[row] + offsets[row]);
-      const auto isNull =
-          (rawNulls != nullptr && bits::isBitNull(rawNulls, row)) ||
-          bits::isBitSet(serializedNulls, i);
-      bits::setBit(rawFieldNulls, row, !isNull);
-    }
+    rawFieldNulls.push_back(fieldNulls.back()->asMutable<uint64_t>());
   }
-
-  const size_t nullLength = alignBits(numFields);
   for (auto row = 0; row < numRows; ++row) {
     if (rawNulls != nullptr && bits::isBitNull(rawNulls, row)) {
+      for (auto i = 0; i < numFields; ++i) {
+        bits::setNull(rawFieldNulls[i], row);
+      }
       continue;
     }
+    const auto* serializedNulls =
+        reinterpret_cast<const uint64_t*>(data[row] + offsets[row]);
+    for (auto word = 0; word < nullLength / sizeof(uint64_t); ++word) {
+      for (auto flags = serializedNulls[word]; flags != 0; flags &= flags - 1) {
+        const auto field = word * 64 + __builtin_ctzll(flags);
+        bits::setNull(rawFieldNulls[field], row);
+      }
+    }
     offsets[row] += nullLength;
   }
 
@@ -254,6 +254,15 @@ class SerializeBenchmark {
     benchmark.deserializeContainer(rowType); \
   }
 
+// Returns a row type of 'numColumns' columns of 'types' in round robin.
+RowTypePtr wideRowType(size_t numColumns, const std::vector<TypePtr>& types) {
+  std::vector<TypePtr> children;
+  for (auto i = 0; i < numColumns; ++i) {
+    children.push_back(types[i % types.size()]);
+  }
+  return ROW(std::move(children));
+}
+
 SERDE_BENCHMARKS(
     fixedWidth5,
     ROW({BIGINT(), DOUBLE(), BOOLEAN(), TINYINT(), REAL()}));
@@ -281,6 +290,14 @@ SERDE_BENCHMARKS(
         DOUBLE(), DOUBLE(), DOUBLE(), DOUBLE(), BIGINT(), BIGINT(),
     }));
 
+SERDE_BENCHMARKS(
+    fixedWidth100,
+    wideRowType(100, {BIGINT(), DOUBLE(), INTEGER(), BOOLEAN(), REAL()}));
+
+SERDE_BENCHMARKS(
+    mixed120,
+    wideRowType(120, {BIGINT(), VARCHAR(), DOUBLE(), TIMESTAMP()}));
+
 BENCHMARK(decimalsSerialize) {
   SerializeBenchmark benchmark;
   benchmark.serializeUnsafe(ROW({BIGINT(), DECIMAL(12, 2), DECIMAL(38, 18)}));
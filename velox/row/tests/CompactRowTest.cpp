@@ -524,6 +524,57 @@ TEST_F(CompactRowTest, row) {
   testRoundTrip(data);
 }
 
+TEST_F(CompactRowTest, wideRows) {
+  // Flat columns are serialized column-at-a-time. Dictionary encoded columns
+  // are serialized through the row indices.
+  const vector_size_t size = 1'000;
+  std::vector<VectorPtr> children;
+  for (auto i = 0; i < 130; ++i) {
+    VectorPtr child;
+    switch (i % 5) {
+      case 0:
+        child = makeFlatVector<int64_t>(
+            size, [&](auto row) { return row * i; }, nullEvery(7 + i % 3));
+        break;
+      case 1:
+        child =
+            makeFlatVector<double>(size, [](auto row) { return row / 3.0; });
+        break;
+      case 2:
+        child = makeFlatVector<int32_t>(
+            size, [&](auto row) { return row + i; }, nullEvery(64));
+        break;
+      case 3:
+        child = makeFlatVector<bool>(
+            size, [](auto row) { return row % 3 == 0; }, nullEvery(5));
+        break;
+      default:
+        child = wrapInDictionary(
+            makeIndicesInReverse(size),
+            makeFlatVector<int16_t>(
+                size, [](auto row) { return row % 100; }, nullEvery(9)));
+    }
+    children.push_back(std::move(child));
+  }
+  auto data = makeRowVector(children);
+  testRoundTrip(data);
+
+  // The range serialization writes the same bytes as the row-by-row one,
+  // i.e. zeros for the null values.
+  const auto rowSize = CompactRow::fixedRowSize(asRowType(data->type()));
+  ASSERT_TRUE(rowSize.has_value());
+  std::vector<char> rowByRow(rowSize.value() * size, 0);
+  std::vector<char> range(rowSize.value() * size, 0);
+  std::vector<size_t> offsets(size);
+  CompactRow row(data);
+  for (auto i = 0; i < size; ++i) {
+    offsets[i] = i * rowSize.value();
+    row.serialize(i, rowByRow.data() + offsets[i]);
+  }
+  row.serialize(0, size, offsets.data(), range.data());
+  ASSERT_EQ(rowByRow, range);
+}
+
 TEST_F(CompactRowTest, fuzz) {
   auto rowType = ROW({
       ROW({BIGINT(), VARCHAR(), DOUBLE()}),
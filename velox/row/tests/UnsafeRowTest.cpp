@@ -198,6 +198,59 @@ TEST_F(UnsafeRowTest, fuzz) {
   doFuzzTest(rowType);
 }
 
+TEST_F(UnsafeRowTest, wideRows) {
+  const vector_size_t size = 1'000;
+  std::vector<VectorPtr> children;
+  for (auto i = 0; i < 120; ++i) {
+    VectorPtr child;
+    switch (i % 4) {
+      case 0:
+        child = makeFlatVector<int64_t>(
+            size, [&](auto row) { return row * i; }, nullEvery(7 + i % 3));
+        break;
+      case 1:
+        child = makeFlatVector<bool>(
+            size, [](auto row) { return row % 3 == 0; }, nullEvery(5));
+        break;
+      case 2:
+        child = makeFlatVector<double>(
+            size, [](auto row) { return row / 3.0; }, nullEvery(64));
+        break;
+      default:
+        child = makeFlatVector<std::string>(
+            size,
+            [&](auto row) { return std::string(row % 30, 'a' + i % 26); },
+            nullEvery(11));
+    }
+    children.push_back(std::move(child));
+  }
+  children.push_back(makeRowVector(
+      {makeFlatVector<int32_t>(size, [](auto row) { return row; }),
+       makeFlatVector<std::string>(
+           size, [](auto row) { return std::string(row % 20, 'x'); })},
+      nullEvery(13)));
+  auto data = makeRowVector(children);
+  testRoundTrip(data);
+
+  // The deserialized strings do not refer to the serialized rows.
+  UnsafeRowFast row(data);
+  std::vector<char> buffer;
+  std::vector<size_t> offsets;
+  for (auto i = 0; i < size; ++i) {
+    offsets.push_back(buffer.size());
+    buffer.resize(buffer.size() + row.rowSize(i), 0);
+  }
+  std::vector<char*> serialized;
+  for (auto i = 0; i < size; ++i) {
+    serialized.push_back(buffer.data() + offsets[i]);
+    row.serialize(i, serialized.back());
+  }
+  auto copy = UnsafeRowFast::deserialize(
+      serialized, asRowType(data->type()), pool_.get());
+  std::fill(buffer.begin(), buffer.end(), 'z');
+  assertEqualVectors(data, copy);
+}
+
 TEST_F(UnsafeRowTest, nestedMaps) {
   auto innerMaps = makeRowVector(
       {makeNullableArrayVector<int64_t>({
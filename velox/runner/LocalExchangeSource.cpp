@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/runner/LocalExchangeSource.h"
+#include "velox/exec/OutputBufferManager.h"
+
+namespace facebook::velox::runner {
+namespace {
+
+class LocalExchangeSource : public exec::ExchangeSource {
+ public:
+  LocalExchangeSource(
+      const std::string& taskId,
+      int destination,
+      std::shared_ptr<exec::ExchangeQueue> queue,
+      memory::MemoryPool* pool)
+      : ExchangeSource(taskId, destination, std::move(queue), pool) {}
+
+  bool supportsMetrics() const override {
+    return true;
+  }
+
+  bool shouldRequestLocked() override {
+    if (atEnd_) {
+      return false;
+    }
+    return !requestPending_.exchange(true);
+  }
+
+  // The producer is in the same process, so the request completes when data
+  // or the end marker is produced. 'maxWait' is not enforced.
+  folly::SemiFuture<Response> request(
+      uint32_t maxBytes,
+      std::chrono::microseconds /*maxWait*/) override {
+    auto promise = VeloxPromise<Response>("LocalExchangeSource::request");
+    auto future = promise.getSemiFuture();
+    {
+      std::lock_guard<std::mutex> l(queue_->mutex());
+      promise_ = std::move(promise);
+    }
+
+    auto buffers = exec::OutputBufferManager::getInstanceRef();
+    VELOX_CHECK_NOT_NULL(buffers, "invalid OutputBufferManager");
+    VELOX_CHECK(requestPending_);
+    // Held by each page to keep the producer's memory alive.
+    auto producer = buffers->getBufferIfExists(remoteTaskId_);
+    if (producer == nullptr) {
+      queue_->setError(
+          fmt::format("Producer task {} not found", remoteTaskId_));
+      setRequestPromise();
+      return future;
+    }
+    auto requestedSequence = sequence_;
+    auto self = shared_from_this();
+    auto resultCallback = [self, requestedSequence, buffers, producer, this](
+                              std::vector<std::unique_ptr<folly::IOBuf>> data,
+                              int64_t sequence,
+                              std::vector<int64_t> remainingBytes) {
+      if (requestedSequence > sequence && !data.empty()) {
+        int64_t nExtra = requestedSequence - sequence;
+        VELOX_CHECK(nExtra < data.size());
+        data.erase(data.begin(), data.begin() + nExtra);
+        sequence = requestedSequence;
+      }
+      std::vector<std::unique_ptr<exec::SerializedPage>> pages;
+      bool atEnd = false;
+      int64_t totalBytes = 0;
+      for (auto& inputPage : data) {
+        if (!inputPage) {
+          atEnd = true;
+          // Keep looping, there could be extra end markers.
+          continue;
+        }
+        totalBytes += inputPage->computeChainDataLength();
+        // The IOBuf shares the producer's buffer instead of copying it.
+        pages.push_back(std::make_unique<exec::SerializedPage>(
+            std::move(inputPage), [producer](folly::IOBuf& /*iobuf*/) {}));
+      }
+      numPages_ += pages.size();
+      totalBytes_ += totalBytes;
+
+      VeloxPromise<Response> requestPromise;
+      {
+        std::vector<ContinuePromise> queuePromises;
+        {
+          std::lock_guard<std::mutex> l(queue_->mutex());
+          requestPending_ = false;
+          requestPromise = std::move(promise_);
+          for (auto& page : pages) {
+            queue_->enqueueLocked(std::move(page), queuePromises);
+          }
+          if (atEnd) {
+            queue_->enqueueLocked(nullptr, queuePromises);
+            atEnd_ = true;
+          }
+          if (!data.empty()) {
+            sequence_ = sequence + pages.size();
+          }
+        }
+        for (auto& promise : queuePromises) {
+          promise.setValue();
+        }
+      }
+      // Outside of queue mutex.
+      if (atEnd_) {
+        buffers->deleteResults(remoteTaskId_, destination_);
+      }
+
+      if (requestPromise.valid() && !requestPromise.isFulfilled()) {
+        requestPromise.setValue(Response{totalBytes, atEnd_, remainingBytes});
+      }
+    };
+
+    buffers->getData(
+        remoteTaskId_, destination_, maxBytes, sequence_, resultCallback);
+    return future;
+  }
+
+  folly::SemiFuture<Response> requestDataSizes(
+      std::chrono::microseconds maxWait) override {
+    return request(0, maxWait);
+  }
+
+  void pause() override {
+    auto buffers = exec::OutputBufferManager::getInstanceRef();
+    VELOX_CHECK_NOT_NULL(buffers, "invalid OutputBufferManager");
+    int64_t ackSequence;
+    {
+      std::lock_guard<std::mutex> l(queue_->mutex());
+      ackSequence = sequence_;
+    }
+    buffers->acknowledge(remoteTaskId_, destination_, ackSequence);
+  }
+
+  void close() override {
+    setRequestPromise();
+    auto buffers = exec::OutputBufferManager::getInstanceRef();
+    buffers->deleteResults(remoteTaskId_, destination_);
+  }
+
+  folly::F14FastMap<std::string, RuntimeMetric> metrics() const override {
+    return {
+        {"localExchangeSource.numPages", RuntimeMetric(numPages_)},
+        {"localExchangeSource.totalBytes",
+         RuntimeMetric(totalBytes_, RuntimeCounter::Unit::kBytes)},
+    };
+  }
+
+ private:
+  // Completes a pending request with no data.
+  void setRequestPromise() {
+    VeloxPromise<Response> promise;
+    {
+      std::lock_guard<std::mutex> l(queue_->mutex());
+      requestPending_ = false;
+      promise = std::move(promise_);
+    }
+    if (promise.valid() && !promise.isFulfilled()) {
+      promise.setValue(Response{0, false, {}});
+    }
+  }
+
+  std::atomic<int64_t> numPages_{0};
+  std::atomic<uint64_t> totalBytes_{0};
+  VeloxPromise<Response> promise_{VeloxPromise<Response>::makeEmpty()};
+};
+} // namespace
+
+std::unique_ptr<exec::ExchangeSource> createLocalExchangeSource(
+    const std::string& taskId,
+    int destination,
+    std::shared_ptr<exec::ExchangeQueue> queue,
+    memory::MemoryPool* pool) {
+  if (strncmp(taskId.c_str(), "local://", 8) == 0) {
+    return std::make_unique<LocalExchangeSource>(
+        taskId, destination, std::move(queue), pool);
+  }
+  return nullptr;
+}
+
+void registerLocalExchangeSource() {
+  static std::once_flag once;
+  std::call_once(once, []() {
+    exec::ExchangeSource::registerFactory(createLocalExchangeSource);
+  });
+}
+
+} // namespace facebook::velox::runner
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/exec/Exchange.h"
+
+namespace facebook::velox::runner {
+
+/// Returns an ExchangeSource that reads pages directly from the
+/// OutputBufferManager of this process if 'taskId' starts with local://.
+/// Returns nullptr otherwise. The pages are handed to the consumer without
+/// copying. Each page keeps the producer's OutputBuffer, and with it the
+/// producer Task and its memory pools, alive until the page is freed.
+std::unique_ptr<exec::ExchangeSource> createLocalExchangeSource(
+    const std::string& taskId,
+    int destination,
+    std::shared_ptr<exec::ExchangeQueue> queue,
+    memory::MemoryPool* pool);
+
+/// Registers createLocalExchangeSource() as an ExchangeSource factory. Safe to
+/// call more than once.
+void registerLocalExchangeSource();
+
+} // namespace facebook::velox::runner
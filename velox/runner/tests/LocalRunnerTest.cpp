@@ -200,6 +200,35 @@ TEST_F(LocalRunnerTest, scan) {
   checkScanCount("s2", 3);
 }
 
+TEST_F(LocalRunnerTest, localExchangeSource) {
+  auto scan = makeScanPlan("e1", 3);
+  auto rootPool = makeRootPool("e1");
+  auto splitSourceFactory = makeSimpleSplitSourceFactory(scan);
+  auto localRunner = std::make_shared<LocalRunner>(
+      std::move(scan), makeQueryCtx("e1", rootPool.get()), splitSourceFactory);
+  auto results = readCursor(localRunner);
+  int32_t count = 0;
+  for (auto& rows : results) {
+    count += rows->size();
+  }
+  EXPECT_EQ(kNumRows, count);
+
+  // The gather stage reads the pages of the scan stage through
+  // runner::LocalExchangeSource.
+  auto stats = localRunner->stats();
+  int64_t numPages = 0;
+  for (auto& pipeline : stats.back().pipelineStats) {
+    for (auto& op : pipeline.operatorStats) {
+      auto it = op.runtimeStats.find("localExchangeSource.numPages");
+      if (it != op.runtimeStats.end()) {
+        numPages += it->second.sum;
+      }
+    }
+  }
+  EXPECT_LT(0, numPages);
+  localRunner->waitForCompletion(kWaitTimeoutUs);
+}
+
 TEST_F(LocalRunnerTest, broadcast) {
   auto plan = makeJoinPlan("c0", true);
   const std::string id = "q1";
@@ -35,6 +35,48 @@ PrestoIterativeVectorSerializer::PrestoIterativeVectorSerializer(
     streams_.emplace_back(
         types[i], std::nullopt, std::nullopt, streamArena, numRows, opts);
   }
+  if (opts_.preserveConstants) {
+    constants_.resize(numTypes);
+  }
+}
+
+bool PrestoIterativeVectorSerializer::appendConstant(
+    int32_t column,
+    const VectorPtr& vector,
+    int32_t numNewRows,
+    Scratch& scratch) {
+  if (!opts_.preserveConstants) {
+    return false;
+  }
+  auto& stream = streams_[column];
+  auto& constant = constants_[column];
+  if (constant != nullptr) {
+    if (vector->isConstantEncoding() &&
+        constant->equalValueAt(vector.get(), 0, 0)) {
+      stream.appendNonNull(numNewRows);
+      return true;
+    }
+    // Rewrites the previous rows as flat.
+    const auto numPreviousRows = numRows_ - numNewRows;
+    stream.clear();
+    stream.flattenStream(vector, 0);
+    const IndexRange range{0, numPreviousRows};
+    serializeColumn(
+        BaseVector::wrapInConstant(numPreviousRows, 0, constant),
+        folly::Range(&range, 1),
+        &stream,
+        scratch);
+    constant = nullptr;
+    return false;
+  }
+  if (numRows_ != numNewRows || !vector->isConstantEncoding()) {
+    return false;
+  }
+  stream.makeConstantStream();
+  const IndexRange range{0, numNewRows};
+  serializeColumn(vector, folly::Range(&range, 1), &stream, scratch);
+  constant = vector;
+  return true;
 }
 
 void PrestoIterativeVectorSerializer::append(
@@ -47,7 +89,9 @@ void PrestoIterativeVectorSerializer::append(
   }
   numRows_ += numNewRows;
   for (int32_t i = 0; i < vector->childrenSize(); ++i) {
-    serializeColumn(vector->childAt(i), ranges, &streams_[i], scratch);
+    if (!appendConstant(i, vector->childAt(i), numNewRows, scratch)) {
+      serializeColumn(vector->childAt(i), ranges, &streams_[i], scratch);
+    }
   }
 }
 
@@ -61,7 +105,38 @@ void PrestoIterativeVectorSerializer::append(
   }
   numRows_ += numNewRows;
   for (int32_t i = 0; i < vector->childrenSize(); ++i) {
-    serializeColumn(vector->childAt(i), rows, &streams_[i], scratch);
+    if (!appendConstant(i, vector->childAt(i), numNewRows, scratch)) {
+      serializeColumn(vector->childAt(i), rows, &streams_[i], scratch);
+    }
+  }
+}
+
+void PrestoIterativeVectorSerializer::appendScatter(
+    const RowVectorPtr& vector,
+    folly::Range<IterativeVectorSerializer* const*> serializers,
+    folly::Range<const folly::Range<const vector_size_t*>*> rows,
+    Scratch& scratch) {
+  VELOX_CHECK_EQ(serializers.size(), rows.size());
+  std::vector<PrestoIterativeVectorSerializer*> targets;
+  targets.reserve(serializers.size());
+  for (auto i = 0; i < serializers.size(); ++i) {
+    auto* target =
+        dynamic_cast<PrestoIterativeVectorSerializer*>(serializers[i]);
+    VELOX_CHECK_NOT_NULL(target);
+    VELOX_CHECK_EQ(target->streams_.size(), vector->childrenSize());
+    target->numRows_ += rows[i].size();
+    targets.push_back(target);
+  }
+  // Serializes column by column so that each column is read once for all the
+  // targets.
+  for (int32_t column = 0; column < vector->childrenSize(); ++column) {
+    const auto& child = vector->childAt(column);
+    for (auto i = 0; i < targets.size(); ++i) {
+      if (!rows[i].empty() &&
+          !targets[i]->appendConstant(column, child, rows[i].size(), scratch)) {
+        serializeColumn(child, rows[i], &targets[i]->streams_[column], scratch);
+      }
+    }
   }
 }
 
@@ -142,8 +217,12 @@ PrestoIterativeVectorSerializer::runtimeStats() {
 
 void PrestoIterativeVectorSerializer::clear() {
   numRows_ = 0;
-  for (auto& stream : streams_) {
-    stream.clear();
+  for (auto i = 0; i < streams_.size(); ++i) {
+    streams_[i].clear();
+    if (!constants_.empty() && constants_[i] != nullptr) {
+      streams_[i].flattenStream(constants_[i], 0);
+      constants_[i] = nullptr;
+    }
   }
 }
 } // namespace facebook::velox::serializer::presto::detail
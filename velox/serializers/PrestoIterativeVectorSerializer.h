@@ -39,6 +39,12 @@ class PrestoIterativeVectorSerializer : public IterativeVectorSerializer {
       const folly::Range<const vector_size_t*>& rows,
       Scratch& scratch) override;
 
+  void appendScatter(
+      const RowVectorPtr& vector,
+      folly::Range<IterativeVectorSerializer* const*> serializers,
+      folly::Range<const folly::Range<const vector_size_t*>*> rows,
+      Scratch& scratch) override;
+
   size_t maxSerializedSize() const override;
 
   // The SerializedPage layout is:
@@ -51,12 +57,26 @@ class PrestoIterativeVectorSerializer : public IterativeVectorSerializer {
   void clear() override;
 
  private:
+  // Appends 'numNewRows' rows of 'vector' to the RLE stream of 'column' if
+  // 'vector' is constant and all the previous rows of the column have the
+  // same value. Returns false if the rows must be serialized as usual, after
+  // the previous rows of an RLE stream are rewritten as flat. 'numRows_'
+  // includes the new rows.
+  bool appendConstant(
+      int32_t column,
+      const VectorPtr& vector,
+      int32_t numNewRows,
+      Scratch& scratch);
+
   const PrestoVectorSerde::PrestoOptions opts_;
   StreamArena* const streamArena_;
   const std::unique_ptr<folly::compression::Codec> codec_;
 
   int32_t numRows_{0};
   std::vector<VectorStream, memory::StlAllocator<VectorStream>> streams_;
+  // The value of each column with an RLE stream if 'preserveConstants' is
+  // set, otherwise nullptr.
+  std::vector<VectorPtr> constants_;
 
   // Count of forthcoming compressions to skip.
   int32_t numCompressionToSkip_{0};
@@ -80,6 +80,25 @@ class PrestoVectorSerde : public VectorSerde {
     /// affect the encoding of the input vectors. This is only relevant when
     /// using BatchVectorSerializer.
     bool preserveEncodings{false};
+
+    /// If true, a column that has the same constant value in all the rows
+    /// appended to an IterativeVectorSerializer is serialized as RLE instead
+    /// of repeating the value for each row, e.g. the partition keys of a
+    /// table scan. The rows are serialized as flat as soon as the column gets
+    /// another value.
+    bool preserveConstants{false};
+
+    /// If true, flat INTEGER, BIGINT and millisecond TIMESTAMP columns are
+    /// serialized as frame of reference or delta bit packed values when that
+    /// takes at most 3/4 of the flat size. Only Velox can read these pages.
+    bool lightweightEncodings{false};
+
+    /// If set, a single contiguous buffer holding the serialized data being
+    /// deserialized. The values of flat vectors of fixed width types without
+    /// nulls and the strings of flat string vectors then reference this
+    /// buffer instead of being copied, which keeps the buffer alive for as
+    /// long as the vectors. Only used for deserialization.
+    BufferPtr zeroCopyBuffer;
   };
 
   PrestoVectorSerde() : VectorSerde(Kind::kPresto) {}
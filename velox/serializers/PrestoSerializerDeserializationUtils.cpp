@@ -62,6 +62,44 @@ bool hasNestedStructs(const std::vector<TypePtr>& types) {
   return false;
 }
 
+// Releaser of a BufferView over part of a zero copy buffer. Keeps the zero
+// copy buffer alive.
+class ZeroCopyReleaser {
+ public:
+  explicit ZeroCopyReleaser(BufferPtr buffer) : buffer_(std::move(buffer)) {}
+
+  void addRef() const {}
+
+  void release() const {}
+
+ private:
+  const BufferPtr buffer_;
+};
+
+// Returns a pointer to the next 'size' bytes of 'source' and skips them if
+// they are contiguous in 'opts.zeroCopyBuffer' and aligned to 'alignment'.
+// Returns nullptr and leaves 'source' unchanged otherwise.
+const char* tryZeroCopy(
+    ByteInputStream* source,
+    int64_t size,
+    size_t alignment,
+    const PrestoVectorSerde::PrestoOptions& opts) {
+  if (opts.zeroCopyBuffer == nullptr) {
+    return nullptr;
+  }
+  const auto position = source->tellp();
+  const auto view = source->nextView(size);
+  const auto* begin = opts.zeroCopyBuffer->as<char>();
+  const auto* end = begin + opts.zeroCopyBuffer->size();
+  if (static_cast<int64_t>(view.size()) == size && view.data() >= begin &&
+      view.data() + size <= end &&
+      reinterpret_cast<uintptr_t>(view.data()) % alignment == 0) {
+    return view.data();
+  }
+  source->seekp(position);
+  return nullptr;
+}
+
 // Reads nulls into 'scratch' and returns count of non-nulls. If 'copy' is
 // given, returns the null bits in 'copy'.
 vector_size_t valueCount(
@@ -213,6 +251,17 @@ void readDictionaryVectorStructNulls(
   source->skip(24);
 }
 
+void readBitPackedStructNulls(ByteInputStream* source, Scratch& scratch) {
+  const int32_t size = source->read<int32_t>();
+  const auto numValues = valueCount(source, size, scratch);
+  const auto kind = static_cast<BitPackingKind>(source->read<int8_t>());
+  const int32_t width = source->read<int8_t>();
+  source->skip(kind == BitPackingKind::kDelta ? 16 : 8);
+  const uint64_t numBits =
+      static_cast<uint64_t>(numBitPackedValues(kind, numValues)) * width;
+  source->skip((numBits + 7) / 8);
+}
+
 void checkTypeEncoding(std::string_view encoding, const TypePtr& type) {
   const auto kindEncoding = typeToEncodingName(type);
   VELOX_USER_CHECK(
@@ -262,6 +311,8 @@ void readStructNullsColumns(
     } else if (encoding == kDictionary) {
       readDictionaryVectorStructNulls(
           source, columnType, useLosslessTimestamp, scratch);
+    } else if (encoding == kBitPackedArray) {
+      readBitPackedStructNulls(source, scratch);
     } else {
       checkTypeEncoding(encoding, columnType);
       const auto it = readers.find(
@@ -751,6 +802,27 @@ void read(
         values);
     return;
   }
+  if constexpr (!std::is_same_v<T, bool> && !std::is_same_v<T, Timestamp>) {
+    // Without nulls the serialized values are laid out like the vector values
+    // and a vector that starts at the page can wrap them.
+    if (resultOffset == 0 && nullCount == 0) {
+      const auto numBytes = numNewValues * sizeof(T);
+      if (const auto* data =
+              tryZeroCopy(source, numBytes, alignof(T), opts)) {
+        result = std::make_shared<FlatVector<T>>(
+            pool,
+            type,
+            flatResult->nulls(),
+            numNewValues,
+            BufferView<ZeroCopyReleaser>::create(
+                reinterpret_cast<const uint8_t*>(data),
+                numBytes,
+                ZeroCopyReleaser(opts.zeroCopyBuffer)),
+            std::vector<BufferPtr>{});
+        return;
+      }
+    }
+  }
   readValues<T>(
       source,
       numNewValues,
@@ -800,12 +872,16 @@ void read<StringView>(
     return;
   }
 
-  auto* rawStrings =
-      flatResult->getRawStringBufferWithSpace(dataSize, true /*exactSize*/);
-
-  source->readBytes(rawStrings, dataSize);
+  const char* rawChars = tryZeroCopy(source, dataSize, 1, opts);
+  if (rawChars != nullptr) {
+    flatResult->addStringBuffer(opts.zeroCopyBuffer);
+  } else {
+    auto* rawStrings =
+        flatResult->getRawStringBufferWithSpace(dataSize, true /*exactSize*/);
+    source->readBytes(rawStrings, dataSize);
+    rawChars = rawStrings;
+  }
   int32_t previousOffset = 0;
-  auto rawChars = reinterpret_cast<char*>(rawStrings);
   for (int32_t i = 0; i < numNewValues; ++i) {
     int32_t offset = rawValues[resultOffset + i].size();
     rawValues[resultOffset + i] =
@@ -1180,6 +1256,145 @@ void readDictionaryVector(
   }
 }
 
+// Reads a BIT_PACKED_ARRAY of INTEGER, BIGINT or millisecond TIMESTAMP
+// values. See kBitPackedArray for the layout.
+template <typename T>
+void readBitPacked(
+    ByteInputStream* source,
+    const TypePtr& /*type*/,
+    vector_size_t resultOffset,
+    const uint64_t* incomingNulls,
+    int32_t numIncomingNulls,
+    velox::memory::MemoryPool* /*pool*/,
+    const PrestoVectorSerde::PrestoOptions& /*opts*/,
+    VectorPtr& result) {
+  const int32_t size = source->read<int32_t>();
+  const auto numNewValues = sizeWithIncomingNulls(size, numIncomingNulls);
+  result->resize(resultOffset + numNewValues);
+
+  auto* flatResult = result->asUnchecked<FlatVector<T>>();
+  const auto nullCount = readNulls(
+      source, size, resultOffset, incomingNulls, numIncomingNulls, *flatResult);
+
+  const auto kind = static_cast<BitPackingKind>(source->read<int8_t>());
+  const int32_t width = source->read<int8_t>();
+  VELOX_CHECK_LE(width, kMaxBitPackedWidth);
+  const auto base = source->read<int64_t>();
+  const auto minDelta =
+      kind == BitPackingKind::kDelta ? source->read<int64_t>() : 0;
+
+  // The packed values are copied with 8 bytes of padding so that each value
+  // can be extracted with a single unaligned load.
+  const auto numValues = numNewValues - nullCount;
+  const auto numPacked = numBitPackedValues(kind, numValues);
+  const uint64_t numBytes = (static_cast<uint64_t>(numPacked) * width + 7) / 8;
+  raw_vector<char> packed(numBytes + sizeof(uint64_t));
+  source->readBytes(packed.data(), numBytes);
+  std::memset(packed.data() + numBytes, 0, sizeof(uint64_t));
+  const uint64_t mask = bits::lowMask(width);
+  auto unpack = [&](int32_t index) {
+    const uint64_t bit = static_cast<uint64_t>(index) * width;
+    return (folly::loadUnaligned<uint64_t>(packed.data() + (bit >> 3)) >>
+            (bit & 7)) &
+        mask;
+  };
+  raw_vector<int64_t> values(numValues);
+  if (numValues > 0 && kind == BitPackingKind::kDelta) {
+    values[0] = base;
+    for (auto i = 1; i < numValues; ++i) {
+      values[i] = values[i - 1] + minDelta + unpack(i - 1);
+    }
+  } else {
+    for (auto i = 0; i < numValues; ++i) {
+      values[i] = base + unpack(i);
+    }
+  }
+
+  auto toValue = [](int64_t value) {
+    if constexpr (std::is_same_v<T, Timestamp>) {
+      return Timestamp::fromMillis(value);
+    } else {
+      return static_cast<T>(value);
+    }
+  };
+  auto* rawValues = flatResult->mutableRawValues();
+  if (nullCount == 0) {
+    for (auto i = 0; i < numValues; ++i) {
+      rawValues[resultOffset + i] = toValue(values[i]);
+    }
+    return;
+  }
+  int32_t toClear = resultOffset;
+  int32_t next = 0;
+  bits::forEachSetBit(
+      flatResult->rawNulls(),
+      resultOffset,
+      resultOffset + numNewValues,
+      [&](int32_t row) {
+        // Set the values between the last non-null and this to type default.
+        for (; toClear < row; ++toClear) {
+          rawValues[toClear] = T();
+        }
+        rawValues[row] = toValue(values[next++]);
+        toClear = row + 1;
+      });
+}
+
+void readBitPackedColumn(
+    ByteInputStream* source,
+    const TypePtr& type,
+    vector_size_t resultOffset,
+    const uint64_t* incomingNulls,
+    int32_t numIncomingNulls,
+    velox::memory::MemoryPool* pool,
+    const PrestoVectorSerde::PrestoOptions& opts,
+    VectorPtr& result) {
+  switch (type->kind()) {
+    case TypeKind::INTEGER:
+      readBitPacked<int32_t>(
+          source,
+          type,
+          resultOffset,
+          incomingNulls,
+          numIncomingNulls,
+          pool,
+          opts,
+          result);
+      return;
+    case TypeKind::BIGINT:
+      readBitPacked<int64_t>(
+          source,
+          type,
+          resultOffset,
+          incomingNulls,
+          numIncomingNulls,
+          pool,
+          opts,
+          result);
+      return;
+    case TypeKind::TIMESTAMP:
+      VELOX_USER_CHECK(
+          !opts.useLosslessTimestamp,
+          "{} of lossless timestamps is not supported",
+          kBitPackedArray);
+      readBitPacked<Timestamp>(
+          source,
+          type,
+          resultOffset,
+          incomingNulls,
+          numIncomingNulls,
+          pool,
+          opts,
+          result);
+      return;
+    default:
+      VELOX_USER_FAIL(
+          "Serialized encoding is not compatible with requested type: {}. Got {}.",
+          type->kindName(),
+          kBitPackedArray);
+  }
+}
+
 // This is used when there's a mismatch between the encoding in the serialized
 // page and the expected output encoding. If the serialized encoding is
 // BYTE_ARRAY, it may represent an all-null vector of the expected output type.
@@ -1293,6 +1508,22 @@ void readColumns(
           pool,
           opts,
           columnResult);
+    } else if (encoding == kBitPackedArray) {
+      if (columnResult != nullptr &&
+          (columnResult->encoding() == VectorEncoding::Simple::CONSTANT ||
+           columnResult->encoding() == VectorEncoding::Simple::DICTIONARY)) {
+        BaseVector::ensureWritable(
+            SelectivityVector::empty(), types[i], pool, columnResult);
+      }
+      readBitPackedColumn(
+          source,
+          columnType,
+          resultOffset,
+          incomingNulls,
+          numIncomingNulls,
+          pool,
+          opts,
+          columnResult);
     } else {
       auto typeToEncoding = typeToEncodingName(columnType);
       if (encoding != typeToEncoding) {
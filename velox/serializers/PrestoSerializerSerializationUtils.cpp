@@ -16,6 +16,8 @@
 
 #include "velox/serializers/PrestoSerializerSerializationUtils.h"
 
+#include "velox/serializers/PrestoSerializerEstimationUtils.h"
+
 #include "velox/vector/BiasVector.h"
 #include "velox/vector/DictionaryVector.h"
 #include "velox/vector/FlatVector.h"
@@ -224,6 +226,51 @@ void serializeConstantVectorRanges(
   }
 }
 
+// Returns true if the rows in 'ranges' of 'dictionaryVector' are estimated to
+// serialize smaller as a dictionary of the 'numUsed' values at 'usedIndices'
+// than flat.
+template <TypeKind Kind>
+bool isDictionarySmaller(
+    const DictionaryVector<typename KindToFlatVector<Kind>::WrapperType>*
+        dictionaryVector,
+    const folly::Range<const IndexRange*>& ranges,
+    const vector_size_t* usedIndices,
+    vector_size_t numUsed,
+    vector_size_t numRows,
+    Scratch& scratch) {
+  // If every element is unique the dictionary isn't giving us any benefit.
+  if (numUsed == numRows) {
+    return false;
+  }
+  if constexpr (TypeTraits<Kind>::isFixedWidth) {
+    // This calculation admittdely ignores some constants, but if they really
+    // make a difference, they're small so there's not much difference either
+    // way.
+    const auto valueBytes = dictionaryVector->type()->cppSizeInBytes();
+    return numUsed * valueBytes + numRows * sizeof(int32_t) <
+        numRows * valueBytes;
+  } else if constexpr (Kind == TypeKind::OPAQUE) {
+    // The serialized sizes of opaque values are not estimated.
+    return true;
+  } else {
+    // The sizes of variable width values, e.g. strings, depend on the values
+    // in use.
+    vector_size_t flatSize = 0;
+    std::vector<vector_size_t*> rangeSizes(ranges.size(), &flatSize);
+    estimateWrapperSerializedSize(
+        ranges, rangeSizes.data(), dictionaryVector, scratch);
+
+    vector_size_t dictionarySize = numRows * sizeof(int32_t);
+    std::vector<vector_size_t*> valueSizes(numUsed, &dictionarySize);
+    estimateSerializedSizeInt(
+        dictionaryVector->valueVector().get(),
+        folly::Range<const vector_size_t*>(usedIndices, numUsed),
+        valueSizes.data(),
+        scratch);
+    return dictionarySize < flatSize;
+  }
+}
+
 template <TypeKind Kind>
 void serializeDictionaryVectorRanges(
     const VectorPtr& vector,
@@ -255,31 +302,18 @@ void serializeDictionaryVectorRanges(
   auto numUsed = computeSelectedIndices(
       dictionaryVector, ranges, scratch, mutableSelectedIndices);
 
-  if (!stream->preserveEncodings()) {
-    // If the values are fixed width and we aren't getting enough reuse to
-    // justify the dictionary, flatten it. For variable width types, rather than
-    // iterate over them computing their size, we simply assume we'll get a
-    // benefit.
-    if constexpr (TypeTraits<Kind>::isFixedWidth) {
-      // This calculation admittdely ignores some constants, but if they really
-      // make a difference, they're small so there's not much difference either
-      // way.
-      if (numUsed * vector->type()->cppSizeInBytes() +
-              numRows * sizeof(int32_t) >=
-          numRows * vector->type()->cppSizeInBytes()) {
-        stream->flattenStream(vector, numRows);
-        serializeWrappedRanges(vector, ranges, stream, scratch);
-        return;
-      }
-    }
-
-    // If every element is unique the dictionary isn't giving us any benefit,
-    // flatten it.
-    if (numUsed == numRows) {
-      stream->flattenStream(vector, numRows);
-      serializeWrappedRanges(vector, ranges, stream, scratch);
-      return;
-    }
+  // Flatten the dictionary unless we're getting enough reuse to justify it.
+  if (!stream->preserveEncodings() &&
+      !isDictionarySmaller<Kind>(
+          dictionaryVector,
+          ranges,
+          mutableSelectedIndices,
+          numUsed,
+          numRows,
+          scratch)) {
+    stream->flattenStream(vector, numRows);
+    serializeWrappedRanges(vector, ranges, stream, scratch);
+    return;
   }
 
   // Serialize the used elements from the Dictionary.
@@ -55,6 +55,25 @@ static inline const std::string_view kRow{"ROW"};
 static inline const std::string_view kRLE{"RLE"};
 static inline const std::string_view kDictionary{"DICTIONARY"};
 
+// Velox only encoding of INTEGER, BIGINT and millisecond TIMESTAMP values
+// written with PrestoOptions::lightweightEncodings. The layout is:
+// + number of rows (4 bytes)
+// + nulls, like for the flat encodings
+// + BitPackingKind (1 byte)
+// + bit width of the packed values (1 byte)
+// + base (8 bytes): the minimum value for kFrameOfReference, the first value
+//   for kDelta
+// + minimum delta between consecutive values (8 bytes), only for kDelta
+// + the non-null values minus the base, or the deltas minus the minimum
+//   delta, packed in 'bit width' bits each, low bits first
+static inline const std::string_view kBitPackedArray{"BIT_PACKED_ARRAY"};
+
+enum class BitPackingKind : int8_t { kFrameOfReference = 0, kDelta = 1 };
+
+// The largest bit width of a BIT_PACKED_ARRAY. Each value is then within a
+// single unaligned 64 bit load.
+constexpr int32_t kMaxBitPackedWidth{56};
+
 void initBitsToMapOnce();
 
 FOLLY_ALWAYS_INLINE std::array<int8_t, ipaddress::kIPPrefixBytes>
@@ -100,6 +119,15 @@ inline void writeInt64(OutputStream* out, int64_t value) {
   out->write(reinterpret_cast<char*>(&value), sizeof(value));
 }
 
+// Returns the number of packed values of a BIT_PACKED_ARRAY of 'numValues'
+// non-null values.
+inline int32_t numBitPackedValues(BitPackingKind kind, int32_t numValues) {
+  if (kind == BitPackingKind::kDelta) {
+    return std::max<int32_t>(numValues - 1, 0);
+  }
+  return numValues;
+}
+
 std::string_view typeToEncodingName(const TypePtr& type);
 
 inline int32_t rangesTotalSize(const folly::Range<const IndexRange*>& ranges) {
@@ -103,6 +103,8 @@ Status PrestoVectorLexer::lexColumn() {
     VELOX_RETURN_NOT_OK(lexFixedArray<int128_t>(TokenType::INT128_ARRAY));
   } else if (encoding == kVariableWidth) {
     VELOX_RETURN_NOT_OK(lexVariableWidth());
+  } else if (encoding == kBitPackedArray) {
+    VELOX_RETURN_NOT_OK(lexBitPackedArray());
   } else if (encoding == kArray) {
     VELOX_RETURN_NOT_OK(lexArray());
   } else if (encoding == kMap) {
@@ -132,6 +134,33 @@ Status PrestoVectorLexer::lexVariableWidth() {
   return Status::OK();
 }
 
+Status PrestoVectorLexer::lexBitPackedArray() {
+  int32_t numValues;
+  VELOX_RETURN_NOT_OK(lexInt(TokenType::NUM_ROWS, &numValues));
+  VELOX_RETURN_NOT_OK(lexNulls(numValues));
+  int8_t kind;
+  VELOX_RETURN_NOT_OK(lexInt(TokenType::BIT_PACKING_HEADER, &kind));
+  int8_t width;
+  VELOX_RETURN_NOT_OK(lexInt(TokenType::BIT_PACKING_HEADER, &width));
+  VELOX_RETURN_IF(
+      width < 0 || width > kMaxBitPackedWidth,
+      Status::Invalid("Invalid bit width: {}", width));
+  const auto packingKind = static_cast<BitPackingKind>(kind);
+  VELOX_RETURN_IF(
+      packingKind != BitPackingKind::kFrameOfReference &&
+          packingKind != BitPackingKind::kDelta,
+      Status::Invalid("Invalid bit packing kind: {}", kind));
+  VELOX_RETURN_NOT_OK(lexInt<int64_t>(TokenType::BIT_PACKING_HEADER));
+  if (packingKind == BitPackingKind::kDelta) {
+    VELOX_RETURN_NOT_OK(lexInt<int64_t>(TokenType::BIT_PACKING_HEADER));
+  }
+  const int64_t numBits =
+      static_cast<int64_t>(numBitPackedValues(packingKind, numValues)) * width;
+  VELOX_RETURN_NOT_OK(
+      lexBytes((numBits + 7) / 8, TokenType::BIT_PACKED_ARRAY));
+  return Status::OK();
+}
+
 Status PrestoVectorLexer::lexArray() {
   VELOX_RETURN_NOT_OK(lexColumn());
   int32_t numRows;
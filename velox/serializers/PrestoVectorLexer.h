@@ -38,6 +38,8 @@ enum class TokenType {
   HASH_TABLE,
   NUM_FIELDS,
   OFFSETS,
+  BIT_PACKING_HEADER,
+  BIT_PACKED_ARRAY,
 };
 
 struct Token {
@@ -70,6 +72,7 @@ class PrestoVectorLexer {
   }
 
   Status lexVariableWidth();
+  Status lexBitPackedArray();
   Status lexArray();
   Status lexMap();
   Status lexRow();
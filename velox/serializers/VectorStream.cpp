@@ -55,6 +55,13 @@ raw_vector<uint64_t>& threadTempNulls() {
   thread_local raw_vector<uint64_t> temp;
   return temp;
 }
+
+// A stream needs at least this many non-null values to be bit packed.
+constexpr int32_t kMinBitPackedValues{16};
+
+int32_t bitWidth(uint64_t range) {
+  return range == 0 ? 0 : 64 - __builtin_clzll(range);
+}
 } // namespace
 
 VectorStream::VectorStream(
@@ -205,7 +212,29 @@ void VectorStream::flattenStream(
   initializeFlatStream(vector, initialNumRows);
 }
 
+void VectorStream::makeConstantStream() {
+  VELOX_CHECK_EQ(nullCount_, 0);
+  VELOX_CHECK_EQ(nonNullCount_, 0);
+  VELOX_CHECK_EQ(totalLength_, 0);
+
+  if (isConstantStream_) {
+    return;
+  }
+
+  encoding_ = VectorEncoding::Simple::CONSTANT;
+  isConstantStream_ = true;
+  isDictionaryStream_ = false;
+  children_.clear();
+
+  initializeHeader(kRLE, *streamArena_);
+  children_.emplace_back(
+      type_, std::nullopt, std::nullopt, streamArena_, 1, opts_);
+}
+
 void VectorStream::flush(OutputStream* out) {
+  if (canBitPack() && flushBitPacked(out)) {
+    return;
+  }
   out->write(reinterpret_cast<char*>(header_.buffer), header_.size);
 
   if (encoding_.has_value()) {
@@ -295,6 +324,110 @@ void VectorStream::flush(OutputStream* out) {
   }
 }
 
+bool VectorStream::canBitPack() const {
+  if (!opts_.lightweightEncodings || isConstantStream_ ||
+      isDictionaryStream_ || nonNullCount_ < kMinBitPackedValues) {
+    return false;
+  }
+  switch (type_->kind()) {
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+      return true;
+    case TypeKind::TIMESTAMP:
+      return !opts_.useLosslessTimestamp;
+    default:
+      return false;
+  }
+}
+
+bool VectorStream::flushBitPacked(OutputStream* out) {
+  const int32_t numValues = nonNullCount_;
+  thread_local raw_vector<int64_t> values;
+  values.resize(numValues);
+  auto input = values_.inputStream();
+  if (type_->kind() == TypeKind::INTEGER) {
+    for (auto i = 0; i < numValues; ++i) {
+      values[i] = input->read<int32_t>();
+    }
+  } else {
+    for (auto i = 0; i < numValues; ++i) {
+      values[i] = input->read<int64_t>();
+    }
+  }
+
+  // Picks frame of reference or delta, whichever packs in fewer bits.
+  int64_t min = values[0];
+  int64_t max = values[0];
+  for (auto i = 1; i < numValues; ++i) {
+    min = std::min(min, values[i]);
+    max = std::max(max, values[i]);
+  }
+  const uint64_t range =
+      static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+  auto kind = BitPackingKind::kFrameOfReference;
+  auto width = bitWidth(range);
+  int64_t base = min;
+  int64_t minDelta = 0;
+  // The deltas are within [-range, range] and do not overflow.
+  if (width > 0 && range < (1ULL << 62)) {
+    minDelta = std::numeric_limits<int64_t>::max();
+    int64_t maxDelta = std::numeric_limits<int64_t>::min();
+    for (auto i = 1; i < numValues; ++i) {
+      const auto delta = values[i] - values[i - 1];
+      minDelta = std::min(minDelta, delta);
+      maxDelta = std::max(maxDelta, delta);
+    }
+    const auto deltaWidth = bitWidth(maxDelta - minDelta);
+    if (deltaWidth < width) {
+      kind = BitPackingKind::kDelta;
+      width = deltaWidth;
+      base = values[0];
+    }
+  }
+  const int32_t valueBits = type_->kind() == TypeKind::INTEGER ? 32 : 64;
+  if (width * 4 > valueBits * 3) {
+    return false;
+  }
+  VELOX_DCHECK_LE(width, kMaxBitPackedWidth);
+
+  writeInt32(out, kBitPackedArray.size());
+  out->write(kBitPackedArray.data(), kBitPackedArray.size());
+  writeInt32(out, nullCount_ + nonNullCount_);
+  flushNulls(out);
+  const char packingHeader[2] = {
+      static_cast<char>(kind), static_cast<char>(width)};
+  out->write(packingHeader, sizeof(packingHeader));
+  writeInt64(out, base);
+  if (kind == BitPackingKind::kDelta) {
+    writeInt64(out, minDelta);
+  }
+
+  const auto numPacked = numBitPackedValues(kind, numValues);
+  const uint64_t numBits = static_cast<uint64_t>(numPacked) * width;
+  thread_local raw_vector<uint64_t> words;
+  words.resize(numBits / 64 + 1);
+  std::memset(words.data(), 0, words.size() * sizeof(uint64_t));
+  auto pack = [&](int32_t index, uint64_t value) {
+    const uint64_t bit = static_cast<uint64_t>(index) * width;
+    const auto shift = bit & 63;
+    words[bit >> 6] |= value << shift;
+    if (shift + width > 64) {
+      words[(bit >> 6) + 1] |= value >> (64 - shift);
+    }
+  };
+  if (kind == BitPackingKind::kDelta) {
+    for (auto i = 0; i < numPacked; ++i) {
+      pack(i, values[i + 1] - values[i] - minDelta);
+    }
+  } else {
+    for (auto i = 0; i < numPacked; ++i) {
+      pack(i, static_cast<uint64_t>(values[i]) - static_cast<uint64_t>(base));
+    }
+  }
+  out->write(reinterpret_cast<const char*>(words.data()), (numBits + 7) / 8);
+  return true;
+}
+
 void VectorStream::flushNulls(OutputStream* out) {
   if (!nullCount_) {
     char zero = 0;
@@ -42,6 +42,9 @@ class VectorStream {
 
   void flattenStream(const VectorPtr& vector, int32_t initialNumRows);
 
+  /// Makes an empty stream an RLE stream of a single value.
+  void makeConstantStream();
+
   std::optional<VectorEncoding::Simple> getEncoding(
       std::optional<VectorEncoding::Simple> encoding,
       std::optional<VectorPtr> vector) {
@@ -204,6 +207,14 @@ class VectorStream {
       std::optional<VectorPtr> vector,
       vector_size_t initialNumRows);
 
+  // True if the stream is a flat INTEGER, BIGINT or millisecond TIMESTAMP
+  // stream that may be written as a BIT_PACKED_ARRAY.
+  bool canBitPack() const;
+
+  // Writes the stream as a BIT_PACKED_ARRAY if that takes at most 3/4 of the
+  // flat size. Returns false without writing otherwise.
+  bool flushBitPacked(OutputStream* out);
+
   const TypePtr type_;
   StreamArena* const streamArena_;
   const bool isLongDecimal_;
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <folly/Benchmark.h>
+#include <folly/Random.h>
+#include <folly/init/Init.h>
+
+#include "velox/serializers/PrestoSerializer.h"
+#include "velox/vector/FlatVector.h"
+
+// Compares the CPU time and the serialized size of Presto shuffle pages of
+// integer columns with lightweight encodings and with page compression.
+namespace facebook::velox::test {
+namespace {
+using serializer::presto::PrestoVectorSerde;
+
+class PrestoSerializerBenchmark {
+ public:
+  PrestoSerializerBenchmark() {
+    folly::Random::DefaultGenerator rng(1);
+    data_ = std::make_shared<RowVector>(
+        pool_.get(),
+        ROW({BIGINT(), INTEGER(), DATE(), TIMESTAMP(), BIGINT()}),
+        nullptr,
+        kNumRows,
+        std::vector<VectorPtr>{
+            // Increasing keys.
+            makeColumn<int64_t>(BIGINT(), [](auto row) { return row * 4 + 1; }),
+            // Small quantities.
+            makeColumn<int32_t>(
+                INTEGER(), [](auto row) { return 1 + (row * 7) % 50; }),
+            // Dates of a few years.
+            makeColumn<int32_t>(
+                DATE(), [](auto row) { return 8'000 + (row * 13) % 2'500; }),
+            // Event times in increasing order.
+            makeColumn<Timestamp>(
+                TIMESTAMP(),
+                [](auto row) {
+                  return Timestamp::fromMillis(1'700'000'000'000 + row * 37);
+                }),
+            // Random values that do not pack.
+            makeColumn<int64_t>(
+                BIGINT(),
+                [&](auto /*row*/) { return folly::Random::rand64(rng); }),
+        });
+  }
+
+  std::string serialize(const PrestoVectorSerde::PrestoOptions& options) {
+    auto serializer = serde_.createBatchSerializer(pool_.get(), &options);
+    std::stringstream stream;
+    OStreamOutputStream output(&stream);
+    serializer->serialize(data_, &output);
+    return stream.str();
+  }
+
+  void deserialize(
+      std::string& serialized,
+      const PrestoVectorSerde::PrestoOptions& options) {
+    BufferInputStream input({ByteRange{
+        reinterpret_cast<uint8_t*>(serialized.data()),
+        static_cast<int64_t>(serialized.size()),
+        0}});
+    RowVectorPtr result;
+    serde_.deserialize(
+        &input, pool_.get(), asRowType(data_->type()), &result, &options);
+    folly::doNotOptimizeAway(result);
+  }
+
+ private:
+  static constexpr vector_size_t kNumRows = 10'000;
+
+  template <typename T>
+  VectorPtr makeColumn(
+      const TypePtr& type,
+      const std::function<T(vector_size_t)>& valueAt) {
+    auto vector =
+        BaseVector::create<FlatVector<T>>(type, kNumRows, pool_.get());
+    for (auto row = 0; row < kNumRows; ++row) {
+      vector->set(row, valueAt(row));
+    }
+    return vector;
+  }
+
+  std::shared_ptr<memory::MemoryPool> pool_{
+      memory::memoryManager()->addLeafPool()};
+  PrestoVectorSerde serde_;
+  RowVectorPtr data_;
+};
+
+PrestoVectorSerde::PrestoOptions makeOptions(
+    common::CompressionKind compressionKind,
+    bool lightweightEncodings) {
+  PrestoVectorSerde::PrestoOptions options;
+  options.compressionKind = compressionKind;
+  options.lightweightEncodings = lightweightEncodings;
+  return options;
+}
+
+const std::vector<std::pair<std::string, PrestoVectorSerde::PrestoOptions>>&
+cases() {
+  static const std::vector<
+      std::pair<std::string, PrestoVectorSerde::PrestoOptions>>
+      kCases{
+          {"plain", makeOptions(common::CompressionKind_NONE, false)},
+          {"lightweight", makeOptions(common::CompressionKind_NONE, true)},
+          {"lz4", makeOptions(common::CompressionKind_LZ4, false)},
+          {"zstd", makeOptions(common::CompressionKind_ZSTD, false)},
+          {"lightweightLz4", makeOptions(common::CompressionKind_LZ4, true)},
+      };
+  return kCases;
+}
+
+void serializeCase(uint32_t iterations, size_t caseIndex) {
+  folly::BenchmarkSuspender suspender;
+  PrestoSerializerBenchmark benchmark;
+  const auto& options = cases()[caseIndex].second;
+  suspender.dismiss();
+
+  for (auto i = 0; i < iterations; ++i) {
+    folly::doNotOptimizeAway(benchmark.serialize(options));
+  }
+}
+
+void deserializeCase(uint32_t iterations, size_t caseIndex) {
+  folly::BenchmarkSuspender suspender;
+  PrestoSerializerBenchmark benchmark;
+  const auto& options = cases()[caseIndex].second;
+  auto serialized = benchmark.serialize(options);
+  suspender.dismiss();
+
+  for (auto i = 0; i < iterations; ++i) {
+    benchmark.deserialize(serialized, options);
+  }
+}
+
+void printSizes() {
+  PrestoSerializerBenchmark benchmark;
+  for (const auto& [name, options] : cases()) {
+    std::cout << name << ": " << benchmark.serialize(options).size()
+              << " bytes" << std::endl;
+  }
+}
+
+BENCHMARK_NAMED_PARAM(serializeCase, plain, 0);
+BENCHMARK_RELATIVE_NAMED_PARAM(serializeCase, lightweight, 1);
+BENCHMARK_RELATIVE_NAMED_PARAM(serializeCase, lz4, 2);
+BENCHMARK_RELATIVE_NAMED_PARAM(serializeCase, zstd, 3);
+BENCHMARK_RELATIVE_NAMED_PARAM(serializeCase, lightweightLz4, 4);
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(deserializeCase, plain, 0);
+BENCHMARK_RELATIVE_NAMED_PARAM(deserializeCase, lightweight, 1);
+BENCHMARK_RELATIVE_NAMED_PARAM(deserializeCase, lz4, 2);
+BENCHMARK_RELATIVE_NAMED_PARAM(deserializeCase, zstd, 3);
+BENCHMARK_RELATIVE_NAMED_PARAM(deserializeCase, lightweightLz4, 4);
+
+} // namespace
+} // namespace facebook::velox::test
+
+int main(int argc, char** argv) {
+  folly::Init init{&argc, &argv};
+  facebook::velox::memory::MemoryManager::initialize(
+      facebook::velox::memory::MemoryManager::Options{});
+  facebook::velox::test::printSizes();
+  folly::runBenchmarks();
+  return 0;
+}
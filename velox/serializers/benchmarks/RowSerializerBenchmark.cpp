@@ -31,26 +31,59 @@ class RowSerializerBenchmark {
     deregisterVectorSerde();
   }
 
+  void compactRowVectorDeserialize(const RowTypePtr& rowType) {
+    folly::BenchmarkSuspender suspender;
+    serializer::CompactRowVectorSerde::registerVectorSerde();
+    auto data = makeData(rowType);
+    auto serialized =
+        serialize(data, makeIndexRanges(data->size(), data->size()));
+    BufferInputStream input({ByteRange{
+        reinterpret_cast<uint8_t*>(serialized.data()),
+        static_cast<int64_t>(serialized.size()),
+        0}});
+    suspender.dismiss();
+
+    RowVectorPtr result;
+    getVectorSerde()->deserialize(&input, pool_.get(), rowType, &result);
+
+    suspender.rehire();
+    deregisterVectorSerde();
+  }
+
  private:
   void serialize(const RowTypePtr& rowType, vector_size_t rangeSize) {
     folly::BenchmarkSuspender suspender;
     auto data = makeData(rowType);
+    auto indexRanges = makeIndexRanges(data->size(), rangeSize);
+    suspender.dismiss();
+
+    serialize(data, indexRanges);
+  }
+
+  static std::vector<IndexRange> makeIndexRanges(
+      vector_size_t size,
+      vector_size_t rangeSize) {
     std::vector<IndexRange> indexRanges;
-    for (auto begin = 0; begin < data->size(); begin += rangeSize) {
+    for (auto begin = 0; begin < size; begin += rangeSize) {
       indexRanges.push_back(
-          IndexRange{begin, std::min(rangeSize, data->size() - begin)});
+          IndexRange{begin, std::min(rangeSize, size - begin)});
     }
-    suspender.dismiss();
+    return indexRanges;
+  }
 
+  std::string serialize(
+      const RowVectorPtr& data,
+      const std::vector<IndexRange>& indexRanges) {
     Scratch scratch;
     auto group = std::make_unique<VectorStreamGroup>(pool_.get(), nullptr);
-    group->createStreamTree(rowType, data->size());
+    group->createStreamTree(asRowType(data->type()), data->size());
     group->append(
         data, folly::Range(indexRanges.data(), indexRanges.size()), scratch);
 
     std::stringstream stream;
     OStreamOutputStream outputStream(&stream);
     group->flush(&outputStream);
+    return stream.str();
   }
 
   RowVectorPtr makeData(const RowTypePtr& rowType) {
@@ -83,8 +116,21 @@ class RowSerializerBenchmark {
   BENCHMARK(compact_serialize_1000_##name) {         \
     RowSerializerBenchmark benchmark;                \
     benchmark.compactRowVectorSerde(rowType, 1'000); \
+  }                                                  \
+  BENCHMARK(compact_deserialize_##name) {            \
+    RowSerializerBenchmark benchmark;                \
+    benchmark.compactRowVectorDeserialize(rowType);  \
   }
 
+// Returns a row type of 'numColumns' columns of 'types' in round robin.
+RowTypePtr wideRowType(size_t numColumns, const std::vector<TypePtr>& types) {
+  std::vector<TypePtr> children;
+  for (auto i = 0; i < numColumns; ++i) {
+    children.push_back(types[i % types.size()]);
+  }
+  return ROW(std::move(children));
+}
+
 VECTOR_SERDE_BENCHMARKS(
     fixedWidth5,
     ROW({BIGINT(), DOUBLE(), BOOLEAN(), TINYINT(), REAL()}));
@@ -112,6 +158,18 @@ VECTOR_SERDE_BENCHMARKS(
         DOUBLE(), DOUBLE(), DOUBLE(), DOUBLE(), BIGINT(), BIGINT(),
     }));
 
+VECTOR_SERDE_BENCHMARKS(
+    fixedWidth100,
+    wideRowType(100, {BIGINT(), DOUBLE(), INTEGER(), BOOLEAN(), REAL()}));
+
+VECTOR_SERDE_BENCHMARKS(
+    fixedWidth200,
+    wideRowType(200, {BIGINT(), DOUBLE(), INTEGER(), BOOLEAN(), REAL()}));
+
+VECTOR_SERDE_BENCHMARKS(
+    mixed120,
+    wideRowType(120, {BIGINT(), VARCHAR(), DOUBLE(), TIMESTAMP()}));
+
 VECTOR_SERDE_BENCHMARKS(
     decimal,
     ROW({BIGINT(), DECIMAL(12, 2), DECIMAL(38, 18)}));
@@ -16,6 +16,7 @@
 #include "velox/serializers/PrestoSerializer.h"
 #include <boost/random/uniform_int_distribution.hpp>
 #include <folly/Random.h>
+#include <folly/hash/Hash.h>
 #include <gtest/gtest.h>
 #include <vector>
 #include "folly/experimental/EventCount.h"
@@ -125,6 +126,8 @@ class PrestoSerializerTest
         serdeOptions == nullptr ? false : serdeOptions->preserveEncodings;
     serializer::presto::PrestoVectorSerde::PrestoOptions paramOptions{
         useLosslessTimestamp, kind, 0.8, nullsFirst, preserveEncodings};
+    paramOptions.lightweightEncodings =
+        serdeOptions == nullptr ? false : serdeOptions->lightweightEncodings;
 
     return paramOptions;
   }
@@ -581,10 +584,15 @@ class PrestoSerializerTest
   }
 
   RowVectorPtr encodingsTestVector() {
-    // String is variable length, so this ensures the data isn't flattened.
-    auto baseNoNulls = makeFlatVector<std::string>({"a", "b", "c", "d"});
+    // Long strings make the dictionary smaller than the flattened values, so
+    // this ensures the data isn't flattened.
+    const auto a = std::string(20, 'a');
+    const auto b = std::string(20, 'b');
+    const auto c = std::string(20, 'c');
+    const auto d = std::string(20, 'd');
+    auto baseNoNulls = makeFlatVector<std::string>({a, b, c, d});
     auto baseWithNulls =
-        makeNullableFlatVector<std::string>({"a", std::nullopt, "b", "c"});
+        makeNullableFlatVector<std::string>({a, std::nullopt, b, c});
     auto baseArray =
         makeArrayVector<int32_t>({{1, 2, 3}, {}, {4, 5}, {6, 7, 8, 9, 10}});
     auto indices = makeIndices(8, [](auto row) { return row / 2; });
@@ -740,9 +748,12 @@ class PrestoSerializerTest
     // This factor is used to ensure we have some repetition in the dictionary
     // in each of the cases to ensure the serializer doesn't flatten the data.
     auto factor = alphabetSize <= numRows ? 2 : alphabetSize / numRows * 2;
-    // String is variable length, so this ensures the data isn't flattened.
-    auto base = makeFlatVector<std::string>(
-        alphabetSize, [](vector_size_t row) { return fmt::format("{}", row); });
+    // Long strings make the dictionary smaller than the flattened values, so
+    // this ensures the data isn't flattened.
+    auto base =
+        makeFlatVector<std::string>(alphabetSize, [](vector_size_t row) {
+          return fmt::format("{}{}", std::string(20, 'x'), row);
+        });
     auto evenIndices = makeIndices(numRows, [alphabetSize, factor](auto row) {
       return (row * factor) % alphabetSize;
     });
@@ -976,6 +987,210 @@ TEST_P(PrestoSerializerTest, serializeNoRowsSelected) {
   assertEqualVectors(deserialized, expected);
 }
 
+TEST_P(PrestoSerializerTest, appendScatter) {
+  auto paramOptions = getParamSerdeOptions(nullptr);
+  auto rowVector = makeRowVector({
+      makeFlatVector<int64_t>(1'000, [](auto row) { return row; }),
+      makeFlatVector<StringView>(
+          1'000,
+          [](auto row) { return StringView::makeInline(std::to_string(row)); },
+          nullEvery(7)),
+      makeArrayVector<int32_t>(
+          1'000,
+          [](auto row) { return row % 5; },
+          [](auto row) { return row; }),
+      BaseVector::wrapInDictionary(
+          nullptr,
+          makeIndicesInReverse(1'000),
+          1'000,
+          makeFlatVector<double>(1'000, [](auto row) { return row * 0.1; })),
+  });
+  const auto rowType = asRowType(rowVector->type());
+
+  // Rows go to the targets round robin, target 3 gets none.
+  constexpr int32_t kNumTargets = 4;
+  std::vector<std::vector<vector_size_t>> targetRows(kNumTargets);
+  for (auto row = 0; row < rowVector->size(); ++row) {
+    targetRows[row % (kNumTargets - 1)].push_back(row);
+  }
+  std::vector<folly::Range<const vector_size_t*>> rows;
+  for (const auto& target : targetRows) {
+    rows.push_back(folly::Range(target.data(), target.size()));
+  }
+
+  auto arena = std::make_unique<StreamArena>(pool_.get());
+  std::vector<std::unique_ptr<IterativeVectorSerializer>> scattered;
+  std::vector<IterativeVectorSerializer*> scatteredPtrs;
+  std::vector<std::unique_ptr<IterativeVectorSerializer>> appended;
+  for (auto i = 0; i < kNumTargets; ++i) {
+    scattered.push_back(serde_->createIterativeSerializer(
+        rowType, rows[i].size(), arena.get(), &paramOptions));
+    scatteredPtrs.push_back(scattered.back().get());
+    appended.push_back(serde_->createIterativeSerializer(
+        rowType, rows[i].size(), arena.get(), &paramOptions));
+  }
+  Scratch scratch;
+  // Two batches into the same serializers.
+  for (auto batch = 0; batch < 2; ++batch) {
+    scattered[0]->appendScatter(rowVector, scatteredPtrs, rows, scratch);
+    for (auto i = 0; i < kNumTargets; ++i) {
+      appended[i]->append(rowVector, rows[i], scratch);
+    }
+  }
+
+  auto toString = [&](IterativeVectorSerializer& serializer) {
+    std::ostringstream out;
+    serializer::presto::PrestoOutputStreamListener listener;
+    OStreamOutputStream output(&out, &listener);
+    serializer.flush(&output);
+    return out.str();
+  };
+  for (auto i = 0; i < kNumTargets; ++i) {
+    SCOPED_TRACE(fmt::format("target {}", i));
+    const auto serialized = toString(*scattered[i]);
+    ASSERT_EQ(serialized, toString(*appended[i]));
+    auto expected = BaseVector::create<RowVector>(rowType, 0, pool_.get());
+    for (auto batch = 0; batch < 2; ++batch) {
+      auto copy = BaseVector::create<RowVector>(
+          rowType, rows[i].size(), pool_.get());
+      for (auto j = 0; j < rows[i].size(); ++j) {
+        copy->copy(rowVector.get(), j, rows[i][j], 1);
+      }
+      expected->append(copy.get());
+    }
+    assertEqualVectors(
+        expected, deserialize(rowType, serialized, &paramOptions));
+  }
+}
+
+TEST_P(PrestoSerializerTest, preserveConstants) {
+  auto paramOptions = getParamSerdeOptions(nullptr);
+  paramOptions.preserveConstants = true;
+  auto makeBatch = [&](int64_t key, const std::string& name) {
+    return makeRowVector({
+        makeConstant<int64_t>(key, 1'000),
+        makeConstant<std::string>(name, 1'000),
+        makeConstant<int32_t>(std::nullopt, 1'000),
+        makeFlatVector<int64_t>(1'000, [](auto row) { return row; }),
+    });
+  };
+  const auto rowType = asRowType(makeBatch(0, "")->type());
+
+  auto arena = std::make_unique<StreamArena>(pool_.get());
+  auto serializer = serde_->createIterativeSerializer(
+      rowType, 1'000, arena.get(), &paramOptions);
+  auto flatOptions = paramOptions;
+  flatOptions.preserveConstants = false;
+  auto flatSerializer = serde_->createIterativeSerializer(
+      rowType, 1'000, arena.get(), &flatOptions);
+  auto toString = [&](IterativeVectorSerializer& target) {
+    std::ostringstream out;
+    serializer::presto::PrestoOutputStreamListener listener;
+    OStreamOutputStream output(&out, &listener);
+    target.flush(&output);
+    return out.str();
+  };
+
+  Scratch scratch;
+  std::vector<vector_size_t> rows(500);
+  std::iota(rows.begin(), rows.end(), 100);
+  const IndexRange range{0, 1'000};
+  auto first = makeBatch(1, "a");
+  auto expected = BaseVector::create<RowVector>(rowType, 0, pool_.get());
+  for (auto i = 0; i < 2; ++i) {
+    serializer->append(first, folly::Range(&range, 1), scratch);
+    serializer->append(first, folly::Range(rows.data(), rows.size()), scratch);
+    flatSerializer->append(first, folly::Range(&range, 1), scratch);
+    flatSerializer->append(
+        first, folly::Range(rows.data(), rows.size()), scratch);
+    expected->append(first.get());
+    expected->append(first->slice(100, 500).get());
+  }
+  auto serialized = toString(*serializer);
+  // The constant columns take one value instead of 3'000.
+  ASSERT_LT(serialized.size() + 3'000 * 8, toString(*flatSerializer).size());
+  auto result = deserialize(rowType, serialized, &paramOptions);
+  assertEqualVectors(expected, result);
+
+  // A different value makes the columns flat.
+  auto second = makeBatch(2, "b");
+  serializer->append(second, folly::Range(&range, 1), scratch);
+  expected->append(second.get());
+  assertEqualVectors(
+      expected, deserialize(rowType, toString(*serializer), &paramOptions));
+
+  // A cleared serializer can start a new RLE column.
+  serializer->clear();
+  serializer->append(second, folly::Range(rows.data(), rows.size()), scratch);
+  auto third = makeBatch(3, "c");
+  third->childAt(3) = makeConstant<int64_t>(5, 1'000);
+  std::vector<IterativeVectorSerializer*> targets{serializer.get()};
+  std::vector<folly::Range<const vector_size_t*>> targetRows{
+      folly::Range(rows.data(), rows.size())};
+  serializer->appendScatter(third, targets, targetRows, scratch);
+  expected = BaseVector::create<RowVector>(rowType, 0, pool_.get());
+  expected->append(second->slice(100, 500).get());
+  expected->append(third->slice(100, 500).get());
+  assertEqualVectors(
+      expected, deserialize(rowType, toString(*serializer), &paramOptions));
+}
+
+TEST_P(PrestoSerializerTest, lightweightEncodings) {
+  const vector_size_t size = 1'000;
+  auto data = makeRowVector({
+      // Delta packs a sequence in 0 bits.
+      makeFlatVector<int64_t>(size, [](auto row) { return 1'000'000 + row; }),
+      // Frame of reference packs a small range.
+      makeFlatVector<int64_t>(
+          size, [](auto row) { return (row * 7) % 100 - 50; }, nullEvery(7)),
+      makeFlatVector<int32_t>(
+          size,
+          [](auto row) { return 19'000 + row % 13; },
+          nullEvery(5),
+          DATE()),
+      makeFlatVector<Timestamp>(
+          size,
+          [](auto row) {
+            return Timestamp::fromMillis(1'700'000'000'000 + row * 1'000);
+          }),
+      // Random values are too wide to pack.
+      makeFlatVector<int64_t>(
+          size, [](auto row) { return folly::hash::twang_mix64(row); }),
+      makeArrayVector<int64_t>(
+          size,
+          [](auto row) { return row % 5; },
+          [](auto row) { return row % 3; }),
+      makeRowVector(
+          {makeFlatVector<int64_t>(size, [](auto row) { return row % 10; })},
+          nullEvery(3)),
+  });
+  const auto rowType = asRowType(data->type());
+
+  for (bool nullsFirst : {false, true}) {
+    SCOPED_TRACE(fmt::format("nullsFirst: {}", nullsFirst));
+    serializer::presto::PrestoVectorSerde::PrestoOptions plainOptions;
+    plainOptions.nullsFirst = nullsFirst;
+    auto packedOptions = plainOptions;
+    packedOptions.lightweightEncodings = true;
+    testRoundTrip(data, &packedOptions);
+
+    std::ostringstream plain;
+    serializeBatch(data, &plain, &plainOptions);
+    std::ostringstream packed;
+    serializeBatch(data, &packed, &packedOptions);
+    assertEqualVectors(data, deserialize(rowType, packed.str(), &plainOptions));
+    if (GetParam() == common::CompressionKind_NONE) {
+      EXPECT_LT(packed.str().size(), plain.str().size() * 2 / 3);
+    }
+  }
+
+  // Lossless timestamps are written flat.
+  serializer::presto::PrestoVectorSerde::PrestoOptions losslessOptions;
+  losslessOptions.useLosslessTimestamp = true;
+  losslessOptions.lightweightEncodings = true;
+  testRoundTrip(data, &losslessOptions);
+}
+
 TEST_P(PrestoSerializerTest, emptyArray) {
   auto arrayVector = makeArrayVector<int32_t>(
       1'000,
@@ -1127,6 +1342,52 @@ TEST_P(PrestoSerializerTest, multiPage) {
   }
 }
 
+TEST_P(PrestoSerializerTest, zeroCopy) {
+  auto data = makeRowVector({
+      makeFlatVector<int8_t>(1'000, [](auto row) { return row % 100; }),
+      makeFlatVector<std::string>(
+          1'000,
+          [](auto row) { return fmt::format("a non inlined string {}", row); }),
+      makeFlatVector<int64_t>(
+          1'000, [](auto row) { return row; }, nullEvery(7)),
+  });
+  std::ostringstream out;
+  serialize(data, &out, nullptr);
+  const auto bytes = out.str();
+
+  auto page = AlignedBuffer::allocate<char>(bytes.size(), pool_.get());
+  std::memcpy(page->asMutable<char>(), bytes.data(), bytes.size());
+  auto paramOptions = getParamSerdeOptions(nullptr);
+  paramOptions.zeroCopyBuffer = page;
+  auto byteStream = std::make_unique<BufferInputStream>(std::vector<ByteRange>{
+      {page->asMutable<uint8_t>(), static_cast<int64_t>(bytes.size()), 0}});
+  RowVectorPtr result;
+  serde_->deserialize(
+      byteStream.get(),
+      pool_.get(),
+      asRowType(data->type()),
+      &result,
+      0,
+      &paramOptions);
+  assertEqualVectors(data, result);
+
+  if (GetParam() == common::CompressionKind::CompressionKind_NONE) {
+    EXPECT_TRUE(result->childAt(0)->values()->isView());
+    const auto& stringBuffers =
+        result->childAt(1)->asFlatVector<StringView>()->stringBuffers();
+    ASSERT_EQ(stringBuffers.size(), 1);
+    EXPECT_EQ(stringBuffers[0], page);
+  }
+  // Values with nulls are copied.
+  EXPECT_FALSE(result->childAt(2)->values()->isView());
+
+  // The vectors keep the page alive.
+  byteStream.reset();
+  paramOptions.zeroCopyBuffer.reset();
+  page.reset();
+  assertEqualVectors(data, result);
+}
+
 TEST_P(PrestoSerializerTest, timestampWithNanosecondPrecision) {
   // Verify that nanosecond precision is preserved when the right options are
   // passed to the serde.
@@ -1296,7 +1557,10 @@ TEST_P(PrestoSerializerTest, dictionaryEncodingTurnedOff) {
       makeFlatVector<int32_t>(32, [](vector_size_t row) { return row; });
   auto bigintBase =
       makeFlatVector<int64_t>(32, [](vector_size_t row) { return row; });
-  auto stringBase = makeFlatVector<std::string>(
+  auto stringBase = makeFlatVector<std::string>(32, [](vector_size_t row) {
+    return fmt::format("{}{}", std::string(20, 'x'), row);
+  });
+  auto shortStringBase = makeFlatVector<std::string>(
       32, [](vector_size_t row) { return fmt::format("{}", row); });
   auto oneIndex = makeIndices(32, [](auto) { return 0; });
   auto quarterIndices = makeIndices(32, [](auto row) { return row % 8; });
@@ -1315,14 +1579,23 @@ TEST_P(PrestoSerializerTest, dictionaryEncodingTurnedOff) {
       // enough benefit to outweigh the cost.
       BaseVector::wrapInDictionary(nullptr, allButOneIndices, 32, bigintBase),
       BaseVector::wrapInDictionary(nullptr, allIndices, 32, bigintBase),
-      // These should keep dictionary encoding because strings are variable
-      // length.
+      // These should keep dictionary encoding because the used strings and
+      // the indices are smaller than the flattened strings.
       BaseVector::wrapInDictionary(nullptr, oneIndex, 32, stringBase),
       BaseVector::wrapInDictionary(nullptr, quarterIndices, 32, stringBase),
+      // This should be flattened because the used strings and the indices
+      // are larger than the flattened strings.
       BaseVector::wrapInDictionary(nullptr, allButOneIndices, 32, stringBase),
       // This should be flattened because the alphabet is the same as the
       // flattened vector.
       BaseVector::wrapInDictionary(nullptr, allIndices, 32, stringBase),
+      // This should keep dictionary encoding because a single index is
+      // smaller than the flattened strings.
+      BaseVector::wrapInDictionary(nullptr, oneIndex, 32, shortStringBase),
+      // This should be flattened because short strings are not much larger
+      // than their indices.
+      BaseVector::wrapInDictionary(
+          nullptr, quarterIndices, 32, shortStringBase),
   });
 
   for (bool preserveEncodings : {false, true}) {
@@ -1371,11 +1644,17 @@ TEST_P(PrestoSerializerTest, dictionaryEncodingTurnedOff) {
         VectorEncoding::Simple::DICTIONARY);
     // string + all but one indices
     ASSERT_EQ(
-        deserialized->childAt(8)->encoding(),
-        VectorEncoding::Simple::DICTIONARY);
+        deserialized->childAt(8)->encoding(), exptectedTransformedEncoding);
     // string + all indices
     ASSERT_EQ(
         deserialized->childAt(9)->encoding(), exptectedTransformedEncoding);
+    // short string + one index
+    ASSERT_EQ(
+        deserialized->childAt(10)->encoding(),
+        VectorEncoding::Simple::DICTIONARY);
+    // short string + quarter indices
+    ASSERT_EQ(
+        deserialized->childAt(11)->encoding(), exptectedTransformedEncoding);
   }
 }
 
@@ -1455,6 +1734,15 @@ TEST_P(PrestoSerializerTest, ioBufRoundTrip) {
         rowVectorToIOBuf(inputRowVector, *pool_), rowType, *pool_);
 
     assertEqualVectors(inputRowVector, outputRowVector);
+
+    // Serialize only a prefix of the rows.
+    const auto rangeEnd = inputRowVector->size() / 2;
+    outputRowVector = IOBufToRowVector(
+        rowVectorToIOBuf(inputRowVector, rangeEnd, *pool_, serde_.get()),
+        rowType,
+        *pool_,
+        serde_.get());
+    assertEqualVectors(inputRowVector->slice(0, rangeEnd), outputRowVector);
   }
 }
 
@@ -19,6 +19,7 @@
 #include <utility>
 
 #include "velox/core/PlanNode.h"
+#include "velox/exec/OperatorTraceReader.h"
 #include "velox/exec/PlanNodeStats.h"
 #include "velox/exec/TaskTraceReader.h"
 #include "velox/exec/TraceUtil.h"
@@ -145,13 +146,58 @@ OperatorReplayerBase::replayNodeFactory(const core::PlanNode* node) const {
 }
 
 void OperatorReplayerBase::printStats(
-    const std::shared_ptr<exec::Task>& task) const {
+    const std::shared_ptr<exec::Task>& task) {
   const auto planStats = exec::toPlanStats(task->taskStats());
   const auto& stats = planStats.at(replayPlanNodeId_);
+  const auto summaries = readTraceSummaries();
+
+  replayStats_ = TraceReplayStats{};
+  replayStats_.queryId = queryId_;
+  replayStats_.taskId = taskId_;
+  replayStats_.nodeId = nodeId_;
+  replayStats_.numDrivers = driverIds_.size();
   for (const auto& [name, operatorStats] : stats.operatorStats) {
     LOG(INFO) << "Stats of replaying operator " << name << " : "
               << operatorStats->toString();
+
+    OperatorReplayStats opReplayStats;
+    opReplayStats.operatorType = name;
+    opReplayStats.inputRows = operatorStats->inputRows;
+    opReplayStats.cpuTimeNanos = operatorStats->cpuWallTiming.cpuNanos;
+    opReplayStats.wallTimeNanos = operatorStats->cpuWallTiming.wallNanos;
+    opReplayStats.peakMemoryBytes = operatorStats->peakMemoryBytes;
+    for (const auto& summary : summaries) {
+      if (summary.opType != name) {
+        continue;
+      }
+      opReplayStats.recordedInputRows += summary.inputRows;
+      opReplayStats.recordedCpuTimeNanos += summary.cpuTimeNanos;
+      opReplayStats.recordedWallTimeNanos += summary.wallTimeNanos;
+      opReplayStats.recordedPeakMemoryBytes += summary.peakMemory;
+    }
+    LOG(INFO) << "Replay vs. traced stats of operator " << name << " : "
+              << opReplayStats.toString();
+    replayStats_.operatorStats.push_back(std::move(opReplayStats));
   }
   LOG(INFO) << "Memory usage: " << task->pool()->treeMemoryUsage(false);
 }
+
+std::vector<exec::trace::OperatorTraceSummary>
+OperatorReplayerBase::readTraceSummaries() const {
+  std::vector<exec::trace::OperatorTraceSummary> summaries;
+  for (const auto pipelineId : pipelineIds_) {
+    for (const auto driverId : driverIds_) {
+      const auto opTraceDir =
+          exec::trace::getOpTraceDirectory(nodeTraceDir_, pipelineId, driverId);
+      if (!fs_->exists(exec::trace::getOpTraceSummaryFilePath(opTraceDir))) {
+        continue;
+      }
+      summaries.push_back(
+          exec::trace::OperatorTraceSummaryReader(
+              opTraceDir, memory::MemoryManager::getInstance()->tracePool())
+              .read());
+    }
+  }
+  return summaries;
+}
 } // namespace facebook::velox::tool::trace
@@ -19,7 +19,9 @@
 #include "velox/common/file/FileSystems.h"
 #include "velox/core/PlanNode.h"
 #include "velox/core/QueryCtx.h"
+#include "velox/exec/Trace.h"
 #include "velox/parse/PlanNodeIdGenerator.h"
+#include "velox/tool/trace/TraceReplayStats.h"
 
 namespace facebook::velox::exec {
 class Task;
@@ -47,6 +49,12 @@ class OperatorReplayerBase {
 
   virtual RowVectorPtr run(bool copyResults = true);
 
+  /// Returns the stats of the last run() of the replayed node, compared with
+  /// the ones recorded in the operator trace summaries.
+  const TraceReplayStats& replayStats() const {
+    return replayStats_;
+  }
+
  protected:
   virtual core::PlanNodePtr createPlanNode(
       const core::PlanNode* node,
@@ -77,10 +85,18 @@ class OperatorReplayerBase {
   core::PlanNodePtr planFragment_;
   core::PlanNodeId replayPlanNodeId_;
 
-  void printStats(const std::shared_ptr<exec::Task>& task) const;
+  /// Prints the stats of the replayed node and collects them in
+  /// 'replayStats_'.
+  void printStats(const std::shared_ptr<exec::Task>& task);
 
  private:
+  // Returns the operator trace summaries of the replayed drivers in all the
+  // traced pipelines.
+  std::vector<exec::trace::OperatorTraceSummary> readTraceSummaries() const;
+
   std::function<core::PlanNodePtr(std::string, core::PlanNodePtr)>
   replayNodeFactory(const core::PlanNode* node) const;
+
+  TraceReplayStats replayStats_;
 };
 } // namespace facebook::velox::tool::trace
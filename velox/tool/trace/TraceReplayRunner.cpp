@@ -106,6 +106,16 @@ DEFINE_string(
     function_prefix,
     "",
     "Prefix for the scalar and aggregate functions.");
+DEFINE_string(
+    replay_stats_output,
+    "",
+    "If not empty, write the replay stats of the target node in JSON to this "
+    "file path that can be used as the baseline of another replay.");
+DEFINE_string(
+    baseline_replay_stats,
+    "",
+    "If not empty, the replay stats file written by a previous replay of the "
+    "same node, e.g. by another build, to compare the operator timing with.");
 
 namespace facebook::velox::tool::trace {
 namespace {
@@ -441,6 +451,16 @@ void TraceReplayRunner::run() {
     return;
   }
   VELOX_USER_CHECK(!FLAGS_task_id.empty(), "--task_id must be provided");
-  createReplayer()->run(FLAGS_copy_results);
+  const auto replayer = createReplayer();
+  replayer->run(FLAGS_copy_results);
+
+  const auto& replayStats = replayer->replayStats();
+  if (!FLAGS_replay_stats_output.empty()) {
+    replayStats.write(FLAGS_replay_stats_output);
+  }
+  if (!FLAGS_baseline_replay_stats.empty()) {
+    LOG(INFO) << replayStats.compare(
+        TraceReplayStats::read(FLAGS_baseline_replay_stats));
+  }
 }
 } // namespace facebook::velox::tool::trace
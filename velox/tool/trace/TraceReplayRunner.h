@@ -39,6 +39,8 @@ DECLARE_double(driver_cpu_executor_hw_multiplier);
 DECLARE_string(memory_arbitrator_type);
 DECLARE_bool(copy_results);
 DECLARE_string(function_prefix);
+DECLARE_string(replay_stats_output);
+DECLARE_string(baseline_replay_stats);
 
 namespace facebook::velox::tool::trace {
 
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/tool/trace/TraceReplayStats.h"
+
+#include <fmt/format.h>
+#include <folly/json.h>
+
+#include <algorithm>
+#include <sstream>
+
+#include "velox/common/base/Exceptions.h"
+#include "velox/common/base/SuccinctPrinter.h"
+#include "velox/common/file/FileSystems.h"
+
+namespace facebook::velox::tool::trace {
+namespace {
+const std::string kOperatorTypeKey = "operatorType";
+const std::string kInputRowsKey = "inputRows";
+const std::string kCpuTimeNanosKey = "cpuTimeNanos";
+const std::string kWallTimeNanosKey = "wallTimeNanos";
+const std::string kPeakMemoryBytesKey = "peakMemoryBytes";
+const std::string kRecordedInputRowsKey = "recordedInputRows";
+const std::string kRecordedCpuTimeNanosKey = "recordedCpuTimeNanos";
+const std::string kRecordedWallTimeNanosKey = "recordedWallTimeNanos";
+const std::string kRecordedPeakMemoryBytesKey = "recordedPeakMemoryBytes";
+const std::string kQueryIdKey = "queryId";
+const std::string kTaskIdKey = "taskId";
+const std::string kNodeIdKey = "nodeId";
+const std::string kNumDriversKey = "numDrivers";
+const std::string kOperatorStatsKey = "operatorStats";
+
+// Returns the relative change of 'value' against 'base' in percentage, or
+// "n/a" if 'base' is zero such as for the traces recorded without timing.
+std::string formatDelta(uint64_t value, uint64_t base) {
+  if (base == 0) {
+    return "n/a";
+  }
+  const double delta =
+      100.0 * (static_cast<double>(value) - static_cast<double>(base)) / base;
+  return fmt::format("{:+.2f}%", delta);
+}
+} // namespace
+
+folly::dynamic OperatorReplayStats::serialize() const {
+  folly::dynamic obj = folly::dynamic::object;
+  obj[kOperatorTypeKey] = operatorType;
+  obj[kInputRowsKey] = inputRows;
+  obj[kCpuTimeNanosKey] = cpuTimeNanos;
+  obj[kWallTimeNanosKey] = wallTimeNanos;
+  obj[kPeakMemoryBytesKey] = peakMemoryBytes;
+  obj[kRecordedInputRowsKey] = recordedInputRows;
+  obj[kRecordedCpuTimeNanosKey] = recordedCpuTimeNanos;
+  obj[kRecordedWallTimeNanosKey] = recordedWallTimeNanos;
+  obj[kRecordedPeakMemoryBytesKey] = recordedPeakMemoryBytes;
+  return obj;
+}
+
+// static
+OperatorReplayStats OperatorReplayStats::create(const folly::dynamic& obj) {
+  OperatorReplayStats stats;
+  stats.operatorType = obj[kOperatorTypeKey].asString();
+  stats.inputRows = obj[kInputRowsKey].asInt();
+  stats.cpuTimeNanos = obj[kCpuTimeNanosKey].asInt();
+  stats.wallTimeNanos = obj[kWallTimeNanosKey].asInt();
+  stats.peakMemoryBytes = obj[kPeakMemoryBytesKey].asInt();
+  stats.recordedInputRows = obj[kRecordedInputRowsKey].asInt();
+  stats.recordedCpuTimeNanos = obj[kRecordedCpuTimeNanosKey].asInt();
+  stats.recordedWallTimeNanos = obj[kRecordedWallTimeNanosKey].asInt();
+  stats.recordedPeakMemoryBytes = obj[kRecordedPeakMemoryBytesKey].asInt();
+  return stats;
+}
+
+std::string OperatorReplayStats::toString() const {
+  return fmt::format(
+      "opType {}, inputRows {} (recorded {}), cpuTime {} (recorded {}, {}), "
+      "wallTime {} (recorded {}, {}), peakMemory {} (recorded {}, {})",
+      operatorType,
+      inputRows,
+      recordedInputRows,
+      succinctNanos(cpuTimeNanos),
+      succinctNanos(recordedCpuTimeNanos),
+      formatDelta(cpuTimeNanos, recordedCpuTimeNanos),
+      succinctNanos(wallTimeNanos),
+      succinctNanos(recordedWallTimeNanos),
+      formatDelta(wallTimeNanos, recordedWallTimeNanos),
+      succinctBytes(peakMemoryBytes),
+      succinctBytes(recordedPeakMemoryBytes),
+      formatDelta(peakMemoryBytes, recordedPeakMemoryBytes));
+}
+
+folly::dynamic TraceReplayStats::serialize() const {
+  folly::dynamic obj = folly::dynamic::object;
+  obj[kQueryIdKey] = queryId;
+  obj[kTaskIdKey] = taskId;
+  obj[kNodeIdKey] = nodeId;
+  obj[kNumDriversKey] = numDrivers;
+  folly::dynamic operatorStatsObj = folly::dynamic::array;
+  for (const auto& stats : operatorStats) {
+    operatorStatsObj.push_back(stats.serialize());
+  }
+  obj[kOperatorStatsKey] = std::move(operatorStatsObj);
+  return obj;
+}
+
+// static
+TraceReplayStats TraceReplayStats::create(const folly::dynamic& obj) {
+  TraceReplayStats stats;
+  stats.queryId = obj[kQueryIdKey].asString();
+  stats.taskId = obj[kTaskIdKey].asString();
+  stats.nodeId = obj[kNodeIdKey].asString();
+  stats.numDrivers = obj[kNumDriversKey].asInt();
+  for (const auto& operatorStatsObj : obj[kOperatorStatsKey]) {
+    stats.operatorStats.push_back(
+        OperatorReplayStats::create(operatorStatsObj));
+  }
+  return stats;
+}
+
+void TraceReplayStats::write(const std::string& path) const {
+  const auto fs = filesystems::getFileSystem(path, nullptr);
+  const auto file = fs->openFileForWrite(path);
+  VELOX_CHECK_NOT_NULL(file);
+  file->append(folly::toPrettyJson(serialize()));
+  file->close();
+}
+
+// static
+TraceReplayStats TraceReplayStats::read(const std::string& path) {
+  const auto fs = filesystems::getFileSystem(path, nullptr);
+  const auto file = fs->openFileForRead(path);
+  VELOX_CHECK_NOT_NULL(file);
+  const auto statsStr = file->pread(0, file->size());
+  VELOX_USER_CHECK(!statsStr.empty(), "Empty replay stats file {}", path);
+  return create(folly::parseJson(statsStr));
+}
+
+std::string TraceReplayStats::compare(const TraceReplayStats& baseline) const {
+  VELOX_USER_CHECK_EQ(
+      queryId, baseline.queryId, "Baseline is replayed from another query");
+  VELOX_USER_CHECK_EQ(
+      taskId, baseline.taskId, "Baseline is replayed from another task");
+  VELOX_USER_CHECK_EQ(
+      nodeId, baseline.nodeId, "Baseline is replayed from another node");
+
+  std::stringstream out;
+  out << fmt::format(
+      "Replay of node {} with {} drivers vs. baseline with {} drivers",
+      nodeId,
+      numDrivers,
+      baseline.numDrivers);
+  for (const auto& stats : operatorStats) {
+    const auto it = std::find_if(
+        baseline.operatorStats.begin(),
+        baseline.operatorStats.end(),
+        [&](const auto& baselineStats) {
+          return baselineStats.operatorType == stats.operatorType;
+        });
+    if (it == baseline.operatorStats.end()) {
+      out << fmt::format(
+          "\n  opType {}: not found in baseline", stats.operatorType);
+      continue;
+    }
+    out << fmt::format(
+        "\n  opType {}: inputRows {} vs. {}, cpuTime {} vs. {} ({}), "
+        "wallTime {} vs. {} ({}), peakMemory {} vs. {} ({})",
+        stats.operatorType,
+        stats.inputRows,
+        it->inputRows,
+        succinctNanos(stats.cpuTimeNanos),
+        succinctNanos(it->cpuTimeNanos),
+        formatDelta(stats.cpuTimeNanos, it->cpuTimeNanos),
+        succinctNanos(stats.wallTimeNanos),
+        succinctNanos(it->wallTimeNanos),
+        formatDelta(stats.wallTimeNanos, it->wallTimeNanos),
+        succinctBytes(stats.peakMemoryBytes),
+        succinctBytes(it->peakMemoryBytes),
+        formatDelta(stats.peakMemoryBytes, it->peakMemoryBytes));
+  }
+  return out.str();
+}
+} // namespace facebook::velox::tool::trace
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <folly/dynamic.h>
+
+#include <string>
+#include <vector>
+
+namespace facebook::velox::tool::trace {
+
+/// The replay stats of one operator type of a replayed plan node, along with
+/// the values recorded in the operator trace summaries of the traced drivers.
+struct OperatorReplayStats {
+  std::string operatorType;
+
+  uint64_t inputRows{0};
+  uint64_t cpuTimeNanos{0};
+  uint64_t wallTimeNanos{0};
+  uint64_t peakMemoryBytes{0};
+
+  uint64_t recordedInputRows{0};
+  uint64_t recordedCpuTimeNanos{0};
+  uint64_t recordedWallTimeNanos{0};
+  uint64_t recordedPeakMemoryBytes{0};
+
+  folly::dynamic serialize() const;
+
+  static OperatorReplayStats create(const folly::dynamic& obj);
+
+  /// Returns the replay stats with their deltas against the recorded ones.
+  std::string toString() const;
+};
+
+/// The replay stats of a traced plan node. They are persisted in JSON so that
+/// replays of the same trace by two different builds can be compared.
+struct TraceReplayStats {
+  std::string queryId;
+  std::string taskId;
+  std::string nodeId;
+  uint32_t numDrivers{0};
+  std::vector<OperatorReplayStats> operatorStats;
+
+  folly::dynamic serialize() const;
+
+  static TraceReplayStats create(const folly::dynamic& obj);
+
+  /// Writes the stats in JSON to 'path'.
+  void write(const std::string& path) const;
+
+  /// Reads the stats written by write() from 'path'.
+  static TraceReplayStats read(const std::string& path);
+
+  /// Returns the per-operator timing deltas of this replay against
+  /// 'baseline' which is replayed from the same traced node, typically by
+  /// another build.
+  std::string compare(const TraceReplayStats& baseline) const;
+};
+} // namespace facebook::velox::tool::trace
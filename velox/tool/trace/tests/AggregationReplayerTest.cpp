@@ -22,6 +22,7 @@
 #include <string>
 
 #include "folly/experimental/EventCount.h"
+#include "velox/common/base/tests/GTestUtils.h"
 #include "velox/common/file/FileSystems.h"
 #include "velox/common/hyperloglog/SparseHll.h"
 #include "velox/common/testutil/TestValue.h"
@@ -367,4 +368,82 @@ TEST_F(AggregationReplayerTest, streamingAggregateTest) {
     }
   }
 }
+
+TEST_F(AggregationReplayerTest, replayStats) {
+  const auto data = generateInput(groupingKeys_, keyTypes_);
+  const auto planWithNames = aggregatePlans(asRowType(data[0]->type()));
+  const auto sourceFilePath = TempFilePath::create();
+  writeToFile(sourceFilePath->getPath(), data);
+
+  const auto& plan = planWithNames.front().plan;
+  const auto testDir = TempDirectoryPath::create();
+  const auto traceRoot = fmt::format("{}/{}", testDir->getPath(), "traceRoot");
+  std::shared_ptr<Task> task;
+  AssertQueryBuilder(plan)
+      .config(core::QueryConfig::kQueryTraceEnabled, true)
+      .config(core::QueryConfig::kQueryTraceDir, traceRoot)
+      .config(core::QueryConfig::kQueryTraceMaxBytes, 100UL << 30)
+      .config(core::QueryConfig::kQueryTraceTaskRegExp, ".*")
+      .config(core::QueryConfig::kQueryTraceNodeId, traceNodeId_)
+      .split(makeHiveConnectorSplit(sourceFilePath->getPath()))
+      .copyResults(pool(), task);
+
+  AggregationReplayer replayer(
+      traceRoot,
+      task->queryCtx()->queryId(),
+      task->taskId(),
+      traceNodeId_,
+      "Aggregation",
+      "",
+      0,
+      executor_.get());
+  replayer.run();
+  const auto& replayStats = replayer.replayStats();
+  ASSERT_EQ(replayStats.queryId, task->queryCtx()->queryId());
+  ASSERT_EQ(replayStats.taskId, task->taskId());
+  ASSERT_EQ(replayStats.nodeId, traceNodeId_);
+  ASSERT_EQ(replayStats.numDrivers, 1);
+  ASSERT_EQ(replayStats.operatorStats.size(), 1);
+  const auto& opStats = replayStats.operatorStats[0];
+  ASSERT_EQ(opStats.operatorType, "Aggregation");
+  ASSERT_EQ(opStats.inputRows, opStats.recordedInputRows);
+  ASSERT_GT(opStats.inputRows, 0);
+  ASSERT_GT(opStats.wallTimeNanos, 0);
+  ASSERT_GT(opStats.recordedWallTimeNanos, 0);
+
+  const auto statsPath = fmt::format("{}/{}", testDir->getPath(), "stats");
+  replayStats.write(statsPath);
+  const auto readStats = TraceReplayStats::read(statsPath);
+  ASSERT_EQ(readStats.serialize(), replayStats.serialize());
+  ASSERT_NE(
+      replayStats.compare(readStats).find("opType Aggregation"),
+      std::string::npos);
+
+  TraceReplayStats otherNodeStats = readStats;
+  otherNodeStats.nodeId = "other";
+  VELOX_ASSERT_THROW(
+      replayStats.compare(otherNodeStats),
+      "Baseline is replayed from another node");
+
+  const auto runnerStatsPath =
+      fmt::format("{}/{}", testDir->getPath(), "runnerStats");
+  FLAGS_root_dir = traceRoot;
+  FLAGS_query_id = task->queryCtx()->queryId();
+  FLAGS_task_id = task->taskId();
+  FLAGS_node_id = traceNodeId_;
+  FLAGS_driver_ids = "";
+  FLAGS_summary = false;
+  FLAGS_replay_stats_output = runnerStatsPath;
+  FLAGS_baseline_replay_stats = statsPath;
+  {
+    TraceReplayRunner runner;
+    runner.init();
+    runner.run();
+  }
+  FLAGS_replay_stats_output = "";
+  FLAGS_baseline_replay_stats = "";
+  ASSERT_EQ(
+      TraceReplayStats::read(runnerStatsPath).operatorStats[0].inputRows,
+      opStats.inputRows);
+}
 } // namespace facebook::velox::tool::trace::test
@@ -90,6 +90,11 @@ void DBGenIterator::initCustomer(size_t offset) {
   sd_cust(CUST, offset, &dbgenCtx_);
 }
 
+void DBGenIterator::skipComments(bool master, bool detail) {
+  dbgenCtx_.skip_master_comment = master;
+  dbgenCtx_.skip_detail_comment = detail;
+}
+
 void DBGenIterator::genNation(size_t index, code_t& code) {
   row_start(NATION, &dbgenCtx_);
   mk_nation(index, &code, &dbgenCtx_);
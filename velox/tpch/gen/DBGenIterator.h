@@ -43,6 +43,11 @@ class DBGenIterator {
   void initPart(size_t offset);
   void initCustomer(size_t offset);
 
+  // Leaves the comments of the generated records (e.g. orders) or of their
+  // detail records (e.g. the lineitems of the orders) empty. The other columns
+  // are the same as with the comments.
+  void skipComments(bool master, bool detail);
+
   // Generate different types of records.
   void genNation(size_t index, dbgen::code_t& code);
   void genRegion(size_t index, dbgen::code_t& code);
@@ -64,19 +64,42 @@ size_t getVectorSize(size_t rowCount, size_t maxRows, size_t offset) {
   return std::min(rowCount - offset, maxRows);
 }
 
+// Allocates flat vectors for 'columns', or for all the columns if 'columns'
+// is std::nullopt. The other columns are null constants.
 std::vector<VectorPtr> allocateVectors(
     const RowTypePtr& type,
     size_t vectorSize,
-    memory::MemoryPool* pool) {
+    memory::MemoryPool* pool,
+    const std::optional<std::vector<column_index_t>>& columns) {
+  std::vector<bool> projected(type->size(), !columns.has_value());
+  if (columns.has_value()) {
+    for (auto column : columns.value()) {
+      VELOX_CHECK_LT(column, type->size());
+      projected[column] = true;
+    }
+  }
+
   std::vector<VectorPtr> vectors;
   vectors.reserve(type->size());
-
-  for (const auto& childType : type->children()) {
-    vectors.emplace_back(BaseVector::create(childType, vectorSize, pool));
+  for (auto i = 0; i < type->size(); ++i) {
+    vectors.emplace_back(
+        projected[i]
+            ? BaseVector::create(type->childAt(i), vectorSize, pool)
+            : BaseVector::createNullConstant(
+                  type->childAt(i), vectorSize, pool));
   }
   return vectors;
 }
 
+// Sets 'row' of 'vector' to the result of 'value' unless the column is not
+// generated, in which case 'vector' is null and 'value' is not evaluated.
+template <typename T, typename TValue>
+void setIfProjected(FlatVector<T>* vector, size_t row, const TValue& value) {
+  if (vector != nullptr) {
+    vector->set(row, value());
+  }
+}
+
 double decimalToDouble(int64_t value) {
   return static_cast<double>(value) * 0.01;
 }
@@ -358,12 +381,13 @@ RowVectorPtr genTpchOrders(
     memory::MemoryPool* pool,
     size_t maxRows,
     size_t offset,
-    double scaleFactor) {
+    double scaleFactor,
+    const std::optional<std::vector<column_index_t>>& columns) {
   // Create schema and allocate vectors.
   auto ordersRowType = getTableSchema(Table::TBL_ORDERS);
   size_t vectorSize = getVectorSize(
       getRowCount(Table::TBL_ORDERS, scaleFactor), maxRows, offset);
-  auto children = allocateVectors(ordersRowType, vectorSize, pool);
+  auto children = allocateVectors(ordersRowType, vectorSize, pool, columns);
 
   auto orderKeyVector = children[0]->asFlatVector<int64_t>();
   auto custKeyVector = children[1]->asFlatVector<int64_t>();
@@ -377,6 +401,7 @@ RowVectorPtr genTpchOrders(
 
   DBGenIterator dbgenIt(scaleFactor);
   dbgenIt.initOrder(offset);
+  dbgenIt.skipComments(commentVector == nullptr, true);
   order_t order;
 
   // Dbgen generates the dataset one row at a time, so we need to transpose it
@@ -384,16 +409,25 @@ RowVectorPtr genTpchOrders(
   for (size_t i = 0; i < vectorSize; ++i) {
     dbgenIt.genOrder(i + offset + 1, order);
 
-    orderKeyVector->set(i, order.okey);
-    custKeyVector->set(i, order.custkey);
-    orderStatusVector->set(i, StringView(&order.orderstatus, 1));
-    totalPriceVector->set(i, decimalToDouble(order.totalprice));
-    orderDateVector->set(i, toDate(order.odate));
-    orderPriorityVector->set(
-        i, StringView(order.opriority, strlen(order.opriority)));
-    clerkVector->set(i, StringView(order.clerk, strlen(order.clerk)));
-    shipPriorityVector->set(i, order.spriority);
-    commentVector->set(i, StringView(order.comment, order.clen));
+    setIfProjected(orderKeyVector, i, [&] { return order.okey; });
+    setIfProjected(custKeyVector, i, [&] { return order.custkey; });
+    setIfProjected(orderStatusVector, i, [&] {
+      return StringView(&order.orderstatus, 1);
+    });
+    setIfProjected(totalPriceVector, i, [&] {
+      return decimalToDouble(order.totalprice);
+    });
+    setIfProjected(orderDateVector, i, [&] { return toDate(order.odate); });
+    setIfProjected(orderPriorityVector, i, [&] {
+      return StringView(order.opriority, strlen(order.opriority));
+    });
+    setIfProjected(clerkVector, i, [&] {
+      return StringView(order.clerk, strlen(order.clerk));
+    });
+    setIfProjected(shipPriorityVector, i, [&] { return order.spriority; });
+    setIfProjected(commentVector, i, [&] {
+      return StringView(order.comment, order.clen);
+    });
   }
   return std::make_shared<RowVector>(
       pool, ordersRowType, BufferPtr(nullptr), vectorSize, std::move(children));
@@ -403,7 +437,8 @@ RowVectorPtr genTpchLineItem(
     memory::MemoryPool* pool,
     size_t maxOrderRows,
     size_t ordersOffset,
-    double scaleFactor) {
+    double scaleFactor,
+    const std::optional<std::vector<column_index_t>>& columns) {
   // We control the buffer size based on the orders table, then allocate the
   // underlying buffer using the worst case (orderVectorSize * 7).
   size_t orderVectorSize = getVectorSize(
@@ -412,7 +447,8 @@ RowVectorPtr genTpchLineItem(
 
   // Create schema and allocate vectors.
   auto lineItemRowType = getTableSchema(Table::TBL_LINEITEM);
-  auto children = allocateVectors(lineItemRowType, lineItemUpperBound, pool);
+  auto children =
+      allocateVectors(lineItemRowType, lineItemUpperBound, pool, columns);
 
   auto orderKeyVector = children[0]->asFlatVector<int64_t>();
   auto partKeyVector = children[1]->asFlatVector<int64_t>();
@@ -435,6 +471,7 @@ RowVectorPtr genTpchLineItem(
 
   DBGenIterator dbgenIt(scaleFactor);
   dbgenIt.initOrder(ordersOffset);
+  dbgenIt.skipComments(true, commentVector == nullptr);
   order_t order;
 
   // Dbgen can't generate lineItem one row at a time; instead, it generates
@@ -448,31 +485,44 @@ RowVectorPtr genTpchLineItem(
 
     for (size_t l = 0; l < order.lines; ++l) {
       const auto& line = order.l[l];
-      orderKeyVector->set(lineItemCount + l, line.okey);
-      partKeyVector->set(lineItemCount + l, line.partkey);
-      suppKeyVector->set(lineItemCount + l, line.suppkey);
-
-      lineNumberVector->set(lineItemCount + l, line.lcnt);
-
-      quantityVector->set(lineItemCount + l, line.quantity);
-      extendedPriceVector->set(lineItemCount + l, decimalToDouble(line.eprice));
-      discountVector->set(lineItemCount + l, decimalToDouble(line.discount));
-      taxVector->set(lineItemCount + l, decimalToDouble(line.tax));
-
-      returnFlagVector->set(lineItemCount + l, StringView(line.rflag, 1));
-      lineStatusVector->set(lineItemCount + l, StringView(line.lstatus, 1));
-
-      shipDateVector->set(lineItemCount + l, toDate(line.sdate));
-      commitDateVector->set(lineItemCount + l, toDate(line.cdate));
-      receiptDateVector->set(lineItemCount + l, toDate(line.rdate));
-
-      shipInstructVector->set(
-          lineItemCount + l,
-          StringView(line.shipinstruct, strlen(line.shipinstruct)));
-      shipModeVector->set(
-          lineItemCount + l, StringView(line.shipmode, strlen(line.shipmode)));
-      commentVector->set(
-          lineItemCount + l, StringView(line.comment, strlen(line.comment)));
+      const auto row = lineItemCount + l;
+      setIfProjected(orderKeyVector, row, [&] { return line.okey; });
+      setIfProjected(partKeyVector, row, [&] { return line.partkey; });
+      setIfProjected(suppKeyVector, row, [&] { return line.suppkey; });
+
+      setIfProjected(lineNumberVector, row, [&] { return line.lcnt; });
+
+      setIfProjected(quantityVector, row, [&] { return line.quantity; });
+      setIfProjected(extendedPriceVector, row, [&] {
+        return decimalToDouble(line.eprice);
+      });
+      setIfProjected(discountVector, row, [&] {
+        return decimalToDouble(line.discount);
+      });
+      setIfProjected(taxVector, row, [&] { return decimalToDouble(line.tax); });
+
+      setIfProjected(returnFlagVector, row, [&] {
+        return StringView(line.rflag, 1);
+      });
+      setIfProjected(lineStatusVector, row, [&] {
+        return StringView(line.lstatus, 1);
+      });
+
+      setIfProjected(shipDateVector, row, [&] { return toDate(line.sdate); });
+      setIfProjected(commitDateVector, row, [&] { return toDate(line.cdate); });
+      setIfProjected(receiptDateVector, row, [&] {
+        return toDate(line.rdate);
+      });
+
+      setIfProjected(shipInstructVector, row, [&] {
+        return StringView(line.shipinstruct, strlen(line.shipinstruct));
+      });
+      setIfProjected(shipModeVector, row, [&] {
+        return StringView(line.shipmode, strlen(line.shipmode));
+      });
+      setIfProjected(commentVector, row, [&] {
+        return StringView(line.comment, strlen(line.comment));
+      });
     }
     lineItemCount += order.lines;
   }
@@ -493,12 +543,13 @@ RowVectorPtr genTpchPart(
     memory::MemoryPool* pool,
     size_t maxRows,
     size_t offset,
-    double scaleFactor) {
+    double scaleFactor,
+    const std::optional<std::vector<column_index_t>>& columns) {
   // Create schema and allocate vectors.
   auto partRowType = getTableSchema(Table::TBL_PART);
   size_t vectorSize =
       getVectorSize(getRowCount(Table::TBL_PART, scaleFactor), maxRows, offset);
-  auto children = allocateVectors(partRowType, vectorSize, pool);
+  auto children = allocateVectors(partRowType, vectorSize, pool, columns);
 
   auto partKeyVector = children[0]->asFlatVector<int64_t>();
   auto nameVector = children[1]->asFlatVector<StringView>();
@@ -512,6 +563,7 @@ RowVectorPtr genTpchPart(
 
   DBGenIterator dbgenIt(scaleFactor);
   dbgenIt.initPart(offset);
+  dbgenIt.skipComments(commentVector == nullptr, true);
   part_t part;
 
   // Dbgen generates the dataset one row at a time, so we need to transpose it
@@ -519,15 +571,29 @@ RowVectorPtr genTpchPart(
   for (size_t i = 0; i < vectorSize; ++i) {
     dbgenIt.genPart(i + offset + 1, part);
 
-    partKeyVector->set(i, part.partkey);
-    nameVector->set(i, StringView(part.name, strlen(part.name)));
-    mfgrVector->set(i, StringView(part.mfgr, strlen(part.mfgr)));
-    brandVector->set(i, StringView(part.brand, strlen(part.brand)));
-    typeVector->set(i, StringView(part.type, part.tlen));
-    sizeVector->set(i, part.size);
-    containerVector->set(i, StringView(part.container, strlen(part.container)));
-    retailPriceVector->set(i, decimalToDouble(part.retailprice));
-    commentVector->set(i, StringView(part.comment, part.clen));
+    setIfProjected(partKeyVector, i, [&] { return part.partkey; });
+    setIfProjected(nameVector, i, [&] {
+      return StringView(part.name, strlen(part.name));
+    });
+    setIfProjected(mfgrVector, i, [&] {
+      return StringView(part.mfgr, strlen(part.mfgr));
+    });
+    setIfProjected(brandVector, i, [&] {
+      return StringView(part.brand, strlen(part.brand));
+    });
+    setIfProjected(typeVector, i, [&] {
+      return StringView(part.type, part.tlen);
+    });
+    setIfProjected(sizeVector, i, [&] { return part.size; });
+    setIfProjected(containerVector, i, [&] {
+      return StringView(part.container, strlen(part.container));
+    });
+    setIfProjected(retailPriceVector, i, [&] {
+      return decimalToDouble(part.retailprice);
+    });
+    setIfProjected(commentVector, i, [&] {
+      return StringView(part.comment, part.clen);
+    });
   }
   return std::make_shared<RowVector>(
       pool, partRowType, BufferPtr(nullptr), vectorSize, std::move(children));
@@ -537,12 +603,13 @@ RowVectorPtr genTpchSupplier(
     memory::MemoryPool* pool,
     size_t maxRows,
     size_t offset,
-    double scaleFactor) {
+    double scaleFactor,
+    const std::optional<std::vector<column_index_t>>& columns) {
   // Create schema and allocate vectors.
   auto supplierRowType = getTableSchema(Table::TBL_SUPPLIER);
   size_t vectorSize = getVectorSize(
       getRowCount(Table::TBL_SUPPLIER, scaleFactor), maxRows, offset);
-  auto children = allocateVectors(supplierRowType, vectorSize, pool);
+  auto children = allocateVectors(supplierRowType, vectorSize, pool, columns);
 
   auto suppKeyVector = children[0]->asFlatVector<int64_t>();
   auto nameVector = children[1]->asFlatVector<StringView>();
@@ -554,6 +621,7 @@ RowVectorPtr genTpchSupplier(
 
   DBGenIterator dbgenIt(scaleFactor);
   dbgenIt.initSupplier(offset);
+  dbgenIt.skipComments(commentVector == nullptr, false);
   supplier_t supp;
 
   // Dbgen generates the dataset one row at a time, so we need to transpose it
@@ -561,13 +629,23 @@ RowVectorPtr genTpchSupplier(
   for (size_t i = 0; i < vectorSize; ++i) {
     dbgenIt.genSupplier(i + offset + 1, supp);
 
-    suppKeyVector->set(i, supp.suppkey);
-    nameVector->set(i, StringView(supp.name, strlen(supp.name)));
-    addressVector->set(i, StringView(supp.address, supp.alen));
-    nationKeyVector->set(i, supp.nation_code);
-    phoneVector->set(i, StringView(supp.phone, strlen(supp.phone)));
-    acctbalVector->set(i, decimalToDouble(supp.acctbal));
-    commentVector->set(i, StringView(supp.comment, supp.clen));
+    setIfProjected(suppKeyVector, i, [&] { return supp.suppkey; });
+    setIfProjected(nameVector, i, [&] {
+      return StringView(supp.name, strlen(supp.name));
+    });
+    setIfProjected(addressVector, i, [&] {
+      return StringView(supp.address, supp.alen);
+    });
+    setIfProjected(nationKeyVector, i, [&] { return supp.nation_code; });
+    setIfProjected(phoneVector, i, [&] {
+      return StringView(supp.phone, strlen(supp.phone));
+    });
+    setIfProjected(acctbalVector, i, [&] {
+      return decimalToDouble(supp.acctbal);
+    });
+    setIfProjected(commentVector, i, [&] {
+      return StringView(supp.comment, supp.clen);
+    });
   }
   return std::make_shared<RowVector>(
       pool,
@@ -581,12 +659,13 @@ RowVectorPtr genTpchPartSupp(
     memory::MemoryPool* pool,
     size_t maxRows,
     size_t offset,
-    double scaleFactor) {
+    double scaleFactor,
+    const std::optional<std::vector<column_index_t>>& columns) {
   // Create schema and allocate vectors.
   auto partSuppRowType = getTableSchema(Table::TBL_PARTSUPP);
   size_t vectorSize = getVectorSize(
       getRowCount(Table::TBL_PARTSUPP, scaleFactor), maxRows, offset);
-  auto children = allocateVectors(partSuppRowType, vectorSize, pool);
+  auto children = allocateVectors(partSuppRowType, vectorSize, pool, columns);
 
   auto partKeyVector = children[0]->asFlatVector<int64_t>();
   auto suppKeyVector = children[1]->asFlatVector<int64_t>();
@@ -606,6 +685,7 @@ RowVectorPtr genTpchPartSupp(
   size_t partSuppCount = 0;
 
   dbgenIt.initPart(partIdx);
+  dbgenIt.skipComments(true, commentVector == nullptr);
 
   do {
     dbgenIt.genPart(partIdx + 1, part);
@@ -613,12 +693,21 @@ RowVectorPtr genTpchPartSupp(
     while ((partSuppIdx < SUPP_PER_PART) && (partSuppCount < vectorSize)) {
       const auto& partSupp = part.s[partSuppIdx];
 
-      partKeyVector->set(partSuppCount, partSupp.partkey);
-      suppKeyVector->set(partSuppCount, partSupp.suppkey);
-      availQtyVector->set(partSuppCount, partSupp.qty);
-      supplyCostVector->set(partSuppCount, decimalToDouble(partSupp.scost));
-      commentVector->set(
-          partSuppCount, StringView(partSupp.comment, partSupp.clen));
+      setIfProjected(partKeyVector, partSuppCount, [&] {
+        return partSupp.partkey;
+      });
+      setIfProjected(suppKeyVector, partSuppCount, [&] {
+        return partSupp.suppkey;
+      });
+      setIfProjected(availQtyVector, partSuppCount, [&] {
+        return partSupp.qty;
+      });
+      setIfProjected(supplyCostVector, partSuppCount, [&] {
+        return decimalToDouble(partSupp.scost);
+      });
+      setIfProjected(commentVector, partSuppCount, [&] {
+        return StringView(partSupp.comment, partSupp.clen);
+      });
 
       ++partSuppIdx;
       ++partSuppCount;
@@ -641,12 +730,13 @@ RowVectorPtr genTpchCustomer(
     memory::MemoryPool* pool,
     size_t maxRows,
     size_t offset,
-    double scaleFactor) {
+    double scaleFactor,
+    const std::optional<std::vector<column_index_t>>& columns) {
   // Create schema and allocate vectors.
   auto customerRowType = getTableSchema(Table::TBL_CUSTOMER);
   size_t vectorSize = getVectorSize(
       getRowCount(Table::TBL_CUSTOMER, scaleFactor), maxRows, offset);
-  auto children = allocateVectors(customerRowType, vectorSize, pool);
+  auto children = allocateVectors(customerRowType, vectorSize, pool, columns);
 
   auto custKeyVector = children[0]->asFlatVector<int64_t>();
   auto nameVector = children[1]->asFlatVector<StringView>();
@@ -659,6 +749,7 @@ RowVectorPtr genTpchCustomer(
 
   DBGenIterator dbgenIt(scaleFactor);
   dbgenIt.initCustomer(offset);
+  dbgenIt.skipComments(commentVector == nullptr, false);
   customer_t cust;
 
   // Dbgen generates the dataset one row at a time, so we need to transpose it
@@ -666,15 +757,26 @@ RowVectorPtr genTpchCustomer(
   for (size_t i = 0; i < vectorSize; ++i) {
     dbgenIt.genCustomer(i + offset + 1, cust);
 
-    custKeyVector->set(i, cust.custkey);
-    nameVector->set(i, StringView(cust.name, strlen(cust.name)));
-    addressVector->set(i, StringView(cust.address, cust.alen));
-    nationKeyVector->set(i, cust.nation_code);
-    phoneVector->set(i, StringView(cust.phone, strlen(cust.phone)));
-    acctBalVector->set(i, decimalToDouble(cust.acctbal));
-    mktSegmentVector->set(
-        i, StringView(cust.mktsegment, strlen(cust.mktsegment)));
-    commentVector->set(i, StringView(cust.comment, cust.clen));
+    setIfProjected(custKeyVector, i, [&] { return cust.custkey; });
+    setIfProjected(nameVector, i, [&] {
+      return StringView(cust.name, strlen(cust.name));
+    });
+    setIfProjected(addressVector, i, [&] {
+      return StringView(cust.address, cust.alen);
+    });
+    setIfProjected(nationKeyVector, i, [&] { return cust.nation_code; });
+    setIfProjected(phoneVector, i, [&] {
+      return StringView(cust.phone, strlen(cust.phone));
+    });
+    setIfProjected(acctBalVector, i, [&] {
+      return decimalToDouble(cust.acctbal);
+    });
+    setIfProjected(mktSegmentVector, i, [&] {
+      return StringView(cust.mktsegment, strlen(cust.mktsegment));
+    });
+    setIfProjected(commentVector, i, [&] {
+      return StringView(cust.comment, cust.clen);
+    });
   }
   return std::make_shared<RowVector>(
       pool,
@@ -688,12 +790,13 @@ RowVectorPtr genTpchNation(
     memory::MemoryPool* pool,
     size_t maxRows,
     size_t offset,
-    double scaleFactor) {
+    double scaleFactor,
+    const std::optional<std::vector<column_index_t>>& columns) {
   // Create schema and allocate vectors.
   auto nationRowType = getTableSchema(Table::TBL_NATION);
   size_t vectorSize = getVectorSize(
       getRowCount(Table::TBL_NATION, scaleFactor), maxRows, offset);
-  auto children = allocateVectors(nationRowType, vectorSize, pool);
+  auto children = allocateVectors(nationRowType, vectorSize, pool, columns);
 
   auto nationKeyVector = children[0]->asFlatVector<int64_t>();
   auto nameVector = children[1]->asFlatVector<StringView>();
@@ -702,6 +805,7 @@ RowVectorPtr genTpchNation(
 
   DBGenIterator dbgenIt(scaleFactor);
   dbgenIt.initNation(offset);
+  dbgenIt.skipComments(commentVector == nullptr, false);
   code_t code;
 
   // Dbgen generates the dataset one row at a time, so we need to transpose it
@@ -709,10 +813,14 @@ RowVectorPtr genTpchNation(
   for (size_t i = 0; i < vectorSize; ++i) {
     dbgenIt.genNation(i + offset + 1, code);
 
-    nationKeyVector->set(i, code.code);
-    nameVector->set(i, StringView(code.text, strlen(code.text)));
-    regionKeyVector->set(i, code.join);
-    commentVector->set(i, StringView(code.comment, code.clen));
+    setIfProjected(nationKeyVector, i, [&] { return code.code; });
+    setIfProjected(nameVector, i, [&] {
+      return StringView(code.text, strlen(code.text));
+    });
+    setIfProjected(regionKeyVector, i, [&] { return code.join; });
+    setIfProjected(commentVector, i, [&] {
+      return StringView(code.comment, code.clen);
+    });
   }
   return std::make_shared<RowVector>(
       pool, nationRowType, BufferPtr(nullptr), vectorSize, std::move(children));
@@ -722,12 +830,13 @@ RowVectorPtr genTpchRegion(
     memory::MemoryPool* pool,
     size_t maxRows,
     size_t offset,
-    double scaleFactor) {
+    double scaleFactor,
+    const std::optional<std::vector<column_index_t>>& columns) {
   // Create schema and allocate vectors.
   auto regionRowType = getTableSchema(Table::TBL_REGION);
   size_t vectorSize = getVectorSize(
       getRowCount(Table::TBL_REGION, scaleFactor), maxRows, offset);
-  auto children = allocateVectors(regionRowType, vectorSize, pool);
+  auto children = allocateVectors(regionRowType, vectorSize, pool, columns);
 
   auto regionKeyVector = children[0]->asFlatVector<int64_t>();
   auto nameVector = children[1]->asFlatVector<StringView>();
@@ -735,6 +844,7 @@ RowVectorPtr genTpchRegion(
 
   DBGenIterator dbgenIt(scaleFactor);
   dbgenIt.initRegion(offset);
+  dbgenIt.skipComments(commentVector == nullptr, false);
   code_t code;
 
   // Dbgen generates the dataset one row at a time, so we need to transpose it
@@ -742,9 +852,13 @@ RowVectorPtr genTpchRegion(
   for (size_t i = 0; i < vectorSize; ++i) {
     dbgenIt.genRegion(i + offset + 1, code);
 
-    regionKeyVector->set(i, code.code);
-    nameVector->set(i, StringView(code.text, strlen(code.text)));
-    commentVector->set(i, StringView(code.comment, code.clen));
+    setIfProjected(regionKeyVector, i, [&] { return code.code; });
+    setIfProjected(nameVector, i, [&] {
+      return StringView(code.text, strlen(code.text));
+    });
+    setIfProjected(commentVector, i, [&] {
+      return StringView(code.comment, code.clen);
+    });
   }
   return std::make_shared<RowVector>(
       pool, regionRowType, BufferPtr(nullptr), vectorSize, std::move(children));
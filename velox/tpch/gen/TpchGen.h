@@ -34,6 +34,11 @@ namespace facebook::velox::tpch {
 /// offset, less than maxRows records might be returned.
 ///
 /// Data is always returned in a RowVector.
+///
+/// The optional `columns` are the indices in the table schema of the columns
+/// to generate. The other columns are null constants, which saves building
+/// their values, most notably the random comment texts. All the columns are
+/// generated by default.
 
 enum class Table : uint8_t {
   TBL_PART,
@@ -93,7 +98,8 @@ RowVectorPtr genTpchOrders(
     memory::MemoryPool* pool,
     size_t maxRows = 10000,
     size_t offset = 0,
-    double scaleFactor = 1);
+    double scaleFactor = 1,
+    const std::optional<std::vector<column_index_t>>& columns = std::nullopt);
 
 /// NOTE: This function's parameters have different semantic from the function
 /// above. Dbgen does not provide deterministic random access to lineitem
@@ -131,7 +137,8 @@ RowVectorPtr genTpchLineItem(
     memory::MemoryPool* pool,
     size_t maxOrdersRows = 10000,
     size_t ordersOffset = 0,
-    double scaleFactor = 1);
+    double scaleFactor = 1,
+    const std::optional<std::vector<column_index_t>>& columns = std::nullopt);
 
 /// Returns a row vector containing at most `maxRows` rows of the "part"
 /// table, starting at `offset`, and given the scale factor. The row vector
@@ -151,7 +158,8 @@ RowVectorPtr genTpchPart(
     memory::MemoryPool* pool,
     size_t maxRows = 10000,
     size_t offset = 0,
-    double scaleFactor = 1);
+    double scaleFactor = 1,
+    const std::optional<std::vector<column_index_t>>& columns = std::nullopt);
 
 /// Returns a row vector containing at most `maxRows` rows of the "supplier"
 /// table, starting at `offset`, and given the scale factor. The row vector
@@ -169,7 +177,8 @@ RowVectorPtr genTpchSupplier(
     memory::MemoryPool* pool,
     size_t maxRows = 10000,
     size_t offset = 0,
-    double scaleFactor = 1);
+    double scaleFactor = 1,
+    const std::optional<std::vector<column_index_t>>& columns = std::nullopt);
 
 /// Returns a row vector containing at most `maxRows` rows of the "partsupp"
 /// table, starting at `offset`, and given the scale factor. The row vector
@@ -185,7 +194,8 @@ RowVectorPtr genTpchPartSupp(
     memory::MemoryPool* pool,
     size_t maxRows = 10000,
     size_t offset = 0,
-    double scaleFactor = 1);
+    double scaleFactor = 1,
+    const std::optional<std::vector<column_index_t>>& columns = std::nullopt);
 
 /// Returns a row vector containing at most `maxRows` rows of the "customer"
 /// table, starting at `offset`, and given the scale factor. The row vector
@@ -204,7 +214,8 @@ RowVectorPtr genTpchCustomer(
     memory::MemoryPool* pool,
     size_t maxRows = 10000,
     size_t offset = 0,
-    double scaleFactor = 1);
+    double scaleFactor = 1,
+    const std::optional<std::vector<column_index_t>>& columns = std::nullopt);
 
 /// Returns a row vector containing at most `maxRows` rows of the "nation"
 /// table, starting at `offset`, and given the scale factor. The row vector
@@ -219,7 +230,8 @@ RowVectorPtr genTpchNation(
     memory::MemoryPool* pool,
     size_t maxRows = 10000,
     size_t offset = 0,
-    double scaleFactor = 1);
+    double scaleFactor = 1,
+    const std::optional<std::vector<column_index_t>>& columns = std::nullopt);
 
 /// Returns a row vector containing at most `maxRows` rows of the "region"
 /// table, starting at `offset`, and given the scale factor. The row vector
@@ -233,7 +245,8 @@ RowVectorPtr genTpchRegion(
     memory::MemoryPool* pool,
     size_t maxRows = 10000,
     size_t offset = 0,
-    double scaleFactor = 1);
+    double scaleFactor = 1,
+    const std::optional<std::vector<column_index_t>>& columns = std::nullopt);
 
 /// Gets the specified TPC-H query number as a string.
 std::string getQuery(int query);
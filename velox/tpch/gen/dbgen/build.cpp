@@ -132,7 +132,10 @@ long mk_cust(DSS_HUGE n_cust, customer_t* c, DBGenContext* ctx) {
   gen_phone(i, c->phone, &ctx->Seed[C_PHNE_SD]);
   RANDOM(c->acctbal, C_ABAL_MIN, C_ABAL_MAX, &ctx->Seed[C_ABAL_SD]);
   pick_str(&c_mseg_set, &ctx->Seed[C_MSEG_SD], c->mktsegment);
-  TEXT(C_CMNT_LEN, &ctx->Seed[C_CMNT_SD], c->comment);
+  if (ctx->skip_master_comment)
+    c->comment[0] = '\0';
+  else
+    TEXT(C_CMNT_LEN, &ctx->Seed[C_CMNT_SD], c->comment);
   c->clen = static_cast<int>(strlen(c->comment));
 
   return (0);
@@ -190,7 +193,10 @@ long mk_order(DSS_HUGE index, order_t* o, DBGenContext* ctx, long upd_num) {
       MAX((ctx->scale_factor * O_CLRK_SCL), O_CLRK_SCL),
       &ctx->Seed[O_CLRK_SD]);
   sprintf(o->clerk, orderSzFormat, O_CLRK_TAG, clk_num);
-  TEXT(O_CMNT_LEN, &ctx->Seed[O_CMNT_SD], o->comment);
+  if (ctx->skip_master_comment)
+    o->comment[0] = '\0';
+  else
+    TEXT(O_CMNT_LEN, &ctx->Seed[O_CMNT_SD], o->comment);
   o->clen = static_cast<int>(strlen(o->comment));
 #ifdef DEBUG
   if (o->clen > O_CMNT_MAX)
@@ -212,7 +218,10 @@ long mk_order(DSS_HUGE index, order_t* o, DBGenContext* ctx, long upd_num) {
     RANDOM(o->l[lcnt].tax, L_TAX_MIN, L_TAX_MAX, &ctx->Seed[L_TAX_SD]);
     pick_str(&l_instruct_set, &ctx->Seed[L_SHIP_SD], o->l[lcnt].shipinstruct);
     pick_str(&l_smode_set, &ctx->Seed[L_SMODE_SD], o->l[lcnt].shipmode);
-    TEXT(L_CMNT_LEN, &ctx->Seed[L_CMNT_SD], o->l[lcnt].comment);
+    if (ctx->skip_detail_comment)
+      o->l[lcnt].comment[0] = '\0';
+    else
+      TEXT(L_CMNT_LEN, &ctx->Seed[L_CMNT_SD], o->l[lcnt].comment);
     o->l[lcnt].clen = static_cast<int>(strlen(o->l[lcnt].comment));
     if (ctx->scale_factor >= 30000)
       RANDOM64(
@@ -278,7 +287,10 @@ long mk_part(DSS_HUGE index, part_t* p, DBGenContext* ctx) {
   RANDOM(p->size, P_SIZE_MIN, P_SIZE_MAX, &ctx->Seed[P_SIZE_SD]);
   pick_str(&p_cntr_set, &ctx->Seed[P_CNTR_SD], p->container);
   p->retailprice = rpb_routine(index);
-  TEXT(P_CMNT_LEN, &ctx->Seed[P_CMNT_SD], p->comment);
+  if (ctx->skip_master_comment)
+    p->comment[0] = '\0';
+  else
+    TEXT(P_CMNT_LEN, &ctx->Seed[P_CMNT_SD], p->comment);
   p->clen = static_cast<int>(strlen(p->comment));
 
   for (snum = 0; snum < SUPP_PER_PART; snum++) {
@@ -286,7 +298,10 @@ long mk_part(DSS_HUGE index, part_t* p, DBGenContext* ctx) {
     PART_SUPP_BRIDGE(p->s[snum].suppkey, index, snum);
     RANDOM(p->s[snum].qty, PS_QTY_MIN, PS_QTY_MAX, &ctx->Seed[PS_QTY_SD]);
     RANDOM(p->s[snum].scost, PS_SCST_MIN, PS_SCST_MAX, &ctx->Seed[PS_SCST_SD]);
-    TEXT(PS_CMNT_LEN, &ctx->Seed[PS_CMNT_SD], p->s[snum].comment);
+    if (ctx->skip_detail_comment)
+      p->s[snum].comment[0] = '\0';
+    else
+      TEXT(PS_CMNT_LEN, &ctx->Seed[PS_CMNT_SD], p->s[snum].comment);
     p->s[snum].clen = static_cast<int>(strlen(p->s[snum].comment));
   }
   return (0);
@@ -304,6 +319,11 @@ long mk_supp(DSS_HUGE index, supplier_t* s, DBGenContext* ctx) {
   gen_phone(i, s->phone, &ctx->Seed[S_PHNE_SD]);
   RANDOM(s->acctbal, S_ABAL_MIN, S_ABAL_MAX, &ctx->Seed[S_ABAL_SD]);
 
+  if (ctx->skip_master_comment) {
+    s->comment[0] = '\0';
+    s->clen = 0;
+    return (0);
+  }
   TEXT(S_CMNT_LEN, &ctx->Seed[S_CMNT_SD], s->comment);
   s->clen = static_cast<int>(strlen(s->comment));
   /*
@@ -376,7 +396,10 @@ int mk_nation(DSS_HUGE index, code_t* c, DBGenContext* ctx) {
   c->code = index - 1;
   c->text = nations.list[index - 1].text;
   c->join = nations.list[index - 1].weight;
-  TEXT(N_CMNT_LEN, &ctx->Seed[N_CMNT_SD], c->comment);
+  if (ctx->skip_master_comment)
+    c->comment[0] = '\0';
+  else
+    TEXT(N_CMNT_LEN, &ctx->Seed[N_CMNT_SD], c->comment);
   c->clen = static_cast<int>(strlen(c->comment));
   return (0);
 }
@@ -385,7 +408,10 @@ int mk_region(DSS_HUGE index, code_t* c, DBGenContext* ctx) {
   c->code = index - 1;
   c->text = regions.list[index - 1].text;
   c->join = 0; /* for completeness */
-  TEXT(R_CMNT_LEN, &ctx->Seed[R_CMNT_SD], c->comment);
+  if (ctx->skip_master_comment)
+    c->comment[0] = '\0';
+  else
+    TEXT(R_CMNT_LEN, &ctx->Seed[R_CMNT_SD], c->comment);
   c->clen = static_cast<int>(strlen(c->comment));
   return (0);
 }
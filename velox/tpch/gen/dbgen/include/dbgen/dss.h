@@ -590,6 +590,12 @@ struct DBGenContext {
   };
 
   long scale_factor = 1;
+
+  /* If set, the mk_*() functions leave the comments of the master (e.g.
+   * orders) or detail (e.g. lineitem) rows empty. row_stop_h() still skips
+   * their seeds, so the other columns are unchanged. */
+  bool skip_master_comment = false;
+  bool skip_detail_comment = false;
 };
 
 } // namespace facebook::velox::tpch::dbgen
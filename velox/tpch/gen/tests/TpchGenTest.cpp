@@ -427,6 +427,31 @@ TEST_F(TpchGenTestLineItemTest, reproducible) {
   }
 }
 
+TEST_F(TpchGenTestLineItemTest, projectedColumns) {
+  auto full = genTpchLineItem(pool_.get(), 1000, 2000);
+
+  // The columns are the same when the comments are not generated.
+  const std::vector<column_index_t> columns{10, 0, 4};
+  auto projected = genTpchLineItem(pool_.get(), 1000, 2000, 1, columns);
+  ASSERT_EQ(full->size(), projected->size());
+  for (auto column = 0; column < full->childrenSize(); ++column) {
+    const auto& child = projected->childAt(column);
+    if (std::find(columns.begin(), columns.end(), column) == columns.end()) {
+      ASSERT_TRUE(child->isConstantEncoding());
+      ASSERT_TRUE(child->isNullAt(0));
+      continue;
+    }
+    for (auto i = 0; i < full->size(); ++i) {
+      ASSERT_TRUE(child->equalValueAt(full->childAt(column).get(), i, i));
+    }
+  }
+
+  // No columns still generates the rows.
+  auto empty = genTpchLineItem(
+      pool_.get(), 1000, 2000, 1, std::vector<column_index_t>{});
+  ASSERT_EQ(full->size(), empty->size());
+}
+
 // Supplier.
 class TpchGenTestSupplierTest : public testing::Test {
  protected:
@@ -523,6 +548,28 @@ TEST_F(TpchGenTestSupplierTest, reproducible) {
   }
 }
 
+TEST_F(TpchGenTestSupplierTest, projectedColumns) {
+  auto full = genTpchSupplier(pool_.get(), 1'000, 500);
+  auto projected = genTpchSupplier(
+      pool_.get(), 1'000, 500, 1, std::vector<column_index_t>{0, 2, 5});
+  ASSERT_EQ(full->size(), projected->size());
+  for (auto column : {0, 2, 5}) {
+    for (auto i = 0; i < full->size(); ++i) {
+      ASSERT_TRUE(projected->childAt(column)->equalValueAt(
+          full->childAt(column).get(), i, i));
+    }
+  }
+  ASSERT_TRUE(projected->childAt(6)->isConstantEncoding());
+
+  // Only the comment.
+  projected = genTpchSupplier(
+      pool_.get(), 1'000, 500, 1, std::vector<column_index_t>{6});
+  for (auto i = 0; i < full->size(); ++i) {
+    ASSERT_TRUE(
+        projected->childAt(6)->equalValueAt(full->childAt(6).get(), i, i));
+  }
+}
+
 // Part.
 class TpchGenTestPartTest : public testing::Test {
  protected:
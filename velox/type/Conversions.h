@@ -18,7 +18,9 @@
 
 #include <folly/Conv.h>
 #include <folly/Expected.h>
+#include <folly/lang/Bits.h>
 #include <cctype>
+#include <cstring>
 #include <string>
 #include <type_traits>
 #include "velox/common/base/Exceptions.h"
@@ -147,6 +149,66 @@ Expected<T> callFollyTo(const F& v) {
   return result.value();
 }
 
+/// Returns true if all 8 bytes of 'chunk' are ASCII digits.
+inline bool isEightDigits(uint64_t chunk) {
+  return ((chunk & 0xF0F0F0F0F0F0F0F0) |
+          (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) ==
+      0x3333333333333333;
+}
+
+/// Converts 8 ASCII digits packed little-endian into 'chunk' to their value
+/// with three multiplications instead of eight.
+inline uint32_t parseEightDigits(uint64_t chunk) {
+  constexpr uint64_t kMask = 0x000000FF000000FF;
+  // 100 + (1000000 << 32).
+  constexpr uint64_t kMul1 = 0x000F424000000064;
+  // 1 + (10000 << 32).
+  constexpr uint64_t kMul2 = 0x0000271000000001;
+  chunk -= 0x3030303030303030;
+  chunk = (chunk * 10) + (chunk >> 8);
+  return static_cast<uint32_t>(
+      (((chunk & kMask) * kMul1) + (((chunk >> 16) & kMask) * kMul2)) >> 32);
+}
+
+/// Parses an optionally signed string of 1 to 18 ASCII digits into 'result'.
+/// Returns false for any other input, including empty strings, embedded
+/// spaces and longer digit runs, in which case the caller falls back to the
+/// general parser so that error messages stay unchanged.
+inline bool tryParseShortInteger(std::string_view v, int64_t& result) {
+  constexpr size_t kMaxDigits = 18;
+  const char* data = v.data();
+  size_t size = v.size();
+  bool negative = false;
+  if (size > 0 && (data[0] == '-' || data[0] == '+')) {
+    negative = data[0] == '-';
+    ++data;
+    --size;
+  }
+  if (size == 0 || size > kMaxDigits) {
+    return false;
+  }
+  uint64_t value = 0;
+  for (; size >= 8; data += 8, size -= 8) {
+    uint64_t chunk;
+    std::memcpy(&chunk, data, sizeof(chunk));
+    chunk = folly::Endian::little(chunk);
+    if (!isEightDigits(chunk)) {
+      return false;
+    }
+    value = value * 100'000'000 + parseEightDigits(chunk);
+  }
+  for (size_t i = 0; i < size; ++i) {
+    const uint8_t digit = data[i] - '0';
+    if (digit > 9) {
+      return false;
+    }
+    value = value * 10 + digit;
+  }
+  result = negative ? -static_cast<int64_t>(value)
+                    : static_cast<int64_t>(value);
+  return true;
+}
+
 } // namespace detail
 
 /// To BOOLEAN converter.
@@ -328,12 +390,29 @@ struct Converter<
     return result;
   }
 
+  /// Converts a string without leading or trailing white space. Short digit
+  /// strings take a word-at-a-time fast path; everything else, including all
+  /// invalid and out-of-range input, goes through folly.
+  static Expected<T> convertTrimmedString(std::string_view trimmed) {
+    int64_t value;
+    if (detail::tryParseShortInteger(trimmed, value)) {
+      if constexpr (sizeof(T) >= sizeof(int64_t)) {
+        return static_cast<T>(value);
+      } else {
+        if (value >= std::numeric_limits<T>::min() &&
+            value <= std::numeric_limits<T>::max()) {
+          return static_cast<T>(value);
+        }
+      }
+    }
+    return detail::callFollyTo<T>(trimmed);
+  }
+
   static Expected<T> tryCast(folly::StringPiece v) {
     if constexpr (TPolicy::truncate) {
       return convertStringToInt(v);
     } else {
-      auto trimmed = trimWhiteSpace(v.data(), v.size());
-      return detail::callFollyTo<T>(trimmed);
+      return convertTrimmedString(trimWhiteSpace(v.data(), v.size()));
     }
   }
 
@@ -341,8 +420,7 @@ struct Converter<
     if constexpr (TPolicy::truncate) {
       return convertStringToInt(folly::StringPiece(v));
     } else {
-      auto trimmed = trimWhiteSpace(v.data(), v.size());
-      return detail::callFollyTo<T>(trimmed);
+      return convertTrimmedString(trimWhiteSpace(v.data(), v.size()));
     }
   }
 
@@ -350,8 +428,7 @@ struct Converter<
     if constexpr (TPolicy::truncate) {
       return convertStringToInt(v);
     } else {
-      auto trimmed = trimWhiteSpace(v.data(), v.length());
-      return detail::callFollyTo<T>(trimmed);
+      return convertTrimmedString(trimWhiteSpace(v.data(), v.length()));
     }
   }
 
@@ -94,6 +94,9 @@ std::string Filter::toString() const {
     case FilterKind::kHugeintValuesUsingHashTable:
       strKind = "HugeintValuesUsingHashTable";
       break;
+    case FilterKind::kBigintValuesUsingBloomFilter:
+      strKind = "BigintValuesUsingBloomFilter";
+      break;
   };
 
   return fmt::format(
@@ -131,6 +134,8 @@ std::unordered_map<FilterKind, std::string> filterKindNames() {
       {FilterKind::kTimestampRange, "kTimestampRange"},
       {FilterKind::kHugeintValuesUsingHashTable,
        "kHugeintValuesUsingHashTable"},
+      {FilterKind::kBigintValuesUsingBloomFilter,
+       "kBigintValuesUsingBloomFilter"},
   };
 }
 
@@ -182,6 +187,8 @@ void Filter::registerSerDe() {
       "BigintValuesUsingHashTable", BigintValuesUsingHashTable::create);
   registry.Register(
       "BigintValuesUsingBitmask", BigintValuesUsingBitmask::create);
+  registry.Register(
+      "BigintValuesUsingBloomFilter", BigintValuesUsingBloomFilter::create);
   registry.Register(
       "NegatedBigintValuesUsingHashTable",
       NegatedBigintValuesUsingHashTable::create);
@@ -437,6 +444,68 @@ bool BigintValuesUsingBitmask::testingEquals(const Filter& other) const {
   return true;
 }
 
+folly::dynamic BigintValuesUsingBloomFilter::serialize() const {
+  auto obj = Filter::serializeBase("BigintValuesUsingBloomFilter");
+  obj["min"] = min_;
+  obj["max"] = max_;
+
+  std::string serialized(bloomFilter_->serializedSize(), '\0');
+  bloomFilter_->serialize(serialized.data());
+  folly::dynamic bloom = folly::dynamic::array;
+  for (auto byte : serialized) {
+    bloom.push_back(static_cast<int64_t>(static_cast<uint8_t>(byte)));
+  }
+  obj["bloomFilter"] = bloom;
+  if (conjunct_) {
+    obj["conjunct"] = conjunct_->serialize();
+  }
+  return obj;
+}
+
+std::unique_ptr<Filter> BigintValuesUsingBloomFilter::create(
+    const folly::dynamic& obj) {
+  auto min = obj["min"].asInt();
+  auto max = obj["max"].asInt();
+  auto nullAllowed = deserializeNullAllowed(obj);
+
+  const auto& bloomArray = obj["bloomFilter"];
+  std::string serialized;
+  serialized.reserve(bloomArray.size());
+  for (const auto& byte : bloomArray) {
+    serialized.push_back(static_cast<char>(byte.asInt()));
+  }
+  auto bloomFilter = std::make_shared<BloomFilter<>>();
+  bloomFilter->merge(serialized.data());
+
+  std::shared_ptr<const Filter> conjunct;
+  if (obj.count("conjunct")) {
+    conjunct = ISerializable::deserialize<Filter>(obj["conjunct"]);
+  }
+  return std::make_unique<BigintValuesUsingBloomFilter>(
+      min, max, std::move(bloomFilter), nullAllowed, std::move(conjunct));
+}
+
+bool BigintValuesUsingBloomFilter::testingEquals(const Filter& other) const {
+  auto otherBloom = dynamic_cast<const BigintValuesUsingBloomFilter*>(&other);
+  if (otherBloom == nullptr || !Filter::testingBaseEquals(other) ||
+      min_ != otherBloom->min_ || max_ != otherBloom->max_) {
+    return false;
+  }
+  if ((conjunct_ == nullptr) != (otherBloom->conjunct_ == nullptr) ||
+      (conjunct_ && !conjunct_->testingEquals(*otherBloom->conjunct_))) {
+    return false;
+  }
+  const auto size = bloomFilter_->serializedSize();
+  if (size != otherBloom->bloomFilter_->serializedSize()) {
+    return false;
+  }
+  std::string bits(size, '\0');
+  std::string otherBits(size, '\0');
+  bloomFilter_->serialize(bits.data());
+  otherBloom->bloomFilter_->serialize(otherBits.data());
+  return bits == otherBits;
+}
+
 folly::dynamic NegatedBigintValuesUsingHashTable::serialize() const {
   auto obj = Filter::serializeBase("NegatedBigintValuesUsingHashTable");
   obj["nonNegated"] = nonNegated_->serialize();
@@ -622,6 +691,24 @@ std::unique_ptr<Filter> BytesValues::create(const folly::dynamic& obj) {
   return std::make_unique<BytesValues>(values, nullAllowed);
 }
 
+void BytesValues::initLookup() {
+  for (auto length : lengths_) {
+    if (length < 64) {
+      smallLengths_ |= 1ULL << length;
+    }
+  }
+  if (values_.size() < kMinValuesForPrefixBloom) {
+    return;
+  }
+  // About 8 bits per value.
+  prefixBloom_.resize(bits::nextPowerOfTwo(values_.size() / 8 + 1));
+  for (const auto& value : values_) {
+    const auto hash = prefixHash(value.data(), value.size());
+    prefixBloom_[(hash >> 32) & (prefixBloom_.size() - 1)] |=
+        prefixBloomMask(hash);
+  }
+}
+
 bool BytesValues::testingEquals(const Filter& other) const {
   auto otherBytesValues = dynamic_cast<const BytesValues*>(&other);
   auto res = otherBytesValues != nullptr && Filter::testingBaseEquals(other) &&
@@ -1869,6 +1956,7 @@ std::unique_ptr<Filter> BigintRange::mergeWith(const Filter* other) const {
     }
     case FilterKind::kNegatedBigintRange:
     case FilterKind::kBigintValuesUsingBitmask:
+    case FilterKind::kBigintValuesUsingBloomFilter:
     case FilterKind::kBigintValuesUsingHashTable:
       return other->mergeWith(this);
     case FilterKind::kBigintMultiRange: {
@@ -1998,6 +2086,7 @@ std::unique_ptr<Filter> NegatedBigintRange::mergeWith(
           otherMultiRanges->ranges(),
           bothNullAllowed);
     }
+    case FilterKind::kBigintValuesUsingBloomFilter:
     case FilterKind::kBigintValuesUsingHashTable:
     case FilterKind::kBigintValuesUsingBitmask:
       return other->mergeWith(this);
@@ -2054,6 +2143,7 @@ std::unique_ptr<Filter> BigintValuesUsingHashTable::mergeWith(
 
       return mergeWith(min, max, other);
     }
+    case FilterKind::kBigintValuesUsingBloomFilter:
     case FilterKind::kBigintValuesUsingBitmask:
       return other->mergeWith(this);
     case FilterKind::kBigintMultiRange: {
@@ -2172,6 +2262,8 @@ std::unique_ptr<Filter> BigintValuesUsingBitmask::mergeWith(
       bool bothNullAllowed = nullAllowed_ && other->testNull();
       return createBigintValues(valuesToKeep, bothNullAllowed);
     }
+    case FilterKind::kBigintValuesUsingBloomFilter:
+      return other->mergeWith(this);
     case FilterKind::kNegatedBigintRange:
     case FilterKind::kNegatedBigintValuesUsingBitmask:
     case FilterKind::kNegatedBigintValuesUsingHashTable: {
@@ -2197,6 +2289,100 @@ std::unique_ptr<Filter> BigintValuesUsingBitmask::mergeWith(
   return createBigintValues(valuesToKeep, bothNullAllowed);
 }
 
+BigintValuesUsingBloomFilter::BigintValuesUsingBloomFilter(
+    int64_t min,
+    int64_t max,
+    std::shared_ptr<const BloomFilter<>> bloomFilter,
+    bool nullAllowed,
+    std::shared_ptr<const Filter> conjunct)
+    : Filter(true, nullAllowed, FilterKind::kBigintValuesUsingBloomFilter),
+      min_(min),
+      max_(max),
+      bloomFilter_(std::move(bloomFilter)),
+      conjunct_(std::move(conjunct)) {
+  VELOX_CHECK_LE(
+      min,
+      max,
+      "BigintValuesUsingBloomFilter min must not exceed max. min: {}, max: {}",
+      min,
+      max);
+  VELOX_CHECK_NOT_NULL(bloomFilter_);
+  VELOX_CHECK(bloomFilter_->isSet());
+}
+
+bool BigintValuesUsingBloomFilter::testInt64Range(
+    int64_t min,
+    int64_t max,
+    bool hasNull) const {
+  if (hasNull && nullAllowed_) {
+    return true;
+  }
+  if (min == max) {
+    return testInt64(min);
+  }
+  if (min > max_ || max < min_) {
+    return false;
+  }
+  return conjunct_ == nullptr || conjunct_->testInt64Range(min, max, false);
+}
+
+std::unique_ptr<Filter> BigintValuesUsingBloomFilter::mergeWith(
+    const Filter* other) const {
+  switch (other->kind()) {
+    case FilterKind::kAlwaysTrue:
+    case FilterKind::kAlwaysFalse:
+    case FilterKind::kIsNull:
+      return other->mergeWith(this);
+    case FilterKind::kIsNotNull:
+      return std::make_unique<BigintValuesUsingBloomFilter>(*this, false);
+    case FilterKind::kBigintRange: {
+      bool bothNullAllowed = nullAllowed_ && other->testNull();
+      auto otherRange = static_cast<const BigintRange*>(other);
+      auto min = std::max(min_, otherRange->lower());
+      auto max = std::min(max_, otherRange->upper());
+      if (min > max) {
+        return nullOrFalse(bothNullAllowed);
+      }
+      return std::make_unique<BigintValuesUsingBloomFilter>(
+          min, max, bloomFilter_, bothNullAllowed, conjunct_);
+    }
+    case FilterKind::kBigintValuesUsingHashTable:
+    case FilterKind::kBigintValuesUsingBitmask: {
+      // An exact IN-list stays exact, only drop the values rejected by 'this'.
+      bool bothNullAllowed = nullAllowed_ && other->testNull();
+      std::vector<int64_t> values;
+      if (other->kind() == FilterKind::kBigintValuesUsingHashTable) {
+        values =
+            static_cast<const BigintValuesUsingHashTable*>(other)->values();
+      } else {
+        values = static_cast<const BigintValuesUsingBitmask*>(other)->values();
+      }
+      std::vector<int64_t> valuesToKeep;
+      valuesToKeep.reserve(values.size());
+      for (auto value : values) {
+        if (other->testInt64(value) && testInt64(value)) {
+          valuesToKeep.push_back(value);
+        }
+      }
+      return createBigintValues(valuesToKeep, bothNullAllowed);
+    }
+    case FilterKind::kNegatedBigintRange:
+    case FilterKind::kNegatedBigintValuesUsingHashTable:
+    case FilterKind::kNegatedBigintValuesUsingBitmask:
+    case FilterKind::kBigintMultiRange:
+    case FilterKind::kBigintValuesUsingBloomFilter: {
+      // Keep the bloom filter and AND the rest into the conjunct.
+      bool bothNullAllowed = nullAllowed_ && other->testNull();
+      std::shared_ptr<const Filter> conjunct =
+          conjunct_ ? conjunct_->mergeWith(other) : other->clone(false);
+      return std::make_unique<BigintValuesUsingBloomFilter>(
+          min_, max_, bloomFilter_, bothNullAllowed, std::move(conjunct));
+    }
+    default:
+      VELOX_UNREACHABLE();
+  }
+}
+
 std::unique_ptr<Filter> NegatedBigintValuesUsingHashTable::mergeWith(
     const Filter* other) const {
   // Rules of NegatedBigintValuesUsingHashTable with IsNull/IsNotNull
@@ -2214,6 +2400,7 @@ std::unique_ptr<Filter> NegatedBigintValuesUsingHashTable::mergeWith(
       return other->mergeWith(this);
     case FilterKind::kIsNotNull:
       return std::make_unique<NegatedBigintValuesUsingHashTable>(*this, false);
+    case FilterKind::kBigintValuesUsingBloomFilter:
     case FilterKind::kBigintValuesUsingHashTable:
     case FilterKind::kBigintValuesUsingBitmask:
     case FilterKind::kBigintRange:
@@ -2253,6 +2440,7 @@ std::unique_ptr<Filter> NegatedBigintValuesUsingBitmask::mergeWith(
       return other->mergeWith(this);
     case FilterKind::kIsNotNull:
       return std::make_unique<NegatedBigintValuesUsingBitmask>(*this, false);
+    case FilterKind::kBigintValuesUsingBloomFilter:
     case FilterKind::kBigintValuesUsingHashTable:
     case FilterKind::kBigintValuesUsingBitmask:
     case FilterKind::kBigintRange:
@@ -2297,6 +2485,7 @@ std::unique_ptr<Filter> BigintMultiRange::mergeWith(const Filter* other) const {
     case FilterKind::kBigintRange:
     case FilterKind::kNegatedBigintRange:
     case FilterKind::kBigintValuesUsingBitmask:
+    case FilterKind::kBigintValuesUsingBloomFilter:
     case FilterKind::kBigintValuesUsingHashTable: {
       return other->mergeWith(this);
     }
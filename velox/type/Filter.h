@@ -24,7 +24,9 @@
 
 #include <folly/Range.h>
 #include <folly/container/F14Set.h>
+#include <folly/hash/Hash.h>
 
+#include "velox/common/base/BloomFilter.h"
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/base/SimdUtil.h"
 #include "velox/common/serialization/Serializable.h"
@@ -57,6 +59,7 @@ enum class FilterKind {
   kHugeintRange,
   kTimestampRange,
   kHugeintValuesUsingHashTable,
+  kBigintValuesUsingBloomFilter,
 };
 
 class Filter;
@@ -1182,6 +1185,94 @@ class BigintValuesUsingBitmask final : public Filter {
   const int64_t max_;
 };
 
+/// Approximate IN-list filter for integral data types. Implemented as a bloom
+/// filter over folly::hasher<int64_t> hashes of the accepted values plus a
+/// [min, max] range check. May pass values which are not in the list, never
+/// rejects values which are. Used for dynamic filters produced from hash join
+/// build sides which have too many distinct keys for an exact IN-list.
+class BigintValuesUsingBloomFilter final : public Filter {
+ public:
+  /// @param min Minimum value.
+  /// @param max Maximum value.
+  /// @param bloomFilter Bloom filter populated with hashes of all accepted
+  /// values.
+  /// @param nullAllowed Null values are passing the filter if true.
+  /// @param conjunct Optional filter which must also pass. Set when merging
+  /// with filters that cannot be folded into the range or the bloom filter.
+  BigintValuesUsingBloomFilter(
+      int64_t min,
+      int64_t max,
+      std::shared_ptr<const BloomFilter<>> bloomFilter,
+      bool nullAllowed,
+      std::shared_ptr<const Filter> conjunct = nullptr);
+
+  BigintValuesUsingBloomFilter(
+      const BigintValuesUsingBloomFilter& other,
+      bool nullAllowed)
+      : Filter(true, nullAllowed, FilterKind::kBigintValuesUsingBloomFilter),
+        min_(other.min_),
+        max_(other.max_),
+        bloomFilter_(other.bloomFilter_),
+        conjunct_(other.conjunct_) {}
+
+  /// Returns the hash of 'value' as inserted into and probed against the
+  /// bloom filter.
+  static uint64_t hash(int64_t value) {
+    return folly::hasher<int64_t>()(value);
+  }
+
+  folly::dynamic serialize() const override;
+
+  static std::unique_ptr<Filter> create(const folly::dynamic& obj);
+
+  std::unique_ptr<Filter> clone(
+      std::optional<bool> nullAllowed = std::nullopt) const final {
+    if (nullAllowed) {
+      return std::make_unique<BigintValuesUsingBloomFilter>(
+          *this, nullAllowed.value());
+    } else {
+      return std::make_unique<BigintValuesUsingBloomFilter>(*this);
+    }
+  }
+
+  bool testInt64(int64_t value) const final {
+    return value >= min_ && value <= max_ &&
+        bloomFilter_->mayContain(hash(value)) &&
+        (conjunct_ == nullptr || conjunct_->testInt64(value));
+  }
+
+  bool testInt64Range(int64_t min, int64_t max, bool hasNull) const final;
+
+  std::unique_ptr<Filter> mergeWith(const Filter* other) const final;
+
+  bool testingEquals(const Filter& other) const final;
+
+  int64_t min() const {
+    return min_;
+  }
+
+  int64_t max() const {
+    return max_;
+  }
+
+  std::string toString() const override {
+    return fmt::format(
+        "BigintValuesUsingBloomFilter: [{}, {}] {}{}",
+        min_,
+        max_,
+        nullAllowed_ ? "with nulls" : "no nulls",
+        conjunct_ ? fmt::format(" AND {}", conjunct_->toString()) : "");
+  }
+
+ private:
+  const int64_t min_;
+  const int64_t max_;
+  // Shared between clones and merged copies. Never modified after
+  // construction.
+  const std::shared_ptr<const BloomFilter<>> bloomFilter_;
+  const std::shared_ptr<const Filter> conjunct_;
+};
+
 // NOT IN-list filter for integral data types. Implemented as a hash table. Good
 // for large number of rejected values that do not fit within a small range.
 class NegatedBigintValuesUsingHashTable final : public Filter {
@@ -1994,6 +2085,7 @@ class BytesValues final : public Filter {
 
     lower_ = *std::min_element(values_.begin(), values_.end());
     upper_ = *std::max_element(values_.begin(), values_.end());
+    initLookup();
   }
 
   BytesValues(const BytesValues& other, bool nullAllowed)
@@ -2001,7 +2093,13 @@ class BytesValues final : public Filter {
         lower_(other.lower_),
         upper_(other.upper_),
         values_(other.values_),
-        lengths_(other.lengths_) {}
+        lengths_(other.lengths_),
+        smallLengths_(other.smallLengths_),
+        prefixBloom_(other.prefixBloom_) {}
+
+  /// Minimum number of values for checking the prefix Bloom filter before
+  /// looking up a value.
+  static constexpr size_t kMinValuesForPrefixBloom = 256;
 
   folly::dynamic serialize() const override;
 
@@ -2017,12 +2115,15 @@ class BytesValues final : public Filter {
   }
 
   bool testLength(int32_t length) const final {
+    if (length < 64) {
+      return smallLengths_ & (1ULL << length);
+    }
     return lengths_.contains(length);
   }
 
   bool testBytes(const char* value, int32_t length) const final {
-    return lengths_.contains(length) &&
-        values_.contains(std::string(value, length));
+    return testLength(length) && mayContainPrefix(value, length) &&
+        values_.contains(std::string_view(value, length));
   }
 
   bool testBytesRange(
@@ -2039,10 +2140,45 @@ class BytesValues final : public Filter {
   bool testingEquals(const Filter& other) const final;
 
  private:
+  // Returns a hash of the length and the first 8 bytes of a value.
+  static uint64_t prefixHash(const char* value, int32_t length) {
+    uint64_t prefix = 0;
+    memcpy(&prefix, value, std::min<int32_t>(length, sizeof(prefix)));
+    return folly::hash::hash_128_to_64(prefix, length);
+  }
+
+  // Returns false if no value has the length and first 8 bytes of 'value'.
+  // Sets two bits of one word per value, so that a value that does not match
+  // is usually rejected with one cache miss and without hashing all of it.
+  bool mayContainPrefix(const char* value, int32_t length) const {
+    if (prefixBloom_.empty()) {
+      return true;
+    }
+    const auto hash = prefixHash(value, length);
+    const auto mask = prefixBloomMask(hash);
+    return (prefixBloom_[(hash >> 32) & (prefixBloom_.size() - 1)] & mask) ==
+        mask;
+  }
+
+  static uint64_t prefixBloomMask(uint64_t hash) {
+    return (1ULL << (hash & 63)) | (1ULL << ((hash >> 6) & 63));
+  }
+
+  // Initializes 'smallLengths_' and 'prefixBloom_' from 'values_'.
+  void initLookup();
+
   std::string lower_;
   std::string upper_;
   folly::F14FastSet<std::string> values_;
   folly::F14FastSet<uint32_t> lengths_;
+
+  // Bit i is set if a value has length i, for lengths below 64.
+  uint64_t smallLengths_{0};
+
+  // Blocked Bloom filter of the prefix hashes of 'values_'. The size is a
+  // power of two. Empty if there are fewer than kMinValuesForPrefixBloom
+  // values.
+  std::vector<uint64_t> prefixBloom_;
 };
 
 /// Represents a combination of two of more range filters on integral types with
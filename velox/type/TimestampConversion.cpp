@@ -215,6 +215,26 @@ bool tryParseDateString(
     return false;
   }
 
+  // Fast path for the canonical YYYY-MM-DD form, which every mode accepts.
+  // Anything else, including invalid days and months, takes the general path
+  // below.
+  if (len == 10 && buf[4] == '-' && buf[7] == '-' &&
+      characterIsDigit(buf[0]) && characterIsDigit(buf[1]) &&
+      characterIsDigit(buf[2]) && characterIsDigit(buf[3]) &&
+      characterIsDigit(buf[5]) && characterIsDigit(buf[6]) &&
+      characterIsDigit(buf[8]) && characterIsDigit(buf[9])) {
+    const int32_t year = (buf[0] - '0') * 1000 + (buf[1] - '0') * 100 +
+        (buf[2] - '0') * 10 + (buf[3] - '0');
+    const int32_t month = (buf[5] - '0') * 10 + (buf[6] - '0');
+    const int32_t day = (buf[8] - '0') * 10 + (buf[9] - '0');
+    Expected<int64_t> expected = daysSinceEpochFromDate(year, month, day);
+    if (expected.hasValue() && validDate(expected.value())) {
+      daysSinceEpoch = expected.value();
+      pos = len;
+      return true;
+    }
+  }
+
   int32_t day = 0;
   int32_t month = -1;
   int32_t year = 0;
@@ -468,6 +468,41 @@ TEST_F(ConversionsTest, toIntegeralTypes) {
         /*expectError*/ true);
     testConversion<std::string, int8_t>(
         {"1234567"}, {}, /*truncate*/ false, false, /*expectError*/ true);
+    // Digit strings around the 8 and 18 digit boundaries of the fast path.
+    testConversion<std::string, int64_t>(
+        {
+            "-0",
+            "0000000000000000012",
+            "12345678",
+            "-123456789",
+            "123456789012345678",
+            "-123456789012345678",
+            "1234567890123456789",
+            "9223372036854775807",
+            "-9223372036854775808",
+        },
+        {
+            0,
+            12,
+            12345678,
+            -123456789,
+            123456789012345678,
+            -123456789012345678,
+            1234567890123456789,
+            std::numeric_limits<int64_t>::max(),
+            std::numeric_limits<int64_t>::min(),
+        },
+        /*truncate*/ false);
+    testConversion<std::string, int64_t>(
+        {"9223372036854775808", "1234567a", "12345678a", "12 34", "--1"},
+        {},
+        /*truncate*/ false,
+        false,
+        /*expectError*/ true);
+    testConversion<std::string, int8_t>(
+        {"127", "-128", "+0"}, {127, -128, 0}, /*truncate*/ false);
+    testConversion<std::string, int8_t>(
+        {"128", "-129"}, {}, /*truncate*/ false, false, /*expectError*/ true);
     testConversion<std::string, int64_t>(
         {"1a",
          "",
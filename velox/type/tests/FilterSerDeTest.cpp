@@ -110,6 +110,23 @@ TEST_F(FilterSerDeTest, valuesFilters) {
   }
 }
 
+TEST_F(FilterSerDeTest, bloomFilter) {
+  auto bloomFilter = std::make_shared<BloomFilter<>>();
+  bloomFilter->reset(100);
+  for (int64_t i = 0; i < 100; ++i) {
+    bloomFilter->insert(BigintValuesUsingBloomFilter::hash(i * 7));
+  }
+  for (bool nullAllowed : {true, false}) {
+    testSerde(BigintValuesUsingBloomFilter(0, 693, bloomFilter, nullAllowed));
+    testSerde(BigintValuesUsingBloomFilter(
+        0,
+        693,
+        bloomFilter,
+        nullAllowed,
+        std::make_shared<NegatedBigintRange>(7, 14, false)));
+  }
+}
+
 TEST_F(FilterSerDeTest, rangeFilters) {
   FloatRange floatRange(1.0, true, true, 124.5, false, true, false);
   testSerde(floatRange);
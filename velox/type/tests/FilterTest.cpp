@@ -499,6 +499,74 @@ TEST(FilterTest, bigintValuesUsingBitmask) {
   EXPECT_FALSE(filter->testInt64Range(1234, 2000, false));
 }
 
+TEST(FilterTest, bigintValuesUsingBloomFilter) {
+  auto makeBloomFilter = [](const std::vector<int64_t>& values) {
+    auto bloomFilter = std::make_shared<BloomFilter<>>();
+    bloomFilter->reset(values.size());
+    for (auto value : values) {
+      bloomFilter->insert(BigintValuesUsingBloomFilter::hash(value));
+    }
+    return bloomFilter;
+  };
+  std::vector<int64_t> values;
+  for (int64_t i = 0; i < 1'000; ++i) {
+    values.push_back(i * 1'000'003);
+  }
+  auto filter = std::make_unique<BigintValuesUsingBloomFilter>(
+      values.front(), values.back(), makeBloomFilter(values), false);
+
+  for (auto value : values) {
+    ASSERT_TRUE(filter->testInt64(value));
+  }
+  int32_t numFalsePositives = 0;
+  for (int64_t i = 0; i < 1'000; ++i) {
+    numFalsePositives += filter->testInt64(i * 1'000'003 + 1);
+  }
+  EXPECT_LT(numFalsePositives, 50);
+
+  EXPECT_FALSE(filter->testNull());
+  EXPECT_FALSE(filter->testInt64(-1));
+  EXPECT_FALSE(filter->testInt64(values.back() + 1));
+
+  EXPECT_TRUE(filter->testInt64Range(0, 10, false));
+  EXPECT_TRUE(filter->testInt64Range(-10, 10, false));
+  EXPECT_FALSE(filter->testInt64Range(-10, -5, false));
+  EXPECT_FALSE(filter->testInt64Range(values.back() + 1, INT64_MAX, false));
+
+  // Merging with a range narrows the range and keeps the bloom filter.
+  auto merged = filter->mergeWith(
+      std::make_unique<BigintRange>(100, values.back(), false).get());
+  ASSERT_EQ(merged->kind(), FilterKind::kBigintValuesUsingBloomFilter);
+  EXPECT_FALSE(merged->testInt64(0));
+  EXPECT_TRUE(merged->testInt64(values[1]));
+
+  // Merging with an IN-list produces an exact IN-list.
+  merged = filter->mergeWith(
+      createBigintValues({0, values.back() + 1, values.back() + 2}, false)
+          .get());
+  ASSERT_EQ(merged->kind(), FilterKind::kBigintRange);
+  EXPECT_TRUE(merged->testInt64(0));
+  EXPECT_FALSE(merged->testInt64(values.back() + 1));
+
+  // Other filters become part of the conjunct.
+  merged = filter->mergeWith(
+      std::make_unique<NegatedBigintRange>(0, 0, false).get());
+  ASSERT_EQ(merged->kind(), FilterKind::kBigintValuesUsingBloomFilter);
+  EXPECT_FALSE(merged->testInt64(0));
+  EXPECT_TRUE(merged->testInt64(values[1]));
+  merged = std::make_unique<NegatedBigintRange>(0, 0, false)->mergeWith(
+      filter.get());
+  ASSERT_EQ(merged->kind(), FilterKind::kBigintValuesUsingBloomFilter);
+  EXPECT_FALSE(merged->testInt64(0));
+  EXPECT_TRUE(merged->testInt64(values[1]));
+
+  merged = filter->clone(true)->mergeWith(std::make_unique<IsNull>().get());
+  EXPECT_EQ(merged->kind(), FilterKind::kIsNull);
+  merged = filter->mergeWith(std::make_unique<IsNotNull>().get());
+  EXPECT_EQ(merged->kind(), FilterKind::kBigintValuesUsingBloomFilter);
+  EXPECT_FALSE(merged->testNull());
+}
+
 TEST(FilterTest, negatedBigintValuesUsingBitmask) {
   auto filter = createNegatedBigintValues({1, 6, 1000, 8, 9, 100, 10}, false);
   auto castedFilter =
@@ -1036,6 +1104,37 @@ TEST(FilterTest, bytesValues) {
   EXPECT_FALSE(filter->testBytesRange(std::nullopt, "Banana", false));
 }
 
+TEST(FilterTest, bytesValuesLarge) {
+  // Enough values for the prefix Bloom filter, with lengths on either side of
+  // 64 and values that share a prefix of more than 8 bytes.
+  std::vector<std::string> values;
+  for (auto i = 0; i < 2 * BytesValues::kMinValuesForPrefixBloom; ++i) {
+    values.push_back(std::to_string(i * 3));
+    values.push_back("shared prefix " + std::to_string(i * 3));
+    values.push_back(std::string(60 + i % 10, 'a' + i % 26));
+  }
+  auto filter = in(values);
+  ASSERT_EQ(filter->kind(), FilterKind::kBytesValues);
+  for (const auto& value : values) {
+    ASSERT_TRUE(filter->testBytes(value.data(), value.size())) << value;
+  }
+  auto copy = filter->clone(true);
+  for (auto i = 0; i < 6 * BytesValues::kMinValuesForPrefixBloom; ++i) {
+    const auto expected = i % 3 == 0;
+    auto value = std::to_string(i);
+    ASSERT_EQ(filter->testBytes(value.data(), value.size()), expected);
+    ASSERT_EQ(copy->testBytes(value.data(), value.size()), expected);
+    value = "shared prefix " + std::to_string(i);
+    ASSERT_EQ(filter->testBytes(value.data(), value.size()), expected);
+    ASSERT_EQ(copy->testBytes(value.data(), value.size()), expected);
+  }
+  EXPECT_TRUE(filter->testLength(63));
+  EXPECT_TRUE(filter->testLength(64));
+  EXPECT_FALSE(filter->testLength(70));
+  EXPECT_FALSE(filter->testBytes(std::string(64, 'z').data(), 64));
+  EXPECT_TRUE(copy->testNull());
+}
+
 TEST(FilterTest, negatedBytesValues) {
   // create a filter
   std::vector<std::string> values(
@@ -232,6 +232,22 @@ TEST(DateTimeUtilTest, fromDateString) {
   EXPECT_EQ(16512, parseDate("2015-03-18T123123", ParseMode::kSparkCast));
   EXPECT_EQ(16512, parseDate("2015-03-18 123142", ParseMode::kSparkCast));
   EXPECT_EQ(16512, parseDate("2015-03-18 (BC)", ParseMode::kSparkCast));
+
+  // Canonical YYYY-MM-DD strings are accepted in every mode.
+  for (ParseMode mode :
+       {ParseMode::kStrict,
+        ParseMode::kNonStrict,
+        ParseMode::kPrestoCast,
+        ParseMode::kSparkCast,
+        ParseMode::kIso8601}) {
+    EXPECT_EQ(19782, parseDate("2024-02-29", mode));
+    EXPECT_EQ(-719162, parseDate("0001-01-01", mode));
+    EXPECT_EQ(2932896, parseDate("9999-12-31", mode));
+    VELOX_ASSERT_THROW(parseDate("2023-02-29", mode), "");
+    VELOX_ASSERT_THROW(parseDate("2023-13-01", mode), "");
+    VELOX_ASSERT_THROW(parseDate("2023-00-10", mode), "");
+    VELOX_ASSERT_THROW(parseDate("2023-01-32", mode), "");
+  }
 }
 
 TEST(DateTimeUtilTest, fromDateStringInvalid) {
@@ -465,14 +465,59 @@ TimeZone::milliseconds TimeZone::to_sys(
 }
 
 TimeZone::seconds TimeZone::to_local(TimeZone::seconds timestamp) const {
+  if (auto offset = cachedOffset(timestamp)) {
+    return timestamp + offset.value();
+  }
   return toLocalImpl(timestamp, tz_, offset_);
 }
 
 TimeZone::milliseconds TimeZone::to_local(
     TimeZone::milliseconds timestamp) const {
+  // Truncates like tzdb::time_zone::get_info().
+  if (auto offset =
+          cachedOffset(std::chrono::duration_cast<seconds>(timestamp))) {
+    return timestamp + offset.value();
+  }
   return toLocalImpl(timestamp, tz_, offset_);
 }
 
+std::optional<TimeZone::seconds> TimeZone::cachedOffset(
+    TimeZone::seconds timestamp) const {
+  const auto value = timestamp.count();
+  if (tz_ == nullptr || value < kOffsetTableBegin ||
+      value >= kOffsetTableEnd) {
+    return std::nullopt;
+  }
+  std::call_once(offsetTableFlag_, [&]() { buildOffsetTable(); });
+
+  // Branch free binary search for the last range that starts at or before
+  // 'value'. The first range starts at kOffsetTableBegin.
+  const auto* base = offsetTableBegins_.data();
+  auto size = offsetTableBegins_.size();
+  while (size > 1) {
+    const auto half = size / 2;
+    base = base[half] <= value ? base + half : base;
+    size -= half;
+  }
+  return seconds(offsetTableOffsets_[base - offsetTableBegins_.data()]);
+}
+
+void TimeZone::buildOffsetTable() const {
+  auto info = tz_->get_info(date::sys_seconds{seconds(kOffsetTableBegin)});
+  offsetTableBegins_.push_back(kOffsetTableBegin);
+  offsetTableOffsets_.push_back(info.offset.count());
+  while (info.end.time_since_epoch().count() < kOffsetTableEnd) {
+    auto next = tz_->get_info(info.end);
+    VELOX_CHECK(next.end > info.end);
+    // Ranges that differ only in the abbreviation are merged.
+    if (next.offset.count() != offsetTableOffsets_.back()) {
+      offsetTableBegins_.push_back(next.begin.time_since_epoch().count());
+      offsetTableOffsets_.push_back(next.offset.count());
+    }
+    info = std::move(next);
+  }
+}
+
 TimeZone::seconds TimeZone::correct_nonexistent_time(
     TimeZone::seconds timestamp) const {
   // If this is an offset time zone.
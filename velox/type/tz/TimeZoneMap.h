@@ -17,6 +17,8 @@
 #pragma once
 
 #include <chrono>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -144,6 +146,9 @@ class TimeZone {
   /// GMT), convert to the same instant in time as observed in the user local
   /// time represented by this object). Note that this conversion is not
   /// susceptible to the error above.
+  ///
+  /// Times in [kOffsetTableBegin, kOffsetTableEnd) are converted through a
+  /// table of the offsets of the time zone that is built on first use.
   seconds to_local(seconds timestamp) const;
   milliseconds to_local(milliseconds timestamp) const;
 
@@ -183,11 +188,29 @@ class TimeZone {
       milliseconds timestamp,
       TChoose choose = TChoose::kFail) const;
 
+ /// Range of the offset table used by to_local(), 1970-01-01 to 2100-01-01
+  /// in seconds since epoch.
+  static constexpr int64_t kOffsetTableBegin = 0;
+  static constexpr int64_t kOffsetTableEnd = 4'102'444'800;
+
  private:
+  // Returns the offset from GMT of 'tz_' at 'timestamp' or std::nullopt if
+  // 'timestamp' is outside of the offset table.
+  std::optional<seconds> cachedOffset(seconds timestamp) const;
+
+  void buildOffsetTable() const;
+
   const tzdb::time_zone* tz_{nullptr};
   const std::chrono::minutes offset_{0};
   const std::string timeZoneName_;
   const int16_t timeZoneID_;
+
+  // Start of each range of time with a constant offset in
+  // [kOffsetTableBegin, kOffsetTableEnd) and the offset of the range, in
+  // seconds. Built on first use since most time zones are never used.
+  mutable std::once_flag offsetTableFlag_;
+  mutable std::vector<int64_t> offsetTableBegins_;
+  mutable std::vector<int32_t> offsetTableOffsets_;
 };
 
 } // namespace facebook::velox::tz
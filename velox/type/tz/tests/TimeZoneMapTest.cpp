@@ -19,6 +19,7 @@
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/external/date/date.h"
+#include "velox/external/tzdb/time_zone.h"
 #include "velox/type/tz/TimeZoneMap.h"
 
 namespace facebook::velox::tz {
@@ -91,6 +92,44 @@ TEST(TimeZoneMapTest, offsetToLocal) {
   EXPECT_NE(toLocalTime("-07:00", ts), toLocalTime("America/Los_Angeles", ts));
 }
 
+TEST(TimeZoneMapTest, offsetTable) {
+  // to_local() of times in the offset table matches the offsets from tzdb,
+  // including the seconds around each transition.
+  for (const auto* name :
+       {"America/Los_Angeles",
+        "Europe/London",
+        "Asia/Kolkata",
+        "Australia/Lord_Howe",
+        "America/Sao_Paulo",
+        "UTC"}) {
+    SCOPED_TRACE(name);
+    const auto* tz = locateZone(name);
+    ASSERT_NE(tz, nullptr);
+    auto expectLocal = [&](int64_t ts) {
+      const auto info = tz->tz()->get_info(date::sys_seconds{seconds(ts)});
+      ASSERT_EQ(ts + info.offset.count(), tz->to_local(seconds(ts)).count());
+      ASSERT_EQ(
+          ts * 1'000 + 999 + info.offset.count() * 1'000,
+          tz->to_local(milliseconds(ts * 1'000 + 999)).count());
+    };
+    auto info = tz->tz()->get_info(
+        date::sys_seconds{seconds(TimeZone::kOffsetTableBegin)});
+    while (info.end.time_since_epoch().count() < TimeZone::kOffsetTableEnd) {
+      const auto transition = info.end.time_since_epoch().count();
+      expectLocal(transition - 1);
+      expectLocal(transition);
+      expectLocal((info.begin.time_since_epoch().count() + transition) / 2);
+      info = tz->tz()->get_info(info.end);
+    }
+    expectLocal(TimeZone::kOffsetTableBegin);
+    expectLocal(TimeZone::kOffsetTableEnd - 1);
+
+    // Times outside of the table are converted by tzdb.
+    expectLocal(TimeZone::kOffsetTableBegin - 1);
+    expectLocal(TimeZone::kOffsetTableEnd);
+  }
+}
+
 TEST(TimeZoneMapTest, offsetToSys) {
   auto toSysTime = [&](std::string_view name, size_t ts) {
     const auto* tz = locateZone(name);
@@ -16,6 +16,7 @@
 #include "velox/vector/DecodedVector.h"
 #include "velox/buffer/Buffer.h"
 #include "velox/common/base/BitUtil.h"
+#include "velox/common/base/SimdUtil.h"
 #include "velox/vector/BaseVector.h"
 #include "velox/vector/LazyVector.h"
 
@@ -49,6 +50,27 @@ const BaseVector* getValueVector(const BaseVector* vector) {
   return vector->valueVector().get();
 }
 
+// Sets result[row] = newIndices[indices[row]] for rows in [begin, end).
+// 'indices' and 'result' may be the same. Each batch of 'indices' is loaded
+// before the same positions of 'result' are written.
+void composeIndices(
+    const vector_size_t* newIndices,
+    const vector_size_t* indices,
+    vector_size_t begin,
+    vector_size_t end,
+    vector_size_t* result) {
+  static_assert(sizeof(vector_size_t) == sizeof(int32_t));
+  constexpr int32_t kBatchSize = xsimd::batch<int32_t>::size;
+  auto row = begin;
+  for (; row + kBatchSize <= end; row += kBatchSize) {
+    simd::gather<int32_t, int32_t>(newIndices, indices + row)
+        .store_unaligned(result + row);
+  }
+  for (; row < end; ++row) {
+    result[row] = newIndices[indices[row]];
+  }
+}
+
 } // namespace
 
 const std::vector<vector_size_t>& DecodedVector::consecutiveIndices() {
@@ -259,6 +281,7 @@ void DecodedVector::applyDictionaryWrapper(
 
   auto newIndices = dictionaryVector.wrapInfo()->as<vector_size_t>();
   auto newNulls = dictionaryVector.rawNulls();
+  const bool hadNulls = nulls_ != nullptr;
   if (newNulls) {
     hasExtraNulls_ = true;
     mayHaveNulls_ = true;
@@ -276,6 +299,23 @@ void DecodedVector::applyDictionaryWrapper(
     indices_ = copiedIndices_.data();
   }
 
+  // Without nulls from the enclosing levels, a contiguous range of rows is
+  // composed in bulk with SIMD gathers.
+  if (!hadNulls && (rows == nullptr || rows->isContiguous())) {
+    const vector_size_t firstRow = rows ? rows->begin() : 0;
+    const vector_size_t endRow = rows ? rows->end() : size_;
+    if (newNulls) {
+      for (auto row = firstRow; row < endRow; ++row) {
+        if (bits::isBitNull(newNulls, currentIndices[row])) {
+          bits::setNull(copiedNulls, row);
+        }
+      }
+    }
+    composeIndices(
+        newIndices, currentIndices, firstRow, endRow, copiedIndices_.data());
+    return;
+  }
+
   applyToRows(rows, [&](vector_size_t row) {
     if (!nulls_ || !bits::isBitNull(nulls_, row)) {
       auto wrappedIndex = currentIndices[row];
@@ -301,13 +301,26 @@ void FlatVector<T>::copyRanges(
     auto leaf =
         source->wrappedVector()->asUnchecked<SimpleVector<StringView>>();
     if (BaseVector::pool_ != leaf->pool()) {
+      // Consecutive rows referencing the same source string share one copy.
+      StringView previous;
+      StringView previousCopy;
       applyToEachRow(ranges, [&](auto targetIndex, auto sourceIndex) {
         if (source->isNullAt(sourceIndex)) {
           this->setNull(targetIndex, true);
-        } else {
-          this->set(
-              targetIndex, leaf->valueAt(source->wrappedIndex(sourceIndex)));
+          return;
+        }
+        const auto value = leaf->valueAt(source->wrappedIndex(sourceIndex));
+        if (!value.isInline() && value.data() == previous.data() &&
+            value.size() == previous.size()) {
+          if (BaseVector::rawNulls_) {
+            BaseVector::setNull(targetIndex, false);
+          }
+          rawValues_[targetIndex] = previousCopy;
+          return;
         }
+        this->set(targetIndex, value);
+        previous = value;
+        previousCopy = rawValues_[targetIndex];
       });
       return;
     }
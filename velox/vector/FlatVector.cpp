@@ -277,7 +277,15 @@ void FlatVector<StringView>::copy(
       rawNulls = BaseVector::mutableRawNulls();
     }
 
+    // Consecutive rows referencing the same source string, e.g. a value
+    // repeated by a dictionary after Unnest or a join, share a single copy.
+    auto isRepeat = [](StringView value, StringView previous) {
+      return value.data() == previous.data() &&
+          value.size() == previous.size();
+    };
+
     size_t totalBytes = 0;
+    StringView previous;
     rows.applyToSelected([&](vector_size_t row) {
       const auto sourceRow = toSourceRow ? toSourceRow[row] : row;
       if (decoded.isNullAt(sourceRow)) {
@@ -289,23 +297,31 @@ void FlatVector<StringView>::copy(
         auto v = decoded.valueAt<StringView>(sourceRow);
         if (v.isInline()) {
           rawValues_[row] = v;
-        } else {
+        } else if (!isRepeat(v, previous)) {
           totalBytes += v.size();
+          previous = v;
         }
       }
     });
 
     if (totalBytes > 0) {
       auto* buffer = getRawStringBufferWithSpace(totalBytes);
+      previous = StringView();
+      StringView previousCopy;
       rows.applyToSelected([&](vector_size_t row) {
         const auto sourceRow = toSourceRow ? toSourceRow[row] : row;
         if (!decoded.isNullAt(sourceRow)) {
           auto v = decoded.valueAt<StringView>(sourceRow);
-          if (!v.isInline()) {
+          if (v.isInline()) {
+            return;
+          }
+          if (!isRepeat(v, previous)) {
             memcpy(buffer, v.data(), v.size());
-            rawValues_[row] = StringView(buffer, v.size());
+            previousCopy = StringView(buffer, v.size());
             buffer += v.size();
+            previous = v;
           }
+          rawValues_[row] = previousCopy;
         }
       });
     }
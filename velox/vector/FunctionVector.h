@@ -32,6 +32,9 @@ class Callable {
  public:
   virtual ~Callable() = default;
 
+  /// Returns true if the captures need to be aligned with the arguments
+  /// through 'wrapCapture' in apply(). Captures that have the same value for
+  /// all rows do not.
   virtual bool hasCapture() const = 0;
 
   /// Applies 'this' to 'args' for 'rows' and returns the result in
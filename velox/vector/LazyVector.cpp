@@ -65,6 +65,8 @@ void VectorLoader::load(
     LazyIoStatsRecorder recorder(result);
     loadInternal(rows, hook, resultSize, result);
   }
+  addThreadLocalRuntimeStat(
+      LazyVector::kLoadedRows, RuntimeCounter(rows.size()));
   if (hook) {
     // Record number of rows loaded directly into ValueHook bypassing
     // materialization into vector. This counter can be used to understand
@@ -282,6 +284,8 @@ void LazyVector::loadVectorInternal() const {
       vector_ = BaseVector::create(type_, 0, pool_);
     }
     SelectivityVector allRows(BaseVector::length_);
+    addThreadLocalRuntimeStat(
+        LazyVector::kFullLoadRows, RuntimeCounter(BaseVector::length_));
     loader_->load(allRows, nullptr, size(), &vector_, pool_);
     VELOX_CHECK_NOT_NULL(vector_);
     if (vector_->encoding() == VectorEncoding::Simple::LAZY) {
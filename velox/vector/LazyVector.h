@@ -230,6 +230,14 @@ class LazyVector : public BaseVector {
   static constexpr const char* kCpuNanos = "dataSourceLazyCpuNanos";
   static constexpr const char* kWallNanos = "dataSourceLazyWallNanos";
   static constexpr const char* kInputBytes = "dataSourceLazyInputBytes";
+  /// Number of rows produced by loaders, whether for a row set or for all
+  /// rows.
+  static constexpr const char* kLoadedRows = "dataSourceLazyLoadedRows";
+  /// Number of rows loaded because loadedVector() was called on a vector that
+  /// was not loaded, which loads all rows regardless of which ones are used.
+  /// A large share of kLoadedRows here means the operator recording it
+  /// defeats late materialization and should load for a row set instead.
+  static constexpr const char* kFullLoadRows = "dataSourceLazyFullLoadRows";
 
   LazyVector(
       velox::memory::MemoryPool* pool,
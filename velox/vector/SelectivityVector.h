@@ -310,6 +310,15 @@ class SelectivityVector {
         bits::isAllSet(bits_.data(), 0, size_, true);
     return allSelected_.value();
   }
+  /// Returns true if all rows in [begin(), end()) are selected, so that
+  /// callers can process the range in bulk instead of row by row.
+  bool isContiguous() const {
+    if (allSelected_.has_value() && allSelected_.value()) {
+      return true;
+    }
+    return bits::isAllSet(bits_.data(), begin_, end_, true);
+  }
+
   /**
    * Iterate and count the number of selected values in this SelectivityVector
    */
@@ -64,6 +64,12 @@ bool VectorPool::release(VectorPtr& vector) {
   if (vector.use_count() != 1 || vector->size() > kMaxRecycleSize) {
     return false;
   }
+  // Vectors allocated from another pool, e.g. passed in from an upstream
+  // operator, are not recycled so that their memory stays accounted to the
+  // pool that allocated it.
+  if (vector->pool() != pool_) {
+    return false;
+  }
 
   auto cacheIndex = toCacheIndex(vector->type());
   if (cacheIndex < 0) {
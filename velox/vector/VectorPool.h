@@ -35,9 +35,10 @@ class VectorPool {
   /// 'pool_' if no pre-allocated vector or type is a complex type.
   VectorPtr get(const TypePtr& type, vector_size_t size);
 
-  /// Moves vector into 'this' if it is flat, recursively singly referenced and
-  /// there is space. The function returns true if 'vector' is not null and has
-  /// been returned back to this pool, otherwise returns false.
+  /// Moves vector into 'this' if it is flat, recursively singly referenced,
+  /// allocated from 'pool_' and there is space. The function returns true if
+  /// 'vector' is not null and has been returned back to this pool, otherwise
+  /// returns false.
   bool release(VectorPtr& vector);
 
   size_t release(std::vector<VectorPtr>& vectors);
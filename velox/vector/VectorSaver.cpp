@@ -14,6 +14,10 @@
  * limitations under the License.
  */
 #include "velox/vector/VectorSaver.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <fstream>
 #include "velox/vector/ComplexVector.h"
 #include "velox/vector/FlatVector.h"
@@ -36,6 +40,131 @@ enum class Encoding : int8_t {
   kLazy = 3,
 };
 
+// Magic bytes at the start of files written by saveVectorToMappableFile().
+constexpr std::string_view kMappableMagic{"VXMAPPED"};
+
+// In mappable files, buffer payloads start at file offsets that are a multiple
+// of this, which is enough for any native type.
+constexpr int64_t kMappableAlignment = 16;
+
+// Output file written by saveVectorToMappableFile(). Buffers written to it are
+// padded to kMappableAlignment.
+class MappableOutputFile : public std::ofstream {
+ public:
+  explicit MappableOutputFile(const char* filePath)
+      : std::ofstream(filePath, std::ofstream::binary) {}
+};
+
+// A file mapped read-only into memory. The mapping is kept until the last
+// buffer viewing it is released.
+class MappedFile {
+ public:
+  explicit MappedFile(const char* filePath) {
+    const int fd = ::open(filePath, O_RDONLY);
+    VELOX_CHECK_GE(fd, 0, "Cannot open file: {}", filePath);
+    struct stat stats;
+    if (::fstat(fd, &stats) != 0) {
+      ::close(fd);
+      VELOX_FAIL("Cannot stat file: {}", filePath);
+    }
+    size_ = stats.st_size;
+    void* data = size_ == 0
+        ? nullptr
+        : ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    VELOX_CHECK(data != MAP_FAILED, "Cannot map file: {}", filePath);
+    data_ = static_cast<char*>(data);
+  }
+
+  ~MappedFile() {
+    if (data_ != nullptr) {
+      ::munmap(data_, size_);
+    }
+  }
+
+  char* data() const {
+    return data_;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+ private:
+  char* data_{nullptr};
+  size_t size_{0};
+};
+
+// Releaser of a BufferView over a MappedFile. Keeps the mapping alive.
+class MappedFileReleaser {
+ public:
+  explicit MappedFileReleaser(std::shared_ptr<const MappedFile> file)
+      : file_(std::move(file)) {}
+
+  void addRef() const {}
+
+  void release() const {}
+
+ private:
+  const std::shared_ptr<const MappedFile> file_;
+};
+
+// Stream buffer reading a MappedFile. Lets readBuffer() return views of the
+// mapping instead of copies.
+class MappedFileStreamBuf : public std::streambuf {
+ public:
+  explicit MappedFileStreamBuf(std::shared_ptr<const MappedFile> file)
+      : file_(std::move(file)) {
+    setg(file_->data(), file_->data(), file_->data() + file_->size());
+  }
+
+  // Returns a view of the next 'size' bytes and skips them.
+  BufferPtr nextView(int32_t size) {
+    VELOX_CHECK_LE(size, egptr() - gptr(), "Mapped buffer past end of file");
+    auto buffer = BufferView<MappedFileReleaser>::create(
+        reinterpret_cast<const uint8_t*>(gptr()),
+        size,
+        MappedFileReleaser(file_));
+    gbump(size);
+    return buffer;
+  }
+
+ protected:
+  pos_type seekoff(
+      off_type offset,
+      std::ios_base::seekdir dir,
+      std::ios_base::openmode /*which*/) override {
+    char* target = dir == std::ios_base::beg ? eback() + offset
+        : dir == std::ios_base::cur          ? gptr() + offset
+                                             : egptr() + offset;
+    if (target < eback() || target > egptr()) {
+      return pos_type(off_type(-1));
+    }
+    setg(eback(), target, egptr());
+    return pos_type(target - eback());
+  }
+
+  pos_type seekpos(pos_type position, std::ios_base::openmode which) override {
+    return seekoff(off_type(position), std::ios_base::beg, which);
+  }
+
+ private:
+  const std::shared_ptr<const MappedFile> file_;
+};
+
+int64_t mappablePadding(int64_t position) {
+  VELOX_CHECK_GE(position, 0);
+  return bits::roundUp(position, kMappableAlignment) - position;
+}
+
+// Pads 'out' to kMappableAlignment if it is a mappable file.
+void writeMappablePadding(std::ostream& out) {
+  if (dynamic_cast<MappableOutputFile*>(&out) != nullptr) {
+    static const char kZeros[kMappableAlignment] = {};
+    out.write(kZeros, mappablePadding(out.tellp()));
+  }
+}
+
 template <typename T>
 void write(const T& value, std::ostream& out) {
   out.write(reinterpret_cast<const char*>(&value), sizeof(T));
@@ -113,6 +242,7 @@ Encoding readEncoding(std::istream& in) {
 /// provided output stream. 'buffer' must be non-null.
 void writeBuffer(const BufferPtr& buffer, std::ostream& out) {
   write<int32_t>(buffer->size(), out);
+  writeMappablePadding(out);
   out.write(buffer->as<char>(), buffer->size());
 }
 
@@ -128,9 +258,19 @@ void writeOptionalBuffer(const BufferPtr& buffer, std::ostream& out) {
 }
 
 /// Deserializes a BufferPtr serialized by 'writeBuffer' from the provided
-/// input stream.
-BufferPtr readBuffer(std::istream& in, memory::MemoryPool* pool) {
+/// input stream. When reading a mapped file, returns a view of the mapping if
+/// 'allowView' is true.
+BufferPtr readBuffer(
+    std::istream& in,
+    memory::MemoryPool* pool,
+    bool allowView = true) {
   auto numBytes = read<int32_t>(in);
+  if (auto* mapped = dynamic_cast<MappedFileStreamBuf*>(in.rdbuf())) {
+    in.ignore(mappablePadding(in.tellg()));
+    if (allowView) {
+      return mapped->nextView(numBytes);
+    }
+  }
   auto buffer = AlignedBuffer::allocate<char>(numBytes, pool);
   auto rawBuffer = buffer->asMutable<char>();
   in.read(rawBuffer, numBytes);
@@ -139,10 +279,13 @@ BufferPtr readBuffer(std::istream& in, memory::MemoryPool* pool) {
 
 /// Deserializes a optional BufferPtr serialized by 'writeOptionalBuffer' from
 /// the provided input stream.
-BufferPtr readOptionalBuffer(std::istream& in, memory::MemoryPool* pool) {
+BufferPtr readOptionalBuffer(
+    std::istream& in,
+    memory::MemoryPool* pool,
+    bool allowView = true) {
   bool hasBuffer = read<bool>(in);
   if (hasBuffer) {
-    return readBuffer(in, pool);
+    return readBuffer(in, pool, allowView);
   }
 
   return nullptr;
@@ -230,6 +373,7 @@ void writeStringViews(
     const std::vector<BufferPtr>& stringBuffers,
     std::ostream& out) {
   write<int32_t>(strings->size(), out);
+  writeMappablePadding(out);
 
   // Compute the offset prefix sum in the stringBuffer based on their original
   // position in stringBuffers
@@ -361,12 +505,14 @@ VectorPtr readFlatVector(
   // Nulls buffer.
   BufferPtr nulls = readOptionalBuffer(in, pool);
 
-  // Values buffer.
-  BufferPtr values = readOptionalBuffer(in, pool);
+  // Values buffer. StringViews are rewritten below, so they are copied from a
+  // mapped file.
+  const bool isString = type->isVarchar() || type->isVarbinary();
+  BufferPtr values = readOptionalBuffer(in, pool, !isString);
 
   // String buffers.
   std::vector<BufferPtr> stringBuffers;
-  if (type->isVarchar() || type->isVarbinary()) {
+  if (isString) {
     int32_t numStringBuffers = read<int32_t>(in);
     for (auto i = 0; i < numStringBuffers; ++i) {
       stringBuffers.push_back(readBuffer(in, pool));
@@ -719,6 +865,13 @@ void saveVectorToFile(const BaseVector* vector, const char* filePath) {
   outputFile.close();
 }
 
+void saveVectorToMappableFile(const BaseVector* vector, const char* filePath) {
+  MappableOutputFile outputFile(filePath);
+  outputFile.write(kMappableMagic.data(), kMappableMagic.size());
+  saveVector(*vector, outputFile);
+  outputFile.close();
+}
+
 void saveStringToFile(const std::string& content, const char* filePath) {
   std::ofstream outputFile(filePath, std::ofstream::binary);
   outputFile.write(content.data(), content.size());
@@ -769,6 +922,22 @@ VectorPtr restoreVectorFromFile(
   return result;
 }
 
+VectorPtr restoreVectorFromMappedFile(
+    const char* filePath,
+    memory::MemoryPool* pool) {
+  auto file = std::make_shared<const MappedFile>(filePath);
+  VELOX_CHECK(
+      file->size() >= kMappableMagic.size() &&
+          std::string_view(file->data(), kMappableMagic.size()) ==
+              kMappableMagic,
+      "Not a file written by saveVectorToMappableFile: {}",
+      filePath);
+  MappedFileStreamBuf streamBuf(std::move(file));
+  std::istream in(&streamBuf);
+  in.ignore(kMappableMagic.size());
+  return restoreVector(in, pool);
+}
+
 std::string restoreStringFromFile(const char* filePath) {
   std::ifstream inputFile(filePath, std::ifstream::binary);
   VELOX_CHECK(!inputFile.fail(), "Cannot open file: {}", filePath);
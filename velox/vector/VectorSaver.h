@@ -39,6 +39,10 @@ void saveVector(const BaseVector& vector, std::ostream& out);
 /// if any error occurs while writing.
 void saveVectorToFile(const BaseVector* vector, const char* filePath);
 
+/// Same as saveVectorToFile() but pads buffers so that the file can be read
+/// back with restoreVectorFromMappedFile().
+void saveVectorToMappableFile(const BaseVector* vector, const char* filePath);
+
 /// Writes 'content' to a new file in 'filePath'. Exceptions will be thrown if
 /// any error occurs while writing.
 void saveStringToFile(const std::string& content, const char* filePath);
@@ -50,6 +54,14 @@ VectorPtr restoreVector(std::istream& in, memory::MemoryPool* pool);
 /// method call
 VectorPtr restoreVectorFromFile(const char* filePath, memory::MemoryPool* pool);
 
+/// Reads a vector from a file stored by saveVectorToMappableFile(). The file is
+/// memory mapped and the nulls, values, string, offsets, sizes and indices
+/// buffers are read-only views of the mapping, which stays mapped while any of
+/// them is referenced. Only the StringViews of string vectors are copied.
+VectorPtr restoreVectorFromMappedFile(
+    const char* filePath,
+    memory::MemoryPool* pool);
+
 /// Reads a string from a file stored by saveStringToFile() method
 std::string restoreStringFromFile(const char* filePath);
 
@@ -81,6 +81,17 @@ void IterativeVectorSerializer::append(const RowVectorPtr& vector) {
   append(vector, folly::Range(&allRows, 1), scratch);
 }
 
+void IterativeVectorSerializer::appendScatter(
+    const RowVectorPtr& vector,
+    folly::Range<IterativeVectorSerializer* const*> serializers,
+    folly::Range<const folly::Range<const vector_size_t*>*> rows,
+    Scratch& scratch) {
+  VELOX_CHECK_EQ(serializers.size(), rows.size());
+  for (auto i = 0; i < serializers.size(); ++i) {
+    serializers[i]->append(vector, rows[i], scratch);
+  }
+}
+
 void BatchVectorSerializer::serialize(
     const RowVectorPtr& vector,
     OutputStream* stream) {
@@ -216,6 +227,25 @@ void VectorStreamGroup::append(
   serializer_->append(unsafeRow, rows, sizes);
 }
 
+// static
+void VectorStreamGroup::appendScatter(
+    const RowVectorPtr& vector,
+    folly::Range<VectorStreamGroup* const*> groups,
+    folly::Range<const folly::Range<const vector_size_t*>*> rows,
+    Scratch& scratch) {
+  VELOX_CHECK_EQ(groups.size(), rows.size());
+  if (groups.empty()) {
+    return;
+  }
+  std::vector<IterativeVectorSerializer*> serializers;
+  serializers.reserve(groups.size());
+  for (auto* group : groups) {
+    VELOX_CHECK_EQ(group->serde_, groups[0]->serde_);
+    serializers.push_back(group->serializer_.get());
+  }
+  serializers[0]->appendScatter(vector, serializers, rows, scratch);
+}
+
 void VectorStreamGroup::flush(OutputStream* out) {
   serializer_->flush(out);
 }
@@ -301,15 +331,18 @@ folly::IOBuf rowVectorToIOBuf(
     vector_size_t rangeEnd,
     memory::MemoryPool& pool,
     VectorSerde* serde) {
-  auto streamGroup = std::make_unique<VectorStreamGroup>(&pool, serde);
-  streamGroup->createStreamTree(asRowType(rowVector->type()), rangeEnd);
+  if (serde == nullptr) {
+    serde = getVectorSerde();
+  }
+  // The batch serializer writes the rows straight to 'stream' instead of
+  // first copying them to per column streams and then flushing these.
+  auto serializer = serde->createBatchSerializer(&pool);
 
   IndexRange range{0, rangeEnd};
   Scratch scratch;
-  streamGroup->append(rowVector, folly::Range<IndexRange*>(&range, 1), scratch);
-
   IOBufOutputStream stream(pool);
-  streamGroup->flush(&stream);
+  serializer->serialize(
+      rowVector, folly::Range<const IndexRange*>(&range, 1), scratch, &stream);
   return std::move(*stream.getIOBuf());
 }
 
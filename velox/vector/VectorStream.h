@@ -105,6 +105,17 @@ class IterativeVectorSerializer {
     return false;
   }
 
+  /// Appends 'rows[i]' of 'vector' to 'serializers[i]' for each i. The
+  /// serializers must be of the kind of 'this' and for the type of 'vector'.
+  /// A serializer may write one column at a time into all 'serializers',
+  /// which keeps the column in cache when each serializer gets few rows. The
+  /// default appends the rows to each serializer in turn.
+  virtual void appendScatter(
+      const RowVectorPtr& vector,
+      folly::Range<IterativeVectorSerializer* const*> serializers,
+      folly::Range<const folly::Range<const vector_size_t*>*> rows,
+      Scratch& scratch);
+
   /// Returns the maximum serialized size of the data previously added via
   /// 'append' methods. Can be used to allocate buffer of exact or maximum size
   /// before calling 'flush'.
@@ -384,6 +395,13 @@ class VectorStreamGroup : public StreamArena {
       : StreamArena(pool),
         serde_(serde != nullptr ? serde : getVectorSerde()) {}
 
+  VectorStreamGroup(
+      memory::MemoryPool* pool,
+      VectorSerde* serde,
+      const StreamArena::Options& arenaOptions)
+      : StreamArena(pool, arenaOptions),
+        serde_(serde != nullptr ? serde : getVectorSerde()) {}
+
   void createStreamTree(
       RowTypePtr type,
       int32_t numRows,
@@ -454,6 +472,15 @@ class VectorStreamGroup : public StreamArena {
       const folly::Range<const vector_size_t*>& rows,
       const std::vector<vector_size_t>& sizes);
 
+  /// Appends 'rows[i]' of 'vector' to 'groups[i]' for each i. The groups must
+  /// have the same serde and stream trees for the type of 'vector'. See
+  /// IterativeVectorSerializer::appendScatter.
+  static void appendScatter(
+      const RowVectorPtr& vector,
+      folly::Range<VectorStreamGroup* const*> groups,
+      folly::Range<const folly::Range<const vector_size_t*>*> rows,
+      Scratch& scratch);
+
   // Writes the contents to 'stream' in wire format.
   void flush(OutputStream* stream);
 
@@ -310,6 +310,9 @@ const char* exportArrowFormatStr(
     // Complex/nested types.
     case TypeKind::ARRAY:
       static_assert(sizeof(vector_size_t) == 4);
+      if (options.exportToArrayView) {
+        return "+vl"; // list view
+      }
       return "+l"; // list
     case TypeKind::MAP:
       return "+m"; // map
@@ -732,7 +735,7 @@ void exportViews(
     ArrowArray& out,
     memory::MemoryPool* pool,
     VeloxToArrowBridgeHolder& holder) {
-  auto stringBuffers = vec.stringBuffers();
+  const auto& stringBuffers = vec.stringBuffers();
   size_t numStringBuffers = stringBuffers.size();
   // Buffers for nulls, values, variadic_buffer_sizes, and all stringBuffers.
   size_t numBuffers = 3 + numStringBuffers;
@@ -784,19 +787,31 @@ void exportViews(
             reinterpret_cast<uint64_t*>(&out.buffers[2])[rhs];
       });
 
-  auto utf8Views = reinterpret_cast<const uint64_t*>(out.buffers[1]);
+  // The views are written to a new buffer since the values of 'vec' may be
+  // shared with other consumers and must not be rewritten in place.
+  auto views = AlignedBuffer::allocate<StringView>(out.length, pool);
+  holder.setBuffer(1, views);
+  auto* utf8Views = views->asMutable<uint32_t>();
+  const auto* rawValues = vec.rawValues();
   int32_t bufferIdxCache = 0;
   uint64_t bufferAddrCache = 0;
+  bool cacheValid = false;
 
+  vector_size_t j = 0; // index into utf8Views
   rows.apply([&](vector_size_t i) {
-    auto view = const_cast<uint32_t*>(
-        reinterpret_cast<const uint32_t*>(&utf8Views[2 * i]));
-    if (!vec.isNullAt(i) && view[0] > 12) {
-      const uint64_t currAddr = *reinterpret_cast<uint64_t*>(&view[2]);
+    auto* view = utf8Views + 4 * j++;
+    if (vec.isNullAt(i)) {
+      memset(view, 0, sizeof(StringView));
+      return;
+    }
+    memcpy(view, &rawValues[i], sizeof(StringView));
+    if (view[0] > StringView::kInlineSize) {
+      const uint64_t currAddr =
+          reinterpret_cast<uint64_t>(rawValues[i].data());
       // 2. Search for correct index with the buffer-pointer as key. Cache the
       // found buffer's address and index in bufferAddrCache and bufferIdxCache
       // respectively
-      if (i == 0 ||
+      if (!cacheValid || currAddr < bufferAddrCache ||
           (currAddr - bufferAddrCache) >
               rawVariadicBufferSizes[bufferIdxCache]) {
         auto it = std::prev(std::upper_bound(
@@ -808,6 +823,7 @@ void exportViews(
             }));
         bufferAddrCache = (reinterpret_cast<uint64_t*>(&out.buffers[2]))[*it];
         bufferIdxCache = *it;
+        cacheValid = true;
       }
       view[2] = bufferIdxCache;
       view[3] = currAddr - bufferAddrCache;
@@ -873,7 +889,6 @@ void exportFlat(
     case TypeKind::VARCHAR:
     case TypeKind::VARBINARY:
       if (options.exportToStringView) {
-        exportValues(vec, rows, options, out, pool, holder);
         exportViews(
             *vec.asUnchecked<FlatVector<StringView>>(),
             rows,
@@ -980,6 +995,53 @@ void exportOffsets(
   out.n_buffers = 2;
 }
 
+// Exports the offsets and sizes of 'vec' as the buffers of an Arrow ListView.
+// The elements are exported as a whole so that the offsets and sizes of 'vec'
+// can be shared without copy when all rows are exported.
+void exportListViewOffsets(
+    const ArrayVector& vec,
+    const Selection& rows,
+    ArrowArray& out,
+    memory::MemoryPool* pool,
+    VeloxToArrowBridgeHolder& holder) {
+  VELOX_CHECK_GE(vec.size(), rows.count());
+  out.n_buffers = 3;
+
+  // Null rows may carry arbitrary offsets and sizes in Velox while Arrow
+  // requires them to be within the child array.
+  const auto numElements = vec.elements()->size();
+  bool inBounds = true;
+  for (vector_size_t i = 0; i < vec.size() && inBounds; ++i) {
+    inBounds = vec.sizeAt(i) == 0 ||
+        (vec.offsetAt(i) >= 0 &&
+         vec.offsetAt(i) + vec.sizeAt(i) <= numElements);
+  }
+  if (!rows.changed() && inBounds) {
+    holder.setBuffer(1, vec.offsets());
+    holder.setBuffer(2, vec.sizes());
+    return;
+  }
+
+  auto offsets = AlignedBuffer::allocate<vector_size_t>(out.length, pool);
+  auto sizes = AlignedBuffer::allocate<vector_size_t>(out.length, pool);
+  auto* rawOffsets = offsets->asMutable<vector_size_t>();
+  auto* rawSizes = sizes->asMutable<vector_size_t>();
+  vector_size_t j = 0; // index into rawOffsets and rawSizes
+  rows.apply([&](vector_size_t i) {
+    if (vec.isNullAt(i)) {
+      rawOffsets[j] = 0;
+      rawSizes[j] = 0;
+    } else {
+      rawOffsets[j] = vec.offsetAt(i);
+      rawSizes[j] = vec.sizeAt(i);
+    }
+    ++j;
+  });
+  VELOX_DCHECK_EQ(j, out.length);
+  holder.setBuffer(1, offsets);
+  holder.setBuffer(2, sizes);
+}
+
 void exportArrays(
     const ArrayVector& vec,
     const Selection& rows,
@@ -988,7 +1050,11 @@ void exportArrays(
     memory::MemoryPool* pool,
     VeloxToArrowBridgeHolder& holder) {
   Selection childRows(vec.elements()->size());
-  exportOffsets(vec, rows, out, pool, holder, childRows);
+  if (options.exportToArrayView) {
+    exportListViewOffsets(vec, rows, out, pool, holder);
+  } else {
+    exportOffsets(vec, rows, out, pool, holder, childRows);
+  }
   holder.resizeChildren(1);
   exportToArrowImpl(
       *vec.elements()->loadedVector(),
@@ -1317,6 +1383,15 @@ TypePtr importFromArrowImpl(
           VELOX_CHECK_NOT_NULL(arrowSchema.children[0]);
           return ARRAY(importFromArrow(*arrowSchema.children[0]));
 
+        // List view with 32 bit offsets and sizes.
+        case 'v':
+          if (format[2] == 'l') {
+            VELOX_CHECK_EQ(arrowSchema.n_children, 1);
+            VELOX_CHECK_NOT_NULL(arrowSchema.children[0]);
+            return ARRAY(importFromArrow(*arrowSchema.children[0]));
+          }
+          break;
+
         // Map.
         case 'm': {
           VELOX_CHECK_EQ(arrowSchema.n_children, 1);
@@ -1618,12 +1693,24 @@ ArrayVectorPtr createArrayVector(
     bool isViewer,
     WrapInBufferViewFunc wrapInBufferView) {
   static_assert(sizeof(vector_size_t) == sizeof(int32_t));
-  VELOX_CHECK_EQ(arrowArray.n_buffers, 2);
   VELOX_CHECK_EQ(arrowArray.n_children, 1);
-  auto offsets = wrapInBufferView(
-      arrowArray.buffers[1], (arrowArray.length + 1) * sizeof(vector_size_t));
-  auto sizes =
-      computeSizes(offsets->as<vector_size_t>(), arrowArray.length, pool);
+  BufferPtr offsets;
+  BufferPtr sizes;
+  if (arrowSchema.format[1] == 'v') {
+    // A list view carries both offsets and sizes, which are used in place.
+    VELOX_CHECK_EQ(arrowArray.n_buffers, 3);
+    offsets = wrapInBufferView(
+        arrowArray.buffers[1], arrowArray.length * sizeof(vector_size_t));
+    sizes = wrapInBufferView(
+        arrowArray.buffers[2], arrowArray.length * sizeof(vector_size_t));
+  } else {
+    VELOX_CHECK_EQ(arrowArray.n_buffers, 2);
+    offsets = wrapInBufferView(
+        arrowArray.buffers[1],
+        (arrowArray.length + 1) * sizeof(vector_size_t));
+    sizes =
+        computeSizes(offsets->as<vector_size_t>(), arrowArray.length, pool);
+  }
   auto elements = importFromArrowImpl(
       *arrowSchema.children[0], *arrowArray.children[0], pool, isViewer);
   return std::make_shared<ArrayVector>(
@@ -40,6 +40,9 @@ struct ArrowOptions {
   std::optional<std::string> timestampTimeZone{std::nullopt};
   // Export VARCHAR and VARBINARY to Arrow 15 StringView format
   bool exportToStringView = false;
+  // Export ARRAY to Arrow ListView format, which shares the offsets and sizes
+  // of the ArrayVector instead of compacting them.
+  bool exportToArrayView = false;
 };
 
 namespace facebook::velox {
@@ -843,6 +843,72 @@ TEST_F(ArrowBridgeArrayExportTest, arrayNested) {
   EXPECT_EQ(values.Value(1), 1);
 }
 
+TEST_F(ArrowBridgeArrayExportTest, arrayView) {
+  auto elements = vectorMaker_.flatVector<int64_t>({1, 2, 3, 4, 5});
+  auto offsets = makeBuffer<vector_size_t>({3, 0, 1});
+  auto sizes = makeBuffer<vector_size_t>({2, 2, 0});
+  auto vec = std::make_shared<ArrayVector>(
+      pool_.get(), ARRAY(BIGINT()), nullptr, 3, offsets, sizes, elements);
+  ArrowOptions options{.exportToArrayView = true};
+
+  // Offsets, sizes and elements are shared with the Velox vector.
+  ArrowArray data;
+  velox::exportToArrow(vec, data, pool_.get(), options);
+  ASSERT_EQ(data.n_buffers, 3);
+  EXPECT_EQ(data.buffers[1], offsets->as<void>());
+  EXPECT_EQ(data.buffers[2], sizes->as<void>());
+  EXPECT_EQ(data.children[0]->buffers[1], elements->values()->as<void>());
+  data.release(&data);
+
+  auto array = toArrow(vec, options, pool_.get());
+  ASSERT_OK(array->ValidateFull());
+  ASSERT_EQ(*array->type(), *arrow::list_view(arrow::int64()));
+  auto& listArray = static_cast<const arrow::ListViewArray&>(*array);
+  EXPECT_EQ(listArray.value_offset(0), 3);
+  EXPECT_EQ(listArray.value_length(0), 2);
+  EXPECT_EQ(listArray.value_offset(1), 0);
+  EXPECT_EQ(listArray.value_length(1), 2);
+  EXPECT_EQ(listArray.value_length(2), 0);
+  ASSERT_EQ(listArray.values()->length(), 5);
+
+  // Null rows with out of range offsets are exported with a copy.
+  vec->setOffsetAndSize(2, 100, 7);
+  vec->setNull(2, true);
+  array = toArrow(vec, options, pool_.get());
+  ASSERT_OK(array->ValidateFull());
+  EXPECT_EQ(array->null_count(), 1);
+
+  ArrowSchema schema;
+  velox::exportToArrow(vec, schema, options);
+  EXPECT_STREQ(schema.format, "+vl");
+  velox::exportToArrow(vec, data, pool_.get(), options);
+  auto result = importFromArrowAsViewer(schema, data, pool_.get());
+  test::assertEqualVectors(vec, result);
+  schema.release(&schema);
+  data.release(&data);
+}
+
+TEST_F(ArrowBridgeArrayExportTest, stringViewKeepsSource) {
+  std::vector<std::string> strings = {
+      "a string long enough not to be inlined",
+      "short",
+      "another string long enough not to be inlined",
+  };
+  auto vec = vectorMaker_.flatVector<StringView>(
+      strings.size(), [&](auto row) { return StringView(strings[row]); });
+  auto copy = BaseVector::copy(*vec);
+  ArrowOptions options{.exportToStringView = true};
+
+  // Exporting Arrow views must not rewrite the pointers of the source views.
+  auto array = toArrow(vec, options, pool_.get());
+  ASSERT_OK(array->ValidateFull());
+  test::assertEqualVectors(copy, vec);
+  auto& views = static_cast<const arrow::StringViewArray&>(*array);
+  for (auto i = 0; i < strings.size(); ++i) {
+    EXPECT_EQ(views.GetView(i), strings[i]);
+  }
+}
+
 TEST_F(ArrowBridgeArrayExportTest, mapSimple) {
   auto allOnes = [](vector_size_t) { return 1; };
   auto vec =
@@ -1292,6 +1292,43 @@ TEST_F(DecodedVectorTest, emptyRowsMultiDict) {
   }
 }
 
+TEST_F(DecodedVectorTest, multiDictContiguousRows) {
+  const vector_size_t size = 1'000;
+  auto base = makeFlatVector<int64_t>(size, [](auto row) { return row; });
+  auto inner = BaseVector::wrapInDictionary(
+      makeNulls(size, nullEvery(7)),
+      makeIndices(size, [](auto row) { return (row * 3) % size; }),
+      size,
+      base);
+  auto outer = wrapInDictionary(makeIndicesInReverse(size), size, inner);
+
+  auto expectedAt = [&](auto row) -> std::optional<int64_t> {
+    const auto innerRow = size - 1 - row;
+    if (innerRow % 7 == 0) {
+      return std::nullopt;
+    }
+    return (innerRow * 3) % size;
+  };
+
+  // All rows, a contiguous range and a range with holes.
+  SelectivityVector range(size, false);
+  range.setValidRange(13, 977, true);
+  range.updateBounds();
+  SelectivityVector holes = range;
+  holes.setValid(500, false);
+  holes.updateBounds();
+  for (const auto& rows : {SelectivityVector(size), range, holes}) {
+    DecodedVector decoded(*outer, rows);
+    rows.applyToSelected([&](auto row) {
+      const auto expected = expectedAt(row);
+      ASSERT_EQ(decoded.isNullAt(row), !expected.has_value()) << row;
+      if (expected.has_value()) {
+        ASSERT_EQ(decoded.valueAt<int64_t>(row), expected.value()) << row;
+      }
+    });
+  }
+}
+
 TEST_F(DecodedVectorTest, flatNulls) {
   // Flat vector with no nulls.
   auto flatNoNulls = makeFlatVector<int64_t>(100, [](auto row) { return row; });
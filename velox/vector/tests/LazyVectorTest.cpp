@@ -688,11 +688,42 @@ TEST_F(LazyVectorTest, runtimeStats) {
   std::sort(stats.begin(), stats.end(), [](auto& x, auto& y) {
     return x.first < y.first;
   });
-  ASSERT_EQ(stats.size(), 3);
+  ASSERT_EQ(stats.size(), 5);
   ASSERT_EQ(stats[0].first, LazyVector::kCpuNanos);
   ASSERT_GE(stats[0].second.value, 0);
-  ASSERT_EQ(stats[1].first, LazyVector::kInputBytes);
-  ASSERT_GE(stats[1].second.value, 0);
-  ASSERT_EQ(stats[2].first, LazyVector::kWallNanos);
+  ASSERT_EQ(stats[1].first, LazyVector::kFullLoadRows);
+  ASSERT_EQ(stats[1].second.value, 10);
+  ASSERT_EQ(stats[2].first, LazyVector::kInputBytes);
   ASSERT_GE(stats[2].second.value, 0);
+  ASSERT_EQ(stats[3].first, LazyVector::kLoadedRows);
+  ASSERT_EQ(stats[3].second.value, 10);
+  ASSERT_EQ(stats[4].first, LazyVector::kWallNanos);
+  ASSERT_GE(stats[4].second.value, 0);
+}
+
+TEST_F(LazyVectorTest, runtimeStatsPartialLoad) {
+  TestRuntimeStatWriter writer;
+  RuntimeStatWriterScopeGuard guard(&writer);
+  auto lazy = std::make_shared<LazyVector>(
+      pool_.get(),
+      INTEGER(),
+      10,
+      std::make_unique<test::SimpleVectorLoader>([&](auto rows) {
+        return makeFlatVector<int32_t>(rows.back() + 1, folly::identity);
+      }));
+  SelectivityVector rows(10, false);
+  rows.setValid(2, true);
+  rows.setValid(7, true);
+  rows.updateBounds();
+  LazyVector::ensureLoadedRows(lazy, rows);
+  ASSERT_TRUE(lazy->isLoaded());
+
+  int64_t loadedRows = 0;
+  for (const auto& [name, counter] : writer.stats()) {
+    ASSERT_NE(name, LazyVector::kFullLoadRows);
+    if (name == LazyVector::kLoadedRows) {
+      loadedRows += counter.value;
+    }
+  }
+  ASSERT_EQ(loadedRows, 2);
 }
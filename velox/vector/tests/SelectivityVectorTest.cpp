@@ -144,6 +144,21 @@ TEST(SelectivityVectorTest, updateBounds) {
   ASSERT_NO_FATAL_FAILURE(setAndAssert(0, true));
 }
 
+TEST(SelectivityVectorTest, isContiguous) {
+  SelectivityVector rows(100);
+  EXPECT_TRUE(rows.isContiguous());
+
+  rows.setValidRange(0, 10, false);
+  rows.setValidRange(90, 100, false);
+  rows.updateBounds();
+  EXPECT_FALSE(rows.isAllSelected());
+  EXPECT_TRUE(rows.isContiguous());
+
+  rows.setValid(50, false);
+  rows.updateBounds();
+  EXPECT_FALSE(rows.isContiguous());
+}
+
 TEST(SelectivityVectorTest, merge) {
   const size_t vectorSize = 10;
   SelectivityVector vector(vectorSize);
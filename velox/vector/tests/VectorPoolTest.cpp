@@ -137,6 +137,21 @@ TEST_F(VectorPoolTest, vectorRecycler) {
   }
 }
 
+TEST_F(VectorPoolTest, otherPool) {
+  VectorPool vectorPool(pool());
+  auto otherPool = rootPool_->addLeafChild("other");
+
+  // A vector allocated from another pool is not recycled.
+  VectorPtr vector = BaseVector::create(BIGINT(), 1'000, otherPool.get());
+  ASSERT_FALSE(vectorPool.release(vector));
+  ASSERT_NE(vector, nullptr);
+
+  vector = BaseVector::create(BIGINT(), 1'000, pool());
+  auto* vectorPtr = vector.get();
+  ASSERT_TRUE(vectorPool.release(vector));
+  ASSERT_EQ(vectorPool.get(BIGINT(), 1'000).get(), vectorPtr);
+}
+
 TEST_F(VectorPoolTest, customTypes) {
   VectorPool vectorPool(pool());
 
@@ -709,4 +709,53 @@ TEST_F(VectorSaverTest, multipleVectors) {
 
   ASSERT_EQ(out.str().size(), in.tellg());
 }
+
+TEST_F(VectorSaverTest, mappedFile) {
+  auto roundTrip = [&](const VectorPtr& vector) {
+    auto path = exec::test::TempFilePath::create();
+    saveVectorToMappableFile(vector.get(), path->getPath().c_str());
+    auto copy = restoreVectorFromMappedFile(path->getPath().c_str(), pool());
+    assertEqualEncodings(vector, copy);
+    return copy;
+  };
+
+  // Values and nulls of a flat vector are aligned views of the mapping.
+  auto copy = roundTrip(makeNullableFlatVector<int64_t>(
+      {1, std::nullopt, 3, 4, std::nullopt, 6, 7}));
+  ASSERT_TRUE(copy->values()->isView());
+  ASSERT_TRUE(copy->nulls()->isView());
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(copy->valuesAsVoid()) % 16, 0);
+
+  // StringViews are copied, string buffers are views.
+  copy = roundTrip(makeFlatVector<std::string>(
+      {"a", "a long string that is not inlined", "b", ""}));
+  ASSERT_FALSE(copy->values()->isView());
+  ASSERT_TRUE(copy->asFlatVector<StringView>()->stringBuffers()[0]->isView());
+
+  roundTrip(makeArrayVector<int32_t>({{1, 2}, {}, {3, 4, 5}}));
+  roundTrip(makeMapVector<int32_t, std::string>(
+      {{{1, "one string that is not inlined"}}, {{2, "two"}, {3, "three"}}}));
+  roundTrip(wrapInDictionary(
+      makeIndicesInReverse(3), makeFlatVector<int64_t>({1, 2, 3})));
+  roundTrip(makeConstant<int64_t>(7, 10));
+
+  VectorFuzzer fuzzer(fuzzerOptions(), pool(), seed_);
+  roundTrip(fuzzer.fuzz(ROW({BIGINT(), VARCHAR(), ARRAY(DOUBLE())})));
+
+  // The mapping outlives the restored vector's file path.
+  auto path = exec::test::TempFilePath::create();
+  saveVectorToMappableFile(
+      makeFlatVector<int64_t>({10, 20}).get(), path->getPath().c_str());
+  copy = restoreVectorFromMappedFile(path->getPath().c_str(), pool());
+  path.reset();
+  assertEqualVectors(makeFlatVector<int64_t>({10, 20}), copy);
+
+  // Files written by saveVectorToFile cannot be mapped.
+  path = exec::test::TempFilePath::create();
+  saveVectorToFile(
+      makeFlatVector<int64_t>({1, 2}).get(), path->getPath().c_str());
+  VELOX_ASSERT_THROW(
+      restoreVectorFromMappedFile(path->getPath().c_str(), pool()),
+      "Not a file written by saveVectorToMappableFile");
+}
 } // namespace facebook::velox::test
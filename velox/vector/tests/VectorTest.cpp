@@ -2444,6 +2444,37 @@ TEST_F(VectorTest, acquireSharedStringBuffers) {
   ASSERT_NO_THROW(flatVector->acquireSharedStringBuffers(unkownVector.get()));
 }
 
+TEST_F(VectorTest, copyRepeatedStringsFromOtherPool) {
+  auto otherPool = rootPool_->addLeafChild("other");
+  const std::string longString(1'000, 'x');
+  auto base = BaseVector::create<FlatVector<StringView>>(
+      VARCHAR(), 2, otherPool.get());
+  base->set(0, StringView(longString));
+  base->set(1, StringView("short"));
+  // Each base row is repeated 10 times, as after an unnest.
+  auto indices = makeIndices(40, [](auto row) { return (row / 10) % 2; });
+  auto source = BaseVector::wrapInDictionary(nullptr, indices, 40, base);
+
+  auto checkCopy = [&](const VectorPtr& target) {
+    test::assertEqualVectors(source, target);
+    size_t stringBytes = 0;
+    for (const auto& buffer :
+         target->asFlatVector<StringView>()->stringBuffers()) {
+      stringBytes += buffer->size();
+    }
+    // One copy per run of repeated rows instead of one per row.
+    EXPECT_EQ(stringBytes, 2 * longString.size());
+  };
+
+  auto target = BaseVector::create(VARCHAR(), 40, pool());
+  target->copy(source.get(), SelectivityVector(40), nullptr);
+  checkCopy(target);
+
+  target = BaseVector::create(VARCHAR(), 40, pool());
+  target->copy(source.get(), 0, 0, 40);
+  checkCopy(target);
+}
+
 TEST_F(VectorTest, acquireSharedStringBuffersRecursive) {
   auto vector = BaseVector::create(VARCHAR(), 100, pool());
   auto flatVector = vector->as<FlatVector<StringView>>();